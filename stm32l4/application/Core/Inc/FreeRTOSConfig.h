@@ -68,7 +68,7 @@
 #define configTICK_RATE_HZ                       ((TickType_t)1000)
 #define configMAX_PRIORITIES                     ( 56 )
 #define configMINIMAL_STACK_SIZE                 ((uint16_t)128)
-#define configTOTAL_HEAP_SIZE                    ((size_t)65535)
+#define configTOTAL_HEAP_SIZE                    ((size_t)163840)
 #define configMAX_TASK_NAME_LEN                  ( 16 )
 #define configUSE_TRACE_FACILITY                 1
 #define configUSE_16_BIT_TICKS                   0
@@ -168,6 +168,13 @@ standard names. */
 
 /* USER CODE BEGIN Defines */
 /* Section where parameter definitions can be added (for instance, to override default ones in FreeRTOS.h) */
+/* pvPortMalloc/vPortFree come from system/mem_heap.c (TLSF heap shared with LVGL),
+   configTOTAL_HEAP_SIZE sizes that pool. Remove heap_4.c again after regenerating.
+   The boot takes 64.8K of it (tasks 15.6K, LVGL with the pack fonts 49.1K, see
+   host/test/test_mem_heap.c). The pool is the largest part of .bss in the 256K RAM;
+   the other large buffers (transport windows 16.7K, UART FIFO and packets 6.8K,
+   OTA 5K, resource cache 4.7K) and _Min_Heap/_Min_Stack_Size leave about 50K free,
+   the link fails on "region RAM overflowed" otherwise. */
 /* USER CODE END Defines */
 
 #endif /* FREERTOS_CONFIG_H */
@@ -15,8 +15,11 @@
 #include "power_manager.h"
 #include "user_intf.h"
 #include "ui_control.h"
+#include "command.h"
 #include "communication.h"
 #include "main_process.h"
+#include "ota.h"
+#include "boot_mailbox.h"
 #include "app_main.h"
 
 /******************************************************************************/
@@ -49,12 +52,18 @@ system_config_t system_config;
  * @brief  Initialize the main application
  */
 void app_main_init(void) {
+    boot_mailbox_t mailbox;
+
     LOG_INFO("");
     LOG_INFO("================================================");
     LOG_INFO("---------- Application %s Version %s ----------", DEVICE_NAME, APP_VERSION);
     LOG_INFO("================================================");
     LOG_INFO("");
 
+    if (boot_mailbox_read(&mailbox) == 0) {
+        LOG_INFO("Bootloader took %lu ms, reboot cause %08lX", mailbox.boot_ms, mailbox.reboot_cause);
+    }
+
     /* Reload configuration */
     memset(&system_config, 0, sizeof(system_config_t));
     if (system_config.magic_number == MAGIC_NUMBER) {
@@ -97,7 +106,9 @@ void app_main_init(void) {
     /* Components initialization */
     power_board_on();
     user_intf_init();
+    command_init();
     communication_init();
     ui_control_init();
     main_process_init();
+    ota_init();
 }
@@ -0,0 +1,173 @@
+/*
+ *  command.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+
+#include "stm32l4xx_hal.h"
+#include "app_config.h"
+#include "log.h"
+#include "command.h"
+
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+
+typedef struct {
+    command_handler_t handler;
+    const char *name;
+    uint8_t mode;
+    command_stats_t stats;          /* Written by the task running the handler only */
+} command_entry_t;
+
+typedef struct {
+    const uint8_t *packet;
+    uint16_t length;
+    command_release_t release;
+} command_job_t;
+
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+
+static command_entry_t command_table[COMMAND_COUNT];
+
+static osMessageQueueId_t command_queue;
+static osThreadId_t command_task_handle;
+static const osThreadAttr_t command_task_attributes = {
+    .name = "command_task",
+    .priority = (osPriority_t) osPriorityLow,
+    .stack_size = 2048
+};
+
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+/*                                FUNCTIONS                                   */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+
+/*!
+ * @brief  Run a handler and account its time
+ */
+static void command_run(command_entry_t *entry, const uint8_t *packet, uint16_t length) {
+    uint32_t start = DWT->CYCCNT;
+    int ret = entry->handler(&packet[1], length - 1);
+    uint32_t elapsed_us = (DWT->CYCCNT - start) / (SystemCoreClock / 1000000);
+
+    entry->stats.count++;
+    entry->stats.total_us += elapsed_us;
+    if (ret != 0) {
+        entry->stats.errors++;
+        LOG_ERR("Command %s failed %d", entry->name, ret);
+    }
+
+    /* Log a slow handler each time it sets a new maximum */
+    if (elapsed_us > entry->stats.max_us) {
+        entry->stats.max_us = elapsed_us;
+        if (elapsed_us > COMMAND_SLOW_US) {
+            LOG_WARN("Command %s took %lu us", entry->name, elapsed_us);
+        }
+    }
+}
+
+/*!
+ * @brief  Task running the deferred handlers
+ */
+static void command_task(void *argument) {
+    (void) argument;
+    command_job_t job;
+
+    while (1) {
+        if (osMessageQueueGet(command_queue, &job, NULL, osWaitForever) != osOK) {
+            continue;
+        }
+
+        command_run(&command_table[job.packet[0]], job.packet, job.length);
+        if (job.release != NULL) {
+            job.release(job.packet);
+        }
+    }
+}
+
+/*!
+ * @brief  Register a command handler, at initialization only
+ */
+int command_register(uint8_t command, const char *name, command_handler_t handler, uint8_t mode) {
+    command_entry_t *entry = &command_table[command];
+
+    if (entry->handler != NULL) {
+        LOG_ERR("Command 0x%02X already registered", command);
+        return -1;
+    }
+
+    entry->name = name;
+    entry->mode = mode;
+    memset(&entry->stats, 0, sizeof(entry->stats));
+    entry->handler = handler;
+
+    return 0;
+}
+
+/*!
+ * @brief  Run or queue the handler of a packet
+ */
+int command_dispatch(const uint8_t *packet, uint16_t length, command_release_t release) {
+    command_entry_t *entry;
+
+    if (length == 0) {
+        return COMMAND_UNKNOWN;
+    }
+
+    entry = &command_table[packet[0]];
+    if (entry->handler == NULL) {
+        LOG_WARN("Unknown command 0x%02X", packet[0]);
+        return COMMAND_UNKNOWN;
+    }
+
+    if (entry->mode == COMMAND_DEFERRED) {
+        command_job_t job = { .packet = packet, .length = length, .release = release };
+
+        if (osMessageQueuePut(command_queue, &job, 0, 0) != osOK) {
+            entry->stats.dropped++;
+            LOG_WARN("Command %s dropped, queue full", entry->name);
+            return COMMAND_BUSY;
+        }
+        return COMMAND_QUEUED;
+    }
+
+    command_run(entry, packet, length);
+
+    return COMMAND_DONE;
+}
+
+/*!
+ * @brief  Get the statistics of a command
+ */
+int command_get_stats(uint8_t command, command_stats_t *stats) {
+    if (command_table[command].handler == NULL) {
+        return -1;
+    }
+    *stats = command_table[command].stats;
+
+    return 0;
+}
+
+/*!
+ * @brief  Create the command task for deferred handlers
+ */
+void command_init(void) {
+    command_queue = osMessageQueueNew(COMMAND_QUEUE_SIZE, sizeof(command_job_t), NULL);
+    command_task_handle = osThreadNew(command_task, NULL, &command_task_attributes);
+}
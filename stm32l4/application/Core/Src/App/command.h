@@ -0,0 +1,139 @@
+/*
+ *  command.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef _COMMAND_H_
+#define _COMMAND_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************************************************************/
+
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+
+#include <stdint.h>
+
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+
+/*
+ * Registry of the commands received from the ESP32, indexed by the first byte
+ * of the packet. Handlers get the payload after the command byte in place, no
+ * copy. Inline handlers run in communication_task and must be short, deferred
+ * ones run in the command task and the packet buffer is handed back with the
+ * release callback when they return.
+ */
+#define COMMAND_COUNT          (256)   /* One entry per command byte */
+#define COMMAND_QUEUE_SIZE     (4)     /* Deferred commands waiting for the command task */
+#define COMMAND_SLOW_US        (2000)  /* Log handlers running longer than this */
+
+/* Command bytes */
+enum {
+    COMMAND_SENSOR_DATA = 0x01,        /* Sensor index, reading (2 bytes LE) */
+    COMMAND_OTA_START = 0x10,          /* See ota.h */
+    COMMAND_OTA_DATA = 0x11,
+    COMMAND_OTA_END = 0x12,
+    COMMAND_OTA_ROLLBACK = 0x13,
+    COMMAND_OTA_STATUS = 0x14,         /* Sent to the ESP32 */
+    COMMAND_XFER_DATA = 0x20,          /* See transport.h */
+    COMMAND_XFER_ACK = 0x21,
+    COMMAND_XFER_SYNC = 0x22,
+};
+
+/* How a handler runs */
+enum {
+    COMMAND_INLINE = 0,
+    COMMAND_DEFERRED,
+};
+
+/* command_dispatch() results */
+enum {
+    COMMAND_BUSY = -2,                 /* Deferred queue full, command dropped */
+    COMMAND_UNKNOWN = -1,              /* No handler for this command byte */
+    COMMAND_DONE = 0,                  /* Handled inline, the packet can be reused */
+    COMMAND_QUEUED,                    /* Deferred, the packet is released later */
+};
+
+/*!
+ * @brief  Command handler
+ * @param  data: Payload after the command byte, valid until the handler returns
+ * @param  length: Payload length
+ * @retval 0 if success, negative on error
+ */
+typedef int (*command_handler_t)(const uint8_t *data, uint16_t length);
+
+/* Called with the packet given to command_dispatch() once a deferred handler returned */
+typedef void (*command_release_t)(const uint8_t *packet);
+
+typedef struct {
+    uint32_t count;                    /* Handler calls */
+    uint32_t errors;                   /* Calls returning an error */
+    uint32_t dropped;                  /* Deferred commands lost, queue full */
+    uint32_t total_us;                 /* Time spent in the handler */
+    uint32_t max_us;                   /* Longest call */
+} command_stats_t;
+
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+/*                                FUNCTIONS                                   */
+/******************************************************************************/
+
+/*!
+ * @brief  Create the command task for deferred handlers
+ * @param  None
+ * @retval None
+ */
+void command_init(void);
+
+/*!
+ * @brief  Register a command handler, at initialization only
+ * @param  command: Command byte
+ * @param  name: Name used in the logs
+ * @param  handler: Handler
+ * @param  mode: COMMAND_INLINE or COMMAND_DEFERRED
+ * @retval 0 if success, -1 if the command is already registered
+ */
+int command_register(uint8_t command, const char *name, command_handler_t handler, uint8_t mode);
+
+/*!
+ * @brief  Run or queue the handler of a packet
+ * @param  packet: Command byte followed by the payload
+ * @param  length: Packet length
+ * @param  release: Called when a deferred handler is done with the packet
+ * @retval COMMAND_DONE, COMMAND_QUEUED, COMMAND_UNKNOWN or COMMAND_BUSY
+ */
+int command_dispatch(const uint8_t *packet, uint16_t length, command_release_t release);
+
+/*!
+ * @brief  Get the statistics of a command
+ * @param  command: Command byte
+ * @param  stats: Output statistics
+ * @retval 0 if success, -1 if the command is not registered
+ */
+int command_get_stats(uint8_t command, command_stats_t *stats);
+
+/******************************************************************************/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _COMMAND_H_ */
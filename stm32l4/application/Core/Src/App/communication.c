@@ -8,19 +8,34 @@
 /*                              INCLUDE FILES                                 */
 /******************************************************************************/
 
+#include <stdatomic.h>
 #include "stm32l4xx_hal.h"
 #include "main.h"
 #include "app_config.h"
 #include "log.h"
 #include "ui_control.h"
+#include "dma_ring.h"
+#include "ring_buffer.h"
+#include "crc.h"
+#include "command.h"
 #include "communication.h"
 
 /******************************************************************************/
 /*                     EXPORTED TYPES and DEFINITIONS                         */
 /******************************************************************************/
 
-#define SOF  0xAA
-#define SOF2 0x55
+#define SOF     0xAA
+#define SOF2    0x55    /* v1 frame */
+#define SOF2_V2 0x56    /* v2 frame */
+
+/* Size of the length and checksum fields */
+#define COMM_FIELD_SIZE(version)    (((version) == COMM_FRAME_V1) ? 1 : 2)
+
+/* DMA span handed to the FIFO: FIFO position after its last byte and arrival time */
+typedef struct {
+    uint32_t position;
+    uint32_t cycles;
+} comm_rx_mark_t;
 
 /******************************************************************************/
 /*                              PRIVATE DATA                                  */
@@ -33,9 +48,27 @@ static const osThreadAttr_t communication_task_attributes = {
     .stack_size = 2048
 };
 
-static uint8_t rx_temp;    /* To read uart data from uart */
-static uart_fifo_t uart_fifo;
+static uint8_t uart_dma_buffer[COMM_DMA_RX_SIZE];    /* Written by DMA1 channel 6 in circular mode */
+static dma_ring_t uart_dma_ring;
+static uint8_t uart_fifo_data[FIFO_SIZE];
+static ring_buffer_t uart_fifo;    /* Written from the DMA interrupt, read by communication_task */
+static uint32_t uart_fifo_dropped;
+static uint32_t uart_fifo_written;  /* Total bytes written to the FIFO, interrupt only */
+static uint32_t uart_fifo_parsed;   /* Total bytes parsed from the FIFO, task only */
+static uint8_t rx_marks_data[COMM_RX_MARKS * sizeof(comm_rx_mark_t)];
+static ring_buffer_t rx_marks;      /* comm_rx_mark_t records, written with the FIFO */
+static comm_latency_stats_t comm_latency;
 static communication_rx_t comm_rx;
+static uint8_t comm_rx_buffers[COMM_RX_BUFFERS][COMM_MAX_LENGTH];
+static atomic_bool comm_rx_busy[COMM_RX_BUFFERS];   /* Held by a deferred command */
+static uint8_t comm_rx_buffer;      /* Index of comm_rx.data */
+static comm_frame_stats_t comm_stats;
+static transport_t comm_transport;  /* Bulk transfers from the ESP32, driven by communication_task */
+static osMutexId_t comm_tx_mutex;   /* Frames sent by communication_task and the command task */
+static const osMutexAttr_t comm_tx_mutex_attributes = {
+    .name = "comm_tx_mutex",
+    .attr_bits = osMutexPrioInherit
+};
 
 #if SIMULATOR
 #define SIMULATOR_MAX_LEN 16
@@ -43,6 +76,25 @@ static uint8_t simulator_rx = 0;
 static bool received_simulator = false;
 static char simulator_buf[SIMULATOR_MAX_LEN + 1];
 static uint8_t simulator_length = 0;
+
+typedef struct {
+    const char *name;
+    void (*handler)(const char *arg);
+} simulator_command_t;
+
+static void simulator_main(const char *arg);
+static void simulator_tap(const char *arg);
+static void simulator_pressure(const char *arg);
+static void simulator_temperature(const char *arg);
+static void simulator_sensitivity(const char *arg);
+
+static const simulator_command_t simulator_commands[] = {
+    { "MAIN", simulator_main },
+    { "TAP",  simulator_tap },
+    { "PRES", simulator_pressure },
+    { "TEMP", simulator_temperature },
+    { "SENS", simulator_sensitivity },
+};
 #endif
 
 /******************************************************************************/
@@ -75,6 +127,7 @@ void HAL_UART_RxCpltCallback(UART_HandleTypeDef *huart)
                 simulator_buf[simulator_length] = '\0';
                 received_simulator = true;
                 simulator_length = 0;
+                osThreadFlagsSet(communication_task_handle, COMM_RX_FLAG);
             }
         }
         else if (!received_simulator) {
@@ -85,14 +138,61 @@ void HAL_UART_RxCpltCallback(UART_HandleTypeDef *huart)
         HAL_UART_Receive_IT(&huart1, (uint8_t *)&simulator_rx, 1);
     }
 #endif
+}
+
+/*!
+ * @brief  Copy a span received by DMA to the FIFO
+ */
+static void communication_rx_span(const uint8_t *data, uint16_t length, void *arg) {
+    (void) arg;
+    uint32_t written = ring_buffer_write(&uart_fifo, data, length);
+
+    /* FIFO full, drop the rest */
+    uart_fifo_dropped += length - written;
+    if (written == 0) {
+        return;
+    }
+
+    /* Without a free mark the span is timed with the next one */
+    uart_fifo_written += written;
+    comm_rx_mark_t mark = { .position = uart_fifo_written, .cycles = DWT->CYCCNT };
+    if (ring_buffer_free(&rx_marks) >= sizeof(mark)) {
+        ring_buffer_write(&rx_marks, (const uint8_t *) &mark, sizeof(mark));
+    }
 
+    osThreadFlagsSet(communication_task_handle, COMM_RX_FLAG);
+}
+
+/*!
+ * @brief  Start the circular DMA reception on USART2
+ */
+static void communication_start_rx(void) {
+    dma_ring_reset(&uart_dma_ring);
+    HAL_UARTEx_ReceiveToIdle_DMA(&huart2, uart_dma_buffer, COMM_DMA_RX_SIZE);
+}
+
+/**
+  * @brief  Reception event callback (half transfer, transfer complete or idle line)
+  * @param  huart UART handle.
+  * @param  Size Number of bytes in the DMA buffer from its start
+  * @retval None
+  */
+void HAL_UARTEx_RxEventCallback(UART_HandleTypeDef *huart, uint16_t Size)
+{
     if (huart->Instance == USART2) {
-        if (uart_fifo.count < FIFO_SIZE) {
-            uart_fifo.data[uart_fifo.head] = rx_temp;
-            uart_fifo.head = (uart_fifo.head + 1) % FIFO_SIZE;
-            uart_fifo.count++;
-        }
-        HAL_UART_Receive_IT(&huart2, (uint8_t *)&rx_temp, 1);
+        dma_ring_update(&uart_dma_ring, Size, communication_rx_span, NULL);
+    }
+}
+
+/**
+  * @brief  UART error callback, the HAL stops the DMA on overrun/framing errors
+  * @param  huart UART handle.
+  * @retval None
+  */
+void HAL_UART_ErrorCallback(UART_HandleTypeDef *huart)
+{
+    if (huart->Instance == USART2) {
+        communication_start_rx();
     }
 }
 
@@ -109,86 +209,356 @@ static uint8_t calculate_checksum(uint8_t *data, int size) {
 }
 
 /*!
- * @brief  Check and handle rx data
+ * @brief  Give back a packet buffer held by a deferred command
  */
-static bool communication_process(uint8_t c) {
-    switch (comm_rx.state) {
-        case COMM_IDLE_STATE:
-            if (c == SOF) {
-                comm_rx.state = COMM_SOF_STATE;
-            }
+static void communication_release(const uint8_t *packet) {
+    for (int i = 0; i < COMM_RX_BUFFERS; i++) {
+        if (packet == comm_rx_buffers[i]) {
+            atomic_store_explicit(&comm_rx_busy[i], false, memory_order_release);
+            osThreadFlagsSet(communication_task_handle, COMM_BUFFER_FLAG);
             break;
+        }
+    }
+}
 
-        case COMM_SOF_STATE:
-            if (c == SOF2) {
-                comm_rx.state = COMM_LENGTH_STATE;
-            }
-            else {
+/*!
+ * @brief  Parse the next packets in another buffer, the current one is held by a deferred command
+ */
+static void communication_next_buffer(void) {
+    atomic_store_explicit(&comm_rx_busy[comm_rx_buffer], true, memory_order_relaxed);
+    comm_rx_buffer = (comm_rx_buffer + 1) % COMM_RX_BUFFERS;
+
+    /* All buffers held, the FIFO keeps the bytes meanwhile */
+    while (atomic_load_explicit(&comm_rx_busy[comm_rx_buffer], memory_order_acquire)) {
+        osThreadFlagsWait(COMM_BUFFER_FLAG, osFlagsWaitAny, osWaitForever);
+    }
+    comm_rx.data = comm_rx_buffers[comm_rx_buffer];
+}
+
+/*!
+ * @brief  Check a complete frame and handle it
+ */
+static void communication_dispatch(void) {
+    bool valid;
+
+    if (comm_rx.version == COMM_FRAME_V1) {
+        valid = (calculate_checksum(comm_rx.data, comm_rx.length) == comm_rx.check[0]);
+    }
+    else {
+        uint16_t crc = crc16_ccitt(CRC16_INIT, comm_rx.header, sizeof(comm_rx.header));
+        crc = crc16_ccitt(crc, comm_rx.data, comm_rx.length);
+        valid = (crc == (comm_rx.check[0] | (comm_rx.check[1] << 8)));
+    }
+
+    if (valid) {
+        comm_stats.frames[comm_rx.version - 1]++;
+        LOG_DBG("Received a packet %d bytes", comm_rx.length);
+        if (command_dispatch(comm_rx.data, comm_rx.length, communication_release) == COMMAND_QUEUED) {
+            communication_next_buffer();
+        }
+    }
+    else {
+        comm_stats.check_errors++;
+        LOG_ERR("Invalid checksum");
+    }
+}
+
+/*!
+ * @brief  Parse received bytes, stop after the end of a frame
+ * @retval Number of bytes used, *frame is set when a frame ended on the last one
+ */
+static uint32_t communication_scan(const uint8_t *data, uint32_t length, bool *frame) {
+    const uint8_t *sof;
+    uint32_t pos = 0;
+    uint32_t chunk;
+    uint8_t c;
+
+    *frame = false;
+    while (pos < length) {
+        switch (comm_rx.state) {
+            case COMM_IDLE_STATE:
+                /* Skip to the next SOF in one pass */
+                sof = memchr(&data[pos], SOF, length - pos);
+                if (sof == NULL) {
+                    comm_stats.skipped += length - pos;
+                    return length;
+                }
+                comm_stats.skipped += sof - &data[pos];
+                pos = sof - data + 1;
+                comm_rx.state = COMM_SOF_STATE;
+                break;
+
+            case COMM_SOF_STATE:
+                c = data[pos++];
+                if ((c == SOF2) || (c == SOF2_V2)) {
+                    comm_rx.version = (c == SOF2) ? COMM_FRAME_V1 : COMM_FRAME_V2;
+                    comm_rx.index = 0;
+                    comm_rx.state = COMM_LENGTH_STATE;
+                }
+                else if (c != SOF) {
+                    comm_rx.state = COMM_IDLE_STATE;
+                    LOG_ERR("Invalid SOF2");
+                }
+                break;
+
+            case COMM_LENGTH_STATE:
+                comm_rx.header[comm_rx.index++] = data[pos++];
+                if (comm_rx.index < COMM_FIELD_SIZE(comm_rx.version)) {
+                    break;
+                }
+
+                if (comm_rx.version == COMM_FRAME_V1) {
+                    comm_rx.length = (comm_rx.header[0] == 0) ? OTA_PACKET_LENGTH : comm_rx.header[0];
+                }
+                else {
+                    comm_rx.length = comm_rx.header[0] | (comm_rx.header[1] << 8);
+                }
+
+                if ((comm_rx.length == 0) || (comm_rx.length > COMM_MAX_LENGTH)) {
+                    comm_stats.length_errors++;
+                    comm_rx.state = COMM_IDLE_STATE;
+                    LOG_ERR("Invalid length %d", comm_rx.length);
+                    break;
+                }
+                comm_rx.index = 0;
+                comm_rx.state = COMM_DATA_STATE;
+                break;
+
+            case COMM_DATA_STATE:
+                /* Copy as much of the payload as this span holds */
+                chunk = comm_rx.length - comm_rx.index;
+                if (chunk > length - pos) {
+                    chunk = length - pos;
+                }
+                memcpy(&comm_rx.data[comm_rx.index], &data[pos], chunk);
+                comm_rx.index += chunk;
+                pos += chunk;
+
+                if (comm_rx.index >= comm_rx.length) {
+                    comm_rx.index = 0;
+                    comm_rx.state = COMM_CHECKSUM_STATE;
+                }
+                break;
+
+            case COMM_CHECKSUM_STATE:
+                comm_rx.check[comm_rx.index++] = data[pos++];
+                if (comm_rx.index >= COMM_FIELD_SIZE(comm_rx.version)) {
+                    comm_rx.state = COMM_IDLE_STATE;
+                    communication_dispatch();
+                    *frame = true;
+                    return pos;
+                }
+                break;
+
+            default:
                 comm_rx.state = COMM_IDLE_STATE;
-                LOG_ERR("Invalid SOF2");
-            }
-            break;
+                break;
+        }
+    }
 
-        case COMM_LENGTH_STATE:
-            if (c == 0) {
-                comm_rx.length = OTA_PACKET_LENGTH;
-            }
-            else {
-                comm_rx.length = c;
-            }
-            comm_rx.index = 0;
-            comm_rx.state = COMM_DATA_STATE;
-            break;
+    return pos;
+}
 
-        case COMM_DATA_STATE:
-            comm_rx.data[comm_rx.index++] = c;
-            if (comm_rx.index >= comm_rx.length) {
-                comm_rx.state = COMM_CHECKSUM_STATE;
-            }
-            break;
+/*!
+ * @brief  Send header and payload as one v2 frame on USART2
+ */
+static int communication_send_parts(const uint8_t *header, uint16_t header_length, const uint8_t *payload, uint16_t length) {
+    uint8_t start[4];
+    uint8_t check[2];
+    uint16_t total = header_length + length;
+    uint16_t crc;
+    bool ok;
+
+    start[0] = SOF;
+    start[1] = SOF2_V2;
+    start[2] = (uint8_t) total;
+    start[3] = (uint8_t) (total >> 8);
+    crc = crc16_ccitt(CRC16_INIT, &start[2], 2);
+    crc = crc16_ccitt(crc, header, header_length);
+    crc = crc16_ccitt(crc, payload, length);
+    check[0] = (uint8_t) crc;
+    check[1] = (uint8_t) (crc >> 8);
+
+    /* One frame at a time on the line */
+    osMutexAcquire(comm_tx_mutex, osWaitForever);
+    ok = (HAL_UART_Transmit(&huart2, start, sizeof(start), COMM_TX_TIMEOUT_MS) == HAL_OK)
+      && (HAL_UART_Transmit(&huart2, (uint8_t *) header, header_length, COMM_TX_TIMEOUT_MS) == HAL_OK)
+      && ((length == 0) || (HAL_UART_Transmit(&huart2, (uint8_t *) payload, length, COMM_TX_TIMEOUT_MS) == HAL_OK))
+      && (HAL_UART_Transmit(&huart2, check, sizeof(check), COMM_TX_TIMEOUT_MS) == HAL_OK);
+    osMutexRelease(comm_tx_mutex);
+
+    return ok ? 0 : -1;
+}
 
-        case COMM_CHECKSUM_STATE:
-            comm_rx.state = COMM_IDLE_STATE;
-            if (calculate_checksum(comm_rx.data, comm_rx.length) == c) {
-                LOG_DBG("Received a packet %d bytes", comm_rx.length);
-            }
-            else {
-                LOG_ERR("Invalid checksum");
-            }
-            return true;
+/*!
+ * @brief  Transport output: one message per frame
+ */
+static void communication_transport_output(const uint8_t *header, uint16_t header_length, const uint8_t *payload, uint16_t length, void *arg) {
+    (void) arg;
+    communication_send_parts(header, header_length, payload, length);
+}
+
+/*!
+ * @brief  Give back a transport packet held by a deferred command
+ */
+static void communication_transport_release(const uint8_t *packet) {
+    transport_release(&comm_transport, packet);
+    osThreadFlagsSet(communication_task_handle, COMM_XFER_FLAG);
+}
 
+/*!
+ * @brief  Transport delivery: run the packet like any other
+ */
+static int communication_transport_deliver(const uint8_t *packet, uint16_t length, void *arg) {
+    (void) arg;
+
+    switch (command_dispatch(packet, length, communication_transport_release)) {
+        case COMMAND_QUEUED:
+            return TRANSPORT_DELIVER_HELD;
+        case COMMAND_BUSY:
+            return TRANSPORT_DELIVER_BUSY;
         default:
-            comm_rx.state = COMM_IDLE_STATE;
-            break;
+            return TRANSPORT_DELIVER_DONE;
     }
+}
 
-    return false;
+/*!
+ * @brief  COMMAND_XFER_DATA handler
+ */
+static int communication_xfer_data(const uint8_t *data, uint16_t length) {
+    return transport_receive_data(&comm_transport, data, length);
 }
 
+/*!
+ * @brief  COMMAND_XFER_SYNC handler
+ */
+static int communication_xfer_sync(const uint8_t *data, uint16_t length) {
+    return transport_receive_sync(&comm_transport, data, length);
+}
+
+/*!
+ * @brief  COMMAND_XFER_ACK handler
+ */
+static int communication_xfer_ack(const uint8_t *data, uint16_t length) {
+    return transport_receive_ack(&comm_transport, data, length, current_ms());
+}
+
+/*!
+ * @brief  Get the oldest arrival mark, false if none
+ */
+static bool communication_peek_mark(comm_rx_mark_t *mark) {
+    const uint8_t *data;
+
+    /* Marks are written whole and the ring size is a multiple of their size */
+    if (ring_buffer_peek_contiguous(&rx_marks, &data) < sizeof(*mark)) {
+        return false;
+    }
+    memcpy(mark, data, sizeof(*mark));
+
+    return true;
+}
+
+/*!
+ * @brief  Drop the marks of spans parsed up to position
+ */
+static void communication_release_marks(uint32_t position) {
+    comm_rx_mark_t mark;
+
+    while (communication_peek_mark(&mark) && ((int32_t) (position - mark.position) >= 0)) {
+        ring_buffer_commit(&rx_marks, sizeof(mark));
+    }
+}
+
+/*!
+ * @brief  Add the latency of a packet ending at position to the histogram
+ */
+static void communication_record_latency(uint32_t position) {
+    comm_rx_mark_t mark;
+    uint32_t latency_us;
+    uint32_t bucket = 0;
+
+    /* The span holding the last byte is the first one ending after it */
+    communication_release_marks(position - 1);
+    if (!communication_peek_mark(&mark)) {
+        return;
+    }
+
+    latency_us = (DWT->CYCCNT - mark.cycles) / (SystemCoreClock / 1000000);
+    for (uint32_t range = latency_us >> 4; (range > 0) && (bucket < COMM_LATENCY_BUCKETS - 1); range >>= 1) {
+        bucket++;
+    }
+
+    comm_latency.buckets[bucket]++;
+    comm_latency.packets++;
+    if (latency_us > comm_latency.max_us) {
+        comm_latency.max_us = latency_us;
+    }
+}
+
+#if SIMULATOR
+static void simulator_main(const char *arg) {
+    (void) arg;
+    ui_control_button_main_pressed();
+}
+
+static void simulator_tap(const char *arg) {
+    (void) arg;
+    ui_control_button_tap_pressed();
+}
+
+static void simulator_pressure(const char *arg) {
+    LOG_DBG("Received simulator pressure %d", atoi(arg));
+}
+
+static void simulator_temperature(const char *arg) {
+    LOG_DBG("Received simulator temperature %d", atoi(arg));
+}
+
+static void simulator_sensitivity(const char *arg) {
+    LOG_DBG("Received simulator sensitivity %d", atoi(arg));
+}
+#endif
+
 /*!
  * @brief  Task for communication handling uart from user/esp32
  */
 static void communication_task(void *argument) {
     (void) argument;
-    int available;
+    const uint8_t *data;
+    uint32_t available;
+    uint32_t offset;
+    uint32_t dropped = 0;
+    uint32_t timeout;
+    bool frame;
 
     while (1) {
-        available = uart_fifo.count;
+        available = ring_buffer_peek_contiguous(&uart_fifo, &data);
         if (available > 0) {
-            for (int i = 0; i < available; i++) {
-                /* Pop data from FIFO */
-                uint8_t byte = uart_fifo.data[uart_fifo.tail];
-                uart_fifo.tail = (uart_fifo.tail + 1) % FIFO_SIZE;
-                uart_fifo.count--;
-
-                if (communication_process(byte)) {
-                    /* A complete packet received, process it */
-                    delay(1);
+            /* Handle the span in place, release it once parsed */
+            for (offset = 0; offset < available; ) {
+                offset += communication_scan(&data[offset], available - offset, &frame);
+                if (frame) {
+                    communication_record_latency(uart_fifo_parsed + offset);
                 }
             }
+            ring_buffer_commit(&uart_fifo, available);
+            uart_fifo_parsed += available;
+            communication_release_marks(uart_fifo_parsed);
+            transport_poll(&comm_transport, current_ms());
         }
         else {
-            delay(10);
+            /* Sleep until the RX interrupt signals new bytes or a retransmit is due, the flags stay set if they came meanwhile */
+            timeout = transport_poll(&comm_transport, current_ms());
+            if (timeout > COMM_RX_TIMEOUT_MS) {
+                timeout = COMM_RX_TIMEOUT_MS;
+            }
+            osThreadFlagsWait(COMM_RX_FLAG | COMM_XFER_FLAG, osFlagsWaitAny, timeout);
+            transport_poll(&comm_transport, current_ms());
+        }
+
+        if (uart_fifo_dropped != dropped) {
+            dropped = uart_fifo_dropped;
+            LOG_WARN("UART FIFO full, %lu bytes dropped", dropped);
         }
         
     #if SIMULATOR
@@ -196,26 +566,15 @@ static void communication_task(void *argument) {
             received_simulator = false;
             LOG_DBG("Simulator command: %s", simulator_buf);
 
-            if (!strncmp((char *)simulator_buf, (char *)"MAIN", 4))
-            {
-                ui_control_button_main_pressed();
-            }
-            else if (!strncmp((char *)simulator_buf, (char *)"TAP", 3))
-            {
-                ui_control_button_tap_pressed();
-            }
-            else if (!strncmp((char *)simulator_buf, (char *)"PRES", 4)) {
-                int pressure = atoi((char *)&simulator_buf[5]);
-                LOG_DBG("Received simulator pressure %d", pressure);
-            }
-            else if (!strncmp((char *)simulator_buf, (char *)"TEMP", 4)) {
-                int temp = atoi((char *)&simulator_buf[5]);
-                LOG_DBG("Received simulator temperature %d", temp);
-            }
+            for (uint32_t i = 0; i < sizeof(simulator_commands) / sizeof(simulator_commands[0]); i++) {
+                const simulator_command_t *command = &simulator_commands[i];
+                size_t length = strlen(command->name);
 
-            else if (!strncmp((char *)simulator_buf, (char *)"SENS", 4)) {
-                int sens = atoi((char *)&simulator_buf[5]);
-                LOG_DBG("Received simulator sensitivity %d", sens);
+                if (!strncmp(simulator_buf, command->name, length)) {
+                    /* Argument after a separator, e.g. "PRES 1013" */
+                    command->handler((simulator_buf[length] != '\0') ? &simulator_buf[length + 1] : &simulator_buf[length]);
+                    break;
+                }
             }
         }
     #endif
@@ -226,13 +585,81 @@ static void communication_task(void *argument) {
  * @brief  Initialize communication api
  */
 void communication_init(void) {
-    memset(&uart_fifo, 0, sizeof(uart_fifo));
+    ring_buffer_init(&uart_fifo, uart_fifo_data, FIFO_SIZE);
+    ring_buffer_init(&rx_marks, rx_marks_data, sizeof(rx_marks_data));
+    memset(&comm_latency, 0, sizeof(comm_latency));
     memset(&comm_rx, 0, sizeof(comm_rx));
+    for (int i = 0; i < COMM_RX_BUFFERS; i++) {
+        atomic_init(&comm_rx_busy[i], false);
+    }
+    comm_rx_buffer = 0;
+    comm_rx.data = comm_rx_buffers[0];
+    memset(&comm_stats, 0, sizeof(comm_stats));
+    comm_tx_mutex = osMutexNew(&comm_tx_mutex_attributes);
+
+    transport_config_t config = { .window = COMM_XFER_WINDOW, .rto_ms = COMM_XFER_RTO_MS };
+    transport_init(&comm_transport, &config, communication_transport_output, communication_transport_deliver, NULL);
+    command_register(COMMAND_XFER_DATA, "xfer_data", communication_xfer_data, COMMAND_INLINE);
+    command_register(COMMAND_XFER_ACK, "xfer_ack", communication_xfer_ack, COMMAND_INLINE);
+    command_register(COMMAND_XFER_SYNC, "xfer_sync", communication_xfer_sync, COMMAND_INLINE);
+    dma_ring_init(&uart_dma_ring, uart_dma_buffer, COMM_DMA_RX_SIZE);
     communication_task_handle = osThreadNew(communication_task, NULL, &communication_task_attributes);
 
+    /* Cycle counter for the latency timestamps */
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
     /* Start receive data from uart */
 #if SIMULATOR
     HAL_UART_Receive_IT(&huart1, (uint8_t *)&simulator_rx, 1);
 #endif
-    HAL_UART_Receive_IT(&huart2, (uint8_t *)&rx_temp, 1);
+    communication_start_rx();
+}
+
+/*!
+ * @brief  Get the packet latency histogram
+ */
+void communication_get_latency(comm_latency_stats_t *stats) {
+    *stats = comm_latency;
+}
+
+/*!
+ * @brief  Get the frame parser counters
+ */
+void communication_get_frame_stats(comm_frame_stats_t *stats) {
+    *stats = comm_stats;
+}
+
+/*!
+ * @brief  Send a packet as a v2 frame to the ESP32
+ */
+int communication_send(const uint8_t *packet, uint16_t length) {
+    return communication_send_parts(packet, length, NULL, 0);
+}
+
+/*!
+ * @brief  Get the windowed transport counters
+ */
+void communication_get_transport_stats(transport_stats_t *stats) {
+    *stats = comm_transport.stats;
 }
+
+#ifdef COMMUNICATION_SIMULATION
+/*!
+ * @brief  Parse received bytes like communication_task() parses a FIFO span
+ */
+uint32_t communication_sim_parse(const uint8_t *data, uint32_t length) {
+    uint32_t frames = 0;
+    bool frame;
+
+    if (comm_rx.data == NULL) {
+        comm_rx.data = comm_rx_buffers[comm_rx_buffer];
+    }
+    for (uint32_t offset = 0; offset < length; ) {
+        offset += communication_scan(&data[offset], length - offset, &frame);
+        frames += frame;
+    }
+
+    return frames;
+}
+#endif
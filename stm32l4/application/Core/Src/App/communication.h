@@ -17,16 +17,40 @@ extern "C" {
 /*                              INCLUDE FILES                                 */
 /******************************************************************************/
 
-
+#include "transport.h"
 
 /******************************************************************************/
 /*                     EXPORTED TYPES and DEFINITIONS                         */
 /******************************************************************************/
 
-#define FIFO_SIZE          (2048 + 256)            /* More than 2 command packets */
+#define FIFO_SIZE          (4096)                  /* More than 2 command packets, power of 2 */
+#define COMM_DMA_RX_SIZE   (512)                   /* Circular DMA buffer, HT/TC every 256 bytes */
 #define OTA_PART_LENGTH    1024
 #define OTA_PACKET_LENGTH  (OTA_PART_LENGTH + 5)   /* 1 byte CMD + 4 bytes offset + 1024 bytes data */
 #define COMM_MAX_LENGTH    (OTA_PART_LENGTH + 16)  /* Max length of communication packet */
+#define COMM_RX_BUFFERS    (2)                     /* Packet buffers, one parsed while the other is handled */
+#define COMM_RX_FLAG       (0x0001)                /* Thread flag set when bytes are received */
+#define COMM_BUFFER_FLAG   (0x0002)                /* Thread flag set when a deferred command releases its buffer */
+#define COMM_XFER_FLAG     (0x0004)                /* Thread flag set when a deferred command releases a transport packet */
+#define COMM_XFER_WINDOW   (8)                     /* Bulk transfer frames in flight */
+#define COMM_XFER_RTO_MS   (200)                   /* Bulk transfer retransmit timeout */
+#define COMM_TX_TIMEOUT_MS (100)                   /* Longest blocking transmit of a frame */
+#define COMM_RX_TIMEOUT_MS (100)                   /* Longest wait for data */
+#define COMM_RX_MARKS      (16)                    /* Arrival times of pending DMA spans, power of 2 */
+#define COMM_LATENCY_BUCKETS (12)                  /* Bucket n counts latencies below 2^(n+4) us, the last one the rest */
+
+/* Define to build communication_sim_parse(), the frame parser without the task (host build) */
+/* #define COMMUNICATION_SIMULATION */
+
+/*
+ * Frame versions, told apart by the second SOF byte:
+ * v1: AA 55 | length (1 byte, 0 for an OTA packet) | data | 8 bit sum of data
+ * v2: AA 56 | length (2 bytes LE) | data | CRC-16/CCITT-FALSE of length and data (2 bytes LE)
+ */
+enum {
+    COMM_FRAME_V1 = 1,
+    COMM_FRAME_V2,
+};
 
 enum {
     COMM_IDLE_STATE = 0,
@@ -36,20 +60,30 @@ enum {
     COMM_CHECKSUM_STATE,
 };
 
-typedef struct {
-    uint16_t head;
-    uint16_t tail;
-    uint16_t count;
-    uint8_t data[FIFO_SIZE];
-} uart_fifo_t;
-
 typedef struct {
     int state;
-    int index;
+    int index;                      /* Bytes of the current field received */
     int length;
-    uint8_t data[COMM_MAX_LENGTH];
+    uint8_t version;                /* COMM_FRAME_Vx */
+    uint8_t header[2];              /* Length field */
+    uint8_t check[2];               /* Checksum field */
+    uint8_t *data;                  /* One of the packet buffers */
 } communication_rx_t;
 
+typedef struct {
+    uint32_t frames[2];             /* Valid frames, v1 and v2 */
+    uint32_t check_errors;          /* Frames with a wrong checksum or CRC */
+    uint32_t length_errors;         /* Frames longer than COMM_MAX_LENGTH or empty */
+    uint32_t skipped;               /* Bytes outside of a frame */
+} comm_frame_stats_t;
+
+/* Time from the arrival of the last byte of a packet to its dispatch */
+typedef struct {
+    uint32_t packets;               /* Packets measured */
+    uint32_t max_us;                /* Highest latency */
+    uint32_t buckets[COMM_LATENCY_BUCKETS];
+} comm_latency_stats_t;
+
 /******************************************************************************/
 /*                              PRIVATE DATA                                  */
 /******************************************************************************/
@@ -73,6 +107,45 @@ typedef struct {
  */
 void communication_init(void);
 
+/*!
+ * @brief  Send a packet as a v2 frame to the ESP32, from any task
+ * @param  packet: Command byte followed by the payload
+ * @param  length: Packet length
+ * @retval 0 if success, -1 on error
+ */
+int communication_send(const uint8_t *packet, uint16_t length);
+
+/*!
+ * @brief  Get the packet latency histogram
+ * @param  stats: Output statistics
+ * @retval None
+ */
+void communication_get_latency(comm_latency_stats_t *stats);
+
+/*!
+ * @brief  Get the frame parser counters
+ * @param  stats: Output statistics
+ * @retval None
+ */
+void communication_get_frame_stats(comm_frame_stats_t *stats);
+
+/*!
+ * @brief  Get the windowed transport counters
+ * @param  stats: Output statistics
+ * @retval None
+ */
+void communication_get_transport_stats(transport_stats_t *stats);
+
+#ifdef COMMUNICATION_SIMULATION
+/*!
+ * @brief  Parse received bytes like communication_task() parses a FIFO span, without communication_init()
+ * @param  data: Received bytes
+ * @param  length: Number of bytes
+ * @retval Number of frames ended in data
+ */
+uint32_t communication_sim_parse(const uint8_t *data, uint32_t length);
+#endif
+
 /******************************************************************************/
 
 #ifdef __cplusplus
@@ -10,6 +10,8 @@
 
 #include "main.h"
 #include "app_config.h"
+#include "ui_event.h"
+#include "command.h"
 #include "main_process.h"
 
 /******************************************************************************/
@@ -50,6 +52,17 @@ void main_process_1sec_event(void) {
     }
 }
 
+/*!
+ * @brief  COMMAND_SENSOR_DATA handler: sensor index, reading (2 bytes LE)
+ */
+static int main_process_sensor_data(const uint8_t *data, uint16_t length) {
+    if ((length < 3) || (data[0] >= O2_SENSOR_NUM)) {
+        return -1;
+    }
+
+    return ui_event_post(UI_EVENT_SENSOR, data[0], data[1] | (data[2] << 8)) ? 0 : -1;
+}
+
 /*!
  * @brief  Initialize components for main process
  */
@@ -59,4 +72,6 @@ void main_process_init(void) {
 
     system_status.set_point.data = system_config.set_point;
     system_status.set_point.blink = false;
+
+    command_register(COMMAND_SENSOR_DATA, "sensor_data", main_process_sensor_data, COMMAND_INLINE);
 }
@@ -0,0 +1,524 @@
+/*
+ *  ota.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+
+#include <stdio.h>
+#include "app_config.h"
+#include "log.h"
+#include "command.h"
+#include "communication.h"
+#include "ota.h"
+#include "crc.h"
+
+#ifndef OTA_FLASH_FILE
+#include "stm32l4xx_hal.h"
+#include "W25Qx.h"
+#include "boot_mailbox.h"
+#endif
+
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+
+#define OTA_STATUS_LENGTH      (8)       /* Command byte, command answered, result, state, received */
+
+enum {
+    OTA_ACCEPTED = 0,
+    OTA_REFUSED,
+};
+
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+
+static ota_status_t ota_status;
+static uint32_t ota_start_ms;
+static uint8_t ota_verify_buf[OTA_PART_LENGTH];
+
+#ifdef OTA_FLASH_FILE
+static FILE *ota_file;
+#endif
+
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+
+extern system_status_t system_status;
+
+/******************************************************************************/
+/*                                FUNCTIONS                                   */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+
+static uint32_t ota_get_u32(const uint8_t *data) {
+    return data[0] | (data[1] << 8) | (data[2] << 16) | ((uint32_t) data[3] << 24);
+}
+
+static void ota_put_u32(uint8_t *data, uint32_t value) {
+    data[0] = (uint8_t) value;
+    data[1] = (uint8_t) (value >> 8);
+    data[2] = (uint8_t) (value >> 16);
+    data[3] = (uint8_t) (value >> 24);
+}
+
+static uint32_t ota_sum(uint32_t sum, const uint8_t *data, uint32_t length) {
+    for (uint32_t i = 0; i < length; i++) {
+        sum += data[i];
+    }
+
+    return sum;
+}
+
+#ifdef OTA_FLASH_FILE
+/**
+ * @brief  Open the file-backed W25Q, created empty (erased) if missing
+ */
+static bool ota_file_open(void) {
+    if (ota_file == NULL) {
+        ota_file = fopen(OTA_FLASH_FILE, "r+b");
+    }
+    if (ota_file == NULL) {
+        ota_file = fopen(OTA_FLASH_FILE, "w+b");
+    }
+
+    return (ota_file != NULL);
+}
+
+/**
+ * @brief  File-backed W25Q: bytes past the end read as erased (0xFF), programming only clears bits
+ */
+static int ota_file_access(uint32_t address, uint8_t *data, uint32_t size, bool program) {
+    uint8_t cell[OTA_PAGE_SIZE];
+
+    if (!ota_file_open()) {
+        return -1;
+    }
+
+    for (uint32_t done = 0; done < size; ) {
+        uint32_t chunk = (size - done > sizeof(cell)) ? sizeof(cell) : (size - done);
+        size_t length;
+
+        if (fseek(ota_file, address + done, SEEK_SET) != 0) {
+            return -1;
+        }
+        length = fread(cell, 1, chunk, ota_file);
+        memset(&cell[length], 0xFF, chunk - length);
+
+        if (program) {
+            for (uint32_t i = 0; i < chunk; i++) {
+                cell[i] &= data[done + i];
+            }
+            if ((fseek(ota_file, address + done, SEEK_SET) != 0) || (fwrite(cell, 1, chunk, ota_file) != chunk)) {
+                return -1;
+            }
+        }
+        else {
+            memcpy(&data[done], cell, chunk);
+        }
+        done += chunk;
+    }
+
+    return 0;
+}
+#endif
+
+/**
+ * @brief  Read the W25Q
+ */
+static int ota_flash_read(uint32_t address, uint8_t *data, uint32_t size) {
+#ifdef OTA_FLASH_FILE
+    return ota_file_access(address, data, size, false);
+#else
+    return (w25qx_read(data, address, size) == W25Qx_OK) ? 0 : -1;
+#endif
+}
+
+/**
+ * @brief  Program erased W25Q bytes
+ */
+static int ota_flash_write(uint32_t address, const uint8_t *data, uint32_t size) {
+#ifdef OTA_FLASH_FILE
+    return ota_file_access(address, (uint8_t *) data, size, true);
+#else
+    return (w25qx_write((uint8_t *) data, address, size) == W25Qx_OK) ? 0 : -1;
+#endif
+}
+
+/**
+ * @brief  Erase the W25Q sector holding address
+ */
+static int ota_flash_erase(uint32_t address) {
+#ifdef OTA_FLASH_FILE
+    static uint8_t erased[OTA_SECTOR_SIZE];
+
+    memset(erased, 0xFF, sizeof(erased));
+    if (!ota_file_open() || (fseek(ota_file, address & ~(OTA_SECTOR_SIZE - 1), SEEK_SET) != 0)) {
+        return -1;
+    }
+    return (fwrite(erased, 1, sizeof(erased), ota_file) == sizeof(erased)) ? 0 : -1;
+#else
+    return (w25qx_erase_block(address) == W25Qx_OK) ? 0 : -1;
+#endif
+}
+
+/*!
+ * @brief  Write the configuration page read by the bootloader
+ */
+static int ota_write_config(const ext_general_cfg_t *cfg) {
+#ifdef OTA_FLASH_FILE
+    FILE *file = fopen(OTA_CONFIG_FILE, "wb");
+    int ret = -1;
+
+    if (file != NULL) {
+        ret = (fwrite(cfg, 1, sizeof(*cfg), file) == sizeof(*cfg)) ? 0 : -1;
+        fclose(file);
+    }
+    return ret;
+#else
+    FLASH_EraseInitTypeDef erase;
+    uint32_t page_error;
+    uint64_t data[(sizeof(ext_general_cfg_t) + 7) / 8];
+    HAL_StatusTypeDef ret;
+
+    memset(data, 0xFF, sizeof(data));
+    memcpy(data, cfg, sizeof(*cfg));
+
+    erase.TypeErase = FLASH_TYPEERASE_PAGES;
+    erase.Banks = FLASH_BANK_1;
+    erase.Page = ETX_APP_NPAGE - 1;
+    erase.NbPages = 1;
+
+    HAL_FLASH_Unlock();
+    __HAL_FLASH_CLEAR_FLAG(FLASH_FLAG_EOP | FLASH_FLAG_OPERR | FLASH_FLAG_WRPERR | FLASH_FLAG_PGAERR);
+    ret = HAL_FLASHEx_Erase(&erase, &page_error);
+    for (uint32_t i = 0; (ret == HAL_OK) && (i < sizeof(data) / sizeof(data[0])); i++) {
+        ret = HAL_FLASH_Program(FLASH_TYPEPROGRAM_DOUBLEWORD, ETX_CONFIG_FLASH_ADDR + i * 8, data[i]);
+    }
+    HAL_FLASH_Lock();
+
+    return (ret == HAL_OK) ? 0 : -1;
+#endif
+}
+
+/*!
+ * @brief  Read the configuration page, erased bytes if never written
+ */
+static void ota_read_config(ext_general_cfg_t *cfg) {
+#ifdef OTA_FLASH_FILE
+    FILE *file = fopen(OTA_CONFIG_FILE, "rb");
+
+    memset(cfg, 0xFF, sizeof(*cfg));
+    if (file != NULL) {
+        if (fread(cfg, 1, sizeof(*cfg), file) != sizeof(*cfg)) {
+            memset(cfg, 0xFF, sizeof(*cfg));
+        }
+        fclose(file);
+    }
+#else
+    memcpy(cfg, (const void *) ETX_CONFIG_FLASH_ADDR, sizeof(*cfg));
+#endif
+}
+
+/*!
+ * @brief  Withdraw the install request of the previous download
+ *
+ * The erase-ahead destroys the file the configuration page names: a reset
+ * during the download would otherwise have the bootloader install a mix
+ * of both images.
+ */
+static int ota_retire_request(void) {
+    ext_general_cfg_t cfg;
+
+    ota_read_config(&cfg);
+    if (cfg.reboot_cause != ETX_OTA_REQUEST) {
+        return 0;
+    }
+    cfg.reboot_cause = ETX_NORMAL_BOOT;
+    return ota_write_config(&cfg);
+}
+
+/*!
+ * @brief  Leave the reboot cause to the bootloader in the boot mailbox
+ */
+static void ota_set_reboot_cause(uint32_t reboot_cause) {
+#ifndef OTA_FLASH_FILE
+    boot_mailbox_t mailbox;
+
+    if (boot_mailbox_read(&mailbox) != 0) {
+        mailbox.boot_ms = 0;
+    }
+    mailbox.reboot_cause = reboot_cause;
+    boot_mailbox_write(&mailbox);
+#else
+    (void) reboot_cause;
+#endif
+}
+
+/*!
+ * @brief  Reset into the bootloader, never during a dive: it acts on the next reset then
+ */
+static void ota_reboot(void) {
+#ifndef OTA_FLASH_FILE
+    if (system_status.dive_state == SURFACE_CONTROL_STATE) {
+        delay(OTA_REBOOT_DELAY_MS);
+        NVIC_SystemReset();
+    }
+#endif
+}
+
+/*!
+ * @brief  Answer a command with the download progress
+ */
+static int ota_send_status(uint8_t command, int ret) {
+    uint8_t packet[OTA_STATUS_LENGTH];
+
+    packet[0] = COMMAND_OTA_STATUS;
+    packet[1] = command;
+    packet[2] = (ret == 0) ? OTA_ACCEPTED : OTA_REFUSED;
+    packet[3] = ota_status.state;
+    ota_put_u32(&packet[4], ota_status.received);
+    if (communication_send(packet, sizeof(packet)) != 0) {
+        LOG_ERR("OTA status not sent");
+    }
+
+    return ret;
+}
+
+/*!
+ * @brief  Erase sectors until the first end bytes of the image are erased
+ */
+static int ota_erase_until(uint32_t end) {
+    if (end > ota_status.fw_size) {
+        end = ota_status.fw_size;
+    }
+
+    while (ota_status.erased < end) {
+        if (ota_flash_erase(OTA_FIRMWARE_ADDRESS + ota_status.erased) != 0) {
+            LOG_ERR("OTA erase failed at %lu", ota_status.erased);
+            return -1;
+        }
+        ota_status.erased += OTA_SECTOR_SIZE;
+    }
+
+    return 0;
+}
+
+/*!
+ * @brief  Stop the download
+ */
+static int ota_fail(void) {
+    ota_status.state = OTA_FAILED_STATE;
+    return -1;
+}
+
+/*!
+ * @brief  Start a download
+ */
+static int ota_start(const uint8_t *data, uint16_t length) {
+    if (length < 8) {
+        return -1;
+    }
+
+    memset(&ota_status, 0, sizeof(ota_status));
+    ota_status.fw_size = ota_get_u32(&data[0]);
+    ota_status.fw_crc = ota_get_u32(&data[4]);
+    if (length >= 12) {
+        ota_status.fw_version = ota_get_u32(&data[8]);
+    }
+    if ((ota_status.fw_size == 0) || (ota_status.fw_size > OTA_FIRMWARE_MAX_SIZE)) {
+        LOG_ERR("OTA invalid size %lu", ota_status.fw_size);
+        return ota_fail();
+    }
+
+    LOG_INFO("OTA start %lu bytes, version %lu", ota_status.fw_size, ota_status.fw_version);
+    if (ota_retire_request() != 0) {
+        LOG_ERR("OTA configuration write failed");
+        return ota_fail();
+    }
+    ota_start_ms = current_ms();
+    ota_status.state = OTA_RECEIVE_STATE;
+
+    return (ota_erase_until(OTA_ERASE_AHEAD) == 0) ? 0 : ota_fail();
+}
+
+/*!
+ * @brief  Write a part of the image
+ */
+static int ota_data(const uint8_t *data, uint16_t length) {
+    uint32_t offset, size;
+
+    if ((ota_status.state != OTA_RECEIVE_STATE) || (length <= 4)) {
+        return -1;
+    }
+
+    offset = ota_get_u32(data);
+    size = length - 4;
+    if ((size > OTA_PART_LENGTH) || (offset + size > ota_status.fw_size)) {
+        LOG_ERR("OTA part out of the image, offset %lu", offset);
+        return ota_fail();
+    }
+
+    /* Part sent again, already written */
+    if (offset + size <= ota_status.received) {
+        return 0;
+    }
+    if (offset != ota_status.received) {
+        LOG_ERR("OTA offset %lu, expected %lu", offset, ota_status.received);
+        return -1;
+    }
+
+    if ((ota_erase_until(offset + size) != 0) || (ota_flash_write(OTA_FIRMWARE_ADDRESS + offset, &data[4], size) != 0)) {
+        LOG_ERR("OTA write failed at %lu", offset);
+        return ota_fail();
+    }
+    ota_status.checksum = ota_sum(ota_status.checksum, &data[4], size);
+    ota_status.received += size;
+
+    /* Erase the next sector now, while the next parts are received */
+    return (ota_erase_until(ota_status.received + OTA_ERASE_AHEAD) == 0) ? 0 : ota_fail();
+}
+
+/*!
+ * @brief  Check the image and request its install
+ */
+static int ota_end(void) {
+    ext_general_cfg_t cfg;
+    uint32_t checksum = 0;
+    uint32_t crc = CRC32_MPEG2_INIT;
+
+    if (ota_status.state != OTA_RECEIVE_STATE) {
+        return -1;
+    }
+    if ((ota_status.received != ota_status.fw_size) || (ota_status.checksum != ota_status.fw_crc)) {
+        LOG_ERR("OTA incomplete image, %lu bytes, checksum %lu", ota_status.received, ota_status.checksum);
+        return ota_fail();
+    }
+
+    /* Check what the bootloader will read */
+    for (uint32_t offset = 0; offset < ota_status.fw_size; offset += OTA_PART_LENGTH) {
+        uint32_t size = (ota_status.fw_size - offset > OTA_PART_LENGTH) ? OTA_PART_LENGTH : (ota_status.fw_size - offset);
+        if (ota_flash_read(OTA_FIRMWARE_ADDRESS + offset, ota_verify_buf, size) != 0) {
+            return ota_fail();
+        }
+        checksum = ota_sum(checksum, ota_verify_buf, size);
+        crc = crc32_mpeg2(crc, ota_verify_buf, size);
+    }
+    if (checksum != ota_status.fw_crc) {
+        LOG_ERR("OTA flash check failed, checksum %lu", checksum);
+        return ota_fail();
+    }
+
+    memset(&cfg, 0xFF, sizeof(cfg));
+    cfg.reboot_cause = ETX_OTA_REQUEST;
+    cfg.slot_table.fw_size = ota_status.fw_size;
+    cfg.slot_table.fw_crc = ota_status.fw_crc;
+    cfg.slot_table.reserved1 = MAGIC_NUMBER;
+    cfg.slot_table.fw_crc32 = crc;          /* Lets the bootloader check and program in one pass */
+    cfg.slot_table.reserved2 = MAGIC_NUMBER;
+    cfg.slot_table.version = ota_status.fw_version;
+    if (ota_write_config(&cfg) != 0) {
+        LOG_ERR("OTA configuration write failed");
+        return ota_fail();
+    }
+    ota_set_reboot_cause(ETX_OTA_REQUEST);
+
+    ota_status.state = OTA_DONE_STATE;
+    ota_status.elapsed_ms = current_ms() - ota_start_ms;
+    ota_status.bytes_per_sec = (uint32_t) ((uint64_t) ota_status.fw_size * 1000 / (ota_status.elapsed_ms ? ota_status.elapsed_ms : 1));
+    LOG_INFO("OTA done, %lu bytes in %lu ms, %lu B/s", ota_status.fw_size, ota_status.elapsed_ms, ota_status.bytes_per_sec);
+
+    return 0;
+}
+
+/*!
+ * @brief  COMMAND_OTA_START handler
+ */
+static int ota_start_command(const uint8_t *data, uint16_t length) {
+    return ota_send_status(COMMAND_OTA_START, ota_start(data, length));
+}
+
+/*!
+ * @brief  COMMAND_OTA_DATA handler
+ */
+static int ota_data_command(const uint8_t *data, uint16_t length) {
+    return ota_send_status(COMMAND_OTA_DATA, ota_data(data, length));
+}
+
+/*!
+ * @brief  COMMAND_OTA_END handler, the status goes out before the reset
+ */
+static int ota_end_command(const uint8_t *data, uint16_t length) {
+    (void) data;
+    (void) length;
+
+    if (ota_send_status(COMMAND_OTA_END, ota_end()) != 0) {
+        return -1;
+    }
+    ota_reboot();
+
+    return 0;
+}
+
+/*!
+ * @brief  COMMAND_OTA_ROLLBACK handler
+ */
+static int ota_rollback(const uint8_t *data, uint16_t length) {
+    (void) data;
+    (void) length;
+
+    /* A downloaded image waits for the reset */
+    if ((ota_status.state == OTA_RECEIVE_STATE) || (ota_status.state == OTA_DONE_STATE)) {
+        return -1;
+    }
+
+    ota_set_reboot_cause(ETX_LOAD_PREV_APP);
+    LOG_INFO("OTA rollback requested");
+    ota_reboot();
+
+    return 0;
+}
+
+/*!
+ * @brief  Confirm the running image after an OTA
+ */
+void ota_confirm(void) {
+#ifndef OTA_FLASH_FILE
+    boot_mailbox_t mailbox;
+
+    /* No flash write, the bootloader records it on the next reset */
+    if ((boot_mailbox_read(&mailbox) != 0) || (mailbox.reboot_cause != ETX_OTA_DONE_BOOT)) {
+        return;
+    }
+    mailbox.reboot_cause = ETX_NORMAL_BOOT;
+    boot_mailbox_write(&mailbox);
+    LOG_INFO("OTA image confirmed");
+#endif
+}
+
+/*!
+ * @brief  Get the OTA progress
+ */
+void ota_get_status(ota_status_t *status) {
+    *status = ota_status;
+}
+
+/*!
+ * @brief  Register the OTA commands
+ */
+void ota_init(void) {
+    memset(&ota_status, 0, sizeof(ota_status));
+
+    command_register(COMMAND_OTA_START, "ota_start", ota_start_command, COMMAND_DEFERRED);
+    command_register(COMMAND_OTA_DATA, "ota_data", ota_data_command, COMMAND_DEFERRED);
+    command_register(COMMAND_OTA_END, "ota_end", ota_end_command, COMMAND_DEFERRED);
+    command_register(COMMAND_OTA_ROLLBACK, "ota_rollback", ota_rollback, COMMAND_DEFERRED);
+}
@@ -0,0 +1,126 @@
+/*
+ *  ota.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef _OTA_H_
+#define _OTA_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************************************************************/
+
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+
+#include <stdint.h>
+
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+
+/*
+ * Firmware download from the ESP32 to the W25Q at OTA_FIRMWARE_ADDRESS, then
+ * installed by the bootloader on the next reset:
+ *   COMMAND_OTA_START:    image size (4 bytes LE), sum of the image bytes (4 bytes LE),
+ *                         optional image version (4 bytes LE), withdraws the
+ *                         request of a previous download before erasing its file
+ *   COMMAND_OTA_DATA:     offset (4 bytes LE), up to OTA_PART_LENGTH bytes, in order
+ *   COMMAND_OTA_END:      no payload, checks the image, writes it to the
+ *                         configuration page and sets ETX_OTA_REQUEST
+ *   COMMAND_OTA_ROLLBACK: no payload, sets ETX_LOAD_PREV_APP
+ * START, DATA and END are answered with a COMMAND_OTA_STATUS frame:
+ *   command answered (1 byte), 0 if accepted or 1 if refused (1 byte),
+ *   OTA_xxx_STATE (1 byte), bytes written so far (4 bytes LE)
+ * A part lost on the line makes the next one refused: the sender goes back
+ * to the bytes written and sends again from there. A part with no status
+ * (itself or its status lost) is sent again after a timeout, the parts
+ * already written are accepted again. A FAILED state needs a new START.
+ * The sender keeps at most OTA_PARTS_AHEAD parts without their status: one
+ * handled, one waiting in the other packet buffer. Nothing then waits in the
+ * UART FIFO while the command task erases a sector (45 to 400 ms).
+ * The reboot causes go through the boot mailbox (common/boot_mailbox.h), the
+ * configuration page is only written when a new image is downloaded.
+ * The handlers are deferred: a part is programmed by the command task while
+ * communication_task parses the next one in its other packet buffer.
+ * The bootloader keeps the image it replaces and restores it if the new one
+ * does not call ota_confirm() within a few resets.
+ */
+#define OTA_FIRMWARE_MAX_SIZE  (0x100000 - (ETX_APP_FLASH_ADDR - 0x08000000))  /* Internal flash after the bootloader */
+#define OTA_SECTOR_SIZE        (0x1000)                  /* W25Q erase unit */
+#define OTA_PAGE_SIZE          (0x100)                   /* W25Q program unit */
+#define OTA_ERASE_AHEAD        (OTA_SECTOR_SIZE)         /* Erased space kept ahead of the write cursor */
+#define OTA_REBOOT_DELAY_MS    (500)                     /* Time to flush the logs before the reset */
+#define OTA_PARTS_AHEAD        (COMM_RX_BUFFERS)         /* Parts sent before the status of the first one */
+
+/* Define to file paths to use a file-backed W25Q and configuration page instead of the hardware (host build) */
+/* #define OTA_FLASH_FILE      "w25q.bin" */
+/* #define OTA_CONFIG_FILE     "ota_cfg.bin" */
+
+enum {
+    OTA_IDLE_STATE = 0,
+    OTA_RECEIVE_STATE,
+    OTA_DONE_STATE,
+    OTA_FAILED_STATE,
+};
+
+typedef struct {
+    uint8_t state;                  /* OTA_xxx_STATE */
+    uint32_t fw_size;
+    uint32_t fw_crc;                /* Sum of the image bytes, as checked by the bootloader */
+    uint32_t fw_version;            /* 0 if not given */
+    uint32_t received;              /* Write cursor, bytes from OTA_FIRMWARE_ADDRESS */
+    uint32_t erased;                /* Bytes erased from OTA_FIRMWARE_ADDRESS */
+    uint32_t checksum;              /* Sum of the bytes received */
+    uint32_t elapsed_ms;            /* From OTA_START to the end of the check */
+    uint32_t bytes_per_sec;         /* End to end throughput */
+} ota_status_t;
+
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+/*                                FUNCTIONS                                   */
+/******************************************************************************/
+
+/*!
+ * @brief  Register the OTA commands
+ * @param  None
+ * @retval None
+ */
+void ota_init(void);
+
+/*!
+ * @brief  Get the OTA progress
+ * @param  status: Output status
+ * @retval None
+ */
+void ota_get_status(ota_status_t *status);
+
+/*!
+ * @brief  Confirm the running image after an OTA, the bootloader then keeps it
+ * @param  None
+ * @retval None
+ */
+void ota_confirm(void);
+
+/******************************************************************************/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _OTA_H_ */
@@ -0,0 +1,452 @@
+/*
+ *  transport.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+
+#include <string.h>
+#include "command.h"
+#include "transport.h"
+
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+
+enum {
+    TRANSPORT_SLOT_FREE = 0,
+    TRANSPORT_SLOT_SENT,                /* Sender: waiting for its ACK */
+    TRANSPORT_SLOT_SACKED,              /* Sender: received out of order by the peer */
+    TRANSPORT_SLOT_RECEIVED,            /* Receiver: stored, not handed over */
+    TRANSPORT_SLOT_HELD,                /* Receiver: handed over, not released */
+};
+
+/* Sender SYNC */
+enum {
+    TRANSPORT_SYNC_DONE = 0,            /* Answered, data can be sent */
+    TRANSPORT_SYNC_DUE,                 /* Sent by the next transport_poll() */
+    TRANSPORT_SYNC_SENT,                /* Waiting for its ACK, sent again on timeout */
+    TRANSPORT_SYNC_LOST,                /* Peer silent, sent again by the next transport_send() */
+};
+
+#define TRANSPORT_SLOT(seq)     ((seq) % TRANSPORT_MAX_WINDOW)
+
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+/*                                FUNCTIONS                                   */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+
+static void transport_put_u16(uint8_t *data, uint16_t value) {
+    data[0] = (uint8_t) value;
+    data[1] = (uint8_t) (value >> 8);
+}
+
+static uint16_t transport_get_u16(const uint8_t *data) {
+    return data[0] | (data[1] << 8);
+}
+
+/*!
+ * @brief  Send a data frame, first time or again
+ */
+static void transport_send_slot(transport_t *transport, transport_tx_slot_t *slot, uint32_t now_ms) {
+    uint8_t header[TRANSPORT_DATA_HEADER];
+
+    header[0] = COMMAND_XFER_DATA;
+    transport_put_u16(&header[1], slot->seq);
+    transport->output(header, sizeof(header), slot->data, slot->length, transport->arg);
+    slot->sent_ms = now_ms;
+}
+
+/*!
+ * @brief  Send the SYNC, first time or again
+ */
+static void transport_send_sync(transport_t *transport, uint32_t now_ms) {
+    uint8_t header[TRANSPORT_SYNC_HEADER];
+
+    header[0] = COMMAND_XFER_SYNC;
+    transport_put_u16(&header[1], transport->tx_sync_seq);
+    header[3] = transport->tx_sync_flags;
+    transport->output(header, sizeof(header), NULL, 0, transport->arg);
+    transport->tx_sync = TRANSPORT_SYNC_SENT;
+    transport->tx_sync_ms = now_ms;
+    transport->stats.syncs_sent++;
+}
+
+/*!
+ * @brief  Tell the peer the next data frame is tx_base, on the next transport_poll()
+ */
+static void transport_start_sync(transport_t *transport, uint8_t flags) {
+    transport->tx_sync = TRANSPORT_SYNC_DUE;
+    transport->tx_sync_flags = flags;
+    transport->tx_sync_retries = 0;
+    transport->tx_sync_seq = transport->tx_base;
+}
+
+/*!
+ * @brief  Acknowledge what was received so far
+ */
+static void transport_send_ack(transport_t *transport) {
+    uint8_t header[TRANSPORT_ACK_HEADER];
+    uint32_t sack = 0;
+
+    for (uint16_t i = 0; i < TRANSPORT_SACK_BITS; i++) {
+        uint16_t seq = transport->rx_next + 1 + i;
+        if ((uint16_t) (seq - transport->rx_release) >= transport->config.window) {
+            break;
+        }
+        if (atomic_load_explicit(&transport->rx[TRANSPORT_SLOT(seq)].state, memory_order_relaxed) == TRANSPORT_SLOT_RECEIVED) {
+            sack |= 1UL << i;
+        }
+    }
+
+    header[0] = COMMAND_XFER_ACK;
+    transport_put_u16(&header[1], transport->rx_next);
+    transport_put_u16(&header[3], (uint16_t) sack);
+    transport_put_u16(&header[5], (uint16_t) (sack >> 16));
+    transport->output(header, sizeof(header), NULL, 0, transport->arg);
+    transport->stats.acks_sent++;
+}
+
+/*!
+ * @brief  Move the receive window past the packets released by their users
+ */
+static void transport_free_released(transport_t *transport) {
+    while ((transport->rx_release != transport->rx_deliver)
+        && (atomic_load_explicit(&transport->rx[TRANSPORT_SLOT(transport->rx_release)].state, memory_order_acquire) == TRANSPORT_SLOT_FREE)) {
+        transport->rx_release++;
+    }
+}
+
+/*!
+ * @brief  Hand over the next packets in order
+ */
+static void transport_deliver(transport_t *transport) {
+    transport_free_released(transport);
+
+    while (transport->rx_deliver != transport->rx_next) {
+        transport_rx_slot_t *slot = &transport->rx[TRANSPORT_SLOT(transport->rx_deliver)];
+
+        /* Held before the call, the user may release it from another task before it returns */
+        atomic_store_explicit(&slot->state, TRANSPORT_SLOT_HELD, memory_order_relaxed);
+        int ret = transport->deliver(slot->data, slot->length, transport->arg);
+        if (ret == TRANSPORT_DELIVER_BUSY) {
+            atomic_store_explicit(&slot->state, TRANSPORT_SLOT_RECEIVED, memory_order_relaxed);
+            break;
+        }
+        if (ret == TRANSPORT_DELIVER_DONE) {
+            atomic_store_explicit(&slot->state, TRANSPORT_SLOT_FREE, memory_order_relaxed);
+        }
+
+        transport->stats.delivered++;
+        transport->rx_deliver++;
+    }
+
+    transport_free_released(transport);
+}
+
+/*!
+ * @brief  Initialize both directions
+ */
+void transport_init(transport_t *transport, const transport_config_t *config, transport_output_t output, transport_deliver_t deliver, void *arg) {
+    memset(transport, 0, sizeof(*transport));
+    transport->config = *config;
+    if ((transport->config.window == 0) || (transport->config.window > TRANSPORT_MAX_WINDOW)) {
+        transport->config.window = TRANSPORT_MAX_WINDOW;
+    }
+    transport->output = output;
+    transport->deliver = deliver;
+    transport->arg = arg;
+
+    for (int i = 0; i < TRANSPORT_MAX_WINDOW; i++) {
+        atomic_init(&transport->rx[i].state, TRANSPORT_SLOT_FREE);
+    }
+    transport_start_sync(transport, TRANSPORT_SYNC_RESTART);
+}
+
+/*!
+ * @brief  Number of packets that can be sent now
+ */
+uint32_t transport_send_space(transport_t *transport) {
+    if (transport->tx_sync != TRANSPORT_SYNC_DONE) {
+        return 0;
+    }
+    return transport->config.window - (uint16_t) (transport->tx_next - transport->tx_base);
+}
+
+/*!
+ * @brief  Queue a packet and send it
+ */
+int transport_send(transport_t *transport, const uint8_t *packet, uint16_t length, uint32_t now_ms) {
+    transport_tx_slot_t *slot;
+
+    /* The peer went silent during the last SYNC, try it again */
+    if (transport->tx_sync == TRANSPORT_SYNC_LOST) {
+        transport->tx_sync_retries = 0;
+        transport_send_sync(transport, now_ms);
+    }
+    if ((length == 0) || (length > TRANSPORT_MAX_PACKET) || (transport_send_space(transport) == 0)) {
+        return -1;
+    }
+
+    slot = &transport->tx[TRANSPORT_SLOT(transport->tx_next)];
+    memcpy(slot->data, packet, length);
+    slot->length = length;
+    slot->seq = transport->tx_next++;
+    slot->state = TRANSPORT_SLOT_SENT;
+    slot->retries = 0;
+    transport_send_slot(transport, slot, now_ms);
+    transport->stats.sent++;
+
+    return 0;
+}
+
+/*!
+ * @brief  Handle a COMMAND_XFER_DATA payload
+ */
+int transport_receive_data(transport_t *transport, const uint8_t *data, uint16_t length) {
+    transport_rx_slot_t *slot;
+    uint16_t seq;
+
+    if ((length <= TRANSPORT_DATA_HEADER - 1) || (length - (TRANSPORT_DATA_HEADER - 1) > TRANSPORT_MAX_PACKET)) {
+        return -1;
+    }
+    seq = transport_get_u16(data);
+    transport_deliver(transport);
+
+    if (!transport->rx_synced) {
+        /* From before a restart of either side, the SYNC of the peer comes first */
+        transport->stats.out_of_window++;
+        return 0;
+    }
+    if ((int16_t) (seq - transport->rx_next) < 0) {
+        /* Already received, the ACK was lost */
+        transport->stats.duplicates++;
+    }
+    else if ((uint16_t) (seq - transport->rx_release) >= transport->config.window) {
+        /* Slots still held or the sender is ahead of us, let it retransmit */
+        transport->stats.out_of_window++;
+    }
+    else {
+        slot = &transport->rx[TRANSPORT_SLOT(seq)];
+        if (atomic_load_explicit(&slot->state, memory_order_relaxed) == TRANSPORT_SLOT_RECEIVED) {
+            transport->stats.duplicates++;
+        }
+        else {
+            slot->length = length - (TRANSPORT_DATA_HEADER - 1);
+            memcpy(slot->data, &data[TRANSPORT_DATA_HEADER - 1], slot->length);
+            atomic_store_explicit(&slot->state, TRANSPORT_SLOT_RECEIVED, memory_order_relaxed);
+            transport->stats.received++;
+
+            while (((uint16_t) (transport->rx_next - transport->rx_release) < transport->config.window)
+                && (atomic_load_explicit(&transport->rx[TRANSPORT_SLOT(transport->rx_next)].state, memory_order_relaxed) == TRANSPORT_SLOT_RECEIVED)) {
+                transport->rx_next++;
+            }
+            transport_deliver(transport);
+        }
+    }
+
+    transport_send_ack(transport);
+
+    return 0;
+}
+
+/*!
+ * @brief  Handle a COMMAND_XFER_SYNC payload
+ */
+int transport_receive_sync(transport_t *transport, const uint8_t *data, uint16_t length) {
+    uint16_t seq;
+    uint8_t flags;
+
+    if (length < TRANSPORT_SYNC_HEADER - 1) {
+        return -1;
+    }
+    seq = transport_get_u16(data);
+    flags = data[2];
+
+    /* The peer lost our frames in flight: they go again after our own SYNC */
+    if (flags & TRANSPORT_SYNC_RESTART) {
+        for (uint16_t i = transport->tx_base; i != transport->tx_next; i++) {
+            transport->tx[TRANSPORT_SLOT(i)].state = TRANSPORT_SLOT_SENT;
+            transport->tx[TRANSPORT_SLOT(i)].retries = 0;
+        }
+        transport_start_sync(transport, 0);
+    }
+
+    /*
+     * Frames before seq never come. Once the packets handed over are
+     * released, the others are dropped. A SYNC behind rx_next is a copy sent
+     * again, the frames received since then are kept.
+     */
+    transport_deliver(transport);
+    if ((transport->rx_release == transport->rx_next)
+        && (!transport->rx_synced || (flags & TRANSPORT_SYNC_RESTART) || ((int16_t) (seq - transport->rx_next) >= 0))) {
+        for (int i = 0; i < TRANSPORT_MAX_WINDOW; i++) {
+            atomic_store_explicit(&transport->rx[i].state, TRANSPORT_SLOT_FREE, memory_order_relaxed);
+        }
+        transport->rx_release = transport->rx_deliver = transport->rx_next = seq;
+        transport->rx_synced = true;
+        transport->stats.resyncs++;
+    }
+
+    transport_send_ack(transport);
+
+    return 0;
+}
+
+/*!
+ * @brief  Handle a COMMAND_XFER_ACK payload
+ */
+int transport_receive_ack(transport_t *transport, const uint8_t *data, uint16_t length, uint32_t now_ms) {
+    uint16_t next;
+    uint32_t sack;
+    bool synced = false;
+
+    if (length < TRANSPORT_ACK_HEADER - 1) {
+        return -1;
+    }
+    next = transport_get_u16(data);
+    sack = transport_get_u16(&data[2]) | ((uint32_t) transport_get_u16(&data[4]) << 16);
+    transport->stats.acks_received++;
+
+    /* Only the answer to the SYNC counts until then */
+    if (transport->tx_sync != TRANSPORT_SYNC_DONE) {
+        if ((transport->tx_sync == TRANSPORT_SYNC_DUE)
+            || ((uint16_t) (next - transport->tx_sync_seq) > (uint16_t) (transport->tx_next - transport->tx_sync_seq))) {
+            return 0;
+        }
+        transport->tx_sync = TRANSPORT_SYNC_DONE;
+        synced = true;
+    }
+
+    /* Ignore ACKs older than the window or ahead of what was sent */
+    if ((uint16_t) (next - transport->tx_base) > (uint16_t) (transport->tx_next - transport->tx_base)) {
+        return 0;
+    }
+
+    while (transport->tx_base != next) {
+        transport->tx[TRANSPORT_SLOT(transport->tx_base)].state = TRANSPORT_SLOT_FREE;
+        transport->tx_base++;
+    }
+
+    /* Frames kept over a restart of the peer go again now */
+    if (synced) {
+        for (uint16_t seq = transport->tx_base; seq != transport->tx_next; seq++) {
+            transport_send_slot(transport, &transport->tx[TRANSPORT_SLOT(seq)], now_ms);
+            transport->stats.retransmits++;
+        }
+        return 0;
+    }
+
+    for (uint16_t i = 0; i < TRANSPORT_SACK_BITS; i++) {
+        uint16_t seq = next + 1 + i;
+        if ((uint16_t) (seq - transport->tx_base) >= (uint16_t) (transport->tx_next - transport->tx_base)) {
+            break;
+        }
+        if (sack & (1UL << i)) {
+            transport->tx[TRANSPORT_SLOT(seq)].state = TRANSPORT_SLOT_SACKED;
+        }
+    }
+
+    /* Later frames arrived, the first one was lost: resend it once without waiting for its timer */
+    if ((sack != 0) && (transport->tx_base != transport->tx_next)) {
+        transport_tx_slot_t *slot = &transport->tx[TRANSPORT_SLOT(transport->tx_base)];
+        if ((slot->state == TRANSPORT_SLOT_SENT) && (slot->retries == 0)) {
+            slot->retries++;
+            transport_send_slot(transport, slot, now_ms);
+            transport->stats.fast_retransmits++;
+        }
+    }
+
+    return 0;
+}
+
+/*!
+ * @brief  Free a packet held after TRANSPORT_DELIVER_HELD, from any task
+ */
+void transport_release(transport_t *transport, const uint8_t *packet) {
+    for (int i = 0; i < TRANSPORT_MAX_WINDOW; i++) {
+        if (packet == transport->rx[i].data) {
+            atomic_store_explicit(&transport->rx[i].state, TRANSPORT_SLOT_FREE, memory_order_release);
+            break;
+        }
+    }
+}
+
+/*!
+ * @brief  Retransmit expired frames and hand over pending packets
+ */
+uint32_t transport_poll(transport_t *transport, uint32_t now_ms) {
+    uint32_t deadline = TRANSPORT_NO_DEADLINE;
+    uint32_t elapsed;
+
+    transport_deliver(transport);
+
+    for (uint16_t seq = transport->tx_base; (seq != transport->tx_next) && (transport->tx_sync == TRANSPORT_SYNC_DONE); seq++) {
+        transport_tx_slot_t *slot = &transport->tx[TRANSPORT_SLOT(seq)];
+        elapsed = now_ms - slot->sent_ms;
+
+        if (slot->state != TRANSPORT_SLOT_SENT) {
+            continue;
+        }
+
+        if (elapsed >= transport->config.rto_ms) {
+            if (slot->retries >= TRANSPORT_MAX_RETRIES) {
+                /* Peer gone, drop the transfer and tell the receiver to stop waiting for it */
+                for (seq = transport->tx_base; seq != transport->tx_next; seq++) {
+                    transport->tx[TRANSPORT_SLOT(seq)].state = TRANSPORT_SLOT_FREE;
+                    transport->stats.abandoned++;
+                }
+                transport->tx_base = transport->tx_next;
+                transport->stats.failures++;
+                transport_start_sync(transport, 0);
+                deadline = TRANSPORT_NO_DEADLINE;
+                break;
+            }
+            slot->retries++;
+            transport_send_slot(transport, slot, now_ms);
+            transport->stats.retransmits++;
+            elapsed = 0;
+        }
+
+        if (transport->config.rto_ms - elapsed < deadline) {
+            deadline = transport->config.rto_ms - elapsed;
+        }
+    }
+
+    if (transport->tx_sync == TRANSPORT_SYNC_DUE) {
+        transport_send_sync(transport, now_ms);
+    }
+    else if ((transport->tx_sync == TRANSPORT_SYNC_SENT) && (now_ms - transport->tx_sync_ms >= transport->config.rto_ms)) {
+        if (transport->tx_sync_retries >= TRANSPORT_MAX_RETRIES) {
+            transport->tx_sync = TRANSPORT_SYNC_LOST;
+        }
+        else {
+            transport->tx_sync_retries++;
+            transport_send_sync(transport, now_ms);
+        }
+    }
+    if (transport->tx_sync == TRANSPORT_SYNC_SENT) {
+        elapsed = now_ms - transport->tx_sync_ms;
+        deadline = transport->config.rto_ms - elapsed;
+    }
+
+    return deadline;
+}
@@ -0,0 +1,235 @@
+/*
+ *  transport.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef _TRANSPORT_H_
+#define _TRANSPORT_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************************************************************/
+
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+
+/*
+ * Selective repeat transport for bulk transfers, carried in frames as three
+ * commands:
+ *   COMMAND_XFER_DATA: sequence number (2 bytes LE), packet (command byte + payload)
+ *   COMMAND_XFER_ACK:  next expected sequence number (2 bytes LE),
+ *                      bitmap of the following frames received (4 bytes LE, bit 0 = next + 1)
+ *   COMMAND_XFER_SYNC: sequence number of the next data frame (2 bytes LE), TRANSPORT_SYNC_xxx flags (1 byte)
+ * Up to window frames are in flight. The sender retransmits a frame when its
+ * timer expires, or once as soon as an ACK shows later frames were received.
+ * The receiver stores out of order frames and hands the packets over in order.
+ * A sender opens the session with a SYNC at startup, TRANSPORT_SYNC_RESTART:
+ * the peer drops what it received and sends its frames in flight again after
+ * a SYNC of its own. After TRANSPORT_MAX_RETRIES it drops the transfer and
+ * sends a SYNC past it, the receiver no longer waits for the lost frames.
+ * The receiver applies a SYNC once the packets it handed over are released,
+ * an older copy is only acknowledged. No data is sent until an ACK answers
+ * the SYNC, and none is received before the first SYNC of the peer.
+ * Not thread safe: all calls from one task, except transport_release().
+ */
+#ifndef TRANSPORT_MAX_WINDOW
+#define TRANSPORT_MAX_WINDOW   (8)      /* Frame slots per direction, power of 2 */
+#endif
+#define TRANSPORT_MAX_PACKET   (1032)   /* Command byte, 4 bytes offset, 1 KB data, rounded */
+#define TRANSPORT_DATA_HEADER  (3)      /* Command byte, sequence number */
+#define TRANSPORT_ACK_HEADER   (7)      /* Command byte, next sequence number, bitmap */
+#define TRANSPORT_SYNC_HEADER  (4)      /* Command byte, sequence number, flags */
+#define TRANSPORT_SYNC_RESTART (0x01)   /* The sender restarted, the peer resyncs its own sender */
+#define TRANSPORT_SACK_BITS    (32)
+#define TRANSPORT_MAX_RETRIES  (10)     /* Retransmits of a frame or a SYNC before the peer is given up */
+#define TRANSPORT_NO_DEADLINE  (UINT32_MAX)
+
+/* transport_deliver_t results */
+enum {
+    TRANSPORT_DELIVER_BUSY = -1,        /* Not taken, try again later */
+    TRANSPORT_DELIVER_DONE = 0,         /* Handled, the slot is free */
+    TRANSPORT_DELIVER_HELD,             /* In use until transport_release() */
+};
+
+typedef struct {
+    uint8_t window;                     /* Frames in flight, 1 to TRANSPORT_MAX_WINDOW */
+    uint16_t rto_ms;                    /* Retransmit timeout */
+} transport_config_t;
+
+/*!
+ * @brief  Send a message: header then payload in one frame
+ */
+typedef void (*transport_output_t)(const uint8_t *header, uint16_t header_length, const uint8_t *payload, uint16_t length, void *arg);
+
+/*!
+ * @brief  Hand over a received packet, in order
+ * @retval TRANSPORT_DELIVER_xxx
+ */
+typedef int (*transport_deliver_t)(const uint8_t *packet, uint16_t length, void *arg);
+
+typedef struct {
+    uint16_t seq;
+    uint16_t length;
+    uint32_t sent_ms;
+    uint8_t state;
+    uint8_t retries;
+    uint8_t data[TRANSPORT_MAX_PACKET];
+} transport_tx_slot_t;
+
+typedef struct {
+    atomic_uchar state;                 /* Set free by transport_release() from another task */
+    uint16_t length;
+    uint8_t data[TRANSPORT_MAX_PACKET];
+} transport_rx_slot_t;
+
+typedef struct {
+    uint32_t sent;                      /* Data frames sent for the first time */
+    uint32_t retransmits;               /* On timeout */
+    uint32_t fast_retransmits;          /* On a hole in a selective ACK */
+    uint32_t failures;                  /* Transfers dropped after TRANSPORT_MAX_RETRIES */
+    uint32_t abandoned;                 /* Data frames dropped with their transfer */
+    uint32_t syncs_sent;                /* SYNC frames, retransmits included */
+    uint32_t resyncs;                   /* SYNCs of the peer applied */
+    uint32_t received;                  /* New data frames received */
+    uint32_t duplicates;                /* Data frames received again */
+    uint32_t out_of_window;             /* Data frames beyond the receive window or before the first SYNC */
+    uint32_t delivered;                 /* Packets handed over */
+    uint32_t acks_sent;
+    uint32_t acks_received;
+} transport_stats_t;
+
+typedef struct {
+    transport_config_t config;
+    transport_output_t output;
+    transport_deliver_t deliver;
+    void *arg;
+
+    /* Sender: [tx_base, tx_next) in flight */
+    uint16_t tx_base;
+    uint16_t tx_next;
+    transport_tx_slot_t tx[TRANSPORT_MAX_WINDOW];
+
+    /* Sender: SYNC of tx_sync_seq until an ACK answers it */
+    uint8_t tx_sync;                    /* TRANSPORT_SYNC_xxx state, see transport.c */
+    uint8_t tx_sync_flags;
+    uint8_t tx_sync_retries;
+    uint16_t tx_sync_seq;
+    uint32_t tx_sync_ms;
+
+    /* Receiver: [rx_release, rx_deliver) handed over, [rx_deliver, rx_next) received in order */
+    uint16_t rx_release;
+    uint16_t rx_deliver;
+    uint16_t rx_next;
+    bool rx_synced;                     /* First SYNC of the peer received */
+    transport_rx_slot_t rx[TRANSPORT_MAX_WINDOW];
+
+    transport_stats_t stats;
+} transport_t;
+
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+/*                                FUNCTIONS                                   */
+/******************************************************************************/
+
+/*!
+ * @brief  Initialize both directions, the first transport_poll() sends a restart SYNC
+ * @param  transport: Transport
+ * @param  config: Window and timer, window is clamped to TRANSPORT_MAX_WINDOW
+ * @param  output: Sends messages to the peer
+ * @param  deliver: Receives the packets in order
+ * @param  arg: Callback argument
+ * @retval None
+ */
+void transport_init(transport_t *transport, const transport_config_t *config, transport_output_t output, transport_deliver_t deliver, void *arg);
+
+/*!
+ * @brief  Queue a packet and send it
+ * @param  transport: Transport
+ * @param  packet: Command byte followed by the payload
+ * @param  length: Packet length, up to TRANSPORT_MAX_PACKET
+ * @param  now_ms: Current time
+ * @retval 0 if sent, -1 if the window is full, the SYNC not answered yet or the packet too long
+ */
+int transport_send(transport_t *transport, const uint8_t *packet, uint16_t length, uint32_t now_ms);
+
+/*!
+ * @brief  Number of packets that can be sent now
+ * @param  transport: Transport
+ * @retval Free slots in the send window
+ */
+uint32_t transport_send_space(transport_t *transport);
+
+/*!
+ * @brief  Handle a COMMAND_XFER_DATA payload
+ * @param  transport: Transport
+ * @param  data: Payload after the command byte
+ * @param  length: Payload length
+ * @retval 0 if success, -1 if malformed
+ */
+int transport_receive_data(transport_t *transport, const uint8_t *data, uint16_t length);
+
+/*!
+ * @brief  Handle a COMMAND_XFER_SYNC payload
+ * @param  transport: Transport
+ * @param  data: Payload after the command byte
+ * @param  length: Payload length
+ * @retval 0 if success, -1 if malformed
+ */
+int transport_receive_sync(transport_t *transport, const uint8_t *data, uint16_t length);
+
+/*!
+ * @brief  Handle a COMMAND_XFER_ACK payload
+ * @param  transport: Transport
+ * @param  data: Payload after the command byte
+ * @param  length: Payload length
+ * @param  now_ms: Current time
+ * @retval 0 if success, -1 if malformed
+ */
+int transport_receive_ack(transport_t *transport, const uint8_t *data, uint16_t length, uint32_t now_ms);
+
+/*!
+ * @brief  Free a packet held after TRANSPORT_DELIVER_HELD, from any task
+ * @param  transport: Transport
+ * @param  packet: Packet given to the deliver callback
+ * @retval None
+ */
+void transport_release(transport_t *transport, const uint8_t *packet);
+
+/*!
+ * @brief  Send a pending SYNC, retransmit expired frames and hand over pending packets
+ * @param  transport: Transport
+ * @param  now_ms: Current time
+ * @retval Time until the next retransmit, TRANSPORT_NO_DEADLINE if nothing is in flight
+ */
+uint32_t transport_poll(transport_t *transport, uint32_t now_ms);
+
+/******************************************************************************/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _TRANSPORT_H_ */
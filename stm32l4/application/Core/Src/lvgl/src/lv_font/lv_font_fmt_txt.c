@@ -44,6 +44,9 @@ static int32_t kern_pair_16_compare(const void * ref, const void * element);
     static inline void bits_write(uint8_t * out, uint32_t bit_pos, uint8_t val, uint8_t len);
     static inline void rle_init(const uint8_t * in,  uint8_t bpp);
     static inline uint8_t rle_next(void);
+#if LV_FONT_GLYPH_CACHE_SLOTS
+    static uint8_t * glyph_cache_get(const lv_font_t * font, uint32_t letter, bool * hit);
+#endif
 #endif /* LV_USE_FONT_COMPRESSED */
 
 /**********************
@@ -56,6 +59,18 @@ static int32_t kern_pair_16_compare(const void * ref, const void * element);
     static uint8_t rle_prev_v;
     static uint8_t rle_cnt;
     static rle_state_t rle_state;
+#if LV_FONT_GLYPH_CACHE_SLOTS
+    typedef struct {
+        const lv_font_t * font;
+        uint32_t letter;
+        uint32_t last_use;
+    } glyph_cache_slot_t;
+
+    static glyph_cache_slot_t glyph_cache_slots[LV_FONT_GLYPH_CACHE_SLOTS];
+    static uint32_t glyph_cache_clock;
+    static lv_font_glyph_cache_stats_t glyph_cache_stats;
+    static uint8_t glyph_cache_buf[LV_FONT_GLYPH_CACHE_SLOTS][LV_FONT_GLYPH_CACHE_SLOT_SIZE] LV_FONT_GLYPH_CACHE_ATTR;
+#endif /* LV_FONT_GLYPH_CACHE_SLOTS */
 #endif /* LV_USE_FONT_COMPRESSED */
 
 /**********************
@@ -112,6 +127,22 @@ const uint8_t * lv_font_get_bitmap_fmt_txt(const lv_font_t * font, uint32_t unic
                 break;
         }
 
+        bool prefilter = fdsc->bitmap_format == LV_FONT_FMT_TXT_COMPRESSED ? true : false;
+
+#if LV_FONT_GLYPH_CACHE_SLOTS
+        /*Decompress once into a cache slot and serve the following draws from there*/
+        if(buf_size <= LV_FONT_GLYPH_CACHE_SLOT_SIZE) {
+            bool hit;
+            uint8_t * slot = glyph_cache_get(font, unicode_letter, &hit);
+            if(!hit) {
+                decompress(&fdsc->glyph_bitmap[gdsc->bitmap_index], slot, gdsc->box_w, gdsc->box_h,
+                           (uint8_t)fdsc->bpp, prefilter);
+            }
+            return slot;
+        }
+        glyph_cache_stats.bypass++;
+#endif
+
         if(_lv_mem_get_size(LV_GC_ROOT(_lv_font_decompr_buf)) < buf_size) {
             uint8_t * tmp = lv_mem_realloc(LV_GC_ROOT(_lv_font_decompr_buf), buf_size);
             LV_ASSERT_MEM(tmp);
@@ -119,7 +150,6 @@ const uint8_t * lv_font_get_bitmap_fmt_txt(const lv_font_t * font, uint32_t unic
             LV_GC_ROOT(_lv_font_decompr_buf) = tmp;
         }
 
-        bool prefilter = fdsc->bitmap_format == LV_FONT_FMT_TXT_COMPRESSED ? true : false;
         decompress(&fdsc->glyph_bitmap[gdsc->bitmap_index], LV_GC_ROOT(_lv_font_decompr_buf), gdsc->box_w, gdsc->box_h,
                    (uint8_t)fdsc->bpp, prefilter);
         return LV_GC_ROOT(_lv_font_decompr_buf);
@@ -194,6 +224,34 @@ void _lv_font_clean_up_fmt_txt(void)
     }
 }
 
+#if LV_USE_FONT_COMPRESSED && LV_FONT_GLYPH_CACHE_SLOTS
+
+/**
+ * Get the statistics of the decompressed glyph cache
+ * @return pointer to the statistics
+ */
+const lv_font_glyph_cache_stats_t * lv_font_glyph_cache_get_stats(void)
+{
+    return &glyph_cache_stats;
+}
+
+/**
+ * Drop the cached glyphs of a font (or all glyphs if `font` is NULL)
+ * @param font pointer to a font which is about to be freed
+ */
+void lv_font_glyph_cache_invalidate(const lv_font_t * font)
+{
+    uint32_t i;
+    for(i = 0; i < LV_FONT_GLYPH_CACHE_SLOTS; i++) {
+        if(font == NULL || glyph_cache_slots[i].font == font) {
+            glyph_cache_slots[i].font = NULL;
+            glyph_cache_slots[i].last_use = 0;
+        }
+    }
+}
+
+#endif
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -561,6 +619,41 @@ static inline uint8_t rle_next(void)
 
     return ret;
 }
+#if LV_FONT_GLYPH_CACHE_SLOTS
+/**
+ * Find the cache slot of a glyph or take the least recently used one
+ * @param font pointer to font
+ * @param letter an unicode letter
+ * @param hit true: the slot already holds the glyph, false: the slot was (re)assigned and has to be filled
+ * @return pointer to the slot's bitmap buffer
+ */
+static uint8_t * glyph_cache_get(const lv_font_t * font, uint32_t letter, bool * hit)
+{
+    uint32_t i;
+    uint32_t lru = 0;
+
+    glyph_cache_clock++;
+    for(i = 0; i < LV_FONT_GLYPH_CACHE_SLOTS; i++) {
+        if(glyph_cache_slots[i].font == font && glyph_cache_slots[i].letter == letter) {
+            glyph_cache_slots[i].last_use = glyph_cache_clock;
+            glyph_cache_stats.hits++;
+            *hit = true;
+            return glyph_cache_buf[i];
+        }
+        if(glyph_cache_slots[i].last_use < glyph_cache_slots[lru].last_use) lru = i;
+    }
+
+    if(glyph_cache_slots[lru].font != NULL) glyph_cache_stats.evictions++;
+    glyph_cache_stats.misses++;
+
+    glyph_cache_slots[lru].font = font;
+    glyph_cache_slots[lru].letter = letter;
+    glyph_cache_slots[lru].last_use = glyph_cache_clock;
+    *hit = false;
+    return glyph_cache_buf[lru];
+}
+#endif /* LV_FONT_GLYPH_CACHE_SLOTS */
+
 #endif /* LV_USE_FONT_COMPRESSED */
 
 /** Code Comparator.
@@ -192,6 +192,26 @@ typedef struct {
 
 } lv_font_fmt_txt_dsc_t;
 
+#ifndef LV_FONT_GLYPH_CACHE_SLOTS
+#define LV_FONT_GLYPH_CACHE_SLOTS 0
+#endif
+
+#ifndef LV_FONT_GLYPH_CACHE_SLOT_SIZE
+#define LV_FONT_GLYPH_CACHE_SLOT_SIZE 1024
+#endif
+
+#ifndef LV_FONT_GLYPH_CACHE_ATTR
+#define LV_FONT_GLYPH_CACHE_ATTR
+#endif
+
+/** Statistics of the decompressed glyph cache*/
+typedef struct {
+    uint32_t hits;
+    uint32_t misses;
+    uint32_t evictions;
+    uint32_t bypass;    /*Glyphs larger than a slot, decompressed on every draw*/
+} lv_font_glyph_cache_stats_t;
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -220,6 +240,22 @@ bool lv_font_get_glyph_dsc_fmt_txt(const lv_font_t * font, lv_font_glyph_dsc_t *
  */
 void _lv_font_clean_up_fmt_txt(void);
 
+#if LV_USE_FONT_COMPRESSED && LV_FONT_GLYPH_CACHE_SLOTS
+
+/**
+ * Get the statistics of the decompressed glyph cache
+ * @return pointer to the statistics
+ */
+const lv_font_glyph_cache_stats_t * lv_font_glyph_cache_get_stats(void);
+
+/**
+ * Drop the cached glyphs of a font (or all glyphs if `font` is NULL)
+ * @param font pointer to a font which is about to be freed
+ */
+void lv_font_glyph_cache_invalidate(const lv_font_t * font);
+
+#endif
+
 /**********************
  *      MACROS
  **********************/
@@ -122,6 +122,10 @@ lv_font_t * lv_font_load(const char * font_name)
 void lv_font_free(lv_font_t * font)
 {
     if(NULL != font) {
+#if LV_USE_FONT_COMPRESSED && LV_FONT_GLYPH_CACHE_SLOTS
+        lv_font_glyph_cache_invalidate(font);
+#endif
+
         lv_font_fmt_txt_dsc_t * dsc = (lv_font_fmt_txt_dsc_t *) font->dsc;
 
         if(NULL != dsc) {
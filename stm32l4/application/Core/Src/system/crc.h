@@ -0,0 +1,87 @@
+/*
+ *  crc.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef _CRC_H_
+#define _CRC_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************************************************************/
+
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+
+#include <stdint.h>
+
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+
+/*
+ * Table driven CRCs, both can be computed in pieces by passing the previous
+ * result back as crc.
+ * CRC-16: CCITT polynomial 0x1021, not reflected (CRC-16/CCITT-FALSE)
+ * CRC-32: IEEE 802.3 polynomial, reflected (same as zlib)
+ * CRC-32/MPEG-2: same polynomial, not reflected, no final XOR (the STM32 CRC
+ * unit with its default settings, used by the bootloader)
+ */
+#define CRC16_INIT        (0xFFFF)
+#define CRC32_INIT        (0x00000000)
+#define CRC32_MPEG2_INIT  (0xFFFFFFFF)
+
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+/*                                FUNCTIONS                                   */
+/******************************************************************************/
+
+/*!
+ * @brief  Update a CRC-16/CCITT-FALSE
+ * @param  crc: CRC16_INIT or the previous result
+ * @param  data: Bytes
+ * @param  length: Number of bytes
+ * @retval CRC
+ */
+uint16_t crc16_ccitt(uint16_t crc, const uint8_t *data, uint32_t length);
+
+/*!
+ * @brief  Update a CRC-32 (IEEE)
+ * @param  crc: CRC32_INIT or the previous result
+ * @param  data: Bytes
+ * @param  length: Number of bytes
+ * @retval CRC
+ */
+uint32_t crc32_ieee(uint32_t crc, const uint8_t *data, uint32_t length);
+
+/*!
+ * @brief  Update a CRC-32/MPEG-2
+ * @param  crc: CRC32_MPEG2_INIT or the previous result
+ * @param  data: Bytes
+ * @param  length: Number of bytes
+ * @retval CRC
+ */
+uint32_t crc32_mpeg2(uint32_t crc, const uint8_t *data, uint32_t length);
+
+/******************************************************************************/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _CRC_H_ */
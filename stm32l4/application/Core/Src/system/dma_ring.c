@@ -0,0 +1,121 @@
+/*
+ *  dma_ring.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+
+#include <stddef.h>
+#include <stdbool.h>
+#include "dma_ring.h"
+
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+/*                                FUNCTIONS                                   */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+
+static void dma_ring_emit(dma_ring_t *ring, uint16_t offset, uint16_t length, dma_ring_span_cb_t callback, void *arg) {
+    ring->bytes += length;
+    ring->spans++;
+    if (callback != NULL) {
+        callback(&ring->buffer[offset], length, arg);
+    }
+}
+
+/*!
+ * @brief  Initialize a ring on a DMA buffer
+ */
+void dma_ring_init(dma_ring_t *ring, uint8_t *buffer, uint16_t size) {
+    ring->buffer = buffer;
+    ring->size = size;
+    ring->bytes = 0;
+    ring->spans = 0;
+    ring->events = 0;
+    dma_ring_reset(ring);
+}
+
+/*!
+ * @brief  Restart from the beginning of the buffer (DMA restarted)
+ */
+void dma_ring_reset(dma_ring_t *ring) {
+    ring->read_pos = 0;
+#ifdef DMA_RING_SIMULATION
+    ring->sim_write_pos = 0;
+#endif
+}
+
+/*!
+ * @brief  Hand over the bytes written since the last call
+ */
+void dma_ring_update(dma_ring_t *ring, uint16_t write_pos, dma_ring_span_cb_t callback, void *arg) {
+    ring->events++;
+    if (write_pos > ring->size) {
+        return;
+    }
+
+    if (write_pos > ring->read_pos) {
+        dma_ring_emit(ring, ring->read_pos, write_pos - ring->read_pos, callback, arg);
+    }
+    else if (write_pos < ring->read_pos) {
+        /* The DMA wrapped: tail of the buffer, then the head */
+        dma_ring_emit(ring, ring->read_pos, ring->size - ring->read_pos, callback, arg);
+        if (write_pos > 0) {
+            dma_ring_emit(ring, 0, write_pos, callback, arg);
+        }
+    }
+
+    ring->read_pos = (write_pos == ring->size) ? 0 : write_pos;
+}
+
+#ifdef DMA_RING_SIMULATION
+/*!
+ * @brief  Simulate the DMA receiving a burst of bytes followed by an idle line
+ */
+void dma_ring_sim_receive(dma_ring_t *ring, const uint8_t *data, uint32_t length, dma_ring_span_cb_t callback, void *arg) {
+    uint16_t half = ring->size / 2;
+    bool reported = false;
+
+    for (uint32_t i = 0; i < length; i++) {
+        ring->buffer[ring->sim_write_pos++] = data[i];
+        reported = false;
+
+        /* Half transfer and transfer complete events */
+        if ((ring->sim_write_pos == half) || (ring->sim_write_pos == ring->size)) {
+            dma_ring_update(ring, ring->sim_write_pos, callback, arg);
+            reported = true;
+        }
+        if (ring->sim_write_pos == ring->size) {
+            ring->sim_write_pos = 0;
+        }
+    }
+
+    /* Idle line event, the HAL does not report it when HT/TC just did */
+    if (!reported && (length > 0)) {
+        dma_ring_update(ring, ring->sim_write_pos, callback, arg);
+    }
+}
+#endif
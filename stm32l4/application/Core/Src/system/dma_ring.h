@@ -0,0 +1,111 @@
+/*
+ *  dma_ring.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef _DMA_RING_H_
+#define _DMA_RING_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************************************************************/
+
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+
+#include <stdint.h>
+
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+
+/*
+ * Reader for a circular DMA reception buffer. On each DMA event (half
+ * transfer, transfer complete, idle line) the DMA write position is given to
+ * dma_ring_update(), which hands the new bytes over as at most two
+ * contiguous spans, in order.
+ */
+
+/* Define to build dma_ring_sim_receive(), a stand-in for the DMA (host build) */
+/* #define DMA_RING_SIMULATION */
+
+typedef void (*dma_ring_span_cb_t)(const uint8_t *data, uint16_t length, void *arg);
+
+typedef struct {
+    uint8_t *buffer;
+    uint16_t size;
+    uint16_t read_pos;              /* Next byte to hand over */
+#ifdef DMA_RING_SIMULATION
+    uint16_t sim_write_pos;         /* Simulated DMA position */
+#endif
+    uint32_t bytes;                 /* Bytes handed over */
+    uint32_t spans;                 /* Spans handed over */
+    uint32_t events;                /* DMA events */
+} dma_ring_t;
+
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+/*                                FUNCTIONS                                   */
+/******************************************************************************/
+
+/*!
+ * @brief  Initialize a ring on a DMA buffer
+ * @param  ring: Ring
+ * @param  buffer: Buffer written by the DMA in circular mode
+ * @param  size: Buffer size in bytes
+ * @retval None
+ */
+void dma_ring_init(dma_ring_t *ring, uint8_t *buffer, uint16_t size);
+
+/*!
+ * @brief  Restart from the beginning of the buffer (DMA restarted)
+ * @param  ring: Ring
+ * @retval None
+ */
+void dma_ring_reset(dma_ring_t *ring);
+
+/*!
+ * @brief  Hand over the bytes written since the last call
+ * @param  ring: Ring
+ * @param  write_pos: Bytes written from the start of the buffer (size - NDTR), size on transfer complete
+ * @param  callback: Called for each contiguous span
+ * @param  arg: Callback argument
+ * @retval None
+ */
+void dma_ring_update(dma_ring_t *ring, uint16_t write_pos, dma_ring_span_cb_t callback, void *arg);
+
+#ifdef DMA_RING_SIMULATION
+/*!
+ * @brief  Simulate the DMA receiving a burst of bytes followed by an idle line
+ * @param  ring: Ring
+ * @param  data: Received bytes
+ * @param  length: Number of bytes
+ * @param  callback: Called for each contiguous span
+ * @param  arg: Callback argument
+ * @retval None
+ */
+void dma_ring_sim_receive(dma_ring_t *ring, const uint8_t *data, uint32_t length, dma_ring_span_cb_t callback, void *arg);
+#endif
+
+/******************************************************************************/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _DMA_RING_H_ */
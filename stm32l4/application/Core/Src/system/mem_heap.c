@@ -0,0 +1,483 @@
+/*
+ *  mem_heap.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+
+#include <stdbool.h>
+#include <string.h>
+#include "FreeRTOS.h"
+#include "task.h"
+#include "mem_heap.h"
+
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+
+/*
+ * Two level segregated fit:
+ *   first level  : power of two size classes
+ *   second level : each class split in MEM_SL_COUNT linear ranges
+ * A bitmap per level gives the first non empty free list with one bit scan,
+ * so allocation and free never walk the heap.
+ */
+#define MEM_ALIGN_LOG2         (3)
+#define MEM_ALIGN              (1 << MEM_ALIGN_LOG2)
+#define MEM_SL_LOG2            (4)
+#define MEM_SL_COUNT           (1 << MEM_SL_LOG2)
+#define MEM_FL_SHIFT           (MEM_SL_LOG2 + MEM_ALIGN_LOG2)
+#define MEM_FL_MAX             (18)                            /* Blocks up to 256K */
+#define MEM_FL_COUNT           (MEM_FL_MAX - MEM_FL_SHIFT + 1)
+#define MEM_SMALL_BLOCK        (1 << MEM_FL_SHIFT)
+
+#define MEM_ALIGN_UP(x)        (((x) + (MEM_ALIGN - 1)) & ~(size_t) (MEM_ALIGN - 1))
+#define MEM_ALIGN_DOWN(x)      ((x) & ~(size_t) (MEM_ALIGN - 1))
+
+/* Flags in the low bits of the block size */
+#define MEM_BLOCK_FREE         (0x01)
+#define MEM_BLOCK_PREV_FREE    (0x02)
+#define MEM_BLOCK_FLAGS        (MEM_BLOCK_FREE | MEM_BLOCK_PREV_FREE)
+
+/*
+ * Block header. prev_phys is stored in the last word of the previous block
+ * and is only valid while that block is free, next_free/prev_free overlap
+ * the payload and are only valid while this block is free.
+ */
+typedef struct mem_block {
+    struct mem_block *prev_phys;
+    uint32_t size;                  /* Payload size | MEM_BLOCK_xxx */
+    uint32_t tag;                   /* MEM_TAG_xxx of the owner */
+    struct mem_block *next_free;
+    struct mem_block *prev_free;
+} mem_block_t;
+
+#define MEM_PTR_SIZE           (sizeof(mem_block_t *))
+#define MEM_BLOCK_START        (offsetof(mem_block_t, next_free))
+#define MEM_BLOCK_OVERHEAD     (MEM_BLOCK_START - MEM_PTR_SIZE)
+#define MEM_BLOCK_SIZE_MIN     (MEM_ALIGN_UP(3 * MEM_PTR_SIZE))
+#define MEM_BLOCK_SIZE_MAX     ((size_t) 1 << MEM_FL_MAX)
+
+_Static_assert((MEM_BLOCK_OVERHEAD % MEM_ALIGN) == 0, "Block overhead breaks the alignment");
+_Static_assert(MEM_HEAP_SIZE < MEM_BLOCK_SIZE_MAX, "MEM_HEAP_SIZE larger than MEM_FL_MAX allows");
+
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+
+static uint64_t mem_pool[MEM_HEAP_SIZE / sizeof(uint64_t)];
+
+static uint32_t fl_bitmap;
+static uint32_t sl_bitmap[MEM_FL_COUNT];
+static mem_block_t *free_lists[MEM_FL_COUNT][MEM_SL_COUNT];
+
+static mem_block_t *first_block;
+static mem_heap_stats_t heap_stats;
+
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+/*                                FUNCTIONS                                   */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+
+static inline size_t block_size(const mem_block_t *block) {
+    return block->size & ~(uint32_t) MEM_BLOCK_FLAGS;
+}
+
+static inline void block_set_size(mem_block_t *block, size_t size) {
+    block->size = (uint32_t) size | (block->size & MEM_BLOCK_FLAGS);
+}
+
+static inline void *block_to_ptr(const mem_block_t *block) {
+    return (uint8_t *) block + MEM_BLOCK_START;
+}
+
+static inline mem_block_t *block_from_ptr(const void *ptr) {
+    return (mem_block_t *) ((uint8_t *) ptr - MEM_BLOCK_START);
+}
+
+/**
+ * @brief  Physically next block, its prev_phys is the last word of this payload
+ */
+static inline mem_block_t *block_next(const mem_block_t *block) {
+    return (mem_block_t *) ((uint8_t *) block_to_ptr(block) + block_size(block) - MEM_PTR_SIZE);
+}
+
+static inline int mem_fls(uint32_t value) {
+    return 31 - __builtin_clz(value);
+}
+
+static inline int mem_ffs(uint32_t value) {
+    return __builtin_ctz(value);
+}
+
+/**
+ * @brief  Free list that holds blocks of this size
+ */
+static void mapping_insert(size_t size, int *fl, int *sl) {
+    if (size < MEM_SMALL_BLOCK) {
+        *fl = 0;
+        *sl = (int) size / (MEM_SMALL_BLOCK / MEM_SL_COUNT);
+    } else {
+        int f = mem_fls((uint32_t) size);
+        *sl = (int) (size >> (f - MEM_SL_LOG2)) ^ MEM_SL_COUNT;
+        *fl = f - (MEM_FL_SHIFT - 1);
+    }
+}
+
+/**
+ * @brief  First free list whose blocks are all large enough for this size
+ */
+static void mapping_search(size_t size, int *fl, int *sl) {
+    if (size >= MEM_SMALL_BLOCK) {
+        size += ((size_t) 1 << (mem_fls((uint32_t) size) - MEM_SL_LOG2)) - 1;
+    }
+    mapping_insert(size, fl, sl);
+}
+
+static mem_block_t *search_suitable_block(int *fl, int *sl) {
+    uint32_t sl_map = sl_bitmap[*fl] & (~0UL << *sl);
+
+    if (sl_map == 0) {
+        uint32_t fl_map = fl_bitmap & (~0UL << (*fl + 1));
+        if (fl_map == 0) {
+            return NULL;
+        }
+        *fl = mem_ffs(fl_map);
+        sl_map = sl_bitmap[*fl];
+    }
+    *sl = mem_ffs(sl_map);
+
+    return free_lists[*fl][*sl];
+}
+
+static void remove_free_block(mem_block_t *block, int fl, int sl) {
+    mem_block_t *prev = block->prev_free;
+    mem_block_t *next = block->next_free;
+
+    if (next != NULL) {
+        next->prev_free = prev;
+    }
+    if (prev != NULL) {
+        prev->next_free = next;
+    } else {
+        free_lists[fl][sl] = next;
+        if (next == NULL) {
+            sl_bitmap[fl] &= ~(1UL << sl);
+            if (sl_bitmap[fl] == 0) {
+                fl_bitmap &= ~(1UL << fl);
+            }
+        }
+    }
+    heap_stats.free_blocks--;
+}
+
+static void insert_free_block(mem_block_t *block) {
+    int fl, sl;
+
+    mapping_insert(block_size(block), &fl, &sl);
+    block->prev_free = NULL;
+    block->next_free = free_lists[fl][sl];
+    if (block->next_free != NULL) {
+        block->next_free->prev_free = block;
+    }
+    free_lists[fl][sl] = block;
+    fl_bitmap |= (1UL << fl);
+    sl_bitmap[fl] |= (1UL << sl);
+    heap_stats.free_blocks++;
+}
+
+static void remove_block(mem_block_t *block) {
+    int fl, sl;
+
+    mapping_insert(block_size(block), &fl, &sl);
+    remove_free_block(block, fl, sl);
+}
+
+/**
+ * @brief  Mark a free block as used, return the tail to the free lists if it is large enough
+ */
+static void block_use(mem_block_t *block, size_t size) {
+    size_t total = block_size(block);
+
+    if (total >= size + MEM_BLOCK_OVERHEAD + MEM_BLOCK_SIZE_MIN) {
+        mem_block_t *remaining = (mem_block_t *) ((uint8_t *) block_to_ptr(block) + size - MEM_PTR_SIZE);
+        remaining->size = (uint32_t) (total - size - MEM_BLOCK_OVERHEAD) | MEM_BLOCK_FREE;
+        remaining->tag = MEM_TAG_COUNT;
+
+        /* The block after the remaining part keeps its PREV_FREE flag */
+        block_next(remaining)->prev_phys = remaining;
+        block_set_size(block, size);
+        insert_free_block(remaining);
+    } else {
+        block_next(block)->size &= ~MEM_BLOCK_PREV_FREE;
+    }
+    block->size &= ~MEM_BLOCK_FREE;
+}
+
+static void mem_heap_lock(void) {
+    vTaskSuspendAll();
+}
+
+static void mem_heap_unlock(void) {
+    (void) xTaskResumeAll();
+}
+
+/**
+ * @brief  Build the pool, one free block followed by a zero sized used sentinel
+ */
+static void mem_heap_init(void) {
+    uint8_t *pool = (uint8_t *) mem_pool;
+    size_t start = MEM_ALIGN_UP(MEM_BLOCK_START);
+    size_t size = MEM_ALIGN_DOWN(sizeof(mem_pool) - start + MEM_PTR_SIZE - sizeof(mem_block_t));
+
+    first_block = (mem_block_t *) (pool + start - MEM_BLOCK_START);
+    first_block->size = (uint32_t) size | MEM_BLOCK_FREE;
+    first_block->tag = MEM_TAG_COUNT;
+
+    mem_block_t *sentinel = block_next(first_block);
+    sentinel->prev_phys = first_block;
+    sentinel->size = MEM_BLOCK_PREV_FREE;
+    sentinel->tag = MEM_TAG_COUNT;
+
+    insert_free_block(first_block);
+
+    heap_stats.total = size + MEM_BLOCK_OVERHEAD;
+    heap_stats.free = heap_stats.total;
+    heap_stats.min_free = heap_stats.total;
+}
+
+/******************************************************************************/
+
+void *mem_heap_alloc(uint8_t tag, size_t size) {
+    void *ptr = NULL;
+    int fl, sl;
+
+    if (tag >= MEM_TAG_COUNT) {
+        return NULL;
+    }
+
+    mem_heap_lock();
+    if (first_block == NULL) {
+        mem_heap_init();
+    }
+
+    if ((size > 0) && (size < MEM_BLOCK_SIZE_MAX / 2)) {
+        size = (size < MEM_BLOCK_SIZE_MIN) ? MEM_BLOCK_SIZE_MIN : MEM_ALIGN_UP(size);
+        mapping_search(size, &fl, &sl);
+
+        mem_block_t *block = (fl < MEM_FL_COUNT) ? search_suitable_block(&fl, &sl) : NULL;
+        if (block != NULL) {
+            remove_free_block(block, fl, sl);
+            block_use(block, size);
+            block->tag = tag;
+            ptr = block_to_ptr(block);
+
+            uint32_t bytes = block_size(block) + MEM_BLOCK_OVERHEAD;
+            mem_tag_stats_t *owner = &heap_stats.tags[tag];
+            owner->used += bytes;
+            owner->allocs++;
+            if (owner->used > owner->peak) {
+                owner->peak = owner->used;
+            }
+
+            heap_stats.used += bytes;
+            heap_stats.free -= bytes;
+            if (heap_stats.used > heap_stats.peak) {
+                heap_stats.peak = heap_stats.used;
+            }
+            if (heap_stats.free < heap_stats.min_free) {
+                heap_stats.min_free = heap_stats.free;
+            }
+        }
+    }
+
+    if (ptr == NULL) {
+        heap_stats.tags[tag].failed++;
+    }
+    mem_heap_unlock();
+
+    return ptr;
+}
+
+void mem_heap_free(void *ptr) {
+    if (ptr == NULL) {
+        return;
+    }
+
+    mem_block_t *block = block_from_ptr(ptr);
+
+    mem_heap_lock();
+    if (((block->size & MEM_BLOCK_FREE) != 0) || (block->tag >= MEM_TAG_COUNT)) {
+        /* Double free or foreign pointer */
+        configASSERT(0);
+        mem_heap_unlock();
+        return;
+    }
+
+    uint32_t bytes = block_size(block) + MEM_BLOCK_OVERHEAD;
+    mem_tag_stats_t *owner = &heap_stats.tags[block->tag];
+    owner->used -= bytes;
+    owner->frees++;
+    heap_stats.used -= bytes;
+    heap_stats.free += bytes;
+
+    block->size |= MEM_BLOCK_FREE;
+    block->tag = MEM_TAG_COUNT;
+
+    /* Merge with the free neighbours */
+    if ((block->size & MEM_BLOCK_PREV_FREE) != 0) {
+        mem_block_t *prev = block->prev_phys;
+        remove_block(prev);
+        block_set_size(prev, block_size(prev) + block_size(block) + MEM_BLOCK_OVERHEAD);
+        block = prev;
+    }
+
+    mem_block_t *next = block_next(block);
+    if ((next->size & MEM_BLOCK_FREE) != 0) {
+        remove_block(next);
+        block_set_size(block, block_size(block) + block_size(next) + MEM_BLOCK_OVERHEAD);
+        next = block_next(block);
+    }
+
+    next->prev_phys = block;
+    next->size |= MEM_BLOCK_PREV_FREE;
+    insert_free_block(block);
+    mem_heap_unlock();
+}
+
+size_t mem_heap_block_size(const void *ptr) {
+    return (ptr != NULL) ? block_size(block_from_ptr(ptr)) : 0;
+}
+
+void mem_heap_get_stats(mem_heap_stats_t *stats) {
+    mem_heap_lock();
+    if (first_block == NULL) {
+        mem_heap_init();
+    }
+
+    *stats = heap_stats;
+    stats->largest_free = 0;
+
+    /* Only the highest non empty list can hold the largest block */
+    if (fl_bitmap != 0) {
+        int fl = mem_fls(fl_bitmap);
+        int sl = mem_fls(sl_bitmap[fl]);
+        for (mem_block_t *block = free_lists[fl][sl]; block != NULL; block = block->next_free) {
+            if (block_size(block) > stats->largest_free) {
+                stats->largest_free = block_size(block);
+            }
+        }
+    }
+    mem_heap_unlock();
+
+    /* Free bytes include the block headers, count the header of the largest block too */
+    if ((stats->free > 0) && (stats->largest_free > 0)) {
+        stats->fragmentation = (uint8_t) (100 - ((uint64_t) (stats->largest_free + MEM_BLOCK_OVERHEAD) * 100) / stats->free);
+    } else {
+        stats->fragmentation = 0;
+    }
+}
+
+int mem_heap_check(void) {
+    int result = 0;
+    uint32_t free_blocks = 0;
+    uint32_t used = 0;
+
+    mem_heap_lock();
+    if (first_block == NULL) {
+        mem_heap_init();
+    }
+
+    bool prev_free = false;
+    mem_block_t *block = first_block;
+    while (block_size(block) != 0) {
+        bool is_free = (block->size & MEM_BLOCK_FREE) != 0;
+
+        if ((((block->size & MEM_BLOCK_PREV_FREE) != 0) != prev_free) ||
+            (prev_free && is_free) ||
+            ((block_size(block) % MEM_ALIGN) != 0)) {
+            result = -1;
+            break;
+        }
+
+        mem_block_t *next = block_next(block);
+        if (is_free) {
+            if (next->prev_phys != block) {
+                result = -1;
+                break;
+            }
+            free_blocks++;
+        } else {
+            used += block_size(block) + MEM_BLOCK_OVERHEAD;
+        }
+        prev_free = is_free;
+        block = next;
+    }
+
+    if ((result == 0) && ((((block->size & MEM_BLOCK_PREV_FREE) != 0) != prev_free) ||
+                          (free_blocks != heap_stats.free_blocks) ||
+                          (used != heap_stats.used))) {
+        result = -1;
+    }
+    mem_heap_unlock();
+
+    return result;
+}
+
+void *mem_heap_lvgl_alloc(size_t size) {
+    return mem_heap_alloc(MEM_TAG_LVGL, size);
+}
+
+void mem_heap_lvgl_free(void *ptr) {
+    mem_heap_free(ptr);
+}
+
+/******************************************************************************/
+/*                     FreeRTOS heap (replaces heap_4.c)                      */
+/******************************************************************************/
+
+void *pvPortMalloc(size_t xWantedSize) {
+    void *pvReturn = mem_heap_alloc(MEM_TAG_RTOS, xWantedSize);
+
+    traceMALLOC(pvReturn, xWantedSize);
+
+#if (configUSE_MALLOC_FAILED_HOOK == 1)
+    if (pvReturn == NULL) {
+        extern void vApplicationMallocFailedHook(void);
+        vApplicationMallocFailedHook();
+    }
+#endif
+
+    return pvReturn;
+}
+
+void vPortFree(void *pv) {
+    if (pv != NULL) {
+        traceFREE(pv, mem_heap_block_size(pv));
+        mem_heap_free(pv);
+    }
+}
+
+size_t xPortGetFreeHeapSize(void) {
+    return heap_stats.free;
+}
+
+size_t xPortGetMinimumEverFreeHeapSize(void) {
+    return heap_stats.min_free;
+}
+
+void vPortInitialiseBlocks(void) {
+    /* The pool is built on the first allocation */
+}
@@ -0,0 +1,134 @@
+/*
+ *  mem_heap.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef _MEM_HEAP_H_
+#define _MEM_HEAP_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************************************************************/
+
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+
+#include <stddef.h>
+#include <stdint.h>
+
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+
+/*
+ * Single heap shared by FreeRTOS (pvPortMalloc) and LVGL (LV_MEM_CUSTOM).
+ * TLSF allocator: allocation and free are O(1), bounded by the bitmap size,
+ * independent of the number of blocks in the heap.
+ */
+
+/* Pool size in bytes, defaults to the FreeRTOS heap size */
+#ifndef MEM_HEAP_SIZE
+#define MEM_HEAP_SIZE          (configTOTAL_HEAP_SIZE)
+#endif
+
+/* Users of the heap, allocations are accounted per tag */
+enum {
+    MEM_TAG_RTOS = 0,           /* Tasks, queues, mutexes, timers */
+    MEM_TAG_LVGL,               /* Objects, styles, fonts and images */
+    MEM_TAG_APP,                /* Application buffers */
+    MEM_TAG_COUNT
+};
+
+typedef struct {
+    uint32_t used;              /* Bytes in use */
+    uint32_t peak;              /* High water mark of used */
+    uint32_t allocs;            /* Successful allocations */
+    uint32_t frees;
+    uint32_t failed;            /* Allocations that could not be served */
+} mem_tag_stats_t;
+
+typedef struct {
+    uint32_t total;             /* Pool size available for blocks */
+    uint32_t used;              /* Bytes in use, block headers included */
+    uint32_t peak;              /* High water mark of used */
+    uint32_t free;              /* Free bytes */
+    uint32_t min_free;          /* Lowest free ever */
+    uint32_t largest_free;      /* Largest allocation that would succeed */
+    uint32_t free_blocks;       /* Number of free blocks */
+    uint8_t fragmentation;      /* 100 * (1 - largest_free / free), in percent */
+    mem_tag_stats_t tags[MEM_TAG_COUNT];
+} mem_heap_stats_t;
+
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+/*                                FUNCTIONS                                   */
+/******************************************************************************/
+
+/*!
+ * @brief  Allocate memory from the shared heap
+ * @param  tag: Owner of the allocation, MEM_TAG_xxx
+ * @param  size: Number of bytes
+ * @retval Pointer aligned to 8 bytes, NULL if there is no block large enough
+ */
+void *mem_heap_alloc(uint8_t tag, size_t size);
+
+/*!
+ * @brief  Release memory returned by mem_heap_alloc
+ * @param  ptr: Pointer to release, NULL is ignored
+ * @retval None
+ */
+void mem_heap_free(void *ptr);
+
+/*!
+ * @brief  Get the usable size of an allocated block
+ * @param  ptr: Allocated pointer
+ * @retval Usable bytes, may be larger than the requested size
+ */
+size_t mem_heap_block_size(const void *ptr);
+
+/*!
+ * @brief  Get the heap statistics
+ * @param  stats: Output statistics
+ * @retval None
+ */
+void mem_heap_get_stats(mem_heap_stats_t *stats);
+
+/*!
+ * @brief  Check the consistency of the heap (walks every block, not O(1))
+ * @param  None
+ * @retval 0 if the heap is consistent, -1 otherwise
+ */
+int mem_heap_check(void);
+
+/*!
+ * @brief  LVGL allocator, see LV_MEM_CUSTOM_ALLOC in lv_conf.h
+ */
+void *mem_heap_lvgl_alloc(size_t size);
+
+/*!
+ * @brief  LVGL release, see LV_MEM_CUSTOM_FREE in lv_conf.h
+ */
+void mem_heap_lvgl_free(void *ptr);
+
+/******************************************************************************/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _MEM_HEAP_H_ */
@@ -0,0 +1,164 @@
+/*
+ *  ring_buffer.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+
+#include <string.h>
+#include "ring_buffer.h"
+
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+/*                                FUNCTIONS                                   */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+
+/*!
+ * @brief  Initialize an empty ring
+ */
+int ring_buffer_init(ring_buffer_t *ring, uint8_t *buffer, uint32_t size) {
+    if ((size == 0) || ((size & (size - 1)) != 0)) {
+        return -1;
+    }
+
+    ring->buffer = buffer;
+    ring->size = size;
+    ring->mask = size - 1;
+    atomic_init(&ring->head, 0);
+    atomic_init(&ring->tail, 0);
+
+    return 0;
+}
+
+/*!
+ * @brief  Number of bytes ready to read
+ */
+uint32_t ring_buffer_count(ring_buffer_t *ring) {
+    return atomic_load_explicit(&ring->head, memory_order_acquire) - atomic_load_explicit(&ring->tail, memory_order_acquire);
+}
+
+/*!
+ * @brief  Number of bytes that can be written
+ */
+uint32_t ring_buffer_free(ring_buffer_t *ring) {
+    return ring->size - ring_buffer_count(ring);
+}
+
+/*!
+ * @brief  Get the writable space that is contiguous in memory, producer only
+ */
+uint32_t ring_buffer_reserve_contiguous(ring_buffer_t *ring, uint8_t **data) {
+    uint32_t head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+    uint32_t tail = atomic_load_explicit(&ring->tail, memory_order_acquire);
+    uint32_t offset = head & ring->mask;
+    uint32_t length = ring->size - (head - tail);
+
+    if (length > ring->size - offset) {
+        length = ring->size - offset;
+    }
+    *data = &ring->buffer[offset];
+
+    return length;
+}
+
+/*!
+ * @brief  Publish bytes written in the reserved space, producer only
+ */
+void ring_buffer_produce(ring_buffer_t *ring, uint32_t length) {
+    atomic_store_explicit(&ring->head, atomic_load_explicit(&ring->head, memory_order_relaxed) + length, memory_order_release);
+}
+
+/*!
+ * @brief  Write bytes, producer only
+ */
+uint32_t ring_buffer_write(ring_buffer_t *ring, const uint8_t *data, uint32_t length) {
+    uint32_t written = 0;
+
+    /* At most two spans: up to the end of the buffer, then from its start */
+    for (int i = 0; (i < 2) && (written < length); i++) {
+        uint8_t *space;
+        uint32_t chunk = ring_buffer_reserve_contiguous(ring, &space);
+        if (chunk == 0) {
+            break;
+        }
+        if (chunk > length - written) {
+            chunk = length - written;
+        }
+        memcpy(space, &data[written], chunk);
+        ring_buffer_produce(ring, chunk);
+        written += chunk;
+    }
+
+    return written;
+}
+
+/*!
+ * @brief  Get the readable bytes that are contiguous in memory, consumer only
+ */
+uint32_t ring_buffer_peek_contiguous(ring_buffer_t *ring, const uint8_t **data) {
+    uint32_t tail = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+    uint32_t head = atomic_load_explicit(&ring->head, memory_order_acquire);
+    uint32_t offset = tail & ring->mask;
+    uint32_t length = head - tail;
+
+    if (length > ring->size - offset) {
+        length = ring->size - offset;
+    }
+    *data = &ring->buffer[offset];
+
+    return length;
+}
+
+/*!
+ * @brief  Release bytes returned by ring_buffer_peek_contiguous(), consumer only
+ */
+void ring_buffer_commit(ring_buffer_t *ring, uint32_t length) {
+    atomic_store_explicit(&ring->tail, atomic_load_explicit(&ring->tail, memory_order_relaxed) + length, memory_order_release);
+}
+
+/*!
+ * @brief  Read bytes, consumer only
+ */
+uint32_t ring_buffer_read(ring_buffer_t *ring, uint8_t *data, uint32_t length) {
+    uint32_t read = 0;
+
+    for (int i = 0; (i < 2) && (read < length); i++) {
+        const uint8_t *span;
+        uint32_t chunk = ring_buffer_peek_contiguous(ring, &span);
+        if (chunk == 0) {
+            break;
+        }
+        if (chunk > length - read) {
+            chunk = length - read;
+        }
+        memcpy(&data[read], span, chunk);
+        ring_buffer_commit(ring, chunk);
+        read += chunk;
+    }
+
+    return read;
+}
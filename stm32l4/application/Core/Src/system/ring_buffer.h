@@ -0,0 +1,135 @@
+/*
+ *  ring_buffer.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef _RING_BUFFER_H_
+#define _RING_BUFFER_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************************************************************/
+
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+
+#include <stdint.h>
+#include <stdatomic.h>
+
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+
+/*
+ * Single producer / single consumer byte ring, no lock needed: the producer
+ * (e.g. an interrupt) only writes head, the consumer only writes tail.
+ * Indices run freely and are masked with size - 1, size must be a power of 2.
+ */
+typedef struct {
+    uint8_t *buffer;
+    uint32_t size;
+    uint32_t mask;
+    atomic_uint head;               /* Total bytes written, producer only */
+    atomic_uint tail;               /* Total bytes read, consumer only */
+} ring_buffer_t;
+
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+/*                                FUNCTIONS                                   */
+/******************************************************************************/
+
+/*!
+ * @brief  Initialize an empty ring
+ * @param  ring: Ring
+ * @param  buffer: Storage
+ * @param  size: Storage size, power of 2
+ * @retval 0 if success, -1 if size is not a power of 2
+ */
+int ring_buffer_init(ring_buffer_t *ring, uint8_t *buffer, uint32_t size);
+
+/*!
+ * @brief  Number of bytes ready to read
+ * @param  ring: Ring
+ * @retval Bytes in the ring
+ */
+uint32_t ring_buffer_count(ring_buffer_t *ring);
+
+/*!
+ * @brief  Number of bytes that can be written
+ * @param  ring: Ring
+ * @retval Free bytes
+ */
+uint32_t ring_buffer_free(ring_buffer_t *ring);
+
+/*!
+ * @brief  Write bytes, producer only
+ * @param  ring: Ring
+ * @param  data: Bytes to write
+ * @param  length: Number of bytes
+ * @retval Number of bytes written, less than length when the ring is full
+ */
+uint32_t ring_buffer_write(ring_buffer_t *ring, const uint8_t *data, uint32_t length);
+
+/*!
+ * @brief  Read bytes, consumer only
+ * @param  ring: Ring
+ * @param  data: Output buffer
+ * @param  length: Maximum number of bytes
+ * @retval Number of bytes read
+ */
+uint32_t ring_buffer_read(ring_buffer_t *ring, uint8_t *data, uint32_t length);
+
+/*!
+ * @brief  Get the readable bytes that are contiguous in memory, consumer only
+ * @param  ring: Ring
+ * @param  data: Output pointer to the first byte
+ * @retval Number of contiguous bytes (the rest follows from the start of the buffer)
+ */
+uint32_t ring_buffer_peek_contiguous(ring_buffer_t *ring, const uint8_t **data);
+
+/*!
+ * @brief  Release bytes returned by ring_buffer_peek_contiguous(), consumer only
+ * @param  ring: Ring
+ * @param  length: Number of bytes handled
+ * @retval None
+ */
+void ring_buffer_commit(ring_buffer_t *ring, uint32_t length);
+
+/*!
+ * @brief  Get the writable space that is contiguous in memory, producer only
+ * @param  ring: Ring
+ * @param  data: Output pointer to the first free byte
+ * @retval Number of contiguous free bytes
+ */
+uint32_t ring_buffer_reserve_contiguous(ring_buffer_t *ring, uint8_t **data);
+
+/*!
+ * @brief  Publish bytes written in the space from ring_buffer_reserve_contiguous(), producer only
+ * @param  ring: Ring
+ * @param  length: Number of bytes written
+ * @retval None
+ */
+void ring_buffer_produce(ring_buffer_t *ring, uint32_t length);
+
+/******************************************************************************/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _RING_BUFFER_H_ */
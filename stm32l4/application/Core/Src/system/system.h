@@ -35,6 +35,8 @@
 #define ETX_LOAD_PREV_APP     (0xFACEFADE)     /* App requests to load the previous version */
 
 #define OTA_FIRMWARE_ADDRESS  (0x10000)
+#define RESOURCE_PACK_ADDRESS (0x800000)     /* Fonts/images pack in W25Q, see tools/res_pack.py */
+#define RESOURCE_PACK_MAX_SIZE (0x400000)
 #define MAGIC_NUMBER          (0xAA555AA5)
 
 typedef void (*application_func_t)(void);
@@ -43,6 +45,10 @@ typedef struct {
     int32_t fw_size;
     uint32_t fw_crc;
     uint32_t reserved1;
+    uint32_t fw_crc32;          /* CRC-32/MPEG-2 of the file, valid if reserved2 is MAGIC_NUMBER */
+    uint32_t reserved2;
+    uint32_t version;           /* Image version given with the OTA, 0xFFFFFFFF if none */
+    uint32_t reserved3;         /* Pads the configuration to double words */
 } __attribute__((packed)) ext_slot_t;
 
 typedef struct {
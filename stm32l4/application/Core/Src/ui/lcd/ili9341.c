@@ -16,9 +16,38 @@
 /*                     EXPORTED TYPES and DEFINITIONS                         */
 /******************************************************************************/
 
+#ifndef FMC_LCD_BASE
 #define FMC_LCD_BASE ((uint32_t)(0x60000000 | 0x00000000))
+#endif
 #define FMC_LCD ((lcd_fmc_address_t *)FMC_LCD_BASE)
 
+/* Bus accesses, the host tests replace them by a panel model (host/test/lcd_model.c) */
+#ifndef LCD_BUS_MODEL
+#define LCD_WRITE_REG(value)    (FMC_LCD->lcd_reg = (value))
+#define LCD_WRITE_RAM(value)    (FMC_LCD->lcd_ram = (value))
+#define LCD_READ_RAM()          (FMC_LCD->lcd_ram)
+#else
+void lcd_model_write_reg(uint16_t value);
+void lcd_model_write_ram(uint16_t value);
+uint16_t lcd_model_read_ram(void);
+#define LCD_WRITE_REG(value)    lcd_model_write_reg(value)
+#define LCD_WRITE_RAM(value)    lcd_model_write_ram(value)
+#define LCD_READ_RAM()          lcd_model_read_ram()
+#endif
+
+#define LCD_PANEL_WIDTH         (240)
+#define LCD_PANEL_HEIGHT        (320)
+
+/* Memory access control (0x36) bits */
+#define MADCTL_MY               (0x80)
+#define MADCTL_MX               (0x40)
+#define MADCTL_MV               (0x20)
+#define MADCTL_BGR              (0x08)
+
+#define LCD_DMA_INSTANCE        DMA2_Channel1
+#define LCD_DMA_IRQ             DMA2_Channel1_IRQn
+#define LCD_DMA_MAX_TRANSFER    (0xFFFF)    /* CNDTR is 16 bits */
+
 typedef struct lcd_fmc_address_st {
 	__IO uint16_t lcd_reg;
 	__IO uint16_t lcd_ram;
@@ -40,6 +69,19 @@ typedef struct lcd_params_st {
 
 lcd_params_t lcd_params;
 
+static const uint8_t madctl_rotation[ILI9341_ROTATION_COUNT] = {
+    /* ILI9341_ROTATION_0 */   MADCTL_BGR,
+    /* ILI9341_ROTATION_90 */  MADCTL_MV | MADCTL_MX | MADCTL_BGR,
+    /* ILI9341_ROTATION_180 */ MADCTL_MY | MADCTL_MX | MADCTL_BGR,
+    /* ILI9341_ROTATION_270 */ MADCTL_MV | MADCTL_MY | MADCTL_BGR,
+};
+
+static DMA_HandleTypeDef hdma_lcd;
+static const uint16_t *dma_src;
+static uint32_t dma_remaining;
+static ili9341_dma_done_t dma_done;
+static volatile uint8_t dma_busy;   /* From ili9341_write_pixels_dma() to the last chunk interrupt */
+
 /******************************************************************************/
 /*                              EXPORTED DATA                                 */
 /******************************************************************************/
@@ -58,7 +100,7 @@ lcd_params_t lcd_params;
  * @brief  Write a command to the LCD
  */
 static void lcd_write_cmd(volatile uint16_t cmd) {
-	FMC_LCD->lcd_reg = cmd;
+	LCD_WRITE_REG(cmd);
 }
 
 /*!
@@ -66,12 +108,12 @@ static void lcd_write_cmd(volatile uint16_t cmd) {
  */
 static uint16_t lcd_read_data(void) {
 	volatile uint16_t data;
-	data = FMC_LCD->lcd_ram;
+	data = LCD_READ_RAM();
 	return data;
 }
 
 void lcd_write_data(uint8_t x) {
-    FMC_LCD->lcd_ram = 0x00FF & x;
+    LCD_WRITE_RAM(0x00FF & x);
 }
 
 /*!
@@ -123,10 +165,76 @@ static int lcd_read_id(void) {
 	return -1;
 }
 
+/*!
+ * @brief  Start the next DMA chunk
+ */
+static void lcd_dma_start_chunk(void) {
+    uint32_t length = dma_remaining;
+    if (length > LCD_DMA_MAX_TRANSFER) {
+        length = LCD_DMA_MAX_TRANSFER;
+    }
+
+    const uint16_t *src = dma_src;
+    dma_src += length;
+    dma_remaining -= length;
+    HAL_DMA_Start_IT(&hdma_lcd, (uint32_t)src, (uint32_t)&FMC_LCD->lcd_ram, length);
+}
+
+/*!
+ * @brief  DMA transfer completed, chain the next chunk or notify the caller
+ */
+static void lcd_dma_xfer_cplt(DMA_HandleTypeDef *hdma) {
+    (void) hdma;
+
+    if (dma_remaining > 0) {
+        lcd_dma_start_chunk();
+        return;
+    }
+
+    dma_busy = 0;
+    if (dma_done != NULL) {
+        dma_done();
+    }
+}
+
+/*!
+ * @brief  Wait for the end of the DMA transfer to the display RAM
+ */
+static void lcd_dma_wait(void) {
+    while (dma_busy) {
+    }
+}
+
+/*!
+ * @brief  Initialize memory to FMC DMA channel
+ */
+static void lcd_dma_init(void) {
+    __HAL_RCC_DMA2_CLK_ENABLE();
+
+    /* Source is the draw buffer (incremented), destination is the LCD RAM register (fixed) */
+    hdma_lcd.Instance = LCD_DMA_INSTANCE;
+    hdma_lcd.Init.Request = DMA_REQUEST_0;
+    hdma_lcd.Init.Direction = DMA_MEMORY_TO_MEMORY;
+    hdma_lcd.Init.PeriphInc = DMA_PINC_ENABLE;
+    hdma_lcd.Init.MemInc = DMA_MINC_DISABLE;
+    hdma_lcd.Init.PeriphDataAlignment = DMA_PDATAALIGN_HALFWORD;
+    hdma_lcd.Init.MemDataAlignment = DMA_MDATAALIGN_HALFWORD;
+    hdma_lcd.Init.Mode = DMA_NORMAL;
+    hdma_lcd.Init.Priority = DMA_PRIORITY_HIGH;
+    if (HAL_DMA_Init(&hdma_lcd) != HAL_OK) {
+        Error_Handler();
+    }
+    HAL_DMA_RegisterCallback(&hdma_lcd, HAL_DMA_XFER_CPLT_CB_ID, lcd_dma_xfer_cplt);
+
+    HAL_NVIC_SetPriority(LCD_DMA_IRQ, 5, 0);
+    HAL_NVIC_EnableIRQ(LCD_DMA_IRQ);
+}
+
 /*!
  * @brief  Initialize the ILI9341 display
  */
 void ili9341_init(void) {
+    lcd_dma_init();
     lcd_read_id();
 
     lcd_write_cmd(0x11);
@@ -175,8 +283,7 @@ void ili9341_init(void) {
     lcd_write_cmd(0xC7);
     lcd_write_data(0xAA);
 
-    lcd_write_cmd(0x36);
-    lcd_write_data(0x08);
+    ili9341_set_rotation(ILI9341_ROTATION_0);
 
     lcd_write_cmd(0x3A);
     lcd_write_data(0x55);
@@ -242,31 +349,138 @@ void ili9341_init(void) {
 /*!
  * @brief  Set the display window
  */
-void ili9341_set_window(unsigned char x0, unsigned char x1, unsigned int y0, unsigned int y1) {
-	unsigned char YSH, YSL, YEH, YEL;
-
-	YSH = y0 >> 8;
-	YSL = y0;
-
-	YEH = y1 >> 8;
-	YEL = y1;
-
+void ili9341_set_window(uint16_t x0, uint16_t x1, uint16_t y0, uint16_t y1) {
+	/* Coordinates are in the rotated frame, MADCTL maps them to the panel */
 	lcd_write_cmd(0x2A);
-	lcd_write_data(0x00);
+	lcd_write_data(x0 >> 8);
 	lcd_write_data(x0);
-	lcd_write_data(0x00);
+	lcd_write_data(x1 >> 8);
 	lcd_write_data(x1);
 	lcd_write_cmd(0x2B);
-	lcd_write_data(YSH);
-	lcd_write_data(YSL);
-	lcd_write_data(YEH);
-	lcd_write_data(YEL);
+	lcd_write_data(y0 >> 8);
+	lcd_write_data(y0);
+	lcd_write_data(y1 >> 8);
+	lcd_write_data(y1);
 	lcd_write_cmd(0x2C);
 }
 
+/*!
+ * @brief  Set the display orientation
+ */
+void ili9341_set_rotation(uint8_t rotation) {
+	if (rotation >= ILI9341_ROTATION_COUNT) {
+		return;
+	}
+
+	/* MADCTL remaps the addresses of the pixels a running DMA transfer still writes */
+	lcd_dma_wait();
+	lcd_write_cmd(0x36);
+	lcd_write_data(madctl_rotation[rotation]);
+
+	lcd_params.lcd_direction = rotation;
+	if ((rotation == ILI9341_ROTATION_90) || (rotation == ILI9341_ROTATION_270)) {
+		lcd_params.lcd_width = LCD_PANEL_HEIGHT;
+		lcd_params.lcd_height = LCD_PANEL_WIDTH;
+	}
+	else {
+		lcd_params.lcd_width = LCD_PANEL_WIDTH;
+		lcd_params.lcd_height = LCD_PANEL_HEIGHT;
+	}
+}
+
 /*!
  * @brief  Write data to the display
  */
 void ili9341_write_data(uint16_t data) {
-    FMC_LCD->lcd_ram = data;
+    LCD_WRITE_RAM(data);
+}
+
+/*!
+ * @brief  Write a block of pixels to the display RAM
+ */
+void ili9341_write_pixels(const uint16_t *data, uint32_t count) {
+    /* Align the source so two pixels are fetched with one word load */
+    if ((((uint32_t)data & 0x3) != 0) && (count > 0)) {
+        LCD_WRITE_RAM(*data++);
+        count--;
+    }
+
+    const uint32_t *src = (const uint32_t *)data;
+    while (count >= 8) {
+        uint32_t p0 = src[0];
+        uint32_t p1 = src[1];
+        uint32_t p2 = src[2];
+        uint32_t p3 = src[3];
+        LCD_WRITE_RAM((uint16_t)p0);
+        LCD_WRITE_RAM((uint16_t)(p0 >> 16));
+        LCD_WRITE_RAM((uint16_t)p1);
+        LCD_WRITE_RAM((uint16_t)(p1 >> 16));
+        LCD_WRITE_RAM((uint16_t)p2);
+        LCD_WRITE_RAM((uint16_t)(p2 >> 16));
+        LCD_WRITE_RAM((uint16_t)p3);
+        LCD_WRITE_RAM((uint16_t)(p3 >> 16));
+        src += 4;
+        count -= 8;
+    }
+
+    data = (const uint16_t *)src;
+    while (count > 0) {
+        LCD_WRITE_RAM(*data++);
+        count--;
+    }
+}
+
+/*!
+ * @brief  Write the same color a number of times to the display RAM
+ */
+void ili9341_fill_color(uint16_t color, uint32_t count) {
+    while (count >= 8) {
+        LCD_WRITE_RAM(color);
+        LCD_WRITE_RAM(color);
+        LCD_WRITE_RAM(color);
+        LCD_WRITE_RAM(color);
+        LCD_WRITE_RAM(color);
+        LCD_WRITE_RAM(color);
+        LCD_WRITE_RAM(color);
+        LCD_WRITE_RAM(color);
+        count -= 8;
+    }
+
+    while (count > 0) {
+        LCD_WRITE_RAM(color);
+        count--;
+    }
+}
+
+/*!
+ * @brief  Set the display window and write its pixels
+ */
+void ili9341_write_area(uint16_t x0, uint16_t x1, uint16_t y0, uint16_t y1, const uint16_t *data) {
+    ili9341_set_window(x0, x1, y0, y1);
+    ili9341_write_pixels(data, (uint32_t)(x1 - x0 + 1) * (y1 - y0 + 1));
+}
+
+/*!
+ * @brief  Start a DMA transfer of pixels to the display RAM
+ */
+void ili9341_write_pixels_dma(const uint16_t *data, uint32_t count, ili9341_dma_done_t done) {
+    dma_done = done;
+    if (count == 0) {
+        if (dma_done != NULL) {
+            dma_done();
+        }
+        return;
+    }
+
+    dma_src = data;
+    dma_remaining = count;
+    dma_busy = 1;
+    lcd_dma_start_chunk();
+}
+
+/*!
+ * @brief  Handle the display DMA interrupt
+ */
+void ili9341_dma_irq_handler(void) {
+    HAL_DMA_IRQHandler(&hdma_lcd);
 }
@@ -17,13 +17,22 @@ extern "C" {
 /*                              INCLUDE FILES                                 */
 /******************************************************************************/
 
-
+#include <stdint.h>
 
 /******************************************************************************/
 /*                     EXPORTED TYPES and DEFINITIONS                         */
 /******************************************************************************/
 
+/* Display orientation (picture turned clockwise), applied by the controller through MADCTL */
+enum {
+    ILI9341_ROTATION_0 = 0,
+    ILI9341_ROTATION_90,
+    ILI9341_ROTATION_180,
+    ILI9341_ROTATION_270,
+    ILI9341_ROTATION_COUNT,
+};
 
+typedef void (*ili9341_dma_done_t)(void);
 
 /******************************************************************************/
 /*                              PRIVATE DATA                                  */
@@ -56,7 +65,14 @@ void ili9341_init(void);
  * @param  y1: End Y coordinate
  * @retval None
  */
-void ili9341_set_window(unsigned char x0, unsigned char x1, unsigned int y0, unsigned int y1);
+void ili9341_set_window(uint16_t x0, uint16_t x1, uint16_t y0, uint16_t y1);
+
+/*!
+ * @brief  Set the display orientation, waits for a running DMA transfer
+ * @param  rotation: ILI9341_ROTATION_0/90/180/270
+ * @retval None
+ */
+void ili9341_set_rotation(uint8_t rotation);
 
 /*!
  * @brief  Write data to the display
@@ -65,6 +81,49 @@ void ili9341_set_window(unsigned char x0, unsigned char x1, unsigned int y0, uns
  */
 void ili9341_write_data(uint16_t data);
 
+/*!
+ * @brief  Write a block of pixels to the display RAM
+ * @param  data: Pixels to be written
+ * @param  count: Number of pixels
+ * @retval None
+ */
+void ili9341_write_pixels(const uint16_t *data, uint32_t count);
+
+/*!
+ * @brief  Write the same color a number of times to the display RAM
+ * @param  color: Color to be written
+ * @param  count: Number of pixels
+ * @retval None
+ */
+void ili9341_fill_color(uint16_t color, uint32_t count);
+
+/*!
+ * @brief  Set the display window and write its pixels
+ * @param  x0: Start X coordinate
+ * @param  x1: End X coordinate
+ * @param  y0: Start Y coordinate
+ * @param  y1: End Y coordinate
+ * @param  data: (x1 - x0 + 1) * (y1 - y0 + 1) pixels
+ * @retval None
+ */
+void ili9341_write_area(uint16_t x0, uint16_t x1, uint16_t y0, uint16_t y1, const uint16_t *data);
+
+/*!
+ * @brief  Start a DMA transfer of pixels to the display RAM
+ * @param  data: Pixels to be written (must stay valid until done is called)
+ * @param  count: Number of pixels
+ * @param  done: Called from the DMA interrupt when the transfer is completed
+ * @retval None
+ */
+void ili9341_write_pixels_dma(const uint16_t *data, uint32_t count, ili9341_dma_done_t done);
+
+/*!
+ * @brief  Handle the display DMA interrupt
+ * @param  None
+ * @retval None
+ */
+void ili9341_dma_irq_handler(void);
+
 /******************************************************************************/
 
 #ifdef __cplusplus
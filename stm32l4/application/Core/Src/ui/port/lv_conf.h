@@ -39,7 +39,7 @@
 
 /* Default display refresh period.
  * Can be changed in the display driver (`lv_disp_drv_t`).*/
-#define LV_DISP_DEF_REFR_PERIOD      40      /*[ms]*/
+#define LV_DISP_DEF_REFR_PERIOD      40      /*[ms], slowed down by ui_control when nothing animates*/
 
 /* Dot Per Inch: used to initialize default sizes.
  * E.g. a button with width = LV_DPI / 2 -> half inch wide
@@ -83,9 +83,9 @@ typedef int16_t lv_coord_t;
 /* Automatically defrag. on free. Defrag. means joining the adjacent free cells. */
 #  define LV_MEM_AUTO_DEFRAG  1
 #else       /*LV_MEM_CUSTOM*/
-#  define LV_MEM_CUSTOM_INCLUDE <stdlib.h>   /*Header for the dynamic memory function*/
-#  define LV_MEM_CUSTOM_ALLOC   malloc       /*Wrapper to malloc*/
-#  define LV_MEM_CUSTOM_FREE    free         /*Wrapper to free*/
+#  define LV_MEM_CUSTOM_INCLUDE "mem_heap.h"    /*Shared with FreeRTOS, accounted as MEM_TAG_LVGL*/
+#  define LV_MEM_CUSTOM_ALLOC   mem_heap_lvgl_alloc
+#  define LV_MEM_CUSTOM_FREE    mem_heap_lvgl_free
 #endif     /*LV_MEM_CUSTOM*/
 
 /* Use the standard memcpy and memset instead of LVGL's own functions.
@@ -187,7 +187,7 @@ e.g. "stm32f769xx.h" or "stm32f429xx.h" */
 #define LV_GPU_DMA2D_CMSIS_INCLUDE "stm32f746xx.h"
 
 /* 1: Enable file system (might be required for images */
-#define LV_USE_FILESYSTEM       0
+#define LV_USE_FILESYSTEM       1
 #if LV_USE_FILESYSTEM
 /*Declare the type of the user data of file system drivers (can be e.g. `void *`, `int`, `struct`)*/
 typedef void * lv_fs_drv_user_data_t;
@@ -265,6 +265,9 @@ typedef void * lv_img_decoder_user_data_t;
  * placed in RAM sections that are DMA accessible */
 #define LV_ATTRIBUTE_DMA
 
+/* Uninitialized buffers placed in SRAM2 (.sram2 output section of the linker scripts) */
+#define LV_ATTRIBUTE_SRAM2 __attribute__((section(".sram2")))
+
 /*===================
  *  HAL settings
  *==================*/
@@ -400,6 +403,16 @@ typedef void * lv_indev_drv_user_data_t;            /*Type of user data in the i
  */
 #define LV_USE_FONT_COMPRESSED 1
 
+/* LRU cache of decompressed glyph bitmaps (compressed fonts only).
+ * LV_FONT_GLYPH_CACHE_SLOTS: number of cached glyphs, 0 to disable
+ * LV_FONT_GLYPH_CACHE_SLOT_SIZE: bytes per slot, larger glyphs are decompressed on every draw
+ * LV_FONT_GLYPH_CACHE_ATTR: attribute of the slot buffers, they sit in SRAM2 with the draw buffers */
+#ifndef LV_FONT_GLYPH_CACHE_SLOTS
+#define LV_FONT_GLYPH_CACHE_SLOTS       20
+#endif
+#define LV_FONT_GLYPH_CACHE_SLOT_SIZE   1024
+#define LV_FONT_GLYPH_CACHE_ATTR        LV_ATTRIBUTE_SRAM2
+
 /* Enable subpixel rendering */
 #define LV_USE_FONT_SUBPX 1
 #if LV_USE_FONT_SUBPX
@@ -9,15 +9,19 @@
 /******************************************************************************/
 
 #include "lvgl.h"
+#include "lv_port_disp.h"
+
+#if !LV_PORT_FRAMEBUFFER
+
 #include "stm32l4xx_hal.h"
 #include "ili9341.h"
-#include "lv_port_disp.h"
 
 /******************************************************************************/
 /*                     EXPORTED TYPES and DEFINITIONS                         */
 /******************************************************************************/
 
-
+/* Smaller areas are written by the CPU, the DMA setup and interrupt cost more than the copy */
+#define DISP_DMA_MIN_PIXELS    (128)
 
 /******************************************************************************/
 /*                              PRIVATE DATA                                  */
@@ -42,8 +46,9 @@
  *      whole frame to display. This way you only need to change the frame buffer's address instead of
  *      copying the pixels.
  */
-#define draw_buf_2_1      (lv_color_t*)(SRAM2_BASE)
-#define draw_buf_2_2      (lv_color_t*)(SRAM2_BASE +0x4000)
+#define DISP_BUF_PIXELS   (LV_HOR_RES_MAX * LV_VER_RES_MAX / 10)
+static lv_color_t draw_buf_2_1[DISP_BUF_PIXELS] LV_ATTRIBUTE_SRAM2;
+static lv_color_t draw_buf_2_2[DISP_BUF_PIXELS] LV_ATTRIBUTE_SRAM2;
 static lv_disp_buf_t draw_buf_dsc_2;
 
 static lv_disp_drv_t disp_drv;
@@ -62,28 +67,34 @@ static void disp_flush(lv_disp_drv_t *disp, const lv_area_t *area, lv_color_t *c
 
 /******************************************************************************/
 
+/**
+ * @brief  Called from the DMA interrupt when the draw buffer was sent
+ */
+static void disp_flush_done(void) {
+    /* Inform the graphics library that you are ready with the flushing*/
+    lv_disp_flush_ready(&disp_drv);
+}
+
 /**
  * @brief  Display flushing
  */
 static void disp_flush(lv_disp_drv_t *disp, const lv_area_t *area, lv_color_t *color_p) {
-    int32_t x;
-    int32_t y;
-
-    if (area->x2 < 0) return;
-    if (area->y2 < 0) return;
-    if (area->x1 > LV_HOR_RES_MAX - 1) return;
-    if (area->y1 > LV_VER_RES_MAX - 1) return;
+    if ((area->x2 < 0) || (area->y2 < 0) ||
+        (area->x1 > lv_disp_get_hor_res(NULL) - 1) || (area->y1 > lv_disp_get_ver_res(NULL) - 1)) {
+        lv_disp_flush_ready(disp);
+        return;
+    }
 
-    ili9341_set_window(area->x1, area->x2, area->y1, area->y2);
-    for (y = area->y1; y <= area->y2; y++) {
-        for (x = area->x1; x <= area->x2; x++) {
-            ili9341_write_data(color_p->full);
-            color_p++;
-        }
+    uint32_t count = lv_area_get_size(area);
+    if (count < DISP_DMA_MIN_PIXELS) {
+        ili9341_write_area(area->x1, area->x2, area->y1, area->y2, (const uint16_t *)color_p);
+        lv_disp_flush_ready(disp);
+        return;
     }
 
-    /* Inform the graphics library that you are ready with the flushing*/
-    lv_disp_flush_ready(disp);
+    /* Send the buffer in background, LVGL renders into the other buffer meanwhile */
+    ili9341_set_window(area->x1, area->x2, area->y1, area->y2);
+    ili9341_write_pixels_dma((const uint16_t *)color_p, count, disp_flush_done);
 }
 
 /*!
@@ -91,7 +102,7 @@ static void disp_flush(lv_disp_drv_t *disp, const lv_area_t *area, lv_color_t *c
  */
 void lv_port_disp_init(void) {
     ili9341_init();
-    lv_disp_buf_init(&draw_buf_dsc_2, draw_buf_2_1, draw_buf_2_2, LV_HOR_RES_MAX * LV_VER_RES_MAX / 10);
+    lv_disp_buf_init(&draw_buf_dsc_2, draw_buf_2_1, draw_buf_2_2, DISP_BUF_PIXELS);
 
     /* Initialize the display */
     lv_disp_drv_init(&disp_drv);
@@ -100,7 +111,7 @@ void lv_port_disp_init(void) {
     disp_drv.hor_res = LV_HOR_RES_MAX;
     disp_drv.ver_res = LV_VER_RES_MAX;
     disp_drv.rotated = LV_DISP_ROT_NONE;
-    disp_drv.sw_rotate = 1;
+    disp_drv.sw_rotate = 0;    /* Rotation is done by the LCD controller */
 
     /* Used to copy the buffer's content to the display */
     disp_drv.flush_cb = disp_flush;
@@ -109,12 +120,34 @@ void lv_port_disp_init(void) {
     /* Set a display buffer */
     disp_drv.buffer = &draw_buf_dsc_2;
 
-    /* Finally register the driver */
+    /* Finally register the driver. No input device: the buttons come as UI events,
+     * the read task of an indev would wake the LVGL task every LV_INDEV_DEF_READ_PERIOD */
     lv_disp_drv_register(&disp_drv);
+}
 
-    /* Initialize the (dummy) input device driver */
-    lv_indev_drv_t indev_drv;
-    lv_indev_drv_init(&indev_drv);
-    indev_drv.type = LV_INDEV_TYPE_NONE;
-    lv_indev_drv_register(&indev_drv);
+/*!
+ * @brief  Rotate the display in the LCD controller
+ */
+void lv_port_disp_set_rotation(lv_disp_rot_t rotation) {
+    /* LVGL turns the picture counter-clockwise (see lv_refr_vdb_rotate), the controller clockwise */
+    static const uint8_t lcd_rotation[] = {
+        [LV_DISP_ROT_NONE] = ILI9341_ROTATION_0,
+        [LV_DISP_ROT_90] = ILI9341_ROTATION_270,
+        [LV_DISP_ROT_180] = ILI9341_ROTATION_180,
+        [LV_DISP_ROT_270] = ILI9341_ROTATION_90,
+    };
+
+    if (rotation > LV_DISP_ROT_270) {
+        return;
+    }
+
+    /* The last flush of a refresh is still in the DMA when lv_task_handler() returns */
+    while (disp_drv.buffer->flushing) {
+    }
+
+    /* sw_rotate is 0 so LVGL only swaps its resolution and keeps rendering unrotated areas */
+    ili9341_set_rotation(lcd_rotation[rotation]);
+    lv_disp_set_rotation(NULL, rotation);
 }
+
+#endif /* !LV_PORT_FRAMEBUFFER */
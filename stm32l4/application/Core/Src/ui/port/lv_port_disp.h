@@ -17,12 +17,16 @@ extern "C" {
 /*                              INCLUDE FILES                                 */
 /******************************************************************************/
 
-#include "lv_conf.h"
+#include "lvgl.h"
 
 /******************************************************************************/
 /*                     EXPORTED TYPES and DEFINITIONS                         */
 /******************************************************************************/
 
+/* 1: render into a memory framebuffer (lv_port_fb.c) instead of the ILI9341 */
+#ifndef LV_PORT_FRAMEBUFFER
+#define LV_PORT_FRAMEBUFFER    0
+#endif
 
 
 /******************************************************************************/
@@ -48,6 +52,13 @@ extern "C" {
  */
 void lv_port_disp_init(void);
 
+/*!
+ * @brief  Rotate the display in the LCD controller, LVGL keeps rendering unrotated
+ * @param  rotation: LV_DISP_ROT_NONE/90/180/270
+ * @retval None
+ */
+void lv_port_disp_set_rotation(lv_disp_rot_t rotation);
+
 /******************************************************************************/
 
 #ifdef __cplusplus
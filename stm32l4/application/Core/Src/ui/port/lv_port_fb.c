@@ -0,0 +1,178 @@
+/*
+ *  lv_port_fb.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+#include "lvgl.h"
+#include "lv_port_disp.h"
+#include "lv_port_fb.h"
+
+#if LV_PORT_FRAMEBUFFER
+
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+
+#define FB_PIXELS          (LV_HOR_RES_MAX * LV_VER_RES_MAX)
+#define FB_DRAW_PIXELS     (FB_PIXELS / 10)    /* Same partial buffer size as the LCD port */
+
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+
+static lv_color_t framebuffer[FB_PIXELS];
+static lv_color_t draw_buf_1[FB_DRAW_PIXELS];
+static lv_color_t draw_buf_2[FB_DRAW_PIXELS];
+static lv_disp_buf_t draw_buf_dsc;
+
+static lv_disp_drv_t disp_drv;
+
+static lv_port_fb_stats_t fb_stats;
+static uint32_t frame_flushed_px;
+
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+/*                                FUNCTIONS                                   */
+/******************************************************************************/
+
+static void disp_flush(lv_disp_drv_t *disp, const lv_area_t *area, lv_color_t *color_p);
+static void disp_monitor(lv_disp_drv_t *disp, uint32_t time, uint32_t px);
+
+/******************************************************************************/
+
+/**
+ * @brief  Copy the rendered area into the framebuffer
+ */
+static void disp_flush(lv_disp_drv_t *disp, const lv_area_t *area, lv_color_t *color_p) {
+    lv_coord_t hor_res = lv_disp_get_hor_res(NULL);
+    lv_coord_t ver_res = lv_disp_get_ver_res(NULL);
+    int32_t width = lv_area_get_width(area);
+
+    for (int32_t y = area->y1; y <= area->y2; y++) {
+        if ((y >= 0) && (y < ver_res)) {
+            for (int32_t x = area->x1; x <= area->x2; x++) {
+                if ((x >= 0) && (x < hor_res)) {
+                    framebuffer[y * hor_res + x] = color_p[x - area->x1];
+                }
+            }
+        }
+        color_p += width;
+    }
+
+    frame_flushed_px += lv_area_get_size(area);
+    fb_stats.flush_calls++;
+    lv_disp_flush_ready(disp);
+}
+
+/**
+ * @brief  Called by LVGL after every refresh cycle
+ */
+static void disp_monitor(lv_disp_drv_t *disp, uint32_t time, uint32_t px) {
+    (void) disp;
+
+    fb_stats.frames++;
+    fb_stats.last_render_ms = time;
+    fb_stats.total_render_ms += time;
+    if (time > fb_stats.max_render_ms) {
+        fb_stats.max_render_ms = time;
+    }
+
+    fb_stats.last_invalidated_px = px;
+    fb_stats.total_invalidated_px += px;
+    fb_stats.last_flushed_px = frame_flushed_px;
+    fb_stats.total_flushed_px += frame_flushed_px;
+    frame_flushed_px = 0;
+}
+
+/*!
+ * @brief  Initialize the framebuffer display driver
+ */
+void lv_port_disp_init(void) {
+    lv_disp_buf_init(&draw_buf_dsc, draw_buf_1, draw_buf_2, FB_DRAW_PIXELS);
+
+    lv_disp_drv_init(&disp_drv);
+    disp_drv.hor_res = LV_HOR_RES_MAX;
+    disp_drv.ver_res = LV_VER_RES_MAX;
+    disp_drv.rotated = LV_DISP_ROT_NONE;
+    disp_drv.sw_rotate = 0;
+    disp_drv.flush_cb = disp_flush;
+    disp_drv.monitor_cb = disp_monitor;
+    disp_drv.buffer = &draw_buf_dsc;
+    lv_disp_drv_register(&disp_drv);
+
+    /* No input device: the one of the LCD port has no read_cb and only logs a warning per read */
+}
+
+/*!
+ * @brief  Rotate the display, the framebuffer takes the rotated resolution
+ */
+void lv_port_disp_set_rotation(lv_disp_rot_t rotation) {
+    memset(framebuffer, 0, sizeof(framebuffer));
+    lv_disp_set_rotation(NULL, rotation);
+}
+
+/*!
+ * @brief  Get the frame statistics since the last reset
+ */
+const lv_port_fb_stats_t *lv_port_fb_get_stats(void) {
+    return &fb_stats;
+}
+
+/*!
+ * @brief  Clear the frame statistics
+ */
+void lv_port_fb_reset_stats(void) {
+    memset(&fb_stats, 0, sizeof(fb_stats));
+    frame_flushed_px = 0;
+}
+
+/*!
+ * @brief  Get the framebuffer content
+ */
+const lv_color_t *lv_port_fb_get_buffer(uint16_t *width, uint16_t *height) {
+    if (width != NULL) {
+        *width = lv_disp_get_hor_res(NULL);
+    }
+    if (height != NULL) {
+        *height = lv_disp_get_ver_res(NULL);
+    }
+    return framebuffer;
+}
+
+/*!
+ * @brief  Dump the framebuffer into a binary PPM (P6) file
+ */
+int lv_port_fb_write_ppm(const char *path) {
+    uint16_t width, height;
+    const lv_color_t *pixels = lv_port_fb_get_buffer(&width, &height);
+
+    FILE *file = fopen(path, "wb");
+    if (file == NULL) {
+        return -1;
+    }
+
+    fprintf(file, "P6\n%u %u\n255\n", width, height);
+    for (uint32_t i = 0; i < (uint32_t)width * height; i++) {
+        uint8_t rgb[3];
+        rgb[0] = (pixels[i].ch.red << 3) | (pixels[i].ch.red >> 2);
+        rgb[1] = (pixels[i].ch.green << 2) | (pixels[i].ch.green >> 4);
+        rgb[2] = (pixels[i].ch.blue << 3) | (pixels[i].ch.blue >> 2);
+        fwrite(rgb, 1, sizeof(rgb), file);
+    }
+
+    return fclose(file) == 0 ? 0 : -1;
+}
+
+#endif /* LV_PORT_FRAMEBUFFER */
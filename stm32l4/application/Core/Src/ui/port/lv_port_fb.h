@@ -0,0 +1,94 @@
+/*
+ *  lv_port_fb.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef _LV_PORT_FB_H_
+#define _LV_PORT_FB_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************************************************************/
+
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+
+#include <stdint.h>
+#include "lv_port_disp.h"
+
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+
+typedef struct {
+    uint32_t frames;                /* Refresh cycles that rendered something */
+    uint32_t last_render_ms;        /* Render + flush time of the last frame */
+    uint32_t max_render_ms;
+    uint32_t total_render_ms;
+    uint32_t last_invalidated_px;   /* Pixels LVGL redrew in the last frame */
+    uint32_t total_invalidated_px;
+    uint32_t last_flushed_px;       /* Pixels passed to flush_cb in the last frame */
+    uint32_t total_flushed_px;
+    uint32_t flush_calls;
+} lv_port_fb_stats_t;
+
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+/*                                FUNCTIONS                                   */
+/******************************************************************************/
+
+#if LV_PORT_FRAMEBUFFER
+
+/*!
+ * @brief  Get the frame statistics since the last reset
+ * @param  None
+ * @retval Pointer to the statistics
+ */
+const lv_port_fb_stats_t *lv_port_fb_get_stats(void);
+
+/*!
+ * @brief  Clear the frame statistics
+ * @param  None
+ * @retval None
+ */
+void lv_port_fb_reset_stats(void);
+
+/*!
+ * @brief  Get the framebuffer content
+ * @param  width: Returns the width of the current orientation
+ * @param  height: Returns the height of the current orientation
+ * @retval Pointer to width * height pixels (RGB565)
+ */
+const lv_color_t *lv_port_fb_get_buffer(uint16_t *width, uint16_t *height);
+
+/*!
+ * @brief  Dump the framebuffer into a binary PPM (P6) file
+ * @param  path: Output file path
+ * @retval 0 if success, -1 otherwise
+ */
+int lv_port_fb_write_ppm(const char *path);
+
+#endif /* LV_PORT_FRAMEBUFFER */
+
+/******************************************************************************/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _LV_PORT_FB_H_ */
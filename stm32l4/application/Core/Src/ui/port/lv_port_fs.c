@@ -0,0 +1,143 @@
+/*
+ *  lv_port_fs.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+
+#include "lvgl.h"
+#include "res_pack.h"
+#include "lv_port_fs.h"
+
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+
+typedef struct {
+    const res_pack_entry_t *entry;
+    uint32_t position;
+} fs_file_t;
+
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+/*                                FUNCTIONS                                   */
+/******************************************************************************/
+
+static lv_fs_res_t fs_open(lv_fs_drv_t *drv, void *file_p, const char *path, lv_fs_mode_t mode);
+static lv_fs_res_t fs_close(lv_fs_drv_t *drv, void *file_p);
+static lv_fs_res_t fs_read(lv_fs_drv_t *drv, void *file_p, void *buf, uint32_t btr, uint32_t *br);
+static lv_fs_res_t fs_seek(lv_fs_drv_t *drv, void *file_p, uint32_t pos);
+static lv_fs_res_t fs_tell(lv_fs_drv_t *drv, void *file_p, uint32_t *pos_p);
+static lv_fs_res_t fs_size(lv_fs_drv_t *drv, void *file_p, uint32_t *size_p);
+
+/******************************************************************************/
+
+/**
+ * @brief  Open a resource, the pack is read only
+ */
+static lv_fs_res_t fs_open(lv_fs_drv_t *drv, void *file_p, const char *path, lv_fs_mode_t mode) {
+    (void) drv;
+    fs_file_t *file = file_p;
+
+    if (mode & LV_FS_MODE_WR) {
+        return LV_FS_RES_DENIED;
+    }
+
+    file->entry = res_pack_find(path);
+    file->position = 0;
+    return (file->entry != NULL) ? LV_FS_RES_OK : LV_FS_RES_NOT_EX;
+}
+
+/**
+ * @brief  Nothing to release
+ */
+static lv_fs_res_t fs_close(lv_fs_drv_t *drv, void *file_p) {
+    (void) drv;
+    (void) file_p;
+    return LV_FS_RES_OK;
+}
+
+/**
+ * @brief  Read through the resource pack cache
+ */
+static lv_fs_res_t fs_read(lv_fs_drv_t *drv, void *file_p, void *buf, uint32_t btr, uint32_t *br) {
+    (void) drv;
+    fs_file_t *file = file_p;
+
+    int32_t length = res_pack_read(file->entry, file->position, buf, btr);
+    if (length < 0) {
+        *br = 0;
+        return LV_FS_RES_HW_ERR;
+    }
+
+    file->position += length;
+    *br = length;
+    return LV_FS_RES_OK;
+}
+
+/**
+ * @brief  Set the read position
+ */
+static lv_fs_res_t fs_seek(lv_fs_drv_t *drv, void *file_p, uint32_t pos) {
+    (void) drv;
+    fs_file_t *file = file_p;
+
+    if (pos > file->entry->size) {
+        return LV_FS_RES_INV_PARAM;
+    }
+
+    file->position = pos;
+    return LV_FS_RES_OK;
+}
+
+/**
+ * @brief  Get the read position
+ */
+static lv_fs_res_t fs_tell(lv_fs_drv_t *drv, void *file_p, uint32_t *pos_p) {
+    (void) drv;
+    *pos_p = ((fs_file_t*) file_p)->position;
+    return LV_FS_RES_OK;
+}
+
+/**
+ * @brief  Get the resource size
+ */
+static lv_fs_res_t fs_size(lv_fs_drv_t *drv, void *file_p, uint32_t *size_p) {
+    (void) drv;
+    *size_p = ((fs_file_t*) file_p)->entry->size;
+    return LV_FS_RES_OK;
+}
+
+/******************************************************************************/
+
+/*!
+ * @brief  Register the read-only resource pack file system
+ */
+void lv_port_fs_init(void) {
+    lv_fs_drv_t fs_drv;
+
+    lv_fs_drv_init(&fs_drv);
+    fs_drv.letter = LV_PORT_FS_LETTER;
+    fs_drv.file_size = sizeof(fs_file_t);
+    fs_drv.open_cb = fs_open;
+    fs_drv.close_cb = fs_close;
+    fs_drv.read_cb = fs_read;
+    fs_drv.seek_cb = fs_seek;
+    fs_drv.tell_cb = fs_tell;
+    fs_drv.size_cb = fs_size;
+    lv_fs_drv_register(&fs_drv);
+}
@@ -0,0 +1,58 @@
+/*
+ *  lv_port_fs.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef _LV_PORT_FS_H_
+#define _LV_PORT_FS_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************************************************************/
+
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+
+#include "lvgl.h"
+
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+
+/* Resource pack files are opened as "R:<name>" */
+#define LV_PORT_FS_LETTER          'R'
+
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+/*                                FUNCTIONS                                   */
+/******************************************************************************/
+
+/*!
+ * @brief  Register the read-only resource pack file system, call after lv_init()
+ * @param  None
+ * @retval None
+ */
+void lv_port_fs_init(void);
+
+/******************************************************************************/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _LV_PORT_FS_H_ */
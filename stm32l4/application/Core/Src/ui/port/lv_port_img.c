@@ -0,0 +1,394 @@
+/*
+ *  lv_port_img.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+
+#include <string.h>
+#include "lvgl.h"
+#include "lv_port_img.h"
+
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+
+/*
+ * Layout (little endian), see tools/img_rle.py:
+ *   "TSRL", uint16 width, uint16 height, uint16 palette_count, uint16 reserved,
+ *   uint16 palette[palette_count], uint32 line_offset[height], stream
+ */
+#define RLE_MAGIC                "TSRL"
+#define RLE_HEADER_SIZE          12
+#define RLE_PALETTE_MAX          255
+#define RLE_ESCAPE               0xFF
+#define RLE_RUN_FLAG             0x80
+#define RLE_COUNT_MASK           0x7F
+#define RLE_FILE_EXT             "rle"
+
+#if LV_USE_FILESYSTEM
+/* Decoder state of an image opened from a file */
+typedef struct {
+    lv_fs_file_t file;
+    uint16_t width;
+    uint16_t height;
+    uint32_t offsets;               /* File position of the line offset table */
+    uint32_t stream;                /* File position of the packets */
+    uint32_t file_size;
+    uint8_t palette[RLE_PALETTE_MAX * 2];
+    uint8_t *line;                  /* Packets of the line being decoded */
+    uint32_t line_size;
+} rle_file_t;
+#endif
+
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+
+static lv_port_img_stats_t img_stats;
+
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+/*                                FUNCTIONS                                   */
+/******************************************************************************/
+
+static lv_res_t rle_info(lv_img_decoder_t *decoder, const void *src, lv_img_header_t *header);
+static lv_res_t rle_open(lv_img_decoder_t *decoder, lv_img_decoder_dsc_t *dsc);
+static lv_res_t rle_read_line(lv_img_decoder_t *decoder, lv_img_decoder_dsc_t *dsc,
+                              lv_coord_t x, lv_coord_t y, lv_coord_t len, uint8_t *buf);
+static void rle_close(lv_img_decoder_t *decoder, lv_img_decoder_dsc_t *dsc);
+
+/******************************************************************************/
+
+static inline uint16_t rle_get_u16(const uint8_t *p) {
+    return (uint16_t) (p[0] | (p[1] << 8));
+}
+
+static inline uint32_t rle_get_u32(const uint8_t *p) {
+    return (uint32_t) p[0] | ((uint32_t) p[1] << 8) | ((uint32_t) p[2] << 16) | ((uint32_t) p[3] << 24);
+}
+
+/**
+ * @brief  Check the header of an RLE image
+ */
+static bool rle_is_valid(const lv_img_dsc_t *img) {
+    if ((img->header.cf != LV_PORT_IMG_CF_RLE) || (img->data_size < RLE_HEADER_SIZE)) {
+        return false;
+    }
+
+    const uint8_t *data = img->data;
+    uint16_t height = rle_get_u16(&data[6]);
+    uint16_t palette_count = rle_get_u16(&data[8]);
+
+    return (memcmp(data, RLE_MAGIC, 4) == 0)
+        && (palette_count <= RLE_PALETTE_MAX)
+        && (img->data_size >= RLE_HEADER_SIZE + palette_count * 2 + height * 4);
+}
+
+/**
+ * @brief  Read one value (palette index or escaped raw color)
+ */
+static inline const uint8_t *rle_get_color(const uint8_t *p, const uint8_t *palette, lv_color_t *color) {
+    if (*p == RLE_ESCAPE) {
+        color->full = rle_get_u16(p + 1);
+        return p + 3;
+    }
+
+    color->full = rle_get_u16(&palette[*p * 2]);
+    return p + 1;
+}
+
+/**
+ * @brief  Decode len pixels starting at x from the packets of one line
+ */
+static void rle_decode_line(const uint8_t *p, const uint8_t *palette, lv_coord_t x, lv_coord_t len, lv_color_t *out) {
+    lv_coord_t pos = 0;
+    lv_coord_t end = x + len;
+    lv_color_t color;
+
+    while (pos < end) {
+        uint8_t ctrl = *p++;
+        lv_coord_t count = (ctrl & RLE_COUNT_MASK) + 1;
+
+        if (ctrl & RLE_RUN_FLAG) {
+            p = rle_get_color(p, palette, &color);
+
+            /* Clip the run to [x, end) */
+            lv_coord_t first = LV_MATH_MAX(pos, x);
+            lv_coord_t last = LV_MATH_MIN(pos + count, end);
+            for (lv_coord_t i = first; i < last; i++) {
+                out[i - x] = color;
+            }
+            pos += count;
+        }
+        else {
+            while ((count > 0) && (pos < end)) {
+                p = rle_get_color(p, palette, &color);
+                if (pos >= x) {
+                    out[pos - x] = color;
+                }
+                pos++;
+                count--;
+            }
+        }
+    }
+}
+
+#if LV_USE_FILESYSTEM
+/**
+ * @brief  Read and check the header of an RLE file
+ */
+static bool rle_file_read_header(lv_fs_file_t *file, uint8_t *header) {
+    uint32_t length;
+
+    if ((lv_fs_read(file, header, RLE_HEADER_SIZE, &length) != LV_FS_RES_OK) || (length != RLE_HEADER_SIZE)) {
+        return false;
+    }
+
+    return (memcmp(header, RLE_MAGIC, 4) == 0) && (rle_get_u16(&header[8]) <= RLE_PALETTE_MAX);
+}
+
+/**
+ * @brief  Open an RLE file: keep the palette in RAM, lines are read on demand
+ */
+static lv_res_t rle_file_open(lv_img_decoder_dsc_t *dsc) {
+    uint8_t header[RLE_HEADER_SIZE];
+    uint32_t length;
+
+    rle_file_t *rle = lv_mem_alloc(sizeof(rle_file_t));
+    if (rle == NULL) {
+        return LV_RES_INV;
+    }
+    memset(rle, 0, sizeof(rle_file_t));
+
+    if (lv_fs_open(&rle->file, dsc->src, LV_FS_MODE_RD) != LV_FS_RES_OK) {
+        lv_mem_free(rle);
+        return LV_RES_INV;
+    }
+
+    if (!rle_file_read_header(&rle->file, header)) {
+        goto error;
+    }
+
+    rle->width = rle_get_u16(&header[4]);
+    rle->height = rle_get_u16(&header[6]);
+    uint16_t palette_count = rle_get_u16(&header[8]);
+    if ((lv_fs_read(&rle->file, rle->palette, palette_count * 2, &length) != LV_FS_RES_OK) || (length != palette_count * 2u)) {
+        goto error;
+    }
+
+    rle->offsets = RLE_HEADER_SIZE + palette_count * 2;
+    rle->stream = rle->offsets + rle->height * 4;
+    if (lv_fs_size(&rle->file, &rle->file_size) != LV_FS_RES_OK) {
+        goto error;
+    }
+
+    /* Worst case line: literal packets of escaped colors */
+    rle->line_size = rle->width * 3 + (rle->width + RLE_COUNT_MASK) / (RLE_COUNT_MASK + 1);
+    rle->line = lv_mem_alloc(rle->line_size);
+    if (rle->line == NULL) {
+        goto error;
+    }
+
+    dsc->user_data = rle;
+    return LV_RES_OK;
+
+error:
+    lv_fs_close(&rle->file);
+    lv_mem_free(rle);
+    return LV_RES_INV;
+}
+
+/**
+ * @brief  Read the packets of line y and decode them
+ */
+static lv_res_t rle_file_read_line(rle_file_t *rle, lv_coord_t x, lv_coord_t y, lv_coord_t len, lv_color_t *out) {
+    uint8_t offsets[8];
+    uint32_t count = (y + 1 < rle->height) ? 8 : 4;
+    uint32_t length, start, end;
+
+    if ((lv_fs_seek(&rle->file, rle->offsets + y * 4) != LV_FS_RES_OK)
+        || (lv_fs_read(&rle->file, offsets, count, &length) != LV_FS_RES_OK) || (length != count)) {
+        return LV_RES_INV;
+    }
+
+    start = rle->stream + rle_get_u32(&offsets[0]);
+    end = (count == 8) ? rle->stream + rle_get_u32(&offsets[4]) : rle->file_size;
+    if ((end < start) || (end - start > rle->line_size)) {
+        return LV_RES_INV;
+    }
+
+    if ((lv_fs_seek(&rle->file, start) != LV_FS_RES_OK)
+        || (lv_fs_read(&rle->file, rle->line, end - start, &length) != LV_FS_RES_OK) || (length != end - start)) {
+        return LV_RES_INV;
+    }
+
+    rle_decode_line(rle->line, rle->palette, x, len, out);
+    return LV_RES_OK;
+}
+#endif /* LV_USE_FILESYSTEM */
+
+/**
+ * @brief  Get the size of an RLE image
+ */
+static lv_res_t rle_info(lv_img_decoder_t *decoder, const void *src, lv_img_header_t *header) {
+    (void) decoder;
+    lv_img_src_t src_type = lv_img_src_get_type(src);
+
+    if (src_type == LV_IMG_SRC_VARIABLE) {
+        const lv_img_dsc_t *img = src;
+        if (!rle_is_valid(img)) {
+            return LV_RES_INV;
+        }
+
+        header->w = rle_get_u16(&img->data[4]);
+        header->h = rle_get_u16(&img->data[6]);
+    }
+#if LV_USE_FILESYSTEM
+    else if ((src_type == LV_IMG_SRC_FILE) && (strcmp(lv_fs_get_ext(src), RLE_FILE_EXT) == 0)) {
+        lv_fs_file_t file;
+        uint8_t data[RLE_HEADER_SIZE];
+
+        if (lv_fs_open(&file, src, LV_FS_MODE_RD) != LV_FS_RES_OK) {
+            return LV_RES_INV;
+        }
+        bool valid = rle_file_read_header(&file, data);
+        lv_fs_close(&file);
+        if (!valid) {
+            return LV_RES_INV;
+        }
+
+        header->w = rle_get_u16(&data[4]);
+        header->h = rle_get_u16(&data[6]);
+    }
+#endif
+    else {
+        return LV_RES_INV;
+    }
+
+    header->always_zero = 0;
+    header->cf = LV_PORT_IMG_CF_RLE;
+    return LV_RES_OK;
+}
+
+/**
+ * @brief  Open an RLE image, no image buffer: LVGL reads it line by line
+ */
+static lv_res_t rle_open(lv_img_decoder_t *decoder, lv_img_decoder_dsc_t *dsc) {
+    (void) decoder;
+
+    if (dsc->src_type == LV_IMG_SRC_VARIABLE) {
+        if (!rle_is_valid(dsc->src)) {
+            return LV_RES_INV;
+        }
+    }
+#if LV_USE_FILESYSTEM
+    else if (dsc->src_type == LV_IMG_SRC_FILE) {
+        if (rle_file_open(dsc) != LV_RES_OK) {
+            return LV_RES_INV;
+        }
+    }
+#endif
+    else {
+        return LV_RES_INV;
+    }
+
+    dsc->img_data = NULL;
+    img_stats.opened++;
+    return LV_RES_OK;
+}
+
+/**
+ * @brief  Decode len pixels of line y starting at x
+ */
+static lv_res_t rle_read_line(lv_img_decoder_t *decoder, lv_img_decoder_dsc_t *dsc,
+                              lv_coord_t x, lv_coord_t y, lv_coord_t len, uint8_t *buf) {
+    (void) decoder;
+
+#if LV_USE_FILESYSTEM
+    if (dsc->src_type == LV_IMG_SRC_FILE) {
+        if (rle_file_read_line(dsc->user_data, x, y, len, (lv_color_t*) buf) != LV_RES_OK) {
+            return LV_RES_INV;
+        }
+    }
+    else
+#endif
+    {
+        const uint8_t *data = ((const lv_img_dsc_t *) dsc->src)->data;
+        uint16_t height = rle_get_u16(&data[6]);
+        uint16_t palette_count = rle_get_u16(&data[8]);
+        const uint8_t *palette = &data[RLE_HEADER_SIZE];
+        const uint8_t *offsets = &palette[palette_count * 2];
+
+        rle_decode_line(&offsets[height * 4] + rle_get_u32(&offsets[y * 4]), palette, x, len, (lv_color_t*) buf);
+    }
+
+    img_stats.lines++;
+    img_stats.pixels += len;
+    return LV_RES_OK;
+}
+
+/**
+ * @brief  Release a file opened by rle_open
+ */
+static void rle_close(lv_img_decoder_t *decoder, lv_img_decoder_dsc_t *dsc) {
+    (void) decoder;
+
+#if LV_USE_FILESYSTEM
+    rle_file_t *rle = dsc->user_data;
+    if ((dsc->src_type == LV_IMG_SRC_FILE) && (rle != NULL)) {
+        lv_fs_close(&rle->file);
+        lv_mem_free(rle->line);
+        lv_mem_free(rle);
+        dsc->user_data = NULL;
+    }
+#else
+    (void) dsc;
+#endif
+}
+
+/******************************************************************************/
+
+/*!
+ * @brief  Register the RLE image decoder, call after lv_init()
+ */
+void lv_port_img_init(void) {
+    lv_img_decoder_t *decoder = lv_img_decoder_create();
+    lv_img_decoder_set_info_cb(decoder, rle_info);
+    lv_img_decoder_set_open_cb(decoder, rle_open);
+    lv_img_decoder_set_read_line_cb(decoder, rle_read_line);
+    lv_img_decoder_set_close_cb(decoder, rle_close);
+}
+
+/*!
+ * @brief  Describe an RLE encoded image for lv_img_set_src()
+ */
+int lv_port_img_rle_dsc_init(lv_img_dsc_t *dsc, const uint8_t *data, uint32_t size) {
+    memset(dsc, 0, sizeof(lv_img_dsc_t));
+    dsc->header.cf = LV_PORT_IMG_CF_RLE;
+    dsc->data = data;
+    dsc->data_size = size;
+
+    if (!rle_is_valid(dsc)) {
+        return -1;
+    }
+
+    dsc->header.w = rle_get_u16(&data[4]);
+    dsc->header.h = rle_get_u16(&data[6]);
+    return 0;
+}
+
+/*!
+ * @brief  Get the decoder statistics
+ */
+const lv_port_img_stats_t *lv_port_img_get_stats(void) {
+    return &img_stats;
+}
@@ -0,0 +1,81 @@
+/*
+ *  lv_port_img.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef _LV_PORT_IMG_H_
+#define _LV_PORT_IMG_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************************************************************/
+
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+
+#include <stdint.h>
+#include "lvgl.h"
+
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+
+/* Color format of images encoded by tools/img_rle.py */
+#define LV_PORT_IMG_CF_RLE         LV_IMG_CF_USER_ENCODED_0
+
+typedef struct {
+    uint32_t opened;                /* Images opened by the RLE decoder */
+    uint32_t lines;                 /* Line reads */
+    uint32_t pixels;                /* Pixels written to the draw buffer */
+} lv_port_img_stats_t;
+
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+/*                                FUNCTIONS                                   */
+/******************************************************************************/
+
+/*!
+ * @brief  Register the RLE image decoder, call after lv_init()
+ * @param  None
+ * @retval None
+ */
+void lv_port_img_init(void);
+
+/*!
+ * @brief  Describe an RLE encoded image for lv_img_set_src()
+ * @param  dsc: Image descriptor to fill
+ * @param  data: Output of tools/img_rle.py
+ * @param  size: Size of data in bytes
+ * @retval 0 if success, -1 if data is not an RLE image
+ */
+int lv_port_img_rle_dsc_init(lv_img_dsc_t *dsc, const uint8_t *data, uint32_t size);
+
+/*!
+ * @brief  Get the decoder statistics
+ * @param  None
+ * @retval Pointer to the statistics
+ */
+const lv_port_img_stats_t *lv_port_img_get_stats(void);
+
+/******************************************************************************/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _LV_PORT_IMG_H_ */
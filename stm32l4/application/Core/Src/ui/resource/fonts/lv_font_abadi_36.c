@@ -1,7 +1,7 @@
 /*******************************************************************************
  * Size: 36 px
  * Bpp: 4
- * Opts: --bpp 4 --size 36 --no-compress --font Abadi MT Std Cond Extra Bold.ttf --range 0-127 --format lvgl -o lv_font_abadi_36.c
+ * Opts: --bpp 4 --size 36 --font Abadi MT Std Cond Extra Bold.ttf --range 0-127 --format lvgl -o lv_font_abadi_36.c
  ******************************************************************************/
 #include "../../lvgl.h"
 
@@ -18,2181 +18,1254 @@
 /*Store the image of the glyphs*/
 static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
     /* U+0020 " " */
-
     /* U+0021 "!" */
-    0xbf, 0xff, 0xff, 0x2a, 0xff, 0xff, 0xf1, 0x9f,
-    0xff, 0xff, 0x9, 0xff, 0xff, 0xf0, 0x8f, 0xff,
-    0xff, 0x7, 0xff, 0xff, 0xe0, 0x7f, 0xff, 0xfe,
-    0x6, 0xff, 0xff, 0xd0, 0x5f, 0xff, 0xfc, 0x4,
-    0xff, 0xff, 0xb0, 0x4f, 0xff, 0xfb, 0x3, 0xff,
-    0xff, 0xa0, 0x2f, 0xff, 0xf9, 0x1, 0xff, 0xff,
-    0x90, 0x1f, 0xff, 0xf8, 0x0, 0xff, 0xff, 0x70,
-    0xe, 0xee, 0xe6, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xcd, 0x90, 0x3, 0xff, 0xff, 0xb0, 0x9f, 0xff,
-    0xff, 0x29, 0xff, 0xff, 0xf2, 0x3f, 0xff, 0xfc,
-    0x0, 0x5d, 0xfa, 0x10,
-
+    0xbf, 0xfe, 0x21, 0x0, 0xe3, 0x30, 0x7, 0x8,
+    0x7, 0xc2, 0x1, 0xef, 0x0, 0xc2, 0x1, 0xf8,
+    0x40, 0x31, 0x81, 0x80, 0x61, 0x1, 0x0, 0xce,
+    0x1, 0xf9, 0xc0, 0x30, 0x80, 0x80, 0x63, 0x3,
+    0x0, 0xff, 0x84, 0x4, 0x3, 0x78, 0x0, 0x47,
+    0x80, 0x1d, 0xd9, 0x80, 0x9, 0x9b, 0x20, 0x3,
+    0xb3, 0x26, 0xb0, 0xa0, 0xc, 0x84, 0x1, 0xf5,
+    0x0, 0x63, 0x23, 0xa2, 0x5, 0xd0,
     /* U+0022 "\"" */
-    0x1f, 0xff, 0xff, 0x40, 0x2f, 0xff, 0xff, 0x21,
-    0xff, 0xff, 0xf4, 0x2, 0xff, 0xff, 0xf2, 0x1f,
-    0xff, 0xff, 0x40, 0x2f, 0xff, 0xff, 0x21, 0xff,
-    0xff, 0xf4, 0x2, 0xff, 0xff, 0xf2, 0xf, 0xff,
-    0xff, 0x30, 0x2f, 0xff, 0xff, 0x20, 0xdf, 0xff,
-    0xf1, 0x0, 0xef, 0xff, 0xf0, 0xa, 0xff, 0xfe,
-    0x0, 0xb, 0xff, 0xfd, 0x0, 0x7f, 0xff, 0xb0,
-    0x0, 0x8f, 0xff, 0xa0, 0x4, 0xff, 0xf9, 0x0,
-    0x5, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0,
-
+    0x1f, 0xfe, 0x40, 0x2f, 0xfe, 0x20, 0xf, 0xff,
+    0x8, 0x80, 0x73, 0x80, 0x7f, 0x10, 0x6, 0x20,
+    0x21, 0x0, 0xc4, 0xe, 0x1, 0x8, 0x80, 0xa,
+    0x1, 0x10, 0x3, 0x40, 0x25, 0x0, 0x8c, 0x2,
+    0x70, 0x1, 0x80, 0x44, 0x1, 0x68, 0x5, 0xa0,
+    0x4, 0xff, 0xa4, 0x2, 0x5f, 0xf9, 0xc0,
     /* U+0023 "#" */
-    0x0, 0x0, 0x0, 0xd, 0xff, 0x70, 0x0, 0x0,
-    0x5f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0x40, 0x0, 0x0, 0x8f, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0x0, 0x0, 0x0, 0xcf, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xfd, 0x0, 0x0,
-    0x0, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xf9, 0x0, 0x0, 0x3, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xf5, 0x0, 0x0, 0x6, 0xff,
-    0xe0, 0x0, 0x35, 0x55, 0x56, 0xff, 0xf7, 0x55,
-    0x55, 0x5b, 0xff, 0xd5, 0x53, 0x9f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
-    0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfa, 0x9f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x0, 0x0,
-    0xf, 0xff, 0x50, 0x0, 0x0, 0x6f, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0x20, 0x0, 0x0,
-    0xaf, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xfe,
-    0x0, 0x0, 0x0, 0xdf, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xfb, 0x0, 0x0, 0x1, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xf7, 0x0, 0x0,
-    0x4, 0xff, 0xf0, 0x0, 0x0, 0x9f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
-    0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfa, 0x9f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x24, 0x4c,
-    0xff, 0xb4, 0x44, 0x44, 0x5f, 0xff, 0x64, 0x44,
-    0x42, 0x0, 0xe, 0xff, 0x60, 0x0, 0x0, 0x4f,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0x30,
-    0x0, 0x0, 0x8f, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0x0, 0x0, 0x0, 0xbf, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xfc, 0x0, 0x0, 0x0,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xf9,
-    0x0, 0x0, 0x2, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xf5, 0x0, 0x0, 0x6, 0xff, 0xf0,
-    0x0, 0x0, 0x0,
-
+    0x0, 0xfb, 0x7f, 0xce, 0x1, 0xcb, 0xff, 0x0,
+    0x7e, 0x12, 0x0, 0x18, 0x7, 0x68, 0x0, 0xc0,
+    0x3f, 0x28, 0x4, 0x80, 0x1c, 0x80, 0x4, 0x0,
+    0xfd, 0x80, 0x2, 0x0, 0xf1, 0x80, 0x34, 0x3,
+    0xf1, 0x80, 0x10, 0x3, 0x8c, 0x2, 0x40, 0xf,
+    0xc8, 0x0, 0xc0, 0xe, 0x50, 0x0, 0x88, 0x0,
+    0x6a, 0xb9, 0x80, 0x22, 0x55, 0xed, 0x0, 0x1a,
+    0xa8, 0xea, 0xba, 0x40, 0x28, 0xaa, 0xe4, 0x0,
+    0x15, 0x52, 0x40, 0x3f, 0xfc, 0x13, 0xff, 0x80,
+    0x2a, 0xff, 0xe9, 0x0, 0xf, 0xfd, 0x40, 0x18,
+    0x80, 0x27, 0x0, 0xec, 0x0, 0x28, 0x7, 0xe4,
+    0x0, 0x9, 0x0, 0x73, 0x80, 0x30, 0x3, 0xf7,
+    0x80, 0x14, 0x3, 0x84, 0x80, 0x6, 0x1, 0xf9,
+    0x0, 0x18, 0x1, 0xca, 0x1, 0x20, 0x6, 0x9f,
+    0xf8, 0x80, 0x11, 0xff, 0xd6, 0x1, 0x7f, 0xea,
+    0x0, 0xff, 0xf0, 0x5d, 0xc6, 0x0, 0x4b, 0xbe,
+    0xa0, 0xa, 0x6e, 0xf4, 0x12, 0x20, 0x80, 0x1a,
+    0x89, 0xc2, 0x1, 0x32, 0x26, 0x20, 0x0, 0x88,
+    0x0, 0xa0, 0x1d, 0x80, 0x3, 0x0, 0xfc, 0x80,
+    0x11, 0x80, 0x71, 0x80, 0x14, 0x3, 0xf6, 0x80,
+    0xc, 0x3, 0xc8, 0x0, 0xf0, 0xf, 0xc6, 0x0,
+    0x50, 0xe, 0x20, 0x9, 0x0, 0x3f, 0x20, 0x3,
+    0x0, 0x39, 0x0, 0x22, 0x0, 0xf0,
     /* U+0024 "$" */
-    0x0, 0x0, 0x5, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0xfa, 0x72, 0x0, 0x0, 0x0,
-    0x6e, 0xff, 0xff, 0xff, 0xfb, 0x10, 0x0, 0xaf,
-    0xff, 0xff, 0xff, 0xff, 0xf3, 0x0, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x30, 0x1f, 0xff, 0xff,
-    0xfe, 0xab, 0xef, 0xf3, 0x4, 0xff, 0xff, 0xfb,
-    0x0, 0x0, 0x7f, 0x30, 0x7f, 0xff, 0xff, 0x30,
-    0x0, 0x0, 0x32, 0x6, 0xff, 0xff, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xc1, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0xf8, 0x10,
-    0x0, 0x0, 0x5, 0xff, 0xff, 0xff, 0xff, 0x91,
-    0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0xff, 0xe4,
-    0x0, 0x0, 0x4, 0xdf, 0xff, 0xff, 0xff, 0xf3,
-    0x0, 0x0, 0x0, 0x5d, 0xff, 0xff, 0xff, 0xe1,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xb5, 0x10,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xfa, 0x7e, 0x50,
-    0x0, 0x0, 0x9f, 0xff, 0xff, 0x77, 0xff, 0xd8,
-    0x67, 0xcf, 0xff, 0xff, 0xf1, 0x7f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf8, 0x7, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfb, 0x0, 0x5f, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x17, 0xcf, 0xff, 0xff,
-    0x82, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0x77, 0x60, 0x0,
-    0x0, 0x0,
-
+    0x0, 0xe5, 0xff, 0x68, 0x7, 0xff, 0x3b, 0x0,
+    0x5, 0x4e, 0x40, 0x1e, 0x6e, 0x60, 0x9, 0x63,
+    0x6c, 0x40, 0x2a, 0x91, 0x0, 0xf9, 0x8, 0x0,
+    0xea, 0x1, 0xff, 0x86, 0x0, 0x38, 0x55, 0x4,
+    0x3, 0x28, 0x7, 0x27, 0x55, 0xf4, 0x0, 0x46,
+    0x1, 0xd0, 0x1, 0x9f, 0x4, 0x4, 0x3, 0xfe,
+    0x32, 0x5, 0x0, 0xef, 0x10, 0xf, 0x8c, 0x40,
+    0x31, 0xf4, 0x8, 0x7, 0xac, 0x3, 0xcf, 0xd2,
+    0x20, 0x19, 0x5c, 0x3, 0xe6, 0xf4, 0x0, 0xd1,
+    0x64, 0x1, 0xe1, 0xb3, 0x0, 0xc9, 0xb4, 0x40,
+    0x1e, 0xd1, 0x0, 0xe5, 0xda, 0x0, 0xe1, 0x70,
+    0xf, 0x96, 0xc0, 0x3b, 0x0, 0x3f, 0x20, 0x7,
+    0xa, 0x88, 0x7, 0x84, 0x3, 0x84, 0xbd, 0x40,
+    0x3a, 0x0, 0x3b, 0x40, 0x6b, 0x61, 0x9f, 0x18,
+    0x3, 0x98, 0x2, 0x27, 0x98, 0x30, 0xe, 0x71,
+    0x0, 0xff, 0xc9, 0x0, 0x40, 0x1f, 0xe7, 0xb0,
+    0x2, 0xf4, 0x18, 0x7, 0x3e, 0xc0, 0x6, 0x17,
+    0xcf, 0xa0, 0x1, 0x41, 0x0, 0x7f, 0xf3, 0x1e,
+    0x21, 0x60, 0x1e,
     /* U+0025 "%" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x67, 0x74, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xbe, 0xfd, 0xa7, 0x41,
-    0x0, 0x38, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0x1, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xe4, 0x5f,
-    0xff, 0xfa, 0xbc, 0xba, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0x80, 0xa, 0xff, 0xf7,
-    0x0, 0x7, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0x40, 0x7, 0xff, 0xf9, 0x0, 0xd,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff,
-    0x30, 0x7, 0xff, 0xf7, 0x0, 0x4f, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0x60, 0xb,
-    0xff, 0xf4, 0x0, 0xbf, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0xe4, 0x6f, 0xff, 0xf1,
-    0x2, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0xff, 0xff, 0xff, 0x60, 0x9, 0xff,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xcf,
-    0xff, 0xff, 0xf9, 0x0, 0x1f, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xbe, 0xea,
-    0x40, 0x0, 0x7f, 0xfc, 0x0, 0x6, 0xbf, 0xeb,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xf5, 0x1, 0xbf, 0xff, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xe0,
-    0x9, 0xff, 0xff, 0xff, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0x80, 0x3f, 0xff,
-    0xe4, 0x6f, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0x10, 0x8f, 0xff, 0x80, 0xc,
-    0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0xfa, 0x0, 0xaf, 0xff, 0x50, 0x8, 0xff, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xf3, 0x0,
-    0xdf, 0xff, 0x30, 0x6, 0xff, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0xd0, 0x0, 0xbf, 0xff,
-    0x40, 0x8, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xff, 0x60, 0x0, 0x8f, 0xff, 0x80, 0xb,
-    0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0x0, 0x0, 0x3f, 0xff, 0xf4, 0x6f, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xf9, 0x0, 0x0,
-    0xa, 0xff, 0xff, 0xff, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xf2, 0x0, 0x0, 0x1, 0xbf,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x6, 0xbe, 0xea,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x37, 0x77, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
+    0x0, 0xff, 0xe3, 0x33, 0xb9, 0x0, 0x3f, 0xf9,
+    0x6b, 0x31, 0x7, 0x0, 0xff, 0xe5, 0x1d, 0x0,
+    0xc, 0xc0, 0x1f, 0xcf, 0x7d, 0xfb, 0x4e, 0x82,
+    0x0, 0x38, 0xc0, 0xa, 0x40, 0x3f, 0xe, 0x42,
+    0x8, 0x12, 0xc5, 0xf7, 0xfb, 0x1c, 0x2, 0x15,
+    0x0, 0xfd, 0x46, 0x1, 0xff, 0xc4, 0x60, 0xf,
+    0xc8, 0x80, 0x0, 0xdd, 0x0, 0x65, 0x43, 0x45,
+    0x0, 0xa4, 0x3, 0xf6, 0x80, 0x4c, 0x8a, 0xa0,
+    0xb, 0x6f, 0x2f, 0x40, 0xa, 0x20, 0x1f, 0x94,
+    0x2, 0xc0, 0x6, 0x80, 0x5c, 0x1, 0x50, 0x3,
+    0x80, 0x3f, 0xf8, 0x0, 0xe0, 0x1e, 0xe0, 0x2,
+    0x10, 0x12, 0x0, 0x7f, 0x28, 0x4, 0xa0, 0xc,
+    0x0, 0x8c, 0x1, 0xe0, 0xb, 0x0, 0xff, 0x68,
+    0x5, 0x8, 0xc8, 0x1, 0x28, 0x12, 0x0, 0x18,
+    0x3, 0xfc, 0x88, 0x0, 0xd, 0xc8, 0x5, 0x22,
+    0x16, 0x0, 0x60, 0xf, 0xfd, 0x46, 0x1, 0xe6,
+    0x60, 0xb, 0x0, 0x2c, 0x3, 0xff, 0xe, 0x42,
+    0x8, 0x96, 0xe4, 0x0, 0xc0, 0x3, 0x20, 0x3,
+    0x5f, 0xf5, 0xa0, 0x7, 0x9e, 0xfb, 0x94, 0x80,
+    0x14, 0x80, 0x24, 0x6, 0xe5, 0x0, 0x52, 0xdc,
+    0x3, 0xff, 0x80, 0xa, 0x20, 0x2a, 0x10, 0x80,
+    0x1e, 0x86, 0x0, 0xff, 0xd2, 0x0, 0x60, 0x36,
+    0x0, 0xd, 0xc8, 0x5, 0x0, 0x1f, 0xf1, 0x98,
+    0x1, 0x21, 0x60, 0x13, 0x23, 0x18, 0x0, 0x50,
+    0x3, 0xfd, 0x20, 0x5, 0x10, 0x20, 0xb, 0x40,
+    0x8, 0x1, 0x18, 0x7, 0xf0, 0xa8, 0x2, 0x40,
+    0xe, 0x1, 0x30, 0x3, 0x80, 0x2e, 0x0, 0xfe,
+    0x90, 0x1, 0x18, 0x1, 0x80, 0x27, 0x0, 0x70,
+    0x5, 0xc0, 0x1f, 0xcc, 0x0, 0xb0, 0x8, 0xc0,
+    0x2c, 0x0, 0x18, 0x4, 0x60, 0x1f, 0x98, 0x40,
+    0xc, 0x1, 0x58, 0x4, 0xe8, 0xc8, 0x0, 0x14,
+    0x0, 0xfd, 0x40, 0x6, 0x0, 0xc6, 0xa0, 0x15,
+    0xc8, 0x5, 0x0, 0x1f, 0x8c, 0xc0, 0xb, 0x0,
+    0xeb, 0x40, 0xf, 0x3b, 0x0, 0x7e, 0x90, 0x2,
+    0x10, 0x7, 0xd, 0xca, 0x8, 0x96, 0xe0, 0x3,
+    0xf1, 0x28, 0x3, 0x80, 0x3f, 0x35, 0xf7, 0x29,
+    0x0, 0x3f, 0x86, 0x22, 0x50, 0xf, 0xfe, 0x28,
     /* U+0026 "&" */
-    0x0, 0x0, 0x0, 0x4, 0xac, 0xfe, 0xc7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff,
-    0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xb4, 0x55, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xef, 0xff, 0xff, 0x80, 0x3c, 0xcc, 0xc6, 0x0,
-    0x3, 0xef, 0xff, 0xff, 0xff, 0x15, 0xff, 0xff,
-    0x70, 0x3, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x5f,
-    0xff, 0xf6, 0x0, 0xef, 0xff, 0xff, 0xff, 0xff,
-    0xf8, 0xff, 0xff, 0x30, 0x7f, 0xff, 0xfe, 0x9f,
-    0xff, 0xff, 0xff, 0xff, 0xf0, 0xe, 0xff, 0xff,
-    0x81, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x1, 0xff,
-    0xff, 0xf5, 0x8, 0xff, 0xff, 0xff, 0xff, 0x60,
-    0x4f, 0xff, 0xff, 0x50, 0x1f, 0xff, 0xff, 0xff,
-    0xd0, 0x3, 0xff, 0xff, 0xfb, 0x0, 0x8f, 0xff,
-    0xff, 0xf5, 0x0, 0x1f, 0xff, 0xff, 0xf8, 0x1,
-    0xff, 0xff, 0xff, 0x10, 0x0, 0xcf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x3, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0x8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x60, 0x0, 0x7, 0xff, 0xff, 0xff, 0xfd, 0xdf,
-    0xff, 0xfd, 0x0, 0x0, 0x2, 0x9e, 0xfe, 0xb6,
-    0x5, 0xff, 0xff, 0xf5,
-
+    0x0, 0xf9, 0x2b, 0x3f, 0xb1, 0xc0, 0x3f, 0xea,
+    0xb5, 0x30, 0x13, 0xd0, 0xf, 0xf5, 0x28, 0x7,
+    0xff, 0x10, 0xd4, 0x3, 0xff, 0x8a, 0x80, 0x1c,
+    0x97, 0x5e, 0x1, 0xfd, 0xe0, 0x1d, 0x68, 0xaa,
+    0x0, 0xfe, 0xe0, 0xe, 0x10, 0xf, 0xfc, 0xa0,
+    0x1c, 0xc0, 0x1f, 0xf8, 0xc4, 0x3, 0x48, 0x7,
+    0xfe, 0x20, 0xe, 0x18, 0x3, 0xcc, 0xcc, 0x1,
+    0x1e, 0x8, 0x7, 0x38, 0xb1, 0x9e, 0x10, 0x1,
+    0xe0, 0x80, 0x7d, 0x0, 0x1c, 0x20, 0xd, 0x0,
+    0xfe, 0x6d, 0x0, 0xca, 0xe, 0x20, 0x10, 0xb0,
+    0x7, 0x38, 0x6, 0x30, 0x90, 0xc, 0xd0, 0x1,
+    0xfc, 0x80, 0x22, 0x0, 0xda, 0x2e, 0x1, 0xfb,
+    0x41, 0x40, 0x3e, 0x90, 0xf, 0x89, 0x81, 0xc0,
+    0x3b, 0x80, 0x5c, 0x3, 0xd0, 0x0, 0x20, 0xe,
+    0x48, 0x9, 0x0, 0xf2, 0x0, 0x4, 0xc0, 0x39,
+    0xff, 0x80, 0x3d, 0x20, 0x17, 0x80, 0x7f, 0xf0,
+    0x9c, 0x2, 0x37, 0x0, 0xff, 0xe1, 0x30, 0x5,
+    0x10, 0x0, 0xf8, 0x88, 0x1, 0xac, 0x3, 0x3e,
+    0xb0, 0x80, 0xa4, 0xec, 0x0, 0x62, 0x50,
     /* U+0027 "'" */
-    0x6f, 0xff, 0xff, 0x6f, 0xff, 0xff, 0x6f, 0xff,
-    0xff, 0x6f, 0xff, 0xff, 0x6f, 0xff, 0xff, 0x3f,
-    0xff, 0xfc, 0xf, 0xff, 0xf9, 0xc, 0xff, 0xf6,
-    0x9, 0xff, 0xf4, 0x0, 0x0, 0x0,
-
+    0x6f, 0xfe, 0x0, 0xff, 0xe6, 0x28, 0x6, 0x33,
+    0x0, 0x65, 0x3, 0x0, 0xbc, 0x14, 0x2, 0x20,
+    0x9f, 0xf9, 0x0,
     /* U+0028 "(" */
-    0x0, 0x0, 0xef, 0xff, 0x70, 0x0, 0x7f, 0xff,
-    0xe0, 0x0, 0xe, 0xff, 0xf8, 0x0, 0x6, 0xff,
-    0xff, 0x10, 0x0, 0xcf, 0xff, 0xa0, 0x0, 0x2f,
-    0xff, 0xf5, 0x0, 0x8, 0xff, 0xff, 0x0, 0x0,
-    0xdf, 0xff, 0xb0, 0x0, 0xf, 0xff, 0xf8, 0x0,
-    0x3, 0xff, 0xff, 0x50, 0x0, 0x7f, 0xff, 0xf2,
-    0x0, 0xa, 0xff, 0xff, 0x0, 0x0, 0xbf, 0xff,
-    0xf0, 0x0, 0xd, 0xff, 0xfe, 0x0, 0x0, 0xdf,
-    0xff, 0xe0, 0x0, 0xe, 0xff, 0xfd, 0x0, 0x0,
-    0xdf, 0xff, 0xe0, 0x0, 0xd, 0xff, 0xfe, 0x0,
-    0x0, 0xcf, 0xff, 0xe0, 0x0, 0xb, 0xff, 0xff,
-    0x0, 0x0, 0x9f, 0xff, 0xf1, 0x0, 0x6, 0xff,
-    0xff, 0x30, 0x0, 0x2f, 0xff, 0xf5, 0x0, 0x0,
-    0xef, 0xff, 0x80, 0x0, 0xb, 0xff, 0xfc, 0x0,
-    0x0, 0x6f, 0xff, 0xf0, 0x0, 0x1, 0xff, 0xff,
-    0x50, 0x0, 0xa, 0xff, 0xfc, 0x0, 0x0, 0x4f,
-    0xff, 0xf2, 0x0, 0x0, 0xdf, 0xff, 0x90, 0x0,
-    0x5, 0xff, 0xff, 0x20, 0x0, 0xc, 0xff, 0xfa,
-
+    0x0, 0xdd, 0xff, 0x38, 0x4, 0xe2, 0x0, 0x17,
+    0x0, 0xa4, 0x2, 0x60, 0x9, 0x84, 0x2, 0x90,
+    0xa, 0x80, 0x25, 0x10, 0x1, 0x18, 0x5, 0xe0,
+    0x15, 0x0, 0x65, 0x0, 0x94, 0x2, 0x40, 0xc,
+    0x40, 0x11, 0x80, 0x46, 0x1, 0xb4, 0x2, 0x40,
+    0xc, 0xe0, 0x16, 0x80, 0x62, 0x0, 0x84, 0x3,
+    0xf3, 0x0, 0x42, 0x1, 0xff, 0xc0, 0x3, 0x0,
+    0x8c, 0x3, 0x18, 0x4, 0x60, 0x1f, 0xfc, 0x0,
+    0x10, 0xf, 0xce, 0x1, 0x8, 0x6, 0x20, 0xc,
+    0x20, 0x17, 0x80, 0x62, 0x0, 0x90, 0x3, 0x30,
+    0x4, 0x42, 0x1, 0x68, 0x6, 0x50, 0x9, 0x0,
+    0x36, 0x80, 0x46, 0x1, 0x9c, 0x3, 0x28, 0x4,
+    0x2a, 0x1, 0x48, 0x6, 0xe0, 0x8, 0xc8, 0x2,
+    0x42, 0x0, 0xac, 0x3, 0x40, 0x4, 0xc4, 0x1,
+    0x29, 0x80, 0x50,
     /* U+0029 ")" */
-    0x1f, 0xff, 0xf5, 0x0, 0x0, 0x9, 0xff, 0xfd,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0xbf, 0xff, 0xc0, 0x0, 0x0, 0x5f, 0xff, 0xf2,
-    0x0, 0x0, 0xf, 0xff, 0xf8, 0x0, 0x0, 0x9,
-    0xff, 0xfd, 0x0, 0x0, 0x5, 0xff, 0xff, 0x20,
-    0x0, 0x2, 0xff, 0xff, 0x60, 0x0, 0x0, 0xff,
-    0xff, 0x90, 0x0, 0x0, 0xcf, 0xff, 0xd0, 0x0,
-    0x0, 0xaf, 0xff, 0xf0, 0x0, 0x0, 0x9f, 0xff,
-    0xf1, 0x0, 0x0, 0x8f, 0xff, 0xf2, 0x0, 0x0,
-    0x8f, 0xff, 0xf3, 0x0, 0x0, 0x7f, 0xff, 0xf4,
-    0x0, 0x0, 0x8f, 0xff, 0xf3, 0x0, 0x0, 0x8f,
-    0xff, 0xf3, 0x0, 0x0, 0x9f, 0xff, 0xf2, 0x0,
-    0x0, 0xaf, 0xff, 0xf0, 0x0, 0x0, 0xbf, 0xff,
-    0xf0, 0x0, 0x0, 0xdf, 0xff, 0xc0, 0x0, 0x0,
-    0xff, 0xff, 0x80, 0x0, 0x2, 0xff, 0xff, 0x40,
-    0x0, 0x6, 0xff, 0xff, 0x10, 0x0, 0xa, 0xff,
-    0xfc, 0x0, 0x0, 0xf, 0xff, 0xf6, 0x0, 0x0,
-    0x6f, 0xff, 0xf1, 0x0, 0x0, 0xcf, 0xff, 0xa0,
-    0x0, 0x3, 0xff, 0xff, 0x30, 0x0, 0xc, 0xff,
-    0xfa, 0x0, 0x0, 0x4f, 0xff, 0xf3, 0x0, 0x0,
-
+    0x1f, 0xfc, 0xa0, 0x18, 0x58, 0x2, 0x80, 0xe,
+    0xb0, 0x8, 0x90, 0x3, 0x12, 0x0, 0x50, 0x1,
+    0xdc, 0x1, 0x19, 0x0, 0x65, 0x0, 0xd4, 0x1,
+    0xcc, 0x1, 0x28, 0x7, 0x60, 0x4, 0x44, 0x0,
+    0xce, 0x1, 0x90, 0x3, 0x10, 0x6, 0xf0, 0xe,
+    0x30, 0x9, 0x0, 0x39, 0x80, 0x22, 0x0, 0xe3,
+    0x0, 0xc2, 0x1, 0x84, 0x3, 0x18, 0x7, 0xf0,
+    0x80, 0x6f, 0x0, 0xce, 0x1, 0xbc, 0x3, 0x38,
+    0x7, 0xff, 0x8, 0x40, 0x30, 0x80, 0x63, 0x0,
+    0xc4, 0x1, 0x84, 0x3, 0xf9, 0x80, 0x23, 0x0,
+    0xe2, 0x0, 0x90, 0x3, 0x10, 0x6, 0xc0, 0xc,
+    0x80, 0x19, 0x40, 0x36, 0x0, 0x46, 0x20, 0x19,
+    0x40, 0x2a, 0x0, 0xcc, 0x1, 0x9c, 0x3, 0x50,
+    0x4, 0xa2, 0x1, 0x19, 0x80, 0x29, 0x0, 0xde,
+    0x1, 0x29, 0x80, 0x48, 0x60, 0x14, 0x80, 0x60,
     /* U+002A "*" */
-    0x0, 0x0, 0xa, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0x90, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xf9, 0x0, 0x0, 0x0, 0xea, 0x50, 0xaf, 0x90,
-    0x5b, 0xd0, 0x5f, 0xff, 0xfe, 0xfe, 0xff, 0xff,
-    0x30, 0x5b, 0xff, 0xff, 0xff, 0xfa, 0x50, 0x0,
-    0x1, 0xcf, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x4f,
-    0xfe, 0xff, 0x30, 0x0, 0x0, 0x1e, 0xfc, 0x1e,
-    0xfd, 0x0, 0x0, 0xb, 0xff, 0x20, 0x3f, 0xf9,
-    0x0, 0x0, 0x2c, 0x50, 0x0, 0x7b, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
+    0x0, 0xea, 0xf9, 0x0, 0xff, 0xea, 0x75, 0x28,
+    0x7, 0x2d, 0xe8, 0x28, 0xad, 0x7a, 0x3, 0xfd,
+    0x21, 0x1a, 0xd2, 0x0, 0x4, 0x4, 0x0, 0xb4,
+    0x60, 0xb7, 0xc6, 0x1, 0x2f, 0xd2, 0x80, 0x65,
+    0x30, 0x10, 0x53, 0x0, 0xe1, 0xa0, 0x3f, 0x10,
+    0xe0, 0xe, 0xa1, 0xe, 0x1d, 0x2, 0x90, 0xd,
+    0x27, 0x44, 0x7, 0x9, 0x0, 0x18, 0xb1, 0x40,
+    0x27, 0xb1, 0x0,
     /* U+002B "+" */
-    0x0, 0x0, 0x0, 0x0, 0x67, 0x76, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x78, 0x88, 0x88, 0x88, 0xef, 0xfe, 0x88, 0x88,
-    0x88, 0x87, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfd, 0xcf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xcf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xfd, 0x0, 0x0, 0x0, 0x0,
-
+    0x0, 0xfc, 0xce, 0xe6, 0x0, 0xff, 0xe2, 0x54,
+    0x42, 0xc0, 0x3f, 0xff, 0xe0, 0x1f, 0xfe, 0x97,
+    0x88, 0xf8, 0x80, 0x7, 0x11, 0xf3, 0xdb, 0xbf,
+    0xc2, 0x0, 0x17, 0x7f, 0xa8, 0x3, 0xff, 0xb9,
+    0x9f, 0xff, 0x18, 0x0, 0xbf, 0xfe, 0xd0, 0xf,
+    0xff, 0xf8, 0x7, 0xff, 0xd4,
     /* U+002C "," */
-    0x0, 0x14, 0x10, 0x0, 0x8f, 0xff, 0x70, 0x4f,
-    0xff, 0xff, 0x38, 0xff, 0xff, 0xf8, 0x7f, 0xff,
-    0xff, 0xa3, 0xff, 0xff, 0xf9, 0x5, 0xff, 0xff,
-    0x70, 0x2, 0xff, 0xf4, 0x0, 0x4f, 0xff, 0x0,
-    0x7, 0xff, 0xa0, 0x0, 0xbf, 0xf3, 0x0, 0xf,
-    0xfb, 0x0, 0x5, 0xff, 0x40, 0x0, 0xaf, 0xd0,
-    0x0,
-
+    0x0, 0xa, 0x8, 0x5, 0x1d, 0x7c, 0xe0, 0x8e,
+    0x1, 0x41, 0xe0, 0x7, 0x5f, 0x80, 0x71, 0x20,
+    0x7, 0x19, 0xa8, 0x3, 0x70, 0x2e, 0x80, 0x46,
+    0x0, 0x60, 0x9, 0x0, 0x6, 0x0, 0x50, 0xb,
+    0x0, 0x12, 0x1, 0x20, 0x21, 0x80, 0x14, 0x1,
+    0xe0, 0x17, 0x81, 0x20, 0x0,
     /* U+002D "-" */
-    0x67, 0x77, 0x77, 0x77, 0x72, 0xdf, 0xff, 0xff,
-    0xff, 0xf5, 0xdf, 0xff, 0xff, 0xff, 0xf5, 0xdf,
-    0xff, 0xff, 0xff, 0xf5, 0xdf, 0xff, 0xff, 0xff,
-    0xf5, 0xdf, 0xff, 0xff, 0xff, 0xf5,
-
+    0x67, 0x7f, 0xc5, 0x71, 0x1f, 0x9c, 0x3, 0xff,
+    0xb8,
     /* U+002E "." */
-    0x0, 0x67, 0x30, 0x0, 0xdf, 0xff, 0x60, 0x6f,
-    0xff, 0xfe, 0x7, 0xff, 0xff, 0xf0, 0x2f, 0xff,
-    0xfa, 0x0, 0x4d, 0xfa, 0x10,
-
+    0x0, 0x33, 0x98, 0x5, 0xb3, 0x18, 0xc0, 0xc4,
+    0x1, 0x40, 0x8, 0x6, 0x10, 0x50, 0xc, 0xa0,
+    0x56, 0x40, 0xb6, 0x0,
     /* U+002F "/" */
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0x10, 0x0, 0x0, 0x0, 0xcf,
-    0xfc, 0x0, 0x0, 0x0, 0x1, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xf3, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0xe0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0x90, 0x0, 0x0, 0x0, 0x4f, 0xff, 0x50, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xfb, 0x0, 0x0, 0x0, 0x2, 0xff, 0xf7,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xd0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0x90, 0x0, 0x0, 0x0, 0x4f, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x9f, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xfb, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0x80, 0x0, 0x0, 0x0, 0x5f, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0xaf, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x67, 0x75, 0x0, 0x0, 0x0, 0x0,
-
+    0x0, 0xfd, 0xff, 0x40, 0x7, 0xca, 0x1, 0x60,
+    0x7, 0xd8, 0x1, 0x20, 0x7, 0xce, 0x0, 0x50,
+    0xf, 0x8c, 0x40, 0x18, 0x1, 0xf2, 0x0, 0x4e,
+    0x1, 0xf5, 0x80, 0xc, 0x40, 0x3c, 0x26, 0x0,
+    0x40, 0xf, 0x90, 0x2, 0xb0, 0xf, 0xbc, 0x0,
+    0x26, 0x1, 0xf2, 0x80, 0x1c, 0x3, 0xe4, 0x0,
+    0xb0, 0x3, 0xec, 0x0, 0x94, 0x3, 0xe5, 0x0,
+    0x20, 0x7, 0xc4, 0x40, 0x6, 0x0, 0x7c, 0x80,
+    0x12, 0x80, 0x7d, 0xa0, 0x2, 0x20, 0x7, 0xc8,
+    0x0, 0x40, 0xf, 0x90, 0x2, 0xd0, 0xf, 0xb4,
+    0x2, 0x40, 0xf, 0x9c, 0x0, 0x80, 0x1f, 0x10,
+    0x80, 0x34, 0x3, 0xe5, 0x0, 0x9c, 0x3, 0xeb,
+    0x0, 0x18, 0x80, 0x78, 0x4c, 0x0, 0x80, 0x1f,
+    0x20, 0x5, 0x60, 0x1f, 0x78, 0x0, 0x4c, 0x3,
+    0xec, 0x88, 0x58, 0x7, 0xe0,
     /* U+0030 "0" */
-    0x0, 0x0, 0x0, 0x6c, 0xef, 0xc9, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x3e, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xa0, 0x0, 0x0, 0x1e, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf7, 0x0, 0x0, 0x9f, 0xff, 0xff,
-    0x86, 0xdf, 0xff, 0xff, 0x0, 0x1, 0xff, 0xff,
-    0xf8, 0x0, 0x2f, 0xff, 0xff, 0x60, 0x6, 0xff,
-    0xff, 0xf1, 0x0, 0xc, 0xff, 0xff, 0xb0, 0xa,
-    0xff, 0xff, 0xc0, 0x0, 0x7, 0xff, 0xff, 0xf0,
-    0xd, 0xff, 0xff, 0xa0, 0x0, 0x5, 0xff, 0xff,
-    0xf3, 0xf, 0xff, 0xff, 0x80, 0x0, 0x3, 0xff,
-    0xff, 0xf5, 0x1f, 0xff, 0xff, 0x70, 0x0, 0x2,
-    0xff, 0xff, 0xf6, 0x2f, 0xff, 0xff, 0x70, 0x0,
-    0x1, 0xff, 0xff, 0xf8, 0x2f, 0xff, 0xff, 0x70,
-    0x0, 0x1, 0xff, 0xff, 0xf8, 0x1f, 0xff, 0xff,
-    0x70, 0x0, 0x2, 0xff, 0xff, 0xf7, 0xf, 0xff,
-    0xff, 0x90, 0x0, 0x2, 0xff, 0xff, 0xf6, 0xd,
-    0xff, 0xff, 0xb0, 0x0, 0x4, 0xff, 0xff, 0xf3,
-    0xa, 0xff, 0xff, 0xd0, 0x0, 0x7, 0xff, 0xff,
-    0xf1, 0x6, 0xff, 0xff, 0xf2, 0x0, 0xb, 0xff,
-    0xff, 0xc0, 0x1, 0xff, 0xff, 0xf9, 0x0, 0x2f,
-    0xff, 0xff, 0x70, 0x0, 0x9f, 0xff, 0xff, 0x85,
-    0xdf, 0xff, 0xfe, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x4, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0x4e, 0xff, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6b, 0xef, 0xd9, 0x30, 0x0, 0x0,
-
+    0x0, 0xf3, 0x67, 0x7e, 0x49, 0x0, 0x7f, 0x1f,
+    0x49, 0x88, 0x1b, 0x6c, 0x0, 0x7c, 0x78, 0x20,
+    0x1f, 0x3d, 0x0, 0x70, 0xe8, 0x7, 0xf9, 0x5c,
+    0x3, 0x40, 0x80, 0x67, 0x92, 0x0, 0xd0, 0x1,
+    0xb, 0x0, 0x67, 0x86, 0xf0, 0xe, 0x60, 0x3,
+    0x80, 0x74, 0x80, 0x8, 0xc0, 0x36, 0x80, 0x30,
+    0x3, 0x18, 0x80, 0x56, 0x1, 0x90, 0x0, 0xe0,
+    0x19, 0x80, 0x31, 0x0, 0x71, 0x81, 0x0, 0x62,
+    0x0, 0xcc, 0x1, 0xcc, 0x20, 0x1d, 0xe0, 0x18,
+    0x40, 0x38, 0xcc, 0x1, 0xfe, 0x30, 0xe, 0xe0,
+    0xf, 0xfe, 0x31, 0x80, 0x7f, 0x8c, 0x3, 0xbc,
+    0x40, 0x3b, 0x80, 0x3f, 0xc2, 0x4, 0x1, 0x88,
+    0x3, 0x30, 0x7, 0x28, 0x38, 0x6, 0x60, 0xc,
+    0x60, 0x1c, 0x41, 0x80, 0x18, 0x88, 0x1, 0x60,
+    0x6, 0x31, 0x7, 0x0, 0xeb, 0x0, 0x12, 0x0,
+    0x6b, 0x0, 0xb, 0x0, 0x66, 0x85, 0xf0, 0xc,
+    0x2e, 0x1, 0x58, 0x7, 0x3d, 0x10, 0x6, 0x80,
+    0xc, 0x56, 0x1, 0xfe, 0x56, 0x0, 0xe4, 0xb1,
+    0x0, 0xf9, 0xa8, 0x3, 0xe4, 0xe9, 0x41, 0x2,
+    0x6c, 0x90, 0xc,
     /* U+0031 "1" */
-    0x0, 0x0, 0x4, 0x44, 0x42, 0x0, 0x0, 0xf,
-    0xff, 0xfa, 0x0, 0x0, 0x2f, 0xff, 0xfa, 0x0,
-    0x0, 0x8f, 0xff, 0xfa, 0x0, 0x28, 0xff, 0xff,
-    0xfa, 0x6f, 0xff, 0xff, 0xff, 0xfa, 0x6f, 0xff,
-    0xff, 0xff, 0xfa, 0x6f, 0xff, 0xff, 0xff, 0xfa,
-    0x6f, 0xff, 0xff, 0xff, 0xfa, 0x0, 0x0, 0xbf,
-    0xff, 0xfa, 0x0, 0x0, 0xbf, 0xff, 0xfa, 0x0,
-    0x0, 0xbf, 0xff, 0xfa, 0x0, 0x0, 0xbf, 0xff,
-    0xfa, 0x0, 0x0, 0xbf, 0xff, 0xfa, 0x0, 0x0,
-    0xbf, 0xff, 0xfa, 0x0, 0x0, 0xbf, 0xff, 0xfa,
-    0x0, 0x0, 0xbf, 0xff, 0xfa, 0x0, 0x0, 0xbf,
-    0xff, 0xfa, 0x0, 0x0, 0xbf, 0xff, 0xfa, 0x0,
-    0x0, 0xbf, 0xff, 0xfa, 0x0, 0x0, 0xbf, 0xff,
-    0xfa, 0x0, 0x0, 0xbf, 0xff, 0xfa, 0x0, 0x0,
-    0xbf, 0xff, 0xfa, 0x0, 0x0, 0xbf, 0xff, 0xfa,
-
+    0x0, 0xe4, 0x4c, 0x40, 0x1d, 0x77, 0xa0, 0x3,
+    0x10, 0x7, 0xf5, 0x0, 0x7c, 0x50, 0xe0, 0x1c,
+    0xdf, 0xae, 0x1, 0xff, 0xd8, 0x6f, 0xf9, 0x0,
+    0x3f, 0xff, 0xe0, 0x1f, 0xff, 0xa0,
     /* U+0032 "2" */
-    0x0, 0x0, 0x24, 0x69, 0x75, 0x20, 0x0, 0x0,
-    0x0, 0x7c, 0xff, 0xff, 0xff, 0xfb, 0x20, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x10,
-    0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0,
-    0x1, 0xfd, 0x61, 0x3, 0xcf, 0xff, 0xff, 0xe0,
-    0x1, 0x70, 0x0, 0x0, 0xe, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x1e, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x1, 0xcf, 0xff, 0xff, 0xf3, 0x0,
-    0x0, 0x0, 0x2e, 0xff, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0x3, 0xef, 0xff, 0xff, 0xe3, 0x0, 0x0,
-    0x0, 0x1e, 0xff, 0xff, 0xfd, 0x20, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0xff, 0xc1, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0x86, 0x66, 0x66, 0x66, 0x63,
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7,
-
+    0x0, 0xc4, 0x8d, 0x2e, 0xa4, 0x1, 0xf3, 0xe6,
+    0xdc, 0xb4, 0x56, 0xd9, 0x0, 0x61, 0x83, 0x0,
+    0xf9, 0x35, 0x0, 0x3f, 0xf8, 0x74, 0x20, 0x1f,
+    0xfc, 0x21, 0xb0, 0xc, 0x53, 0xdf, 0x86, 0x1,
+    0xc8, 0x1, 0x46, 0xb0, 0x81, 0xe0, 0x80, 0x61,
+    0x0, 0xb, 0x80, 0x78, 0x80, 0x3f, 0xf8, 0x42,
+    0x40, 0x18, 0xc0, 0x3f, 0xa8, 0x40, 0x35, 0x80,
+    0x7e, 0xb4, 0x0, 0xc2, 0xe0, 0x1e, 0x1c, 0x40,
+    0xe, 0xd0, 0xf, 0x17, 0x98, 0x7, 0x59, 0x80,
+    0x71, 0xe0, 0x80, 0x61, 0xc4, 0x0, 0xe1, 0xd1,
+    0x0, 0xc5, 0x86, 0x1, 0xed, 0x10, 0xc, 0x78,
+    0x40, 0x1e, 0x33, 0x0, 0x64, 0xc1, 0x0, 0xfa,
+    0x40, 0x31, 0x58, 0x7, 0xf2, 0x80, 0x6b, 0x0,
+    0xfe, 0x10, 0xe, 0xe6, 0x6f, 0xc6, 0x60, 0xe,
+    0x79, 0x9f, 0xc8, 0x20, 0x1f, 0xfe, 0x30,
     /* U+0033 "3" */
-    0x1, 0x7b, 0xef, 0xec, 0xa4, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x20, 0x0, 0x9f,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x10, 0x9, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfb, 0x0, 0x9f, 0xfc,
-    0xac, 0xff, 0xff, 0xff, 0xf1, 0x9, 0xa2, 0x0,
-    0x2, 0xef, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x2, 0x9f,
-    0xff, 0xff, 0x40, 0x0, 0x4, 0xff, 0xff, 0xff,
-    0xff, 0x60, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xfb,
-    0x20, 0x0, 0x0, 0x4, 0xff, 0xff, 0xff, 0xfd,
-    0x60, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xff, 0xff,
-    0xc1, 0x0, 0x0, 0x0, 0x14, 0xcf, 0xff, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0x52,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xf4, 0x9b,
-    0x30, 0x0, 0x8, 0xff, 0xff, 0xff, 0x19, 0xff,
-    0xeb, 0xbe, 0xff, 0xff, 0xff, 0xb0, 0x9f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf3, 0x9, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf6, 0x0, 0x8f, 0xff, 0xff,
-    0xff, 0xff, 0xc3, 0x0, 0x0, 0x27, 0xbe, 0xff,
-    0xea, 0x50, 0x0, 0x0,
-
+    0x1, 0x7b, 0xef, 0xec, 0xa4, 0x0, 0xe7, 0xe8,
+    0x41, 0x1, 0x35, 0xbc, 0x20, 0xb, 0x80, 0x3f,
+    0x8f, 0x4, 0x3, 0xff, 0x80, 0x3, 0x40, 0x1c,
+    0x6a, 0x60, 0x1e, 0x41, 0x0, 0x2e, 0xe5, 0x66,
+    0x88, 0x7, 0x10, 0x4d, 0x10, 0x4, 0x4e, 0x1,
+    0xc6, 0x1, 0xf8, 0x80, 0x31, 0x0, 0x7c, 0x52,
+    0x80, 0x1a, 0x40, 0x32, 0x7f, 0xb5, 0x80, 0x34,
+    0xa0, 0x7, 0xfc, 0x9a, 0xc0, 0x1f, 0xf9, 0x3d,
+    0x80, 0x3f, 0xf8, 0x0, 0x53, 0x82, 0x1, 0x27,
+    0xfb, 0xac, 0xc0, 0x31, 0xd8, 0x7, 0x85, 0x30,
+    0x80, 0x32, 0x88, 0x7, 0xea, 0x0, 0xe5, 0x0,
+    0xfc, 0x20, 0x1c, 0x24, 0x1, 0xf6, 0x80, 0x70,
+    0xdd, 0x8c, 0x3, 0x42, 0x0, 0x72, 0x82, 0x67,
+    0x5d, 0xb9, 0xc0, 0x39, 0x4, 0x2, 0x14, 0x40,
+    0x80, 0x7a, 0x0, 0x3f, 0xf8, 0x1, 0x26, 0x2,
+    0x1, 0xfc, 0x78, 0xc0, 0x8, 0xd8, 0x41, 0x0,
+    0xa, 0xd6, 0x18, 0x4,
     /* U+0034 "4" */
-    0x0, 0x0, 0x0, 0x0, 0x4, 0x44, 0x44, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff,
-    0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0xde, 0xff, 0xff, 0xa0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0x3e, 0xff, 0xff, 0xa0,
-    0x0, 0x0, 0xd, 0xff, 0xf8, 0xe, 0xff, 0xff,
-    0xa0, 0x0, 0x0, 0x8f, 0xff, 0xd0, 0xe, 0xff,
-    0xff, 0xa0, 0x0, 0x3, 0xff, 0xff, 0x30, 0xe,
-    0xff, 0xff, 0xa0, 0x0, 0xd, 0xff, 0xf8, 0x0,
-    0xe, 0xff, 0xff, 0xa0, 0x0, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xff, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0xa0, 0x0,
-
+    0x0, 0xfe, 0x44, 0xe3, 0x0, 0xff, 0x9a, 0xef,
+    0xa4, 0x3, 0xfc, 0x52, 0x1, 0xff, 0xc4, 0xe0,
+    0xf, 0xfe, 0x23, 0x98, 0x7, 0xff, 0xc, 0xa0,
+    0x3, 0xff, 0x89, 0xc0, 0x1f, 0xfc, 0x48, 0x30,
+    0x1, 0x8, 0x7, 0xfc, 0x6e, 0x1, 0x70, 0x7,
+    0xfe, 0xe0, 0x9, 0xcc, 0x3, 0xfe, 0x82, 0x0,
+    0x14, 0x0, 0x7f, 0xc6, 0xe0, 0x17, 0x0, 0x7f,
+    0xee, 0x0, 0x9c, 0xc0, 0x3f, 0xf1, 0x0, 0x4f,
+    0xff, 0x8, 0x6, 0x5f, 0xf3, 0x0, 0x7f, 0xfa,
+    0xff, 0xff, 0x8, 0x6, 0x4f, 0xf3, 0x0, 0x7f,
+    0xf0, 0x84, 0x3, 0xff, 0xfe, 0x1, 0xff, 0xc6,
     /* U+0035 "5" */
-    0x16, 0x66, 0x66, 0x66, 0x66, 0x66, 0x50, 0x4,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x4f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x4, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x4f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xe0, 0x4, 0xff, 0xff,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0x69,
-    0xde, 0xa2, 0x0, 0x4, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf5, 0x0, 0x4f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf2, 0x4, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xb0, 0x4f, 0xff, 0xff, 0xaa, 0xff, 0xff,
-    0xff, 0x12, 0x88, 0x88, 0x60, 0xb, 0xff, 0xff,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0x51,
-    0x10, 0x0, 0x0, 0xc, 0xff, 0xff, 0xf3, 0x4e,
-    0x60, 0x0, 0x8, 0xff, 0xff, 0xfe, 0x4, 0xff,
-    0xfb, 0xae, 0xff, 0xff, 0xff, 0x70, 0x4f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xd0, 0x4, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe3, 0x0, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xc2, 0x0, 0x0, 0x16, 0x9c, 0xef,
-    0xda, 0x50, 0x0, 0x0,
-
+    0x16, 0x6f, 0xf9, 0x40, 0xb, 0x33, 0xff, 0x58,
+    0x7, 0xff, 0xa6, 0xff, 0xfb, 0x80, 0x3f, 0xfb,
+    0x45, 0x3b, 0xd4, 0x40, 0x1f, 0xd2, 0xc4, 0x2b,
+    0xaa, 0x1, 0xff, 0xc2, 0xa2, 0x0, 0xff, 0xe1,
+    0x48, 0x7, 0xca, 0xa0, 0xe, 0x41, 0x67, 0x7d,
+    0x35, 0x44, 0x0, 0xe4, 0x28, 0x8c, 0xc0, 0xd,
+    0x0, 0xe3, 0x0, 0xfc, 0x40, 0x1c, 0x20, 0x1f,
+    0x88, 0x3, 0x88, 0x44, 0x1, 0xea, 0x0, 0xe6,
+    0x5f, 0x60, 0xd, 0x6, 0x1, 0x84, 0xc0, 0x67,
+    0xee, 0xb9, 0xc0, 0x3a, 0x40, 0x39, 0x14, 0x40,
+    0x38, 0x9c, 0x3, 0xff, 0xf, 0x0, 0x1c, 0x3,
+    0xf8, 0xf0, 0xc0, 0x7, 0xd2, 0xc6, 0x20, 0x4b,
+    0x58, 0x40, 0x10,
     /* U+0036 "6" */
-    0x0, 0x0, 0x1, 0x7c, 0xef, 0xdb, 0x83, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xff, 0xff, 0xff, 0x30,
-    0x0, 0x9, 0xff, 0xff, 0xff, 0xff, 0xff, 0x30,
-    0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x30,
-    0x2, 0xff, 0xff, 0xff, 0xfc, 0xbd, 0xff, 0x30,
-    0x9, 0xff, 0xff, 0xfd, 0x20, 0x0, 0x4d, 0x30,
-    0xf, 0xff, 0xff, 0xe2, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xff, 0xff, 0x23, 0xbf, 0xea, 0x20, 0x0,
-    0xbf, 0xff, 0xff, 0x5f, 0xff, 0xff, 0xe3, 0x0,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x20,
-    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0,
-    0xdf, 0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0xf2,
-    0xcf, 0xff, 0xff, 0xe1, 0x9, 0xff, 0xff, 0xf5,
-    0xbf, 0xff, 0xff, 0x40, 0x1, 0xff, 0xff, 0xf8,
-    0x9f, 0xff, 0xfe, 0x0, 0x0, 0xff, 0xff, 0xfa,
-    0x6f, 0xff, 0xff, 0x10, 0x0, 0xff, 0xff, 0xf9,
-    0x2f, 0xff, 0xff, 0x50, 0x1, 0xff, 0xff, 0xf7,
-    0xc, 0xff, 0xff, 0xd0, 0x8, 0xff, 0xff, 0xf3,
-    0x5, 0xff, 0xff, 0xfd, 0xcf, 0xff, 0xff, 0xc0,
-    0x0, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x30,
-    0x0, 0x1e, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x2, 0xcf, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x6, 0xbe, 0xfd, 0x92, 0x0, 0x0,
-
+    0x0, 0xe1, 0x7c, 0xef, 0xdb, 0x83, 0x0, 0xf3,
+    0x74, 0x18, 0x81, 0x23, 0xe1, 0x80, 0x69, 0x90,
+    0x7, 0xff, 0x0, 0x1d, 0x80, 0x3f, 0xf8, 0x0,
+    0x50, 0x1, 0xe3, 0x42, 0x0, 0xeb, 0x0, 0xe2,
+    0xdc, 0xbd, 0xb2, 0x0, 0x98, 0x3, 0xf, 0x90,
+    0x4, 0x9a, 0x60, 0xa0, 0x1d, 0x24, 0x1, 0xfb,
+    0x40, 0x39, 0x4e, 0xff, 0xa8, 0x80, 0x23, 0x0,
+    0xe7, 0xc4, 0x1, 0x5c, 0x30, 0x3, 0x80, 0x75,
+    0x0, 0x70, 0xe1, 0x0, 0x80, 0x7f, 0xf0, 0x2,
+    0x0, 0x3f, 0x84, 0x3, 0x94, 0x84, 0x3, 0x87,
+    0xb8, 0xc0, 0x1c, 0xee, 0x0, 0xea, 0x10, 0x80,
+    0xe, 0xd2, 0x0, 0xc2, 0x80, 0x1, 0x0, 0xe2,
+    0xf0, 0xc, 0x22, 0x0, 0xfc, 0x68, 0x1, 0xc8,
+    0x0, 0x10, 0xe, 0xe2, 0x30, 0xd, 0x0, 0x9,
+    0x0, 0xe4, 0x9, 0x0, 0xc5, 0xb8, 0xe0, 0x18,
+    0xcc, 0xa, 0x60, 0x18, 0x8c, 0x3, 0xbc, 0x2,
+    0xd1, 0x0, 0xfe, 0x73, 0x0, 0x87, 0xc, 0x3,
+    0xe7, 0x80, 0xe, 0x2c, 0x94, 0x10, 0x26, 0xd8,
+    0x0, 0x80,
     /* U+0037 "7" */
-    0x36, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x68,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x8f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe8, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x8f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xf3, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0xd, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff,
-    0xb0, 0x0, 0x0, 0x0,
-
+    0x36, 0x6f, 0xfe, 0x15, 0xcc, 0xff, 0xf0, 0x26,
+    0x0, 0x3f, 0xfc, 0x31, 0xff, 0xf8, 0x40, 0x32,
+    0x80, 0x7e, 0x51, 0x0, 0xdc, 0x1, 0xfa, 0x40,
+    0x30, 0xa8, 0x7, 0xc4, 0x60, 0x19, 0x80, 0x3f,
+    0x58, 0x7, 0x50, 0x7, 0xe6, 0x0, 0xc6, 0x40,
+    0x1f, 0x30, 0x7, 0x48, 0x7, 0xea, 0x0, 0xe5,
+    0x0, 0xf8, 0xcc, 0x1, 0x98, 0x3, 0xf4, 0x80,
+    0x75, 0x0, 0x7c, 0x2a, 0x1, 0x88, 0xc0, 0x3e,
+    0x60, 0xe, 0xb0, 0xf, 0xd4, 0x1, 0xce, 0x1,
+    0xf2, 0x10, 0x6, 0x51, 0x0, 0xfb, 0x80, 0x3b,
+    0x80, 0x3e, 0x15, 0x0, 0xc4, 0x80, 0x1f, 0x30,
+    0x7, 0x50, 0x7, 0xe9, 0x0, 0xe6, 0x0, 0xf9,
+    0x4, 0x3, 0x20, 0x80, 0x78,
     /* U+0038 "8" */
-    0x0, 0x0, 0x7, 0xbd, 0xfd, 0xa5, 0x0, 0x0,
-    0x0, 0x0, 0x6e, 0xff, 0xff, 0xff, 0xfd, 0x30,
-    0x0, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x10, 0x0, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfb, 0x0, 0x9, 0xff, 0xff, 0xfa, 0x5c, 0xff,
-    0xff, 0xf1, 0x0, 0xcf, 0xff, 0xff, 0x0, 0x4f,
-    0xff, 0xff, 0x30, 0xd, 0xff, 0xff, 0xb0, 0x0,
-    0xff, 0xff, 0xf1, 0x0, 0xbf, 0xff, 0xfe, 0x0,
-    0x3f, 0xff, 0xfb, 0x0, 0x7, 0xff, 0xff, 0xf8,
-    0xb, 0xff, 0xfe, 0x20, 0x0, 0xe, 0xff, 0xff,
-    0xfc, 0xff, 0xfe, 0x30, 0x0, 0x0, 0x2d, 0xff,
-    0xff, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x1d,
-    0xff, 0xff, 0xff, 0xfe, 0x40, 0x0, 0x0, 0x8,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x60, 0x0, 0x2d,
-    0xff, 0xff, 0x66, 0xff, 0xff, 0xff, 0x30, 0xd,
-    0xff, 0xff, 0x50, 0x3, 0xff, 0xff, 0xfd, 0x8,
-    0xff, 0xff, 0xa0, 0x0, 0xa, 0xff, 0xff, 0xf1,
-    0xcf, 0xff, 0xf6, 0x0, 0x0, 0x6f, 0xff, 0xff,
-    0x4f, 0xff, 0xff, 0x70, 0x0, 0x8, 0xff, 0xff,
-    0xf4, 0xdf, 0xff, 0xfd, 0x0, 0x0, 0xef, 0xff,
-    0xff, 0x28, 0xff, 0xff, 0xfd, 0x66, 0xdf, 0xff,
-    0xff, 0xc0, 0x1e, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf4, 0x0, 0x4f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf7, 0x0, 0x0, 0x2b, 0xff, 0xff, 0xff,
-    0xff, 0xd4, 0x0, 0x0, 0x0, 0x3, 0x9d, 0xff,
-    0xeb, 0x50, 0x0, 0x0,
-
+    0x0, 0xe7, 0xbd, 0xfd, 0xa5, 0x0, 0xfc, 0xdd,
+    0x8, 0x40, 0x4b, 0x5a, 0x60, 0x1c, 0xb2, 0x20,
+    0x1f, 0x16, 0x88, 0x4, 0x54, 0x1, 0xfe, 0x1a,
+    0x0, 0xac, 0x3, 0x96, 0x8c, 0x3, 0x20, 0x80,
+    0x14, 0x3, 0xa9, 0x60, 0x3, 0x88, 0x0, 0x20,
+    0x19, 0x0, 0x8, 0x1, 0xc4, 0x0, 0x60, 0xc,
+    0xa0, 0x3, 0x0, 0xc8, 0x20, 0xc, 0x0, 0xc3,
+    0x1, 0x0, 0x10, 0xc8, 0x4, 0xe2, 0x1, 0x9f,
+    0x10, 0x0, 0x3a, 0x40, 0x1b, 0x8, 0x3, 0x18,
+    0x5, 0x86, 0x1, 0xc5, 0x84, 0x1, 0xf6, 0x20,
+    0x7, 0xa4, 0x80, 0x3e, 0x1b, 0x60, 0x8, 0xb5,
+    0xc0, 0x29, 0x90, 0x7, 0x49, 0x80, 0x3c, 0x80,
+    0x2a, 0x66, 0x60, 0x7, 0x70, 0x41, 0x0, 0x4a,
+    0xa0, 0x1, 0xa8, 0x6, 0x21, 0x40, 0xd, 0x80,
+    0x1b, 0x0, 0x39, 0x4c, 0x3, 0x8, 0x6, 0xe0,
+    0xf, 0x10, 0x6, 0xa0, 0xc, 0xc0, 0x1c, 0xca,
+    0x1, 0x8b, 0x59, 0x9a, 0x20, 0x18, 0xca, 0x44,
+    0x3, 0x14, 0xc8, 0x80, 0x3a, 0x0, 0x68, 0x3,
+    0xff, 0x42, 0x0, 0x13, 0x50, 0x3, 0xf1, 0x5b,
+    0x80, 0x62, 0xbc, 0x62, 0x0, 0xa, 0x56, 0xa0,
+    0x4,
     /* U+0039 "9" */
-    0x0, 0x0, 0x7, 0xce, 0xfd, 0x81, 0x0, 0x0,
-    0x0, 0x0, 0x3e, 0xff, 0xff, 0xff, 0xf5, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xf5,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf2, 0x0, 0x6, 0xff, 0xff, 0xfd, 0xbf, 0xff,
-    0xff, 0xb0, 0x0, 0xdf, 0xff, 0xfd, 0x0, 0x8f,
-    0xff, 0xff, 0x20, 0x2f, 0xff, 0xff, 0x70, 0x0,
-    0xff, 0xff, 0xf7, 0x4, 0xff, 0xff, 0xf5, 0x0,
-    0xb, 0xff, 0xff, 0xb0, 0x4f, 0xff, 0xff, 0x40,
-    0x0, 0x8f, 0xff, 0xfe, 0x2, 0xff, 0xff, 0xf7,
-    0x0, 0xd, 0xff, 0xff, 0xf1, 0xf, 0xff, 0xff,
-    0xd1, 0x9, 0xff, 0xff, 0xff, 0x20, 0xcf, 0xff,
-    0xff, 0xfe, 0xff, 0xff, 0xff, 0xf3, 0x4, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x30, 0xb,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x0,
-    0xb, 0xff, 0xff, 0xfa, 0x9f, 0xff, 0xff, 0x10,
-    0x0, 0x7, 0xdf, 0xd6, 0xc, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff,
-    0x50, 0x0, 0xd7, 0x0, 0x0, 0x9f, 0xff, 0xff,
-    0xf0, 0x0, 0xd, 0xff, 0xbb, 0xef, 0xff, 0xff,
-    0xf7, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0xd, 0xff, 0xff, 0xff, 0xff,
-    0xfd, 0x10, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xff,
-    0xfa, 0x10, 0x0, 0x0, 0x1, 0x7a, 0xdf, 0xed,
-    0x93, 0x0, 0x0, 0x0,
-
+    0x0, 0xe7, 0xce, 0xfd, 0x81, 0x0, 0xfc, 0x7d,
+    0x6, 0x20, 0x4f, 0xca, 0x1, 0xe3, 0xc1, 0x0,
+    0xfa, 0x94, 0x3, 0xbc, 0x3, 0xfd, 0x44, 0x1,
+    0x31, 0x80, 0x62, 0x40, 0xe, 0x90, 0xa, 0xc0,
+    0x31, 0x6d, 0xb8, 0x6, 0x42, 0x2, 0x20, 0x6,
+    0xa0, 0x4, 0x0, 0x72, 0x83, 0x0, 0x71, 0x0,
+    0x48, 0x1, 0xb0, 0x3, 0xe1, 0x0, 0x8c, 0x3,
+    0x28, 0x30, 0x7, 0x18, 0x4, 0xa0, 0x18, 0x44,
+    0x40, 0x1d, 0x42, 0x12, 0x40, 0x1c, 0x60, 0x60,
+    0x18, 0xbb, 0x8c, 0x1, 0xe1, 0x8, 0x0, 0xf0,
+    0x80, 0x7f, 0x22, 0x0, 0x3f, 0xf8, 0x0, 0x20,
+    0xb, 0x40, 0xe, 0x56, 0x0, 0xe3, 0x0, 0xae,
+    0x8, 0xa, 0x69, 0x40, 0x30, 0x88, 0x3, 0x3e,
+    0xfe, 0xb1, 0x18, 0x6, 0x40, 0xf, 0xf4, 0x0,
+    0x77, 0x80, 0x5a, 0xe0, 0x1a, 0x54, 0x3, 0x94,
+    0x3, 0x47, 0xdd, 0xb9, 0x80, 0x3a, 0x0, 0x3e,
+    0x44, 0x8, 0x7, 0x1b, 0x80, 0x7f, 0xf0, 0x8b,
+    0x40, 0x3f, 0xf8, 0x4b, 0x82, 0x1, 0xd9, 0xa,
+    0x40, 0x24, 0xd9, 0x42, 0x1, 0x80,
     /* U+003A ":" */
-    0x4, 0xde, 0xa1, 0x2, 0xff, 0xff, 0xa0, 0x7f,
-    0xff, 0xff, 0x6, 0xff, 0xff, 0xe0, 0xd, 0xff,
-    0xf6, 0x0, 0x6, 0x83, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0x73, 0x0, 0xd, 0xff, 0xf6, 0x6, 0xff, 0xff,
-    0xe0, 0x7f, 0xff, 0xff, 0x2, 0xff, 0xff, 0xa0,
-    0x4, 0xdf, 0xa1, 0x0,
-
+    0x4, 0xde, 0xa1, 0x2, 0xb2, 0x15, 0xb0, 0x50,
+    0xc, 0xa0, 0x20, 0x18, 0x41, 0x88, 0x2, 0x80,
+    0x6, 0xcb, 0xe3, 0x0, 0x4d, 0x6, 0x1, 0xff,
+    0xd4, 0x67, 0x30, 0xb, 0x66, 0x31, 0x81, 0x88,
+    0x2, 0x80, 0x10, 0xc, 0x20, 0xa0, 0x19, 0x40,
+    0xac, 0x81, 0x6c, 0x0,
     /* U+003B ";" */
-    0x0, 0x78, 0x40, 0x0, 0xdf, 0xff, 0x60, 0x6f,
-    0xff, 0xfe, 0x7, 0xff, 0xff, 0xf0, 0x2f, 0xff,
-    0xfa, 0x0, 0x4d, 0xfa, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x36, 0x30, 0x0, 0xaf, 0xff,
-    0x80, 0x4f, 0xff, 0xff, 0x48, 0xff, 0xff, 0xf8,
-    0x7f, 0xff, 0xff, 0xa2, 0xff, 0xff, 0xf9, 0x4,
-    0xdf, 0xff, 0x70, 0x2, 0xff, 0xf3, 0x0, 0x4f,
-    0xfe, 0x0, 0x7, 0xff, 0x90, 0x0, 0xbf, 0xf2,
-    0x0, 0xf, 0xfb, 0x0, 0x5, 0xff, 0x40, 0x0,
-    0xaf, 0xd0, 0x0,
-
+    0x0, 0x3c, 0x20, 0x5, 0xb0, 0xf6, 0xc0, 0xc4,
+    0x1, 0x40, 0x8, 0x6, 0x10, 0x50, 0xc, 0xa0,
+    0x56, 0x40, 0xb6, 0x0, 0x4d, 0xfa, 0x10, 0xf,
+    0xfe, 0xd1, 0xb1, 0x80, 0x55, 0x93, 0x90, 0x8,
+    0xa0, 0x13, 0xa6, 0x0, 0x76, 0x78, 0x7, 0x12,
+    0x80, 0x71, 0x95, 0x90, 0x5, 0xc0, 0x9e, 0x1,
+    0x20, 0x1, 0x80, 0x2, 0x60, 0x3, 0x0, 0x38,
+    0x5, 0x80, 0xb, 0x0, 0x90, 0x10, 0x80, 0xa,
+    0x0, 0xf0, 0xb, 0xc0, 0x90, 0x0,
     /* U+003C "<" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x15, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x39, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6c, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0x8e, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xbf, 0xff, 0xff,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x17, 0xef, 0xff,
-    0xff, 0xff, 0xc6, 0x0, 0x0, 0x0, 0x4a, 0xff,
-    0xff, 0xff, 0xfe, 0x92, 0x0, 0x0, 0x1, 0x6d,
-    0xff, 0xff, 0xff, 0xfc, 0x60, 0x0, 0x0, 0x0,
-    0x8f, 0xff, 0xff, 0xff, 0xe9, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xff, 0xff, 0xc5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xfd, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff,
-    0xff, 0xfe, 0x82, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xdf, 0xff, 0xff, 0xff, 0xb5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xaf, 0xff, 0xff, 0xff,
-    0xe8, 0x20, 0x0, 0x0, 0x0, 0x0, 0x1, 0x7e,
-    0xff, 0xff, 0xff, 0xfc, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5b, 0xff, 0xff, 0xff, 0xfe, 0x92,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x29, 0xff, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xcf, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xaf, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x7a,
-
+    0x0, 0xff, 0xe3, 0xa, 0x80, 0x7f, 0xf1, 0xe,
+    0x7a, 0x40, 0x3f, 0xf8, 0x4d, 0x98, 0x60, 0xf,
+    0xfe, 0x0, 0x14, 0x74, 0x98, 0x7, 0xff, 0x0,
+    0x16, 0xf5, 0xc4, 0x3, 0xac, 0x3, 0xc2, 0xfd,
+    0x48, 0x1, 0xc7, 0x3e, 0xe0, 0x19, 0x2b, 0xa0,
+    0x40, 0x30, 0xb6, 0xe3, 0x0, 0x42, 0xdb, 0x6a,
+    0x1, 0xc7, 0x3d, 0x24, 0x1, 0xa3, 0xa4, 0x80,
+    0x30, 0xb6, 0xe3, 0x0, 0x7c, 0x80, 0x1c, 0x75,
+    0xd2, 0x40, 0x1f, 0xfc, 0x22, 0x95, 0x0, 0xff,
+    0xe2, 0x95, 0x74, 0x10, 0x7, 0xfb, 0x24, 0x80,
+    0x30, 0xbe, 0xda, 0x80, 0x7f, 0x36, 0xe2, 0x80,
+    0x72, 0x57, 0x41, 0x0, 0x7e, 0x3a, 0xe8, 0x10,
+    0xc, 0x2f, 0xb8, 0xa0, 0x1f, 0x85, 0xfa, 0x90,
+    0x3, 0x8e, 0xba, 0x48, 0x3, 0xf2, 0xde, 0xb0,
+    0x7, 0xb, 0x70, 0x7, 0xf8, 0xa7, 0xe4, 0xc0,
+    0x3f, 0xf8, 0xcd, 0x98, 0x50, 0xf, 0xfe, 0x31,
+    0xd7, 0x43, 0x0,
     /* U+003D "=" */
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfd, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfd, 0xcf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x79, 0x99,
-    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x97,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x79, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
-    0x99, 0x97, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfd, 0xcf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xcf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd,
-
+    0xcf, 0xff, 0xfe, 0x36, 0x80, 0x7f, 0xf7, 0x2d,
+    0x9b, 0xff, 0x8d, 0x4f, 0x33, 0xff, 0xc6, 0x70,
+    0xf, 0xff, 0x83, 0xcc, 0xff, 0xf1, 0x9e, 0xd9,
+    0xbf, 0xf8, 0xd4, 0x1, 0xff, 0xdc,
     /* U+003E ">" */
-    0x41, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0x93, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xc6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff,
-    0xff, 0xe9, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7e, 0xff, 0xff, 0xff, 0xfb, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5c, 0xff, 0xff, 0xff, 0xfe,
-    0x81, 0x0, 0x0, 0x0, 0x0, 0x0, 0x29, 0xef,
-    0xff, 0xff, 0xff, 0xa4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xcf, 0xff, 0xff, 0xff, 0xd7, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0x9e, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5c, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xdf, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x28, 0xef, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x5b, 0xff, 0xff, 0xff,
-    0xfd, 0x60, 0x0, 0x0, 0x2, 0x8e, 0xff, 0xff,
-    0xff, 0xfa, 0x40, 0x0, 0x0, 0x5, 0xcf, 0xff,
-    0xff, 0xff, 0xe7, 0x10, 0x0, 0x0, 0x28, 0xef,
-    0xff, 0xff, 0xff, 0xb5, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xff, 0xff, 0x92, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xff, 0xfd, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xfa, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa7, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
+    0x41, 0x0, 0xff, 0xe3, 0x47, 0x49, 0x80, 0x7f,
+    0xf1, 0x9b, 0x30, 0xc0, 0x1f, 0xfc, 0x63, 0x9e,
+    0x92, 0x0, 0xff, 0xac, 0x40, 0x30, 0xb6, 0xda,
+    0x80, 0x7f, 0x3f, 0x51, 0x80, 0x72, 0x57, 0x40,
+    0x80, 0x7e, 0x5c, 0xd6, 0x10, 0xc, 0x2f, 0xd4,
+    0x80, 0x1f, 0x8a, 0x7a, 0x8c, 0x3, 0x96, 0xf5,
+    0xc4, 0x3, 0xf2, 0xe6, 0xb0, 0x80, 0x62, 0x8e,
+    0x80, 0xf, 0xe2, 0x9e, 0xa3, 0x0, 0xe4, 0x0,
+    0xff, 0xcb, 0x24, 0x1, 0xff, 0xc3, 0x28, 0xea,
+    0x20, 0xf, 0xfe, 0x0, 0x2d, 0xeb, 0x88, 0x6,
+    0x29, 0xc0, 0xe, 0x28, 0xea, 0x40, 0xe, 0x5b,
+    0xd6, 0x0, 0xcb, 0x9a, 0xe2, 0x1, 0x86, 0x3a,
+    0x90, 0x2, 0x28, 0xea, 0x30, 0xe, 0x4a, 0xe7,
+    0x10, 0xe, 0xe7, 0x10, 0xe, 0x6d, 0xb5, 0x0,
+    0xff, 0xe0, 0x1, 0x4f, 0xc9, 0x0, 0x7f, 0xf0,
+    0x1, 0x73, 0x58, 0x3, 0xff, 0x80, 0xd, 0x1d,
+    0x46, 0x1, 0xff, 0xc3,
     /* U+003F "?" */
-    0x0, 0x27, 0xac, 0xef, 0xca, 0x60, 0x0, 0x0,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xd5, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x1, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x1f, 0xfe,
-    0xa8, 0x7a, 0xff, 0xff, 0xff, 0xa1, 0xd5, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x2,
-    0xef, 0xff, 0xff, 0x30, 0x0, 0x0, 0x3, 0xef,
-    0xff, 0xff, 0x60, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xff, 0x70, 0x0, 0x0, 0x1, 0xef, 0xff, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x55, 0x55, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4c, 0xe9, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xdf,
-    0xa1, 0x0, 0x0, 0x0,
-
+    0x0, 0x13, 0xd6, 0x77, 0xe5, 0x30, 0x7, 0x66,
+    0xc2, 0x98, 0x81, 0xac, 0xea, 0x80, 0x4, 0xc0,
+    0x3f, 0x8a, 0x94, 0x3, 0xff, 0x85, 0x46, 0x1,
+    0xa, 0xbc, 0x28, 0x7, 0xa4, 0xa, 0xba, 0xa1,
+    0xeb, 0x0, 0x39, 0xc7, 0x54, 0x3, 0x8c, 0x80,
+    0x3f, 0xf8, 0x0, 0x64, 0x1, 0x9c, 0x3, 0xe2,
+    0xd0, 0xe, 0x90, 0xf, 0x1e, 0x8, 0x6, 0x93,
+    0x0, 0xe3, 0xc1, 0x0, 0xd0, 0xc0, 0x1c, 0x3a,
+    0x1, 0xd4, 0xe0, 0x1e, 0x81, 0x0, 0xd6, 0xa0,
+    0x1f, 0x38, 0x6, 0x94, 0x0, 0xfc, 0x20, 0x10,
+    0xb0, 0x7, 0xe2, 0x0, 0xc8, 0x1, 0xfc, 0x55,
+    0x5a, 0x40, 0x3f, 0xca, 0xb8, 0xc0, 0x3f, 0xc9,
+    0x9d, 0x22, 0x1, 0xfc, 0x76, 0x62, 0xd4, 0x1,
+    0xfd, 0x40, 0x19, 0x4, 0x3, 0xf1, 0x80, 0x7f,
+    0xf0, 0xb8, 0x3, 0x18, 0x80, 0x7e, 0x4a, 0x20,
+    0x5d, 0x0, 0xf0,
     /* U+0040 "@" */
-    0x0, 0x0, 0x0, 0x0, 0x3, 0x8b, 0xde, 0xfe,
-    0xca, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x2, 0xcf, 0xff,
-    0xff, 0xcb, 0xab, 0xdf, 0xff, 0xfe, 0x40, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xa4, 0x0, 0x0,
-    0x0, 0x16, 0xdf, 0xff, 0x50, 0x0, 0x0, 0x3,
-    0xff, 0xfc, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xff, 0x30, 0x0, 0x0, 0xef, 0xf9, 0x0,
-    0x3, 0x8a, 0x83, 0x0, 0x33, 0x31, 0x6f, 0xfd,
-    0x0, 0x0, 0x9f, 0xfa, 0x0, 0x1b, 0xff, 0xff,
-    0xf9, 0x2f, 0xff, 0x40, 0x9f, 0xf6, 0x0, 0x2f,
-    0xfd, 0x0, 0x1d, 0xff, 0xff, 0xff, 0xfb, 0xff,
-    0xf2, 0x0, 0xef, 0xd0, 0x9, 0xff, 0x40, 0xa,
-    0xff, 0xf9, 0x21, 0x9f, 0xff, 0xff, 0x0, 0x8,
-    0xff, 0x20, 0xff, 0xc0, 0x3, 0xff, 0xfa, 0x0,
-    0x0, 0xdf, 0xff, 0xc0, 0x0, 0x3f, 0xf6, 0x4f,
-    0xf6, 0x0, 0xaf, 0xff, 0x10, 0x0, 0x8, 0xff,
-    0xfa, 0x0, 0x0, 0xff, 0x98, 0xff, 0x20, 0x1f,
-    0xff, 0xa0, 0x0, 0x0, 0x6f, 0xff, 0x70, 0x0,
-    0xf, 0xfa, 0xbf, 0xe0, 0x7, 0xff, 0xf5, 0x0,
-    0x0, 0x7, 0xff, 0xf4, 0x0, 0x0, 0xef, 0xbd,
-    0xfd, 0x0, 0xbf, 0xff, 0x20, 0x0, 0x0, 0x8f,
-    0xff, 0x20, 0x0, 0xf, 0xf9, 0xef, 0xb0, 0xd,
-    0xff, 0xf0, 0x0, 0x0, 0xa, 0xff, 0xf0, 0x0,
-    0x1, 0xff, 0x8e, 0xfb, 0x0, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0xdf, 0xfd, 0x0, 0x0, 0x5f, 0xf5,
-    0xdf, 0xc0, 0xf, 0xff, 0xa0, 0x0, 0x0, 0x2f,
-    0xff, 0xa0, 0x0, 0xc, 0xff, 0xc, 0xfd, 0x0,
-    0xdf, 0xfa, 0x0, 0x0, 0x6, 0xff, 0xf7, 0x0,
-    0x5, 0xff, 0xa0, 0xaf, 0xf0, 0xb, 0xff, 0xc0,
-    0x0, 0x0, 0xaf, 0xff, 0x50, 0x1, 0xdf, 0xf2,
-    0x7, 0xff, 0x40, 0x6f, 0xff, 0x0, 0x0, 0x1f,
-    0xff, 0xf2, 0x1, 0xcf, 0xf8, 0x0, 0x2f, 0xf9,
-    0x0, 0xef, 0xf8, 0x0, 0xb, 0xff, 0xff, 0x99,
-    0xff, 0xfa, 0x0, 0x0, 0xdf, 0xf1, 0x5, 0xff,
-    0xfc, 0x9d, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x0,
-    0x0, 0x5, 0xff, 0x90, 0x5, 0xff, 0xff, 0xfc,
-    0x2a, 0xff, 0xff, 0xd4, 0x0, 0x0, 0x0, 0xd,
-    0xff, 0x50, 0x1, 0x57, 0x63, 0x0, 0x5, 0x76,
-    0x30, 0x0, 0x44, 0x42, 0x0, 0x3f, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xdf,
-    0xfe, 0x10, 0x0, 0x5f, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xfe, 0x30, 0x0,
-    0x0, 0x6f, 0xff, 0xe7, 0x10, 0x0, 0x0, 0x1,
-    0x7d, 0xff, 0xfd, 0x20, 0x0, 0x0, 0x0, 0x3d,
-    0xff, 0xff, 0xdb, 0x99, 0xce, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xef, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x92, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x38, 0xcd, 0xff, 0xec,
-    0x95, 0x0, 0x0, 0x0, 0x0,
-
+    0x0, 0xfe, 0x38, 0xbd, 0xef, 0xec, 0xa5, 0x0,
+    0xff, 0xe1, 0xb6, 0xe3, 0xa1, 0x8, 0x9, 0xad,
+    0x7c, 0x88, 0x7, 0xf8, 0xb2, 0x48, 0x2, 0x34,
+    0x54, 0x20, 0x9, 0xbd, 0x0, 0x3f, 0x1e, 0x98,
+    0x1, 0x6f, 0xf2, 0xea, 0xf7, 0xa4, 0x80, 0x6d,
+    0x40, 0x3c, 0x78, 0x0, 0x3d, 0xa4, 0x0, 0xf0,
+    0xb6, 0xb8, 0x2, 0x8c, 0x3, 0xb4, 0x0, 0xd8,
+    0x40, 0x71, 0x50, 0x60, 0x3, 0x3a, 0x64, 0x0,
+    0xe0, 0xd, 0x22, 0xb, 0x20, 0x37, 0x8e, 0xaf,
+    0x92, 0x59, 0x92, 0xb3, 0x0, 0x98, 0x0, 0x4c,
+    0x5, 0x40, 0x38, 0x80, 0x1c, 0xd2, 0x1, 0x30,
+    0x48, 0x85, 0x80, 0x2c, 0x1, 0x20, 0xb, 0x20,
+    0x3, 0x6f, 0x30, 0x20, 0x4, 0x40, 0x6, 0x2,
+    0x20, 0x30, 0x1a, 0x1, 0xa8, 0x1, 0x64, 0x86,
+    0x48, 0x2, 0x30, 0xa, 0xc0, 0x8, 0x80, 0x5,
+    0x0, 0x24, 0x2, 0xb0, 0xc, 0xa0, 0x13, 0x0,
+    0x46, 0x0, 0xfc, 0x0, 0x20, 0xa, 0x80, 0x14,
+    0x40, 0x37, 0x0, 0x5a, 0x1, 0xe3, 0x30, 0x9,
+    0x3, 0x0, 0x5e, 0x1, 0xc2, 0x1, 0x18, 0x6,
+    0x10, 0x16, 0x3, 0x0, 0x60, 0x4, 0xe0, 0x1d,
+    0xe0, 0x13, 0x0, 0x61, 0x2, 0x30, 0x60, 0x3,
+    0x0, 0x44, 0x1, 0xc4, 0x1, 0x10, 0x4, 0x20,
+    0x1, 0x0, 0xe2, 0x0, 0x18, 0x7, 0x9c, 0x0,
+    0x40, 0x19, 0x0, 0x1a, 0x60, 0xe0, 0x1c, 0xc0,
+    0x1c, 0x44, 0x0, 0x38, 0x6, 0x90, 0x2, 0x88,
+    0x8, 0x0, 0x80, 0x3f, 0x20, 0x5, 0xa0, 0x12,
+    0x98, 0x28, 0x30, 0x10, 0x1, 0x80, 0xc, 0x1,
+    0xd8, 0x1, 0x10, 0x0, 0x60, 0x1, 0x1, 0xa0,
+    0x4, 0xd, 0x0, 0x18, 0x6, 0x15, 0x0, 0x9c,
+    0x7, 0x48, 0x1c, 0x81, 0x40, 0x1a, 0xc, 0x20,
+    0x8, 0x0, 0xa8, 0x3, 0x5c, 0xf1, 0x82, 0xc0,
+    0x0, 0x88, 0xc, 0x21, 0x60, 0x7, 0xc9, 0xd4,
+    0x0, 0xcc, 0xc0, 0x3, 0x50, 0x6, 0x80, 0x4,
+    0x2, 0xd0, 0x0, 0xd8, 0x8f, 0x54, 0x3, 0x15,
+    0xc8, 0x7, 0x29, 0x3, 0x28, 0x2f, 0x54, 0x4e,
+    0x60, 0xaa, 0x91, 0x39, 0xa8, 0x8, 0x91, 0x0,
+    0x38, 0x1, 0x48, 0x2, 0xae, 0xc6, 0x1, 0x2b,
+    0xb1, 0x81, 0x6d, 0xda, 0x8c, 0x0, 0x74, 0x0,
+    0xb8, 0x0, 0xff, 0xcd, 0xa4, 0x3, 0xa2, 0x1,
+    0x2c, 0x80, 0x1f, 0x9c, 0x40, 0x3c, 0x2f, 0xb2,
+    0x0, 0x2c, 0x30, 0xe, 0x6c, 0x20, 0x18, 0xed,
+    0xb9, 0x96, 0x77, 0x20, 0x80, 0xf, 0xa4, 0x1,
+    0xf1, 0xec, 0x88, 0x0, 0x91, 0x98, 0x62, 0x0,
+    0x16, 0xd8, 0x0, 0xff, 0x9b, 0xb1, 0xcc, 0x80,
+    0x2, 0x6d, 0x5d, 0x24, 0x1, 0xc0,
     /* U+0041 "A" */
-    0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0x9f,
-    0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff,
-    0xd6, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xfa, 0x3f, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xff, 0x70, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0xf4, 0xd, 0xff, 0xff,
-    0x40, 0x0, 0x0, 0xd, 0xff, 0xff, 0x10, 0xaf,
-    0xff, 0xf8, 0x0, 0x0, 0x1, 0xff, 0xff, 0xf0,
-    0x8, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x5f, 0xff,
-    0xfc, 0x0, 0x5f, 0xff, 0xff, 0x10, 0x0, 0x9,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x0,
-    0x0, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xa0, 0x0, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x0, 0x6, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf2, 0x0, 0xbf, 0xff, 0xfe,
-    0x55, 0x55, 0x9f, 0xff, 0xff, 0x60, 0xf, 0xff,
-    0xff, 0xa0, 0x0, 0x3, 0xff, 0xff, 0xfb, 0x3,
-    0xff, 0xff, 0xf7, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xf0, 0x7f, 0xff, 0xff, 0x40, 0x0, 0x0, 0xdf,
-    0xff, 0xff, 0x3c, 0xff, 0xff, 0xf1, 0x0, 0x0,
-    0xa, 0xff, 0xff, 0xf8,
-
+    0x0, 0xf4, 0xff, 0xf2, 0x80, 0x7f, 0xe7, 0x0,
+    0xec, 0x0, 0xff, 0x88, 0x40, 0x39, 0x0, 0x3f,
+    0xe4, 0x0, 0xf1, 0x10, 0x3, 0xfd, 0x80, 0x1f,
+    0x20, 0x7, 0xf9, 0x40, 0x3e, 0xc0, 0xf, 0xe3,
+    0x0, 0xfc, 0x80, 0x1f, 0xc8, 0x1, 0x98, 0x2,
+    0x13, 0x0, 0xfd, 0x60, 0x11, 0x78, 0x6, 0x40,
+    0xf, 0xc6, 0x1, 0x3a, 0x80, 0x6c, 0x0, 0xf9,
+    0x0, 0x36, 0x98, 0x6, 0x40, 0xf, 0xb0, 0x3,
+    0x18, 0x10, 0x6, 0x40, 0xf, 0x28, 0x6, 0x50,
+    0x70, 0xd, 0x80, 0x1c, 0x24, 0x1, 0x84, 0x8,
+    0x3, 0x28, 0x7, 0x20, 0x6, 0x30, 0x6, 0x80,
+    0x62, 0x10, 0xd, 0x80, 0x18, 0xff, 0xd4, 0x1,
+    0xc8, 0x1, 0x9c, 0x3, 0xff, 0x80, 0x1e, 0x1,
+    0x10, 0x80, 0x7f, 0xf0, 0x1, 0x0, 0x24, 0x0,
+    0xff, 0xe1, 0x9, 0x0, 0x34, 0x3, 0xd, 0x56,
+    0x60, 0xe, 0x40, 0x2, 0x0, 0x64, 0x55, 0xd4,
+    0x1, 0xda, 0x6, 0x1, 0xda, 0x1, 0x8c, 0x3,
+    0x90, 0x10, 0x3, 0x8c, 0x3, 0x88, 0x3, 0x8e,
+    0xc0, 0x39, 0x40, 0x39, 0xc0, 0x3a, 0xc0,
     /* U+0042 "B" */
-    0x5f, 0xff, 0xff, 0xff, 0xff, 0xda, 0x30, 0x0,
-    0x0, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
-    0x0, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf1, 0x0, 0x5f, 0xff, 0xff, 0xdc,
-    0xef, 0xff, 0xff, 0xf5, 0x0, 0x5f, 0xff, 0xff,
-    0x50, 0xb, 0xff, 0xff, 0xf7, 0x0, 0x5f, 0xff,
-    0xff, 0x50, 0x5, 0xff, 0xff, 0xf5, 0x0, 0x5f,
-    0xff, 0xff, 0x50, 0x7, 0xff, 0xff, 0xf1, 0x0,
-    0x5f, 0xff, 0xff, 0x51, 0x5f, 0xff, 0xff, 0x90,
-    0x0, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb,
-    0x0, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xfd,
-    0x50, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xd7, 0x10, 0x0, 0x5f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf4, 0x0, 0x5f, 0xff, 0xff,
-    0xb8, 0x9d, 0xff, 0xff, 0xff, 0x30, 0x5f, 0xff,
-    0xff, 0x50, 0x0, 0x7f, 0xff, 0xff, 0xa0, 0x5f,
-    0xff, 0xff, 0x50, 0x0, 0xd, 0xff, 0xff, 0xf0,
-    0x5f, 0xff, 0xff, 0x50, 0x0, 0xb, 0xff, 0xff,
-    0xf2, 0x5f, 0xff, 0xff, 0x50, 0x0, 0xe, 0xff,
-    0xff, 0xf2, 0x5f, 0xff, 0xff, 0x50, 0x1, 0xaf,
-    0xff, 0xff, 0xf0, 0x5f, 0xff, 0xff, 0xdb, 0xcf,
-    0xff, 0xff, 0xff, 0xb0, 0x5f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x30, 0x5f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x5f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfd, 0x50, 0x0, 0x5f,
-    0xff, 0xff, 0xff, 0xfd, 0xb9, 0x40, 0x0, 0x0,
-
+    0x5f, 0xff, 0xed, 0xa3, 0x0, 0xff, 0xe1, 0x92,
+    0xe5, 0x0, 0x7f, 0xf1, 0x56, 0x0, 0x3f, 0xf8,
+    0xae, 0x20, 0x1f, 0x88, 0xc4, 0x3, 0xc8, 0x1,
+    0xfa, 0x33, 0x90, 0x3, 0x88, 0x3, 0xfe, 0xe0,
+    0xe, 0x20, 0xf, 0xf8, 0x80, 0x39, 0x0, 0x3f,
+    0x85, 0x60, 0x3, 0x30, 0x80, 0x7e, 0xae, 0xa0,
+    0xc, 0x92, 0x1, 0xff, 0xc2, 0x2a, 0xb0, 0xf,
+    0xfe, 0x19, 0x43, 0x88, 0x7, 0xff, 0xc, 0xa3,
+    0x90, 0x3, 0xf2, 0x3b, 0x10, 0x7, 0x59, 0x80,
+    0x7d, 0xd1, 0x3b, 0x0, 0x1d, 0x20, 0x1f, 0xf3,
+    0x90, 0x6, 0x50, 0xf, 0xfc, 0xc0, 0x1c, 0x40,
+    0x1f, 0xf2, 0x80, 0x7f, 0xf0, 0xc6, 0x84, 0x3,
+    0x88, 0x3, 0xd1, 0x79, 0xca, 0x1, 0xc8, 0x1,
+    0xf1, 0x21, 0x80, 0x7d, 0x0, 0x1f, 0xfc, 0x48,
+    0x30, 0xf, 0xfe, 0x11, 0x53, 0x80, 0x7f, 0xc4,
+    0x8d, 0x7a, 0xa0, 0x10,
     /* U+0043 "C" */
-    0x0, 0x0, 0x0, 0x3a, 0xdf, 0xec, 0x82, 0x0,
-    0x0, 0x1b, 0xff, 0xff, 0xff, 0xfa, 0x0, 0x1,
-    0xef, 0xff, 0xff, 0xff, 0xfa, 0x0, 0xd, 0xff,
-    0xff, 0xff, 0xff, 0xfa, 0x0, 0x8f, 0xff, 0xff,
-    0xff, 0xff, 0xfa, 0x1, 0xff, 0xff, 0xff, 0xd5,
-    0x24, 0x9a, 0x7, 0xff, 0xff, 0xfd, 0x0, 0x0,
-    0x1, 0xc, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x5f, 0xff,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0xd, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xff, 0xfe, 0x20, 0x0, 0x2, 0x2, 0xff,
-    0xff, 0xff, 0xe7, 0x46, 0xba, 0x0, 0x9f, 0xff,
-    0xff, 0xff, 0xff, 0xfa, 0x0, 0x1e, 0xff, 0xff,
-    0xff, 0xff, 0xfa, 0x0, 0x3, 0xff, 0xff, 0xff,
-    0xff, 0xfa, 0x0, 0x0, 0x2c, 0xff, 0xff, 0xff,
-    0xfa, 0x0, 0x0, 0x0, 0x5b, 0xdf, 0xdb, 0x71,
-
+    0x0, 0xf1, 0xd6, 0xff, 0x64, 0x10, 0x6, 0x1b,
+    0xc5, 0x20, 0x13, 0x78, 0x0, 0x87, 0xd0, 0x3,
+    0xfe, 0xc1, 0x0, 0xff, 0xa0, 0x80, 0x3f, 0xe1,
+    0x70, 0xe, 0x2a, 0xdb, 0x60, 0x3, 0x0, 0x71,
+    0x6a, 0x92, 0x4d, 0x85, 0x80, 0x74, 0x80, 0x70,
+    0x81, 0x80, 0x61, 0x40, 0xf, 0x18, 0x7, 0x28,
+    0x7, 0xcc, 0x1, 0xd8, 0x1, 0xf1, 0x80, 0x70,
+    0x80, 0x7f, 0xf2, 0x4c, 0x3, 0xb8, 0x3, 0xe1,
+    0x0, 0xe1, 0x0, 0xf9, 0x40, 0x39, 0xc0, 0x3e,
+    0x12, 0x0, 0xc2, 0x80, 0x1f, 0x28, 0x7, 0x51,
+    0x0, 0x62, 0xa, 0x0, 0xe1, 0xc7, 0x46, 0xb8,
+    0x2, 0x60, 0xe, 0x18, 0xb9, 0x40, 0xa, 0x4,
+    0x3, 0xff, 0xe, 0x80, 0x7f, 0xf0, 0x0, 0xf4,
+    0xc0, 0x3f, 0xf1, 0x65, 0x21, 0x1, 0x24, 0x58,
     /* U+0044 "D" */
-    0x7f, 0xff, 0xff, 0xff, 0xed, 0xa4, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x20,
-    0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x30, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x10, 0x7f, 0xff, 0xff, 0xdd, 0xff, 0xff,
-    0xff, 0xf8, 0x7, 0xff, 0xff, 0xf4, 0x1, 0xcf,
-    0xff, 0xff, 0xf0, 0x7f, 0xff, 0xff, 0x40, 0x2,
-    0xff, 0xff, 0xff, 0x47, 0xff, 0xff, 0xf4, 0x0,
-    0x8, 0xff, 0xff, 0xf8, 0x7f, 0xff, 0xff, 0x40,
-    0x0, 0x4f, 0xff, 0xff, 0xa7, 0xff, 0xff, 0xf4,
-    0x0, 0x0, 0xff, 0xff, 0xfb, 0x7f, 0xff, 0xff,
-    0x40, 0x0, 0xf, 0xff, 0xff, 0xd7, 0xff, 0xff,
-    0xf4, 0x0, 0x0, 0xef, 0xff, 0xff, 0x7f, 0xff,
-    0xff, 0x40, 0x0, 0xf, 0xff, 0xff, 0xe7, 0xff,
-    0xff, 0xf4, 0x0, 0x0, 0xff, 0xff, 0xfe, 0x7f,
-    0xff, 0xff, 0x40, 0x0, 0x2f, 0xff, 0xff, 0xc7,
-    0xff, 0xff, 0xf4, 0x0, 0x5, 0xff, 0xff, 0xf9,
-    0x7f, 0xff, 0xff, 0x40, 0x0, 0xaf, 0xff, 0xff,
-    0x57, 0xff, 0xff, 0xf4, 0x0, 0x2f, 0xff, 0xff,
-    0xf1, 0x7f, 0xff, 0xff, 0x40, 0x3d, 0xff, 0xff,
-    0xfa, 0x7, 0xff, 0xff, 0xfd, 0xef, 0xff, 0xff,
-    0xff, 0x20, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x70, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x90, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x60, 0x0, 0x7, 0xff, 0xff, 0xff, 0xed,
-    0xb6, 0x0, 0x0, 0x0,
-
+    0x7f, 0xff, 0xbb, 0x69, 0x0, 0x3f, 0xf8, 0x0,
+    0x24, 0xb7, 0x84, 0x1, 0xff, 0xc3, 0x3d, 0x30,
+    0xf, 0xfe, 0x26, 0x88, 0x7, 0xc4, 0x40, 0xf,
+    0xc, 0x80, 0x7d, 0x3b, 0xc6, 0x1, 0xce, 0x1,
+    0xfc, 0x3c, 0x1, 0xe4, 0x0, 0xfe, 0x27, 0x0,
+    0xec, 0x0, 0xff, 0x60, 0x7, 0x10, 0x7, 0xf9,
+    0x0, 0x38, 0x40, 0x3f, 0xf8, 0x8c, 0x1, 0xff,
+    0x8, 0x6, 0x20, 0xf, 0xf8, 0x40, 0x30, 0x80,
+    0x7f, 0xf3, 0xc8, 0x3, 0x88, 0x3, 0xfc, 0xe0,
+    0x1c, 0xa0, 0x1f, 0xef, 0x0, 0xec, 0x0, 0xfe,
+    0x25, 0x0, 0xe4, 0x0, 0xfc, 0x7e, 0x1, 0xca,
+    0x20, 0x1e, 0x9e, 0xc2, 0x0, 0xe8, 0x0, 0xf8,
+    0x84, 0x3, 0xd0, 0x40, 0x1f, 0xfc, 0x26, 0x70,
+    0xf, 0xfe, 0x0, 0xc, 0xc8, 0x3, 0xfc, 0x24,
+    0x93, 0xcc, 0x1, 0x80,
     /* U+0045 "E" */
-    0x6f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x86,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x6f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x86, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x6f, 0xff,
-    0xff, 0xfe, 0xee, 0xee, 0xee, 0x86, 0xff, 0xff,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf0, 0x6f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x6, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x6, 0xff, 0xff, 0xfd, 0xbb, 0xbb, 0xbb,
-    0xb0, 0x6f, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x6, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x6, 0xff,
-    0xff, 0xff, 0xee, 0xee, 0xee, 0xe8, 0x6f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x86, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf8, 0x6f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x86, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf8,
-
+    0x6f, 0xff, 0xfe, 0x7, 0xc0, 0x7, 0xff, 0xa0,
+    0x47, 0xe0, 0xf, 0xaf, 0xbb, 0xe8, 0x0, 0xff,
+    0xf3, 0xdf, 0xff, 0xc0, 0x1f, 0xfe, 0x82, 0x44,
+    0xf8, 0x3, 0xe9, 0xbb, 0xf8, 0x3, 0xff, 0xef,
+    0x7d, 0xdf, 0x40, 0x7, 0xc2, 0x3f, 0x0, 0x7f,
+    0xf8, 0x80,
     /* U+0046 "F" */
-    0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x45,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x5f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x45, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x5f, 0xff,
-    0xff, 0xfe, 0xee, 0xee, 0xee, 0x35, 0xff, 0xff,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfa, 0x5, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xa0, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfa, 0x5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xa0, 0x5f, 0xff, 0xff, 0xdb, 0xbb, 0xbb, 0xb7,
-    0x5, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x0,
-
+    0x5f, 0xff, 0xfe, 0x7, 0xa0, 0x7, 0xff, 0xa0,
+    0x47, 0xe7, 0x0, 0xf5, 0x77, 0x7c, 0x60, 0x1f,
+    0xff, 0x6a, 0xff, 0xf5, 0x0, 0x7f, 0xfa, 0x9,
+    0x13, 0xda, 0x1, 0xf4, 0x5d, 0xf9, 0xc0, 0x3f,
+    0xff, 0xe0, 0x1f, 0xfe, 0x20,
     /* U+0047 "G" */
-    0x0, 0x0, 0x0, 0x6b, 0xdf, 0xec, 0x93, 0x0,
-    0x0, 0x0, 0x5e, 0xff, 0xff, 0xff, 0xff, 0x90,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,
-    0x0, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,
-    0x0, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,
-    0x7, 0xff, 0xff, 0xff, 0xa3, 0x2, 0x5c, 0xc0,
-    0xd, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x30,
-    0x2f, 0xff, 0xff, 0xe1, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xff, 0xff, 0x10, 0x36, 0x66, 0x66, 0x64,
-    0xbf, 0xff, 0xff, 0x0, 0x8f, 0xff, 0xff, 0xfa,
-    0xbf, 0xff, 0xff, 0x0, 0x8f, 0xff, 0xff, 0xfa,
-    0xaf, 0xff, 0xff, 0x0, 0x8f, 0xff, 0xff, 0xfa,
-    0x9f, 0xff, 0xff, 0x20, 0x8f, 0xff, 0xff, 0xfa,
-    0x7f, 0xff, 0xff, 0x50, 0x0, 0xaf, 0xff, 0xfa,
-    0x4f, 0xff, 0xff, 0x80, 0x0, 0xaf, 0xff, 0xfa,
-    0xf, 0xff, 0xff, 0xe0, 0x0, 0xbf, 0xff, 0xfa,
-    0xb, 0xff, 0xff, 0xf9, 0x1, 0xff, 0xff, 0xfa,
-    0x4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
-    0x0, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
-    0x0, 0x2e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
-    0x0, 0x3, 0xef, 0xff, 0xff, 0xe4, 0xff, 0xfa,
-    0x0, 0x0, 0x17, 0xdf, 0xe9, 0x10, 0x7f, 0xfa,
-
+    0x0, 0xf3, 0x5e, 0xff, 0x64, 0x98, 0x7, 0x97,
+    0xa5, 0x8, 0x4, 0xdb, 0x24, 0x3, 0x3d, 0x8,
+    0x7, 0xe5, 0x0, 0x96, 0x0, 0x3f, 0xf8, 0x56,
+    0x1, 0xff, 0xc2, 0x71, 0x0, 0xe5, 0xcf, 0xda,
+    0x30, 0xa, 0x80, 0x39, 0x68, 0xc0, 0x97, 0x3c,
+    0x8, 0x80, 0x18, 0x6c, 0x3, 0xc6, 0xe, 0x1,
+    0xcc, 0x20, 0x1f, 0xb4, 0x3, 0xb0, 0x3, 0xf8,
+    0x80, 0x39, 0x40, 0xd9, 0xbc, 0x82, 0x1, 0xc2,
+    0x17, 0x33, 0xee, 0x0, 0xff, 0xe2, 0x8, 0x7,
+    0xff, 0xc, 0xc0, 0x38, 0x80, 0x3f, 0xb8, 0x3,
+    0x9c, 0x23, 0xd4, 0x3, 0x8c, 0x3, 0xb4, 0x3,
+    0xf9, 0x0, 0x39, 0x80, 0x21, 0x0, 0xf2, 0x0,
+    0x61, 0x90, 0x14, 0x0, 0xf7, 0x80, 0x73, 0x7f,
+    0x0, 0x7c, 0x88, 0x0, 0xff, 0xe1, 0xc8, 0x80,
+    0x7f, 0xf0, 0x8b, 0x44, 0x3, 0x86, 0xc0, 0x3e,
+    0x3f, 0x82, 0x1, 0x6f, 0x48, 0x0, 0x80,
     /* U+0048 "H" */
-    0x3f, 0xff, 0xff, 0x80, 0x0, 0xf, 0xff, 0xff,
-    0xb3, 0xff, 0xff, 0xf8, 0x0, 0x0, 0xff, 0xff,
-    0xfb, 0x3f, 0xff, 0xff, 0x80, 0x0, 0xf, 0xff,
-    0xff, 0xb3, 0xff, 0xff, 0xf8, 0x0, 0x0, 0xff,
-    0xff, 0xfb, 0x3f, 0xff, 0xff, 0x80, 0x0, 0xf,
-    0xff, 0xff, 0xb3, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0xff, 0xff, 0xfb, 0x3f, 0xff, 0xff, 0x80, 0x0,
-    0xf, 0xff, 0xff, 0xb3, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0xff, 0xff, 0xfb, 0x3f, 0xff, 0xff, 0x80,
-    0x0, 0xf, 0xff, 0xff, 0xb3, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfb, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xb3, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb3, 0xff,
-    0xff, 0xfe, 0xbb, 0xbb, 0xff, 0xff, 0xfb, 0x3f,
-    0xff, 0xff, 0x80, 0x0, 0xf, 0xff, 0xff, 0xb3,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0xff, 0xff, 0xfb,
-    0x3f, 0xff, 0xff, 0x80, 0x0, 0xf, 0xff, 0xff,
-    0xb3, 0xff, 0xff, 0xf8, 0x0, 0x0, 0xff, 0xff,
-    0xfb, 0x3f, 0xff, 0xff, 0x80, 0x0, 0xf, 0xff,
-    0xff, 0xb3, 0xff, 0xff, 0xf8, 0x0, 0x0, 0xff,
-    0xff, 0xfb, 0x3f, 0xff, 0xff, 0x80, 0x0, 0xf,
-    0xff, 0xff, 0xb3, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0xff, 0xff, 0xfb, 0x3f, 0xff, 0xff, 0x80, 0x0,
-    0xf, 0xff, 0xff, 0xb3, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0xff, 0xff, 0xfb,
-
+    0x3f, 0xfe, 0x80, 0xd, 0xff, 0xd6, 0x1, 0xff,
+    0xff, 0x0, 0xff, 0xfb, 0xbf, 0xfe, 0x0, 0xff,
+    0xf9, 0x8a, 0x26, 0x0, 0xff, 0xcd, 0x77, 0x80,
+    0x3f, 0xff, 0xe0, 0x1f, 0xff, 0xf0, 0xf, 0xe0,
     /* U+0049 "I" */
-    0x3f, 0xff, 0xff, 0x83, 0xff, 0xff, 0xf8, 0x3f,
-    0xff, 0xff, 0x83, 0xff, 0xff, 0xf8, 0x3f, 0xff,
-    0xff, 0x83, 0xff, 0xff, 0xf8, 0x3f, 0xff, 0xff,
-    0x83, 0xff, 0xff, 0xf8, 0x3f, 0xff, 0xff, 0x83,
-    0xff, 0xff, 0xf8, 0x3f, 0xff, 0xff, 0x83, 0xff,
-    0xff, 0xf8, 0x3f, 0xff, 0xff, 0x83, 0xff, 0xff,
-    0xf8, 0x3f, 0xff, 0xff, 0x83, 0xff, 0xff, 0xf8,
-    0x3f, 0xff, 0xff, 0x83, 0xff, 0xff, 0xf8, 0x3f,
-    0xff, 0xff, 0x83, 0xff, 0xff, 0xf8, 0x3f, 0xff,
-    0xff, 0x83, 0xff, 0xff, 0xf8, 0x3f, 0xff, 0xff,
-    0x83, 0xff, 0xff, 0xf8,
-
+    0x3f, 0xfe, 0x80, 0xf, 0xff, 0xf8, 0x7, 0xff,
+    0xfc, 0x3, 0xfe,
     /* U+004A "J" */
-    0x0, 0x2f, 0xff, 0xff, 0xa0, 0x2, 0xff, 0xff,
-    0xfa, 0x0, 0x2f, 0xff, 0xff, 0xa0, 0x2, 0xff,
-    0xff, 0xfa, 0x0, 0x2f, 0xff, 0xff, 0xa0, 0x2,
-    0xff, 0xff, 0xfa, 0x0, 0x2f, 0xff, 0xff, 0xa0,
-    0x2, 0xff, 0xff, 0xfa, 0x0, 0x2f, 0xff, 0xff,
-    0xa0, 0x2, 0xff, 0xff, 0xfa, 0x0, 0x2f, 0xff,
-    0xff, 0xa0, 0x2, 0xff, 0xff, 0xfa, 0x0, 0x2f,
-    0xff, 0xff, 0xa0, 0x2, 0xff, 0xff, 0xfa, 0x0,
-    0x2f, 0xff, 0xff, 0xa0, 0x2, 0xff, 0xff, 0xfa,
-    0x0, 0x2f, 0xff, 0xff, 0xa0, 0x3, 0xff, 0xff,
-    0xfa, 0x0, 0x7f, 0xff, 0xff, 0x99, 0xef, 0xff,
-    0xff, 0xf8, 0x9f, 0xff, 0xff, 0xff, 0x49, 0xff,
-    0xff, 0xff, 0xd0, 0x9f, 0xff, 0xff, 0xf4, 0x6,
-    0xdf, 0xfd, 0xa2, 0x0,
-
+    0x0, 0x17, 0xff, 0x50, 0x7, 0xff, 0xfc, 0x3,
+    0xff, 0xf6, 0x20, 0x1f, 0x90, 0x3, 0x8e, 0x7a,
+    0x0, 0x38, 0x40, 0x40, 0x3d, 0x80, 0x1f, 0x12,
+    0x0, 0x7d, 0x21, 0xe4, 0x0, 0x25, 0xd4, 0x0,
     /* U+004B "K" */
-    0x6f, 0xff, 0xff, 0x40, 0x0, 0xaf, 0xff, 0xfe,
-    0x16, 0xff, 0xff, 0xf4, 0x0, 0x2f, 0xff, 0xff,
-    0x60, 0x6f, 0xff, 0xff, 0x40, 0xa, 0xff, 0xff,
-    0xc0, 0x6, 0xff, 0xff, 0xf4, 0x2, 0xff, 0xff,
-    0xf3, 0x0, 0x6f, 0xff, 0xff, 0x40, 0x9f, 0xff,
-    0xfa, 0x0, 0x6, 0xff, 0xff, 0xf4, 0x1f, 0xff,
-    0xff, 0x10, 0x0, 0x6f, 0xff, 0xff, 0x49, 0xff,
-    0xff, 0x70, 0x0, 0x6, 0xff, 0xff, 0xf6, 0xff,
-    0xff, 0xd0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xdf,
-    0xff, 0xf9, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x6f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x40, 0x0, 0x6, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x6f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x6, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0x0, 0x6f,
-    0xff, 0xff, 0xfe, 0xff, 0xff, 0xfb, 0x0, 0x6,
-    0xff, 0xff, 0xff, 0x3e, 0xff, 0xff, 0xf1, 0x0,
-    0x6f, 0xff, 0xff, 0xa0, 0x9f, 0xff, 0xff, 0x60,
-    0x6, 0xff, 0xff, 0xf5, 0x4, 0xff, 0xff, 0xfb,
-    0x0, 0x6f, 0xff, 0xff, 0x40, 0xf, 0xff, 0xff,
-    0xf1, 0x6, 0xff, 0xff, 0xf4, 0x0, 0xbf, 0xff,
-    0xff, 0x60, 0x6f, 0xff, 0xff, 0x40, 0x6, 0xff,
-    0xff, 0xfc, 0x6, 0xff, 0xff, 0xf4, 0x0, 0x2f,
-    0xff, 0xff, 0xf2, 0x6f, 0xff, 0xff, 0x40, 0x0,
-    0xdf, 0xff, 0xff, 0x76, 0xff, 0xff, 0xf4, 0x0,
-    0x8, 0xff, 0xff, 0xfd,
-
+    0x6f, 0xfe, 0x40, 0xa, 0xbf, 0xf7, 0x8, 0x7,
+    0xf1, 0x28, 0x6, 0x81, 0x0, 0xfe, 0x80, 0xc,
+    0x6c, 0x1, 0xfc, 0x4a, 0x1, 0xbc, 0x3, 0xfd,
+    0x60, 0x19, 0x4c, 0x3, 0xf8, 0x58, 0x3, 0x58,
+    0x7, 0xfa, 0x0, 0x34, 0x8, 0x7, 0xf1, 0x30,
+    0x4, 0x4e, 0x1, 0xfe, 0xb0, 0xc, 0x80, 0x1f,
+    0xf1, 0x0, 0x67, 0x0, 0xff, 0xe2, 0xa, 0x0,
+    0x7f, 0xf1, 0x38, 0x3, 0xff, 0x88, 0xa0, 0x1f,
+    0xfc, 0x55, 0x0, 0xff, 0x8, 0x7, 0x70, 0x7,
+    0xfb, 0x44, 0x3, 0x20, 0x80, 0x7e, 0x53, 0x70,
+    0xe, 0x70, 0xf, 0xde, 0x1a, 0x1, 0xda, 0x1,
+    0xf8, 0x41, 0x0, 0x39, 0x4, 0x3, 0xfc, 0x80,
+    0x1c, 0xe0, 0x1f, 0xed, 0x0, 0xea, 0x0, 0xff,
+    0x20, 0x7, 0x19, 0x0, 0x7f, 0x11, 0x0, 0x39,
+    0x40, 0x3f, 0xca, 0x1, 0xd4,
     /* U+004C "L" */
-    0x5f, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0x50, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x5f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x45, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf4, 0x5f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x45, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf4,
-
+    0x5f, 0xfe, 0x50, 0xf, 0xff, 0xf8, 0x7, 0xff,
+    0xfc, 0x3, 0xff, 0xfe, 0x1, 0xff, 0xef, 0xaf,
+    0xff, 0x90, 0x3, 0xff, 0xe0,
     /* U+004D "M" */
-    0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x5, 0xff,
-    0xff, 0xff, 0x14, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0xbf, 0xff, 0xff, 0xf1, 0x4f, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0x14,
-    0xff, 0xff, 0xff, 0xf4, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0xf1, 0x4f, 0xff, 0xff, 0xff, 0xa0, 0x0,
-    0xdf, 0xff, 0xff, 0xff, 0x14, 0xff, 0xff, 0xff,
-    0xff, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xf1, 0x4f,
-    0xff, 0xff, 0xff, 0xf6, 0x9, 0xff, 0xff, 0xff,
-    0xff, 0x14, 0xff, 0xff, 0xff, 0xff, 0xb0, 0xef,
-    0xff, 0xff, 0xff, 0xf1, 0x4f, 0xff, 0xff, 0x9f,
-    0xff, 0x6f, 0xff, 0x9f, 0xff, 0xff, 0x14, 0xff,
-    0xff, 0xf4, 0xff, 0xff, 0xff, 0xf5, 0xff, 0xff,
-    0xf1, 0x4f, 0xff, 0xff, 0x2d, 0xff, 0xff, 0xfc,
-    0x5f, 0xff, 0xff, 0x14, 0xff, 0xff, 0xf3, 0x8f,
-    0xff, 0xff, 0x76, 0xff, 0xff, 0xf1, 0x4f, 0xff,
-    0xff, 0x43, 0xff, 0xff, 0xf1, 0x7f, 0xff, 0xff,
-    0x14, 0xff, 0xff, 0xf4, 0xe, 0xff, 0xfb, 0x7,
-    0xff, 0xff, 0xf1, 0x4f, 0xff, 0xff, 0x40, 0x8f,
-    0xff, 0x60, 0x7f, 0xff, 0xff, 0x14, 0xff, 0xff,
-    0xf4, 0x2, 0xff, 0xf0, 0x7, 0xff, 0xff, 0xf1,
-    0x4f, 0xff, 0xff, 0x40, 0xd, 0xfa, 0x0, 0x7f,
-    0xff, 0xff, 0x14, 0xff, 0xff, 0xf4, 0x0, 0x7f,
-    0x40, 0x7, 0xff, 0xff, 0xf1, 0x4f, 0xff, 0xff,
-    0x40, 0x1, 0xe0, 0x0, 0x7f, 0xff, 0xff, 0x14,
-    0xff, 0xff, 0xf4, 0x0, 0x4, 0x0, 0x7, 0xff,
-    0xff, 0xf1, 0x4f, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0x14, 0xff, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xf1, 0x4f,
-    0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0x14, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xf1,
-
+    0x4f, 0xff, 0x10, 0x7, 0x2f, 0xff, 0x84, 0x3,
+    0xea, 0x0, 0xee, 0x0, 0xff, 0xe1, 0x30, 0x6,
+    0x14, 0x0, 0xff, 0xe1, 0xa, 0x0, 0x4c, 0x1,
+    0xff, 0xc4, 0xe0, 0xa, 0x80, 0x3f, 0xf8, 0x8a,
+    0x0, 0x32, 0x0, 0xff, 0xe2, 0xb0, 0x50, 0x7,
+    0xff, 0x1b, 0x41, 0xc0, 0x3f, 0xf8, 0x6c, 0x0,
+    0x46, 0x10, 0x3, 0x0, 0x7f, 0xed, 0x0, 0xa4,
+    0x2, 0xc0, 0xf, 0xfc, 0xc4, 0x1, 0xc6, 0x1,
+    0xff, 0xc0, 0x1, 0x50, 0xe, 0xb3, 0x0, 0xff,
+    0xcf, 0x60, 0x1c, 0xc2, 0x1, 0xff, 0xc0, 0x3,
+    0x10, 0x9, 0x4, 0x3, 0xff, 0x86, 0xc0, 0x16,
+    0x80, 0x7f, 0xf1, 0x28, 0x2, 0x60, 0xf, 0xfe,
+    0x21, 0x10, 0x14, 0x3, 0xff, 0x8d, 0x41, 0xc0,
+    0x1f, 0xfc, 0x66, 0x14, 0x0, 0xff, 0xe3, 0xd,
+    0x0, 0x7f, 0xf2, 0x10, 0x3, 0xff, 0xfa,
     /* U+004E "N" */
-    0x4f, 0xff, 0xff, 0xa0, 0x0, 0xa, 0xff, 0xff,
-    0xc4, 0xff, 0xff, 0xff, 0x10, 0x0, 0xaf, 0xff,
-    0xfc, 0x4f, 0xff, 0xff, 0xf6, 0x0, 0xa, 0xff,
-    0xff, 0xc4, 0xff, 0xff, 0xff, 0xc0, 0x0, 0xaf,
-    0xff, 0xfc, 0x4f, 0xff, 0xff, 0xff, 0x20, 0xa,
-    0xff, 0xff, 0xc4, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0xaf, 0xff, 0xfc, 0x4f, 0xff, 0xff, 0xff, 0xe0,
-    0xa, 0xff, 0xff, 0xc4, 0xff, 0xff, 0xff, 0xff,
-    0x40, 0xaf, 0xff, 0xfc, 0x4f, 0xff, 0xff, 0xff,
-    0xf9, 0xa, 0xff, 0xff, 0xc4, 0xff, 0xff, 0xff,
-    0xff, 0xe0, 0xaf, 0xff, 0xfc, 0x4f, 0xff, 0xff,
-    0xcf, 0xff, 0x49, 0xff, 0xff, 0xc4, 0xff, 0xff,
-    0xf6, 0xff, 0xf9, 0x9f, 0xff, 0xfc, 0x4f, 0xff,
-    0xff, 0x2f, 0xff, 0xe8, 0xff, 0xff, 0xc4, 0xff,
-    0xff, 0xf2, 0xbf, 0xff, 0xef, 0xff, 0xfc, 0x4f,
-    0xff, 0xff, 0x26, 0xff, 0xff, 0xff, 0xff, 0xc4,
-    0xff, 0xff, 0xf2, 0x1f, 0xff, 0xff, 0xff, 0xfc,
-    0x4f, 0xff, 0xff, 0x20, 0xbf, 0xff, 0xff, 0xff,
-    0xc4, 0xff, 0xff, 0xf2, 0x5, 0xff, 0xff, 0xff,
-    0xfc, 0x4f, 0xff, 0xff, 0x20, 0xf, 0xff, 0xff,
-    0xff, 0xc4, 0xff, 0xff, 0xf2, 0x0, 0x9f, 0xff,
-    0xff, 0xfc, 0x4f, 0xff, 0xff, 0x20, 0x3, 0xff,
-    0xff, 0xff, 0xc4, 0xff, 0xff, 0xf2, 0x0, 0xe,
-    0xff, 0xff, 0xfc, 0x4f, 0xff, 0xff, 0x20, 0x0,
-    0x8f, 0xff, 0xff, 0xc4, 0xff, 0xff, 0xf2, 0x0,
-    0x2, 0xff, 0xff, 0xfc,
-
+    0x4f, 0xfe, 0xa0, 0xd, 0x5f, 0xfb, 0x0, 0x3c,
+    0xa2, 0x1, 0xff, 0xc4, 0x70, 0xf, 0xfe, 0x25,
+    0x0, 0x7f, 0xf1, 0xc, 0x80, 0x3f, 0xf8, 0x94,
+    0x1, 0xff, 0xc4, 0x60, 0xf, 0xfe, 0x20, 0xa0,
+    0x7, 0xff, 0x13, 0x40, 0x3f, 0xf8, 0x8e, 0x1,
+    0xff, 0xc0, 0x3, 0x0, 0xa, 0x18, 0x7, 0xfd,
+    0x40, 0x16, 0x80, 0x7f, 0xe4, 0x0, 0x9c, 0x40,
+    0x3f, 0xf2, 0x0, 0x5, 0x80, 0x3f, 0xf6, 0x80,
+    0x42, 0x1, 0xff, 0x9c, 0x3, 0xff, 0x88, 0x28,
+    0x1, 0xff, 0xc4, 0xe0, 0xf, 0xfe, 0x22, 0x80,
+    0x7f, 0xf1, 0x58, 0x3, 0xff, 0x89, 0x40, 0x1f,
+    0xfc, 0x43, 0x10, 0xf, 0xfe, 0x23, 0x0, 0x7f,
+    0xf1, 0x28, 0x3, 0xc0,
     /* U+004F "O" */
-    0x0, 0x0, 0x0, 0x4a, 0xdf, 0xdc, 0x82, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1b, 0xff, 0xff, 0xff,
-    0xff, 0x90, 0x0, 0x0, 0x0, 0x1, 0xdf, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x10, 0x0, 0x0, 0xc,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x0,
-    0x0, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf5, 0x0, 0x0, 0xef, 0xff, 0xff, 0xa3, 0x3b,
-    0xff, 0xff, 0xfc, 0x0, 0x4, 0xff, 0xff, 0xfd,
-    0x0, 0x0, 0xdf, 0xff, 0xff, 0x30, 0x9, 0xff,
-    0xff, 0xf4, 0x0, 0x0, 0x6f, 0xff, 0xff, 0x70,
-    0xc, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xb0, 0xf, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0xe, 0xff, 0xff, 0xc0, 0x1f, 0xff, 0xff, 0xa0,
-    0x0, 0x0, 0xd, 0xff, 0xff, 0xe0, 0x2f, 0xff,
-    0xff, 0x90, 0x0, 0x0, 0xb, 0xff, 0xff, 0xf0,
-    0x2f, 0xff, 0xff, 0x90, 0x0, 0x0, 0xb, 0xff,
-    0xff, 0xf0, 0x1f, 0xff, 0xff, 0xa0, 0x0, 0x0,
-    0xd, 0xff, 0xff, 0xf0, 0xf, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0xe, 0xff, 0xff, 0xd0, 0xd, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xa0,
-    0x9, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0x70, 0x4, 0xff, 0xff, 0xfd, 0x0, 0x2,
-    0xff, 0xff, 0xff, 0x20, 0x0, 0xef, 0xff, 0xff,
-    0xc5, 0x5d, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x6f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x0,
-    0x0, 0xc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x90, 0x0, 0x0, 0x1, 0xef, 0xff, 0xff, 0xff,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x1b, 0xff,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4a, 0xdf, 0xec, 0x82, 0x0, 0x0, 0x0,
-
+    0x0, 0xf2, 0x56, 0xfe, 0xe4, 0x10, 0x7, 0xf8,
+    0x6e, 0xca, 0x40, 0x46, 0xfb, 0x20, 0x1f, 0x87,
+    0x10, 0x3, 0xf3, 0x60, 0x80, 0x7b, 0x48, 0x3,
+    0xfc, 0x76, 0x1, 0xcc, 0x60, 0x1f, 0xf9, 0x54,
+    0x1, 0xa0, 0x3, 0x97, 0x30, 0x80, 0x1d, 0x20,
+    0x12, 0x8, 0x6, 0x2a, 0x33, 0x59, 0x0, 0x63,
+    0x30, 0x3, 0x40, 0x3a, 0x40, 0x35, 0x80, 0x72,
+    0x0, 0x14, 0x3, 0x90, 0x3, 0x38, 0x7, 0x60,
+    0x0, 0xc0, 0x32, 0x0, 0x70, 0x88, 0x3, 0x38,
+    0x8, 0x7, 0x8, 0x7, 0x8c, 0x3, 0x10, 0x18,
+    0x7, 0x18, 0x7, 0x98, 0x3, 0x8, 0x7, 0xff,
+    0x24, 0xc0, 0x38, 0xc0, 0x3c, 0xc0, 0x1e, 0x10,
+    0xe, 0x60, 0xf, 0x18, 0x6, 0x20, 0x1, 0x0,
+    0x63, 0x0, 0xe2, 0x10, 0xc, 0xe0, 0x4, 0x0,
+    0xe4, 0x0, 0xca, 0x1, 0xda, 0x0, 0xd0, 0xe,
+    0x90, 0x8, 0xa0, 0x3, 0x94, 0x0, 0x82, 0x1,
+    0x8b, 0x15, 0x5e, 0x1, 0xc8, 0x40, 0x14, 0x0,
+    0x71, 0xd5, 0x8, 0x3, 0xa0, 0x3, 0x31, 0x80,
+    0x7f, 0xe6, 0x30, 0xe, 0xd1, 0x0, 0xff, 0x24,
+    0x80, 0x78, 0x7d, 0x0, 0x3f, 0x3d, 0x80, 0x7e,
+    0x1b, 0xb2, 0x90, 0x9, 0xbe, 0xc0, 0x7,
     /* U+0050 "P" */
-    0x6f, 0xff, 0xff, 0xff, 0xff, 0xda, 0x60, 0x0,
-    0x6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd4,
-    0x0, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf2, 0x6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xb0, 0x6f, 0xff, 0xff, 0xdb, 0xcf, 0xff,
-    0xff, 0xff, 0x16, 0xff, 0xff, 0xf4, 0x0, 0x1c,
-    0xff, 0xff, 0xf3, 0x6f, 0xff, 0xff, 0x40, 0x0,
-    0x5f, 0xff, 0xff, 0x66, 0xff, 0xff, 0xf4, 0x0,
-    0x7, 0xff, 0xff, 0xf5, 0x6f, 0xff, 0xff, 0x40,
-    0x3, 0xef, 0xff, 0xff, 0x36, 0xff, 0xff, 0xfd,
-    0xcd, 0xff, 0xff, 0xff, 0xe0, 0x6f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf6, 0x6, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfb, 0x0, 0x6f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x6, 0xff,
-    0xff, 0xff, 0xff, 0xda, 0x71, 0x0, 0x0, 0x6f,
-    0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0,
-
+    0x6f, 0xff, 0xed, 0xa6, 0x0, 0xff, 0xe1, 0x12,
+    0xce, 0xa0, 0x7, 0xff, 0xc, 0xac, 0x80, 0x3f,
+    0xf8, 0x92, 0x1, 0xf1, 0x21, 0x80, 0x79, 0x4,
+    0x3, 0xd3, 0x79, 0xc6, 0x1, 0xc4, 0x1, 0xfc,
+    0x32, 0x1, 0xca, 0x1, 0xfe, 0x20, 0xe, 0x30,
+    0xf, 0xe3, 0x90, 0xe, 0x60, 0xf, 0x4e, 0x6e,
+    0x8, 0x6, 0x13, 0x0, 0xf1, 0x19, 0x0, 0x7a,
+    0x0, 0x3f, 0xf8, 0x68, 0xc0, 0x1f, 0xfc, 0x28,
+    0xb0, 0xf, 0xf8, 0x96, 0x39, 0xc0, 0x3f, 0xaf,
+    0xfd, 0xb4, 0xe2, 0x1, 0xff, 0xff, 0x0, 0xff,
+    0xff, 0x80, 0x7c,
     /* U+0051 "Q" */
-    0x0, 0x0, 0x0, 0x39, 0xdf, 0xfd, 0x82, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xff,
-    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff,
-    0xff, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0xa,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90, 0x0,
-    0x0, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf3, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xb3, 0x4c,
-    0xff, 0xff, 0xfb, 0x0, 0x2, 0xff, 0xff, 0xfe,
-    0x0, 0x1, 0xef, 0xff, 0xff, 0x20, 0x8, 0xff,
-    0xff, 0xf5, 0x0, 0x0, 0x7f, 0xff, 0xff, 0x60,
-    0xb, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0x90, 0xe, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0xe, 0xff, 0xff, 0xd0, 0xf, 0xff, 0xff, 0xa0,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xe0, 0x1f, 0xff,
-    0xff, 0x90, 0x0, 0x0, 0xb, 0xff, 0xff, 0xf0,
-    0x2f, 0xff, 0xff, 0x90, 0x0, 0x0, 0xb, 0xff,
-    0xff, 0xf0, 0x1f, 0xff, 0xff, 0x90, 0x0, 0x0,
-    0xc, 0xff, 0xff, 0xf0, 0xf, 0xff, 0xff, 0xb0,
-    0x0, 0x0, 0xd, 0xff, 0xff, 0xf0, 0xf, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xd0,
-    0xc, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xa0, 0x8, 0xff, 0xff, 0xf5, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0x60, 0x4, 0xff, 0xff, 0xfc,
-    0x0, 0x1, 0xef, 0xff, 0xff, 0x10, 0x0, 0xdf,
-    0xff, 0xff, 0xa2, 0x2b, 0xff, 0xff, 0xfb, 0x0,
-    0x0, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf3, 0x0, 0x0, 0xc, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0xcf, 0xff,
-    0xff, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xff, 0xff, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4b, 0xef, 0xff, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0xff, 0x71, 0x16, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1d, 0xff, 0xff,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0xfd, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x23, 0x10, 0x0,
-
+    0x0, 0xf1, 0xce, 0xff, 0xb6, 0x8, 0x3, 0xfe,
+    0x9c, 0x62, 0x0, 0x13, 0xec, 0x80, 0x7f, 0x63,
+    0x0, 0x7e, 0x6b, 0x0, 0xfa, 0x8c, 0x3, 0xfc,
+    0x92, 0x1, 0xc8, 0xa0, 0x1f, 0xf9, 0x8c, 0x3,
+    0x40, 0x7, 0x26, 0x59, 0x80, 0x74, 0x0, 0x44,
+    0x60, 0x18, 0x6c, 0xd3, 0x44, 0x3, 0x21, 0x0,
+    0x28, 0x3, 0xac, 0x2, 0x19, 0x0, 0xe4, 0x0,
+    0x18, 0x7, 0x20, 0x6, 0x50, 0xe, 0xf0, 0x2,
+    0x80, 0x63, 0x10, 0xc, 0x42, 0x1, 0x90, 0x0,
+    0x20, 0x19, 0x80, 0x3c, 0x40, 0x18, 0xc0, 0x40,
+    0x38, 0xc0, 0x3c, 0xe0, 0x18, 0x40, 0xc0, 0x3f,
+    0xf8, 0xe6, 0x1, 0xff, 0x9c, 0x3, 0xc2, 0x1,
+    0xc4, 0x1, 0xe1, 0x0, 0xff, 0xce, 0x1, 0xe2,
+    0x0, 0xc4, 0x0, 0x30, 0xc, 0x60, 0x1c, 0x60,
+    0x1c, 0xe0, 0x4, 0x0, 0xe5, 0x0, 0xc8, 0x1,
+    0xd8, 0x0, 0xc0, 0xe, 0x90, 0x8, 0x64, 0x3,
+    0x9c, 0x0, 0x84, 0x1, 0x8e, 0x88, 0x94, 0x20,
+    0x19, 0x4, 0x2, 0x80, 0xe, 0x5d, 0xd2, 0x0,
+    0x74, 0x0, 0x65, 0x30, 0xf, 0xfd, 0x6, 0x1,
+    0xd8, 0x60, 0x1f, 0xe4, 0x70, 0xf, 0xb0, 0xc0,
+    0x3f, 0x35, 0x80, 0x7f, 0x65, 0xa0, 0x80, 0x65,
+    0x90, 0xf, 0xf9, 0x2f, 0x90, 0x2, 0x57, 0x11,
+    0x31, 0x80, 0x7f, 0xa0, 0x3, 0x47, 0x72, 0x5c,
+    0x3, 0xfc, 0x6a, 0x1, 0xff, 0xc7, 0xb2, 0x0,
+    0xff, 0xe3, 0xe, 0xb0, 0x6, 0x26, 0x0, 0xff,
+    0xe0, 0x4, 0xfe, 0xe7, 0x69, 0x0,
     /* U+0052 "R" */
-    0x6f, 0xff, 0xff, 0xff, 0xff, 0xdb, 0x60, 0x0,
-    0x6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd3,
-    0x0, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xe1, 0x6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x90, 0x6f, 0xff, 0xff, 0xdc, 0xdf, 0xff,
-    0xff, 0xfd, 0x6, 0xff, 0xff, 0xf4, 0x0, 0x5f,
-    0xff, 0xff, 0xf0, 0x6f, 0xff, 0xff, 0x40, 0x0,
-    0xdf, 0xff, 0xff, 0x6, 0xff, 0xff, 0xf4, 0x0,
-    0xd, 0xff, 0xff, 0xc0, 0x6f, 0xff, 0xff, 0x40,
-    0x3, 0xff, 0xff, 0xf6, 0x6, 0xff, 0xff, 0xf9,
-    0x69, 0xff, 0xff, 0xfa, 0x0, 0x6f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfa, 0x0, 0x6, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xb4, 0x0, 0x0, 0x6f, 0xff,
-    0xff, 0xff, 0xff, 0xfa, 0x30, 0x0, 0x6, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x0, 0x6f,
-    0xff, 0xff, 0x52, 0xbf, 0xff, 0xff, 0x30, 0x6,
-    0xff, 0xff, 0xf4, 0x1, 0xff, 0xff, 0xf9, 0x0,
-    0x6f, 0xff, 0xff, 0x40, 0xc, 0xff, 0xff, 0xe0,
-    0x6, 0xff, 0xff, 0xf4, 0x0, 0x9f, 0xff, 0xff,
-    0x20, 0x6f, 0xff, 0xff, 0x40, 0x7, 0xff, 0xff,
-    0xf5, 0x6, 0xff, 0xff, 0xf4, 0x0, 0x5f, 0xff,
-    0xff, 0x90, 0x6f, 0xff, 0xff, 0x40, 0x2, 0xff,
-    0xff, 0xfc, 0x6, 0xff, 0xff, 0xf4, 0x0, 0xf,
-    0xff, 0xff, 0xf0, 0x6f, 0xff, 0xff, 0x40, 0x0,
-    0xef, 0xff, 0xff, 0x36, 0xff, 0xff, 0xf4, 0x0,
-    0xc, 0xff, 0xff, 0xf6,
-
+    0x6f, 0xff, 0xed, 0xb6, 0x0, 0xff, 0xe1, 0x12,
+    0x4e, 0x98, 0x7, 0xff, 0xc, 0xb4, 0x40, 0x3f,
+    0xf8, 0x63, 0x0, 0x1f, 0x11, 0x90, 0x7, 0x90,
+    0x3, 0xe9, 0xcd, 0xa0, 0xe, 0x20, 0xf, 0xf2,
+    0x90, 0x7, 0xff, 0x24, 0xc0, 0x3f, 0xc6, 0x40,
+    0x1a, 0x80, 0x3e, 0xd6, 0x9c, 0x0, 0xca, 0xc0,
+    0x1f, 0x34, 0xb0, 0x6, 0x5a, 0x0, 0xff, 0xe0,
+    0x2, 0x5d, 0x0, 0x7f, 0xf0, 0x85, 0xc0, 0x3f,
+    0xf8, 0x6b, 0x8e, 0x1, 0xfd, 0x5a, 0x80, 0x1a,
+    0xc, 0x3, 0xf0, 0x95, 0x0, 0x75, 0x0, 0x7f,
+    0x84, 0xc0, 0x33, 0x80, 0x7f, 0xca, 0x1, 0x84,
+    0x80, 0x3f, 0xdc, 0x1, 0xce, 0x1, 0xfe, 0x20,
+    0xe, 0xc0, 0xf, 0xf3, 0x80, 0x72, 0x80, 0x7f,
+    0x88, 0x3, 0x8c, 0x3, 0xfe, 0x10, 0xe, 0x30,
+    0xf, 0xf1, 0x0, 0x72, 0x80,
     /* U+0053 "S" */
-    0x0, 0x0, 0x5a, 0xef, 0xec, 0x94, 0x0, 0x0,
-    0x3, 0xcf, 0xff, 0xff, 0xff, 0xfd, 0x0, 0x3,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0, 0xdf,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x7f, 0xff,
-    0xff, 0xff, 0xef, 0xff, 0xe0, 0xc, 0xff, 0xff,
-    0xfa, 0x10, 0x4, 0xce, 0x0, 0xef, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x70, 0xc, 0xff, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xb1,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0xf8,
-    0x10, 0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0xff,
-    0x90, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff,
-    0xe3, 0x0, 0x0, 0x3, 0xcf, 0xff, 0xff, 0xff,
-    0xe1, 0x0, 0x0, 0x0, 0x3b, 0xff, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xf5,
-    0x20, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0x5d,
-    0x60, 0x0, 0x0, 0xd, 0xff, 0xff, 0xf4, 0xef,
-    0xc6, 0x21, 0x3c, 0xff, 0xff, 0xff, 0xe, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x90, 0xef, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xe1, 0xe, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf3, 0x0, 0x8f, 0xff, 0xff,
-    0xff, 0xff, 0xa1, 0x0, 0x0, 0x6, 0xad, 0xff,
-    0xd9, 0x40, 0x0, 0x0,
-
+    0x0, 0xcb, 0x5d, 0xfd, 0x92, 0x80, 0x1c, 0x79,
+    0x4a, 0x20, 0x26, 0xd7, 0xa0, 0x11, 0xe1, 0x80,
+    0x7e, 0x30, 0xb, 0x80, 0x3f, 0xf8, 0x0, 0xe4,
+    0x1, 0xe1, 0x0, 0xf5, 0x80, 0x72, 0xf7, 0x3e,
+    0xcc, 0x2, 0x20, 0xe, 0xa1, 0x0, 0x26, 0x48,
+    0x0, 0x80, 0x38, 0x40, 0x39, 0xc0, 0xa, 0x1,
+    0xd4, 0x20, 0x1f, 0x58, 0x7, 0x27, 0x40, 0x80,
+    0x71, 0x38, 0x7, 0x9f, 0xa4, 0x3, 0xa2, 0x0,
+    0x1f, 0x37, 0x18, 0x6, 0x7c, 0x30, 0xf, 0xe,
+    0x88, 0x6, 0x3c, 0xc2, 0x0, 0x70, 0xe8, 0x7,
+    0x8e, 0xe4, 0x3, 0x8c, 0x80, 0x3e, 0x65, 0x0,
+    0xe7, 0x20, 0xf, 0x88, 0x3, 0xde, 0xc0, 0x1e,
+    0x50, 0xe, 0x13, 0x9c, 0x62, 0x13, 0xc2, 0x0,
+    0xe4, 0x0, 0x1c, 0xef, 0x61, 0x80, 0x73, 0x0,
+    0x7f, 0xf0, 0x0, 0x60, 0x3, 0xff, 0x80, 0x1a,
+    0x20, 0xc0, 0x1f, 0xcb, 0xc6, 0x0, 0x8f, 0x95,
+    0x20, 0x1, 0x35, 0xd0, 0x80, 0x40,
     /* U+0054 "T" */
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf7, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf7, 0x2e, 0xee, 0xef, 0xff, 0xff, 0xff,
-    0xee, 0xee, 0x60, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0x70, 0x0, 0x0,
-
+    0x3f, 0xff, 0xfe, 0x1b, 0x80, 0x7f, 0xf9, 0xc4,
+    0x78, 0x3, 0xe1, 0x1e, 0x2e, 0xed, 0x80, 0x1d,
+    0x1d, 0xd9, 0x80, 0x3f, 0xff, 0xe0, 0x1f, 0xff,
+    0xf0, 0xf, 0xff, 0xf8, 0x7, 0xff, 0xfc, 0x3,
+    0xc0,
     /* U+0055 "U" */
-    0x8f, 0xff, 0xff, 0x30, 0x0, 0x6f, 0xff, 0xff,
-    0x48, 0xff, 0xff, 0xf3, 0x0, 0x6, 0xff, 0xff,
-    0xf4, 0x8f, 0xff, 0xff, 0x30, 0x0, 0x6f, 0xff,
-    0xff, 0x48, 0xff, 0xff, 0xf3, 0x0, 0x6, 0xff,
-    0xff, 0xf4, 0x8f, 0xff, 0xff, 0x30, 0x0, 0x6f,
-    0xff, 0xff, 0x48, 0xff, 0xff, 0xf3, 0x0, 0x6,
-    0xff, 0xff, 0xf4, 0x8f, 0xff, 0xff, 0x30, 0x0,
-    0x6f, 0xff, 0xff, 0x48, 0xff, 0xff, 0xf3, 0x0,
-    0x6, 0xff, 0xff, 0xf4, 0x8f, 0xff, 0xff, 0x30,
-    0x0, 0x6f, 0xff, 0xff, 0x48, 0xff, 0xff, 0xf3,
-    0x0, 0x6, 0xff, 0xff, 0xf4, 0x8f, 0xff, 0xff,
-    0x30, 0x0, 0x6f, 0xff, 0xff, 0x48, 0xff, 0xff,
-    0xf3, 0x0, 0x6, 0xff, 0xff, 0xf4, 0x8f, 0xff,
-    0xff, 0x30, 0x0, 0x6f, 0xff, 0xff, 0x48, 0xff,
-    0xff, 0xf3, 0x0, 0x6, 0xff, 0xff, 0xf4, 0x8f,
-    0xff, 0xff, 0x30, 0x0, 0x6f, 0xff, 0xff, 0x48,
-    0xff, 0xff, 0xf3, 0x0, 0x7, 0xff, 0xff, 0xf4,
-    0x7f, 0xff, 0xff, 0x40, 0x0, 0x7f, 0xff, 0xff,
-    0x45, 0xff, 0xff, 0xf6, 0x0, 0xb, 0xff, 0xff,
-    0xf2, 0x3f, 0xff, 0xff, 0xd0, 0x3, 0xff, 0xff,
-    0xff, 0x0, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff,
-    0xff, 0xb0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf2, 0x0, 0xd, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf7, 0x0, 0x0, 0x19, 0xff, 0xff, 0xff,
-    0xff, 0xe6, 0x0, 0x0, 0x0, 0x3, 0xad, 0xff,
-    0xda, 0x70, 0x0, 0x0,
-
+    0x8f, 0xfe, 0x30, 0x9, 0xbf, 0xf9, 0x0, 0x3f,
+    0xff, 0xe0, 0x1f, 0xff, 0xf0, 0xf, 0xff, 0xf8,
+    0x7, 0xff, 0x2c, 0x40, 0x3d, 0xe0, 0x1c, 0xe0,
+    0x1f, 0xe2, 0x0, 0xe2, 0x0, 0xb0, 0x3, 0x99,
+    0x80, 0x1d, 0x60, 0x3, 0x40, 0xe, 0x23, 0x0,
+    0xe2, 0xfd, 0xc0, 0xe, 0x40, 0x4, 0x0, 0x78,
+    0x80, 0x3d, 0x20, 0x7, 0x20, 0xf, 0xfa, 0x8,
+    0x2, 0xc6, 0x0, 0xfc, 0x32, 0xe0, 0x18, 0x67,
+    0x14, 0x80, 0x4, 0xb1, 0xcc, 0x1,
     /* U+0056 "V" */
-    0xaf, 0xff, 0xff, 0x70, 0x0, 0x2, 0xff, 0xff,
-    0xff, 0x6, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x5f,
-    0xff, 0xff, 0xb0, 0x2f, 0xff, 0xff, 0xd0, 0x0,
-    0x8, 0xff, 0xff, 0xf7, 0x0, 0xef, 0xff, 0xff,
-    0x0, 0x0, 0xbf, 0xff, 0xff, 0x30, 0xa, 0xff,
-    0xff, 0xf2, 0x0, 0xd, 0xff, 0xff, 0xe0, 0x0,
-    0x6f, 0xff, 0xff, 0x50, 0x0, 0xff, 0xff, 0xfa,
-    0x0, 0x2, 0xff, 0xff, 0xf8, 0x0, 0x3f, 0xff,
-    0xff, 0x60, 0x0, 0xe, 0xff, 0xff, 0xa0, 0x6,
-    0xff, 0xff, 0xf2, 0x0, 0x0, 0xaf, 0xff, 0xfd,
-    0x0, 0x9f, 0xff, 0xfe, 0x0, 0x0, 0x6, 0xff,
-    0xff, 0xf0, 0xc, 0xff, 0xff, 0xa0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0x20, 0xef, 0xff, 0xf6, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0xf5, 0x1f, 0xff, 0xff,
-    0x20, 0x0, 0x0, 0xa, 0xff, 0xff, 0x84, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xfb,
-    0x7f, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0xff, 0xda, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0xe, 0xff, 0xff, 0xdf, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xff, 0xff, 0xff, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0xff,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0,
-
+    0xaf, 0xfe, 0x70, 0xc, 0x5f, 0xfe, 0xc, 0x0,
+    0xed, 0x0, 0xce, 0x1, 0xc8, 0x8, 0x1, 0xce,
+    0x1, 0xb4, 0x3, 0xb0, 0x8, 0x40, 0x31, 0x0,
+    0x63, 0x0, 0xe4, 0x0, 0x20, 0x7, 0x10, 0x4,
+    0xc0, 0x18, 0x4c, 0x1, 0x80, 0x1c, 0xe0, 0x11,
+    0x0, 0x64, 0x0, 0x90, 0x3, 0xb4, 0x0, 0x60,
+    0x1d, 0x80, 0x11, 0x8, 0x6, 0x20, 0x2, 0x80,
+    0x72, 0x0, 0x64, 0x0, 0xce, 0x0, 0xf0, 0xc,
+    0x24, 0x1, 0xb0, 0x3, 0x10, 0x1, 0x40, 0x32,
+    0x0, 0x72, 0x0, 0x71, 0x1, 0x0, 0x6c, 0x0,
+    0xe2, 0x10, 0xc, 0xe2, 0x20, 0xc, 0x80, 0x1e,
+    0x40, 0xd, 0xaa, 0x1, 0x84, 0x80, 0x3d, 0x80,
+    0x18, 0xcc, 0x1, 0x9c, 0x3, 0xe4, 0x0, 0xcd,
+    0xa0, 0x1b, 0x0, 0x3e, 0x21, 0x0, 0x89, 0xc0,
+    0x32, 0x0, 0x7e, 0x40, 0xc, 0x40, 0x11, 0x8,
+    0x7, 0xec, 0x0, 0xfc, 0x80, 0x1f, 0xc8, 0x1,
+    0xfb, 0x0, 0x3f, 0x88, 0x40, 0x3e, 0x40, 0xf,
+    0xf2, 0x0, 0x78, 0x84, 0x3, 0xfd, 0x80, 0x1e,
+    0x50, 0xf, 0xf9, 0x0, 0x3d, 0x80, 0x1f, 0xf1,
+    0x8, 0x7, 0x20, 0x7, 0x80,
     /* U+0057 "W" */
-    0x9f, 0xff, 0xff, 0x30, 0xa, 0xff, 0xff, 0xf0,
-    0x0, 0xcf, 0xff, 0xff, 0x6, 0xff, 0xff, 0xf4,
-    0x0, 0xcf, 0xff, 0xff, 0x20, 0xe, 0xff, 0xff,
-    0xc0, 0x3f, 0xff, 0xff, 0x60, 0xd, 0xff, 0xff,
-    0xf3, 0x0, 0xff, 0xff, 0xf9, 0x0, 0xff, 0xff,
-    0xf7, 0x0, 0xff, 0xff, 0xff, 0x50, 0x1f, 0xff,
-    0xff, 0x60, 0xd, 0xff, 0xff, 0x90, 0xf, 0xff,
-    0xff, 0xf6, 0x2, 0xff, 0xff, 0xf3, 0x0, 0xaf,
-    0xff, 0xfa, 0x1, 0xff, 0xfd, 0xff, 0x70, 0x4f,
-    0xff, 0xff, 0x0, 0x7, 0xff, 0xff, 0xc0, 0x3f,
-    0xff, 0x9f, 0xf9, 0x6, 0xff, 0xff, 0xd0, 0x0,
-    0x3f, 0xff, 0xfd, 0x4, 0xff, 0xe8, 0xff, 0xa0,
-    0x7f, 0xff, 0xfa, 0x0, 0x0, 0xff, 0xff, 0xf0,
-    0x6f, 0xfd, 0x7f, 0xfb, 0x9, 0xff, 0xff, 0x70,
-    0x0, 0xd, 0xff, 0xff, 0x7, 0xff, 0xc6, 0xff,
-    0xd0, 0xaf, 0xff, 0xf3, 0x0, 0x0, 0xaf, 0xff,
-    0xf2, 0x8f, 0xfb, 0x5f, 0xfe, 0xc, 0xff, 0xff,
-    0x10, 0x0, 0x7, 0xff, 0xff, 0x3a, 0xff, 0xa4,
-    0xff, 0xf0, 0xdf, 0xff, 0xd0, 0x0, 0x0, 0x4f,
-    0xff, 0xf5, 0xbf, 0xf9, 0x2f, 0xff, 0x1f, 0xff,
-    0xfa, 0x0, 0x0, 0x1, 0xff, 0xff, 0x6c, 0xff,
-    0x71, 0xff, 0xf3, 0xff, 0xff, 0x70, 0x0, 0x0,
-    0xe, 0xff, 0xf8, 0xdf, 0xf6, 0xf, 0xff, 0x5f,
-    0xff, 0xf4, 0x0, 0x0, 0x0, 0xbf, 0xff, 0x9e,
-    0xff, 0x50, 0xef, 0xf7, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0x8, 0xff, 0xfa, 0xff, 0xf3, 0xd, 0xff,
-    0x8f, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x5f, 0xff,
-    0xdf, 0xff, 0x20, 0xcf, 0xfc, 0xff, 0xfb, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0xf1, 0xa,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xff, 0x0, 0x9f, 0xff, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xe0,
-    0x8, 0xff, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0xff, 0xfd, 0x0, 0x7f, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff,
-    0xb0, 0x5, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xfa, 0x0, 0x4f, 0xff,
-    0xff, 0x90, 0x0, 0x0,
-
+    0x9f, 0xfe, 0x30, 0x5, 0x7f, 0xf0, 0x5, 0x9f,
+    0xfc, 0x1e, 0x1, 0xce, 0x0, 0x60, 0xe, 0x20,
+    0x1, 0x0, 0x63, 0x5, 0x0, 0xe2, 0x0, 0x8,
+    0x7, 0x8, 0x0, 0x40, 0x32, 0x81, 0x80, 0x70,
+    0x80, 0x8, 0x3, 0x98, 0x4, 0x3, 0xbc, 0x0,
+    0x40, 0x1b, 0x80, 0x3f, 0x18, 0x18, 0x7, 0x28,
+    0x1, 0xc0, 0x31, 0x80, 0x80, 0x44, 0x0, 0x10,
+    0x60, 0xe, 0x30, 0x6, 0x80, 0x66, 0x2, 0x0,
+    0x90, 0x1, 0xc0, 0x40, 0x18, 0x80, 0x24, 0x0,
+    0xc2, 0xe, 0x0, 0x11, 0x0, 0xc, 0x4, 0x3,
+    0x38, 0x4, 0x60, 0x18, 0x80, 0x80, 0x7, 0xe0,
+    0x1, 0xe, 0x0, 0xda, 0x1, 0x88, 0x3, 0x84,
+    0x0, 0x22, 0x0, 0x30, 0x18, 0x6, 0x40, 0xc,
+    0xe0, 0x18, 0xbc, 0x0, 0xe6, 0x0, 0x30, 0x60,
+    0xc, 0x40, 0x1b, 0x40, 0x30, 0x90, 0x0, 0x44,
+    0x0, 0x10, 0x10, 0x8, 0x84, 0x3, 0x18, 0x6,
+    0x61, 0x0, 0x1b, 0x0, 0x42, 0x40, 0x13, 0x80,
+    0x72, 0x80, 0x63, 0x70, 0x7, 0x18, 0x4, 0x40,
+    0x1b, 0x40, 0x38, 0x44, 0x1, 0x70, 0x80, 0x4,
+    0x40, 0x13, 0x0, 0x63, 0x0, 0xf2, 0x80, 0x42,
+    0x60, 0x3, 0x1, 0x0, 0x10, 0x6, 0x50, 0xf,
+    0x18, 0x4, 0x62, 0x0, 0x60, 0x30, 0x7, 0x80,
+    0x42, 0x20, 0xf, 0x68, 0x4, 0xe0, 0x10, 0x80,
+    0x80, 0x10, 0x2, 0x50, 0xf, 0x9c, 0x2, 0x20,
+    0x8, 0xc1, 0x80, 0x6, 0x1, 0x18, 0x7, 0xc4,
+    0x1, 0xf0, 0x81, 0x80, 0x7b, 0x40, 0x3f, 0x18,
+    0x7, 0x8, 0x0, 0x40, 0x3c, 0xe0, 0x1f, 0x94,
+    0x3, 0x8c, 0x1, 0xe0, 0x1e, 0x20, 0xf, 0xde,
+    0x1, 0xcc, 0x0, 0x20, 0xe, 0x30, 0xf, 0xe5,
+    0x0, 0xe1, 0x0, 0x8, 0x7, 0x28, 0x7,
     /* U+0058 "X" */
-    0x0, 0xff, 0xff, 0xff, 0x0, 0x3f, 0xff, 0xff,
-    0xe0, 0x0, 0xa, 0xff, 0xff, 0xf2, 0x6, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x4f, 0xff, 0xff, 0x60,
-    0x9f, 0xff, 0xff, 0x20, 0x0, 0x0, 0xef, 0xff,
-    0xf9, 0xd, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x9,
-    0xff, 0xff, 0xc0, 0xff, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xff, 0x4f, 0xff, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0xef, 0xff, 0xfb, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xff,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff,
-    0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xff, 0xfd, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0x6f, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0xff, 0xd1, 0xff, 0xff, 0xf6,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xf9, 0xd, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0x50,
-    0x9f, 0xff, 0xff, 0x10, 0x0, 0xb, 0xff, 0xff,
-    0xf1, 0x5, 0xff, 0xff, 0xf7, 0x0, 0x1, 0xff,
-    0xff, 0xfd, 0x0, 0x1f, 0xff, 0xff, 0xd0, 0x0,
-    0x7f, 0xff, 0xff, 0x90, 0x0, 0xdf, 0xff, 0xff,
-    0x30, 0xc, 0xff, 0xff, 0xf5, 0x0, 0xa, 0xff,
-    0xff, 0xf9, 0x2, 0xff, 0xff, 0xff, 0x10, 0x0,
-    0x6f, 0xff, 0xff, 0xe0,
-
+    0x0, 0x7f, 0xf8, 0x0, 0x7f, 0xfd, 0xc0, 0x19,
+    0x40, 0x38, 0x81, 0x40, 0x39, 0x80, 0x37, 0x0,
+    0x72, 0x7, 0x80, 0x75, 0x0, 0x64, 0x10, 0xd,
+    0xe0, 0x80, 0x18, 0x88, 0x1, 0xce, 0x1, 0x94,
+    0x8, 0x3, 0x50, 0x7, 0xb4, 0x3, 0x1a, 0x0,
+    0x73, 0x0, 0x79, 0x4, 0x3, 0x78, 0x6, 0x31,
+    0x0, 0xf9, 0xc0, 0x32, 0x0, 0x6a, 0x0, 0xfd,
+    0x40, 0x1f, 0xce, 0x1, 0xf8, 0xc4, 0x3, 0xe4,
+    0x10, 0xf, 0xe7, 0x0, 0xfb, 0x40, 0x3f, 0xca,
+    0x1, 0xf7, 0x80, 0x7f, 0x11, 0x80, 0x7c, 0xe0,
+    0x1f, 0xd4, 0x1, 0xf8, 0x50, 0x3, 0xf3, 0x0,
+    0x62, 0x0, 0xdc, 0x1, 0xf2, 0x8, 0x6, 0xb0,
+    0xc, 0xa0, 0x1f, 0x68, 0x6, 0x27, 0x0, 0xe6,
+    0x0, 0xf3, 0x0, 0x64, 0x12, 0x0, 0xd4, 0x1,
+    0xca, 0x1, 0xd8, 0x8, 0x1, 0x8c, 0x40, 0x37,
+    0x0, 0x72, 0x6, 0x0, 0x73, 0x0, 0x42, 0x80,
+    0x18, 0x84, 0x10, 0x3, 0xa8, 0x2, 0x60, 0xe,
+    0x40, 0x0, 0x90, 0x6, 0x23, 0x0, 0x58, 0x7,
+    0x60, 0x4, 0xe0, 0x1d, 0x40, 0x46, 0x1, 0xc8,
+    0x1, 0x60, 0x7, 0x38, 0x0,
     /* U+0059 "Y" */
-    0x5f, 0xff, 0xff, 0xf0, 0x0, 0x1f, 0xff, 0xff,
-    0xf5, 0xe, 0xff, 0xff, 0xf4, 0x0, 0x6f, 0xff,
-    0xff, 0xe0, 0x7, 0xff, 0xff, 0xf8, 0x0, 0xaf,
-    0xff, 0xff, 0x70, 0x1, 0xff, 0xff, 0xfd, 0x0,
-    0xef, 0xff, 0xff, 0x0, 0x0, 0x9f, 0xff, 0xff,
-    0x12, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0x57, 0xff, 0xff, 0xf1, 0x0, 0x0, 0xc,
-    0xff, 0xff, 0x9b, 0xff, 0xff, 0xa0, 0x0, 0x0,
-    0x5, 0xff, 0xff, 0xef, 0xff, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0,
-
+    0x5f, 0xff, 0x0, 0x43, 0xff, 0xe5, 0x50, 0x80,
+    0x72, 0x0, 0x1c, 0x3, 0x85, 0x42, 0x40, 0x3b,
+    0x0, 0x18, 0x1, 0xd2, 0x0, 0x60, 0xe, 0x50,
+    0x2, 0x0, 0x73, 0x80, 0x5, 0x80, 0x31, 0x9,
+    0x8, 0x6, 0x70, 0xd, 0x40, 0x1c, 0x8a, 0x1,
+    0xd2, 0x1, 0x8c, 0xc0, 0x1b, 0x30, 0x1, 0x94,
+    0x40, 0x3a, 0x40, 0x33, 0xa0, 0x6, 0x90, 0xf,
+    0x28, 0x80, 0x42, 0x1, 0x8c, 0xc0, 0x1f, 0x48,
+    0x7, 0xe9, 0x0, 0xfc, 0xc0, 0x1f, 0x12, 0x80,
+    0x7e, 0x16, 0x0, 0xf5, 0x80, 0x7f, 0xac, 0x3,
+    0xcc, 0x1, 0xfe, 0x20, 0xe, 0x30, 0xf, 0xff,
+    0xf8, 0x7, 0xff, 0xfc, 0x3, 0xff, 0xb0,
     /* U+005A "Z" */
-    0x2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd,
-    0x0, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xd0, 0x2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfd, 0x0, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xd0, 0x2, 0xee, 0xee, 0xee, 0xef, 0xff,
-    0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0xff, 0xe1, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xff, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xfe, 0xee, 0xee,
-    0xee, 0xe9, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x90, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf9, 0xf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x90, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf9,
-
+    0x2, 0xff, 0xff, 0xe0, 0x7e, 0x80, 0x7f, 0xfa,
+    0x84, 0x7e, 0x0, 0xfe, 0x2e, 0xef, 0x60, 0x7,
+    0x94, 0x3, 0xfa, 0x40, 0x38, 0x60, 0x3, 0xf2,
+    0x20, 0x3, 0xac, 0x3, 0xfa, 0x40, 0x39, 0x14,
+    0x3, 0xf3, 0x90, 0x7, 0x48, 0x7, 0xe1, 0x80,
+    0xe, 0x62, 0x0, 0xfd, 0x0, 0x1c, 0x30, 0x1,
+    0xf8, 0xd8, 0x3, 0xa0, 0x40, 0x3f, 0x78, 0x7,
+    0x13, 0x0, 0x7e, 0x63, 0x0, 0xee, 0x0, 0xfe,
+    0x80, 0xe, 0x53, 0x0, 0xfd, 0x2, 0x1, 0xd6,
+    0x1, 0xf8, 0x9c, 0x3, 0xa0, 0x40, 0x3f, 0x48,
+    0x7, 0x13, 0x80, 0x7f, 0x20, 0x7, 0x17, 0x77,
+    0xe9, 0x0, 0xfc, 0x23, 0xf8, 0x3, 0xff, 0xd0,
     /* U+005B "[" */
-    0x9f, 0xff, 0xff, 0xf6, 0x9f, 0xff, 0xff, 0xf6,
-    0x9f, 0xff, 0xff, 0xf6, 0x9f, 0xff, 0x74, 0x41,
-    0x9f, 0xff, 0x30, 0x0, 0x9f, 0xff, 0x30, 0x0,
-    0x9f, 0xff, 0x30, 0x0, 0x9f, 0xff, 0x30, 0x0,
-    0x9f, 0xff, 0x30, 0x0, 0x9f, 0xff, 0x30, 0x0,
-    0x9f, 0xff, 0x30, 0x0, 0x9f, 0xff, 0x30, 0x0,
-    0x9f, 0xff, 0x30, 0x0, 0x9f, 0xff, 0x30, 0x0,
-    0x9f, 0xff, 0x30, 0x0, 0x9f, 0xff, 0x30, 0x0,
-    0x9f, 0xff, 0x30, 0x0, 0x9f, 0xff, 0x30, 0x0,
-    0x9f, 0xff, 0x30, 0x0, 0x9f, 0xff, 0x30, 0x0,
-    0x9f, 0xff, 0x30, 0x0, 0x9f, 0xff, 0x30, 0x0,
-    0x9f, 0xff, 0x30, 0x0, 0x9f, 0xff, 0x30, 0x0,
-    0x9f, 0xff, 0x30, 0x0, 0x9f, 0xff, 0x30, 0x0,
-    0x9f, 0xff, 0x30, 0x0, 0x9f, 0xff, 0x30, 0x0,
-    0x9f, 0xff, 0x74, 0x41, 0x9f, 0xff, 0xff, 0xf6,
-    0x9f, 0xff, 0xff, 0xf6, 0x9f, 0xff, 0xff, 0xf6,
-
+    0x9f, 0xff, 0x30, 0x7, 0xff, 0x22, 0x2e, 0xce,
+    0x1, 0x91, 0x21, 0x0, 0xff, 0xff, 0x80, 0x7f,
+    0xff, 0xc0, 0x3f, 0xfb, 0x48, 0x90, 0x80, 0x68,
+    0xbb, 0x38, 0x7, 0xff, 0x10,
     /* U+005C "\\" */
-    0xcf, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x50, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x6, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x1, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0xf, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0xa, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0x90, 0x0, 0x0, 0x0, 0xa, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xf2, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x1, 0x77, 0x72,
-
+    0xcf, 0xf5, 0x80, 0x7e, 0x40, 0x2, 0x0, 0x7e,
+    0xb0, 0x9, 0x40, 0x3e, 0x30, 0xb, 0x0, 0x3f,
+    0x28, 0x1, 0xc0, 0x3f, 0x60, 0x0, 0x48, 0x3,
+    0xe7, 0x0, 0x94, 0x3, 0xe1, 0x20, 0x6, 0x0,
+    0x7e, 0x50, 0x2, 0x0, 0x7e, 0xb0, 0x9, 0x0,
+    0x3e, 0x30, 0xb, 0x40, 0x3f, 0x28, 0x1, 0x0,
+    0x3f, 0x60, 0x0, 0x88, 0x1, 0xf3, 0x80, 0x4a,
+    0x1, 0xf0, 0x90, 0x3, 0x0, 0x3f, 0x28, 0x1,
+    0x0, 0x3f, 0x58, 0x4, 0x80, 0x1f, 0x18, 0x5,
+    0xa0, 0x1f, 0x94, 0x0, 0x80, 0x1f, 0xb0, 0x0,
+    0x44, 0x0, 0xf9, 0xc0, 0x24, 0x0, 0xf8, 0x48,
+    0x1, 0xa0, 0x1f, 0x94, 0x0, 0x80, 0x1f, 0xb0,
+    0x2, 0x40, 0xf, 0x90, 0x2, 0xd0, 0xf, 0xca,
+    0x0, 0x40, 0xf, 0xd8, 0x0, 0x22, 0x0, 0x7c,
+    0xf1, 0x10, 0x0,
     /* U+005D "]" */
-    0x8f, 0xff, 0xff, 0xf7, 0x8f, 0xff, 0xff, 0xf7,
-    0x8f, 0xff, 0xff, 0xf7, 0x24, 0x48, 0xff, 0xf7,
-    0x0, 0x6, 0xff, 0xf7, 0x0, 0x6, 0xff, 0xf7,
-    0x0, 0x6, 0xff, 0xf7, 0x0, 0x6, 0xff, 0xf7,
-    0x0, 0x6, 0xff, 0xf7, 0x0, 0x6, 0xff, 0xf7,
-    0x0, 0x6, 0xff, 0xf7, 0x0, 0x6, 0xff, 0xf7,
-    0x0, 0x6, 0xff, 0xf7, 0x0, 0x6, 0xff, 0xf7,
-    0x0, 0x6, 0xff, 0xf7, 0x0, 0x6, 0xff, 0xf7,
-    0x0, 0x6, 0xff, 0xf7, 0x0, 0x6, 0xff, 0xf7,
-    0x0, 0x6, 0xff, 0xf7, 0x0, 0x6, 0xff, 0xf7,
-    0x0, 0x6, 0xff, 0xf7, 0x0, 0x6, 0xff, 0xf7,
-    0x0, 0x6, 0xff, 0xf7, 0x0, 0x6, 0xff, 0xf7,
-    0x0, 0x6, 0xff, 0xf7, 0x0, 0x6, 0xff, 0xf7,
-    0x0, 0x6, 0xff, 0xf7, 0x0, 0x6, 0xff, 0xf7,
-    0x24, 0x48, 0xff, 0xf7, 0x8f, 0xff, 0xff, 0xf7,
-    0x8f, 0xff, 0xff, 0xf7, 0x8f, 0xff, 0xff, 0xf7,
-
+    0x8f, 0xff, 0x38, 0x7, 0xff, 0x12, 0xae, 0xce,
+    0x1, 0x89, 0x11, 0xc0, 0x1f, 0xff, 0xf0, 0xf,
+    0xff, 0xf8, 0x7, 0xff, 0x68, 0x91, 0x1c, 0x1,
+    0xaa, 0xec, 0xe0, 0x1f, 0xfc, 0x80,
     /* U+005E "^" */
-    0x0, 0x0, 0x0, 0xaf, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff,
-    0x90, 0x0, 0x0, 0x0, 0xe, 0xff, 0xfd, 0xff,
-    0xff, 0x10, 0x0, 0x0, 0x7, 0xff, 0xff, 0x2f,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0xef, 0xff, 0xa0,
-    0xaf, 0xff, 0xe0, 0x0, 0x0, 0x6f, 0xff, 0xf4,
-    0x3, 0xff, 0xff, 0x60, 0x0, 0xd, 0xff, 0xfd,
-    0x0, 0xd, 0xff, 0xfe, 0x0, 0x5, 0xff, 0xff,
-    0x70, 0x0, 0x7f, 0xff, 0xf5, 0x0, 0xcf, 0xff,
-    0xf1, 0x0, 0x1, 0xff, 0xff, 0xd0, 0x4f, 0xff,
-    0xf9, 0x0, 0x0, 0xa, 0xff, 0xff, 0x4b, 0xff,
-    0xff, 0x30, 0x0, 0x0, 0x3f, 0xff, 0xfb,
-
+    0x0, 0xf5, 0x7f, 0xd8, 0x1, 0xff, 0xa, 0x80,
+    0x46, 0x60, 0xf, 0xf4, 0x0, 0x74, 0x80, 0x7f,
+    0xb, 0x0, 0x72, 0x90, 0x7, 0xe9, 0x0, 0xfa,
+    0xc0, 0x3f, 0x30, 0x4, 0x40, 0x13, 0x8, 0x7,
+    0x9c, 0x40, 0x2f, 0x0, 0xd2, 0x1, 0xe9, 0x0,
+    0x94, 0x94, 0x2, 0x60, 0xe, 0x61, 0x0, 0xb8,
+    0x24, 0x2, 0x16, 0x0, 0xd6, 0x1, 0x12, 0x1,
+    0x90, 0x5, 0x0, 0x12, 0x90, 0x5, 0x40, 0x15,
+    0x0, 0x42, 0xa0, 0x9, 0x0, 0xcc, 0x1, 0x30,
+    0x6, 0x80, 0x43, 0x0, 0x98, 0x40, 0x21, 0x50,
+    0x8, 0x93, 0xc0, 0x35, 0x0, 0x74, 0x80, 0x6f,
     /* U+005F "_" */
-    0x2c, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
-    0xcc, 0xcc, 0xc1, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf1,
-
+    0x2c, 0xcf, 0xfe, 0x40, 0x88, 0xcf, 0xff, 0x90,
+    0x0,
     /* U+0060 "`" */
-    0x2, 0x22, 0x20, 0x0, 0xd, 0xff, 0xf7, 0x0,
-    0x2, 0xff, 0xfe, 0x0, 0x0, 0x6f, 0xff, 0x70,
-    0x0, 0xa, 0xff, 0xe0, 0x0, 0x1, 0xef, 0xf7,
-
+    0x2, 0x2c, 0x1, 0xbf, 0x76, 0x70, 0xb, 0xc0,
+    0x29, 0x0, 0x8a, 0x40, 0x2, 0xe0, 0x13, 0x28,
+    0x2, 0x40, 0x35, 0x88, 0xb, 0x80,
     /* U+0061 "a" */
-    0x0, 0x3, 0x8c, 0xef, 0xda, 0x60, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0xff, 0xff, 0xfc, 0x20, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x0,
-    0x0, 0xfc, 0x84, 0x37, 0xef, 0xff, 0xfc, 0x0,
-    0x0, 0x60, 0x0, 0x0, 0x2f, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x4, 0x9c, 0xff, 0xff, 0xff, 0x10,
-    0x0, 0x19, 0xff, 0xff, 0xff, 0xff, 0xff, 0x20,
-    0x3, 0xef, 0xff, 0xfe, 0xaf, 0xff, 0xff, 0x20,
-    0xe, 0xff, 0xff, 0x60, 0xe, 0xff, 0xff, 0x20,
-    0x6f, 0xff, 0xfb, 0x0, 0xf, 0xff, 0xff, 0x20,
-    0x8f, 0xff, 0xfa, 0x0, 0x2f, 0xff, 0xff, 0x20,
-    0x7f, 0xff, 0xff, 0x41, 0x9f, 0xff, 0xff, 0x20,
-    0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x30,
-    0xb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60,
-    0x1, 0xdf, 0xff, 0xff, 0xbd, 0xff, 0xff, 0xa0,
-    0x0, 0x8, 0xcf, 0xd7, 0x9, 0xff, 0xff, 0xf0,
-
+    0x0, 0x8e, 0x33, 0xbf, 0x69, 0x80, 0x3e, 0xcc,
+    0x39, 0x88, 0x12, 0xce, 0x10, 0x7, 0x18, 0x7,
+    0xe3, 0xf0, 0xf, 0xfe, 0x19, 0x38, 0x7, 0x1b,
+    0xde, 0x40, 0x80, 0x6b, 0x0, 0xd3, 0x90, 0x86,
+    0xf8, 0x1, 0x8c, 0x3, 0x30, 0x1, 0x27, 0x34,
+    0x3, 0x84, 0x2, 0x19, 0xfb, 0x63, 0x0, 0xf1,
+    0x80, 0xf, 0xd8, 0x2, 0x15, 0x0, 0xfd, 0xa2,
+    0x1, 0x4f, 0x50, 0x80, 0x79, 0x84, 0x2, 0x46,
+    0x0, 0x8, 0x7, 0xb8, 0x3, 0x8, 0x0, 0x80,
+    0x3e, 0xf0, 0xc, 0xa8, 0x36, 0x1, 0xf1, 0x80,
+    0x75, 0xf3, 0x0, 0x70, 0x82, 0x20, 0x3, 0xff,
+    0x28, 0x2, 0x88, 0x3, 0x90, 0x80, 0x36, 0x0,
+    0x7, 0x5c, 0xc0, 0xa2, 0xd0, 0x3, 0x28, 0x0,
     /* U+0062 "b" */
-    0x5f, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0xff, 0x23, 0xbf, 0xea, 0x20, 0x0,
-    0x5f, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xe3, 0x0,
-    0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0,
-    0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70,
-    0x5f, 0xff, 0xff, 0xfd, 0xef, 0xff, 0xff, 0xe0,
-    0x5f, 0xff, 0xff, 0xb0, 0xd, 0xff, 0xff, 0xf3,
-    0x5f, 0xff, 0xff, 0x40, 0x6, 0xff, 0xff, 0xf5,
-    0x5f, 0xff, 0xff, 0x20, 0x3, 0xff, 0xff, 0xf7,
-    0x5f, 0xff, 0xff, 0x20, 0x2, 0xff, 0xff, 0xf8,
-    0x5f, 0xff, 0xff, 0x20, 0x4, 0xff, 0xff, 0xf5,
-    0x5f, 0xff, 0xff, 0x20, 0x7, 0xff, 0xff, 0xf3,
-    0x5f, 0xff, 0xff, 0x40, 0x1e, 0xff, 0xff, 0xf1,
-    0x5f, 0xff, 0xff, 0xfb, 0xef, 0xff, 0xff, 0x90,
-    0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x20,
-    0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x0,
-    0x5f, 0xff, 0xfb, 0xef, 0xff, 0xff, 0xa0, 0x0,
-    0x5f, 0xff, 0xb0, 0x1a, 0xef, 0xc6, 0x0, 0x0,
-
+    0x5f, 0xfe, 0x20, 0xf, 0xff, 0xf8, 0x7, 0xff,
+    0x64, 0xef, 0xfa, 0x88, 0x3, 0xf9, 0x71, 0x0,
+    0x57, 0xc, 0x3, 0xf4, 0x0, 0x70, 0xe8, 0x7,
+    0xff, 0xc, 0x5c, 0x3, 0xf1, 0x8, 0x7, 0x48,
+    0x7, 0xc9, 0xbc, 0x40, 0x18, 0x4c, 0x3, 0xde,
+    0x0, 0xb0, 0xe, 0x60, 0xf, 0x30, 0x1, 0x40,
+    0x38, 0x80, 0x3f, 0x84, 0x3, 0xbc, 0x3, 0xf9,
+    0x80, 0x3b, 0x40, 0x3f, 0x8c, 0x3, 0x98, 0x3,
+    0xcc, 0x3, 0x20, 0x1c, 0x40, 0x1e, 0xbb, 0x78,
+    0x80, 0x66, 0x10, 0xf, 0x90, 0x40, 0x3a, 0xc0,
+    0x3f, 0xf8, 0x4c, 0x40, 0x1e, 0x41, 0x0, 0xe5,
+    0x90, 0xf, 0x25, 0xfa, 0x88, 0x1c, 0xd0, 0x4,
     /* U+0063 "c" */
-    0x0, 0x0, 0x5, 0xbe, 0xfd, 0xa3, 0x0, 0x2,
-    0xcf, 0xff, 0xff, 0xf9, 0x0, 0x1e, 0xff, 0xff,
-    0xff, 0xf9, 0x0, 0xaf, 0xff, 0xff, 0xff, 0xf9,
-    0x3, 0xff, 0xff, 0xff, 0xfe, 0xf9, 0xb, 0xff,
-    0xff, 0xfc, 0x20, 0x14, 0xf, 0xff, 0xff, 0xf1,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xa0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0x90, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xb0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0xb, 0xff, 0xff, 0xfe, 0x41, 0x46,
-    0x4, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x0, 0xbf,
-    0xff, 0xff, 0xff, 0xf9, 0x0, 0x2e, 0xff, 0xff,
-    0xff, 0xf9, 0x0, 0x3, 0xdf, 0xff, 0xff, 0xf9,
-    0x0, 0x0, 0x7, 0xcf, 0xec, 0x71,
-
+    0x0, 0xe5, 0xbe, 0xfd, 0xa3, 0x0, 0x8b, 0x29,
+    0x4, 0x9, 0x68, 0x0, 0x38, 0x60, 0x1f, 0xd6,
+    0x20, 0x1f, 0xc6, 0xa0, 0x1e, 0x10, 0xa, 0x0,
+    0x38, 0xf7, 0xb9, 0xa0, 0x80, 0x1d, 0xa4, 0x2,
+    0x82, 0x1, 0xca, 0x20, 0x18, 0xc0, 0x38, 0xc0,
+    0x38, 0xc0, 0x38, 0x80, 0x38, 0x40, 0x39, 0x8,
+    0x3, 0x90, 0x3, 0xb1, 0x5, 0x18, 0x3c, 0x3,
+    0x86, 0xfa, 0xfc, 0x11, 0x0, 0x1f, 0xf4, 0x88,
+    0x7, 0xf8, 0xb4, 0x80, 0x3f, 0xc7, 0xb0, 0x60,
+    0x27, 0x10,
     /* U+0064 "d" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xfa,
-    0x0, 0x0, 0x5c, 0xfd, 0x91, 0xef, 0xff, 0xfa,
-    0x0, 0x9, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfa,
-    0x0, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
-    0x0, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
-    0x6, 0xff, 0xff, 0xfe, 0xae, 0xff, 0xff, 0xfa,
-    0xc, 0xff, 0xff, 0xf2, 0x1, 0xff, 0xff, 0xfa,
-    0xf, 0xff, 0xff, 0xa0, 0x0, 0xef, 0xff, 0xfa,
-    0x1f, 0xff, 0xff, 0x70, 0x0, 0xef, 0xff, 0xfa,
-    0x3f, 0xff, 0xff, 0x60, 0x0, 0xef, 0xff, 0xfa,
-    0x2f, 0xff, 0xff, 0x70, 0x0, 0xff, 0xff, 0xfa,
-    0xf, 0xff, 0xff, 0xb0, 0x2, 0xff, 0xff, 0xfa,
-    0xd, 0xff, 0xff, 0xf4, 0x8, 0xff, 0xff, 0xfa,
-    0x8, 0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0xfa,
-    0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
-    0x0, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
-    0x0, 0xb, 0xff, 0xff, 0xfa, 0xaf, 0xff, 0xfa,
-    0x0, 0x0, 0x7d, 0xfd, 0x70, 0x6f, 0xff, 0xfa,
-
+    0x0, 0xff, 0x77, 0xfe, 0xa0, 0xf, 0xff, 0xf8,
+    0x7, 0xff, 0x35, 0x73, 0xf6, 0x44, 0x3, 0xfa,
+    0x68, 0xc0, 0x9b, 0xc4, 0x3, 0xe6, 0x60, 0x7,
+    0x8, 0x7, 0xe8, 0x0, 0xff, 0xe1, 0x30, 0x80,
+    0x61, 0x51, 0x0, 0xfa, 0x80, 0x3b, 0x2b, 0xc0,
+    0x3e, 0x30, 0xc, 0xa4, 0x2, 0x20, 0xe, 0x10,
+    0xe, 0xd0, 0xf, 0xe2, 0x0, 0xe1, 0x0, 0xfe,
+    0x10, 0xe, 0x10, 0x8, 0x40, 0x38, 0x80, 0x3b,
+    0x0, 0x4, 0x1, 0xf1, 0x0, 0x64, 0x40, 0x50,
+    0x7, 0xca, 0x1, 0xd7, 0xce, 0x1, 0xf4, 0x80,
+    0x78, 0x40, 0x3f, 0xb, 0x0, 0x7f, 0xf0, 0xe5,
+    0x0, 0x39, 0x54, 0x1, 0xfa, 0xe0, 0x80, 0xa2,
+    0xb0, 0x3, 0x80,
     /* U+0065 "e" */
-    0x0, 0x0, 0x4, 0xae, 0xfe, 0xc7, 0x0, 0x0,
-    0x0, 0x1, 0xbf, 0xff, 0xff, 0xff, 0xd2, 0x0,
-    0x0, 0xd, 0xff, 0xff, 0xff, 0xff, 0xff, 0x20,
-    0x0, 0x8f, 0xff, 0xf9, 0x25, 0xef, 0xff, 0xa0,
-    0x2, 0xff, 0xff, 0xc0, 0x0, 0x6f, 0xff, 0xf2,
-    0x9, 0xff, 0xff, 0x80, 0x0, 0x2f, 0xff, 0xf6,
-    0xd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb,
-    0xf, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x80,
-    0xa, 0xff, 0xff, 0xfe, 0x30, 0x0, 0x2c, 0xf0,
-    0x3, 0xff, 0xff, 0xff, 0xfd, 0xac, 0xff, 0xf0,
-    0x0, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0x0, 0x1d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0x0, 0x1, 0xaf, 0xff, 0xff, 0xff, 0xfe, 0x70,
-    0x0, 0x0, 0x3, 0x9d, 0xff, 0xda, 0x50, 0x0,
-
+    0x0, 0xe4, 0xae, 0xfe, 0xc7, 0x0, 0xf8, 0x6e,
+    0xca, 0x20, 0x27, 0x1a, 0x40, 0x1d, 0x88, 0x1,
+    0xf1, 0x69, 0x0, 0x50, 0x40, 0x13, 0x6d, 0x8,
+    0x5, 0x0, 0x2, 0x70, 0x8, 0xe4, 0x96, 0x0,
+    0x25, 0x20, 0xb0, 0xc, 0x80, 0x12, 0x0, 0x64,
+    0x4, 0x0, 0xcf, 0xff, 0x68, 0x6, 0xe0, 0x20,
+    0xf, 0xfe, 0x0, 0x18, 0x80, 0x7f, 0xf0, 0xc4,
+    0x3, 0x87, 0xff, 0xf5, 0x80, 0x80, 0x61, 0x40,
+    0xf, 0x40, 0x1, 0x0, 0x3a, 0x8c, 0x2, 0x2c,
+    0x70, 0x4, 0x80, 0x70, 0xe6, 0xd6, 0x69, 0x80,
+    0x46, 0x80, 0x1e, 0x25, 0x30, 0xf, 0x51, 0x0,
+    0x7f, 0xf0, 0x87, 0x14, 0x3, 0xf0, 0xc0, 0x6,
+    0x1a, 0xc6, 0x20, 0x1, 0x2d, 0x73, 0x80,
     /* U+0066 "f" */
-    0x0, 0x0, 0x3a, 0xdf, 0xeb, 0x40, 0x0, 0x6f,
-    0xff, 0xff, 0xf8, 0x0, 0x3f, 0xff, 0xff, 0xff,
-    0x80, 0x7, 0xff, 0xff, 0xff, 0xf8, 0x0, 0xaf,
-    0xff, 0xff, 0xdb, 0x70, 0xb, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0xbf, 0xff, 0xfe, 0x0, 0xb, 0xff,
-    0xff, 0xff, 0xff, 0xf8, 0xbf, 0xff, 0xff, 0xff,
-    0xff, 0x8b, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xbf,
-    0xff, 0xff, 0xff, 0xff, 0x80, 0xb, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0xbf, 0xff, 0xfe, 0x0, 0x0,
-    0xb, 0xff, 0xff, 0xe0, 0x0, 0x0, 0xbf, 0xff,
-    0xfe, 0x0, 0x0, 0xb, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0xbf, 0xff, 0xfe, 0x0, 0x0, 0xb, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0xbf, 0xff, 0xfe, 0x0,
-    0x0, 0xb, 0xff, 0xff, 0xe0, 0x0, 0x0, 0xbf,
-    0xff, 0xfe, 0x0, 0x0, 0xb, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0xbf, 0xff, 0xfe, 0x0, 0x0, 0xb,
-    0xff, 0xff, 0xe0, 0x0,
-
+    0x0, 0xc7, 0x5b, 0xfd, 0x68, 0x1, 0x36, 0x29,
+    0x0, 0xa6, 0x0, 0xe, 0x40, 0x3f, 0x90, 0x3,
+    0xfd, 0xa0, 0x1c, 0x49, 0xe0, 0x1, 0x0, 0xed,
+    0xb7, 0x0, 0xf8, 0x40, 0x2b, 0xf4, 0x0, 0xc3,
+    0xfe, 0x80, 0xf, 0xfe, 0xad, 0xfa, 0x0, 0x61,
+    0xff, 0x40, 0x7, 0xff, 0xfc, 0x3, 0xff, 0xda,
     /* U+0067 "g" */
-    0x0, 0x0, 0x3b, 0xef, 0xc5, 0x9, 0xff, 0xfb,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xfb,
-    0x0, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb,
-    0x0, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb,
-    0x5, 0xff, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xfb,
-    0xb, 0xff, 0xff, 0xf3, 0x1, 0xef, 0xff, 0xfb,
-    0xe, 0xff, 0xff, 0xb0, 0x0, 0xef, 0xff, 0xfb,
-    0xf, 0xff, 0xff, 0x80, 0x0, 0xef, 0xff, 0xfb,
-    0x2f, 0xff, 0xff, 0x80, 0x0, 0xef, 0xff, 0xfb,
-    0x1f, 0xff, 0xff, 0x90, 0x0, 0xef, 0xff, 0xfb,
-    0xf, 0xff, 0xff, 0xc0, 0x1, 0xff, 0xff, 0xfb,
-    0xc, 0xff, 0xff, 0xf5, 0x8, 0xff, 0xff, 0xfb,
-    0x7, 0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0xfb,
-    0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb,
-    0x0, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb,
-    0x0, 0xa, 0xff, 0xff, 0xfa, 0xef, 0xff, 0xfb,
-    0x0, 0x0, 0x6d, 0xfd, 0x70, 0xef, 0xff, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xf9,
-    0x1, 0x90, 0x0, 0x0, 0x9, 0xff, 0xff, 0xf6,
-    0x1, 0xfe, 0x72, 0x3, 0x9f, 0xff, 0xff, 0xf2,
-    0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0,
-    0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x20,
-    0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x0,
-    0x0, 0xbf, 0xff, 0xff, 0xff, 0xff, 0x70, 0x0,
-    0x0, 0x2, 0x7b, 0xef, 0xec, 0x81, 0x0, 0x0,
-
+    0x0, 0xc7, 0x7d, 0xf8, 0xa1, 0x3f, 0xf5, 0x80,
+    0x4f, 0x88, 0x20, 0x75, 0xac, 0x1, 0xe4, 0x80,
+    0xf, 0x10, 0x7, 0xd2, 0x1, 0xff, 0xc2, 0x52,
+    0x0, 0xe4, 0x10, 0xf, 0xb8, 0x3, 0xb2, 0xfc,
+    0x40, 0x3c, 0xa0, 0x19, 0xc, 0x4, 0x3, 0xe1,
+    0x0, 0xc6, 0x1, 0xfc, 0x40, 0x1f, 0xfc, 0x33,
+    0x0, 0xe1, 0x0, 0xfe, 0x10, 0xe, 0x50, 0x0,
+    0x88, 0x3, 0xc6, 0x1, 0x8d, 0x42, 0x40, 0x3e,
+    0xb0, 0xe, 0xae, 0x70, 0xf, 0x98, 0x3, 0xc2,
+    0x1, 0xf8, 0x5c, 0x3, 0xff, 0x87, 0xa, 0x1,
+    0xca, 0x20, 0x1f, 0xaa, 0x48, 0xa, 0x28, 0x3,
+    0x84, 0x3, 0x36, 0xfe, 0xb8, 0x88, 0x3, 0x18,
+    0xc, 0x80, 0x7a, 0x0, 0x3b, 0xc0, 0xd, 0xce,
+    0x40, 0x72, 0xc0, 0x1c, 0x80, 0x10, 0xc6, 0xfe,
+    0x30, 0x7, 0x29, 0x0, 0x7f, 0xf0, 0xa0, 0x3,
+    0xff, 0x85, 0x4, 0x0, 0x14, 0x0, 0xfe, 0x87,
+    0x0, 0xd7, 0xb0, 0x82, 0x2, 0x6f, 0xce, 0x1,
     /* U+0068 "h" */
-    0x4f, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xf4,
-    0x3b, 0xee, 0xa2, 0x0, 0x4f, 0xff, 0xff, 0xaf,
-    0xff, 0xff, 0xe3, 0x4, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xc0, 0x4f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x34, 0xff, 0xff, 0xff, 0xef, 0xff,
-    0xff, 0xf6, 0x4f, 0xff, 0xff, 0xc0, 0x4f, 0xff,
-    0xff, 0x84, 0xff, 0xff, 0xf8, 0x1, 0xff, 0xff,
-    0xf8, 0x4f, 0xff, 0xff, 0x50, 0xf, 0xff, 0xff,
-    0x84, 0xff, 0xff, 0xf4, 0x0, 0xff, 0xff, 0xf8,
-    0x4f, 0xff, 0xff, 0x40, 0xf, 0xff, 0xff, 0x84,
-    0xff, 0xff, 0xf4, 0x0, 0xff, 0xff, 0xf8, 0x4f,
-    0xff, 0xff, 0x40, 0xf, 0xff, 0xff, 0x84, 0xff,
-    0xff, 0xf4, 0x0, 0xff, 0xff, 0xf8, 0x4f, 0xff,
-    0xff, 0x40, 0xf, 0xff, 0xff, 0x84, 0xff, 0xff,
-    0xf4, 0x0, 0xff, 0xff, 0xf8, 0x4f, 0xff, 0xff,
-    0x40, 0xf, 0xff, 0xff, 0x84, 0xff, 0xff, 0xf4,
-    0x0, 0xff, 0xff, 0xf8,
-
+    0x4f, 0xfe, 0x40, 0xf, 0xff, 0xf8, 0x7, 0xff,
+    0x48, 0xef, 0xb9, 0x44, 0x1, 0xfb, 0xb1, 0x4,
+    0x4b, 0x86, 0x1, 0xf2, 0x80, 0x70, 0xf8, 0x7,
+    0xff, 0x8, 0xcc, 0x1, 0xf0, 0x80, 0x79, 0x40,
+    0x3c, 0x7d, 0x60, 0x1d, 0xc0, 0x1e, 0x40, 0x50,
+    0xf, 0xfd, 0xa0, 0x20, 0x1f, 0xf8, 0x40, 0x3f,
+    0xff, 0xe0, 0x1f, 0xfe, 0x90,
     /* U+0069 "i" */
-    0x2, 0xbf, 0xd5, 0x0, 0xdf, 0xff, 0xf3, 0x4f,
-    0xff, 0xff, 0x93, 0xff, 0xff, 0xf8, 0xc, 0xff,
-    0xff, 0x20, 0x19, 0xdb, 0x30, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xf6, 0x1f, 0xff, 0xff, 0x61,
-    0xff, 0xff, 0xf6, 0x1f, 0xff, 0xff, 0x61, 0xff,
-    0xff, 0xf6, 0x1f, 0xff, 0xff, 0x61, 0xff, 0xff,
-    0xf6, 0x1f, 0xff, 0xff, 0x61, 0xff, 0xff, 0xf6,
-    0x1f, 0xff, 0xff, 0x61, 0xff, 0xff, 0xf6, 0x1f,
-    0xff, 0xff, 0x61, 0xff, 0xff, 0xf6, 0x1f, 0xff,
-    0xff, 0x61, 0xff, 0xff, 0xf6, 0x1f, 0xff, 0xff,
-    0x61, 0xff, 0xff, 0xf6,
-
+    0x2, 0xbf, 0xd5, 0x0, 0x7a, 0x1, 0x51, 0xa1,
+    0x0, 0x6a, 0x70, 0xe, 0x13, 0x30, 0x6, 0xa0,
+    0xd6, 0x24, 0xc2, 0x1, 0x9d, 0xb3, 0x1, 0xff,
+    0xe6, 0x0, 0xff, 0xff, 0x80, 0x7f, 0xf6, 0x40,
     /* U+006A "j" */
-    0x0, 0x2, 0xbf, 0xd5, 0x0, 0x0, 0xdf, 0xff,
-    0xf3, 0x0, 0x4f, 0xff, 0xff, 0x90, 0x3, 0xff,
-    0xff, 0xf8, 0x0, 0xc, 0xff, 0xff, 0x20, 0x0,
-    0x19, 0xdb, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0xf6, 0x0, 0x2f, 0xff, 0xff,
-    0x60, 0x2, 0xff, 0xff, 0xf6, 0x0, 0x2f, 0xff,
-    0xff, 0x60, 0x2, 0xff, 0xff, 0xf6, 0x0, 0x2f,
-    0xff, 0xff, 0x60, 0x2, 0xff, 0xff, 0xf6, 0x0,
-    0x2f, 0xff, 0xff, 0x60, 0x2, 0xff, 0xff, 0xf6,
-    0x0, 0x2f, 0xff, 0xff, 0x60, 0x2, 0xff, 0xff,
-    0xf6, 0x0, 0x2f, 0xff, 0xff, 0x60, 0x2, 0xff,
-    0xff, 0xf6, 0x0, 0x2f, 0xff, 0xff, 0x60, 0x2,
-    0xff, 0xff, 0xf6, 0x0, 0x2f, 0xff, 0xff, 0x60,
-    0x2, 0xff, 0xff, 0xf6, 0x0, 0x2f, 0xff, 0xff,
-    0x60, 0x3, 0xff, 0xff, 0xf6, 0x0, 0x7f, 0xff,
-    0xff, 0x4c, 0xcf, 0xff, 0xff, 0xf2, 0xdf, 0xff,
-    0xff, 0xff, 0xd, 0xff, 0xff, 0xff, 0x80, 0xdf,
-    0xff, 0xff, 0xc1, 0x6, 0xdf, 0xec, 0x70, 0x0,
-
+    0x0, 0x8a, 0xff, 0x54, 0x3, 0x7a, 0x1, 0x51,
+    0x80, 0x10, 0x80, 0x35, 0x0, 0x1c, 0x3, 0x84,
+    0x0, 0x66, 0x0, 0xd4, 0x1, 0x6b, 0x12, 0x61,
+    0x0, 0x43, 0x3b, 0x66, 0x1, 0x17, 0xff, 0x30,
+    0x7, 0xff, 0xfc, 0x3, 0xff, 0xfe, 0x1, 0xc2,
+    0x1, 0xf9, 0x0, 0x38, 0xb3, 0x10, 0x1, 0xcc,
+    0x26, 0x1, 0xe2, 0x0, 0xf9, 0xc0, 0x3e, 0x39,
+    0xb, 0x20, 0x13, 0x8c, 0x10,
     /* U+006B "k" */
-    0x4f, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xf4,
-    0x5, 0xff, 0xff, 0xc0, 0x4f, 0xff, 0xff, 0x40,
-    0xcf, 0xff, 0xf2, 0x4, 0xff, 0xff, 0xf4, 0x4f,
-    0xff, 0xf7, 0x0, 0x4f, 0xff, 0xff, 0x5c, 0xff,
-    0xfc, 0x0, 0x4, 0xff, 0xff, 0xf9, 0xff, 0xff,
-    0x20, 0x0, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xf3,
-    0x0, 0x4, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x0,
-    0x4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x0,
-    0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x4,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x4f,
-    0xff, 0xff, 0x7a, 0xff, 0xff, 0xf1, 0x4, 0xff,
-    0xff, 0xf4, 0x5f, 0xff, 0xff, 0x60, 0x4f, 0xff,
-    0xff, 0x41, 0xff, 0xff, 0xfb, 0x4, 0xff, 0xff,
-    0xf4, 0xc, 0xff, 0xff, 0xf1, 0x4f, 0xff, 0xff,
-    0x40, 0x7f, 0xff, 0xff, 0x54, 0xff, 0xff, 0xf4,
-    0x3, 0xff, 0xff, 0xfa,
-
+    0x4f, 0xfe, 0x40, 0xf, 0xff, 0xf8, 0x7, 0xff,
+    0x4d, 0x7f, 0xf6, 0x0, 0x7f, 0x48, 0x6, 0xe0,
+    0xf, 0xc8, 0x60, 0x14, 0x10, 0x7, 0xc3, 0x0,
+    0x11, 0xb8, 0x7, 0xec, 0x30, 0xb, 0x80, 0x3f,
+    0x98, 0x3, 0x8, 0x7, 0xff, 0xa, 0xc0, 0x3f,
+    0xf8, 0x4a, 0x1, 0xff, 0xc2, 0x22, 0x0, 0x7f,
+    0xf0, 0x94, 0x3, 0xff, 0x85, 0x60, 0x1f, 0xa1,
+    0x40, 0x31, 0x88, 0x7, 0xc7, 0xe0, 0x1c, 0xe0,
+    0x1f, 0x90, 0x3, 0xb4, 0x3, 0xf0, 0x98, 0x6,
+    0x41, 0x0, 0xfd, 0x60, 0x1c, 0x80, 0x1f, 0x90,
+    0x3, 0xbc,
     /* U+006C "l" */
-    0x1f, 0xff, 0xff, 0x71, 0xff, 0xff, 0xf7, 0x1f,
-    0xff, 0xff, 0x71, 0xff, 0xff, 0xf7, 0x1f, 0xff,
-    0xff, 0x71, 0xff, 0xff, 0xf7, 0x1f, 0xff, 0xff,
-    0x71, 0xff, 0xff, 0xf7, 0x1f, 0xff, 0xff, 0x71,
-    0xff, 0xff, 0xf7, 0x1f, 0xff, 0xff, 0x71, 0xff,
-    0xff, 0xf7, 0x1f, 0xff, 0xff, 0x71, 0xff, 0xff,
-    0xf7, 0x1f, 0xff, 0xff, 0x71, 0xff, 0xff, 0xf7,
-    0x1f, 0xff, 0xff, 0x71, 0xff, 0xff, 0xf7, 0x1f,
-    0xff, 0xff, 0x71, 0xff, 0xff, 0xf7, 0x1f, 0xff,
-    0xff, 0x71, 0xff, 0xff, 0xf7, 0x1f, 0xff, 0xff,
-    0x71, 0xff, 0xff, 0xf7,
-
+    0x1f, 0xfe, 0x70, 0xf, 0xff, 0xf8, 0x7, 0xff,
+    0xfc, 0x3, 0xfe,
     /* U+006D "m" */
-    0x4f, 0xff, 0xfa, 0x4, 0xbe, 0xeb, 0x20, 0x4,
-    0xbe, 0xea, 0x30, 0x4, 0xff, 0xff, 0xf6, 0xff,
-    0xff, 0xff, 0x26, 0xff, 0xff, 0xff, 0x50, 0x4f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff,
-    0xff, 0xfe, 0x4, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x4f, 0xff,
-    0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xa4, 0xff, 0xff, 0xfd, 0x4, 0xff, 0xff,
-    0xff, 0x11, 0xff, 0xff, 0xfc, 0x4f, 0xff, 0xff,
-    0x80, 0x1f, 0xff, 0xff, 0xb0, 0xd, 0xff, 0xff,
-    0xc4, 0xff, 0xff, 0xf5, 0x0, 0xff, 0xff, 0xf9,
-    0x0, 0xcf, 0xff, 0xfc, 0x4f, 0xff, 0xff, 0x40,
-    0xf, 0xff, 0xff, 0x80, 0xc, 0xff, 0xff, 0xc4,
-    0xff, 0xff, 0xf4, 0x0, 0xff, 0xff, 0xf8, 0x0,
-    0xcf, 0xff, 0xfc, 0x4f, 0xff, 0xff, 0x40, 0xf,
-    0xff, 0xff, 0x80, 0xc, 0xff, 0xff, 0xc4, 0xff,
-    0xff, 0xf4, 0x0, 0xff, 0xff, 0xf8, 0x0, 0xcf,
-    0xff, 0xfc, 0x4f, 0xff, 0xff, 0x40, 0xf, 0xff,
-    0xff, 0x80, 0xc, 0xff, 0xff, 0xc4, 0xff, 0xff,
-    0xf4, 0x0, 0xff, 0xff, 0xf8, 0x0, 0xcf, 0xff,
-    0xfc, 0x4f, 0xff, 0xff, 0x40, 0xf, 0xff, 0xff,
-    0x80, 0xc, 0xff, 0xff, 0xc4, 0xff, 0xff, 0xf4,
-    0x0, 0xff, 0xff, 0xf8, 0x0, 0xcf, 0xff, 0xfc,
-    0x4f, 0xff, 0xff, 0x40, 0xf, 0xff, 0xff, 0x80,
-    0xc, 0xff, 0xff, 0xc0,
-
+    0x4f, 0xfd, 0x40, 0x97, 0xdc, 0xb2, 0x0, 0x25,
+    0xf7, 0x28, 0xc0, 0x3e, 0x56, 0xb4, 0x11, 0x26,
+    0x93, 0x5a, 0x8, 0x97, 0x14, 0x3, 0xe9, 0x0,
+    0xf7, 0xc8, 0x7, 0xac, 0x3, 0xff, 0x84, 0x40,
+    0x1f, 0xb, 0x0, 0x7c, 0x20, 0x1f, 0xfc, 0x2c,
+    0x0, 0xf1, 0x75, 0x80, 0x7b, 0xb8, 0x1, 0xcc,
+    0x1, 0xe5, 0x5, 0x0, 0xe4, 0x11, 0x10, 0x7,
+    0xfd, 0xa0, 0x20, 0x1c, 0x40, 0x1, 0x0, 0xff,
+    0x84, 0x3, 0xe1, 0x0, 0xff, 0xff, 0x80, 0x7f,
+    0xff, 0xc0, 0x3f, 0xfb, 0xc0,
     /* U+006E "n" */
-    0x4f, 0xff, 0xfb, 0x5, 0xcf, 0xda, 0x20, 0x4,
-    0xff, 0xff, 0xf9, 0xff, 0xff, 0xfe, 0x30, 0x4f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x4, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x4f, 0xff,
-    0xff, 0xfe, 0xff, 0xff, 0xff, 0x74, 0xff, 0xff,
-    0xfc, 0x3, 0xff, 0xff, 0xf8, 0x4f, 0xff, 0xff,
-    0x70, 0xf, 0xff, 0xff, 0x84, 0xff, 0xff, 0xf5,
-    0x0, 0xff, 0xff, 0xf8, 0x4f, 0xff, 0xff, 0x40,
-    0xf, 0xff, 0xff, 0x84, 0xff, 0xff, 0xf4, 0x0,
-    0xff, 0xff, 0xf8, 0x4f, 0xff, 0xff, 0x40, 0xf,
-    0xff, 0xff, 0x84, 0xff, 0xff, 0xf4, 0x0, 0xff,
-    0xff, 0xf8, 0x4f, 0xff, 0xff, 0x40, 0xf, 0xff,
-    0xff, 0x84, 0xff, 0xff, 0xf4, 0x0, 0xff, 0xff,
-    0xf8, 0x4f, 0xff, 0xff, 0x40, 0xf, 0xff, 0xff,
-    0x84, 0xff, 0xff, 0xf4, 0x0, 0xff, 0xff, 0xf8,
-    0x4f, 0xff, 0xff, 0x40, 0xf, 0xff, 0xff, 0x80,
-
+    0x4f, 0xfd, 0x60, 0xb9, 0xfb, 0x44, 0x1, 0xf2,
+    0x4d, 0x18, 0x12, 0xe1, 0x80, 0x7c, 0xc0, 0x1c,
+    0x3c, 0x1, 0xff, 0xc2, 0x24, 0x0, 0xf8, 0x40,
+    0x3c, 0x60, 0x1e, 0x3e, 0xc0, 0xe, 0xf0, 0xf,
+    0x58, 0x18, 0x7, 0xfe, 0x20, 0xf, 0xfe, 0x10,
+    0x80, 0x7f, 0xff, 0xc0, 0x3f, 0xfd, 0x20,
     /* U+006F "o" */
-    0x0, 0x0, 0x4a, 0xef, 0xec, 0x82, 0x0, 0x0,
-    0x0, 0x1c, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x0,
-    0x8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x30,
-    0x1f, 0xff, 0xff, 0xe7, 0x9f, 0xff, 0xff, 0xc0,
-    0x8f, 0xff, 0xff, 0x40, 0xa, 0xff, 0xff, 0xf3,
-    0xcf, 0xff, 0xff, 0x0, 0x5, 0xff, 0xff, 0xf7,
-    0xef, 0xff, 0xfc, 0x0, 0x2, 0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xfb, 0x0, 0x1, 0xff, 0xff, 0xf9,
-    0xef, 0xff, 0xfc, 0x0, 0x2, 0xff, 0xff, 0xf8,
-    0xcf, 0xff, 0xfe, 0x0, 0x4, 0xff, 0xff, 0xf6,
-    0x9f, 0xff, 0xff, 0x40, 0xa, 0xff, 0xff, 0xf2,
-    0x2f, 0xff, 0xff, 0xe6, 0x9f, 0xff, 0xff, 0xb0,
-    0x9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x20,
-    0x1, 0xef, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x2d, 0xff, 0xff, 0xff, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x5b, 0xef, 0xec, 0x81, 0x0, 0x0,
-
+    0x0, 0xc9, 0x5d, 0xfd, 0x90, 0x40, 0x1e, 0x1c,
+    0xb5, 0x10, 0x13, 0x7d, 0x80, 0xe, 0xc3, 0x0,
+    0xfc, 0xf2, 0x1, 0x41, 0x0, 0x7f, 0x98, 0xc0,
+    0x5c, 0x3, 0xc, 0x30, 0x7, 0x78, 0x48, 0x7,
+    0x53, 0xca, 0x80, 0x63, 0x32, 0x0, 0x72, 0x0,
+    0x3c, 0x3, 0x90, 0x80, 0x31, 0x80, 0x4e, 0x1,
+    0xde, 0x20, 0x19, 0xc0, 0x23, 0x0, 0xe1, 0x10,
+    0x6, 0x70, 0x8, 0xc0, 0x38, 0x48, 0x3, 0x10,
+    0x4, 0xc0, 0x1d, 0xca, 0x1, 0x85, 0x0, 0x1c,
+    0x1, 0xc9, 0x60, 0x1d, 0x4d, 0x2a, 0x1, 0x90,
+    0x88, 0xc0, 0x18, 0x65, 0x80, 0x3a, 0x40, 0x10,
+    0x20, 0x1f, 0xe7, 0x20, 0x0, 0xe1, 0x0, 0x7e,
+    0x88, 0x0, 0x62, 0xda, 0x41, 0x1, 0x37, 0xe7,
+    0x0, 0x80,
     /* U+0070 "p" */
-    0x5f, 0xff, 0xf8, 0x5, 0xcf, 0xe9, 0x20, 0x0,
-    0x5f, 0xff, 0xfc, 0x9f, 0xff, 0xff, 0xe3, 0x0,
-    0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0,
-    0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70,
-    0x5f, 0xff, 0xff, 0xfd, 0xef, 0xff, 0xff, 0xd0,
-    0x5f, 0xff, 0xff, 0xa0, 0xc, 0xff, 0xff, 0xf3,
-    0x5f, 0xff, 0xff, 0x40, 0x6, 0xff, 0xff, 0xf5,
-    0x5f, 0xff, 0xff, 0x20, 0x3, 0xff, 0xff, 0xf7,
-    0x5f, 0xff, 0xff, 0x20, 0x2, 0xff, 0xff, 0xf8,
-    0x5f, 0xff, 0xff, 0x20, 0x3, 0xff, 0xff, 0xf6,
-    0x5f, 0xff, 0xff, 0x20, 0x7, 0xff, 0xff, 0xf4,
-    0x5f, 0xff, 0xff, 0x50, 0x1e, 0xff, 0xff, 0xf1,
-    0x5f, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xb0,
-    0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40,
-    0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x0,
-    0x5f, 0xff, 0xff, 0xef, 0xff, 0xff, 0xc1, 0x0,
-    0x5f, 0xff, 0xff, 0x27, 0xcf, 0xd7, 0x0, 0x0,
-    0x5f, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-
+    0x5f, 0xfd, 0x0, 0xb9, 0xfd, 0x24, 0x1, 0xf9,
+    0x26, 0x8c, 0x5, 0xb0, 0xc0, 0x3e, 0x36, 0x0,
+    0xe1, 0xd0, 0xf, 0xfe, 0x18, 0xb8, 0x7, 0xe2,
+    0x10, 0xe, 0xa0, 0xf, 0x97, 0x78, 0xc0, 0x31,
+    0x18, 0x7, 0xb8, 0x1, 0x40, 0x1c, 0xc0, 0x1e,
+    0x60, 0x2, 0x80, 0x71, 0x0, 0x7f, 0x8, 0x7,
+    0x78, 0x7, 0xf0, 0x80, 0x77, 0x0, 0x7f, 0x20,
+    0x7, 0x10, 0x7, 0x9c, 0x6, 0x40, 0x39, 0x40,
+    0x3d, 0x5b, 0xc2, 0x1, 0x90, 0x40, 0x3e, 0x20,
+    0xf, 0x78, 0x7, 0xff, 0x9, 0x10, 0x1, 0xf0,
+    0x80, 0x71, 0xd0, 0x7, 0xec, 0x83, 0x2, 0x8c,
+    0x10, 0xf, 0xe7, 0xcf, 0xd7, 0x0, 0xff, 0xff,
+    0x80, 0x7f, 0xf7, 0x40,
     /* U+0071 "q" */
-    0x0, 0x0, 0x4b, 0xff, 0xc4, 0xb, 0xff, 0xf9,
-    0x0, 0x8, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xf9,
-    0x0, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9,
-    0x0, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9,
-    0x6, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xf9,
-    0xc, 0xff, 0xff, 0xf3, 0x1, 0xff, 0xff, 0xf9,
-    0xf, 0xff, 0xff, 0xb0, 0x0, 0xff, 0xff, 0xf9,
-    0x1f, 0xff, 0xff, 0x80, 0x0, 0xff, 0xff, 0xf9,
-    0x3f, 0xff, 0xff, 0x60, 0x0, 0xff, 0xff, 0xf9,
-    0x2f, 0xff, 0xff, 0x70, 0x0, 0xff, 0xff, 0xf9,
-    0xf, 0xff, 0xff, 0xb0, 0x3, 0xff, 0xff, 0xf9,
-    0xd, 0xff, 0xff, 0xf4, 0x8, 0xff, 0xff, 0xf9,
-    0x8, 0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0xf9,
-    0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9,
-    0x0, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9,
-    0x0, 0xb, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xf9,
-    0x0, 0x0, 0x6d, 0xfd, 0x60, 0xff, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xf9,
-
+    0x0, 0xc9, 0x7f, 0xec, 0x40, 0xbf, 0xfa, 0x40,
+    0x28, 0xb4, 0x0, 0x1d, 0xea, 0x0, 0x79, 0x9c,
+    0x3, 0xc4, 0x1, 0xf4, 0x0, 0x7f, 0xf0, 0x98,
+    0x40, 0x39, 0x0, 0x3f, 0x50, 0x7, 0x65, 0xf0,
+    0x7, 0xc6, 0x1, 0x90, 0xc0, 0x40, 0x3c, 0x20,
+    0x1c, 0x60, 0x1f, 0xc4, 0x1, 0xdc, 0x1, 0xfc,
+    0x20, 0x1c, 0x20, 0x1f, 0xc4, 0x1, 0xd8, 0x0,
+    0x30, 0xf, 0x88, 0x3, 0x22, 0x2, 0xc0, 0x3e,
+    0x50, 0xe, 0xbe, 0x70, 0xf, 0xa4, 0x3, 0xc2,
+    0x1, 0xf8, 0x5c, 0x3, 0xff, 0x87, 0x8, 0x1,
+    0xce, 0x1, 0xfd, 0x72, 0x40, 0x53, 0x0, 0x1f,
+    0xe6, 0xdf, 0xd6, 0x0, 0xff, 0xff, 0x80, 0x7f,
+    0xf8, 0x0,
     /* U+0072 "r" */
-    0x5f, 0xff, 0xf8, 0x8, 0xef, 0x55, 0xff, 0xff,
-    0xc7, 0xff, 0xf5, 0x5f, 0xff, 0xff, 0xff, 0xff,
-    0x55, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x5f, 0xff,
-    0xff, 0xff, 0xff, 0x55, 0xff, 0xff, 0xff, 0xa4,
-    0x52, 0x5f, 0xff, 0xff, 0xb0, 0x0, 0x5, 0xff,
-    0xff, 0xf6, 0x0, 0x0, 0x5f, 0xff, 0xff, 0x40,
-    0x0, 0x5, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x5f,
-    0xff, 0xff, 0x40, 0x0, 0x5, 0xff, 0xff, 0xf4,
-    0x0, 0x0, 0x5f, 0xff, 0xff, 0x40, 0x0, 0x5,
-    0xff, 0xff, 0xf4, 0x0, 0x0, 0x5f, 0xff, 0xff,
-    0x40, 0x0, 0x5, 0xff, 0xff, 0xf4, 0x0, 0x0,
-    0x5f, 0xff, 0xff, 0x40, 0x0, 0x0,
-
+    0x5f, 0xfd, 0x1, 0x1d, 0xea, 0x1, 0xc8, 0xee,
+    0x10, 0xf, 0x8e, 0x0, 0x3f, 0xfa, 0xab, 0x74,
+    0xe0, 0x1e, 0x4a, 0x45, 0x20, 0xf, 0x68, 0x7,
+    0xf8, 0x80, 0x3f, 0xff, 0xe0, 0x1f, 0xfc, 0x50,
     /* U+0073 "s" */
-    0x0, 0x5, 0xbd, 0xfe, 0xc9, 0x30, 0x0, 0x2d,
-    0xff, 0xff, 0xff, 0xff, 0x60, 0x2e, 0xff, 0xff,
-    0xff, 0xff, 0xf6, 0xa, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x60, 0xdf, 0xff, 0xff, 0xb6, 0x7c, 0xf6,
-    0xc, 0xff, 0xff, 0xf2, 0x0, 0x4, 0x50, 0x8f,
-    0xff, 0xff, 0xd7, 0x10, 0x0, 0x1, 0xef, 0xff,
-    0xff, 0xff, 0xa1, 0x0, 0x2, 0xcf, 0xff, 0xff,
-    0xff, 0xe2, 0x0, 0x0, 0x4b, 0xff, 0xff, 0xff,
-    0xe0, 0x10, 0x0, 0x2, 0xcf, 0xff, 0xff, 0x5e,
-    0x70, 0x0, 0x9, 0xff, 0xff, 0xf7, 0xef, 0xd8,
-    0x58, 0xff, 0xff, 0xff, 0x4e, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf0, 0xef, 0xff, 0xff, 0xff, 0xff,
-    0xf4, 0xb, 0xff, 0xff, 0xff, 0xff, 0xe5, 0x0,
-    0x2, 0x8c, 0xef, 0xdb, 0x70, 0x0, 0x0,
-
+    0x0, 0x96, 0xf7, 0xfb, 0x24, 0xc0, 0x22, 0xda,
+    0x42, 0x1, 0x36, 0xc6, 0x2, 0xc2, 0x0, 0xff,
+    0x40, 0x80, 0x7f, 0xce, 0x1, 0xc9, 0x30, 0x60,
+    0x10, 0x80, 0x74, 0xb3, 0xe5, 0x98, 0x20, 0x7,
+    0x7b, 0x88, 0x22, 0x84, 0x88, 0x6, 0x28, 0xea,
+    0x10, 0x0, 0xe1, 0x80, 0x79, 0x7c, 0x80, 0x5,
+    0x96, 0x80, 0x1c, 0x38, 0x2, 0x0, 0x4b, 0xd3,
+    0x0, 0xc2, 0xbe, 0xe0, 0x11, 0x28, 0x7, 0x10,
+    0x46, 0xc2, 0xc3, 0x0, 0x71, 0x80, 0x9, 0xe9,
+    0xc0, 0x3c, 0x80, 0x1f, 0xf5, 0x82, 0x80, 0x7e,
+    0x1a, 0x40, 0xbd, 0x73, 0x10, 0x24, 0x8e, 0x50,
+    0x0,
     /* U+0074 "t" */
-    0x0, 0xe, 0xff, 0xfc, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x1f, 0xff, 0xfc, 0x0,
-    0x0, 0x2, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x4f,
-    0xff, 0xfc, 0x0, 0xa, 0xff, 0xff, 0xff, 0xff,
-    0xf8, 0xaf, 0xff, 0xff, 0xff, 0xff, 0x8a, 0xff,
-    0xff, 0xff, 0xff, 0xf8, 0xaf, 0xff, 0xff, 0xff,
-    0xff, 0x80, 0xa, 0xff, 0xff, 0xf1, 0x0, 0x0,
-    0x9f, 0xff, 0xff, 0x0, 0x0, 0x9, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0x0, 0x0,
-    0x9, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x9f, 0xff,
-    0xff, 0x0, 0x0, 0x9, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x9f, 0xff, 0xff, 0x30, 0x0, 0x8, 0xff,
-    0xff, 0xfe, 0xa8, 0x0, 0x6f, 0xff, 0xff, 0xff,
-    0x80, 0x2, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x8,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x4, 0xbe, 0xfe,
-    0xc4,
-
+    0x0, 0xbb, 0xfe, 0xc0, 0xf, 0x8, 0x7, 0xf0,
+    0x80, 0x7f, 0x8c, 0x3, 0xfc, 0xc0, 0x1f, 0xab,
+    0xec, 0x3, 0x1f, 0xfa, 0x0, 0x3f, 0xfa, 0xb5,
+    0xea, 0x1, 0xdd, 0xf0, 0x0, 0x30, 0xe, 0x10,
+    0xf, 0xff, 0xa9, 0x80, 0x61, 0x0, 0xed, 0xa8,
+    0x0, 0x70, 0x7, 0xa, 0x80, 0x48, 0x1, 0xfe,
+    0x27, 0x0, 0xff, 0x45, 0xa0, 0x80, 0x9e, 0x0,
     /* U+0075 "u" */
-    0x3f, 0xff, 0xff, 0x50, 0x1f, 0xff, 0xff, 0x73,
-    0xff, 0xff, 0xf5, 0x1, 0xff, 0xff, 0xf7, 0x3f,
-    0xff, 0xff, 0x50, 0x1f, 0xff, 0xff, 0x73, 0xff,
-    0xff, 0xf5, 0x1, 0xff, 0xff, 0xf7, 0x3f, 0xff,
-    0xff, 0x50, 0x1f, 0xff, 0xff, 0x73, 0xff, 0xff,
-    0xf5, 0x1, 0xff, 0xff, 0xf7, 0x3f, 0xff, 0xff,
-    0x50, 0x1f, 0xff, 0xff, 0x73, 0xff, 0xff, 0xf5,
-    0x1, 0xff, 0xff, 0xf7, 0x3f, 0xff, 0xff, 0x50,
-    0x1f, 0xff, 0xff, 0x73, 0xff, 0xff, 0xf5, 0x1,
-    0xff, 0xff, 0xf7, 0x3f, 0xff, 0xff, 0x60, 0x2f,
-    0xff, 0xff, 0x73, 0xff, 0xff, 0xf9, 0x8, 0xff,
-    0xff, 0xf7, 0x1f, 0xff, 0xff, 0xfe, 0xff, 0xff,
-    0xff, 0x70, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf7, 0x6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x70, 0xb, 0xff, 0xff, 0xfc, 0xcf, 0xff, 0xf7,
-    0x0, 0x8, 0xcf, 0xd7, 0x7, 0xff, 0xff, 0x70,
-
+    0x3f, 0xfe, 0x50, 0x1f, 0xfe, 0x70, 0xf, 0xff,
+    0xf8, 0x7, 0xff, 0xd8, 0xc0, 0xc0, 0x3f, 0xf7,
+    0x85, 0x0, 0x78, 0x80, 0x39, 0xb9, 0xc0, 0x3c,
+    0x22, 0x0, 0xe1, 0x0, 0xfd, 0x0, 0x1f, 0xfc,
+    0x26, 0x40, 0xe, 0x33, 0x0, 0x7d, 0x6e, 0x60,
+    0x51, 0x96, 0x1, 0xc0,
     /* U+0076 "v" */
-    0x4f, 0xff, 0xff, 0x90, 0x2, 0xff, 0xff, 0xf8,
-    0xf, 0xff, 0xff, 0xc0, 0x5, 0xff, 0xff, 0xf3,
-    0xb, 0xff, 0xff, 0xe0, 0x7, 0xff, 0xff, 0xe0,
-    0x6, 0xff, 0xff, 0xf0, 0xa, 0xff, 0xff, 0xa0,
-    0x2, 0xff, 0xff, 0xf3, 0xc, 0xff, 0xff, 0x60,
-    0x0, 0xef, 0xff, 0xf5, 0xf, 0xff, 0xff, 0x10,
-    0x0, 0x9f, 0xff, 0xf7, 0x1f, 0xff, 0xfc, 0x0,
-    0x0, 0x5f, 0xff, 0xf9, 0x4f, 0xff, 0xf8, 0x0,
-    0x0, 0x1f, 0xff, 0xfc, 0x6f, 0xff, 0xf3, 0x0,
-    0x0, 0xc, 0xff, 0xfe, 0x9f, 0xff, 0xf0, 0x0,
-    0x0, 0x8, 0xff, 0xff, 0xcf, 0xff, 0xa0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0xaf, 0xff, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xff, 0xff, 0xf0, 0x0, 0x0,
-
+    0x4f, 0xfe, 0x90, 0x1, 0x7f, 0xf4, 0x20, 0x7,
+    0x28, 0x1, 0xc0, 0x3a, 0xc1, 0x0, 0x31, 0x0,
+    0x8, 0x3, 0x9, 0x86, 0x80, 0x61, 0x0, 0x68,
+    0x6, 0x40, 0x2, 0x0, 0x71, 0x83, 0x0, 0x6c,
+    0x0, 0x10, 0x80, 0x66, 0x3, 0x0, 0xce, 0x1,
+    0x38, 0x6, 0x21, 0x0, 0xc6, 0x20, 0x16, 0x0,
+    0x6e, 0x50, 0xc, 0x80, 0x19, 0x0, 0x32, 0x90,
+    0x6, 0xb0, 0xc, 0x26, 0x1, 0x17, 0x80, 0x63,
+    0x0, 0xe4, 0x0, 0x85, 0x40, 0x25, 0x0, 0xf5,
+    0x80, 0x63, 0x0, 0xb0, 0x3, 0xc6, 0x1, 0xf9,
+    0xc0, 0x3e, 0x50, 0xf, 0x10, 0x80, 0x7d, 0x80,
+    0x1e, 0x50, 0xf, 0xc8, 0x1, 0xec, 0x0, 0xfc,
+    0x44, 0x0, 0xe4, 0x0, 0xc0,
     /* U+0077 "w" */
-    0xf, 0xff, 0xff, 0x90, 0x7, 0xff, 0xff, 0xf3,
-    0x0, 0xbf, 0xff, 0xfd, 0xb, 0xff, 0xff, 0xb0,
-    0x8, 0xff, 0xff, 0xf4, 0x0, 0xdf, 0xff, 0xf9,
-    0x7, 0xff, 0xff, 0xe0, 0xa, 0xff, 0xff, 0xf6,
-    0x0, 0xff, 0xff, 0xf4, 0x3, 0xff, 0xff, 0xf0,
-    0xc, 0xff, 0xff, 0xf8, 0x2, 0xff, 0xff, 0xf0,
-    0x0, 0xef, 0xff, 0xf2, 0xe, 0xff, 0xdf, 0xfa,
-    0x4, 0xff, 0xff, 0xc0, 0x0, 0xaf, 0xff, 0xf5,
-    0xf, 0xff, 0x9f, 0xfc, 0x7, 0xff, 0xff, 0x80,
-    0x0, 0x6f, 0xff, 0xf7, 0x1f, 0xff, 0x5f, 0xfe,
-    0x9, 0xff, 0xff, 0x40, 0x0, 0x2f, 0xff, 0xf9,
-    0x3f, 0xfe, 0x3f, 0xff, 0xc, 0xff, 0xff, 0x0,
-    0x0, 0xe, 0xff, 0xfc, 0x5f, 0xfd, 0x1f, 0xff,
-    0x1e, 0xff, 0xfb, 0x0, 0x0, 0xa, 0xff, 0xfe,
-    0x7f, 0xfb, 0xf, 0xff, 0x4f, 0xff, 0xf7, 0x0,
-    0x0, 0x6, 0xff, 0xff, 0xaf, 0xf9, 0xd, 0xff,
-    0x8f, 0xff, 0xf3, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xef, 0xf7, 0xb, 0xff, 0xdf, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0xff, 0xf5, 0xa, 0xff,
-    0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x9f, 0xff,
-    0xff, 0xf3, 0x8, 0xff, 0xff, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0xff, 0xf1, 0x6, 0xff,
-    0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xf0, 0x4, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xff, 0xff, 0xe0, 0x2, 0xff,
-    0xff, 0xfa, 0x0, 0x0,
-
+    0xf, 0xfe, 0x90, 0x3, 0xff, 0xf1, 0x80, 0x2f,
+    0xff, 0x68, 0x20, 0x6, 0x20, 0x7, 0x80, 0x73,
+    0x80, 0x18, 0x3, 0x20, 0x60, 0x6, 0x50, 0x1,
+    0x0, 0x71, 0x0, 0x8, 0x3, 0x68, 0x20, 0x6,
+    0x10, 0x3, 0x0, 0x77, 0x1, 0x0, 0x72, 0x1,
+    0x88, 0x6, 0x20, 0x20, 0x1, 0x0, 0x8, 0x18,
+    0x3, 0x18, 0x4, 0x80, 0x19, 0xc0, 0x40, 0x8,
+    0x0, 0x60, 0x30, 0xc, 0x80, 0x16, 0x0, 0x62,
+    0x10, 0xb, 0x0, 0x4, 0x1c, 0x1, 0xb0, 0x2,
+    0x40, 0xd, 0xc4, 0x0, 0x16, 0x0, 0x8, 0x28,
+    0x6, 0x40, 0x8, 0x84, 0x2, 0x56, 0x0, 0x19,
+    0x0, 0x42, 0x40, 0x12, 0x0, 0x72, 0x0, 0x44,
+    0x40, 0x3, 0x8, 0x4, 0xa2, 0x1, 0x60, 0x7,
+    0x60, 0x4, 0x3a, 0x0, 0x20, 0x20, 0x6, 0x0,
+    0x64, 0x0, 0xe7, 0x0, 0xc8, 0x0, 0xe0, 0x60,
+    0x2, 0x80, 0x42, 0x60, 0x1c, 0x24, 0x1, 0x8,
+    0x0, 0x80, 0x40, 0x4, 0x1, 0x20, 0x7, 0xc8,
+    0x1, 0xe6, 0x2, 0x0, 0xf6, 0x0, 0x7d, 0x80,
+    0x1e, 0x20, 0xe0, 0xf, 0x20, 0x7, 0xc8, 0x1,
+    0xe1, 0x2, 0x0, 0xe1, 0x20, 0xf, 0x84, 0x80,
+    0x30, 0x80, 0x18, 0x3, 0x90, 0x3,
     /* U+0078 "x" */
-    0xe, 0xff, 0xff, 0xa0, 0x1f, 0xff, 0xfe, 0x0,
-    0x9f, 0xff, 0xfd, 0x5, 0xff, 0xff, 0x80, 0x3,
-    0xff, 0xff, 0xf0, 0x9f, 0xff, 0xf2, 0x0, 0xd,
-    0xff, 0xff, 0x2c, 0xff, 0xfc, 0x0, 0x0, 0x7f,
-    0xff, 0xf5, 0xff, 0xff, 0x60, 0x0, 0x1, 0xff,
-    0xff, 0xbf, 0xff, 0xf0, 0x0, 0x0, 0xb, 0xff,
-    0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x5f, 0xff,
-    0xff, 0xff, 0x40, 0x0, 0x0, 0x5, 0xff, 0xff,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x2f, 0xff, 0xfb, 0xff,
-    0xff, 0x30, 0x0, 0x9, 0xff, 0xff, 0x5f, 0xff,
-    0xf9, 0x0, 0x0, 0xff, 0xff, 0xd2, 0xff, 0xff,
-    0xf1, 0x0, 0x6f, 0xff, 0xfa, 0xf, 0xff, 0xff,
-    0x70, 0xd, 0xff, 0xff, 0x60, 0xcf, 0xff, 0xfd,
-    0x3, 0xff, 0xff, 0xf3, 0x9, 0xff, 0xff, 0xf4,
-    0xaf, 0xff, 0xff, 0x10, 0x6f, 0xff, 0xff, 0xa0,
-
+    0xe, 0xff, 0xd4, 0x3, 0xff, 0xb8, 0x0, 0xe0,
+    0x19, 0xc1, 0x0, 0x33, 0x0, 0x28, 0x3, 0x10,
+    0x60, 0x6, 0xa0, 0x1, 0x90, 0x6, 0x25, 0x0,
+    0x8c, 0x80, 0x2a, 0x0, 0xce, 0x60, 0x15, 0x0,
+    0x66, 0x0, 0xdc, 0x1, 0x98, 0x3, 0xa, 0x0,
+    0x48, 0x1, 0x28, 0x7, 0xb8, 0x3, 0xee, 0x0,
+    0xff, 0xe1, 0x10, 0x7, 0xa4, 0x3, 0xea, 0x0,
+    0xe2, 0x30, 0x9, 0x0, 0x23, 0x30, 0x6, 0xb0,
+    0xd, 0xc0, 0x1a, 0x80, 0x33, 0x0, 0x44, 0xe0,
+    0x19, 0x84, 0x0, 0xc0, 0x19, 0xc8, 0x3, 0x98,
+    0x1, 0x60, 0x1b, 0x0, 0xc0, 0x35, 0x1, 0x90,
+    0x6, 0x50, 0x50, 0xc, 0x49, 0x20, 0x1c, 0x41,
+    0xe0, 0x1d, 0xc0,
     /* U+0079 "y" */
-    0x9f, 0xff, 0xff, 0x40, 0xb, 0xff, 0xff, 0xf0,
-    0x5f, 0xff, 0xff, 0x60, 0xd, 0xff, 0xff, 0xb0,
-    0x1f, 0xff, 0xff, 0x80, 0xf, 0xff, 0xff, 0x70,
-    0xc, 0xff, 0xff, 0xb0, 0x1f, 0xff, 0xff, 0x20,
-    0x8, 0xff, 0xff, 0xd0, 0x3f, 0xff, 0xfe, 0x0,
-    0x3, 0xff, 0xff, 0xf0, 0x5f, 0xff, 0xfa, 0x0,
-    0x0, 0xff, 0xff, 0xf2, 0x7f, 0xff, 0xf6, 0x0,
-    0x0, 0xaf, 0xff, 0xf4, 0xaf, 0xff, 0xf1, 0x0,
-    0x0, 0x6f, 0xff, 0xf6, 0xcf, 0xff, 0xd0, 0x0,
-    0x0, 0x2f, 0xff, 0xf9, 0xef, 0xff, 0x90, 0x0,
-    0x0, 0xd, 0xff, 0xfb, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0x9, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xff, 0xff, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0xb, 0x8c, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0xe, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0xe, 0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0xe, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xce, 0xfc, 0x60, 0x0, 0x0, 0x0, 0x0,
-
+    0x9f, 0xfe, 0x40, 0x5, 0xff, 0xf0, 0x60, 0x7,
+    0x10, 0x1, 0x80, 0x32, 0x2, 0x0, 0x77, 0x0,
+    0x8, 0x3, 0x60, 0x9, 0x80, 0x63, 0x1, 0x0,
+    0xe5, 0x0, 0x20, 0x6, 0x60, 0x20, 0xc, 0x24,
+    0x0, 0xb0, 0xc, 0x40, 0xc0, 0x19, 0x0, 0x23,
+    0x0, 0xe2, 0x20, 0x6, 0xc0, 0xc, 0xa0, 0x19,
+    0xb4, 0x3, 0x38, 0x6, 0xc0, 0xc, 0x4c, 0x1,
+    0x10, 0x80, 0x64, 0x0, 0xde, 0x40, 0x12, 0x0,
+    0x71, 0x10, 0x2, 0x21, 0x0, 0xb4, 0x3, 0xc8,
+    0x1, 0x20, 0x6, 0x40, 0xf, 0x68, 0x7, 0xc6,
+    0x1, 0xf2, 0x0, 0x7c, 0x80, 0x1f, 0x90, 0x3,
+    0xd6, 0x1, 0xfb, 0x0, 0x3c, 0x60, 0x1f, 0x90,
+    0x3, 0x90, 0x3, 0xf8, 0x40, 0x3b, 0x40, 0x3f,
+    0x90, 0x3, 0x90, 0x3, 0xfa, 0xc0, 0x31, 0x10,
+    0x3, 0xd7, 0x18, 0x40, 0x1a, 0xc0, 0x3e, 0x57,
+    0x30, 0xc, 0x2c, 0x1, 0xff, 0xc2, 0x90, 0xf,
+    0xfe, 0x12, 0xb8, 0x7, 0xe8, 0x31, 0x3, 0x9a,
+    0x0, 0xfc,
     /* U+007A "z" */
-    0x8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x0,
-    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x8,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x0, 0x8f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x1, 0x33,
-    0x33, 0x8f, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x1e, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0xff, 0xff, 0x20, 0x0, 0x0, 0x6, 0xff,
-    0xff, 0xff, 0x70, 0x0, 0x0, 0x2, 0xff, 0xff,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xfa, 0x0,
-    0x0, 0x0, 0xd, 0xff, 0xff, 0xff, 0x43, 0x33,
-    0x33, 0x10, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf5, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x50, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x50,
-
+    0x8, 0xff, 0xff, 0xac, 0x3, 0xff, 0xc7, 0x39,
+    0x99, 0xc0, 0x3c, 0x60, 0x1, 0x33, 0x89, 0x80,
+    0x38, 0xe0, 0x3, 0xd4, 0x20, 0x1d, 0xc0, 0x1e,
+    0x64, 0x0, 0xe8, 0x20, 0xe, 0x29, 0x0, 0xe4,
+    0x70, 0xf, 0x70, 0x7, 0xa8, 0x3, 0xce, 0x60,
+    0x1d, 0x42, 0x1, 0xc7, 0x0, 0x1c, 0xaa, 0x0,
+    0xf7, 0x0, 0x7b, 0x8c, 0xf8, 0x40, 0x80, 0x3d,
+    0x79, 0x9c, 0x80, 0x1f, 0xfe, 0x10,
     /* U+007B "{" */
-    0x0, 0x0, 0x0, 0x5, 0xae, 0xff, 0xb0, 0x0,
-    0x0, 0xb, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x9,
-    0xff, 0xff, 0xff, 0xb0, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0xfb, 0x0, 0x0, 0x4f, 0xff, 0xfd, 0x63,
-    0x20, 0x0, 0x6, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0xaf, 0xff,
-    0xf7, 0x0, 0x0, 0x3a, 0xef, 0xff, 0xfe, 0x0,
-    0x0, 0x4, 0xff, 0xff, 0xff, 0x30, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0x30, 0x0, 0x0, 0x4, 0xff,
-    0xff, 0xfd, 0x20, 0x0, 0x0, 0x3c, 0xff, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0x1, 0xcf, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xa0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xfc, 0x30, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xff, 0xfb, 0x0, 0x0, 0xb, 0xff, 0xff,
-    0xff, 0xb0, 0x0, 0x0, 0x2e, 0xff, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0x18, 0xdf, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0x21,
-
+    0x0, 0xf9, 0x6b, 0xbf, 0xd6, 0x1, 0xeb, 0xa5,
+    0x10, 0xf, 0xd2, 0x80, 0x1f, 0xf3, 0x0, 0x7f,
+    0xc8, 0x1, 0x8a, 0x72, 0x40, 0x31, 0x0, 0x69,
+    0x63, 0x20, 0xf, 0xe6, 0x0, 0xf8, 0x40, 0x31,
+    0x80, 0x7f, 0xf2, 0x3c, 0x3, 0x8, 0x7, 0xc2,
+    0x1, 0xff, 0x88, 0x2, 0x20, 0xf, 0xc8, 0x1,
+    0x38, 0x7, 0xd4, 0x1, 0xb4, 0x3, 0x1d, 0x72,
+    0x80, 0x42, 0xe0, 0x19, 0xd4, 0x40, 0x36, 0x80,
+    0x7f, 0xd8, 0x60, 0x1f, 0xf7, 0x10, 0x7, 0x39,
+    0x80, 0x62, 0xf0, 0xe, 0x3c, 0xe3, 0x0, 0x89,
+    0x40, 0x3c, 0x3a, 0x1, 0xbc, 0x3, 0xe1, 0x40,
+    0x9, 0x80, 0x3f, 0x10, 0x4, 0x40, 0x1f, 0x84,
+    0x2, 0x10, 0xf, 0xde, 0x1, 0xff, 0xc5, 0x10,
+    0xf, 0x84, 0x3, 0xff, 0x18, 0x6, 0x20, 0xf,
+    0x84, 0x3, 0x79, 0x80, 0x79, 0x40, 0x31, 0xe7,
+    0xd8, 0x6, 0x14, 0x0, 0xff, 0xd2, 0x20, 0x1f,
+    0xf1, 0x7b, 0x90, 0x7, 0xf8, 0x63, 0x7f, 0xb6,
+    0x80,
     /* U+007C "|" */
-    0x5f, 0xff, 0x75, 0xff, 0xf7, 0x5f, 0xff, 0x75,
-    0xff, 0xf7, 0x5f, 0xff, 0x75, 0xff, 0xf7, 0x5f,
-    0xff, 0x75, 0xff, 0xf7, 0x5f, 0xff, 0x75, 0xff,
-    0xf7, 0x5f, 0xff, 0x75, 0xff, 0xf7, 0x5f, 0xff,
-    0x75, 0xff, 0xf7, 0x5f, 0xff, 0x75, 0xff, 0xf7,
-    0x5f, 0xff, 0x75, 0xff, 0xf7, 0x5f, 0xff, 0x75,
-    0xff, 0xf7, 0x5f, 0xff, 0x75, 0xff, 0xf7, 0x5f,
-    0xff, 0x75, 0xff, 0xf7, 0x5f, 0xff, 0x75, 0xff,
-    0xf7, 0x5f, 0xff, 0x75, 0xff, 0xf7, 0x5f, 0xff,
-    0x75, 0xff, 0xf7, 0x5f, 0xff, 0x75, 0xff, 0xf7,
-
+    0x5f, 0xf9, 0xc0, 0x3f, 0xff, 0xe0, 0x1f, 0xff,
+    0xf0, 0xe,
     /* U+007D "}" */
-    0x4f, 0xfe, 0xb7, 0x10, 0x0, 0x0, 0x4, 0xff,
-    0xff, 0xff, 0x40, 0x0, 0x0, 0x4f, 0xff, 0xff,
-    0xfe, 0x10, 0x0, 0x4, 0xff, 0xff, 0xff, 0xf6,
-    0x0, 0x0, 0x3, 0x4a, 0xff, 0xff, 0xa0, 0x0,
-    0x0, 0x0, 0xd, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xff, 0xd0, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff,
-    0xd7, 0x40, 0x0, 0x0, 0x1d, 0xff, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0x1c, 0xff, 0xff, 0xb0, 0x0,
-    0x0, 0x6, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x4,
-    0xff, 0xff, 0xff, 0xb0, 0x0, 0x0, 0xdf, 0xff,
-    0xf8, 0x20, 0x0, 0x0, 0x2f, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0xd, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x17,
-    0xff, 0xff, 0xa0, 0x0, 0x4, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xff, 0x20,
-    0x0, 0x4, 0xff, 0xff, 0xff, 0x60, 0x0, 0x0,
-    0x4f, 0xff, 0xfa, 0x30, 0x0, 0x0, 0x0, 0x22,
-    0x10, 0x0, 0x0, 0x0, 0x0,
-
+    0x4f, 0xf7, 0x5b, 0x88, 0x7, 0xf0, 0xa4, 0x72,
+    0x0, 0x7f, 0xea, 0x10, 0xf, 0xf8, 0x5c, 0x3,
+    0x26, 0x5a, 0x80, 0x6c, 0x0, 0xe3, 0x4a, 0x20,
+    0x9, 0x80, 0x3f, 0x30, 0x4, 0x20, 0x1f, 0xfc,
+    0x91, 0x0, 0xff, 0xe2, 0x18, 0x7, 0xe3, 0x0,
+    0xff, 0xc2, 0x1, 0x8, 0x7, 0xed, 0x0, 0xc8,
+    0x1, 0xf2, 0x0, 0x69, 0x0, 0xf8, 0x54, 0x2,
+    0x2d, 0x74, 0x0, 0xeb, 0x20, 0x8, 0xa3, 0xc0,
+    0x38, 0x70, 0xc0, 0x3f, 0xe7, 0x30, 0xf, 0xf2,
+    0x48, 0x7, 0xfd, 0x20, 0x19, 0xf6, 0xc0, 0x31,
+    0x10, 0x2, 0x78, 0x20, 0xe, 0x70, 0xd, 0x40,
+    0x1f, 0x10, 0x6, 0x20, 0xf, 0xbc, 0x2, 0x10,
+    0xf, 0xc2, 0x1, 0x18, 0x7, 0xe3, 0x0, 0xff,
+    0xc2, 0x1, 0xff, 0x98, 0x2, 0x10, 0xf, 0xb,
+    0x90, 0x4, 0xc0, 0x19, 0x3f, 0xa0, 0x3, 0x10,
+    0x7, 0xfe, 0xa0, 0xf, 0xfa, 0x48, 0x3, 0xf9,
+    0x71, 0x80, 0x39, 0x37, 0x5d, 0xf4, 0x60, 0x1e,
     /* U+007E "~" */
-    0x0, 0x4, 0x8a, 0x85, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0x4, 0xdf, 0xff, 0xff, 0xf8, 0x10,
-    0x0, 0x0, 0x0, 0xa8, 0x8f, 0xff, 0xff, 0xff,
-    0xff, 0xf9, 0x20, 0x0, 0x4d, 0xf8, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0xce, 0xff, 0xf8,
-    0xff, 0xd6, 0x20, 0x38, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf5, 0xf8, 0x0, 0x0, 0x0, 0x18, 0xef,
-    0xff, 0xff, 0xfd, 0x30, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xbe, 0xfc, 0x60, 0x0
+    0x0, 0x92, 0x2a, 0x14, 0x3, 0xfe, 0x20, 0x4d,
+    0xb7, 0x57, 0xaf, 0x81, 0x0, 0xfa, 0xa9, 0x16,
+    0x40, 0x1e, 0x7e, 0x92, 0x0, 0x93, 0x54, 0x1c,
+    0x3, 0xfc, 0xdb, 0xd9, 0xd6, 0x40, 0x18, 0xa7,
+    0x7f, 0x1c, 0x3, 0x84, 0xc4, 0x2, 0xd0, 0x7d,
+    0x62, 0x3, 0x8e, 0x71, 0x0, 0xf1, 0x62, 0xdc,
+    0x0, 0x78, 0x63, 0xa5, 0x4, 0xe, 0x74, 0xc0,
+    0x0
 };
 
 
@@ -2204,99 +1277,99 @@ static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
     {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
     {.bitmap_index = 0, .adv_w = 147, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
     {.bitmap_index = 0, .adv_w = 168, .box_w = 7, .box_h = 24, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 84, .adv_w = 273, .box_w = 15, .box_h = 10, .ofs_x = 1, .ofs_y = 14},
-    {.bitmap_index = 159, .adv_w = 385, .box_w = 22, .box_h = 25, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 434, .adv_w = 270, .box_w = 15, .box_h = 29, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 652, .adv_w = 468, .box_w = 28, .box_h = 29, .ofs_x = 1, .ofs_y = -2},
-    {.bitmap_index = 1058, .adv_w = 312, .box_w = 19, .box_h = 24, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1286, .adv_w = 137, .box_w = 6, .box_h = 10, .ofs_x = 1, .ofs_y = 14},
-    {.bitmap_index = 1316, .adv_w = 246, .box_w = 9, .box_h = 32, .ofs_x = 5, .ofs_y = -8},
-    {.bitmap_index = 1460, .adv_w = 246, .box_w = 10, .box_h = 32, .ofs_x = 1, .ofs_y = -8},
-    {.bitmap_index = 1620, .adv_w = 270, .box_w = 13, .box_h = 12, .ofs_x = 2, .ofs_y = 12},
-    {.bitmap_index = 1698, .adv_w = 384, .box_w = 20, .box_h = 20, .ofs_x = 2, .ofs_y = 2},
-    {.bitmap_index = 1898, .adv_w = 168, .box_w = 7, .box_h = 14, .ofs_x = 2, .ofs_y = -9},
-    {.bitmap_index = 1947, .adv_w = 216, .box_w = 10, .box_h = 6, .ofs_x = 2, .ofs_y = 6},
-    {.bitmap_index = 1977, .adv_w = 168, .box_w = 7, .box_h = 6, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 1998, .adv_w = 216, .box_w = 12, .box_h = 28, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 2166, .adv_w = 294, .box_w = 18, .box_h = 24, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2382, .adv_w = 294, .box_w = 10, .box_h = 24, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 2502, .adv_w = 294, .box_w = 16, .box_h = 24, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2694, .adv_w = 294, .box_w = 15, .box_h = 24, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 2874, .adv_w = 294, .box_w = 18, .box_h = 24, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3090, .adv_w = 294, .box_w = 15, .box_h = 24, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 3270, .adv_w = 294, .box_w = 16, .box_h = 24, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3462, .adv_w = 294, .box_w = 15, .box_h = 24, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3642, .adv_w = 294, .box_w = 17, .box_h = 24, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3846, .adv_w = 294, .box_w = 17, .box_h = 24, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 4050, .adv_w = 168, .box_w = 7, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 4110, .adv_w = 168, .box_w = 7, .box_h = 26, .ofs_x = 2, .ofs_y = -9},
-    {.bitmap_index = 4201, .adv_w = 384, .box_w = 20, .box_h = 20, .ofs_x = 2, .ofs_y = 2},
-    {.bitmap_index = 4401, .adv_w = 384, .box_w = 20, .box_h = 12, .ofs_x = 2, .ofs_y = 6},
-    {.bitmap_index = 4521, .adv_w = 384, .box_w = 20, .box_h = 20, .ofs_x = 2, .ofs_y = 2},
-    {.bitmap_index = 4721, .adv_w = 258, .box_w = 15, .box_h = 24, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 4901, .adv_w = 461, .box_w = 27, .box_h = 30, .ofs_x = 1, .ofs_y = -6},
-    {.bitmap_index = 5306, .adv_w = 300, .box_w = 19, .box_h = 24, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 5534, .adv_w = 300, .box_w = 18, .box_h = 24, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 5750, .adv_w = 246, .box_w = 14, .box_h = 24, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 5918, .adv_w = 306, .box_w = 17, .box_h = 24, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 6122, .adv_w = 270, .box_w = 15, .box_h = 24, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 6302, .adv_w = 258, .box_w = 15, .box_h = 24, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 6482, .adv_w = 288, .box_w = 16, .box_h = 24, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 6674, .adv_w = 312, .box_w = 17, .box_h = 24, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 6878, .adv_w = 150, .box_w = 7, .box_h = 24, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 6962, .adv_w = 180, .box_w = 9, .box_h = 24, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 7070, .adv_w = 276, .box_w = 17, .box_h = 24, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 7274, .adv_w = 240, .box_w = 15, .box_h = 24, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 7454, .adv_w = 366, .box_w = 21, .box_h = 24, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 7706, .adv_w = 312, .box_w = 17, .box_h = 24, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 7910, .adv_w = 318, .box_w = 20, .box_h = 24, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 8150, .adv_w = 288, .box_w = 17, .box_h = 24, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 8354, .adv_w = 318, .box_w = 20, .box_h = 31, .ofs_x = 0, .ofs_y = -7},
-    {.bitmap_index = 8664, .adv_w = 288, .box_w = 17, .box_h = 24, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 8868, .adv_w = 264, .box_w = 15, .box_h = 24, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 9048, .adv_w = 276, .box_w = 17, .box_h = 24, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 9252, .adv_w = 300, .box_w = 17, .box_h = 24, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 9456, .adv_w = 294, .box_w = 19, .box_h = 24, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 9684, .adv_w = 390, .box_w = 25, .box_h = 24, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 9984, .adv_w = 300, .box_w = 19, .box_h = 24, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 10212, .adv_w = 288, .box_w = 18, .box_h = 24, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 10428, .adv_w = 282, .box_w = 17, .box_h = 24, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 10632, .adv_w = 222, .box_w = 8, .box_h = 32, .ofs_x = 5, .ofs_y = -8},
-    {.bitmap_index = 10760, .adv_w = 216, .box_w = 12, .box_h = 28, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 10928, .adv_w = 222, .box_w = 8, .box_h = 32, .ofs_x = 1, .ofs_y = -8},
-    {.bitmap_index = 11056, .adv_w = 336, .box_w = 17, .box_h = 14, .ofs_x = 2, .ofs_y = 10},
-    {.bitmap_index = 11175, .adv_w = 318, .box_w = 22, .box_h = 2, .ofs_x = -1, .ofs_y = -4},
-    {.bitmap_index = 11197, .adv_w = 192, .box_w = 8, .box_h = 6, .ofs_x = 1, .ofs_y = 19},
-    {.bitmap_index = 11221, .adv_w = 258, .box_w = 16, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 11357, .adv_w = 282, .box_w = 16, .box_h = 24, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 11549, .adv_w = 210, .box_w = 12, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 11651, .adv_w = 282, .box_w = 16, .box_h = 24, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 11843, .adv_w = 270, .box_w = 16, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 11979, .adv_w = 168, .box_w = 11, .box_h = 24, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 12111, .adv_w = 282, .box_w = 16, .box_h = 25, .ofs_x = 0, .ofs_y = -8},
-    {.bitmap_index = 12311, .adv_w = 276, .box_w = 15, .box_h = 24, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 12491, .adv_w = 150, .box_w = 7, .box_h = 24, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 12575, .adv_w = 150, .box_w = 9, .box_h = 32, .ofs_x = -1, .ofs_y = -8},
-    {.bitmap_index = 12719, .adv_w = 252, .box_w = 15, .box_h = 24, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 12899, .adv_w = 150, .box_w = 7, .box_h = 24, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 12983, .adv_w = 408, .box_w = 23, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 13179, .adv_w = 276, .box_w = 15, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 13307, .adv_w = 282, .box_w = 16, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 13443, .adv_w = 282, .box_w = 16, .box_h = 25, .ofs_x = 1, .ofs_y = -8},
-    {.bitmap_index = 13643, .adv_w = 282, .box_w = 16, .box_h = 25, .ofs_x = 0, .ofs_y = -8},
-    {.bitmap_index = 13843, .adv_w = 186, .box_w = 11, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 13937, .adv_w = 234, .box_w = 13, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 14048, .adv_w = 186, .box_w = 11, .box_h = 22, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 14169, .adv_w = 276, .box_w = 15, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 14297, .adv_w = 228, .box_w = 16, .box_h = 17, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 14433, .adv_w = 366, .box_w = 24, .box_h = 17, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 14637, .adv_w = 240, .box_w = 15, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 14765, .adv_w = 246, .box_w = 16, .box_h = 25, .ofs_x = 0, .ofs_y = -8},
-    {.bitmap_index = 14965, .adv_w = 240, .box_w = 15, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 15093, .adv_w = 224, .box_w = 13, .box_h = 34, .ofs_x = 0, .ofs_y = -10},
-    {.bitmap_index = 15314, .adv_w = 339, .box_w = 5, .box_h = 32, .ofs_x = 8, .ofs_y = -8},
-    {.bitmap_index = 15394, .adv_w = 224, .box_w = 13, .box_h = 34, .ofs_x = 0, .ofs_y = -10},
-    {.bitmap_index = 15615, .adv_w = 378, .box_w = 20, .box_h = 7, .ofs_x = 2, .ofs_y = 8}
+    {.bitmap_index = 62, .adv_w = 273, .box_w = 15, .box_h = 10, .ofs_x = 1, .ofs_y = 14},
+    {.bitmap_index = 109, .adv_w = 385, .box_w = 22, .box_h = 25, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 291, .adv_w = 270, .box_w = 15, .box_h = 29, .ofs_x = 1, .ofs_y = -3},
+    {.bitmap_index = 438, .adv_w = 468, .box_w = 28, .box_h = 29, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 734, .adv_w = 312, .box_w = 19, .box_h = 24, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 885, .adv_w = 137, .box_w = 6, .box_h = 10, .ofs_x = 1, .ofs_y = 14},
+    {.bitmap_index = 904, .adv_w = 246, .box_w = 9, .box_h = 32, .ofs_x = 5, .ofs_y = -8},
+    {.bitmap_index = 1019, .adv_w = 246, .box_w = 10, .box_h = 32, .ofs_x = 1, .ofs_y = -8},
+    {.bitmap_index = 1139, .adv_w = 270, .box_w = 13, .box_h = 12, .ofs_x = 2, .ofs_y = 12},
+    {.bitmap_index = 1198, .adv_w = 384, .box_w = 20, .box_h = 20, .ofs_x = 2, .ofs_y = 2},
+    {.bitmap_index = 1243, .adv_w = 168, .box_w = 7, .box_h = 14, .ofs_x = 2, .ofs_y = -9},
+    {.bitmap_index = 1288, .adv_w = 216, .box_w = 10, .box_h = 6, .ofs_x = 2, .ofs_y = 6},
+    {.bitmap_index = 1297, .adv_w = 168, .box_w = 7, .box_h = 6, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 1317, .adv_w = 216, .box_w = 12, .box_h = 28, .ofs_x = 1, .ofs_y = -4},
+    {.bitmap_index = 1434, .adv_w = 294, .box_w = 18, .box_h = 24, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1589, .adv_w = 294, .box_w = 10, .box_h = 24, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 1619, .adv_w = 294, .box_w = 16, .box_h = 24, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1738, .adv_w = 294, .box_w = 15, .box_h = 24, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 1870, .adv_w = 294, .box_w = 18, .box_h = 24, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1958, .adv_w = 294, .box_w = 15, .box_h = 24, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 2057, .adv_w = 294, .box_w = 16, .box_h = 24, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2203, .adv_w = 294, .box_w = 15, .box_h = 24, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2304, .adv_w = 294, .box_w = 17, .box_h = 24, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2465, .adv_w = 294, .box_w = 17, .box_h = 24, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2615, .adv_w = 168, .box_w = 7, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 2659, .adv_w = 168, .box_w = 7, .box_h = 26, .ofs_x = 2, .ofs_y = -9},
+    {.bitmap_index = 2729, .adv_w = 384, .box_w = 20, .box_h = 20, .ofs_x = 2, .ofs_y = 2},
+    {.bitmap_index = 2860, .adv_w = 384, .box_w = 20, .box_h = 12, .ofs_x = 2, .ofs_y = 6},
+    {.bitmap_index = 2890, .adv_w = 384, .box_w = 20, .box_h = 20, .ofs_x = 2, .ofs_y = 2},
+    {.bitmap_index = 3022, .adv_w = 258, .box_w = 15, .box_h = 24, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3145, .adv_w = 461, .box_w = 27, .box_h = 30, .ofs_x = 1, .ofs_y = -6},
+    {.bitmap_index = 3503, .adv_w = 300, .box_w = 19, .box_h = 24, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3654, .adv_w = 300, .box_w = 18, .box_h = 24, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3778, .adv_w = 246, .box_w = 14, .box_h = 24, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3890, .adv_w = 306, .box_w = 17, .box_h = 24, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 4006, .adv_w = 270, .box_w = 15, .box_h = 24, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 4048, .adv_w = 258, .box_w = 15, .box_h = 24, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 4085, .adv_w = 288, .box_w = 16, .box_h = 24, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 4212, .adv_w = 312, .box_w = 17, .box_h = 24, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 4244, .adv_w = 150, .box_w = 7, .box_h = 24, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 4255, .adv_w = 180, .box_w = 9, .box_h = 24, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4287, .adv_w = 276, .box_w = 17, .box_h = 24, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 4404, .adv_w = 240, .box_w = 15, .box_h = 24, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 4425, .adv_w = 366, .box_w = 21, .box_h = 24, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 4544, .adv_w = 312, .box_w = 17, .box_h = 24, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 4644, .adv_w = 318, .box_w = 20, .box_h = 24, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4811, .adv_w = 288, .box_w = 17, .box_h = 24, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 4894, .adv_w = 318, .box_w = 20, .box_h = 31, .ofs_x = 0, .ofs_y = -7},
+    {.bitmap_index = 5100, .adv_w = 288, .box_w = 17, .box_h = 24, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 5217, .adv_w = 264, .box_w = 15, .box_h = 24, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 5351, .adv_w = 276, .box_w = 17, .box_h = 24, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5384, .adv_w = 300, .box_w = 17, .box_h = 24, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 5454, .adv_w = 294, .box_w = 19, .box_h = 24, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5611, .adv_w = 390, .box_w = 25, .box_h = 24, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5850, .adv_w = 300, .box_w = 19, .box_h = 24, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6007, .adv_w = 288, .box_w = 18, .box_h = 24, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6102, .adv_w = 282, .box_w = 17, .box_h = 24, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6198, .adv_w = 222, .box_w = 8, .box_h = 32, .ofs_x = 5, .ofs_y = -8},
+    {.bitmap_index = 6227, .adv_w = 216, .box_w = 12, .box_h = 28, .ofs_x = 1, .ofs_y = -4},
+    {.bitmap_index = 6342, .adv_w = 222, .box_w = 8, .box_h = 32, .ofs_x = 1, .ofs_y = -8},
+    {.bitmap_index = 6372, .adv_w = 336, .box_w = 17, .box_h = 14, .ofs_x = 2, .ofs_y = 10},
+    {.bitmap_index = 6460, .adv_w = 318, .box_w = 22, .box_h = 2, .ofs_x = -1, .ofs_y = -4},
+    {.bitmap_index = 6469, .adv_w = 192, .box_w = 8, .box_h = 6, .ofs_x = 1, .ofs_y = 19},
+    {.bitmap_index = 6491, .adv_w = 258, .box_w = 16, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6595, .adv_w = 282, .box_w = 16, .box_h = 24, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 6691, .adv_w = 210, .box_w = 12, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6765, .adv_w = 282, .box_w = 16, .box_h = 24, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6864, .adv_w = 270, .box_w = 16, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6967, .adv_w = 168, .box_w = 11, .box_h = 24, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7015, .adv_w = 282, .box_w = 16, .box_h = 25, .ofs_x = 0, .ofs_y = -8},
+    {.bitmap_index = 7151, .adv_w = 276, .box_w = 15, .box_h = 24, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 7204, .adv_w = 150, .box_w = 7, .box_h = 24, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 7236, .adv_w = 150, .box_w = 9, .box_h = 32, .ofs_x = -1, .ofs_y = -8},
+    {.bitmap_index = 7297, .adv_w = 252, .box_w = 15, .box_h = 24, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 7379, .adv_w = 150, .box_w = 7, .box_h = 24, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 7390, .adv_w = 408, .box_w = 23, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 7467, .adv_w = 276, .box_w = 15, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 7514, .adv_w = 282, .box_w = 16, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 7620, .adv_w = 282, .box_w = 16, .box_h = 25, .ofs_x = 1, .ofs_y = -8},
+    {.bitmap_index = 7720, .adv_w = 282, .box_w = 16, .box_h = 25, .ofs_x = 0, .ofs_y = -8},
+    {.bitmap_index = 7818, .adv_w = 186, .box_w = 11, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 7850, .adv_w = 234, .box_w = 13, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 7939, .adv_w = 186, .box_w = 11, .box_h = 22, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7995, .adv_w = 276, .box_w = 15, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 8039, .adv_w = 228, .box_w = 16, .box_h = 17, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 8140, .adv_w = 366, .box_w = 24, .box_h = 17, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 8306, .adv_w = 240, .box_w = 15, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8405, .adv_w = 246, .box_w = 16, .box_h = 25, .ofs_x = 0, .ofs_y = -8},
+    {.bitmap_index = 8543, .adv_w = 240, .box_w = 15, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8605, .adv_w = 224, .box_w = 13, .box_h = 34, .ofs_x = 0, .ofs_y = -10},
+    {.bitmap_index = 8742, .adv_w = 339, .box_w = 5, .box_h = 32, .ofs_x = 8, .ofs_y = -8},
+    {.bitmap_index = 8752, .adv_w = 224, .box_w = 13, .box_h = 34, .ofs_x = 0, .ofs_y = -10},
+    {.bitmap_index = 8888, .adv_w = 378, .box_w = 20, .box_h = 7, .ofs_x = 2, .ofs_y = 8}
 };
 
 /*---------------------
@@ -2673,7 +1746,7 @@ static lv_font_fmt_txt_dsc_t font_dsc = {
     .cmap_num = 1,
     .bpp = 4,
     .kern_classes = 0,
-    .bitmap_format = 0,
+    .bitmap_format = 1,
 #if LVGL_VERSION_MAJOR == 8
     .cache = &cache
 #endif
@@ -1,7 +1,7 @@
 /*******************************************************************************
  * Size: 40 px
  * Bpp: 4
- * Opts: --bpp 4 --size 40 --no-compress --font Abadi MT Std Cond Extra Bold.ttf --range 0-127 --format lvgl -o lv_font_abadi_40.c
+ * Opts: --bpp 4 --size 40 --font Abadi MT Std Cond Extra Bold.ttf --range 0-127 --format lvgl -o lv_font_abadi_40.c
  ******************************************************************************/
 #include "../../lvgl.h"
 
@@ -18,2676 +18,1436 @@
 /*Store the image of the glyphs*/
 static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
     /* U+0020 " " */
-
     /* U+0021 "!" */
-    0x7f, 0xff, 0xff, 0xf0, 0x6f, 0xff, 0xff, 0xf0,
-    0x5f, 0xff, 0xff, 0xf0, 0x5f, 0xff, 0xff, 0xe0,
-    0x4f, 0xff, 0xff, 0xd0, 0x3f, 0xff, 0xff, 0xd0,
-    0x3f, 0xff, 0xff, 0xc0, 0x2f, 0xff, 0xff, 0xb0,
-    0x1f, 0xff, 0xff, 0xb0, 0xf, 0xff, 0xff, 0xa0,
-    0xf, 0xff, 0xff, 0x90, 0xf, 0xff, 0xff, 0x80,
-    0xe, 0xff, 0xff, 0x80, 0xe, 0xff, 0xff, 0x70,
-    0xd, 0xff, 0xff, 0x60, 0xc, 0xff, 0xff, 0x60,
-    0xb, 0xff, 0xff, 0x50, 0xb, 0xff, 0xff, 0x40,
-    0x9, 0xee, 0xee, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x48, 0x72, 0x0, 0x8, 0xff, 0xff, 0x40,
-    0x2f, 0xff, 0xff, 0xe0, 0x6f, 0xff, 0xff, 0xf1,
-    0x4f, 0xff, 0xff, 0xf0, 0xc, 0xff, 0xff, 0x80,
-    0x1, 0xae, 0xd8, 0x0,
-
+    0x7f, 0xff, 0x0, 0x80, 0x7c, 0x60, 0x1f, 0xfc,
+    0x0, 0x10, 0x10, 0xe, 0x30, 0x70, 0xf, 0xfe,
+    0x0, 0x8, 0x8, 0x7, 0x38, 0x18, 0x7, 0xc2,
+    0x1, 0xc2, 0x1, 0xf1, 0x80, 0x7c, 0x20, 0x1,
+    0x0, 0xff, 0xde, 0x0, 0x30, 0xc, 0x20, 0x1,
+    0x0, 0xf9, 0xc0, 0x31, 0x80, 0x7c, 0x20, 0x2,
+    0x11, 0xce, 0x0, 0x9e, 0xec, 0x60, 0x12, 0x43,
+    0x90, 0x5, 0x16, 0xf1, 0xa8, 0x4, 0xe0, 0x1a,
+    0x81, 0x0, 0x38, 0x44, 0x40, 0x1e, 0x14, 0x30,
+    0xc, 0xe0, 0xd, 0x51, 0x27, 0x80,
     /* U+0022 "\"" */
-    0xdf, 0xff, 0xff, 0x10, 0x1f, 0xff, 0xff, 0xdd,
-    0xff, 0xff, 0xf1, 0x1, 0xff, 0xff, 0xfd, 0xdf,
-    0xff, 0xff, 0x10, 0x1f, 0xff, 0xff, 0xdd, 0xff,
-    0xff, 0xf1, 0x1, 0xff, 0xff, 0xfd, 0xdf, 0xff,
-    0xff, 0x10, 0x1f, 0xff, 0xff, 0xdb, 0xff, 0xff,
-    0xf0, 0x0, 0xff, 0xff, 0xfc, 0x8f, 0xff, 0xfc,
-    0x0, 0xc, 0xff, 0xff, 0x95, 0xff, 0xff, 0xa0,
-    0x0, 0x8f, 0xff, 0xf6, 0x2f, 0xff, 0xf7, 0x0,
-    0x5, 0xff, 0xff, 0x40, 0xff, 0xff, 0x40, 0x0,
-    0x2f, 0xff, 0xf1, 0x1, 0x22, 0x20, 0x0, 0x0,
-    0x22, 0x22, 0x0,
-
+    0xdf, 0xfe, 0x10, 0x1f, 0xfe, 0xd0, 0xf, 0xff,
+    0x83, 0x0, 0x70, 0x80, 0x80, 0x70, 0x98, 0x6,
+    0x30, 0x8, 0xc0, 0x32, 0xe8, 0x6, 0x60, 0x9,
+    0x0, 0x37, 0xb8, 0x6, 0xd0, 0xb, 0x40, 0x31,
+    0x10, 0x3, 0x18, 0x4, 0xe0, 0x19, 0x43, 0xb7,
+    0x64, 0x0, 0x8b, 0x77, 0x8,
     /* U+0023 "#" */
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x5f, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0x80, 0x0, 0x0, 0x9, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xf4, 0x0,
-    0x0, 0x0, 0xcf, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0x10, 0x0, 0x0, 0xf, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xd0,
-    0x0, 0x0, 0x3, 0xff, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0x60, 0x0, 0x0, 0xa, 0xff, 0xf0, 0x0, 0x5,
-    0xbb, 0xbb, 0xbd, 0xff, 0xfc, 0xbb, 0xbb, 0xbb,
-    0xff, 0xff, 0xbb, 0xb1, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x27, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf2, 0x7f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0x4f, 0xff, 0x60, 0x0,
-    0x0, 0xa, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xf3, 0x0, 0x0, 0x0, 0xdf, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xff, 0xc0, 0x0, 0x0, 0x4, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0x60, 0x0, 0x0, 0xa,
-    0xff, 0xf0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf2, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x27, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf2, 0x5a, 0xab, 0xff, 0xfd, 0xaa, 0xaa,
-    0xaa, 0xdf, 0xff, 0xba, 0xaa, 0xaa, 0x10, 0x0,
-    0x5f, 0xff, 0x50, 0x0, 0x0, 0xa, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0xef, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xfe, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xb0,
-    0x0, 0x0, 0x5, 0xff, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0x40, 0x0, 0x0, 0xc, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
-
+    0x0, 0xfd, 0xff, 0x60, 0x7, 0x97, 0xfe, 0x50,
+    0xf, 0xe2, 0x0, 0x90, 0x3, 0xd8, 0x1, 0x20,
+    0x7, 0xf2, 0x0, 0x58, 0x1, 0xe5, 0x0, 0x8,
+    0x80, 0x3f, 0xbc, 0x2, 0x50, 0xf, 0x18, 0x1,
+    0x0, 0x3f, 0xc8, 0x0, 0x21, 0x0, 0xe3, 0x0,
+    0xb4, 0x3, 0xfc, 0x40, 0x7, 0x0, 0xf2, 0x0,
+    0x48, 0x1, 0xfc, 0x80, 0x16, 0x0, 0x7b, 0x40,
+    0x23, 0x0, 0x96, 0xef, 0xa4, 0x2, 0xab, 0xbf,
+    0x28, 0x5, 0x77, 0x9, 0x22, 0x71, 0x0, 0x46,
+    0x89, 0xe0, 0xc, 0x89, 0x18, 0x7, 0xff, 0x99,
+    0xff, 0xf5, 0x80, 0x53, 0xff, 0xe5, 0x0, 0xbf,
+    0xf1, 0x0, 0x71, 0x80, 0x4a, 0x1, 0xe7, 0x0,
+    0x10, 0x7, 0xfb, 0x40, 0x23, 0x0, 0xe1, 0x20,
+    0x3, 0x80, 0x7f, 0x90, 0x0, 0x60, 0x1e, 0x50,
+    0xb, 0x0, 0x3f, 0x84, 0x40, 0x5, 0x0, 0xf1,
+    0x80, 0x4a, 0x1, 0xfc, 0xa0, 0x17, 0x80, 0x7b,
+    0x40, 0x23, 0x0, 0xe7, 0xff, 0xac, 0x2, 0x9f,
+    0xff, 0x28, 0x5, 0xff, 0xc4, 0x1, 0xff, 0xe6,
+    0x25, 0x52, 0x0, 0x44, 0xab, 0xe2, 0x0, 0x91,
+    0x57, 0x8d, 0x6a, 0x9c, 0x1, 0x45, 0x57, 0x9c,
+    0x2, 0xba, 0xae, 0x10, 0xb, 0x40, 0x24, 0x0,
+    0xf2, 0x0, 0xc, 0x3, 0xfc, 0x80, 0x1, 0x10,
+    0x7, 0x8, 0x80, 0xa, 0x1, 0xfe, 0x30, 0x2,
+    0x80, 0x79, 0x0, 0x2c, 0x0, 0xfe, 0x20, 0xb,
+    0x0, 0x3d, 0x80, 0x13, 0x80, 0x7f, 0x20, 0x4,
+    0x60, 0x1e, 0x50, 0x0, 0x90, 0x7, 0xf7, 0x80,
+    0x4a, 0x1, 0xe3, 0x0, 0x28, 0x7, 0xe0,
     /* U+0024 "$" */
-    0x0, 0x0, 0x0, 0x9f, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0x63, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xcf, 0xff, 0xff, 0xff,
-    0x92, 0x0, 0x0, 0xa, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xd0, 0x0, 0xb, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfd, 0x0, 0x6, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xd0, 0x0, 0xef, 0xff, 0xff, 0xfb,
-    0x78, 0xbf, 0xfd, 0x0, 0x1f, 0xff, 0xff, 0xf7,
-    0x0, 0x0, 0x2c, 0xd0, 0x4, 0xff, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x7, 0x0, 0x5f, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff,
-    0xff, 0xff, 0xb3, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xff, 0xff, 0xff, 0xfb, 0x40, 0x0, 0x0, 0x0,
-    0xaf, 0xff, 0xff, 0xff, 0xff, 0xc2, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x0,
-    0x0, 0x0, 0x4c, 0xff, 0xff, 0xff, 0xff, 0xe1,
-    0x0, 0x0, 0x0, 0x4, 0xbf, 0xff, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x4e, 0xff, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xff, 0xff, 0x72, 0x10, 0x0, 0x0, 0x0, 0xe,
-    0xff, 0xff, 0xf6, 0x4d, 0x30, 0x0, 0x0, 0x4,
-    0xff, 0xff, 0xff, 0x44, 0xff, 0xa3, 0x0, 0x5,
-    0xef, 0xff, 0xff, 0xe0, 0x4f, 0xff, 0xff, 0xdf,
-    0xff, 0xff, 0xff, 0xf8, 0x4, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfd, 0x0, 0x4f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfd, 0x20, 0x2, 0xcf, 0xff,
-    0xff, 0xff, 0xff, 0xfa, 0x10, 0x0, 0x0, 0x49,
-    0xdf, 0xff, 0xff, 0x82, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0x77, 0x70, 0x0, 0x0, 0x0,
-
+    0x0, 0xf4, 0xff, 0xb8, 0x3, 0xff, 0xa4, 0x60,
+    0x1, 0x63, 0x0, 0xfe, 0x5c, 0x50, 0xa, 0x73,
+    0xe4, 0x80, 0x3a, 0xa8, 0x60, 0x1f, 0x37, 0x80,
+    0x6b, 0x50, 0xf, 0xfe, 0x13, 0x20, 0x7, 0xff,
+    0xe, 0x0, 0x3c, 0x90, 0xe8, 0x1, 0xc2, 0x20,
+    0xe, 0x8b, 0x78, 0xbd, 0x30, 0x9, 0x40, 0x3c,
+    0xe0, 0x18, 0xb2, 0x80, 0x2, 0x1, 0xff, 0xc0,
+    0x7, 0x0, 0x30, 0x7, 0xa0, 0x3, 0xf8, 0xc4,
+    0x3, 0x9e, 0xcc, 0x3, 0xf5, 0x80, 0x79, 0x32,
+    0xd0, 0x3, 0xca, 0xa0, 0xf, 0x92, 0xf0, 0x80,
+    0x3a, 0x9c, 0x3, 0xf1, 0xea, 0x0, 0x74, 0x59,
+    0x80, 0x7e, 0xa1, 0x0, 0xe4, 0xcb, 0x40, 0xf,
+    0xe, 0x80, 0x7c, 0x97, 0x61, 0x0, 0xe3, 0x20,
+    0xf, 0xc9, 0xa0, 0x1e, 0x40, 0xf, 0xe3, 0x10,
+    0xe, 0x12, 0x10, 0xf, 0xfe, 0x10, 0xb6, 0x18,
+    0x7, 0x90, 0x40, 0x38, 0x80, 0xb2, 0x8c, 0x2,
+    0x5a, 0x0, 0xe1, 0x40, 0x9, 0x73, 0xf7, 0xe8,
+    0x40, 0x39, 0x80, 0x3e, 0x20, 0xf, 0x8a, 0x0,
+    0x3f, 0xf8, 0x45, 0xe0, 0x6, 0x30, 0xf, 0xf2,
+    0xe1, 0x0, 0xb, 0x2d, 0x88, 0x3, 0x9f, 0x68,
+    0x40, 0x39, 0x27, 0x7d, 0x80, 0x3, 0x4, 0x1,
+    0xff, 0xd0, 0xd8, 0x84, 0x80, 0x7c,
     /* U+0025 "%" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x57, 0x77, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3e, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x19, 0xdf, 0xfd, 0xa7, 0x42, 0x0, 0x13, 0x9f,
-    0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff,
-    0x9d, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0x40,
-    0xe, 0xff, 0xfb, 0x1, 0x20, 0x6f, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xe0, 0x0,
-    0xaf, 0xff, 0xe0, 0x0, 0xd, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xff, 0xfc, 0x0, 0x8,
-    0xff, 0xff, 0x0, 0x4, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xff, 0xd0, 0x0, 0x9f,
-    0xff, 0xd0, 0x0, 0xaf, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0xff, 0x10, 0xc, 0xff,
-    0xfa, 0x0, 0x1f, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xf9, 0x16, 0xff, 0xff,
-    0x60, 0x8, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xc0,
-    0x0, 0xef, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0xff, 0xff, 0xe3, 0x0,
-    0x6f, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0xff, 0xb1, 0x0, 0xd,
-    0xff, 0xd0, 0x0, 0x2, 0x57, 0x51, 0x0, 0x0,
-    0x0, 0x0, 0x16, 0x75, 0x20, 0x0, 0x4, 0xff,
-    0xf6, 0x0, 0x1b, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0x0, 0x1e, 0xff, 0xff, 0xff, 0xfc, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0x90,
-    0xb, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xf2, 0x4,
-    0xff, 0xff, 0x71, 0xaf, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xfb, 0x0, 0xaf,
-    0xff, 0xd0, 0x1, 0xff, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0x50, 0xd, 0xff,
-    0xf9, 0x0, 0xd, 0xff, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xff, 0xe0, 0x0, 0xef, 0xff,
-    0x80, 0x0, 0xbf, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xf7, 0x0, 0xd, 0xff, 0xf9,
-    0x0, 0xc, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xff, 0x10, 0x0, 0xaf, 0xff, 0xc0,
-    0x0, 0xef, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xa0, 0x0, 0x7, 0xff, 0xff, 0x20,
-    0x4f, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0xf3, 0x0, 0x0, 0x1e, 0xff, 0xfe, 0x9e,
-    0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xff,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x3a, 0xef, 0xe9, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x47, 0x77, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
+    0x0, 0xff, 0xe4, 0x2b, 0xbc, 0x1, 0xff, 0xce,
+    0x3a, 0x88, 0x60, 0x7, 0xff, 0x34, 0xf4, 0x2,
+    0xf0, 0xf, 0xf0, 0xce, 0xff, 0xb6, 0x9d, 0x8,
+    0x0, 0x27, 0x38, 0x20, 0x2, 0x40, 0xf, 0xe5,
+    0xe6, 0x20, 0x1, 0x2c, 0x5e, 0xff, 0xbb, 0x18,
+    0x3, 0x50, 0x7, 0xf2, 0x50, 0x7, 0xff, 0x1d,
+    0x80, 0x3f, 0xa4, 0x3, 0x31, 0x0, 0x61, 0x0,
+    0xfc, 0xc2, 0x1, 0xf9, 0x48, 0x2, 0xb9, 0xd1,
+    0x0, 0x97, 0xfb, 0x7e, 0x40, 0x2a, 0x0, 0xfe,
+    0xd0, 0x8, 0x50, 0x0, 0x80, 0x12, 0x80, 0x90,
+    0x58, 0x0, 0xcc, 0x1, 0xfc, 0x40, 0x11, 0x0,
+    0x44, 0x1, 0x8, 0x4, 0x84, 0x0, 0x90, 0xf,
+    0xf1, 0x80, 0x42, 0x1, 0x8, 0x4, 0x40, 0x17,
+    0x0, 0x5, 0x40, 0x3f, 0xde, 0x1, 0x10, 0x80,
+    0x14, 0x2, 0x70, 0x0, 0xa8, 0x1, 0x80, 0x3f,
+    0xe4, 0x0, 0xd0, 0x2c, 0x60, 0x16, 0x0, 0x24,
+    0x2, 0x90, 0xf, 0xf8, 0x98, 0x2, 0x6e, 0x90,
+    0x8, 0xd8, 0x0, 0xc0, 0x5, 0x10, 0xf, 0xfd,
+    0x24, 0x1, 0xf0, 0xf8, 0x1, 0x84, 0x1, 0xc0,
+    0x1f, 0xfc, 0x2d, 0x70, 0xe, 0x4f, 0x30, 0x5,
+    0x80, 0x9, 0x0, 0x22, 0x57, 0x51, 0x0, 0xfa,
+    0x3a, 0x62, 0xb6, 0xc4, 0x0, 0x84, 0x0, 0xb0,
+    0x0, 0xde, 0xd4, 0x57, 0x40, 0x7, 0xc2, 0xce,
+    0xa4, 0x1, 0xbc, 0x2, 0x60, 0x1f, 0x40, 0xe,
+    0x7c, 0x10, 0xf, 0xfe, 0x0, 0x12, 0x0, 0x18,
+    0x1, 0x42, 0x1, 0xf1, 0xc8, 0x7, 0xff, 0x0,
+    0x28, 0x2, 0xb0, 0x44, 0x0, 0x51, 0xca, 0x1,
+    0x38, 0x80, 0x7f, 0xe7, 0x0, 0x21, 0x7, 0x0,
+    0x44, 0xe3, 0x60, 0x19, 0x80, 0x3f, 0xe6, 0x0,
+    0xb8, 0x0, 0xe0, 0x12, 0x0, 0x4, 0x80, 0x2e,
+    0x0, 0xff, 0xac, 0x0, 0x2a, 0x0, 0x30, 0x8,
+    0x40, 0x26, 0x0, 0x88, 0x3, 0xfc, 0x84, 0x0,
+    0x90, 0x8, 0xc0, 0x21, 0x0, 0x9c, 0x2, 0x10,
+    0xf, 0xf7, 0x80, 0x4c, 0x1, 0x38, 0x4, 0xa0,
+    0x11, 0x0, 0x44, 0x1, 0xfc, 0x48, 0x0, 0x51,
+    0x0, 0xb4, 0x2, 0x32, 0x4, 0x10, 0xb, 0x40,
+    0x3f, 0xac, 0x2, 0x90, 0xc, 0xc2, 0x1, 0x64,
+    0xd0, 0x4, 0x4a, 0x1, 0xfc, 0xc0, 0x3, 0x30,
+    0x6, 0x18, 0x0, 0x85, 0x84, 0x2, 0x90, 0xf,
+    0xe6, 0x0, 0xa8, 0x3, 0xcd, 0x20, 0x1f, 0x52,
+    0x0, 0x7f, 0x58, 0x0, 0x58, 0x3, 0xe6, 0xc5,
+    0x10, 0x16, 0xd5, 0x0, 0xfe, 0x42, 0x0, 0x30,
+    0x7, 0xf1, 0xd7, 0x7f, 0x49, 0x0, 0x7f, 0xd1,
+    0x14, 0x80, 0x7f, 0xf1, 0xc0,
     /* U+0026 "&" */
-    0x0, 0x0, 0x0, 0x0, 0x4a, 0xef, 0xec, 0xa1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xaf, 0xff,
-    0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xff,
-    0xcb, 0xe3, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xff, 0xb0,
-    0x6, 0x88, 0x88, 0x40, 0x0, 0x5, 0xff, 0xff,
-    0xff, 0xff, 0x30, 0xcf, 0xff, 0xf8, 0x0, 0x5,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0xc, 0xff, 0xff,
-    0x70, 0x4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4,
-    0xdf, 0xff, 0xf5, 0x0, 0xdf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xdd, 0xff, 0xff, 0x20, 0x7f, 0xff,
-    0xff, 0xa9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0xd, 0xff, 0xff, 0xf4, 0x1f, 0xff, 0xff, 0xff,
-    0xff, 0xfa, 0x1, 0xff, 0xff, 0xff, 0x0, 0x9f,
-    0xff, 0xff, 0xff, 0xff, 0x50, 0x3f, 0xff, 0xff,
-    0xf0, 0x2, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x2,
-    0xff, 0xff, 0xff, 0x50, 0x9, 0xff, 0xff, 0xff,
-    0xf4, 0x0, 0x1f, 0xff, 0xff, 0xfd, 0x10, 0x2f,
-    0xff, 0xff, 0xfd, 0x0, 0x0, 0xcf, 0xff, 0xff,
-    0xfe, 0x98, 0xef, 0xff, 0xff, 0xf2, 0x0, 0x5,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x90, 0x0, 0xb, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x10, 0x0, 0x2e, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x0,
-    0x2d, 0xff, 0xff, 0xff, 0xfd, 0x9f, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x5, 0xbe, 0xfe, 0xb6, 0x0,
-    0xef, 0xff, 0xff, 0x50,
-
+    0x0, 0xfc, 0x95, 0xdf, 0xd9, 0x42, 0x1, 0xff,
+    0xd, 0x5a, 0x88, 0x9, 0xa9, 0x0, 0x7f, 0xda,
+    0xa0, 0x1f, 0xfc, 0x68, 0x30, 0xf, 0xfe, 0x3a,
+    0x80, 0x78, 0xd0, 0x40, 0x3f, 0xe2, 0x0, 0xe8,
+    0xcb, 0xe3, 0x0, 0xff, 0xe2, 0x30, 0x7, 0xff,
+    0x8, 0x40, 0x38, 0x80, 0x3f, 0xf8, 0x4a, 0x1,
+    0xd2, 0x1, 0xff, 0xc2, 0xd0, 0xe, 0x52, 0x0,
+    0xff, 0xe0, 0x1, 0x0, 0x7a, 0x40, 0xd, 0x11,
+    0x90, 0x3, 0x2d, 0x80, 0x79, 0xc, 0x29, 0xdf,
+    0x60, 0x4, 0xb4, 0x1, 0xfb, 0xc0, 0x3d, 0xe0,
+    0x4, 0xa0, 0xf, 0xe3, 0x41, 0x0, 0xc4, 0x0,
+    0x90, 0xf, 0xfa, 0x40, 0x39, 0xc1, 0xc8, 0x3,
+    0x2b, 0x0, 0x71, 0x10, 0x3, 0x10, 0x50, 0x7,
+    0x74, 0x0, 0x7f, 0x94, 0x4, 0x80, 0x39, 0x5,
+    0x80, 0x3f, 0xbc, 0x8, 0x3, 0xf5, 0x80, 0x7e,
+    0x25, 0x1, 0x0, 0xf2, 0x81, 0x30, 0x7, 0xd2,
+    0x0, 0x30, 0xf, 0x40, 0x85, 0x80, 0x78, 0x90,
+    0x0, 0x26, 0x1, 0xc5, 0xf3, 0x42, 0x1, 0xc4,
+    0x40, 0xa, 0x40, 0x3c, 0x2c, 0xe2, 0x1, 0xeb,
+    0x0, 0x95, 0x0, 0x3f, 0xf8, 0x6c, 0x20, 0x14,
+    0x88, 0x7, 0xff, 0xd, 0x80, 0x22, 0xc2, 0x0,
+    0xf8, 0x98, 0x3, 0xa4, 0x3, 0x16, 0xd2, 0x8,
+    0xa, 0x4e, 0xc8, 0x80, 0x61, 0x50,
     /* U+0027 "'" */
-    0x3f, 0xff, 0xff, 0xc3, 0xff, 0xff, 0xfc, 0x3f,
-    0xff, 0xff, 0xc3, 0xff, 0xff, 0xfc, 0x3f, 0xff,
-    0xff, 0xc1, 0xff, 0xff, 0xfa, 0xe, 0xff, 0xff,
-    0x70, 0xbf, 0xff, 0xf4, 0x8, 0xff, 0xff, 0x20,
-    0x5f, 0xff, 0xf0, 0x0, 0x22, 0x21, 0x0,
-
+    0x3f, 0xfe, 0xc0, 0xf, 0xfe, 0x81, 0x0, 0x73,
+    0x8, 0x80, 0x36, 0x82, 0x80, 0x63, 0x3, 0x0,
+    0xcc, 0x1a, 0x1, 0x88, 0x17, 0x76, 0xe0,
     /* U+0028 "(" */
-    0x0, 0x0, 0xe, 0xff, 0xfe, 0x0, 0x0, 0x6,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0xdf, 0xff, 0xf1,
-    0x0, 0x0, 0x5f, 0xff, 0xf9, 0x0, 0x0, 0xc,
-    0xff, 0xff, 0x20, 0x0, 0x1, 0xff, 0xff, 0xd0,
-    0x0, 0x0, 0x7f, 0xff, 0xf7, 0x0, 0x0, 0xd,
-    0xff, 0xff, 0x20, 0x0, 0x2, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x5f, 0xff, 0xfb, 0x0, 0x0, 0x8,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0xcf, 0xff, 0xf5,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0x20, 0x0, 0x1,
-    0xff, 0xff, 0xf1, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0x0, 0x0, 0x4, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0x0, 0x0,
-    0x4, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0x0, 0x0, 0x2, 0xff, 0xff, 0xf1, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0x20, 0x0, 0x0, 0xef,
-    0xff, 0xf4, 0x0, 0x0, 0xb, 0xff, 0xff, 0x60,
-    0x0, 0x0, 0x7f, 0xff, 0xf8, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xb0, 0x0, 0x0, 0xf, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0xcf, 0xff, 0xf3, 0x0, 0x0,
-    0x6, 0xff, 0xff, 0x80, 0x0, 0x0, 0xf, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xf4, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xa0, 0x0, 0x0, 0xc,
-    0xff, 0xff, 0x20, 0x0, 0x0, 0x4f, 0xff, 0xfa,
-    0x0, 0x0, 0x0, 0xcf, 0xff, 0xf3,
-
+    0x0, 0xee, 0xff, 0xb8, 0x3, 0x98, 0x40, 0x26,
+    0x0, 0xeb, 0x0, 0xd2, 0x1, 0x94, 0x80, 0x26,
+    0x10, 0xd, 0x20, 0x1a, 0xc0, 0x30, 0x98, 0x4,
+    0x44, 0x0, 0xcc, 0x1, 0xa8, 0x3, 0xa8, 0x3,
+    0x28, 0x6, 0x22, 0x0, 0x42, 0x40, 0x19, 0xc0,
+    0x32, 0x80, 0x76, 0x80, 0x63, 0x0, 0xe4, 0x0,
+    0xda, 0x1, 0xc6, 0x1, 0x9c, 0x3, 0x8, 0x7,
+    0x18, 0x6, 0x30, 0xe, 0x10, 0xc, 0x20, 0x1f,
+    0xe7, 0x0, 0xff, 0xef, 0xb8, 0x7, 0xf8, 0x40,
+    0x38, 0x40, 0x31, 0x0, 0x71, 0x80, 0x70, 0x80,
+    0x66, 0x0, 0xe5, 0x0, 0xc4, 0x1, 0xd8, 0x1,
+    0xb8, 0x3, 0x90, 0x3, 0x18, 0x7, 0x18, 0x6,
+    0x50, 0xf, 0x18, 0x4, 0x26, 0x1, 0xd4, 0x1,
+    0xac, 0x3, 0x98, 0x3, 0x30, 0x7, 0x94, 0x2,
+    0x14, 0x0, 0xe9, 0x0, 0xdc, 0x1, 0xc6, 0x60,
+    0x9, 0x48, 0x3, 0xa0, 0x3, 0x40, 0x7, 0x21,
+    0x80, 0x4a, 0x60,
     /* U+0029 ")" */
-    0xe, 0xff, 0xff, 0x10, 0x0, 0x0, 0x7f, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0xef, 0xff, 0xe0, 0x0,
-    0x0, 0x8, 0xff, 0xff, 0x60, 0x0, 0x0, 0x1f,
-    0xff, 0xfd, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xf3,
-    0x0, 0x0, 0x6, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x1f, 0xff, 0xfe, 0x0, 0x0, 0x0, 0xcf, 0xff,
-    0xf3, 0x0, 0x0, 0x9, 0xff, 0xff, 0x60, 0x0,
-    0x0, 0x7f, 0xff, 0xfa, 0x0, 0x0, 0x4, 0xff,
-    0xff, 0xd0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xf2, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0x40, 0x0, 0x0, 0xef, 0xff, 0xf5,
-    0x0, 0x0, 0xe, 0xff, 0xff, 0x50, 0x0, 0x0,
-    0xef, 0xff, 0xf6, 0x0, 0x0, 0xe, 0xff, 0xff,
-    0x60, 0x0, 0x0, 0xef, 0xff, 0xf5, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0x40, 0x0, 0x0, 0xff, 0xff,
-    0xf3, 0x0, 0x0, 0x1f, 0xff, 0xff, 0x10, 0x0,
-    0x3, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x4f, 0xff,
-    0xfc, 0x0, 0x0, 0x7, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0xaf, 0xff, 0xf5, 0x0, 0x0, 0xd, 0xff,
-    0xff, 0x10, 0x0, 0x1, 0xff, 0xff, 0xd0, 0x0,
-    0x0, 0x6f, 0xff, 0xf7, 0x0, 0x0, 0xd, 0xff,
-    0xff, 0x10, 0x0, 0x3, 0xff, 0xff, 0xb0, 0x0,
-    0x0, 0x9f, 0xff, 0xf5, 0x0, 0x0, 0x1f, 0xff,
-    0xfd, 0x0, 0x0, 0x9, 0xff, 0xff, 0x50, 0x0,
-    0x2, 0xff, 0xff, 0xd0, 0x0, 0x0,
-
+    0xe, 0xff, 0xc2, 0x1, 0xd2, 0x1, 0x98, 0x3,
+    0x9c, 0x40, 0x29, 0x0, 0xf3, 0x0, 0x42, 0xc0,
+    0x1d, 0x20, 0x1a, 0xc0, 0x38, 0x4c, 0x2, 0x23,
+    0x0, 0xea, 0x0, 0xd6, 0x1, 0xce, 0x1, 0x98,
+    0x3, 0x84, 0xc0, 0x21, 0x30, 0xe, 0x50, 0xc,
+    0xa0, 0x1d, 0xc0, 0x1b, 0x0, 0x38, 0xc0, 0x33,
+    0x80, 0x72, 0x80, 0x62, 0x0, 0xe1, 0x0, 0xe2,
+    0x0, 0xff, 0x30, 0x7, 0x8, 0x6, 0x10, 0xf,
+    0xfe, 0x49, 0x80, 0x7f, 0xf2, 0x4c, 0x3, 0x84,
+    0x3, 0x8, 0x7, 0xf9, 0xc0, 0x30, 0x80, 0x71,
+    0x0, 0x62, 0x0, 0xe1, 0x0, 0xce, 0x1, 0x8c,
+    0x3, 0x8c, 0x3, 0x20, 0x7, 0x68, 0x6, 0xd0,
+    0xe, 0x70, 0xc, 0x80, 0x18, 0x48, 0x2, 0x21,
+    0x0, 0xce, 0x1, 0xa8, 0x3, 0xac, 0x3, 0x30,
+    0x6, 0x32, 0x0, 0x90, 0x40, 0x35, 0x0, 0x6e,
+    0x0, 0xc2, 0xc0, 0x11, 0x28, 0x6, 0x80, 0xd,
+    0x0, 0x18, 0x98, 0x2, 0x25, 0x0, 0xc0,
     /* U+002A "*" */
-    0x0, 0x0, 0x0, 0xdf, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xa0, 0x0, 0x0, 0x0, 0x66,
-    0x10, 0xd, 0xfa, 0x0, 0x27, 0x30, 0xd, 0xff,
-    0xc7, 0xef, 0xc8, 0xdf, 0xfa, 0x1, 0xdf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x38, 0xef,
-    0xff, 0xff, 0xc7, 0x20, 0x0, 0x0, 0x1, 0xef,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xfe,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x8f, 0xfb, 0x1e,
-    0xff, 0x40, 0x0, 0x0, 0x4f, 0xfe, 0x10, 0x3f,
-    0xfe, 0x10, 0x0, 0x1, 0xaf, 0x30, 0x0, 0x7f,
-    0x70, 0x0, 0x0, 0x0, 0x20, 0x0, 0x0, 0x20,
-    0x0, 0x0,
-
+    0x0, 0xf6, 0xfd, 0x0, 0x7f, 0xf6, 0x59, 0x82,
+    0x1, 0xf1, 0x39, 0x80, 0x2e, 0x7b, 0x1c, 0xc1,
+    0xa3, 0x75, 0x12, 0x2, 0x1, 0x1c, 0x8, 0x1b,
+    0x90, 0x1, 0x80, 0x77, 0x1c, 0x40, 0x38, 0xe3,
+    0x70, 0x2, 0x38, 0xf1, 0x0, 0x8f, 0x1c, 0x80,
+    0x3d, 0x42, 0x2, 0x6, 0xe0, 0x1f, 0x42, 0x2,
+    0x78, 0x84, 0x20, 0x7, 0x23, 0x80, 0xd0, 0xe8,
+    0x2, 0x84, 0x3, 0x2a, 0x83, 0x44, 0xe, 0x2,
+    0x44, 0x3, 0xd, 0x69, 0x80, 0x4f, 0xae, 0x1,
     /* U+002B "+" */
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xcc, 0xc4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xff, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf4, 0x8f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x48, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf4, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xff, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0x0,
-
+    0x0, 0xfe, 0x8c, 0xc9, 0x0, 0x3f, 0xf8, 0xc4,
+    0x67, 0x8, 0x7, 0xff, 0xfc, 0x3, 0xff, 0xfe,
+    0x1, 0xff, 0xc8, 0x8f, 0xff, 0xca, 0x1, 0x57,
+    0xff, 0xe4, 0x0, 0xff, 0xfc, 0xc7, 0xff, 0xe5,
+    0x0, 0xab, 0xff, 0xf2, 0x0, 0x7f, 0xff, 0xc0,
+    0x3f, 0xff, 0xe0, 0x1f, 0xfd, 0x60,
     /* U+002C "," */
-    0x0, 0x6c, 0xc7, 0x0, 0x9, 0xff, 0xff, 0xb0,
-    0x1f, 0xff, 0xff, 0xf4, 0x4f, 0xff, 0xff, 0xf8,
-    0x2f, 0xff, 0xff, 0xfa, 0xd, 0xff, 0xff, 0xf9,
-    0x2, 0xdf, 0xff, 0xf7, 0x0, 0xb, 0xff, 0xf4,
-    0x0, 0xb, 0xff, 0xf0, 0x0, 0xe, 0xff, 0xa0,
-    0x0, 0x1f, 0xff, 0x40, 0x0, 0x5f, 0xfc, 0x0,
-    0x0, 0xaf, 0xf5, 0x0, 0x0, 0xff, 0xe0, 0x0,
-    0x4, 0xff, 0x70, 0x0,
-
+    0x0, 0x36, 0x61, 0xc0, 0x29, 0x91, 0x9a, 0x2c,
+    0x5, 0x80, 0x32, 0x21, 0x40, 0x3d, 0x8c, 0x1,
+    0xe2, 0x28, 0x3, 0x8c, 0x3c, 0x80, 0x37, 0x1,
+    0x6a, 0x0, 0x46, 0x1, 0xf2, 0x0, 0x4a, 0x0,
+    0x50, 0x8, 0x44, 0x0, 0xe0, 0x9, 0x0, 0x6,
+    0x80, 0x17, 0x80, 0x24, 0x3, 0x28, 0xa, 0x80,
+    0x48, 0x0, 0x90, 0x8,
     /* U+002D "-" */
-    0x12, 0x22, 0x22, 0x22, 0x22, 0x1a, 0xff, 0xff,
-    0xff, 0xff, 0xfa, 0xaf, 0xff, 0xff, 0xff, 0xff,
-    0xaa, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xaf, 0xff,
-    0xff, 0xff, 0xff, 0xaa, 0xff, 0xff, 0xff, 0xff,
-    0xfa, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xa0,
-
+    0x12, 0x2f, 0xe1, 0xbd, 0xdf, 0xeb, 0x0, 0xff,
+    0xf5, 0x80,
     /* U+002E "." */
-    0x0, 0x2, 0x10, 0x0, 0x2d, 0xff, 0xa0, 0xd,
-    0xff, 0xff, 0x83, 0xff, 0xff, 0xfd, 0x2f, 0xff,
-    0xff, 0xd0, 0xbf, 0xff, 0xf6, 0x1, 0x9e, 0xd7,
-    0x0,
-
+    0x0, 0x88, 0x40, 0x22, 0xdd, 0x75, 0x0, 0x3c,
+    0x80, 0xb, 0x6, 0x40, 0x19, 0x44, 0x3, 0xc4,
+    0x80, 0x1a, 0xc2, 0x98, 0x4a, 0x18,
     /* U+002F "/" */
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xff, 0x10, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xff, 0x10, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xff, 0x10, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xff, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0,
-
+    0x0, 0xfe, 0xff, 0xc0, 0x1f, 0xc8, 0x1, 0x28,
+    0x7, 0xf6, 0x80, 0x58, 0x1, 0xfc, 0xe0, 0x13,
+    0x80, 0x7e, 0x21, 0x0, 0x10, 0x80, 0x7e, 0x50,
+    0x9, 0x40, 0x3f, 0xb0, 0x2, 0xb0, 0xf, 0xe4,
+    0x0, 0x8c, 0x3, 0xf2, 0x80, 0x4a, 0x1, 0xfd,
+    0x80, 0x17, 0x80, 0x7f, 0x38, 0x4, 0x80, 0x1f,
+    0x88, 0x40, 0x6, 0x20, 0x1f, 0x94, 0x2, 0x40,
+    0xf, 0xeb, 0x0, 0xac, 0x3, 0xf0, 0x98, 0x0,
+    0x4c, 0x3, 0xf2, 0x0, 0x48, 0x1, 0xfd, 0x80,
+    0x17, 0x80, 0x7f, 0x38, 0x4, 0x80, 0x1f, 0x8c,
+    0x40, 0x6, 0x20, 0x1f, 0x90, 0x2, 0xb0, 0xf,
+    0xeb, 0x0, 0x90, 0x3, 0xf0, 0x98, 0x0, 0x4c,
+    0x3, 0xf2, 0x0, 0x4e, 0x1, 0xfd, 0xe0, 0x16,
+    0x0, 0x7f, 0x20, 0x4, 0xa0, 0x1f, 0x8c, 0x40,
+    0x8, 0x1, 0xfd, 0x60, 0x16, 0x0, 0x7f, 0x20,
+    0x4, 0xa0, 0x1f, 0x84, 0xc0, 0x2, 0x40, 0x1f,
+    0x90, 0x2, 0x70, 0xf, 0xef, 0x0, 0xb4, 0x3,
+    0xf8,
     /* U+0030 "0" */
-    0x0, 0x0, 0x0, 0x17, 0xce, 0xfc, 0x93, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff,
-    0xff, 0xb1, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0xff, 0xff, 0xff, 0xfd, 0x20, 0x0, 0x0, 0x5,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x0,
-    0x0, 0x1e, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xc0, 0x6,
-    0xff, 0xff, 0xfe, 0x0, 0x0, 0xef, 0xff, 0xff,
-    0x20, 0x0, 0xcf, 0xff, 0xff, 0x50, 0x4, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xa0,
-    0x8, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0xe0, 0xb, 0xff, 0xff, 0xf6, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xf1, 0xe, 0xff, 0xff, 0xf4,
-    0x0, 0x0, 0xe, 0xff, 0xff, 0xf3, 0xf, 0xff,
-    0xff, 0xf3, 0x0, 0x0, 0xd, 0xff, 0xff, 0xf5,
-    0xf, 0xff, 0xff, 0xf2, 0x0, 0x0, 0xc, 0xff,
-    0xff, 0xf7, 0x1f, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0xc, 0xff, 0xff, 0xf7, 0xf, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xf7, 0xf, 0xff,
-    0xff, 0xf3, 0x0, 0x0, 0xd, 0xff, 0xff, 0xf6,
-    0xd, 0xff, 0xff, 0xf5, 0x0, 0x0, 0xe, 0xff,
-    0xff, 0xf5, 0xb, 0xff, 0xff, 0xf7, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xf2, 0x7, 0xff, 0xff, 0xf9,
-    0x0, 0x0, 0x2f, 0xff, 0xff, 0xf0, 0x4, 0xff,
-    0xff, 0xfd, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xb0,
-    0x0, 0xef, 0xff, 0xff, 0x30, 0x0, 0xbf, 0xff,
-    0xff, 0x60, 0x0, 0x8f, 0xff, 0xff, 0xc0, 0x6,
-    0xff, 0xff, 0xfe, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0xff, 0xdf, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x6,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x10, 0x0, 0x0, 0x0, 0x6, 0xef, 0xff, 0xff,
-    0xff, 0xc1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xbd, 0xfd, 0xa4, 0x0, 0x0, 0x0,
-
+    0x0, 0xf0, 0xbe, 0x77, 0xe4, 0x98, 0x7, 0xfc,
+    0xdd, 0x6, 0x20, 0x6d, 0x96, 0x20, 0x1f, 0xa2,
+    0x40, 0x3f, 0x26, 0x10, 0x7, 0x95, 0xc0, 0x3f,
+    0xc5, 0xe0, 0x1c, 0x36, 0x1, 0xe2, 0x0, 0xe2,
+    0x80, 0xd, 0x22, 0x1, 0x8f, 0xf6, 0x40, 0x39,
+    0x80, 0x33, 0x0, 0x77, 0x0, 0x18, 0xc0, 0x30,
+    0xa8, 0x1, 0x4, 0x3, 0x19, 0x0, 0x54, 0x1,
+    0xde, 0x0, 0xc0, 0xe, 0x40, 0xc, 0x80, 0x1c,
+    0x80, 0x3, 0x0, 0xee, 0x0, 0xc4, 0x1, 0xc2,
+    0x20, 0x50, 0xe, 0x20, 0xe, 0x10, 0xe, 0x20,
+    0x10, 0xe, 0x70, 0xe, 0x30, 0xe, 0x60, 0xf,
+    0x84, 0x3, 0x84, 0x3, 0x88, 0x40, 0x3f, 0xf8,
+    0xe2, 0x1, 0xff, 0xce, 0x10, 0xe, 0x10, 0xe,
+    0x10, 0x20, 0xe, 0x60, 0xe, 0x30, 0xe, 0x30,
+    0x60, 0xe, 0x20, 0xe, 0x10, 0xe, 0x70, 0xc0,
+    0xe, 0xe0, 0xc, 0x40, 0x1e, 0x20, 0x30, 0xe,
+    0x40, 0xc, 0x80, 0x1c, 0x80, 0x4, 0x10, 0xc,
+    0x46, 0x1, 0x68, 0x7, 0x68, 0x4, 0xc0, 0x1d,
+    0xe0, 0x6, 0x40, 0xc, 0x2c, 0x1, 0x48, 0x7,
+    0x1f, 0xec, 0x80, 0x74, 0x80, 0x61, 0x90, 0xf,
+    0x10, 0x7, 0x1b, 0x80, 0x73, 0x38, 0x7, 0xf8,
+    0x74, 0x3, 0xe8, 0x91, 0x0, 0xf8, 0xfc, 0x40,
+    0x3f, 0x37, 0x42, 0x10, 0x12, 0xde, 0x8, 0x6,
     /* U+0031 "1" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0x0, 0x0, 0x5, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0xdf, 0xff, 0xff, 0x0, 0x14, 0xcf, 0xff, 0xff,
-    0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x88,
-    0x88, 0xff, 0xff, 0xff, 0x0, 0x0, 0xe, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0xef, 0xff, 0xff, 0x0,
-    0x0, 0xe, 0xff, 0xff, 0xf0, 0x0, 0x0, 0xef,
-    0xff, 0xff, 0x0, 0x0, 0xe, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0xef, 0xff, 0xff, 0x0, 0x0, 0xe,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0xef, 0xff, 0xff,
-    0x0, 0x0, 0xe, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0xef, 0xff, 0xff, 0x0, 0x0, 0xe, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0xef, 0xff, 0xff, 0x0, 0x0,
-    0xe, 0xff, 0xff, 0xf0, 0x0, 0x0, 0xef, 0xff,
-    0xff, 0x0, 0x0, 0xe, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0xef, 0xff, 0xff, 0x0,
-
+    0x0, 0xff, 0xe1, 0x8f, 0xff, 0x0, 0x71, 0x80,
+    0x7f, 0x9c, 0x3, 0xfd, 0x0, 0x1f, 0xa, 0x61,
+    0x0, 0x7b, 0xfa, 0xcc, 0x3, 0xff, 0xb8, 0xef,
+    0x80, 0x3e, 0x88, 0xc2, 0x1, 0xff, 0xff, 0x0,
+    0xff, 0xff, 0x80, 0x7f, 0xf2, 0x40,
     /* U+0032 "2" */
-    0x0, 0x0, 0x0, 0x1, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0x7b, 0xef, 0xff, 0xfb, 0x50, 0x0,
-    0x0, 0x9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc3,
-    0x0, 0x0, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf4, 0x0, 0xc, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xe0, 0x0, 0xcf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x60, 0xc, 0xfa, 0x41, 0x4, 0xcf,
-    0xff, 0xff, 0xfa, 0x0, 0x94, 0x0, 0x0, 0x0,
-    0xef, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xff, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0xff, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0xaf, 0xff, 0xff, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0xff, 0xfe, 0x40, 0x0, 0x0,
-    0x0, 0x5f, 0xff, 0xff, 0xfd, 0x20, 0x0, 0x0,
-    0x0, 0xd, 0xff, 0xff, 0xfc, 0x10, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xff, 0xfd, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xff, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xff, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x4f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf4, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x4f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf4, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x40,
-
+    0x0, 0xf8, 0x44, 0x1, 0xfe, 0x17, 0xbe, 0xfe,
+    0xe7, 0xda, 0x80, 0x7a, 0x7a, 0x10, 0x40, 0x32,
+    0x56, 0x18, 0x6, 0x50, 0xf, 0xf1, 0xe2, 0x0,
+    0x7f, 0xf1, 0x28, 0x3, 0xff, 0x88, 0x2c, 0x1,
+    0x96, 0xfb, 0xec, 0xc0, 0x3d, 0x80, 0x5, 0xba,
+    0x41, 0x4, 0xc1, 0x0, 0xe6, 0x0, 0x4a, 0x0,
+    0x79, 0x0, 0x39, 0xc0, 0x3f, 0xc2, 0x1, 0xc4,
+    0x1, 0xfc, 0x88, 0x0, 0xec, 0x0, 0xfc, 0x76,
+    0x1, 0xc4, 0xa0, 0x1f, 0x2e, 0x0, 0x7a, 0x40,
+    0x3e, 0x7a, 0x0, 0xf4, 0xa0, 0x7, 0xa6, 0x0,
+    0x3d, 0xc, 0x1, 0xea, 0x60, 0xf, 0x4b, 0x80,
+    0x7a, 0x14, 0x3, 0x86, 0xd8, 0x3, 0xca, 0xe0,
+    0x1c, 0x58, 0x80, 0x1f, 0x40, 0x7, 0x1e, 0x10,
+    0x7, 0xc8, 0x40, 0x18, 0xb4, 0x40, 0x3f, 0x70,
+    0x7, 0x40, 0x80, 0x7f, 0x38, 0x7, 0x20, 0x7,
+    0xf8, 0xc0, 0x3b, 0xbf, 0xff, 0x90, 0x40, 0x3f,
+    0xfe, 0xe0,
     /* U+0033 "3" */
-    0x0, 0x38, 0xce, 0xfe, 0xca, 0x50, 0x0, 0x0,
-    0x2, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xc4, 0x0,
-    0x0, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3,
-    0x0, 0x4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xe2, 0x0, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x80, 0x4, 0xfe, 0x94, 0x35, 0xcf, 0xff,
-    0xff, 0xfc, 0x0, 0x4a, 0x10, 0x0, 0x0, 0xdf,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x6, 0x89,
-    0xcf, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0xcf,
-    0xff, 0xff, 0xff, 0xe4, 0x0, 0x0, 0x0, 0xc,
-    0xff, 0xff, 0xff, 0xd4, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xff, 0xff, 0xfd, 0x60, 0x0, 0x0,
-    0xc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x0,
-    0x0, 0x0, 0x1, 0x4c, 0xff, 0xff, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xf2, 0x49, 0x10, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0xff, 0x4, 0xff, 0xa6, 0x34, 0x8f, 0xff,
-    0xff, 0xff, 0xb0, 0x4f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf4, 0x4, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfa, 0x0, 0x4f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfb, 0x0, 0x3, 0xef, 0xff, 0xff,
-    0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x49, 0xce,
-    0xff, 0xeb, 0x61, 0x0, 0x0, 0x0,
-
+    0x0, 0x1c, 0x67, 0x7f, 0x65, 0x28, 0x7, 0x8b,
+    0x71, 0xcc, 0x40, 0x4d, 0x6b, 0x10, 0x3, 0x31,
+    0x0, 0x7f, 0x1d, 0x98, 0x7, 0xff, 0x13, 0x48,
+    0x3, 0xff, 0x86, 0x34, 0x1, 0x85, 0xaf, 0x28,
+    0xc0, 0x3c, 0x80, 0x12, 0xfc, 0xa1, 0xae, 0x10,
+    0x7, 0x10, 0x1, 0x28, 0x40, 0x39, 0x40, 0x39,
+    0x40, 0x3f, 0xc2, 0x1, 0xc6, 0x1, 0xfc, 0x6c,
+    0x1, 0xd4, 0x1, 0xcd, 0x13, 0x98, 0x0, 0xe9,
+    0x20, 0xe, 0xa7, 0x63, 0x0, 0xc3, 0x6c, 0x1,
+    0xff, 0xc0, 0x2, 0xa4, 0x0, 0xff, 0xe1, 0x15,
+    0xeb, 0x0, 0x7f, 0xf0, 0xca, 0x68, 0x3, 0xb3,
+    0xfd, 0xd6, 0x60, 0x1c, 0xac, 0x1, 0xf0, 0xa6,
+    0x18, 0x7, 0x58, 0x7, 0xfa, 0x40, 0x38, 0x84,
+    0x3, 0xf9, 0x80, 0x3c, 0x60, 0x1f, 0xc8, 0x1,
+    0xf2, 0x48, 0x80, 0x71, 0x40, 0x7, 0x88, 0x1b,
+    0xa9, 0x8d, 0x23, 0x40, 0x3c, 0x80, 0x19, 0x67,
+    0x2d, 0xc0, 0x3e, 0xf0, 0xf, 0xfe, 0x1a, 0xa0,
+    0x7, 0xff, 0x9, 0x28, 0x0, 0xe2, 0x1, 0xfe,
+    0x8b, 0x0, 0x8f, 0xad, 0x8c, 0x40, 0x2, 0x93,
+    0xce, 0x1, 0x80,
     /* U+0034 "4" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xff, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xff, 0xff, 0xff, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0xff,
-    0xf4, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0xee, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x8f,
-    0xff, 0xf5, 0xdf, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x3f, 0xff, 0xfb, 0xd, 0xff, 0xff, 0xf4, 0x0,
-    0x0, 0xd, 0xff, 0xff, 0x10, 0xdf, 0xff, 0xff,
-    0x40, 0x0, 0x8, 0xff, 0xff, 0x60, 0xd, 0xff,
-    0xff, 0xf4, 0x0, 0x2, 0xff, 0xff, 0xc0, 0x0,
-    0xdf, 0xff, 0xff, 0x40, 0x0, 0xcf, 0xff, 0xf2,
-    0x0, 0xd, 0xff, 0xff, 0xf4, 0x0, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x57, 0x77, 0x77, 0x77,
-    0x77, 0xef, 0xff, 0xff, 0xa7, 0x72, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xff, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xf4, 0x0,
-    0x0,
-
+    0x0, 0xff, 0xe7, 0x9f, 0xff, 0x90, 0x3, 0xfe,
+    0xe0, 0xf, 0xfe, 0x2c, 0x10, 0x7, 0xff, 0x10,
+    0xdc, 0x3, 0xff, 0x8b, 0xc0, 0x1f, 0xfc, 0x58,
+    0x20, 0xf, 0xfe, 0x21, 0xb8, 0x7, 0xff, 0x17,
+    0x80, 0x21, 0x10, 0x7, 0xfe, 0x82, 0x0, 0xac,
+    0xc0, 0x3f, 0xe3, 0x70, 0x9, 0x14, 0x3, 0xff,
+    0x70, 0x6, 0xa0, 0xf, 0xfd, 0x4, 0x1, 0x48,
+    0x80, 0x7f, 0xc4, 0xe0, 0x11, 0xb0, 0x7, 0xfe,
+    0xe0, 0xd, 0xc0, 0x1f, 0xfc, 0x0, 0x30, 0xd,
+    0xbf, 0xf1, 0x0, 0x75, 0xff, 0x94, 0x3, 0xff,
+    0xdb, 0x11, 0xfc, 0x20, 0x1c, 0xb1, 0x7, 0x7f,
+    0xf1, 0x80, 0x77, 0x3b, 0x88, 0x3, 0xff, 0xfe,
+    0x1, 0xff, 0xdb,
     /* U+0035 "5" */
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x0,
-    0xff, 0xff, 0xff, 0xee, 0xee, 0xee, 0xe8, 0x0,
-    0xff, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0x48, 0xde, 0xb6, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0,
-    0xff, 0xff, 0xfd, 0x22, 0xef, 0xff, 0xff, 0xf0,
-    0x22, 0x22, 0x21, 0x0, 0x6f, 0xff, 0xff, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xf0,
-    0xd5, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xc0,
-    0xff, 0xc6, 0x33, 0x7f, 0xff, 0xff, 0xff, 0x60,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60, 0x0,
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xd4, 0x0, 0x0,
-    0x2, 0x7b, 0xef, 0xfd, 0xa5, 0x0, 0x0, 0x0,
-
+    0xff, 0xff, 0xe0, 0x7c, 0x80, 0x7f, 0xfb, 0x4,
+    0x7f, 0x0, 0x7e, 0xde, 0xef, 0x40, 0x7, 0xff,
+    0x71, 0xe3, 0x7a, 0xd8, 0x3, 0xfd, 0x6e, 0x42,
+    0x93, 0x60, 0x1f, 0xfc, 0x34, 0xa0, 0xf, 0xfe,
+    0x1a, 0xa0, 0x7, 0xff, 0xf, 0xc0, 0x3c, 0x5b,
+    0xa1, 0x0, 0xe4, 0xd, 0xde, 0xc2, 0x24, 0x0,
+    0x78, 0xc8, 0xb8, 0x40, 0x8, 0x1, 0xe7, 0x0,
+    0xfc, 0x60, 0x1f, 0xfc, 0x32, 0x0, 0xf3, 0x80,
+    0x7e, 0xa0, 0xf, 0x1e, 0xa8, 0x7, 0x1b, 0x0,
+    0x71, 0x81, 0x56, 0x31, 0x99, 0xf0, 0x3, 0xd4,
+    0x1, 0x1c, 0xe6, 0x20, 0x3, 0xc2, 0xc0, 0x1f,
+    0xfc, 0x2a, 0x0, 0xff, 0xe1, 0x4a, 0x0, 0x10,
+    0x3, 0xf8, 0xad, 0x80, 0x2b, 0xd8, 0x41, 0x0,
+    0x12, 0xd6, 0xa0, 0x6,
     /* U+0036 "6" */
-    0x0, 0x0, 0x0, 0x16, 0xbd, 0xfe, 0xc9, 0x50,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0xb, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x0, 0x0, 0x6f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x0, 0x1, 0xef, 0xff,
-    0xff, 0xfb, 0x53, 0x5a, 0xfe, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x2b, 0x0, 0xd,
-    0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xff, 0xff, 0xe0, 0x2a, 0xee, 0xb5,
-    0x0, 0x0, 0x8f, 0xff, 0xff, 0xb5, 0xff, 0xff,
-    0xff, 0xa0, 0x0, 0xaf, 0xff, 0xff, 0xdf, 0xff,
-    0xff, 0xff, 0xf9, 0x0, 0xbf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x20, 0xcf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0xbf, 0xff,
-    0xff, 0xff, 0xa6, 0xdf, 0xff, 0xff, 0xf1, 0xaf,
-    0xff, 0xff, 0xf9, 0x0, 0x3f, 0xff, 0xff, 0xf5,
-    0x9f, 0xff, 0xff, 0xe0, 0x0, 0xd, 0xff, 0xff,
-    0xf7, 0x6f, 0xff, 0xff, 0xa0, 0x0, 0xb, 0xff,
-    0xff, 0xf8, 0x3f, 0xff, 0xff, 0xd0, 0x0, 0xb,
-    0xff, 0xff, 0xf7, 0xf, 0xff, 0xff, 0xf1, 0x0,
-    0xd, 0xff, 0xff, 0xf5, 0xa, 0xff, 0xff, 0xf8,
-    0x0, 0x3f, 0xff, 0xff, 0xf1, 0x4, 0xff, 0xff,
-    0xff, 0x74, 0xdf, 0xff, 0xff, 0xc0, 0x0, 0xbf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0x0,
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x0,
-    0x0, 0x4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd1,
-    0x0, 0x0, 0x0, 0x4d, 0xff, 0xff, 0xff, 0xfb,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x6c, 0xef, 0xda,
-    0x40, 0x0, 0x0,
-
+    0x0, 0xf0, 0xb5, 0xef, 0xf6, 0x4a, 0x80, 0x7e,
+    0x7e, 0x94, 0x20, 0x13, 0x6a, 0xe0, 0xf, 0x64,
+    0x0, 0x7f, 0xf0, 0xec, 0xc0, 0x3f, 0xf8, 0x6c,
+    0x80, 0x1f, 0xfc, 0x31, 0x80, 0xf, 0x25, 0x65,
+    0x28, 0x7, 0x30, 0x80, 0x73, 0xda, 0x9a, 0xd6,
+    0xa8, 0x5, 0x40, 0x1c, 0x90, 0x1, 0xc5, 0x60,
+    0x2, 0x20, 0x7, 0x78, 0x7, 0xf9, 0xc0, 0x38,
+    0x50, 0xab, 0xb9, 0x6a, 0x1, 0xb4, 0x3, 0x95,
+    0x5a, 0xa2, 0x24, 0xaa, 0x0, 0x44, 0x1, 0xcd,
+    0x40, 0x1e, 0x59, 0x0, 0x8, 0x7, 0x10, 0x7,
+    0xe6, 0x20, 0x70, 0xf, 0xfe, 0x1c, 0x3, 0x80,
+    0x7c, 0xb2, 0x40, 0x1c, 0xa2, 0x20, 0xf, 0x35,
+    0x37, 0x0, 0x79, 0xc, 0x3, 0x86, 0x40, 0x6,
+    0x40, 0x1c, 0x5e, 0x1, 0xc8, 0x1, 0x98, 0x3,
+    0xbd, 0x40, 0x39, 0xc0, 0x3f, 0xde, 0x60, 0x1c,
+    0x42, 0x1, 0x30, 0x7, 0x10, 0x28, 0x7, 0x48,
+    0x0, 0xc8, 0x3, 0x90, 0x38, 0x3, 0x9d, 0xc9,
+    0xc0, 0x1c, 0x62, 0x8, 0x80, 0xe, 0x8b, 0x20,
+    0xe, 0x90, 0xa, 0x40, 0x3f, 0xf2, 0x28, 0x4,
+    0x56, 0x1, 0xfe, 0x2a, 0x0, 0xe4, 0xb2, 0x0,
+    0xf9, 0x30, 0x40, 0x3c, 0x9b, 0x26, 0x20, 0x4b,
+    0x76, 0x10, 0x8,
     /* U+0037 "7" */
-    0x6f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xa6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfa, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xa6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfa, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xff, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0xfa, 0x0, 0x0, 0x0, 0x0,
-
+    0x6f, 0xff, 0xfe, 0x1d, 0x0, 0x7f, 0xfe, 0x1b,
+    0xff, 0xf8, 0x80, 0x3b, 0x40, 0x3f, 0x8c, 0x80,
+    0x39, 0x80, 0x3f, 0xa4, 0x3, 0x94, 0x40, 0x3f,
+    0xa, 0x80, 0x77, 0x0, 0x7f, 0x30, 0x7, 0xa,
+    0x0, 0x7f, 0x50, 0x7, 0x30, 0x7, 0xf2, 0x10,
+    0x7, 0x50, 0x7, 0xf7, 0x80, 0x72, 0x10, 0x7,
+    0xe1, 0x40, 0xe, 0xe0, 0xf, 0xe9, 0x0, 0xe1,
+    0x50, 0xf, 0xe6, 0x0, 0xe6, 0x0, 0xfe, 0x51,
+    0x0, 0xea, 0x0, 0xfe, 0xe0, 0xe, 0x32, 0x0,
+    0xfc, 0x48, 0x1, 0xd2, 0x1, 0xfd, 0x60, 0x1e,
+    0x50, 0xf, 0xe7, 0x0, 0xe6, 0x0, 0xfe, 0x61,
+    0x0, 0xea, 0x0, 0xfe, 0xa0, 0xe, 0x33, 0x0,
+    0x7e, 0x33, 0x0, 0x75, 0x0, 0x7f, 0x50, 0x7,
+    0x98, 0x3, 0xf0, 0xb0, 0x7, 0x28, 0x7, 0xe0,
     /* U+0038 "8" */
-    0x0, 0x0, 0x1, 0x8b, 0xdf, 0xda, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0xff,
-    0xe6, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf6, 0x0, 0x0, 0x9, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf4, 0x0, 0x1, 0xff,
-    0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xb0, 0x0,
-    0x6f, 0xff, 0xff, 0xf2, 0x4, 0xff, 0xff, 0xff,
-    0x0, 0x9, 0xff, 0xff, 0xf9, 0x0, 0xd, 0xff,
-    0xff, 0xf0, 0x0, 0x9f, 0xff, 0xff, 0x90, 0x0,
-    0xdf, 0xff, 0xfd, 0x0, 0x7, 0xff, 0xff, 0xfd,
-    0x0, 0x1f, 0xff, 0xff, 0x70, 0x0, 0x3f, 0xff,
-    0xff, 0xf7, 0xa, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0xbf, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xc1, 0x0,
-    0x0, 0x1, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x1, 0xcf, 0xff, 0xff, 0xff,
-    0xfd, 0x40, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0xa, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x1d,
-    0xff, 0xff, 0xd2, 0x2d, 0xff, 0xff, 0xff, 0x30,
-    0xc, 0xff, 0xff, 0xe1, 0x0, 0xd, 0xff, 0xff,
-    0xfc, 0x6, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x5f,
-    0xff, 0xff, 0xf0, 0xaf, 0xff, 0xff, 0x20, 0x0,
-    0x2, 0xff, 0xff, 0xff, 0x3d, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xf3, 0xcf, 0xff,
-    0xff, 0x70, 0x0, 0x7, 0xff, 0xff, 0xff, 0x18,
-    0xff, 0xff, 0xff, 0x40, 0x4, 0xff, 0xff, 0xff,
-    0xd0, 0x2f, 0xff, 0xff, 0xff, 0xee, 0xff, 0xff,
-    0xff, 0xf6, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x9f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x10, 0x0, 0x0, 0x4c,
-    0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xad, 0xff, 0xeb, 0x71, 0x0, 0x0,
-    0x0,
-
+    0x0, 0xe1, 0x8b, 0xdf, 0xda, 0x60, 0xf, 0xf4,
+    0x73, 0xa1, 0x1, 0x2c, 0xf3, 0x0, 0x7d, 0x8e,
+    0x1, 0xf8, 0x65, 0x80, 0x3a, 0x4c, 0x3, 0xfe,
+    0x94, 0x0, 0x85, 0x80, 0x3c, 0x40, 0x1e, 0xf0,
+    0x9, 0xc0, 0x3d, 0xba, 0xb0, 0xe, 0x40, 0xb,
+    0xc0, 0x39, 0x88, 0x10, 0x80, 0x3f, 0xf9, 0x64,
+    0x1, 0x70, 0x7, 0x20, 0x0, 0x48, 0x3, 0x50,
+    0x4, 0x80, 0x1c, 0x4e, 0x16, 0x1, 0x8d, 0xc0,
+    0x23, 0x40, 0xe, 0x8b, 0x50, 0x8, 0xf4, 0x3,
+    0xa8, 0xc0, 0x39, 0x0, 0x24, 0xc1, 0x0, 0xe1,
+    0xd3, 0x0, 0xfc, 0xc8, 0x1, 0xf0, 0xc8, 0x7,
+    0xe2, 0xb7, 0x0, 0xf5, 0x50, 0x3, 0xfd, 0x10,
+    0x0, 0x87, 0x54, 0x2, 0x2d, 0xd1, 0x0, 0x73,
+    0x98, 0x3, 0x48, 0x2, 0x1c, 0x22, 0x69, 0x0,
+    0x77, 0x83, 0x18, 0x6, 0x81, 0x0, 0xa0, 0x3,
+    0x8c, 0x30, 0x3, 0x90, 0x3, 0x38, 0x7, 0x8d,
+    0xc0, 0x3f, 0xc2, 0x1, 0xf0, 0x80, 0x72, 0x80,
+    0x64, 0x0, 0xf1, 0x20, 0x7, 0x42, 0x0, 0x12,
+    0x0, 0x38, 0x86, 0x80, 0x3d, 0x7d, 0xcb, 0x0,
+    0xf5, 0x81, 0x38, 0x7, 0x84, 0x40, 0x1e, 0x36,
+    0x0, 0x43, 0x0, 0x7f, 0xe3, 0xd0, 0xd, 0x36,
+    0x60, 0x1f, 0xcf, 0x82, 0x1, 0xc9, 0x94, 0xa4,
+    0x0, 0x14, 0x8e, 0x80, 0xc,
     /* U+0039 "9" */
-    0x0, 0x0, 0x1, 0x7c, 0xef, 0xd8, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xa0, 0x0, 0x0, 0x4, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0xdf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x20, 0x0,
-    0x5f, 0xff, 0xff, 0xf7, 0x4d, 0xff, 0xff, 0xfa,
-    0x0, 0xa, 0xff, 0xff, 0xfa, 0x0, 0x2f, 0xff,
-    0xff, 0xf0, 0x0, 0xef, 0xff, 0xff, 0x40, 0x0,
-    0xbf, 0xff, 0xff, 0x50, 0x1f, 0xff, 0xff, 0xf2,
-    0x0, 0x7, 0xff, 0xff, 0xf9, 0x2, 0xff, 0xff,
-    0xff, 0x10, 0x0, 0x4f, 0xff, 0xff, 0xc0, 0x1f,
-    0xff, 0xff, 0xf3, 0x0, 0x6, 0xff, 0xff, 0xff,
-    0x0, 0xff, 0xff, 0xff, 0x70, 0x1, 0xef, 0xff,
-    0xff, 0xf0, 0xc, 0xff, 0xff, 0xfe, 0x31, 0xbf,
-    0xff, 0xff, 0xff, 0x10, 0x6f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf2, 0x0, 0xef, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x10, 0x6,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0x0, 0x9, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff,
-    0xff, 0x0, 0x0, 0x6, 0xef, 0xff, 0xb2, 0x7f,
-    0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x34, 0x20,
-    0xd, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xff, 0xff, 0x30, 0x0, 0x54,
-    0x0, 0x0, 0x2, 0xef, 0xff, 0xff, 0xd0, 0x0,
-    0x8, 0xfc, 0x63, 0x48, 0xff, 0xff, 0xff, 0xf6,
-    0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfd, 0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x20, 0x0, 0x0, 0x8f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x30, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0xff, 0xfb, 0x10, 0x0, 0x0, 0x0,
-    0x3, 0x8b, 0xdf, 0xec, 0x93, 0x0, 0x0, 0x0,
-    0x0,
-
+    0x0, 0xe1, 0x7c, 0xef, 0xd8, 0x20, 0xf, 0xf3,
+    0x74, 0x18, 0x81, 0x3e, 0xc0, 0x7, 0xe7, 0x90,
+    0xf, 0xcf, 0x40, 0x1e, 0x48, 0x0, 0xff, 0x2b,
+    0x80, 0x74, 0x80, 0x7f, 0xe8, 0x20, 0x9, 0x48,
+    0x3, 0xa2, 0xc8, 0x3, 0xa0, 0x2, 0xf0, 0xe,
+    0x57, 0x4f, 0x0, 0xe5, 0x0, 0x90, 0x3, 0xb8,
+    0x0, 0x48, 0x1, 0xca, 0x2, 0x20, 0xe, 0x60,
+    0xb, 0x0, 0x3b, 0x0, 0xc0, 0x3c, 0x60, 0x11,
+    0x80, 0x72, 0x81, 0x80, 0x78, 0x80, 0x22, 0x0,
+    0xe3, 0x1, 0x0, 0xf2, 0x0, 0x6, 0x0, 0x3f,
+    0x18, 0x7, 0x49, 0x8d, 0x8, 0x7, 0x84, 0x28,
+    0x3, 0x87, 0x39, 0x0, 0x3e, 0x30, 0x61, 0x0,
+    0xff, 0xe1, 0x98, 0x2, 0x0, 0x3f, 0xf8, 0x62,
+    0x0, 0x66, 0x0, 0x78, 0x60, 0x3, 0xfd, 0x32,
+    0x10, 0x9, 0x30, 0x3, 0xc8, 0x1, 0xcd, 0xd9,
+    0x7b, 0x65, 0x40, 0x1c, 0x60, 0x1f, 0x1a, 0x10,
+    0x21, 0x0, 0x75, 0x80, 0x4a, 0x80, 0x1c, 0x54,
+    0x1, 0xc4, 0x60, 0x16, 0xde, 0x31, 0xa4, 0x68,
+    0x80, 0x75, 0x80, 0x78, 0xe7, 0x2d, 0xc0, 0x3c,
+    0x4c, 0x1, 0xff, 0xc4, 0x1f, 0x0, 0xff, 0xe2,
+    0xe9, 0x0, 0x77, 0x80, 0x7f, 0x27, 0x18, 0x7,
+    0x9f, 0x1d, 0x8, 0x4, 0xdb, 0x2c, 0x40, 0x38,
     /* U+003A ":" */
-    0x1, 0xae, 0xd6, 0x0, 0xbf, 0xff, 0xf6, 0x2f,
-    0xff, 0xff, 0xd3, 0xff, 0xff, 0xfd, 0xd, 0xff,
-    0xff, 0x80, 0x2d, 0xff, 0xa0, 0x0, 0x2, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0x10, 0x0, 0x2d, 0xff,
-    0xa0, 0xd, 0xff, 0xff, 0x83, 0xff, 0xff, 0xfd,
-    0x2f, 0xff, 0xff, 0xd0, 0xbf, 0xff, 0xf6, 0x1,
-    0x9e, 0xd7, 0x0,
-
+    0x1, 0xae, 0xd6, 0x0, 0x52, 0x89, 0x4b, 0x12,
+    0x0, 0x6b, 0x10, 0xf, 0x19, 0x0, 0x65, 0xf,
+    0x20, 0x2, 0xc0, 0x16, 0xeb, 0xa8, 0x3, 0x10,
+    0x80, 0x7f, 0xf5, 0x48, 0x40, 0x22, 0xdd, 0x75,
+    0x0, 0x3c, 0x80, 0xb, 0x6, 0x40, 0x19, 0x44,
+    0x3, 0xc4, 0x80, 0x1a, 0xc2, 0x98, 0x4a, 0x18,
     /* U+003B ";" */
-    0x0, 0x2, 0x10, 0x0, 0x3, 0xdf, 0xfa, 0x0,
-    0xd, 0xff, 0xff, 0x80, 0x3f, 0xff, 0xff, 0xd0,
-    0x2f, 0xff, 0xff, 0xd0, 0xb, 0xff, 0xff, 0x60,
-    0x1, 0x9e, 0xd7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7c, 0xd8, 0x0, 0x9, 0xff, 0xff, 0xb0,
-    0x1f, 0xff, 0xff, 0xf4, 0x4f, 0xff, 0xff, 0xf8,
-    0x2f, 0xff, 0xff, 0xfa, 0xd, 0xff, 0xff, 0xf9,
-    0x2, 0xdf, 0xff, 0xf7, 0x0, 0xb, 0xff, 0xf3,
-    0x0, 0xb, 0xff, 0xf0, 0x0, 0xe, 0xff, 0xa0,
-    0x0, 0x1f, 0xff, 0x40, 0x0, 0x5f, 0xfc, 0x0,
-    0x0, 0xaf, 0xf5, 0x0, 0x0, 0xff, 0xe0, 0x0,
-    0x4, 0xff, 0x70, 0x0,
-
+    0x0, 0x88, 0x40, 0x31, 0xee, 0xba, 0x80, 0x2e,
+    0x20, 0x2, 0xc0, 0x19, 0x0, 0x65, 0x1, 0x0,
+    0xf8, 0x90, 0x3, 0x58, 0x2, 0x98, 0x4a, 0x18,
+    0x0, 0x33, 0xda, 0xe0, 0x1f, 0xfe, 0x87, 0xcd,
+    0x80, 0xa, 0x60, 0xc9, 0xec, 0x5, 0x80, 0x32,
+    0x21, 0x40, 0x3d, 0x8c, 0x1, 0xe2, 0x28, 0x3,
+    0x8c, 0x3c, 0x80, 0x37, 0x1, 0x6a, 0x0, 0x48,
+    0x1, 0xf1, 0x80, 0x4a, 0x0, 0x50, 0x8, 0x44,
+    0x0, 0xe0, 0x9, 0x0, 0x6, 0x80, 0x17, 0x80,
+    0x24, 0x3, 0x28, 0xa, 0x80, 0x48, 0x0, 0x90,
+    0x8,
     /* U+003C "<" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xc3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0x8e, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4b, 0xff, 0xff, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x17, 0xef, 0xff, 0xff,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x3, 0xaf,
-    0xff, 0xff, 0xff, 0xff, 0xb1, 0x0, 0x0, 0x0,
-    0x0, 0x6d, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x10,
-    0x0, 0x0, 0x0, 0x29, 0xff, 0xff, 0xff, 0xff,
-    0xfb, 0x40, 0x0, 0x0, 0x0, 0x5, 0xbf, 0xff,
-    0xff, 0xff, 0xfe, 0x71, 0x0, 0x0, 0x0, 0x1,
-    0x7e, 0xff, 0xff, 0xff, 0xff, 0xb4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xe8,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0xff, 0xfc, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0xff, 0xfa, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff,
-    0xff, 0xff, 0xd7, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0x8e, 0xff, 0xff, 0xff, 0xff, 0xa4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xcf,
-    0xff, 0xff, 0xff, 0xfd, 0x71, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3a, 0xff, 0xff, 0xff, 0xff,
-    0xfa, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0x7d, 0xff, 0xff, 0xff, 0xff, 0xd7, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xbf, 0xff, 0xff,
-    0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x28, 0xef, 0xff, 0xff, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6c, 0xff,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xaf, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x17,
-    0x20,
-
+    0x0, 0xff, 0xef, 0xb6, 0x18, 0x7, 0xff, 0x14,
+    0xa3, 0xa4, 0xc0, 0x3f, 0xf8, 0x89, 0x7a, 0xe2,
+    0x1, 0xff, 0xc3, 0x17, 0xeb, 0x40, 0xf, 0xfe,
+    0x21, 0xd7, 0x40, 0x80, 0x79, 0x8, 0x3, 0xf3,
+    0x6e, 0x28, 0x7, 0x86, 0x3a, 0xc4, 0x3, 0x8a,
+    0x7e, 0x48, 0x3, 0xc9, 0x7c, 0xe2, 0x1, 0xcb,
+    0x7a, 0xc0, 0x1e, 0x18, 0xeb, 0x40, 0xe, 0x17,
+    0xea, 0x40, 0xf, 0x25, 0xf3, 0x88, 0x7, 0xd3,
+    0x2, 0x1, 0xc2, 0xfd, 0x68, 0x1, 0xff, 0xc4,
+    0x3b, 0xe8, 0x10, 0xf, 0xfe, 0x31, 0xf2, 0x0,
+    0x7f, 0xf0, 0xb8, 0x3, 0xcb, 0x7a, 0xe2, 0x1,
+    0xff, 0x36, 0xb8, 0x80, 0x71, 0x47, 0x52, 0x0,
+    0x7f, 0x8a, 0x3a, 0x4c, 0x3, 0xcb, 0x7a, 0xe2,
+    0x1, 0xfe, 0x6c, 0xc2, 0x80, 0x78, 0xa3, 0xa9,
+    0x0, 0x3f, 0xc7, 0x5d, 0x4, 0x1, 0xe5, 0xbd,
+    0x71, 0x0, 0xfe, 0x17, 0xdb, 0x40, 0xf, 0x14,
+    0x71, 0x0, 0x7f, 0xc9, 0x7a, 0xe2, 0x1, 0xe1,
+    0x0, 0xff, 0xe0, 0x1, 0x47, 0x49, 0x80, 0x7f,
+    0xf2, 0x5b, 0x30, 0xa0, 0x1f, 0xfc, 0x93, 0xae,
+    0x81,
     /* U+003D "=" */
-    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x48, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x8f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x48, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf4, 0x8f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x48, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf4, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x40,
-
+    0x8f, 0xff, 0xfe, 0x4a, 0x0, 0x7f, 0xfe, 0x63,
+    0xff, 0xff, 0x92, 0x80, 0x1f, 0xff, 0xf0, 0xf,
+    0xfe, 0x2c, 0x7f, 0xff, 0xf2, 0x50, 0x3, 0xff,
+    0xf2,
     /* U+003E ">" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xa4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xfd, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0xff, 0xf9, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0xff, 0xff, 0xc5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xdf, 0xff, 0xff, 0xff, 0xfe, 0x81,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x39, 0xff,
-    0xff, 0xff, 0xff, 0xfa, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6d, 0xff, 0xff, 0xff, 0xff,
-    0xd7, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0x9f, 0xff, 0xff, 0xff, 0xff, 0x93, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x16, 0xdf, 0xff, 0xff,
-    0xff, 0xfc, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3a, 0xff, 0xff, 0xff, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x6e, 0xff,
-    0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6c, 0xff, 0xff, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x29, 0xff, 0xff, 0xff, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x6, 0xcf, 0xff,
-    0xff, 0xff, 0xfd, 0x60, 0x0, 0x0, 0x0, 0x2,
-    0x9f, 0xff, 0xff, 0xff, 0xff, 0xa3, 0x0, 0x0,
-    0x0, 0x0, 0x6c, 0xff, 0xff, 0xff, 0xff, 0xe8,
-    0x10, 0x0, 0x0, 0x0, 0x29, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x50, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0x92, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0xd6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0xfa, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xfe, 0x81, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x55, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0,
-
+    0x0, 0xff, 0xe5, 0xbd, 0x20, 0x7, 0xff, 0x23,
+    0xd6, 0xf5, 0x80, 0x3f, 0xf9, 0x25, 0x3f, 0x24,
+    0x1, 0xff, 0xc9, 0x6d, 0xc5, 0x0, 0xff, 0xe0,
+    0x6, 0x10, 0x7, 0x8e, 0xba, 0x4, 0x3, 0xfc,
+    0x9b, 0x8c, 0x1, 0xe1, 0x7e, 0xa4, 0x0, 0xff,
+    0x1c, 0xfc, 0x90, 0x7, 0x96, 0xf5, 0xc4, 0x3,
+    0xfc, 0xdb, 0x8c, 0x1, 0xe2, 0x8e, 0x93, 0x0,
+    0xff, 0x1c, 0xf4, 0x90, 0x7, 0x9b, 0x30, 0xa0,
+    0x1f, 0xe1, 0x6d, 0xc5, 0x0, 0xf1, 0xd1, 0x80,
+    0x7f, 0xe3, 0xae, 0x91, 0x0, 0xff, 0xe4, 0x3d,
+    0x8, 0x7, 0xff, 0x14, 0xa7, 0xe4, 0xc0, 0x3c,
+    0x20, 0x1f, 0xcd, 0x9a, 0xc0, 0x1e, 0x29, 0xf2,
+    0x0, 0xf1, 0x4f, 0xc9, 0x80, 0x79, 0x73, 0x58,
+    0x3, 0xcd, 0x9a, 0xc0, 0x1e, 0x17, 0xea, 0x30,
+    0xe, 0x29, 0xf9, 0x30, 0xf, 0x1d, 0x74, 0x8,
+    0x7, 0x9f, 0x58, 0x3, 0xe6, 0xdc, 0x50, 0xf,
+    0xef, 0x0, 0xf1, 0x4f, 0xc9, 0x0, 0x7f, 0xf1,
+    0x16, 0xf5, 0x80, 0x3f, 0xf8, 0x82, 0xfd, 0x48,
+    0x1, 0xff, 0xc4, 0xda, 0xe8, 0x10, 0xf, 0xfe,
+    0x30,
     /* U+003F "?" */
-    0x0, 0x48, 0xce, 0xff, 0xda, 0x60, 0x0, 0x0,
-    0x9e, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x50, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1,
-    0xff, 0xb5, 0x20, 0x3, 0xcf, 0xff, 0xff, 0xf6,
-    0xa2, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xfe, 0x20,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0xff, 0xf3, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xfe, 0x20, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0xff, 0xd1, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xff, 0xfe, 0x10, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0x66, 0x66, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x49, 0x83, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9e, 0xe8, 0x0, 0x0, 0x0, 0x0,
-
+    0x0, 0x24, 0x67, 0x7f, 0xb6, 0x98, 0x3, 0xa7,
+    0xad, 0xcc, 0x40, 0x4, 0xb3, 0xaa, 0x1, 0x30,
+    0x80, 0x7f, 0x15, 0x50, 0x3, 0xff, 0x86, 0xb0,
+    0x1, 0xff, 0xc3, 0x71, 0x0, 0x25, 0x6f, 0xfb,
+    0xc, 0x3, 0xce, 0xbb, 0x6a, 0x40, 0x3, 0xc0,
+    0xf, 0x75, 0x10, 0x7, 0xc2, 0x1, 0xde, 0x1,
+    0xf9, 0x44, 0x3, 0x8c, 0x3, 0xe3, 0xa0, 0xe,
+    0x34, 0x0, 0xf2, 0x60, 0x7, 0xf, 0x0, 0x79,
+    0x2c, 0x3, 0xda, 0x40, 0x1c, 0x76, 0x1, 0xc3,
+    0xa6, 0x1, 0xee, 0x0, 0xe2, 0xf2, 0x0, 0xf2,
+    0x10, 0x6, 0x1c, 0x10, 0xf, 0xb0, 0x3, 0xa8,
+    0x40, 0x3f, 0x10, 0x6, 0x24, 0x0, 0xfe, 0x10,
+    0xc, 0xe0, 0x1f, 0xef, 0x99, 0xe0, 0xf, 0xf2,
+    0x33, 0x63, 0x0, 0xff, 0x92, 0x60, 0xc0, 0x3f,
+    0xe7, 0xb6, 0x7c, 0x50, 0xf, 0xe1, 0x80, 0xd,
+    0x40, 0x1f, 0xca, 0x1, 0xe2, 0x0, 0xfc, 0xe0,
+    0x1e, 0x30, 0xf, 0xc6, 0x80, 0x19, 0x84, 0x3,
+    0xfa, 0xd8, 0x44, 0xf2, 0x1, 0xf0,
     /* U+0040 "@" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xab, 0xdf,
-    0xfd, 0xc9, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3b, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xa1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xef, 0xff, 0xfb, 0x62, 0x0, 0x0, 0x26, 0xbf,
-    0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x2e, 0xff,
-    0xfa, 0x20, 0x0, 0x0, 0x0, 0x0, 0x3, 0xbf,
-    0xff, 0x90, 0x0, 0x0, 0x1, 0xef, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0xf4, 0x0, 0x0, 0xa, 0xff, 0xe3, 0x0, 0x5,
-    0xbe, 0xeb, 0x50, 0x6, 0x66, 0x50, 0x9f, 0xfe,
-    0x0, 0x0, 0x5f, 0xff, 0x30, 0x1, 0xcf, 0xff,
-    0xff, 0xf9, 0x3f, 0xff, 0xa0, 0xc, 0xff, 0x60,
-    0x0, 0xdf, 0xf7, 0x0, 0x1d, 0xff, 0xff, 0xff,
-    0xff, 0xbf, 0xff, 0x70, 0x4, 0xff, 0xd0, 0x4,
-    0xff, 0xe0, 0x0, 0xaf, 0xff, 0xe5, 0x14, 0xdf,
-    0xff, 0xff, 0x50, 0x0, 0xdf, 0xf2, 0xa, 0xff,
-    0x60, 0x5, 0xff, 0xff, 0x20, 0x0, 0x2f, 0xff,
-    0xff, 0x20, 0x0, 0x8f, 0xf6, 0xf, 0xff, 0x0,
-    0xd, 0xff, 0xf7, 0x0, 0x0, 0xc, 0xff, 0xff,
-    0x0, 0x0, 0x4f, 0xf9, 0x3f, 0xfb, 0x0, 0x3f,
-    0xff, 0xf0, 0x0, 0x0, 0x9, 0xff, 0xfd, 0x0,
-    0x0, 0x3f, 0xfb, 0x7f, 0xf7, 0x0, 0x9f, 0xff,
-    0xa0, 0x0, 0x0, 0x9, 0xff, 0xfa, 0x0, 0x0,
-    0x1f, 0xfc, 0xaf, 0xf4, 0x0, 0xdf, 0xff, 0x60,
-    0x0, 0x0, 0xa, 0xff, 0xf7, 0x0, 0x0, 0x2f,
-    0xfb, 0xbf, 0xf3, 0x0, 0xff, 0xff, 0x30, 0x0,
-    0x0, 0xb, 0xff, 0xf5, 0x0, 0x0, 0x3f, 0xfa,
-    0xcf, 0xf2, 0x3, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0xd, 0xff, 0xf2, 0x0, 0x0, 0x6f, 0xf8, 0xdf,
-    0xf1, 0x4, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xf0, 0x0, 0x0, 0xaf, 0xf5, 0xcf, 0xf2,
-    0x4, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0xd0, 0x0, 0x0, 0xff, 0xf0, 0xaf, 0xf4, 0x2,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xa0,
-    0x0, 0x7, 0xff, 0xb0, 0x9f, 0xf5, 0x0, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0xef, 0xff, 0x80, 0x0,
-    0x2f, 0xff, 0x30, 0x6f, 0xf9, 0x0, 0xdf, 0xff,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0x50, 0x1, 0xdf,
-    0xfa, 0x0, 0x2f, 0xfe, 0x0, 0x6f, 0xff, 0x60,
-    0x0, 0xc, 0xff, 0xff, 0x40, 0x4e, 0xff, 0xd1,
-    0x0, 0xd, 0xff, 0x30, 0xf, 0xff, 0xf6, 0x12,
-    0xbf, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0x20, 0x0,
-    0x8, 0xff, 0xb0, 0x5, 0xff, 0xff, 0xff, 0xff,
-    0xcf, 0xff, 0xff, 0xff, 0xc1, 0x0, 0x0, 0x1,
-    0xff, 0xf4, 0x0, 0x4e, 0xff, 0xff, 0xe5, 0xb,
-    0xff, 0xff, 0xd5, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xfe, 0x10, 0x0, 0x46, 0x74, 0x0, 0x0, 0x47,
-    0x63, 0x0, 0x2, 0x44, 0x42, 0x0, 0xd, 0xff,
-    0xc1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xf2, 0x0, 0x2, 0xef, 0xfe,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xff, 0x40, 0x0, 0x0, 0x3f, 0xff, 0xf9,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x6, 0xdf, 0xff,
-    0xf4, 0x0, 0x0, 0x0, 0x2, 0xdf, 0xff, 0xfb,
-    0x63, 0x10, 0x2, 0x49, 0xef, 0xff, 0xfc, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x29, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfd, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0x8a, 0xcd, 0xdb,
-    0x96, 0x20, 0x0, 0x0, 0x0, 0x0,
-
+    0x0, 0xff, 0x96, 0xaf, 0x7f, 0xdb, 0x92, 0xa0,
+    0x1f, 0xfc, 0x53, 0xbf, 0xa5, 0x42, 0x0, 0x11,
+    0xb5, 0x7d, 0x8, 0x7, 0xff, 0x0, 0x27, 0x10,
+    0x3, 0xff, 0x2f, 0x30, 0x7, 0xf8, 0xb9, 0x80,
+    0x24, 0x9d, 0xff, 0xdb, 0x28, 0x1, 0x4c, 0x80,
+    0x3f, 0x16, 0x8, 0x1, 0x76, 0xd8, 0x80, 0x31,
+    0x35, 0xe2, 0x0, 0x1a, 0x40, 0x3c, 0x38, 0x20,
+    0xb, 0xa2, 0x0, 0xff, 0x1d, 0xb8, 0x1, 0x90,
+    0x3, 0xac, 0x40, 0x71, 0x0, 0xb, 0x7d, 0xcb,
+    0x50, 0x3, 0x34, 0xb0, 0xc0, 0xa, 0x0, 0xca,
+    0xa0, 0x6, 0x98, 0xe, 0x52, 0x8, 0x92, 0xa4,
+    0xe6, 0x6f, 0x9, 0x30, 0x16, 0x0, 0xa0, 0x1,
+    0x6, 0x3, 0x86, 0x1, 0xe6, 0x80, 0xb, 0x40,
+    0x10, 0x0, 0xb0, 0x2, 0x10, 0xb, 0x80, 0x2c,
+    0x80, 0x3, 0x5d, 0x64, 0x8, 0x1, 0x10, 0x1,
+    0x8, 0x8, 0x81, 0xc0, 0x8, 0x0, 0x2a, 0x80,
+    0x2c, 0x51, 0x4f, 0x0, 0xe7, 0x0, 0x94, 0x0,
+    0x80, 0xa0, 0x6, 0x0, 0x40, 0x5, 0x4, 0x1,
+    0x11, 0x80, 0x62, 0x0, 0xb0, 0x1, 0xe6, 0x0,
+    0x40, 0x1, 0x90, 0x4, 0xe0, 0x1c, 0xa0, 0x11,
+    0x0, 0x67, 0x0, 0x12, 0x0, 0x30, 0x1, 0x40,
+    0x12, 0x80, 0x7f, 0x9c, 0x3, 0x10, 0x1, 0xf4,
+    0x0, 0x60, 0x4, 0x0, 0xb0, 0x3, 0xc6, 0x1,
+    0x68, 0x6, 0x30, 0x3, 0x88, 0x1, 0xc0, 0x4,
+    0x1, 0x28, 0x7, 0x84, 0x2, 0x20, 0xc, 0x20,
+    0x1, 0x70, 0x0, 0x81, 0x80, 0x63, 0x0, 0xf3,
+    0x0, 0x4e, 0x1, 0x94, 0x0, 0x42, 0x0, 0x30,
+    0x70, 0x8, 0x80, 0x3c, 0x24, 0x1, 0x10, 0x6,
+    0xc0, 0x6, 0x88, 0x0, 0xc0, 0x38, 0x40, 0x3c,
+    0xa0, 0x11, 0x0, 0x72, 0x80, 0x15, 0x80, 0xc,
+    0xc, 0x1, 0x38, 0x7, 0xb0, 0x2, 0x70, 0xc,
+    0xe0, 0x4, 0x3, 0x0, 0x8, 0x10, 0x4, 0xc0,
+    0x1e, 0x60, 0x8, 0x80, 0x22, 0x80, 0x4, 0x7,
+    0x80, 0x30, 0x0, 0x40, 0x2, 0x0, 0xe4, 0x10,
+    0xb, 0x40, 0x3, 0xe0, 0x5, 0x30, 0x40, 0x3,
+    0x80, 0x2c, 0x2, 0x60, 0xd, 0x0, 0x18, 0x41,
+    0x3c, 0x80, 0xac, 0x0, 0x44, 0x1, 0x30, 0x60,
+    0xa, 0x58, 0x4a, 0xcc, 0x3, 0x5f, 0x58, 0x80,
+    0xf8, 0x80, 0x4a, 0x0, 0x80, 0x5, 0x0, 0x53,
+    0xda, 0x80, 0x60, 0x18, 0x40, 0x7, 0xe4, 0x1,
+    0xa4, 0x0, 0x88, 0x5, 0xb1, 0x0, 0xc3, 0x58,
+    0x80, 0x18, 0xab, 0x4, 0x3, 0x86, 0x0, 0x14,
+    0x20, 0x9d, 0x73, 0x17, 0xca, 0x17, 0x68, 0x9c,
+    0xd5, 0x2, 0x44, 0x88, 0x0, 0xe4, 0x3, 0xa2,
+    0x0, 0x46, 0x74, 0x0, 0xc8, 0xec, 0x60, 0x4,
+    0xdb, 0xb8, 0x3, 0x78, 0x81, 0xf9, 0x80, 0x7f,
+    0xf0, 0xa2, 0xc0, 0x2b, 0x20, 0x8, 0xb4, 0x0,
+    0x39, 0x22, 0x1, 0xfe, 0x6d, 0x70, 0xa, 0xd0,
+    0x3, 0x8f, 0x48, 0x0, 0xdd, 0x6c, 0x62, 0x0,
+    0x24, 0x9e, 0x92, 0x0, 0x1e, 0xa0, 0x7, 0xc5,
+    0xac, 0x1, 0x24, 0xe7, 0x7f, 0xb6, 0xd8, 0x40,
+    0x3, 0x38, 0x40, 0x1f, 0xe9, 0xd6, 0x0, 0xff,
+    0x8a, 0x79, 0x80, 0x3f, 0xf8, 0x0, 0x53, 0xf6,
+    0xea, 0x64, 0x44, 0x69, 0xdd, 0x30, 0x7, 0xc0,
     /* U+0041 "A" */
-    0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xff, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xff, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xfe, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0x9f, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xff, 0xd5, 0xff, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0xfa, 0x2f, 0xff,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff,
-    0x70, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xf4, 0xd, 0xff, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0xff, 0x20, 0xaf, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0x9, 0xff, 0xff, 0xf0,
-    0x7, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0xdf,
-    0xff, 0xfc, 0x0, 0x4f, 0xff, 0xff, 0xa0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0x90, 0x2, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0x5, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf3, 0x0, 0x0, 0xaf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x0,
-    0xe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfb, 0x0, 0x2, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf0, 0x0, 0x6f, 0xff, 0xff,
-    0xfd, 0xdd, 0xde, 0xff, 0xff, 0xff, 0x40, 0xb,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xf8, 0x0, 0xff, 0xff, 0xff, 0x50, 0x0, 0x0,
-    0xdf, 0xff, 0xff, 0xc0, 0x3f, 0xff, 0xff, 0xf1,
-    0x0, 0x0, 0xa, 0xff, 0xff, 0xff, 0x17, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0xf5, 0xbf, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x4,
-    0xff, 0xff, 0xff, 0x90,
-
+    0x0, 0xfb, 0xbf, 0xfa, 0xc0, 0x3f, 0xf8, 0x0,
+    0x42, 0x1, 0xc8, 0x1, 0xff, 0xc0, 0x4, 0x0,
+    0xf8, 0xc0, 0x3f, 0xf6, 0x80, 0x7c, 0x80, 0x1f,
+    0xf9, 0x0, 0x3e, 0xb0, 0xf, 0xf8, 0xc0, 0x3f,
+    0x18, 0x7, 0xfc, 0x80, 0x1f, 0xc8, 0x1, 0xfe,
+    0xc0, 0xc, 0x20, 0x1b, 0x0, 0x3f, 0xc8, 0x1,
+    0x9c, 0x3, 0x20, 0x7, 0xf2, 0x0, 0x62, 0xc0,
+    0xc, 0x62, 0x1, 0xfb, 0x0, 0x33, 0xb8, 0x3,
+    0x90, 0x3, 0xf2, 0x0, 0x6d, 0x20, 0xe, 0xc0,
+    0xf, 0x84, 0xc0, 0x31, 0x81, 0x0, 0x64, 0x0,
+    0xf9, 0x0, 0x39, 0x81, 0xc0, 0x31, 0x10, 0x3,
+    0xd8, 0x1, 0xc4, 0x1a, 0x1, 0xc8, 0x1, 0xe4,
+    0x0, 0xc6, 0x0, 0x30, 0xe, 0xc0, 0xe, 0x12,
+    0x0, 0xca, 0x0, 0x60, 0xe, 0x40, 0xe, 0x40,
+    0xe, 0x6f, 0xf6, 0x80, 0x70, 0x98, 0x6, 0xf0,
+    0xf, 0xfe, 0x1a, 0x0, 0x64, 0x0, 0xff, 0xe1,
+    0xe0, 0x4, 0x42, 0x1, 0xff, 0xc3, 0x40, 0x9,
+    0x0, 0x3c, 0x45, 0x84, 0x3, 0xc8, 0x0, 0xd0,
+    0xe, 0x7d, 0xdd, 0xc0, 0x1e, 0xc0, 0x2, 0x0,
+    0x76, 0x80, 0x71, 0x0, 0x72, 0x1, 0x80, 0x79,
+    0x0, 0x39, 0xc0, 0x38, 0xc5, 0x0, 0x38, 0x44,
+    0x1, 0xda, 0x1, 0xe4, 0xc0, 0xe, 0x50, 0xf,
+    0x18, 0x7, 0xb0,
     /* U+0042 "B" */
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xb6, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xd4, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x10, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf2, 0x0, 0x3f, 0xff, 0xff, 0xf6, 0x58, 0xff,
-    0xff, 0xff, 0xf4, 0x0, 0x3f, 0xff, 0xff, 0xf2,
-    0x0, 0x5f, 0xff, 0xff, 0xf5, 0x0, 0x3f, 0xff,
-    0xff, 0xf2, 0x0, 0x2f, 0xff, 0xff, 0xf3, 0x0,
-    0x3f, 0xff, 0xff, 0xf2, 0x0, 0x5f, 0xff, 0xff,
-    0xe0, 0x0, 0x3f, 0xff, 0xff, 0xf2, 0x15, 0xef,
-    0xff, 0xff, 0x40, 0x0, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x30, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x60,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x70, 0x0, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf9, 0x0, 0x3f, 0xff,
-    0xff, 0xf3, 0x12, 0x5d, 0xff, 0xff, 0xff, 0x50,
-    0x3f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0xdf, 0xff,
-    0xff, 0xc0, 0x3f, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xf0, 0x3f, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x5f, 0xff, 0xff, 0xf2, 0x3f, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xf2,
-    0x3f, 0xff, 0xff, 0xf2, 0x0, 0x2, 0xff, 0xff,
-    0xff, 0xf0, 0x3f, 0xff, 0xff, 0xf6, 0x45, 0x9f,
-    0xff, 0xff, 0xff, 0xc0, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xd1, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xe7, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xec, 0x96, 0x0, 0x0, 0x0,
-
+    0x3f, 0xff, 0xf6, 0xdb, 0x0, 0x7f, 0xf1, 0x49,
+    0x27, 0x50, 0x3, 0xff, 0x8c, 0x54, 0x20, 0x1f,
+    0xfc, 0x61, 0xd0, 0xf, 0xfe, 0x39, 0x90, 0x7,
+    0xf4, 0xd3, 0x80, 0x7c, 0xc0, 0x1f, 0xc8, 0xb1,
+    0x40, 0x1e, 0x10, 0xf, 0xfc, 0xe0, 0x1e, 0x60,
+    0xf, 0xfc, 0xe0, 0x1c, 0x26, 0x1, 0xfe, 0x15,
+    0xb0, 0xe, 0xa0, 0xf, 0xf6, 0xf5, 0x8, 0x6,
+    0x84, 0x0, 0xff, 0xe2, 0x1e, 0x38, 0x7, 0xff,
+    0x15, 0x94, 0x3, 0xff, 0x8c, 0xb3, 0xce, 0x1,
+    0xff, 0xc6, 0x18, 0x90, 0xf, 0xec, 0xed, 0xa2,
+    0x0, 0xe6, 0x50, 0xf, 0xc2, 0x22, 0x5d, 0x20,
+    0xe, 0x90, 0xf, 0xfe, 0x0, 0x50, 0x7, 0x18,
+    0x7, 0xff, 0x0, 0x8, 0x3, 0xc4, 0x1, 0xff,
+    0xb4, 0x3, 0xff, 0x8c, 0x4e, 0x1, 0xe2, 0x0,
+    0xf9, 0x10, 0xb3, 0xa0, 0x1e, 0x30, 0xf, 0xd3,
+    0x74, 0xc0, 0x1f, 0x58, 0x7, 0xff, 0x18, 0x9c,
+    0x3, 0xff, 0x8a, 0x58, 0x1, 0xff, 0xc4, 0x18,
+    0xd1, 0x0, 0xff, 0xc2, 0x6d, 0x3c, 0xe0, 0x18,
     /* U+0043 "C" */
-    0x0, 0x0, 0x0, 0x4, 0xad, 0xfe, 0xc9, 0x30,
-    0x0, 0x0, 0x2, 0xcf, 0xff, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xf2,
-    0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2,
-    0x0, 0xe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2,
-    0x0, 0x8f, 0xff, 0xff, 0xff, 0xfc, 0xdf, 0xf2,
-    0x0, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x1, 0xa2,
-    0x5, 0xff, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0xe, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x6, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0xfa, 0x10, 0x3, 0xc2,
-    0x0, 0x9f, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xf2,
-    0x0, 0x1e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2,
-    0x0, 0x5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x4, 0xef, 0xff, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x5, 0xbd, 0xfe, 0xb8, 0x20,
-
+    0x0, 0xf9, 0x2b, 0x7f, 0xb2, 0x4c, 0x3, 0xc5,
+    0x96, 0xa4, 0x2, 0x6d, 0x84, 0x1, 0x93, 0x4c,
+    0x3, 0xff, 0x1d, 0x80, 0x7f, 0xf0, 0xb4, 0x3,
+    0xff, 0x85, 0x2, 0x1, 0xf1, 0x90, 0x7, 0x38,
+    0x7, 0x9f, 0xf3, 0x79, 0x40, 0xa, 0x1, 0xe6,
+    0x80, 0x8, 0x68, 0x83, 0x80, 0x3d, 0x0, 0x1f,
+    0x94, 0x3, 0x94, 0x40, 0x3e, 0x11, 0x0, 0x76,
+    0x80, 0x7e, 0x20, 0xf, 0x18, 0x7, 0xe7, 0x0,
+    0xf3, 0x0, 0x7e, 0x10, 0xf, 0x18, 0x7, 0xe1,
+    0x0, 0xf1, 0x80, 0x7e, 0x70, 0xf, 0x30, 0x7,
+    0xe1, 0x0, 0xf0, 0x80, 0x7e, 0x21, 0x0, 0xef,
+    0x0, 0xfe, 0x50, 0xe, 0x51, 0x0, 0xfd, 0xa0,
+    0x1e, 0xb0, 0xf, 0xce, 0x1, 0xe5, 0xa1, 0x0,
+    0x1e, 0x10, 0xb, 0x0, 0x79, 0x7b, 0x7f, 0xc,
+    0x2, 0x81, 0x0, 0xf8, 0x80, 0x3c, 0x36, 0x1,
+    0xff, 0xc3, 0x59, 0x0, 0xff, 0xe1, 0xb5, 0x88,
+    0x7, 0xff, 0x9, 0x3a, 0x90, 0x80, 0x51, 0xf4,
+    0x80,
     /* U+0044 "D" */
-    0x4f, 0xff, 0xff, 0xff, 0xfe, 0xca, 0x50, 0x0,
-    0x0, 0x4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xe5, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x4, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x4f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x4,
-    0xff, 0xff, 0xff, 0x56, 0xaf, 0xff, 0xff, 0xff,
-    0x90, 0x4f, 0xff, 0xff, 0xf1, 0x0, 0x6f, 0xff,
-    0xff, 0xff, 0x4, 0xff, 0xff, 0xff, 0x10, 0x0,
-    0xbf, 0xff, 0xff, 0xf4, 0x4f, 0xff, 0xff, 0xf1,
-    0x0, 0x3, 0xff, 0xff, 0xff, 0x84, 0xff, 0xff,
-    0xff, 0x10, 0x0, 0xf, 0xff, 0xff, 0xfa, 0x4f,
-    0xff, 0xff, 0xf1, 0x0, 0x0, 0xbf, 0xff, 0xff,
-    0xc4, 0xff, 0xff, 0xff, 0x10, 0x0, 0xa, 0xff,
-    0xff, 0xfd, 0x4f, 0xff, 0xff, 0xf1, 0x0, 0x0,
-    0x9f, 0xff, 0xff, 0xe4, 0xff, 0xff, 0xff, 0x10,
-    0x0, 0x9, 0xff, 0xff, 0xff, 0x4f, 0xff, 0xff,
-    0xf1, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xe4, 0xff,
-    0xff, 0xff, 0x10, 0x0, 0xb, 0xff, 0xff, 0xfd,
-    0x4f, 0xff, 0xff, 0xf1, 0x0, 0x0, 0xdf, 0xff,
-    0xff, 0xa4, 0xff, 0xff, 0xff, 0x10, 0x0, 0xf,
-    0xff, 0xff, 0xf8, 0x4f, 0xff, 0xff, 0xf1, 0x0,
-    0x5, 0xff, 0xff, 0xff, 0x44, 0xff, 0xff, 0xff,
-    0x10, 0x0, 0xcf, 0xff, 0xff, 0xf0, 0x4f, 0xff,
-    0xff, 0xf1, 0x0, 0x8f, 0xff, 0xff, 0xf9, 0x4,
-    0xff, 0xff, 0xff, 0x67, 0xcf, 0xff, 0xff, 0xff,
-    0x20, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x90, 0x4, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xd0, 0x0, 0x4f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xc1, 0x0, 0x4, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x4f,
-    0xff, 0xff, 0xff, 0xec, 0xa6, 0x0, 0x0, 0x0,
-    0x0,
-
+    0x4f, 0xff, 0xdd, 0x94, 0xa0, 0x1f, 0xfc, 0x31,
+    0x35, 0xae, 0x50, 0xf, 0xfe, 0x28, 0xd4, 0x0,
+    0x7f, 0xf1, 0x9d, 0x80, 0x3f, 0xf8, 0xd2, 0x20,
+    0x1f, 0xaa, 0x54, 0x3, 0xe8, 0x0, 0xfc, 0x8d,
+    0x52, 0x1, 0xe6, 0x0, 0xff, 0x99, 0x0, 0x3c,
+    0x80, 0x1f, 0xf4, 0x0, 0x7b, 0x0, 0x3f, 0xe3,
+    0x0, 0xf1, 0x0, 0x7f, 0xe4, 0x0, 0xe6, 0x0,
+    0xff, 0xc2, 0x1, 0xc2, 0x1, 0xff, 0x8c, 0x3,
+    0x8c, 0x3, 0xff, 0x8c, 0x20, 0x1f, 0xf8, 0xc0,
+    0x38, 0x40, 0x3f, 0xf0, 0x80, 0x71, 0x80, 0x7f,
+    0xe6, 0x0, 0xe7, 0x0, 0xff, 0xc4, 0x1, 0xc4,
+    0x1, 0xff, 0x28, 0x7, 0xb0, 0x3, 0xfe, 0x90,
+    0xf, 0x20, 0x7, 0xfa, 0xc, 0x3, 0x98, 0x3,
+    0xf3, 0xbb, 0x1c, 0x3, 0xd6, 0x1, 0xfa, 0x60,
+    0xc0, 0x3c, 0xc4, 0x1, 0xff, 0xc4, 0x29, 0x0,
+    0xff, 0xe2, 0x1e, 0x0, 0x7f, 0xf1, 0x1f, 0x4,
+    0x3, 0xfe, 0x13, 0x59, 0xf8, 0x0, 0xe0,
     /* U+0045 "E" */
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x43, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf4, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x43, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf4, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x43, 0xff, 0xff, 0xff, 0x87, 0x77,
-    0x77, 0x77, 0x72, 0x3f, 0xff, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfa, 0x3, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x3, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x3,
-    0xff, 0xff, 0xff, 0x64, 0x44, 0x44, 0x44, 0x30,
-    0x3f, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0x87, 0x77,
-    0x77, 0x77, 0x72, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x43, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf4, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x43, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf4, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x40,
-
+    0x3f, 0xff, 0xfe, 0x1a, 0x0, 0x7f, 0xff, 0xde,
+    0x23, 0xf3, 0x0, 0x7d, 0x2e, 0xff, 0x88, 0x3,
+    0xff, 0xdd, 0xdf, 0xff, 0x50, 0x7, 0xff, 0xfc,
+    0x26, 0xef, 0xe9, 0x0, 0xfc, 0xe8, 0x9f, 0x18,
+    0x7, 0xff, 0xfc, 0x25, 0xdf, 0xf1, 0x0, 0x7c,
+    0xf1, 0x1f, 0x98, 0x3, 0xff, 0xf0,
     /* U+0046 "F" */
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x3f, 0xff, 0xff, 0xf9, 0x77, 0x77, 0x77, 0x77,
-    0x3f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4,
-    0x3f, 0xff, 0xff, 0xf6, 0x44, 0x44, 0x44, 0x41,
-    0x3f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-
+    0x3f, 0xff, 0xfe, 0x18, 0x7, 0xff, 0xed, 0xa2,
+    0x3f, 0x0, 0x7d, 0x6e, 0xff, 0x80, 0x3f, 0xff,
+    0x7b, 0xff, 0xf2, 0x0, 0x7f, 0xfe, 0xe6, 0xef,
+    0xe5, 0x0, 0xf9, 0x13, 0xf0, 0x80, 0x7f, 0xff,
+    0xc0, 0x3f, 0xff, 0x20,
     /* U+0047 "G" */
-    0x0, 0x0, 0x0, 0x6, 0xbd, 0xfe, 0xda, 0x50,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x40, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0x8, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x4f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0xdf, 0xff,
-    0xff, 0xff, 0xda, 0xae, 0xff, 0x80, 0x4, 0xff,
-    0xff, 0xff, 0xf5, 0x0, 0x0, 0x2b, 0x80, 0xa,
-    0xff, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x10,
-    0xf, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xd0,
-    0x7, 0xff, 0xff, 0xff, 0xf8, 0x9f, 0xff, 0xff,
-    0xc0, 0x7, 0xff, 0xff, 0xff, 0xf8, 0x8f, 0xff,
-    0xff, 0xc0, 0x7, 0xff, 0xff, 0xff, 0xf8, 0x7f,
-    0xff, 0xff, 0xd0, 0x7, 0xff, 0xff, 0xff, 0xf8,
-    0x6f, 0xff, 0xff, 0xf0, 0x7, 0xef, 0xff, 0xff,
-    0xf8, 0x4f, 0xff, 0xff, 0xf2, 0x0, 0x6, 0xff,
-    0xff, 0xf8, 0x1f, 0xff, 0xff, 0xf5, 0x0, 0x6,
-    0xff, 0xff, 0xf8, 0xd, 0xff, 0xff, 0xfc, 0x0,
-    0x7, 0xff, 0xff, 0xf8, 0x8, 0xff, 0xff, 0xff,
-    0x40, 0xa, 0xff, 0xff, 0xf8, 0x3, 0xff, 0xff,
-    0xff, 0xf8, 0x9f, 0xff, 0xff, 0xf8, 0x0, 0xbf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xff, 0x39,
-    0xff, 0xf8, 0x0, 0x0, 0x2, 0x8d, 0xfe, 0xa2,
-    0x0, 0xdf, 0xf8,
-
+    0x0, 0xf9, 0xaf, 0x7f, 0xb6, 0x94, 0x3, 0xf3,
+    0x7c, 0xa1, 0x0, 0x92, 0xd7, 0x20, 0x7, 0x54,
+    0x80, 0x7f, 0xe, 0x0, 0x68, 0x50, 0xf, 0xfe,
+    0x1a, 0x38, 0x7, 0xff, 0x12, 0x40, 0x3e, 0x25,
+    0x50, 0x80, 0x72, 0x10, 0x7, 0xab, 0x6a, 0x9d,
+    0xa8, 0x1, 0x70, 0x7, 0xa9, 0x40, 0x31, 0x5c,
+    0x80, 0x14, 0x3, 0x91, 0x40, 0x3e, 0x10, 0x20,
+    0xf, 0x68, 0x7, 0xf9, 0xc0, 0x3c, 0x80, 0x1f,
+    0xe2, 0x0, 0xe1, 0x20, 0xf, 0xf7, 0x80, 0x71,
+    0x80, 0x1f, 0xff, 0xe8, 0x10, 0xe, 0x10, 0xf,
+    0xf8, 0x40, 0x3f, 0xf8, 0xbe, 0x1, 0xc2, 0x1,
+    0xff, 0x8, 0x7, 0x10, 0x4, 0x20, 0x1f, 0x10,
+    0x7, 0x88, 0x1f, 0xa4, 0x3, 0xca, 0x1, 0xe7,
+    0x0, 0xff, 0x9, 0x0, 0x74, 0x80, 0x42, 0x1,
+    0xf2, 0x80, 0x71, 0xa0, 0x3, 0x40, 0x3e, 0xb0,
+    0xf, 0x5c, 0x4a, 0x80, 0x7c, 0x68, 0x1, 0xe7,
+    0x60, 0xf, 0xe9, 0x0, 0xff, 0xe2, 0x95, 0x0,
+    0x7f, 0xf1, 0x56, 0x80, 0x3e, 0xc6, 0x0, 0xfc,
+    0xba, 0xe4, 0x2, 0xba, 0x72, 0x40, 0x10,
     /* U+0048 "H" */
-    0xff, 0xff, 0xff, 0x50, 0x0, 0xa, 0xff, 0xff,
-    0xfb, 0xff, 0xff, 0xff, 0x50, 0x0, 0xa, 0xff,
-    0xff, 0xfb, 0xff, 0xff, 0xff, 0x50, 0x0, 0xa,
-    0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0x50, 0x0,
-    0xa, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0x50,
-    0x0, 0xa, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff,
-    0x50, 0x0, 0xa, 0xff, 0xff, 0xfb, 0xff, 0xff,
-    0xff, 0x50, 0x0, 0xa, 0xff, 0xff, 0xfb, 0xff,
-    0xff, 0xff, 0x50, 0x0, 0xa, 0xff, 0xff, 0xfb,
-    0xff, 0xff, 0xff, 0x50, 0x0, 0xa, 0xff, 0xff,
-    0xfb, 0xff, 0xff, 0xff, 0x50, 0x0, 0xa, 0xff,
-    0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff,
-    0xff, 0xff, 0x84, 0x44, 0x4b, 0xff, 0xff, 0xfb,
-    0xff, 0xff, 0xff, 0x50, 0x0, 0xa, 0xff, 0xff,
-    0xfb, 0xff, 0xff, 0xff, 0x50, 0x0, 0xa, 0xff,
-    0xff, 0xfb, 0xff, 0xff, 0xff, 0x50, 0x0, 0xa,
-    0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0x50, 0x0,
-    0xa, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0x50,
-    0x0, 0xa, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff,
-    0x50, 0x0, 0xa, 0xff, 0xff, 0xfb, 0xff, 0xff,
-    0xff, 0x50, 0x0, 0xa, 0xff, 0xff, 0xfb, 0xff,
-    0xff, 0xff, 0x50, 0x0, 0xa, 0xff, 0xff, 0xfb,
-    0xff, 0xff, 0xff, 0x50, 0x0, 0xa, 0xff, 0xff,
-    0xfb, 0xff, 0xff, 0xff, 0x50, 0x0, 0xa, 0xff,
-    0xff, 0xfb, 0xff, 0xff, 0xff, 0x50, 0x0, 0xa,
-    0xff, 0xff, 0xfb,
-
+    0xff, 0xf2, 0x80, 0x6a, 0xff, 0xeb, 0x0, 0xff,
+    0xff, 0x80, 0x7f, 0xff, 0xc0, 0x3f, 0xf8, 0xd5,
+    0xff, 0x94, 0x3, 0xff, 0xfe, 0x1, 0xfc, 0xf7,
+    0x79, 0x0, 0x3f, 0xf6, 0xa2, 0x61, 0x0, 0xff,
+    0xff, 0x80, 0x7f, 0xff, 0xc0, 0x3f, 0xfb, 0x0,
     /* U+0049 "I" */
-    0xff, 0xff, 0xff, 0x6f, 0xff, 0xff, 0xf6, 0xff,
-    0xff, 0xff, 0x6f, 0xff, 0xff, 0xf6, 0xff, 0xff,
-    0xff, 0x6f, 0xff, 0xff, 0xf6, 0xff, 0xff, 0xff,
-    0x6f, 0xff, 0xff, 0xf6, 0xff, 0xff, 0xff, 0x6f,
-    0xff, 0xff, 0xf6, 0xff, 0xff, 0xff, 0x6f, 0xff,
-    0xff, 0xf6, 0xff, 0xff, 0xff, 0x6f, 0xff, 0xff,
-    0xf6, 0xff, 0xff, 0xff, 0x6f, 0xff, 0xff, 0xf6,
-    0xff, 0xff, 0xff, 0x6f, 0xff, 0xff, 0xf6, 0xff,
-    0xff, 0xff, 0x6f, 0xff, 0xff, 0xf6, 0xff, 0xff,
-    0xff, 0x6f, 0xff, 0xff, 0xf6, 0xff, 0xff, 0xff,
-    0x6f, 0xff, 0xff, 0xf6, 0xff, 0xff, 0xff, 0x6f,
-    0xff, 0xff, 0xf6, 0xff, 0xff, 0xff, 0x60,
-
+    0xff, 0xf3, 0x0, 0x7f, 0xff, 0xc0, 0x3f, 0xff,
+    0xe0, 0x1f, 0xfd, 0x40,
     /* U+004A "J" */
-    0x0, 0xd, 0xff, 0xff, 0xf9, 0x0, 0xd, 0xff,
-    0xff, 0xf9, 0x0, 0xd, 0xff, 0xff, 0xf9, 0x0,
-    0xd, 0xff, 0xff, 0xf9, 0x0, 0xd, 0xff, 0xff,
-    0xf9, 0x0, 0xd, 0xff, 0xff, 0xf9, 0x0, 0xd,
-    0xff, 0xff, 0xf9, 0x0, 0xd, 0xff, 0xff, 0xf9,
-    0x0, 0xd, 0xff, 0xff, 0xf9, 0x0, 0xd, 0xff,
-    0xff, 0xf9, 0x0, 0xd, 0xff, 0xff, 0xf9, 0x0,
-    0xd, 0xff, 0xff, 0xf9, 0x0, 0xd, 0xff, 0xff,
-    0xf9, 0x0, 0xd, 0xff, 0xff, 0xf9, 0x0, 0xd,
-    0xff, 0xff, 0xf9, 0x0, 0xd, 0xff, 0xff, 0xf9,
-    0x0, 0xd, 0xff, 0xff, 0xf9, 0x0, 0xd, 0xff,
-    0xff, 0xf9, 0x0, 0xd, 0xff, 0xff, 0xf9, 0x0,
-    0xe, 0xff, 0xff, 0xf9, 0x0, 0x1f, 0xff, 0xff,
-    0xf8, 0x67, 0xbf, 0xff, 0xff, 0xf7, 0x8f, 0xff,
-    0xff, 0xff, 0xf5, 0x8f, 0xff, 0xff, 0xff, 0xf1,
-    0x8f, 0xff, 0xff, 0xff, 0xa0, 0x8f, 0xff, 0xff,
-    0xfc, 0x10, 0x5c, 0xef, 0xeb, 0x60, 0x0,
-
+    0x0, 0xb7, 0xff, 0xa4, 0x3, 0xff, 0xfe, 0x1,
+    0xff, 0xff, 0x0, 0xff, 0xea, 0x98, 0x7, 0xe1,
+    0x10, 0x7, 0xb, 0x3d, 0x0, 0x7b, 0xfa, 0x10,
+    0x3, 0xc4, 0x1, 0xfc, 0x80, 0x1f, 0x94, 0x40,
+    0x3e, 0x3b, 0xd, 0x31, 0x1, 0x49, 0xc1, 0x0,
     /* U+004B "K" */
-    0x3f, 0xff, 0xff, 0xf1, 0x0, 0x5, 0xff, 0xff,
-    0xfe, 0x3, 0xff, 0xff, 0xff, 0x10, 0x0, 0xdf,
-    0xff, 0xff, 0x50, 0x3f, 0xff, 0xff, 0xf1, 0x0,
-    0x5f, 0xff, 0xff, 0xb0, 0x3, 0xff, 0xff, 0xff,
-    0x10, 0xc, 0xff, 0xff, 0xf2, 0x0, 0x3f, 0xff,
-    0xff, 0xf1, 0x4, 0xff, 0xff, 0xf9, 0x0, 0x3,
-    0xff, 0xff, 0xff, 0x10, 0xcf, 0xff, 0xfe, 0x10,
-    0x0, 0x3f, 0xff, 0xff, 0xf1, 0x4f, 0xff, 0xff,
-    0x60, 0x0, 0x3, 0xff, 0xff, 0xff, 0x1b, 0xff,
-    0xff, 0xd0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xf5,
-    0xff, 0xff, 0xf4, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xff, 0xdf, 0xff, 0xff, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf5, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x3, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x10, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0xcf, 0xff, 0xff, 0xf6,
-    0x0, 0x3, 0xff, 0xff, 0xff, 0xf2, 0xdf, 0xff,
-    0xff, 0xb0, 0x0, 0x3f, 0xff, 0xff, 0xf8, 0x9,
-    0xff, 0xff, 0xff, 0x10, 0x3, 0xff, 0xff, 0xff,
-    0x20, 0x4f, 0xff, 0xff, 0xf6, 0x0, 0x3f, 0xff,
-    0xff, 0xf1, 0x0, 0xff, 0xff, 0xff, 0xc0, 0x3,
-    0xff, 0xff, 0xff, 0x10, 0xb, 0xff, 0xff, 0xff,
-    0x10, 0x3f, 0xff, 0xff, 0xf1, 0x0, 0x6f, 0xff,
-    0xff, 0xf7, 0x3, 0xff, 0xff, 0xff, 0x10, 0x2,
-    0xff, 0xff, 0xff, 0xc0, 0x3f, 0xff, 0xff, 0xf1,
-    0x0, 0xd, 0xff, 0xff, 0xff, 0x23, 0xff, 0xff,
-    0xff, 0x10, 0x0, 0x8f, 0xff, 0xff, 0xf7, 0x3f,
-    0xff, 0xff, 0xf1, 0x0, 0x4, 0xff, 0xff, 0xff,
-    0xd0,
-
+    0x3f, 0xff, 0x8, 0x4, 0xbf, 0xfd, 0xc0, 0x1f,
+    0xfa, 0x0, 0x3a, 0xc0, 0x3f, 0xe5, 0x20, 0xc,
+    0x8a, 0x1, 0xff, 0x48, 0x7, 0x48, 0x7, 0xfc,
+    0x86, 0x1, 0x98, 0x80, 0x3f, 0xe8, 0x0, 0xc3,
+    0x0, 0x1f, 0xf2, 0x18, 0x6, 0x81, 0x0, 0xff,
+    0xbc, 0x3, 0x13, 0x0, 0x7f, 0xc8, 0x80, 0xd,
+    0x20, 0x1f, 0xfa, 0x0, 0x39, 0x0, 0x3f, 0xf1,
+    0x0, 0x72, 0x80, 0x7f, 0xf1, 0xbc, 0x3, 0xff,
+    0x8c, 0xa0, 0x1f, 0xfc, 0x75, 0x0, 0xff, 0xe3,
+    0x70, 0x7, 0xff, 0x19, 0x4, 0x3, 0xfe, 0x30,
+    0xf, 0x38, 0x7, 0xfd, 0xc4, 0x1, 0xda, 0x1,
+    0xfe, 0x72, 0x40, 0xe, 0x41, 0x0, 0xfe, 0xa0,
+    0xd0, 0xf, 0x38, 0x7, 0xf1, 0x82, 0x0, 0x7a,
+    0x80, 0x3f, 0xf2, 0x0, 0x71, 0x88, 0x7, 0xfd,
+    0xa0, 0x1e, 0x60, 0xf, 0xf9, 0x0, 0x3d, 0x60,
+    0x1f, 0xf1, 0x10, 0x3, 0x8c, 0x80, 0x3f, 0xe5,
+    0x0, 0xf2, 0x80, 0x7f, 0xd8, 0x1, 0xea,
     /* U+004C "L" */
-    0x2f, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xfa, 0x88, 0x88, 0x88, 0x88,
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-
+    0x2f, 0xff, 0x18, 0x7, 0xff, 0xfc, 0x3, 0xff,
+    0xfe, 0x1, 0xff, 0xff, 0x0, 0xff, 0xff, 0x80,
+    0x7f, 0xf5, 0xe6, 0x23, 0xf0, 0x7, 0xca, 0xef,
+    0xf8, 0x3, 0xff, 0xe8,
     /* U+004D "M" */
-    0x1f, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0xb,
-    0xff, 0xff, 0xff, 0x61, 0xff, 0xff, 0xff, 0xf6,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xf6, 0x1f,
-    0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x6f, 0xff,
-    0xff, 0xff, 0x61, 0xff, 0xff, 0xff, 0xff, 0x20,
-    0x0, 0xc, 0xff, 0xff, 0xff, 0xf6, 0x1f, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x2, 0xff, 0xff, 0xff,
-    0xff, 0x61, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0x8f, 0xff, 0xff, 0xff, 0xf6, 0x1f, 0xff, 0xff,
-    0xff, 0xff, 0x40, 0xe, 0xff, 0xff, 0xff, 0xff,
-    0x61, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x4, 0xff,
-    0xff, 0xff, 0xff, 0xf6, 0x1f, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x9f, 0xff, 0xff, 0xff, 0xff, 0x61,
-    0xff, 0xff, 0xfd, 0xaf, 0xff, 0x6f, 0xff, 0xf9,
-    0xff, 0xff, 0xf6, 0x1f, 0xff, 0xff, 0xe5, 0xff,
-    0xff, 0xff, 0xfc, 0x8f, 0xff, 0xff, 0x61, 0xff,
-    0xff, 0xff, 0x1f, 0xff, 0xff, 0xff, 0x79, 0xff,
-    0xff, 0xf6, 0x1f, 0xff, 0xff, 0xf0, 0xcf, 0xff,
-    0xff, 0xf2, 0xaf, 0xff, 0xff, 0x61, 0xff, 0xff,
-    0xff, 0x7, 0xff, 0xff, 0xfd, 0xb, 0xff, 0xff,
-    0xf6, 0x1f, 0xff, 0xff, 0xf1, 0x1f, 0xff, 0xff,
-    0x80, 0xbf, 0xff, 0xff, 0x61, 0xff, 0xff, 0xff,
-    0x10, 0xbf, 0xff, 0xf2, 0xc, 0xff, 0xff, 0xf6,
-    0x1f, 0xff, 0xff, 0xf1, 0x6, 0xff, 0xfc, 0x0,
-    0xcf, 0xff, 0xff, 0x61, 0xff, 0xff, 0xff, 0x10,
-    0x1f, 0xff, 0x60, 0xc, 0xff, 0xff, 0xf6, 0x1f,
-    0xff, 0xff, 0xf1, 0x0, 0xaf, 0xf1, 0x0, 0xcf,
-    0xff, 0xff, 0x61, 0xff, 0xff, 0xff, 0x10, 0x5,
-    0xfb, 0x0, 0xc, 0xff, 0xff, 0xf6, 0x1f, 0xff,
-    0xff, 0xf1, 0x0, 0xf, 0x50, 0x0, 0xcf, 0xff,
-    0xff, 0x61, 0xff, 0xff, 0xff, 0x10, 0x0, 0x90,
-    0x0, 0xc, 0xff, 0xff, 0xf6, 0x1f, 0xff, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff,
-    0x61, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xff, 0xf6, 0x1f, 0xff, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0x61,
-    0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0xc,
-    0xff, 0xff, 0xf6, 0x1f, 0xff, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0x60,
-
+    0x1f, 0xff, 0x84, 0x3, 0xd7, 0xff, 0xe6, 0x0,
+    0xfc, 0xe0, 0x1c, 0x28, 0x1, 0xff, 0xc3, 0xa0,
+    0xe, 0x70, 0xf, 0xfe, 0x21, 0x90, 0x6, 0xa0,
+    0xf, 0xfe, 0x2d, 0x0, 0x44, 0x60, 0x1f, 0xfc,
+    0x56, 0x0, 0xa8, 0x3, 0xff, 0x8c, 0x28, 0x0,
+    0x60, 0xf, 0xfe, 0x3e, 0x82, 0x8, 0x7, 0xff,
+    0x1d, 0x83, 0x40, 0x3f, 0xf8, 0x84, 0xa0, 0x13,
+    0x30, 0x2, 0x60, 0xf, 0xfc, 0x7e, 0x1, 0x48,
+    0x4, 0x62, 0x1, 0xff, 0x85, 0x0, 0x3e, 0xb1,
+    0x0, 0xff, 0xe0, 0x0, 0x98, 0x7, 0x94, 0xc0,
+    0x3f, 0xf8, 0x56, 0x1, 0xc4, 0x41, 0x0, 0xff,
+    0xe0, 0x0, 0xb0, 0x7, 0x28, 0x7, 0xff, 0x10,
+    0x50, 0x3, 0x50, 0x38, 0x7, 0xff, 0xf, 0x40,
+    0x23, 0x20, 0xf, 0xfe, 0x2b, 0x80, 0x54, 0x1,
+    0xff, 0xc6, 0x15, 0x0, 0x38, 0x7, 0xff, 0x1f,
+    0xc1, 0x4, 0x3, 0xff, 0x8e, 0xa1, 0xc0, 0x1f,
+    0xfc, 0x96, 0x50, 0xf, 0xfe, 0x4c, 0x80, 0x7f,
+    0xff, 0xc0, 0x3f, 0xfa, 0x0,
     /* U+004E "N" */
-    0x1f, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x4f, 0xff,
-    0xff, 0xc1, 0xff, 0xff, 0xff, 0xd0, 0x0, 0x4,
-    0xff, 0xff, 0xfc, 0x1f, 0xff, 0xff, 0xff, 0x30,
-    0x0, 0x4f, 0xff, 0xff, 0xc1, 0xff, 0xff, 0xff,
-    0xf9, 0x0, 0x4, 0xff, 0xff, 0xfc, 0x1f, 0xff,
-    0xff, 0xff, 0xe0, 0x0, 0x4f, 0xff, 0xff, 0xc1,
-    0xff, 0xff, 0xff, 0xff, 0x40, 0x4, 0xff, 0xff,
-    0xfc, 0x1f, 0xff, 0xff, 0xff, 0xfa, 0x0, 0x4f,
-    0xff, 0xff, 0xc1, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0x4, 0xff, 0xff, 0xfc, 0x1f, 0xff, 0xff, 0xff,
-    0xff, 0x60, 0x4f, 0xff, 0xff, 0xc1, 0xff, 0xff,
-    0xff, 0xff, 0xfb, 0x4, 0xff, 0xff, 0xfc, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xf1, 0x4f, 0xff, 0xff,
-    0xc1, 0xff, 0xff, 0xff, 0xff, 0xff, 0x64, 0xff,
-    0xff, 0xfc, 0x1f, 0xff, 0xff, 0xda, 0xff, 0xfb,
-    0x3f, 0xff, 0xff, 0xc1, 0xff, 0xff, 0xfd, 0x5f,
-    0xff, 0xf3, 0xff, 0xff, 0xfc, 0x1f, 0xff, 0xff,
-    0xe1, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xc1, 0xff,
-    0xff, 0xfe, 0xb, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x1f, 0xff, 0xff, 0xf0, 0x6f, 0xff, 0xff, 0xff,
-    0xff, 0xc1, 0xff, 0xff, 0xff, 0x1, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x1f, 0xff, 0xff, 0xf0, 0xb,
-    0xff, 0xff, 0xff, 0xff, 0xc1, 0xff, 0xff, 0xff,
-    0x0, 0x5f, 0xff, 0xff, 0xff, 0xfc, 0x1f, 0xff,
-    0xff, 0xf0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xc1,
-    0xff, 0xff, 0xff, 0x0, 0xa, 0xff, 0xff, 0xff,
-    0xfc, 0x1f, 0xff, 0xff, 0xf0, 0x0, 0x4f, 0xff,
-    0xff, 0xff, 0xc1, 0xff, 0xff, 0xff, 0x0, 0x0,
-    0xef, 0xff, 0xff, 0xfc, 0x1f, 0xff, 0xff, 0xf0,
-    0x0, 0x8, 0xff, 0xff, 0xff, 0xc1, 0xff, 0xff,
-    0xff, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xfc, 0x1f,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0xdf, 0xff, 0xff,
-    0xc0,
-
+    0x1f, 0xff, 0x38, 0x6, 0x4f, 0xfe, 0xc0, 0xf,
+    0xa8, 0x3, 0xff, 0x8c, 0x46, 0x1, 0xff, 0xc6,
+    0xa0, 0xf, 0xfe, 0x33, 0x80, 0x7f, 0xf1, 0x85,
+    0x0, 0x3f, 0xf8, 0xdc, 0x1, 0xff, 0xc6, 0x50,
+    0xf, 0xfe, 0x3b, 0x0, 0x7f, 0xf1, 0xb4, 0x3,
+    0xff, 0x8c, 0x82, 0x1, 0xff, 0xc6, 0x70, 0xf,
+    0xfe, 0x0, 0x12, 0x80, 0x5a, 0xe0, 0x1f, 0xfc,
+    0x0, 0xf0, 0x9, 0x0, 0x3f, 0xf8, 0x0, 0x68,
+    0x1, 0x90, 0x3, 0xff, 0x80, 0x2, 0x80, 0x14,
+    0x0, 0x7f, 0xe1, 0xd, 0x0, 0xff, 0xe3, 0x38,
+    0x7, 0xff, 0x18, 0x50, 0x3, 0xff, 0x8d, 0xc0,
+    0x1f, 0xfc, 0x65, 0x0, 0xff, 0xe3, 0xa8, 0x7,
+    0xff, 0x1b, 0x80, 0x3f, 0xf8, 0xc8, 0x20, 0x1f,
+    0xfc, 0x66, 0x0, 0xff, 0xe3, 0x50, 0x7, 0xff,
+    0x18, 0x88, 0x1, 0xe0,
     /* U+004F "O" */
-    0x0, 0x0, 0x0, 0x5, 0xbd, 0xfe, 0xc9, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xcf, 0xff,
-    0xff, 0xff, 0xfc, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x30, 0x0, 0x0, 0xc, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x5f, 0xff, 0xff, 0xff, 0xdd, 0xff, 0xff, 0xff,
-    0xf7, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xf5, 0x0,
-    0x3f, 0xff, 0xff, 0xfe, 0x0, 0x2, 0xff, 0xff,
-    0xff, 0x90, 0x0, 0x6, 0xff, 0xff, 0xff, 0x40,
-    0x7, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0x80, 0xa, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0xaf, 0xff, 0xff, 0xc0, 0xd, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0xd0, 0xf, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0xff, 0xf0, 0xf, 0xff, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xf1, 0x1f,
-    0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xf2, 0xf, 0xff, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xff, 0xf1, 0xf, 0xff, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xf0,
-    0xd, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xe0, 0xa, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0xcf, 0xff, 0xff, 0xb0, 0x7, 0xff,
-    0xff, 0xff, 0x10, 0x0, 0x1, 0xff, 0xff, 0xff,
-    0x80, 0x2, 0xff, 0xff, 0xff, 0x90, 0x0, 0x9,
-    0xff, 0xff, 0xff, 0x30, 0x0, 0xdf, 0xff, 0xff,
-    0xf6, 0x0, 0x6f, 0xff, 0xff, 0xfd, 0x0, 0x0,
-    0x6f, 0xff, 0xff, 0xff, 0xee, 0xff, 0xff, 0xff,
-    0xf6, 0x0, 0x0, 0xd, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x2, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x20, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x2, 0xdf, 0xff,
-    0xff, 0xff, 0xfc, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xad, 0xfe, 0xd9, 0x30, 0x0, 0x0,
-    0x0,
-
+    0x0, 0xf9, 0x6f, 0x7f, 0xb2, 0x4c, 0x3, 0xff,
+    0x16, 0x52, 0x10, 0x9, 0xb6, 0x60, 0xc0, 0x3f,
+    0x8f, 0x4c, 0x3, 0xf1, 0xe2, 0x80, 0x7c, 0x58,
+    0x1, 0xff, 0xa8, 0xc0, 0x3d, 0xc0, 0x1f, 0xfc,
+    0x2d, 0x0, 0xe5, 0x30, 0xf, 0x11, 0x0, 0x3c,
+    0x2e, 0x1, 0xa4, 0x3, 0xd5, 0xba, 0xc0, 0xf,
+    0x48, 0x4, 0x46, 0x1, 0xcc, 0xa0, 0x3, 0x90,
+    0xe, 0x14, 0x0, 0x28, 0x7, 0xa4, 0x3, 0x30,
+    0x7, 0xb0, 0x1, 0xa0, 0x1c, 0x60, 0x1e, 0x50,
+    0xe, 0x40, 0x3, 0x80, 0x72, 0x0, 0x7b, 0x40,
+    0x38, 0x40, 0x4, 0x1, 0xdc, 0x1, 0xe2, 0x0,
+    0xe2, 0x0, 0xfc, 0x60, 0x1e, 0x10, 0xf, 0x8,
+    0x80, 0x3c, 0x20, 0x1e, 0x70, 0xf, 0x18, 0x80,
+    0x78, 0x40, 0x3c, 0xe0, 0x1e, 0x30, 0xf, 0x88,
+    0x3, 0xc4, 0x1, 0xe1, 0x2, 0x0, 0xef, 0x0,
+    0xf0, 0x80, 0x70, 0x80, 0x1c, 0x3, 0x90, 0x3,
+    0xd6, 0x1, 0xca, 0x0, 0xd0, 0xe, 0x31, 0x0,
+    0xc2, 0x60, 0x1c, 0x60, 0x5, 0x0, 0xf4, 0x0,
+    0x68, 0x0, 0xf5, 0x80, 0x8, 0x80, 0x1c, 0xcc,
+    0x0, 0x33, 0x0, 0x38, 0x8c, 0x2, 0xb0, 0xf,
+    0x4f, 0x72, 0x40, 0x3d, 0x60, 0x19, 0x88, 0x3,
+    0xc2, 0x20, 0xf, 0x1b, 0x0, 0x77, 0x80, 0x7f,
+    0xf0, 0x0, 0x78, 0x3, 0xc5, 0x60, 0x1f, 0xfb,
+    0x48, 0x3, 0xe4, 0xd2, 0x0, 0xfc, 0x7a, 0x60,
+    0x1f, 0xc5, 0xb6, 0xa4, 0x2, 0x4d, 0x98, 0x20,
+    0xe,
     /* U+0050 "P" */
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xc8, 0x10,
-    0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x70, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x90, 0x3, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x30, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3,
-    0xff, 0xff, 0xff, 0x64, 0x59, 0xff, 0xff, 0xff,
-    0xf0, 0x3f, 0xff, 0xff, 0xf1, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0x23, 0xff, 0xff, 0xff, 0x10, 0x0,
-    0x1f, 0xff, 0xff, 0xf5, 0x3f, 0xff, 0xff, 0xf1,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0x43, 0xff, 0xff,
-    0xff, 0x10, 0x0, 0x7f, 0xff, 0xff, 0xf2, 0x3f,
-    0xff, 0xff, 0xf1, 0x2, 0x7f, 0xff, 0xff, 0xfe,
-    0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x90, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf2, 0x3, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf5, 0x0, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf5, 0x0, 0x3, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfd, 0x81, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xf6, 0x44, 0x31, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0,
-
+    0x3f, 0xff, 0xf7, 0x64, 0x8, 0x7, 0xff, 0xc,
+    0x4d, 0xf9, 0xc0, 0x3f, 0xf8, 0xd1, 0x20, 0x1f,
+    0xfc, 0x66, 0x30, 0xf, 0xfe, 0x37, 0x80, 0x7e,
+    0x9b, 0xa6, 0x0, 0xf1, 0x80, 0x7e, 0x74, 0x59,
+    0x80, 0xf, 0x10, 0x7, 0xfc, 0xc0, 0x1e, 0x70,
+    0xf, 0xfe, 0x30, 0x80, 0x7f, 0xcc, 0x1, 0xe6,
+    0x0, 0xfe, 0x27, 0x80, 0xe, 0x12, 0x0, 0xfb,
+    0xbf, 0x60, 0x3, 0xce, 0x1, 0xff, 0xc6, 0xb0,
+    0xf, 0xfe, 0x2d, 0x10, 0x7, 0xff, 0x12, 0x94,
+    0x3, 0xff, 0x84, 0x4f, 0xca, 0x1, 0xfe, 0x9b,
+    0xb6, 0x76, 0xc0, 0x80, 0x7f, 0xce, 0x88, 0x31,
+    0x0, 0xff, 0xff, 0x80, 0x7f, 0xff, 0xc0, 0x3f,
+    0xfa, 0x0,
     /* U+0051 "Q" */
-    0x0, 0x0, 0x0, 0x3, 0x9c, 0xef, 0xd9, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xbf, 0xff,
-    0xff, 0xff, 0xfc, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x2e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x0,
-    0x0, 0x0, 0x1, 0xef, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x20, 0x0, 0x0, 0xb, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0xdd, 0xff, 0xff, 0xff,
-    0xf6, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xf5, 0x0,
-    0x4f, 0xff, 0xff, 0xfd, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0x7, 0xff, 0xff, 0xff, 0x30,
-    0x6, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0x70, 0x9, 0xff, 0xff, 0xfd, 0x0,
-    0x0, 0x0, 0xbf, 0xff, 0xff, 0xa0, 0xc, 0xff,
-    0xff, 0xf9, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0xe0, 0xe, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0xff, 0xf0, 0xf, 0xff, 0xff, 0xf6,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xf0, 0xf,
-    0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xf1, 0xf, 0xff, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xf2, 0xf, 0xff, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xf1,
-    0xe, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0xff, 0xf0, 0xd, 0xff, 0xff, 0xf9, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0xff, 0xd0, 0x9, 0xff,
-    0xff, 0xfd, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff,
-    0xb0, 0x5, 0xff, 0xff, 0xff, 0x20, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0x70, 0x1, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x8, 0xff, 0xff, 0xff, 0x20, 0x0,
-    0xbf, 0xff, 0xff, 0xf5, 0x0, 0x4f, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xdd,
-    0xff, 0xff, 0xff, 0xf5, 0x0, 0x0, 0xb, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x0,
-    0x0, 0x1, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x10, 0x0, 0x0, 0x0, 0x1d, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe3, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xcf, 0xff, 0xff, 0xff, 0xfb, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xad, 0xff, 0xff,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0xfe, 0x51, 0x17, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xff,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xff, 0xff, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2c, 0xff,
-    0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x58, 0xaa, 0x84, 0x0,
-
+    0x0, 0xf8, 0xe7, 0x3b, 0xf6, 0x50, 0x3, 0xff,
+    0xd, 0xe3, 0x18, 0x81, 0x35, 0xe1, 0x0, 0x7f,
+    0x17, 0xa0, 0x7, 0xe3, 0xd3, 0x0, 0xf8, 0x70,
+    0x40, 0x3f, 0xec, 0x20, 0xf, 0x50, 0x80, 0x7f,
+    0xf0, 0x3, 0x80, 0x38, 0xd0, 0x3, 0xc4, 0x40,
+    0xf, 0x1b, 0x0, 0x68, 0x0, 0xf5, 0x6e, 0xac,
+    0x3, 0xd6, 0x1, 0xa, 0x0, 0x73, 0xa8, 0x1,
+    0x20, 0x3, 0x88, 0xc0, 0xe, 0x1, 0xe9, 0x0,
+    0xce, 0x1, 0xe4, 0x0, 0x78, 0x7, 0x10, 0x80,
+    0x72, 0x0, 0x76, 0x80, 0x14, 0x3, 0x90, 0x3,
+    0xd8, 0x1, 0xc8, 0x0, 0x20, 0xe, 0xe0, 0xf,
+    0x10, 0x7, 0x8, 0x0, 0x40, 0x38, 0x40, 0x3c,
+    0x20, 0x1f, 0xfc, 0x22, 0x0, 0xf3, 0x80, 0x78,
+    0x40, 0x3e, 0x10, 0xf, 0xfe, 0x0, 0x18, 0x7,
+    0xc6, 0x1, 0xe6, 0x0, 0xf1, 0x80, 0x80, 0x70,
+    0x80, 0x78, 0xc0, 0x3c, 0x20, 0x60, 0x1d, 0xc0,
+    0x1e, 0xe0, 0xe, 0x20, 0x2, 0x0, 0x72, 0x0,
+    0x79, 0x0, 0x39, 0x80, 0x18, 0x1, 0xc4, 0x40,
+    0xc, 0x26, 0x1, 0xd8, 0x0, 0x40, 0xf, 0x50,
+    0x6, 0x90, 0xf, 0x28, 0x0, 0x50, 0x3, 0x9d,
+    0x40, 0x8, 0xe0, 0x1c, 0x64, 0x1, 0x40, 0x7,
+    0xab, 0x75, 0x60, 0x1e, 0x90, 0xc, 0x68, 0x1,
+    0xe2, 0x20, 0x7, 0x95, 0x40, 0x1d, 0x44, 0x1,
+    0xff, 0x86, 0xc0, 0x3c, 0x38, 0x40, 0x1f, 0xe1,
+    0xd1, 0x0, 0xf8, 0x70, 0xc0, 0x3f, 0x26, 0x18,
+    0x7, 0xf0, 0xe5, 0xa9, 0x0, 0x74, 0x10, 0x7,
+    0xfe, 0x4a, 0xd6, 0x0, 0xda, 0xa2, 0x27, 0x40,
+    0xf, 0xfa, 0xc0, 0x30, 0xd7, 0x72, 0x0, 0x3f,
+    0xf1, 0x28, 0x7, 0xff, 0x26, 0x84, 0x3, 0xff,
+    0x93, 0x86, 0x1, 0xff, 0xc8, 0x2c, 0xa7, 0x55,
+    0x3d, 0xa0, 0x0,
     /* U+0052 "R" */
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xb8, 0x10,
-    0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x80, 0x3, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x30, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x3,
-    0xff, 0xff, 0xff, 0x65, 0x7c, 0xff, 0xff, 0xff,
-    0xd0, 0x3f, 0xff, 0xff, 0xf1, 0x0, 0xd, 0xff,
-    0xff, 0xfe, 0x3, 0xff, 0xff, 0xff, 0x10, 0x0,
-    0x8f, 0xff, 0xff, 0xd0, 0x3f, 0xff, 0xff, 0xf1,
-    0x0, 0x9, 0xff, 0xff, 0xfa, 0x3, 0xff, 0xff,
-    0xff, 0x10, 0x0, 0xdf, 0xff, 0xff, 0x50, 0x3f,
-    0xff, 0xff, 0xf1, 0x2, 0xbf, 0xff, 0xff, 0xa0,
-    0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfa, 0x20, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x30, 0x0, 0x3, 0xff,
-    0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0x30, 0x0,
-    0x3f, 0xff, 0xff, 0xf1, 0x1b, 0xff, 0xff, 0xfe,
-    0x0, 0x3, 0xff, 0xff, 0xff, 0x10, 0x1f, 0xff,
-    0xff, 0xf4, 0x0, 0x3f, 0xff, 0xff, 0xf1, 0x0,
-    0xbf, 0xff, 0xff, 0xa0, 0x3, 0xff, 0xff, 0xff,
-    0x10, 0x8, 0xff, 0xff, 0xfd, 0x0, 0x3f, 0xff,
-    0xff, 0xf1, 0x0, 0x5f, 0xff, 0xff, 0xf1, 0x3,
-    0xff, 0xff, 0xff, 0x10, 0x3, 0xff, 0xff, 0xff,
-    0x40, 0x3f, 0xff, 0xff, 0xf1, 0x0, 0x1f, 0xff,
-    0xff, 0xf8, 0x3, 0xff, 0xff, 0xff, 0x10, 0x0,
-    0xef, 0xff, 0xff, 0xb0, 0x3f, 0xff, 0xff, 0xf1,
-    0x0, 0xc, 0xff, 0xff, 0xff, 0x3, 0xff, 0xff,
-    0xff, 0x10, 0x0, 0xaf, 0xff, 0xff, 0xf2, 0x3f,
-    0xff, 0xff, 0xf1, 0x0, 0x8, 0xff, 0xff, 0xff,
-    0x50,
-
+    0x3f, 0xff, 0xf6, 0xdc, 0x8, 0x7, 0xff, 0xc,
+    0x91, 0xfa, 0x0, 0x3f, 0xf8, 0xcf, 0x0, 0x1f,
+    0xfc, 0x67, 0x30, 0xf, 0xfe, 0x34, 0x80, 0x7e,
+    0x9a, 0x83, 0x0, 0xf3, 0x80, 0x7e, 0x75, 0x7c,
+    0x20, 0xe, 0x30, 0xf, 0xfc, 0xa0, 0x1c, 0x60,
+    0x1f, 0xf8, 0x40, 0x39, 0xc0, 0x3f, 0xf2, 0x0,
+    0x77, 0x80, 0x7f, 0x8a, 0xc8, 0x3, 0x2a, 0x80,
+    0x3f, 0x77, 0xea, 0x0, 0x63, 0xa0, 0xf, 0xfe,
+    0x23, 0xe0, 0x7, 0xff, 0xd, 0x76, 0x0, 0x3f,
+    0xf8, 0x8b, 0xc6, 0x1, 0xff, 0x8, 0x7, 0x1e,
+    0x18, 0x7, 0xfb, 0xf9, 0x0, 0x3b, 0x40, 0x3f,
+    0xe1, 0xa0, 0xe, 0x14, 0x0, 0xff, 0x85, 0x0,
+    0x3b, 0x80, 0x3f, 0xf1, 0x80, 0x73, 0x80, 0x7f,
+    0xed, 0x0, 0xe2, 0x10, 0xf, 0xf9, 0x80, 0x3c,
+    0xa0, 0x1f, 0xf1, 0x0, 0x7b, 0x0, 0x3f, 0xe1,
+    0x10, 0x7, 0x18, 0x7, 0xfe, 0x20, 0xe, 0x40,
+    0xf, 0xfc, 0xc0, 0x1e, 0x20, 0xf, 0xf8, 0x80,
+    0x3c, 0xe0,
     /* U+0053 "S" */
-    0x0, 0x0, 0x7, 0xbe, 0xff, 0xda, 0x50, 0x0,
-    0x0, 0x0, 0x5e, 0xff, 0xff, 0xff, 0xff, 0xe5,
-    0x0, 0x0, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x70, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf7, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x70, 0x7, 0xff, 0xff, 0xff, 0xfa, 0x79,
-    0xdf, 0xf7, 0x0, 0xaf, 0xff, 0xff, 0xf3, 0x0,
-    0x0, 0x4e, 0x70, 0xc, 0xff, 0xff, 0xfb, 0x0,
-    0x0, 0x0, 0x14, 0x0, 0xaf, 0xff, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0xff, 0xe6, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xff, 0xfe, 0x70, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0xff, 0xff, 0xff, 0xd3, 0x0, 0x0, 0x0,
-    0x6f, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x0, 0x0,
-    0x0, 0x19, 0xff, 0xff, 0xff, 0xff, 0xe1, 0x0,
-    0x0, 0x0, 0x1, 0x9f, 0xff, 0xff, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff,
-    0xf0, 0x10, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0x1b, 0x50, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0xff, 0xf0, 0xcf, 0xb3, 0x0, 0x0, 0x8f, 0xff,
-    0xff, 0xfc, 0xc, 0xff, 0xfe, 0xbb, 0xef, 0xff,
-    0xff, 0xff, 0x70, 0xcf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xe0, 0xc, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf4, 0x0, 0xcf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf5, 0x0, 0x4, 0xcf, 0xff, 0xff,
-    0xff, 0xff, 0xc3, 0x0, 0x0, 0x0, 0x27, 0xbd,
-    0xfe, 0xd9, 0x40, 0x0, 0x0, 0x0,
-
+    0x0, 0xe7, 0xbe, 0xff, 0x6d, 0x28, 0x7, 0xcb,
+    0xd0, 0x82, 0x0, 0x25, 0xae, 0x50, 0xd, 0x54,
+    0x10, 0xf, 0xc2, 0x40, 0x14, 0x28, 0x7, 0xff,
+    0x8, 0x5c, 0x3, 0xff, 0x86, 0xc0, 0x1f, 0x2c,
+    0x31, 0x0, 0x76, 0x80, 0x7b, 0x29, 0xe7, 0x6c,
+    0x40, 0x26, 0x0, 0xe4, 0x30, 0xc, 0x9e, 0x60,
+    0x6, 0x0, 0xe6, 0x0, 0xf0, 0xa0, 0x3, 0x40,
+    0x38, 0xa4, 0x3, 0xf9, 0x80, 0x3c, 0xdc, 0xc0,
+    0x1f, 0xc, 0x0, 0x78, 0x67, 0x9c, 0x3, 0xce,
+    0xc0, 0x1f, 0xc, 0x69, 0x80, 0x74, 0xc8, 0x3,
+    0xf1, 0x61, 0x80, 0x73, 0x73, 0x0, 0x7e, 0xd1,
+    0x0, 0xe1, 0x9e, 0x60, 0xf, 0xc, 0x0, 0x7c,
+    0x33, 0x40, 0x1e, 0x70, 0xf, 0xe5, 0x50, 0x7,
+    0x8, 0x8, 0x7, 0xed, 0x0, 0xf0, 0xd2, 0x80,
+    0x7d, 0x80, 0x1e, 0x17, 0xab, 0x30, 0xd, 0x8,
+    0x1, 0xc6, 0x1, 0x26, 0x75, 0xdb, 0x9c, 0x3,
+    0xd6, 0x1, 0xc2, 0x88, 0x10, 0xf, 0xb, 0x80,
+    0x7f, 0xf0, 0xe8, 0x3, 0xff, 0x87, 0x48, 0x0,
+    0x83, 0x0, 0xfe, 0x3c, 0x50, 0x9, 0x33, 0x61,
+    0x8, 0x4, 0x9a, 0xf0, 0xc0, 0x30,
     /* U+0054 "T" */
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x41, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf4, 0x1f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x41, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40,
-    0x77, 0x77, 0x7c, 0xff, 0xff, 0xfe, 0x77, 0x77,
-    0x72, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0,
-
+    0x1f, 0xff, 0xfe, 0x2a, 0x0, 0x7f, 0xff, 0xc0,
+    0x62, 0x38, 0xc0, 0x38, 0x62, 0x39, 0x81, 0xdf,
+    0x94, 0x3, 0x89, 0xdf, 0x88, 0x3, 0xff, 0xfe,
+    0x1, 0xff, 0xff, 0x0, 0xff, 0xff, 0x80, 0x7f,
+    0xff, 0xc0, 0x3f, 0xff, 0xe0, 0x1c,
     /* U+0055 "U" */
-    0x5f, 0xff, 0xff, 0xf0, 0x0, 0x2, 0xff, 0xff,
-    0xff, 0x35, 0xff, 0xff, 0xff, 0x0, 0x0, 0x2f,
-    0xff, 0xff, 0xf3, 0x5f, 0xff, 0xff, 0xf0, 0x0,
-    0x2, 0xff, 0xff, 0xff, 0x35, 0xff, 0xff, 0xff,
-    0x0, 0x0, 0x2f, 0xff, 0xff, 0xf3, 0x5f, 0xff,
-    0xff, 0xf0, 0x0, 0x2, 0xff, 0xff, 0xff, 0x35,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0xf3, 0x5f, 0xff, 0xff, 0xf0, 0x0, 0x2, 0xff,
-    0xff, 0xff, 0x35, 0xff, 0xff, 0xff, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xf3, 0x5f, 0xff, 0xff, 0xf0,
-    0x0, 0x2, 0xff, 0xff, 0xff, 0x35, 0xff, 0xff,
-    0xff, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xf3, 0x5f,
-    0xff, 0xff, 0xf0, 0x0, 0x2, 0xff, 0xff, 0xff,
-    0x35, 0xff, 0xff, 0xff, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0xf3, 0x5f, 0xff, 0xff, 0xf0, 0x0, 0x2,
-    0xff, 0xff, 0xff, 0x35, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0x2f, 0xff, 0xff, 0xf3, 0x5f, 0xff, 0xff,
-    0xf0, 0x0, 0x2, 0xff, 0xff, 0xff, 0x35, 0xff,
-    0xff, 0xff, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xf3,
-    0x5f, 0xff, 0xff, 0xf0, 0x0, 0x2, 0xff, 0xff,
-    0xff, 0x35, 0xff, 0xff, 0xff, 0x0, 0x0, 0x2f,
-    0xff, 0xff, 0xf3, 0x5f, 0xff, 0xff, 0xf0, 0x0,
-    0x3, 0xff, 0xff, 0xff, 0x24, 0xff, 0xff, 0xff,
-    0x30, 0x0, 0x6f, 0xff, 0xff, 0xf1, 0x2f, 0xff,
-    0xff, 0xf8, 0x0, 0xc, 0xff, 0xff, 0xff, 0x0,
-    0xef, 0xff, 0xff, 0xf8, 0x6b, 0xff, 0xff, 0xff,
-    0xb0, 0x9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf5, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x5f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x10, 0x0, 0x0, 0x4e,
-    0xff, 0xff, 0xff, 0xff, 0xfb, 0x10, 0x0, 0x0,
-    0x0, 0x5, 0xad, 0xff, 0xec, 0x83, 0x0, 0x0,
-    0x0,
-
+    0x5f, 0xff, 0x0, 0x62, 0xff, 0xf1, 0x80, 0x7f,
+    0xff, 0xc0, 0x3f, 0xff, 0xe0, 0x1f, 0xff, 0xf0,
+    0xf, 0xff, 0xf8, 0x7, 0xff, 0x58, 0x40, 0x3c,
+    0x22, 0x0, 0xf1, 0x80, 0x4a, 0x1, 0xe3, 0x60,
+    0xf, 0x58, 0x5, 0x40, 0x1e, 0x12, 0x10, 0xe,
+    0x78, 0x6b, 0x30, 0xe, 0x40, 0x3, 0x80, 0x79,
+    0xe5, 0x0, 0x3d, 0xc0, 0x8, 0x0, 0xff, 0xe1,
+    0x1a, 0x80, 0x6, 0x80, 0x3f, 0xf0, 0xe8, 0x6,
+    0x5b, 0x10, 0xf, 0xe4, 0xf1, 0x0, 0xe4, 0xea,
+    0x52, 0x0, 0x9, 0xbe, 0x58, 0x80, 0x40,
     /* U+0056 "V" */
-    0x9f, 0xff, 0xff, 0xf3, 0x0, 0x0, 0xd, 0xff,
-    0xff, 0xff, 0x5, 0xff, 0xff, 0xff, 0x50, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0xb0, 0x1f, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xf7, 0x0,
-    0xdf, 0xff, 0xff, 0xb0, 0x0, 0x5, 0xff, 0xff,
-    0xff, 0x30, 0x9, 0xff, 0xff, 0xfd, 0x0, 0x0,
-    0x8f, 0xff, 0xff, 0xf0, 0x0, 0x5f, 0xff, 0xff,
-    0xf0, 0x0, 0xb, 0xff, 0xff, 0xfb, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0x30, 0x0, 0xef, 0xff, 0xff,
-    0x70, 0x0, 0xe, 0xff, 0xff, 0xf5, 0x0, 0x1f,
-    0xff, 0xff, 0xf3, 0x0, 0x0, 0xaf, 0xff, 0xff,
-    0x80, 0x3, 0xff, 0xff, 0xff, 0x0, 0x0, 0x6,
-    0xff, 0xff, 0xfb, 0x0, 0x6f, 0xff, 0xff, 0xb0,
-    0x0, 0x0, 0x2f, 0xff, 0xff, 0xd0, 0x9, 0xff,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff,
-    0x0, 0xcf, 0xff, 0xff, 0x20, 0x0, 0x0, 0xa,
-    0xff, 0xff, 0xf3, 0xe, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xff, 0x51, 0xff, 0xff,
-    0xfa, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xf8,
-    0x4f, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0xe,
-    0xff, 0xff, 0xb7, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xff, 0xfd, 0xaf, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xfd,
-    0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0xff, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xff, 0xff, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x0,
-
+    0x9f, 0xff, 0x18, 0x7, 0x6f, 0xff, 0x83, 0x0,
+    0x3c, 0xc0, 0x1c, 0x40, 0x1c, 0x80, 0x80, 0x1e,
+    0xd0, 0xc, 0x60, 0x1e, 0xc0, 0x12, 0x0, 0xe3,
+    0x0, 0xcc, 0x1, 0xe4, 0x0, 0x20, 0x7, 0x30,
+    0x6, 0xd0, 0xf, 0x18, 0x3, 0x0, 0x38, 0x80,
+    0x31, 0x80, 0x72, 0x0, 0x48, 0x1, 0xe3, 0x0,
+    0x94, 0x3, 0xb0, 0x2, 0x11, 0x0, 0x73, 0x0,
+    0x4, 0x40, 0x1c, 0x80, 0x19, 0x0, 0x3b, 0x40,
+    0x4, 0x1, 0xe3, 0x0, 0xd8, 0x1, 0xc6, 0x0,
+    0x50, 0xe, 0x40, 0xe, 0x40, 0xe, 0x60, 0x7,
+    0x80, 0x76, 0x0, 0x71, 0x8, 0x6, 0x20, 0x2,
+    0x80, 0x72, 0x80, 0x79, 0x0, 0x38, 0xc0, 0x80,
+    0x30, 0x90, 0x7, 0xb0, 0x3, 0x98, 0x44, 0x1,
+    0x90, 0x3, 0xe4, 0x0, 0xed, 0x50, 0xe, 0xc0,
+    0xf, 0x88, 0x40, 0x31, 0x98, 0x3, 0x90, 0x3,
+    0xf2, 0x0, 0x66, 0xd0, 0xc, 0x24, 0x1, 0xfb,
+    0x0, 0x31, 0x38, 0x6, 0x40, 0xf, 0xe4, 0x0,
+    0xe2, 0x0, 0xd8, 0x1, 0xfc, 0x42, 0x1, 0xfc,
+    0x80, 0x1f, 0xe4, 0x0, 0xfc, 0x24, 0x1, 0xfe,
+    0xc0, 0xf, 0xc8, 0x1, 0xff, 0x20, 0x7, 0xec,
+    0x0, 0xff, 0x88, 0x40, 0x3e, 0x40, 0xf, 0xfc,
+    0xa0, 0x1e, 0x22, 0x0, 0x7f, 0xec, 0x0, 0xf2,
+    0x0, 0x7f, 0xf0, 0x1, 0x0, 0x3d, 0x80, 0x1f,
     /* U+0057 "W" */
-    0x8f, 0xff, 0xff, 0xe0, 0x0, 0xaf, 0xff, 0xff,
-    0xb0, 0x0, 0xcf, 0xff, 0xff, 0x95, 0xff, 0xff,
-    0xff, 0x0, 0xb, 0xff, 0xff, 0xfc, 0x0, 0xd,
-    0xff, 0xff, 0xf6, 0x2f, 0xff, 0xff, 0xf1, 0x0,
-    0xcf, 0xff, 0xff, 0xe0, 0x0, 0xff, 0xff, 0xff,
-    0x30, 0xff, 0xff, 0xff, 0x20, 0xe, 0xff, 0xff,
-    0xff, 0x0, 0xf, 0xff, 0xff, 0xf1, 0xc, 0xff,
-    0xff, 0xf4, 0x0, 0xff, 0xff, 0xff, 0xf1, 0x2,
-    0xff, 0xff, 0xfe, 0x0, 0x9f, 0xff, 0xff, 0x50,
-    0x1f, 0xff, 0xff, 0xff, 0x20, 0x3f, 0xff, 0xff,
-    0xb0, 0x6, 0xff, 0xff, 0xf6, 0x2, 0xff, 0xfa,
-    0xff, 0xf3, 0x5, 0xff, 0xff, 0xf8, 0x0, 0x3f,
-    0xff, 0xff, 0x80, 0x3f, 0xff, 0x7f, 0xff, 0x50,
-    0x6f, 0xff, 0xff, 0x50, 0x0, 0xff, 0xff, 0xf9,
-    0x5, 0xff, 0xf5, 0xff, 0xf6, 0x8, 0xff, 0xff,
-    0xf2, 0x0, 0xd, 0xff, 0xff, 0xb0, 0x6f, 0xff,
-    0x3f, 0xff, 0x70, 0x9f, 0xff, 0xff, 0x0, 0x0,
-    0xaf, 0xff, 0xfc, 0x7, 0xff, 0xf1, 0xff, 0xf9,
-    0xb, 0xff, 0xff, 0xc0, 0x0, 0x7, 0xff, 0xff,
-    0xe0, 0x9f, 0xff, 0xf, 0xff, 0xa0, 0xcf, 0xff,
-    0xf9, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xa, 0xff,
-    0xf0, 0xef, 0xfb, 0xe, 0xff, 0xff, 0x60, 0x0,
-    0x1, 0xff, 0xff, 0xf1, 0xcf, 0xfe, 0xc, 0xff,
-    0xd0, 0xff, 0xff, 0xf3, 0x0, 0x0, 0xe, 0xff,
-    0xff, 0x3c, 0xff, 0xd0, 0xbf, 0xfe, 0x1f, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xf4, 0xef,
-    0xfb, 0x9, 0xff, 0xf2, 0xff, 0xff, 0xd0, 0x0,
-    0x0, 0x8, 0xff, 0xff, 0x5e, 0xff, 0xa0, 0x8f,
-    0xff, 0x4f, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x5f,
-    0xff, 0xf6, 0xff, 0xf9, 0x7, 0xff, 0xf6, 0xff,
-    0xff, 0x70, 0x0, 0x0, 0x2, 0xff, 0xff, 0x8f,
-    0xff, 0x70, 0x6f, 0xff, 0x8f, 0xff, 0xf4, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xfa, 0xff, 0xf6, 0x4,
-    0xff, 0xfa, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xff, 0xff, 0x50, 0x3f, 0xff, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff,
-    0xff, 0xf3, 0x2, 0xff, 0xff, 0xff, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xff, 0x20,
-    0x1f, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xff, 0xf1, 0x0, 0xff, 0xff,
-    0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xff, 0x0, 0xe, 0xff, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xe0,
-    0x0, 0xdf, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0xff, 0xfd, 0x0, 0xc, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x0,
-
+    0x8f, 0xfe, 0xe0, 0xa, 0xbf, 0xfa, 0xc0, 0x2c,
+    0xff, 0xe9, 0xd0, 0xe, 0x10, 0x8, 0x40, 0x39,
+    0xc0, 0x21, 0x0, 0xef, 0x70, 0xf, 0x8, 0x1,
+    0xc0, 0x38, 0x80, 0x22, 0x0, 0xe5, 0x20, 0xf,
+    0x18, 0x0, 0x80, 0x38, 0x40, 0x3f, 0x88, 0xc,
+    0x3, 0x98, 0x0, 0x20, 0x1e, 0x10, 0x20, 0xe,
+    0x11, 0x2, 0x80, 0x70, 0x80, 0x80, 0x7c, 0x60,
+    0x20, 0x1c, 0xa0, 0xf, 0x0, 0xe3, 0x3, 0x0,
+    0x94, 0x2, 0x10, 0x60, 0xe, 0x30, 0x2, 0x80,
+    0x77, 0x0, 0x80, 0x5a, 0x1, 0x30, 0x18, 0x7,
+    0x68, 0x0, 0xc0, 0x38, 0x41, 0x80, 0x22, 0x0,
+    0x8c, 0x38, 0x3, 0x9c, 0x2, 0x20, 0xc, 0x40,
+    0x60, 0x13, 0x0, 0x42, 0x2, 0x1, 0xc4, 0x1,
+    0x38, 0x6, 0x70, 0x10, 0x8, 0x80, 0x2e, 0x2,
+    0x0, 0xc6, 0x1, 0xb4, 0x3, 0x10, 0x70, 0x4,
+    0x20, 0x11, 0x83, 0x80, 0x65, 0x0, 0xc6, 0x1,
+    0x84, 0xc, 0x3, 0x8, 0x0, 0x40, 0x80, 0x37,
+    0x80, 0x65, 0x0, 0xe1, 0x60, 0x0, 0x81, 0x0,
+    0x18, 0x4, 0x3, 0x28, 0x6, 0x11, 0x0, 0x62,
+    0x0, 0x8c, 0x1c, 0x0, 0x62, 0x1, 0xc6, 0x1,
+    0xca, 0x1, 0x9c, 0x80, 0xc, 0x4, 0x0, 0x13,
+    0x0, 0xc4, 0x1, 0xe3, 0x0, 0xc2, 0x1, 0x8,
+    0x8, 0x4, 0xc0, 0x19, 0xc0, 0x3d, 0xa0, 0x18,
+    0xc4, 0x0, 0x61, 0xe0, 0x11, 0x0, 0x6d, 0x0,
+    0xf3, 0x80, 0x6e, 0x0, 0xb8, 0x4, 0x2, 0xe0,
+    0xc, 0x60, 0x1e, 0x20, 0xc, 0x40, 0x10, 0x81,
+    0x0, 0x44, 0x1, 0x94, 0x3, 0xe3, 0x0, 0x94,
+    0x2, 0x30, 0x70, 0x9, 0x40, 0x21, 0x10, 0x7,
+    0xca, 0x1, 0xf3, 0x0, 0x80, 0x7c, 0xa0, 0x1f,
+    0xbc, 0x3, 0xe1, 0x3, 0x0, 0xf8, 0xc0, 0x3f,
+    0x28, 0x7, 0xc6, 0x2, 0x1, 0xf6, 0x80, 0x7e,
+    0x30, 0xf, 0x84, 0x0, 0x20, 0x1e, 0x70, 0xf,
+    0xe2, 0x0, 0xe1, 0x0, 0x8c, 0x3, 0xc4, 0x1,
+    0xfc, 0xe0, 0x1c, 0x60, 0x10, 0x80, 0x71, 0x80,
+    0x70,
     /* U+0058 "X" */
-    0x0, 0xcf, 0xff, 0xff, 0xd0, 0x0, 0xff, 0xff,
-    0xff, 0xc0, 0x0, 0x7, 0xff, 0xff, 0xff, 0x0,
-    0x3f, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xf3, 0x6, 0xff, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0xcf, 0xff, 0xff, 0x70, 0x9f, 0xff, 0xff,
-    0xb0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xfa, 0xc,
-    0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xe0, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0xbf, 0xff, 0xff, 0x5f, 0xff, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xfb, 0xff,
-    0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0xff,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xff, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff,
-    0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xcf, 0xff, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xf4,
-    0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xfd, 0xf, 0xff, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0xff, 0x90, 0xbf, 0xff, 0xff,
-    0x70, 0x0, 0x0, 0xe, 0xff, 0xff, 0xf5, 0x7,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x4, 0xff, 0xff,
-    0xff, 0x10, 0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0xaf, 0xff, 0xff, 0xd0, 0x0, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0xf, 0xff, 0xff, 0xf9, 0x0, 0xc,
-    0xff, 0xff, 0xfd, 0x0, 0x6, 0xff, 0xff, 0xff,
-    0x60, 0x0, 0x8f, 0xff, 0xff, 0xf3, 0x0, 0xbf,
-    0xff, 0xff, 0xf2, 0x0, 0x4, 0xff, 0xff, 0xff,
-    0x90, 0x1f, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xfe, 0x0,
-
+    0x0, 0x67, 0xff, 0x68, 0x5, 0xff, 0xec, 0x0,
+    0xd6, 0x1, 0xc4, 0x0, 0x30, 0xf, 0x50, 0x6,
+    0x60, 0xf, 0x18, 0x28, 0x7, 0x9c, 0x3, 0x9,
+    0x80, 0x72, 0x7, 0x80, 0x72, 0x8, 0x7, 0x50,
+    0x7, 0x68, 0x28, 0x7, 0x68, 0x7, 0x9c, 0x3,
+    0x90, 0xc, 0x3, 0x9c, 0x3, 0xc2, 0x80, 0x18,
+    0x54, 0x3, 0x94, 0x40, 0x3e, 0xd0, 0xe, 0xe0,
+    0xe, 0xf0, 0xf, 0xce, 0x1, 0xc8, 0x1, 0xca,
+    0x1, 0xf8, 0x50, 0x3, 0xf9, 0x40, 0x3f, 0xda,
+    0x1, 0xfd, 0xc0, 0x1f, 0xe7, 0x0, 0xfc, 0x28,
+    0x1, 0xff, 0xd3, 0x70, 0xf, 0xc2, 0x80, 0x1f,
+    0xea, 0x0, 0xfe, 0xe0, 0xf, 0xe2, 0x30, 0xf,
+    0xe5, 0x0, 0xfe, 0x50, 0xe, 0x30, 0xe, 0x50,
+    0xf, 0xd4, 0x1, 0xd0, 0x1, 0xdc, 0x1, 0xf1,
+    0x90, 0x6, 0x24, 0x0, 0xe4, 0x10, 0xf, 0x50,
+    0x7, 0x20, 0x20, 0x7, 0x30, 0x7, 0x9c, 0x3,
+    0xb0, 0x30, 0x3, 0xac, 0x3, 0x90, 0x40, 0x39,
+    0x0, 0xc0, 0x38, 0xc8, 0x3, 0x70, 0x7, 0x10,
+    0x82, 0x0, 0x7a, 0x80, 0x32, 0x80, 0x72, 0x0,
+    0x46, 0x1, 0xca, 0x1, 0x30, 0x7, 0xbc, 0x2,
+    0x40, 0xe, 0x23, 0x0, 0x68, 0x7, 0x90, 0x2,
+    0xc0, 0xf, 0x50, 0xa, 0x0, 0x70, 0x90, 0x4,
+    0xa0, 0x1e, 0x70,
     /* U+0059 "Y" */
-    0x4f, 0xff, 0xff, 0xfc, 0x0, 0x0, 0xef, 0xff,
-    0xff, 0xf4, 0xd, 0xff, 0xff, 0xff, 0x0, 0x2,
-    0xff, 0xff, 0xff, 0xd0, 0x7, 0xff, 0xff, 0xff,
-    0x40, 0x6, 0xff, 0xff, 0xff, 0x60, 0x1, 0xff,
-    0xff, 0xff, 0x90, 0xa, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x9f, 0xff, 0xff, 0xd0, 0xe, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xf1, 0x3f,
-    0xff, 0xff, 0xf1, 0x0, 0x0, 0xb, 0xff, 0xff,
-    0xf5, 0x7f, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x5,
-    0xff, 0xff, 0xfa, 0xbf, 0xff, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0xfe, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0xff, 0xff, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0xff, 0xf1, 0x0, 0x0, 0x0,
-
+    0x4f, 0xff, 0x60, 0x6, 0xef, 0xff, 0x22, 0x8,
+    0x3, 0x8c, 0x2, 0x21, 0x0, 0xe2, 0x40, 0xa0,
+    0xf, 0x20, 0x1, 0x0, 0x3d, 0x60, 0x6, 0x0,
+    0xf6, 0x80, 0x30, 0x3, 0x85, 0x80, 0x2, 0xc0,
+    0x1c, 0x80, 0x4, 0x0, 0xe6, 0x0, 0xd6, 0x1,
+    0xc4, 0x26, 0x20, 0x1d, 0x20, 0x18, 0x90, 0x3,
+    0x91, 0x0, 0x1c, 0xa2, 0x1, 0xdc, 0x1, 0xdf,
+    0x80, 0x1d, 0x20, 0x1e, 0x51, 0x0, 0xc8, 0x80,
+    0xc, 0x66, 0x0, 0xfa, 0x40, 0x30, 0x80, 0x74,
+    0x80, 0x7e, 0x60, 0xf, 0xe1, 0x50, 0xf, 0xc2,
+    0xc0, 0x1f, 0xa4, 0x3, 0xfd, 0x40, 0x1f, 0x9c,
+    0x3, 0xfc, 0x66, 0x0, 0xf3, 0x0, 0x7f, 0xe9,
+    0x0, 0xf5, 0x80, 0x7f, 0xe1, 0x0, 0xf1, 0x80,
+    0x7f, 0xff, 0xc0, 0x3f, 0xff, 0xe0, 0x1f, 0xff,
+    0xf0,
     /* U+005A "Z" */
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x90, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x90, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x90, 0xf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x90, 0xf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x90, 0x7, 0x77, 0x77,
-    0x77, 0x8f, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0xff, 0xfe, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff,
-    0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xff, 0xff, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xff, 0xff, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff,
-    0xfc, 0x77, 0x77, 0x77, 0x77, 0x73, 0xef, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xef,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7,
-    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf7, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf7, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf7,
-
+    0xf, 0xff, 0xfe, 0x1c, 0x80, 0x7f, 0xff, 0xa2,
+    0x3e, 0x70, 0xf, 0x84, 0x0, 0xef, 0xf6, 0x80,
+    0x78, 0x64, 0x3, 0xfa, 0xc0, 0x3d, 0x22, 0x1,
+    0xf9, 0xc4, 0x3, 0x89, 0xc0, 0x3f, 0xc, 0x0,
+    0x7a, 0x40, 0x3f, 0xac, 0x3, 0xc8, 0x80, 0xf,
+    0xc6, 0xa0, 0x1e, 0x90, 0xf, 0xef, 0x0, 0xf3,
+    0x10, 0x7, 0xe5, 0x30, 0xe, 0x18, 0x0, 0xfe,
+    0xb0, 0xf, 0x40, 0x80, 0x7e, 0x81, 0x0, 0xe2,
+    0x60, 0xf, 0xc2, 0xe0, 0x1e, 0x90, 0xf, 0xeb,
+    0x0, 0xf2, 0x20, 0x3, 0xf1, 0xa8, 0x7, 0xa4,
+    0x3, 0xfb, 0xc0, 0x3c, 0xe4, 0x1, 0xf9, 0x8c,
+    0x3, 0x86, 0x0, 0x3f, 0xac, 0x3, 0xc4, 0xef,
+    0xfc, 0x66, 0x0, 0xf1, 0xc4, 0x7f, 0x20, 0x7,
+    0xff, 0xf0,
     /* U+005B "[" */
-    0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xca, 0xa8,
-    0xff, 0xff, 0x40, 0x0, 0xff, 0xff, 0x40, 0x0,
-    0xff, 0xff, 0x40, 0x0, 0xff, 0xff, 0x40, 0x0,
-    0xff, 0xff, 0x40, 0x0, 0xff, 0xff, 0x40, 0x0,
-    0xff, 0xff, 0x40, 0x0, 0xff, 0xff, 0x40, 0x0,
-    0xff, 0xff, 0x40, 0x0, 0xff, 0xff, 0x40, 0x0,
-    0xff, 0xff, 0x40, 0x0, 0xff, 0xff, 0x40, 0x0,
-    0xff, 0xff, 0x40, 0x0, 0xff, 0xff, 0x40, 0x0,
-    0xff, 0xff, 0x40, 0x0, 0xff, 0xff, 0x40, 0x0,
-    0xff, 0xff, 0x40, 0x0, 0xff, 0xff, 0x40, 0x0,
-    0xff, 0xff, 0x40, 0x0, 0xff, 0xff, 0x40, 0x0,
-    0xff, 0xff, 0x40, 0x0, 0xff, 0xff, 0x40, 0x0,
-    0xff, 0xff, 0x40, 0x0, 0xff, 0xff, 0x40, 0x0,
-    0xff, 0xff, 0x40, 0x0, 0xff, 0xff, 0x40, 0x0,
-    0xff, 0xff, 0x40, 0x0, 0xff, 0xff, 0x40, 0x0,
-    0xff, 0xff, 0xca, 0xa8, 0xff, 0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xfc,
-
+    0xff, 0xfb, 0x0, 0x3f, 0xf9, 0x6, 0xaa, 0x40,
+    0xd, 0x15, 0x48, 0x0, 0xff, 0xff, 0x80, 0x7f,
+    0xff, 0xc0, 0x3f, 0xff, 0x51, 0x54, 0x80, 0xc,
+    0x6a, 0xa4, 0x0, 0xff, 0xe2, 0x0,
     /* U+005C "\\" */
-    0xbf, 0xff, 0x40, 0x0, 0x0, 0x0, 0x6, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0x50, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xff, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff,
-    0x90, 0x0, 0x0, 0x0, 0x1, 0xff, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x6, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0xa0,
-
+    0xbf, 0xf9, 0x0, 0x3f, 0x68, 0x5, 0x80, 0x1f,
+    0x90, 0x2, 0x50, 0xf, 0xc4, 0x40, 0x1, 0x8,
+    0x7, 0xe4, 0x0, 0x9c, 0x3, 0xf6, 0x80, 0x58,
+    0x1, 0xf9, 0x0, 0x24, 0x0, 0xfe, 0x40, 0x0,
+    0x98, 0x7, 0xec, 0x0, 0x90, 0x3, 0xf2, 0x80,
+    0x56, 0x1, 0xf8, 0x84, 0x0, 0x62, 0x1, 0xf9,
+    0xc0, 0x24, 0x0, 0xfd, 0x80, 0x16, 0x0, 0x7e,
+    0x40, 0x9, 0xc0, 0x3f, 0x9, 0x80, 0x4, 0x80,
+    0x3f, 0x58, 0x4, 0xa0, 0x1f, 0x90, 0x2, 0xc0,
+    0xf, 0xc6, 0x20, 0x4, 0x0, 0xfe, 0x40, 0x9,
+    0x0, 0x3f, 0x78, 0x5, 0xa0, 0x1f, 0x90, 0x2,
+    0x40, 0xf, 0xc2, 0x60, 0x2, 0x20, 0x7, 0xe4,
+    0x0, 0x90, 0x3, 0xf5, 0x80, 0x5a, 0x1, 0xf8,
+    0xc0, 0x24, 0x0, 0xfe, 0x50, 0x9, 0x0, 0x3f,
+    0x60, 0x5, 0x80, 0x1f, 0x9c, 0x2, 0x50, 0xf,
+    0xc2, 0x40, 0x2, 0x10, 0xf, 0xca, 0x1, 0x20,
+    0x7, 0xec, 0x0, 0xbc,
     /* U+005D "]" */
-    0x5f, 0xff, 0xff, 0xff, 0x65, 0xff, 0xff, 0xff,
-    0xf6, 0x5f, 0xff, 0xff, 0xff, 0x63, 0xaa, 0xaf,
-    0xff, 0xf6, 0x0, 0x0, 0xdf, 0xff, 0x60, 0x0,
-    0xd, 0xff, 0xf6, 0x0, 0x0, 0xdf, 0xff, 0x60,
-    0x0, 0xd, 0xff, 0xf6, 0x0, 0x0, 0xdf, 0xff,
-    0x60, 0x0, 0xd, 0xff, 0xf6, 0x0, 0x0, 0xdf,
-    0xff, 0x60, 0x0, 0xd, 0xff, 0xf6, 0x0, 0x0,
-    0xdf, 0xff, 0x60, 0x0, 0xd, 0xff, 0xf6, 0x0,
-    0x0, 0xdf, 0xff, 0x60, 0x0, 0xd, 0xff, 0xf6,
-    0x0, 0x0, 0xdf, 0xff, 0x60, 0x0, 0xd, 0xff,
-    0xf6, 0x0, 0x0, 0xdf, 0xff, 0x60, 0x0, 0xd,
-    0xff, 0xf6, 0x0, 0x0, 0xdf, 0xff, 0x60, 0x0,
-    0xd, 0xff, 0xf6, 0x0, 0x0, 0xdf, 0xff, 0x60,
-    0x0, 0xd, 0xff, 0xf6, 0x0, 0x0, 0xdf, 0xff,
-    0x60, 0x0, 0xd, 0xff, 0xf6, 0x0, 0x0, 0xdf,
-    0xff, 0x60, 0x0, 0xd, 0xff, 0xf6, 0x0, 0x0,
-    0xdf, 0xff, 0x60, 0x0, 0xd, 0xff, 0xf6, 0x0,
-    0x0, 0xdf, 0xff, 0x60, 0x0, 0xd, 0xff, 0xf6,
-    0x3a, 0xaa, 0xff, 0xff, 0x65, 0xff, 0xff, 0xff,
-    0xf6, 0x5f, 0xff, 0xff, 0xff, 0x65, 0xff, 0xff,
-    0xff, 0xf6,
-
+    0x5f, 0xff, 0x98, 0x3, 0xff, 0x8c, 0xca, 0xb0,
+    0x7, 0x1d, 0x54, 0x40, 0x1f, 0xff, 0xf0, 0xf,
+    0xff, 0xf8, 0x7, 0xff, 0xfc, 0x3, 0xff, 0x94,
+    0x75, 0x51, 0x0, 0x66, 0x55, 0x80, 0x3f, 0xf9,
+    0x60,
     /* U+005E "^" */
-    0x0, 0x0, 0x0, 0x4, 0x77, 0x77, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xff,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0xfe, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xff, 0xf4, 0xef, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xd0, 0x8f, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0x70, 0x1f,
-    0xff, 0xff, 0x10, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0x10, 0xb, 0xff, 0xff, 0x80, 0x0, 0x0, 0xaf,
-    0xff, 0xfa, 0x0, 0x4, 0xff, 0xff, 0xf0, 0x0,
-    0x2, 0xff, 0xff, 0xf3, 0x0, 0x0, 0xef, 0xff,
-    0xf7, 0x0, 0x9, 0xff, 0xff, 0xd0, 0x0, 0x0,
-    0x7f, 0xff, 0xfe, 0x0, 0x1f, 0xff, 0xff, 0x60,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0x60, 0x8f, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xd0,
-
+    0x0, 0xf9, 0x1d, 0xf0, 0x7, 0xff, 0xe, 0xa2,
+    0x33, 0x0, 0x7f, 0xf0, 0x1, 0x84, 0x3, 0x58,
+    0x7, 0xff, 0x0, 0x2c, 0x3, 0x89, 0x0, 0x3f,
+    0xe5, 0x20, 0xf, 0x40, 0x7, 0xfd, 0x20, 0x1f,
+    0x19, 0x80, 0x3f, 0x90, 0xc0, 0x21, 0x0, 0xd0,
+    0x1, 0xfd, 0xe0, 0x1a, 0x84, 0x2, 0x42, 0x0,
+    0xf8, 0xd0, 0x2, 0x24, 0x60, 0xd, 0x60, 0x1f,
+    0x40, 0x6, 0xa0, 0x90, 0xc, 0xc2, 0x1, 0xc4,
+    0x80, 0x19, 0x80, 0x50, 0x3, 0x48, 0x7, 0x40,
+    0x6, 0x51, 0x0, 0x78, 0x6, 0x70, 0xc, 0x4a,
+    0x1, 0xa4, 0x2, 0x41, 0x0, 0xce, 0x1, 0x58,
+    0x6, 0x23, 0x0, 0xd2, 0x1, 0xa4, 0x0, 0x2c,
+    0x1, 0xac, 0x3, 0x98, 0x3, 0xb, 0x4, 0x80,
+    0x73, 0x0, 0x70, 0xa8, 0x6, 0xb0,
     /* U+005F "_" */
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf4, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4,
-
+    0x3f, 0xff, 0xfe, 0x52, 0x0, 0x7f, 0xf3, 0x0,
     /* U+0060 "`" */
-    0xa, 0xbb, 0xbb, 0x0, 0x0, 0x3f, 0xff, 0xf7,
-    0x0, 0x0, 0x8f, 0xff, 0xe0, 0x0, 0x0, 0xcf,
-    0xff, 0x70, 0x0, 0x2, 0xff, 0xfe, 0x0, 0x0,
-    0x5, 0xff, 0xf7,
-
+    0xa, 0xbb, 0xc0, 0x1a, 0x51, 0x33, 0x80, 0x46,
+    0xe0, 0x14, 0x80, 0x68, 0x30, 0x0, 0xb8, 0x6,
+    0xe0, 0xa, 0x40, 0x31, 0x50, 0x0, 0x5c,
     /* U+0061 "a" */
-    0x0, 0x0, 0x5a, 0xde, 0xfe, 0xb6, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x30,
-    0x0, 0x0, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x20, 0x0, 0xb, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfb, 0x0, 0x0, 0xbf, 0xfd, 0xbc, 0xff, 0xff,
-    0xff, 0xf4, 0x0, 0xb, 0x91, 0x0, 0x0, 0xaf,
-    0xff, 0xff, 0x80, 0x0, 0x10, 0x0, 0x0, 0x15,
-    0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x4a, 0xef,
-    0xff, 0xff, 0xff, 0xb0, 0x0, 0x8, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfb, 0x0, 0x1c, 0xff, 0xff,
-    0xfd, 0xaf, 0xff, 0xff, 0xb0, 0xb, 0xff, 0xff,
-    0xe4, 0x0, 0xef, 0xff, 0xfb, 0x3, 0xff, 0xff,
-    0xf6, 0x0, 0xe, 0xff, 0xff, 0xb0, 0x7f, 0xff,
-    0xff, 0x30, 0x1, 0xff, 0xff, 0xfb, 0x7, 0xff,
-    0xff, 0xf8, 0x0, 0x5f, 0xff, 0xff, 0xb0, 0x4f,
-    0xff, 0xff, 0xfa, 0x8f, 0xff, 0xff, 0xfc, 0x1,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0,
-    0x6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x10, 0x8, 0xff, 0xff, 0xff, 0x8c, 0xff, 0xff,
-    0xf5, 0x0, 0x4, 0xae, 0xfc, 0x40, 0x8f, 0xff,
-    0xff, 0xa0,
-
+    0x0, 0xcb, 0x5b, 0xdf, 0xd6, 0xc0, 0x1f, 0x3f,
+    0xd2, 0x90, 0x80, 0xa4, 0xe1, 0x80, 0x76, 0x0,
+    0x7f, 0x1e, 0x10, 0x7, 0xff, 0x12, 0x40, 0x3e,
+    0x24, 0x30, 0xf, 0x22, 0x0, 0x33, 0x76, 0xde,
+    0x7a, 0x80, 0x76, 0x0, 0x55, 0x22, 0x1, 0xf,
+    0x80, 0x71, 0x0, 0x42, 0x0, 0x4a, 0xee, 0x50,
+    0x7, 0x8, 0x6, 0x8f, 0xb5, 0x10, 0xf, 0xf0,
+    0xe3, 0x80, 0x62, 0x50, 0xf, 0xd4, 0x60, 0x10,
+    0xde, 0xd0, 0x80, 0x78, 0xd0, 0x3, 0x42, 0x0,
+    0x7f, 0x20, 0x7, 0x28, 0x0, 0x44, 0x1, 0xff,
+    0xac, 0x0, 0x80, 0x1f, 0x18, 0x7, 0x3d, 0x45,
+    0x0, 0x73, 0x82, 0x80, 0x79, 0x5c, 0x3, 0xc2,
+    0x3, 0x20, 0x1f, 0xfc, 0x0, 0x21, 0x6, 0x70,
+    0xf, 0x39, 0x80, 0x72, 0x0, 0x22, 0xd4, 0x40,
+    0xee, 0x10, 0x3, 0xbc,
     /* U+0062 "b" */
-    0x2f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xf0, 0x3b, 0xee, 0xb4, 0x0,
-    0x0, 0x2f, 0xff, 0xff, 0xf4, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf6, 0x0, 0x2f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x0, 0x2f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x60, 0x2f, 0xff, 0xff,
-    0xff, 0x68, 0xff, 0xff, 0xff, 0xd0, 0x2f, 0xff,
-    0xff, 0xf5, 0x0, 0x8f, 0xff, 0xff, 0xf0, 0x2f,
-    0xff, 0xff, 0xf1, 0x0, 0x2f, 0xff, 0xff, 0xf3,
-    0x2f, 0xff, 0xff, 0xf0, 0x0, 0xf, 0xff, 0xff,
-    0xf5, 0x2f, 0xff, 0xff, 0xf0, 0x0, 0xf, 0xff,
-    0xff, 0xf6, 0x2f, 0xff, 0xff, 0xf0, 0x0, 0xf,
-    0xff, 0xff, 0xf4, 0x2f, 0xff, 0xff, 0xf0, 0x0,
-    0x3f, 0xff, 0xff, 0xf2, 0x2f, 0xff, 0xff, 0xf0,
-    0x0, 0xaf, 0xff, 0xff, 0xf0, 0x2f, 0xff, 0xff,
-    0xfb, 0x48, 0xff, 0xff, 0xff, 0x90, 0x2f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x20, 0x2f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x0,
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe1,
-    0x0, 0x2f, 0xff, 0xff, 0x7e, 0xff, 0xff, 0xfd,
-    0x20, 0x0, 0x2f, 0xff, 0xf5, 0x1, 0x9e, 0xfd,
-    0x70, 0x0, 0x0,
-
+    0x2f, 0xff, 0x0, 0x7f, 0xff, 0xc0, 0x3f, 0xff,
+    0x47, 0x7d, 0xcb, 0x40, 0xf, 0xf9, 0x31, 0x4,
+    0x49, 0x70, 0x1, 0xfe, 0xb0, 0xf, 0x3b, 0x0,
+    0x7f, 0xf1, 0x60, 0x3, 0xff, 0x8a, 0x2c, 0x1,
+    0xfd, 0x2e, 0x1, 0xeb, 0x0, 0xfd, 0x4d, 0xe,
+    0x1, 0xc4, 0x1, 0xf9, 0x0, 0x14, 0x1, 0xe3,
+    0x0, 0xf8, 0x40, 0x4, 0x1, 0xe6, 0x0, 0xff,
+    0xe2, 0x98, 0x7, 0xff, 0x14, 0x80, 0x3f, 0xc6,
+    0x1, 0xe6, 0x0, 0xff, 0x48, 0x7, 0x88, 0x3,
+    0xeb, 0x48, 0x50, 0xe, 0x60, 0xf, 0xc9, 0x6e,
+    0x1, 0xeb, 0x0, 0xff, 0xe2, 0x29, 0x0, 0x7f,
+    0xf0, 0xc6, 0xc0, 0x3f, 0x40, 0x80, 0x71, 0x60,
+    0x80, 0x7d, 0x4f, 0xec, 0x20, 0x51, 0xa4, 0x1,
     /* U+0063 "c" */
-    0x0, 0x0, 0x1, 0x7c, 0xef, 0xda, 0x40, 0x0,
-    0x5, 0xef, 0xff, 0xff, 0xfd, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0xff, 0xd0, 0x4, 0xff, 0xff, 0xff,
-    0xff, 0xfd, 0x0, 0xdf, 0xff, 0xff, 0xff, 0xff,
-    0xd0, 0x5f, 0xff, 0xff, 0xff, 0xb7, 0xad, 0xa,
-    0xff, 0xff, 0xff, 0x60, 0x0, 0x10, 0xef, 0xff,
-    0xff, 0xb0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf6,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0x50, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0xd0, 0x0, 0x0, 0xb, 0xff,
-    0xff, 0xff, 0x90, 0x0, 0x40, 0x5f, 0xff, 0xff,
-    0xff, 0xea, 0xdd, 0x0, 0xcf, 0xff, 0xff, 0xff,
-    0xff, 0xd0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xfd,
-    0x0, 0x8, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x0,
-    0x7, 0xff, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x2,
-    0x8d, 0xfe, 0xb7, 0x10,
-
+    0x0, 0xe1, 0x7c, 0xef, 0xda, 0x40, 0xc, 0xbf,
+    0x6, 0x20, 0x4b, 0x20, 0x13, 0xd0, 0x80, 0x7f,
+    0x24, 0x0, 0x7f, 0xd2, 0x1, 0xff, 0x29, 0x0,
+    0x79, 0x21, 0x40, 0x1e, 0x1, 0xe9, 0xb7, 0xac,
+    0x4, 0x0, 0xe4, 0x60, 0x8, 0x40, 0x40, 0x3b,
+    0x40, 0x38, 0x40, 0x3c, 0x60, 0x1c, 0x20, 0x1e,
+    0x20, 0xf, 0xfd, 0x40, 0x1e, 0x40, 0xe, 0x29,
+    0x0, 0x90, 0x38, 0x3, 0xcd, 0xd5, 0xb2, 0xa,
+    0x60, 0x1e, 0x15, 0x20, 0xb, 0xc0, 0x3f, 0xf1,
+    0xb8, 0x7, 0xfe, 0x88, 0x0, 0x7f, 0xe7, 0xd7,
+    0x20, 0x14, 0x8c,
     /* U+0064 "d" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xf6,
-    0x0, 0x0, 0x7, 0xdf, 0xe9, 0x1c, 0xff, 0xff,
-    0xf6, 0x0, 0x2, 0xdf, 0xff, 0xff, 0xee, 0xff,
-    0xff, 0xf6, 0x0, 0x1d, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf6, 0x0, 0x8f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf6, 0x0, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf6, 0x7, 0xff, 0xff,
-    0xff, 0x73, 0x8f, 0xff, 0xff, 0xf6, 0xc, 0xff,
-    0xff, 0xfa, 0x0, 0xc, 0xff, 0xff, 0xf6, 0xf,
-    0xff, 0xff, 0xf4, 0x0, 0xc, 0xff, 0xff, 0xf6,
-    0x1f, 0xff, 0xff, 0xf2, 0x0, 0xc, 0xff, 0xff,
-    0xf6, 0x2f, 0xff, 0xff, 0xf1, 0x0, 0xc, 0xff,
-    0xff, 0xf6, 0xf, 0xff, 0xff, 0xf2, 0x0, 0xc,
-    0xff, 0xff, 0xf6, 0xe, 0xff, 0xff, 0xf6, 0x0,
-    0xf, 0xff, 0xff, 0xf6, 0xc, 0xff, 0xff, 0xfc,
-    0x0, 0x4f, 0xff, 0xff, 0xf6, 0x8, 0xff, 0xff,
-    0xff, 0xb8, 0xef, 0xff, 0xff, 0xf6, 0x1, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x0,
-    0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6,
-    0x0, 0x2f, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff,
-    0xf6, 0x0, 0x4, 0xff, 0xff, 0xff, 0x87, 0xff,
-    0xff, 0xf6, 0x0, 0x0, 0x2a, 0xef, 0xc5, 0x3,
-    0xff, 0xff, 0xf6,
-
+    0x0, 0xff, 0xb3, 0xff, 0x98, 0x3, 0xff, 0xfe,
+    0x1, 0xff, 0xec, 0x7d, 0xfe, 0x91, 0x0, 0xff,
+    0x16, 0xc1, 0x0, 0xb7, 0x90, 0x7, 0xe1, 0xf2,
+    0x0, 0xe1, 0x10, 0x7, 0xe9, 0x20, 0xf, 0xfe,
+    0x23, 0x80, 0x7f, 0xf1, 0x1c, 0x3, 0xd1, 0x8e,
+    0x1, 0xfa, 0xc0, 0x39, 0x5c, 0xe0, 0xc0, 0x3e,
+    0x30, 0xe, 0xe0, 0xf, 0xf0, 0x80, 0x79, 0x80,
+    0x3f, 0xc6, 0x1, 0xe3, 0x0, 0xff, 0x10, 0x7,
+    0x8c, 0x3, 0xfe, 0x10, 0xe, 0x40, 0x8, 0xc0,
+    0x3e, 0x20, 0xe, 0xa0, 0x2, 0x0, 0x7e, 0x40,
+    0xe, 0x3b, 0x8a, 0x0, 0xfd, 0x20, 0x1e, 0x47,
+    0x10, 0xf, 0xc2, 0xa0, 0x1f, 0xfc, 0x58, 0x0,
+    0xfc, 0x20, 0x1f, 0x8a, 0xc0, 0x3c, 0xf2, 0x1,
+    0xfc, 0x9a, 0xa2, 0x7, 0x50, 0x80, 0x1e,
     /* U+0065 "e" */
-    0x0, 0x0, 0x5, 0xbd, 0xfe, 0xc8, 0x10, 0x0,
-    0x0, 0x0, 0x4d, 0xff, 0xff, 0xff, 0xff, 0x70,
-    0x0, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x70, 0x0, 0x2f, 0xff, 0xff, 0xd8, 0xbf, 0xff,
-    0xff, 0x10, 0xc, 0xff, 0xff, 0xd0, 0x0, 0x8f,
-    0xff, 0xf9, 0x3, 0xff, 0xff, 0xf6, 0x0, 0x1,
-    0xff, 0xff, 0xf0, 0x8f, 0xff, 0xff, 0x74, 0x44,
-    0x4f, 0xff, 0xff, 0x2c, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf5, 0xef, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf7, 0xef, 0xff, 0xff,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x60, 0x9f, 0xff,
-    0xff, 0xfa, 0x0, 0x0, 0x2, 0xcb, 0x4, 0xff,
-    0xff, 0xff, 0xfc, 0x63, 0x49, 0xff, 0xb0, 0xc,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x0,
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0,
-    0x0, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb,
-    0x0, 0x0, 0x3d, 0xff, 0xff, 0xff, 0xff, 0xf9,
-    0x10, 0x0, 0x0, 0x5, 0xad, 0xff, 0xdb, 0x61,
-    0x0, 0x0,
-
+    0x0, 0xe5, 0xbd, 0xfe, 0xc8, 0x10, 0xf, 0x93,
+    0x69, 0x8, 0x4, 0xdf, 0x9c, 0x3, 0x96, 0xc8,
+    0x3, 0xf4, 0x38, 0x4, 0x54, 0x1, 0x89, 0xd0,
+    0x3, 0x40, 0x80, 0x38, 0x3, 0x16, 0xc5, 0xb8,
+    0x6, 0x80, 0x33, 0x0, 0x6b, 0x0, 0xa4, 0x3,
+    0x30, 0x58, 0x7, 0xa, 0x24, 0xa0, 0x1c, 0x48,
+    0x1, 0xd1, 0x77, 0x80, 0x39, 0xc8, 0x3, 0xff,
+    0x86, 0x42, 0x1, 0xff, 0xc4, 0x10, 0xe, 0x6f,
+    0xff, 0xe7, 0x30, 0xe, 0x61, 0x0, 0xf9, 0x81,
+    0x0, 0x3d, 0x60, 0x1c, 0x59, 0xa1, 0xa0, 0x1e,
+    0x5c, 0x63, 0x49, 0xd3, 0x0, 0x21, 0x80, 0x78,
+    0xe7, 0x2d, 0x80, 0x3b, 0x80, 0x3f, 0xf8, 0x85,
+    0x60, 0x1f, 0xfc, 0x44, 0xc2, 0x0, 0xfe, 0x6a,
+    0x0, 0xc7, 0xb4, 0xa4, 0x0, 0x24, 0x9e, 0x91,
+    0x0,
     /* U+0066 "f" */
-    0x0, 0x0, 0x5, 0xbd, 0xfe, 0xb5, 0x0, 0x0,
-    0xcf, 0xff, 0xff, 0xfb, 0x0, 0xa, 0xff, 0xff,
-    0xff, 0xfb, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xfb,
-    0x0, 0x4f, 0xff, 0xff, 0xff, 0xfb, 0x0, 0x6f,
-    0xff, 0xff, 0xf6, 0x45, 0x0, 0x6f, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xc0, 0x0,
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xbf, 0xff,
-    0xff, 0xff, 0xff, 0xfb, 0xbf, 0xff, 0xff, 0xff,
-    0xff, 0xfb, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xfb,
-    0x57, 0xbf, 0xff, 0xff, 0xe7, 0x75, 0x0, 0x6f,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x6f, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x6f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x6f,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x6f, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x6f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x6f,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x6f, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x6f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x6f,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x6f, 0xff, 0xff,
-    0xc0, 0x0,
-
+    0x0, 0xe5, 0xbd, 0xfe, 0xb5, 0x0, 0xd9, 0x48,
+    0x40, 0x29, 0xc0, 0x15, 0x18, 0x7, 0xf0, 0xa8,
+    0x7, 0xf9, 0x40, 0x3f, 0xe2, 0x0, 0xf4, 0xdf,
+    0x0, 0x7e, 0x36, 0x45, 0x0, 0xff, 0xd7, 0xf2,
+    0x1, 0xc7, 0xfe, 0xb0, 0xf, 0xfe, 0xc7, 0x42,
+    0x0, 0x70, 0xc4, 0x39, 0x5f, 0x40, 0x38, 0x9d,
+    0xca, 0x1, 0xff, 0xff, 0x0, 0xff, 0xff, 0x80,
+    0x78,
     /* U+0067 "g" */
-    0x0, 0x0, 0x6, 0xcf, 0xeb, 0x50, 0x5f, 0xff,
-    0xf6, 0x0, 0x1, 0xcf, 0xff, 0xff, 0xfc, 0xff,
-    0xff, 0xf6, 0x0, 0xc, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf6, 0x0, 0x6f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf6, 0x0, 0xdf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf6, 0x5, 0xff, 0xff,
-    0xff, 0x93, 0x8f, 0xff, 0xff, 0xf6, 0xb, 0xff,
-    0xff, 0xfc, 0x0, 0xc, 0xff, 0xff, 0xf6, 0xe,
-    0xff, 0xff, 0xf6, 0x0, 0xc, 0xff, 0xff, 0xf6,
-    0xf, 0xff, 0xff, 0xf4, 0x0, 0xc, 0xff, 0xff,
-    0xf6, 0x1f, 0xff, 0xff, 0xf3, 0x0, 0xc, 0xff,
-    0xff, 0xf6, 0xf, 0xff, 0xff, 0xf4, 0x0, 0xc,
-    0xff, 0xff, 0xf6, 0xe, 0xff, 0xff, 0xf7, 0x0,
-    0xe, 0xff, 0xff, 0xf6, 0xb, 0xff, 0xff, 0xfd,
-    0x0, 0x3f, 0xff, 0xff, 0xf6, 0x8, 0xff, 0xff,
-    0xff, 0xc7, 0xef, 0xff, 0xff, 0xf6, 0x1, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x0,
-    0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6,
-    0x0, 0x1e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf6, 0x0, 0x3, 0xef, 0xff, 0xff, 0x8c, 0xff,
-    0xff, 0xf6, 0x0, 0x0, 0x19, 0xef, 0xc5, 0xc,
-    0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xf5, 0x0, 0x70, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xff, 0xf2, 0x0, 0xdd, 0x50,
-    0x0, 0x4, 0xef, 0xff, 0xff, 0xf0, 0x0, 0xdf,
-    0xfe, 0xaa, 0xdf, 0xff, 0xff, 0xff, 0x90, 0x0,
-    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x20,
-    0x0, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xb0, 0x0, 0x0, 0x6d, 0xff, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x48, 0xce, 0xfe,
-    0xc8, 0x20, 0x0, 0x0,
-
+    0x0, 0xe6, 0xcf, 0xeb, 0x50, 0x5f, 0xfc, 0xc0,
+    0x10, 0xe4, 0x98, 0xa, 0x56, 0x50, 0x7, 0xed,
+    0x30, 0xf, 0x18, 0x7, 0xe6, 0x30, 0xf, 0xfe,
+    0x25, 0x80, 0x7f, 0xf1, 0x14, 0x80, 0x39, 0xb1,
+    0xc0, 0x3f, 0x70, 0x7, 0x1c, 0x9c, 0x18, 0x7,
+    0xca, 0x1, 0xd4, 0x1, 0xff, 0x8, 0x7, 0x10,
+    0x7, 0xf8, 0x40, 0x3c, 0xe0, 0x1f, 0xe1, 0x0,
+    0xf3, 0x80, 0x7f, 0xc2, 0x1, 0xc6, 0x1, 0x10,
+    0x7, 0xca, 0x1, 0xd4, 0x0, 0x31, 0x0, 0xf8,
+    0xc0, 0x38, 0xb1, 0xf4, 0x3, 0xf4, 0x80, 0x78,
+    0xe0, 0x40, 0x3f, 0xb, 0x0, 0x7f, 0xf1, 0x60,
+    0x40, 0x3f, 0xf8, 0x83, 0xa2, 0x1, 0xce, 0x60,
+    0x1f, 0xc7, 0xec, 0x20, 0x75, 0x0, 0x1f, 0xf0,
+    0xcf, 0x7e, 0x28, 0x18, 0x7, 0x18, 0x1, 0xc0,
+    0x3e, 0x60, 0xf, 0x38, 0x2, 0xb5, 0x40, 0x32,
+    0x40, 0x7, 0x88, 0x2, 0x2a, 0xea, 0xa6, 0xd8,
+    0x80, 0x73, 0x0, 0x78, 0x55, 0x44, 0x1, 0xf5,
+    0x80, 0x7f, 0xf1, 0x1c, 0x80, 0x3f, 0xf8, 0x69,
+    0x0, 0x1a, 0xc8, 0x3, 0xf9, 0xec, 0x3, 0x9b,
+    0x6d, 0xcc, 0x40, 0x4d, 0xf6, 0x0, 0x30,
     /* U+0068 "h" */
-    0x1f, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xf1,
-    0x3a, 0xee, 0xb5, 0x0, 0x1, 0xff, 0xff, 0xff,
-    0x7f, 0xff, 0xff, 0xf8, 0x0, 0x1f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf4, 0x1, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1, 0xff,
-    0xff, 0xff, 0xf7, 0xaf, 0xff, 0xff, 0xf2, 0x1f,
-    0xff, 0xff, 0xf8, 0x1, 0xff, 0xff, 0xff, 0x31,
-    0xff, 0xff, 0xff, 0x40, 0xf, 0xff, 0xff, 0xf3,
-    0x1f, 0xff, 0xff, 0xf2, 0x0, 0xff, 0xff, 0xff,
-    0x31, 0xff, 0xff, 0xff, 0x10, 0xf, 0xff, 0xff,
-    0xf3, 0x1f, 0xff, 0xff, 0xf1, 0x0, 0xff, 0xff,
-    0xff, 0x31, 0xff, 0xff, 0xff, 0x10, 0xf, 0xff,
-    0xff, 0xf3, 0x1f, 0xff, 0xff, 0xf1, 0x0, 0xff,
-    0xff, 0xff, 0x31, 0xff, 0xff, 0xff, 0x10, 0xf,
-    0xff, 0xff, 0xf3, 0x1f, 0xff, 0xff, 0xf1, 0x0,
-    0xff, 0xff, 0xff, 0x31, 0xff, 0xff, 0xff, 0x10,
-    0xf, 0xff, 0xff, 0xf3, 0x1f, 0xff, 0xff, 0xf1,
-    0x0, 0xff, 0xff, 0xff, 0x31, 0xff, 0xff, 0xff,
-    0x10, 0xf, 0xff, 0xff, 0xf3, 0x1f, 0xff, 0xff,
-    0xf1, 0x0, 0xff, 0xff, 0xff, 0x30,
-
+    0x1f, 0xff, 0x8, 0x7, 0xff, 0xfc, 0x3, 0xff,
+    0xe2, 0x75, 0xdc, 0xb5, 0x0, 0xff, 0x36, 0x28,
+    0x89, 0x2a, 0x0, 0x3f, 0xa0, 0x3, 0xce, 0x80,
+    0x1f, 0xfc, 0x48, 0x0, 0xff, 0xe2, 0x18, 0x7,
+    0xf4, 0x28, 0x7, 0x88, 0x3, 0xe7, 0x75, 0x80,
+    0x78, 0x40, 0x3e, 0xc0, 0x10, 0xf, 0xfe, 0x13,
+    0x0, 0x7f, 0xf1, 0xc, 0x3, 0xff, 0xfe, 0x1,
+    0xff, 0xff, 0x0, 0xff, 0xc0,
     /* U+0069 "i" */
-    0x0, 0x7d, 0xea, 0x10, 0x8, 0xff, 0xff, 0xd0,
-    0xf, 0xff, 0xff, 0xf5, 0x1f, 0xff, 0xff, 0xf7,
-    0xd, 0xff, 0xff, 0xf3, 0x3, 0xff, 0xff, 0x80,
-    0x0, 0x17, 0x83, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xff, 0xff, 0xf3, 0xe, 0xff, 0xff, 0xf3,
-    0xe, 0xff, 0xff, 0xf3, 0xe, 0xff, 0xff, 0xf3,
-    0xe, 0xff, 0xff, 0xf3, 0xe, 0xff, 0xff, 0xf3,
-    0xe, 0xff, 0xff, 0xf3, 0xe, 0xff, 0xff, 0xf3,
-    0xe, 0xff, 0xff, 0xf3, 0xe, 0xff, 0xff, 0xf3,
-    0xe, 0xff, 0xff, 0xf3, 0xe, 0xff, 0xff, 0xf3,
-    0xe, 0xff, 0xff, 0xf3, 0xe, 0xff, 0xff, 0xf3,
-    0xe, 0xff, 0xff, 0xf3, 0xe, 0xff, 0xff, 0xf3,
-    0xe, 0xff, 0xff, 0xf3, 0xe, 0xff, 0xff, 0xf3,
-    0xe, 0xff, 0xff, 0xf3,
-
+    0x0, 0x3e, 0xf5, 0x8, 0x2, 0x20, 0x42, 0xb8,
+    0x0, 0x70, 0xc, 0x4a, 0x20, 0x1e, 0x21, 0x20,
+    0xe, 0x40, 0xe0, 0xc, 0xe6, 0x7, 0xd0, 0xf9,
+    0x0, 0x10, 0xbc, 0x18, 0x5, 0xdf, 0xfc, 0x60,
+    0x1f, 0xff, 0xf0, 0xf, 0xff, 0xc8,
     /* U+006A "j" */
-    0x0, 0x0, 0x7d, 0xea, 0x10, 0x0, 0x8, 0xff,
-    0xff, 0xd0, 0x0, 0xf, 0xff, 0xff, 0xf5, 0x0,
-    0x1f, 0xff, 0xff, 0xf7, 0x0, 0xd, 0xff, 0xff,
-    0xf3, 0x0, 0x3, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x17, 0x83, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xf3, 0x0, 0xf, 0xff,
-    0xff, 0xf3, 0x0, 0xf, 0xff, 0xff, 0xf3, 0x0,
-    0xf, 0xff, 0xff, 0xf3, 0x0, 0xf, 0xff, 0xff,
-    0xf3, 0x0, 0xf, 0xff, 0xff, 0xf3, 0x0, 0xf,
-    0xff, 0xff, 0xf3, 0x0, 0xf, 0xff, 0xff, 0xf3,
-    0x0, 0xf, 0xff, 0xff, 0xf3, 0x0, 0xf, 0xff,
-    0xff, 0xf3, 0x0, 0xf, 0xff, 0xff, 0xf3, 0x0,
-    0xf, 0xff, 0xff, 0xf3, 0x0, 0xf, 0xff, 0xff,
-    0xf3, 0x0, 0xf, 0xff, 0xff, 0xf3, 0x0, 0xf,
-    0xff, 0xff, 0xf3, 0x0, 0xf, 0xff, 0xff, 0xf3,
-    0x0, 0xf, 0xff, 0xff, 0xf3, 0x0, 0xf, 0xff,
-    0xff, 0xf3, 0x0, 0xf, 0xff, 0xff, 0xf3, 0x0,
-    0xf, 0xff, 0xff, 0xf3, 0x0, 0xf, 0xff, 0xff,
-    0xf3, 0x0, 0x2f, 0xff, 0xff, 0xf2, 0x85, 0xbf,
-    0xff, 0xff, 0xf0, 0xef, 0xff, 0xff, 0xff, 0xe0,
-    0xef, 0xff, 0xff, 0xff, 0x90, 0xef, 0xff, 0xff,
-    0xff, 0x10, 0xef, 0xff, 0xff, 0xf5, 0x0, 0x6c,
-    0xff, 0xc9, 0x20, 0x0,
-
+    0x0, 0xcf, 0xbd, 0x42, 0x1, 0xa2, 0x4, 0x2b,
+    0x80, 0x19, 0xc0, 0x31, 0x28, 0x0, 0x40, 0x3c,
+    0x40, 0x1, 0x20, 0xe, 0x40, 0xb, 0x80, 0x33,
+    0x98, 0x4, 0x7d, 0xf, 0x90, 0x1, 0xc2, 0xf0,
+    0x60, 0x1d, 0xff, 0xe3, 0x0, 0xff, 0xff, 0x80,
+    0x7f, 0xff, 0xc0, 0x3f, 0xfd, 0x4, 0x1, 0xe1,
+    0x85, 0x90, 0xf, 0x13, 0x52, 0x0, 0x70, 0x80,
+    0x7f, 0x38, 0x7, 0xf4, 0x0, 0x7e, 0xa1, 0x8,
+    0x30, 0x1, 0xb6, 0xa8, 0x0,
     /* U+006B "k" */
-    0x1f, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xf1,
-    0x3, 0xff, 0xff, 0xf8, 0x1, 0xff, 0xff, 0xff,
-    0x10, 0xbf, 0xff, 0xfd, 0x0, 0x1f, 0xff, 0xff,
-    0xf1, 0x3f, 0xff, 0xff, 0x20, 0x1, 0xff, 0xff,
-    0xff, 0x1a, 0xff, 0xff, 0x70, 0x0, 0x1f, 0xff,
-    0xff, 0xf4, 0xff, 0xff, 0xc0, 0x0, 0x1, 0xff,
-    0xff, 0xff, 0xcf, 0xff, 0xf6, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90,
-    0x0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf3, 0x0, 0x1f, 0xff, 0xff, 0xf7, 0xdf, 0xff,
-    0xff, 0x80, 0x1, 0xff, 0xff, 0xff, 0x28, 0xff,
-    0xff, 0xfd, 0x0, 0x1f, 0xff, 0xff, 0xf1, 0x4f,
-    0xff, 0xff, 0xf2, 0x1, 0xff, 0xff, 0xff, 0x10,
-    0xff, 0xff, 0xff, 0x70, 0x1f, 0xff, 0xff, 0xf1,
-    0xa, 0xff, 0xff, 0xfc, 0x1, 0xff, 0xff, 0xff,
-    0x10, 0x6f, 0xff, 0xff, 0xf1, 0x1f, 0xff, 0xff,
-    0xf1, 0x1, 0xff, 0xff, 0xff, 0x60,
-
+    0x1f, 0xff, 0x8, 0x7, 0xff, 0xfc, 0x3, 0xff,
+    0xe4, 0x7f, 0xfd, 0x0, 0x1f, 0xe8, 0x0, 0xc5,
+    0x0, 0x1f, 0xc6, 0x80, 0x1b, 0xc0, 0x3f, 0xd2,
+    0x1, 0xa0, 0x80, 0x3f, 0x95, 0x40, 0x11, 0xb8,
+    0x7, 0xfa, 0x0, 0x35, 0x0, 0x7f, 0xc6, 0x1,
+    0xb0, 0x3, 0xff, 0x88, 0xa0, 0x1f, 0xfc, 0x54,
+    0x0, 0xff, 0xe2, 0x68, 0x7, 0xff, 0x11, 0xc0,
+    0x3f, 0xf8, 0x82, 0x60, 0x1f, 0xd0, 0x40, 0x1d,
+    0x60, 0x1f, 0xca, 0xa0, 0xe, 0x50, 0xf, 0xe3,
+    0xc0, 0xe, 0x22, 0x0, 0x7f, 0x20, 0x7, 0x94,
+    0x3, 0xfc, 0xa0, 0x1d, 0x60, 0x1f, 0xec, 0x0,
+    0xe3, 0x10, 0xf, 0xe7, 0x0, 0xf3, 0x80,
     /* U+006C "l" */
-    0xef, 0xff, 0xff, 0x4e, 0xff, 0xff, 0xf4, 0xef,
-    0xff, 0xff, 0x4e, 0xff, 0xff, 0xf4, 0xef, 0xff,
-    0xff, 0x4e, 0xff, 0xff, 0xf4, 0xef, 0xff, 0xff,
-    0x4e, 0xff, 0xff, 0xf4, 0xef, 0xff, 0xff, 0x4e,
-    0xff, 0xff, 0xf4, 0xef, 0xff, 0xff, 0x4e, 0xff,
-    0xff, 0xf4, 0xef, 0xff, 0xff, 0x4e, 0xff, 0xff,
-    0xf4, 0xef, 0xff, 0xff, 0x4e, 0xff, 0xff, 0xf4,
-    0xef, 0xff, 0xff, 0x4e, 0xff, 0xff, 0xf4, 0xef,
-    0xff, 0xff, 0x4e, 0xff, 0xff, 0xf4, 0xef, 0xff,
-    0xff, 0x4e, 0xff, 0xff, 0xf4, 0xef, 0xff, 0xff,
-    0x4e, 0xff, 0xff, 0xf4, 0xef, 0xff, 0xff, 0x4e,
-    0xff, 0xff, 0xf4, 0xef, 0xff, 0xff, 0x40,
-
+    0xef, 0xfe, 0x40, 0xf, 0xff, 0xf8, 0x7, 0xff,
+    0xfc, 0x3, 0xff, 0xa8,
     /* U+006D "m" */
-    0x1f, 0xff, 0xff, 0x60, 0x3b, 0xef, 0xc5, 0x0,
-    0x4, 0xbe, 0xfc, 0x60, 0x0, 0x1f, 0xff, 0xff,
-    0xb5, 0xff, 0xff, 0xff, 0x80, 0x8f, 0xff, 0xff,
-    0xf9, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf9, 0xff, 0xff, 0xff, 0xff, 0x60, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xd0, 0x1f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf2, 0x1f, 0xff, 0xff, 0xff, 0x8b, 0xff, 0xff,
-    0xff, 0xf9, 0xaf, 0xff, 0xff, 0xf5, 0x1f, 0xff,
-    0xff, 0xf9, 0x1, 0xff, 0xff, 0xff, 0xa0, 0xe,
-    0xff, 0xff, 0xf6, 0x1f, 0xff, 0xff, 0xf4, 0x0,
-    0xff, 0xff, 0xff, 0x70, 0xc, 0xff, 0xff, 0xf6,
-    0x1f, 0xff, 0xff, 0xf2, 0x0, 0xef, 0xff, 0xff,
-    0x50, 0xc, 0xff, 0xff, 0xf6, 0x1f, 0xff, 0xff,
-    0xf1, 0x0, 0xef, 0xff, 0xff, 0x40, 0xc, 0xff,
-    0xff, 0xf6, 0x1f, 0xff, 0xff, 0xf1, 0x0, 0xef,
-    0xff, 0xff, 0x40, 0xc, 0xff, 0xff, 0xf6, 0x1f,
-    0xff, 0xff, 0xf1, 0x0, 0xef, 0xff, 0xff, 0x40,
-    0xc, 0xff, 0xff, 0xf6, 0x1f, 0xff, 0xff, 0xf1,
-    0x0, 0xef, 0xff, 0xff, 0x40, 0xc, 0xff, 0xff,
-    0xf6, 0x1f, 0xff, 0xff, 0xf1, 0x0, 0xef, 0xff,
-    0xff, 0x40, 0xc, 0xff, 0xff, 0xf6, 0x1f, 0xff,
-    0xff, 0xf1, 0x0, 0xef, 0xff, 0xff, 0x40, 0xc,
-    0xff, 0xff, 0xf6, 0x1f, 0xff, 0xff, 0xf1, 0x0,
-    0xef, 0xff, 0xff, 0x40, 0xc, 0xff, 0xff, 0xf6,
-    0x1f, 0xff, 0xff, 0xf1, 0x0, 0xef, 0xff, 0xff,
-    0x40, 0xc, 0xff, 0xff, 0xf6, 0x1f, 0xff, 0xff,
-    0xf1, 0x0, 0xef, 0xff, 0xff, 0x40, 0xc, 0xff,
-    0xff, 0xf6, 0x1f, 0xff, 0xff, 0xf1, 0x0, 0xef,
-    0xff, 0xff, 0x40, 0xc, 0xff, 0xff, 0xf6,
-
+    0x1f, 0xfe, 0x60, 0x3b, 0xef, 0xc5, 0x0, 0x92,
+    0xfb, 0xf1, 0x80, 0x3f, 0xb5, 0x71, 0x4, 0xe,
+    0xa0, 0x22, 0xd0, 0x40, 0xe6, 0x40, 0x1f, 0x92,
+    0x80, 0x3c, 0xf2, 0xe0, 0x1e, 0x66, 0x0, 0x7f,
+    0xf1, 0x18, 0x3, 0xf5, 0x80, 0x7f, 0xf3, 0x48,
+    0x80, 0x1f, 0x9d, 0x0, 0x3e, 0x65, 0x0, 0xf3,
+    0x80, 0x7c, 0xd1, 0x40, 0x1e, 0x59, 0xa1, 0x0,
+    0xe3, 0x0, 0xfb, 0x40, 0x40, 0x3d, 0xa0, 0x2,
+    0x0, 0xff, 0xe0, 0x3, 0x0, 0x4, 0x3, 0x88,
+    0x3, 0xff, 0x88, 0x60, 0x1f, 0x84, 0x3, 0xff,
+    0xfe, 0x1, 0xff, 0xff, 0x0, 0xff, 0xff, 0x80,
+    0x7f, 0xf1, 0x80,
     /* U+006E "n" */
-    0x1f, 0xff, 0xff, 0x70, 0x4b, 0xee, 0xa5, 0x0,
-    0x1, 0xff, 0xff, 0xfb, 0x8f, 0xff, 0xff, 0xf9,
-    0x0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf5, 0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xd0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x11, 0xff, 0xff, 0xff, 0xf7, 0x9f,
-    0xff, 0xff, 0xf3, 0x1f, 0xff, 0xff, 0xf8, 0x0,
-    0xff, 0xff, 0xff, 0x41, 0xff, 0xff, 0xff, 0x30,
-    0xe, 0xff, 0xff, 0xf4, 0x1f, 0xff, 0xff, 0xf2,
-    0x0, 0xef, 0xff, 0xff, 0x41, 0xff, 0xff, 0xff,
-    0x10, 0xe, 0xff, 0xff, 0xf4, 0x1f, 0xff, 0xff,
-    0xf1, 0x0, 0xef, 0xff, 0xff, 0x41, 0xff, 0xff,
-    0xff, 0x10, 0xe, 0xff, 0xff, 0xf4, 0x1f, 0xff,
-    0xff, 0xf1, 0x0, 0xef, 0xff, 0xff, 0x41, 0xff,
-    0xff, 0xff, 0x10, 0xe, 0xff, 0xff, 0xf4, 0x1f,
-    0xff, 0xff, 0xf1, 0x0, 0xef, 0xff, 0xff, 0x41,
-    0xff, 0xff, 0xff, 0x10, 0xe, 0xff, 0xff, 0xf4,
-    0x1f, 0xff, 0xff, 0xf1, 0x0, 0xef, 0xff, 0xff,
-    0x41, 0xff, 0xff, 0xff, 0x10, 0xe, 0xff, 0xff,
-    0xf4, 0x1f, 0xff, 0xff, 0xf1, 0x0, 0xef, 0xff,
-    0xff, 0x40,
-
+    0x1f, 0xfe, 0x70, 0x4b, 0xee, 0x52, 0x80, 0x7f,
+    0x64, 0x5a, 0x8, 0x96, 0xa4, 0x3, 0xf2, 0x38,
+    0x7, 0x99, 0x40, 0x3f, 0xf8, 0x90, 0x1, 0xff,
+    0xc4, 0x21, 0x0, 0xfd, 0xc, 0x1, 0xe2, 0x0,
+    0xf9, 0xdd, 0x20, 0x1e, 0x70, 0xf, 0xac, 0x0,
+    0x20, 0x1f, 0xfc, 0x0, 0x10, 0xf, 0xfe, 0x21,
+    0x80, 0x7f, 0xff, 0xc0, 0x3f, 0xff, 0xe0, 0x1f,
+    0xf8,
     /* U+006F "o" */
-    0x0, 0x0, 0x6, 0xbe, 0xfe, 0xd9, 0x30, 0x0,
-    0x0, 0x0, 0x4, 0xef, 0xff, 0xff, 0xff, 0xfb,
-    0x10, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xd1, 0x0, 0x2, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x0, 0xb, 0xff, 0xff, 0xff,
-    0xdf, 0xff, 0xff, 0xff, 0x60, 0x2f, 0xff, 0xff,
-    0xf7, 0x1, 0xdf, 0xff, 0xff, 0xd0, 0x7f, 0xff,
-    0xff, 0xe0, 0x0, 0x5f, 0xff, 0xff, 0xf1, 0xaf,
-    0xff, 0xff, 0xa0, 0x0, 0x1f, 0xff, 0xff, 0xf5,
-    0xcf, 0xff, 0xff, 0x80, 0x0, 0xf, 0xff, 0xff,
-    0xf6, 0xdf, 0xff, 0xff, 0x70, 0x0, 0xe, 0xff,
-    0xff, 0xf7, 0xcf, 0xff, 0xff, 0x80, 0x0, 0xe,
-    0xff, 0xff, 0xf6, 0xbf, 0xff, 0xff, 0xa0, 0x0,
-    0x1f, 0xff, 0xff, 0xf4, 0x8f, 0xff, 0xff, 0xe0,
-    0x0, 0x5f, 0xff, 0xff, 0xf1, 0x3f, 0xff, 0xff,
-    0xf8, 0x0, 0xdf, 0xff, 0xff, 0xc0, 0xc, 0xff,
-    0xff, 0xff, 0xee, 0xff, 0xff, 0xff, 0x50, 0x3,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd1,
-    0x0, 0x0, 0x5, 0xef, 0xff, 0xff, 0xff, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xbe, 0xfe, 0xd8,
-    0x30, 0x0, 0x0,
-
+    0x0, 0xe6, 0xbe, 0xfe, 0xd9, 0x30, 0xf, 0xc9,
+    0xd2, 0x82, 0x2, 0x4d, 0x96, 0x20, 0x1c, 0xb6,
+    0x20, 0x1f, 0x93, 0x4, 0x2, 0x2a, 0x0, 0xff,
+    0x8b, 0x40, 0x29, 0x0, 0xf1, 0x0, 0x78, 0xd8,
+    0x9, 0x0, 0x3a, 0x37, 0x88, 0x3, 0xac, 0x14,
+    0x3, 0x85, 0xc0, 0x60, 0x3, 0x88, 0x74, 0x3,
+    0x90, 0x2, 0x40, 0xf, 0x23, 0x0, 0x71, 0x0,
+    0x42, 0x1, 0xe3, 0x10, 0xe, 0xf0, 0xc, 0x20,
+    0x1c, 0x22, 0x0, 0xef, 0x0, 0xff, 0xb, 0x80,
+    0x71, 0x0, 0x42, 0x20, 0xe, 0x23, 0x0, 0xe4,
+    0x0, 0x90, 0x3, 0xcb, 0x60, 0x1c, 0x30, 0x0,
+    0x80, 0xe, 0x31, 0x33, 0x0, 0x73, 0xf7, 0x8,
+    0x3, 0xa4, 0x1, 0xe0, 0x1e, 0x11, 0x0, 0x72,
+    0x28, 0x0, 0xe0, 0x3, 0xfe, 0x2a, 0x0, 0xcf,
+    0x42, 0x1, 0xf9, 0x74, 0x40, 0x39, 0x7a, 0x50,
+    0x40, 0x49, 0xf2, 0x80, 0x30,
     /* U+0070 "p" */
-    0x2f, 0xff, 0xff, 0x40, 0x5c, 0xee, 0xb4, 0x0,
-    0x0, 0x2f, 0xff, 0xff, 0x89, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf6, 0x0, 0x2f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x0, 0x2f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x60, 0x2f, 0xff, 0xff,
-    0xfd, 0x67, 0xff, 0xff, 0xff, 0xd0, 0x2f, 0xff,
-    0xff, 0xf4, 0x0, 0x7f, 0xff, 0xff, 0xf0, 0x2f,
-    0xff, 0xff, 0xf0, 0x0, 0x2f, 0xff, 0xff, 0xf2,
-    0x2f, 0xff, 0xff, 0xf0, 0x0, 0xf, 0xff, 0xff,
-    0xf4, 0x2f, 0xff, 0xff, 0xf0, 0x0, 0xf, 0xff,
-    0xff, 0xf6, 0x2f, 0xff, 0xff, 0xf0, 0x0, 0xf,
-    0xff, 0xff, 0xf5, 0x2f, 0xff, 0xff, 0xf0, 0x0,
-    0x3f, 0xff, 0xff, 0xf3, 0x2f, 0xff, 0xff, 0xf0,
-    0x0, 0x9f, 0xff, 0xff, 0xf0, 0x2f, 0xff, 0xff,
-    0xfc, 0x69, 0xff, 0xff, 0xff, 0xa0, 0x2f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x30, 0x2f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0,
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3,
-    0x0, 0x2f, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff,
-    0x40, 0x0, 0x2f, 0xff, 0xff, 0xf0, 0x7c, 0xfd,
-    0x92, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0,
-
+    0x2f, 0xfe, 0x40, 0x5c, 0xee, 0x5a, 0x0, 0x7f,
+    0xb2, 0x68, 0xc4, 0x49, 0x70, 0x1, 0xfc, 0xec,
+    0x1, 0xe7, 0x60, 0xf, 0xfe, 0x2c, 0x0, 0x7f,
+    0xf1, 0x45, 0x80, 0x3f, 0x14, 0xc0, 0x7, 0xac,
+    0x3, 0xf4, 0xb3, 0xc0, 0x7, 0x10, 0x7, 0xe4,
+    0x0, 0x28, 0x7, 0x88, 0x3, 0xfc, 0x40, 0x1e,
+    0x60, 0xf, 0xfe, 0x29, 0x0, 0x7f, 0xf1, 0x4c,
+    0x3, 0xfc, 0x60, 0x1e, 0x60, 0xf, 0xf5, 0x0,
+    0x78, 0xc0, 0x3e, 0xc6, 0x96, 0x0, 0xe5, 0x0,
+    0xfc, 0x72, 0xc0, 0x1e, 0x90, 0xf, 0xfe, 0x21,
+    0x98, 0x3, 0xff, 0x89, 0xe0, 0x1f, 0xc6, 0x1,
+    0xeb, 0x30, 0xf, 0xec, 0x83, 0x2, 0x6d, 0x40,
+    0xf, 0xf9, 0xf3, 0xf6, 0x48, 0x3, 0xff, 0xfe,
+    0x1, 0xff, 0xfd,
     /* U+0071 "q" */
-    0x0, 0x0, 0x7, 0xdf, 0xeb, 0x40, 0x7f, 0xff,
-    0xf4, 0x0, 0x1, 0xdf, 0xff, 0xff, 0xfb, 0xff,
-    0xff, 0xf4, 0x0, 0xd, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf4, 0x0, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf4, 0x0, 0xef, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf4, 0x6, 0xff, 0xff,
-    0xff, 0xa4, 0x9f, 0xff, 0xff, 0xf4, 0xc, 0xff,
-    0xff, 0xfc, 0x0, 0xe, 0xff, 0xff, 0xf4, 0xf,
-    0xff, 0xff, 0xf6, 0x0, 0xd, 0xff, 0xff, 0xf4,
-    0x1f, 0xff, 0xff, 0xf3, 0x0, 0xd, 0xff, 0xff,
-    0xf4, 0x2f, 0xff, 0xff, 0xf2, 0x0, 0xd, 0xff,
-    0xff, 0xf4, 0x1f, 0xff, 0xff, 0xf3, 0x0, 0xe,
-    0xff, 0xff, 0xf4, 0xf, 0xff, 0xff, 0xf6, 0x0,
-    0xf, 0xff, 0xff, 0xf4, 0xd, 0xff, 0xff, 0xfc,
-    0x0, 0x4f, 0xff, 0xff, 0xf4, 0x8, 0xff, 0xff,
-    0xff, 0xb7, 0xef, 0xff, 0xff, 0xf4, 0x1, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x0,
-    0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4,
-    0x0, 0x2e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf4, 0x0, 0x3, 0xef, 0xff, 0xff, 0x6d, 0xff,
-    0xff, 0xf4, 0x0, 0x0, 0x19, 0xef, 0xc4, 0xd,
-    0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xff, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
-    0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xff, 0xff, 0xf4,
-
+    0x0, 0xe7, 0xdf, 0xeb, 0x40, 0x7f, 0xfc, 0x80,
+    0x10, 0xec, 0x10, 0xa, 0x5d, 0xa0, 0x3, 0xf6,
+    0x10, 0x7, 0x90, 0x3, 0xf3, 0x90, 0x7, 0xff,
+    0x12, 0x40, 0x3f, 0xf8, 0x8c, 0x20, 0x1c, 0xb6,
+    0xc0, 0x1f, 0xa8, 0x3, 0x8e, 0x92, 0x44, 0x3,
+    0xe3, 0x0, 0xea, 0x0, 0x8c, 0x3, 0xc2, 0x1,
+    0xe5, 0x0, 0xff, 0x18, 0x7, 0x84, 0x3, 0xfc,
+    0x60, 0x1e, 0x10, 0x8, 0xc0, 0x3c, 0x20, 0x1e,
+    0x50, 0x8, 0x40, 0x3e, 0x20, 0xe, 0xa0, 0x2,
+    0x0, 0x7e, 0x50, 0xe, 0x3b, 0x7a, 0x0, 0xfd,
+    0x20, 0x1e, 0x48, 0x10, 0xf, 0xc2, 0xa0, 0x1f,
+    0xfc, 0x58, 0x10, 0xf, 0xfe, 0x21, 0x68, 0x80,
+    0x74, 0x90, 0x7, 0xf1, 0xfb, 0x8, 0x1d, 0xb0,
+    0x7, 0xfc, 0x33, 0xdf, 0x88, 0x1, 0xff, 0xff,
+    0x0, 0xff, 0xff, 0x80, 0x0,
     /* U+0072 "r" */
-    0x3f, 0xff, 0xff, 0x40, 0x8d, 0xf9, 0x3f, 0xff,
-    0xff, 0x88, 0xff, 0xf9, 0x3f, 0xff, 0xff, 0xdf,
-    0xff, 0xf9, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xf9,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x3f, 0xff,
-    0xff, 0xff, 0xfe, 0xe9, 0x3f, 0xff, 0xff, 0xff,
-    0x40, 0x1, 0x3f, 0xff, 0xff, 0xf7, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xf1, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xf1,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xf1, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xf1, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xf1,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xf1, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xf1, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xf1,
-    0x0, 0x0,
-
+    0x3f, 0xfe, 0x40, 0x8d, 0xf9, 0x0, 0xf6, 0x43,
+    0x90, 0x7, 0xe5, 0x70, 0xf, 0xf1, 0x0, 0x7f,
+    0xf3, 0x84, 0x40, 0x1f, 0xd7, 0xdc, 0x80, 0xf,
+    0xa1, 0x0, 0x2, 0x1, 0xf2, 0x80, 0x7f, 0xc6,
+    0x1, 0xff, 0xff, 0x0, 0xff, 0xec, 0x80,
     /* U+0073 "s" */
-    0x0, 0x1, 0x8b, 0xdf, 0xec, 0x93, 0x0, 0x0,
-    0x8f, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x8, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc0, 0x4f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xc0, 0xaf, 0xff, 0xff, 0xff,
-    0xef, 0xff, 0xc0, 0xcf, 0xff, 0xff, 0xe2, 0x0,
-    0x3b, 0xc0, 0x9f, 0xff, 0xff, 0xe2, 0x0, 0x0,
-    0x40, 0x5f, 0xff, 0xff, 0xff, 0xa4, 0x0, 0x0,
-    0xa, 0xff, 0xff, 0xff, 0xff, 0xd5, 0x0, 0x0,
-    0x8f, 0xff, 0xff, 0xff, 0xff, 0x70, 0x0, 0x2,
-    0xaf, 0xff, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x1,
-    0x8f, 0xff, 0xff, 0xfc, 0xb4, 0x0, 0x0, 0xa,
-    0xff, 0xff, 0xff, 0xcf, 0xa3, 0x0, 0x3e, 0xff,
-    0xff, 0xfe, 0xcf, 0xff, 0xfe, 0xff, 0xff, 0xff,
-    0xfb, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60, 0x7e,
-    0xff, 0xff, 0xff, 0xff, 0xe6, 0x0, 0x0, 0x59,
-    0xde, 0xfc, 0xa7, 0x0, 0x0,
-
+    0x0, 0x86, 0x2f, 0x7f, 0xb2, 0x4c, 0x3, 0x47,
+    0x3a, 0x10, 0x9, 0xb6, 0x58, 0x2, 0x1c, 0x3,
+    0xf9, 0xc1, 0x1c, 0x3, 0xff, 0x70, 0x7, 0xc2,
+    0x1, 0xcc, 0x1, 0xc3, 0xbd, 0xf8, 0x80, 0x5,
+    0x0, 0xfe, 0x3b, 0x80, 0xc0, 0xe, 0x1d, 0xa4,
+    0x0, 0x20, 0x2a, 0x80, 0x3c, 0xb7, 0xaa, 0x1,
+    0x53, 0x80, 0x7c, 0x54, 0xe0, 0x14, 0x6a, 0x80,
+    0x7d, 0xa, 0x1, 0x15, 0x73, 0x80, 0x7a, 0x6d,
+    0x0, 0x21, 0x85, 0x0, 0xe3, 0x7b, 0xa3, 0x0,
+    0x1a, 0x0, 0x70, 0x80, 0x17, 0x3f, 0xb0, 0x40,
+    0x39, 0x40, 0x38, 0x40, 0x3e, 0x80, 0xf, 0xfd,
+    0x27, 0x62, 0x1, 0xf8, 0x65, 0x81, 0xfa, 0x98,
+    0x84, 0xd, 0x63, 0x98, 0x0,
     /* U+0074 "t" */
-    0x0, 0x4, 0x77, 0x77, 0x50, 0x0, 0x0, 0x9,
-    0xff, 0xff, 0xa0, 0x0, 0x0, 0xb, 0xff, 0xff,
-    0xa0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xa0, 0x0,
-    0x0, 0xd, 0xff, 0xff, 0xa0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xa0, 0x0, 0xaf, 0xff, 0xff, 0xff,
-    0xff, 0xfb, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xfb,
-    0xaf, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xaf, 0xff,
-    0xff, 0xff, 0xff, 0xfb, 0x57, 0xaf, 0xff, 0xff,
-    0xf7, 0x75, 0x0, 0x5f, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x5f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x5f,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x5f, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x5f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x5f,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x5f, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xf9, 0x24,
-    0x0, 0x3f, 0xff, 0xff, 0xff, 0xfb, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0xfb, 0x0, 0xa, 0xff, 0xff,
-    0xff, 0xfb, 0x0, 0x1, 0xef, 0xff, 0xff, 0xfb,
-    0x0, 0x0, 0x8, 0xce, 0xfe, 0xb5,
-
+    0x0, 0x91, 0xdf, 0x28, 0x7, 0xb6, 0x23, 0x78,
+    0x7, 0x88, 0x3, 0xfe, 0x70, 0xf, 0xf8, 0x40,
+    0x3f, 0xe2, 0x0, 0xfd, 0x5f, 0xe0, 0xe, 0x5f,
+    0xf5, 0x80, 0x7f, 0xf6, 0x3e, 0x14, 0x3, 0xd1,
+    0xe, 0x57, 0xf0, 0xe, 0x17, 0x72, 0x80, 0x7f,
+    0xff, 0xc0, 0x38, 0x40, 0x3f, 0xf4, 0x92, 0x0,
+    0x18, 0x3, 0xcd, 0xbe, 0x0, 0x20, 0xf, 0xf8,
+    0x54, 0x3, 0xfe, 0xb1, 0x0, 0xff, 0xf, 0x39,
+    0x88, 0xa, 0x70,
     /* U+0075 "u" */
-    0xf, 0xff, 0xff, 0xf2, 0x0, 0xff, 0xff, 0xff,
-    0x30, 0xff, 0xff, 0xff, 0x20, 0xf, 0xff, 0xff,
-    0xf3, 0xf, 0xff, 0xff, 0xf2, 0x0, 0xff, 0xff,
-    0xff, 0x30, 0xff, 0xff, 0xff, 0x20, 0xf, 0xff,
-    0xff, 0xf3, 0xf, 0xff, 0xff, 0xf2, 0x0, 0xff,
-    0xff, 0xff, 0x30, 0xff, 0xff, 0xff, 0x20, 0xf,
-    0xff, 0xff, 0xf3, 0xf, 0xff, 0xff, 0xf2, 0x0,
-    0xff, 0xff, 0xff, 0x30, 0xff, 0xff, 0xff, 0x20,
-    0xf, 0xff, 0xff, 0xf3, 0xf, 0xff, 0xff, 0xf2,
-    0x0, 0xff, 0xff, 0xff, 0x30, 0xff, 0xff, 0xff,
-    0x20, 0xf, 0xff, 0xff, 0xf3, 0xf, 0xff, 0xff,
-    0xf2, 0x0, 0xff, 0xff, 0xff, 0x30, 0xff, 0xff,
-    0xff, 0x20, 0xf, 0xff, 0xff, 0xf3, 0xf, 0xff,
-    0xff, 0xf4, 0x5, 0xff, 0xff, 0xff, 0x30, 0xef,
-    0xff, 0xff, 0xc7, 0xef, 0xff, 0xff, 0xf3, 0xc,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x30,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3,
-    0x0, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x30, 0x4, 0xff, 0xff, 0xff, 0xb9, 0xff, 0xff,
-    0xf3, 0x0, 0x2, 0xbe, 0xfc, 0x50, 0x4f, 0xff,
-    0xff, 0x30,
-
+    0xf, 0xff, 0x10, 0x3, 0xff, 0xc6, 0x1, 0xff,
+    0xff, 0x0, 0xff, 0xff, 0x80, 0x7f, 0xf8, 0x18,
+    0x14, 0x3, 0xf0, 0x80, 0x74, 0x3d, 0x80, 0x7e,
+    0x20, 0xe, 0x38, 0x10, 0xf, 0xd6, 0x1, 0xff,
+    0xc4, 0x71, 0x0, 0xff, 0xe2, 0x50, 0x7, 0x91,
+    0x80, 0x3f, 0x26, 0xa0, 0x81, 0xd5, 0xe8, 0x7,
+    0x80,
     /* U+0076 "v" */
-    0x4f, 0xff, 0xff, 0xf3, 0x0, 0x2f, 0xff, 0xff,
-    0xf2, 0xf, 0xff, 0xff, 0xf5, 0x0, 0x5f, 0xff,
-    0xff, 0xd0, 0xc, 0xff, 0xff, 0xf8, 0x0, 0x7f,
-    0xff, 0xff, 0x90, 0x7, 0xff, 0xff, 0xfa, 0x0,
-    0xaf, 0xff, 0xff, 0x40, 0x3, 0xff, 0xff, 0xfc,
-    0x0, 0xcf, 0xff, 0xff, 0x0, 0x0, 0xef, 0xff,
-    0xff, 0x0, 0xff, 0xff, 0xfb, 0x0, 0x0, 0xaf,
-    0xff, 0xff, 0x11, 0xff, 0xff, 0xf7, 0x0, 0x0,
-    0x6f, 0xff, 0xff, 0x34, 0xff, 0xff, 0xf2, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0x56, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0xd, 0xff, 0xff, 0x89, 0xff, 0xff,
-    0x90, 0x0, 0x0, 0x8, 0xff, 0xff, 0xab, 0xff,
-    0xff, 0x50, 0x0, 0x0, 0x4, 0xff, 0xff, 0xce,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xff, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xff, 0xff, 0xff, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xff,
-    0x10, 0x0, 0x0,
-
+    0x4f, 0xff, 0x18, 0x0, 0xbf, 0xfc, 0x48, 0x1,
+    0xe6, 0x0, 0x38, 0x7, 0x11, 0x0, 0xc0, 0x3b,
+    0x40, 0x4, 0x1, 0xc8, 0x0, 0xb0, 0xe, 0x20,
+    0x6, 0x80, 0x76, 0x80, 0x10, 0x3, 0x98, 0x0,
+    0xc0, 0x1c, 0x80, 0x3, 0x10, 0xc, 0x60, 0x3,
+    0x0, 0xc8, 0x1, 0x90, 0x3, 0x84, 0x40, 0x1d,
+    0x80, 0x1b, 0x0, 0x38, 0x94, 0x3, 0x94, 0x3,
+    0x38, 0x7, 0x31, 0x0, 0x61, 0x20, 0xc, 0x24,
+    0x1, 0xb7, 0xc0, 0x33, 0x80, 0x79, 0x40, 0x31,
+    0x10, 0x3, 0x60, 0x7, 0xb0, 0x3, 0x32, 0x80,
+    0x65, 0x0, 0xf2, 0x0, 0x63, 0x10, 0x8, 0xc0,
+    0x3f, 0x20, 0x7, 0xeb, 0x0, 0xfd, 0x80, 0x1f,
+    0x90, 0x3, 0xf2, 0x0, 0x7c, 0x26, 0x1, 0xf8,
+    0xc4, 0x3, 0xce, 0x1, 0xfe, 0x40, 0xf, 0x60,
+    0x7, 0xfb, 0xc0, 0x3c, 0x80, 0x1c,
     /* U+0077 "w" */
-    0xf, 0xff, 0xff, 0xf3, 0x0, 0x7f, 0xff, 0xff,
-    0xc0, 0x0, 0xcf, 0xff, 0xff, 0x60, 0xbf, 0xff,
-    0xff, 0x50, 0x9, 0xff, 0xff, 0xfe, 0x0, 0xf,
-    0xff, 0xff, 0xf1, 0x7, 0xff, 0xff, 0xf7, 0x0,
-    0xbf, 0xff, 0xff, 0xf0, 0x1, 0xff, 0xff, 0xfd,
-    0x0, 0x3f, 0xff, 0xff, 0xa0, 0xd, 0xff, 0xff,
-    0xff, 0x10, 0x3f, 0xff, 0xff, 0x90, 0x0, 0xff,
-    0xff, 0xfc, 0x0, 0xff, 0xfe, 0xff, 0xf3, 0x6,
-    0xff, 0xff, 0xf5, 0x0, 0xb, 0xff, 0xff, 0xf0,
-    0xf, 0xff, 0xaf, 0xff, 0x50, 0x8f, 0xff, 0xff,
-    0x10, 0x0, 0x7f, 0xff, 0xff, 0x12, 0xff, 0xf7,
-    0xff, 0xf7, 0xa, 0xff, 0xff, 0xd0, 0x0, 0x2,
-    0xff, 0xff, 0xf3, 0x4f, 0xff, 0x4f, 0xff, 0x90,
-    0xdf, 0xff, 0xf8, 0x0, 0x0, 0xe, 0xff, 0xff,
-    0x66, 0xff, 0xf2, 0xdf, 0xfa, 0xf, 0xff, 0xff,
-    0x40, 0x0, 0x0, 0xaf, 0xff, 0xf8, 0x7f, 0xff,
-    0xc, 0xff, 0xc1, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x6, 0xff, 0xff, 0xa9, 0xff, 0xe0, 0xaf, 0xfe,
-    0x4f, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xfd, 0xbf, 0xfc, 0x8, 0xff, 0xf7, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0xef, 0xff, 0xfd, 0xff,
-    0xa0, 0x6f, 0xff, 0xbf, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0xff, 0xff, 0xf8, 0x4, 0xff,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xff, 0xff, 0xff, 0x70, 0x3f, 0xff, 0xff, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff,
-    0xf5, 0x1, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xff, 0xff, 0xff, 0x30, 0xf,
-    0xff, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0xff, 0xf1, 0x0, 0xdf, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff,
-    0xff, 0x0, 0xb, 0xff, 0xff, 0xfb, 0x0, 0x0,
-    0x0,
-
+    0xf, 0xff, 0x18, 0x1, 0xff, 0xfb, 0x0, 0x2c,
+    0xff, 0xe6, 0x4, 0x0, 0xe6, 0x0, 0x70, 0x7,
+    0x10, 0x4, 0x60, 0x1c, 0xe1, 0x80, 0x1c, 0x40,
+    0x2, 0x0, 0xe1, 0x0, 0x8, 0x7, 0x10, 0x82,
+    0x0, 0x76, 0x80, 0x18, 0x3, 0xc2, 0x4, 0x1,
+    0xc8, 0x0, 0x30, 0xe, 0x60, 0x1, 0x0, 0x4,
+    0x2, 0x20, 0x50, 0xe, 0xc0, 0x9, 0x0, 0x31,
+    0x80, 0x72, 0x0, 0x4c, 0x1c, 0x1, 0xc8, 0x1,
+    0x60, 0x7, 0x9, 0x0, 0x5a, 0x1, 0x10, 0x10,
+    0x6, 0x21, 0x0, 0x94, 0x3, 0x89, 0x80, 0x23,
+    0x0, 0xb8, 0x1c, 0x3, 0x28, 0x6, 0x21, 0x0,
+    0xca, 0x40, 0x13, 0x10, 0x0, 0xc0, 0x80, 0x36,
+    0x0, 0x72, 0x0, 0x6e, 0x10, 0x8, 0x84, 0x0,
+    0xc2, 0x1, 0xc8, 0x1, 0xd8, 0x1, 0x8b, 0x80,
+    0x2, 0xc, 0x0, 0x25, 0x0, 0xc6, 0x1, 0xe4,
+    0x0, 0xce, 0x40, 0x2, 0x2, 0x0, 0x9, 0x80,
+    0x64, 0x0, 0xf1, 0x8, 0x4, 0x4c, 0x0, 0x60,
+    0xe0, 0xb, 0x0, 0x36, 0x0, 0x7c, 0x80, 0x18,
+    0x80, 0x4, 0x4, 0x1, 0x20, 0x6, 0x40, 0xf,
+    0xbc, 0x3, 0xef, 0x7, 0x0, 0xf9, 0x0, 0x3f,
+    0x20, 0x7, 0xc4, 0x4, 0x1, 0xf6, 0x0, 0x7e,
+    0x12, 0x0, 0xf3, 0x0, 0x80, 0x7c, 0x80, 0x1f,
+    0xc8, 0x1, 0xe2, 0x0, 0x10, 0x7, 0x8c, 0x3,
+    0xfb, 0x0, 0x3c, 0x20, 0x6, 0x0, 0xe4, 0x0,
+    0xe0,
     /* U+0078 "x" */
-    0xd, 0xff, 0xff, 0xf6, 0x1, 0xff, 0xff, 0xf7,
-    0x0, 0x7f, 0xff, 0xff, 0x80, 0x4f, 0xff, 0xff,
-    0x10, 0x1, 0xff, 0xff, 0xfb, 0x8, 0xff, 0xff,
-    0xb0, 0x0, 0xb, 0xff, 0xff, 0xd0, 0xcf, 0xff,
-    0xf5, 0x0, 0x0, 0x5f, 0xff, 0xff, 0x1f, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0xff, 0xff, 0xf6, 0xff,
-    0xff, 0x90, 0x0, 0x0, 0x9, 0xff, 0xff, 0xdf,
-    0xff, 0xf3, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0xe, 0xff,
-    0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xff, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0xcf,
-    0xff, 0xfc, 0xff, 0xff, 0x70, 0x0, 0x0, 0x3f,
-    0xff, 0xfd, 0x8f, 0xff, 0xfd, 0x0, 0x0, 0x9,
-    0xff, 0xff, 0xa5, 0xff, 0xff, 0xf4, 0x0, 0x0,
-    0xff, 0xff, 0xf7, 0x2f, 0xff, 0xff, 0xa0, 0x0,
-    0x6f, 0xff, 0xff, 0x40, 0xff, 0xff, 0xff, 0x10,
-    0xd, 0xff, 0xff, 0xf1, 0xc, 0xff, 0xff, 0xf7,
-    0x3, 0xff, 0xff, 0xfe, 0x0, 0xaf, 0xff, 0xff,
-    0xe0, 0xaf, 0xff, 0xff, 0xb0, 0x7, 0xff, 0xff,
-    0xff, 0x40,
-
+    0xd, 0xff, 0xe6, 0x1, 0xff, 0xe7, 0x0, 0x50,
+    0x7, 0x70, 0x28, 0x7, 0x30, 0x1, 0x80, 0x38,
+    0xc3, 0x0, 0x32, 0x8, 0x0, 0x50, 0x3, 0x30,
+    0x20, 0x6, 0xe0, 0xd, 0xc0, 0x18, 0x84, 0xc0,
+    0x32, 0x80, 0x65, 0x0, 0xe7, 0x0, 0xcc, 0x1,
+    0xe6, 0x0, 0xd6, 0x1, 0xa8, 0x3, 0xd4, 0x1,
+    0x88, 0x2, 0x23, 0x0, 0xf1, 0x90, 0x7, 0xd4,
+    0x1, 0xf8, 0xc0, 0x3e, 0xd0, 0xf, 0x94, 0x40,
+    0x3e, 0x51, 0x0, 0xf4, 0x80, 0x63, 0x0, 0xcc,
+    0x1, 0xc6, 0x60, 0x8, 0x90, 0x3, 0x50, 0x7,
+    0x50, 0x6, 0x7d, 0x0, 0xc4, 0x80, 0x19, 0x80,
+    0x36, 0xb8, 0x7, 0x70, 0x4, 0xc0, 0x1c, 0x64,
+    0x1, 0xca, 0x20, 0xb, 0x0, 0xe5, 0x3, 0x0,
+    0xe6, 0x3, 0x20, 0xc, 0x22, 0x6, 0x0, 0xe9,
+    0x9, 0x0, 0xe5, 0x0, 0x68, 0x7, 0xa, 0x0,
     /* U+0079 "y" */
-    0x9f, 0xff, 0xff, 0xf0, 0x0, 0xaf, 0xff, 0xff,
-    0xa4, 0xff, 0xff, 0xff, 0x10, 0xc, 0xff, 0xff,
-    0xf6, 0xf, 0xff, 0xff, 0xf3, 0x0, 0xef, 0xff,
-    0xff, 0x20, 0xcf, 0xff, 0xff, 0x60, 0xf, 0xff,
-    0xff, 0xd0, 0x7, 0xff, 0xff, 0xf8, 0x2, 0xff,
-    0xff, 0xf9, 0x0, 0x3f, 0xff, 0xff, 0xa0, 0x5f,
-    0xff, 0xff, 0x50, 0x0, 0xef, 0xff, 0xfd, 0x7,
-    0xff, 0xff, 0xf1, 0x0, 0xa, 0xff, 0xff, 0xf0,
-    0x9f, 0xff, 0xfc, 0x0, 0x0, 0x6f, 0xff, 0xff,
-    0x1b, 0xff, 0xff, 0x80, 0x0, 0x1, 0xff, 0xff,
-    0xf3, 0xdf, 0xff, 0xf4, 0x0, 0x0, 0xd, 0xff,
-    0xff, 0x6f, 0xff, 0xff, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0xfa, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x4,
-    0xff, 0xff, 0xef, 0xff, 0xf7, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x4, 0x1, 0xcf, 0xff, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xff,
-    0xf3, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x4a, 0xdf,
-    0xea, 0x20, 0x0, 0x0, 0x0, 0x0,
-
+    0x9f, 0xff, 0x0, 0x55, 0xff, 0xd5, 0xa0, 0x1e,
+    0x10, 0x3, 0x0, 0x76, 0x20, 0x7, 0x88, 0x0,
+    0x40, 0x1c, 0x80, 0x60, 0x1c, 0xa0, 0x1, 0x0,
+    0xc4, 0x40, 0xb0, 0xe, 0xe0, 0x20, 0xe, 0x40,
+    0x2, 0x0, 0x71, 0x3, 0x80, 0x76, 0x0, 0xc,
+    0x40, 0x33, 0x81, 0x0, 0x72, 0x0, 0x48, 0x1,
+    0x88, 0x38, 0x3, 0x18, 0x80, 0x58, 0x1, 0xc2,
+    0x40, 0x19, 0x0, 0x33, 0x80, 0x71, 0x30, 0x6,
+    0xc0, 0xc, 0x24, 0x1, 0x94, 0x80, 0x32, 0x0,
+    0x72, 0x0, 0x6c, 0x0, 0xc8, 0x1, 0xed, 0x0,
+    0xc8, 0x1, 0xb0, 0x3, 0xc8, 0x1, 0x84, 0x3,
+    0x20, 0x7, 0xc6, 0x1, 0xf0, 0x98, 0x7, 0xd6,
+    0x1, 0xf2, 0x0, 0x7e, 0x40, 0xf, 0xb0, 0x3,
+    0xf1, 0x88, 0x7, 0x90, 0x3, 0xf9, 0x0, 0x38,
+    0x88, 0x1, 0xfc, 0x60, 0x1c, 0x80, 0x1f, 0xe4,
+    0x0, 0xed, 0x0, 0xfe, 0x32, 0x0, 0xe4, 0x0,
+    0xf2, 0x0, 0xf8, 0x7, 0x28, 0x7, 0xd1, 0xfc,
+    0x60, 0x1d, 0x20, 0x1f, 0xfc, 0x33, 0x30, 0x7,
+    0xff, 0xf, 0xc0, 0x3f, 0xf8, 0x74, 0x60, 0x1f,
+    0xa1, 0x48, 0x5, 0x75, 0x40, 0x3f,
     /* U+007A "z" */
-    0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x35,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x5f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x35, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x4b, 0xbb,
-    0xbb, 0xdf, 0xff, 0xff, 0xff, 0x30, 0x0, 0x0,
-    0xe, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x0, 0xa,
-    0xff, 0xff, 0xff, 0xe1, 0x0, 0x0, 0x5, 0xff,
-    0xff, 0xff, 0xf4, 0x0, 0x0, 0x1, 0xef, 0xff,
-    0xff, 0xf9, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xff,
-    0x40, 0x0, 0x0, 0x1e, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0xb, 0xff, 0xff, 0xff, 0xd0, 0x0,
-    0x0, 0x6, 0xff, 0xff, 0xff, 0xf3, 0x0, 0x0,
-    0x0, 0xef, 0xff, 0xff, 0xfe, 0xbb, 0xbb, 0xbb,
-    0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,
-
+    0x5f, 0xff, 0xfe, 0x7, 0x98, 0x7, 0xff, 0x84,
+    0x51, 0x38, 0x80, 0x3f, 0x25, 0xdf, 0x18, 0x7,
+    0x94, 0xc0, 0x3a, 0x84, 0x3, 0x86, 0xc0, 0x39,
+    0x54, 0x1, 0xea, 0x10, 0xc, 0x36, 0x1, 0xe6,
+    0x40, 0xe, 0xb1, 0x0, 0xe1, 0x90, 0xe, 0x55,
+    0x0, 0x7a, 0x80, 0x38, 0x6c, 0x3, 0xce, 0x80,
+    0x1d, 0x42, 0x1, 0xc5, 0x0, 0x1c, 0xc8, 0x1,
+    0xee, 0x0, 0xf4, 0x0, 0x78, 0x62, 0xef, 0xa8,
+    0x40, 0x3c, 0x28, 0x9f, 0x0, 0x7f, 0xf8, 0x40,
     /* U+007B "{" */
-    0x0, 0x0, 0x0, 0x0, 0x5a, 0xdf, 0xff, 0x10,
-    0x0, 0x0, 0x1, 0xbf, 0xff, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0xcf, 0xff, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0x5f, 0xff, 0xff, 0xff, 0xf1, 0x0, 0x0,
-    0x9, 0xff, 0xff, 0xfe, 0xbb, 0x10, 0x0, 0x0,
-    0xcf, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xff, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x2b, 0xef, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xff, 0xe2, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0xc1, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x48, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xff, 0xd5, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xf1, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0x9, 0xff, 0xff, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x47, 0x9a, 0xa1,
-
+    0x0, 0xfc, 0xb5, 0xbf, 0xf0, 0x80, 0x78, 0x6e,
+    0x94, 0x80, 0x3f, 0xda, 0x80, 0x1f, 0xf9, 0x4c,
+    0x3, 0xff, 0x80, 0x18, 0x1, 0xc2, 0x88, 0x0,
+    0xf2, 0x80, 0x66, 0xeb, 0xb0, 0x80, 0x71, 0x0,
+    0x6a, 0x0, 0xff, 0xe1, 0x8, 0x7, 0xf0, 0x80,
+    0x63, 0x0, 0xff, 0xe8, 0x88, 0x7, 0xff, 0x2c,
+    0x80, 0x30, 0x80, 0x7f, 0x30, 0x6, 0x20, 0xf,
+    0xee, 0x0, 0xca, 0x1, 0xf9, 0x94, 0x3, 0x68,
+    0x7, 0x15, 0xf4, 0x80, 0x63, 0x40, 0xe, 0x14,
+    0x10, 0xc, 0x3c, 0x1, 0xff, 0x8f, 0xc8, 0x3,
+    0xff, 0x1b, 0x80, 0x7f, 0xf0, 0xa5, 0x80, 0x3c,
+    0x76, 0xe0, 0x1d, 0x0, 0x1f, 0x24, 0x68, 0x6,
+    0x16, 0x0, 0xfc, 0x4e, 0x1, 0xb0, 0x3, 0xfa,
+    0xc0, 0x33, 0x0, 0x7f, 0x10, 0x6, 0x20, 0xf,
+    0xe1, 0x0, 0xc2, 0x1, 0xff, 0xd2, 0x10, 0xf,
+    0xfe, 0x60, 0x80, 0x63, 0x0, 0xfe, 0x30, 0xc,
+    0xc0, 0x1f, 0xcc, 0x1, 0xa5, 0x40, 0x3f, 0x18,
+    0x6, 0x2a, 0xff, 0x8, 0x7, 0x58, 0x7, 0xff,
+    0x8, 0xd8, 0x3, 0xff, 0x85, 0x30, 0x1, 0xff,
+    0xc2, 0x7f, 0xb8, 0x65, 0x50, 0x0,
     /* U+007C "|" */
-    0x5f, 0xff, 0xd5, 0xff, 0xfd, 0x5f, 0xff, 0xd5,
-    0xff, 0xfd, 0x5f, 0xff, 0xd5, 0xff, 0xfd, 0x5f,
-    0xff, 0xd5, 0xff, 0xfd, 0x5f, 0xff, 0xd5, 0xff,
-    0xfd, 0x5f, 0xff, 0xd5, 0xff, 0xfd, 0x5f, 0xff,
-    0xd5, 0xff, 0xfd, 0x5f, 0xff, 0xd5, 0xff, 0xfd,
-    0x5f, 0xff, 0xd5, 0xff, 0xfd, 0x5f, 0xff, 0xd5,
-    0xff, 0xfd, 0x5f, 0xff, 0xd5, 0xff, 0xfd, 0x5f,
-    0xff, 0xd5, 0xff, 0xfd, 0x5f, 0xff, 0xd5, 0xff,
-    0xfd, 0x5f, 0xff, 0xd5, 0xff, 0xfd, 0x5f, 0xff,
-    0xd5, 0xff, 0xfd, 0x5f, 0xff, 0xd5, 0xff, 0xfd,
-    0x5f, 0xff, 0xd5, 0xff, 0xfd, 0x5f, 0xff, 0xd5,
-    0xff, 0xfd,
-
+    0x5f, 0xfb, 0x40, 0x3f, 0xff, 0xe0, 0x1f, 0xff,
+    0xf0, 0xf, 0xfe, 0x68,
     /* U+007D "}" */
-    0x3f, 0xfe, 0xc9, 0x40, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xff, 0xc1, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xff, 0xff, 0x30, 0x0, 0x0, 0x2b, 0xbf,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xfe, 0x10,
-    0x0, 0x0, 0x1, 0xcf, 0xff, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0xbf, 0xff, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0xaf, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xc3, 0x10, 0x0, 0x0, 0x9,
-    0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x15, 0xef, 0xff, 0xf9, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xff, 0xff, 0x60, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xe5, 0x0, 0x0, 0x0, 0x2, 0xaa, 0x98,
-    0x30, 0x0, 0x0, 0x0, 0x0,
-
+    0x3f, 0xf7, 0x64, 0xa0, 0x7, 0xfc, 0x26, 0xd7,
+    0x82, 0x1, 0xff, 0xc0, 0x3, 0xa0, 0xf, 0xfe,
+    0x12, 0x18, 0x7, 0xa, 0x20, 0x3, 0xd6, 0x1,
+    0xc5, 0x76, 0xf4, 0x0, 0xc4, 0x1, 0xfd, 0xe0,
+    0x19, 0x80, 0x3f, 0x9c, 0x3, 0x8, 0x7, 0xff,
+    0x30, 0x40, 0x3f, 0xfa, 0x26, 0x1, 0x8c, 0x3,
+    0xf8, 0x40, 0x30, 0x80, 0x7f, 0x84, 0x3, 0x18,
+    0x7, 0xf2, 0x0, 0x68, 0x0, 0xfe, 0xf0, 0xc,
+    0x92, 0x1, 0xf9, 0x4c, 0x3, 0x37, 0xf0, 0x80,
+    0x7b, 0x4c, 0x3, 0x84, 0x3, 0xe1, 0xc2, 0x0,
+    0xff, 0xe0, 0x5, 0x90, 0x7, 0xfe, 0xa4, 0x0,
+    0xff, 0xc4, 0xa0, 0x18, 0xf3, 0x84, 0x3, 0xac,
+    0x3, 0x26, 0x18, 0x80, 0x78, 0x80, 0x37, 0x0,
+    0x7f, 0x28, 0x6, 0x40, 0xf, 0xe1, 0x0, 0xc2,
+    0x1, 0xf8, 0x40, 0x30, 0x80, 0x7f, 0xf0, 0x8c,
+    0x3, 0xf8, 0xc0, 0x3f, 0xf8, 0x42, 0x1, 0xff,
+    0xc2, 0x70, 0xc, 0x20, 0x1f, 0xc6, 0x1, 0x9c,
+    0x3, 0xe1, 0x59, 0x0, 0xc4, 0x1, 0xc7, 0xfd,
+    0x42, 0x1, 0xbc, 0x3, 0xff, 0x84, 0xe0, 0x1f,
+    0xfc, 0x0, 0x91, 0x0, 0xff, 0x86, 0x98, 0x3,
+    0xc2, 0xaa, 0x67, 0xce, 0x50, 0xf, 0x80,
     /* U+007E "~" */
-    0x0, 0x0, 0x0, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x18, 0xdf, 0xff, 0xc7,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x8, 0x7, 0xff,
-    0xff, 0xff, 0xff, 0xfa, 0x30, 0x0, 0x0, 0x3,
-    0xdf, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd,
-    0x74, 0x36, 0xbf, 0xff, 0xbf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf,
-    0xfa, 0x41, 0x14, 0x8e, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfb, 0xbc, 0x20, 0x0, 0x0, 0x0, 0x6c,
-    0xff, 0xff, 0xff, 0xfe, 0x50, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x39, 0xcf, 0xec, 0x71, 0x0
+    0x0, 0xf0, 0x80, 0x7f, 0xf1, 0x46, 0x37, 0xfb,
+    0xf1, 0xc4, 0x3, 0xfd, 0x0, 0xfc, 0xe4, 0x1,
+    0x1c, 0x75, 0x18, 0x7, 0x8f, 0x5e, 0x60, 0x3,
+    0xf9, 0x73, 0x5d, 0xd, 0xaf, 0x8, 0x8, 0x3,
+    0xff, 0x14, 0x5e, 0x4a, 0x0, 0x79, 0x6f, 0xb9,
+    0x6e, 0x20, 0x1f, 0xf2, 0x1, 0xed, 0x20, 0x89,
+    0x23, 0xa4, 0xc0, 0x3e, 0x1a, 0xbe, 0xc2, 0x0,
+    0xf9, 0xb3, 0xc, 0x60, 0x27, 0x1e, 0xa0,
+    0x0
 };
 
 
@@ -2699,99 +1459,99 @@ static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
     {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
     {.bitmap_index = 0, .adv_w = 163, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
     {.bitmap_index = 0, .adv_w = 187, .box_w = 8, .box_h = 27, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 108, .adv_w = 303, .box_w = 15, .box_h = 11, .ofs_x = 2, .ofs_y = 16},
-    {.bitmap_index = 191, .adv_w = 428, .box_w = 25, .box_h = 28, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 541, .adv_w = 300, .box_w = 17, .box_h = 32, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 813, .adv_w = 520, .box_w = 31, .box_h = 32, .ofs_x = 1, .ofs_y = -2},
-    {.bitmap_index = 1309, .adv_w = 347, .box_w = 21, .box_h = 27, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1593, .adv_w = 152, .box_w = 7, .box_h = 11, .ofs_x = 1, .ofs_y = 16},
-    {.bitmap_index = 1632, .adv_w = 273, .box_w = 11, .box_h = 36, .ofs_x = 5, .ofs_y = -9},
-    {.bitmap_index = 1830, .adv_w = 273, .box_w = 11, .box_h = 36, .ofs_x = 1, .ofs_y = -9},
-    {.bitmap_index = 2028, .adv_w = 300, .box_w = 15, .box_h = 13, .ofs_x = 2, .ofs_y = 14},
-    {.bitmap_index = 2126, .adv_w = 427, .box_w = 23, .box_h = 22, .ofs_x = 2, .ofs_y = 2},
-    {.bitmap_index = 2379, .adv_w = 187, .box_w = 8, .box_h = 15, .ofs_x = 2, .ofs_y = -10},
-    {.bitmap_index = 2439, .adv_w = 240, .box_w = 11, .box_h = 7, .ofs_x = 2, .ofs_y = 6},
-    {.bitmap_index = 2478, .adv_w = 187, .box_w = 7, .box_h = 7, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 2503, .adv_w = 240, .box_w = 14, .box_h = 31, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 2720, .adv_w = 326, .box_w = 20, .box_h = 27, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2990, .adv_w = 326, .box_w = 11, .box_h = 27, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 3139, .adv_w = 326, .box_w = 17, .box_h = 27, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 3369, .adv_w = 326, .box_w = 17, .box_h = 27, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 3599, .adv_w = 326, .box_w = 19, .box_h = 27, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3856, .adv_w = 326, .box_w = 16, .box_h = 26, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 4064, .adv_w = 326, .box_w = 18, .box_h = 27, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 4307, .adv_w = 326, .box_w = 17, .box_h = 26, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 4528, .adv_w = 326, .box_w = 19, .box_h = 27, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 4785, .adv_w = 326, .box_w = 19, .box_h = 27, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 5042, .adv_w = 187, .box_w = 7, .box_h = 19, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 5109, .adv_w = 187, .box_w = 8, .box_h = 29, .ofs_x = 2, .ofs_y = -10},
-    {.bitmap_index = 5225, .adv_w = 427, .box_w = 23, .box_h = 23, .ofs_x = 2, .ofs_y = 2},
-    {.bitmap_index = 5490, .adv_w = 427, .box_w = 23, .box_h = 13, .ofs_x = 2, .ofs_y = 6},
-    {.bitmap_index = 5640, .adv_w = 427, .box_w = 23, .box_h = 23, .ofs_x = 2, .ofs_y = 2},
-    {.bitmap_index = 5905, .adv_w = 287, .box_w = 16, .box_h = 27, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 6121, .adv_w = 512, .box_w = 30, .box_h = 34, .ofs_x = 1, .ofs_y = -7},
-    {.bitmap_index = 6631, .adv_w = 333, .box_w = 21, .box_h = 27, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 6915, .adv_w = 333, .box_w = 20, .box_h = 27, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 7185, .adv_w = 273, .box_w = 16, .box_h = 27, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 7401, .adv_w = 340, .box_w = 19, .box_h = 27, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 7658, .adv_w = 300, .box_w = 17, .box_h = 27, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 7888, .adv_w = 287, .box_w = 16, .box_h = 27, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 8104, .adv_w = 320, .box_w = 18, .box_h = 27, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 8347, .adv_w = 347, .box_w = 18, .box_h = 27, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 8590, .adv_w = 166, .box_w = 7, .box_h = 27, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 8685, .adv_w = 200, .box_w = 10, .box_h = 27, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 8820, .adv_w = 307, .box_w = 19, .box_h = 27, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 9077, .adv_w = 267, .box_w = 16, .box_h = 27, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 9293, .adv_w = 406, .box_w = 23, .box_h = 27, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 9604, .adv_w = 347, .box_w = 19, .box_h = 27, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 9861, .adv_w = 353, .box_w = 22, .box_h = 27, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 10158, .adv_w = 320, .box_w = 19, .box_h = 27, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 10415, .adv_w = 353, .box_w = 22, .box_h = 34, .ofs_x = 0, .ofs_y = -7},
-    {.bitmap_index = 10789, .adv_w = 320, .box_w = 19, .box_h = 27, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 11046, .adv_w = 293, .box_w = 17, .box_h = 27, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 11276, .adv_w = 307, .box_w = 19, .box_h = 27, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 11533, .adv_w = 333, .box_w = 19, .box_h = 27, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 11790, .adv_w = 326, .box_w = 21, .box_h = 27, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 12074, .adv_w = 433, .box_w = 27, .box_h = 27, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 12439, .adv_w = 333, .box_w = 21, .box_h = 27, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 12723, .adv_w = 320, .box_w = 20, .box_h = 27, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 12993, .adv_w = 314, .box_w = 18, .box_h = 27, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 13236, .adv_w = 246, .box_w = 8, .box_h = 36, .ofs_x = 6, .ofs_y = -9},
-    {.bitmap_index = 13380, .adv_w = 240, .box_w = 13, .box_h = 31, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 13582, .adv_w = 246, .box_w = 9, .box_h = 36, .ofs_x = 1, .ofs_y = -9},
-    {.bitmap_index = 13744, .adv_w = 374, .box_w = 20, .box_h = 16, .ofs_x = 2, .ofs_y = 12},
-    {.bitmap_index = 13904, .adv_w = 353, .box_w = 24, .box_h = 2, .ofs_x = -1, .ofs_y = -5},
-    {.bitmap_index = 13928, .adv_w = 213, .box_w = 9, .box_h = 6, .ofs_x = 1, .ofs_y = 21},
-    {.bitmap_index = 13955, .adv_w = 287, .box_w = 17, .box_h = 19, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 14117, .adv_w = 314, .box_w = 18, .box_h = 27, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 14360, .adv_w = 234, .box_w = 13, .box_h = 19, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 14484, .adv_w = 314, .box_w = 18, .box_h = 27, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 14727, .adv_w = 300, .box_w = 17, .box_h = 19, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 14889, .adv_w = 187, .box_w = 12, .box_h = 27, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 15051, .adv_w = 314, .box_w = 18, .box_h = 28, .ofs_x = 0, .ofs_y = -9},
-    {.bitmap_index = 15303, .adv_w = 307, .box_w = 17, .box_h = 27, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 15533, .adv_w = 166, .box_w = 8, .box_h = 27, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 15641, .adv_w = 166, .box_w = 10, .box_h = 36, .ofs_x = -1, .ofs_y = -9},
-    {.bitmap_index = 15821, .adv_w = 280, .box_w = 17, .box_h = 27, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 16051, .adv_w = 166, .box_w = 7, .box_h = 27, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 16146, .adv_w = 453, .box_w = 26, .box_h = 19, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 16393, .adv_w = 307, .box_w = 17, .box_h = 19, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 16555, .adv_w = 314, .box_w = 18, .box_h = 19, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 16726, .adv_w = 314, .box_w = 18, .box_h = 28, .ofs_x = 1, .ofs_y = -9},
-    {.bitmap_index = 16978, .adv_w = 314, .box_w = 18, .box_h = 28, .ofs_x = 0, .ofs_y = -9},
-    {.bitmap_index = 17230, .adv_w = 207, .box_w = 12, .box_h = 19, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 17344, .adv_w = 260, .box_w = 14, .box_h = 19, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 17477, .adv_w = 207, .box_w = 12, .box_h = 25, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 17627, .adv_w = 307, .box_w = 17, .box_h = 19, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 17789, .adv_w = 253, .box_w = 18, .box_h = 19, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 17960, .adv_w = 406, .box_w = 27, .box_h = 19, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 18217, .adv_w = 267, .box_w = 17, .box_h = 19, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 18379, .adv_w = 273, .box_w = 17, .box_h = 28, .ofs_x = 0, .ofs_y = -9},
-    {.bitmap_index = 18617, .adv_w = 267, .box_w = 15, .box_h = 19, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 18760, .adv_w = 249, .box_w = 15, .box_h = 38, .ofs_x = 0, .ofs_y = -11},
-    {.bitmap_index = 19045, .adv_w = 376, .box_w = 5, .box_h = 36, .ofs_x = 9, .ofs_y = -9},
-    {.bitmap_index = 19135, .adv_w = 249, .box_w = 15, .box_h = 38, .ofs_x = 0, .ofs_y = -11},
-    {.bitmap_index = 19420, .adv_w = 420, .box_w = 22, .box_h = 8, .ofs_x = 2, .ofs_y = 9}
+    {.bitmap_index = 78, .adv_w = 303, .box_w = 15, .box_h = 11, .ofs_x = 2, .ofs_y = 16},
+    {.bitmap_index = 123, .adv_w = 428, .box_w = 25, .box_h = 28, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 338, .adv_w = 300, .box_w = 17, .box_h = 32, .ofs_x = 1, .ofs_y = -3},
+    {.bitmap_index = 512, .adv_w = 520, .box_w = 31, .box_h = 32, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 861, .adv_w = 347, .box_w = 21, .box_h = 27, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1043, .adv_w = 152, .box_w = 7, .box_h = 11, .ofs_x = 1, .ofs_y = 16},
+    {.bitmap_index = 1066, .adv_w = 273, .box_w = 11, .box_h = 36, .ofs_x = 5, .ofs_y = -9},
+    {.bitmap_index = 1197, .adv_w = 273, .box_w = 11, .box_h = 36, .ofs_x = 1, .ofs_y = -9},
+    {.bitmap_index = 1332, .adv_w = 300, .box_w = 15, .box_h = 13, .ofs_x = 2, .ofs_y = 14},
+    {.bitmap_index = 1404, .adv_w = 427, .box_w = 23, .box_h = 22, .ofs_x = 2, .ofs_y = 2},
+    {.bitmap_index = 1450, .adv_w = 187, .box_w = 8, .box_h = 15, .ofs_x = 2, .ofs_y = -10},
+    {.bitmap_index = 1502, .adv_w = 240, .box_w = 11, .box_h = 7, .ofs_x = 2, .ofs_y = 6},
+    {.bitmap_index = 1512, .adv_w = 187, .box_w = 7, .box_h = 7, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 1534, .adv_w = 240, .box_w = 14, .box_h = 31, .ofs_x = 1, .ofs_y = -4},
+    {.bitmap_index = 1671, .adv_w = 326, .box_w = 20, .box_h = 27, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1855, .adv_w = 326, .box_w = 11, .box_h = 27, .ofs_x = 4, .ofs_y = 0},
+    {.bitmap_index = 1893, .adv_w = 326, .box_w = 17, .box_h = 27, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 2023, .adv_w = 326, .box_w = 17, .box_h = 27, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 2178, .adv_w = 326, .box_w = 19, .box_h = 27, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2277, .adv_w = 326, .box_w = 16, .box_h = 26, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 2385, .adv_w = 326, .box_w = 18, .box_h = 27, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2556, .adv_w = 326, .box_w = 17, .box_h = 26, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2668, .adv_w = 326, .box_w = 19, .box_h = 27, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2849, .adv_w = 326, .box_w = 19, .box_h = 27, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3025, .adv_w = 187, .box_w = 7, .box_h = 19, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 3073, .adv_w = 187, .box_w = 8, .box_h = 29, .ofs_x = 2, .ofs_y = -10},
+    {.bitmap_index = 3154, .adv_w = 427, .box_w = 23, .box_h = 23, .ofs_x = 2, .ofs_y = 2},
+    {.bitmap_index = 3307, .adv_w = 427, .box_w = 23, .box_h = 13, .ofs_x = 2, .ofs_y = 6},
+    {.bitmap_index = 3332, .adv_w = 427, .box_w = 23, .box_h = 23, .ofs_x = 2, .ofs_y = 2},
+    {.bitmap_index = 3485, .adv_w = 287, .box_w = 16, .box_h = 27, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3627, .adv_w = 512, .box_w = 30, .box_h = 34, .ofs_x = 1, .ofs_y = -7},
+    {.bitmap_index = 4059, .adv_w = 333, .box_w = 21, .box_h = 27, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4238, .adv_w = 333, .box_w = 20, .box_h = 27, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 4382, .adv_w = 273, .box_w = 16, .box_h = 27, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4519, .adv_w = 340, .box_w = 19, .box_h = 27, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 4654, .adv_w = 300, .box_w = 17, .box_h = 27, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 4700, .adv_w = 287, .box_w = 16, .box_h = 27, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 4736, .adv_w = 320, .box_w = 18, .box_h = 27, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 4887, .adv_w = 347, .box_w = 18, .box_h = 27, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 4927, .adv_w = 166, .box_w = 7, .box_h = 27, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 4939, .adv_w = 200, .box_w = 10, .box_h = 27, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4979, .adv_w = 307, .box_w = 19, .box_h = 27, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 5114, .adv_w = 267, .box_w = 16, .box_h = 27, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 5142, .adv_w = 406, .box_w = 23, .box_h = 27, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 5283, .adv_w = 347, .box_w = 19, .box_h = 27, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 5399, .adv_w = 353, .box_w = 22, .box_h = 27, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5600, .adv_w = 320, .box_w = 19, .box_h = 27, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 5698, .adv_w = 353, .box_w = 22, .box_h = 34, .ofs_x = 0, .ofs_y = -7},
+    {.bitmap_index = 5941, .adv_w = 320, .box_w = 19, .box_h = 27, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 6079, .adv_w = 293, .box_w = 17, .box_h = 27, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 6237, .adv_w = 307, .box_w = 19, .box_h = 27, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6275, .adv_w = 333, .box_w = 19, .box_h = 27, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 6354, .adv_w = 326, .box_w = 21, .box_h = 27, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6538, .adv_w = 433, .box_w = 27, .box_h = 27, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6811, .adv_w = 333, .box_w = 21, .box_h = 27, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6990, .adv_w = 320, .box_w = 20, .box_h = 27, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7103, .adv_w = 314, .box_w = 18, .box_h = 27, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 7209, .adv_w = 246, .box_w = 8, .box_h = 36, .ofs_x = 6, .ofs_y = -9},
+    {.bitmap_index = 7239, .adv_w = 240, .box_w = 13, .box_h = 31, .ofs_x = 1, .ofs_y = -4},
+    {.bitmap_index = 7371, .adv_w = 246, .box_w = 9, .box_h = 36, .ofs_x = 1, .ofs_y = -9},
+    {.bitmap_index = 7404, .adv_w = 374, .box_w = 20, .box_h = 16, .ofs_x = 2, .ofs_y = 12},
+    {.bitmap_index = 7514, .adv_w = 353, .box_w = 24, .box_h = 2, .ofs_x = -1, .ofs_y = -5},
+    {.bitmap_index = 7522, .adv_w = 213, .box_w = 9, .box_h = 6, .ofs_x = 1, .ofs_y = 21},
+    {.bitmap_index = 7545, .adv_w = 287, .box_w = 17, .box_h = 19, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7661, .adv_w = 314, .box_w = 18, .box_h = 27, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 7765, .adv_w = 234, .box_w = 13, .box_h = 19, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7848, .adv_w = 314, .box_w = 18, .box_h = 27, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7959, .adv_w = 300, .box_w = 17, .box_h = 19, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 8072, .adv_w = 187, .box_w = 12, .box_h = 27, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8129, .adv_w = 314, .box_w = 18, .box_h = 28, .ofs_x = 0, .ofs_y = -9},
+    {.bitmap_index = 8288, .adv_w = 307, .box_w = 17, .box_h = 27, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 8349, .adv_w = 166, .box_w = 8, .box_h = 27, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 8387, .adv_w = 166, .box_w = 10, .box_h = 36, .ofs_x = -1, .ofs_y = -9},
+    {.bitmap_index = 8456, .adv_w = 280, .box_w = 17, .box_h = 27, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 8551, .adv_w = 166, .box_w = 7, .box_h = 27, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 8563, .adv_w = 453, .box_w = 26, .box_h = 19, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 8654, .adv_w = 307, .box_w = 17, .box_h = 19, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 8711, .adv_w = 314, .box_w = 18, .box_h = 19, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 8836, .adv_w = 314, .box_w = 18, .box_h = 28, .ofs_x = 1, .ofs_y = -9},
+    {.bitmap_index = 8943, .adv_w = 314, .box_w = 18, .box_h = 28, .ofs_x = 0, .ofs_y = -9},
+    {.bitmap_index = 9060, .adv_w = 207, .box_w = 12, .box_h = 19, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 9099, .adv_w = 260, .box_w = 14, .box_h = 19, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 9200, .adv_w = 207, .box_w = 12, .box_h = 25, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 9267, .adv_w = 307, .box_w = 17, .box_h = 19, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 9316, .adv_w = 253, .box_w = 18, .box_h = 19, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 9434, .adv_w = 406, .box_w = 27, .box_h = 19, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 9627, .adv_w = 267, .box_w = 17, .box_h = 19, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 9747, .adv_w = 273, .box_w = 17, .box_h = 28, .ofs_x = 0, .ofs_y = -9},
+    {.bitmap_index = 9905, .adv_w = 267, .box_w = 15, .box_h = 19, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 9977, .adv_w = 249, .box_w = 15, .box_h = 38, .ofs_x = 0, .ofs_y = -11},
+    {.bitmap_index = 10135, .adv_w = 376, .box_w = 5, .box_h = 36, .ofs_x = 9, .ofs_y = -9},
+    {.bitmap_index = 10147, .adv_w = 249, .box_w = 15, .box_h = 38, .ofs_x = 0, .ofs_y = -11},
+    {.bitmap_index = 10314, .adv_w = 420, .box_w = 22, .box_h = 8, .ofs_x = 2, .ofs_y = 9}
 };
 
 /*---------------------
@@ -3168,7 +1928,7 @@ static lv_font_fmt_txt_dsc_t font_dsc = {
     .cmap_num = 1,
     .bpp = 4,
     .kern_classes = 0,
-    .bitmap_format = 0,
+    .bitmap_format = 1,
 #if LVGL_VERSION_MAJOR == 8
     .cache = &cache
 #endif
@@ -1,7 +1,7 @@
 /*******************************************************************************
  * Size: 44 px
  * Bpp: 4
- * Opts: --bpp 4 --size 44 --no-compress --font Abadi MT Std Cond Extra Bold.ttf --range 0-127 --format lvgl -o lv_font_abadi_44.c
+ * Opts: --bpp 4 --size 44 --font Abadi MT Std Cond Extra Bold.ttf --range 0-127 --format lvgl -o lv_font_abadi_44.c
  ******************************************************************************/
 #include "../../lvgl.h"
 
@@ -18,3186 +18,1632 @@
 /*Store the image of the glyphs*/
 static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
     /* U+0020 " " */
-
     /* U+0021 "!" */
-    0x3f, 0xff, 0xff, 0xff, 0x2, 0xff, 0xff, 0xff,
-    0xe0, 0x1f, 0xff, 0xff, 0xfd, 0x1, 0xff, 0xff,
-    0xff, 0xd0, 0xf, 0xff, 0xff, 0xfc, 0x0, 0xff,
-    0xff, 0xff, 0xb0, 0xf, 0xff, 0xff, 0xfb, 0x0,
-    0xef, 0xff, 0xff, 0xa0, 0xd, 0xff, 0xff, 0xf9,
-    0x0, 0xcf, 0xff, 0xff, 0x90, 0xc, 0xff, 0xff,
-    0xf8, 0x0, 0xbf, 0xff, 0xff, 0x70, 0xa, 0xff,
-    0xff, 0xf6, 0x0, 0xaf, 0xff, 0xff, 0x60, 0x9,
-    0xff, 0xff, 0xf5, 0x0, 0x8f, 0xff, 0xff, 0x40,
-    0x7, 0xff, 0xff, 0xf4, 0x0, 0x7f, 0xff, 0xff,
-    0x30, 0x6, 0xff, 0xff, 0xf2, 0x0, 0x5f, 0xff,
-    0xff, 0x10, 0x4, 0xee, 0xee, 0xe1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0x41, 0x0, 0x0,
-    0xa, 0xff, 0xf9, 0x0, 0x9, 0xff, 0xff, 0xf8,
-    0x0, 0xff, 0xff, 0xff, 0xe0, 0x2f, 0xff, 0xff,
-    0xff, 0x0, 0xef, 0xff, 0xff, 0xd0, 0x6, 0xff,
-    0xff, 0xf4, 0x0, 0x5, 0xcf, 0xc4, 0x0,
-
+    0x3f, 0xff, 0x80, 0x40, 0x3c, 0x20, 0x60, 0x1e,
+    0x30, 0xf, 0xf0, 0x80, 0x78, 0x40, 0x3f, 0x38,
+    0x7, 0xfc, 0x20, 0x1c, 0x20, 0x3, 0x0, 0xe3,
+    0x0, 0x8, 0x7, 0xff, 0x8, 0x40, 0xe, 0x1,
+    0xde, 0x0, 0x10, 0xe, 0x10, 0xf, 0xf8, 0xc0,
+    0x38, 0xc0, 0x2, 0x1, 0xc2, 0x0, 0xf0, 0xf,
+    0xfe, 0x13, 0x80, 0x4, 0x3, 0x84, 0x0, 0x60,
+    0x1c, 0x60, 0x1, 0x1f, 0x0, 0x49, 0xdd, 0xc2,
+    0x1, 0x89, 0x4, 0x3, 0xab, 0x6f, 0xa4, 0x2,
+    0x95, 0x0, 0x9a, 0x0, 0xc, 0x1, 0xcc, 0x4,
+    0x1, 0xe1, 0x2, 0x10, 0xe, 0x20, 0x4, 0x0,
+    0x74, 0x80, 0x1a, 0x8c, 0xe, 0xd0, 0x0,
     /* U+0022 "\"" */
-    0xaf, 0xff, 0xff, 0xe0, 0x0, 0xff, 0xff, 0xff,
-    0x8a, 0xff, 0xff, 0xfe, 0x0, 0xf, 0xff, 0xff,
-    0xf8, 0xaf, 0xff, 0xff, 0xe0, 0x0, 0xff, 0xff,
-    0xff, 0x8a, 0xff, 0xff, 0xfe, 0x0, 0xf, 0xff,
-    0xff, 0xf8, 0xaf, 0xff, 0xff, 0xe0, 0x0, 0xff,
-    0xff, 0xff, 0x8a, 0xff, 0xff, 0xfd, 0x0, 0xf,
-    0xff, 0xff, 0xf8, 0x7f, 0xff, 0xff, 0xb0, 0x0,
-    0xcf, 0xff, 0xff, 0x54, 0xff, 0xff, 0xf8, 0x0,
-    0x9, 0xff, 0xff, 0xf3, 0xf, 0xff, 0xff, 0x50,
-    0x0, 0x5f, 0xff, 0xff, 0x0, 0xdf, 0xff, 0xf3,
-    0x0, 0x2, 0xff, 0xff, 0xd0, 0xa, 0xff, 0xff,
-    0x0, 0x0, 0xf, 0xff, 0xfb, 0x0, 0x13, 0x33,
-    0x30, 0x0, 0x0, 0x23, 0x33, 0x10,
-
+    0xaf, 0xfe, 0xe0, 0xb, 0xff, 0xd0, 0x1, 0xff,
+    0xfe, 0x30, 0xf, 0xf6, 0x80, 0x73, 0x0, 0x46,
+    0x1, 0xda, 0x60, 0x1c, 0x60, 0x12, 0x80, 0x73,
+    0x20, 0x7, 0x68, 0x5, 0x80, 0x1c, 0x60, 0x40,
+    0x19, 0x80, 0x27, 0x0, 0xc4, 0x0, 0x70, 0xc,
+    0x60, 0x11, 0x0, 0x66, 0x0, 0x5e, 0x66, 0x0,
+    0xed, 0xcc, 0xa8, 0x0,
     /* U+0023 "#" */
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0x90, 0x0, 0x0, 0x0, 0xdf, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xf5, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0x20, 0x0, 0x0, 0x4,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xfb, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0xef, 0xff, 0x20, 0x0, 0x5f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xa5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x5f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xa5, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfa, 0x1, 0x11, 0x11, 0x9f, 0xff, 0x81,
-    0x11, 0x11, 0x11, 0xef, 0xff, 0x41, 0x11, 0x10,
-    0x0, 0x0, 0xb, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0x10, 0x0, 0x0, 0x4, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xff, 0x70, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xf1, 0x0, 0x0,
-    0x5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x5f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xa5, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfa, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x0,
-    0xc, 0xff, 0xf4, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xff, 0xf9, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0xef, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0xf3, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0x0, 0x0, 0x0, 0x6, 0xff,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x0,
-
+    0x0, 0xfe, 0xff, 0xc2, 0x1, 0xe6, 0xff, 0xa8,
+    0x3, 0xfc, 0x80, 0x11, 0x8, 0x7, 0xbc, 0x2,
+    0xd0, 0xf, 0xf1, 0x80, 0x48, 0x1, 0xf2, 0x0,
+    0x48, 0x1, 0xfe, 0xc0, 0xb, 0x0, 0x3e, 0x20,
+    0x8, 0xc0, 0x3f, 0xca, 0x1, 0x38, 0x7, 0x90,
+    0x2, 0x30, 0xf, 0xf1, 0x8, 0x0, 0x48, 0x3,
+    0xc6, 0x1, 0x28, 0x7, 0xf9, 0xc0, 0x25, 0x0,
+    0xfb, 0x0, 0x2c, 0x0, 0xff, 0x60, 0x5, 0x80,
+    0x1f, 0x28, 0x4, 0xe0, 0x12, 0xff, 0xf9, 0x80,
+    0x28, 0xff, 0xf8, 0x40, 0x2d, 0xff, 0x50, 0x7,
+    0xff, 0xfc, 0x3, 0xcb, 0xdd, 0xcc, 0x1, 0x3f,
+    0x77, 0xc2, 0x1, 0x5f, 0x75, 0x60, 0x23, 0xc4,
+    0x1, 0x60, 0x8f, 0x80, 0x40, 0x24, 0x11, 0xc0,
+    0x1e, 0x40, 0x9, 0x40, 0x3c, 0xa0, 0x11, 0x80,
+    0x7f, 0x88, 0x2, 0x11, 0x0, 0x78, 0xc0, 0x25,
+    0x0, 0xff, 0x38, 0x4, 0xa0, 0x1f, 0x68, 0x5,
+    0xe0, 0x1f, 0xed, 0x0, 0xb0, 0x3, 0xe7, 0x0,
+    0x94, 0x3, 0xfc, 0x80, 0x11, 0x0, 0x78, 0x48,
+    0x2, 0x20, 0xe, 0x5f, 0xfc, 0x60, 0x15, 0x7f,
+    0xfb, 0x80, 0x37, 0x7f, 0xea, 0x0, 0xff, 0xff,
+    0x80, 0x79, 0x7f, 0xe3, 0x0, 0xaf, 0xff, 0xe0,
+    0xd, 0xff, 0xea, 0x0, 0xc6, 0x1, 0x20, 0x7,
+    0x90, 0x2, 0x30, 0xf, 0xf1, 0x80, 0x44, 0x1,
+    0xf1, 0x80, 0x4a, 0x1, 0xfe, 0x50, 0x9, 0x0,
+    0x3e, 0xc0, 0xb, 0x0, 0x3f, 0xd8, 0x1, 0x78,
+    0x7, 0xca, 0x1, 0x38, 0x7, 0xf9, 0xc0, 0x25,
+    0x0, 0xf1, 0x8, 0x0, 0x48, 0x3, 0xf8, 0x48,
+    0x2, 0x30, 0xf, 0x20, 0x4, 0x80, 0x1f, 0xe5,
+    0x0, 0x8c, 0x3, 0xef, 0x0, 0xb4, 0x3, 0xf0,
     /* U+0024 "$" */
-    0x0, 0x0, 0x0, 0x2, 0x22, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xff, 0x52, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xcf, 0xff, 0xff, 0xff, 0x93, 0x0, 0x0,
-    0x0, 0x1b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5,
-    0x0, 0x0, 0x2e, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x60, 0x0, 0xc, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf6, 0x0, 0x6, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x60, 0x0, 0xdf, 0xff,
-    0xff, 0xfe, 0x51, 0x14, 0xbf, 0xf6, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0x20, 0x0, 0x0, 0x3e, 0x60,
-    0x2, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x14, 0x0, 0x2f, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff,
-    0xff, 0xf8, 0x10, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0xff, 0xff, 0xff, 0x82, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x10,
-    0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x30, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x2a,
-    0xff, 0xff, 0xff, 0xff, 0xfd, 0x10, 0x0, 0x0,
-    0x0, 0x2, 0x9f, 0xff, 0xff, 0xff, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2d, 0xff, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xff, 0xf3, 0x11, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0xff, 0xff, 0x22, 0xd2, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xf0, 0x2f,
-    0xf7, 0x0, 0x0, 0x1, 0xcf, 0xff, 0xff, 0xfc,
-    0x2, 0xff, 0xfe, 0xa7, 0x68, 0xef, 0xff, 0xff,
-    0xff, 0x60, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xd0, 0x2, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf3, 0x0, 0x2f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xe3, 0x0, 0x0, 0x9f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xb2, 0x0, 0x0,
-    0x0, 0x16, 0xbe, 0xff, 0xff, 0xf8, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xff, 0x0, 0x0, 0x0, 0x0,
-
+    0x0, 0xf8, 0x8b, 0x0, 0x7f, 0xf0, 0xff, 0x76,
+    0x0, 0xff, 0xed, 0x29, 0x0, 0x7f, 0xcb, 0x84,
+    0x1, 0x56, 0xfc, 0x98, 0x7, 0x86, 0xe8, 0xc0,
+    0x3e, 0x6c, 0x50, 0xc, 0x5e, 0x80, 0x1f, 0xf1,
+    0x80, 0x6e, 0x10, 0xf, 0xfe, 0x23, 0x18, 0x7,
+    0xff, 0x16, 0xc0, 0x3c, 0x35, 0xdc, 0xb4, 0x0,
+    0xe1, 0x20, 0xf, 0x62, 0x88, 0x92, 0xf0, 0x40,
+    0x23, 0x0, 0xf1, 0x90, 0x7, 0x1f, 0x90, 0x7,
+    0xff, 0x14, 0x50, 0x0, 0x40, 0x1e, 0x35, 0x0,
+    0xff, 0x8c, 0x3, 0xd5, 0x2, 0x1, 0xfd, 0x0,
+    0x1f, 0x3f, 0x41, 0x0, 0x7c, 0x8c, 0x1, 0xf9,
+    0xf6, 0x44, 0x3, 0xd2, 0x80, 0x1f, 0xcd, 0xe6,
+    0x1, 0xeb, 0x70, 0xf, 0xe1, 0xc3, 0x0, 0xf4,
+    0x6a, 0x80, 0x7f, 0x70, 0x80, 0x78, 0xab, 0x58,
+    0x3, 0xe2, 0x80, 0xf, 0xc5, 0x3a, 0x40, 0x1e,
+    0x70, 0xf, 0xf1, 0x78, 0x7, 0x84, 0x80, 0x3f,
+    0xc4, 0x60, 0x1e, 0x11, 0x80, 0x3f, 0xf8, 0x82,
+    0x78, 0x40, 0x1f, 0x9, 0x80, 0x78, 0x80, 0xb5,
+    0xc0, 0x38, 0x74, 0x3, 0xc6, 0x1, 0xa3, 0xa9,
+    0xda, 0x3c, 0xc0, 0x3d, 0x40, 0x1c, 0x2b, 0x12,
+    0xe2, 0x1, 0xe2, 0x60, 0xf, 0xfe, 0x2f, 0x0,
+    0x7f, 0xf1, 0x7, 0xc, 0x0, 0x4c, 0x1, 0xff,
+    0x26, 0x18, 0x6, 0x9e, 0x94, 0x10, 0xe, 0x7d,
+    0xb2, 0x0, 0xf0, 0xb5, 0xf7, 0x90, 0x5, 0x4,
+    0x1, 0xff, 0xe0,
     /* U+0025 "%" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x47, 0x77, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1c, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5b, 0xef, 0xec,
-    0x84, 0x0, 0x0, 0x0, 0x4, 0xdf, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff,
-    0xff, 0xff, 0xfb, 0x98, 0x8a, 0xdf, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0x50, 0x6f, 0xff, 0xff, 0xae, 0xfe,
-    0xcb, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0xfb, 0x0, 0xd, 0xff, 0xff, 0x20,
-    0x0, 0xa, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0xf7, 0x0, 0xa, 0xff, 0xff,
-    0x50, 0x0, 0x2f, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0xf5, 0x0, 0x8, 0xff,
-    0xff, 0x60, 0x0, 0x8f, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0xf6, 0x0, 0xa,
-    0xff, 0xff, 0x40, 0x0, 0xef, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xfa, 0x0,
-    0xd, 0xff, 0xff, 0x20, 0x6, 0xff, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0x40, 0x7f, 0xff, 0xfd, 0x0, 0xd, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf3, 0x0, 0x4f, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0x90, 0x0, 0xbf,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x2,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5b, 0xef, 0xea, 0x30, 0x0,
-    0x9, 0xff, 0xf7, 0x0, 0x0, 0x8d, 0xfe, 0xc7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xf1, 0x0, 0x3d, 0xff, 0xff,
-    0xff, 0xe3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xa0, 0x3, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0x30, 0xc, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0xfc, 0x0, 0x6f,
-    0xff, 0xfc, 0x11, 0xdf, 0xff, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xf5, 0x0,
-    0xbf, 0xff, 0xf3, 0x0, 0x6f, 0xff, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xe0,
-    0x0, 0xef, 0xff, 0xf0, 0x0, 0x1f, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
-    0x80, 0x0, 0xff, 0xff, 0xe0, 0x0, 0xf, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0x10, 0x0, 0xff, 0xff, 0xe0, 0x0, 0xf,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xfb, 0x0, 0x0, 0xef, 0xff, 0xf0, 0x0,
-    0x1f, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xff, 0xf4, 0x0, 0x0, 0xbf, 0xff, 0xf5,
-    0x0, 0x5f, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xd0, 0x0, 0x0, 0x5f, 0xff,
-    0xfd, 0x11, 0xdf, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xff, 0x60, 0x0, 0x0, 0xc,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x3d, 0xff, 0xff, 0xff, 0xd2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8d, 0xff, 0xc7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x67, 0x77,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0,
-
+    0x0, 0xff, 0xe5, 0x23, 0xbc, 0x80, 0x1f, 0xfd,
+    0x1, 0xb8, 0x89, 0xc0, 0x3f, 0xf9, 0xe3, 0xa0,
+    0x11, 0x98, 0x3, 0xfe, 0x5b, 0xef, 0xec, 0x84,
+    0x0, 0xf9, 0x30, 0xc0, 0x29, 0x0, 0xff, 0xaa,
+    0x88, 0x20, 0x26, 0xf7, 0xf7, 0x31, 0xa, 0xdb,
+    0x20, 0x8, 0x54, 0x3, 0xfd, 0xaa, 0x1, 0xfc,
+    0x8c, 0xee, 0x52, 0x0, 0xe6, 0x0, 0xff, 0x39,
+    0x0, 0x7f, 0xf2, 0x64, 0x3, 0xf8, 0x60, 0x3,
+    0x57, 0xc8, 0x7, 0x28, 0x80, 0x9a, 0x0, 0x4a,
+    0x20, 0x1f, 0xc8, 0x1, 0x91, 0x41, 0x88, 0x3,
+    0x47, 0x7f, 0x60, 0x80, 0x5c, 0x1, 0xfe, 0xd0,
+    0xd, 0x80, 0x13, 0x80, 0x67, 0x0, 0x89, 0x40,
+    0x4, 0x80, 0x1f, 0xe1, 0x0, 0xc4, 0x1, 0x10,
+    0x6, 0x30, 0xa, 0x80, 0x2b, 0x0, 0xff, 0x84,
+    0x3, 0x18, 0x4, 0x40, 0x18, 0x80, 0x26, 0x0,
+    0x98, 0x3, 0xfe, 0xd0, 0xd, 0x80, 0x13, 0x80,
+    0x66, 0x0, 0x30, 0x80, 0x18, 0x3, 0xff, 0x20,
+    0x6, 0x54, 0x7, 0x20, 0x8, 0x88, 0x0, 0xb0,
+    0xa, 0xc0, 0x3f, 0xf0, 0xc8, 0x6, 0xbf, 0x80,
+    0xd, 0xc0, 0x4, 0x20, 0x2, 0x10, 0x7, 0xff,
+    0x0, 0x18, 0xc0, 0x3f, 0x98, 0xc0, 0x1e, 0x1,
+    0x70, 0x7, 0xff, 0xf, 0x14, 0x3, 0xe7, 0x90,
+    0x1, 0x20, 0x0, 0x54, 0x3, 0xff, 0x89, 0x54,
+    0x41, 0x1, 0x5c, 0x80, 0xa, 0xc0, 0x29, 0x0,
+    0xd1, 0xbf, 0xd8, 0xe0, 0x1f, 0x96, 0xfb, 0xfa,
+    0x8c, 0x3, 0x30, 0x4, 0xc0, 0x3, 0xd7, 0x20,
+    0x13, 0x8e, 0x30, 0xf, 0xfe, 0x23, 0x0, 0x4a,
+    0x20, 0x78, 0x40, 0x1e, 0x1c, 0x20, 0xf, 0xfe,
+    0x1d, 0x80, 0x52, 0x0, 0xf0, 0xf, 0xf4, 0x80,
+    0x7f, 0xf0, 0x90, 0x80, 0x6, 0x60, 0x63, 0x0,
+    0x8f, 0xb8, 0x40, 0x12, 0x18, 0x7, 0xff, 0x0,
+    0x3c, 0x2, 0x90, 0x6, 0x80, 0x6f, 0x11, 0x58,
+    0x6, 0xa0, 0xf, 0xfc, 0x48, 0x0, 0x15, 0x0,
+    0x28, 0x6, 0x30, 0x3, 0x80, 0x62, 0x0, 0xff,
+    0xd6, 0x1, 0x30, 0x4, 0x20, 0x10, 0x80, 0x42,
+    0x1, 0x94, 0x3, 0xff, 0x30, 0x5, 0x20, 0x1f,
+    0xfc, 0x41, 0x0, 0xff, 0x9c, 0x2, 0x41, 0x0,
+    0x84, 0x2, 0x10, 0x8, 0x40, 0x31, 0x0, 0x7f,
+    0xd4, 0x1, 0x78, 0x6, 0x50, 0xc, 0xa0, 0x4,
+    0x0, 0xce, 0x1, 0xfe, 0x42, 0x0, 0x12, 0x0,
+    0x6e, 0x0, 0xd0, 0x22, 0x80, 0xd, 0xc0, 0x1f,
+    0xef, 0x0, 0xac, 0x3, 0x94, 0xc0, 0x22, 0xee,
+    0x10, 0x4, 0x88, 0x0, 0xfe, 0x24, 0x0, 0x98,
+    0x3, 0xde, 0x1, 0xfe, 0x90, 0xf, 0xf5, 0x80,
+    0x4c, 0x1, 0xf1, 0xe1, 0x0, 0x78, 0xb4, 0x80,
+    0x3f, 0x85, 0x80, 0x2b, 0x0, 0xfc, 0x7a, 0xe4,
+    0x0, 0x38, 0xd2, 0x0, 0xff, 0x30, 0x4, 0x84,
+    0x1, 0xfe, 0x8d, 0xff, 0x63, 0x80, 0x7f, 0xe1,
+    0x88, 0xc0, 0x1f, 0xfc, 0x90,
     /* U+0026 "&" */
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xad, 0xfe, 0xca,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1b,
-    0xff, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1e, 0xff, 0xff, 0xff, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff,
-    0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xfe,
-    0x63, 0x56, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0xff, 0xff, 0xd0, 0x1, 0x44,
-    0x44, 0x42, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff,
-    0xff, 0x50, 0x4f, 0xff, 0xff, 0x90, 0x0, 0x8,
-    0xff, 0xff, 0xff, 0xff, 0xfd, 0x4, 0xff, 0xff,
-    0xf9, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf6, 0x4f, 0xff, 0xff, 0x70, 0x4, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xe5, 0xff, 0xff, 0xf4,
-    0x0, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff,
-    0xcf, 0xff, 0xff, 0x20, 0x6f, 0xff, 0xff, 0xf4,
-    0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0xc,
-    0xff, 0xff, 0xff, 0x2, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf9, 0x0, 0xff, 0xff, 0xff, 0xc0, 0xa,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x30, 0x1f, 0xff,
-    0xff, 0xfb, 0x0, 0x2f, 0xff, 0xff, 0xff, 0xff,
-    0xc0, 0x1, 0xff, 0xff, 0xff, 0xe0, 0x0, 0xaf,
-    0xff, 0xff, 0xff, 0xf3, 0x0, 0xf, 0xff, 0xff,
-    0xff, 0x70, 0x3, 0xff, 0xff, 0xff, 0xfa, 0x0,
-    0x0, 0xcf, 0xff, 0xff, 0xff, 0x82, 0x1d, 0xff,
-    0xff, 0xff, 0xc0, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x30, 0x0,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfa, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x0, 0x0,
-    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x6e, 0xff, 0xff, 0xff,
-    0xfe, 0x5e, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x17, 0xce, 0xfe, 0xb6, 0x0, 0x8f, 0xff, 0xff,
-    0xf6,
-
+    0x0, 0xfe, 0x4a, 0xdf, 0xec, 0xa6, 0x0, 0xff,
+    0xe0, 0x0, 0xdd, 0x94, 0x80, 0x4d, 0x74, 0x3,
+    0xff, 0xf, 0xa0, 0x7, 0xff, 0x22, 0xc4, 0x3,
+    0xff, 0x90, 0x6a, 0x1, 0xff, 0xc9, 0x50, 0xf,
+    0xc, 0xe5, 0x68, 0x7, 0xfd, 0xe0, 0x1e, 0x86,
+    0x35, 0x60, 0xf, 0xf8, 0x40, 0x3c, 0xa0, 0x1f,
+    0xfc, 0x3d, 0x0, 0xf2, 0x80, 0x7f, 0xf0, 0xdc,
+    0x3, 0xd4, 0x1, 0xff, 0xc3, 0x22, 0x0, 0x71,
+    0xa8, 0x7, 0xff, 0xd, 0x0, 0x3d, 0x0, 0x1,
+    0x44, 0xe2, 0x0, 0xe6, 0x60, 0x7, 0x89, 0x41,
+    0x6e, 0xfc, 0x1, 0xa2, 0x40, 0x3f, 0x40, 0x7,
+    0xfc, 0xee, 0x0, 0xfe, 0x26, 0x0, 0xf7, 0x0,
+    0x12, 0x0, 0x3f, 0xe8, 0x10, 0xe, 0x30, 0x4,
+    0x80, 0x71, 0x0, 0x78, 0x64, 0x3, 0x98, 0x18,
+    0x80, 0x3a, 0x54, 0x3, 0xc6, 0x1, 0x84, 0x82,
+    0x80, 0x3c, 0x90, 0x1, 0xff, 0x38, 0x0, 0xc0,
+    0x38, 0xc0, 0x94, 0x3, 0xfd, 0x40, 0x20, 0x1e,
+    0x70, 0x4, 0x0, 0x7f, 0x19, 0x80, 0x3f, 0x28,
+    0x0, 0x94, 0x3, 0xf7, 0x80, 0x4, 0x3, 0xc2,
+    0xe0, 0x9, 0x0, 0xf9, 0x4c, 0x2, 0x30, 0xf,
+    0x44, 0x8, 0xa0, 0xf, 0x30, 0x6, 0xb0, 0xf,
+    0x9f, 0x78, 0x80, 0x3c, 0x66, 0x0, 0x98, 0x3,
+    0xff, 0x8d, 0x20, 0x10, 0xc8, 0x7, 0xff, 0x15,
+    0x44, 0x2, 0x67, 0x0, 0xff, 0xe2, 0xc8, 0x6,
+    0x89, 0x10, 0xf, 0x86, 0x84, 0x3, 0x9c, 0x3,
+    0x9b, 0xe0, 0xc4, 0x5, 0x27, 0x95, 0x80, 0x3c,
+    0xc0,
     /* U+0027 "'" */
-    0xf, 0xff, 0xff, 0xf8, 0xf, 0xff, 0xff, 0xf8,
-    0xf, 0xff, 0xff, 0xf8, 0xf, 0xff, 0xff, 0xf8,
-    0xf, 0xff, 0xff, 0xf8, 0xf, 0xff, 0xff, 0xf7,
-    0xd, 0xff, 0xff, 0xf5, 0xa, 0xff, 0xff, 0xf2,
-    0x7, 0xff, 0xff, 0xf0, 0x4, 0xff, 0xff, 0xd0,
-    0x1, 0xff, 0xff, 0xa0, 0x0, 0x33, 0x33, 0x10,
-
+    0xf, 0xff, 0x40, 0x7, 0xff, 0x6f, 0xc0, 0x80,
+    0x38, 0x81, 0xc0, 0x39, 0xc3, 0x40, 0x38, 0x80,
+    0xc0, 0x31, 0x0, 0x14, 0x3, 0x38, 0x0, 0x73,
+    0x35, 0x80,
     /* U+0028 "(" */
-    0x0, 0x0, 0xe, 0xff, 0xff, 0x70, 0x0, 0x0,
-    0x6f, 0xff, 0xff, 0x10, 0x0, 0x0, 0xdf, 0xff,
-    0xf9, 0x0, 0x0, 0x4, 0xff, 0xff, 0xf2, 0x0,
-    0x0, 0xc, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0x50, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0xfa, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xf1, 0x0, 0x0, 0xa, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0xe, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0x80, 0x0, 0x0, 0x4f, 0xff,
-    0xff, 0x50, 0x0, 0x0, 0x7f, 0xff, 0xff, 0x40,
-    0x0, 0x0, 0x8f, 0xff, 0xff, 0x30, 0x0, 0x0,
-    0xaf, 0xff, 0xff, 0x20, 0x0, 0x0, 0xaf, 0xff,
-    0xff, 0x10, 0x0, 0x0, 0xbf, 0xff, 0xff, 0x10,
-    0x0, 0x0, 0xbf, 0xff, 0xff, 0x10, 0x0, 0x0,
-    0xbf, 0xff, 0xff, 0x10, 0x0, 0x0, 0xbf, 0xff,
-    0xff, 0x10, 0x0, 0x0, 0xaf, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x9f, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0x40, 0x0, 0x0, 0x6f, 0xff,
-    0xff, 0x50, 0x0, 0x0, 0x4f, 0xff, 0xff, 0x70,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0x90, 0x0, 0x0,
-    0xd, 0xff, 0xff, 0xb0, 0x0, 0x0, 0xa, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xf6, 0x0, 0x0,
-    0x0, 0xbf, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x5f,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0x50, 0x0, 0x0, 0x9, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0,
-    0xbf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0x30, 0x0, 0x0, 0xb, 0xff, 0xff, 0xc0,
-
+    0x0, 0xee, 0xff, 0xce, 0x1, 0xcc, 0x20, 0x19,
+    0x80, 0x3a, 0xc0, 0x33, 0x8, 0x6, 0x42, 0x0,
+    0xd6, 0x1, 0xd0, 0x1, 0x90, 0x80, 0x30, 0x98,
+    0x6, 0xe0, 0xe, 0x60, 0xe, 0x50, 0xe, 0xa0,
+    0xc, 0xa0, 0x1c, 0x44, 0x0, 0xde, 0x1, 0xca,
+    0x1, 0xc8, 0x1, 0xda, 0x1, 0x84, 0x40, 0x1c,
+    0x80, 0x19, 0x40, 0x38, 0x44, 0x1, 0x8c, 0x3,
+    0x94, 0x3, 0xb4, 0x3, 0x8c, 0x3, 0x84, 0x3,
+    0xbc, 0x3, 0x9c, 0x3, 0x88, 0x3, 0x84, 0x3,
+    0xfe, 0x30, 0xe, 0x10, 0xf, 0xff, 0x18, 0x80,
+    0x71, 0x80, 0x71, 0x80, 0x7f, 0xdc, 0x1, 0xcc,
+    0x1, 0xc2, 0x1, 0xc2, 0x1, 0xc4, 0x1, 0xc4,
+    0x1, 0xca, 0x1, 0xdc, 0x1, 0xc2, 0x40, 0x18,
+    0x80, 0x3c, 0xe0, 0x19, 0x40, 0x3d, 0x80, 0x18,
+    0x48, 0x3, 0x9c, 0x3, 0x90, 0x3, 0x85, 0x0,
+    0x36, 0x0, 0x7b, 0x80, 0x32, 0x80, 0x79, 0x40,
+    0x39, 0x40, 0x3c, 0xc0, 0x1a, 0x40, 0x3d, 0x40,
+    0x18, 0xcc, 0x1, 0xc6, 0x80, 0x1a, 0x0, 0x3d,
+    0x0, 0x19, 0xc, 0x3, 0x8d, 0x0, 0x37, 0x80,
     /* U+0029 ")" */
-    0xb, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x4, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xfa,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0xe, 0xff, 0xff, 0x80, 0x0, 0x0, 0x8,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xf4, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xf9, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0x30, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0x70, 0x0, 0x0, 0xe, 0xff, 0xff, 0xa0,
-    0x0, 0x0, 0xb, 0xff, 0xff, 0xd0, 0x0, 0x0,
-    0x9, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xf3, 0x0, 0x0, 0x6, 0xff, 0xff, 0xf5,
-    0x0, 0x0, 0x5, 0xff, 0xff, 0xf6, 0x0, 0x0,
-    0x4, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x4, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x4, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x5, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x5, 0xff,
-    0xff, 0xf7, 0x0, 0x0, 0x6, 0xff, 0xff, 0xf6,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xf4, 0x0, 0x0,
-    0x8, 0xff, 0xff, 0xf2, 0x0, 0x0, 0xa, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xd0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xa0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0x70, 0x0, 0x0, 0x5f, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0x9f, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0xf8, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xf2, 0x0, 0x0, 0x8, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0xe, 0xff, 0xff, 0x60, 0x0,
-    0x0, 0x6f, 0xff, 0xfe, 0x0, 0x0, 0x0, 0xef,
-    0xff, 0xf7, 0x0, 0x0, 0x7, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0xe, 0xff, 0xff, 0x80, 0x0, 0x0,
-
+    0xb, 0xff, 0xd6, 0x1, 0xef, 0x0, 0xc8, 0x40,
+    0x1c, 0x86, 0x1, 0xa0, 0x3, 0xd2, 0x1, 0x94,
+    0x40, 0x39, 0x44, 0x3, 0x48, 0x7, 0x98, 0x3,
+    0x30, 0x7, 0xac, 0x3, 0xa, 0x0, 0x71, 0x90,
+    0x6, 0xd0, 0xf, 0x28, 0x6, 0x60, 0xf, 0x60,
+    0x7, 0x18, 0x7, 0x28, 0x7, 0x20, 0x7, 0x8,
+    0x80, 0x36, 0x80, 0x79, 0x40, 0x33, 0x80, 0x78,
+    0x80, 0x31, 0x8, 0x7, 0x70, 0x7, 0x10, 0x7,
+    0x8, 0x7, 0x30, 0x7, 0x18, 0x7, 0x18, 0x7,
+    0x8, 0x7, 0x8, 0x7, 0xfd, 0xe0, 0x1f, 0xfd,
+    0x11, 0x0, 0xef, 0x0, 0xff, 0xe2, 0x98, 0x7,
+    0x8, 0x7, 0x8, 0x7, 0x10, 0x7, 0x78, 0x7,
+    0x30, 0x7, 0x10, 0x7, 0x10, 0x7, 0x30, 0x6,
+    0x20, 0xf, 0x18, 0x6, 0x70, 0xe, 0x10, 0xe,
+    0xd0, 0xe, 0x40, 0xe, 0x50, 0xe, 0xc0, 0xc,
+    0x24, 0x1, 0xc8, 0x1, 0x98, 0x3, 0x8c, 0x80,
+    0x35, 0x0, 0x75, 0x80, 0x63, 0x20, 0xe, 0x60,
+    0xd, 0x40, 0x1c, 0xc2, 0x1, 0xb, 0x0, 0x74,
+    0x0, 0x69, 0x0, 0xe7, 0x10, 0xc, 0xe0, 0x1d,
+    0x20, 0x19, 0xc0, 0x38,
     /* U+002A "*" */
-    0x0, 0x0, 0x0, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x30,
-    0x0, 0xf, 0xfb, 0x0, 0x0, 0x30, 0x6f, 0xd8,
-    0x31, 0xff, 0xb0, 0x5a, 0xff, 0xb, 0xff, 0xff,
-    0xef, 0xff, 0xff, 0xff, 0xf6, 0x5b, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe9, 0x30, 0x1, 0x6b, 0xff,
-    0xff, 0xf9, 0x40, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xdf,
-    0xfc, 0x0, 0x0, 0x0, 0x1e, 0xff, 0x91, 0xef,
-    0xf8, 0x0, 0x0, 0xb, 0xff, 0xc0, 0x3, 0xff,
-    0xf4, 0x0, 0x0, 0x7f, 0xf2, 0x0, 0x7, 0xfd,
-    0x30, 0x0, 0x0, 0x34, 0x0, 0x0, 0x7, 0x0,
-    0x0,
-
+    0x0, 0xf7, 0xfa, 0xc0, 0x3f, 0xfb, 0x26, 0x1,
+    0xff, 0x18, 0x36, 0x6c, 0x18, 0x80, 0x65, 0xaf,
+    0xc0, 0xd0, 0x27, 0xcf, 0x0, 0x27, 0xd2, 0x80,
+    0x1b, 0x90, 0x2, 0x10, 0xf, 0xb, 0x2a, 0xaf,
+    0xa5, 0x0, 0x39, 0xaf, 0xa4, 0xc0, 0x2, 0xd8,
+    0x1, 0xd6, 0x80, 0x1e, 0x38, 0x0, 0x10, 0x3,
+    0x80, 0x3c, 0x3a, 0x0, 0x6c, 0x10, 0x38, 0x0,
+    0xea, 0x10, 0x39, 0x1d, 0x0, 0x3a, 0x0, 0x6c,
+    0x0, 0x70, 0x0, 0xe0, 0x9, 0xc0, 0x33, 0xe5,
+    0x90, 0x4, 0xf1, 0xa6, 0x0,
     /* U+002B "+" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x11, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x26, 0x66, 0x66,
-    0x66, 0x66, 0xbf, 0xff, 0xe6, 0x66, 0x66, 0x66,
-    0x66, 0x44, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x4f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xb4, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x4f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0,
-
+    0x0, 0xff, 0x84, 0x70, 0x7, 0xff, 0x21, 0xfb,
+    0xaf, 0x0, 0xff, 0xff, 0x80, 0x7f, 0xff, 0xc0,
+    0x3f, 0xfe, 0x4, 0xcd, 0xfd, 0x80, 0x19, 0x9b,
+    0xf9, 0x1a, 0x67, 0xf9, 0x0, 0x21, 0x99, 0xfe,
+    0xf0, 0xf, 0xff, 0xfa, 0x7f, 0xff, 0x40, 0x4,
+    0x3f, 0xff, 0xd6, 0x1, 0xff, 0xff, 0x0, 0xff,
+    0xff, 0x80, 0x7f, 0xff, 0xc0,
     /* U+002C "," */
-    0x0, 0x3, 0x64, 0x0, 0x0, 0xa, 0xff, 0xfd,
-    0x20, 0x8, 0xff, 0xff, 0xfd, 0x0, 0xdf, 0xff,
-    0xff, 0xf5, 0xf, 0xff, 0xff, 0xff, 0x80, 0xdf,
-    0xff, 0xff, 0xf9, 0x8, 0xff, 0xff, 0xff, 0x80,
-    0xb, 0xff, 0xff, 0xf6, 0x0, 0x5, 0xff, 0xff,
-    0x30, 0x0, 0x2f, 0xff, 0xe0, 0x0, 0x4, 0xff,
-    0xfa, 0x0, 0x0, 0x7f, 0xff, 0x40, 0x0, 0xa,
-    0xff, 0xd0, 0x0, 0x0, 0xff, 0xf6, 0x0, 0x0,
-    0x4f, 0xfe, 0x0, 0x0, 0x9, 0xff, 0x80, 0x0,
-    0x0, 0xef, 0xf1, 0x0, 0x0,
-
+    0x0, 0x8d, 0x90, 0x3, 0xab, 0x26, 0xf4, 0x80,
+    0x10, 0xa0, 0x11, 0x78, 0x1, 0x40, 0x38, 0x94,
+    0x8, 0x3, 0xda, 0x4, 0x1, 0xe1, 0x5, 0x0,
+    0xf0, 0x84, 0x20, 0x7, 0x70, 0x2, 0xe8, 0x3,
+    0x28, 0x4, 0xe0, 0x10, 0x98, 0x4, 0xc0, 0x12,
+    0x0, 0x63, 0x0, 0xb8, 0x3, 0x68, 0x0, 0x90,
+    0x3, 0x28, 0x2, 0xc0, 0x32, 0x0, 0x5, 0x80,
+    0x36, 0x80, 0x18, 0x3, 0x9c, 0x1, 0x20, 0x10,
     /* U+002D "-" */
-    0x5c, 0xcc, 0xcc, 0xcc, 0xcc, 0xcb, 0x6f, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x6f, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x6f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x6f, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x6f, 0xff, 0xff, 0xff,
-    0xff, 0xfe,
-
+    0x5c, 0xcf, 0xf5, 0x99, 0xff, 0xca, 0x1, 0xff,
+    0xf0,
     /* U+002E "." */
-    0x0, 0x3b, 0xda, 0x20, 0x3, 0xff, 0xff, 0xf2,
-    0xc, 0xff, 0xff, 0xfa, 0xf, 0xff, 0xff, 0xfc,
-    0xd, 0xff, 0xff, 0xfa, 0x5, 0xff, 0xff, 0xf3,
-    0x0, 0x5c, 0xfc, 0x30,
-
+    0x0, 0x1d, 0xed, 0x10, 0x0, 0xf1, 0x9, 0x74,
+    0x83, 0xc0, 0x3a, 0x0, 0xc0, 0x39, 0x80, 0x80,
+    0x39, 0x82, 0x0, 0x3a, 0x41, 0x68, 0xc0, 0xf0,
+    0xc0,
     /* U+002F "/" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-
+    0x0, 0xff, 0x7f, 0xe6, 0x0, 0xfe, 0x40, 0xc,
+    0xe0, 0x1f, 0xda, 0x1, 0x18, 0x80, 0x7f, 0x38,
+    0x4, 0x80, 0x1f, 0xc4, 0x20, 0x15, 0x80, 0x7f,
+    0x28, 0x4, 0x26, 0x1, 0xfd, 0x60, 0x12, 0x0,
+    0x7f, 0x8c, 0x2, 0xf0, 0xf, 0xe5, 0x0, 0xc8,
+    0x1, 0xfd, 0x80, 0x11, 0x88, 0x7, 0xf3, 0x80,
+    0x56, 0x1, 0xfc, 0x62, 0x1, 0x20, 0x7, 0xf2,
+    0x0, 0x42, 0x60, 0x1f, 0xd6, 0x1, 0x38, 0x7,
+    0xf0, 0x98, 0x5, 0x80, 0x1f, 0xc8, 0x1, 0x94,
+    0x3, 0xfb, 0xc0, 0x24, 0x0, 0xff, 0x20, 0x5,
+    0x80, 0x1f, 0xc6, 0x20, 0x12, 0x80, 0x7f, 0x58,
+    0x4, 0x24, 0x1, 0xfc, 0x80, 0x13, 0x80, 0x7f,
+    0x9, 0x80, 0x5a, 0x1, 0xfc, 0x80, 0x19, 0x0,
+    0x3f, 0xbc, 0x2, 0x40, 0xf, 0xf2, 0x0, 0x5a,
+    0x1, 0xfc, 0x62, 0x1, 0x20, 0x7, 0xf5, 0x80,
+    0x44, 0x40, 0xf, 0xe4, 0x0, 0x94, 0x3, 0xf8,
+    0x4c, 0x2, 0xc0, 0xf, 0xe7, 0x0, 0xc8, 0x1,
+    0xfd, 0x80, 0x12, 0x80, 0x7f, 0x94, 0x2, 0xc0,
+    0xf, 0xe4, 0x0, 0xce, 0x1, 0xfd, 0x80, 0x11,
+    0x8, 0x7, 0xf0,
     /* U+0030 "0" */
-    0x0, 0x0, 0x0, 0x28, 0xce, 0xfc, 0x94, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff,
-    0xff, 0xfc, 0x30, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x40, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x10, 0x0, 0xe, 0xff, 0xff,
-    0xff, 0x86, 0xcf, 0xff, 0xff, 0xf7, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0x50, 0x0, 0xdf, 0xff, 0xff,
-    0xd0, 0x0, 0xdf, 0xff, 0xff, 0xd0, 0x0, 0x6,
-    0xff, 0xff, 0xff, 0x40, 0x2f, 0xff, 0xff, 0xf7,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xf9, 0x6, 0xff,
-    0xff, 0xff, 0x40, 0x0, 0x0, 0xef, 0xff, 0xff,
-    0xc0, 0x9f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0xc,
-    0xff, 0xff, 0xff, 0xc, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0xff, 0xf2, 0xdf, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xff,
-    0x3e, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xf5, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0x6f, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xf6,
-    0xef, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0x5d, 0xff, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0xff, 0xf4, 0xbf, 0xff, 0xff,
-    0xf1, 0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0x39,
-    0xff, 0xff, 0xff, 0x30, 0x0, 0x0, 0xbf, 0xff,
-    0xff, 0xf0, 0x5f, 0xff, 0xff, 0xf5, 0x0, 0x0,
-    0xe, 0xff, 0xff, 0xfd, 0x1, 0xff, 0xff, 0xff,
-    0x90, 0x0, 0x1, 0xff, 0xff, 0xff, 0xa0, 0xd,
-    0xff, 0xff, 0xfd, 0x0, 0x0, 0x6f, 0xff, 0xff,
-    0xf4, 0x0, 0x7f, 0xff, 0xff, 0xf6, 0x0, 0xd,
-    0xff, 0xff, 0xfe, 0x0, 0x1, 0xff, 0xff, 0xff,
-    0xf8, 0x6c, 0xff, 0xff, 0xff, 0x70, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf3, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0xff, 0xff, 0xff, 0xe3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0x8b, 0xdf, 0xdb, 0x50,
-    0x0, 0x0, 0x0,
-
+    0x0, 0xf1, 0x46, 0x77, 0xe4, 0xa0, 0x7, 0xfe,
+    0x8d, 0x73, 0x10, 0x36, 0xbc, 0x30, 0xf, 0xec,
+    0x70, 0xf, 0xc7, 0x8a, 0x1, 0xf5, 0x18, 0x7,
+    0xfd, 0x48, 0x1, 0xcc, 0xa0, 0x1f, 0xfc, 0x0,
+    0xa1, 0x0, 0xd0, 0x1, 0xe7, 0x93, 0x0, 0xe1,
+    0x60, 0x9, 0xc4, 0x3, 0xaa, 0x1b, 0x8, 0x3,
+    0xa8, 0x2, 0xa0, 0xe, 0x25, 0x0, 0xac, 0x3,
+    0x89, 0x0, 0x88, 0x1, 0xd4, 0x1, 0x9c, 0x3,
+    0xda, 0x8, 0x1, 0xe3, 0x0, 0xc2, 0x20, 0xe,
+    0x50, 0xf0, 0xf, 0x30, 0x7, 0x10, 0x7, 0x18,
+    0x28, 0x7, 0x88, 0x3, 0x94, 0x3, 0xc4, 0x20,
+    0x1f, 0xf8, 0x40, 0x3c, 0x26, 0x1, 0xc2, 0x1,
+    0xef, 0x0, 0xf3, 0x8, 0x7, 0xff, 0x1c, 0xc0,
+    0x3f, 0xf9, 0x22, 0x1, 0xff, 0xc7, 0x33, 0x0,
+    0x70, 0x80, 0x7b, 0xc0, 0x3c, 0x2c, 0x1, 0xe1,
+    0x0, 0xe1, 0x0, 0xf3, 0x90, 0x7, 0x88, 0x3,
+    0x88, 0x3, 0xc7, 0x80, 0x1e, 0x60, 0xe, 0x50,
+    0xe, 0x20, 0x40, 0xf, 0x60, 0x6, 0x11, 0x0,
+    0x73, 0x80, 0x90, 0x7, 0x20, 0x6, 0x70, 0xf,
+    0x70, 0x2, 0x80, 0x38, 0x98, 0x2, 0xb0, 0xe,
+    0x14, 0x0, 0x30, 0x7, 0xa6, 0x1b, 0x8, 0x3,
+    0xa4, 0x2, 0x18, 0x0, 0xf3, 0xc9, 0x80, 0x70,
+    0xb8, 0x6, 0x73, 0x0, 0xff, 0xe0, 0x6, 0x80,
+    0x7b, 0x10, 0x3, 0xfe, 0xa3, 0x0, 0xfa, 0xdc,
+    0x3, 0xf0, 0xe2, 0x80, 0x7f, 0x47, 0x3a, 0x10,
+    0x12, 0x57, 0x18, 0x7,
     /* U+0031 "1" */
-    0x0, 0x0, 0x2, 0xcc, 0xcc, 0xc5, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x5, 0xff,
-    0xff, 0xf6, 0x0, 0x0, 0xa, 0xff, 0xff, 0xf6,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xf6, 0x0, 0x27,
-    0xff, 0xff, 0xff, 0xf6, 0x9f, 0xff, 0xff, 0xff,
-    0xff, 0xf6, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xf6,
-    0x9f, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x9f, 0xff,
-    0xff, 0xff, 0xff, 0xf6, 0x9f, 0xff, 0xff, 0xff,
-    0xff, 0xf6, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xf6,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xf6, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xf6, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xf6,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xf6, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xf6, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xf6,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xf6, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xf6, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xf6,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xf6, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xf6, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xf6,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xf6,
-
+    0x0, 0xe2, 0xcc, 0xe5, 0x0, 0xe1, 0x33, 0xf0,
+    0x7, 0x30, 0x7, 0xfd, 0xe0, 0x1f, 0xe3, 0x50,
+    0xf, 0xc4, 0xf8, 0x1, 0xf4, 0xfe, 0xc0, 0x7,
+    0xff, 0xb2, 0x7f, 0xee, 0x0, 0xff, 0xff, 0x80,
+    0x7f, 0xff, 0xc0, 0x3f, 0xfe, 0x20,
     /* U+0032 "2" */
-    0x0, 0x1, 0x59, 0xce, 0xfe, 0xd9, 0x40, 0x0,
-    0x0, 0x0, 0x2a, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc3, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf7, 0x0, 0x0, 0x6f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf4, 0x0, 0x6, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x0,
-    0x6f, 0xff, 0xec, 0xcf, 0xff, 0xff, 0xff, 0xff,
-    0x30, 0x6, 0xfc, 0x40, 0x0, 0x9, 0xff, 0xff,
-    0xff, 0xf7, 0x0, 0x56, 0x0, 0x0, 0x0, 0xc,
-    0xff, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xdf, 0xff, 0xff,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x2, 0xdf, 0xff,
-    0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x3, 0xef,
-    0xff, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x6, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0xff, 0xff, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x1, 0xef, 0xff, 0xff, 0xfd,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff,
-    0xfd, 0x10, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff,
-    0xff, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xff, 0xfe, 0x77, 0x77,
-    0x77, 0x77, 0x77, 0x70, 0xbf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x1c, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xcf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x1c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf1, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x10,
-
+    0x0, 0x85, 0x67, 0x3b, 0xfb, 0x65, 0x0, 0x3e,
+    0x2a, 0xea, 0x63, 0x10, 0x12, 0x6b, 0xc3, 0x0,
+    0xe4, 0x50, 0xf, 0xf1, 0xe3, 0x80, 0x7f, 0xf1,
+    0xa1, 0x0, 0x3f, 0xf8, 0xd2, 0x1, 0xf0, 0x99,
+    0x80, 0x3f, 0x11, 0x80, 0x63, 0xbe, 0xcc, 0x7b,
+    0x0, 0x7c, 0x80, 0x3, 0x9c, 0x40, 0xd, 0x26,
+    0x1, 0xee, 0x0, 0x2b, 0x0, 0x7d, 0x60, 0x1e,
+    0x10, 0xf, 0xfb, 0x80, 0x3d, 0xa0, 0x1f, 0xe1,
+    0x60, 0xf, 0x38, 0x7, 0xf0, 0xe0, 0x7, 0x90,
+    0x80, 0x3f, 0x16, 0x10, 0x7, 0xa0, 0x3, 0xf1,
+    0xe1, 0x0, 0x7a, 0x4c, 0x3, 0xe4, 0xc1, 0x0,
+    0xf3, 0xb0, 0x7, 0xcd, 0x60, 0x1f, 0x3c, 0x0,
+    0x7c, 0xd2, 0x1, 0xf4, 0xc0, 0x7, 0xc7, 0x20,
+    0x1f, 0x5b, 0x0, 0x7c, 0x3a, 0x1, 0xe2, 0xd4,
+    0x0, 0xfd, 0x22, 0x1, 0xc5, 0x84, 0x1, 0xfc,
+    0xc0, 0x1c, 0x38, 0x20, 0x1f, 0xca, 0x20, 0x1d,
+    0x62, 0x1, 0xfe, 0xd0, 0xf, 0x28, 0x7, 0xfc,
+    0x60, 0x1c, 0x2e, 0xff, 0xf0, 0x7, 0xc3, 0x11,
+    0xff, 0xb, 0x80, 0x7f, 0xff, 0xc0,
     /* U+0033 "3" */
-    0x0, 0x1, 0x58, 0xab, 0xa8, 0x51, 0x0, 0x0,
-    0x0, 0x0, 0x4b, 0xff, 0xff, 0xff, 0xff, 0xf9,
-    0x10, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x50, 0x0, 0x0, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x40, 0x0, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4,
-    0x0, 0xf, 0xfa, 0x41, 0x3, 0xcf, 0xff, 0xff,
-    0xff, 0x70, 0x0, 0xd3, 0x0, 0x0, 0x0, 0xdf,
-    0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0x5c, 0xff, 0xff, 0xff,
-    0x40, 0x0, 0x0, 0x4, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff,
-    0xff, 0xfc, 0x30, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0xff, 0xff, 0xff, 0x94, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x40, 0x0,
-    0x0, 0x4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x14, 0xcf, 0xff,
-    0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff,
-    0xf0, 0x7, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0xff, 0xfd, 0x0, 0xfd, 0x61, 0x0, 0x1, 0xaf,
-    0xff, 0xff, 0xff, 0xa0, 0xf, 0xff, 0xfe, 0xcd,
-    0xff, 0xff, 0xff, 0xff, 0xf4, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x20,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x30, 0x0, 0xa, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf9, 0x10, 0x0, 0x0, 0x1, 0x69, 0xde, 0xff,
-    0xdb, 0x71, 0x0, 0x0, 0x0,
-
+    0x0, 0x85, 0x62, 0xae, 0xa1, 0x44, 0x3, 0xf2,
+    0x5f, 0x53, 0xaa, 0x2b, 0xd7, 0x48, 0x80, 0x7a,
+    0xd0, 0x3, 0xf9, 0xb9, 0x40, 0x3f, 0xf8, 0xd4,
+    0x80, 0x1f, 0xfc, 0x6a, 0x0, 0xff, 0xe3, 0xa,
+    0x0, 0x72, 0xdf, 0x7e, 0x18, 0x7, 0xc6, 0x1,
+    0x16, 0x52, 0x8, 0x1e, 0x10, 0x7, 0xb8, 0x2,
+    0xd3, 0x0, 0xf5, 0x0, 0x78, 0x40, 0x3f, 0xef,
+    0x0, 0xf6, 0x80, 0x7f, 0xca, 0x1, 0xc2, 0xa0,
+    0x1f, 0x85, 0x70, 0x80, 0x3a, 0x80, 0x3c, 0x9f,
+    0xee, 0xa3, 0x0, 0xe9, 0x40, 0xf, 0xfe, 0x19,
+    0xe3, 0x0, 0x7f, 0xf1, 0x15, 0xc0, 0x3f, 0xf8,
+    0xad, 0x78, 0x80, 0x1f, 0xfc, 0x53, 0xb6, 0x0,
+    0xe4, 0xff, 0xba, 0xcc, 0x3, 0xd2, 0x40, 0x1f,
+    0x85, 0x31, 0x0, 0x3d, 0x60, 0x1f, 0xf4, 0x0,
+    0x79, 0x0, 0x3f, 0xe3, 0x0, 0xf1, 0x0, 0x7f,
+    0xc6, 0x1, 0xfc, 0xe0, 0x1f, 0xa0, 0x3, 0xc4,
+    0x0, 0x8d, 0x61, 0x0, 0x86, 0x90, 0x3, 0xce,
+    0x1, 0x14, 0xf7, 0x33, 0x79, 0x40, 0x3e, 0xe0,
+    0xf, 0x9, 0x90, 0x7, 0xe3, 0x40, 0xf, 0xfe,
+    0x20, 0xf0, 0x7, 0xff, 0x10, 0x74, 0x80, 0x25,
+    0x0, 0xff, 0x9b, 0xcc, 0x3, 0x57, 0x4b, 0x10,
+    0x80, 0x9, 0x23, 0xa4, 0x40, 0x30,
     /* U+0034 "4" */
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xcc, 0xcc, 0xcc,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1e, 0xff, 0xff, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0xd, 0xff, 0xff, 0x7d, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0xff, 0xd0, 0xdf, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf3,
-    0xd, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0xcf,
-    0xff, 0xf9, 0x0, 0xdf, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x7f, 0xff, 0xfe, 0x0, 0xd, 0xff, 0xff,
-    0xff, 0x0, 0x0, 0x2f, 0xff, 0xff, 0x50, 0x0,
-    0xdf, 0xff, 0xff, 0xf0, 0x0, 0xb, 0xff, 0xff,
-    0xb0, 0x0, 0xd, 0xff, 0xff, 0xff, 0x0, 0x0,
-    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x4d, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf4, 0xdf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4d,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf4, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xf0, 0x0,
-    0x0,
-
+    0x0, 0xfe, 0x1c, 0xcf, 0x58, 0x7, 0xff, 0x0,
+    0x28, 0xcf, 0xc8, 0x1, 0xff, 0x95, 0x0, 0x3f,
+    0xf8, 0xc3, 0x60, 0x1f, 0xfc, 0x7b, 0x10, 0xf,
+    0xfe, 0x32, 0x28, 0x7, 0xff, 0x1e, 0x80, 0x3f,
+    0xf8, 0xf2, 0x20, 0x1f, 0xfc, 0x63, 0x60, 0xf,
+    0xfe, 0x3f, 0x0, 0x68, 0x20, 0xf, 0xfe, 0x0,
+    0x41, 0x0, 0x44, 0xe0, 0x1f, 0xfc, 0x0, 0x37,
+    0x0, 0xdc, 0x1, 0xff, 0xc2, 0xf0, 0xc, 0xc6,
+    0x1, 0xff, 0xc0, 0x7, 0x30, 0x8, 0x64, 0x3,
+    0xff, 0x80, 0x5, 0x0, 0x1a, 0xc0, 0x3f, 0xf8,
+    0x52, 0x1, 0x91, 0x40, 0x3f, 0xf8, 0x4c, 0x1,
+    0x93, 0xff, 0x10, 0x7, 0xbf, 0xe4, 0x0, 0xff,
+    0xff, 0x80, 0x7f, 0x6f, 0xff, 0xf1, 0x0, 0x7b,
+    0xfe, 0x40, 0xf, 0xff, 0xf8, 0x7, 0xff, 0xf0,
     /* U+0035 "5" */
-    0x46, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x61,
-    0x0, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf4, 0x0, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf4, 0x0, 0xaf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf4, 0x0, 0xaf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf4, 0x0, 0xaf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf4, 0x0, 0xaf, 0xff,
-    0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xff, 0xff, 0xf2, 0x7c, 0xfd,
-    0x81, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xfe, 0xff,
-    0xff, 0xfe, 0x30, 0x0, 0xaf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf2, 0x0, 0xaf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfd, 0x0, 0xaf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0xaf,
-    0xff, 0xff, 0xfb, 0xbf, 0xff, 0xff, 0xff, 0xa0,
-    0x8d, 0xdd, 0xdd, 0x60, 0x9, 0xff, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xff, 0xff, 0xe0, 0x84, 0x0,
-    0x0, 0x0, 0xd, 0xff, 0xff, 0xff, 0xa0, 0xaf,
-    0xb3, 0x0, 0x1, 0xcf, 0xff, 0xff, 0xff, 0x50,
-    0xaf, 0xff, 0xec, 0xcf, 0xff, 0xff, 0xff, 0xfd,
-    0x0, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf5, 0x0, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x90, 0x0, 0xaf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf9, 0x0, 0x0, 0x5e, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x60, 0x0, 0x0, 0x0, 0x38, 0xce,
-    0xff, 0xda, 0x50, 0x0, 0x0, 0x0,
-
+    0x46, 0x6f, 0xfe, 0x10, 0x80, 0x3a, 0x67, 0xff,
+    0x84, 0xa0, 0x1f, 0xff, 0xf0, 0xf, 0x77, 0xff,
+    0xc8, 0x1, 0xff, 0xf3, 0x37, 0xcf, 0xd8, 0x10,
+    0xf, 0xfb, 0x20, 0xc0, 0x9f, 0xcc, 0x3, 0xfc,
+    0x20, 0x1c, 0x38, 0x40, 0x1f, 0xfc, 0x5f, 0x0,
+    0xff, 0xe2, 0x92, 0x80, 0x7e, 0x44, 0x0, 0x7d,
+    0xe0, 0x45, 0xe9, 0xbb, 0x30, 0x7, 0x90, 0x23,
+    0x77, 0x98, 0x1, 0x0, 0x1e, 0x10, 0xf, 0xf0,
+    0x88, 0x3, 0xc2, 0x1, 0xff, 0xd0, 0x10, 0xf,
+    0x8, 0x7, 0xf2, 0x80, 0x78, 0x42, 0x10, 0x3,
+    0xe8, 0x0, 0xf2, 0x1, 0x5d, 0x8c, 0x2, 0x1c,
+    0x20, 0xf, 0x78, 0x4, 0x99, 0xd9, 0x8e, 0x30,
+    0xf, 0x12, 0x80, 0x70, 0x99, 0x80, 0x3f, 0x40,
+    0x7, 0xff, 0x11, 0x94, 0x3, 0xff, 0x86, 0xd2,
+    0x1, 0x78, 0x80, 0x7f, 0xc, 0xc8, 0x3, 0x2f,
+    0x63, 0x98, 0x80, 0x9, 0x6b, 0x98, 0x3, 0x80,
     /* U+0036 "6" */
-    0x0, 0x0, 0x0, 0x0, 0x27, 0x9b, 0xb9, 0x73,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5c, 0xff, 0xff,
-    0xff, 0xff, 0xe5, 0x0, 0x0, 0x0, 0x9, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0,
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x0,
-    0x0, 0x9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf9, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf9, 0x0, 0x0, 0xcf, 0xff, 0xff,
-    0xff, 0xa3, 0x1, 0x5b, 0xf9, 0x0, 0x4, 0xff,
-    0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x37, 0x0,
-    0x9, 0xff, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xff, 0xff, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xfc,
-    0x2, 0xad, 0xfc, 0x70, 0x0, 0x0, 0x5f, 0xff,
-    0xff, 0xf8, 0x5f, 0xff, 0xff, 0xfd, 0x20, 0x0,
-    0x7f, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff,
-    0xe2, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfa, 0x0, 0x9f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x30, 0x9f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0,
-    0x8f, 0xff, 0xff, 0xff, 0xe3, 0x8, 0xff, 0xff,
-    0xff, 0xf0, 0x7f, 0xff, 0xff, 0xff, 0x30, 0x0,
-    0xdf, 0xff, 0xff, 0xf3, 0x6f, 0xff, 0xff, 0xf9,
-    0x0, 0x0, 0x9f, 0xff, 0xff, 0xf5, 0x4f, 0xff,
-    0xff, 0xf7, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xf6,
-    0xf, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x8f, 0xff,
-    0xff, 0xf5, 0xd, 0xff, 0xff, 0xfd, 0x0, 0x0,
-    0x9f, 0xff, 0xff, 0xf3, 0x8, 0xff, 0xff, 0xff,
-    0x30, 0x0, 0xef, 0xff, 0xff, 0xf0, 0x2, 0xff,
-    0xff, 0xff, 0xc1, 0x7, 0xff, 0xff, 0xff, 0xb0,
-    0x0, 0xbf, 0xff, 0xff, 0xfe, 0xdf, 0xff, 0xff,
-    0xff, 0x40, 0x0, 0x2f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x6, 0xef, 0xff, 0xff, 0xff, 0xd3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x17, 0xce, 0xfd,
-    0xa5, 0x0, 0x0, 0x0,
-
+    0x0, 0xfc, 0x4f, 0x37, 0x69, 0x73, 0x0, 0xff,
+    0x2e, 0x6c, 0x32, 0x21, 0xa3, 0x39, 0x40, 0x3e,
+    0x9a, 0x30, 0xf, 0xc3, 0x80, 0x1e, 0xb6, 0x0,
+    0xff, 0xe2, 0xca, 0x0, 0x7f, 0xf1, 0x4d, 0x80,
+    0x3f, 0xf8, 0xde, 0x1, 0xf2, 0xe7, 0xf5, 0x20,
+    0x7, 0x21, 0x80, 0x7a, 0xa8, 0x60, 0x2b, 0x79,
+    0xc0, 0x16, 0x80, 0x79, 0x94, 0x3, 0xc6, 0xe0,
+    0x13, 0x80, 0x7a, 0xc0, 0x3f, 0xe2, 0x10, 0xe,
+    0x32, 0x25, 0x6f, 0xe3, 0x80, 0x73, 0x80, 0x79,
+    0x17, 0x54, 0x80, 0xe3, 0x48, 0x2, 0x20, 0xf,
+    0x1d, 0x0, 0x78, 0xb0, 0x80, 0x1e, 0x1, 0xe4,
+    0x0, 0xfc, 0x30, 0x0, 0x10, 0xf, 0xfe, 0x22,
+    0x98, 0x7, 0xff, 0x1e, 0x0, 0x40, 0x3e, 0x1c,
+    0xf7, 0x0, 0xf2, 0x7, 0x80, 0x7d, 0xa6, 0x10,
+    0x40, 0x1e, 0x31, 0x0, 0xf3, 0x18, 0x4, 0x80,
+    0x1e, 0x62, 0x0, 0xf7, 0x0, 0x6e, 0x0, 0xf1,
+    0xa0, 0x7, 0xb8, 0x3, 0x78, 0x7, 0x8c, 0x8,
+    0x3, 0x90, 0x3, 0x8, 0x7, 0x98, 0x14, 0x3,
+    0x88, 0xc0, 0x27, 0x0, 0xf1, 0x85, 0x0, 0x7b,
+    0xc4, 0x1c, 0x40, 0x39, 0x0, 0x4, 0x80, 0x1c,
+    0x7f, 0xb0, 0x1, 0xef, 0x0, 0xa4, 0x3, 0xc2,
+    0x40, 0x1e, 0x34, 0x0, 0x8a, 0x0, 0x3f, 0xf8,
+    0x1, 0xc0, 0x1c, 0xee, 0x0, 0xff, 0xac, 0x80,
+    0x3d, 0x12, 0x20, 0x1f, 0x16, 0x20, 0x7, 0xe6,
+    0xf8, 0x31, 0x2, 0x5a, 0xd3, 0x0, 0xc0,
     /* U+0037 "7" */
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf7, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x73, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x71,
-    0x77, 0x77, 0x77, 0x77, 0x77, 0xcf, 0xff, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
-    0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0xff, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xff, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0,
-
+    0x3f, 0xff, 0xfe, 0x2b, 0x80, 0x7f, 0xff, 0xc0,
+    0xa2, 0x3f, 0xc6, 0x1, 0xe1, 0x13, 0xbf, 0xf8,
+    0x40, 0x3c, 0xe0, 0x1f, 0xe4, 0x20, 0xe, 0x51,
+    0x0, 0xff, 0x70, 0x7, 0xb8, 0x3, 0xfc, 0x2a,
+    0x1, 0xc2, 0x80, 0x1f, 0xe6, 0x0, 0xf3, 0x0,
+    0x7f, 0xd2, 0x1, 0xea, 0x0, 0xff, 0x20, 0x80,
+    0x72, 0x10, 0x7, 0xfb, 0xc0, 0x3d, 0xc0, 0x1f,
+    0xe1, 0x40, 0xf, 0x28, 0x7, 0xfa, 0x40, 0x3c,
+    0xc0, 0x1f, 0xf3, 0x0, 0x7a, 0x80, 0x3f, 0xca,
+    0x20, 0x1c, 0x46, 0x1, 0xfe, 0xe0, 0xf, 0x58,
+    0x7, 0xf8, 0x90, 0x3, 0xce, 0x1, 0xfe, 0xa0,
+    0xf, 0x28, 0x80, 0x7f, 0x98, 0x3, 0xdc, 0x1,
+    0xfe, 0x51, 0x0, 0xe1, 0x40, 0xf, 0xf7, 0x0,
+    0x79, 0x80, 0x3f, 0xc4, 0x80, 0x1e, 0xa0, 0xf,
+    0xf5, 0x0, 0x79, 0x8, 0x3, 0xfc, 0xc0, 0x1e,
+    0xe0, 0xf, 0xf2, 0x88, 0x7, 0xa, 0x80, 0x7f,
+    0xa4, 0x3, 0xce, 0x1, 0xfc,
     /* U+0038 "8" */
-    0x0, 0x0, 0x0, 0x29, 0xde, 0xfd, 0xa7, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0x9f, 0xff, 0xff,
-    0xff, 0xff, 0x81, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xd1, 0x0, 0x0,
-    0x1, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x50, 0x0, 0xf, 0xff, 0xff,
-    0xff, 0xa5, 0xbf, 0xff, 0xff, 0xfa, 0x0, 0x3,
-    0xff, 0xff, 0xff, 0xb0, 0x0, 0xdf, 0xff, 0xff,
-    0xc0, 0x0, 0x5f, 0xff, 0xff, 0xf7, 0x0, 0x9,
-    0xff, 0xff, 0xfc, 0x0, 0x5, 0xff, 0xff, 0xff,
-    0x70, 0x0, 0xaf, 0xff, 0xff, 0x90, 0x0, 0x2f,
-    0xff, 0xff, 0xfc, 0x0, 0xe, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0xef, 0xff, 0xff, 0xf6, 0x7, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0xf9, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0xc,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x1d, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x1c, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x0,
-    0x0, 0x1b, 0xff, 0xff, 0xfc, 0xdf, 0xff, 0xff,
-    0xff, 0x90, 0x0, 0x1d, 0xff, 0xff, 0xfa, 0x0,
-    0x9f, 0xff, 0xff, 0xff, 0x30, 0xa, 0xff, 0xff,
-    0xfb, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xfb, 0x4,
-    0xff, 0xff, 0xff, 0x20, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0xf0, 0x9f, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0xe, 0xff, 0xff, 0xff, 0x2b, 0xff, 0xff, 0xfd,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xf2, 0xbf,
-    0xff, 0xff, 0xf1, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0xff, 0x8, 0xff, 0xff, 0xff, 0xa0, 0x0, 0xa,
-    0xff, 0xff, 0xff, 0xd0, 0x3f, 0xff, 0xff, 0xff,
-    0xc6, 0x6c, 0xff, 0xff, 0xff, 0xf7, 0x0, 0xbf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x0, 0x1, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x40, 0x0, 0x1, 0xdf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x8f, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x16, 0xad, 0xff, 0xec, 0x82,
-    0x0, 0x0, 0x0,
-
+    0x0, 0xf1, 0x4e, 0xf7, 0xed, 0x38, 0x80, 0x7f,
+    0x86, 0x75, 0x88, 0x40, 0x96, 0x3a, 0x4, 0x3,
+    0xe3, 0xe6, 0x0, 0xfe, 0x7c, 0x10, 0xe, 0x1d,
+    0x0, 0xff, 0xc5, 0xa0, 0x1d, 0x2, 0x1, 0xff,
+    0xc0, 0x3, 0x50, 0xc, 0xc0, 0x1e, 0x5a, 0x40,
+    0xf, 0x78, 0x4, 0x60, 0x1e, 0x4a, 0x5b, 0x20,
+    0xe, 0x60, 0x9, 0x80, 0x3d, 0x80, 0x12, 0x0,
+    0x7f, 0xf2, 0xc, 0x3, 0x94, 0x2, 0x70, 0xf,
+    0x58, 0x4, 0x80, 0x1d, 0x60, 0x11, 0x8, 0x7,
+    0x1b, 0x3, 0x88, 0x6, 0x72, 0x0, 0xd2, 0x1,
+    0xe9, 0x94, 0x0, 0x65, 0x80, 0xe, 0x73, 0x0,
+    0xf3, 0x0, 0x67, 0xa0, 0xf, 0xb4, 0x80, 0x3f,
+    0x86, 0xc0, 0x3f, 0xe, 0x18, 0x7, 0xe1, 0xc8,
+    0x0, 0xfc, 0xe6, 0x1, 0xfe, 0x7a, 0x0, 0xe1,
+    0xb9, 0x0, 0xc6, 0x40, 0x1e, 0x59, 0x0, 0x87,
+    0x10, 0x3, 0x2e, 0x6b, 0x0, 0x79, 0x8c, 0x1,
+    0x64, 0x1, 0x92, 0x80, 0x12, 0xa0, 0x1e, 0x80,
+    0x45, 0x0, 0xe9, 0x0, 0xd6, 0x1, 0xe4, 0xd,
+    0x0, 0xe1, 0x20, 0xc, 0x22, 0x0, 0xf1, 0x10,
+    0x3, 0x8c, 0x3, 0xc6, 0x1, 0xff, 0xc0, 0x2,
+    0x10, 0xc, 0x24, 0x1, 0xe2, 0x30, 0xf, 0x58,
+    0x6, 0xb0, 0xf, 0x10, 0x58, 0x7, 0x97, 0x19,
+    0x98, 0xa0, 0x1e, 0xa0, 0x34, 0x0, 0xf1, 0xcc,
+    0x8c, 0x3, 0xc2, 0xe0, 0xa, 0x10, 0xf, 0xfe,
+    0x1d, 0x0, 0x43, 0xe4, 0x1, 0xff, 0xc0, 0xb,
+    0x40, 0xc, 0x3a, 0xe0, 0x1f, 0xe4, 0xd4, 0x0,
+    0xfa, 0x3a, 0x54, 0x80, 0x2, 0x6f, 0xb6, 0x40,
+    0x18,
     /* U+0039 "9" */
-    0x0, 0x0, 0x0, 0x49, 0xab, 0x95, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4e, 0xff, 0xff, 0xff,
-    0xe6, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x8f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x60, 0x0, 0xc, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xe1, 0x0, 0x3f, 0xff, 0xff, 0xff,
-    0x41, 0xaf, 0xff, 0xff, 0xf7, 0x0, 0x8f, 0xff,
-    0xff, 0xf6, 0x0, 0xd, 0xff, 0xff, 0xfd, 0x0,
-    0xcf, 0xff, 0xff, 0xf1, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0x30, 0xef, 0xff, 0xff, 0xf0, 0x0, 0x3,
-    0xff, 0xff, 0xff, 0x60, 0xff, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xa0, 0xef, 0xff,
-    0xff, 0xf0, 0x0, 0x2, 0xff, 0xff, 0xff, 0xd0,
-    0xdf, 0xff, 0xff, 0xf4, 0x0, 0xc, 0xff, 0xff,
-    0xff, 0xe0, 0x9f, 0xff, 0xff, 0xfd, 0x10, 0x9f,
-    0xff, 0xff, 0xff, 0xf0, 0x4f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xc, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0x4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x0, 0xaf, 0xff, 0xff, 0xff, 0xfb,
-    0xff, 0xff, 0xff, 0xe0, 0x0, 0x9, 0xff, 0xff,
-    0xff, 0xb2, 0xff, 0xff, 0xff, 0xd0, 0x0, 0x0,
-    0x4b, 0xef, 0xc5, 0x4, 0xff, 0xff, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0x20, 0x2, 0x50, 0x0, 0x0,
-    0x0, 0xbf, 0xff, 0xff, 0xfc, 0x0, 0x2, 0xfb,
-    0x30, 0x0, 0x2b, 0xff, 0xff, 0xff, 0xf6, 0x0,
-    0x2, 0xff, 0xfe, 0xcd, 0xff, 0xff, 0xff, 0xff,
-    0xd0, 0x0, 0x2, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x30, 0x0, 0x2, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x2, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd3, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0x9c, 0xef, 0xec, 0x93,
-    0x0, 0x0, 0x0, 0x0,
-
+    0x0, 0xf2, 0x4d, 0x5c, 0xa8, 0x7, 0xfe, 0x4e,
+    0xb6, 0x54, 0x6a, 0xe6, 0x0, 0xfe, 0x8b, 0x10,
+    0xf, 0xc, 0xd0, 0x7, 0xd0, 0xe0, 0x1f, 0xe5,
+    0xa0, 0xe, 0x37, 0x0, 0xff, 0xca, 0xc0, 0x1b,
+    0xc0, 0x3f, 0xf8, 0x50, 0x20, 0x3, 0x30, 0x7,
+    0xaf, 0x94, 0x3, 0x85, 0x80, 0x16, 0x1, 0xe9,
+    0x41, 0xa2, 0x0, 0xea, 0x0, 0x20, 0x7, 0x9c,
+    0x2, 0xa0, 0xe, 0x23, 0x2, 0x0, 0xf0, 0x80,
+    0x48, 0x1, 0xe5, 0x1, 0x0, 0xe1, 0x0, 0xc6,
+    0x1, 0xec, 0x1, 0x0, 0xe1, 0x0, 0xc4, 0x1,
+    0xe7, 0x3, 0x0, 0xf2, 0x0, 0x5c, 0x1, 0xe3,
+    0x4, 0x0, 0xf4, 0x88, 0x49, 0x80, 0x78, 0x43,
+    0x40, 0x3c, 0x5d, 0xec, 0x1, 0xfc, 0x86, 0x1,
+    0xff, 0xc7, 0x80, 0xf, 0xfe, 0x3a, 0x28, 0x7,
+    0xe4, 0x0, 0xf0, 0x80, 0x54, 0xc0, 0x1e, 0x49,
+    0x0, 0xf1, 0x80, 0x69, 0xb4, 0x10, 0x3a, 0xb6,
+    0x0, 0xf3, 0x80, 0x72, 0x5f, 0x7e, 0x28, 0x70,
+    0x7, 0xb0, 0x3, 0xfe, 0x15, 0x0, 0xf2, 0x0,
+    0x9, 0x40, 0x3e, 0xa0, 0xf, 0x19, 0x0, 0x55,
+    0x66, 0x1, 0x15, 0xa0, 0x7, 0xa8, 0x3, 0x93,
+    0x3b, 0x37, 0x48, 0x1, 0xe2, 0x60, 0xf, 0x84,
+    0xc8, 0x3, 0xf7, 0x0, 0x7f, 0xf1, 0xa4, 0xc0,
+    0x3f, 0xf8, 0xb0, 0xc0, 0x1f, 0xfc, 0x42, 0xc7,
+    0x0, 0xf1, 0x7d, 0x31, 0x88, 0x9, 0xb6, 0x69,
+    0x80, 0x78,
     /* U+003A ":" */
-    0x0, 0x5d, 0xfb, 0x30, 0x5, 0xff, 0xff, 0xf3,
-    0xc, 0xff, 0xff, 0xfa, 0xf, 0xff, 0xff, 0xfc,
-    0xc, 0xff, 0xff, 0xf9, 0x3, 0xff, 0xff, 0xf2,
-    0x0, 0x3a, 0xda, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3b, 0xda, 0x20, 0x3, 0xff, 0xff, 0xf2,
-    0xc, 0xff, 0xff, 0xfa, 0xf, 0xff, 0xff, 0xfc,
-    0xd, 0xff, 0xff, 0xfa, 0x5, 0xff, 0xff, 0xf3,
-    0x0, 0x5c, 0xfc, 0x30,
-
+    0x0, 0x2e, 0xfd, 0x98, 0x1, 0x68, 0x81, 0x30,
+    0xc2, 0x40, 0x3a, 0x40, 0xc0, 0x39, 0x80, 0xc0,
+    0x39, 0x43, 0xc0, 0x3a, 0xc0, 0xf1, 0x49, 0x74,
+    0x80, 0x7, 0x5b, 0x44, 0x1, 0xff, 0xe7, 0x3b,
+    0xda, 0x20, 0x1, 0xe2, 0x12, 0xe9, 0x7, 0x80,
+    0x74, 0x1, 0x80, 0x73, 0x1, 0x0, 0x73, 0x4,
+    0x0, 0x74, 0x82, 0xd1, 0x81, 0xe1, 0x80,
     /* U+003B ";" */
-    0x0, 0x3a, 0xc9, 0x10, 0x0, 0x3f, 0xff, 0xff,
-    0x20, 0xc, 0xff, 0xff, 0xfa, 0x0, 0xff, 0xff,
-    0xff, 0xc0, 0xd, 0xff, 0xff, 0xfa, 0x0, 0x5f,
-    0xff, 0xff, 0x30, 0x0, 0x5c, 0xfc, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x25, 0x30, 0x0,
-    0x0, 0xaf, 0xff, 0xd2, 0x0, 0x7f, 0xff, 0xff,
-    0xd0, 0xd, 0xff, 0xff, 0xff, 0x40, 0xff, 0xff,
-    0xff, 0xf7, 0xe, 0xff, 0xff, 0xff, 0x90, 0x8f,
-    0xff, 0xff, 0xf8, 0x0, 0xbf, 0xff, 0xff, 0x60,
-    0x0, 0x6f, 0xff, 0xf3, 0x0, 0x1, 0xff, 0xfe,
-    0x0, 0x0, 0x3f, 0xff, 0xa0, 0x0, 0x7, 0xff,
-    0xf5, 0x0, 0x0, 0xaf, 0xfe, 0x0, 0x0, 0xf,
-    0xff, 0x80, 0x0, 0x4, 0xff, 0xf1, 0x0, 0x0,
-    0x9f, 0xf9, 0x0, 0x0, 0xe, 0xff, 0x20, 0x0,
-
+    0x0, 0x1d, 0x64, 0x88, 0x4, 0x78, 0xa6, 0xdc,
+    0x40, 0xf, 0x0, 0xe8, 0x0, 0x18, 0x7, 0x30,
+    0x0, 0x80, 0x39, 0x80, 0x10, 0x1, 0xd2, 0x0,
+    0x5a, 0x30, 0x3c, 0x30, 0x9, 0x73, 0xf0, 0xc0,
+    0x3f, 0xff, 0x4, 0xa6, 0x1, 0xd5, 0xb5, 0x9a,
+    0x40, 0x7, 0x50, 0x8, 0xbc, 0x1, 0x40, 0x1c,
+    0x48, 0x4, 0x1, 0xe3, 0x1, 0x0, 0xf7, 0x3,
+    0x0, 0x78, 0x42, 0x10, 0x3, 0xb8, 0x1, 0x72,
+    0x1, 0x94, 0x2, 0x70, 0x8, 0x4c, 0x2, 0x20,
+    0x9, 0x0, 0x32, 0x0, 0x5e, 0x1, 0xb4, 0x0,
+    0x2a, 0x1, 0x94, 0x0, 0xc0, 0x19, 0x0, 0x29,
+    0x0, 0xda, 0x0, 0x61, 0x0, 0xce, 0x0, 0xb0,
+    0x8,
     /* U+003C "<" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5c,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x18, 0xef, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xaf, 0xff,
-    0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6d, 0xff, 0xff, 0xff, 0xff, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x29, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xc4, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x20, 0x0,
-    0x0, 0x0, 0x1, 0x8e, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x60, 0x0, 0x0, 0x0, 0x0, 0x4a, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x93, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xd6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xfa, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xff, 0xff, 0xfd, 0x61, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0xff, 0xfe, 0x92,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2d,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xaf, 0xff, 0xff,
-    0xff, 0xff, 0xe8, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x18, 0xef, 0xff, 0xff, 0xff, 0xff,
-    0xc5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5c, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x82, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x9f, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x17, 0xdf, 0xff, 0xff, 0xff,
-    0xff, 0xe6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4b, 0xff, 0xff, 0xff, 0xff, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x8e,
-    0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xcf, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3a, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0x40,
-
+    0x0, 0xff, 0xe5, 0x92, 0x80, 0x7f, 0xf2, 0x57,
+    0x37, 0x0, 0x3f, 0xf8, 0xc3, 0x1d, 0x46, 0x1,
+    0xff, 0xc6, 0x4a, 0xe7, 0x10, 0xf, 0xfe, 0x33,
+    0x6d, 0xa8, 0x7, 0xff, 0x18, 0xa7, 0xe4, 0x80,
+    0x3e, 0x3d, 0x0, 0xfe, 0x5c, 0xd6, 0x0, 0xfc,
+    0xdb, 0x88, 0x1, 0xe1, 0x8e, 0xa3, 0x0, 0xf8,
+    0xe7, 0xe4, 0x80, 0x3c, 0x95, 0xce, 0x20, 0x1f,
+    0x36, 0x61, 0x80, 0x3e, 0x6d, 0xb5, 0x0, 0xf8,
+    0xa7, 0xe4, 0xc0, 0x3e, 0x3f, 0x92, 0x0, 0xf9,
+    0x73, 0x58, 0x3, 0xfc, 0xe0, 0x1f, 0x14, 0xf5,
+    0x18, 0x7, 0xff, 0x1d, 0xb5, 0x84, 0x3, 0xff,
+    0x92, 0xdd, 0x24, 0x1, 0xff, 0xc2, 0x62, 0x0,
+    0xf0, 0xb6, 0xe2, 0x80, 0x7f, 0xe2, 0xdb, 0x50,
+    0xf, 0x8e, 0xba, 0x8, 0x3, 0xfe, 0x4a, 0xe7,
+    0x10, 0xf, 0xb, 0xee, 0x28, 0x7, 0xfc, 0x31,
+    0xd4, 0x60, 0x1f, 0x1d, 0x74, 0x10, 0x7, 0xfc,
+    0xb9, 0x86, 0x0, 0xf8, 0x5f, 0x71, 0x40, 0x3f,
+    0xe3, 0x9e, 0x82, 0x0, 0xf8, 0xeb, 0x98, 0x3,
+    0xfe, 0x17, 0xdb, 0x40, 0xf, 0x87, 0xc0, 0x3f,
+    0xf8, 0x49, 0x7a, 0xe2, 0x1, 0xff, 0xca, 0x28,
+    0xe9, 0x30, 0xf, 0xfe, 0x5b, 0x66, 0x14, 0x3,
+    0xff, 0x96, 0x75, 0xda,
     /* U+003D "=" */
-    0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xb4, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfb, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xb4, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfb, 0x26, 0x66, 0x66, 0x66, 0x66, 0x66,
-    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x26, 0x66, 0x66,
-    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
-    0x66, 0x44, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x4f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xb4, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x4f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xb0,
-
+    0x4f, 0xff, 0xfe, 0x5d, 0x80, 0x7f, 0xff, 0xda,
+    0x67, 0xff, 0x97, 0xe4, 0xcd, 0xff, 0xcb, 0x40,
+    0xf, 0xff, 0xf8, 0x7, 0xff, 0x34, 0x99, 0xbf,
+    0xf9, 0x68, 0xd3, 0x3f, 0xfc, 0xbf, 0x0, 0xff,
+    0xff, 0x80,
     /* U+003E ">" */
-    0x25, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xfe, 0x71, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xfa, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
-    0xff, 0xd6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0xff, 0xff, 0xff, 0x92,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xaf,
-    0xff, 0xff, 0xff, 0xff, 0xfb, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x17, 0xdf, 0xff, 0xff,
-    0xff, 0xff, 0xe7, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4a, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xa3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0x7d, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xaf, 0xff,
-    0xff, 0xff, 0xff, 0xf9, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x17, 0xef, 0xff, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4b, 0xff, 0xff, 0xff, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0x6d, 0xff, 0xff, 0xff, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x39, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xd6, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0x9f, 0xff, 0xff, 0xff,
-    0xff, 0xfa, 0x30, 0x0, 0x0, 0x0, 0x0, 0x6d,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x81, 0x0, 0x0,
-    0x0, 0x0, 0x39, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc5, 0x0, 0x0, 0x0, 0x0, 0x2, 0xcf, 0xff,
-    0xff, 0xff, 0xff, 0xf9, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0xff, 0xff, 0xfd, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0xff, 0xff, 0xb4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0xe8, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xfc, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x23, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0,
-
+    0x25, 0x0, 0xff, 0xe5, 0xb5, 0x73, 0x88, 0x7,
+    0xff, 0x28, 0x63, 0xa8, 0xc0, 0x3f, 0xf9, 0x6b,
+    0x9a, 0xc0, 0x1f, 0xfc, 0xb2, 0x9f, 0x92, 0x0,
+    0xff, 0xe0, 0x2, 0xa8, 0x3, 0xf3, 0x6d, 0xa8,
+    0x7, 0xfc, 0x35, 0xd0, 0x40, 0x1f, 0x25, 0x73,
+    0x88, 0x7, 0xf8, 0x5f, 0x6d, 0x40, 0x3e, 0x18,
+    0xea, 0x30, 0xf, 0xf9, 0x2b, 0xa0, 0x80, 0x3e,
+    0x5c, 0xd6, 0x0, 0xff, 0x85, 0xf6, 0xd4, 0x3,
+    0xe2, 0x9f, 0x92, 0x0, 0xff, 0x92, 0xba, 0x4,
+    0x3, 0xe6, 0xd8, 0x0, 0xff, 0xc2, 0xfd, 0x68,
+    0x1, 0xf0, 0x80, 0x7f, 0xf0, 0xd2, 0xe8, 0x3,
+    0xff, 0x92, 0x2d, 0xb4, 0x1, 0xff, 0xc7, 0x39,
+    0xe9, 0x20, 0xf, 0xbc, 0x3, 0xfc, 0xdb, 0x8c,
+    0x1, 0xf1, 0x4f, 0xb0, 0x7, 0xc7, 0x3f, 0x24,
+    0x1, 0xf2, 0xe6, 0xb0, 0x7, 0xcd, 0xb8, 0xc0,
+    0x1f, 0xb, 0xf5, 0x18, 0x7, 0x8e, 0x7e, 0x48,
+    0x3, 0xe3, 0xae, 0x81, 0x0, 0xf1, 0x66, 0x18,
+    0x3, 0xf3, 0x6e, 0x28, 0x7, 0xf3, 0x18, 0x7,
+    0xc5, 0x1f, 0x24, 0x1, 0xff, 0xc6, 0x4b, 0xd7,
+    0x0, 0xff, 0xe3, 0xb, 0xf5, 0xa0, 0x7, 0xff,
+    0x18, 0xeb, 0xa0, 0x40, 0x3f, 0xf8, 0xcd, 0x98,
+    0x50, 0xf, 0xfe, 0x48,
     /* U+003F "?" */
-    0x0, 0x16, 0x9c, 0xef, 0xed, 0xa5, 0x0, 0x0,
-    0x0, 0x6b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd5,
-    0x0, 0x0, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xc1, 0x0, 0xef, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x0, 0xef, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x60, 0xef, 0xff, 0xc9,
-    0x89, 0xdf, 0xff, 0xff, 0xff, 0xd0, 0xee, 0x71,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xf1, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xff, 0xff, 0xfc, 0x10, 0x0, 0x0, 0x0,
-    0x1e, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x77, 0x77,
-    0x74, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0x52, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0xc1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xff, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3c,
-    0xfd, 0x60, 0x0, 0x0, 0x0, 0x0,
-
+    0x0, 0xb, 0x4e, 0x77, 0xf6, 0xd2, 0x80, 0x79,
+    0xaf, 0xa5, 0x8c, 0x40, 0x49, 0x6b, 0x54, 0x3,
+    0x42, 0x0, 0x7f, 0x8a, 0xb0, 0x40, 0x3f, 0xf8,
+    0x87, 0xa0, 0x1f, 0xfc, 0x53, 0x60, 0xe, 0x36,
+    0x76, 0x20, 0xf, 0xac, 0x0, 0x31, 0xd9, 0x31,
+    0x3b, 0x0, 0x1e, 0x21, 0x8e, 0x71, 0x0, 0xe7,
+    0x20, 0xf, 0x1b, 0x0, 0x7f, 0x18, 0x7, 0x8c,
+    0x3, 0xf9, 0x44, 0x3, 0x84, 0x40, 0x1f, 0x8e,
+    0x80, 0x3d, 0x0, 0x1f, 0x93, 0x0, 0x3c, 0x6c,
+    0x1, 0xf2, 0xd8, 0x7, 0x8f, 0x0, 0x3e, 0x4a,
+    0x0, 0xf1, 0xe8, 0x7, 0xc3, 0x40, 0x1e, 0x5c,
+    0x10, 0xf, 0xa0, 0x40, 0x39, 0x68, 0x3, 0xf9,
+    0xc0, 0x38, 0xe8, 0x3, 0xf8, 0x84, 0x3, 0xb8,
+    0x3, 0xfc, 0x20, 0x1c, 0x64, 0x1, 0xfe, 0x70,
+    0xe, 0x50, 0xf, 0xf9, 0xa2, 0x3b, 0x40, 0x3f,
+    0xe2, 0x77, 0xe4, 0x0, 0xff, 0xe0, 0x1, 0x29,
+    0x0, 0x7f, 0xf0, 0xa7, 0x6b, 0x70, 0x40, 0x3f,
+    0xe7, 0x60, 0x8, 0xe8, 0x3, 0xfe, 0xa0, 0xe,
+    0x41, 0x0, 0xff, 0x10, 0x7, 0x88, 0x3, 0xfc,
+    0x60, 0x1e, 0x30, 0xf, 0xf7, 0x80, 0x74, 0x0,
+    0x7f, 0xc7, 0x86, 0x5, 0x2e, 0x1, 0xf8,
     /* U+0040 "@" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x38, 0xac,
-    0xdf, 0xed, 0xb9, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x28, 0xef, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfa, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xcf, 0xff, 0xff,
-    0xe9, 0x65, 0x34, 0x57, 0xcf, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xef, 0xff, 0xfa,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x18, 0xff, 0xff,
-    0xc1, 0x0, 0x0, 0x0, 0x2, 0xef, 0xff, 0xc3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xcf,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xa0,
-    0x0, 0x0, 0x25, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xff, 0x60, 0x0, 0x0, 0x7f, 0xff, 0x80,
-    0x0, 0x7, 0xff, 0xff, 0xf7, 0x1, 0xbb, 0xbb,
-    0x10, 0xcf, 0xff, 0x0, 0x0, 0x2f, 0xff, 0xb0,
-    0x0, 0x1d, 0xff, 0xff, 0xff, 0xf9, 0x4f, 0xff,
-    0xf0, 0x1, 0xff, 0xf6, 0x0, 0x9, 0xff, 0xe1,
-    0x0, 0x1e, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff,
-    0xfd, 0x0, 0x9, 0xff, 0xd0, 0x1, 0xff, 0xf7,
-    0x0, 0xb, 0xff, 0xff, 0x93, 0x16, 0xff, 0xff,
-    0xff, 0xa0, 0x0, 0x2f, 0xff, 0x20, 0x6f, 0xfe,
-    0x0, 0x6, 0xff, 0xff, 0x80, 0x0, 0x7, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0xdf, 0xf6, 0xc, 0xff,
-    0x80, 0x0, 0xdf, 0xff, 0xd0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0x50, 0x0, 0x9, 0xff, 0xa0, 0xff,
-    0xf4, 0x0, 0x5f, 0xff, 0xf5, 0x0, 0x0, 0x0,
-    0xdf, 0xff, 0xf2, 0x0, 0x0, 0x6f, 0xfb, 0x3f,
-    0xff, 0x0, 0xa, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0xff, 0x0, 0x0, 0x5, 0xff, 0xc7,
-    0xff, 0xc0, 0x0, 0xff, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0xd0, 0x0, 0x0, 0x4f, 0xfd,
-    0x8f, 0xfa, 0x0, 0x3f, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0xd, 0xff, 0xfb, 0x0, 0x0, 0x5, 0xff,
-    0xc9, 0xff, 0x90, 0x6, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0x80, 0x0, 0x0, 0x7f,
-    0xfa, 0xaf, 0xf8, 0x0, 0x8f, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xf5, 0x0, 0x0, 0xa,
-    0xff, 0x9a, 0xff, 0x80, 0x9, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0x30, 0x0, 0x0,
-    0xef, 0xf5, 0x9f, 0xf9, 0x0, 0x9f, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xf0, 0x0, 0x0,
-    0x4f, 0xff, 0x18, 0xff, 0xb0, 0x8, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xfe, 0x0, 0x0,
-    0xb, 0xff, 0xb0, 0x6f, 0xfc, 0x0, 0x6f, 0xff,
-    0xd0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xb0, 0x0,
-    0x4, 0xff, 0xf4, 0x4, 0xff, 0xf1, 0x4, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xf8, 0x0,
-    0x2, 0xef, 0xfb, 0x0, 0xf, 0xff, 0x50, 0xe,
-    0xff, 0xf4, 0x0, 0x0, 0xd, 0xff, 0xff, 0x60,
-    0x3, 0xef, 0xff, 0x20, 0x0, 0xbf, 0xfa, 0x0,
-    0x7f, 0xff, 0xc0, 0x0, 0x7, 0xff, 0xff, 0xfa,
-    0x49, 0xff, 0xff, 0x40, 0x0, 0x6, 0xff, 0xf2,
-    0x1, 0xef, 0xff, 0xb4, 0x38, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x50, 0x0, 0x0, 0xe, 0xff,
-    0xa0, 0x4, 0xff, 0xff, 0xff, 0xff, 0xea, 0xff,
-    0xff, 0xff, 0xfd, 0x30, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0x40, 0x2, 0xcf, 0xff, 0xff, 0xa1, 0xc,
-    0xff, 0xff, 0xd6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xfe, 0x20, 0x0, 0x25, 0x65, 0x10, 0x0,
-    0x4, 0x65, 0x20, 0x0, 0x4, 0x55, 0x53, 0x0,
-    0x3, 0xff, 0xfd, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0x20,
-    0x0, 0x6, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4e, 0xff, 0xff, 0x40,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xc4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xbf, 0xff, 0xfe, 0x40,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xfd, 0x84,
-    0x21, 0x1, 0x25, 0x8e, 0xff, 0xff, 0xfc, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xcf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4c, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0x6b, 0xef, 0xff, 0xff, 0xea, 0x72, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0x21, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0,
-
+    0x0, 0xff, 0xc7, 0x15, 0x9b, 0xfd, 0xb7, 0x28,
+    0x1, 0xff, 0xc7, 0x28, 0xec, 0x75, 0x32, 0x1,
+    0x24, 0x6b, 0xfa, 0x20, 0xf, 0xfe, 0x1b, 0xeb,
+    0x88, 0x7, 0xfe, 0x5d, 0x80, 0xf, 0xfc, 0x59,
+    0x0, 0x18, 0x5a, 0x6b, 0x2e, 0xa0, 0xc0, 0x33,
+    0xe0, 0x7, 0xf8, 0xb0, 0xc0, 0x25, 0xce, 0x96,
+    0x53, 0x45, 0x7c, 0xe7, 0x0, 0x8f, 0x4, 0x3,
+    0xe2, 0xc1, 0x0, 0x1e, 0x51, 0x80, 0x7f, 0xc,
+    0x71, 0x80, 0xe, 0x80, 0x3e, 0xf1, 0x0, 0x2e,
+    0x18, 0x4, 0x4a, 0x60, 0x1f, 0xe, 0x28, 0x1,
+    0x18, 0x3, 0x9c, 0x80, 0xf, 0x40, 0x13, 0xfe,
+    0xd6, 0x7b, 0x80, 0xdd, 0xe1, 0xa3, 0x0, 0x48,
+    0x6, 0x28, 0x0, 0x24, 0x0, 0x7, 0x60, 0x3,
+    0xa2, 0x55, 0x13, 0x8, 0x68, 0x4, 0xc0, 0x15,
+    0x80, 0x6, 0x80, 0x3, 0xe4, 0x1, 0xf3, 0x40,
+    0x4, 0x40, 0x1, 0x60, 0x5, 0x80, 0x5, 0x80,
+    0x12, 0x20, 0xa, 0x10, 0x9, 0xb3, 0xa4, 0x0,
+    0x60, 0x13, 0x80, 0x56, 0x0, 0x22, 0x3, 0x80,
+    0x5, 0xc0, 0xc, 0x80, 0x13, 0xc9, 0x8b, 0x40,
+    0x7, 0x10, 0x4, 0x44, 0x0, 0x20, 0x50, 0x1,
+    0x80, 0x2b, 0x0, 0x8a, 0x0, 0x33, 0x80, 0x76,
+    0x80, 0x64, 0x0, 0x60, 0x18, 0x3, 0x0, 0xa,
+    0x40, 0x14, 0x0, 0x78, 0x80, 0x33, 0x80, 0x6f,
+    0x0, 0x9, 0x80, 0x48, 0x0, 0xf0, 0xc, 0xa0,
+    0x1e, 0x60, 0xc, 0x40, 0x18, 0xc0, 0xe, 0x80,
+    0x3, 0x0, 0x94, 0x2, 0x50, 0xf, 0x9c, 0x2,
+    0x20, 0xe, 0x10, 0x0, 0xf8, 0x1, 0x80, 0x6,
+    0x1, 0xb4, 0x3, 0xe1, 0x0, 0x98, 0x3, 0x84,
+    0x0, 0x22, 0x0, 0x18, 0x1, 0x40, 0x31, 0x80,
+    0x7c, 0x40, 0x11, 0x80, 0x71, 0x0, 0x18, 0xc0,
+    0x2, 0x0, 0xe0, 0xc, 0xa0, 0x1e, 0x10, 0xd,
+    0xa0, 0x1d, 0xa0, 0x3, 0x0, 0xf0, 0x80, 0x61,
+    0x0, 0xf2, 0x80, 0x66, 0x0, 0xe4, 0x0, 0x61,
+    0x80, 0x4, 0x3, 0xc4, 0x1, 0xf1, 0x80, 0x63,
+    0x0, 0xc8, 0x20, 0x4, 0x10, 0x1, 0x0, 0x4,
+    0x2, 0x10, 0xf, 0xb0, 0x2, 0x10, 0xe, 0xf0,
+    0x2, 0xf, 0x0, 0x1c, 0x1, 0xc0, 0x10, 0x80,
+    0x78, 0x50, 0x2, 0x50, 0xc, 0x88, 0x0, 0x78,
+    0x10, 0x0, 0xc4, 0x8, 0x2, 0x20, 0xf, 0x20,
+    0x6, 0x30, 0x8, 0xa8, 0x0, 0x88, 0x4, 0x0,
+    0x90, 0x10, 0x40, 0x24, 0x0, 0xe8, 0x0, 0xdc,
+    0x0, 0x3c, 0x10, 0x4, 0x80, 0x48, 0x0, 0xf0,
+    0x4, 0x80, 0x50, 0x1, 0x9c, 0x80, 0x36, 0x24,
+    0xe0, 0x80, 0x2c, 0x80, 0x2d, 0x0, 0x29, 0x3,
+    0x8, 0x0, 0xed, 0xe, 0x20, 0x1, 0xcb, 0x6c,
+    0x1, 0x52, 0x0, 0x66, 0x10, 0x4, 0x0, 0xd0,
+    0x4, 0x97, 0x8e, 0x2, 0xa0, 0x1f, 0x16, 0x28,
+    0x7, 0xa4, 0x0, 0xa8, 0x9, 0xa6, 0x1, 0xcb,
+    0xf4, 0x60, 0x18, 0xa7, 0x4c, 0x3, 0xe7, 0x10,
+    0x5, 0x10, 0x16, 0x6d, 0x4d, 0x75, 0x8, 0x65,
+    0xcd, 0x6e, 0x98, 0x0, 0x8a, 0xb1, 0x80, 0x5a,
+    0x0, 0x1f, 0x20, 0x1, 0x2b, 0x28, 0x80, 0x64,
+    0x65, 0x20, 0xa, 0xae, 0xaa, 0x10, 0x8, 0xe4,
+    0x0, 0x5a, 0xa0, 0x1f, 0xfc, 0x34, 0xe5, 0x0,
+    0xac, 0x80, 0x33, 0x40, 0x5, 0x58, 0x80, 0x1f,
+    0xf2, 0xdd, 0x84, 0x0, 0x36, 0x80, 0x1e, 0x7a,
+    0x0, 0x8e, 0xf6, 0x10, 0x84, 0x4, 0x96, 0x3a,
+    0x90, 0x2, 0x3f, 0x40, 0xf, 0xcb, 0xa6, 0x1,
+    0x13, 0xde, 0xf7, 0xf6, 0xd3, 0x88, 0x4, 0x55,
+    0x82, 0x1, 0xfe, 0x2c, 0xb3, 0x0, 0xff, 0xe0,
+    0x1, 0xce, 0xa8, 0x7, 0xff, 0x9, 0x33, 0x65,
+    0x4, 0x3, 0x85, 0x63, 0x71, 0x80, 0x3f, 0xf8,
+    0xc4, 0xd7, 0xdf, 0xdb, 0xdf, 0xd4, 0xe4, 0x1,
+    0xfc,
     /* U+0041 "A" */
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xff, 0xff, 0xff, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff,
-    0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0xff, 0xfc, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0xff, 0x7f, 0xff, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff,
-    0xc4, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xfa, 0x1f, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0x70,
-    0xef, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0xff, 0xf4, 0xb, 0xff, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0x10, 0x9f,
-    0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xe0, 0x6, 0xff, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xff, 0xfb, 0x0, 0x3f, 0xff,
-    0xff, 0xf4, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff,
-    0x90, 0x0, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0xd, 0xff, 0xff, 0xfa, 0x66, 0x6f, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x6f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x40, 0x0, 0xa, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf9, 0x0, 0x0, 0xef, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0,
-    0x0, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x10, 0x7, 0xff, 0xff, 0xff,
-    0x40, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xf5, 0x0,
-    0xbf, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x9, 0xff,
-    0xff, 0xff, 0x90, 0xf, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xff, 0xfe, 0x3, 0xff,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x4, 0xff, 0xff,
-    0xff, 0xf2, 0x7f, 0xff, 0xff, 0xf9, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xff, 0x6b, 0xff, 0xff,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff,
-    0xfa,
-
+    0x0, 0xf8, 0xbf, 0xfe, 0x10, 0xf, 0xfe, 0x12,
+    0x0, 0x7c, 0x80, 0x1f, 0xfc, 0x2c, 0x0, 0xfb,
+    0x0, 0x3f, 0xf8, 0x48, 0x1, 0xf2, 0x0, 0x7f,
+    0xf0, 0x0, 0xc4, 0x3, 0xe2, 0x10, 0xf, 0xfc,
+    0x80, 0x1f, 0xc8, 0x1, 0xff, 0xb0, 0x3, 0xfb,
+    0xc0, 0x3f, 0xf2, 0x0, 0x7f, 0x20, 0x7, 0xfc,
+    0x80, 0x1c, 0x60, 0x18, 0x48, 0x3, 0xfd, 0x80,
+    0x1d, 0x60, 0x1c, 0x80, 0x1f, 0xe4, 0x0, 0xc6,
+    0x60, 0xe, 0xc0, 0xf, 0xf1, 0x80, 0x66, 0x50,
+    0xe, 0x40, 0xf, 0xe4, 0x0, 0xed, 0x11, 0x0,
+    0x61, 0x30, 0xf, 0xda, 0x1, 0xc6, 0xa, 0x1,
+    0xc8, 0x1, 0xf9, 0x0, 0x39, 0x40, 0x80, 0x3b,
+    0x0, 0x3e, 0x12, 0x0, 0xc2, 0x20, 0xf0, 0xe,
+    0x40, 0xf, 0x90, 0x3, 0x94, 0x0, 0xa0, 0x1e,
+    0x40, 0xf, 0x60, 0x7, 0x10, 0x0, 0xc0, 0x3d,
+    0x80, 0x1e, 0x40, 0xe, 0x36, 0x68, 0x3, 0xc8,
+    0x1, 0xc4, 0x40, 0xe, 0x59, 0x98, 0x3, 0xc6,
+    0x1, 0xc8, 0x1, 0xff, 0xc5, 0x40, 0xd, 0x80,
+    0x1f, 0xfc, 0x5d, 0x0, 0xc8, 0x1, 0xff, 0xc5,
+    0x40, 0x8, 0x84, 0x3, 0xff, 0x8a, 0x42, 0x0,
+    0x50, 0xf, 0x5f, 0xff, 0x18, 0x7, 0x90, 0x1,
+    0x80, 0x1e, 0x60, 0xe, 0x50, 0xf, 0x60, 0x1,
+    0x0, 0x3c, 0x40, 0x1d, 0xe0, 0x1e, 0x70, 0x30,
+    0xf, 0x18, 0x7, 0x88, 0x3, 0xc2, 0x48, 0x1,
+    0xe5, 0x0, 0xf2, 0x80, 0x7c, 0x98, 0x1, 0xef,
+    0x0, 0xf0, 0x88, 0x3, 0xd8,
     /* U+0042 "B" */
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0x81,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x40, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0, 0xf,
-    0xff, 0xff, 0xff, 0xde, 0xff, 0xff, 0xff, 0xff,
-    0xf0, 0x0, 0xf, 0xff, 0xff, 0xff, 0x0, 0x1b,
-    0xff, 0xff, 0xff, 0xf2, 0x0, 0xf, 0xff, 0xff,
-    0xff, 0x0, 0x1, 0xff, 0xff, 0xff, 0xf2, 0x0,
-    0xf, 0xff, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0xf0, 0x0, 0xf, 0xff, 0xff, 0xff, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0xb0, 0x0, 0xf, 0xff,
-    0xff, 0xff, 0x0, 0xb, 0xff, 0xff, 0xff, 0x30,
-    0x0, 0xf, 0xff, 0xff, 0xff, 0x9b, 0xef, 0xff,
-    0xff, 0xf7, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x60, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb1, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x92, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf9, 0x0, 0xf, 0xff, 0xff, 0xff, 0x0,
-    0x3, 0xbf, 0xff, 0xff, 0xff, 0x40, 0xf, 0xff,
-    0xff, 0xff, 0x0, 0x0, 0xa, 0xff, 0xff, 0xff,
-    0xb0, 0xf, 0xff, 0xff, 0xff, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0xf0, 0xf, 0xff, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xf1, 0xf,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0xf2, 0xf, 0xff, 0xff, 0xff, 0x0, 0x0,
-    0x8, 0xff, 0xff, 0xff, 0xf1, 0xf, 0xff, 0xff,
-    0xff, 0x0, 0x1, 0x9f, 0xff, 0xff, 0xff, 0xe0,
-    0xf, 0xff, 0xff, 0xff, 0xdd, 0xef, 0xff, 0xff,
-    0xff, 0xff, 0x90, 0xf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x20, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7,
-    0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc3, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xeb, 0x83, 0x0,
-    0x0, 0x0,
-
+    0xf, 0xff, 0xfb, 0x6e, 0x4, 0x3, 0xff, 0x8c,
+    0x48, 0xfc, 0xe0, 0x1f, 0xfc, 0x98, 0x80, 0x7,
+    0xff, 0x25, 0xd0, 0x3, 0xff, 0x93, 0x0, 0x1f,
+    0xf1, 0x8, 0x7, 0xe3, 0x0, 0xff, 0xb7, 0xb8,
+    0x80, 0x1f, 0x10, 0x7, 0xfe, 0x1a, 0x0, 0xff,
+    0xe4, 0x88, 0x7, 0xc4, 0x1, 0xff, 0xc0, 0x1,
+    0x0, 0xf2, 0x0, 0x7f, 0xf0, 0xa8, 0x3, 0xd0,
+    0x1, 0xff, 0x4d, 0xf2, 0x0, 0x74, 0x18, 0x7,
+    0xfc, 0xc8, 0x20, 0x1d, 0x2e, 0x1, 0xff, 0xc6,
+    0x4e, 0x60, 0xf, 0xfe, 0x3a, 0x7c, 0x90, 0x7,
+    0xff, 0x1c, 0x5b, 0x60, 0x3, 0xff, 0x92, 0xf2,
+    0x1, 0xfe, 0xff, 0xb1, 0x0, 0x3c, 0xc8, 0x1,
+    0xff, 0x8e, 0xd4, 0x3, 0xde, 0x1, 0xff, 0xc2,
+    0xb0, 0xf, 0x20, 0x7, 0xff, 0x8, 0x40, 0x3e,
+    0x10, 0xf, 0xfe, 0x0, 0x8, 0x7, 0xc6, 0x1,
+    0xff, 0xc0, 0x9, 0x0, 0xf8, 0xc0, 0x3f, 0xe1,
+    0x97, 0x0, 0xf0, 0x88, 0x3, 0xf6, 0xeb, 0xb8,
+    0xc0, 0x1f, 0x38, 0x7, 0xf1, 0x10, 0x40, 0x3f,
+    0xac, 0x3, 0xff, 0x91, 0x4, 0x1, 0xff, 0xc7,
+    0x77, 0x0, 0x7f, 0xf1, 0x8f, 0x20, 0x3, 0xff,
+    0x86, 0x28, 0xf9, 0x83, 0x0, 0xc0,
     /* U+0043 "C" */
-    0x0, 0x0, 0x0, 0x0, 0x4a, 0xce, 0xfd, 0xa5,
-    0x0, 0x0, 0x0, 0x4, 0xdf, 0xff, 0xff, 0xff,
-    0xfa, 0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xa0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfa, 0x0, 0x4, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xa0, 0x0, 0xdf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfa, 0x0, 0x7f, 0xff, 0xff, 0xff,
-    0xfa, 0x66, 0x9f, 0xa0, 0xe, 0xff, 0xff, 0xff,
-    0xe3, 0x0, 0x0, 0x16, 0x4, 0xff, 0xff, 0xff,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0xff,
-    0x40, 0x0, 0x3, 0x70, 0x9, 0xff, 0xff, 0xff,
-    0xff, 0xb7, 0x8c, 0xfa, 0x0, 0x1e, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x6f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x9f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x0,
-    0xaf, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xff, 0xff, 0xff, 0x90, 0x0,
-    0x0, 0x0, 0x6, 0xbd, 0xfe, 0xb9, 0x30,
-
+    0x0, 0xfc, 0x95, 0x9d, 0xfb, 0x4a, 0x1, 0xf2,
+    0x6d, 0xa9, 0x88, 0x12, 0xd5, 0x0, 0x3a, 0x2c,
+    0x80, 0x3f, 0xf8, 0x0, 0xee, 0x0, 0xff, 0xe1,
+    0x24, 0x0, 0x7f, 0xf0, 0xe4, 0x3, 0xff, 0x86,
+    0xe4, 0x1, 0xf2, 0xcc, 0x98, 0x3, 0x48, 0x7,
+    0x87, 0x29, 0x99, 0x3d, 0x80, 0x82, 0x1, 0xeb,
+    0x30, 0xc, 0x2c, 0x1a, 0x1, 0xe2, 0x50, 0xf,
+    0xca, 0x1, 0xea, 0x0, 0xfe, 0x30, 0xf, 0x20,
+    0x7, 0xe2, 0x0, 0xf8, 0xc0, 0x3f, 0x8, 0x7,
+    0x88, 0x3, 0xf9, 0xc0, 0x3c, 0x20, 0x1f, 0xfc,
+    0xe7, 0x0, 0xf1, 0x0, 0x7f, 0x8, 0x7, 0x84,
+    0x3, 0xf8, 0x80, 0x3e, 0x20, 0xf, 0xe2, 0x0,
+    0xf2, 0x80, 0x7f, 0x20, 0x7, 0xa8, 0x3, 0xfb,
+    0x0, 0x3c, 0x4a, 0x1, 0xf9, 0x44, 0x3, 0xd4,
+    0x80, 0x18, 0xdc, 0x0, 0xe0, 0x1f, 0x5d, 0x9e,
+    0x33, 0x1a, 0x0, 0x81, 0x0, 0xf9, 0x21, 0xcc,
+    0x3, 0xc, 0x0, 0x7f, 0xf1, 0x19, 0x80, 0x1f,
+    0xfc, 0x49, 0x50, 0xf, 0xfe, 0x25, 0x48, 0x7,
+    0xf1, 0x80, 0x79, 0xbe, 0x50, 0x80, 0x51, 0xb2,
+    0x40,
     /* U+0044 "D" */
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xec, 0xb6, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc1, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x90, 0x1, 0xff, 0xff, 0xff,
-    0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0x20, 0x1f,
-    0xff, 0xff, 0xfe, 0x0, 0x3c, 0xff, 0xff, 0xff,
-    0xf9, 0x1, 0xff, 0xff, 0xff, 0xe0, 0x0, 0xd,
-    0xff, 0xff, 0xff, 0xe0, 0x1f, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0x4f, 0xff, 0xff, 0xff, 0x31, 0xff,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0xef, 0xff, 0xff,
-    0xf7, 0x1f, 0xff, 0xff, 0xfe, 0x0, 0x0, 0xa,
-    0xff, 0xff, 0xff, 0xa1, 0xff, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x6f, 0xff, 0xff, 0xfc, 0x1f, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x5, 0xff, 0xff, 0xff,
-    0xd1, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x4f,
-    0xff, 0xff, 0xfe, 0x1f, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xff, 0xf1, 0xff, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xfe,
-    0x1f, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x5, 0xff,
-    0xff, 0xff, 0xd1, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x6f, 0xff, 0xff, 0xfc, 0x1f, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0xa1,
-    0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0xbf, 0xff,
-    0xff, 0xf7, 0x1f, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xff, 0x31, 0xff, 0xff, 0xff,
-    0xe0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xf0, 0x1f,
-    0xff, 0xff, 0xfe, 0x0, 0x2, 0xff, 0xff, 0xff,
-    0xf9, 0x1, 0xff, 0xff, 0xff, 0xe0, 0x6, 0xef,
-    0xff, 0xff, 0xff, 0x20, 0x1f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x1, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe1,
-    0x0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf4, 0x0, 0x1, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe3, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x91, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0xff, 0xec, 0xa7, 0x10,
-    0x0, 0x0, 0x0,
-
+    0x1f, 0xff, 0xee, 0xcb, 0x60, 0xf, 0xfe, 0x28,
+    0x9a, 0x4f, 0xc0, 0x7, 0xff, 0x21, 0xf0, 0x40,
+    0x3f, 0xf8, 0xe7, 0xa0, 0x1f, 0xfc, 0x83, 0x90,
+    0xf, 0xf1, 0x0, 0x7f, 0x31, 0x0, 0x7e, 0x1d,
+    0xfc, 0x30, 0xf, 0xac, 0x3, 0xfe, 0x3c, 0x20,
+    0xf, 0x38, 0x7, 0xff, 0x0, 0x24, 0x3, 0xc2,
+    0x60, 0x1f, 0xf9, 0x4, 0x3, 0xc8, 0x1, 0xff,
+    0xc0, 0x4, 0x0, 0xf6, 0x80, 0x7f, 0xf0, 0x3,
+    0x0, 0x3c, 0xc0, 0x1f, 0xfc, 0x0, 0x30, 0xf,
+    0x8, 0x7, 0xff, 0x0, 0x4, 0x3, 0xc6, 0x1,
+    0xff, 0xc0, 0x7, 0x0, 0xf0, 0x80, 0x7f, 0xf0,
+    0x1, 0xc0, 0x3c, 0x20, 0x1f, 0xfc, 0x0, 0x10,
+    0xf, 0x18, 0x7, 0xff, 0x0, 0xc, 0x3, 0xc2,
+    0x1, 0xff, 0xc0, 0xf, 0x0, 0xf3, 0x0, 0x7f,
+    0xf0, 0x0, 0x80, 0x3d, 0xa0, 0x1f, 0xf8, 0x50,
+    0x3, 0xc8, 0x1, 0xff, 0x98, 0x3, 0xe3, 0x0,
+    0xff, 0x8a, 0x0, 0x3c, 0xc0, 0x1f, 0xf3, 0x60,
+    0x7, 0xd6, 0x1, 0xf8, 0x7f, 0xd2, 0x20, 0x1e,
+    0x52, 0x0, 0xff, 0xe3, 0xd, 0x80, 0x7f, 0xf1,
+    0xe8, 0x40, 0x3f, 0xf8, 0xa3, 0x88, 0x1, 0xff,
+    0xc5, 0x6f, 0x30, 0xf, 0xfe, 0x0, 0x9, 0xac,
+    0x74, 0x88, 0x7,
     /* U+0045 "E" */
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf0, 0xf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf0, 0xf, 0xff, 0xff, 0xff, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x0, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0xfd, 0xdd, 0xdd, 0xdd,
-    0xdd, 0x40, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf5, 0x0, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x50, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x0, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x50,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf5, 0x0, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xf1, 0x11,
-    0x11, 0x11, 0x11, 0x10, 0xf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf0,
-
+    0xf, 0xff, 0xfe, 0x28, 0x7, 0xff, 0xfc, 0x3,
+    0xff, 0xa3, 0xdd, 0xfe, 0x0, 0xfc, 0x23, 0xff,
+    0x0, 0x7f, 0xfd, 0x47, 0x77, 0xf9, 0x0, 0x3f,
+    0x88, 0xbf, 0x84, 0x3, 0xff, 0xfe, 0x1, 0xfc,
+    0x3f, 0xff, 0xca, 0x1, 0xff, 0xff, 0x0, 0xff,
+    0xe8, 0x8, 0xff, 0xc0, 0x1f, 0xdd, 0xdf, 0xe0,
+    0xf, 0xff, 0xf8, 0x7, 0xff, 0x24,
     /* U+0046 "F" */
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfa, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfa, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfa, 0xf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfa, 0xf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfa, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xf, 0xff,
-    0xff, 0xff, 0x11, 0x11, 0x11, 0x11, 0x10, 0xf,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0xdd, 0xdd, 0xdd, 0xdd, 0xc0, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xe0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xe0, 0xf, 0xff, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-
+    0xf, 0xff, 0xfe, 0x25, 0x0, 0x7f, 0xff, 0xc0,
+    0x3f, 0xf9, 0x7d, 0xdf, 0xd4, 0x1, 0xf8, 0x47,
+    0xf8, 0x3, 0xff, 0xfe, 0x1, 0xed, 0xdf, 0xd8,
+    0x1, 0xfc, 0x45, 0xfc, 0x1, 0xff, 0xff, 0x0,
+    0xf7, 0xff, 0xee, 0x0, 0xff, 0xff, 0x80, 0x7f,
+    0xff, 0xc0, 0x3f, 0xfc, 0xa0,
     /* U+0047 "G" */
-    0x0, 0x0, 0x0, 0x0, 0x6b, 0xdf, 0xfd, 0xb7,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0xff, 0xff, 0xfa, 0x10, 0x0, 0x0, 0x1b, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40,
-    0x0, 0x9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x40, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x40, 0x0, 0xbf, 0xff, 0xff,
-    0xff, 0xf8, 0x43, 0x49, 0xff, 0x40, 0x2, 0xff,
-    0xff, 0xff, 0xfd, 0x10, 0x0, 0x0, 0x1b, 0x40,
-    0x7, 0xff, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xff, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0xff, 0xfa, 0x0, 0x26,
-    0x66, 0x66, 0x66, 0x62, 0x6f, 0xff, 0xff, 0xf9,
-    0x0, 0x6f, 0xff, 0xff, 0xff, 0xf5, 0x6f, 0xff,
-    0xff, 0xf8, 0x0, 0x6f, 0xff, 0xff, 0xff, 0xf5,
-    0x5f, 0xff, 0xff, 0xf9, 0x0, 0x6f, 0xff, 0xff,
-    0xff, 0xf5, 0x5f, 0xff, 0xff, 0xfa, 0x0, 0x6f,
-    0xff, 0xff, 0xff, 0xf5, 0x3f, 0xff, 0xff, 0xfc,
-    0x0, 0x6f, 0xff, 0xff, 0xff, 0xf5, 0x1f, 0xff,
-    0xff, 0xff, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xf5,
-    0xe, 0xff, 0xff, 0xff, 0x30, 0x0, 0x2f, 0xff,
-    0xff, 0xf5, 0xb, 0xff, 0xff, 0xff, 0x70, 0x0,
-    0x2f, 0xff, 0xff, 0xf5, 0x6, 0xff, 0xff, 0xff,
-    0xe1, 0x0, 0x5f, 0xff, 0xff, 0xf5, 0x1, 0xff,
-    0xff, 0xff, 0xfc, 0x21, 0xcf, 0xff, 0xff, 0xf5,
-    0x0, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf5, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf5, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x0, 0x0,
-    0xaf, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xf5,
-    0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0xf6, 0x1e,
-    0xff, 0xf5, 0x0, 0x0, 0x0, 0x29, 0xdf, 0xea,
-    0x30, 0x5, 0xff, 0xf5,
-
+    0x0, 0xfc, 0xd7, 0xbf, 0xed, 0xb7, 0x20, 0xf,
+    0xe7, 0xf9, 0x42, 0x0, 0x12, 0x46, 0xd0, 0x80,
+    0x70, 0xdc, 0x0, 0x7f, 0x95, 0x40, 0x1d, 0xa8,
+    0x1, 0xff, 0xc5, 0x93, 0x0, 0xff, 0xe2, 0x9b,
+    0x0, 0x7f, 0xf1, 0xa0, 0x3, 0xf3, 0xde, 0x5b,
+    0x0, 0x71, 0x20, 0x7, 0x8b, 0xa1, 0xd, 0x27,
+    0x90, 0x2, 0x50, 0xf, 0xbc, 0x40, 0x38, 0x6d,
+    0x0, 0x16, 0x1, 0xe6, 0x20, 0xf, 0xf8, 0xc0,
+    0x3d, 0xa0, 0x1f, 0xf1, 0x0, 0x7c, 0x80, 0x1f,
+    0xf3, 0x0, 0x78, 0xc0, 0x3f, 0xf0, 0x80, 0x79,
+    0x80, 0x4, 0xcd, 0xf8, 0x8c, 0x3, 0xc6, 0x0,
+    0x49, 0x9f, 0xce, 0x1, 0xf0, 0x80, 0x7f, 0xe3,
+    0x0, 0xf0, 0x80, 0x7f, 0xf1, 0xcc, 0x3, 0xff,
+    0x30, 0x7, 0x98, 0x3, 0xff, 0x10, 0x7, 0x8c,
+    0x0, 0xdf, 0xa0, 0x1f, 0x8, 0x80, 0x3c, 0x60,
+    0x1f, 0xf9, 0x40, 0x3c, 0x80, 0x1f, 0xfb, 0x40,
+    0x3d, 0x22, 0x0, 0x70, 0xf, 0xce, 0x1, 0xe1,
+    0xd2, 0x19, 0x0, 0xfc, 0x2c, 0x1, 0xe3, 0xde,
+    0x30, 0xf, 0xe8, 0x0, 0xff, 0xe3, 0x8c, 0x0,
+    0x7f, 0xf1, 0xdd, 0x40, 0x3f, 0x88, 0x3, 0xfa,
+    0x9c, 0x3, 0xe9, 0xc1, 0x0, 0xfe, 0x8d, 0x62,
+    0x1, 0x5c, 0x61, 0xb0, 0xc,
     /* U+0048 "H" */
-    0xcf, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x4f, 0xff,
-    0xff, 0xfa, 0xcf, 0xff, 0xff, 0xf3, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xfa, 0xcf, 0xff, 0xff, 0xf3,
-    0x0, 0x0, 0x4f, 0xff, 0xff, 0xfa, 0xcf, 0xff,
-    0xff, 0xf3, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xfa,
-    0xcf, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x4f, 0xff,
-    0xff, 0xfa, 0xcf, 0xff, 0xff, 0xf3, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xfa, 0xcf, 0xff, 0xff, 0xf3,
-    0x0, 0x0, 0x4f, 0xff, 0xff, 0xfa, 0xcf, 0xff,
-    0xff, 0xf3, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xfa,
-    0xcf, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x4f, 0xff,
-    0xff, 0xfa, 0xcf, 0xff, 0xff, 0xf3, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xfa, 0xcf, 0xff, 0xff, 0xf3,
-    0x0, 0x0, 0x4f, 0xff, 0xff, 0xfa, 0xcf, 0xff,
-    0xff, 0xfe, 0xdd, 0xdd, 0xef, 0xff, 0xff, 0xfa,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfa, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfa, 0xcf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xcf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfa, 0xcf, 0xff, 0xff, 0xf3, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xfa, 0xcf, 0xff, 0xff, 0xf3,
-    0x0, 0x0, 0x4f, 0xff, 0xff, 0xfa, 0xcf, 0xff,
-    0xff, 0xf3, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xfa,
-    0xcf, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x4f, 0xff,
-    0xff, 0xfa, 0xcf, 0xff, 0xff, 0xf3, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xfa, 0xcf, 0xff, 0xff, 0xf3,
-    0x0, 0x0, 0x4f, 0xff, 0xff, 0xfa, 0xcf, 0xff,
-    0xff, 0xf3, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xfa,
-    0xcf, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x4f, 0xff,
-    0xff, 0xfa, 0xcf, 0xff, 0xff, 0xf3, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xfa, 0xcf, 0xff, 0xff, 0xf3,
-    0x0, 0x0, 0x4f, 0xff, 0xff, 0xfa, 0xcf, 0xff,
-    0xff, 0xf3, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xfa,
-    0xcf, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x4f, 0xff,
-    0xff, 0xfa, 0xcf, 0xff, 0xff, 0xf3, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xfa,
-
+    0xcf, 0xff, 0x18, 0x6, 0x4f, 0xff, 0x50, 0x7,
+    0xff, 0xfc, 0x3, 0xff, 0xfe, 0x1, 0xff, 0xed,
+    0xdd, 0xea, 0x0, 0xff, 0xe1, 0x9, 0x16, 0x10,
+    0xf, 0xff, 0xf8, 0x7, 0xff, 0x1f, 0x3f, 0xf5,
+    0x80, 0x7f, 0xff, 0xc0, 0x3f, 0xff, 0xe0, 0x1f,
+    0xff, 0xf0, 0xf, 0xfe, 0x50,
     /* U+0049 "I" */
-    0xcf, 0xff, 0xff, 0xf3, 0xcf, 0xff, 0xff, 0xf3,
-    0xcf, 0xff, 0xff, 0xf3, 0xcf, 0xff, 0xff, 0xf3,
-    0xcf, 0xff, 0xff, 0xf3, 0xcf, 0xff, 0xff, 0xf3,
-    0xcf, 0xff, 0xff, 0xf3, 0xcf, 0xff, 0xff, 0xf3,
-    0xcf, 0xff, 0xff, 0xf3, 0xcf, 0xff, 0xff, 0xf3,
-    0xcf, 0xff, 0xff, 0xf3, 0xcf, 0xff, 0xff, 0xf3,
-    0xcf, 0xff, 0xff, 0xf3, 0xcf, 0xff, 0xff, 0xf3,
-    0xcf, 0xff, 0xff, 0xf3, 0xcf, 0xff, 0xff, 0xf3,
-    0xcf, 0xff, 0xff, 0xf3, 0xcf, 0xff, 0xff, 0xf3,
-    0xcf, 0xff, 0xff, 0xf3, 0xcf, 0xff, 0xff, 0xf3,
-    0xcf, 0xff, 0xff, 0xf3, 0xcf, 0xff, 0xff, 0xf3,
-    0xcf, 0xff, 0xff, 0xf3, 0xcf, 0xff, 0xff, 0xf3,
-    0xcf, 0xff, 0xff, 0xf3, 0xcf, 0xff, 0xff, 0xf3,
-    0xcf, 0xff, 0xff, 0xf3, 0xcf, 0xff, 0xff, 0xf3,
-    0xcf, 0xff, 0xff, 0xf3, 0xcf, 0xff, 0xff, 0xf3,
-
+    0xcf, 0xff, 0x18, 0x7, 0xff, 0xfc, 0x3, 0xff,
+    0xfe, 0x1, 0xff, 0xff, 0x0, 0xf8,
     /* U+004A "J" */
-    0x0, 0x8, 0xff, 0xff, 0xff, 0x80, 0x0, 0x8f,
-    0xff, 0xff, 0xf8, 0x0, 0x8, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x8f, 0xff, 0xff, 0xf8, 0x0, 0x8,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x8f, 0xff, 0xff,
-    0xf8, 0x0, 0x8, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x8f, 0xff, 0xff, 0xf8, 0x0, 0x8, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0x8f, 0xff, 0xff, 0xf8, 0x0,
-    0x8, 0xff, 0xff, 0xff, 0x80, 0x0, 0x8f, 0xff,
-    0xff, 0xf8, 0x0, 0x8, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x8f, 0xff, 0xff, 0xf8, 0x0, 0x8, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0x8f, 0xff, 0xff, 0xf8,
-    0x0, 0x8, 0xff, 0xff, 0xff, 0x80, 0x0, 0x8f,
-    0xff, 0xff, 0xf8, 0x0, 0x8, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x8f, 0xff, 0xff, 0xf8, 0x0, 0x8,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x8f, 0xff, 0xff,
-    0xf8, 0x0, 0xb, 0xff, 0xff, 0xff, 0x82, 0x13,
-    0xef, 0xff, 0xff, 0xf7, 0x8f, 0xff, 0xff, 0xff,
-    0xff, 0x68, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x8f,
-    0xff, 0xff, 0xff, 0xfd, 0x8, 0xff, 0xff, 0xff,
-    0xff, 0x50, 0x8f, 0xff, 0xff, 0xff, 0x80, 0x4,
-    0xbe, 0xff, 0xca, 0x40, 0x0,
-
+    0x0, 0xa3, 0xff, 0xd0, 0x1, 0xff, 0xff, 0x0,
+    0xff, 0xff, 0x80, 0x7f, 0xff, 0xc0, 0x3f, 0x8c,
+    0x3, 0xe2, 0x13, 0x50, 0xf, 0x7d, 0x76, 0x8,
+    0x7, 0x84, 0x3, 0xfc, 0x80, 0x1f, 0xc4, 0x40,
+    0xf, 0xe8, 0x0, 0xfe, 0x75, 0xc, 0x41, 0x0,
+    0x1a, 0xdc, 0x0, 0x0,
     /* U+004B "K" */
-    0xf, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xfd, 0x0, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0x8, 0xff, 0xff, 0xff, 0x40, 0xf, 0xff, 0xff,
-    0xfe, 0x0, 0x1, 0xff, 0xff, 0xff, 0xa0, 0x0,
-    0xff, 0xff, 0xff, 0xe0, 0x0, 0x8f, 0xff, 0xff,
-    0xf2, 0x0, 0xf, 0xff, 0xff, 0xfe, 0x0, 0xe,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0xff, 0xff, 0xff,
-    0xe0, 0x7, 0xff, 0xff, 0xfe, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xfe, 0x0, 0xef, 0xff, 0xff, 0x60,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xe0, 0x6f, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xfe,
-    0xd, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0xe5, 0xff, 0xff, 0xfa, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x60, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x60, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xff, 0xfa, 0xff, 0xff, 0xff, 0xf1, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0xfe, 0x1d, 0xff, 0xff, 0xff,
-    0x60, 0x0, 0xf, 0xff, 0xff, 0xff, 0x60, 0x8f,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0xff, 0xff, 0xff,
-    0xf0, 0x4, 0xff, 0xff, 0xff, 0xf1, 0x0, 0xf,
-    0xff, 0xff, 0xfe, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0x70, 0x0, 0xff, 0xff, 0xff, 0xe0, 0x0, 0xaf,
-    0xff, 0xff, 0xfc, 0x0, 0xf, 0xff, 0xff, 0xfe,
-    0x0, 0x6, 0xff, 0xff, 0xff, 0xf2, 0x0, 0xff,
-    0xff, 0xff, 0xe0, 0x0, 0x1f, 0xff, 0xff, 0xff,
-    0x70, 0xf, 0xff, 0xff, 0xfe, 0x0, 0x0, 0xdf,
-    0xff, 0xff, 0xfc, 0x0, 0xff, 0xff, 0xff, 0xe0,
-    0x0, 0x8, 0xff, 0xff, 0xff, 0xf2, 0xf, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xff,
-    0x70, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0xfd,
-
+    0xf, 0xff, 0x70, 0x6, 0x1f, 0xff, 0x68, 0x7,
+    0xff, 0x0, 0x24, 0x3, 0xd2, 0x1, 0xff, 0x85,
+    0xc0, 0x39, 0x50, 0x3, 0xff, 0x48, 0x7, 0xa0,
+    0x3, 0xff, 0x80, 0xc, 0x1, 0xce, 0x40, 0x1f,
+    0xf9, 0xc4, 0x3, 0xc, 0x0, 0x7f, 0xf0, 0x2,
+    0x40, 0x3a, 0x0, 0x3f, 0xf8, 0x0, 0xc2, 0x1,
+    0x8d, 0x80, 0x3f, 0xf8, 0x1, 0x60, 0x1d, 0xe0,
+    0x1f, 0xfc, 0x0, 0x52, 0x0, 0xca, 0x60, 0x1f,
+    0xf8, 0x60, 0x3, 0xb0, 0x3, 0xff, 0x84, 0x40,
+    0x1d, 0xa0, 0x1f, 0xfc, 0x84, 0x10, 0xf, 0xfe,
+    0x43, 0x80, 0x7f, 0xf2, 0x34, 0x3, 0xff, 0x90,
+    0x82, 0x1, 0xff, 0xc8, 0x70, 0xf, 0xfe, 0x45,
+    0x0, 0x7f, 0xf0, 0x1, 0x40, 0x3c, 0x62, 0x1,
+    0xff, 0xd, 0x90, 0x7, 0x9c, 0x3, 0xfe, 0x81,
+    0x50, 0xf, 0x50, 0x7, 0xfc, 0xc1, 0x80, 0x1e,
+    0x31, 0x0, 0xfe, 0x10, 0x2, 0x0, 0x7c, 0xc0,
+    0x1f, 0xfc, 0x0, 0x50, 0xf, 0x58, 0x7, 0xff,
+    0x0, 0x30, 0x3, 0xc6, 0x40, 0x1f, 0xf9, 0xc0,
+    0x3e, 0x50, 0xf, 0xfc, 0x24, 0x1, 0xeb, 0x0,
+    0xff, 0xe0, 0x2, 0x80, 0x78, 0xc8, 0x3, 0xff,
+    0x60, 0x7, 0xca, 0x1, 0xff, 0x90, 0x3, 0xea,
     /* U+004C "L" */
-    0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0x22,
-    0x22, 0x22, 0x22, 0x21, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xaf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xaf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xaf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
-
+    0xff, 0xf8, 0x3, 0xff, 0xfe, 0x1, 0xff, 0xff,
+    0x0, 0xff, 0xff, 0x80, 0x7f, 0xff, 0xc0, 0x3f,
+    0xff, 0xe0, 0x1f, 0xfc, 0x42, 0x2f, 0xe1, 0x0,
+    0xfb, 0x77, 0xfa, 0xc0, 0x3f, 0xff, 0xe0, 0x1f,
+    0xe0,
     /* U+004D "M" */
-    0xef, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0xfc, 0xef, 0xff, 0xff, 0xff,
-    0x40, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0xfc,
-    0xef, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x0, 0xc,
-    0xff, 0xff, 0xff, 0xfc, 0xef, 0xff, 0xff, 0xff,
-    0xf1, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xff, 0xfc,
-    0xef, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x8f,
-    0xff, 0xff, 0xff, 0xfc, 0xef, 0xff, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xff, 0xfc,
-    0xef, 0xff, 0xff, 0xff, 0xff, 0x20, 0x3, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0xef, 0xff, 0xff, 0xff,
-    0xff, 0x70, 0x9, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0xef, 0xff, 0xff, 0xff, 0xff, 0xd0, 0xe, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0xef, 0xff, 0xff, 0xff,
-    0xff, 0xf3, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0xef, 0xff, 0xff, 0xac, 0xff, 0xf9, 0xaf, 0xff,
-    0xbc, 0xff, 0xff, 0xfc, 0xef, 0xff, 0xff, 0xa8,
-    0xff, 0xfe, 0xff, 0xff, 0x7c, 0xff, 0xff, 0xfc,
-    0xef, 0xff, 0xff, 0xb4, 0xff, 0xff, 0xff, 0xff,
-    0x3d, 0xff, 0xff, 0xfc, 0xef, 0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xff, 0xfe, 0xe, 0xff, 0xff, 0xfc,
-    0xef, 0xff, 0xff, 0xd0, 0xaf, 0xff, 0xff, 0xf9,
-    0xf, 0xff, 0xff, 0xfc, 0xef, 0xff, 0xff, 0xe0,
-    0x4f, 0xff, 0xff, 0xf4, 0xf, 0xff, 0xff, 0xfc,
-    0xef, 0xff, 0xff, 0xe0, 0xe, 0xff, 0xff, 0xe0,
-    0xf, 0xff, 0xff, 0xfc, 0xef, 0xff, 0xff, 0xe0,
-    0x9, 0xff, 0xff, 0x80, 0xf, 0xff, 0xff, 0xfc,
-    0xef, 0xff, 0xff, 0xe0, 0x4, 0xff, 0xff, 0x30,
-    0xf, 0xff, 0xff, 0xfc, 0xef, 0xff, 0xff, 0xe0,
-    0x0, 0xef, 0xfd, 0x0, 0xf, 0xff, 0xff, 0xfc,
-    0xef, 0xff, 0xff, 0xe0, 0x0, 0x9f, 0xf7, 0x0,
-    0xf, 0xff, 0xff, 0xfc, 0xef, 0xff, 0xff, 0xe0,
-    0x0, 0x3f, 0xf2, 0x0, 0xf, 0xff, 0xff, 0xfc,
-    0xef, 0xff, 0xff, 0xe0, 0x0, 0xd, 0xc0, 0x0,
-    0xf, 0xff, 0xff, 0xfc, 0xef, 0xff, 0xff, 0xe0,
-    0x0, 0x8, 0x60, 0x0, 0xf, 0xff, 0xff, 0xfc,
-    0xef, 0xff, 0xff, 0xe0, 0x0, 0x2, 0x10, 0x0,
-    0xf, 0xff, 0xff, 0xfc, 0xef, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xfc,
-    0xef, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xfc, 0xef, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xfc,
-    0xef, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xfc, 0xef, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xfc,
-
+    0xef, 0xff, 0x70, 0x7, 0xc3, 0xff, 0xf6, 0x0,
+    0x7c, 0x28, 0x1, 0xe7, 0x0, 0xff, 0xe2, 0x70,
+    0x7, 0xa8, 0x3, 0xff, 0x88, 0xa2, 0x1, 0x88,
+    0xc0, 0x3f, 0xf8, 0xae, 0x1, 0xa8, 0x3, 0xff,
+    0x8d, 0x40, 0x19, 0x40, 0x3f, 0xf8, 0xc6, 0x40,
+    0x3, 0x20, 0xf, 0xfe, 0x3a, 0x80, 0x28, 0x3,
+    0xff, 0x91, 0x40, 0x7, 0x0, 0xff, 0xe4, 0x11,
+    0xa8, 0x80, 0x7f, 0xf1, 0x14, 0xc0, 0x2a, 0xf0,
+    0x9, 0xc, 0x3, 0xff, 0x80, 0x8, 0x1, 0x3a,
+    0x80, 0x58, 0x1, 0xff, 0xc0, 0x1, 0xc0, 0x8,
+    0x40, 0x32, 0x8, 0x7, 0xfe, 0x74, 0x0, 0xf8,
+    0x4c, 0xc0, 0x1f, 0xf8, 0x41, 0x40, 0x3c, 0xe0,
+    0x20, 0x1f, 0xf8, 0xc3, 0x80, 0x3d, 0xa0, 0x1f,
+    0xfc, 0x44, 0x10, 0xc, 0x28, 0x1, 0xff, 0xc5,
+    0x70, 0xc, 0xc0, 0x1f, 0xfc, 0x6d, 0x0, 0xd6,
+    0x1, 0xff, 0xc6, 0x41, 0x0, 0x11, 0x80, 0x7f,
+    0xf1, 0xdc, 0x1, 0x40, 0x1f, 0xfc, 0x8a, 0x0,
+    0x28, 0x7, 0xff, 0x20, 0xc8, 0xc8, 0x3, 0xff,
+    0x92, 0xb4, 0x1, 0xff, 0xca, 0xa7, 0x0, 0xff,
+    0xe5, 0x10, 0x80, 0x7f, 0xff, 0xc0, 0x3f, 0xfa,
+    0x80,
     /* U+004E "N" */
-    0xef, 0xff, 0xff, 0xf5, 0x0, 0x0, 0xe, 0xff,
-    0xff, 0xfc, 0xef, 0xff, 0xff, 0xfb, 0x0, 0x0,
-    0xe, 0xff, 0xff, 0xfc, 0xef, 0xff, 0xff, 0xff,
-    0x10, 0x0, 0xe, 0xff, 0xff, 0xfc, 0xef, 0xff,
-    0xff, 0xff, 0x60, 0x0, 0xe, 0xff, 0xff, 0xfc,
-    0xef, 0xff, 0xff, 0xff, 0xc0, 0x0, 0xe, 0xff,
-    0xff, 0xfc, 0xef, 0xff, 0xff, 0xff, 0xf1, 0x0,
-    0xe, 0xff, 0xff, 0xfc, 0xef, 0xff, 0xff, 0xff,
-    0xf7, 0x0, 0xe, 0xff, 0xff, 0xfc, 0xef, 0xff,
-    0xff, 0xff, 0xfd, 0x0, 0xe, 0xff, 0xff, 0xfc,
-    0xef, 0xff, 0xff, 0xff, 0xff, 0x20, 0xe, 0xff,
-    0xff, 0xfc, 0xef, 0xff, 0xff, 0xff, 0xff, 0x80,
-    0xe, 0xff, 0xff, 0xfc, 0xef, 0xff, 0xff, 0xff,
-    0xff, 0xe0, 0xe, 0xff, 0xff, 0xfc, 0xef, 0xff,
-    0xff, 0xff, 0xff, 0xf3, 0xe, 0xff, 0xff, 0xfc,
-    0xef, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xe, 0xff,
-    0xff, 0xfc, 0xef, 0xff, 0xff, 0xae, 0xff, 0xfe,
-    0xd, 0xff, 0xff, 0xfc, 0xef, 0xff, 0xff, 0x9a,
-    0xff, 0xff, 0x2d, 0xff, 0xff, 0xfc, 0xef, 0xff,
-    0xff, 0xa5, 0xff, 0xff, 0x7c, 0xff, 0xff, 0xfc,
-    0xef, 0xff, 0xff, 0xb1, 0xff, 0xff, 0xcc, 0xff,
-    0xff, 0xfc, 0xef, 0xff, 0xff, 0xb0, 0xcf, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0xef, 0xff, 0xff, 0xb0,
-    0x6f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xef, 0xff,
-    0xff, 0xb0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0xef, 0xff, 0xff, 0xb0, 0xb, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0xef, 0xff, 0xff, 0xb0, 0x5, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0xef, 0xff, 0xff, 0xb0,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xef, 0xff,
-    0xff, 0xb0, 0x0, 0xaf, 0xff, 0xff, 0xff, 0xfc,
-    0xef, 0xff, 0xff, 0xb0, 0x0, 0x4f, 0xff, 0xff,
-    0xff, 0xfc, 0xef, 0xff, 0xff, 0xb0, 0x0, 0xe,
-    0xff, 0xff, 0xff, 0xfc, 0xef, 0xff, 0xff, 0xb0,
-    0x0, 0x8, 0xff, 0xff, 0xff, 0xfc, 0xef, 0xff,
-    0xff, 0xb0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xfc,
-    0xef, 0xff, 0xff, 0xb0, 0x0, 0x0, 0xdf, 0xff,
-    0xff, 0xfc, 0xef, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xfc,
-
+    0xef, 0xff, 0x28, 0x7, 0x77, 0xff, 0x60, 0x7,
+    0xdc, 0x1, 0xff, 0xc7, 0x41, 0x0, 0xff, 0xe3,
+    0xb8, 0x7, 0xff, 0x1e, 0x80, 0x3f, 0xf8, 0xe6,
+    0x20, 0x1f, 0xfc, 0x76, 0x0, 0xff, 0xe3, 0xd0,
+    0x7, 0xff, 0x1c, 0x88, 0x1, 0xff, 0xc7, 0xa0,
+    0xf, 0xfe, 0x3b, 0x0, 0x7f, 0xf1, 0xc4, 0xc0,
+    0x3f, 0xf8, 0xf4, 0x1, 0xff, 0xc2, 0x51, 0x0,
+    0x9c, 0xc, 0x3, 0xff, 0x1a, 0x0, 0x42, 0x40,
+    0x1f, 0xfc, 0x0, 0x3f, 0x0, 0xca, 0x20, 0x1f,
+    0xf8, 0x50, 0x3, 0x58, 0x7, 0xff, 0x8, 0x4c,
+    0x2, 0x33, 0x0, 0x7f, 0xf0, 0xa8, 0x3, 0xff,
+    0x8e, 0xe0, 0x1f, 0xfc, 0x71, 0x40, 0xf, 0xfe,
+    0x3f, 0x0, 0x7f, 0xf1, 0xd4, 0x3, 0xff, 0x90,
+    0xa0, 0x1f, 0xfc, 0x7e, 0x0, 0xff, 0xe3, 0xa0,
+    0x80, 0x7f, 0xf1, 0xd8, 0x3, 0xff, 0x8f, 0x60,
+    0x1f, 0xfc, 0x73, 0x20, 0xf, 0xfe, 0x3d, 0x0,
+    0x7c,
     /* U+004F "O" */
-    0x0, 0x0, 0x0, 0x5, 0xbd, 0xfe, 0xca, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e, 0xff,
-    0xff, 0xff, 0xff, 0xe6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7,
-    0x0, 0x0, 0xb, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf2, 0x0, 0x4, 0xff, 0xff,
-    0xff, 0xfe, 0x75, 0xaf, 0xff, 0xff, 0xff, 0x90,
-    0x0, 0xaf, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x8f,
-    0xff, 0xff, 0xff, 0x10, 0x1f, 0xff, 0xff, 0xff,
-    0x30, 0x0, 0x0, 0xef, 0xff, 0xff, 0xf5, 0x4,
-    0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0xa0, 0x8f, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xfd, 0xb, 0xff,
-    0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0xf0, 0xdf, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0xd, 0xff, 0xff, 0xff, 0x2e, 0xff, 0xff,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff,
-    0xf3, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0xff, 0xff, 0x4f, 0xff, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xf3,
-    0xef, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0xd,
-    0xff, 0xff, 0xff, 0x2d, 0xff, 0xff, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0xf1, 0xbf,
-    0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0x8, 0xff, 0xff, 0xff, 0x90, 0x0,
-    0x0, 0x5, 0xff, 0xff, 0xff, 0xc0, 0x5f, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff,
-    0xf9, 0x1, 0xff, 0xff, 0xff, 0xf4, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xff, 0x40, 0xb, 0xff, 0xff,
-    0xff, 0xd1, 0x0, 0xb, 0xff, 0xff, 0xff, 0xe0,
-    0x0, 0x4f, 0xff, 0xff, 0xff, 0xe8, 0x8d, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0xcf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x60, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xef, 0xff, 0xff,
-    0xff, 0xfe, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5a, 0xdf, 0xfd, 0xa5, 0x0, 0x0, 0x0,
-    0x0,
-
+    0x0, 0xf9, 0x6f, 0x7f, 0xb2, 0x94, 0x3, 0xff,
+    0x80, 0x9, 0xd4, 0x84, 0x2, 0x6b, 0x5c, 0xc0,
+    0x1f, 0xe7, 0xb1, 0x0, 0xfc, 0x33, 0x40, 0x1f,
+    0x9a, 0x0, 0x3f, 0xf2, 0xd8, 0x7, 0x8a, 0x40,
+    0x3f, 0xf8, 0x48, 0xe0, 0x1d, 0x20, 0x1f, 0xfc,
+    0x48, 0x20, 0x9, 0x10, 0x1, 0xe1, 0x8a, 0x50,
+    0xf, 0xac, 0x2, 0xe0, 0xf, 0x17, 0x3a, 0xd3,
+    0x80, 0x79, 0x84, 0x5, 0x40, 0x3d, 0xc0, 0x1a,
+    0x4, 0x3, 0xc8, 0xa, 0x1, 0xe3, 0x30, 0x7,
+    0x48, 0x7, 0xbc, 0x30, 0x3, 0xc8, 0x1, 0xe4,
+    0x0, 0xf3, 0x81, 0x80, 0x7b, 0x40, 0x3c, 0x60,
+    0x1e, 0x20, 0x60, 0xf, 0x38, 0x7, 0xc4, 0x1,
+    0xe2, 0x30, 0xf, 0x18, 0x7, 0xc2, 0x1, 0xe1,
+    0x10, 0x7, 0x84, 0x3, 0xe7, 0x0, 0xf3, 0x80,
+    0x7f, 0xf0, 0xdc, 0x3, 0xce, 0x20, 0x1e, 0x20,
+    0xf, 0x84, 0x3, 0xc2, 0x60, 0x1e, 0x10, 0xf,
+    0x8c, 0x3, 0xc6, 0xc0, 0x1e, 0x60, 0xf, 0x8,
+    0x80, 0x3c, 0x26, 0x1, 0xec, 0x0, 0xf2, 0x0,
+    0x78, 0xc3, 0x40, 0x3c, 0xe0, 0x1e, 0xf0, 0xf,
+    0x28, 0x20, 0x7, 0x85, 0x0, 0x30, 0xa8, 0x7,
+    0xb4, 0x5, 0x0, 0x3d, 0x22, 0x1, 0x50, 0x7,
+    0x85, 0x0, 0x1e, 0x1, 0xe2, 0xf8, 0x86, 0xa0,
+    0x7, 0x98, 0x2, 0x43, 0x0, 0xf0, 0xbb, 0x88,
+    0x3, 0xc3, 0x0, 0x1b, 0xc0, 0x3f, 0xf8, 0x90,
+    0x1, 0xc7, 0x20, 0x1f, 0xfc, 0x27, 0x60, 0xf,
+    0x34, 0x0, 0x7f, 0xe6, 0x80, 0xf, 0xcf, 0x62,
+    0x1, 0xf8, 0x6a, 0x40, 0x3f, 0xc9, 0xd4, 0xa4,
+    0x0, 0x25, 0xae, 0x50, 0xf,
     /* U+0050 "P" */
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xed, 0x95,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfd, 0x30, 0x0, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x10, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0xff, 0xff, 0xff,
-    0xfd, 0xde, 0xff, 0xff, 0xff, 0xff, 0xe0, 0xf,
-    0xff, 0xff, 0xfe, 0x0, 0x2, 0xbf, 0xff, 0xff,
-    0xff, 0x10, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0xf3, 0xf, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xff, 0x40, 0xff,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0xdf, 0xff, 0xff,
-    0xf3, 0xf, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0xff, 0x10, 0xff, 0xff, 0xff, 0xe0,
-    0x0, 0x5e, 0xff, 0xff, 0xff, 0xd0, 0xf, 0xff,
-    0xff, 0xff, 0xde, 0xff, 0xff, 0xff, 0xff, 0xf9,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x10, 0xf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x70, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x50, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xed, 0x95, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0,
-
+    0xf, 0xff, 0xfb, 0xb6, 0x54, 0x3, 0xff, 0x8a,
+    0x24, 0xd5, 0xa6, 0x1, 0xff, 0xc7, 0x2c, 0x40,
+    0xf, 0xfe, 0x45, 0x8, 0x7, 0xff, 0x1c, 0x64,
+    0x3, 0xf8, 0x88, 0x20, 0x1f, 0x98, 0x3, 0xf0,
+    0xee, 0xbb, 0x50, 0x3, 0xc2, 0x20, 0xf, 0xf8,
+    0xa8, 0x3, 0xe2, 0x0, 0xff, 0xc2, 0x60, 0x1e,
+    0x70, 0xf, 0xfe, 0x0, 0x8, 0x7, 0x9c, 0x3,
+    0xff, 0x19, 0x0, 0x78, 0x80, 0x3f, 0xe5, 0xd0,
+    0xf, 0x10, 0x80, 0x7c, 0x3b, 0xdf, 0x42, 0x1,
+    0xe4, 0x0, 0xfe, 0x21, 0x0, 0xfe, 0x80, 0xf,
+    0xfe, 0x3c, 0x8, 0x7, 0xff, 0x19, 0xdc, 0x1,
+    0xff, 0xc5, 0x1a, 0x80, 0xf, 0xfe, 0x10, 0x93,
+    0x57, 0x28, 0x7, 0xfc, 0x3f, 0xf7, 0x6c, 0xa8,
+    0x7, 0xff, 0xfc, 0x3, 0xff, 0xfe, 0x1, 0xff,
+    0xff, 0x0, 0xff, 0xc0,
     /* U+0051 "Q" */
-    0x0, 0x0, 0x0, 0x3, 0x9c, 0xef, 0xdb, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2c, 0xff,
-    0xff, 0xff, 0xff, 0xe6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6,
-    0x0, 0x0, 0xa, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf1, 0x0, 0x3, 0xff, 0xff,
-    0xff, 0xfe, 0x75, 0xbf, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x9f, 0xff, 0xff, 0xfd, 0x10, 0x0, 0xaf,
-    0xff, 0xff, 0xfe, 0x0, 0xe, 0xff, 0xff, 0xff,
-    0x40, 0x0, 0x0, 0xef, 0xff, 0xff, 0xf5, 0x4,
-    0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x8, 0xff,
-    0xff, 0xff, 0x80, 0x7f, 0xff, 0xff, 0xfa, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0xff, 0xfc, 0xa, 0xff,
-    0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0xf0, 0xcf, 0xff, 0xff, 0xf3, 0x0, 0x0,
-    0x0, 0xe, 0xff, 0xff, 0xff, 0x1d, 0xff, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff,
-    0xf2, 0xef, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xf4,
-    0xef, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0xc,
-    0xff, 0xff, 0xff, 0x3d, 0xff, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0xf2, 0xcf,
-    0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xff, 0x1a, 0xff, 0xff, 0xff, 0x50, 0x0,
-    0x0, 0x2, 0xff, 0xff, 0xff, 0xe0, 0x7f, 0xff,
-    0xff, 0xf9, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff,
-    0xfb, 0x3, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0xa, 0xff, 0xff, 0xff, 0x80, 0xf, 0xff, 0xff,
-    0xff, 0x50, 0x0, 0x1, 0xff, 0xff, 0xff, 0xf3,
-    0x0, 0x9f, 0xff, 0xff, 0xfe, 0x20, 0x0, 0xbf,
-    0xff, 0xff, 0xfd, 0x0, 0x2, 0xff, 0xff, 0xff,
-    0xfe, 0x88, 0xdf, 0xff, 0xff, 0xff, 0x70, 0x0,
-    0x9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2c, 0xff, 0xff, 0xff, 0xff, 0xc3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0x8b, 0xff, 0xff,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0xff, 0xfb, 0x30, 0x28, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0xff, 0xff, 0xff, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff,
-    0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xdf, 0xff, 0xff, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff,
-    0xb2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0x32, 0x0, 0x0,
-
+    0x0, 0xf8, 0xe7, 0x3b, 0xf6, 0xd4, 0x3, 0xff,
+    0x80, 0x5, 0x98, 0x63, 0x10, 0x24, 0xae, 0x60,
+    0xf, 0xf2, 0xe9, 0x80, 0x7e, 0x19, 0xa0, 0xf,
+    0xc9, 0x40, 0x1f, 0xf9, 0x68, 0x3, 0xc3, 0x60,
+    0x1f, 0xfc, 0x25, 0x60, 0xe, 0xb0, 0xf, 0xfe,
+    0x24, 0x88, 0x4, 0x6a, 0x1, 0xe1, 0x8a, 0x40,
+    0xf, 0xa4, 0x2, 0xa0, 0xf, 0x17, 0xba, 0xda,
+    0x80, 0x79, 0x80, 0x27, 0x0, 0xf4, 0x88, 0x5,
+    0x42, 0x1, 0xc2, 0xa0, 0x82, 0x1, 0xc2, 0x80,
+    0x1c, 0xc0, 0x1e, 0xd0, 0x30, 0xf, 0x20, 0x7,
+    0xb0, 0x3, 0xc8, 0x1a, 0x1, 0xec, 0x0, 0xf2,
+    0x0, 0x78, 0xc1, 0x80, 0x3c, 0xa0, 0x1f, 0x8,
+    0x7, 0x84, 0x40, 0x1e, 0x10, 0xf, 0x88, 0x3,
+    0xc6, 0x60, 0xf, 0x18, 0x7, 0xff, 0x8, 0x44,
+    0x1, 0xe1, 0x0, 0xf9, 0xc0, 0x3c, 0xe2, 0x1,
+    0xe1, 0x0, 0xf9, 0xc0, 0x3c, 0xe6, 0x1, 0xe3,
+    0x0, 0xf8, 0x80, 0x3c, 0x22, 0x0, 0xf0, 0x80,
+    0x7c, 0x20, 0x1e, 0x36, 0x0, 0xf3, 0x0, 0x78,
+    0x80, 0x3c, 0x22, 0xd0, 0xf, 0x60, 0x7, 0x90,
+    0x3, 0xca, 0x8, 0x1, 0xe7, 0x0, 0xf6, 0x0,
+    0x78, 0xc0, 0xc0, 0x3c, 0x2a, 0x1, 0x85, 0x40,
+    0x3d, 0x60, 0x6, 0x0, 0xf5, 0x90, 0x5, 0x40,
+    0x1e, 0x23, 0x0, 0x58, 0x7, 0x87, 0x22, 0x1a,
+    0x80, 0x1e, 0xa0, 0x8, 0x98, 0x3, 0xc2, 0xee,
+    0x20, 0xf, 0x1b, 0x80, 0x68, 0x0, 0xff, 0xe2,
+    0x70, 0x7, 0xd, 0x80, 0x7f, 0xf0, 0xa0, 0x80,
+    0x3c, 0x94, 0x1, 0xff, 0xa5, 0xc0, 0x3f, 0x2e,
+    0x98, 0x7, 0xe3, 0xc6, 0x0, 0xff, 0x16, 0x61,
+    0xd0, 0x3, 0x9c, 0xc0, 0x3f, 0xf8, 0x0, 0x71,
+    0x6c, 0x1, 0x92, 0xcc, 0xa, 0x14, 0x3, 0xfe,
+    0xb0, 0xe, 0x4c, 0xfd, 0x70, 0xf, 0xfc, 0x4c,
+    0x1, 0xff, 0xca, 0x92, 0x0, 0xff, 0xe5, 0x71,
+    0x0, 0x7f, 0xf2, 0x4f, 0x58, 0x3, 0x91, 0xc0,
+    0x3f, 0xf8, 0x73, 0xfb, 0x9b, 0xf6, 0x40,
     /* U+0052 "R" */
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xeb, 0x94,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfb, 0x20, 0x0, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x30, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf6, 0x0, 0xff, 0xff, 0xff,
-    0xfd, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xa0, 0xf,
-    0xff, 0xff, 0xfe, 0x0, 0x5, 0xff, 0xff, 0xff,
-    0xfc, 0x0, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xd0, 0xf, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0x4f, 0xff, 0xff, 0xfb, 0x0, 0xff,
-    0xff, 0xff, 0xe0, 0x0, 0x6, 0xff, 0xff, 0xff,
-    0x70, 0xf, 0xff, 0xff, 0xfe, 0x0, 0x0, 0xbf,
-    0xff, 0xff, 0xf2, 0x0, 0xff, 0xff, 0xff, 0xe0,
-    0x2, 0xaf, 0xff, 0xff, 0xf8, 0x0, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf6, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x81, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xe9, 0x20, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x60, 0x0, 0x0, 0xff, 0xff, 0xff, 0xf7, 0x9f,
-    0xff, 0xff, 0xff, 0x30, 0x0, 0xf, 0xff, 0xff,
-    0xfe, 0x0, 0x5f, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0xe0, 0x0, 0xdf, 0xff, 0xff,
-    0xf2, 0x0, 0xf, 0xff, 0xff, 0xfe, 0x0, 0x8,
-    0xff, 0xff, 0xff, 0x60, 0x0, 0xff, 0xff, 0xff,
-    0xe0, 0x0, 0x5f, 0xff, 0xff, 0xfa, 0x0, 0xf,
-    0xff, 0xff, 0xfe, 0x0, 0x3, 0xff, 0xff, 0xff,
-    0xd0, 0x0, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0x10, 0xf, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0xef, 0xff, 0xff, 0xf4, 0x0, 0xff,
-    0xff, 0xff, 0xe0, 0x0, 0xc, 0xff, 0xff, 0xff,
-    0x70, 0xf, 0xff, 0xff, 0xfe, 0x0, 0x0, 0xaf,
-    0xff, 0xff, 0xfb, 0x0, 0xff, 0xff, 0xff, 0xe0,
-    0x0, 0x8, 0xff, 0xff, 0xff, 0xe0, 0xf, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xff,
-    0x10, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x4, 0xff,
-    0xff, 0xff, 0xf5,
-
+    0xf, 0xff, 0xfb, 0xae, 0x50, 0x3, 0xff, 0x8a,
+    0x28, 0xd7, 0x62, 0x0, 0xff, 0xe3, 0xa6, 0x98,
+    0x7, 0xff, 0x23, 0x40, 0x3f, 0xf9, 0x2, 0xc0,
+    0x1f, 0xc4, 0x40, 0xf, 0xec, 0x0, 0xfc, 0x3b,
+    0xaf, 0xa0, 0xf, 0x98, 0x3, 0xff, 0x2c, 0x0,
+    0x78, 0x40, 0x3f, 0xf8, 0x0, 0x60, 0x1e, 0x60,
+    0xf, 0xfe, 0x0, 0x10, 0x7, 0xb0, 0x3, 0xff,
+    0x80, 0x1a, 0x1, 0xe5, 0x0, 0xff, 0x8a, 0x90,
+    0x3, 0x9c, 0x80, 0x3f, 0xf, 0xfb, 0x54, 0x3,
+    0x96, 0x0, 0x3f, 0xf8, 0xd3, 0x40, 0x1f, 0xfc,
+    0x41, 0x7e, 0x60, 0xf, 0xfe, 0x30, 0x98, 0x7,
+    0xff, 0x18, 0x5b, 0x58, 0x3, 0xff, 0x43, 0x0,
+    0x7a, 0x4c, 0x3, 0xfc, 0x2f, 0x34, 0x1, 0xef,
+    0x0, 0xff, 0xe0, 0x2, 0x90, 0x7, 0x19, 0x0,
+    0x7f, 0xf0, 0x1, 0x40, 0x3c, 0x80, 0x1f, 0xfc,
+    0x0, 0xd0, 0xf, 0x60, 0x7, 0xff, 0x0, 0x18,
+    0x3, 0xce, 0x1, 0xff, 0xc0, 0x2, 0x0, 0xf1,
+    0x8, 0x7, 0xfe, 0x11, 0x0, 0x79, 0x40, 0x3f,
+    0xf8, 0x0, 0x40, 0x1e, 0x30, 0xf, 0xfe, 0x0,
+    0x30, 0x7, 0xb0, 0x3, 0xff, 0x80, 0x4, 0x1,
+    0xe5, 0x0, 0xff, 0xe0, 0x7, 0x0, 0x78, 0x44,
+    0x1, 0xff, 0x88, 0x3, 0xe4,
     /* U+0053 "S" */
-    0x0, 0x0, 0x2, 0x7b, 0xef, 0xfd, 0xa6, 0x10,
-    0x0, 0x0, 0x1, 0xaf, 0xff, 0xff, 0xff, 0xff,
-    0xf9, 0x0, 0x0, 0x2e, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x0, 0x1, 0xef, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x0, 0xa, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x0, 0x1f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x6f, 0xff,
-    0xff, 0xff, 0xb3, 0x2, 0x5c, 0xff, 0x0, 0x9f,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x6f, 0x0,
-    0xaf, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x3,
-    0x0, 0x8f, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0xff, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x1e, 0xff, 0xff, 0xff, 0xfd,
-    0x40, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x50, 0x0, 0x0, 0x0, 0xaf, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x20, 0x0, 0x0, 0x9,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x4d, 0xff, 0xff, 0xff, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x6d, 0xff, 0xff, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xff, 0xfc, 0xa5, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0xff, 0xfb, 0xaf, 0xa1,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0xff, 0xf8, 0xaf,
-    0xff, 0xa6, 0x45, 0x9f, 0xff, 0xff, 0xff, 0xf3,
-    0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc0, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x30, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf6, 0x0, 0xaf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x60, 0x0, 0x18, 0xef, 0xff, 0xff,
-    0xff, 0xff, 0xc3, 0x0, 0x0, 0x0, 0x4, 0x9c,
-    0xef, 0xec, 0x83, 0x0, 0x0, 0x0,
-
+    0x0, 0xe2, 0x7b, 0xef, 0xf6, 0xd3, 0x8, 0x7,
+    0x86, 0xb6, 0x10, 0x40, 0x4, 0xb3, 0xd2, 0x1,
+    0x8b, 0xd4, 0x3, 0xfc, 0xc0, 0x10, 0xe0, 0x80,
+    0x7f, 0xf0, 0xec, 0x40, 0x3f, 0xf8, 0x62, 0xa0,
+    0x1f, 0xfc, 0x47, 0x0, 0xf9, 0x33, 0xf6, 0x8c,
+    0x3, 0x78, 0x7, 0x8e, 0xcc, 0x9, 0x72, 0x40,
+    0x23, 0x0, 0xf5, 0x80, 0x79, 0xb0, 0x0, 0x40,
+    0x1e, 0xc0, 0xf, 0x8c, 0x1, 0xa0, 0x1e, 0x47,
+    0x0, 0xfe, 0x41, 0x0, 0xf4, 0x6a, 0x0, 0x7c,
+    0x30, 0x1, 0xf1, 0x5e, 0x28, 0x7, 0x99, 0x40,
+    0x3f, 0x1d, 0x61, 0x0, 0x75, 0x30, 0x7, 0xf1,
+    0xea, 0x0, 0x74, 0xd9, 0x0, 0x7f, 0x59, 0x0,
+    0x72, 0x6c, 0x90, 0x7, 0xee, 0x0, 0xf9, 0xb6,
+    0x0, 0x3e, 0x35, 0x0, 0xfc, 0xf8, 0x1, 0xf6,
+    0x0, 0x7f, 0x1b, 0x0, 0x78, 0x80, 0x3f, 0xde,
+    0x1, 0xe7, 0xa5, 0x0, 0xfd, 0xe0, 0x1e, 0x70,
+    0xaa, 0x8, 0x7, 0x23, 0x0, 0x78, 0xc0, 0xb,
+    0xd4, 0xc8, 0xb3, 0x60, 0x1f, 0x58, 0x6, 0x59,
+    0xba, 0x60, 0xf, 0x8c, 0xc0, 0x1f, 0xfc, 0x4f,
+    0x0, 0xff, 0xe2, 0x49, 0x80, 0x7f, 0xf0, 0xe5,
+    0x80, 0x16, 0xe2, 0x1, 0xfc, 0x78, 0xc0, 0x10,
+    0xc7, 0x5b, 0x18, 0x80, 0x9b, 0xe6, 0xc, 0x3,
     /* U+0054 "T" */
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x10, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf1, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x10,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf1, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x10, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x1,
-    0x11, 0x11, 0x1f, 0xff, 0xff, 0xff, 0x11, 0x11,
-    0x11, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0,
-
+    0xf, 0xff, 0xfe, 0x38, 0x80, 0x7f, 0xff, 0xc0,
+    0x3f, 0xfa, 0x7d, 0xde, 0x0, 0xfb, 0xbb, 0xc2,
+    0x2, 0x3e, 0x0, 0xf8, 0x47, 0xc0, 0x1f, 0xff,
+    0xf0, 0xf, 0xff, 0xf8, 0x7, 0xff, 0xfc, 0x3,
+    0xff, 0xfe, 0x1, 0xff, 0xff, 0x0, 0xff, 0xff,
+    0x80, 0x7f, 0xf0, 0x0,
     /* U+0055 "U" */
-    0x3f, 0xff, 0xff, 0xfc, 0x0, 0x0, 0xd, 0xff,
-    0xff, 0xff, 0x13, 0xff, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0xdf, 0xff, 0xff, 0xf1, 0x3f, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0xd, 0xff, 0xff, 0xff, 0x13,
-    0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0xdf, 0xff,
-    0xff, 0xf1, 0x3f, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0xd, 0xff, 0xff, 0xff, 0x13, 0xff, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xf1, 0x3f,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0xd, 0xff, 0xff,
-    0xff, 0x13, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0xdf, 0xff, 0xff, 0xf1, 0x3f, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0xd, 0xff, 0xff, 0xff, 0x13, 0xff,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0xdf, 0xff, 0xff,
-    0xf1, 0x3f, 0xff, 0xff, 0xfc, 0x0, 0x0, 0xd,
-    0xff, 0xff, 0xff, 0x13, 0xff, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0xdf, 0xff, 0xff, 0xf1, 0x3f, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0xd, 0xff, 0xff, 0xff,
-    0x13, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0xdf,
-    0xff, 0xff, 0xf1, 0x3f, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0xd, 0xff, 0xff, 0xff, 0x13, 0xff, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xf1,
-    0x3f, 0xff, 0xff, 0xfc, 0x0, 0x0, 0xd, 0xff,
-    0xff, 0xff, 0x13, 0xff, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0xdf, 0xff, 0xff, 0xf1, 0x3f, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0xd, 0xff, 0xff, 0xff, 0x13,
-    0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0xef, 0xff,
-    0xff, 0xf1, 0x2f, 0xff, 0xff, 0xfd, 0x0, 0x0,
-    0xe, 0xff, 0xff, 0xff, 0x11, 0xff, 0xff, 0xff,
-    0xf0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xf0, 0xf,
-    0xff, 0xff, 0xff, 0x30, 0x0, 0x6f, 0xff, 0xff,
-    0xfe, 0x0, 0xcf, 0xff, 0xff, 0xfd, 0x10, 0x3e,
-    0xff, 0xff, 0xff, 0xb0, 0x8, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x50, 0x0, 0x0, 0xaf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xad, 0xff, 0xed, 0x95,
-    0x0, 0x0, 0x0,
-
+    0x3f, 0xff, 0x60, 0x7, 0x6f, 0xff, 0x84, 0x3,
+    0xff, 0xfe, 0x1, 0xff, 0xff, 0x0, 0xff, 0xff,
+    0x80, 0x7f, 0xff, 0xc0, 0x3f, 0xff, 0xe0, 0x1f,
+    0xfc, 0x43, 0x0, 0xf8, 0x40, 0x3c, 0x20, 0x1f,
+    0xfc, 0x0, 0x30, 0xf, 0x10, 0x6, 0x11, 0x0,
+    0x78, 0x44, 0x1, 0xf1, 0x80, 0x4e, 0x1, 0xe1,
+    0x0, 0x18, 0x7, 0xb8, 0x40, 0xe0, 0x3, 0xca,
+    0x0, 0x40, 0xf, 0x17, 0x7e, 0x8, 0x7, 0xb4,
+    0x1, 0x20, 0x1f, 0xfc, 0x41, 0x60, 0x0, 0xb8,
+    0x7, 0xff, 0xe, 0xc0, 0x34, 0x28, 0x7, 0xff,
+    0x0, 0x21, 0x40, 0x3a, 0xa0, 0x3, 0xfc, 0x56,
+    0xe0, 0x1f, 0x3f, 0xca, 0x90, 0x0, 0x49, 0xab,
+    0x50, 0x3,
     /* U+0056 "V" */
-    0x9f, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x8f,
-    0xff, 0xff, 0xff, 0x5, 0xff, 0xff, 0xff, 0xf1,
-    0x0, 0x0, 0xb, 0xff, 0xff, 0xff, 0xb0, 0x1f,
-    0xff, 0xff, 0xff, 0x30, 0x0, 0x0, 0xdf, 0xff,
-    0xff, 0xf7, 0x0, 0xdf, 0xff, 0xff, 0xf6, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xff, 0x30, 0x9, 0xff,
-    0xff, 0xff, 0x90, 0x0, 0x3, 0xff, 0xff, 0xff,
-    0xf0, 0x0, 0x5f, 0xff, 0xff, 0xfb, 0x0, 0x0,
-    0x6f, 0xff, 0xff, 0xfb, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0xe0, 0x0, 0x8, 0xff, 0xff, 0xff, 0x70,
-    0x0, 0xd, 0xff, 0xff, 0xff, 0x10, 0x0, 0xbf,
-    0xff, 0xff, 0xf3, 0x0, 0x0, 0x9f, 0xff, 0xff,
-    0xf3, 0x0, 0xe, 0xff, 0xff, 0xff, 0x0, 0x0,
-    0x6, 0xff, 0xff, 0xff, 0x60, 0x1, 0xff, 0xff,
-    0xff, 0xb0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xf8,
-    0x0, 0x3f, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0,
-    0xef, 0xff, 0xff, 0xb0, 0x6, 0xff, 0xff, 0xff,
-    0x30, 0x0, 0x0, 0xa, 0xff, 0xff, 0xfe, 0x0,
-    0x9f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0xff, 0xf1, 0xc, 0xff, 0xff, 0xfb, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0x30, 0xef,
-    0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0xe, 0xff,
-    0xff, 0xf6, 0x1f, 0xff, 0xff, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xff, 0xff, 0x84, 0xff, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff,
-    0xfb, 0x7f, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xe9, 0xff, 0xff, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff,
-    0xdf, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xff, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0,
-    0x0,
-
+    0x9f, 0xff, 0x70, 0x7, 0xa3, 0xff, 0xe0, 0xc0,
+    0xf, 0x8, 0x80, 0x38, 0xc0, 0x3c, 0x80, 0x80,
+    0x1f, 0x10, 0x7, 0x30, 0x7, 0xb0, 0x4, 0x80,
+    0x3c, 0xa0, 0x1c, 0x40, 0x1e, 0x40, 0x2, 0x0,
+    0x7b, 0xc0, 0x31, 0x80, 0x7c, 0x60, 0xc, 0x0,
+    0xf1, 0x0, 0x65, 0x0, 0xf2, 0x0, 0x48, 0x1,
+    0xe5, 0x0, 0xdc, 0x1, 0xec, 0x0, 0x84, 0x80,
+    0x38, 0x44, 0x1, 0x18, 0x7, 0x90, 0x3, 0x20,
+    0x7, 0x88, 0x2, 0x50, 0xf, 0x18, 0x6, 0xf0,
+    0xf, 0x28, 0x0, 0x44, 0x1, 0xc8, 0x1, 0xc8,
+    0x1, 0xee, 0x0, 0x10, 0x7, 0xb0, 0x3, 0x88,
+    0x40, 0x38, 0xc0, 0xa, 0x1, 0xe4, 0x0, 0xf2,
+    0x0, 0x72, 0x80, 0x3c, 0x3, 0xc6, 0x1, 0xec,
+    0x0, 0xe1, 0x10, 0x28, 0x7, 0x20, 0x7, 0xc8,
+    0x1, 0xe2, 0x2, 0x0, 0xec, 0x0, 0xf8, 0x84,
+    0x3, 0x94, 0x44, 0x1, 0xc8, 0x1, 0xf9, 0x0,
+    0x3b, 0x94, 0x3, 0xc6, 0x1, 0xfb, 0x0, 0x38,
+    0xcc, 0x1, 0xc8, 0x1, 0xfc, 0xa0, 0x1c, 0xbc,
+    0x1, 0xd8, 0x1, 0xfc, 0x62, 0x1, 0x85, 0x0,
+    0x39, 0x0, 0x3f, 0xca, 0x1, 0xc4, 0x1, 0xc6,
+    0x1, 0xfe, 0xc0, 0xf, 0xf2, 0x0, 0x7f, 0xc8,
+    0x1, 0xfe, 0xc0, 0xf, 0xf8, 0xc0, 0x3f, 0xc8,
+    0x1, 0xff, 0x90, 0x3, 0xf0, 0x98, 0x7, 0xfe,
+    0xc0, 0xf, 0xca, 0x1, 0xff, 0xc0, 0x4, 0x0,
+    0xfd, 0x80, 0x1f, 0xfc, 0x0, 0x30, 0xf, 0xc8,
+    0x1, 0xff, 0xc2, 0x30, 0xf, 0x9, 0x80, 0x7f,
+    0xf0, 0x90, 0x3, 0xc8, 0x1, 0xf8,
     /* U+0057 "W" */
-    0x8f, 0xff, 0xff, 0xf9, 0x0, 0x9, 0xff, 0xff,
-    0xff, 0x60, 0x0, 0xbf, 0xff, 0xff, 0xf4, 0x5f,
-    0xff, 0xff, 0xfa, 0x0, 0xb, 0xff, 0xff, 0xff,
-    0x70, 0x0, 0xdf, 0xff, 0xff, 0xf1, 0x2f, 0xff,
-    0xff, 0xfc, 0x0, 0xc, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0xef, 0xff, 0xff, 0xe0, 0xf, 0xff, 0xff,
-    0xfd, 0x0, 0xd, 0xff, 0xff, 0xff, 0xa0, 0x0,
-    0xff, 0xff, 0xff, 0xb0, 0xc, 0xff, 0xff, 0xfe,
-    0x0, 0xf, 0xff, 0xff, 0xff, 0xb0, 0x1, 0xff,
-    0xff, 0xff, 0x80, 0x9, 0xff, 0xff, 0xff, 0x0,
-    0xf, 0xff, 0xff, 0xff, 0xc0, 0x3, 0xff, 0xff,
-    0xff, 0x50, 0x6, 0xff, 0xff, 0xff, 0x10, 0x1f,
-    0xff, 0xff, 0xff, 0xe0, 0x4, 0xff, 0xff, 0xff,
-    0x20, 0x3, 0xff, 0xff, 0xff, 0x30, 0x3f, 0xff,
-    0xad, 0xff, 0xf0, 0x6, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0x40, 0x4f, 0xff, 0x9c,
-    0xff, 0xf0, 0x7, 0xff, 0xff, 0xfd, 0x0, 0x0,
-    0xdf, 0xff, 0xff, 0x60, 0x5f, 0xff, 0x8b, 0xff,
-    0xf2, 0x9, 0xff, 0xff, 0xfa, 0x0, 0x0, 0xaf,
-    0xff, 0xff, 0x70, 0x7f, 0xff, 0x7b, 0xff, 0xf3,
-    0xa, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0x90, 0x8f, 0xff, 0x6a, 0xff, 0xf5, 0xc,
-    0xff, 0xff, 0xf4, 0x0, 0x0, 0x4f, 0xff, 0xff,
-    0xa0, 0x9f, 0xff, 0x59, 0xff, 0xf6, 0xd, 0xff,
-    0xff, 0xf1, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xb0,
-    0xbf, 0xff, 0x47, 0xff, 0xf7, 0xf, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0xe, 0xff, 0xff, 0xd0, 0xcf,
-    0xff, 0x36, 0xff, 0xf9, 0xf, 0xff, 0xff, 0xb0,
-    0x0, 0x0, 0xb, 0xff, 0xff, 0xf0, 0xdf, 0xff,
-    0x25, 0xff, 0xfa, 0x2f, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x8, 0xff, 0xff, 0xf0, 0xef, 0xff, 0x13,
-    0xff, 0xfb, 0x3f, 0xff, 0xff, 0x50, 0x0, 0x0,
-    0x5, 0xff, 0xff, 0xf2, 0xff, 0xff, 0x2, 0xff,
-    0xfc, 0x5f, 0xff, 0xff, 0x20, 0x0, 0x0, 0x2,
-    0xff, 0xff, 0xf4, 0xff, 0xfe, 0x1, 0xff, 0xfd,
-    0x6f, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xf5, 0xff, 0xfd, 0x0, 0xff, 0xfe, 0x7f,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff,
-    0xf7, 0xff, 0xfb, 0x0, 0xef, 0xff, 0x8f, 0xff,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xf8,
-    0xff, 0xfa, 0x0, 0xdf, 0xff, 0x8f, 0xff, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xff,
-    0xf9, 0x0, 0xcf, 0xff, 0xff, 0xff, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0xbf, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xf6, 0x0,
-    0x9f, 0xff, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xff, 0xff, 0xff, 0xf5, 0x0, 0x8f,
-    0xff, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0xff, 0xff, 0xf4, 0x0, 0x7f, 0xff,
-    0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xf2, 0x0, 0x6f, 0xff, 0xff,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0xff, 0xff, 0xf1, 0x0, 0x4f, 0xff, 0xff, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0xf0, 0x0, 0x3f, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x0,
-
+    0x8f, 0xff, 0x48, 0x5, 0x3f, 0xfe, 0x60, 0xa,
+    0xff, 0xfc, 0x9a, 0x1, 0xe3, 0x0, 0x88, 0x3,
+    0xc2, 0x1, 0x30, 0x7, 0x95, 0xc0, 0x3c, 0xc0,
+    0x13, 0x80, 0x7b, 0xc0, 0x23, 0x0, 0xe1, 0x11,
+    0x0, 0x78, 0x40, 0x21, 0x0, 0xf1, 0x0, 0x42,
+    0x1, 0xca, 0x0, 0x30, 0xe, 0x30, 0x8, 0x80,
+    0x3c, 0x20, 0x1, 0x0, 0xf1, 0x80, 0x14, 0x3,
+    0x84, 0x3, 0xfc, 0xe0, 0x2, 0x0, 0xf6, 0x80,
+    0x3c, 0x3, 0xc2, 0x2, 0x1, 0xf1, 0x0, 0x1c,
+    0x3, 0xce, 0x0, 0x50, 0xf, 0x10, 0x10, 0x4,
+    0xa4, 0x0, 0x10, 0x1, 0x0, 0x78, 0x80, 0x6,
+    0x1, 0xe7, 0x7, 0x0, 0x8c, 0x40, 0x38, 0x40,
+    0x38, 0x80, 0x31, 0x0, 0x71, 0x0, 0x80, 0x42,
+    0xe0, 0x11, 0x7, 0x0, 0x73, 0x80, 0x67, 0x0,
+    0xe1, 0x2, 0x0, 0xbc, 0x3, 0x8, 0x18, 0x7,
+    0x68, 0x6, 0xd0, 0xe, 0xe0, 0xf0, 0x8, 0x44,
+    0x1, 0x30, 0x30, 0x7, 0x18, 0x6, 0x30, 0xe,
+    0x30, 0x10, 0x8, 0xcc, 0x1, 0x18, 0x8, 0x7,
+    0x28, 0x6, 0x50, 0xe, 0x10, 0x20, 0x8, 0x78,
+    0x2, 0x10, 0x20, 0xc, 0x22, 0x0, 0xc2, 0x20,
+    0xc, 0xc0, 0xe0, 0x13, 0x88, 0x5, 0xc0, 0x1e,
+    0x50, 0xf, 0x28, 0x6, 0x20, 0x10, 0x8, 0x4c,
+    0x2, 0x32, 0x0, 0xe3, 0x0, 0xf1, 0x80, 0x78,
+    0xc0, 0x23, 0x60, 0x8, 0x44, 0x1, 0xda, 0x1,
+    0xed, 0x0, 0xe2, 0x10, 0x8, 0x44, 0x1, 0x3b,
+    0x0, 0x73, 0x80, 0x79, 0xc0, 0x39, 0x80, 0x21,
+    0x3, 0x0, 0x84, 0xc0, 0x38, 0x80, 0x3c, 0x40,
+    0x1c, 0x20, 0x11, 0x80, 0x80, 0x46, 0x20, 0x18,
+    0xc0, 0x3f, 0x18, 0x6, 0x20, 0x9, 0x80, 0x2,
+    0x0, 0x1f, 0x0, 0xca, 0x1, 0xf9, 0x40, 0x37,
+    0x80, 0x42, 0x0, 0x30, 0xf, 0xde, 0x1, 0xfb,
+    0xc0, 0x33, 0x80, 0x46, 0x0, 0x10, 0x9, 0xc0,
+    0x32, 0x80, 0x7e, 0x50, 0xf, 0xc2, 0x0, 0x70,
+    0xf, 0xc6, 0x1, 0xf8, 0xc0, 0x3f, 0x70, 0x0,
+    0x80, 0x3e, 0x20, 0xf, 0xf1, 0x0, 0x7c, 0x60,
+    0x1, 0x0, 0xf9, 0xc0, 0x3f, 0xce, 0x1, 0xf0,
+    0x80, 0x3c, 0x3, 0xed, 0x0, 0xff, 0x68, 0x7,
+    0xcc, 0x0, 0x10, 0xf, 0x8c, 0x3, 0xfc, 0x60,
+    0x1f, 0x18, 0x0, 0x80, 0x3e, 0x50, 0xf, 0xf2,
+    0x80, 0x7c, 0x20, 0x7, 0x0, 0xf0, 0x88, 0x3,
+    0x80,
     /* U+0058 "X" */
-    0x0, 0x9f, 0xff, 0xff, 0xfb, 0x0, 0xc, 0xff,
-    0xff, 0xff, 0xa0, 0x0, 0x3, 0xff, 0xff, 0xff,
-    0xe0, 0x0, 0xff, 0xff, 0xff, 0xf5, 0x0, 0x0,
-    0xe, 0xff, 0xff, 0xff, 0x10, 0x2f, 0xff, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xf5,
-    0x6, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xff, 0x80, 0x9f, 0xff, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0xfb, 0xc,
-    0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0x90, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0x5f, 0xff,
-    0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff,
-    0xff, 0xfc, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xff,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xfa, 0xff, 0xff, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0x3f, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xff, 0xff, 0xd0, 0xef, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xf9, 0xa,
-    0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0x8, 0xff,
-    0xff, 0xff, 0x50, 0x6f, 0xff, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0xff, 0xf1, 0x2, 0xff,
-    0xff, 0xff, 0xd0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xfd, 0x0, 0xf, 0xff, 0xff, 0xff, 0x20, 0x0,
-    0x9, 0xff, 0xff, 0xff, 0x90, 0x0, 0xbf, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0xef, 0xff, 0xff, 0xf6,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x5f,
-    0xff, 0xff, 0xff, 0x20, 0x0, 0x3f, 0xff, 0xff,
-    0xff, 0x30, 0xa, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0xf9, 0x0, 0xff, 0xff,
-    0xff, 0xfa, 0x0, 0x0, 0xc, 0xff, 0xff, 0xff,
-    0xe0,
-
+    0x0, 0x4f, 0xff, 0xac, 0x2, 0xcf, 0xff, 0x50,
+    0x6, 0xa0, 0xf, 0x28, 0x4, 0x60, 0x1e, 0xf0,
+    0xc, 0x62, 0x1, 0xc2, 0x20, 0x20, 0xf, 0x94,
+    0x3, 0x9c, 0x3, 0xc8, 0x8, 0x1, 0xe5, 0x0,
+    0xf5, 0x0, 0x7b, 0x43, 0xc0, 0x3d, 0xc0, 0x1e,
+    0x31, 0x0, 0xe3, 0x5, 0x0, 0xe1, 0x40, 0xf,
+    0x9c, 0x3, 0x90, 0xc, 0x3, 0x9c, 0x3, 0xf5,
+    0x0, 0x79, 0x40, 0x3d, 0xa0, 0x1f, 0x8c, 0x40,
+    0x3a, 0x40, 0x38, 0x50, 0x3, 0xf9, 0x80, 0x38,
+    0xc0, 0x39, 0xc0, 0x3f, 0xd6, 0x1, 0xff, 0x50,
+    0x7, 0xf8, 0xc4, 0x3, 0xf8, 0x8c, 0x3, 0xfe,
+    0x60, 0xf, 0xe5, 0x0, 0xff, 0xda, 0x1, 0xfd,
+    0xa0, 0x1f, 0xfb, 0xc0, 0x3f, 0xbc, 0x3, 0xfe,
+    0x15, 0x0, 0xfe, 0x50, 0xf, 0xf9, 0xc0, 0x3f,
+    0xe5, 0x0, 0xff, 0x68, 0x7, 0xfd, 0xc0, 0x1f,
+    0xc2, 0x80, 0x1c, 0xa0, 0x1c, 0x82, 0x1, 0xf9,
+    0x80, 0x3d, 0x20, 0x1e, 0x70, 0xf, 0xd4, 0x1,
+    0xc4, 0x62, 0x1, 0xd4, 0x1, 0xf1, 0x10, 0x3,
+    0x90, 0x10, 0x3, 0x8c, 0x40, 0x3d, 0x40, 0x1e,
+    0xc0, 0xc0, 0xf, 0x30, 0x7, 0x98, 0x3, 0xc8,
+    0x8, 0x1, 0xea, 0x0, 0xe3, 0x10, 0xe, 0x21,
+    0x2, 0x0, 0xf1, 0x10, 0x3, 0x50, 0x7, 0x90,
+    0x2, 0x40, 0xf, 0x50, 0x6, 0x70, 0xf, 0x78,
+    0x5, 0x80, 0x1e, 0x60, 0x9, 0x44, 0x3, 0xc8,
+    0x1, 0x20, 0x7, 0x84, 0xc0, 0x1e, 0x1, 0xe1,
+    0x20, 0x8, 0xc0, 0x3e, 0xa0, 0x2, 0x80, 0x79,
+    0x0, 0x38, 0xc0, 0x3c, 0xe0,
     /* U+0059 "Y" */
-    0x4f, 0xff, 0xff, 0xff, 0x80, 0x0, 0xa, 0xff,
-    0xff, 0xff, 0xf3, 0xd, 0xff, 0xff, 0xff, 0xc0,
-    0x0, 0xe, 0xff, 0xff, 0xff, 0xd0, 0x6, 0xff,
-    0xff, 0xff, 0xf1, 0x0, 0x2f, 0xff, 0xff, 0xff,
-    0x60, 0x0, 0xff, 0xff, 0xff, 0xf5, 0x0, 0x7f,
-    0xff, 0xff, 0xfe, 0x0, 0x0, 0x9f, 0xff, 0xff,
-    0xf9, 0x0, 0xbf, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xfd, 0x0, 0xff, 0xff, 0xff,
-    0xf1, 0x0, 0x0, 0xb, 0xff, 0xff, 0xff, 0x13,
-    0xff, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x4, 0xff,
-    0xff, 0xff, 0x57, 0xff, 0xff, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0xff, 0xab, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0xef, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xff, 0xff, 0xff, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
-    0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0xff, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
-    0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0xff, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0x60, 0x0,
-    0x0, 0x0,
-
+    0x4f, 0xff, 0xa0, 0x3, 0x57, 0xff, 0xc6, 0x84,
+    0x1, 0xe4, 0x0, 0xc8, 0x1, 0xe2, 0x30, 0xb0,
+    0xf, 0x18, 0x80, 0x8, 0x40, 0x3d, 0x60, 0x6,
+    0x0, 0xf9, 0x0, 0xa, 0x1, 0xe1, 0x60, 0x9,
+    0x80, 0x3d, 0x80, 0xc, 0x0, 0xf3, 0x0, 0x6b,
+    0x0, 0xf2, 0x0, 0x10, 0x3, 0xd2, 0x1, 0x89,
+    0x0, 0x38, 0x84, 0xc0, 0x3c, 0xa2, 0x1, 0xde,
+    0x1, 0xe4, 0x40, 0x7, 0xa4, 0x3, 0xc8, 0x40,
+    0x1d, 0xf8, 0x1, 0xc6, 0x60, 0xf, 0xa8, 0x3,
+    0x91, 0x0, 0x1d, 0x20, 0x1f, 0x98, 0x3, 0x84,
+    0x3, 0x85, 0x40, 0x3f, 0xb, 0x0, 0x7f, 0xa4,
+    0x3, 0xfd, 0x40, 0x1f, 0xe6, 0x0, 0xff, 0x19,
+    0x80, 0x3f, 0x30, 0x80, 0x7f, 0xd2, 0x1, 0xfa,
+    0xc0, 0x3f, 0xf2, 0x88, 0x7, 0x90, 0x80, 0x3f,
+    0xf8, 0x0, 0xe0, 0x1e, 0xd0, 0xf, 0xff, 0xf8,
+    0x7, 0xff, 0xfc, 0x3, 0xff, 0xfe, 0x1, 0xff,
+    0xf8,
     /* U+005A "Z" */
-    0xb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x50, 0xb, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x50, 0xb, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0xb, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x50,
-    0xb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x50, 0xb, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x50, 0x0, 0x11, 0x11, 0x11,
-    0x12, 0xff, 0xff, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xff,
-    0xe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff,
-    0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0xff, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xff, 0xe1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xff, 0xff, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff,
-    0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xff, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xff, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
-    0xff, 0xff, 0x81, 0x11, 0x11, 0x11, 0x11, 0x10,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf5, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf5, 0xcf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xcf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf5, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf5,
-
+    0xb, 0xff, 0xff, 0xe2, 0x28, 0x7, 0xff, 0xfc,
+    0x3, 0xff, 0x9f, 0x7d, 0xdf, 0x68, 0x7, 0xe7,
+    0x0, 0x84, 0x7e, 0xa0, 0xf, 0x9c, 0x80, 0x3f,
+    0x89, 0xc0, 0x3c, 0x32, 0x1, 0xfe, 0x80, 0xf,
+    0xa0, 0x40, 0x3f, 0x8d, 0x40, 0x3c, 0x4c, 0x1,
+    0xfe, 0xf0, 0xf, 0xa4, 0x3, 0xfc, 0xc6, 0x1,
+    0xe4, 0x40, 0x7, 0xfa, 0x0, 0x3e, 0x90, 0xf,
+    0xf4, 0x8, 0x7, 0x98, 0x80, 0x3f, 0x85, 0xc0,
+    0x3c, 0x30, 0x1, 0xfe, 0xb0, 0xf, 0xa4, 0x40,
+    0x3f, 0x8d, 0x40, 0x3c, 0x4e, 0x1, 0xfe, 0xf0,
+    0xf, 0xa4, 0x3, 0xfc, 0xa6, 0x1, 0xe4, 0x40,
+    0x7, 0xfa, 0xc0, 0x3e, 0x90, 0xf, 0xf3, 0x88,
+    0x7, 0x98, 0x80, 0x3f, 0x86, 0x0, 0x3e, 0x80,
+    0xf, 0xf4, 0x0, 0x7c, 0xe0, 0x23, 0xfc, 0xa,
+    0x1, 0xf3, 0xf7, 0x7f, 0x94, 0x3, 0xff, 0xfe,
+    0x1, 0xff, 0xcd,
     /* U+005B "[" */
-    0x6f, 0xff, 0xff, 0xff, 0xf2, 0x6f, 0xff, 0xff,
-    0xff, 0xf2, 0x6f, 0xff, 0xff, 0xff, 0xf2, 0x6f,
-    0xff, 0xff, 0xff, 0xf2, 0x6f, 0xff, 0xf5, 0x0,
-    0x0, 0x6f, 0xff, 0xf4, 0x0, 0x0, 0x6f, 0xff,
-    0xf4, 0x0, 0x0, 0x6f, 0xff, 0xf4, 0x0, 0x0,
-    0x6f, 0xff, 0xf4, 0x0, 0x0, 0x6f, 0xff, 0xf4,
-    0x0, 0x0, 0x6f, 0xff, 0xf4, 0x0, 0x0, 0x6f,
-    0xff, 0xf4, 0x0, 0x0, 0x6f, 0xff, 0xf4, 0x0,
-    0x0, 0x6f, 0xff, 0xf4, 0x0, 0x0, 0x6f, 0xff,
-    0xf4, 0x0, 0x0, 0x6f, 0xff, 0xf4, 0x0, 0x0,
-    0x6f, 0xff, 0xf4, 0x0, 0x0, 0x6f, 0xff, 0xf4,
-    0x0, 0x0, 0x6f, 0xff, 0xf4, 0x0, 0x0, 0x6f,
-    0xff, 0xf4, 0x0, 0x0, 0x6f, 0xff, 0xf4, 0x0,
-    0x0, 0x6f, 0xff, 0xf4, 0x0, 0x0, 0x6f, 0xff,
-    0xf4, 0x0, 0x0, 0x6f, 0xff, 0xf4, 0x0, 0x0,
-    0x6f, 0xff, 0xf4, 0x0, 0x0, 0x6f, 0xff, 0xf4,
-    0x0, 0x0, 0x6f, 0xff, 0xf4, 0x0, 0x0, 0x6f,
-    0xff, 0xf4, 0x0, 0x0, 0x6f, 0xff, 0xf4, 0x0,
-    0x0, 0x6f, 0xff, 0xf4, 0x0, 0x0, 0x6f, 0xff,
-    0xf4, 0x0, 0x0, 0x6f, 0xff, 0xf4, 0x0, 0x0,
-    0x6f, 0xff, 0xf4, 0x0, 0x0, 0x6f, 0xff, 0xf4,
-    0x0, 0x0, 0x6f, 0xff, 0xf4, 0x0, 0x0, 0x6f,
-    0xff, 0xf5, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xff,
-    0xf2, 0x6f, 0xff, 0xff, 0xff, 0xf2, 0x6f, 0xff,
-    0xff, 0xff, 0xf2, 0x6f, 0xff, 0xff, 0xff, 0xf2,
-
+    0x6f, 0xff, 0xc4, 0x1, 0xff, 0xd7, 0xaf, 0xf8,
+    0x80, 0x38, 0x40, 0x3f, 0xff, 0xe0, 0x1f, 0xff,
+    0xf0, 0xf, 0xff, 0xf8, 0x7, 0xff, 0xf8, 0x40,
+    0x3f, 0xab, 0xfe, 0x20, 0xf, 0xfe, 0x90,
     /* U+005C "\\" */
-    0x9f, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xff, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xf0,
-
+    0x9f, 0xfb, 0x0, 0x3f, 0xda, 0x1, 0x18, 0x7,
+    0xf9, 0x0, 0x32, 0x80, 0x7f, 0x90, 0x2, 0xc0,
+    0xf, 0xf6, 0x0, 0x4e, 0x1, 0xfe, 0x50, 0x8,
+    0x48, 0x3, 0xf8, 0x84, 0x2, 0x50, 0xf, 0xf3,
+    0x80, 0x58, 0x1, 0xfe, 0xc0, 0x9, 0x0, 0x3f,
+    0xca, 0x1, 0x90, 0x3, 0xfc, 0x60, 0x16, 0x80,
+    0x7f, 0xac, 0x2, 0x40, 0xf, 0xf2, 0x0, 0x44,
+    0x40, 0xf, 0xe3, 0x10, 0x9, 0x0, 0x3f, 0xc8,
+    0x1, 0x68, 0x7, 0xfb, 0xc0, 0x24, 0x0, 0xff,
+    0x20, 0x6, 0x40, 0xf, 0xe1, 0x30, 0xb, 0x0,
+    0x3f, 0xd6, 0x1, 0x28, 0x7, 0xf9, 0x0, 0x22,
+    0x10, 0xf, 0xe3, 0x10, 0x9, 0xc0, 0x3f, 0xc8,
+    0x1, 0x60, 0x7, 0xfb, 0xc0, 0x24, 0x0, 0xff,
+    0x20, 0x4, 0x26, 0x1, 0xfc, 0x26, 0x1, 0x58,
+    0x7, 0xf9, 0x0, 0x24, 0x0, 0xff, 0x58, 0x4,
+    0x62, 0x1, 0xfc, 0x60, 0x19, 0x0, 0x3f, 0xca,
+    0x1, 0x78, 0x7, 0xfb, 0x0, 0x24, 0x0, 0xff,
+    0x38, 0x4, 0x26, 0x1, 0xfc, 0x24, 0x1, 0x20,
+    0x7, 0xf9, 0x40, 0x2b, 0x0, 0xff, 0x60, 0x4,
+    0x60,
     /* U+005D "]" */
-    0x3f, 0xff, 0xff, 0xff, 0xf5, 0x3f, 0xff, 0xff,
-    0xff, 0xf5, 0x3f, 0xff, 0xff, 0xff, 0xf5, 0x3f,
-    0xff, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x6f, 0xff,
-    0xf5, 0x0, 0x0, 0x5f, 0xff, 0xf5, 0x0, 0x0,
-    0x5f, 0xff, 0xf5, 0x0, 0x0, 0x5f, 0xff, 0xf5,
-    0x0, 0x0, 0x5f, 0xff, 0xf5, 0x0, 0x0, 0x5f,
-    0xff, 0xf5, 0x0, 0x0, 0x5f, 0xff, 0xf5, 0x0,
-    0x0, 0x5f, 0xff, 0xf5, 0x0, 0x0, 0x5f, 0xff,
-    0xf5, 0x0, 0x0, 0x5f, 0xff, 0xf5, 0x0, 0x0,
-    0x5f, 0xff, 0xf5, 0x0, 0x0, 0x5f, 0xff, 0xf5,
-    0x0, 0x0, 0x5f, 0xff, 0xf5, 0x0, 0x0, 0x5f,
-    0xff, 0xf5, 0x0, 0x0, 0x5f, 0xff, 0xf5, 0x0,
-    0x0, 0x5f, 0xff, 0xf5, 0x0, 0x0, 0x5f, 0xff,
-    0xf5, 0x0, 0x0, 0x5f, 0xff, 0xf5, 0x0, 0x0,
-    0x5f, 0xff, 0xf5, 0x0, 0x0, 0x5f, 0xff, 0xf5,
-    0x0, 0x0, 0x5f, 0xff, 0xf5, 0x0, 0x0, 0x5f,
-    0xff, 0xf5, 0x0, 0x0, 0x5f, 0xff, 0xf5, 0x0,
-    0x0, 0x5f, 0xff, 0xf5, 0x0, 0x0, 0x5f, 0xff,
-    0xf5, 0x0, 0x0, 0x5f, 0xff, 0xf5, 0x0, 0x0,
-    0x5f, 0xff, 0xf5, 0x0, 0x0, 0x5f, 0xff, 0xf5,
-    0x0, 0x0, 0x5f, 0xff, 0xf5, 0x0, 0x0, 0x5f,
-    0xff, 0xf5, 0x0, 0x0, 0x5f, 0xff, 0xf5, 0x0,
-    0x0, 0x6f, 0xff, 0xf5, 0x3f, 0xff, 0xff, 0xff,
-    0xf5, 0x3f, 0xff, 0xff, 0xff, 0xf5, 0x3f, 0xff,
-    0xff, 0xff, 0xf5, 0x3f, 0xff, 0xff, 0xff, 0xf5,
-
+    0x3f, 0xff, 0xca, 0x1, 0xff, 0xd2, 0x3f, 0xfa,
+    0x40, 0x3f, 0x8c, 0x3, 0xff, 0xfe, 0x1, 0xff,
+    0xff, 0x0, 0xff, 0xff, 0x80, 0x7f, 0xff, 0x8c,
+    0x3, 0x8f, 0xfe, 0x90, 0xf, 0xfe, 0xb8,
     /* U+005E "^" */
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0xff, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xef,
-    0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0x7c, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0xff, 0x16, 0xff, 0xff,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xfa,
-    0x0, 0xef, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xf3, 0x0, 0x9f, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0xe, 0xff, 0xff, 0xd0, 0x0, 0x2f,
-    0xff, 0xff, 0xa0, 0x0, 0x0, 0x6f, 0xff, 0xff,
-    0x60, 0x0, 0xc, 0xff, 0xff, 0xf1, 0x0, 0x0,
-    0xdf, 0xff, 0xff, 0x0, 0x0, 0x5, 0xff, 0xff,
-    0xf9, 0x0, 0x5, 0xff, 0xff, 0xf9, 0x0, 0x0,
-    0x0, 0xef, 0xff, 0xff, 0x10, 0xd, 0xff, 0xff,
-    0xf3, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0x70,
-    0x4f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0xff, 0xe0,
-
+    0x0, 0xfd, 0x7f, 0xfa, 0x0, 0x3f, 0xf8, 0x66,
+    0x80, 0x19, 0xc0, 0x3f, 0xf8, 0x72, 0x1, 0xe7,
+    0x0, 0xff, 0xe0, 0x1, 0x28, 0x7, 0xa4, 0x3,
+    0xff, 0x80, 0x16, 0x1, 0xf0, 0xb0, 0x7, 0xfc,
+    0x2c, 0x1, 0xfa, 0xc0, 0x3f, 0xe8, 0x0, 0xc2,
+    0x1, 0x89, 0x40, 0x3f, 0x85, 0x80, 0x34, 0x98,
+    0x6, 0x90, 0xf, 0xe9, 0x0, 0xe6, 0xa0, 0xc,
+    0x66, 0x0, 0xfc, 0xc0, 0x19, 0x45, 0x84, 0x3,
+    0x40, 0x7, 0xce, 0x20, 0x1a, 0x40, 0xe, 0x1,
+    0x90, 0x80, 0x3d, 0x20, 0x18, 0x8c, 0x1, 0x60,
+    0x1d, 0x0, 0x1c, 0xc2, 0x1, 0xac, 0x2, 0x23,
+    0x0, 0xca, 0x20, 0x1a, 0xc0, 0x39, 0x80, 0x34,
+    0x80, 0x74, 0x0, 0x4a, 0x40, 0x19, 0x80, 0x39,
+    0x44, 0x3, 0x30, 0x80, 0x20, 0x3, 0xa8, 0x3,
+    0xcc, 0x1, 0xcc, 0x8, 0x40, 0x18, 0xcc, 0x1,
+    0xea, 0x0, 0xe9, 0x0,
     /* U+005F "_" */
-    0x3, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
-    0x33, 0x33, 0x33, 0x33, 0x31, 0x4f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-
+    0x3, 0x3f, 0xfe, 0x60, 0xa6, 0x67, 0xff, 0x32,
+    0x40, 0x3f, 0xf9, 0xc0,
     /* U+0060 "`" */
-    0x45, 0x55, 0x53, 0x0, 0x5, 0xff, 0xff, 0xe0,
-    0x0, 0x9, 0xff, 0xff, 0x60, 0x0, 0xd, 0xff,
-    0xfe, 0x0, 0x0, 0x3f, 0xff, 0xf6, 0x0, 0x0,
-    0x7f, 0xff, 0xe0, 0x0, 0x0, 0xcf, 0xff, 0x60,
-
+    0x45, 0x5c, 0x60, 0x10, 0xd5, 0x6d, 0x0, 0x95,
+    0x80, 0x21, 0x60, 0xa, 0x48, 0x2, 0x80, 0xd,
+    0xc0, 0x10, 0xb0, 0x4, 0x70, 0x1, 0x40, 0x6,
+    0x73, 0x0, 0xb, 0x0,
     /* U+0061 "a" */
-    0x0, 0x0, 0x27, 0xbd, 0xff, 0xeb, 0x70, 0x0,
-    0x0, 0x0, 0x3, 0xcf, 0xff, 0xff, 0xff, 0xff,
-    0xe5, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf6, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90, 0x0,
-    0x7, 0xfc, 0x74, 0x24, 0x9f, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0x66, 0x0, 0x0, 0x0, 0x5f, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x3, 0x69,
-    0xff, 0xff, 0xff, 0x30, 0x0, 0x0, 0x5, 0xaf,
-    0xff, 0xff, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x6e,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0x0,
-    0xaf, 0xff, 0xff, 0xfd, 0xaf, 0xff, 0xff, 0xf4,
-    0x0, 0x8f, 0xff, 0xff, 0xd3, 0x0, 0xef, 0xff,
-    0xff, 0x40, 0x1f, 0xff, 0xff, 0xf1, 0x0, 0xe,
-    0xff, 0xff, 0xf4, 0x5, 0xff, 0xff, 0xfd, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0x40, 0x7f, 0xff, 0xff,
-    0xe0, 0x0, 0x2f, 0xff, 0xff, 0xf4, 0x6, 0xff,
-    0xff, 0xff, 0xa0, 0x1b, 0xff, 0xff, 0xff, 0x40,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf6, 0x0, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x80, 0x1, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfb, 0x0, 0x3, 0xef, 0xff,
-    0xff, 0xf5, 0xcf, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x8c, 0xfe, 0xa2, 0x7, 0xff, 0xff, 0xff, 0x50,
-
+    0x0, 0xc4, 0xf7, 0xbf, 0xee, 0xb7, 0x0, 0xfc,
+    0x79, 0xb0, 0x84, 0x0, 0x14, 0x8e, 0x50, 0xf,
+    0x21, 0x80, 0x7f, 0xd, 0x30, 0x7, 0xff, 0x1a,
+    0x48, 0x3, 0xff, 0x8d, 0x60, 0x1e, 0x38, 0xbd,
+    0xb6, 0x0, 0xf3, 0x80, 0x61, 0x9c, 0x74, 0x24,
+    0x9a, 0x0, 0xe1, 0x20, 0x9, 0x98, 0x1, 0x8d,
+    0xb0, 0x3, 0xc2, 0x1, 0xe5, 0xaf, 0xc9, 0x60,
+    0xf, 0x38, 0x6, 0x6e, 0xa5, 0x0, 0xff, 0xe1,
+    0x54, 0x88, 0x6, 0x25, 0x0, 0xfe, 0x85, 0x0,
+    0xc5, 0x9b, 0x42, 0x1, 0xf0, 0xb8, 0x7, 0x61,
+    0x80, 0x7f, 0x90, 0x3, 0x88, 0x40, 0x21, 0x0,
+    0xf8, 0x80, 0x38, 0xc0, 0x22, 0x0, 0xfc, 0x20,
+    0x1c, 0x34, 0x3, 0x20, 0x1f, 0x94, 0x3, 0xcb,
+    0xfc, 0x80, 0x1e, 0x20, 0x34, 0x0, 0xff, 0xe1,
+    0xf0, 0x2, 0x80, 0x3f, 0xf8, 0x66, 0x0, 0x1c,
+    0x10, 0xf, 0x51, 0x80, 0x72, 0x0, 0x47, 0xce,
+    0x60, 0x2b, 0xab, 0x60, 0x1e, 0x50,
     /* U+0062 "b" */
-    0xff, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xfb, 0x2, 0xae, 0xfc, 0x70, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0xb3, 0xff, 0xff, 0xff, 0xd1, 0x0,
-    0xf, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff,
-    0xd0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x80, 0xf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x0, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xf, 0xff,
-    0xff, 0xff, 0xa0, 0x1c, 0xff, 0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xff, 0xf1, 0x0, 0x3f, 0xff, 0xff,
-    0xfe, 0xf, 0xff, 0xff, 0xfd, 0x0, 0x0, 0xef,
-    0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xc0, 0x0,
-    0xd, 0xff, 0xff, 0xff, 0x2f, 0xff, 0xff, 0xfb,
-    0x0, 0x0, 0xcf, 0xff, 0xff, 0xf3, 0xff, 0xff,
-    0xff, 0xb0, 0x0, 0xd, 0xff, 0xff, 0xff, 0x2f,
-    0xff, 0xff, 0xfb, 0x0, 0x0, 0xff, 0xff, 0xff,
-    0xf0, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x5f, 0xff,
-    0xff, 0xfc, 0xf, 0xff, 0xff, 0xfe, 0x30, 0x1e,
-    0xff, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff,
-    0xdf, 0xff, 0xff, 0xff, 0xf1, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x0, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x20,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x50, 0x0, 0xff, 0xff, 0xfc, 0x5e, 0xff, 0xff,
-    0xff, 0x60, 0x0, 0xf, 0xff, 0xfd, 0x10, 0x19,
-    0xdf, 0xd9, 0x20, 0x0, 0x0,
-
+    0xff, 0xf5, 0x80, 0x7f, 0xff, 0xc0, 0x3f, 0xff,
+    0xe0, 0x1f, 0xfc, 0xa2, 0xae, 0xfc, 0x70, 0xf,
+    0xfc, 0x7a, 0xa2, 0x7, 0x1a, 0x20, 0x1f, 0xcb,
+    0x80, 0x1e, 0x2c, 0x0, 0xfe, 0x10, 0xf, 0xc5,
+    0x0, 0x1f, 0xfc, 0x66, 0x0, 0xff, 0xe3, 0xb,
+    0x0, 0x7e, 0x5f, 0xe3, 0x0, 0xf5, 0x0, 0x7e,
+    0xb0, 0x1f, 0x0, 0xf1, 0x0, 0x7c, 0x42, 0x0,
+    0x31, 0x0, 0xe1, 0x0, 0xf8, 0x40, 0x31, 0x80,
+    0x78, 0x80, 0x3c, 0xe0, 0x18, 0x40, 0x3c, 0x20,
+    0x1f, 0xf0, 0x80, 0x78, 0x40, 0x3f, 0xe2, 0x0,
+    0xf1, 0x0, 0x7f, 0x94, 0x3, 0xc6, 0x1, 0xf2,
+    0x98, 0xd, 0x80, 0x79, 0x0, 0x3e, 0x1c, 0xde,
+    0x10, 0xf, 0x48, 0x7, 0xf1, 0x0, 0x7c, 0xc2,
+    0x1, 0xff, 0xc5, 0xb0, 0xf, 0xfe, 0x2d, 0x10,
+    0x7, 0xc7, 0x42, 0x1, 0xe9, 0x50, 0xf, 0x8b,
+    0x57, 0xd8, 0x80, 0x9b, 0x58, 0x3,
     /* U+0063 "c" */
-    0x0, 0x0, 0x0, 0x28, 0xce, 0xfd, 0xa5, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xf2, 0x0,
-    0x0, 0xcf, 0xff, 0xff, 0xff, 0xff, 0x20, 0x0,
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x0, 0x6f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x20, 0xe, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf2, 0x5, 0xff, 0xff,
-    0xff, 0xfd, 0x41, 0x29, 0x20, 0xaf, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xf3, 0x0,
-    0x0, 0x0, 0xd, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0xaf, 0xff, 0xff, 0xff, 0x30, 0x0,
-    0x0, 0x5, 0xff, 0xff, 0xff, 0xff, 0x84, 0x7d,
-    0x20, 0xe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2,
-    0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x20,
-    0x0, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x0,
-    0x1, 0xdf, 0xff, 0xff, 0xff, 0xff, 0x20, 0x0,
-    0x1, 0xaf, 0xff, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x39, 0xdf, 0xeb, 0x71, 0x0,
-
+    0x0, 0xf1, 0x46, 0x77, 0xed, 0x28, 0x7, 0xa3,
+    0x5c, 0xc4, 0x9, 0x68, 0x80, 0x36, 0x38, 0x7,
+    0xfe, 0xb3, 0x0, 0xff, 0xcc, 0x80, 0x1f, 0xfc,
+    0x0, 0x80, 0xf, 0xfe, 0x0, 0x28, 0x80, 0x78,
+    0xaf, 0xb5, 0x80, 0x1e, 0x1, 0xe1, 0xd4, 0x12,
+    0x92, 0x7, 0x0, 0xf4, 0x0, 0x7c, 0x40, 0x1e,
+    0x40, 0xf, 0xfe, 0x11, 0x0, 0x7f, 0xf0, 0x8c,
+    0x3, 0xe2, 0x0, 0xf5, 0x80, 0x7c, 0xe0, 0x1e,
+    0x73, 0x0, 0xf7, 0x80, 0x7d, 0x90, 0x8f, 0xa4,
+    0xa, 0x20, 0x1f, 0x3d, 0xc1, 0x0, 0x52, 0x1,
+    0xff, 0xc2, 0x73, 0x0, 0xff, 0xe1, 0x69, 0x0,
+    0x7f, 0xf0, 0x0, 0x71, 0x40, 0x3f, 0xf8, 0x0,
+    0x35, 0x8c, 0x40, 0x29, 0x1c, 0x40,
     /* U+0064 "d" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x2, 0xad, 0xfd, 0x80,
-    0xaf, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xfd, 0xdf, 0xff, 0xff, 0xf2, 0x0, 0x6,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2,
-    0x0, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf2, 0x0, 0x9f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf2, 0x1, 0xff, 0xff, 0xff,
-    0xfe, 0xbf, 0xff, 0xff, 0xff, 0xf2, 0x7, 0xff,
-    0xff, 0xff, 0xd0, 0x1, 0xef, 0xff, 0xff, 0xf2,
-    0xb, 0xff, 0xff, 0xff, 0x40, 0x0, 0xaf, 0xff,
-    0xff, 0xf2, 0xe, 0xff, 0xff, 0xff, 0x0, 0x0,
-    0xaf, 0xff, 0xff, 0xf2, 0xf, 0xff, 0xff, 0xfd,
-    0x0, 0x0, 0xaf, 0xff, 0xff, 0xf2, 0xf, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xf2,
-    0xf, 0xff, 0xff, 0xfe, 0x0, 0x0, 0xbf, 0xff,
-    0xff, 0xf2, 0xf, 0xff, 0xff, 0xff, 0x10, 0x0,
-    0xcf, 0xff, 0xff, 0xf2, 0xc, 0xff, 0xff, 0xff,
-    0x60, 0x0, 0xff, 0xff, 0xff, 0xf2, 0x8, 0xff,
-    0xff, 0xff, 0xf4, 0x1a, 0xff, 0xff, 0xff, 0xf2,
-    0x2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf2, 0x0, 0xbf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf2, 0x0, 0x4f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x0, 0xa,
-    0xff, 0xff, 0xff, 0xff, 0xcf, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0xaf, 0xff, 0xff, 0xf8, 0x3f, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x5, 0xcf, 0xeb, 0x40,
-    0xf, 0xff, 0xff, 0xf2,
-
+    0x0, 0xff, 0xd5, 0xff, 0xe2, 0x0, 0xff, 0xff,
+    0x80, 0x7f, 0xff, 0xc0, 0x3f, 0xf8, 0x65, 0x5b,
+    0xfb, 0x0, 0x1f, 0xfc, 0x0, 0x7d, 0x52, 0x2,
+    0x7d, 0x70, 0xf, 0xf3, 0x40, 0x7, 0x88, 0x80,
+    0x1f, 0xc5, 0x20, 0x1f, 0xfc, 0x6b, 0x0, 0xff,
+    0xe3, 0xb, 0x0, 0x78, 0x50, 0x3, 0xfc, 0xc0,
+    0x1e, 0x2e, 0xbe, 0x10, 0xf, 0xd8, 0x1, 0xe9,
+    0x0, 0xa, 0x0, 0x7e, 0x50, 0xf, 0x20, 0x7,
+    0xfe, 0x10, 0xe, 0x20, 0xf, 0xfe, 0x38, 0x80,
+    0x7f, 0xf1, 0xc8, 0x3, 0x8, 0x7, 0xff, 0x8,
+    0x44, 0x1, 0x38, 0x7, 0xe3, 0x0, 0xf3, 0x80,
+    0x46, 0x1, 0xf9, 0x0, 0x3d, 0x28, 0x34, 0x1,
+    0xfd, 0x40, 0x1f, 0x5f, 0x28, 0x7, 0xf1, 0x20,
+    0x7, 0xff, 0x1f, 0xc0, 0x3f, 0xf8, 0xe8, 0xa0,
+    0x1f, 0x8c, 0x3, 0xfd, 0x4a, 0x1, 0xe7, 0xf0,
+    0xf, 0xfa, 0xa8, 0x60, 0x29, 0x70, 0x60, 0x1f,
     /* U+0065 "e" */
-    0x0, 0x0, 0x1, 0x6b, 0xef, 0xec, 0x83, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff,
-    0xf9, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x9, 0xff, 0xff,
-    0xff, 0xef, 0xff, 0xff, 0xf9, 0x0, 0x4, 0xff,
-    0xff, 0xfe, 0x20, 0x1b, 0xff, 0xff, 0xf2, 0x0,
-    0xcf, 0xff, 0xff, 0x40, 0x0, 0x1f, 0xff, 0xff,
-    0x90, 0x3f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0xcf,
-    0xff, 0xfd, 0x8, 0xff, 0xff, 0xff, 0xaa, 0xaa,
-    0xae, 0xff, 0xff, 0xf1, 0xbf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x2d, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xef,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x3d, 0xff, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xff, 0xff, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x13, 0x8, 0xff, 0xff, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x2d, 0x60, 0x3f, 0xff, 0xff,
-    0xff, 0xf5, 0x0, 0x1, 0x8f, 0xf6, 0x0, 0xdf,
-    0xff, 0xff, 0xff, 0xff, 0xcd, 0xff, 0xff, 0x60,
-    0x4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf6, 0x0, 0x9, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x60, 0x0, 0x9, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x6, 0xef,
-    0xff, 0xff, 0xff, 0xff, 0xb3, 0x0, 0x0, 0x0,
-    0x0, 0x5a, 0xdf, 0xfd, 0xb7, 0x20, 0x0, 0x0,
-
+    0x0, 0xe1, 0x6b, 0xef, 0xec, 0x83, 0x0, 0xfe,
+    0x7e, 0x94, 0x10, 0x13, 0x7c, 0x90, 0xf, 0xaa,
+    0x0, 0x3f, 0x9b, 0x0, 0x3a, 0x54, 0x3, 0x84,
+    0x3, 0x8e, 0x40, 0x24, 0x60, 0xc, 0x3b, 0xdc,
+    0x40, 0xc, 0xc4, 0x0, 0x80, 0xe, 0xa2, 0x1,
+    0xa0, 0xe, 0xb0, 0x33, 0x0, 0x72, 0x0, 0x42,
+    0x60, 0x19, 0x2, 0xc0, 0x3d, 0x55, 0xc4, 0x1,
+    0x88, 0x4c, 0x3, 0xca, 0xbc, 0x20, 0x1c, 0x6c,
+    0x1, 0xff, 0xc5, 0x13, 0x0, 0xff, 0xe3, 0x18,
+    0x7, 0xab, 0xff, 0xfc, 0x6c, 0x1, 0xee, 0x0,
+    0xfc, 0x26, 0x6, 0x1, 0xe4, 0x40, 0x7, 0x8b,
+    0x14, 0x2c, 0x3, 0xeb, 0x50, 0x8, 0x63, 0x48,
+    0x0, 0x64, 0x1, 0xf5, 0x7e, 0x6f, 0x38, 0x7,
+    0x48, 0x7, 0xf1, 0x90, 0x7, 0xc8, 0xc0, 0x1f,
+    0xfc, 0x69, 0x60, 0xf, 0xfe, 0x0, 0x18, 0x6,
+    0x99, 0x8, 0x7, 0xf2, 0x62, 0x80, 0x73, 0x75,
+    0x29, 0x0, 0x9, 0x23, 0x6c, 0xc0, 0x0,
     /* U+0066 "f" */
-    0x0, 0x0, 0x0, 0x7b, 0xef, 0xdb, 0x60, 0x0,
-    0x4, 0xef, 0xff, 0xff, 0xfe, 0x0, 0x2, 0xff,
-    0xff, 0xff, 0xff, 0xe0, 0x0, 0xbf, 0xff, 0xff,
-    0xff, 0xfe, 0x0, 0xe, 0xff, 0xff, 0xff, 0xff,
-    0xe0, 0x1, 0xff, 0xff, 0xff, 0xff, 0xde, 0x0,
-    0x2f, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x2, 0xff,
-    0xff, 0xff, 0xa0, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0xfa, 0x0, 0xa, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xea,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xaf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xea, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x0, 0x2f, 0xff, 0xff, 0xfa,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0xa0, 0x0,
-    0x0, 0x2f, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x2,
-    0xff, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0xfa, 0x0, 0x0, 0x2, 0xff, 0xff, 0xff,
-    0xa0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xfa, 0x0,
-    0x0, 0x2, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x2, 0xff,
-    0xff, 0xff, 0xa0, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0xfa, 0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0xa0,
-    0x0, 0x0, 0x2f, 0xff, 0xff, 0xfa, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x2f,
-    0xff, 0xff, 0xfa, 0x0, 0x0, 0x2, 0xff, 0xff,
-    0xff, 0xa0, 0x0,
-
+    0x0, 0xf3, 0xdf, 0x7e, 0xdb, 0x0, 0x64, 0xe8,
+    0x41, 0x2, 0x48, 0x0, 0x8a, 0xc4, 0x3, 0xfd,
+    0x20, 0x1f, 0xf9, 0x40, 0x3f, 0xe1, 0x10, 0x7,
+    0xc4, 0x1, 0x18, 0x7, 0x87, 0xf7, 0x80, 0x3f,
+    0x90, 0x3, 0xff, 0x89, 0x5f, 0xa0, 0x1e, 0x5f,
+    0xf7, 0x0, 0x7f, 0xfa, 0x2b, 0xf4, 0x3, 0xcb,
+    0xfe, 0xe0, 0xf, 0xff, 0xf8, 0x7, 0xff, 0xfc,
+    0x3, 0xff, 0xc2,
     /* U+0067 "g" */
-    0x0, 0x0, 0x1, 0x9d, 0xfe, 0xb4, 0x1, 0xdf,
-    0xff, 0xf2, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xff,
-    0xae, 0xff, 0xff, 0xf2, 0x0, 0x4, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x0, 0xe,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2,
-    0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf2, 0x0, 0xef, 0xff, 0xff, 0xff, 0xcf,
-    0xff, 0xff, 0xff, 0xf2, 0x5, 0xff, 0xff, 0xff,
-    0xe1, 0x1, 0xdf, 0xff, 0xff, 0xf2, 0xa, 0xff,
-    0xff, 0xff, 0x60, 0x0, 0xaf, 0xff, 0xff, 0xf2,
-    0xd, 0xff, 0xff, 0xff, 0x10, 0x0, 0xaf, 0xff,
-    0xff, 0xf2, 0xf, 0xff, 0xff, 0xff, 0x0, 0x0,
-    0xaf, 0xff, 0xff, 0xf2, 0xf, 0xff, 0xff, 0xff,
-    0x0, 0x0, 0xaf, 0xff, 0xff, 0xf2, 0xf, 0xff,
-    0xff, 0xff, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xf2,
-    0xe, 0xff, 0xff, 0xff, 0x20, 0x0, 0xcf, 0xff,
-    0xff, 0xf2, 0xb, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0xff, 0xff, 0xff, 0xf2, 0x8, 0xff, 0xff, 0xff,
-    0xf4, 0xa, 0xff, 0xff, 0xff, 0xf2, 0x2, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2,
-    0x0, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf2, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf2, 0x0, 0x8, 0xff, 0xff,
-    0xff, 0xff, 0xef, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x9f, 0xff, 0xff, 0xf7, 0xaf, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x4, 0xbe, 0xeb, 0x40, 0xaf, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xff, 0xff, 0xf1, 0x0, 0x40, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xff, 0xf0, 0x0, 0xad,
-    0x30, 0x0, 0x0, 0x1c, 0xff, 0xff, 0xff, 0xb0,
-    0x0, 0xaf, 0xfc, 0x63, 0x47, 0xef, 0xff, 0xff,
-    0xff, 0x70, 0x0, 0xaf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x10, 0x0, 0xaf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0xaf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x0,
-    0x0, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd,
-    0x10, 0x0, 0x0, 0x29, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x91, 0x0, 0x0, 0x0, 0x0, 0x5, 0xad,
-    0xef, 0xec, 0x82, 0x0, 0x0, 0x0,
-
+    0x0, 0xe1, 0x9d, 0xfe, 0xb4, 0x1, 0xdf, 0xfc,
+    0x40, 0x19, 0x79, 0x88, 0x5, 0x2e, 0xbc, 0x80,
+    0x3f, 0x25, 0x0, 0x7c, 0xa2, 0x1, 0xfd, 0x40,
+    0x1f, 0xfc, 0x67, 0x10, 0xf, 0xfe, 0x34, 0x80,
+    0x7c, 0x60, 0x1f, 0xe5, 0x10, 0xe, 0x1e, 0xce,
+    0x20, 0xf, 0xde, 0x1, 0xe8, 0x10, 0x17, 0x0,
+    0xfc, 0xe0, 0x1e, 0x70, 0xf, 0xfc, 0x40, 0x1e,
+    0x10, 0xf, 0xff, 0x40, 0x80, 0x78, 0x80, 0x26,
+    0x0, 0xfc, 0xa0, 0x1e, 0xa0, 0x8, 0xc0, 0x3f,
+    0x18, 0x7, 0x9d, 0x2, 0x80, 0x3f, 0xa8, 0x3,
+    0xeb, 0xf5, 0x0, 0xfe, 0x25, 0x0, 0xff, 0xe3,
+    0xc8, 0x7, 0xff, 0x1c, 0xdc, 0x3, 0xf0, 0x80,
+    0x7f, 0xa1, 0x80, 0x3d, 0x8, 0x1, 0xff, 0x4d,
+    0xa0, 0x89, 0x2d, 0xc0, 0x3f, 0xf8, 0x0, 0x97,
+    0xdc, 0xb4, 0x7, 0x0, 0xf1, 0x80, 0x10, 0x3,
+    0xf1, 0x90, 0x7, 0x84, 0x1, 0xda, 0x60, 0x1c,
+    0x3e, 0x1, 0xe4, 0x0, 0xc5, 0x98, 0x63, 0x47,
+    0xf3, 0x0, 0xf6, 0x0, 0x78, 0xe7, 0x2e, 0x4,
+    0x3, 0xe6, 0x0, 0xff, 0xe3, 0x38, 0x80, 0x7f,
+    0xf1, 0x4a, 0x0, 0x3f, 0xf8, 0xa5, 0x80, 0x1d,
+    0xc, 0x1, 0xfe, 0x6c, 0x10, 0xe, 0x29, 0xfa,
+    0x52, 0x10, 0x13, 0x7d, 0x91, 0x0, 0xc0,
     /* U+0068 "h" */
-    0xef, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0xfe,
-    0x2, 0xad, 0xfd, 0x80, 0x0, 0xef, 0xff, 0xff,
-    0xe5, 0xff, 0xff, 0xff, 0xd2, 0xe, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xef, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5e, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xef,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde,
-    0xff, 0xff, 0xff, 0xb0, 0x4f, 0xff, 0xff, 0xff,
-    0xef, 0xff, 0xff, 0xf4, 0x0, 0xef, 0xff, 0xff,
-    0xfe, 0xff, 0xff, 0xff, 0x10, 0xd, 0xff, 0xff,
-    0xff, 0xef, 0xff, 0xff, 0xf0, 0x0, 0xdf, 0xff,
-    0xff, 0xfe, 0xff, 0xff, 0xfe, 0x0, 0xd, 0xff,
-    0xff, 0xff, 0xef, 0xff, 0xff, 0xe0, 0x0, 0xdf,
-    0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0x0, 0xd,
-    0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0xe0, 0x0,
-    0xdf, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0x0,
-    0xd, 0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0xe0,
-    0x0, 0xdf, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe,
-    0x0, 0xd, 0xff, 0xff, 0xff, 0xef, 0xff, 0xff,
-    0xe0, 0x0, 0xdf, 0xff, 0xff, 0xfe, 0xff, 0xff,
-    0xfe, 0x0, 0xd, 0xff, 0xff, 0xff, 0xef, 0xff,
-    0xff, 0xe0, 0x0, 0xdf, 0xff, 0xff, 0xfe, 0xff,
-    0xff, 0xfe, 0x0, 0xd, 0xff, 0xff, 0xff,
-
+    0xef, 0xfe, 0xe0, 0xf, 0xff, 0xf8, 0x7, 0xff,
+    0xfc, 0x3, 0x15, 0x6f, 0xec, 0x0, 0x7f, 0x97,
+    0x54, 0x80, 0x9f, 0x48, 0x3, 0xe1, 0xa0, 0xf,
+    0x17, 0x0, 0x7f, 0xf1, 0xd, 0x40, 0x3f, 0xf8,
+    0x9e, 0x1, 0xff, 0xc4, 0x70, 0xf, 0x93, 0xec,
+    0x3, 0xc4, 0x1, 0xf7, 0x82, 0x8, 0x7, 0xff,
+    0x0, 0x14, 0x0, 0x60, 0x1f, 0xfc, 0x0, 0x10,
+    0xf, 0xfe, 0x18, 0x80, 0x7f, 0xff, 0xc0, 0x3f,
+    0xff, 0xe0, 0x1f, 0xfd, 0x20,
     /* U+0069 "i" */
-    0x3, 0xbf, 0xd7, 0x0, 0x3f, 0xff, 0xff, 0x90,
-    0xbf, 0xff, 0xff, 0xf2, 0xef, 0xff, 0xff, 0xf5,
-    0xcf, 0xff, 0xff, 0xf3, 0x5f, 0xff, 0xff, 0xc0,
-    0x7, 0xff, 0xfb, 0x10, 0x0, 0x3, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xf0,
-    0xbf, 0xff, 0xff, 0xf0, 0xbf, 0xff, 0xff, 0xf0,
-    0xbf, 0xff, 0xff, 0xf0, 0xbf, 0xff, 0xff, 0xf0,
-    0xbf, 0xff, 0xff, 0xf0, 0xbf, 0xff, 0xff, 0xf0,
-    0xbf, 0xff, 0xff, 0xf0, 0xbf, 0xff, 0xff, 0xf0,
-    0xbf, 0xff, 0xff, 0xf0, 0xbf, 0xff, 0xff, 0xf0,
-    0xbf, 0xff, 0xff, 0xf0, 0xbf, 0xff, 0xff, 0xf0,
-    0xbf, 0xff, 0xff, 0xf0, 0xbf, 0xff, 0xff, 0xf0,
-    0xbf, 0xff, 0xff, 0xf0, 0xbf, 0xff, 0xff, 0xf0,
-    0xbf, 0xff, 0xff, 0xf0, 0xbf, 0xff, 0xff, 0xf0,
-    0xbf, 0xff, 0xff, 0xf0, 0xbf, 0xff, 0xff, 0xf0,
-
+    0x3, 0xbf, 0xd7, 0x0, 0x1e, 0x20, 0x14, 0x48,
+    0x40, 0x7, 0x31, 0x28, 0x7, 0x9c, 0x80, 0x3c,
+    0xd2, 0x1, 0xc6, 0x65, 0x80, 0x9, 0x34, 0x0,
+    0xff, 0x9d, 0x62, 0x1, 0x8c, 0x40, 0x2b, 0xff,
+    0xf0, 0x7, 0xff, 0xfc, 0x3, 0xff, 0xfe, 0x1,
+    0xff,
     /* U+006A "j" */
-    0x0, 0x0, 0x3, 0xbf, 0xd7, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0x90, 0x0, 0x0, 0xbf, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0xef, 0xff, 0xff, 0xf5,
-    0x0, 0x0, 0xcf, 0xff, 0xff, 0xf3, 0x0, 0x0,
-    0x5f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x7, 0xff,
-    0xfb, 0x10, 0x0, 0x0, 0x0, 0x3, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xff, 0xff, 0xf0, 0x0, 0x0, 0xbf, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0xbf, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0xbf, 0xff, 0xff, 0xf0, 0x0, 0x0, 0xbf, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0xbf, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0xbf, 0xff, 0xff, 0xf0, 0x0, 0x0, 0xbf, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0xbf, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0xbf, 0xff, 0xff, 0xf0, 0x0, 0x0, 0xbf, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0xbf, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0xbf, 0xff, 0xff, 0xf0, 0x0, 0x0, 0xbf, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0xbf, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0xbf, 0xff, 0xff, 0xf0, 0x0, 0x0, 0xbf, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0xef, 0xff, 0xff, 0xf0, 0x2, 0x3,
-    0xff, 0xff, 0xff, 0xe0, 0xf, 0xef, 0xff, 0xff,
-    0xff, 0xc0, 0xf, 0xff, 0xff, 0xff, 0xff, 0x90,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0x40, 0xf, 0xff,
-    0xff, 0xff, 0xfb, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0xd1, 0x0, 0x6, 0xce, 0xfe, 0xc6, 0x0, 0x0,
-
+    0x0, 0xe3, 0xbf, 0xd7, 0x0, 0xf1, 0xe2, 0x1,
+    0x44, 0x80, 0x74, 0x0, 0x73, 0x10, 0x6, 0x50,
+    0xf, 0x38, 0x6, 0x20, 0xf, 0x30, 0x6, 0x90,
+    0xe, 0x33, 0x0, 0x65, 0x80, 0x9, 0x34, 0x3,
+    0xcf, 0xf9, 0xd6, 0x20, 0x1f, 0x8c, 0x40, 0x3e,
+    0xbf, 0xff, 0x0, 0x7f, 0xff, 0xc0, 0x3f, 0xff,
+    0xe0, 0x1f, 0xff, 0xf0, 0xf, 0xfe, 0xa3, 0x80,
+    0x7f, 0xc4, 0x1, 0xf8, 0x80, 0xc4, 0x3, 0x84,
+    0x1, 0xbd, 0x80, 0x1e, 0x20, 0x8, 0x40, 0x3e,
+    0x50, 0xf, 0xfb, 0x40, 0x3f, 0xc8, 0x80, 0xf,
+    0xe2, 0xa0, 0xa, 0x4c, 0x40, 0x4e, 0x74, 0x40,
+    0x0,
     /* U+006B "k" */
-    0xef, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xff, 0xff, 0xe0, 0x1, 0xff, 0xff,
-    0xff, 0x30, 0xef, 0xff, 0xff, 0xe0, 0x9, 0xff,
-    0xff, 0xf8, 0x0, 0xef, 0xff, 0xff, 0xe0, 0x1f,
-    0xff, 0xff, 0xd0, 0x0, 0xef, 0xff, 0xff, 0xe0,
-    0x9f, 0xff, 0xff, 0x30, 0x0, 0xef, 0xff, 0xff,
-    0xe1, 0xff, 0xff, 0xf8, 0x0, 0x0, 0xef, 0xff,
-    0xff, 0xe8, 0xff, 0xff, 0xd0, 0x0, 0x0, 0xef,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x0,
-    0x0, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6,
-    0x0, 0x0, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfb, 0x0, 0x0, 0xef, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x10, 0x0, 0xef, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x50, 0x0, 0xef, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xa0, 0x0, 0xef, 0xff,
-    0xff, 0xf9, 0xff, 0xff, 0xff, 0xf0, 0x0, 0xef,
-    0xff, 0xff, 0xf0, 0xbf, 0xff, 0xff, 0xf5, 0x0,
-    0xef, 0xff, 0xff, 0xe0, 0x6f, 0xff, 0xff, 0xfa,
-    0x0, 0xef, 0xff, 0xff, 0xe0, 0x2f, 0xff, 0xff,
-    0xfe, 0x0, 0xef, 0xff, 0xff, 0xe0, 0xd, 0xff,
-    0xff, 0xff, 0x40, 0xef, 0xff, 0xff, 0xe0, 0x9,
-    0xff, 0xff, 0xff, 0x90, 0xef, 0xff, 0xff, 0xe0,
-    0x4, 0xff, 0xff, 0xff, 0xe0, 0xef, 0xff, 0xff,
-    0xe0, 0x0, 0xff, 0xff, 0xff, 0xf3,
-
+    0xef, 0xfe, 0xe0, 0xf, 0xff, 0xf8, 0x7, 0xff,
+    0xfc, 0x3, 0xff, 0x84, 0x3f, 0xfe, 0x30, 0xf,
+    0xf4, 0x0, 0x73, 0x98, 0x7, 0xf0, 0xb0, 0x6,
+    0x28, 0x0, 0xff, 0x40, 0x7, 0x70, 0x7, 0xf8,
+    0x58, 0x3, 0x39, 0x80, 0x7f, 0xa4, 0x3, 0x14,
+    0x0, 0x7f, 0x85, 0xc0, 0x30, 0x80, 0x7f, 0xf1,
+    0x4c, 0x40, 0x3f, 0xf8, 0xae, 0x1, 0xff, 0xc5,
+    0xd0, 0xf, 0xfe, 0x2a, 0x8, 0x7, 0xff, 0x15,
+    0x0, 0x3f, 0xf8, 0xbe, 0x1, 0xfe, 0x60, 0xf,
+    0x28, 0x7, 0xfa, 0x50, 0x3, 0xca, 0x1, 0xf8,
+    0x43, 0x40, 0x3d, 0xe0, 0x1f, 0xe4, 0x0, 0xf2,
+    0x0, 0x7f, 0x88, 0x80, 0x1c, 0x28, 0x1, 0xfe,
+    0x40, 0xf, 0x68, 0x7, 0xfb, 0x40, 0x3c, 0xe0,
+    0x1f, 0xe4, 0x0, 0xf0, 0x98,
     /* U+006C "l" */
-    0xbf, 0xff, 0xff, 0xf1, 0xbf, 0xff, 0xff, 0xf1,
-    0xbf, 0xff, 0xff, 0xf1, 0xbf, 0xff, 0xff, 0xf1,
-    0xbf, 0xff, 0xff, 0xf1, 0xbf, 0xff, 0xff, 0xf1,
-    0xbf, 0xff, 0xff, 0xf1, 0xbf, 0xff, 0xff, 0xf1,
-    0xbf, 0xff, 0xff, 0xf1, 0xbf, 0xff, 0xff, 0xf1,
-    0xbf, 0xff, 0xff, 0xf1, 0xbf, 0xff, 0xff, 0xf1,
-    0xbf, 0xff, 0xff, 0xf1, 0xbf, 0xff, 0xff, 0xf1,
-    0xbf, 0xff, 0xff, 0xf1, 0xbf, 0xff, 0xff, 0xf1,
-    0xbf, 0xff, 0xff, 0xf1, 0xbf, 0xff, 0xff, 0xf1,
-    0xbf, 0xff, 0xff, 0xf1, 0xbf, 0xff, 0xff, 0xf1,
-    0xbf, 0xff, 0xff, 0xf1, 0xbf, 0xff, 0xff, 0xf1,
-    0xbf, 0xff, 0xff, 0xf1, 0xbf, 0xff, 0xff, 0xf1,
-    0xbf, 0xff, 0xff, 0xf1, 0xbf, 0xff, 0xff, 0xf1,
-    0xbf, 0xff, 0xff, 0xf1, 0xbf, 0xff, 0xff, 0xf1,
-    0xbf, 0xff, 0xff, 0xf1, 0xbf, 0xff, 0xff, 0xf1,
-
+    0xbf, 0xff, 0x8, 0x7, 0xff, 0xfc, 0x3, 0xff,
+    0xfe, 0x1, 0xff, 0xff, 0x0, 0xf8,
     /* U+006D "m" */
-    0xef, 0xff, 0xff, 0x20, 0x3a, 0xdf, 0xc8, 0x0,
-    0x0, 0x4b, 0xef, 0xd8, 0x0, 0x0, 0xef, 0xff,
-    0xff, 0x76, 0xff, 0xff, 0xff, 0xd1, 0x9, 0xff,
-    0xff, 0xff, 0xc1, 0x0, 0xef, 0xff, 0xff, 0xef,
-    0xff, 0xff, 0xff, 0xfb, 0x8f, 0xff, 0xff, 0xff,
-    0xfc, 0x0, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40,
-    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0xef, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xd0, 0xef, 0xff, 0xff, 0xfc,
-    0x14, 0xff, 0xff, 0xff, 0xfc, 0x14, 0xff, 0xff,
-    0xff, 0xf0, 0xef, 0xff, 0xff, 0xf3, 0x0, 0xef,
-    0xff, 0xff, 0xf5, 0x0, 0xef, 0xff, 0xff, 0xf1,
-    0xef, 0xff, 0xff, 0xf0, 0x0, 0xdf, 0xff, 0xff,
-    0xf2, 0x0, 0xbf, 0xff, 0xff, 0xf1, 0xef, 0xff,
-    0xff, 0xf0, 0x0, 0xcf, 0xff, 0xff, 0xf0, 0x0,
-    0xbf, 0xff, 0xff, 0xf1, 0xef, 0xff, 0xff, 0xe0,
-    0x0, 0xcf, 0xff, 0xff, 0xf0, 0x0, 0xbf, 0xff,
-    0xff, 0xf1, 0xef, 0xff, 0xff, 0xe0, 0x0, 0xcf,
-    0xff, 0xff, 0xf0, 0x0, 0xbf, 0xff, 0xff, 0xf1,
-    0xef, 0xff, 0xff, 0xe0, 0x0, 0xcf, 0xff, 0xff,
-    0xf0, 0x0, 0xbf, 0xff, 0xff, 0xf1, 0xef, 0xff,
-    0xff, 0xe0, 0x0, 0xcf, 0xff, 0xff, 0xf0, 0x0,
-    0xbf, 0xff, 0xff, 0xf1, 0xef, 0xff, 0xff, 0xe0,
-    0x0, 0xcf, 0xff, 0xff, 0xf0, 0x0, 0xbf, 0xff,
-    0xff, 0xf1, 0xef, 0xff, 0xff, 0xe0, 0x0, 0xcf,
-    0xff, 0xff, 0xf0, 0x0, 0xbf, 0xff, 0xff, 0xf1,
-    0xef, 0xff, 0xff, 0xe0, 0x0, 0xcf, 0xff, 0xff,
-    0xf0, 0x0, 0xbf, 0xff, 0xff, 0xf1, 0xef, 0xff,
-    0xff, 0xe0, 0x0, 0xcf, 0xff, 0xff, 0xf0, 0x0,
-    0xbf, 0xff, 0xff, 0xf1, 0xef, 0xff, 0xff, 0xe0,
-    0x0, 0xcf, 0xff, 0xff, 0xf0, 0x0, 0xbf, 0xff,
-    0xff, 0xf1, 0xef, 0xff, 0xff, 0xe0, 0x0, 0xcf,
-    0xff, 0xff, 0xf0, 0x0, 0xbf, 0xff, 0xff, 0xf1,
-    0xef, 0xff, 0xff, 0xe0, 0x0, 0xcf, 0xff, 0xff,
-    0xf0, 0x0, 0xbf, 0xff, 0xff, 0xf1,
-
+    0xef, 0xfe, 0x20, 0x3a, 0xdf, 0xc8, 0x0, 0xc9,
+    0x7d, 0xfb, 0x0, 0x1f, 0xe5, 0x6c, 0x52, 0x3,
+    0x7d, 0x10, 0x9b, 0x41, 0x2, 0x7c, 0x10, 0xf,
+    0xd3, 0x20, 0xf, 0x15, 0x43, 0x0, 0x78, 0xf4,
+    0x3, 0xf0, 0x80, 0x7e, 0x47, 0x0, 0xfc, 0x68,
+    0x1, 0xff, 0xcf, 0xf0, 0xf, 0xfe, 0x7b, 0x0,
+    0x7e, 0x3e, 0xb0, 0xf, 0x8f, 0xac, 0x3, 0xc4,
+    0x1, 0xfb, 0xc5, 0x4, 0x3, 0xd2, 0x28, 0x20,
+    0x1e, 0x10, 0xf, 0x8c, 0x0, 0x60, 0x1e, 0x70,
+    0x2, 0x80, 0x7f, 0xf1, 0x44, 0x3, 0xc4, 0x1,
+    0xff, 0xc4, 0x10, 0xf, 0xff, 0xf8, 0x7, 0xff,
+    0xfc, 0x3, 0xff, 0xfe, 0x1, 0xff, 0xff, 0x0,
     /* U+006E "n" */
-    0xef, 0xff, 0xff, 0x30, 0x4b, 0xef, 0xd8, 0x0,
-    0x0, 0xef, 0xff, 0xff, 0x78, 0xff, 0xff, 0xff,
-    0xd2, 0x0, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfd, 0x0, 0xef, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x60, 0xef, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xb0, 0xef, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0xef, 0xff,
-    0xff, 0xfb, 0x2, 0xff, 0xff, 0xff, 0xf0, 0xef,
-    0xff, 0xff, 0xf3, 0x0, 0xdf, 0xff, 0xff, 0xf0,
-    0xef, 0xff, 0xff, 0xf0, 0x0, 0xcf, 0xff, 0xff,
-    0xf0, 0xef, 0xff, 0xff, 0xf0, 0x0, 0xcf, 0xff,
-    0xff, 0xf0, 0xef, 0xff, 0xff, 0xe0, 0x0, 0xcf,
-    0xff, 0xff, 0xf0, 0xef, 0xff, 0xff, 0xe0, 0x0,
-    0xcf, 0xff, 0xff, 0xf0, 0xef, 0xff, 0xff, 0xe0,
-    0x0, 0xcf, 0xff, 0xff, 0xf0, 0xef, 0xff, 0xff,
-    0xe0, 0x0, 0xcf, 0xff, 0xff, 0xf0, 0xef, 0xff,
-    0xff, 0xe0, 0x0, 0xcf, 0xff, 0xff, 0xf0, 0xef,
-    0xff, 0xff, 0xe0, 0x0, 0xcf, 0xff, 0xff, 0xf0,
-    0xef, 0xff, 0xff, 0xe0, 0x0, 0xcf, 0xff, 0xff,
-    0xf0, 0xef, 0xff, 0xff, 0xe0, 0x0, 0xcf, 0xff,
-    0xff, 0xf0, 0xef, 0xff, 0xff, 0xe0, 0x0, 0xcf,
-    0xff, 0xff, 0xf0, 0xef, 0xff, 0xff, 0xe0, 0x0,
-    0xcf, 0xff, 0xff, 0xf0, 0xef, 0xff, 0xff, 0xe0,
-    0x0, 0xcf, 0xff, 0xff, 0xf0,
-
+    0xef, 0xfe, 0x30, 0x4b, 0xef, 0xd8, 0x0, 0xff,
+    0x24, 0x5a, 0x8, 0x13, 0xe9, 0x0, 0x7e, 0x87,
+    0x0, 0xf1, 0x78, 0x7, 0xff, 0x14, 0x98, 0x3,
+    0xff, 0x8b, 0xa0, 0x1f, 0xfc, 0x55, 0x0, 0xfc,
+    0x9f, 0xa0, 0x1e, 0x10, 0xf, 0xd0, 0x4, 0x40,
+    0xf, 0xfe, 0x11, 0x80, 0x4, 0x3, 0xff, 0xa6,
+    0x20, 0x1f, 0xff, 0xf0, 0xf, 0xff, 0xf8, 0x7,
+    0xff, 0x74,
     /* U+006F "o" */
-    0x0, 0x0, 0x1, 0x7b, 0xef, 0xed, 0x94, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xc3, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x50, 0x0, 0x0, 0x9f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x0,
-    0x4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfd, 0x0, 0xb, 0xff, 0xff, 0xff, 0xc5, 0x9f,
-    0xff, 0xff, 0xff, 0x50, 0x2f, 0xff, 0xff, 0xff,
-    0x10, 0x8, 0xff, 0xff, 0xff, 0xb0, 0x6f, 0xff,
-    0xff, 0xf9, 0x0, 0x1, 0xff, 0xff, 0xff, 0xf0,
-    0x9f, 0xff, 0xff, 0xf6, 0x0, 0x0, 0xdf, 0xff,
-    0xff, 0xf2, 0xaf, 0xff, 0xff, 0xf4, 0x0, 0x0,
-    0xbf, 0xff, 0xff, 0xf4, 0xbf, 0xff, 0xff, 0xf3,
-    0x0, 0x0, 0xbf, 0xff, 0xff, 0xf4, 0xbf, 0xff,
-    0xff, 0xf4, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xf3,
-    0xaf, 0xff, 0xff, 0xf6, 0x0, 0x0, 0xdf, 0xff,
-    0xff, 0xf2, 0x7f, 0xff, 0xff, 0xf9, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0xe0, 0x3f, 0xff, 0xff, 0xff,
-    0x10, 0x7, 0xff, 0xff, 0xff, 0xb0, 0xd, 0xff,
-    0xff, 0xff, 0xc5, 0x7f, 0xff, 0xff, 0xff, 0x40,
-    0x5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf2, 0x0, 0x0, 0xc, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x8f, 0xff, 0xff, 0xff, 0xff, 0xc2, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0x7c, 0xef, 0xed, 0x94, 0x0,
-    0x0, 0x0,
-
+    0x0, 0xe1, 0x7b, 0xef, 0xed, 0x94, 0x0, 0xff,
+    0x3f, 0x42, 0x8, 0x9, 0x35, 0xe1, 0x80, 0x7d,
+    0x50, 0x1, 0xfc, 0x78, 0xa0, 0x1d, 0x2a, 0x1,
+    0xff, 0xa8, 0xc0, 0x24, 0x60, 0xf, 0xfe, 0x17,
+    0x0, 0x5e, 0x1, 0xe3, 0xa6, 0x0, 0xf1, 0x28,
+    0x12, 0x0, 0x7b, 0x56, 0x5c, 0x3, 0xdc, 0x8,
+    0x1, 0xe6, 0x10, 0x4, 0x80, 0x79, 0x3, 0xc0,
+    0x3d, 0xe0, 0x10, 0x90, 0x7, 0x88, 0xc0, 0x3c,
+    0x40, 0x19, 0x80, 0x3c, 0xc2, 0x1, 0xe7, 0x0,
+    0xff, 0xe3, 0xb8, 0x7, 0xfc, 0xe2, 0x1, 0xe2,
+    0x0, 0xcc, 0x1, 0xe1, 0xd0, 0xf, 0x78, 0x6,
+    0x20, 0xe, 0x12, 0x40, 0xf, 0x30, 0x80, 0x1c,
+    0x3, 0xca, 0x6, 0x40, 0x1e, 0xd5, 0x78, 0x0,
+    0xf7, 0x80, 0x20, 0x3, 0xc7, 0x50, 0x1, 0xe3,
+    0x40, 0x2, 0xa8, 0x3, 0xff, 0x85, 0xc0, 0x1a,
+    0x8c, 0x3, 0xff, 0x59, 0x0, 0x76, 0x38, 0x7,
+    0xf1, 0xea, 0x0, 0x7d, 0x1b, 0x6, 0x20, 0x24,
+    0xd7, 0x84, 0x1, 0x80,
     /* U+0070 "p" */
-    0xff, 0xff, 0xff, 0x0, 0x4b, 0xef, 0xc6, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xf3, 0x9f, 0xff, 0xff,
-    0xfc, 0x10, 0x0, 0xff, 0xff, 0xff, 0xdf, 0xff,
-    0xff, 0xff, 0xfd, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0xf,
-    0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff,
-    0x60, 0xff, 0xff, 0xff, 0xf8, 0x0, 0xcf, 0xff,
-    0xff, 0xfc, 0xf, 0xff, 0xff, 0xff, 0x0, 0x3,
-    0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xc0,
-    0x0, 0xe, 0xff, 0xff, 0xff, 0x1f, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xf3, 0xff,
-    0xff, 0xff, 0xb0, 0x0, 0xb, 0xff, 0xff, 0xff,
-    0x3f, 0xff, 0xff, 0xfb, 0x0, 0x0, 0xdf, 0xff,
-    0xff, 0xf2, 0xff, 0xff, 0xff, 0xb0, 0x0, 0xf,
-    0xff, 0xff, 0xff, 0xf, 0xff, 0xff, 0xfb, 0x0,
-    0x4, 0xff, 0xff, 0xff, 0xd0, 0xff, 0xff, 0xff,
-    0xf4, 0x2, 0xef, 0xff, 0xff, 0xf9, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x20,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xb0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf4, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0xf, 0xff, 0xff, 0xfd,
-    0xcf, 0xff, 0xff, 0xf8, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0xb0, 0x7d, 0xfe, 0xa3, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
+    0xff, 0xf0, 0x1, 0x2f, 0xbf, 0x18, 0x3, 0xfe,
+    0x39, 0xb4, 0x10, 0x39, 0xc1, 0x0, 0xfe, 0xe6,
+    0x0, 0xf1, 0xe0, 0x7, 0xf1, 0x0, 0x7e, 0x28,
+    0x0, 0xff, 0xe3, 0x30, 0x7, 0xf8, 0x40, 0x3e,
+    0x16, 0x0, 0xfc, 0xfd, 0xe6, 0x1, 0xea, 0x0,
+    0xfd, 0x0, 0xf, 0x0, 0xf1, 0x80, 0x7c, 0x60,
+    0x11, 0x88, 0x7, 0x84, 0x3, 0xfe, 0x20, 0xf,
+    0x10, 0x7, 0x9c, 0x3, 0x38, 0x7, 0xff, 0x19,
+    0x80, 0x3c, 0x20, 0x1f, 0xf1, 0x0, 0x78, 0x80,
+    0x3f, 0xc8, 0x1, 0xe2, 0x0, 0xf9, 0x10, 0x5,
+    0x40, 0x1e, 0x40, 0xf, 0xd7, 0xfa, 0x20, 0x1e,
+    0xb0, 0xf, 0xfe, 0x2a, 0x10, 0x7, 0xff, 0x17,
+    0xc0, 0x3f, 0xf8, 0xae, 0x80, 0x1f, 0x88, 0xc0,
+    0x3c, 0xf0, 0x1, 0xfc, 0xd9, 0x4, 0x2, 0xb9,
+    0x0, 0x1f, 0xf9, 0xf7, 0xfa, 0x8c, 0x3, 0xff,
+    0xfe, 0x1, 0xff, 0xff, 0x0, 0xff, 0xe7, 0x0,
     /* U+0071 "q" */
-    0x0, 0x0, 0x2, 0x9d, 0xfe, 0xb4, 0x3, 0xef,
-    0xff, 0xf0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xff,
-    0x9f, 0xff, 0xff, 0xf0, 0x0, 0x5, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0x0, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xdf,
-    0xff, 0xff, 0xff, 0xf0, 0x6, 0xff, 0xff, 0xff,
-    0xe1, 0x2, 0xef, 0xff, 0xff, 0xf0, 0xb, 0xff,
-    0xff, 0xff, 0x60, 0x0, 0xcf, 0xff, 0xff, 0xf0,
-    0xe, 0xff, 0xff, 0xff, 0x10, 0x0, 0xcf, 0xff,
-    0xff, 0xf0, 0xf, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0xcf, 0xff, 0xff, 0xf0, 0xf, 0xff, 0xff, 0xfd,
-    0x0, 0x0, 0xcf, 0xff, 0xff, 0xf0, 0xf, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xf0,
-    0xf, 0xff, 0xff, 0xff, 0x10, 0x0, 0xdf, 0xff,
-    0xff, 0xf0, 0xc, 0xff, 0xff, 0xff, 0x60, 0x1,
-    0xff, 0xff, 0xff, 0xf0, 0x8, 0xff, 0xff, 0xff,
-    0xe3, 0xa, 0xff, 0xff, 0xff, 0xf0, 0x2, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0x0, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf0, 0x0, 0x9, 0xff, 0xff,
-    0xff, 0xff, 0xef, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x9f, 0xff, 0xff, 0xf5, 0xcf, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x4, 0xbe, 0xeb, 0x30, 0xcf, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xff, 0xff, 0xf0,
-
+    0x0, 0xe2, 0x9d, 0xfe, 0xb4, 0x3, 0xef, 0xfc,
+    0x1, 0xcd, 0xac, 0x40, 0x29, 0x73, 0x82, 0x1,
+    0xf9, 0x64, 0x3, 0xe6, 0x0, 0xfe, 0x1a, 0x0,
+    0xff, 0xe3, 0x48, 0x7, 0xff, 0x1d, 0xc0, 0x3e,
+    0x20, 0xf, 0xf3, 0x0, 0x78, 0x7b, 0x74, 0x20,
+    0x1f, 0xb4, 0x3, 0xd0, 0x20, 0x44, 0x0, 0xfc,
+    0xa0, 0x1e, 0x70, 0xf, 0xfc, 0x20, 0x1c, 0x22,
+    0x0, 0xff, 0xe3, 0x18, 0x7, 0xff, 0x1c, 0xc0,
+    0x3f, 0xf8, 0xe2, 0x20, 0x8, 0x40, 0x3f, 0x18,
+    0x7, 0x9c, 0x0, 0x24, 0x1, 0xf9, 0x0, 0x3d,
+    0x6, 0x16, 0x1, 0xfd, 0x40, 0x1e, 0x1c, 0xf5,
+    0x0, 0xfe, 0x24, 0x0, 0xff, 0xe3, 0xc0, 0x7,
+    0xff, 0x1c, 0xd8, 0x3, 0xf0, 0x80, 0x7f, 0xa5,
+    0x80, 0x3d, 0x44, 0x1, 0xff, 0x4d, 0xa0, 0x89,
+    0x31, 0x40, 0x3f, 0xf8, 0x0, 0x97, 0xdc, 0xb3,
+    0x0, 0xff, 0xff, 0x80, 0x7f, 0xff, 0xc0, 0x3f,
+    0xfb, 0x60,
     /* U+0072 "r" */
-    0xf, 0xff, 0xff, 0xf0, 0x7, 0xdf, 0xd0, 0xff,
-    0xff, 0xff, 0x39, 0xff, 0xfd, 0xf, 0xff, 0xff,
-    0xfa, 0xff, 0xff, 0xd0, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfd, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xd0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xf,
-    0xff, 0xff, 0xff, 0xfd, 0x87, 0xa0, 0xff, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0x30, 0x0, 0x0, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0,
-
+    0xf, 0xff, 0x0, 0x1f, 0x7f, 0x40, 0x3e, 0x39,
+    0x82, 0x0, 0xfe, 0x96, 0x0, 0xff, 0x94, 0x3,
+    0xff, 0xb8, 0x4f, 0xe, 0x1, 0xf8, 0xf6, 0x1e,
+    0x80, 0x3f, 0x78, 0x7, 0xfe, 0x30, 0xf, 0xf8,
+    0x40, 0x3f, 0xff, 0xe0, 0x1f, 0xff, 0x0,
     /* U+0073 "s" */
-    0x0, 0x0, 0x39, 0xbe, 0xfd, 0xc9, 0x40, 0x0,
-    0x0, 0x2b, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x20,
-    0x2, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0x20,
-    0xd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x20,
-    0x6f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x20,
-    0x9f, 0xff, 0xff, 0xff, 0x96, 0x7b, 0xff, 0x20,
-    0xaf, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x3c, 0x20,
-    0x7f, 0xff, 0xff, 0xfe, 0x40, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xff, 0xfe, 0x82, 0x0, 0x0,
-    0x5, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x5e, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x1, 0x8e, 0xff, 0xff, 0xff, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x5d, 0xff, 0xff, 0xff, 0xf3,
-    0x72, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xf6,
-    0xaf, 0x70, 0x0, 0x0, 0xef, 0xff, 0xff, 0xf7,
-    0xaf, 0xfe, 0x96, 0x7d, 0xff, 0xff, 0xff, 0xf5,
-    0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70,
-    0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x0,
-    0x3b, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x50, 0x0,
-    0x0, 0x27, 0xbd, 0xff, 0xeb, 0x60, 0x0, 0x0,
-
+    0x0, 0xc7, 0x37, 0xdf, 0xb9, 0x28, 0x1, 0xc5,
+    0x78, 0xc8, 0x20, 0x46, 0xd7, 0xc4, 0x0, 0x2c,
+    0x40, 0xf, 0xe1, 0x0, 0xbc, 0x40, 0x3f, 0xf8,
+    0x0, 0xc4, 0x1, 0xff, 0xc2, 0xf0, 0xf, 0x9a,
+    0x61, 0x0, 0x31, 0x80, 0x79, 0x65, 0x9e, 0xf0,
+    0xc0, 0x1a, 0x1, 0xe4, 0x40, 0x4, 0x78, 0x40,
+    0xc0, 0x1e, 0x1b, 0xe8, 0x20, 0xc, 0x34, 0x1,
+    0xf0, 0xbe, 0xc0, 0x6, 0x5a, 0x10, 0xf, 0xcf,
+    0x80, 0x19, 0x7d, 0xc4, 0x3, 0xe3, 0xb0, 0xc,
+    0x31, 0xd4, 0x40, 0x1e, 0x43, 0x72, 0x0, 0xcb,
+    0xa4, 0x1, 0xe5, 0xdd, 0x38, 0x7, 0x18, 0x7,
+    0x84, 0x1, 0x1d, 0x2c, 0xfa, 0x20, 0x1e, 0x20,
+    0x8, 0x5a, 0x60, 0x80, 0x3e, 0x50, 0xf, 0xfe,
+    0x14, 0x0, 0x7f, 0xf0, 0x95, 0xc2, 0x50, 0x3,
+    0xf8, 0x6a, 0x80, 0x3, 0xbd, 0x84, 0x20, 0x0,
+    0xa4, 0xf2, 0x80, 0x40,
     /* U+0074 "t" */
-    0x0, 0x3, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0x70, 0x0, 0x0, 0x6, 0xff,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0x70, 0x0, 0x0, 0x9, 0xff, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0xaf, 0xff, 0xff, 0x70, 0x0, 0x9f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe9, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x9f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xe9, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,
-    0x1, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff,
-    0xd0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xfe, 0xbd, 0x0,
-    0xd, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0, 0xaf,
-    0xff, 0xff, 0xff, 0xfe, 0x0, 0x2, 0xff, 0xff,
-    0xff, 0xff, 0xe0, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0x2, 0xac, 0xef, 0xeb, 0x60,
-
+    0x0, 0x8f, 0xff, 0x9c, 0x3, 0xce, 0x1, 0xff,
+    0x88, 0x3, 0xff, 0x8, 0x7, 0xfe, 0xe0, 0xf,
+    0xfc, 0x60, 0x1f, 0xd3, 0xfe, 0x50, 0xe, 0x8f,
+    0xf7, 0x0, 0x7f, 0xfa, 0x27, 0xf8, 0x3, 0xc7,
+    0xfe, 0xe0, 0xf, 0xff, 0xf8, 0x7, 0xff, 0x34,
+    0x40, 0x3f, 0xf1, 0x10, 0x3, 0x8, 0x7, 0xd9,
+    0x7a, 0x1, 0x10, 0x7, 0x85, 0xc, 0x2, 0x70,
+    0xf, 0xfd, 0x0, 0x1f, 0xf8, 0xa0, 0x3, 0xff,
+    0x3e, 0xa9, 0x88, 0xa, 0x40,
     /* U+0075 "u" */
-    0xdf, 0xff, 0xff, 0xf0, 0x0, 0xef, 0xff, 0xff,
-    0xed, 0xff, 0xff, 0xff, 0x0, 0xe, 0xff, 0xff,
-    0xfe, 0xdf, 0xff, 0xff, 0xf0, 0x0, 0xef, 0xff,
-    0xff, 0xed, 0xff, 0xff, 0xff, 0x0, 0xe, 0xff,
-    0xff, 0xfe, 0xdf, 0xff, 0xff, 0xf0, 0x0, 0xef,
-    0xff, 0xff, 0xed, 0xff, 0xff, 0xff, 0x0, 0xe,
-    0xff, 0xff, 0xfe, 0xdf, 0xff, 0xff, 0xf0, 0x0,
-    0xef, 0xff, 0xff, 0xed, 0xff, 0xff, 0xff, 0x0,
-    0xe, 0xff, 0xff, 0xfe, 0xdf, 0xff, 0xff, 0xf0,
-    0x0, 0xef, 0xff, 0xff, 0xed, 0xff, 0xff, 0xff,
-    0x0, 0xe, 0xff, 0xff, 0xfe, 0xdf, 0xff, 0xff,
-    0xf0, 0x0, 0xef, 0xff, 0xff, 0xed, 0xff, 0xff,
-    0xff, 0x0, 0xe, 0xff, 0xff, 0xfe, 0xdf, 0xff,
-    0xff, 0xf0, 0x0, 0xef, 0xff, 0xff, 0xed, 0xff,
-    0xff, 0xff, 0x10, 0xf, 0xff, 0xff, 0xfe, 0xcf,
-    0xff, 0xff, 0xf6, 0x9, 0xff, 0xff, 0xff, 0xea,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xe1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xe0, 0xa, 0xff, 0xff, 0xff, 0x96, 0xff,
-    0xff, 0xfe, 0x0, 0x6, 0xdf, 0xeb, 0x40, 0x1f,
-    0xff, 0xff, 0xe0,
-
+    0xdf, 0xff, 0x0, 0x5d, 0xff, 0xdc, 0x1, 0xff,
+    0xff, 0x0, 0xff, 0xff, 0x80, 0x7f, 0xfc, 0x44,
+    0x0, 0x20, 0x1e, 0x10, 0xf, 0x38, 0x48, 0x7,
+    0xcc, 0x1, 0xe9, 0xf6, 0x0, 0xfb, 0x40, 0x3f,
+    0xf8, 0x8c, 0x1, 0xff, 0xc4, 0x17, 0x0, 0xff,
+    0xe2, 0x42, 0x80, 0x79, 0xa4, 0x3, 0xf5, 0x49,
+    0x0, 0xa5, 0xcb, 0x80, 0x78,
     /* U+0076 "v" */
-    0x5f, 0xff, 0xff, 0xfd, 0x0, 0x2, 0xff, 0xff,
-    0xff, 0xc1, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x5f,
-    0xff, 0xff, 0xf7, 0xc, 0xff, 0xff, 0xff, 0x20,
-    0x7, 0xff, 0xff, 0xff, 0x30, 0x8f, 0xff, 0xff,
-    0xf4, 0x0, 0xaf, 0xff, 0xff, 0xe0, 0x4, 0xff,
-    0xff, 0xff, 0x60, 0xc, 0xff, 0xff, 0xfa, 0x0,
-    0xf, 0xff, 0xff, 0xf8, 0x0, 0xff, 0xff, 0xff,
-    0x50, 0x0, 0xbf, 0xff, 0xff, 0xb0, 0x1f, 0xff,
-    0xff, 0xf1, 0x0, 0x7, 0xff, 0xff, 0xfd, 0x4,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0xf0, 0x6f, 0xff, 0xff, 0x80, 0x0, 0x0, 0xef,
-    0xff, 0xff, 0x29, 0xff, 0xff, 0xf3, 0x0, 0x0,
-    0xa, 0xff, 0xff, 0xf4, 0xbf, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0xff, 0x6e, 0xff, 0xff,
-    0xa0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xf9, 0xff,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff,
-    0xef, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x8f,
-    0xff, 0xff, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0,
-
+    0x5f, 0xff, 0x68, 0x4, 0x5f, 0xfe, 0xc4, 0x0,
+    0xf1, 0x0, 0x4e, 0x1, 0xeb, 0x13, 0x0, 0xf1,
+    0x0, 0x8, 0x3, 0xc8, 0x8, 0x1, 0xe6, 0x0,
+    0x68, 0x7, 0x9, 0x86, 0x0, 0x78, 0x80, 0xc,
+    0x1, 0xc8, 0x0, 0x40, 0xf, 0x70, 0x0, 0xc0,
+    0x3b, 0xc0, 0x24, 0x0, 0xe3, 0x1, 0x0, 0xf2,
+    0x0, 0x58, 0x1, 0xcc, 0xa, 0x1, 0xc6, 0x20,
+    0x12, 0x80, 0x71, 0x1, 0x0, 0x72, 0x0, 0x62,
+    0x10, 0xe, 0x2f, 0x0, 0xeb, 0x0, 0xe4, 0x0,
+    0xe6, 0x20, 0xe, 0x30, 0xe, 0xf0, 0xe, 0x25,
+    0x0, 0xca, 0x1, 0xe4, 0x0, 0xef, 0x10, 0xd,
+    0x80, 0x1e, 0x13, 0x0, 0xce, 0x1, 0xce, 0x1,
+    0xf2, 0x0, 0x61, 0x0, 0xc4, 0x20, 0x1f, 0x60,
+    0x7, 0xf2, 0x80, 0x7e, 0x40, 0xf, 0xec, 0x0,
+    0xfe, 0x40, 0xf, 0xc8, 0x1, 0xfd, 0x80, 0x1f,
+    0x20, 0x7, 0xf9, 0x40, 0x3e, 0xd0, 0xf, 0xf1,
+    0x8, 0x7, 0x90, 0x3, 0x80,
     /* U+0077 "w" */
-    0xf, 0xff, 0xff, 0xfc, 0x0, 0x8, 0xff, 0xff,
-    0xff, 0x50, 0x0, 0xdf, 0xff, 0xff, 0xe0, 0xb,
-    0xff, 0xff, 0xff, 0x0, 0xa, 0xff, 0xff, 0xff,
-    0x70, 0x0, 0xff, 0xff, 0xff, 0xa0, 0x7, 0xff,
-    0xff, 0xff, 0x10, 0xc, 0xff, 0xff, 0xff, 0x90,
-    0x2, 0xff, 0xff, 0xff, 0x60, 0x3, 0xff, 0xff,
-    0xff, 0x30, 0xd, 0xff, 0xff, 0xff, 0xb0, 0x4,
-    0xff, 0xff, 0xff, 0x20, 0x0, 0xff, 0xff, 0xff,
-    0x60, 0xf, 0xff, 0xff, 0xff, 0xc0, 0x7, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0xbf, 0xff, 0xff, 0x80,
-    0x1f, 0xff, 0xcf, 0xff, 0xe0, 0x9, 0xff, 0xff,
-    0xfa, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xb0, 0x3f,
-    0xff, 0xae, 0xff, 0xf0, 0xc, 0xff, 0xff, 0xf6,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xd0, 0x4f, 0xff,
-    0x9c, 0xff, 0xf2, 0xe, 0xff, 0xff, 0xf1, 0x0,
-    0x0, 0xe, 0xff, 0xff, 0xf0, 0x6f, 0xff, 0x7a,
-    0xff, 0xf4, 0xf, 0xff, 0xff, 0xd0, 0x0, 0x0,
-    0xa, 0xff, 0xff, 0xf2, 0x8f, 0xff, 0x58, 0xff,
-    0xf5, 0x3f, 0xff, 0xff, 0x90, 0x0, 0x0, 0x6,
-    0xff, 0xff, 0xf4, 0xaf, 0xff, 0x36, 0xff, 0xf7,
-    0x5f, 0xff, 0xff, 0x50, 0x0, 0x0, 0x2, 0xff,
-    0xff, 0xf6, 0xcf, 0xff, 0x15, 0xff, 0xf9, 0x7f,
-    0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0xef, 0xff,
-    0xf9, 0xdf, 0xff, 0x3, 0xff, 0xfb, 0xaf, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xfb,
-    0xff, 0xfe, 0x1, 0xff, 0xfd, 0xcf, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xff,
-    0xfc, 0x0, 0xff, 0xff, 0xef, 0xff, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xff, 0xfa,
-    0x0, 0xdf, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0xcf, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0xff, 0xff, 0xf6, 0x0, 0xaf,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xff, 0xff, 0xf4, 0x0, 0x8f, 0xff,
-    0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0xf2, 0x0, 0x6f, 0xff, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0xff, 0xff, 0xf1, 0x0, 0x4f, 0xff, 0xff, 0xfb,
-    0x0, 0x0, 0x0,
-
+    0xf, 0xff, 0x60, 0x5, 0x1f, 0xfe, 0x50, 0xb,
+    0x7f, 0xfb, 0x80, 0x8, 0x1, 0xc6, 0x1, 0x10,
+    0x7, 0x88, 0x2, 0x20, 0xe, 0x40, 0x6, 0x0,
+    0x78, 0x40, 0xc, 0x1, 0xee, 0x0, 0x10, 0x7,
+    0xb0, 0x0, 0x80, 0x1e, 0x20, 0x0, 0x80, 0x78,
+    0x80, 0xc, 0x1, 0xe4, 0x0, 0x18, 0x7, 0x94,
+    0x0, 0x40, 0x1e, 0x70, 0x1, 0x80, 0x70, 0x90,
+    0x4, 0x80, 0x1d, 0xc0, 0x20, 0x11, 0x80, 0x44,
+    0x0, 0xe0, 0xe, 0x40, 0xd, 0x80, 0x1c, 0x60,
+    0x40, 0x13, 0x8, 0x0, 0x40, 0xa, 0x1, 0xd8,
+    0x1, 0x90, 0x3, 0x98, 0x1c, 0x2, 0x32, 0x0,
+    0x88, 0x8, 0x3, 0x9c, 0x3, 0x18, 0x80, 0x62,
+    0x2, 0x0, 0xb9, 0x80, 0x26, 0x1, 0x0, 0xc4,
+    0x20, 0x1c, 0x80, 0x1c, 0x5c, 0x1, 0x11, 0x0,
+    0x21, 0x30, 0xe, 0x40, 0xf, 0x60, 0x7, 0x31,
+    0x0, 0x4d, 0xc0, 0x11, 0x30, 0x7, 0x60, 0x7,
+    0x90, 0x3, 0x89, 0x80, 0x22, 0x30, 0xb, 0x88,
+    0x3, 0x90, 0x3, 0xc4, 0x20, 0x1b, 0xc4, 0x2,
+    0x16, 0x0, 0x8b, 0x40, 0x31, 0x8, 0x7, 0xc8,
+    0x1, 0x88, 0x80, 0x1, 0x2, 0x0, 0x99, 0x80,
+    0x19, 0x40, 0x3f, 0x60, 0x6, 0x40, 0x8, 0x80,
+    0x40, 0x22, 0x20, 0x6, 0xc0, 0xf, 0xc8, 0x1,
+    0xf9, 0x80, 0x4, 0x1, 0x8, 0x6, 0x40, 0xf,
+    0xc4, 0x20, 0x1f, 0x10, 0x0, 0x40, 0x3e, 0x30,
+    0xf, 0xf3, 0x80, 0x7d, 0xc0, 0x6, 0x0, 0xf9,
+    0x0, 0x3f, 0xd8, 0x1, 0xf1, 0x0, 0x8, 0x3,
+    0xec, 0x0, 0xff, 0x20, 0x7, 0xcc, 0x0, 0xe0,
+    0xf, 0x90, 0x3, 0xfc, 0x24, 0x1, 0xe3, 0x0,
+    0x10, 0x7, 0x90, 0x3, 0xc0,
     /* U+0078 "x" */
-    0xc, 0xff, 0xff, 0xff, 0x10, 0x1f, 0xff, 0xff,
-    0xf1, 0x0, 0x6f, 0xff, 0xff, 0xf4, 0x4, 0xff,
-    0xff, 0xfa, 0x0, 0x0, 0xff, 0xff, 0xff, 0x60,
-    0x8f, 0xff, 0xff, 0x40, 0x0, 0xa, 0xff, 0xff,
-    0xf9, 0xc, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x4f,
-    0xff, 0xff, 0xb0, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0xef, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x8, 0xff, 0xff, 0xf8, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xef,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff,
-    0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xff, 0xff, 0xff, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xee, 0xff,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xfb,
-    0xbf, 0xff, 0xff, 0x20, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0x89, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x9,
-    0xff, 0xff, 0xf5, 0x6f, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0x23, 0xff, 0xff, 0xff,
-    0x50, 0x0, 0x6f, 0xff, 0xff, 0xf0, 0xf, 0xff,
-    0xff, 0xfc, 0x0, 0xd, 0xff, 0xff, 0xfc, 0x0,
-    0xdf, 0xff, 0xff, 0xf2, 0x3, 0xff, 0xff, 0xff,
-    0x90, 0xa, 0xff, 0xff, 0xff, 0x90, 0xaf, 0xff,
-    0xff, 0xf6, 0x0, 0x7f, 0xff, 0xff, 0xfe, 0x0,
-
+    0xc, 0xff, 0xf0, 0x80, 0xff, 0xf8, 0x40, 0x14,
+    0x1, 0xe5, 0x5, 0x0, 0xe5, 0x10, 0x3, 0x0,
+    0x78, 0x83, 0x0, 0x3b, 0x80, 0x32, 0x80, 0x77,
+    0x82, 0x0, 0x61, 0x40, 0xd, 0xc0, 0x1c, 0x40,
+    0x60, 0x19, 0x80, 0x39, 0x4, 0x3, 0x29, 0x80,
+    0x75, 0x0, 0x79, 0x80, 0x30, 0xd8, 0x6, 0x32,
+    0x0, 0xf5, 0x0, 0x73, 0x0, 0x6a, 0x0, 0xf8,
+    0x8c, 0x3, 0x8, 0x6, 0x70, 0xf, 0xd4, 0x1,
+    0xf9, 0x4, 0x3, 0xf7, 0x80, 0x7e, 0x50, 0xf,
+    0xe7, 0x0, 0xfc, 0x2a, 0x1, 0xf3, 0x8, 0x4,
+    0x22, 0x0, 0xdc, 0x1, 0xf5, 0x0, 0x65, 0x50,
+    0x6, 0x42, 0x0, 0xe3, 0x30, 0x6, 0x32, 0x0,
+    0xea, 0x0, 0xea, 0x0, 0xed, 0xf0, 0xe, 0x60,
+    0xe, 0x60, 0xe, 0x75, 0x0, 0xe1, 0x50, 0x9,
+    0x80, 0x3c, 0x46, 0x1, 0xe9, 0x0, 0xac, 0x3,
+    0x8c, 0x0, 0x40, 0x1c, 0x64, 0x6, 0x40, 0x1c,
+    0xa0, 0x7, 0x0, 0xf5, 0x84, 0x80, 0x7b, 0xc0,
+    0x1a, 0x1, 0xe7, 0x0,
     /* U+0079 "y" */
-    0x8f, 0xff, 0xff, 0xfa, 0x0, 0xa, 0xff, 0xff,
-    0xff, 0x54, 0xff, 0xff, 0xff, 0xc0, 0x0, 0xcf,
-    0xff, 0xff, 0xf1, 0xf, 0xff, 0xff, 0xfe, 0x0,
-    0xe, 0xff, 0xff, 0xfd, 0x0, 0xbf, 0xff, 0xff,
-    0xf1, 0x0, 0xff, 0xff, 0xff, 0x80, 0x7, 0xff,
-    0xff, 0xff, 0x30, 0x2f, 0xff, 0xff, 0xf4, 0x0,
-    0x3f, 0xff, 0xff, 0xf5, 0x4, 0xff, 0xff, 0xff,
-    0x0, 0x0, 0xef, 0xff, 0xff, 0x70, 0x6f, 0xff,
-    0xff, 0xc0, 0x0, 0xa, 0xff, 0xff, 0xfa, 0x8,
-    0xff, 0xff, 0xf7, 0x0, 0x0, 0x6f, 0xff, 0xff,
-    0xc0, 0xaf, 0xff, 0xff, 0x30, 0x0, 0x1, 0xff,
-    0xff, 0xfe, 0xc, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0xd, 0xff, 0xff, 0xf1, 0xef, 0xff, 0xfb, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0xff, 0x4f, 0xff, 0xff,
-    0x70, 0x0, 0x0, 0x4, 0xff, 0xff, 0xf8, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xdf, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xff, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff,
-    0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x9a, 0x9e,
-    0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0xa,
-    0xff, 0xff, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xff, 0xff, 0xff, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xff, 0xff, 0xff, 0xfd, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xfd,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x2, 0x8c, 0xee,
-    0xc7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
+    0x8f, 0xff, 0x50, 0x5, 0x5f, 0xfe, 0x5c, 0x0,
+    0xf3, 0x0, 0x4c, 0x1, 0xe4, 0x40, 0x7, 0x88,
+    0x2, 0x20, 0xe, 0x21, 0x4, 0x0, 0xe1, 0x10,
+    0x0, 0x40, 0x39, 0x40, 0x18, 0x1, 0xe2, 0x2,
+    0x0, 0xf6, 0x0, 0x10, 0x3, 0xcc, 0xc, 0x1,
+    0xe4, 0x0, 0x18, 0x80, 0x71, 0x1, 0x0, 0x71,
+    0x80, 0x64, 0x0, 0xed, 0xe, 0x0, 0xeb, 0x0,
+    0xd8, 0x1, 0xcc, 0x4, 0x1, 0xc8, 0x1, 0x9c,
+    0x3, 0x88, 0x18, 0x3, 0x8c, 0x3, 0x9, 0x0,
+    0x61, 0x11, 0x0, 0x64, 0x0, 0xf2, 0x0, 0x72,
+    0x88, 0x6, 0xc0, 0xf, 0x68, 0x7, 0x60, 0x7,
+    0x28, 0x7, 0x90, 0x3, 0x94, 0x3, 0x9, 0x0,
+    0x7c, 0x80, 0x18, 0x80, 0x32, 0x0, 0x7e, 0xc0,
+    0xf, 0xec, 0x0, 0xfc, 0x80, 0x1f, 0xce, 0x1,
+    0xf8, 0xc4, 0x3, 0xe2, 0x10, 0xf, 0xe4, 0x0,
+    0xf9, 0x0, 0x3f, 0xd8, 0x1, 0xf6, 0x0, 0x7f,
+    0x9c, 0x3, 0xe4, 0x0, 0xff, 0x8, 0x7, 0x8c,
+    0x40, 0x3f, 0xc8, 0x1, 0xeb, 0x0, 0xff, 0xb4,
+    0x3, 0xc8, 0x1, 0xfe, 0x26, 0x0, 0xe1, 0x30,
+    0xf, 0xa6, 0xa7, 0x0, 0x3d, 0x20, 0x1f, 0x8d,
+    0x58, 0x40, 0x3c, 0xc0, 0x1f, 0xfc, 0x56, 0x10,
+    0xf, 0xfe, 0x21, 0x40, 0x7, 0xff, 0x10, 0xbc,
+    0x40, 0x3f, 0xa1, 0xcc, 0x44, 0x71, 0xa4, 0x1,
+    0xfc,
     /* U+007A "z" */
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xc0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x0, 0x33, 0x33, 0x33, 0xef, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0xd, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x9, 0xff,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0xff, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0xef,
-    0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x1e,
-    0xff, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0xa,
-    0xff, 0xff, 0xff, 0xfd, 0x33, 0x33, 0x33, 0x31,
-    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x8d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf8, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x8d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x80,
-
+    0x3f, 0xff, 0xfe, 0x16, 0x0, 0x7f, 0xfe, 0x4f,
+    0x33, 0xc2, 0x1, 0xf2, 0x0, 0xc, 0xfa, 0xc4,
+    0x3, 0xc5, 0x0, 0x1e, 0x37, 0x0, 0xfb, 0x80,
+    0x3e, 0xe0, 0xf, 0x9c, 0xc0, 0x3d, 0x24, 0x1,
+    0xe3, 0x80, 0xf, 0x23, 0x0, 0x7d, 0xc0, 0x1f,
+    0x50, 0x7, 0xd0, 0x40, 0x1e, 0x91, 0x0, 0xf1,
+    0xb8, 0x7, 0x91, 0x80, 0x3e, 0xe0, 0xf, 0xd,
+    0x0, 0x7d, 0x24, 0x1, 0xeb, 0x10, 0xf, 0x12,
+    0x99, 0xf8, 0x5c, 0x3, 0xe2, 0xcc, 0xfa, 0x40,
+    0x3f, 0xff, 0x0,
     /* U+007B "{" */
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xad, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x2, 0xcf, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x1e, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0x84, 0x21,
-    0x0, 0x0, 0x5, 0xff, 0xff, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0xff, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0xff, 0x60, 0x0, 0x0,
-    0x3, 0x5b, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0x3, 0x6e, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xff, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xfe, 0x61, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x18, 0xcf, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x12, 0x21,
-
+    0x0, 0xfe, 0x5a, 0xdf, 0xfa, 0x0, 0x3e, 0x2c,
+    0xa5, 0x20, 0xf, 0xf0, 0xe1, 0x80, 0x7f, 0xf0,
+    0x2, 0x4, 0x3, 0xff, 0x84, 0xc0, 0x1f, 0xfc,
+    0x22, 0x0, 0xf3, 0xde, 0xc8, 0x7, 0x38, 0x7,
+    0x4c, 0x21, 0x8, 0x7, 0x18, 0x7, 0x28, 0x7,
+    0xff, 0xc, 0x80, 0x3f, 0x84, 0x3, 0xff, 0xb2,
+    0x20, 0x1f, 0xde, 0x1, 0xff, 0xc3, 0x10, 0xc,
+    0x20, 0x1f, 0xe5, 0x0, 0xc4, 0x1, 0xfe, 0x30,
+    0xc, 0xa0, 0x1f, 0xd2, 0x1, 0xde, 0x1, 0xe3,
+    0x5b, 0x60, 0xc, 0x2c, 0x1, 0xc5, 0x94, 0x80,
+    0x1d, 0x0, 0x1f, 0xfc, 0x28, 0x60, 0xf, 0xfe,
+    0x0, 0x4b, 0x80, 0x7f, 0xf0, 0xa5, 0x80, 0x3f,
+    0xf8, 0x72, 0x80, 0x1e, 0x2c, 0x91, 0x0, 0xe9,
+    0x0, 0xf8, 0xdb, 0x8c, 0x3, 0x12, 0x80, 0x7f,
+    0x70, 0x7, 0x60, 0x7, 0xf1, 0x10, 0x3, 0x10,
+    0x7, 0xf9, 0x0, 0x32, 0x80, 0x7f, 0x84, 0x3,
+    0x8, 0x7, 0xfb, 0xc0, 0x3f, 0xfb, 0x22, 0x1,
+    0xff, 0xc3, 0x30, 0xf, 0xe1, 0x0, 0xff, 0xe1,
+    0x98, 0x7, 0x38, 0x7, 0xf3, 0x0, 0x75, 0xb0,
+    0x80, 0x7c, 0x60, 0x1c, 0x33, 0xdf, 0x0, 0x1e,
+    0x40, 0xf, 0xfe, 0x1c, 0x0, 0x7f, 0xf0, 0xce,
+    0x80, 0x3f, 0xf8, 0x6b, 0xce, 0x60, 0x1f, 0xfc,
+    0x0, 0x18, 0xcf, 0xed, 0xd4, 0x80,
     /* U+007C "|" */
-    0x6f, 0xff, 0xf3, 0x6f, 0xff, 0xf3, 0x6f, 0xff,
-    0xf3, 0x6f, 0xff, 0xf3, 0x6f, 0xff, 0xf3, 0x6f,
-    0xff, 0xf3, 0x6f, 0xff, 0xf3, 0x6f, 0xff, 0xf3,
-    0x6f, 0xff, 0xf3, 0x6f, 0xff, 0xf3, 0x6f, 0xff,
-    0xf3, 0x6f, 0xff, 0xf3, 0x6f, 0xff, 0xf3, 0x6f,
-    0xff, 0xf3, 0x6f, 0xff, 0xf3, 0x6f, 0xff, 0xf3,
-    0x6f, 0xff, 0xf3, 0x6f, 0xff, 0xf3, 0x6f, 0xff,
-    0xf3, 0x6f, 0xff, 0xf3, 0x6f, 0xff, 0xf3, 0x6f,
-    0xff, 0xf3, 0x6f, 0xff, 0xf3, 0x6f, 0xff, 0xf3,
-    0x6f, 0xff, 0xf3, 0x6f, 0xff, 0xf3, 0x6f, 0xff,
-    0xf3, 0x6f, 0xff, 0xf3, 0x6f, 0xff, 0xf3, 0x6f,
-    0xff, 0xf3, 0x6f, 0xff, 0xf3, 0x6f, 0xff, 0xf3,
-    0x6f, 0xff, 0xf3, 0x6f, 0xff, 0xf3, 0x6f, 0xff,
-    0xf3, 0x6f, 0xff, 0xf3, 0x6f, 0xff, 0xf3, 0x6f,
-    0xff, 0xf3, 0x6f, 0xff, 0xf3, 0x6f, 0xff, 0xf3,
-
+    0x6f, 0xfc, 0x60, 0x1f, 0xff, 0xf0, 0xf, 0xff,
+    0xf8, 0x7, 0xff, 0xfc, 0x3, 0xf8,
     /* U+007D "}" */
-    0x2f, 0xfe, 0xda, 0x71, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0x50, 0x0, 0x0,
-    0x2, 0x36, 0xcf, 0xff, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xff, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xfe, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xd5, 0x10,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x3, 0xef, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x1, 0xcf, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xfa, 0x73,
-    0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xff, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xff, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x3, 0xcf, 0xff, 0xff, 0x90, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0x70, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xfe, 0x83, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0x22, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
+    0x2f, 0xf7, 0x6d, 0x38, 0x80, 0x7f, 0xc2, 0x4b,
+    0x1c, 0xe0, 0x1f, 0xfc, 0x38, 0x60, 0xf, 0xfe,
+    0x1c, 0x80, 0x7f, 0xf1, 0x14, 0x3, 0x8b, 0x72,
+    0x4c, 0x3, 0xb0, 0x3, 0xc4, 0x6d, 0xa0, 0x1c,
+    0x40, 0x1f, 0xc2, 0x40, 0x19, 0xc0, 0x3f, 0xc2,
+    0x1, 0xff, 0xc3, 0x70, 0xc, 0x20, 0x1f, 0xfc,
+    0xe1, 0x0, 0xff, 0xe1, 0x98, 0x6, 0x30, 0xf,
+    0xf0, 0x80, 0x61, 0x0, 0xff, 0x78, 0x7, 0x10,
+    0x7, 0xf1, 0x80, 0x72, 0x0, 0x7f, 0x20, 0x7,
+    0x40, 0x80, 0x7f, 0x28, 0x6, 0x1c, 0x51, 0x0,
+    0xfa, 0xc0, 0x38, 0xab, 0xa0, 0x3, 0xc3, 0x82,
+    0x1, 0xff, 0xc2, 0x3c, 0x0, 0xff, 0xe1, 0xf,
+    0x0, 0x7f, 0xf0, 0xb0, 0xc0, 0x3f, 0xf8, 0x0,
+    0xc4, 0x1, 0xcb, 0x16, 0x1, 0xe8, 0x0, 0xec,
+    0xa7, 0x30, 0xe, 0x21, 0x0, 0xce, 0x60, 0x1f,
+    0x9c, 0x3, 0xac, 0x3, 0xf8, 0x80, 0x38, 0xc0,
+    0x3f, 0xbc, 0x3, 0x8, 0x7, 0xf8, 0x40, 0x31,
+    0x80, 0x7f, 0x8c, 0x3, 0xff, 0x86, 0x20, 0x18,
+    0x40, 0x3f, 0xce, 0x1, 0xff, 0xd3, 0x30, 0xc,
+    0xe0, 0x1f, 0x8f, 0x0, 0x38, 0x80, 0x38, 0x7f,
+    0xd8, 0x60, 0x1d, 0xc0, 0x1f, 0xfc, 0x36, 0x0,
+    0xff, 0xe1, 0x30, 0x80, 0x7f, 0xf0, 0x1, 0xa4,
+    0x3, 0xfe, 0x17, 0xc9, 0x0, 0xf8, 0x77, 0x6f,
+    0xe8, 0x30, 0xf, 0xc0,
     /* U+007E "~" */
-    0x0, 0x1, 0x7b, 0xef, 0xc9, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0x30, 0x8, 0xff, 0xff,
-    0xff, 0xff, 0xe7, 0x10, 0x0, 0x0, 0x0, 0x5,
-    0xf5, 0x2d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x92, 0x0, 0x0, 0x3a, 0xff, 0x57, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xbb, 0xdf,
-    0xff, 0xf5, 0x7f, 0xff, 0xfd, 0xaa, 0xef, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x57, 0xff,
-    0x92, 0x0, 0x0, 0x29, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x90, 0x7d, 0x20, 0x0, 0x0, 0x0,
-    0x1, 0x7e, 0xff, 0xff, 0xff, 0xfe, 0x40, 0x3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xad,
-    0xfe, 0xb6, 0x0, 0x0
+    0x0, 0x85, 0xef, 0xbf, 0x25, 0x40, 0x3f, 0xf1,
+    0x18, 0x2, 0x3a, 0x10, 0x40, 0xda, 0xb9, 0xc4,
+    0x3, 0xf2, 0xeb, 0x16, 0xb8, 0x7, 0xe1, 0x8e,
+    0x92, 0x0, 0xc7, 0x54, 0x0, 0x29, 0x0, 0x7f,
+    0xe6, 0xde, 0xbb, 0x6e, 0x28, 0x7, 0xe2, 0x55,
+    0x8, 0x7, 0xc2, 0x88, 0x20, 0xf, 0xcd, 0xba,
+    0xaa, 0x76, 0xb0, 0x7, 0xfe, 0x65, 0x2, 0xd9,
+    0x20, 0xc, 0x53, 0xd0, 0x20, 0x1f, 0xd, 0xc8,
+    0x26, 0x90, 0x7, 0xe1, 0x7e, 0xa5, 0x20, 0x14,
+    0x9e, 0x40, 0x0,
+    0x0
 };
 
 
@@ -3209,99 +1655,99 @@ static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
     {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
     {.bitmap_index = 0, .adv_w = 180, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
     {.bitmap_index = 0, .adv_w = 206, .box_w = 9, .box_h = 30, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 135, .adv_w = 334, .box_w = 17, .box_h = 12, .ofs_x = 2, .ofs_y = 18},
-    {.bitmap_index = 237, .adv_w = 470, .box_w = 27, .box_h = 31, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 656, .adv_w = 330, .box_w = 19, .box_h = 36, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 998, .adv_w = 572, .box_w = 34, .box_h = 35, .ofs_x = 1, .ofs_y = -2},
-    {.bitmap_index = 1593, .adv_w = 382, .box_w = 23, .box_h = 30, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1938, .adv_w = 168, .box_w = 8, .box_h = 12, .ofs_x = 1, .ofs_y = 18},
-    {.bitmap_index = 1986, .adv_w = 301, .box_w = 12, .box_h = 40, .ofs_x = 6, .ofs_y = -10},
-    {.bitmap_index = 2226, .adv_w = 301, .box_w = 12, .box_h = 40, .ofs_x = 1, .ofs_y = -10},
-    {.bitmap_index = 2466, .adv_w = 330, .box_w = 15, .box_h = 14, .ofs_x = 3, .ofs_y = 16},
-    {.bitmap_index = 2571, .adv_w = 470, .box_w = 25, .box_h = 25, .ofs_x = 2, .ofs_y = 3},
-    {.bitmap_index = 2884, .adv_w = 206, .box_w = 9, .box_h = 17, .ofs_x = 2, .ofs_y = -11},
-    {.bitmap_index = 2961, .adv_w = 264, .box_w = 12, .box_h = 7, .ofs_x = 2, .ofs_y = 7},
-    {.bitmap_index = 3003, .adv_w = 206, .box_w = 8, .box_h = 7, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 3031, .adv_w = 264, .box_w = 15, .box_h = 34, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 3286, .adv_w = 359, .box_w = 21, .box_h = 30, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3601, .adv_w = 359, .box_w = 12, .box_h = 29, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 3775, .adv_w = 359, .box_w = 19, .box_h = 29, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 4051, .adv_w = 359, .box_w = 19, .box_h = 30, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 4336, .adv_w = 359, .box_w = 21, .box_h = 29, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 4641, .adv_w = 359, .box_w = 18, .box_h = 30, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 4911, .adv_w = 359, .box_w = 20, .box_h = 30, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 5211, .adv_w = 359, .box_w = 19, .box_h = 29, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 5487, .adv_w = 359, .box_w = 21, .box_h = 30, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 5802, .adv_w = 359, .box_w = 20, .box_h = 30, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 6102, .adv_w = 206, .box_w = 8, .box_h = 21, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 6186, .adv_w = 206, .box_w = 9, .box_h = 32, .ofs_x = 2, .ofs_y = -11},
-    {.bitmap_index = 6330, .adv_w = 470, .box_w = 25, .box_h = 25, .ofs_x = 2, .ofs_y = 2},
-    {.bitmap_index = 6643, .adv_w = 470, .box_w = 25, .box_h = 15, .ofs_x = 2, .ofs_y = 7},
-    {.bitmap_index = 6831, .adv_w = 470, .box_w = 25, .box_h = 25, .ofs_x = 2, .ofs_y = 2},
-    {.bitmap_index = 7144, .adv_w = 315, .box_w = 18, .box_h = 30, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 7414, .adv_w = 563, .box_w = 33, .box_h = 38, .ofs_x = 1, .ofs_y = -8},
-    {.bitmap_index = 8041, .adv_w = 367, .box_w = 23, .box_h = 30, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 8386, .adv_w = 367, .box_w = 22, .box_h = 30, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 8716, .adv_w = 301, .box_w = 17, .box_h = 30, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 8971, .adv_w = 374, .box_w = 21, .box_h = 30, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 9286, .adv_w = 330, .box_w = 19, .box_h = 30, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 9571, .adv_w = 315, .box_w = 18, .box_h = 30, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 9841, .adv_w = 352, .box_w = 20, .box_h = 30, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 10141, .adv_w = 382, .box_w = 20, .box_h = 30, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 10441, .adv_w = 183, .box_w = 8, .box_h = 30, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 10561, .adv_w = 220, .box_w = 11, .box_h = 30, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 10726, .adv_w = 337, .box_w = 21, .box_h = 30, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 11041, .adv_w = 294, .box_w = 17, .box_h = 30, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 11296, .adv_w = 447, .box_w = 24, .box_h = 30, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 11656, .adv_w = 382, .box_w = 20, .box_h = 30, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 11956, .adv_w = 389, .box_w = 23, .box_h = 30, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 12301, .adv_w = 352, .box_w = 21, .box_h = 30, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 12616, .adv_w = 389, .box_w = 23, .box_h = 38, .ofs_x = 1, .ofs_y = -8},
-    {.bitmap_index = 13053, .adv_w = 352, .box_w = 21, .box_h = 30, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 13368, .adv_w = 322, .box_w = 18, .box_h = 30, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 13638, .adv_w = 337, .box_w = 21, .box_h = 30, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 13953, .adv_w = 367, .box_w = 21, .box_h = 30, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 14268, .adv_w = 359, .box_w = 23, .box_h = 30, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 14613, .adv_w = 477, .box_w = 30, .box_h = 30, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 15063, .adv_w = 367, .box_w = 23, .box_h = 30, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 15408, .adv_w = 352, .box_w = 22, .box_h = 30, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 15738, .adv_w = 345, .box_w = 20, .box_h = 30, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 16038, .adv_w = 271, .box_w = 10, .box_h = 40, .ofs_x = 6, .ofs_y = -10},
-    {.bitmap_index = 16238, .adv_w = 264, .box_w = 15, .box_h = 34, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 16493, .adv_w = 271, .box_w = 10, .box_h = 40, .ofs_x = 1, .ofs_y = -10},
-    {.bitmap_index = 16693, .adv_w = 411, .box_w = 22, .box_h = 17, .ofs_x = 2, .ofs_y = 13},
-    {.bitmap_index = 16880, .adv_w = 389, .box_w = 26, .box_h = 3, .ofs_x = -1, .ofs_y = -6},
-    {.bitmap_index = 16919, .adv_w = 234, .box_w = 9, .box_h = 7, .ofs_x = 2, .ofs_y = 23},
-    {.bitmap_index = 16951, .adv_w = 315, .box_w = 19, .box_h = 21, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 17151, .adv_w = 345, .box_w = 19, .box_h = 30, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 17436, .adv_w = 257, .box_w = 15, .box_h = 21, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 17594, .adv_w = 345, .box_w = 20, .box_h = 30, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 17894, .adv_w = 330, .box_w = 19, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 18094, .adv_w = 206, .box_w = 13, .box_h = 30, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 18289, .adv_w = 345, .box_w = 20, .box_h = 31, .ofs_x = 0, .ofs_y = -10},
-    {.bitmap_index = 18599, .adv_w = 337, .box_w = 17, .box_h = 30, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 18854, .adv_w = 183, .box_w = 8, .box_h = 30, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 18974, .adv_w = 183, .box_w = 12, .box_h = 40, .ofs_x = -2, .ofs_y = -10},
-    {.bitmap_index = 19214, .adv_w = 308, .box_w = 18, .box_h = 30, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 19484, .adv_w = 183, .box_w = 8, .box_h = 30, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 19604, .adv_w = 498, .box_w = 28, .box_h = 21, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 19898, .adv_w = 337, .box_w = 18, .box_h = 21, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 20087, .adv_w = 345, .box_w = 20, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 20297, .adv_w = 345, .box_w = 19, .box_h = 31, .ofs_x = 2, .ofs_y = -10},
-    {.bitmap_index = 20592, .adv_w = 345, .box_w = 20, .box_h = 31, .ofs_x = 0, .ofs_y = -10},
-    {.bitmap_index = 20902, .adv_w = 227, .box_w = 13, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 21039, .adv_w = 286, .box_w = 16, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 21207, .adv_w = 227, .box_w = 13, .box_h = 27, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 21383, .adv_w = 337, .box_w = 17, .box_h = 21, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 21562, .adv_w = 279, .box_w = 19, .box_h = 21, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 21762, .adv_w = 447, .box_w = 30, .box_h = 21, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 22077, .adv_w = 294, .box_w = 19, .box_h = 21, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 22277, .adv_w = 301, .box_w = 19, .box_h = 31, .ofs_x = 0, .ofs_y = -10},
-    {.bitmap_index = 22572, .adv_w = 294, .box_w = 17, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 22751, .adv_w = 274, .box_w = 16, .box_h = 42, .ofs_x = 0, .ofs_y = -12},
-    {.bitmap_index = 23087, .adv_w = 414, .box_w = 6, .box_h = 40, .ofs_x = 10, .ofs_y = -10},
-    {.bitmap_index = 23207, .adv_w = 274, .box_w = 16, .box_h = 42, .ofs_x = 0, .ofs_y = -12},
-    {.bitmap_index = 23543, .adv_w = 462, .box_w = 25, .box_h = 8, .ofs_x = 2, .ofs_y = 10}
+    {.bitmap_index = 95, .adv_w = 334, .box_w = 17, .box_h = 12, .ofs_x = 2, .ofs_y = 18},
+    {.bitmap_index = 147, .adv_w = 470, .box_w = 27, .box_h = 31, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 379, .adv_w = 330, .box_w = 19, .box_h = 36, .ofs_x = 1, .ofs_y = -3},
+    {.bitmap_index = 574, .adv_w = 572, .box_w = 34, .box_h = 35, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 963, .adv_w = 382, .box_w = 23, .box_h = 30, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1172, .adv_w = 168, .box_w = 8, .box_h = 12, .ofs_x = 1, .ofs_y = 18},
+    {.bitmap_index = 1198, .adv_w = 301, .box_w = 12, .box_h = 40, .ofs_x = 6, .ofs_y = -10},
+    {.bitmap_index = 1350, .adv_w = 301, .box_w = 12, .box_h = 40, .ofs_x = 1, .ofs_y = -10},
+    {.bitmap_index = 1506, .adv_w = 330, .box_w = 15, .box_h = 14, .ofs_x = 3, .ofs_y = 16},
+    {.bitmap_index = 1583, .adv_w = 470, .box_w = 25, .box_h = 25, .ofs_x = 2, .ofs_y = 3},
+    {.bitmap_index = 1636, .adv_w = 206, .box_w = 9, .box_h = 17, .ofs_x = 2, .ofs_y = -11},
+    {.bitmap_index = 1700, .adv_w = 264, .box_w = 12, .box_h = 7, .ofs_x = 2, .ofs_y = 7},
+    {.bitmap_index = 1709, .adv_w = 206, .box_w = 8, .box_h = 7, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 1734, .adv_w = 264, .box_w = 15, .box_h = 34, .ofs_x = 1, .ofs_y = -4},
+    {.bitmap_index = 1889, .adv_w = 359, .box_w = 21, .box_h = 30, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2093, .adv_w = 359, .box_w = 12, .box_h = 29, .ofs_x = 4, .ofs_y = 0},
+    {.bitmap_index = 2131, .adv_w = 359, .box_w = 19, .box_h = 29, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 2281, .adv_w = 359, .box_w = 19, .box_h = 30, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 2455, .adv_w = 359, .box_w = 21, .box_h = 29, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2567, .adv_w = 359, .box_w = 18, .box_h = 30, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 2695, .adv_w = 359, .box_w = 20, .box_h = 30, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2894, .adv_w = 359, .box_w = 19, .box_h = 29, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3027, .adv_w = 359, .box_w = 21, .box_h = 30, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3244, .adv_w = 359, .box_w = 20, .box_h = 30, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 3438, .adv_w = 206, .box_w = 8, .box_h = 21, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 3493, .adv_w = 206, .box_w = 9, .box_h = 32, .ofs_x = 2, .ofs_y = -11},
+    {.bitmap_index = 3590, .adv_w = 470, .box_w = 25, .box_h = 25, .ofs_x = 2, .ofs_y = 2},
+    {.bitmap_index = 3762, .adv_w = 470, .box_w = 25, .box_h = 15, .ofs_x = 2, .ofs_y = 7},
+    {.bitmap_index = 3796, .adv_w = 470, .box_w = 25, .box_h = 25, .ofs_x = 2, .ofs_y = 2},
+    {.bitmap_index = 3968, .adv_w = 315, .box_w = 18, .box_h = 30, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 4135, .adv_w = 563, .box_w = 33, .box_h = 38, .ofs_x = 1, .ofs_y = -8},
+    {.bitmap_index = 4640, .adv_w = 367, .box_w = 23, .box_h = 30, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4845, .adv_w = 367, .box_w = 22, .box_h = 30, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 5011, .adv_w = 301, .box_w = 17, .box_h = 30, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5164, .adv_w = 374, .box_w = 21, .box_h = 30, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 5335, .adv_w = 330, .box_w = 19, .box_h = 30, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 5389, .adv_w = 315, .box_w = 18, .box_h = 30, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 5434, .adv_w = 352, .box_w = 20, .box_h = 30, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 5607, .adv_w = 382, .box_w = 20, .box_h = 30, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 5652, .adv_w = 183, .box_w = 8, .box_h = 30, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 5666, .adv_w = 220, .box_w = 11, .box_h = 30, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5710, .adv_w = 337, .box_w = 21, .box_h = 30, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 5878, .adv_w = 294, .box_w = 17, .box_h = 30, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 5911, .adv_w = 447, .box_w = 24, .box_h = 30, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 6072, .adv_w = 382, .box_w = 20, .box_h = 30, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 6201, .adv_w = 389, .box_w = 23, .box_h = 30, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 6422, .adv_w = 352, .box_w = 21, .box_h = 30, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 6538, .adv_w = 389, .box_w = 23, .box_h = 38, .ofs_x = 1, .ofs_y = -8},
+    {.bitmap_index = 6809, .adv_w = 352, .box_w = 21, .box_h = 30, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 6982, .adv_w = 322, .box_w = 18, .box_h = 30, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 7158, .adv_w = 337, .box_w = 21, .box_h = 30, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7202, .adv_w = 367, .box_w = 21, .box_h = 30, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 7300, .adv_w = 359, .box_w = 23, .box_h = 30, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7514, .adv_w = 477, .box_w = 30, .box_h = 30, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7835, .adv_w = 367, .box_w = 23, .box_h = 30, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8048, .adv_w = 352, .box_w = 22, .box_h = 30, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8177, .adv_w = 345, .box_w = 20, .box_h = 30, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 8300, .adv_w = 271, .box_w = 10, .box_h = 40, .ofs_x = 6, .ofs_y = -10},
+    {.bitmap_index = 8331, .adv_w = 264, .box_w = 15, .box_h = 34, .ofs_x = 1, .ofs_y = -4},
+    {.bitmap_index = 8484, .adv_w = 271, .box_w = 10, .box_h = 40, .ofs_x = 1, .ofs_y = -10},
+    {.bitmap_index = 8515, .adv_w = 411, .box_w = 22, .box_h = 17, .ofs_x = 2, .ofs_y = 13},
+    {.bitmap_index = 8639, .adv_w = 389, .box_w = 26, .box_h = 3, .ofs_x = -1, .ofs_y = -6},
+    {.bitmap_index = 8651, .adv_w = 234, .box_w = 9, .box_h = 7, .ofs_x = 2, .ofs_y = 23},
+    {.bitmap_index = 8679, .adv_w = 315, .box_w = 19, .box_h = 21, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8813, .adv_w = 345, .box_w = 19, .box_h = 30, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 8939, .adv_w = 257, .box_w = 15, .box_h = 21, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 9041, .adv_w = 345, .box_w = 20, .box_h = 30, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 9169, .adv_w = 330, .box_w = 19, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 9304, .adv_w = 206, .box_w = 13, .box_h = 30, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 9363, .adv_w = 345, .box_w = 20, .box_h = 31, .ofs_x = 0, .ofs_y = -10},
+    {.bitmap_index = 9538, .adv_w = 337, .box_w = 17, .box_h = 30, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 9607, .adv_w = 183, .box_w = 8, .box_h = 30, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 9648, .adv_w = 183, .box_w = 12, .box_h = 40, .ofs_x = -2, .ofs_y = -10},
+    {.bitmap_index = 9737, .adv_w = 308, .box_w = 18, .box_h = 30, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 9846, .adv_w = 183, .box_w = 8, .box_h = 30, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 9860, .adv_w = 498, .box_w = 28, .box_h = 21, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 9956, .adv_w = 337, .box_w = 18, .box_h = 21, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 10014, .adv_w = 345, .box_w = 20, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 10154, .adv_w = 345, .box_w = 19, .box_h = 31, .ofs_x = 2, .ofs_y = -10},
+    {.bitmap_index = 10282, .adv_w = 345, .box_w = 20, .box_h = 31, .ofs_x = 0, .ofs_y = -10},
+    {.bitmap_index = 10412, .adv_w = 227, .box_w = 13, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 10451, .adv_w = 286, .box_w = 16, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 10575, .adv_w = 227, .box_w = 13, .box_h = 27, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 10644, .adv_w = 337, .box_w = 17, .box_h = 21, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 10697, .adv_w = 279, .box_w = 19, .box_h = 21, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 10830, .adv_w = 447, .box_w = 30, .box_h = 21, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 11059, .adv_w = 294, .box_w = 19, .box_h = 21, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 11199, .adv_w = 301, .box_w = 19, .box_h = 31, .ofs_x = 0, .ofs_y = -10},
+    {.bitmap_index = 11384, .adv_w = 294, .box_w = 17, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 11459, .adv_w = 274, .box_w = 16, .box_h = 42, .ofs_x = 0, .ofs_y = -12},
+    {.bitmap_index = 11641, .adv_w = 414, .box_w = 6, .box_h = 40, .ofs_x = 10, .ofs_y = -10},
+    {.bitmap_index = 11655, .adv_w = 274, .box_w = 16, .box_h = 42, .ofs_x = 0, .ofs_y = -12},
+    {.bitmap_index = 11843, .adv_w = 462, .box_w = 25, .box_h = 8, .ofs_x = 2, .ofs_y = 10}
 };
 
 /*---------------------
@@ -3678,7 +2124,7 @@ static lv_font_fmt_txt_dsc_t font_dsc = {
     .cmap_num = 1,
     .bpp = 4,
     .kern_classes = 0,
-    .bitmap_format = 0,
+    .bitmap_format = 1,
 #if LVGL_VERSION_MAJOR == 8
     .cache = &cache
 #endif
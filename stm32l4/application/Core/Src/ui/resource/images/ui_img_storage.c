@@ -1,5 +1,9 @@
 #include <stdint.h>
 
+#ifndef RESOURCE_BUILTIN_LOGOS
+#define RESOURCE_BUILTIN_LOGOS 1
+#endif
+
 const uint8_t img_arrow_up_11x21[] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x06, 0x20, 0x06, 0x20, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
@@ -48,2471 +52,1089 @@ const uint8_t img_arrow_down_11x21[] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
 };
 
-const uint8_t img_logo_marine_120x120[] = {
-    0x04, 0xE0, 0x01, 0x0F, 0x1F, 0x00, 0x1F, 0x08, 0x3E, 0x10, 0x1F, 0x18,
-    0x1F, 0x20, 0x1F, 0x18, 0x1F, 0x18, 0x1F, 0x20, 0x1E, 0x18, 0x1F, 0x18,
-    0x1F, 0x18, 0x1F, 0x18, 0x1F, 0x18, 0x1F, 0x18, 0x1F, 0x18, 0x1F, 0x18,
-    0x1F, 0x18, 0x1F, 0x18, 0x1F, 0x18, 0x1F, 0x18, 0x1F, 0x18, 0x1F, 0x18,
-    0x1F, 0x18, 0x1F, 0x18, 0x1F, 0x18, 0x1F, 0x18, 0x1F, 0x18, 0x1F, 0x18,
-    0x1F, 0x18, 0x1F, 0x18, 0x1F, 0x18, 0x1F, 0x18, 0x1F, 0x18, 0x1F, 0x18,
-    0x1F, 0x18, 0x1F, 0x18, 0x1F, 0x18, 0x1F, 0x18, 0x1F, 0x18, 0x1F, 0x18,
-    0x1F, 0x18, 0x1F, 0x18, 0x1F, 0x18, 0x1F, 0x18, 0x1F, 0x18, 0x1F, 0x18,
-    0x1F, 0x18, 0x1F, 0x18, 0x1F, 0x18, 0x1F, 0x18, 0x1F, 0x18, 0x1F, 0x18,
-    0x1F, 0x18, 0x1F, 0x18, 0x1F, 0x18, 0x1F, 0x18, 0x1F, 0x18, 0x1F, 0x18,
-    0x1F, 0x18, 0x1F, 0x18, 0x1F, 0x18, 0x1F, 0x18, 0x1F, 0x18, 0x1F, 0x18,
-    0x1F, 0x18, 0x1F, 0x18, 0x1F, 0x18, 0x1F, 0x18, 0x1F, 0x18, 0x1F, 0x18,
-    0x1F, 0x18, 0x1F, 0x18, 0x1F, 0x18, 0x1F, 0x18, 0x1F, 0x18, 0x1F, 0x18,
-    0x1F, 0x18, 0x1F, 0x18, 0x1F, 0x18, 0x1F, 0x18, 0x1F, 0x18, 0x1F, 0x18,
-    0x1F, 0x18, 0x1F, 0x18, 0x1F, 0x18, 0x1F, 0x18, 0x1F, 0x18, 0x1F, 0x18,
-    0x1F, 0x18, 0x1F, 0x18, 0x1F, 0x18, 0x1F, 0x18, 0x1F, 0x18, 0x1F, 0x18,
-    0x1F, 0x18, 0x1F, 0x18, 0x1F, 0x18, 0x1F, 0x18, 0x1F, 0x18, 0x1F, 0x18,
-    0x1F, 0x18, 0x1F, 0x18, 0x1F, 0x18, 0x1F, 0x18, 0x1F, 0x18, 0x1F, 0x18,
-    0x1F, 0x18, 0x1F, 0x18, 0x1F, 0x18, 0x1F, 0x18, 0x1F, 0x18, 0x1F, 0x18,
-    0x1F, 0x18, 0x1F, 0x18, 0x1F, 0x18, 0x1F, 0x18, 0x1F, 0x20, 0x1F, 0x18,
-    0x1F, 0x00, 0xBC, 0x30, 0x1F, 0x20, 0x1E, 0x20, 0x1F, 0x28, 0x1F, 0x20,
-    0x1E, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1E, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1E, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x18, 0x1E, 0x20,
-    0x1F, 0x20, 0x1F, 0x00, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1E, 0x18,
-    0x1F, 0x20, 0x1F, 0x28, 0x1E, 0x20, 0x3E, 0x20, 0x1F, 0x20, 0x3F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1E, 0x20, 0x1F, 0x20, 0x1E, 0x20,
-    0x3E, 0x20, 0x1F, 0x00, 0x3E, 0x20, 0x1E, 0x18, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1E, 0x18, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1E, 0x20,
-    0x1E, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1E, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x18, 0x1F, 0x08, 0x1F, 0x20, 0x1E, 0x20, 0x1F, 0x20, 0x1E, 0x20,
-    0x3E, 0x20, 0x3E, 0x18, 0x1F, 0x20, 0x1E, 0x28, 0x1D, 0x20, 0x3F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1E, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x3F, 0x20, 0x1F, 0x28, 0x1F, 0x18, 0x1F, 0x20, 0x1F, 0x20, 0x1E, 0x20,
-    0x1F, 0x20, 0x1F, 0x08, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1E, 0x20,
-    0x1F, 0x20, 0x1F, 0x28, 0x1F, 0x20, 0x3F, 0x20, 0x1F, 0x00, 0x1E, 0x00,
-    0x1E, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1F, 0x00,
-    0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00,
-    0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00,
-    0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00,
-    0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00,
-    0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00,
-    0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00,
-    0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00,
-    0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00,
-    0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00,
-    0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00,
-    0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00,
-    0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00,
-    0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00,
-    0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00,
-    0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00,
-    0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00,
-    0x1F, 0x10, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x18, 0x1F, 0x00, 0x1F, 0x20, 0x1F, 0x20, 0x1E, 0x18, 0x1F, 0x20,
-    0x1F, 0x20, 0x1E, 0x20, 0x1F, 0x10, 0x1E, 0x00, 0xBE, 0x51, 0x1F, 0x94,
-    0xFD, 0x8B, 0xBF, 0x8B, 0xDF, 0x8B, 0xBD, 0x8B, 0xFF, 0x8B, 0xBE, 0x8B,
-    0xBF, 0x8B, 0xBF, 0x8B, 0xBF, 0x8B, 0xBF, 0x8B, 0xBF, 0x8B, 0xBF, 0x8B,
-    0xBF, 0x8B, 0xBF, 0x8B, 0xBF, 0x8B, 0xBF, 0x8B, 0xBF, 0x8B, 0xBF, 0x8B,
-    0xBF, 0x8B, 0xBF, 0x8B, 0xBF, 0x8B, 0xBF, 0x8B, 0xBF, 0x8B, 0xBF, 0x8B,
-    0xBF, 0x8B, 0xBF, 0x8B, 0xBF, 0x8B, 0xBF, 0x8B, 0xBF, 0x8B, 0xBF, 0x8B,
-    0xBF, 0x8B, 0xBF, 0x8B, 0xBF, 0x8B, 0xBF, 0x8B, 0xBF, 0x8B, 0xBF, 0x8B,
-    0xBF, 0x8B, 0xBF, 0x8B, 0xBF, 0x8B, 0xBF, 0x8B, 0xBF, 0x8B, 0xBF, 0x8B,
-    0xBF, 0x8B, 0xBF, 0x8B, 0xBF, 0x8B, 0xBF, 0x8B, 0xBF, 0x8B, 0xBF, 0x8B,
-    0xBF, 0x8B, 0xBF, 0x8B, 0xBF, 0x8B, 0xBF, 0x8B, 0xBF, 0x8B, 0xBF, 0x8B,
-    0xBF, 0x8B, 0xBF, 0x8B, 0xBF, 0x8B, 0xBF, 0x8B, 0xBF, 0x8B, 0xBF, 0x8B,
-    0xBF, 0x8B, 0xBF, 0x8B, 0xBF, 0x8B, 0xBF, 0x8B, 0xBF, 0x8B, 0xBF, 0x8B,
-    0xBF, 0x8B, 0xBF, 0x8B, 0xBF, 0x8B, 0xBF, 0x8B, 0xBF, 0x8B, 0xBF, 0x8B,
-    0xBF, 0x8B, 0xBF, 0x8B, 0xBF, 0x8B, 0xBF, 0x8B, 0xBF, 0x8B, 0xBF, 0x8B,
-    0xBF, 0x8B, 0xBF, 0x8B, 0xBF, 0x8B, 0xBF, 0x8B, 0xBF, 0x8B, 0xBF, 0x8B,
-    0xBF, 0x8B, 0xBF, 0x8B, 0xBF, 0x8B, 0xBF, 0x8B, 0xBF, 0x8B, 0xBF, 0x8B,
-    0xBF, 0x8B, 0xBF, 0x8B, 0xBF, 0x8B, 0xBF, 0x8B, 0xDF, 0x8B, 0xDF, 0x8B,
-    0xDF, 0x8B, 0xDF, 0x8B, 0xDF, 0x8B, 0xDF, 0x8B, 0xDF, 0x8B, 0xDF, 0x8B,
-    0xBE, 0x30, 0x1F, 0x08, 0x1F, 0x28, 0x1F, 0x28, 0x3F, 0x18, 0x1E, 0x20,
-    0x1F, 0x18, 0x1F, 0x08, 0x3F, 0x20, 0x1F, 0x18, 0x1E, 0x20, 0x1F, 0x20,
-    0x1E, 0x20, 0x1F, 0x18, 0x1E, 0x10, 0xDE, 0x7B, 0xFE, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x3F, 0xEF, 0x1E, 0x29, 0x1F, 0x10, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x28,
-    0x1F, 0x20, 0x1E, 0x08, 0x1E, 0x20, 0x1F, 0x20, 0x1E, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x00, 0xBE, 0xAC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x1D, 0xAD, 0x1E, 0x00, 0x1F, 0x18, 0x1F, 0x20, 0x3F, 0x20,
-    0x1F, 0x18, 0x1F, 0x08, 0x1F, 0x20, 0x1E, 0x20, 0x3F, 0x20, 0x1D, 0x20,
-    0x1F, 0x08, 0xFE, 0x30, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xCD, 0x1E, 0x08, 0x1F, 0x18, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x08, 0x1F, 0x20, 0x1F, 0x28, 0x1F, 0x20, 0x1F, 0x20,
-    0x3F, 0x00, 0x3E, 0x62, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xDF, 0xC5, 0x1E, 0x00, 0x1F, 0x18, 0x1F, 0x20, 0x1E, 0x20,
-    0x1F, 0x20, 0x1F, 0x08, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x18,
-    0x3F, 0x00, 0xFD, 0x59, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x9F, 0xBD, 0x3E, 0x08, 0x3F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x08, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1E, 0x18,
-    0x1F, 0x00, 0x3E, 0x5A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xBF, 0xC5, 0x1E, 0x08, 0x1F, 0x18, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x08, 0x1F, 0x20, 0x1E, 0x20, 0x1F, 0x18, 0x1F, 0x20,
-    0x1E, 0x00, 0x1D, 0x5A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xBF, 0xC5, 0x1E, 0x08, 0x1F, 0x18, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x08, 0x1E, 0x20, 0x1F, 0x28, 0x1F, 0x20, 0x1E, 0x20,
-    0x1F, 0x00, 0x1F, 0x5A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x9F, 0xBD, 0x1E, 0x08, 0x1F, 0x18, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x08, 0x1F, 0x20, 0x1E, 0x20, 0x1E, 0x20, 0x1F, 0x18,
-    0x1F, 0x00, 0x1E, 0x5A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xF7, 0x5E, 0xB5, 0x9E, 0xA4,
-    0xDF, 0xAC, 0xBE, 0xA4, 0xDE, 0xA4, 0xBE, 0xA4, 0x9D, 0xA4, 0x1E, 0xCE,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xBF, 0xC5, 0x1E, 0x08, 0x1F, 0x18, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x08, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x00, 0x1E, 0x5A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3E, 0xE7,
-    0xFE, 0xA4, 0xFE, 0x6A, 0xBE, 0x51, 0xBD, 0x28, 0x1E, 0x08, 0x1F, 0x00,
-    0x1E, 0x00, 0x1D, 0x00, 0x1D, 0x00, 0x1E, 0x08, 0x1E, 0x00, 0x3D, 0x10,
-    0x7F, 0x41, 0xBD, 0x7B, 0x5F, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xBF, 0xC5, 0x1E, 0x08, 0x1F, 0x18, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x08, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x00, 0x1E, 0x5A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFE, 0xFF, 0xFE, 0xCD, 0xFF, 0x93, 0x1E, 0x52, 0x3E, 0x10,
-    0x1E, 0x00, 0x1E, 0x00, 0x1F, 0x00, 0x1F, 0x08, 0x1F, 0x18, 0x1F, 0x20,
-    0x1E, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x18, 0x1F, 0x20, 0x1F, 0x18,
-    0x1F, 0x08, 0x1F, 0x00, 0x3E, 0x08, 0x5D, 0x39, 0x9F, 0xDE, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xBF, 0xC5, 0x1E, 0x08, 0x1F, 0x18, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x08, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x00, 0x1E, 0x5A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0xDE,
-    0x3E, 0x94, 0x5E, 0x39, 0x1F, 0x08, 0x1F, 0x00, 0x1F, 0x00, 0x3F, 0x10,
-    0x1F, 0x20, 0x1F, 0x28, 0x1F, 0x20, 0x1F, 0x20, 0x1E, 0x20, 0x1E, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1E, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1E, 0x20, 0x1F, 0x28, 0x1F, 0x10, 0x1F, 0x00, 0x5D, 0x18, 0x5F, 0xDE,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xBF, 0xC5, 0x1E, 0x08, 0x1F, 0x18, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x08, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x00, 0x1E, 0x5A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xE6, 0x5D, 0x7B, 0x3D, 0x18,
-    0x1F, 0x00, 0x1E, 0x08, 0x1E, 0x18, 0x1F, 0x20, 0x1F, 0x28, 0x1E, 0x20,
-    0x1F, 0x20, 0x1F, 0x18, 0x1F, 0x20, 0x1E, 0x20, 0x1E, 0x20, 0x1E, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1E, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x18, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x00, 0x3D, 0x10,
-    0xBF, 0xBD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xBF, 0xC5, 0x1E, 0x08, 0x1F, 0x18, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x08, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x00, 0x1E, 0x5A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x1E, 0xE7, 0x3D, 0x7B, 0x1E, 0x18, 0x1E, 0x00, 0x1F, 0x10,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1E, 0x20, 0x1E, 0x20, 0x1F, 0x20,
-    0x1E, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1E, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1E, 0x20, 0x1F, 0x28,
-    0x1F, 0x20, 0x1F, 0x20, 0x1E, 0x18, 0x1F, 0x20, 0x1F, 0x28, 0x3F, 0x00,
-    0x1D, 0x00, 0xFE, 0xB4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xBF, 0xC5, 0x1E, 0x08, 0x1F, 0x18, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x08, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x00, 0x1E, 0x5A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xFF,
-    0x9E, 0x9C, 0x5E, 0x20, 0x1F, 0x00, 0x1F, 0x10, 0x1F, 0x28, 0x3F, 0x18,
-    0x1E, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1E, 0x20, 0x1E, 0x20, 0x1E, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1E, 0x28, 0x1F, 0x28, 0x1F, 0x20, 0x1E, 0x20,
-    0x1F, 0x08, 0x1E, 0x10, 0x9E, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xBF, 0xC5, 0x1E, 0x08, 0x1F, 0x18, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x08, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x00, 0x1E, 0x5A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0xF7, 0x7E, 0x9C, 0x3D, 0x39,
-    0x1E, 0x00, 0x1F, 0x08, 0x1F, 0x20, 0x3F, 0x20, 0x1F, 0x20, 0x1E, 0x28,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1E, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1E, 0x18,
-    0x1F, 0x20, 0x1F, 0x18, 0x1F, 0x20, 0x1F, 0x18, 0x1E, 0x18, 0x1F, 0x28,
-    0x1F, 0x20, 0x1F, 0x00, 0x7E, 0x41, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xBF, 0xC5, 0x1E, 0x08, 0x1F, 0x18, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x08, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x00, 0x1E, 0x5A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xA4, 0x9D, 0x28, 0x1D, 0x00, 0x1F, 0x08,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1E, 0x20, 0x1E, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1E, 0x20, 0x1E, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1E, 0x20, 0x1E, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1E, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1E, 0x20, 0x1E, 0x20, 0x1F, 0x20, 0x1F, 0x18,
-    0x1F, 0x20, 0x1F, 0x20, 0x1E, 0x00, 0xBE, 0xA4, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xBF, 0xC5, 0x1E, 0x08, 0x1F, 0x18, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x08, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x00, 0x1E, 0x5A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xBE, 0xD6, 0x7D, 0x5A, 0x1F, 0x08, 0x1F, 0x00, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1E, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1E, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x3F, 0x20,
-    0x1F, 0x20, 0x1F, 0x28, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1E, 0x20, 0x1F, 0x28, 0x1F, 0x00, 0x5E, 0x28, 0xBF, 0xF7, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xBF, 0xC5, 0x1E, 0x08, 0x1F, 0x18, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x08, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x00, 0x1E, 0x5A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0x8B,
-    0x1E, 0x10, 0x1F, 0x00, 0x1F, 0x18, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x18, 0x1F, 0x20, 0x1F, 0x20, 0x1E, 0x20, 0x1F, 0x20,
-    0x1F, 0x18, 0x3F, 0x18, 0x1E, 0x20, 0x1E, 0x20, 0x1F, 0x20, 0x1F, 0x28,
-    0x1F, 0x20, 0x1F, 0x20, 0x3F, 0x18, 0x1E, 0x08, 0x7F, 0xBD, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xBF, 0xC5, 0x1E, 0x08, 0x1F, 0x18, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x08, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x00, 0x1E, 0x5A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0xFF, 0x7D, 0x39, 0x1E, 0x00,
-    0x3F, 0x10, 0x1E, 0x28, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x18, 0x3F, 0x18, 0x1E, 0x20,
-    0x1E, 0x28, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1E, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x18,
-    0x1F, 0x20, 0x1F, 0x18, 0x1F, 0x28, 0x1E, 0x00, 0x7E, 0x62, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xBF, 0xC5, 0x1E, 0x08, 0x1F, 0x18, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x08, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x00, 0x1E, 0x5A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xDF, 0xFF, 0xDF, 0xE6, 0x9E, 0x39, 0x1F, 0x00, 0x1F, 0x20,
-    0x1E, 0x20, 0x1F, 0x20, 0x1E, 0x20, 0x3F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1E, 0x20, 0x1F, 0x20, 0x1F, 0x28, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1E, 0x20, 0x1F, 0x20, 0x1E, 0x28,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1E, 0x20, 0x1E, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x28, 0x1E, 0x00, 0xBE, 0x49, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xBF, 0xC5, 0x1E, 0x08, 0x1F, 0x18, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x08, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x00, 0x1E, 0x5A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x9D, 0x9C, 0x3D, 0x10, 0x1F, 0x08, 0x1E, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1E, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x18, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x18, 0x1F, 0x20, 0x1F, 0x20, 0x3E, 0x20, 0x1E, 0x18,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x28, 0x1E, 0x18,
-    0x1F, 0x20, 0x1E, 0x20, 0x1E, 0x20, 0x1F, 0x00, 0x3E, 0x5A, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xBF, 0xC5, 0x1E, 0x08, 0x1F, 0x18, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x08, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x00, 0x1E, 0x5A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9E, 0xDE,
-    0xFE, 0x51, 0x1E, 0x00, 0x1F, 0x08, 0x1E, 0x20, 0x1F, 0x20, 0x1F, 0x18,
-    0x1F, 0x28, 0x1F, 0x18, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x3F, 0x18, 0x1F, 0x20, 0x1E, 0x20, 0x1F, 0x20,
-    0x3F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x10, 0x1F, 0x08, 0x1F, 0x10,
-    0x1F, 0x18, 0x1F, 0x20, 0x1E, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x3F, 0x20, 0x1F, 0x00, 0xFF, 0x59, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xBF, 0xC5, 0x1E, 0x08, 0x1F, 0x18, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x08, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x00, 0x1E, 0x5A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBD, 0xA4, 0x3D, 0x08,
-    0x1E, 0x00, 0x1F, 0x20, 0x3F, 0x20, 0x1F, 0x20, 0x1E, 0x20, 0x1E, 0x20,
-    0x3F, 0x18, 0x1F, 0x28, 0x1E, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x28, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x28,
-    0x1F, 0x20, 0x3F, 0x00, 0x1E, 0x00, 0x1E, 0x18, 0x7E, 0x30, 0x5E, 0x28,
-    0x3E, 0x08, 0x3E, 0x00, 0x1F, 0x20, 0x1F, 0x28, 0x1E, 0x18, 0x1F, 0x20,
-    0x1E, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1E, 0x00, 0xBE, 0x51, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xBF, 0xC5, 0x1E, 0x08, 0x1F, 0x18, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x08, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x00, 0x1E, 0x5A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xF7, 0xDC, 0x62, 0x1F, 0x00, 0x1F, 0x08,
-    0x1F, 0x20, 0x1E, 0x20, 0x1E, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x3F, 0x20, 0x1E, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1E, 0x20, 0x3F, 0x18, 0x1F, 0x00,
-    0x1E, 0x00, 0x7E, 0x39, 0xDD, 0x8B, 0x9F, 0xDE, 0x7F, 0xF7, 0x7F, 0xEF,
-    0x7E, 0xBD, 0x5E, 0x5A, 0x1E, 0x08, 0x1F, 0x10, 0x3F, 0x28, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x28, 0x1E, 0x00, 0x1F, 0x73, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xBF, 0xC5, 0x1E, 0x08, 0x1F, 0x18, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x08, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x00, 0x1E, 0x5A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xDF, 0xC5, 0xFD, 0x28, 0x1F, 0x08, 0x1F, 0x18, 0x1F, 0x28,
-    0x1E, 0x20, 0x3F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1E, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1E, 0x20,
-    0x1F, 0x28, 0x1E, 0x20, 0x1F, 0x28, 0x3F, 0x10, 0x1E, 0x00, 0x1D, 0x29,
-    0xFD, 0xAC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xBD, 0x7B, 0x1F, 0x08, 0x1F, 0x18, 0x1F, 0x20,
-    0x1E, 0x20, 0x1F, 0x18, 0x1F, 0x20, 0x1E, 0x00, 0x9E, 0xA4, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xBF, 0xC5, 0x1E, 0x08, 0x1F, 0x18, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x08, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x00, 0x1E, 0x5A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x3E, 0x73, 0x1E, 0x00, 0x1F, 0x00, 0x1F, 0x20, 0x1F, 0x20, 0x3E, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1E, 0x20, 0x1F, 0x20, 0x1E, 0x18, 0x1F, 0x28, 0x1E, 0x20,
-    0x1E, 0x18, 0x1F, 0x20, 0x1F, 0x08, 0x1E, 0x08, 0xFE, 0x8B, 0x9F, 0xF7,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xDF, 0xFF,
-    0xFF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0x9D, 0x7B, 0x1E, 0x08, 0x1E, 0x18,
-    0x1F, 0x20, 0x1F, 0x20, 0x1E, 0x18, 0x1E, 0x00, 0xDF, 0xC5, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xBF, 0xC5, 0x1E, 0x08, 0x1F, 0x18, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x08, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x00, 0x1E, 0x5A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0x41,
-    0x1E, 0x00, 0x1F, 0x18, 0x1F, 0x28, 0x1F, 0x20, 0x3F, 0x20, 0x1E, 0x20,
-    0x1F, 0x18, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x3F, 0x20, 0x1F, 0x20, 0x1E, 0x20,
-    0x1F, 0x28, 0x3F, 0x10, 0x1E, 0x08, 0xBD, 0x9C, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDD, 0x8B, 0x1E, 0x00, 0x1F, 0x28,
-    0x1E, 0x20, 0x1E, 0x28, 0x3F, 0x00, 0x5F, 0x62, 0xFF, 0xFF, 0xFE, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xBF, 0xC5, 0x1E, 0x08, 0x1F, 0x18, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x08, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x00, 0x1E, 0x5A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xE6, 0xBD, 0x41, 0x1F, 0x00,
-    0x1F, 0x20, 0x3F, 0x28, 0x1E, 0x20, 0x1E, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x18, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1E, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x3E, 0x20, 0x3F, 0x20,
-    0x1F, 0x20, 0x1E, 0x08, 0x9E, 0x83, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xDF, 0x28, 0x1F, 0x00, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x08, 0x1E, 0x10, 0x3E, 0xEF, 0xFF, 0xFF, 0xFE, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xBF, 0xC5, 0x1E, 0x08, 0x1F, 0x18, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x08, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x00, 0x1E, 0x5A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x5E, 0x94, 0x5E, 0x10, 0x1F, 0x00, 0x3F, 0x20,
-    0x1F, 0x20, 0x1E, 0x20, 0x1F, 0x28, 0x1F, 0x28, 0x3F, 0x20, 0x1E, 0x20,
-    0x1F, 0x28, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x28, 0x1E, 0x18, 0x3F, 0x20, 0x1E, 0x20, 0x1E, 0x20, 0x1F, 0x20,
-    0x3F, 0x00, 0x3D, 0x39, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x5E, 0x83, 0x1F, 0x00, 0x1F, 0x20, 0x3E, 0x20,
-    0x1F, 0x18, 0x1E, 0x00, 0xBE, 0x8B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xBF, 0xC5, 0x1E, 0x08, 0x1F, 0x18, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x08, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x00, 0x1E, 0x5A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xDE, 0xEE, 0xDE, 0x49, 0x1E, 0x00, 0x1F, 0x08, 0x1F, 0x28, 0x1F, 0x20,
-    0x1F, 0x20, 0x1E, 0x20, 0x1F, 0x18, 0x1F, 0x20, 0x1E, 0x20, 0x1F, 0x20,
-    0x1E, 0x18, 0x1E, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x3F, 0x20, 0x1E, 0x18, 0x1F, 0x28, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x00, 0xFE, 0xAC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xBE, 0xA4, 0x1E, 0x00, 0x1F, 0x18, 0x1E, 0x20, 0x3F, 0x18,
-    0x1F, 0x08, 0x1D, 0x73, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xBF, 0xC5, 0x1E, 0x08, 0x1F, 0x18, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x08, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x00, 0x1E, 0x5A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xB5,
-    0x9E, 0x20, 0x1F, 0x00, 0x1F, 0x18, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1E, 0x20,
-    0x3F, 0x20, 0x3E, 0x18, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1E, 0x20, 0x1F, 0x20, 0x1E, 0x20, 0x1F, 0x20, 0x3F, 0x18, 0x1F, 0x10,
-    0x5D, 0x28, 0x9F, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xE6,
-    0xBD, 0x8B, 0x1F, 0x00, 0x1F, 0x08, 0x1F, 0x18, 0x1F, 0x08, 0x1D, 0x00,
-    0x3E, 0x6B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xBF, 0xC5, 0x1E, 0x08, 0x1F, 0x18, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x08, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x00, 0x1E, 0x5A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x1E, 0x63, 0x1E, 0x00,
-    0x1F, 0x08, 0x1F, 0x20, 0x1F, 0x20, 0x1E, 0x28, 0x1F, 0x20, 0x1F, 0x20,
-    0x1E, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x00,
-    0x5F, 0x7B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5E, 0xB5,
-    0x3C, 0x00, 0x1E, 0x00, 0x1D, 0x08, 0x1D, 0x18, 0xBF, 0x62, 0x7F, 0xB5,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xBF, 0xC5, 0x1E, 0x08, 0x1F, 0x18, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x08, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x00, 0x1E, 0x5A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xC5, 0x1E, 0x31, 0x1E, 0x08, 0x1F, 0x18,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x3E, 0x18, 0x1F, 0x20, 0x1F, 0x20, 0x3F, 0x20, 0x1F, 0x18, 0x3E, 0x00,
-    0xFE, 0xB4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xE6, 0x7F, 0xBD, 0x5E, 0xBD, 0xBE, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xC5, 0x1E, 0x08, 0x1F, 0x20, 0x1E, 0x20, 0x1F, 0x20,
-    0x3F, 0x20, 0x1E, 0x00, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x00, 0x1E, 0x5A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xDE, 0xAC, 0x1D, 0x08, 0x1F, 0x00, 0x3F, 0x18, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1E, 0x20, 0x1E, 0x20, 0x1F, 0x20, 0x1E, 0x00,
-    0x5F, 0xAD, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xDF, 0xCD, 0x3E, 0x00, 0x1E, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1E, 0x20, 0x1F, 0x08, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x00, 0x1E, 0x5A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF,
-    0x9D, 0x73, 0x3E, 0x00, 0x1F, 0x10, 0x1F, 0x28, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1E, 0x18, 0x1F, 0x20, 0x1E, 0x20, 0x1F, 0x20, 0x1E, 0x00,
-    0xDF, 0x93, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x5F, 0xF7, 0x5E, 0x39, 0x1E, 0x10, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x08, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x00, 0x1E, 0x5A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0xC5, 0xBE, 0x39,
-    0x1F, 0x00, 0x1F, 0x18, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x3F, 0x20, 0x1F, 0x20, 0x1E, 0x20, 0x1F, 0x20, 0x1F, 0x08,
-    0xFE, 0x38, 0xDE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xCD,
-    0xFE, 0x28, 0x1F, 0x00, 0x3E, 0x20, 0x1E, 0x20, 0x1E, 0x20, 0x3F, 0x20,
-    0x1F, 0x20, 0x1F, 0x08, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x00, 0x1E, 0x5A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xBE, 0x62, 0x3E, 0x00, 0x1D, 0x00,
-    0x3F, 0x20, 0x1F, 0x20, 0x3E, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1E, 0x20, 0x1F, 0x20, 0x1F, 0x18, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x00, 0x9F, 0xBD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3D, 0x94, 0x1E, 0x08,
-    0x1F, 0x08, 0x3F, 0x18, 0x1F, 0x20, 0x1E, 0x20, 0x1F, 0x20, 0x1E, 0x20,
-    0x3F, 0x20, 0x1F, 0x08, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x00, 0x1E, 0x5A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF,
-    0xFF, 0xE6, 0x1E, 0x8C, 0x5F, 0x18, 0x1E, 0x00, 0x1E, 0x18, 0x3F, 0x28,
-    0x1F, 0x20, 0x1F, 0x28, 0x1F, 0x20, 0x1F, 0x18, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x3E, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x08, 0xBE, 0x41, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xAC, 0x7E, 0x31, 0x1E, 0x00, 0x1F, 0x10,
-    0x3F, 0x20, 0x1F, 0x28, 0x1F, 0x28, 0x3F, 0x18, 0x1F, 0x20, 0x1F, 0x28,
-    0x1E, 0x20, 0x1F, 0x08, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x00, 0x1E, 0x5A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xE6, 0xBE, 0xA4, 0xFE, 0x51,
-    0x3E, 0x10, 0x1E, 0x00, 0x1E, 0x08, 0x1F, 0x28, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x28, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1E, 0x20, 0x1F, 0x20, 0x1E, 0x20, 0x1E, 0x20, 0x3F, 0x20, 0x3F, 0x20,
-    0x1E, 0x28, 0x1E, 0x08, 0xBD, 0x62, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x1E, 0xC6, 0x5E, 0x5A, 0x1E, 0x00, 0x1F, 0x00, 0x3F, 0x20, 0x1F, 0x20,
-    0x1E, 0x28, 0x1F, 0x20, 0x1F, 0x28, 0x3E, 0x18, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x08, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x00, 0x3F, 0x5A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0xF7,
-    0xFE, 0xBD, 0x3E, 0x94, 0xBE, 0x51, 0x1D, 0x10, 0x1E, 0x00, 0x1F, 0x00,
-    0x3F, 0x10, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x3F, 0x18, 0x1E, 0x20, 0x1E, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1E, 0x20, 0x1F, 0x20, 0x1E, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x28, 0x3F, 0x18, 0x1F, 0x10, 0x9D, 0x41, 0xBD, 0xA4, 0x9F, 0xF7,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1D, 0xCE, 0x5D, 0x7B, 0x3D, 0x31,
-    0x1E, 0x08, 0x1F, 0x00, 0x1F, 0x18, 0x1F, 0x20, 0x1F, 0x20, 0x1E, 0x20,
-    0x1E, 0x18, 0x1F, 0x20, 0x1E, 0x20, 0x1F, 0x28, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1E, 0x08, 0x1F, 0x28, 0x3F, 0x18, 0x1F, 0x20, 0x1F, 0x18,
-    0x1F, 0x08, 0x5D, 0x52, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x5E, 0xEF, 0xDE, 0xC5, 0x1F, 0xB5, 0xFE, 0x8B, 0x9E, 0x62, 0xDD, 0x30,
-    0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x08, 0x1F, 0x10, 0x1F, 0x18, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1E, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1E, 0x20, 0x1E, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1E, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1E, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x18, 0x1F, 0x08, 0x1E, 0x00, 0xFE, 0x28,
-    0xBF, 0x83, 0x1D, 0xC6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xBE, 0xDE, 0x5E, 0x94, 0x1F, 0x4A, 0x1D, 0x08, 0x1E, 0x00, 0x1E, 0x08,
-    0x1F, 0x18, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x08, 0x1E, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1E, 0x20,
-    0x1F, 0x20, 0x5E, 0x20, 0x7E, 0x49, 0x1E, 0x41, 0xFE, 0x40, 0x5F, 0x49,
-    0xBE, 0x28, 0x1D, 0x08, 0x3E, 0x08, 0x1D, 0x00, 0x1E, 0x08, 0x1F, 0x08,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1E, 0x18, 0x3F, 0x20, 0x1E, 0x20, 0x1E, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x10, 0x1F, 0x20, 0x1F, 0x20, 0x3E, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x3F, 0x20, 0x1F, 0x20, 0x1E, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x28, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x18, 0x1F, 0x28, 0x1F, 0x28, 0x1E, 0x08,
-    0x3F, 0x00, 0x1E, 0x08, 0x3E, 0x39, 0x1E, 0x73, 0x5F, 0xB5, 0x9F, 0xDE,
-    0x7E, 0xF7, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0x7E, 0x9C, 0xFE, 0x51,
-    0x1D, 0x10, 0x1E, 0x08, 0x1E, 0x08, 0x3F, 0x18, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x18,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x08, 0x1E, 0x20, 0x1F, 0x28, 0x1F, 0x20, 0x1F, 0x20,
-    0x3F, 0x28, 0x3F, 0x18, 0x1F, 0x00, 0x1F, 0x08, 0x1E, 0x08, 0x1F, 0x08,
-    0x1F, 0x10, 0x1F, 0x18, 0x1F, 0x18, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1E, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1E, 0x20,
-    0x1E, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x28, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x10, 0x1D, 0x18, 0x1E, 0x00, 0x3F, 0x10, 0x1E, 0x20,
-    0x1E, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1E, 0x20, 0x1E, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1E, 0x20, 0x1E, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1E, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1E, 0x20,
-    0x1E, 0x20, 0x1F, 0x18, 0x1F, 0x08, 0x1F, 0x00, 0x1E, 0x08, 0x3E, 0x10,
-    0x7E, 0x20, 0x3E, 0x39, 0xFE, 0x59, 0xFE, 0x72, 0x1E, 0x8C, 0x3D, 0x8C,
-    0x3D, 0xCE, 0x9F, 0xDE, 0x7F, 0xD6, 0x7F, 0xD6, 0xDF, 0xDE, 0x7E, 0xB5,
-    0x5D, 0x7B, 0x5E, 0x62, 0x3E, 0x41, 0x3D, 0x18, 0x1F, 0x08, 0x1F, 0x00,
-    0x3F, 0x10, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x28, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x08, 0x1F, 0x18, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1E, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1E, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x18, 0x1F, 0x18, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x18, 0x1F, 0x18, 0x1F, 0x20,
-    0x1F, 0x28, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x10,
-    0x1F, 0x00, 0x7D, 0x41, 0x3F, 0xCE, 0x9E, 0xA4, 0x1D, 0x10, 0x1F, 0x00,
-    0x1F, 0x18, 0x1F, 0x18, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1E, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1E, 0x20,
-    0x1E, 0x18, 0x3F, 0x18, 0x3F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x18, 0x1F, 0x20, 0x1F, 0x28,
-    0x1F, 0x20, 0x1F, 0x18, 0x3F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x18,
-    0x1F, 0x10, 0x1F, 0x08, 0x1F, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00,
-    0x3E, 0x10, 0x1E, 0x10, 0x1E, 0x18, 0x1E, 0x18, 0x1E, 0x18, 0x1E, 0x10,
-    0x1E, 0x00, 0x1E, 0x00, 0x1F, 0x08, 0x1F, 0x18, 0x1F, 0x20, 0x1F, 0x20,
-    0x1E, 0x20, 0x1E, 0x20, 0x1E, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x08, 0x1F, 0x20, 0x1E, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x18, 0x3F, 0x20, 0x1F, 0x20, 0x1E, 0x20, 0x3F, 0x28,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x28, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x18, 0x3E, 0x20, 0x1E, 0x18, 0x1F, 0x10, 0x1F, 0x00, 0x3D, 0x10,
-    0x1E, 0x8C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0xDE, 0x7D, 0x52,
-    0x1E, 0x00, 0x1F, 0x08, 0x1F, 0x10, 0x1F, 0x18, 0x1E, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1E, 0x20, 0x1E, 0x18, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1E, 0x18, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x28, 0x1E, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x28, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x18, 0x1F, 0x18, 0x1F, 0x18, 0x1F, 0x10, 0x1F, 0x18, 0x1F, 0x18,
-    0x1F, 0x20, 0x1F, 0x28, 0x1E, 0x28, 0x3F, 0x20, 0x1F, 0x18, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1E, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x08, 0x1F, 0x20, 0x1E, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1E, 0x18, 0x1F, 0x20, 0x3F, 0x18, 0x3F, 0x20, 0x1E, 0x18,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1E, 0x18, 0x3F, 0x20, 0x1E, 0x20,
-    0x1F, 0x20, 0x1F, 0x08, 0x1F, 0x08, 0x1E, 0x10, 0x1D, 0x6B, 0xBF, 0xE6,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x9E, 0xBD, 0xFD, 0x6A, 0x9D, 0x20, 0x1F, 0x08, 0x1F, 0x08, 0x1F, 0x08,
-    0x1F, 0x18, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x3F, 0x20, 0x1E, 0x20, 0x1E, 0x20, 0x1F, 0x28, 0x1F, 0x20, 0x1E, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x28, 0x1F, 0x20,
-    0x1E, 0x20, 0x1E, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1E, 0x20, 0x1F, 0x18, 0x3F, 0x20, 0x1E, 0x20,
-    0x1E, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x08, 0x1F, 0x20, 0x1F, 0x20, 0x1E, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x28, 0x1E, 0x18, 0x1F, 0x20, 0x1E, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1E, 0x18,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x18, 0x1E, 0x00,
-    0x1F, 0x00, 0x1D, 0x29, 0x1E, 0x94, 0x3F, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xF7, 0xDE, 0xBD, 0xFD, 0x6A, 0xBD, 0x20,
-    0x1E, 0x08, 0x1E, 0x08, 0x1F, 0x08, 0x1F, 0x10, 0x1F, 0x20, 0x1F, 0x20,
-    0x1E, 0x20, 0x3E, 0x20, 0x1E, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x18, 0x1F, 0x20, 0x1F, 0x20, 0x1E, 0x20,
-    0x1E, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1E, 0x20, 0x1E, 0x18, 0x3F, 0x20,
-    0x1E, 0x20, 0x1E, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x18, 0x3F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x18, 0x1F, 0x20, 0x1E, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x3E, 0x20, 0x1E, 0x18, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x08, 0x1F, 0x20, 0x1F, 0x20, 0x3F, 0x20, 0x3F, 0x18,
-    0x1E, 0x18, 0x1F, 0x20, 0x1E, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x08, 0x1F, 0x08, 0x1C, 0x08, 0x7E, 0x5A,
-    0x5E, 0xB5, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0xFF,
-    0x1F, 0xCE, 0xDE, 0x8B, 0xBE, 0x41, 0x5C, 0x18, 0x1E, 0x00, 0x1F, 0x00,
-    0x1F, 0x08, 0x3F, 0x18, 0x1F, 0x20, 0x1F, 0x28, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1E, 0x20, 0x1E, 0x20, 0x1E, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1E, 0x20, 0x1E, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1E, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x3F, 0x20, 0x1E, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1E, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x08, 0x1F, 0x20, 0x1F, 0x20, 0x1E, 0x20, 0x1E, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1E, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1E, 0x20, 0x1F, 0x20, 0x1F, 0x10,
-    0x1F, 0x00, 0x1E, 0x00, 0x7D, 0x20, 0xDE, 0x83, 0x9E, 0xDE, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xE6, 0xFD, 0xAC, 0xDE, 0x72,
-    0x3E, 0x39, 0x1D, 0x08, 0x1E, 0x00, 0x1F, 0x00, 0x1F, 0x08, 0x1F, 0x10,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x3E, 0x18,
-    0x1E, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1E, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1E, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1E, 0x20, 0x1F, 0x18, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1E, 0x20,
-    0x1F, 0x18, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1E, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1E, 0x20,
-    0x1F, 0x20, 0x1F, 0x08, 0x1F, 0x20, 0x1E, 0x20, 0x3F, 0x20, 0x3F, 0x18,
-    0x1E, 0x18, 0x1F, 0x20, 0x1F, 0x20, 0x1E, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1E, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x3F, 0x20, 0x3F, 0x18, 0x1F, 0x08, 0x1F, 0x00, 0x1E, 0x00, 0x1D, 0x18,
-    0x3E, 0x62, 0xFD, 0xAC, 0x7E, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xDF, 0xF7, 0xFD, 0x8E, 0x9F, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xDF, 0xFF, 0x3E, 0xCE, 0xBF, 0xA4, 0x5E, 0x83, 0xDE, 0x51, 0x3D, 0x18,
-    0x1E, 0x00, 0x3E, 0x00, 0x1F, 0x00, 0x1F, 0x10, 0x1F, 0x20, 0x1F, 0x28,
-    0x3F, 0x18, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1E, 0x20, 0x3E, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x28, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x18, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1E, 0x20, 0x1E, 0x20,
-    0x1F, 0x20, 0x1E, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1E, 0x20, 0x1E, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x18, 0x1F, 0x00, 0x1E, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1E, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x28, 0x1E, 0x28, 0x1F, 0x20, 0x1F, 0x10, 0x1F, 0x08,
-    0x1E, 0x00, 0x1E, 0x00, 0xBD, 0x20, 0xDE, 0x6A, 0x1E, 0xA5, 0xFE, 0xDE,
-    0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1E, 0x9F,
-    0x1F, 0x1E, 0x7F, 0x05, 0xDE, 0x05, 0x7F, 0x46, 0xFE, 0x8E, 0xBF, 0xDF,
-    0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xDF, 0xDE,
-    0xFF, 0xC5, 0x5E, 0x9C, 0x1D, 0x5A, 0x9E, 0x20, 0x1E, 0x00, 0x1F, 0x00,
-    0x1F, 0x10, 0x1F, 0x18, 0x1F, 0x20, 0x1E, 0x20, 0x1E, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1E, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1E, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1E, 0x20, 0x1F, 0x20, 0x1E, 0x20, 0x1E, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1E, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1E, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1E, 0x20, 0x1F, 0x08, 0x3F, 0x20, 0x1F, 0x18, 0x1F, 0x20, 0x3F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x3E, 0x18, 0x1F, 0x18,
-    0x1F, 0x18, 0x1E, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x1D, 0x10, 0x5E, 0x41,
-    0xDD, 0x6A, 0x9D, 0xB5, 0x7F, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9E, 0xCF, 0x5E, 0x4E, 0xBF, 0x05,
-    0xBF, 0x05, 0x3F, 0x06, 0x1F, 0x06, 0xBF, 0x05, 0x9F, 0x05, 0xFF, 0x05,
-    0x7E, 0x46, 0x1F, 0x97, 0xBF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9E, 0xEF, 0x5E, 0xAD, 0x9D, 0x62,
-    0xDF, 0x28, 0x1D, 0x00, 0x1F, 0x00, 0x1F, 0x08, 0x1F, 0x18, 0x3F, 0x20,
-    0x1F, 0x20, 0x1F, 0x28, 0x1F, 0x20, 0x3F, 0x20, 0x1E, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1E, 0x20, 0x1E, 0x20, 0x1F, 0x18, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x28,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1E, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x00, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x10, 0x1F, 0x08, 0x1E, 0x00, 0x1E, 0x00, 0x1F, 0x08,
-    0x1E, 0x18, 0x7E, 0x49, 0x9E, 0x62, 0xBC, 0x7B, 0x1E, 0xC6, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x7D, 0xC7, 0xBE, 0x6E, 0xDF, 0x05, 0xBF, 0x05, 0xFF, 0x05,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0xFF, 0x05, 0x3F, 0x0E, 0xFF, 0x05,
-    0xBF, 0x0D, 0xBF, 0x05, 0xDF, 0x05, 0x7F, 0x3E, 0x1F, 0x97, 0x9F, 0xDF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x9F, 0xF7, 0x1D, 0xAD, 0xFE, 0x72, 0x5E, 0x49, 0x3D, 0x20, 0x1D, 0x00,
-    0x1E, 0x00, 0x3E, 0x00, 0x1F, 0x08, 0x1F, 0x10, 0x1F, 0x18, 0x3F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1E, 0x20, 0x1F, 0x18, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1E, 0x20, 0x1E, 0x20, 0x3F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1E, 0x18, 0x3E, 0x20, 0x3E, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1E, 0x20,
-    0x1E, 0x20, 0x1F, 0x08, 0x1F, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1F, 0x08,
-    0x1E, 0x08, 0x5D, 0x18, 0xBE, 0x49, 0xBE, 0x6A, 0x1E, 0x9C, 0x3E, 0xB5,
-    0xDE, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x1F, 0xA7,
-    0x7F, 0x46, 0xBF, 0x05, 0x9F, 0x05, 0xFF, 0x05, 0x1F, 0x06, 0x1F, 0x06,
-    0xFF, 0x05, 0xFF, 0x05, 0xFF, 0x05, 0xFF, 0x05, 0xFF, 0x05, 0x1F, 0x0E,
-    0xFF, 0x05, 0x1F, 0x06, 0xFF, 0x05, 0xDF, 0x05, 0xBF, 0x05, 0xFE, 0x05,
-    0x9E, 0x3E, 0xDF, 0x76, 0x7E, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1E, 0xE7, 0x5D, 0xB5,
-    0x1F, 0x94, 0xBE, 0x6A, 0x5E, 0x41, 0x3D, 0x18, 0x1F, 0x08, 0x1F, 0x00,
-    0x1E, 0x00, 0x1F, 0x08, 0x1F, 0x10, 0x1F, 0x18, 0x1F, 0x18, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1E, 0x20, 0x1E, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1E, 0x20, 0x1F, 0x20, 0x1E, 0x20,
-    0x1E, 0x20, 0x1E, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x3F, 0x20, 0x1E, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x08, 0x5E, 0x5A, 0x1D, 0x52, 0x3D, 0x73, 0xDF, 0xA4,
-    0xFE, 0xC5, 0x1E, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xE7, 0xFE, 0x6E, 0x3E, 0x1E, 0x9F, 0x05,
-    0xBF, 0x05, 0x1F, 0x06, 0x1F, 0x06, 0xFF, 0x05, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x3F, 0x06, 0x1F, 0x06, 0x3F, 0x06, 0xFF, 0x05, 0xFF, 0x05,
-    0x1F, 0x06, 0xFF, 0x05, 0xFF, 0x05, 0x1F, 0x0E, 0xFF, 0x05, 0xFF, 0x05,
-    0xDF, 0x05, 0xBF, 0x05, 0xDE, 0x05, 0x3F, 0x2E, 0x7F, 0x56, 0xDF, 0x86,
-    0x9E, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xBD, 0xDE, 0x9E, 0xBD, 0x1E, 0x94,
-    0x5D, 0x5A, 0x1D, 0x39, 0x7E, 0x20, 0x1E, 0x18, 0x3E, 0x08, 0x1E, 0x00,
-    0x1F, 0x00, 0x1F, 0x00, 0x3F, 0x08, 0x1F, 0x10, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1E, 0x18, 0x3F, 0x18,
-    0x1F, 0x10, 0x3E, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF,
-    0x5F, 0xB7, 0x9E, 0x4E, 0xDF, 0x05, 0xDF, 0x05, 0xDF, 0x0D, 0xFF, 0x0D,
-    0x1F, 0x06, 0x1F, 0x06, 0xFF, 0x05, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0xFF, 0x05, 0xFF, 0x05, 0xFF, 0x05, 0x3F, 0x06, 0xFF, 0x0D,
-    0x1F, 0x06, 0xFF, 0x05, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0xFF, 0x05,
-    0xFF, 0x05, 0x1F, 0x06, 0xFF, 0x05, 0xFF, 0x05, 0xBF, 0x05, 0xBF, 0x05,
-    0xDE, 0x05, 0x3F, 0x26, 0x9F, 0x5E, 0x3F, 0x97, 0x9F, 0xD7, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFE, 0xFF, 0x9F, 0xF7, 0x5E, 0xD6, 0xDF, 0xC5, 0x5D, 0x94,
-    0xFD, 0x72, 0xDE, 0x51, 0x1E, 0x31, 0x1D, 0x10, 0x1E, 0x08, 0x1E, 0x00,
-    0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1F, 0x00, 0x1F, 0x08, 0x1F, 0x10,
-    0x1F, 0x10, 0x1F, 0x18, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x10, 0x1F, 0x10, 0x1F, 0x00, 0x1E, 0x00, 0x3E, 0x00, 0x1F, 0x08,
-    0x5D, 0x20, 0x7D, 0x52, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xBF, 0xE7, 0x7F, 0xC7, 0x3F, 0xA7, 0xBE, 0x5E, 0x1E, 0x16,
-    0xBF, 0x05, 0xBF, 0x0D, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0xFF, 0x05, 0xDF, 0x05, 0xDF, 0x05, 0xBF, 0x05, 0xFF, 0x05, 0x7F, 0x36,
-    0xFF, 0x76, 0x3F, 0xAF, 0x9F, 0xD7, 0xDF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5D, 0xCE, 0xBE, 0xC5, 0x3D, 0x9C,
-    0x1E, 0x94, 0xDE, 0x72, 0x3D, 0x52, 0x3E, 0x62, 0xBD, 0x30, 0x7F, 0x28,
-    0x5D, 0x28, 0x1D, 0x08, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1F, 0x00,
-    0x1F, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x1E, 0x00, 0x3F, 0x00,
-    0x1F, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00,
-    0x5D, 0x28, 0x7D, 0x28, 0x7E, 0x41, 0x9D, 0x6A, 0xFD, 0x8B, 0x7E, 0xAD,
-    0x3F, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9E, 0xD7, 0xFE, 0x96, 0xBF, 0x6E,
-    0x5F, 0x36, 0x1E, 0x16, 0xDF, 0x05, 0xBF, 0x05, 0xBF, 0x0D, 0xDF, 0x05,
-    0xFF, 0x05, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0xFF, 0x05, 0xFF, 0x05, 0xFF, 0x05, 0xFF, 0x05, 0x1F, 0x06, 0xDF, 0x05,
-    0x9F, 0x05, 0xBF, 0x05, 0xFF, 0x05, 0x1E, 0x16, 0x7E, 0x46, 0xDF, 0x76,
-    0x3D, 0x9F, 0x7F, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xF7, 0x9F, 0xEF,
-    0x5F, 0xF7, 0x5D, 0xB5, 0xFD, 0xAC, 0x1D, 0xAD, 0x1F, 0xAD, 0xBE, 0x83,
-    0xFD, 0x72, 0x3E, 0x7B, 0x3E, 0x73, 0x1E, 0x73, 0x1F, 0x7B, 0x1E, 0x73,
-    0x1F, 0x7B, 0xFF, 0x7A, 0x3D, 0x7B, 0xFE, 0xA4, 0x3D, 0xAD, 0x1D, 0xB5,
-    0x5F, 0xF7, 0x7E, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xBF, 0xDF, 0x5E, 0xB7,
-    0xDE, 0x86, 0x9E, 0x4E, 0x3E, 0x26, 0xDF, 0x0D, 0xBF, 0x05, 0xBF, 0x05,
-    0xDF, 0x05, 0xFF, 0x05, 0x1F, 0x06, 0x1F, 0x06, 0xFF, 0x05, 0x1F, 0x06,
-    0x3F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0xFF, 0x05, 0xFF, 0x05,
-    0xFF, 0x05, 0xFF, 0x05, 0x1F, 0x06, 0x1F, 0x06, 0xFF, 0x05, 0x1F, 0x06,
-    0x1F, 0x0E, 0x1F, 0x06, 0x1F, 0x06, 0xFF, 0x05, 0xDF, 0x05, 0xBF, 0x05,
-    0xBF, 0x05, 0x1F, 0x06, 0x5F, 0x1E, 0x7F, 0x3E, 0xBF, 0x6E, 0x1F, 0xA7,
-    0x9F, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xF7, 0xFF, 0xEF, 0x7E, 0xC7,
-    0x3E, 0xA7, 0xFF, 0x76, 0x7F, 0x46, 0x1E, 0x1E, 0xFF, 0x05, 0xDF, 0x05,
-    0xBF, 0x05, 0xBF, 0x05, 0xFF, 0x05, 0xFF, 0x05, 0xFF, 0x05, 0x1F, 0x06,
-    0x1F, 0x06, 0xFF, 0x05, 0xFF, 0x05, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0xFF, 0x05, 0xFF, 0x05, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0xFF, 0x05, 0xFF, 0x05, 0x1F, 0x06, 0x1F, 0x06, 0xFF, 0x0D, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0xFF, 0x05, 0x1F, 0x06, 0x1F, 0x06,
-    0xFF, 0x05, 0xFF, 0x05, 0xDF, 0x05, 0xBF, 0x0D, 0x9F, 0x05, 0xBE, 0x05,
-    0xFE, 0x0D, 0x1F, 0x26, 0x7E, 0x5E, 0x1F, 0x87, 0x5F, 0xAF, 0x7F, 0xD7,
-    0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x2E, 0xFE, 0x15, 0x3F, 0x16, 0xDF, 0x05,
-    0xBF, 0x05, 0xBF, 0x05, 0xBF, 0x05, 0xDF, 0x05, 0xFF, 0x05, 0x1F, 0x06,
-    0x1F, 0x06, 0xFF, 0x05, 0xFF, 0x05, 0xFF, 0x05, 0xFF, 0x05, 0x1F, 0x06,
-    0x1F, 0x06, 0xFF, 0x05, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0xFF, 0x05,
-    0xFF, 0x05, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0xFF, 0x05,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0xFF, 0x05, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0xFF, 0x05, 0xFF, 0x0D, 0x1F, 0x06, 0x1F, 0x06,
-    0xFF, 0x05, 0xFF, 0x05, 0xDF, 0x05, 0xBF, 0x05, 0xDF, 0x05, 0xDF, 0x0D,
-    0xFE, 0x0D, 0x1E, 0x26, 0x9F, 0x4E, 0x5E, 0x56, 0x1F, 0x87, 0x5F, 0xA7,
-    0x1F, 0x9F, 0x9F, 0xCF, 0x9F, 0xD7, 0xDF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x05, 0xDF, 0x05, 0xFF, 0x05, 0xFF, 0x05,
-    0xFF, 0x05, 0xFF, 0x05, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0xFF, 0x05, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0xFF, 0x05, 0xFF, 0x05, 0xFF, 0x05, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0xFF, 0x05, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0xFF, 0x05, 0xFF, 0x05, 0xFF, 0x05, 0x1F, 0x0E, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0xFF, 0x05, 0x1F, 0x06,
-    0x3F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0xFF, 0x05, 0xFF, 0x05,
-    0xFF, 0x05, 0xDF, 0x05, 0xDF, 0x05, 0xBF, 0x05, 0xBF, 0x05, 0x9E, 0x0D,
-    0xDF, 0x05, 0xDE, 0x05, 0xDE, 0x05, 0x1F, 0x0E, 0x5F, 0x3E, 0x9F, 0x4E,
-    0xFE, 0x7E, 0xDF, 0x86, 0x7F, 0xB7, 0x5D, 0xC7, 0xDF, 0xEF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7E, 0xD7, 0x7F, 0xB7, 0xFD, 0x8E,
-    0xFF, 0x6E, 0x3F, 0x3E, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0xFF, 0x05,
-    0xFF, 0x05, 0x1F, 0x06, 0x1F, 0x06, 0xFF, 0x05, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0xFF, 0x05, 0xFF, 0x05, 0x1F, 0x06, 0x1F, 0x06,
-    0xFF, 0x05, 0x1F, 0x06, 0x1F, 0x06, 0xFF, 0x05, 0xFF, 0x05, 0xFF, 0x05,
-    0xFF, 0x05, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0xFF, 0x05, 0xFF, 0x05,
-    0x1F, 0x06, 0x1F, 0x06, 0x3F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0xFF, 0x05,
-    0xFF, 0x0D, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0xFF, 0x05, 0xFF, 0x05, 0x1F, 0x06, 0x1F, 0x06, 0xFF, 0x05, 0x1F, 0x06,
-    0xFF, 0x05, 0xFF, 0x05, 0xFF, 0x05, 0x1F, 0x06, 0x1F, 0x06, 0xFF, 0x05,
-    0x1F, 0x06, 0xFF, 0x05, 0x1F, 0x06, 0xDF, 0x05, 0xDF, 0x0D, 0xBF, 0x05,
-    0xBF, 0x05, 0x9F, 0x05, 0x9E, 0x05, 0xDE, 0x05, 0x1F, 0x16, 0x5F, 0x36,
-    0x3E, 0x36, 0xBE, 0x66, 0xDF, 0x66, 0x9D, 0x66, 0x7F, 0x9F, 0x9F, 0xBF,
-    0x7E, 0xB7, 0x7F, 0xBF, 0x5F, 0xBF, 0x9E, 0xAF, 0x9F, 0xAF, 0x5E, 0xBF,
-    0x9F, 0xC7, 0x3F, 0x97, 0x7D, 0x66, 0xDE, 0x6E, 0xBE, 0x6E, 0xBF, 0x66,
-    0x5F, 0x2E, 0x3E, 0x2E, 0x5F, 0x2E, 0xBE, 0x05, 0xBF, 0x05, 0xBF, 0x05,
-    0xBF, 0x0D, 0x7F, 0x05, 0x1F, 0x06, 0xFF, 0x05, 0xFF, 0x05, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0xFF, 0x05, 0xFF, 0x05, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x0E, 0x1F, 0x06, 0xFF, 0x05, 0x1F, 0x06, 0x1F, 0x06, 0xFF, 0x05,
-    0xFF, 0x05, 0x1F, 0x06, 0x1F, 0x06, 0xFF, 0x05, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0xFF, 0x05, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0xFF, 0x05, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0xFF, 0x05, 0xFF, 0x05, 0xFF, 0x05, 0xFF, 0x05, 0xFF, 0x05,
-    0x1F, 0x06, 0xFF, 0x05, 0xFF, 0x0D, 0x1F, 0x06, 0x1F, 0x06, 0xFF, 0x05,
-    0x1F, 0x06, 0x1F, 0x06, 0xFF, 0x05, 0xFF, 0x05, 0xFF, 0x05, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0xFF, 0x05, 0x1F, 0x06, 0xFF, 0x05, 0x1F, 0x06,
-    0xFF, 0x05, 0x1F, 0x06, 0x1E, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0xFF, 0x05,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0xDF, 0x05, 0xFF, 0x05,
-    0xFF, 0x05, 0xBF, 0x05, 0xBF, 0x05, 0xBF, 0x05, 0xBF, 0x05, 0xDF, 0x05,
-    0xDF, 0x05, 0xDF, 0x05, 0xDF, 0x05, 0xDF, 0x05, 0xDF, 0x05, 0xDF, 0x05,
-    0xDF, 0x05, 0xBF, 0x05, 0xBF, 0x05, 0x9F, 0x05, 0xBF, 0x05, 0x9F, 0x05,
-    0xDF, 0x05, 0xDF, 0x05, 0xDF, 0x05, 0xFF, 0x05, 0x1F, 0x06, 0x1F, 0x06,
-    0xFF, 0x05, 0xDF, 0x05, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0xFF, 0x05, 0xFF, 0x05, 0xFF, 0x05, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0xFF, 0x05, 0x1F, 0x06, 0x1F, 0x06, 0xFF, 0x0D,
-    0x1F, 0x06, 0x1F, 0x06, 0xFF, 0x05, 0x1F, 0x06, 0xFF, 0x05, 0x1F, 0x06,
-    0xFF, 0x05, 0x3F, 0x06, 0x1F, 0x06, 0xFF, 0x05, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0xFF, 0x05, 0x1F, 0x06, 0xFF, 0x05, 0xFF, 0x05, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0xFF, 0x05, 0xDF, 0x05, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0xFF, 0x05, 0xFF, 0x05, 0x1F, 0x06, 0x1F, 0x06, 0xFF, 0x05,
-    0xFF, 0x05, 0xFF, 0x05, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0xFF, 0x05,
-    0xFF, 0x05, 0x1F, 0x06, 0xFF, 0x0D, 0x1F, 0x06, 0x1F, 0x06, 0xFF, 0x05,
-    0xFF, 0x05, 0xFF, 0x05, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0xFF, 0x0D,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0xFF, 0x05, 0xDF, 0x05, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0xFF, 0x0D, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x0E, 0xDF, 0x05, 0x1F, 0x06,
-    0x1F, 0x0E, 0x1F, 0x06, 0xFF, 0x05, 0x1F, 0x06, 0xFF, 0x05, 0x1F, 0x06,
-    0x3F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x3E, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0xFF, 0x05, 0xDF, 0x05, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x0E, 0xFF, 0x05, 0xFF, 0x05, 0xFF, 0x05,
-    0x1F, 0x06, 0xFF, 0x0D, 0xDF, 0x05, 0xDE, 0x05, 0x3F, 0x26, 0xDF, 0x05,
-    0xDF, 0x05, 0xFF, 0x05, 0x3F, 0x06, 0x1F, 0x06, 0x1F, 0x0E, 0xFF, 0x05,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0xFF, 0x05, 0xFF, 0x05, 0xFF, 0x0D,
-    0x1F, 0x06, 0x1F, 0x06, 0xFF, 0x05, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0xFF, 0x05, 0xDF, 0x05, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0xFF, 0x05, 0xFF, 0x05,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0xFF, 0x05, 0xFF, 0x05,
-    0x3F, 0x06, 0xFF, 0x05, 0xFF, 0x05, 0x1F, 0x06, 0x1F, 0x06, 0xFF, 0x05,
-    0xBF, 0x05, 0x9F, 0x05, 0x1E, 0x1E, 0x5F, 0xA7, 0xFF, 0xFF, 0x3F, 0x9F,
-    0xFF, 0x1D, 0x9F, 0x05, 0xBF, 0x05, 0xFF, 0x0D, 0x1F, 0x06, 0xFF, 0x05,
-    0x1F, 0x0E, 0xFF, 0x05, 0xFF, 0x05, 0xFF, 0x05, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0xFF, 0x05, 0xDF, 0x05, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0xFF, 0x05,
-    0xFF, 0x05, 0x1F, 0x06, 0x1F, 0x06, 0xBF, 0x0D, 0x9F, 0x05, 0xFE, 0x05,
-    0x7E, 0x3E, 0xDE, 0x86, 0xDE, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xF7, 0xDE, 0x96, 0x7F, 0x46, 0xFE, 0x05, 0xBF, 0x05, 0xDF, 0x05,
-    0xFF, 0x05, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0xFF, 0x05, 0xDF, 0x05, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0xFF, 0x0D,
-    0xDF, 0x05, 0xBF, 0x05, 0xBF, 0x05, 0x5F, 0x3E, 0x1F, 0x8F, 0x9E, 0xD7,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xD7, 0xFE, 0x7E, 0x5E, 0x3E,
-    0xDF, 0x05, 0xBF, 0x05, 0xBF, 0x05, 0xFF, 0x05, 0x1F, 0x06, 0x1F, 0x06,
-    0xFF, 0x05, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0xFF, 0x05,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0xFF, 0x05, 0xDF, 0x05, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0xFF, 0x05, 0xDF, 0x05, 0xBF, 0x05,
-    0x3E, 0x1E, 0xFF, 0x76, 0x7F, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF,
-    0x7F, 0xD7, 0x1F, 0x87, 0x5E, 0x2E, 0xDF, 0x05, 0xBF, 0x05, 0x9F, 0x05,
-    0xFF, 0x05, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0xFF, 0x05, 0xFF, 0x05,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0xFF, 0x05, 0xDF, 0x05, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0xFF, 0x05, 0xFF, 0x05,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0xFF, 0x05, 0xFF, 0x05,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0xFF, 0x05, 0xFF, 0x05, 0xFF, 0x05,
-    0xFF, 0x05, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0xFF, 0x05, 0xFF, 0x05,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0xFF, 0x05, 0xBF, 0x05, 0xDF, 0x05, 0x1F, 0x1E, 0x7E, 0x5E, 0x1F, 0xAF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xCF, 0xFF, 0x86, 0x9E, 0x4E,
-    0x1F, 0x0E, 0xDF, 0x05, 0x9F, 0x05, 0xDF, 0x05, 0xFF, 0x05, 0x3F, 0x06,
-    0xFF, 0x05, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0xFF, 0x05, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0xFF, 0x05, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0xFF, 0x05, 0xDF, 0x05, 0x1F, 0x06, 0xFF, 0x05, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0xFF, 0x05,
-    0xFF, 0x05, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0xFF, 0x05, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0xFF, 0x05, 0xFF, 0x05, 0xFF, 0x05, 0x1F, 0x06, 0x1F, 0x06,
-    0xFF, 0x05, 0x1F, 0x06, 0xFF, 0x05, 0xFF, 0x05, 0xBE, 0x05, 0xBF, 0x05,
-    0x1F, 0x26, 0x9F, 0x5E, 0x5F, 0xB7, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xF7,
-    0x1D, 0xCE, 0x9F, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF,
-    0xFF, 0xEF, 0x5F, 0xAF, 0xBF, 0x66, 0x3F, 0x2E, 0xDE, 0x05, 0x9F, 0x05,
-    0xBF, 0x05, 0xFF, 0x05, 0x1F, 0x06, 0xFF, 0x05, 0xFF, 0x05, 0xFF, 0x05,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0xFF, 0x05, 0xFF, 0x05, 0xFF, 0x05,
-    0x1E, 0x06, 0xFF, 0x05, 0xFF, 0x05, 0x1F, 0x06, 0xFF, 0x05, 0xFF, 0x05,
-    0xFF, 0x05, 0xDF, 0x05, 0x1F, 0x06, 0xFF, 0x05, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0xFF, 0x05, 0xFF, 0x05,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0xFF, 0x05, 0x1F, 0x06, 0x1F, 0x06,
-    0xFF, 0x05, 0x1F, 0x06, 0x1F, 0x06, 0xFF, 0x05, 0xFF, 0x05, 0xFF, 0x05,
-    0xFF, 0x05, 0xBF, 0x05, 0x9E, 0x0D, 0x3F, 0x1E, 0xBF, 0x6E, 0x3E, 0xAF,
-    0xDF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0xFF, 0x5E, 0xB5, 0x3E, 0x73, 0xDD, 0x28,
-    0x1D, 0x08, 0xFE, 0x28, 0xDC, 0x83, 0xBE, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xD7, 0xFE, 0x96,
-    0x7F, 0x56, 0x1F, 0x16, 0xBF, 0x05, 0xDF, 0x05, 0xDF, 0x05, 0xFF, 0x05,
-    0xFF, 0x05, 0xFF, 0x05, 0xFF, 0x05, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0xFF, 0x05,
-    0xFF, 0x05, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0xFF, 0x05, 0x3F, 0x06,
-    0x3F, 0x06, 0xDE, 0x05, 0x1F, 0x06, 0xFF, 0x05, 0xFF, 0x05, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0xFF, 0x05, 0xFF, 0x05, 0xFF, 0x05, 0xFF, 0x05, 0x1F, 0x06, 0x1F, 0x06,
-    0xFF, 0x05, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x0E, 0xFF, 0x05,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0xDF, 0x05, 0xBF, 0x05, 0xBF, 0x05,
-    0x1F, 0x1E, 0xBE, 0x5E, 0x5E, 0xB7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF,
-    0xDE, 0xC5, 0xFE, 0x7A, 0xDE, 0x30, 0x1D, 0x08, 0x1E, 0x00, 0x1F, 0x10,
-    0x1F, 0x18, 0x1F, 0x08, 0x1E, 0x08, 0x1E, 0x10, 0x7D, 0x52, 0x9E, 0xB5,
-    0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xF7, 0x9F, 0xCF, 0x3F, 0xA7, 0xBE, 0x66, 0x5F, 0x2E,
-    0xDF, 0x05, 0xBF, 0x05, 0xBF, 0x05, 0xDF, 0x05, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0xFF, 0x05, 0xFF, 0x05, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0xFF, 0x05,
-    0xFF, 0x05, 0xFF, 0x05, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0xFF, 0x05, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0xDF, 0x05, 0xDF, 0x05,
-    0xDF, 0x05, 0xBF, 0x05, 0xBE, 0x05, 0x1E, 0x1E, 0x9E, 0x5E, 0x5E, 0xB7,
-    0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7E, 0xCE, 0x5E, 0x7B, 0xDD, 0x28,
-    0x1E, 0x08, 0x1F, 0x00, 0x1F, 0x08, 0x1F, 0x20, 0x1F, 0x28, 0x1E, 0x18,
-    0x1F, 0x18, 0x1E, 0x20, 0x3F, 0x20, 0x1F, 0x10, 0x1F, 0x00, 0x1E, 0x08,
-    0xFD, 0x30, 0xBE, 0x83, 0x1D, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x7F, 0xD7, 0x1F, 0x97, 0x7F, 0x4E, 0xFE, 0x15, 0xBE, 0x05, 0xBF, 0x05,
-    0xBF, 0x05, 0xDF, 0x05, 0xDF, 0x05, 0xFF, 0x05, 0xFF, 0x05, 0x1F, 0x06,
-    0xFF, 0x05, 0xFF, 0x05, 0xFF, 0x05, 0x1F, 0x06, 0x1F, 0x06, 0xFF, 0x0D,
-    0xDF, 0x0D, 0xDF, 0x05, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0xFF, 0x05, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0xFF, 0x05, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0xFF, 0x05, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0xDF, 0x05, 0xDF, 0x0D, 0x9F, 0x05, 0xBF, 0x05, 0x1F, 0x16, 0x7F, 0x3E,
-    0xBF, 0x66, 0xDF, 0x86, 0x5E, 0xB7, 0xDF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x3E, 0xCE, 0xFE, 0x93, 0xDE, 0x49, 0x1D, 0x08, 0x1F, 0x00, 0x1F, 0x08,
-    0x3F, 0x18, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x3F, 0x20,
-    0x1E, 0x20, 0x1F, 0x28, 0x1E, 0x20, 0x1E, 0x20, 0x1E, 0x28, 0x1F, 0x18,
-    0x1F, 0x08, 0x1F, 0x00, 0x1E, 0x08, 0x9E, 0x41, 0xBE, 0x8B, 0xFE, 0xC5,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xF7, 0x3F, 0x9F, 0xDE, 0x7E,
-    0x9E, 0x56, 0x5F, 0x2E, 0x3F, 0x16, 0xFF, 0x05, 0xBF, 0x05, 0xBF, 0x05,
-    0xBF, 0x0D, 0xDF, 0x05, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0xFF, 0x05,
-    0xFF, 0x05, 0xDF, 0x05, 0xFF, 0x05, 0xFF, 0x05, 0x1F, 0x06, 0x1F, 0x06,
-    0xFF, 0x05, 0xFF, 0x05, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0xFF, 0x05, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0xFF, 0x05, 0xFF, 0x05, 0xFF, 0x05, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0xFF, 0x05, 0xDF, 0x05, 0xBF, 0x05, 0xBF, 0x05, 0xBF, 0x05,
-    0x3E, 0x26, 0xBF, 0x56, 0xFF, 0x8E, 0x5E, 0xC7, 0xFF, 0xEF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5E, 0xD6, 0xBE, 0x83, 0x5E, 0x39,
-    0x1D, 0x08, 0x1E, 0x00, 0x1F, 0x08, 0x1F, 0x10, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1E, 0x20, 0x1E, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x28, 0x1E, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x18, 0x1F, 0x08, 0x1E, 0x00, 0x1D, 0x00,
-    0x1D, 0x41, 0x7E, 0x7B, 0x1E, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xF7, 0x9F, 0xCF, 0x3F, 0x9F, 0xFE, 0x86,
-    0xBF, 0x4E, 0x1E, 0x26, 0xDE, 0x0D, 0xBE, 0x05, 0xDF, 0x05, 0xDF, 0x05,
-    0xDF, 0x05, 0x9E, 0x05, 0xFF, 0x05, 0xFF, 0x05, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0xFF, 0x05, 0xFF, 0x05, 0xFF, 0x05, 0xFF, 0x05, 0x9F, 0x0D, 0xBF, 0x05,
-    0xBF, 0x05, 0xFF, 0x0D, 0x5F, 0x2E, 0xDF, 0x6E, 0x3F, 0xA7, 0x9F, 0xCF,
-    0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x7E, 0xD6, 0x9D, 0x83, 0x7E, 0x41, 0x1D, 0x10, 0x1E, 0x00, 0x1F, 0x00,
-    0x1F, 0x18, 0x1F, 0x20, 0x1E, 0x20, 0x1F, 0x20, 0x1E, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x3F, 0x18, 0x1E, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1E, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x08, 0x1E, 0x00, 0x1D, 0x08, 0x1F, 0x31, 0xBD, 0x62, 0x7D, 0xB5,
-    0x7F, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xDF, 0xF7, 0xBF, 0xDF, 0x7F, 0xBF, 0x7F, 0xBF, 0x7F, 0xC7,
-    0x7F, 0xC7, 0x5E, 0xB7, 0x5E, 0x36, 0xFF, 0x05, 0xDF, 0x05, 0xBF, 0x05,
-    0xDF, 0x05, 0xDF, 0x05, 0xDF, 0x05, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0xFF, 0x05, 0x1F, 0x06, 0x1F, 0x06, 0xFF, 0x05,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0xFF, 0x05, 0x1F, 0x06, 0x1F, 0x06,
-    0xFF, 0x05, 0xFF, 0x0D, 0xFF, 0x05, 0xDF, 0x05, 0xDF, 0x05, 0x9F, 0x0D,
-    0xBF, 0x05, 0xDF, 0x05, 0xFE, 0x05, 0x1E, 0x16, 0x7F, 0x3E, 0xBE, 0x6E,
-    0x5E, 0xB7, 0xBF, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xE6, 0x7E, 0xBD, 0x3E, 0x7B, 0x3D, 0x39,
-    0x1E, 0x10, 0x1F, 0x08, 0x1F, 0x08, 0x3F, 0x10, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1E, 0x20, 0x1F, 0x18, 0x1F, 0x08, 0x1E, 0x00, 0x1F, 0x00,
-    0xBE, 0x20, 0xFE, 0x72, 0x5D, 0xB5, 0xDF, 0xDE, 0xDF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9E, 0xDF, 0x3F, 0x97, 0xBF, 0x66,
-    0x9E, 0x56, 0x5F, 0x36, 0x3F, 0x26, 0xDE, 0x05, 0xBF, 0x05, 0xBE, 0x05,
-    0xBF, 0x05, 0x9F, 0x05, 0xBF, 0x05, 0x9F, 0x05, 0x9F, 0x05, 0xDF, 0x05,
-    0xBF, 0x05, 0xBF, 0x05, 0xBF, 0x05, 0xBF, 0x05, 0x9F, 0x05, 0xBF, 0x05,
-    0xDF, 0x05, 0xBD, 0x05, 0xDF, 0x05, 0x3F, 0x1E, 0x5E, 0x36, 0xDF, 0x5E,
-    0xBE, 0x6E, 0x5F, 0xA7, 0x9F, 0xD7, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7E, 0xEF, 0xBE, 0xBD,
-    0x3D, 0x73, 0x5D, 0x39, 0x3E, 0x10, 0x1E, 0x00, 0x1F, 0x00, 0x1F, 0x08,
-    0x1F, 0x18, 0x1F, 0x20, 0x1E, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x3E, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1E, 0x20, 0x1F, 0x20,
-    0x1F, 0x08, 0x3E, 0x00, 0x1E, 0x00, 0x3E, 0x10, 0xFD, 0x30, 0x1D, 0x5A,
-    0xFE, 0x8B, 0x7F, 0xB5, 0x9E, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xC7, 0x7F, 0xC7, 0x9F, 0xC7,
-    0xDF, 0x9E, 0xFE, 0x7E, 0x1E, 0x7F, 0xDF, 0x8E, 0x1F, 0x7F, 0x9E, 0x3E,
-    0x7F, 0x46, 0x9F, 0x3E, 0x7F, 0x46, 0xFF, 0x7E, 0xFF, 0x8E, 0xBF, 0x86,
-    0x7F, 0xA7, 0x7E, 0xC7, 0x7F, 0xD7, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF,
-    0xFF, 0xFF, 0x1D, 0xD6, 0x3E, 0x9C, 0x5E, 0x62, 0x9E, 0x20, 0x1E, 0x08,
-    0x1E, 0x00, 0x1F, 0x08, 0x1F, 0x10, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1E, 0x20, 0x1E, 0x20, 0x3F, 0x20, 0x3F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x18, 0x1F, 0x18, 0x1E, 0x20, 0x1E, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x3F, 0x18, 0x1F, 0x10, 0x1F, 0x08, 0x1E, 0x00,
-    0x1E, 0x00, 0x1F, 0x00, 0x1D, 0x10, 0x1E, 0x39, 0xBD, 0x6A, 0xFE, 0x8B,
-    0x5F, 0xB5, 0x1D, 0xC6, 0x7E, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0x1E, 0xE7, 0x3F, 0xB5, 0xBE, 0x6A,
-    0x1E, 0x31, 0x3D, 0x10, 0x3E, 0x00, 0x1F, 0x00, 0x1F, 0x10, 0x1F, 0x20,
-    0x1F, 0x28, 0x1F, 0x28, 0x1E, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1E, 0x20, 0x1E, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x18, 0x3F, 0x20, 0x1D, 0x20, 0x1E, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x28, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x18, 0x1F, 0x10, 0x1E, 0x00, 0x1E, 0x00,
-    0x1E, 0x08, 0x1D, 0x08, 0xBD, 0x28, 0x7F, 0x41, 0x3C, 0x41, 0x7E, 0x6A,
-    0x5D, 0x7B, 0xDE, 0x6A, 0x3F, 0x94, 0xFF, 0xCD, 0xDF, 0xC5, 0x7E, 0xC5,
-    0x9E, 0xDE, 0xBE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0xDE, 0x1D, 0xAD,
-    0x5E, 0x7B, 0x3E, 0x62, 0x1E, 0x39, 0x3D, 0x18, 0x1D, 0x00, 0x1F, 0x00,
-    0x1F, 0x08, 0x1F, 0x18, 0x1F, 0x20, 0x1F, 0x20, 0x3F, 0x20, 0x1F, 0x20,
-    0x1E, 0x18, 0x1F, 0x20, 0x1F, 0x20, 0x3F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1E, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x28, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1E, 0x20, 0x3F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1E, 0x20,
-    0x1F, 0x18, 0x1F, 0x18, 0x1F, 0x10, 0x1E, 0x08, 0x3F, 0x08, 0x1E, 0x00,
-    0x1F, 0x00, 0x1E, 0x00, 0x1D, 0x00, 0x1E, 0x08, 0x1D, 0x08, 0x1E, 0x08,
-    0x1E, 0x18, 0x9D, 0x10, 0xDE, 0x72, 0x9D, 0xB5, 0x7E, 0xF7, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3E, 0xF7, 0x3D, 0xD6,
-    0x1E, 0xAD, 0x7D, 0x7B, 0xBD, 0x51, 0xBE, 0x30, 0x3E, 0x18, 0x1D, 0x08,
-    0x1E, 0x00, 0x1E, 0x00, 0x1F, 0x08, 0x1F, 0x10, 0x3F, 0x20, 0x1E, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x3F, 0x18, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1E, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1E, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1E, 0x20, 0x1E, 0x20, 0x1E, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x3E, 0x20, 0x1F, 0x18, 0x1F, 0x18, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1E, 0x20, 0x1E, 0x20, 0x1F, 0x20, 0x1E, 0x20, 0x1E, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1E, 0x20, 0x1E, 0x20, 0x3F, 0x20, 0x1F, 0x18, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x18, 0x1F, 0x18,
-    0x3F, 0x18, 0x1F, 0x00, 0x1F, 0x00, 0x1E, 0x00, 0x7E, 0x30, 0x5D, 0x7B,
-    0xFD, 0xA4, 0x3D, 0xAD, 0x5F, 0xF7, 0x5F, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9E, 0xEF, 0x7E, 0xDE,
-    0xFC, 0xAC, 0x7E, 0xA4, 0x3E, 0x73, 0xFD, 0x51, 0x7C, 0x20, 0x1D, 0x08,
-    0x1E, 0x00, 0x3F, 0x00, 0x1F, 0x00, 0x1F, 0x08, 0x1F, 0x10, 0x1F, 0x18,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1E, 0x20, 0x1E, 0x20, 0x1F, 0x20,
-    0x1E, 0x18, 0x3E, 0x18, 0x1E, 0x28, 0x1F, 0x20, 0x1F, 0x18, 0x1F, 0x18,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1E, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1E, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1E, 0x20, 0x1E, 0x20, 0x1F, 0x20, 0x1F, 0x18, 0x1E, 0x20,
-    0x1E, 0x20, 0x1E, 0x28, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1E, 0x20, 0x1E, 0x20, 0x1F, 0x20,
-    0x1E, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1E, 0x20, 0x1E, 0x20, 0x1F, 0x20,
-    0x1F, 0x28, 0x1E, 0x00, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x10, 0x1F, 0x00,
-    0x1E, 0x00, 0x3D, 0x00, 0x5E, 0x28, 0x7E, 0x20, 0x1E, 0x41, 0x5D, 0x62,
-    0xFF, 0x59, 0x1E, 0x73, 0x7D, 0x9C, 0x3E, 0x9C, 0x1E, 0x9C, 0x3E, 0x94,
-    0x1E, 0x94, 0x5D, 0x94, 0x3D, 0x94, 0x3E, 0x9C, 0x3D, 0x9C, 0x5C, 0x94,
-    0x5E, 0x9C, 0x3E, 0x7B, 0x3E, 0x52, 0x5E, 0x49, 0x7E, 0x30, 0x1E, 0x18,
-    0x1E, 0x00, 0x1E, 0x00, 0x1F, 0x00, 0x1F, 0x08, 0x1F, 0x10, 0x1F, 0x18,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x3E, 0x20, 0x1E, 0x20, 0x1F, 0x28,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1E, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1E, 0x20, 0x1E, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1E, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1E, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1E, 0x20, 0x1E, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x3F, 0x20, 0x1F, 0x20,
-    0x1E, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x3F, 0x00, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x18, 0x1F, 0x18, 0x1F, 0x10, 0x1F, 0x08, 0x1E, 0x00,
-    0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00,
-    0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00,
-    0x1E, 0x00, 0x1E, 0x00, 0x1F, 0x00, 0x1F, 0x08, 0x1F, 0x10, 0x1F, 0x18,
-    0x1F, 0x18, 0x1F, 0x20, 0x1F, 0x20, 0x1E, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1E, 0x20, 0x1E, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1E, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x00, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x18, 0x1F, 0x18, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1E, 0x20,
-    0x1E, 0x20, 0x3E, 0x20, 0x1E, 0x18, 0x1F, 0x20, 0x1F, 0x20, 0x1E, 0x20,
-    0x1E, 0x20, 0x1E, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x3F, 0x20, 0x3F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1E, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x00, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1E, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1E, 0x20, 0x1F, 0x20, 0x1F, 0x18,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x3F, 0x20, 0x1E, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x18, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x00, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x3F, 0x18, 0x3F, 0x18, 0x3F, 0x18, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1E, 0x20, 0x3E, 0x20,
-    0x1E, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x18, 0x1E, 0x18,
-    0x1F, 0x20, 0x1F, 0x28, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x00, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x18, 0x1F, 0x20,
-    0x1E, 0x28, 0x1F, 0x20, 0x1F, 0x20, 0x3F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x18, 0x3F, 0x20, 0x1E, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x18, 0x1F, 0x18, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x00, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1E, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x10, 0x1E, 0x00, 0x3F, 0x00,
-    0x1E, 0x00, 0x1F, 0x00, 0x1F, 0x08, 0x1F, 0x10, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x3F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x00, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x3F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x18, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x10,
-    0x1F, 0x00, 0x1E, 0x00, 0x1D, 0x08, 0x7E, 0x20, 0xFE, 0x51, 0xDE, 0x8B,
-    0xBE, 0x9C, 0xFE, 0x72, 0x5F, 0x49, 0x1D, 0x10, 0x1D, 0x00, 0x1E, 0x00,
-    0x1F, 0x08, 0x1F, 0x10, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x08, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1E, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1E, 0x20, 0x1E, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x18, 0x1F, 0x10, 0x1F, 0x08, 0x1E, 0x00, 0x1F, 0x08, 0x3C, 0x18,
-    0xFE, 0x51, 0x9F, 0x8B, 0x3D, 0xB5, 0x3E, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9E, 0xD6, 0x1E, 0xAD, 0x7E, 0x83,
-    0xBE, 0x49, 0x3D, 0x20, 0x1E, 0x00, 0x1E, 0x00, 0x1F, 0x08, 0x1F, 0x10,
-    0x1F, 0x18, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x08, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x3F, 0x20, 0x1E, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1E, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1E, 0x20,
-    0x1E, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x10, 0x1F, 0x00,
-    0x1F, 0x00, 0x1E, 0x08, 0x9D, 0x41, 0x7D, 0x83, 0x9E, 0xBD, 0xFF, 0xE6,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x1E, 0xE7, 0x7E, 0xBD, 0x7D, 0x7B, 0x5D, 0x41, 0x1E, 0x10,
-    0x1E, 0x00, 0x3E, 0x00, 0x1F, 0x08, 0x1F, 0x18, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1E, 0x20, 0x1E, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1E, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1E, 0x20,
-    0x1E, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1E, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1E, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1E, 0x20,
-    0x1F, 0x20, 0x1F, 0x00, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1E, 0x20, 0x3F, 0x20, 0x1E, 0x20, 0x1F, 0x20, 0x1E, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x3F, 0x20, 0x1F, 0x18, 0x1F, 0x20, 0x3F, 0x20,
-    0x1E, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1E, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1E, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x08, 0x1F, 0x00, 0x3F, 0x00, 0x1D, 0x00, 0xFE, 0x28, 0xDE, 0x6A,
-    0xDD, 0xAC, 0xDE, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0xDE,
-    0xBF, 0x9C, 0x9F, 0x6A, 0x3E, 0x41, 0x1E, 0x08, 0x1E, 0x00, 0x1F, 0x08,
-    0x1F, 0x10, 0x3F, 0x18, 0x1F, 0x20, 0x1E, 0x20, 0x1F, 0x20, 0x1E, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1E, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1E, 0x20, 0x1F, 0x18, 0x1E, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1E, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1E, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1E, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x08, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1E, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1E, 0x20,
-    0x3E, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x3F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x18, 0x3F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1E, 0x20, 0x1E, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x10, 0x3F, 0x00, 0x1F, 0x00, 0x1E, 0x10,
-    0x1E, 0x41, 0x7E, 0x6A, 0x1E, 0x94, 0xDD, 0xC5, 0x9E, 0xF7, 0xFE, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFE, 0xC5, 0x1E, 0x94, 0x7E, 0x5A,
-    0xBE, 0x20, 0x1E, 0x08, 0x1F, 0x00, 0x1F, 0x08, 0x1F, 0x10, 0x1F, 0x18,
-    0x1F, 0x18, 0x1F, 0x20, 0x1F, 0x20, 0x3F, 0x20, 0x1E, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1E, 0x20,
-    0x1E, 0x20, 0x1E, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1E, 0x20, 0x1E, 0x20,
-    0x1E, 0x20, 0x1F, 0x20, 0x1E, 0x20, 0x3F, 0x28, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x08, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1E, 0x20, 0x1F, 0x20,
-    0x1E, 0x20, 0x1F, 0x20, 0x1E, 0x20, 0x1E, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1E, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1E, 0x20, 0x1F, 0x20,
-    0x1E, 0x20, 0x1E, 0x18, 0x1F, 0x18, 0x1F, 0x10, 0x1F, 0x08, 0x1F, 0x00,
-    0x1E, 0x00, 0x1D, 0x08, 0x5C, 0x20, 0x1D, 0x52, 0xDD, 0x83, 0x3E, 0xCE,
-    0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF,
-    0xBF, 0xFF, 0x9E, 0xBD, 0x5D, 0x73, 0xFE, 0x49, 0x7C, 0x18, 0x1E, 0x10,
-    0x1E, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x1F, 0x10, 0x1F, 0x18, 0x1F, 0x18,
-    0x1F, 0x20, 0x1F, 0x20, 0x1E, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1E, 0x20, 0x1F, 0x20,
-    0x1E, 0x20, 0x3F, 0x20, 0x1E, 0x18, 0x1E, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1E, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1E, 0x20,
-    0x1F, 0x20, 0x1F, 0x08, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1E, 0x20, 0x1F, 0x20, 0x1E, 0x18, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1E, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x18, 0x3F, 0x18, 0x1F, 0x10, 0x1F, 0x00, 0x1F, 0x00,
-    0x1E, 0x00, 0x1E, 0x08, 0x1E, 0x10, 0x5E, 0x20, 0x5D, 0x41, 0x9E, 0x62,
-    0x5E, 0x94, 0xDF, 0xC5, 0x1E, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xB7, 0x9E, 0x4E, 0x3E, 0x26, 0x7F, 0x5E,
-    0x3E, 0xBF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0xF7, 0x1E, 0xD6,
-    0x5F, 0xBD, 0xFE, 0x93, 0x3D, 0x5A, 0x3E, 0x39, 0x7E, 0x18, 0x1D, 0x08,
-    0x1E, 0x00, 0x1F, 0x00, 0x1F, 0x08, 0x1F, 0x10, 0x1F, 0x18, 0x1F, 0x18,
-    0x1E, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x3F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x3F, 0x20, 0x1E, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x08, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1E, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x3F, 0x20, 0x1E, 0x20,
-    0x3F, 0x20, 0x1E, 0x20, 0x1F, 0x18, 0x1F, 0x18, 0x1F, 0x08, 0x1F, 0x00,
-    0x3F, 0x00, 0x1E, 0x00, 0x3E, 0x10, 0x9E, 0x28, 0xBD, 0x49, 0x3D, 0x5A,
-    0x9E, 0x83, 0x9C, 0xA4, 0x7F, 0xDE, 0x3E, 0xEF, 0xFF, 0xFF, 0xFE, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x9E, 0xD7, 0x5F, 0xBF,
-    0xDF, 0x76, 0x3E, 0x26, 0xDF, 0x05, 0xDF, 0x05, 0xDF, 0x05, 0xBF, 0x05,
-    0xDE, 0x05, 0x1F, 0x1E, 0xBF, 0x66, 0x3F, 0xA7, 0x9F, 0xD7, 0xDF, 0xF7,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xEF, 0x9E, 0xBD,
-    0xBD, 0x83, 0x9D, 0x62, 0x3E, 0x49, 0x5D, 0x20, 0x1D, 0x08, 0x1E, 0x00,
-    0x1F, 0x00, 0x1F, 0x00, 0x1F, 0x08, 0x1F, 0x10, 0x3F, 0x18, 0x3E, 0x18,
-    0x3F, 0x20, 0x1E, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1E, 0x20, 0x3F, 0x20,
-    0x1F, 0x18, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x00, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x18, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x18, 0x1F, 0x18, 0x1F, 0x10, 0x1E, 0x08, 0x1F, 0x08, 0x1E, 0x00,
-    0x1E, 0x00, 0x1F, 0x00, 0x1D, 0x08, 0x1C, 0x10, 0x1D, 0x31, 0x1E, 0x52,
-    0x1D, 0x73, 0x7D, 0x9C, 0x5E, 0xD6, 0x7E, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xBE, 0xD7, 0x1E, 0x8F, 0x7E, 0x46, 0xFE, 0x1D, 0xFF, 0x05, 0xBF, 0x05,
-    0xBF, 0x05, 0xDF, 0x0D, 0xFF, 0x05, 0xFF, 0x05, 0x1F, 0x06, 0x1F, 0x06,
-    0xFF, 0x05, 0xFF, 0x05, 0xBF, 0x05, 0x9F, 0x05, 0xDF, 0x0D, 0x1F, 0x16,
-    0x7D, 0x3E, 0x1E, 0x7F, 0x5E, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0xEF, 0x1F, 0xCE, 0x7D, 0x9C,
-    0xFD, 0x72, 0xFD, 0x51, 0x3E, 0x41, 0x3D, 0x20, 0x1D, 0x00, 0x1E, 0x00,
-    0x1E, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x1F, 0x08, 0x1F, 0x10, 0x1F, 0x18,
-    0x1F, 0x18, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20,
-    0x1F, 0x20, 0x1F, 0x00, 0x1F, 0x10, 0x1F, 0x10, 0x1F, 0x18, 0x1F, 0x18,
-    0x1F, 0x18, 0x1F, 0x18, 0x1F, 0x10, 0x1F, 0x10, 0x1F, 0x08, 0x1F, 0x08,
-    0x1F, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x08,
-    0x1E, 0x18, 0x1E, 0x18, 0x9D, 0x28, 0x3E, 0x5A, 0xDE, 0x51, 0x5E, 0x7B,
-    0x3E, 0x94, 0xFE, 0x93, 0x9F, 0xBD, 0x3D, 0xCE, 0xBF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xDF, 0xE7, 0x3E, 0xB7, 0xFF, 0x96, 0xDF, 0x66, 0x5E, 0x2E,
-    0xDE, 0x05, 0xDF, 0x05, 0xDF, 0x05, 0xDF, 0x05, 0xFF, 0x05, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0xFF, 0x05, 0xFF, 0x05, 0xFF, 0x05, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x0E, 0x1F, 0x06, 0xFF, 0x05, 0xFF, 0x05,
-    0xDF, 0x0D, 0x9F, 0x0D, 0xDF, 0x05, 0x3E, 0x26, 0xDE, 0x5E, 0xFE, 0x9E,
-    0x9F, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xE6, 0xDD, 0xC5, 0x5E, 0x9C,
-    0x1D, 0x94, 0xFF, 0x72, 0xFD, 0x51, 0x5E, 0x5A, 0x7E, 0x20, 0x1D, 0x18,
-    0x1F, 0x10, 0x1E, 0x08, 0x1E, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x1E, 0x00,
-    0x1E, 0x08, 0x1E, 0x00, 0x7E, 0x28, 0x7E, 0x28, 0x1F, 0x18, 0x1E, 0x08,
-    0x1D, 0x00, 0x1E, 0x08, 0x9E, 0x28, 0x9E, 0x30, 0x5E, 0x28, 0xFD, 0x51,
-    0x7D, 0x62, 0x1C, 0x5A, 0xBE, 0x83, 0x3F, 0xB5, 0xDD, 0xAC, 0x7F, 0xBD,
-    0xDF, 0xE6, 0xDD, 0xD6, 0x3E, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xE7, 0x5E, 0xAF, 0xBE, 0x66,
-    0x5F, 0x36, 0xFF, 0x15, 0xBF, 0x05, 0xBF, 0x05, 0xDF, 0x05, 0xDF, 0x05,
-    0xFF, 0x05, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0xDF, 0x05, 0x9F, 0x05, 0x9F, 0x05,
-    0xFF, 0x0D, 0x5E, 0x2E, 0x9E, 0x5E, 0xFF, 0x8E, 0x9E, 0xB7, 0xDF, 0xE7,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5E, 0xEF, 0xDD, 0xDE,
-    0x7F, 0xDE, 0xFE, 0xAC, 0xFE, 0xA4, 0xFF, 0xB4, 0xFE, 0xB4, 0x1E, 0xAD,
-    0x1E, 0xAD, 0xDF, 0xA4, 0x7E, 0xF7, 0xBF, 0xF7, 0x3E, 0xCE, 0xDF, 0xC5,
-    0xDF, 0xC5, 0xFE, 0xCD, 0x9F, 0xF7, 0x9E, 0xF7, 0x9F, 0xF7, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xE7, 0x5E, 0xB7,
-    0xDE, 0x7E, 0x9D, 0x56, 0x5E, 0x2E, 0xFF, 0x0D, 0xDF, 0x05, 0xBF, 0x05,
-    0xDF, 0x05, 0xFF, 0x05, 0xFF, 0x05, 0xFF, 0x05, 0xFF, 0x05, 0xFF, 0x05,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0xFF, 0x05, 0xFF, 0x05, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0xDF, 0x05, 0xBF, 0x05, 0xBF, 0x05, 0xBE, 0x05, 0xFF, 0x15,
-    0x3F, 0x2E, 0xBF, 0x6E, 0x5F, 0xBF, 0xDF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xF7, 0x9E, 0xD7,
-    0x3F, 0xAF, 0xFF, 0x86, 0x9E, 0x56, 0x5E, 0x26, 0x1F, 0x0E, 0xDF, 0x05,
-    0xBF, 0x05, 0xBF, 0x05, 0xDF, 0x05, 0xFF, 0x05, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0xFF, 0x05, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x3F, 0x06, 0xDF, 0x05, 0xFF, 0x05,
-    0xDF, 0x05, 0xBF, 0x05, 0xBF, 0x05, 0x1E, 0x16, 0x7E, 0x3E, 0xDF, 0x6E,
-    0x3E, 0x97, 0x7F, 0xAF, 0x9F, 0xCF, 0xDF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xEF,
-    0x9F, 0xC7, 0x3F, 0x9F, 0xDE, 0x6E, 0x9E, 0x56, 0x1E, 0x16, 0xFE, 0x05,
-    0xBF, 0x05, 0xBF, 0x05, 0xBF, 0x05, 0xDF, 0x05, 0xFF, 0x05, 0xFF, 0x05,
-    0x1F, 0x06, 0xFF, 0x05, 0x1F, 0x0E, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0xFF, 0x05, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0xFF, 0x05, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0xFF, 0x05, 0x1F, 0x06, 0x1F, 0x06, 0xDF, 0x05, 0x9F, 0x05,
-    0x9F, 0x05, 0xDF, 0x05, 0xDF, 0x05, 0x1E, 0x16, 0x7E, 0x36, 0xBE, 0x5E,
-    0xFE, 0x86, 0x3E, 0xA7, 0xBE, 0xD7, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xBF, 0xDF, 0xBF, 0xD7,
-    0x3F, 0xAF, 0xDE, 0x8E, 0xBF, 0x5E, 0x9F, 0x46, 0x5F, 0x2E, 0xFF, 0x15,
-    0xDF, 0x05, 0xBF, 0x05, 0xBF, 0x05, 0xBF, 0x05, 0xDF, 0x05, 0xFF, 0x05,
-    0x1F, 0x06, 0x1F, 0x06, 0xFF, 0x05, 0xFF, 0x0D, 0x1F, 0x06, 0x1F, 0x06,
-    0xFF, 0x05, 0xFF, 0x05, 0xFF, 0x05, 0xFF, 0x05, 0xFF, 0x05, 0xFF, 0x05,
-    0x1F, 0x06, 0xFF, 0x05, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0xFF, 0x05,
-    0xFF, 0x05, 0x1F, 0x06, 0x1F, 0x06, 0xFF, 0x05, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0xFF, 0x05, 0xFF, 0x05, 0xDF, 0x05, 0xBF, 0x05,
-    0xBF, 0x05, 0x9F, 0x05, 0x1F, 0x06, 0x1F, 0x1E, 0x7F, 0x3E, 0x7E, 0x56,
-    0xFE, 0x76, 0x3E, 0x9F, 0x9F, 0xCF, 0xBF, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0xBF, 0xFF, 0xE7, 0xDE, 0xF7, 0xDF, 0xF7,
-    0xFF, 0xF7, 0xDF, 0xF7, 0xDF, 0xF7, 0xDF, 0xF7, 0xFE, 0xF7, 0x7F, 0xCF,
-    0x5F, 0xAF, 0x7F, 0xAF, 0x7F, 0xBF, 0x7F, 0xBF, 0x5E, 0x97, 0x9E, 0x66,
-    0xDF, 0x66, 0x5D, 0x46, 0x3E, 0x2E, 0x7F, 0x2E, 0xFE, 0x05, 0xFF, 0x05,
-    0xBE, 0x05, 0xBE, 0x05, 0xBF, 0x05, 0xBF, 0x05, 0xDF, 0x05, 0xDF, 0x05,
-    0xFF, 0x05, 0xFF, 0x05, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0xFF, 0x05, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0xFF, 0x05,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0xFF, 0x05, 0xFF, 0x05,
-    0x1F, 0x06, 0x1F, 0x06, 0xFF, 0x05, 0xFF, 0x05, 0xFF, 0x05, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0xFF, 0x05, 0xFF, 0x05, 0xFF, 0x05,
-    0xFF, 0x05, 0xFF, 0x05, 0xFF, 0x05, 0xFF, 0x05, 0x1F, 0x06, 0xFF, 0x05,
-    0xFF, 0x05, 0x1F, 0x06, 0x1F, 0x06, 0xFF, 0x05, 0xFF, 0x05, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0xFF, 0x05, 0xFF, 0x05, 0xFF, 0x05,
-    0x1F, 0x06, 0x1F, 0x06, 0xFF, 0x05, 0xDF, 0x05, 0xBF, 0x05, 0xBF, 0x05,
-    0x9E, 0x05, 0xBF, 0x05, 0xFF, 0x05, 0xFF, 0x05, 0x5F, 0x2E, 0x3E, 0x36,
-    0xBF, 0x5E, 0x9E, 0x6E, 0x7F, 0xAF, 0x5F, 0xB7, 0xBF, 0xDF, 0xFF, 0xEF,
-    0xFE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x05, 0x1F, 0x16, 0x3E, 0x16, 0x3E, 0x16,
-    0x1F, 0x16, 0x1E, 0x16, 0x1E, 0x16, 0x3F, 0x16, 0x1F, 0x16, 0xDF, 0x05,
-    0xDF, 0x05, 0xDE, 0x05, 0xBF, 0x05, 0xDF, 0x05, 0xDF, 0x05, 0xBF, 0x05,
-    0x9F, 0x05, 0xDF, 0x05, 0xDF, 0x05, 0xDF, 0x05, 0xFF, 0x05, 0x1F, 0x06,
-    0xFF, 0x05, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0xFF, 0x05, 0x1F, 0x06, 0x1F, 0x06, 0xFF, 0x05, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0xFF, 0x0D, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0xFF, 0x05,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x0E, 0xFF, 0x05, 0xFF, 0x05, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0xFF, 0x05, 0xFF, 0x05,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0xFF, 0x05, 0x1F, 0x06, 0x1F, 0x06,
-    0xFF, 0x05, 0xFF, 0x05, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0xFF, 0x05, 0xFF, 0x05, 0xFF, 0x05, 0x1F, 0x06, 0xFF, 0x05,
-    0x1F, 0x0E, 0xFF, 0x05, 0x1F, 0x06, 0xFF, 0x05, 0xDF, 0x05, 0xDF, 0x05,
-    0xBF, 0x05, 0x9F, 0x05, 0xDF, 0x05, 0xBF, 0x05, 0xDE, 0x05, 0x1F, 0x16,
-    0x3F, 0x1E, 0x7F, 0x56, 0x7F, 0x56, 0x5F, 0x46, 0xBE, 0x66, 0x3F, 0xA7,
-    0xFE, 0x8E, 0xDE, 0xDF, 0x9F, 0x05, 0xDF, 0x05, 0xFF, 0x05, 0xFF, 0x05,
-    0xDF, 0x05, 0xFF, 0x05, 0xDF, 0x05, 0xDF, 0x05, 0xFF, 0x05, 0xFF, 0x05,
-    0xFF, 0x05, 0xFF, 0x05, 0x1F, 0x06, 0xFF, 0x05, 0xFF, 0x05, 0xFF, 0x05,
-    0x1F, 0x06, 0x1F, 0x06, 0xFF, 0x05, 0x1F, 0x06, 0x1F, 0x0E, 0xFF, 0x05,
-    0x1F, 0x06, 0x1F, 0x06, 0xFF, 0x05, 0xFF, 0x05, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0xFF, 0x05, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0xFF, 0x05, 0xFF, 0x05, 0xFF, 0x05, 0xFF, 0x0D, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0xFF, 0x05, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0xFF, 0x05, 0xFF, 0x05, 0x1F, 0x06, 0xFF, 0x05, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0xFF, 0x05, 0x1F, 0x06, 0xFF, 0x05, 0xFF, 0x05,
-    0x1F, 0x06, 0x1F, 0x06, 0xFF, 0x05, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0xFF, 0x05,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0xFF, 0x05, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0xFF, 0x05, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06,
-    0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x06, 0x1F, 0x0E, 0x1F, 0x06, 0x1F, 0x06,
-    0xFF, 0x05, 0x1F, 0x06, 0xFF, 0x05, 0x1F, 0x06, 0xFF, 0x05, 0xFF, 0x05,
-    0xFF, 0x05, 0xBF, 0x05, 0xBF, 0x05, 0xDF, 0x05, 0xDF, 0x05, 0x7F, 0x05,
-    0xFF, 0x05, 0xBF, 0xE7, 0x0A
+#if RESOURCE_BUILTIN_LOGOS
+
+/* 120x120, 28800 -> 7920 bytes */
+const uint8_t img_logo_marine_120x120_rle[] = {
+    0x54, 0x53, 0x52, 0x4c, 0x78, 0x00, 0x78, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0xff, 0x1f, 0x20, 0x1f, 0x06, 0xff, 0x05, 0x1e, 0x20, 
+    0x1f, 0x18, 0x1e, 0x00, 0x1f, 0x00, 0x1f, 0x08, 0xdf, 0x05, 0xbf, 0x05, 0x3f, 0x20, 0xbf, 0x8b, 0x1f, 0x28, 0x1e, 0x08, 0x1f, 0x10, 
+    0x1e, 0x18, 0x3f, 0x18, 0x1e, 0x5a, 0xdf, 0xff, 0x9f, 0x05, 0xfe, 0xff, 0xbf, 0xc5, 0x3e, 0x20, 0xff, 0x0d, 0x1d, 0x08, 0x1f, 0x0e, 
+    0x1e, 0x28, 0x1d, 0x00, 0x3f, 0x06, 0x1e, 0x10, 0x3f, 0x00, 0x3e, 0x00, 0xde, 0x05, 0xdf, 0xf7, 0x9f, 0xf7, 0xff, 0xf7, 0xbe, 0x05, 
+    0x3e, 0x18, 0xdf, 0x8b, 0xdf, 0x0d, 0x1e, 0x16, 0x3e, 0x10, 0xdf, 0xc5, 0x3f, 0x10, 0x1d, 0x10, 0x1f, 0x16, 0xbe, 0xde, 0xbf, 0x0d, 
+    0x9f, 0xd7, 0x5e, 0xb7, 0x9f, 0xcf, 0x5f, 0x2e, 0x1e, 0xe7, 0x3f, 0x28, 0x5f, 0xf7, 0x1e, 0x94, 0x7f, 0x46, 0xbf, 0xdf, 0xfe, 0x05, 
+    0x7f, 0xc7, 0x3e, 0x08, 0x7f, 0xf7, 0xbe, 0xa4, 0x3d, 0x10, 0x5d, 0x7b, 0x3d, 0x18, 0x9e, 0xde, 0xfe, 0x51, 0x7e, 0xf7, 0x7e, 0x20, 
+    0x9e, 0xbd, 0x1f, 0x1e, 0x7f, 0x3e, 0xbf, 0xe7, 0x3f, 0xa7, 0xdf, 0xef, 0x3e, 0x26, 0x7f, 0xbf, 0xbf, 0x66, 0xbe, 0x51, 0x1d, 0xad, 
+    0x3e, 0x62, 0x9f, 0xbd, 0x5e, 0xb5, 0x9f, 0xde, 0x3e, 0x94, 0xdf, 0xe6, 0x5e, 0x28, 0x5e, 0x5a, 0xfd, 0xac, 0x3e, 0x73, 0xfe, 0x8b, 
+    0x1d, 0x18, 0xfe, 0xc5, 0xfe, 0x28, 0x3e, 0x39, 0x1e, 0x73, 0xfe, 0x72, 0x9f, 0xc7, 0x3e, 0xce, 0x7f, 0x05, 0xbe, 0x6e, 0x3f, 0x2e, 
+    0x7f, 0x56, 0x9e, 0x4e, 0x9e, 0xd7, 0xbf, 0x6e, 0x5f, 0x36, 0xbe, 0x83, 0xff, 0xef, 0x7f, 0xd7, 0xbe, 0x66, 0x5f, 0xbf, 0x3f, 0x9f, 
+    0x5e, 0x2e, 0x9e, 0x56, 0x1e, 0xad, 0xfd, 0x51, 0x1d, 0x20, 0xbe, 0x8b, 0x3f, 0xef, 0x3e, 0x5a, 0x1d, 0x5a, 0x9e, 0xa4, 0xfe, 0xa4, 
+    0xfe, 0xcd, 0x5e, 0x39, 0xfe, 0xb4, 0x5e, 0x20, 0xbe, 0xf7, 0x3d, 0x39, 0x7e, 0x41, 0xdf, 0xa4, 0xbf, 0xf7, 0x7f, 0xbd, 0xbe, 0xff, 
+    0xbe, 0x49, 0x7e, 0x30, 0x7e, 0xbd, 0xbe, 0x41, 0xde, 0xe6, 0x3e, 0xef, 0x5e, 0x94, 0x3f, 0xb5, 0x9e, 0x20, 0x5d, 0x28, 0x1e, 0x31, 
+    0xff, 0xe6, 0x1e, 0x8c, 0x1d, 0xce, 0x9e, 0x62, 0x1e, 0x41, 0xdf, 0xde, 0x3e, 0x41, 0x7d, 0x52, 0xde, 0x72, 0x7e, 0xef, 0xde, 0x51, 
+    0xde, 0x6a, 0x5e, 0x9c, 0x7e, 0x46, 0x1f, 0x97, 0x3d, 0x20, 0xbe, 0x6a, 0xdf, 0x76, 0x7e, 0xc7, 0x5d, 0xb5, 0xdf, 0x86, 0xbf, 0xff, 
+    0x5f, 0xb7, 0x3f, 0x26, 0x3f, 0x97, 0x5e, 0xd6, 0xfd, 0x72, 0xbe, 0x5e, 0xff, 0x76, 0x3f, 0xaf, 0x3e, 0x7b, 0x1e, 0x1e, 0x1f, 0x87, 
+    0x5f, 0xaf, 0x3f, 0x16, 0x5f, 0xa7, 0xfe, 0x7e, 0x7f, 0xb7, 0x9e, 0x05, 0xdf, 0x66, 0x3f, 0x1e, 0x5e, 0x7b, 0xfe, 0x93, 0xff, 0x8e, 
+    0x9f, 0x0d, 0x3e, 0x9c, 0x7d, 0x9c, 0xff, 0x15, 0x7f, 0xaf, 0x1f, 0x94, 0xfd, 0x8b, 0xbd, 0x8b, 0xff, 0x8b, 0xbe, 0x30, 0xff, 0xcd, 
+    0x1e, 0xce, 0x3e, 0xe7, 0xbd, 0x28, 0x7f, 0x41, 0xbd, 0x7b, 0x1e, 0x52, 0x5d, 0x39, 0x5d, 0x18, 0x3d, 0x7b, 0xde, 0xff, 0x7e, 0x9c, 
+    0x9d, 0x28, 0xff, 0x59, 0xbd, 0xa4, 0xdd, 0x8b, 0x1d, 0x29, 0x9e, 0x83, 0xdf, 0x28, 0x5e, 0x83, 0xde, 0x49, 0xfe, 0xac, 0x1d, 0x73, 
+    0x7f, 0xb5, 0xff, 0xc5, 0xde, 0xac, 0xde, 0xf7, 0x3d, 0x94, 0xbd, 0x62, 0x1e, 0xc6, 0x9d, 0x41, 0x5e, 0xef, 0xde, 0xc5, 0x1d, 0xc6, 
+    0x7e, 0x49, 0x5f, 0x49, 0x5f, 0xb5, 0x3d, 0xce, 0x7f, 0xd6, 0x5e, 0x62, 0xfd, 0x6a, 0xbd, 0x20, 0x7e, 0x5a, 0x1f, 0xce, 0xde, 0x8b, 
+    0xfe, 0xe6, 0xfd, 0x8e, 0xfe, 0x8e, 0x5e, 0x41, 0x9d, 0xb5, 0x9e, 0xef, 0x9d, 0x62, 0x9f, 0xdf, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 
+    0x00, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x53, 0x00, 0x00, 0x00, 0x6e, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 
+    0xa9, 0x00, 0x00, 0x00, 0xc3, 0x00, 0x00, 0x00, 0xd8, 0x00, 0x00, 0x00, 0xeb, 0x00, 0x00, 0x00, 0xfd, 0x00, 0x00, 0x00, 0x10, 0x01, 
+    0x00, 0x00, 0x21, 0x01, 0x00, 0x00, 0x36, 0x01, 0x00, 0x00, 0x49, 0x01, 0x00, 0x00, 0x6d, 0x01, 0x00, 0x00, 0x95, 0x01, 0x00, 0x00, 
+    0xc2, 0x01, 0x00, 0x00, 0xf6, 0x01, 0x00, 0x00, 0x27, 0x02, 0x00, 0x00, 0x58, 0x02, 0x00, 0x00, 0x83, 0x02, 0x00, 0x00, 0xb2, 0x02, 
+    0x00, 0x00, 0xe5, 0x02, 0x00, 0x00, 0x16, 0x03, 0x00, 0x00, 0x44, 0x03, 0x00, 0x00, 0x74, 0x03, 0x00, 0x00, 0xa8, 0x03, 0x00, 0x00, 
+    0xdd, 0x03, 0x00, 0x00, 0x10, 0x04, 0x00, 0x00, 0x4b, 0x04, 0x00, 0x00, 0x89, 0x04, 0x00, 0x00, 0xc0, 0x04, 0x00, 0x00, 0xfc, 0x04, 
+    0x00, 0x00, 0x35, 0x05, 0x00, 0x00, 0x72, 0x05, 0x00, 0x00, 0xa9, 0x05, 0x00, 0x00, 0xe2, 0x05, 0x00, 0x00, 0x17, 0x06, 0x00, 0x00, 
+    0x4d, 0x06, 0x00, 0x00, 0x78, 0x06, 0x00, 0x00, 0x9c, 0x06, 0x00, 0x00, 0xc5, 0x06, 0x00, 0x00, 0xef, 0x06, 0x00, 0x00, 0x1b, 0x07, 
+    0x00, 0x00, 0x4c, 0x07, 0x00, 0x00, 0x7e, 0x07, 0x00, 0x00, 0xbf, 0x07, 0x00, 0x00, 0x06, 0x08, 0x00, 0x00, 0x5a, 0x08, 0x00, 0x00, 
+    0xb6, 0x08, 0x00, 0x00, 0x0c, 0x09, 0x00, 0x00, 0x57, 0x09, 0x00, 0x00, 0x9c, 0x09, 0x00, 0x00, 0xf1, 0x09, 0x00, 0x00, 0x2f, 0x0a, 
+    0x00, 0x00, 0x74, 0x0a, 0x00, 0x00, 0xc6, 0x0a, 0x00, 0x00, 0x1d, 0x0b, 0x00, 0x00, 0x6d, 0x0b, 0x00, 0x00, 0xbe, 0x0b, 0x00, 0x00, 
+    0x11, 0x0c, 0x00, 0x00, 0x67, 0x0c, 0x00, 0x00, 0xb5, 0x0c, 0x00, 0x00, 0x05, 0x0d, 0x00, 0x00, 0x54, 0x0d, 0x00, 0x00, 0x8f, 0x0d, 
+    0x00, 0x00, 0xcd, 0x0d, 0x00, 0x00, 0x15, 0x0e, 0x00, 0x00, 0x59, 0x0e, 0x00, 0x00, 0xcb, 0x0e, 0x00, 0x00, 0x21, 0x0f, 0x00, 0x00, 
+    0x44, 0x0f, 0x00, 0x00, 0x60, 0x0f, 0x00, 0x00, 0x7c, 0x0f, 0x00, 0x00, 0x9f, 0x0f, 0x00, 0x00, 0xc5, 0x0f, 0x00, 0x00, 0xe9, 0x0f, 
+    0x00, 0x00, 0x12, 0x10, 0x00, 0x00, 0x31, 0x10, 0x00, 0x00, 0x6a, 0x10, 0x00, 0x00, 0xb0, 0x10, 0x00, 0x00, 0xf6, 0x10, 0x00, 0x00, 
+    0x45, 0x11, 0x00, 0x00, 0x8d, 0x11, 0x00, 0x00, 0xdb, 0x11, 0x00, 0x00, 0x33, 0x12, 0x00, 0x00, 0x7b, 0x12, 0x00, 0x00, 0xc1, 0x12, 
+    0x00, 0x00, 0x13, 0x13, 0x00, 0x00, 0x72, 0x13, 0x00, 0x00, 0xaf, 0x13, 0x00, 0x00, 0xeb, 0x13, 0x00, 0x00, 0x36, 0x14, 0x00, 0x00, 
+    0x8b, 0x14, 0x00, 0x00, 0xe4, 0x14, 0x00, 0x00, 0x04, 0x15, 0x00, 0x00, 0x20, 0x15, 0x00, 0x00, 0x38, 0x15, 0x00, 0x00, 0x4e, 0x15, 
+    0x00, 0x00, 0x67, 0x15, 0x00, 0x00, 0x7e, 0x15, 0x00, 0x00, 0x9f, 0x15, 0x00, 0x00, 0xd1, 0x15, 0x00, 0x00, 0x17, 0x16, 0x00, 0x00, 
+    0x6d, 0x16, 0x00, 0x00, 0xbd, 0x16, 0x00, 0x00, 0x1a, 0x17, 0x00, 0x00, 0x6e, 0x17, 0x00, 0x00, 0xcb, 0x17, 0x00, 0x00, 0x28, 0x18, 
+    0x00, 0x00, 0x88, 0x18, 0x00, 0x00, 0xe1, 0x18, 0x00, 0x00, 0x17, 0x19, 0x00, 0x00, 0x4c, 0x19, 0x00, 0x00, 0x8b, 0x19, 0x00, 0x00, 
+    0xd7, 0x19, 0x00, 0x00, 0x49, 0x1a, 0x00, 0x00, 0xa8, 0x1a, 0x00, 0x00, 0x06, 0xff, 0x04, 0xe0, 0xff, 0x01, 0x0f, 0x07, 0x08, 0x2a, 
+    0x05, 0x01, 0x81, 0x05, 0x01, 0x01, 0x10, 0xea, 0x05, 0x01, 0x01, 0x05, 0x06, 0x07, 0xff, 0xbc, 0x30, 0x01, 0x04, 0x0d, 0x01, 0x04, 
+    0x86, 0x01, 0x00, 0x04, 0x81, 0x01, 0x00, 0x04, 0xe3, 0x01, 0x01, 0x05, 0x04, 0x01, 0x01, 0x07, 0x82, 0x01, 0x06, 0x10, 0x01, 0x0d, 
+    0x04, 0x17, 0x01, 0x0b, 0xe8, 0x01, 0x02, 0x04, 0x01, 0x04, 0x03, 0x17, 0x07, 0x17, 0x10, 0x82, 0x01, 0x00, 0x10, 0x82, 0x01, 0x81, 
+    0x04, 0xe6, 0x01, 0x00, 0x04, 0x82, 0x01, 0x0b, 0x05, 0x08, 0x01, 0x04, 0x01, 0x04, 0x17, 0x26, 0x01, 0x1b, 0x77, 0x0b, 0x83, 0x01, 
+    0x00, 0x04, 0xe0, 0x01, 0x02, 0x0b, 0x0d, 0x05, 0x81, 0x01, 0x00, 0x04, 0x01, 0x01, 0x08, 0x82, 0x01, 0x05, 0x04, 0x01, 0x0d, 0x01, 
+    0x0b, 0x07, 0x81, 0x06, 0x81, 0x07, 0x81, 0x06, 0x00, 0x07, 0xdf, 0x06, 0x00, 0x0f, 0x84, 0x01, 0x01, 0x05, 0x07, 0x81, 0x01, 0x00, 
+    0x10, 0x81, 0x01, 0x0a, 0x04, 0x0f, 0x06, 0x50, 0xc5, 0xc6, 0x0c, 0x27, 0xc7, 0xc8, 0x78, 0xd7, 0x0c, 0x87, 0x27, 0x01, 0xc9, 0x08, 
+    0x81, 0x0d, 0x01, 0x11, 0x04, 0x0a, 0x05, 0x08, 0x0b, 0x05, 0x04, 0x01, 0x04, 0x05, 0x1e, 0xff, 0xde, 0x7b, 0x15, 0xe6, 0x00, 0x02, 
+    0x79, 0xff, 0x1e, 0x29, 0x0f, 0x81, 0x01, 0x00, 0x0d, 0x04, 0x01, 0x0e, 0x04, 0x01, 0x04, 0x81, 0x01, 0x01, 0x07, 0xff, 0xbe, 0xac, 
+    0xe9, 0x00, 0x04, 0x51, 0x06, 0x05, 0x01, 0x0b, 0x07, 0x05, 0x08, 0x01, 0x04, 0x0b, 0x77, 0x08, 0xff, 0xfe, 0x30, 0xea, 0x00, 0x02, 
+    0xca, 0x0e, 0x05, 0x81, 0x01, 0x03, 0x01, 0x08, 0x01, 0x0d, 0x81, 0x01, 0x01, 0x1f, 0x52, 0xea, 0x00, 0x04, 0x2b, 0x06, 0x05, 0x01, 
+    0x04, 0x01, 0x01, 0x08, 0x82, 0x01, 0x02, 0x05, 0x1f, 0xff, 0xfd, 0x59, 0xea, 0x00, 0x02, 0x53, 0x3d, 0x0b, 0x81, 0x01, 0x01, 0x01, 
+    0x08, 0x82, 0x01, 0x02, 0x10, 0x07, 0x7a, 0xea, 0x00, 0x02, 0x16, 0x0e, 0x05, 0x81, 0x01, 0x07, 0x01, 0x08, 0x01, 0x04, 0x05, 0x01, 
+    0x06, 0x7b, 0xc8, 0x00, 0x00, 0x15, 0xa0, 0x00, 0x02, 0x16, 0x0e, 0x05, 0x81, 0x01, 0x07, 0x01, 0x08, 0x04, 0x0d, 0x01, 0x04, 0x07, 
+    0xff, 0x1f, 0x5a, 0xea, 0x00, 0x02, 0x53, 0x0e, 0x05, 0x81, 0x01, 0x02, 0x01, 0x08, 0x01, 0x81, 0x04, 0x02, 0x05, 0x07, 0x12, 0xc2, 
+    0x00, 0x08, 0x3e, 0x54, 0x7c, 0xff, 0xdf, 0xac, 0x3f, 0xff, 0xde, 0xa4, 0x3f, 0xff, 0x9d, 0xa4, 0xcb, 0x9e, 0x00, 0x02, 0x16, 0x0e, 
+    0x05, 0x81, 0x01, 0x01, 0x01, 0x08, 0x83, 0x01, 0x01, 0x07, 0x12, 0xbe, 0x00, 0x07, 0xcc, 0x7d, 0xff, 0xfe, 0x6a, 0x50, 0xcd, 0x0e, 
+    0x07, 0x06, 0x81, 0x1c, 0x05, 0x0e, 0x06, 0x40, 0xce, 0xcf, 0xff, 0x5f, 0xce, 0x9b, 0x00, 0x02, 0x16, 0x0e, 0x05, 0x81, 0x01, 0x01, 
+    0x01, 0x08, 0x83, 0x01, 0x01, 0x07, 0x12, 0xba, 0x00, 0x04, 0x15, 0x7e, 0xff, 0xff, 0x93, 0xd0, 0x2a, 0x81, 0x06, 0x04, 0x07, 0x08, 
+    0x05, 0x01, 0x04, 0x81, 0x01, 0x07, 0x05, 0x01, 0x05, 0x08, 0x07, 0x3d, 0xd1, 0x55, 0x99, 0x00, 0x02, 0x16, 0x0e, 0x05, 0x81, 0x01, 
+    0x01, 0x01, 0x08, 0x83, 0x01, 0x01, 0x07, 0x12, 0xb8, 0x00, 0x03, 0x2f, 0x56, 0x7f, 0x08, 0x81, 0x07, 0x02, 0x2c, 0x01, 0x0d, 0x81, 
+    0x01, 0x81, 0x04, 0x82, 0x01, 0x00, 0x04, 0x81, 0x01, 0x05, 0x04, 0x0d, 0x0f, 0x07, 0xd2, 0xff, 0x5f, 0xde, 0x84, 0x00, 0x00, 0x15, 
+    0x92, 0x00, 0x02, 0x16, 0x0e, 0x05, 0x81, 0x01, 0x01, 0x01, 0x08, 0x83, 0x01, 0x01, 0x07, 0x12, 0xb6, 0x00, 0x0b, 0x57, 0x41, 0x42, 
+    0x07, 0x0e, 0x10, 0x01, 0x0d, 0x04, 0x01, 0x05, 0x01, 0x82, 0x04, 0x82, 0x01, 0x00, 0x04, 0x82, 0x01, 0x00, 0x05, 0x81, 0x01, 0x02, 
+    0x07, 0x40, 0xff, 0xbf, 0xbd, 0x97, 0x00, 0x02, 0x16, 0x0e, 0x05, 0x81, 0x01, 0x01, 0x01, 0x08, 0x83, 0x01, 0x01, 0x07, 0x12, 0xb4, 
+    0x00, 0x04, 0x35, 0xd3, 0x10, 0x06, 0x0f, 0x82, 0x01, 0x81, 0x04, 0x01, 0x01, 0x04, 0x85, 0x01, 0x00, 0x04, 0x81, 0x01, 0x01, 0x04, 
+    0x0d, 0x81, 0x01, 0x05, 0x10, 0x01, 0x0d, 0x1f, 0x1c, 0x80, 0x96, 0x00, 0x02, 0x16, 0x0e, 0x05, 0x81, 0x01, 0x01, 0x01, 0x08, 0x83, 
+    0x01, 0x01, 0x07, 0x12, 0xb2, 0x00, 0x07, 0xd4, 0xff, 0x9e, 0x9c, 0x81, 0x07, 0x0f, 0x0d, 0x11, 0x04, 0x86, 0x01, 0x82, 0x04, 0x88, 
+    0x01, 0x06, 0x1b, 0x0d, 0x01, 0x04, 0x08, 0x1e, 0x43, 0x95, 0x00, 0x02, 0x16, 0x0e, 0x05, 0x81, 0x01, 0x01, 0x01, 0x08, 0x83, 0x01, 
+    0x01, 0x07, 0x12, 0xb0, 0x00, 0x08, 0x82, 0xd5, 0x83, 0x06, 0x08, 0x01, 0x0b, 0x01, 0x1b, 0x85, 0x01, 0x00, 0x04, 0x89, 0x01, 0x0b, 
+    0x10, 0x01, 0x05, 0x01, 0x05, 0x10, 0x0d, 0x01, 0x07, 0x84, 0x00, 0x13, 0x93, 0x00, 0x02, 0x16, 0x0e, 0x05, 0x81, 0x01, 0x01, 0x01, 
+    0x08, 0x83, 0x01, 0x01, 0x07, 0x12, 0xaf, 0x00, 0x03, 0x85, 0xd6, 0x1c, 0x08, 0x82, 0x01, 0x81, 0x04, 0x81, 0x01, 0x81, 0x04, 0x83, 
+    0x01, 0x81, 0x04, 0x86, 0x01, 0x00, 0x04, 0x82, 0x01, 0x81, 0x04, 0x01, 0x01, 0x05, 0x81, 0x01, 0x01, 0x06, 0x3f, 0x94, 0x00, 0x02, 
+    0x16, 0x0e, 0x05, 0x81, 0x01, 0x01, 0x01, 0x08, 0x83, 0x01, 0x01, 0x07, 0x12, 0xad, 0x00, 0x03, 0xff, 0xbe, 0xd6, 0xff, 0x7d, 0x5a, 
+    0x08, 0x07, 0x8f, 0x01, 0x00, 0x04, 0x83, 0x01, 0x00, 0x04, 0x82, 0x01, 0x02, 0x0b, 0x01, 0x0d, 0x83, 0x01, 0x04, 0x04, 0x0d, 0x07, 
+    0x58, 0x86, 0x93, 0x00, 0x02, 0x16, 0x0e, 0x05, 0x81, 0x01, 0x01, 0x01, 0x08, 0x83, 0x01, 0x01, 0x07, 0x12, 0xab, 0x00, 0x04, 0xd4, 
+    0xc8, 0x1e, 0x07, 0x05, 0x95, 0x01, 0x00, 0x05, 0x81, 0x01, 0x03, 0x04, 0x01, 0x05, 0x11, 0x81, 0x04, 0x01, 0x01, 0x0d, 0x81, 0x01, 
+    0x02, 0x11, 0x0e, 0x87, 0x93, 0x00, 0x02, 0x16, 0x0e, 0x05, 0x81, 0x01, 0x01, 0x01, 0x08, 0x83, 0x01, 0x01, 0x07, 0x12, 0xaa, 0x00, 
+    0x04, 0x88, 0xff, 0x7d, 0x39, 0x06, 0x2c, 0x1b, 0x92, 0x01, 0x03, 0x05, 0x11, 0x04, 0x1b, 0x85, 0x01, 0x00, 0x04, 0x82, 0x01, 0x05, 
+    0x05, 0x01, 0x05, 0x0d, 0x06, 0xff, 0x7e, 0x62, 0x93, 0x00, 0x02, 0x16, 0x0e, 0x05, 0x81, 0x01, 0x01, 0x01, 0x08, 0x83, 0x01, 0x01, 
+    0x07, 0x12, 0xa8, 0x00, 0x08, 0x13, 0x57, 0xff, 0x9e, 0x39, 0x07, 0x01, 0x04, 0x01, 0x04, 0x0b, 0x8f, 0x01, 0x02, 0x04, 0x01, 0x0d, 
+    0x83, 0x01, 0x02, 0x04, 0x01, 0x1b, 0x82, 0x01, 0x81, 0x04, 0x82, 0x01, 0x02, 0x0d, 0x06, 0x89, 0x93, 0x00, 0x02, 0x16, 0x0e, 0x05, 
+    0x81, 0x01, 0x01, 0x01, 0x08, 0x83, 0x01, 0x01, 0x07, 0x12, 0xa8, 0x00, 0x03, 0xff, 0x9d, 0x9c, 0x40, 0x08, 0x04, 0x83, 0x01, 0x00, 
+    0x04, 0x8f, 0x01, 0x00, 0x05, 0x83, 0x01, 0x00, 0x05, 0x81, 0x01, 0x01, 0x17, 0x10, 0x83, 0x01, 0x02, 0x0d, 0x10, 0x01, 0x81, 0x04, 
+    0x01, 0x07, 0x7a, 0x93, 0x00, 0x02, 0x16, 0x0e, 0x05, 0x81, 0x01, 0x01, 0x01, 0x08, 0x83, 0x01, 0x01, 0x07, 0x12, 0xa6, 0x00, 0x08, 
+    0x43, 0x44, 0x06, 0x08, 0x04, 0x01, 0x05, 0x0d, 0x05, 0x91, 0x01, 0x04, 0x11, 0x01, 0x04, 0x01, 0x0b, 0x81, 0x01, 0x05, 0x0f, 0x08, 
+    0x0f, 0x05, 0x01, 0x04, 0x84, 0x01, 0x02, 0x0b, 0x07, 0xd7, 0x93, 0x00, 0x02, 0x16, 0x0e, 0x05, 0x81, 0x01, 0x01, 0x01, 0x08, 0x83, 
+    0x01, 0x01, 0x07, 0x12, 0xa5, 0x00, 0x05, 0xd8, 0xff, 0x3d, 0x08, 0x06, 0x01, 0x0b, 0x01, 0x81, 0x04, 0x02, 0x11, 0x0d, 0x04, 0x90, 
+    0x01, 0x00, 0x0d, 0x81, 0x01, 0x0d, 0x0d, 0x01, 0x1f, 0x06, 0x10, 0x8a, 0x58, 0x3d, 0x20, 0x01, 0x0d, 0x10, 0x01, 0x04, 0x81, 0x01, 
+    0x01, 0x06, 0x50, 0x93, 0x00, 0x02, 0x16, 0x0e, 0x05, 0x81, 0x01, 0x01, 0x01, 0x08, 0x83, 0x01, 0x01, 0x07, 0x12, 0xa3, 0x00, 0x04, 
+    0x3e, 0xff, 0xdc, 0x62, 0x07, 0x08, 0x01, 0x81, 0x04, 0x83, 0x01, 0x01, 0x0b, 0x04, 0x91, 0x01, 0x0d, 0x04, 0x11, 0x07, 0x06, 0xff, 
+    0x7e, 0x39, 0xd9, 0x55, 0x3e, 0xff, 0x7f, 0xef, 0x8b, 0x59, 0x0e, 0x0f, 0x36, 0x82, 0x01, 0x02, 0x0d, 0x06, 0xff, 0x1f, 0x73, 0x93, 
+    0x00, 0x02, 0x16, 0x0e, 0x05, 0x81, 0x01, 0x01, 0x01, 0x08, 0x83, 0x01, 0x01, 0x07, 0x12, 0xa2, 0x00, 0x06, 0x2b, 0xff, 0xfd, 0x28, 
+    0x08, 0x05, 0x0d, 0x04, 0x0b, 0x91, 0x01, 0x00, 0x04, 0x81, 0x01, 0x07, 0x04, 0x0d, 0x04, 0x0d, 0x2c, 0x06, 0xda, 0x5a, 0x86, 0x00, 
+    0x08, 0xcf, 0x08, 0x05, 0x01, 0x04, 0x05, 0x01, 0x06, 0x7c, 0x93, 0x00, 0x02, 0x16, 0x0e, 0x05, 0x81, 0x01, 0x01, 0x01, 0x08, 0x83, 
+    0x01, 0x01, 0x07, 0x12, 0xa1, 0x00, 0x02, 0x5b, 0x06, 0x07, 0x81, 0x01, 0x00, 0x17, 0x92, 0x01, 0x0a, 0x04, 0x01, 0x10, 0x0d, 0x04, 
+    0x10, 0x01, 0x08, 0x0e, 0x5c, 0x23, 0x83, 0x00, 0x02, 0x15, 0x13, 0x00, 0x81, 0x13, 0x02, 0xff, 0x9d, 0x7b, 0x0e, 0x10, 0x81, 0x01, 
+    0x02, 0x10, 0x06, 0x2b, 0x93, 0x00, 0x02, 0x16, 0x0e, 0x05, 0x81, 0x01, 0x01, 0x01, 0x08, 0x83, 0x01, 0x01, 0x07, 0x12, 0xa0, 0x00, 
+    0x07, 0x8c, 0x06, 0x05, 0x0d, 0x01, 0x0b, 0x04, 0x05, 0x93, 0x01, 0x06, 0x0b, 0x01, 0x04, 0x0d, 0x2c, 0x0e, 0xff, 0xbd, 0x9c, 0x82, 
+    0x00, 0x00, 0x13, 0x86, 0x00, 0x08, 0xd9, 0x06, 0x0d, 0x04, 0x1b, 0x1f, 0xff, 0x5f, 0x62, 0x00, 0x15, 0x92, 0x00, 0x02, 0x16, 0x0e, 
+    0x05, 0x81, 0x01, 0x01, 0x01, 0x08, 0x83, 0x01, 0x01, 0x07, 0x12, 0x9e, 0x00, 0x04, 0x8d, 0xff, 0xbd, 0x41, 0x07, 0x01, 0x36, 0x81, 
+    0x04, 0x82, 0x01, 0x00, 0x05, 0x8f, 0x01, 0x00, 0x04, 0x82, 0x01, 0x06, 0x17, 0x0b, 0x01, 0x0e, 0xdb, 0x00, 0x15, 0x87, 0x00, 0x03, 
+    0x13, 0x00, 0xdc, 0x07, 0x81, 0x01, 0x04, 0x08, 0x1e, 0x8e, 0x00, 0x15, 0x92, 0x00, 0x02, 0x16, 0x0e, 0x05, 0x81, 0x01, 0x01, 0x01, 
+    0x08, 0x83, 0x01, 0x01, 0x07, 0x12, 0x9d, 0x00, 0x05, 0x8f, 0xff, 0x5e, 0x10, 0x07, 0x0b, 0x01, 0x04, 0x81, 0x0d, 0x02, 0x0b, 0x04, 
+    0x0d, 0x90, 0x01, 0x02, 0x0d, 0x10, 0x0b, 0x81, 0x04, 0x02, 0x01, 0x1f, 0x83, 0x8b, 0x00, 0x06, 0xdd, 0x07, 0x01, 0x17, 0x05, 0x06, 
+    0x78, 0x95, 0x00, 0x02, 0x16, 0x0e, 0x05, 0x81, 0x01, 0x01, 0x01, 0x08, 0x83, 0x01, 0x01, 0x07, 0x12, 0x9b, 0x00, 0x04, 0xff, 0xde, 
+    0xee, 0xde, 0x06, 0x08, 0x0d, 0x81, 0x01, 0x06, 0x04, 0x05, 0x01, 0x04, 0x01, 0x10, 0x04, 0x90, 0x01, 0x02, 0x0b, 0x10, 0x0d, 0x81, 
+    0x01, 0x01, 0x07, 0xdf, 0x8a, 0x00, 0x06, 0x3f, 0x06, 0x05, 0x04, 0x11, 0x08, 0xe0, 0x96, 0x00, 0x02, 0x16, 0x0e, 0x05, 0x81, 0x01, 
+    0x01, 0x01, 0x08, 0x83, 0x01, 0x01, 0x07, 0x12, 0x9a, 0x00, 0x03, 0x90, 0x91, 0x07, 0x05, 0x87, 0x01, 0x02, 0x04, 0x0b, 0x26, 0x8f, 
+    0x01, 0x07, 0x04, 0x01, 0x04, 0x01, 0x11, 0x0f, 0x92, 0x23, 0x88, 0x00, 0x07, 0x57, 0xc7, 0x07, 0x08, 0x05, 0x08, 0x1c, 0xff, 0x3e, 
+    0x6b, 0x97, 0x00, 0x02, 0x16, 0x0e, 0x05, 0x81, 0x01, 0x01, 0x01, 0x08, 0x83, 0x01, 0x01, 0x07, 0x12, 0x98, 0x00, 0x03, 0x13, 0xff, 
+    0x1e, 0x63, 0x06, 0x08, 0x81, 0x01, 0x00, 0x1b, 0x81, 0x01, 0x00, 0x04, 0x9b, 0x01, 0x01, 0x07, 0xff, 0x5f, 0x7b, 0x89, 0x00, 0x06, 
+    0x54, 0xff, 0x3c, 0x00, 0x06, 0x19, 0x5d, 0xff, 0xbf, 0x62, 0xe1, 0x98, 0x00, 0x02, 0x16, 0x0e, 0x05, 0x81, 0x01, 0x01, 0x01, 0x08, 
+    0x83, 0x01, 0x01, 0x07, 0x12, 0x97, 0x00, 0x03, 0x5e, 0x93, 0x0e, 0x05, 0x9d, 0x01, 0x00, 0x26, 0x81, 0x01, 0x03, 0x0b, 0x05, 0x20, 
+    0x80, 0x8a, 0x00, 0x03, 0x94, 0x87, 0xff, 0x5e, 0xbd, 0x2f, 0x9a, 0x00, 0x04, 0xe2, 0x0e, 0x01, 0x04, 0x01, 0x01, 0x0b, 0x06, 0x83, 
+    0x01, 0x01, 0x07, 0x12, 0x96, 0x00, 0x03, 0xe3, 0x19, 0x07, 0x11, 0xa0, 0x01, 0x81, 0x04, 0x03, 0x01, 0x06, 0xff, 0x5f, 0xad, 0x13, 
+    0xa8, 0x00, 0x02, 0xff, 0xdf, 0xcd, 0x20, 0x04, 0x81, 0x01, 0x01, 0x04, 0x08, 0x83, 0x01, 0x01, 0x07, 0x12, 0x94, 0x00, 0x04, 0x13, 
+    0xff, 0x9d, 0x73, 0x20, 0x0f, 0x0d, 0xa0, 0x01, 0x05, 0x10, 0x01, 0x04, 0x01, 0x06, 0xff, 0xdf, 0x93, 0xa4, 0x00, 0x00, 0x13, 0x82, 
+    0x00, 0x02, 0x37, 0x7f, 0x1e, 0x82, 0x01, 0x01, 0x01, 0x08, 0x83, 0x01, 0x01, 0x07, 0x12, 0x93, 0x00, 0x03, 0xff, 0x5f, 0xc5, 0xff, 
+    0xbe, 0x39, 0x07, 0x05, 0xa2, 0x01, 0x06, 0x0b, 0x01, 0x04, 0x01, 0x08, 0xff, 0xfe, 0x38, 0xe4, 0xa6, 0x00, 0x03, 0x7e, 0x5f, 0x07, 
+    0x17, 0x81, 0x04, 0x00, 0x0b, 0x01, 0x01, 0x08, 0x83, 0x01, 0x01, 0x07, 0x12, 0x91, 0x00, 0x06, 0xff, 0xff, 0xee, 0xff, 0xbe, 0x62, 
+    0x20, 0x1c, 0x0b, 0x01, 0x17, 0xa0, 0x01, 0x02, 0x04, 0x01, 0x05, 0x82, 0x01, 0x01, 0x07, 0x53, 0xa5, 0x00, 0x07, 0xe5, 0x0e, 0x08, 
+    0x11, 0x01, 0x04, 0x01, 0x04, 0x01, 0x0b, 0x08, 0x83, 0x01, 0x01, 0x07, 0x12, 0x8e, 0x00, 0x0a, 0x15, 0x94, 0x95, 0xff, 0x5f, 0x18, 
+    0x06, 0x10, 0x36, 0x01, 0x0d, 0x01, 0x05, 0x9f, 0x01, 0x00, 0x17, 0x84, 0x01, 0x01, 0x08, 0x8c, 0xa3, 0x00, 0x04, 0xe3, 0xff, 0x7e, 
+    0x31, 0x06, 0x0f, 0x0b, 0x81, 0x0d, 0x02, 0x11, 0x01, 0x0d, 0x01, 0x04, 0x08, 0x83, 0x01, 0x01, 0x07, 0x12, 0x8c, 0x00, 0x06, 0x8d, 
+    0x3f, 0x44, 0x2a, 0x06, 0x0e, 0x0d, 0x84, 0x01, 0x00, 0x0d, 0x9f, 0x01, 0x01, 0x04, 0x01, 0x81, 0x04, 0x81, 0x0b, 0x02, 0x1b, 0x0e, 
+    0xe6, 0xa0, 0x00, 0x09, 0xe7, 0x59, 0x06, 0x07, 0x0b, 0x01, 0x1b, 0x01, 0x0d, 0x26, 0x81, 0x01, 0x01, 0x01, 0x08, 0x83, 0x01, 0x01, 
+    0x07, 0xff, 0x3f, 0x5a, 0x88, 0x00, 0x07, 0x82, 0xff, 0xfe, 0xbd, 0x56, 0x50, 0x2d, 0x06, 0x07, 0x2c, 0x84, 0x01, 0x00, 0x11, 0x81, 
+    0x04, 0xa1, 0x01, 0x02, 0x04, 0x01, 0x04, 0x81, 0x01, 0x05, 0x0d, 0x11, 0x0f, 0xe8, 0xd8, 0x23, 0x9a, 0x00, 0x05, 0x96, 0x41, 0xff, 
+    0x3d, 0x31, 0x0e, 0x07, 0x05, 0x81, 0x01, 0x04, 0x04, 0x10, 0x01, 0x04, 0x0d, 0x81, 0x01, 0x07, 0x01, 0x0e, 0x0d, 0x11, 0x01, 0x05, 
+    0x08, 0xff, 0x5d, 0x52, 0x83, 0x00, 0x05, 0xe9, 0xea, 0xff, 0x1f, 0xb5, 0x5c, 0x97, 0xff, 0xdd, 0x30, 0x81, 0x06, 0x02, 0x0e, 0x0f, 
+    0x05, 0x8d, 0x01, 0x00, 0x04, 0x84, 0x01, 0x81, 0x04, 0x83, 0x01, 0x00, 0x04, 0x86, 0x01, 0x00, 0x04, 0x8f, 0x01, 0x05, 0x05, 0x08, 
+    0x06, 0x5f, 0xff, 0xbf, 0x83, 0xeb, 0x95, 0x00, 0x06, 0x2f, 0x8f, 0xff, 0x1f, 0x4a, 0x19, 0x06, 0x0e, 0x05, 0x8a, 0x01, 0x02, 0x01, 
+    0x08, 0x04, 0x81, 0x01, 0x0c, 0x04, 0x01, 0x81, 0xec, 0x98, 0xff, 0xfe, 0x40, 0xed, 0xff, 0xbe, 0x28, 0x19, 0x3d, 0x1c, 0x0e, 0x08, 
+    0x8b, 0x01, 0x01, 0x10, 0x0b, 0x81, 0x04, 0x83, 0x01, 0x00, 0x0f, 0x81, 0x01, 0x00, 0x17, 0x82, 0x01, 0x02, 0x0b, 0x01, 0x04, 0x86, 
+    0x01, 0x00, 0x0d, 0x91, 0x01, 0x00, 0x05, 0x81, 0x0d, 0x08, 0x0e, 0x1f, 0x0e, 0x60, 0x61, 0xee, 0x55, 0x45, 0x15, 0x8c, 0x00, 0x03, 
+    0xff, 0xff, 0xde, 0xd5, 0x44, 0x2d, 0x81, 0x0e, 0x00, 0x11, 0x86, 0x01, 0x00, 0x05, 0x85, 0x01, 0x03, 0x01, 0x08, 0x04, 0x0d, 0x81, 
+    0x01, 0x06, 0x36, 0x11, 0x07, 0x08, 0x0e, 0x08, 0x0f, 0x81, 0x05, 0x8a, 0x01, 0x00, 0x04, 0x81, 0x01, 0x81, 0x04, 0x82, 0x01, 0x00, 
+    0x0d, 0x81, 0x01, 0x03, 0x0f, 0x5d, 0x06, 0x2c, 0x81, 0x04, 0x81, 0x01, 0x81, 0x04, 0x82, 0x01, 0x81, 0x04, 0x95, 0x01, 0x00, 0x04, 
+    0x81, 0x01, 0x81, 0x04, 0x0c, 0x05, 0x08, 0x07, 0x0e, 0x2a, 0x46, 0x60, 0xff, 0xfe, 0x59, 0x62, 0x95, 0xff, 0x3d, 0x8c, 0xef, 0x55, 
+    0x81, 0xf0, 0x08, 0x99, 0xff, 0x7e, 0xb5, 0x41, 0xf1, 0x9a, 0x42, 0x08, 0x07, 0x2c, 0x82, 0x01, 0x00, 0x0d, 0x8c, 0x01, 0x02, 0x01, 
+    0x08, 0x05, 0x85, 0x01, 0x00, 0x04, 0x83, 0x01, 0x00, 0x04, 0x82, 0x01, 0x81, 0x05, 0x86, 0x01, 0x81, 0x05, 0x01, 0x01, 0x0d, 0x83, 
+    0x01, 0x06, 0x0f, 0x07, 0xff, 0x7d, 0x41, 0xff, 0x3f, 0xce, 0x7c, 0x2d, 0x07, 0x81, 0x05, 0x83, 0x01, 0x00, 0x04, 0x83, 0x01, 0x03, 
+    0x04, 0x10, 0x11, 0x0b, 0x91, 0x01, 0x05, 0x05, 0x01, 0x0d, 0x01, 0x05, 0x0b, 0x81, 0x01, 0x03, 0x05, 0x0f, 0x08, 0x07, 0x82, 0x06, 
+    0x01, 0x2a, 0x1e, 0x82, 0x10, 0x00, 0x1e, 0x81, 0x06, 0x01, 0x08, 0x05, 0x81, 0x01, 0x82, 0x04, 0x8e, 0x01, 0x03, 0x01, 0x08, 0x01, 
+    0x04, 0x88, 0x01, 0x04, 0x05, 0x0b, 0x01, 0x04, 0x36, 0x88, 0x01, 0x00, 0x0d, 0x81, 0x01, 0x06, 0x05, 0x17, 0x10, 0x0f, 0x07, 0x40, 
+    0x95, 0x82, 0x00, 0x06, 0x2f, 0x9b, 0x06, 0x08, 0x0f, 0x05, 0x04, 0x83, 0x01, 0x01, 0x04, 0x10, 0x83, 0x01, 0x00, 0x10, 0x90, 0x01, 
+    0x01, 0x0d, 0x04, 0x82, 0x01, 0x00, 0x0d, 0x88, 0x01, 0x82, 0x05, 0x00, 0x0f, 0x81, 0x05, 0x04, 0x01, 0x0d, 0x1b, 0x0b, 0x05, 0x82, 
+    0x01, 0x00, 0x04, 0x8e, 0x01, 0x03, 0x01, 0x08, 0x01, 0x04, 0x82, 0x01, 0x04, 0x10, 0x01, 0x11, 0x0b, 0x10, 0x8e, 0x01, 0x03, 0x10, 
+    0x0b, 0x04, 0x01, 0x81, 0x08, 0x02, 0x1e, 0xff, 0x1d, 0x6b, 0xff, 0xbf, 0xe6, 0x85, 0x00, 0x02, 0x47, 0xf2, 0xff, 0x9d, 0x20, 0x82, 
+    0x08, 0x00, 0x05, 0x9c, 0x01, 0x00, 0x0b, 0x81, 0x04, 0x02, 0x0d, 0x01, 0x04, 0x83, 0x01, 0x01, 0x0d, 0x01, 0x81, 0x04, 0x85, 0x01, 
+    0x02, 0x04, 0x05, 0x0b, 0x81, 0x04, 0x90, 0x01, 0x01, 0x01, 0x08, 0x81, 0x01, 0x00, 0x04, 0x82, 0x01, 0x03, 0x0d, 0x10, 0x01, 0x04, 
+    0x84, 0x01, 0x00, 0x10, 0x89, 0x01, 0x05, 0x05, 0x06, 0x07, 0xda, 0x38, 0x79, 0x82, 0x00, 0x00, 0x13, 0x85, 0x00, 0x03, 0x23, 0xff, 
+    0xde, 0xbd, 0xf2, 0xf3, 0x81, 0x0e, 0x01, 0x08, 0x0f, 0x81, 0x01, 0x02, 0x04, 0x17, 0x04, 0x90, 0x01, 0x00, 0x05, 0x81, 0x01, 0x81, 
+    0x04, 0x81, 0x01, 0x02, 0x04, 0x10, 0x0b, 0x81, 0x04, 0x81, 0x01, 0x01, 0x05, 0x0b, 0x87, 0x01, 0x02, 0x05, 0x01, 0x04, 0x81, 0x01, 
+    0x01, 0x17, 0x10, 0x8e, 0x01, 0x01, 0x01, 0x08, 0x81, 0x01, 0x04, 0x0b, 0x11, 0x10, 0x01, 0x04, 0x90, 0x01, 0x81, 0x08, 0x04, 0xff, 
+    0x1c, 0x08, 0xf4, 0x54, 0x00, 0x15, 0x8d, 0x00, 0x0a, 0x88, 0xf5, 0xf6, 0x8c, 0xff, 0x5c, 0x18, 0x06, 0x07, 0x08, 0x11, 0x01, 0x0d, 
+    0x9b, 0x01, 0x82, 0x04, 0x82, 0x01, 0x81, 0x04, 0x82, 0x01, 0x00, 0x04, 0x81, 0x01, 0x01, 0x0b, 0x04, 0x82, 0x01, 0x00, 0x04, 0x8d, 
+    0x01, 0x01, 0x01, 0x08, 0x81, 0x01, 0x81, 0x04, 0x8a, 0x01, 0x00, 0x04, 0x82, 0x01, 0x07, 0x04, 0x01, 0x0f, 0x07, 0x06, 0xff, 0x7d, 
+    0x20, 0xff, 0xde, 0x83, 0x43, 0x95, 0x00, 0x08, 0xf7, 0x5a, 0x9c, 0x60, 0x19, 0x06, 0x07, 0x08, 0x0f, 0x84, 0x01, 0x01, 0x26, 0x04, 
+    0x83, 0x01, 0x00, 0x04, 0x81, 0x01, 0x00, 0x04, 0x85, 0x01, 0x01, 0x04, 0x05, 0x85, 0x01, 0x01, 0x04, 0x05, 0x97, 0x01, 0x00, 0x04, 
+    0x82, 0x01, 0x00, 0x04, 0x06, 0x01, 0x08, 0x01, 0x04, 0x0b, 0x11, 0x10, 0x81, 0x01, 0x00, 0x04, 0x81, 0x01, 0x00, 0x04, 0x84, 0x01, 
+    0x08, 0x0b, 0x11, 0x08, 0x07, 0x06, 0x5d, 0x52, 0x5a, 0x9d, 0x84, 0x00, 0x00, 0x13, 0x82, 0x00, 0x02, 0x22, 0xf8, 0x63, 0x8e, 0x00, 
+    0x0c, 0x13, 0x64, 0xff, 0xbf, 0xa4, 0xdd, 0x9e, 0x42, 0x06, 0x20, 0x07, 0x0f, 0x01, 0x0d, 0x11, 0x84, 0x01, 0x01, 0x04, 0x17, 0x87, 
+    0x01, 0x00, 0x0d, 0x83, 0x01, 0x00, 0x05, 0x85, 0x01, 0x81, 0x04, 0x01, 0x01, 0x04, 0x91, 0x01, 0x81, 0x04, 0x81, 0x01, 0x02, 0x05, 
+    0x07, 0x04, 0x84, 0x01, 0x00, 0x04, 0x83, 0x01, 0x04, 0x0d, 0x1b, 0x01, 0x0f, 0x08, 0x81, 0x06, 0x04, 0xf3, 0x9f, 0xff, 0x1e, 0xa5, 
+    0xff, 0xfe, 0xde, 0x15, 0x89, 0x00, 0x07, 0xff, 0x1e, 0x9f, 0x48, 0x65, 0x21, 0x39, 0xf9, 0x3a, 0x15, 0x86, 0x00, 0x00, 0x13, 0x85, 
+    0x00, 0x0b, 0x15, 0x00, 0x99, 0xe2, 0xa0, 0x7b, 0x91, 0x06, 0x07, 0x0f, 0x05, 0x01, 0x81, 0x04, 0x81, 0x01, 0x00, 0x04, 0x81, 0x01, 
+    0x00, 0x04, 0x82, 0x01, 0x01, 0x04, 0x01, 0x81, 0x04, 0x81, 0x01, 0x00, 0x04, 0x86, 0x01, 0x00, 0x04, 0x98, 0x01, 0x05, 0x04, 0x08, 
+    0x0b, 0x05, 0x01, 0x0b, 0x83, 0x01, 0x00, 0x26, 0x81, 0x05, 0x00, 0x06, 0x81, 0x07, 0x04, 0x2d, 0xfa, 0xff, 0xdd, 0x6a, 0xfb, 0x3e, 
+    0x8b, 0x00, 0x01, 0xff, 0x9e, 0xcf, 0xff, 0x5e, 0x4e, 0x81, 0x0a, 0x07, 0x1d, 0x02, 0x0a, 0x14, 0x03, 0xa1, 0xa2, 0x3a, 0x91, 0x00, 
+    0x0d, 0xfc, 0xff, 0x5e, 0xad, 0xfd, 0xdc, 0x1c, 0x07, 0x08, 0x05, 0x0b, 0x01, 0x0d, 0x01, 0x0b, 0x04, 0x81, 0x01, 0x81, 0x04, 0x00, 
+    0x05, 0x86, 0x01, 0x00, 0x0d, 0x9a, 0x01, 0x00, 0x04, 0x81, 0x01, 0x01, 0x01, 0x07, 0x84, 0x01, 0x01, 0x0f, 0x08, 0x81, 0x06, 0x05, 
+    0x08, 0x10, 0xec, 0x97, 0xff, 0xbc, 0x7b, 0xe7, 0x8d, 0x00, 0x04, 0xff, 0x7d, 0xc7, 0x66, 0x09, 0x0a, 0x03, 0x82, 0x02, 0x08, 0x03, 
+    0xff, 0x3f, 0x0e, 0x03, 0x30, 0x0a, 0x09, 0x49, 0xa2, 0xfe, 0x91, 0x00, 0x0b, 0x23, 0x51, 0x62, 0xff, 0x5e, 0x49, 0xa3, 0x1c, 0x06, 
+    0x20, 0x08, 0x0f, 0x05, 0x0b, 0x82, 0x01, 0x01, 0x04, 0x05, 0x83, 0x01, 0x81, 0x04, 0x00, 0x0b, 0x97, 0x01, 0x00, 0x10, 0x81, 0x17, 
+    0x81, 0x01, 0x00, 0x04, 0x02, 0x04, 0x08, 0x07, 0x81, 0x06, 0x07, 0x08, 0x0e, 0xd2, 0x89, 0xa4, 0xff, 0x1e, 0x9c, 0xff, 0x3e, 0xb5, 
+    0xff, 0xde, 0xde, 0x8e, 0x00, 0x05, 0x13, 0xff, 0x1f, 0xa7, 0x39, 0x0a, 0x14, 0x03, 0x81, 0x02, 0x84, 0x03, 0x09, 0x1a, 0x03, 0x02, 
+    0x03, 0x09, 0x0a, 0x3b, 0xff, 0x9e, 0x3e, 0xa5, 0xa6, 0x92, 0x00, 0x0a, 0x35, 0xa7, 0xc5, 0xa4, 0xfa, 0x42, 0x08, 0x07, 0x06, 0x08, 
+    0x0f, 0x81, 0x05, 0x82, 0x01, 0x81, 0x04, 0x84, 0x01, 0x01, 0x04, 0x01, 0x82, 0x04, 0x8f, 0x01, 0x01, 0x0b, 0x04, 0x83, 0x01, 0x07, 
+    0x01, 0x08, 0x59, 0xff, 0x1d, 0x52, 0xff, 0x3d, 0x73, 0x85, 0x5e, 0x35, 0x91, 0x00, 0x04, 0x4a, 0xff, 0xfe, 0x6e, 0xff, 0x3e, 0x1e, 
+    0x14, 0x0a, 0x81, 0x02, 0x00, 0x03, 0x82, 0x02, 0x02, 0x1d, 0x02, 0x1d, 0x81, 0x03, 0x00, 0x02, 0x81, 0x03, 0x00, 0x1a, 0x81, 0x03, 
+    0x06, 0x09, 0x0a, 0x21, 0x67, 0x68, 0xa8, 0xff, 0x9e, 0xc7, 0x92, 0x00, 0x09, 0x15, 0xff, 0xbd, 0xde, 0x47, 0x38, 0xff, 0x5d, 0x5a, 
+    0xff, 0x1d, 0x39, 0x46, 0x10, 0x3d, 0x06, 0x81, 0x07, 0x01, 0xff, 0x3f, 0x08, 0x0f, 0x9d, 0x01, 0x01, 0x10, 0x11, 0x01, 0x0f, 0x20, 
+    0x94, 0x00, 0x02, 0xa9, 0xaa, 0x69, 0x81, 0x09, 0x01, 0x28, 0x18, 0x81, 0x02, 0x00, 0x03, 0x83, 0x02, 0x82, 0x03, 0x03, 0x1d, 0x18, 
+    0x02, 0x03, 0x82, 0x02, 0x81, 0x03, 0x00, 0x02, 0x81, 0x03, 0x81, 0x0a, 0x04, 0x21, 0xab, 0xff, 0x9f, 0x5e, 0xac, 0x31, 0x93, 0x00, 
+    0x09, 0x15, 0x23, 0xad, 0x2b, 0xff, 0x5d, 0x94, 0xae, 0x9e, 0x93, 0x2d, 0x0e, 0x83, 0x06, 0x01, 0x07, 0x08, 0x81, 0x0f, 0x00, 0x05, 
+    0x8f, 0x01, 0x81, 0x0f, 0x03, 0x07, 0x06, 0x20, 0x08, 0x01, 0xff, 0x5d, 0x20, 0x9b, 0x90, 0x00, 0x06, 0x4a, 0x3c, 0x4b, 0xaf, 0x29, 
+    0x0a, 0x30, 0x9b, 0x02, 0x00, 0x03, 0x81, 0x09, 0x06, 0x0a, 0x03, 0xff, 0x7f, 0x36, 0xb0, 0xb1, 0x31, 0x4c, 0x96, 0x00, 0x0a, 0xff, 
+    0x5d, 0xce, 0xff, 0xbe, 0xc5, 0xff, 0x3d, 0x9c, 0x38, 0x9c, 0xff, 0x3d, 0x52, 0x52, 0xff, 0xbd, 0x30, 0xff, 0x7f, 0x28, 0x92, 0x19, 
+    0x82, 0x06, 0x84, 0x07, 0x02, 0x06, 0x1f, 0x07, 0x84, 0x06, 0x05, 0x92, 0xff, 0x7d, 0x28, 0x84, 0xff, 0x9d, 0x6a, 0xc6, 0xff, 0x7e, 
+    0xad, 0x00, 0xff, 0x3f, 0xe7, 0x8d, 0x00, 0x09, 0x6a, 0xff, 0xfe, 0x96, 0x6b, 0x6c, 0x29, 0x09, 0x0a, 0x30, 0x09, 0x03, 0x9c, 0x02, 
+    0x83, 0x03, 0x09, 0x02, 0x09, 0x14, 0x0a, 0x03, 0x29, 0xa1, 0xa5, 0xff, 0x3d, 0x9f, 0xff, 0x7f, 0xcf, 0x99, 0x00, 0x15, 0x86, 0xff, 
+    0x9f, 0xef, 0x37, 0xa7, 0x5a, 0x51, 0xff, 0x1f, 0xad, 0x6d, 0xae, 0xb2, 0x5b, 0x61, 0xff, 0x1f, 0x7b, 0x61, 0xff, 0x1f, 0x7b, 0xff, 
+    0xff, 0x7a, 0xd3, 0x7d, 0xff, 0x3d, 0xad, 0xff, 0x1d, 0xb5, 0x37, 0x45, 0x83, 0x00, 0x88, 0x00, 0x06, 0x24, 0x3a, 0x32, 0xff, 0xde, 
+    0x86, 0x69, 0x4d, 0x28, 0x81, 0x0a, 0x01, 0x09, 0x03, 0x81, 0x02, 0x02, 0x03, 0x02, 0x1d, 0x9a, 0x02, 0x83, 0x03, 0x81, 0x02, 0x02, 
+    0x03, 0x02, 0x1a, 0x81, 0x02, 0x01, 0x03, 0x09, 0x81, 0x0a, 0x05, 0x02, 0xff, 0x5f, 0x1e, 0x49, 0x6b, 0xff, 0x1f, 0xa7, 0xff, 0x9f, 
+    0xe7, 0x95, 0x00, 0x00, 0x13, 0x97, 0x00, 0x82, 0x00, 0x08, 0x22, 0x6e, 0xa6, 0xff, 0x3e, 0xa7, 0xb0, 0x39, 0xb3, 0x03, 0x09, 0x81, 
+    0x0a, 0x82, 0x03, 0x81, 0x02, 0x81, 0x03, 0x82, 0x02, 0x81, 0x03, 0x9b, 0x02, 0x81, 0x03, 0x81, 0x02, 0x00, 0x18, 0x83, 0x02, 0x00, 
+    0x03, 0x81, 0x02, 0x81, 0x03, 0x0a, 0x09, 0x30, 0x14, 0x25, 0xff, 0xfe, 0x0d, 0xff, 0x1f, 0x26, 0xff, 0x7e, 0x5e, 0xb4, 0xb5, 0x6f, 
+    0x24, 0xa8, 0x00, 0x81, 0x00, 0x03, 0x67, 0xff, 0xfe, 0x15, 0xb6, 0x09, 0x82, 0x0a, 0x01, 0x09, 0x03, 0x81, 0x02, 0x83, 0x03, 0x81, 
+    0x02, 0x00, 0x03, 0x82, 0x02, 0x81, 0x03, 0xa1, 0x02, 0x00, 0x03, 0x82, 0x02, 0x00, 0x03, 0x83, 0x02, 0x01, 0x03, 0x18, 0x81, 0x02, 
+    0x81, 0x03, 0x0d, 0x09, 0x0a, 0x09, 0x28, 0xff, 0xfe, 0x0d, 0xff, 0x1e, 0x26, 0xff, 0x9f, 0x4e, 0xff, 0x5e, 0x56, 0xb4, 0xb7, 0xff, 
+    0x1f, 0x9f, 0x33, 0x31, 0xff, 0xdf, 0xdf, 0x9f, 0x00, 0x81, 0x00, 0x81, 0x09, 0x83, 0x03, 0x83, 0x02, 0x00, 0x03, 0x85, 0x02, 0x82, 
+    0x03, 0x82, 0x02, 0x00, 0x03, 0xa1, 0x02, 0x82, 0x03, 0x00, 0x1a, 0x85, 0x02, 0x02, 0x03, 0x02, 0x1d, 0x82, 0x02, 0x82, 0x03, 0x81, 
+    0x09, 0x81, 0x0a, 0x01, 0xff, 0x9e, 0x0d, 0x09, 0x81, 0x21, 0x07, 0x1a, 0xff, 0x5f, 0x3e, 0xff, 0x9f, 0x4e, 0xb8, 0xa8, 0xb9, 0xff, 
+    0x5d, 0xc7, 0x4c, 0x95, 0x00, 0x02, 0xff, 0x7e, 0xd7, 0xb9, 0xf8, 0x01, 0xff, 0xff, 0x6e, 0xff, 0x3f, 0x3e, 0x82, 0x02, 0x81, 0x03, 
+    0x81, 0x02, 0x00, 0x03, 0x83, 0x02, 0x81, 0x03, 0x81, 0x02, 0x00, 0x03, 0x81, 0x02, 0x83, 0x03, 0xa0, 0x02, 0x81, 0x03, 0x81, 0x02, 
+    0x00, 0x1d, 0x81, 0x02, 0x01, 0x03, 0x18, 0x84, 0x02, 0x81, 0x03, 0x81, 0x02, 0x01, 0x03, 0x02, 0x82, 0x03, 0x81, 0x02, 0x05, 0x03, 
+    0x02, 0x03, 0x02, 0x09, 0x28, 0x81, 0x0a, 0x1a, 0x14, 0xba, 0x21, 0x2e, 0x6c, 0xff, 0x3e, 0x36, 0x70, 0xbb, 0xff, 0x9d, 0x66, 0xff, 
+    0x7f, 0x9f, 0xff, 0x9f, 0xbf, 0xff, 0x7e, 0xb7, 0x4e, 0x71, 0xff, 0x9e, 0xaf, 0xff, 0x9f, 0xaf, 0xff, 0x5e, 0xbf, 0x63, 0xac, 0xff, 
+    0x7d, 0x66, 0xff, 0xde, 0x6e, 0x66, 0x4f, 0x34, 0xff, 0x3e, 0x2e, 0x34, 0x25, 0x81, 0x0a, 0x02, 0x30, 0x65, 0x02, 0x81, 0x03, 0x82, 
+    0x02, 0x81, 0x03, 0x81, 0x02, 0x02, 0x1a, 0x02, 0x03, 0x81, 0x02, 0x81, 0x03, 0x81, 0x02, 0x00, 0x03, 0x82, 0x02, 0x00, 0x03, 0x9e, 
+    0x02, 0x00, 0x03, 0x82, 0x02, 0x84, 0x03, 0x02, 0x02, 0x03, 0x18, 0x81, 0x02, 0x00, 0x03, 0x81, 0x02, 0x82, 0x03, 0x82, 0x02, 0x06, 
+    0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0xff, 0x1e, 0x06, 0x81, 0x02, 0x00, 0x03, 0x83, 0x02, 0x00, 0x09, 0x81, 0x03, 0x83, 0x0a, 0x87, 
+    0x09, 0x81, 0x0a, 0x02, 0x14, 0x0a, 0x14, 0x82, 0x09, 0x00, 0x03, 0x81, 0x02, 0x01, 0x03, 0x09, 0xba, 0x02, 0x82, 0x03, 0x83, 0x02, 
+    0x00, 0x03, 0x81, 0x02, 0x00, 0x18, 0x81, 0x02, 0x07, 0x03, 0x02, 0x03, 0x02, 0x03, 0x1d, 0x02, 0x03, 0x82, 0x02, 0x01, 0x03, 0x02, 
+    0x81, 0x03, 0x9e, 0x02, 0x01, 0x03, 0x09, 0xc0, 0x02, 0x81, 0x03, 0x81, 0x02, 0x82, 0x03, 0x82, 0x02, 0x81, 0x03, 0x01, 0x02, 0x18, 
+    0x81, 0x02, 0x82, 0x03, 0x82, 0x02, 0x00, 0x18, 0x9d, 0x02, 0x01, 0x03, 0x09, 0xbf, 0x02, 0x00, 0x18, 0x87, 0x02, 0x09, 0x1a, 0x09, 
+    0x02, 0x1a, 0x02, 0x03, 0x02, 0x03, 0x02, 0x1d, 0x83, 0x02, 0x00, 0xff, 0x3e, 0x06, 0x9d, 0x02, 0x01, 0x03, 0x09, 0xc1, 0x02, 0x00, 
+    0x1a, 0x82, 0x03, 0x04, 0x02, 0x18, 0x09, 0x21, 0xab, 0x81, 0x09, 0x04, 0x03, 0x1d, 0x02, 0x1a, 0x03, 0x82, 0x02, 0x81, 0x03, 0x00, 
+    0x18, 0x81, 0x02, 0x00, 0x03, 0x9a, 0x02, 0x01, 0x03, 0x09, 0xb7, 0x02, 0x81, 0x03, 0x83, 0x02, 0x81, 0x03, 0x00, 0x1d, 0x81, 0x03, 
+    0x81, 0x02, 0x0d, 0x03, 0x0a, 0x14, 0xb3, 0xb7, 0x00, 0x72, 0xff, 0xff, 0x1d, 0x14, 0x0a, 0x18, 0x02, 0x03, 0x1a, 0x82, 0x03, 0x9f, 
+    0x02, 0x01, 0x03, 0x09, 0xbe, 0x02, 0x81, 0x03, 0x81, 0x02, 0x05, 0x30, 0x14, 0x3b, 0xff, 0x7e, 0x3e, 0xff, 0xde, 0x86, 0xff, 0xde, 
+    0xef, 0x82, 0x00, 0x06, 0x24, 0xff, 0xde, 0x96, 0x39, 0x3b, 0x0a, 0x09, 0x03, 0xa2, 0x02, 0x01, 0x03, 0x09, 0xbe, 0x02, 0x01, 0x18, 
+    0x09, 0x81, 0x0a, 0x02, 0xff, 0x5f, 0x3e, 0xff, 0x1f, 0x8f, 0x6a, 0x88, 0x00, 0x03, 0x31, 0xb8, 0xff, 0x5e, 0x3e, 0x09, 0x81, 0x0a, 
+    0x00, 0x03, 0x81, 0x02, 0x00, 0x03, 0x83, 0x02, 0x00, 0x03, 0x97, 0x02, 0x01, 0x03, 0x09, 0xbc, 0x02, 0x05, 0x03, 0x09, 0x0a, 0xff, 
+    0x3e, 0x1e, 0xb0, 0x3c, 0x8d, 0x00, 0x07, 0x13, 0x6f, 0xb4, 0x73, 0x09, 0x0a, 0x14, 0x03, 0x82, 0x02, 0x81, 0x03, 0x97, 0x02, 0x01, 
+    0x03, 0x09, 0x9f, 0x02, 0x81, 0x03, 0x83, 0x02, 0x81, 0x03, 0x82, 0x02, 0x83, 0x03, 0x82, 0x02, 0x81, 0x03, 0x85, 0x02, 0x05, 0x03, 
+    0x0a, 0x09, 0x48, 0xff, 0x7e, 0x5e, 0xff, 0x1f, 0xaf, 0x94, 0x00, 0x09, 0x33, 0xff, 0xff, 0x86, 0x69, 0x1a, 0x09, 0x14, 0x09, 0x03, 
+    0x1d, 0x03, 0x87, 0x02, 0x00, 0x03, 0x82, 0x02, 0x00, 0x03, 0x89, 0x02, 0x03, 0x03, 0x09, 0x02, 0x03, 0x98, 0x02, 0x81, 0x03, 0x8b, 
+    0x02, 0x00, 0x03, 0x84, 0x02, 0x82, 0x03, 0x81, 0x02, 0x01, 0x03, 0x02, 0x81, 0x03, 0x05, 0x25, 0x0a, 0xff, 0x1f, 0x26, 0xff, 0x9f, 
+    0x5e, 0xaa, 0x24, 0x8c, 0x00, 0x02, 0x23, 0x96, 0x23, 0x88, 0x00, 0x09, 0x15, 0x6e, 0xb5, 0x4f, 0x67, 0x21, 0x14, 0x0a, 0x03, 0x02, 
+    0x82, 0x03, 0x88, 0x02, 0x82, 0x03, 0x00, 0xff, 0x1e, 0x06, 0x81, 0x03, 0x00, 0x02, 0x81, 0x03, 0x03, 0x03, 0x09, 0x02, 0x03, 0x9d, 
+    0x02, 0x81, 0x03, 0x88, 0x02, 0x00, 0x03, 0x81, 0x02, 0x00, 0x03, 0x81, 0x02, 0x83, 0x03, 0x05, 0x0a, 0xff, 0x9e, 0x0d, 0xbc, 0x6b, 
+    0xff, 0x3e, 0xaf, 0x22, 0x8c, 0x00, 0x07, 0x88, 0x54, 0x5b, 0xff, 0xdd, 0x28, 0x19, 0x5f, 0xff, 0xdc, 0x83, 0x2f, 0x8b, 0x00, 0x04, 
+    0x31, 0xff, 0xfe, 0x96, 0x68, 0x2e, 0x0a, 0x81, 0x09, 0x83, 0x03, 0x87, 0x02, 0x81, 0x03, 0x82, 0x02, 0x01, 0x03, 0x1d, 0x02, 0x1d, 
+    0x21, 0x02, 0x81, 0x03, 0x9e, 0x02, 0x83, 0x03, 0x81, 0x02, 0x00, 0x03, 0x82, 0x02, 0x01, 0x1a, 0x03, 0x82, 0x02, 0x00, 0x09, 0x81, 
+    0x0a, 0x02, 0x48, 0xaf, 0x32, 0x8b, 0x00, 0x0f, 0x13, 0x00, 0x15, 0xea, 0xff, 0xfe, 0x7a, 0xff, 0xde, 0x30, 0x19, 0x06, 0x0f, 0x05, 
+    0x08, 0x0e, 0x1e, 0x9b, 0xff, 0x9e, 0xb5, 0x13, 0x82, 0x00, 0x00, 0x15, 0x87, 0x00, 0x05, 0x24, 0x33, 0x4b, 0x70, 0x34, 0x09, 0x81, 
+    0x0a, 0x00, 0x09, 0x82, 0x02, 0x81, 0x03, 0x87, 0x02, 0x00, 0x03, 0x81, 0x03, 0x9f, 0x02, 0x00, 0x03, 0x8a, 0x02, 0x82, 0x09, 0x05, 
+    0x0a, 0x25, 0xb3, 0xff, 0x9e, 0x5e, 0x32, 0x24, 0x8d, 0x00, 0x11, 0xff, 0x7e, 0xce, 0xbd, 0xff, 0xdd, 0x28, 0x0e, 0x07, 0x08, 0x01, 
+    0x0d, 0x10, 0x05, 0x04, 0x0b, 0x0f, 0x07, 0x0e, 0xff, 0xfd, 0x30, 0x6d, 0x96, 0x8e, 0x00, 0x04, 0x6f, 0xa2, 0xff, 0x7f, 0x4e, 0xff, 
+    0xfe, 0x15, 0x25, 0x81, 0x0a, 0x81, 0x09, 0x81, 0x03, 0x00, 0x02, 0x82, 0x03, 0x81, 0x02, 0x00, 0x18, 0x01, 0x28, 0x09, 0x83, 0x02, 
+    0x00, 0x03, 0x92, 0x02, 0x00, 0x03, 0x8a, 0x02, 0x00, 0x03, 0x82, 0x02, 0x09, 0x09, 0x28, 0x14, 0x0a, 0x2e, 0x49, 0x4f, 0xa8, 0x32, 
+    0x4c, 0x8d, 0x00, 0x06, 0x64, 0xbe, 0xde, 0x19, 0x07, 0x08, 0x11, 0x83, 0x01, 0x02, 0x0b, 0x04, 0x0d, 0x81, 0x04, 0x07, 0x1b, 0x05, 
+    0x08, 0x07, 0x0e, 0xff, 0x9e, 0x41, 0x78, 0x5e, 0x8e, 0x00, 0x06, 0x22, 0x72, 0xff, 0xde, 0x7e, 0x74, 0x34, 0xb6, 0x03, 0x81, 0x0a, 
+    0x01, 0x30, 0x09, 0x82, 0x02, 0x00, 0x03, 0x01, 0x03, 0x09, 0x81, 0x03, 0x81, 0x02, 0x81, 0x03, 0x91, 0x02, 0x00, 0x03, 0x83, 0x02, 
+    0x82, 0x03, 0x82, 0x02, 0x01, 0x03, 0x09, 0x82, 0x0a, 0x04, 0x4d, 0xff, 0xbf, 0x56, 0xbf, 0xff, 0x5e, 0xc7, 0x6e, 0x8f, 0x00, 0x06, 
+    0xad, 0x6d, 0x7f, 0x19, 0x06, 0x08, 0x0f, 0x84, 0x01, 0x81, 0x04, 0x83, 0x01, 0x01, 0x0d, 0x04, 0x82, 0x01, 0x06, 0x05, 0x08, 0x06, 
+    0x1c, 0xff, 0x1d, 0x41, 0xff, 0x7e, 0x7b, 0xcb, 0x90, 0x00, 0x07, 0x22, 0x33, 0x72, 0xff, 0xfe, 0x86, 0xff, 0xbf, 0x4e, 0xff, 0x1e, 
+    0x26, 0xff, 0xde, 0x0d, 0x25, 0x81, 0x09, 0x01, 0x09, 0xba, 0x81, 0x03, 0x99, 0x02, 0x83, 0x03, 0x00, 0xc0, 0x81, 0x0a, 0x05, 0x18, 
+    0x34, 0xff, 0xdf, 0x6e, 0x4b, 0x33, 0x13, 0x90, 0x00, 0x0a, 0xff, 0x7e, 0xd6, 0xff, 0x9d, 0x83, 0x84, 0x2d, 0x06, 0x07, 0x05, 0x01, 
+    0x04, 0x01, 0x04, 0x88, 0x01, 0x01, 0x11, 0x04, 0x81, 0x01, 0x00, 0x04, 0x84, 0x01, 0x06, 0x08, 0x06, 0x19, 0xff, 0x1f, 0x31, 0xe6, 
+    0xff, 0x7d, 0xb5, 0x3e, 0x91, 0x00, 0x01, 0x22, 0x3a, 0x81, 0x4e, 0x00, 0x3c, 0x05, 0x3c, 0x32, 0xff, 0x5e, 0x36, 0x03, 0x09, 0x0a, 
+    0x82, 0x09, 0x84, 0x02, 0x00, 0x03, 0x81, 0x02, 0x00, 0x03, 0x82, 0x02, 0x00, 0x03, 0x81, 0x02, 0x02, 0x03, 0x18, 0x03, 0x81, 0x09, 
+    0x08, 0xc0, 0x0a, 0x09, 0x3b, 0x29, 0x49, 0x66, 0x32, 0x4a, 0x91, 0x00, 0x04, 0x8d, 0x8b, 0xb2, 0x83, 0x1e, 0x81, 0x08, 0x00, 0x2c, 
+    0x9a, 0x01, 0x09, 0x04, 0x05, 0x08, 0x06, 0x07, 0xff, 0xbe, 0x20, 0x62, 0xa7, 0x99, 0x13, 0x92, 0x00, 0x82, 0x00, 0x0b, 0xff, 0x9e, 
+    0xdf, 0xac, 0x4f, 0x74, 0x6c, 0xab, 0x21, 0x0a, 0x25, 0x0a, 0x14, 0x0a, 0x81, 0x14, 0x00, 0x09, 0x83, 0x0a, 0x0b, 0x14, 0x0a, 0x09, 
+    0xff, 0xbd, 0x05, 0x09, 0xbc, 0xff, 0x5e, 0x36, 0xff, 0xdf, 0x5e, 0x66, 0xb7, 0x31, 0x13, 0x91, 0x00, 0x0a, 0x9d, 0xff, 0xbe, 0xbd, 
+    0xff, 0x3d, 0x73, 0xd1, 0x2a, 0x06, 0x07, 0x08, 0x05, 0x01, 0x04, 0x81, 0x01, 0x00, 0x17, 0x9b, 0x01, 0x0a, 0x04, 0x01, 0x08, 0x20, 
+    0x06, 0x2a, 0xff, 0xfd, 0x30, 0x7b, 0x5c, 0xe1, 0x43, 0x8e, 0x00, 0x83, 0x00, 0x00, 0x13, 0x83, 0x00, 0x81, 0x3c, 0x11, 0x63, 0xff, 
+    0xdf, 0x9e, 0xb8, 0xff, 0x1e, 0x7f, 0xff, 0xdf, 0x8e, 0xff, 0x1f, 0x7f, 0xff, 0x9e, 0x3e, 0x39, 0xff, 0x9f, 0x3e, 0x39, 0xff, 0xff, 
+    0x7e, 0xbf, 0xff, 0xbf, 0x86, 0xff, 0x7f, 0xa7, 0xa6, 0x6f, 0x00, 0x15, 0x91, 0x00, 0x09, 0x15, 0x00, 0xff, 0x1d, 0xd6, 0xc1, 0xf1, 
+    0x91, 0x0e, 0x06, 0x08, 0x0f, 0x82, 0x01, 0x81, 0x04, 0x81, 0x0b, 0x9b, 0x01, 0x81, 0x05, 0x81, 0x04, 0x81, 0x01, 0x02, 0x11, 0x0f, 
+    0x08, 0x81, 0x06, 0x07, 0x07, 0x2d, 0xff, 0x1e, 0x39, 0xff, 0xbd, 0x6a, 0x5c, 0xee, 0xeb, 0x9d, 0x88, 0x00, 0xaa, 0x00, 0x0a, 0x15, 
+    0x00, 0x35, 0x90, 0xa4, 0x93, 0x40, 0x20, 0x07, 0x0f, 0x01, 0x81, 0x0d, 0x00, 0x04, 0x85, 0x01, 0x81, 0x04, 0x98, 0x01, 0x03, 0x05, 
+    0x0b, 0x77, 0x04, 0x82, 0x01, 0x00, 0x0d, 0x85, 0x01, 0x01, 0x05, 0x0f, 0x81, 0x06, 0x0b, 0x0e, 0x19, 0xcd, 0xce, 0xff, 0x3c, 0x41, 
+    0xff, 0x7e, 0x6a, 0x41, 0x9f, 0xff, 0x3f, 0x94, 0xca, 0x2b, 0xff, 0x7e, 0xc5, 0x01, 0x43, 0x82, 0xa5, 0x00, 0x09, 0x2f, 0x51, 0xbd, 
+    0x52, 0xff, 0x1e, 0x39, 0x42, 0x1c, 0x07, 0x08, 0x05, 0x81, 0x01, 0x02, 0x0b, 0x01, 0x10, 0x81, 0x01, 0x00, 0x0b, 0x81, 0x01, 0x00, 
+    0x04, 0x9c, 0x01, 0x00, 0x0d, 0x8b, 0x01, 0x01, 0x04, 0x0b, 0x81, 0x01, 0x00, 0x04, 0x81, 0x05, 0x09, 0x0f, 0x0e, 0xff, 0x3f, 0x08, 
+    0x06, 0x07, 0x06, 0x1c, 0x0e, 0x19, 0x0e, 0x04, 0x10, 0xff, 0x9d, 0x10, 0x9c, 0xfb, 0x45, 0x9c, 0x00, 0x07, 0xff, 0x3e, 0xf7, 0xff, 
+    0x3d, 0xd6, 0x75, 0xff, 0x7d, 0x7b, 0xff, 0xbd, 0x51, 0xc9, 0x26, 0x19, 0x81, 0x06, 0x03, 0x08, 0x0f, 0x0b, 0x04, 0x81, 0x01, 0x00, 
+    0x11, 0x85, 0x01, 0x00, 0x04, 0x81, 0x01, 0x00, 0x04, 0x81, 0x01, 0x82, 0x04, 0x97, 0x01, 0x00, 0x17, 0x81, 0x05, 0x82, 0x01, 0x81, 
+    0x04, 0x00, 0x01, 0x81, 0x04, 0x87, 0x01, 0x81, 0x04, 0x01, 0x0b, 0x05, 0x84, 0x01, 0x81, 0x05, 0x00, 0x11, 0x81, 0x07, 0x04, 0x06, 
+    0x8a, 0x41, 0xff, 0xfd, 0xa4, 0xff, 0x3d, 0xad, 0x81, 0x37, 0x91, 0x00, 0x0d, 0xfc, 0xff, 0x7e, 0xde, 0xff, 0xfc, 0xac, 0xff, 0x7e, 
+    0xa4, 0x5b, 0x76, 0xff, 0x7c, 0x20, 0x19, 0x06, 0x1f, 0x07, 0x08, 0x0f, 0x05, 0x82, 0x01, 0x81, 0x04, 0x04, 0x01, 0x10, 0x26, 0x1b, 
+    0x01, 0x81, 0x05, 0x85, 0x01, 0x00, 0x04, 0x9f, 0x01, 0x00, 0x04, 0x82, 0x01, 0x81, 0x04, 0x01, 0x01, 0x05, 0x81, 0x04, 0x00, 0x1b, 
+    0x86, 0x01, 0x81, 0x04, 0x01, 0x01, 0x04, 0x81, 0x01, 0x81, 0x04, 0x00, 0x01, 0x01, 0x0d, 0x06, 0x81, 0x01, 0x19, 0x0f, 0x07, 0x06, 
+    0xff, 0x3d, 0x00, 0x58, 0x46, 0x98, 0xff, 0x5d, 0x62, 0xd7, 0x61, 0xc2, 0xc1, 0xff, 0x1e, 0x9c, 0x56, 0x38, 0xff, 0x5d, 0x94, 0xe5, 
+    0xc1, 0xff, 0x3d, 0x9c, 0xff, 0x5c, 0x94, 0xa0, 0xb2, 0xff, 0x3e, 0x52, 0xff, 0x5e, 0x49, 0x8a, 0x10, 0x81, 0x06, 0x03, 0x07, 0x08, 
+    0x0f, 0x05, 0x82, 0x01, 0x02, 0x17, 0x04, 0x0d, 0x84, 0x01, 0x00, 0x04, 0x86, 0x01, 0x81, 0x04, 0x87, 0x01, 0x00, 0x04, 0x9c, 0x01, 
+    0x00, 0x04, 0x88, 0x01, 0x81, 0x04, 0x84, 0x01, 0x02, 0x0b, 0x01, 0x04, 0x84, 0x01, 0x01, 0x01, 0x1f, 0x84, 0x01, 0x81, 0x05, 0x01, 
+    0x0f, 0x08, 0x8e, 0x06, 0x02, 0x07, 0x08, 0x0f, 0x81, 0x05, 0x81, 0x01, 0x00, 0x04, 0xad, 0x01, 0x81, 0x04, 0xa2, 0x01, 0x00, 0x04, 
+    0x81, 0x01, 0x01, 0x01, 0x07, 0x85, 0x01, 0x81, 0x05, 0xb0, 0x01, 0x81, 0x04, 0x01, 0x17, 0x10, 0x81, 0x01, 0x82, 0x04, 0x85, 0x01, 
+    0x81, 0x0b, 0xa8, 0x01, 0x00, 0x04, 0x81, 0x01, 0x01, 0x01, 0x07, 0xb7, 0x01, 0x00, 0x04, 0x83, 0x01, 0x02, 0x04, 0x01, 0x05, 0x82, 
+    0x01, 0x01, 0x0b, 0x04, 0x81, 0x01, 0x00, 0x05, 0xad, 0x01, 0x01, 0x01, 0x07, 0x97, 0x01, 0x82, 0x11, 0xa2, 0x01, 0x02, 0x04, 0x17, 
+    0x04, 0x82, 0x01, 0x03, 0x05, 0x10, 0x01, 0x0d, 0xad, 0x01, 0x01, 0x01, 0x07, 0xb7, 0x01, 0x02, 0x05, 0x01, 0x1b, 0x81, 0x01, 0x00, 
+    0x0b, 0x81, 0x01, 0x02, 0x05, 0x0b, 0x04, 0x84, 0x01, 0x81, 0x05, 0xab, 0x01, 0x01, 0x01, 0x07, 0xb9, 0x01, 0x00, 0x04, 0x81, 0x01, 
+    0x06, 0x0f, 0x06, 0x1f, 0x06, 0x07, 0x08, 0x0f, 0x82, 0x01, 0x00, 0x0b, 0xad, 0x01, 0x01, 0x01, 0x07, 0x97, 0x01, 0x00, 0x0b, 0x96, 
+    0x01, 0x00, 0x05, 0x87, 0x01, 0x0e, 0x0f, 0x07, 0x06, 0x19, 0x46, 0x44, 0xf6, 0xff, 0xbe, 0x9c, 0x62, 0xed, 0x2d, 0x1c, 0x06, 0x08, 
+    0x0f, 0xad, 0x01, 0x01, 0x01, 0x08, 0x87, 0x01, 0x00, 0x04, 0x8e, 0x01, 0x81, 0x04, 0x99, 0x01, 0x09, 0x05, 0x0f, 0x08, 0x06, 0x08, 
+    0xff, 0x3c, 0x18, 0x44, 0xff, 0x9f, 0x8b, 0xff, 0x3d, 0xb5, 0xcc, 0x84, 0x00, 0x04, 0xff, 0x9e, 0xd6, 0x75, 0xff, 0x7e, 0x83, 0x89, 
+    0xa3, 0x81, 0x06, 0x02, 0x08, 0x0f, 0x05, 0xa8, 0x01, 0x01, 0x01, 0x08, 0x98, 0x01, 0x01, 0x0b, 0x04, 0x89, 0x01, 0x00, 0x04, 0x86, 
+    0x01, 0x81, 0x04, 0x82, 0x01, 0x00, 0x0f, 0x81, 0x07, 0x04, 0x0e, 0xe8, 0xff, 0x7d, 0x83, 0x47, 0x94, 0x8c, 0x00, 0x08, 0x35, 0x8b, 
+    0xff, 0x7d, 0x7b, 0xff, 0x5d, 0x41, 0x1e, 0x06, 0x20, 0x08, 0x05, 0x82, 0x01, 0x81, 0x04, 0x81, 0x01, 0x00, 0x04, 0x8a, 0x01, 0x81, 
+    0x04, 0x87, 0x01, 0x00, 0x04, 0x83, 0x01, 0x00, 0x04, 0x81, 0x01, 0x00, 0x04, 0x01, 0x01, 0x07, 0x8f, 0x01, 0x04, 0x04, 0x0b, 0x04, 
+    0x01, 0x04, 0x82, 0x01, 0x04, 0x0b, 0x05, 0x01, 0x0b, 0x04, 0x81, 0x01, 0x00, 0x04, 0x87, 0x01, 0x00, 0x04, 0x84, 0x01, 0x07, 0x08, 
+    0x07, 0x1f, 0x1c, 0x5f, 0x9f, 0xff, 0xdd, 0xac, 0xff, 0xde, 0xde, 0x94, 0x00, 0x0c, 0x2f, 0xff, 0xbf, 0x9c, 0xff, 0x9f, 0x6a, 0x9a, 
+    0x0e, 0x06, 0x08, 0x0f, 0x11, 0x01, 0x04, 0x01, 0x04, 0x81, 0x01, 0x00, 0x04, 0x83, 0x01, 0x02, 0x04, 0x05, 0x04, 0x83, 0x01, 0x00, 
+    0x04, 0x86, 0x01, 0x00, 0x04, 0x82, 0x01, 0x00, 0x04, 0x82, 0x01, 0x01, 0x01, 0x08, 0x93, 0x01, 0x00, 0x04, 0x85, 0x01, 0x01, 0x04, 
+    0x17, 0x81, 0x01, 0x00, 0x0b, 0x81, 0x01, 0x01, 0x05, 0x0b, 0x81, 0x01, 0x81, 0x04, 0x81, 0x01, 0x09, 0x0f, 0x1f, 0x07, 0x1e, 0x98, 
+    0xff, 0x7e, 0x6a, 0x38, 0xff, 0xdd, 0xc5, 0xff, 0x9e, 0xf7, 0x15, 0x98, 0x00, 0x09, 0x15, 0x00, 0x5e, 0x38, 0xf4, 0xff, 0xbe, 0x20, 
+    0x0e, 0x07, 0x08, 0x0f, 0x81, 0x05, 0x81, 0x01, 0x01, 0x0b, 0x04, 0x85, 0x01, 0x82, 0x04, 0x81, 0x01, 0x82, 0x04, 0x02, 0x01, 0x04, 
+    0x36, 0x87, 0x01, 0x01, 0x01, 0x08, 0x93, 0x01, 0x03, 0x04, 0x01, 0x04, 0x01, 0x81, 0x04, 0x82, 0x01, 0x00, 0x04, 0x81, 0x01, 0x0f, 
+    0x04, 0x01, 0x04, 0x10, 0x05, 0x0f, 0x08, 0x07, 0x06, 0x19, 0xff, 0x5c, 0x20, 0xff, 0x1d, 0x52, 0xff, 0xdd, 0x83, 0x64, 0x00, 0x15, 
+    0x8d, 0x00, 0x00, 0x24, 0x89, 0x00, 0x00, 0x13, 0x86, 0x00, 0x07, 0x15, 0xa9, 0x47, 0xff, 0x5d, 0x73, 0xff, 0xfe, 0x49, 0xff, 0x7c, 
+    0x18, 0x1e, 0x06, 0x81, 0x07, 0x00, 0x0f, 0x81, 0x05, 0x81, 0x01, 0x00, 0x04, 0x86, 0x01, 0x05, 0x04, 0x01, 0x04, 0x0b, 0x10, 0x04, 
+    0x83, 0x01, 0x00, 0x04, 0x81, 0x01, 0x00, 0x04, 0x01, 0x01, 0x08, 0x91, 0x01, 0x02, 0x04, 0x01, 0x10, 0x84, 0x01, 0x00, 0x04, 0x81, 
+    0x01, 0x02, 0x05, 0x11, 0x0f, 0x81, 0x07, 0x08, 0x06, 0x0e, 0x1e, 0x81, 0xff, 0x5d, 0x41, 0x97, 0x8f, 0x2b, 0x35, 0x90, 0x00, 0x05, 
+    0xb9, 0x69, 0x4d, 0xff, 0x7f, 0x5e, 0xff, 0x3e, 0xbf, 0x24, 0x93, 0x00, 0x0b, 0x37, 0xff, 0x1e, 0xd6, 0xff, 0x5f, 0xbd, 0xbe, 0xff, 
+    0x3d, 0x5a, 0x60, 0xff, 0x7e, 0x18, 0x19, 0x06, 0x07, 0x08, 0x0f, 0x81, 0x05, 0x00, 0x04, 0x81, 0x01, 0x00, 0x0b, 0x85, 0x01, 0x01, 
+    0x0b, 0x04, 0x85, 0x01, 0x01, 0x01, 0x08, 0x90, 0x01, 0x00, 0x04, 0x81, 0x01, 0x03, 0x0b, 0x04, 0x0b, 0x04, 0x81, 0x05, 0x0d, 0x08, 
+    0x07, 0x1f, 0x06, 0x2a, 0xff, 0x9e, 0x28, 0xff, 0xbd, 0x49, 0xff, 0x3d, 0x5a, 0xdb, 0xff, 0x9c, 0xa4, 0xff, 0x7f, 0xde, 0x8e, 0x00, 
+    0x15, 0x8e, 0x00, 0x04, 0x13, 0x6a, 0x71, 0xa5, 0x4d, 0x82, 0x09, 0x06, 0x0a, 0x21, 0x48, 0x4f, 0x4b, 0x31, 0x22, 0x95, 0x00, 0x07, 
+    0x79, 0x47, 0xff, 0xbd, 0x83, 0xfd, 0xff, 0x3e, 0x49, 0xff, 0x5d, 0x20, 0x19, 0x06, 0x81, 0x07, 0x05, 0x08, 0x0f, 0x11, 0x26, 0x0b, 
+    0x04, 0x81, 0x01, 0x02, 0x04, 0x0b, 0x05, 0x84, 0x01, 0x01, 0x01, 0x07, 0x8b, 0x01, 0x00, 0x05, 0x82, 0x01, 0x81, 0x05, 0x02, 0x0f, 
+    0x0e, 0x08, 0x81, 0x06, 0x08, 0x07, 0x19, 0xff, 0x1c, 0x10, 0xff, 0x1d, 0x31, 0xd0, 0xe0, 0xc2, 0xad, 0x45, 0x93, 0x00, 0x04, 0xff, 
+    0xbe, 0xd7, 0xff, 0x1e, 0x8f, 0xa1, 0xff, 0xfe, 0x1d, 0x03, 0x81, 0x0a, 0x00, 0x28, 0x81, 0x03, 0x81, 0x02, 0x81, 0x03, 0x06, 0x0a, 
+    0x14, 0x28, 0x2e, 0xff, 0x7d, 0x3e, 0xff, 0x1e, 0x7f, 0xff, 0x5e, 0xc7, 0x97, 0x00, 0x07, 0xff, 0x5f, 0xef, 0xf5, 0xc2, 0xae, 0x76, 
+    0x9a, 0xa3, 0x1c, 0x81, 0x06, 0x81, 0x07, 0x01, 0x08, 0x0f, 0x81, 0x05, 0x84, 0x01, 0x01, 0x01, 0x07, 0x81, 0x0f, 0x83, 0x05, 0x81, 
+    0x0f, 0x81, 0x08, 0x00, 0x07, 0x83, 0x06, 0x00, 0x0e, 0x81, 0x10, 0x08, 0xd6, 0x7a, 0x9e, 0xbd, 0x56, 0xbe, 0x53, 0xef, 0xa9, 0x93, 
+    0x00, 0x05, 0xff, 0xdf, 0xe7, 0xff, 0x3e, 0xb7, 0xff, 0xff, 0x96, 0xbb, 0x73, 0x21, 0x82, 0x09, 0x00, 0x03, 0x82, 0x02, 0x82, 0x03, 
+    0x82, 0x02, 0x01, 0x1a, 0x02, 0x81, 0x03, 0x06, 0x28, 0xc0, 0x09, 0x4d, 0xff, 0xde, 0x5e, 0xff, 0xfe, 0x9e, 0xfe, 0x99, 0x00, 0x0b, 
+    0xf7, 0xff, 0xdd, 0xc5, 0xa0, 0xff, 0x1d, 0x94, 0xff, 0xff, 0x72, 0x76, 0x59, 0x46, 0x5d, 0x0f, 0x0e, 0x06, 0x81, 0x20, 0x00, 0x06, 
+    0x01, 0x0e, 0x06, 0x81, 0xff, 0x7e, 0x28, 0x10, 0x05, 0x0e, 0x1c, 0x0e, 0xff, 0x9e, 0x28, 0xff, 0x9e, 0x30, 0x58, 0x76, 0xff, 0x7d, 
+    0x62, 0xff, 0x1c, 0x5a, 0x6d, 0x90, 0xff, 0xdd, 0xac, 0x87, 0x57, 0xff, 0xdd, 0xd6, 0x8e, 0x97, 0x00, 0x04, 0x4a, 0xff, 0x5e, 0xaf, 
+    0x70, 0x6c, 0xc3, 0x81, 0x0a, 0x81, 0x09, 0x00, 0x03, 0x93, 0x02, 0x00, 0x09, 0x81, 0x14, 0x05, 0x18, 0x73, 0xff, 0x9e, 0x5e, 0xbf, 
+    0xff, 0x9e, 0xb7, 0xff, 0xdf, 0xe7, 0x9b, 0x00, 0x07, 0xe9, 0xff, 0xdd, 0xde, 0xff, 0x7f, 0xde, 0xdf, 0x7d, 0xff, 0xff, 0xb4, 0x80, 
+    0x75, 0x04, 0x75, 0x85, 0x45, 0x86, 0x64, 0x81, 0x2b, 0x03, 0x7e, 0x23, 0xff, 0x9e, 0xf7, 0x23, 0x9c, 0x00, 0x08, 0xff, 0x9f, 0xe7, 
+    0x32, 0xff, 0xde, 0x7e, 0xff, 0x9d, 0x56, 0x73, 0x18, 0x09, 0x0a, 0x09, 0x84, 0x03, 0x93, 0x02, 0x81, 0x03, 0x82, 0x02, 0x00, 0x09, 
+    0x81, 0x0a, 0x05, 0x25, 0xc3, 0x67, 0x6b, 0x71, 0x22, 0x9f, 0x00, 0xa1, 0x00, 0x07, 0x22, 0x6a, 0xb1, 0xff, 0xff, 0x86, 0x74, 0xff, 
+    0x5e, 0x26, 0x1a, 0x09, 0x81, 0x0a, 0x01, 0x09, 0x03, 0x9b, 0x02, 0x00, 0x03, 0x85, 0x02, 0x03, 0x1d, 0x09, 0x03, 0x09, 0x81, 0x0a, 
+    0x06, 0x29, 0xff, 0x7e, 0x3e, 0xff, 0xdf, 0x6e, 0xff, 0x3e, 0x97, 0xc4, 0x33, 0x4c, 0x94, 0x00, 0x00, 0x13, 0x83, 0x00, 0x9c, 0x00, 
+    0x06, 0x4c, 0x63, 0x72, 0xff, 0xde, 0x6e, 0x74, 0x29, 0x3b, 0x82, 0x0a, 0x00, 0x09, 0x81, 0x03, 0x02, 0x02, 0x03, 0x1a, 0x83, 0x02, 
+    0x00, 0x03, 0x9b, 0x02, 0x00, 0x03, 0x85, 0x02, 0x00, 0x03, 0x81, 0x02, 0x00, 0x09, 0x81, 0x14, 0x81, 0x09, 0x06, 0x29, 0xff, 0x7e, 
+    0x36, 0xaf, 0xff, 0xfe, 0x86, 0xff, 0x3e, 0xa7, 0xff, 0xbe, 0xd7, 0x24, 0x91, 0x00, 0x01, 0x13, 0x00, 0x94, 0x00, 0x09, 0x13, 0x3a, 
+    0xff, 0xbf, 0xd7, 0xb1, 0xff, 0xde, 0x8e, 0xff, 0xbf, 0x5e, 0xff, 0x9f, 0x46, 0x34, 0xc3, 0x09, 0x82, 0x0a, 0x01, 0x09, 0x03, 0x81, 
+    0x02, 0x01, 0x03, 0x18, 0x81, 0x02, 0x85, 0x03, 0x01, 0x02, 0x03, 0x9a, 0x02, 0x81, 0x03, 0x81, 0x02, 0x00, 0x03, 0x89, 0x02, 0x81, 
+    0x03, 0x00, 0x09, 0x81, 0x0a, 0x08, 0x14, 0x02, 0x48, 0x49, 0xff, 0x7e, 0x56, 0xff, 0xfe, 0x76, 0xff, 0x3e, 0x9f, 0x33, 0x4a, 0x89, 
+    0x00, 0x00, 0x13, 0x82, 0x00, 0x81, 0x00, 0x04, 0x71, 0xff, 0xff, 0xe7, 0xe4, 0x22, 0x24, 0x82, 0x22, 0x03, 0xff, 0xfe, 0xf7, 0xff, 
+    0x7f, 0xcf, 0xb5, 0xc4, 0x81, 0x4e, 0x07, 0xff, 0x5e, 0x97, 0xff, 0x9e, 0x66, 0xbb, 0xff, 0x5d, 0x46, 0xff, 0x3e, 0x2e, 0xff, 0x7f, 
+    0x2e, 0x3b, 0x03, 0x81, 0x25, 0x81, 0x0a, 0x81, 0x09, 0x81, 0x03, 0x83, 0x02, 0x00, 0x03, 0x83, 0x02, 0x00, 0x03, 0x83, 0x02, 0x81, 
+    0x03, 0x81, 0x02, 0x82, 0x03, 0x95, 0x02, 0x86, 0x03, 0x00, 0x02, 0x81, 0x03, 0x81, 0x02, 0x81, 0x03, 0x83, 0x02, 0x82, 0x03, 0x81, 
+    0x02, 0x01, 0x03, 0x09, 0x81, 0x0a, 0x01, 0xba, 0x0a, 0x81, 0x03, 0x08, 0x34, 0xff, 0x3e, 0x36, 0xff, 0xbf, 0x5e, 0xff, 0x9e, 0x6e, 
+    0xc4, 0xaa, 0x3a, 0x6e, 0xff, 0xfe, 0xf7, 0x84, 0x00, 0x81, 0x00, 0x01, 0x65, 0x2e, 0x81, 0xff, 0x3e, 0x16, 0x00, 0x2e, 0x81, 0x29, 
+    0x01, 0xb6, 0x2e, 0x81, 0x09, 0x01, 0x21, 0x0a, 0x81, 0x09, 0x01, 0x0a, 0x14, 0x82, 0x09, 0x02, 0x03, 0x02, 0x03, 0x85, 0x02, 0x00, 
+    0x03, 0x81, 0x02, 0x00, 0x03, 0x86, 0x02, 0x00, 0x18, 0x83, 0x02, 0x00, 0x03, 0x99, 0x02, 0x00, 0x1a, 0x81, 0x03, 0x84, 0x02, 0x81, 
+    0x03, 0x82, 0x02, 0x00, 0x03, 0x81, 0x02, 0x81, 0x03, 0x84, 0x02, 0x82, 0x03, 0x05, 0x02, 0x03, 0x1a, 0x03, 0x02, 0x03, 0x81, 0x09, 
+    0x06, 0x0a, 0x14, 0x09, 0x0a, 0x21, 0x2e, 0xbc, 0x81, 0x68, 0x02, 0xff, 0x5f, 0x46, 0x70, 0x4b, 0x03, 0xf9, 0xff, 0xde, 0xdf, 0x14, 
+    0x09, 0x81, 0x03, 0x01, 0x09, 0x03, 0x81, 0x09, 0x83, 0x03, 0x00, 0x02, 0x82, 0x03, 0x81, 0x02, 0x03, 0x03, 0x02, 0x1a, 0x03, 0x81, 
+    0x02, 0x81, 0x03, 0x82, 0x02, 0x00, 0x03, 0x83, 0x02, 0x82, 0x03, 0x00, 0x18, 0x83, 0x02, 0x00, 0x03, 0x82, 0x02, 0x81, 0x03, 0x01, 
+    0x02, 0x03, 0x95, 0x02, 0x01, 0x03, 0x02, 0x81, 0x03, 0x81, 0x02, 0x00, 0x03, 0x87, 0x02, 0x00, 0x03, 0x82, 0x02, 0x00, 0x03, 0x83, 
+    0x02, 0x00, 0x03, 0x85, 0x02, 0x00, 0x1a, 0x81, 0x02, 0x03, 0x03, 0x02, 0x03, 0x02, 0x82, 0x03, 0x81, 0x0a, 0x81, 0x09, 0x00, 0x65, 
 };
 
-const uint8_t img_logo_rebtek_310_62[] = {
-    0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xef, 0xff, 0xef, 0xff, 0xef, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xef, 0xff, 0xef, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdd, 0xc6, 0x2d, 0x1a, 0x2f, 0x12, 0x50, 0x0a, 0x91, 0x0a, 0x71, 0x02, 0x71, 0x02, 0x91, 0x02, 0xb1, 0x0a, 0x50, 0x0a, 0x4f, 0x12, 0x2d, 0x12, 0x8d, 0x2a, 0xff, 0xf7, 0xdf, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xef, 0xff, 0xef, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xef, 0xff, 0xef, 0xff, 0xef, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xef, 0xff, 0xef, 0xff, 0xef, 0xff, 0xef, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xef, 0xff, 0xef, 0xff, 0xef, 0xff, 0xef, 0xff, 0xef, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xef, 0xff, 0xef, 0xff, 0xef, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x1b, 0xa6, 0x4e, 0x12, 0x4f, 0x0a, 0x71, 0x0a, 0x71, 0x02, 0xb2, 0x0a, 0x50, 0x02, 0x71, 0x02, 0x92, 0x0a, 0x71, 0x02, 0x91, 0x12, 0xcc, 0x09, 0x8d, 0x32, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xf7, 0xdf, 0xf7, 0x5e, 0xe7, 0xdc, 0xd6, 0xfd, 0xd6, 0x3f, 0xd7, 0x1f, 0xcf, 0x1f, 0xc7, 0x1f, 0xc7, 0x1f, 0xcf, 0x1f, 0xcf, 0x1f, 0xcf, 0x1f, 0xcf, 0x1f, 0xcf, 0x1f, 0xcf, 0x1f, 0xc7, 0x1e, 0xc7, 0x3e, 0xc7, 0x1e, 0xc7, 0x3e, 0xcf, 0x1e, 0xcf, 0x1f, 0xcf, 0x1f, 0xcf, 0x1f, 0xc7, 0x1f, 0xc7, 0x1f, 0xcf, 0x1e, 0xcf, 0x1e, 0xcf, 0x1e, 0xcf, 0x1f, 0xcf, 0x1f, 0xcf, 0x1f, 0xcf, 0x3f, 0xcf, 0x1f, 0xc7, 0x1e, 0xc7, 0x5f, 0xd7, 0xdf, 0xe7, 0xff, 0xef, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xdf, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x57, 0x95, 0x0d, 0x1a, 0x4f, 0x12, 0x70, 0x0a, 0x70, 0x02, 0x71, 0x02, 0x92, 0x02, 0x91, 0x02, 0x91, 0x02, 0x2f, 0x02, 0x6f, 0x12, 0x4e, 0x1a, 0xd2, 0x53, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xdf, 0xf7, 0x1d, 0xd7, 0x1e, 0xcf, 0x1f, 0xc7, 0x5f, 0xd7, 0x1e, 0xcf, 0x1e, 0xcf, 0x1e, 0xcf, 0x1f, 0xcf, 0x1f, 0xcf, 0x1f, 0xcf, 0x1f, 0xcf, 0x1e, 0xcf, 0x1e, 0xcf, 0x1f, 0xcf, 0x1f, 0xc7, 0x3f, 0xc7, 0x1f, 0xc7, 0x3f, 0xcf, 0x1f, 0xcf, 0x1e, 0xcf, 0x1f, 0xd7, 0x1f, 0xd7, 0x3e, 0xcf, 0x3e, 0xcf, 0x3f, 0xc7, 0x3f, 0xc7, 0x3f, 0xc7, 0x1f, 0xcf, 0x1f, 0xcf, 0x1e, 0xcf, 0x3f, 0xcf, 0x3f, 0xc7, 0x3f, 0xc7, 0x3f, 0xc7, 0x1f, 0xcf, 0x1f, 0xcf, 0x1f, 0xcf, 0x1f, 0xcf, 0x3e, 0xcf, 0x3e, 0xcf, 0x3e, 0xcf, 0x3f, 0xcf, 0x1f, 0xcf, 0x1f, 0xcf, 0x3f, 0xcf, 0x3f, 0xcf, 0x3e, 0xcf, 0x3e, 0xcf, 0x3f, 0xd7, 0x3f, 0xcf, 0x1f, 0xd7, 0xbd, 0xce, 0x5e, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xb6, 0x74, 0x0d, 0x0a, 0x4f, 0x0a, 0x71, 0x0a, 0x51, 0x02, 0x71, 0x02, 0x71, 0x02, 0x91, 0x02, 0x71, 0x02, 0x71, 0x0a, 0x50, 0x0a, 0x0d, 0x12, 0x34, 0x6c, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbc, 0xc6, 0x0b, 0x2a, 0xc7, 0x00, 0x49, 0x01, 0x8c, 0x01, 0x8b, 0x01, 0x6a, 0x01, 0x6a, 0x01, 0x6a, 0x01, 0x6a, 0x01, 0x4a, 0x01, 0x6a, 0x01, 0x6a, 0x01, 0x4a, 0x01, 0x6a, 0x01, 0x6a, 0x01, 0x6a, 0x01, 0x6a, 0x01, 0x6a, 0x01, 0x6a, 0x01, 0x6b, 0x01, 0x6b, 0x01, 0x4b, 0x01, 0x4b, 0x01, 0x4b, 0x01, 0x6a, 0x01, 0x6a, 0x01, 0x6a, 0x01, 0x6a, 0x01, 0x6a, 0x01, 0x4a, 0x01, 0x4a, 0x01, 0x4a, 0x01, 0x6b, 0x01, 0x2a, 0x01, 0x09, 0x01, 0x09, 0x01, 0x4a, 0x09, 0x8e, 0x2a, 0xf3, 0x53, 0x1b, 0x9e, 0x9f, 0xd7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xf7, 0xd1, 0x63, 0x2d, 0x1a, 0x2f, 0x0a, 0x50, 0x0a, 0x91, 0x0a, 0x92, 0x02, 0x71, 0x02, 0x71, 0x02, 0x91, 0x0a, 0x50, 0x0a, 0x4f, 0x12, 0x2d, 0x12, 0x58, 0x85, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x32, 0x74, 0x27, 0x01, 0x29, 0x01, 0x8b, 0x01, 0x4a, 0x01, 0x4a, 0x01, 0x4a, 0x01, 0x4a, 0x01, 0x4b, 0x01, 0x4b, 0x01, 0x4b, 0x01, 0x4a, 0x01, 0x49, 0x01, 0x4a, 0x01, 0x4a, 0x01, 0x6a, 0x01, 0x6a, 0x01, 0x6b, 0x01, 0x6b, 0x01, 0x6a, 0x01, 0x6a, 0x01, 0x4b, 0x01, 0x4a, 0x01, 0x4a, 0x01, 0x4a, 0x01, 0x4b, 0x01, 0x4b, 0x01, 0x4b, 0x01, 0x2a, 0x01, 0x2a, 0x01, 0x4a, 0x01, 0x4a, 0x01, 0x6a, 0x01, 0x6a, 0x01, 0x6a, 0x01, 0x4a, 0x01, 0x2a, 0x01, 0x4a, 0x01, 0x4a, 0x01, 0x4a, 0x01, 0x4a, 0x01, 0x4a, 0x01, 0x4a, 0x01, 0x4b, 0x01, 0x4b, 0x01, 0x4a, 0x01, 0x4a, 0x01, 0x4a, 0x01, 0x49, 0x01, 0x6a, 0x01, 0x4a, 0x01, 0x28, 0x01, 0xc6, 0x00, 0x73, 0x84, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x50, 0x4b, 0x0d, 0x0a, 0x70, 0x0a, 0x71, 0x0a, 0x51, 0x02, 0x51, 0x02, 0x91, 0x0a, 0x71, 0x02, 0x70, 0x02, 0x91, 0x0a, 0x2f, 0x0a, 0xec, 0x11, 0xba, 0x9d, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1b, 0xae, 0xcb, 0x11, 0x6f, 0x1a, 0x90, 0x12, 0x71, 0x0a, 0x70, 0x02, 0x90, 0x0a, 0x6f, 0x12, 0x6f, 0x12, 0x6f, 0x12, 0x6f, 0x12, 0x4f, 0x12, 0x4f, 0x12, 0x50, 0x12, 0x70, 0x12, 0x70, 0x12, 0x70, 0x12, 0x70, 0x12, 0x70, 0x12, 0x70, 0x12, 0x70, 0x12, 0x70, 0x12, 0x50, 0x12, 0x50, 0x12, 0x4f, 0x12, 0x4f, 0x12, 0x4f, 0x12, 0x4f, 0x12, 0x4f, 0x0a, 0x4f, 0x0a, 0x70, 0x12, 0x90, 0x12, 0x70, 0x12, 0x50, 0x12, 0x50, 0x1a, 0x50, 0x1a, 0x50, 0x1a, 0x2f, 0x1a, 0x0e, 0x0a, 0x0d, 0x0a, 0x8a, 0x01, 0x28, 0x01, 0x8d, 0x2a, 0x3b, 0xae, 0xbf, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xad, 0x32, 0x0d, 0x12, 0x50, 0x12, 0x70, 0x0a, 0x71, 0x02, 0x71, 0x02, 0x92, 0x02, 0x91, 0x02, 0x71, 0x02, 0x50, 0x0a, 0x4f, 0x12, 0x0c, 0x12, 0xbd, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x4f, 0x4b, 0x4d, 0x1a, 0x4e, 0x12, 0x6f, 0x12, 0xb1, 0x1a, 0x6f, 0x12, 0x6f, 0x12, 0x50, 0x12, 0x70, 0x12, 0x50, 0x12, 0x50, 0x12, 0x4f, 0x12, 0x4e, 0x12, 0x4f, 0x1a, 0x4f, 0x12, 0x6f, 0x12, 0x6f, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x6f, 0x12, 0x6f, 0x12, 0x50, 0x12, 0x50, 0x12, 0x4f, 0x12, 0x4f, 0x12, 0x50, 0x12, 0x50, 0x1a, 0x50, 0x1a, 0x2f, 0x1a, 0x4f, 0x1a, 0x4f, 0x1a, 0x6f, 0x12, 0x70, 0x12, 0x70, 0x12, 0x70, 0x12, 0x50, 0x12, 0x50, 0x12, 0x50, 0x12, 0x4f, 0x12, 0x4f, 0x12, 0x6f, 0x12, 0x70, 0x12, 0x50, 0x12, 0x50, 0x12, 0x50, 0x12, 0x70, 0x12, 0x90, 0x12, 0x70, 0x12, 0x70, 0x12, 0x6f, 0x12, 0x6f, 0x12, 0x2d, 0x1a, 0x6d, 0x2a, 0xf9, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xce, 0x32, 0x0d, 0x0a, 0x70, 0x0a, 0x71, 0x0a, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x71, 0x0a, 0x4f, 0x12, 0xcb, 0x09, 0x1e, 0xc7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x1b, 0xa6, 0x6a, 0x01, 0x6f, 0x12, 0xb1, 0x0a, 0x71, 0x02, 0x92, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x50, 0x0a, 0x70, 0x0a, 0x50, 0x0a, 0x50, 0x12, 0x50, 0x12, 0x50, 0x12, 0x50, 0x0a, 0x50, 0x0a, 0x50, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x6f, 0x0a, 0x6f, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x50, 0x02, 0x50, 0x02, 0x50, 0x0a, 0x50, 0x0a, 0x50, 0x12, 0x50, 0x0a, 0x4f, 0x0a, 0x4f, 0x0a, 0x6f, 0x12, 0x6f, 0x12, 0x0d, 0x12, 0x8b, 0x01, 0x0c, 0x1a, 0xbd, 0xbe, 0xff, 0xf7, 0xdf, 0xf7, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0x6d, 0x2a, 0x0d, 0x12, 0x70, 0x12, 0x70, 0x0a, 0x70, 0x02, 0x51, 0x02, 0x71, 0x02, 0x91, 0x02, 0x70, 0x02, 0x70, 0x0a, 0x2e, 0x0a, 0x0c, 0x1a, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x8d, 0x2a, 0x0c, 0x0a, 0x4e, 0x0a, 0x90, 0x0a, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x6f, 0x0a, 0x6f, 0x0a, 0x6f, 0x0a, 0x6f, 0x0a, 0x8f, 0x0a, 0x8f, 0x0a, 0x90, 0x02, 0x90, 0x02, 0x70, 0x0a, 0x70, 0x0a, 0x50, 0x0a, 0x70, 0x0a, 0x6f, 0x0a, 0x6f, 0x0a, 0x6f, 0x0a, 0x6f, 0x0a, 0x70, 0x0a, 0x6f, 0x0a, 0x6f, 0x12, 0x6f, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x71, 0x02, 0x71, 0x02, 0x50, 0x02, 0x71, 0x0a, 0x50, 0x02, 0x4f, 0x0a, 0x0d, 0x12, 0x0f, 0x43, 0x9b, 0xc6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xdf, 0xae, 0x2a, 0x2e, 0x0a, 0x70, 0x0a, 0x71, 0x0a, 0x71, 0x02, 0x91, 0x02, 0x71, 0x02, 0x71, 0x02, 0x91, 0x0a, 0x50, 0x0a, 0x2f, 0x12, 0xcb, 0x11, 0xff, 0xef, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x38, 0x85, 0xac, 0x01, 0x90, 0x12, 0x71, 0x02, 0x92, 0x0a, 0x51, 0x02, 0x71, 0x0a, 0x70, 0x0a, 0x71, 0x0a, 0x71, 0x0a, 0x71, 0x0a, 0x71, 0x0a, 0x71, 0x0a, 0x51, 0x0a, 0x71, 0x0a, 0x71, 0x0a, 0x71, 0x0a, 0x71, 0x0a, 0x71, 0x0a, 0x71, 0x0a, 0x91, 0x02, 0x91, 0x02, 0x91, 0x02, 0x91, 0x02, 0x90, 0x02, 0x90, 0x02, 0x70, 0x02, 0x70, 0x0a, 0x70, 0x02, 0x70, 0x02, 0x70, 0x0a, 0x70, 0x02, 0x71, 0x0a, 0x91, 0x0a, 0x91, 0x0a, 0x71, 0x0a, 0x71, 0x0a, 0x91, 0x0a, 0xb1, 0x0a, 0xb1, 0x0a, 0x4f, 0x0a, 0x70, 0x0a, 0x2f, 0x02, 0x2f, 0x0a, 0x4f, 0x12, 0x29, 0x01, 0xb5, 0x7c, 0x7f, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xc6, 0x8e, 0x2a, 0x2e, 0x12, 0x50, 0x0a, 0x70, 0x0a, 0x91, 0x0a, 0x71, 0x02, 0x51, 0x02, 0x70, 0x02, 0x70, 0x0a, 0x90, 0x0a, 0x0d, 0x02, 0x4d, 0x22, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xbf, 0xdf, 0x8d, 0x2a, 0x4e, 0x12, 0x90, 0x0a, 0x70, 0x02, 0x91, 0x02, 0x91, 0x02, 0x91, 0x02, 0x91, 0x02, 0x91, 0x02, 0x91, 0x02, 0x70, 0x02, 0x90, 0x0a, 0x90, 0x0a, 0x70, 0x0a, 0x90, 0x0a, 0x90, 0x02, 0x90, 0x02, 0x90, 0x02, 0x90, 0x02, 0x90, 0x02, 0x90, 0x02, 0x70, 0x0a, 0x90, 0x0a, 0x90, 0x0a, 0x90, 0x02, 0x90, 0x02, 0x90, 0x02, 0x90, 0x02, 0x90, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x90, 0x02, 0x70, 0x02, 0x70, 0x0a, 0x70, 0x0a, 0x70, 0x02, 0x70, 0x02, 0x91, 0x02, 0x71, 0x02, 0x70, 0x02, 0x71, 0x02, 0x91, 0x0a, 0x91, 0x02, 0x71, 0x02, 0xb2, 0x0a, 0x91, 0x0a, 0x90, 0x12, 0xec, 0x09, 0xd2, 0x5b, 0x9f, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3b, 0xae, 0x8e, 0x2a, 0x2e, 0x0a, 0x70, 0x0a, 0x71, 0x0a, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x91, 0x02, 0x91, 0x0a, 0x50, 0x0a, 0x2e, 0x12, 0x2c, 0x22, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xe7, 0x14, 0x64, 0xac, 0x01, 0x4f, 0x0a, 0x70, 0x0a, 0x4f, 0x0a, 0x70, 0x0a, 0x71, 0x0a, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x71, 0x0a, 0x51, 0x0a, 0x51, 0x0a, 0x51, 0x0a, 0x71, 0x0a, 0x71, 0x0a, 0x71, 0x0a, 0x71, 0x02, 0x71, 0x02, 0x71, 0x0a, 0x71, 0x0a, 0x71, 0x0a, 0x71, 0x0a, 0x71, 0x0a, 0x71, 0x0a, 0x71, 0x0a, 0x71, 0x0a, 0x71, 0x0a, 0x71, 0x0a, 0x71, 0x02, 0x50, 0x02, 0x70, 0x02, 0x91, 0x02, 0x91, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x90, 0x0a, 0x70, 0x02, 0x91, 0x0a, 0x91, 0x0a, 0x70, 0x0a, 0x70, 0x12, 0x2a, 0x01, 0xd3, 0x63, 0xbf, 0xef, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb9, 0x9d, 0x4d, 0x1a, 0x2e, 0x0a, 0x70, 0x0a, 0x91, 0x0a, 0x70, 0x02, 0x51, 0x02, 0x71, 0x0a, 0x91, 0x0a, 0x50, 0x02, 0x70, 0x0a, 0x2e, 0x0a, 0x71, 0x4b, 0xff, 0xf7, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0x7c, 0xbe, 0x8e, 0x22, 0x0e, 0x0a, 0x50, 0x0a, 0x91, 0x0a, 0x50, 0x02, 0x91, 0x0a, 0x92, 0x02, 0x92, 0x02, 0x71, 0x02, 0x71, 0x02, 0x70, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x50, 0x0a, 0x50, 0x0a, 0x70, 0x02, 0x70, 0x02, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x91, 0x02, 0x91, 0x02, 0x91, 0x02, 0x91, 0x02, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x70, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x71, 0x0a, 0x71, 0x0a, 0x71, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x71, 0x0a, 0x71, 0x0a, 0x71, 0x0a, 0x71, 0x02, 0x71, 0x0a, 0x71, 0x0a, 0x71, 0x0a, 0x71, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x71, 0x0a, 0x91, 0x0a, 0x91, 0x0a, 0x6f, 0x12, 0xcb, 0x09, 0x54, 0x74, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd6, 0x7c, 0x4d, 0x1a, 0x2e, 0x0a, 0x70, 0x0a, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x91, 0x02, 0x71, 0x02, 0x91, 0x0a, 0x4f, 0x0a, 0x2e, 0x12, 0x91, 0x4b, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1d, 0xd7, 0x10, 0x3b, 0x2e, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x70, 0x12, 0x70, 0x12, 0x71, 0x0a, 0x71, 0x02, 0x91, 0x02, 0x92, 0x02, 0x92, 0x02, 0x91, 0x02, 0x71, 0x02, 0x71, 0x0a, 0x51, 0x0a, 0x51, 0x0a, 0x51, 0x0a, 0x51, 0x0a, 0x71, 0x0a, 0x71, 0x0a, 0x71, 0x0a, 0x71, 0x0a, 0x71, 0x0a, 0x71, 0x0a, 0x71, 0x0a, 0x71, 0x0a, 0x71, 0x0a, 0x51, 0x0a, 0x51, 0x0a, 0x51, 0x0a, 0x51, 0x0a, 0x71, 0x0a, 0x71, 0x0a, 0x91, 0x02, 0x91, 0x02, 0x70, 0x02, 0x90, 0x02, 0x91, 0x02, 0x91, 0x02, 0x91, 0x02, 0x70, 0x02, 0x90, 0x0a, 0x70, 0x02, 0x71, 0x02, 0x92, 0x0a, 0x30, 0x02, 0x4f, 0x12, 0x29, 0x01, 0x75, 0x74, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x95, 0x6c, 0x0d, 0x12, 0x4f, 0x0a, 0x70, 0x0a, 0x70, 0x02, 0x91, 0x02, 0x71, 0x0a, 0x51, 0x0a, 0x70, 0x0a, 0x50, 0x0a, 0x90, 0x0a, 0x0d, 0x0a, 0xf6, 0x84, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x37, 0x8d, 0x2d, 0x1a, 0x4f, 0x12, 0x70, 0x0a, 0x71, 0x0a, 0x70, 0x0a, 0x91, 0x0a, 0x91, 0x02, 0x92, 0x02, 0x71, 0x02, 0x71, 0x0a, 0x71, 0x0a, 0x70, 0x0a, 0x71, 0x0a, 0x51, 0x0a, 0x71, 0x0a, 0x71, 0x0a, 0x91, 0x02, 0x91, 0x02, 0x91, 0x02, 0x91, 0x02, 0x91, 0x02, 0x91, 0x02, 0x91, 0x02, 0x91, 0x02, 0x91, 0x02, 0x91, 0x02, 0x91, 0x02, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x71, 0x0a, 0x71, 0x0a, 0x71, 0x0a, 0x71, 0x0a, 0x71, 0x0a, 0x70, 0x02, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x71, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x50, 0x0a, 0x91, 0x0a, 0x50, 0x02, 0x70, 0x0a, 0x4f, 0x0a, 0xab, 0x09, 0xd5, 0x84, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xf3, 0x5b, 0x0c, 0x12, 0x4f, 0x0a, 0x70, 0x0a, 0x50, 0x02, 0x92, 0x0a, 0x71, 0x02, 0xb1, 0x0a, 0x70, 0x02, 0x90, 0x0a, 0x2e, 0x0a, 0x0d, 0x12, 0x38, 0x8d, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbc, 0xc6, 0x2d, 0x1a, 0x2f, 0x0a, 0x70, 0x02, 0x91, 0x02, 0x70, 0x0a, 0x70, 0x0a, 0x71, 0x0a, 0x50, 0x02, 0x71, 0x02, 0x71, 0x02, 0x91, 0x02, 0x91, 0x02, 0x70, 0x02, 0x91, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x51, 0x0a, 0x71, 0x0a, 0x71, 0x0a, 0x71, 0x02, 0x70, 0x02, 0x70, 0x0a, 0x71, 0x0a, 0x71, 0x0a, 0x71, 0x0a, 0x71, 0x0a, 0x71, 0x0a, 0x71, 0x0a, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x91, 0x0a, 0x70, 0x02, 0x91, 0x0a, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x71, 0x02, 0x71, 0x02, 0x91, 0x0a, 0x70, 0x02, 0x90, 0x0a, 0x90, 0x0a, 0xb1, 0x0a, 0x50, 0x02, 0x91, 0x0a, 0x4f, 0x12, 0x28, 0x01, 0x9d, 0xb6, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x30, 0x3b, 0x2e, 0x12, 0x70, 0x0a, 0x70, 0x0a, 0x91, 0x02, 0x71, 0x02, 0x71, 0x0a, 0x71, 0x0a, 0x30, 0x02, 0x90, 0x12, 0x70, 0x0a, 0x0c, 0x0a, 0x9c, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x5b, 0x2d, 0x12, 0x4f, 0x0a, 0x70, 0x0a, 0x90, 0x0a, 0x90, 0x0a, 0x70, 0x02, 0x71, 0x02, 0x91, 0x02, 0x91, 0x02, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x71, 0x0a, 0x72, 0x0a, 0x72, 0x02, 0x71, 0x02, 0x71, 0x02, 0x91, 0x0a, 0x71, 0x02, 0x71, 0x02, 0x91, 0x02, 0x91, 0x02, 0x91, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x91, 0x02, 0x51, 0x02, 0xb2, 0x0a, 0x70, 0x02, 0x91, 0x0a, 0x71, 0x0a, 0x71, 0x0a, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x70, 0x02, 0x50, 0x0a, 0x91, 0x12, 0x70, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x2e, 0x0a, 0x4d, 0x1a, 0x78, 0x95, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xef, 0x3a, 0x2d, 0x12, 0x6f, 0x0a, 0x70, 0x0a, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x91, 0x02, 0x70, 0x02, 0x4f, 0x0a, 0x4e, 0x12, 0x0d, 0x1a, 0x9d, 0xbe, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5b, 0xb6, 0xac, 0x01, 0x50, 0x0a, 0x91, 0x02, 0x71, 0x02, 0x50, 0x02, 0x71, 0x0a, 0x50, 0x0a, 0x71, 0x0a, 0x71, 0x0a, 0x71, 0x02, 0xb1, 0x0a, 0x70, 0x02, 0x6f, 0x0a, 0x4f, 0x0a, 0x4f, 0x0a, 0x4f, 0x0a, 0x50, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x4f, 0x0a, 0x4f, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x4f, 0x02, 0x50, 0x0a, 0x50, 0x0a, 0x70, 0x0a, 0x50, 0x02, 0x91, 0x0a, 0x92, 0x0a, 0x92, 0x0a, 0x91, 0x0a, 0x70, 0x02, 0x90, 0x0a, 0x90, 0x0a, 0x6f, 0x02, 0x90, 0x02, 0x90, 0x02, 0x70, 0x02, 0x2d, 0x0a, 0x0b, 0x1a, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x10, 0x33, 0x0e, 0x02, 0x4f, 0x0a, 0x91, 0x0a, 0x91, 0x02, 0x71, 0x02, 0x71, 0x0a, 0x71, 0x0a, 0x50, 0x0a, 0x70, 0x0a, 0x6f, 0x0a, 0xcb, 0x09, 0xff, 0xef, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xce, 0x32, 0xec, 0x09, 0x4e, 0x0a, 0x8f, 0x12, 0x6f, 0x0a, 0x4f, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x71, 0x0a, 0x71, 0x0a, 0x71, 0x0a, 0x71, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x91, 0x0a, 0x71, 0x02, 0x71, 0x0a, 0x71, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x70, 0x02, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x91, 0x02, 0x71, 0x02, 0x91, 0x0a, 0x70, 0x0a, 0x4f, 0x0a, 0x2f, 0x02, 0x70, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x70, 0x12, 0x4f, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x4f, 0x0a, 0x0d, 0x0a, 0xef, 0x3a, 0x5b, 0xb6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xef, 0x10, 0x3b, 0xed, 0x01, 0x70, 0x0a, 0x70, 0x0a, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x91, 0x02, 0x70, 0x02, 0x4f, 0x0a, 0x6f, 0x1a, 0x6a, 0x09, 0xdf, 0xe7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xb9, 0x9d, 0x6b, 0x01, 0x71, 0x0a, 0x92, 0x02, 0x71, 0x02, 0x50, 0x02, 0x71, 0x0a, 0x71, 0x0a, 0x71, 0x12, 0x71, 0x0a, 0x71, 0x0a, 0x91, 0x0a, 0x2e, 0x02, 0x2e, 0x0a, 0xec, 0x09, 0x0c, 0x0a, 0x0c, 0x0a, 0x0d, 0x0a, 0x0d, 0x02, 0x0d, 0x02, 0x0d, 0x02, 0x0d, 0x0a, 0x0d, 0x0a, 0x0d, 0x0a, 0x0d, 0x02, 0x0d, 0x02, 0x0d, 0x02, 0x0d, 0x0a, 0x0d, 0x0a, 0x0c, 0x02, 0x0c, 0x0a, 0xec, 0x01, 0x0d, 0x0a, 0x0d, 0x0a, 0x0e, 0x0a, 0x0e, 0x0a, 0x2f, 0x0a, 0x71, 0x12, 0x50, 0x0a, 0x71, 0x0a, 0x51, 0x02, 0x71, 0x02, 0x71, 0x02, 0x70, 0x0a, 0x90, 0x0a, 0x6f, 0x02, 0xb0, 0x02, 0xb0, 0x02, 0xb0, 0x02, 0x6f, 0x0a, 0x49, 0x01, 0x9d, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5f, 0xd7, 0xcf, 0x2a, 0x2e, 0x02, 0x70, 0x0a, 0x70, 0x0a, 0x91, 0x02, 0x91, 0x02, 0x51, 0x02, 0x71, 0x0a, 0x70, 0x0a, 0x4f, 0x0a, 0x4e, 0x0a, 0x0c, 0x1a, 0xff, 0xf7, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0x6c, 0x2a, 0xcb, 0x09, 0xec, 0x09, 0x0d, 0x0a, 0xec, 0x09, 0xec, 0x09, 0xed, 0x09, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xed, 0x01, 0xee, 0x01, 0x0e, 0x02, 0x0e, 0x02, 0x0e, 0x0a, 0x0d, 0x0a, 0xed, 0x01, 0x0e, 0x0a, 0x30, 0x0a, 0x30, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x70, 0x02, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x91, 0x02, 0x2f, 0x02, 0x0e, 0x02, 0x0d, 0x0a, 0x0d, 0x0a, 0xed, 0x01, 0x0d, 0x0a, 0x0e, 0x0a, 0x0e, 0x02, 0xed, 0x01, 0x0d, 0x0a, 0x0d, 0x0a, 0x0d, 0x0a, 0xed, 0x09, 0xed, 0x09, 0xed, 0x09, 0xec, 0x09, 0xed, 0x09, 0x0d, 0x0a, 0x2d, 0x12, 0xaa, 0x09, 0x2f, 0x4b, 0x1e, 0xd7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xbc, 0xbe, 0xcf, 0x2a, 0x2e, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x91, 0x02, 0x70, 0x02, 0x4f, 0x0a, 0x2d, 0x12, 0xeb, 0x19, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xe7, 0xb5, 0x74, 0xad, 0x01, 0x92, 0x12, 0x91, 0x02, 0x70, 0x02, 0x71, 0x0a, 0x71, 0x0a, 0x30, 0x0a, 0x50, 0x0a, 0x30, 0x02, 0x71, 0x0a, 0x0e, 0x02, 0x73, 0x33, 0x55, 0x5c, 0x34, 0x64, 0x33, 0x64, 0x33, 0x64, 0x34, 0x5c, 0x34, 0x5c, 0x34, 0x5c, 0x34, 0x5c, 0x33, 0x64, 0x33, 0x64, 0x33, 0x5c, 0x33, 0x5c, 0x33, 0x5c, 0x33, 0x5c, 0x33, 0x5c, 0x33, 0x5c, 0x33, 0x5c, 0x33, 0x5c, 0x33, 0x5c, 0x34, 0x64, 0x34, 0x64, 0xb2, 0x4b, 0xf0, 0x32, 0x2e, 0x12, 0x2e, 0x12, 0x4f, 0x12, 0x71, 0x0a, 0x51, 0x02, 0x51, 0x02, 0x91, 0x0a, 0x50, 0x02, 0x90, 0x0a, 0x90, 0x0a, 0x90, 0x02, 0xb1, 0x02, 0x90, 0x02, 0x4f, 0x0a, 0x2d, 0x12, 0x50, 0x4b, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1a, 0xa6, 0x6e, 0x1a, 0x4e, 0x0a, 0x70, 0x0a, 0x50, 0x02, 0x91, 0x02, 0x91, 0x02, 0x51, 0x02, 0x71, 0x0a, 0x70, 0x0a, 0x4f, 0x0a, 0x2d, 0x0a, 0x0f, 0x3b, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5e, 0xdf, 0xf2, 0x63, 0xb2, 0x53, 0xb2, 0x53, 0xf3, 0x5b, 0xf3, 0x53, 0xd2, 0x53, 0xd3, 0x53, 0xf3, 0x53, 0xf3, 0x53, 0xf3, 0x53, 0xf3, 0x53, 0xf3, 0x53, 0xd4, 0x53, 0xd4, 0x53, 0xd3, 0x53, 0xd3, 0x53, 0xf3, 0x53, 0xf3, 0x53, 0xf3, 0x53, 0xb3, 0x43, 0x70, 0x1a, 0x70, 0x12, 0x50, 0x0a, 0x70, 0x0a, 0x71, 0x0a, 0x71, 0x0a, 0x70, 0x0a, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x91, 0x0a, 0x0e, 0x02, 0x11, 0x2b, 0xf4, 0x4b, 0xf3, 0x53, 0xd2, 0x53, 0xd3, 0x53, 0xd3, 0x53, 0xd3, 0x53, 0xd3, 0x53, 0xd3, 0x53, 0xd3, 0x53, 0xd3, 0x53, 0xd3, 0x53, 0xd3, 0x53, 0xd3, 0x53, 0xd3, 0x53, 0xf3, 0x5b, 0xf3, 0x53, 0xb2, 0x53, 0xd2, 0x53, 0x70, 0x4b, 0xf6, 0x8c, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x78, 0x95, 0x4e, 0x1a, 0x4f, 0x0a, 0x70, 0x0a, 0x71, 0x0a, 0x71, 0x0a, 0x71, 0x02, 0x71, 0x02, 0x91, 0x02, 0x70, 0x02, 0x6f, 0x0a, 0xec, 0x11, 0x30, 0x4b, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5e, 0xd7, 0x71, 0x4b, 0xee, 0x09, 0x92, 0x12, 0x70, 0x02, 0x70, 0x0a, 0x70, 0x0a, 0x50, 0x0a, 0x70, 0x0a, 0x91, 0x0a, 0x70, 0x0a, 0x6f, 0x0a, 0xcc, 0x01, 0x1c, 0x9e, 0xff, 0xef, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xef, 0xdd, 0xbe, 0xd5, 0x74, 0x6d, 0x22, 0x2c, 0x12, 0x70, 0x0a, 0x91, 0x0a, 0x70, 0x02, 0xb1, 0x0a, 0x71, 0x02, 0x51, 0x02, 0x91, 0x0a, 0x92, 0x0a, 0x71, 0x0a, 0x50, 0x02, 0x8f, 0x12, 0x2d, 0x1a, 0x07, 0x01, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xf7, 0xff, 0xf7, 0xd6, 0x7c, 0x4d, 0x12, 0x6f, 0x0a, 0x70, 0x0a, 0x70, 0x02, 0x92, 0x02, 0x92, 0x02, 0x51, 0x0a, 0x71, 0x0a, 0x50, 0x02, 0x70, 0x12, 0xec, 0x09, 0x95, 0x74, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xef, 0xff, 0xef, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xef, 0xff, 0xef, 0xff, 0xef, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xef, 0xff, 0xef, 0xff, 0xef, 0xff, 0xef, 0xbd, 0xb6, 0x8f, 0x1a, 0x0e, 0x02, 0x70, 0x0a, 0x71, 0x0a, 0x71, 0x0a, 0x71, 0x0a, 0x71, 0x0a, 0x71, 0x02, 0x72, 0x02, 0x71, 0x0a, 0x4f, 0x0a, 0xab, 0x01, 0xda, 0x95, 0xff, 0xe7, 0xff, 0xef, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xef, 0xff, 0xef, 0xff, 0xef, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xef, 0xff, 0xef, 0xff, 0xef, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x74, 0x74, 0x0d, 0x0a, 0x4f, 0x0a, 0x70, 0x0a, 0x70, 0x02, 0x71, 0x0a, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x70, 0x02, 0x6f, 0x12, 0xec, 0x11, 0x95, 0x74, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1d, 0xcf, 0x4d, 0x22, 0x2f, 0x0a, 0x71, 0x0a, 0x70, 0x02, 0x70, 0x0a, 0x70, 0x0a, 0x50, 0x0a, 0x70, 0x02, 0x90, 0x0a, 0x90, 0x0a, 0x4f, 0x0a, 0x8a, 0x01, 0x9d, 0xb6, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xe7, 0x19, 0xa6, 0x6c, 0x22, 0xed, 0x01, 0xb1, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x91, 0x0a, 0x71, 0x02, 0x72, 0x0a, 0x72, 0x0a, 0x71, 0x0a, 0x50, 0x0a, 0x8f, 0x12, 0x8e, 0x1a, 0x07, 0x01, 0xdf, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xf7, 0xd1, 0x53, 0x2c, 0x0a, 0x6f, 0x0a, 0x70, 0x0a, 0x71, 0x0a, 0x92, 0x02, 0x92, 0x02, 0x71, 0x0a, 0x51, 0x0a, 0x50, 0x02, 0x70, 0x12, 0xcb, 0x09, 0x5c, 0xb6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0x1a, 0x9e, 0xac, 0x01, 0x50, 0x12, 0x70, 0x0a, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x71, 0x0a, 0x4f, 0x12, 0x49, 0x01, 0xdd, 0xbe, 0xff, 0xef, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x91, 0x53, 0x0d, 0x0a, 0x90, 0x0a, 0x70, 0x0a, 0x71, 0x02, 0x71, 0x0a, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x70, 0x02, 0x6f, 0x12, 0xab, 0x09, 0x5c, 0xb6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9c, 0xb6, 0xab, 0x09, 0x50, 0x0a, 0x71, 0x0a, 0x70, 0x02, 0x90, 0x02, 0x71, 0x0a, 0x71, 0x0a, 0xb1, 0x0a, 0x90, 0x02, 0x70, 0x02, 0x2e, 0x0a, 0x4e, 0x22, 0xbe, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xf7, 0xf6, 0x84, 0x2e, 0x12, 0x4f, 0x0a, 0x70, 0x0a, 0x50, 0x0a, 0x71, 0x0a, 0x92, 0x0a, 0x72, 0x0a, 0x51, 0x02, 0x71, 0x02, 0x70, 0x0a, 0x70, 0x0a, 0x4e, 0x12, 0x6a, 0x01, 0x5c, 0xb6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0x0f, 0x3b, 0x0c, 0x0a, 0x6f, 0x0a, 0x90, 0x12, 0x71, 0x0a, 0x92, 0x02, 0x92, 0x02, 0x51, 0x0a, 0x50, 0x0a, 0x91, 0x0a, 0x4f, 0x0a, 0xab, 0x09, 0x9f, 0xdf, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x79, 0x8d, 0xac, 0x01, 0x50, 0x12, 0x71, 0x0a, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x90, 0x02, 0x90, 0x02, 0x71, 0x02, 0x70, 0x0a, 0x4e, 0x12, 0xab, 0x09, 0x1e, 0xc7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xef, 0x0f, 0x43, 0x0e, 0x0a, 0x70, 0x0a, 0x70, 0x02, 0x71, 0x02, 0x71, 0x0a, 0x71, 0x0a, 0x71, 0x02, 0x71, 0x02, 0x70, 0x0a, 0x6f, 0x12, 0x69, 0x01, 0xff, 0xe7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3b, 0xa6, 0x8a, 0x01, 0x71, 0x12, 0x71, 0x0a, 0x71, 0x02, 0x91, 0x02, 0x91, 0x02, 0x91, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x0a, 0x0e, 0x0a, 0x51, 0x43, 0x1f, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1e, 0xcf, 0x52, 0x3b, 0x0e, 0x0a, 0x50, 0x0a, 0x91, 0x12, 0x51, 0x0a, 0x71, 0x02, 0x92, 0x0a, 0x71, 0x02, 0x91, 0x02, 0x91, 0x0a, 0x70, 0x0a, 0x4f, 0x0a, 0xab, 0x01, 0x99, 0x95, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xdf, 0xee, 0x32, 0x4d, 0x0a, 0x4e, 0x02, 0x70, 0x0a, 0x71, 0x0a, 0x72, 0x02, 0x92, 0x02, 0x51, 0x0a, 0x50, 0x02, 0xb1, 0x12, 0x2e, 0x0a, 0x8a, 0x11, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xe7, 0x96, 0x74, 0xcd, 0x01, 0x71, 0x12, 0x71, 0x0a, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x70, 0x02, 0x90, 0x02, 0x90, 0x02, 0x70, 0x0a, 0x0d, 0x0a, 0xef, 0x32, 0x7f, 0xd7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1e, 0xcf, 0xef, 0x3a, 0x2e, 0x0a, 0x70, 0x0a, 0x71, 0x02, 0x71, 0x02, 0x71, 0x0a, 0x71, 0x0a, 0x71, 0x02, 0x71, 0x02, 0x70, 0x0a, 0x6f, 0x12, 0x69, 0x09, 0xff, 0xf7, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0x37, 0x7d, 0xab, 0x01, 0x50, 0x0a, 0x91, 0x0a, 0x71, 0x02, 0x71, 0x02, 0x91, 0x0a, 0x71, 0x02, 0x70, 0x02, 0x90, 0x0a, 0x70, 0x0a, 0xac, 0x01, 0x75, 0x6c, 0x9f, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xf7, 0x55, 0x64, 0xcc, 0x01, 0x70, 0x0a, 0x70, 0x02, 0x70, 0x0a, 0x71, 0x02, 0x71, 0x02, 0x92, 0x0a, 0x71, 0x0a, 0x91, 0x0a, 0x70, 0x0a, 0x4e, 0x0a, 0x8b, 0x01, 0x79, 0x8d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x5f, 0xd7, 0x5b, 0xb6, 0x78, 0x95, 0xf6, 0x84, 0x95, 0x74, 0x54, 0x6c, 0x34, 0x6c, 0x34, 0x64, 0x34, 0x6c, 0x75, 0x74, 0x95, 0x74, 0x57, 0x95, 0xd9, 0xa5, 0x3e, 0xd7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7c, 0xae, 0xae, 0x22, 0x4e, 0x02, 0x90, 0x0a, 0x90, 0x02, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x91, 0x0a, 0x50, 0x02, 0x90, 0x0a, 0x2d, 0x0a, 0x6d, 0x32, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xf7, 0x1d, 0xd7, 0x5b, 0xbe, 0xd8, 0xa5, 0xb8, 0x9d, 0xb8, 0x9d, 0x98, 0x95, 0xb9, 0x9d, 0x1b, 0xae, 0xdd, 0xc6, 0xbf, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5f, 0xd7, 0xb2, 0x4b, 0x0d, 0x02, 0x90, 0x0a, 0x71, 0x0a, 0x51, 0x02, 0x71, 0x0a, 0x71, 0x0a, 0x91, 0x0a, 0x71, 0x02, 0x70, 0x02, 0x6f, 0x12, 0xec, 0x09, 0xf3, 0x5b, 0xbf, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xf7, 0x3f, 0xd7, 0x3b, 0xae, 0x57, 0x8d, 0xf6, 0x84, 0xb5, 0x74, 0x74, 0x6c, 0x54, 0x6c, 0x34, 0x64, 0x54, 0x64, 0x95, 0x74, 0xb5, 0x74, 0xf6, 0x84, 0x1a, 0xae, 0x5e, 0xd7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xdf, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xa5, 0x8e, 0x22, 0x4f, 0x0a, 0x71, 0x02, 0x71, 0x02, 0x51, 0x02, 0x91, 0x0a, 0x70, 0x0a, 0x70, 0x02, 0x70, 0x0a, 0x50, 0x0a, 0x2f, 0x12, 0x6d, 0x2a, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xf7, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xdf, 0x34, 0x54, 0xed, 0x01, 0x70, 0x0a, 0x71, 0x0a, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x90, 0x02, 0x70, 0x0a, 0x6f, 0x0a, 0x70, 0x12, 0x8b, 0x01, 0x58, 0x8d, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xf7, 0x7c, 0x0d, 0x0a, 0x4f, 0x0a, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x71, 0x02, 0x91, 0x02, 0x91, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x6f, 0x12, 0x8a, 0x01, 0x99, 0x95, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xfd, 0xce, 0x78, 0x95, 0x33, 0x6c, 0x71, 0x4b, 0xef, 0x32, 0x4d, 0x1a, 0x0c, 0x12, 0xab, 0x09, 0xab, 0x01, 0xcc, 0x09, 0xcc, 0x01, 0xcc, 0x09, 0xcc, 0x09, 0xab, 0x01, 0x0c, 0x12, 0x6d, 0x2a, 0x50, 0x4b, 0x74, 0x74, 0xd9, 0xa5, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xf7, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x78, 0x8d, 0x6e, 0x12, 0x4e, 0x0a, 0x90, 0x02, 0x70, 0x02, 0x70, 0x02, 0x71, 0x0a, 0x71, 0x02, 0x70, 0x02, 0xb1, 0x0a, 0x6f, 0x0a, 0xec, 0x09, 0x54, 0x74, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xef, 0xff, 0xe7, 0x1a, 0xa6, 0x95, 0x74, 0x13, 0x64, 0x50, 0x4b, 0xef, 0x3a, 0x8d, 0x2a, 0x6d, 0x22, 0x6d, 0x1a, 0x4d, 0x1a, 0x8e, 0x22, 0xaf, 0x2a, 0x50, 0x43, 0xd2, 0x5b, 0x54, 0x74, 0xb9, 0xa5, 0x9f, 0xdf, 0xff, 0xf7, 0xff, 0xf7, 0xdf, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xbe, 0xae, 0x2a, 0x4e, 0x02, 0x90, 0x0a, 0x71, 0x0a, 0x51, 0x0a, 0x71, 0x0a, 0x70, 0x0a, 0x92, 0x0a, 0x71, 0x02, 0x70, 0x02, 0x6f, 0x12, 0xab, 0x01, 0x58, 0x8d, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xef, 0x1e, 0xcf, 0x17, 0x8d, 0x54, 0x6c, 0x51, 0x4b, 0xcf, 0x32, 0x4d, 0x1a, 0xcc, 0x09, 0xab, 0x01, 0xab, 0x01, 0xcc, 0x09, 0xcc, 0x09, 0xcc, 0x01, 0x8b, 0x01, 0x8b, 0x01, 0x0c, 0x12, 0xcf, 0x32, 0x70, 0x4b, 0x53, 0x6c, 0xfa, 0xa5, 0xff, 0xf7, 0xff, 0xff, 0xdf, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x7c, 0x2d, 0x12, 0x70, 0x0a, 0x71, 0x02, 0x71, 0x02, 0x91, 0x0a, 0x51, 0x02, 0x71, 0x0a, 0x70, 0x0a, 0x6f, 0x0a, 0x50, 0x12, 0xed, 0x11, 0xd2, 0x5b, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xdf, 0x39, 0xae, 0x97, 0x95, 0x1a, 0xa6, 0xba, 0xa5, 0x99, 0x9d, 0xba, 0xa5, 0xd9, 0xa5, 0xb8, 0x9d, 0xb8, 0x9d, 0xb8, 0x9d, 0xd9, 0xa5, 0xb8, 0xa5, 0x97, 0xa5, 0x14, 0x95, 0x3d, 0xdf, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3e, 0xd7, 0xce, 0x2a, 0x2e, 0x0a, 0x70, 0x12, 0x51, 0x0a, 0x71, 0x0a, 0x71, 0x02, 0x50, 0x02, 0x70, 0x02, 0x70, 0x0a, 0x4f, 0x0a, 0x6f, 0x12, 0x8a, 0x01, 0x1a, 0xa6, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x79, 0x8d, 0x6e, 0x1a, 0x2f, 0x02, 0x91, 0x0a, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x91, 0x0a, 0x50, 0x02, 0x90, 0x0a, 0x6f, 0x12, 0x6a, 0x01, 0x1b, 0xa6, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xf7, 0x7b, 0xb6, 0x33, 0x64, 0x30, 0x3b, 0x4e, 0x1a, 0xac, 0x01, 0x0d, 0x0a, 0x2d, 0x0a, 0x4e, 0x0a, 0x6e, 0x0a, 0x8f, 0x0a, 0x8f, 0x0a, 0x8f, 0x0a, 0x6f, 0x0a, 0x6f, 0x0a, 0x90, 0x0a, 0x6f, 0x0a, 0x4f, 0x0a, 0x4e, 0x0a, 0xed, 0x01, 0xcb, 0x01, 0xae, 0x22, 0xf2, 0x5b, 0x1a, 0xae, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x54, 0x64, 0x0d, 0x0a, 0x6f, 0x0a, 0x90, 0x02, 0x70, 0x02, 0x70, 0x02, 0x71, 0x0a, 0x71, 0x0a, 0x91, 0x02, 0x90, 0x02, 0x6f, 0x0a, 0xec, 0x09, 0x98, 0x9d, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xf7, 0xbf, 0xdf, 0x37, 0x85, 0x91, 0x43, 0xaf, 0x22, 0x0d, 0x12, 0xcd, 0x01, 0x0e, 0x0a, 0x2f, 0x0a, 0x4f, 0x02, 0x4f, 0x02, 0x4e, 0x02, 0x4e, 0x02, 0x4e, 0x0a, 0x2e, 0x0a, 0xed, 0x01, 0x0d, 0x0a, 0xcc, 0x09, 0x4d, 0x1a, 0x92, 0x4b, 0xb6, 0x7c, 0xff, 0xe7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5c, 0xae, 0xcb, 0x09, 0x6f, 0x0a, 0x90, 0x02, 0x71, 0x02, 0x51, 0x0a, 0x71, 0x0a, 0x50, 0x02, 0x71, 0x02, 0x71, 0x02, 0x70, 0x0a, 0x6f, 0x12, 0x6a, 0x01, 0x9c, 0xb6, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xf7, 0x3b, 0xa6, 0x13, 0x5c, 0x30, 0x3b, 0x2d, 0x12, 0x0d, 0x0a, 0xed, 0x01, 0x2f, 0x02, 0x70, 0x0a, 0x50, 0x0a, 0x70, 0x0a, 0x90, 0x12, 0x6f, 0x12, 0x6f, 0x12, 0x90, 0x12, 0x6f, 0x12, 0x4f, 0x0a, 0x2e, 0x0a, 0x0e, 0x0a, 0x0d, 0x0a, 0xcc, 0x09, 0x8e, 0x2a, 0x13, 0x64, 0x7c, 0xb6, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x5b, 0xed, 0x09, 0x90, 0x0a, 0x70, 0x02, 0x70, 0x02, 0x91, 0x0a, 0x51, 0x02, 0x71, 0x02, 0x70, 0x02, 0x6f, 0x0a, 0x70, 0x12, 0xab, 0x09, 0x99, 0x9d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x7f, 0xdf, 0xb4, 0x74, 0x6c, 0x22, 0xad, 0x22, 0x8e, 0x1a, 0x6e, 0x22, 0xb0, 0x2a, 0x8f, 0x22, 0x8f, 0x22, 0xaf, 0x22, 0x8e, 0x22, 0x6e, 0x22, 0x8d, 0x2a, 0x8d, 0x32, 0x68, 0x11, 0xb0, 0x63, 0x7f, 0xe7, 
-    0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xce, 0xaa, 0x09, 0x6f, 0x0a, 0x70, 0x12, 0x50, 0x0a, 0x71, 0x0a, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x70, 0x0a, 0x70, 0x0a, 0x4f, 0x12, 0xec, 0x11, 0x7c, 0xb6, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x78, 0x8d, 0x6e, 0x1a, 0x4f, 0x0a, 0x91, 0x0a, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x91, 0x02, 0x70, 0x02, 0x90, 0x0a, 0x6f, 0x12, 0x49, 0x01, 0x1e, 0xc7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xf7, 0xff, 0xff, 0xff, 0xf7, 0x9c, 0xbe, 0x12, 0x64, 0xce, 0x32, 0x2d, 0x12, 0x0d, 0x0a, 0x4f, 0x0a, 0x50, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x6f, 0x0a, 0x6f, 0x02, 0x6f, 0x02, 0x6f, 0x02, 0x90, 0x02, 0xb0, 0x02, 0xb1, 0x0a, 0x90, 0x02, 0x91, 0x02, 0x70, 0x02, 0x90, 0x0a, 0x70, 0x0a, 0x6f, 0x0a, 0x6f, 0x0a, 0xec, 0x09, 0xae, 0x2a, 0xb5, 0x74, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x71, 0x4b, 0xed, 0x09, 0x90, 0x0a, 0x90, 0x0a, 0x70, 0x02, 0x91, 0x0a, 0x71, 0x02, 0x91, 0x02, 0x71, 0x02, 0x91, 0x0a, 0x70, 0x0a, 0x8a, 0x01, 0x5f, 0xd7, 0xff, 0xf7, 0xff, 0xf7, 0x16, 0x85, 0x70, 0x4b, 0x2c, 0x12, 0xec, 0x01, 0x2f, 0x0a, 0x70, 0x0a, 0x71, 0x0a, 0x71, 0x0a, 0x92, 0x0a, 0xb2, 0x02, 0x91, 0x02, 0x91, 0x02, 0x91, 0x02, 0x90, 0x0a, 0x70, 0x0a, 0x70, 0x02, 0x90, 0x0a, 0x70, 0x0a, 0x2e, 0x0a, 0x0d, 0x0a, 0x0c, 0x12, 0x30, 0x43, 0xfa, 0xa5, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda, 0x9d, 0x8b, 0x01, 0x8f, 0x12, 0x70, 0x02, 0x71, 0x02, 0x71, 0x0a, 0x71, 0x0a, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x70, 0x0a, 0x4e, 0x0a, 0xca, 0x09, 0xfd, 0xbe, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x7c, 0xb6, 0xb2, 0x53, 0xae, 0x2a, 0x0c, 0x0a, 0x2d, 0x0a, 0x2e, 0x0a, 0x6f, 0x0a, 0x91, 0x0a, 0x91, 0x02, 0x91, 0x02, 0x71, 0x02, 0x50, 0x0a, 0x50, 0x02, 0x90, 0x0a, 0x4f, 0x0a, 0x50, 0x02, 0x90, 0x0a, 0x91, 0x0a, 0x70, 0x02, 0x70, 0x0a, 0x70, 0x0a, 0x4f, 0x0a, 0x4f, 0x12, 0xab, 0x01, 0x8e, 0x2a, 0xd5, 0x7c, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x71, 0x4b, 0xed, 0x09, 0x90, 0x0a, 0x70, 0x02, 0x70, 0x02, 0x91, 0x02, 0x92, 0x0a, 0x71, 0x02, 0x70, 0x02, 0x90, 0x0a, 0x6f, 0x12, 0x4a, 0x01, 0x3f, 0xd7, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x3f, 0xd7, 0xf3, 0x5b, 0x2c, 0x1a, 0x0c, 0x0a, 0x4e, 0x0a, 0x2e, 0x0a, 0x2e, 0x0a, 0x0e, 0x0a, 0x2f, 0x0a, 0x2f, 0x0a, 0xee, 0x01, 0x2e, 0x0a, 0x2d, 0x12, 0xec, 0x11, 0xe7, 0x00, 0x74, 0x74, 0x3e, 0xd7, 0xff, 0xef, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9c, 0xbe, 0x8a, 0x01, 0x6f, 0x12, 0x70, 0x0a, 0x71, 0x0a, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x91, 0x0a, 0x70, 0x0a, 0x2e, 0x0a, 0xf0, 0x32, 0xdd, 0xc6, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x37, 0x85, 0x2d, 0x0a, 0x6f, 0x0a, 0x71, 0x02, 0x92, 0x0a, 0x71, 0x02, 0x71, 0x02, 0x70, 0x02, 0x90, 0x02, 0x90, 0x02, 0x90, 0x0a, 0xaf, 0x1a, 0x07, 0x01, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xdf, 0xe7, 0xb6, 0x7c, 0xae, 0x32, 0xeb, 0x09, 0x0d, 0x0a, 0x70, 0x0a, 0x91, 0x0a, 0x91, 0x0a, 0x71, 0x02, 0x50, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x91, 0x0a, 0x90, 0x02, 0x70, 0x02, 0x90, 0x02, 0x91, 0x0a, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x90, 0x0a, 0x50, 0x02, 0x91, 0x0a, 0x50, 0x02, 0x90, 0x12, 0x0d, 0x0a, 0xeb, 0x09, 0x74, 0x6c, 0xff, 0xef, 0xdf, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xef, 0x10, 0x3b, 0x0e, 0x0a, 0x70, 0x0a, 0x71, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x91, 0x0a, 0x71, 0x02, 0x91, 0x02, 0x71, 0x02, 0x2f, 0x02, 0xab, 0x01, 0xff, 0xe7, 0xff, 0xef, 0x51, 0x4b, 0x6e, 0x22, 0xcc, 0x01, 0x4f, 0x0a, 0x90, 0x0a, 0x70, 0x02, 0xb1, 0x0a, 0x91, 0x0a, 0x91, 0x0a, 0x92, 0x02, 0x92, 0x02, 0x91, 0x02, 0x91, 0x02, 0x91, 0x02, 0x71, 0x0a, 0x70, 0x0a, 0x71, 0x02, 0x91, 0x02, 0x70, 0x02, 0x90, 0x0a, 0x4f, 0x0a, 0x6f, 0x12, 0x0d, 0x0a, 0x4d, 0x1a, 0xf6, 0x7c, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xef, 0xf7, 0x7c, 0xac, 0x01, 0x8f, 0x0a, 0x90, 0x0a, 0x71, 0x02, 0x71, 0x02, 0x71, 0x0a, 0x71, 0x02, 0x71, 0x02, 0x70, 0x02, 0x70, 0x0a, 0x2d, 0x0a, 0x8d, 0x22, 0x3e, 0xcf, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xdf, 0xf7, 0xff, 0xff, 0xdf, 0xef, 0x54, 0x6c, 0x8e, 0x2a, 0xec, 0x09, 0x0e, 0x0a, 0x4e, 0x0a, 0x4f, 0x0a, 0x90, 0x12, 0x70, 0x0a, 0x70, 0x02, 0x71, 0x02, 0x91, 0x02, 0x70, 0x0a, 0x70, 0x0a, 0x90, 0x0a, 0x70, 0x0a, 0x90, 0x0a, 0x91, 0x02, 0x91, 0x02, 0x91, 0x02, 0x91, 0x02, 0x71, 0x02, 0x71, 0x02, 0x30, 0x02, 0x70, 0x0a, 0x90, 0x12, 0x0d, 0x0a, 0x0b, 0x1a, 0x73, 0x74, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5f, 0xdf, 0x30, 0x3b, 0x0d, 0x0a, 0x70, 0x0a, 0x71, 0x02, 0x90, 0x02, 0x91, 0x02, 0x92, 0x02, 0x71, 0x02, 0x70, 0x02, 0x70, 0x0a, 0x6f, 0x12, 0x28, 0x01, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x1e, 0xcf, 0x50, 0x43, 0x0d, 0x12, 0x0d, 0x0a, 0x70, 0x12, 0x4f, 0x0a, 0x2f, 0x0a, 0x90, 0x12, 0x90, 0x12, 0x70, 0x0a, 0x50, 0x0a, 0x91, 0x12, 0x90, 0x12, 0x2d, 0x12, 0x8a, 0x09, 0x38, 0x85, 0xff, 0xe7, 0xff, 0xf7, 0xff, 0xf7, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xb9, 0x9d, 0xab, 0x01, 0x70, 0x0a, 0x50, 0x0a, 0x71, 0x0a, 0x70, 0x02, 0x71, 0x02, 0x91, 0x02, 0x71, 0x02, 0x71, 0x0a, 0x50, 0x0a, 0xed, 0x09, 0x14, 0x5c, 0x9f, 0xdf, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb5, 0x6c, 0x0c, 0x0a, 0x70, 0x0a, 0x50, 0x02, 0x92, 0x0a, 0x72, 0x02, 0x71, 0x02, 0x70, 0x02, 0xb1, 0x02, 0x90, 0x02, 0x6f, 0x02, 0x8f, 0x12, 0x27, 0x01, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x9f, 0xd7, 0xb2, 0x53, 0x0c, 0x12, 0x2e, 0x12, 0x4e, 0x12, 0x6f, 0x0a, 0x91, 0x0a, 0x50, 0x02, 0x71, 0x02, 0x50, 0x02, 0x91, 0x0a, 0x70, 0x02, 0x70, 0x02, 0x71, 0x0a, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x70, 0x02, 0x91, 0x0a, 0x71, 0x0a, 0x91, 0x0a, 0x91, 0x0a, 0x50, 0x02, 0x91, 0x0a, 0x71, 0x02, 0x71, 0x0a, 0x70, 0x0a, 0x2e, 0x0a, 0x0c, 0x12, 0x74, 0x74, 0xff, 0xf7, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xce, 0xd0, 0x32, 0x2f, 0x0a, 0x70, 0x0a, 0x71, 0x0a, 0x71, 0x0a, 0x70, 0x02, 0x71, 0x02, 0x71, 0x02, 0x91, 0x02, 0x91, 0x02, 0x70, 0x0a, 0xd0, 0x22, 0xff, 0xe7, 0xce, 0x3a, 0xab, 0x09, 0x4f, 0x12, 0x4f, 0x0a, 0x90, 0x0a, 0x91, 0x0a, 0x71, 0x02, 0x71, 0x02, 0x70, 0x02, 0x70, 0x02, 0x50, 0x02, 0x71, 0x02, 0x91, 0x02, 0x92, 0x02, 0x91, 0x02, 0x71, 0x0a, 0x71, 0x0a, 0x71, 0x02, 0x70, 0x02, 0x91, 0x02, 0x91, 0x02, 0x70, 0x02, 0x4f, 0x02, 0x6f, 0x0a, 0x0d, 0x0a, 0xcb, 0x11, 0xf6, 0x84, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xdf, 0xd3, 0x53, 0xed, 0x09, 0x6f, 0x0a, 0x90, 0x02, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x70, 0x02, 0x70, 0x0a, 0xec, 0x01, 0xb1, 0x4b, 0x9f, 0xd7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x5f, 0xd7, 0x2f, 0x4b, 0x0c, 0x12, 0x0d, 0x0a, 0x90, 0x12, 0x70, 0x0a, 0x50, 0x0a, 0x70, 0x12, 0x70, 0x0a, 0x50, 0x0a, 0x50, 0x02, 0x71, 0x02, 0x91, 0x0a, 0x70, 0x02, 0x6f, 0x0a, 0x6f, 0x0a, 0x70, 0x0a, 0x90, 0x0a, 0x91, 0x02, 0x91, 0x02, 0x91, 0x02, 0x91, 0x02, 0x92, 0x02, 0x91, 0x02, 0xd2, 0x0a, 0x71, 0x02, 0x50, 0x02, 0x6f, 0x0a, 0x4e, 0x12, 0xca, 0x11, 0xd5, 0x7c, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3b, 0xb6, 0xcf, 0x2a, 0x2e, 0x0a, 0x50, 0x02, 0x70, 0x02, 0x90, 0x02, 0x91, 0x0a, 0x50, 0x02, 0x71, 0x02, 0x91, 0x0a, 0x4f, 0x0a, 0x2e, 0x12, 0xcb, 0x11, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x1d, 0xc7, 0xef, 0x32, 0x2d, 0x0a, 0x6f, 0x12, 0x70, 0x12, 0x71, 0x0a, 0x71, 0x12, 0x71, 0x0a, 0x50, 0x0a, 0x50, 0x0a, 0x70, 0x0a, 0x4f, 0x0a, 0x90, 0x12, 0x0d, 0x0a, 0x8a, 0x09, 0xda, 0x95, 0xff, 0xef, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xe7, 0x54, 0x6c, 0xec, 0x09, 0x70, 0x0a, 0x70, 0x0a, 0x71, 0x0a, 0x70, 0x02, 0x70, 0x02, 0x91, 0x02, 0x71, 0x02, 0x71, 0x02, 0x50, 0x0a, 0xac, 0x01, 0x18, 0x7d, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xf2, 0x53, 0x0d, 0x02, 0x70, 0x0a, 0x70, 0x02, 0x72, 0x02, 0x71, 0x02, 0x91, 0x0a, 0x71, 0x02, 0xb1, 0x02, 0x91, 0x02, 0x4f, 0x02, 0x2d, 0x0a, 0xad, 0x3a, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3e, 0xcf, 0xce, 0x2a, 0xec, 0x09, 0x6f, 0x12, 0x4f, 0x0a, 0x70, 0x0a, 0x50, 0x0a, 0x50, 0x02, 0x70, 0x0a, 0x91, 0x0a, 0x70, 0x0a, 0x91, 0x0a, 0x50, 0x02, 0x71, 0x02, 0x71, 0x0a, 0x71, 0x0a, 0x71, 0x0a, 0x71, 0x0a, 0x71, 0x0a, 0x30, 0x02, 0x71, 0x0a, 0x71, 0x0a, 0x71, 0x0a, 0x71, 0x0a, 0x71, 0x0a, 0x71, 0x0a, 0x51, 0x02, 0x92, 0x0a, 0x50, 0x02, 0x70, 0x0a, 0x0d, 0x02, 0x2c, 0x1a, 0xf9, 0x9d, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x98, 0x9d, 0x8f, 0x22, 0x4f, 0x0a, 0x70, 0x0a, 0x71, 0x0a, 0x71, 0x0a, 0x71, 0x02, 0x91, 0x02, 0xb1, 0x02, 0x91, 0x02, 0x51, 0x02, 0x50, 0x02, 0xb4, 0x3b, 0x92, 0x43, 0xcb, 0x09, 0x2e, 0x0a, 0x6f, 0x0a, 0x90, 0x0a, 0x90, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x0a, 0x71, 0x0a, 0x91, 0x12, 0x71, 0x0a, 0x70, 0x02, 0x71, 0x02, 0x71, 0x02, 0x51, 0x0a, 0x50, 0x0a, 0x71, 0x0a, 0x70, 0x0a, 0x70, 0x02, 0x50, 0x02, 0xb1, 0x0a, 0x70, 0x02, 0x90, 0x0a, 0x70, 0x02, 0x90, 0x12, 0x2e, 0x12, 0x8a, 0x09, 0x3b, 0xb6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1e, 0xcf, 0xcf, 0x32, 0x2e, 0x0a, 0x6f, 0x0a, 0x70, 0x02, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x70, 0x02, 0x70, 0x0a, 0xcc, 0x01, 0xf6, 0x74, 0xdf, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xef, 0x1e, 0xc7, 0x6d, 0x2a, 0xec, 0x09, 0x4f, 0x12, 0x70, 0x0a, 0x50, 0x02, 0x71, 0x02, 0x71, 0x0a, 0x50, 0x0a, 0x70, 0x0a, 0x71, 0x0a, 0x91, 0x0a, 0x71, 0x02, 0x71, 0x02, 0x70, 0x02, 0x70, 0x0a, 0x6f, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x71, 0x02, 0x91, 0x0a, 0x91, 0x02, 0x91, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x91, 0x02, 0x71, 0x02, 0x70, 0x0a, 0x70, 0x12, 0x0d, 0x0a, 0x4d, 0x22, 0x3b, 0xae, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x17, 0x8d, 0x6e, 0x1a, 0x70, 0x12, 0x50, 0x02, 0x71, 0x02, 0x70, 0x02, 0x91, 0x0a, 0x50, 0x02, 0x71, 0x02, 0x70, 0x0a, 0x4f, 0x0a, 0xec, 0x09, 0x91, 0x4b, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xfd, 0xbe, 0xae, 0x22, 0x2d, 0x0a, 0x4f, 0x02, 0x50, 0x02, 0x92, 0x0a, 0x31, 0x02, 0x51, 0x0a, 0x31, 0x0a, 0x71, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x6f, 0x0a, 0x2d, 0x0a, 0xcb, 0x09, 0xfa, 0xa5, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xd7, 0x2f, 0x3b, 0x0d, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x70, 0x02, 0x70, 0x02, 0x71, 0x02, 0x71, 0x02, 0x51, 0x02, 0x70, 0x12, 0x8b, 0x01, 0xba, 0x95, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9b, 0xbe, 0x71, 0x3b, 0x0d, 0x02, 0x70, 0x0a, 0x91, 0x0a, 0x71, 0x02, 0x51, 0x02, 0x91, 0x0a, 0x91, 0x0a, 0x71, 0x02, 0x91, 0x02, 0x90, 0x0a, 0xcc, 0x09, 0xb4, 0x7c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3e, 0xd7, 0x4d, 0x2a, 0xec, 0x09, 0x4f, 0x0a, 0x70, 0x0a, 0x91, 0x0a, 0x50, 0x02, 0x71, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x50, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x50, 0x02, 0x70, 0x0a, 0x91, 0x12, 0x50, 0x0a, 0x50, 0x12, 0x71, 0x12, 0x50, 0x0a, 0x71, 0x12, 0x30, 0x02, 0x92, 0x0a, 0x92, 0x0a, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x71, 0x0a, 0x51, 0x0a, 0x51, 0x0a, 0x91, 0x0a, 0x90, 0x0a, 0xec, 0x01, 0x2f, 0x3b, 0xff, 0xe7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xb5, 0x74, 0x4d, 0x12, 0x4f, 0x0a, 0x70, 0x0a, 0x71, 0x0a, 0x71, 0x02, 0x71, 0x02, 0x91, 0x02, 0x70, 0x02, 0x71, 0x02, 0x91, 0x0a, 0x71, 0x0a, 0xb1, 0x12, 0x0d, 0x02, 0x6e, 0x12, 0x6f, 0x0a, 0xb1, 0x0a, 0x70, 0x02, 0x70, 0x02, 0xb1, 0x0a, 0x50, 0x02, 0x70, 0x0a, 0x70, 0x0a, 0x50, 0x0a, 0x50, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x51, 0x0a, 0x51, 0x0a, 0x50, 0x0a, 0x91, 0x0a, 0x90, 0x0a, 0x70, 0x0a, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x0a, 0x6f, 0x12, 0xcc, 0x09, 0xcb, 0x19, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x9c, 0xb6, 0xec, 0x11, 0x2e, 0x0a, 0x90, 0x0a, 0x70, 0x02, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x91, 0x02, 0x70, 0x0a, 0x4f, 0x0a, 0xab, 0x01, 0x1a, 0xa6, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xf7, 0xff, 0xf7, 0x1e, 0xc7, 0x2c, 0x1a, 0xec, 0x09, 0x4f, 0x12, 0x90, 0x0a, 0x71, 0x0a, 0x71, 0x02, 0x91, 0x0a, 0x91, 0x0a, 0x71, 0x0a, 0x71, 0x0a, 0x71, 0x0a, 0x71, 0x02, 0x91, 0x02, 0x91, 0x0a, 0x70, 0x0a, 0x6f, 0x0a, 0x6f, 0x0a, 0x4f, 0x0a, 0x50, 0x0a, 0x50, 0x02, 0x50, 0x02, 0x71, 0x02, 0x91, 0x0a, 0x90, 0x0a, 0x70, 0x0a, 0x70, 0x02, 0x70, 0x0a, 0x71, 0x02, 0x71, 0x0a, 0x50, 0x0a, 0x4f, 0x0a, 0xcd, 0x09, 0x51, 0x43, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x33, 0x6c, 0xec, 0x09, 0x90, 0x12, 0x70, 0x0a, 0x91, 0x0a, 0x70, 0x0a, 0x70, 0x02, 0x71, 0x02, 0x70, 0x02, 0x50, 0x02, 0x90, 0x12, 0xab, 0x09, 0x58, 0x8d, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xbd, 0xbe, 0x4d, 0x1a, 0x0d, 0x0a, 0x6f, 0x0a, 0x70, 0x02, 0xb2, 0x0a, 0x51, 0x02, 0x72, 0x0a, 0x51, 0x0a, 0x71, 0x0a, 0x71, 0x0a, 0x50, 0x0a, 0x6f, 0x12, 0xcc, 0x01, 0x6c, 0x22, 0x7b, 0xae, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3e, 0xcf, 0xeb, 0x11, 0x4f, 0x12, 0x70, 0x0a, 0x70, 0x0a, 0x70, 0x02, 0x70, 0x02, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x71, 0x0a, 0x70, 0x12, 0xcc, 0x09, 0x1b, 0xa6, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xf7, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd5, 0x84, 0xec, 0x09, 0x70, 0x0a, 0x70, 0x0a, 0x70, 0x02, 0x71, 0x02, 0x71, 0x0a, 0x71, 0x0a, 0x91, 0x0a, 0x71, 0x02, 0x71, 0x02, 0x4f, 0x0a, 0x49, 0x01, 0x5e, 0xd7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xbf, 0xdf, 0x4d, 0x2a, 0xed, 0x11, 0x4f, 0x0a, 0x70, 0x0a, 0x70, 0x02, 0x91, 0x0a, 0x70, 0x02, 0x50, 0x02, 0x70, 0x0a, 0x90, 0x0a, 0x2f, 0x0a, 0x70, 0x0a, 0x90, 0x0a, 0x4f, 0x02, 0x4f, 0x0a, 0x0d, 0x02, 0x0d, 0x0a, 0xed, 0x09, 0xcc, 0x01, 0x4f, 0x12, 0x50, 0x0a, 0x50, 0x0a, 0x30, 0x02, 0x71, 0x02, 0x71, 0x02, 0x91, 0x02, 0x91, 0x02, 0x70, 0x02, 0x50, 0x0a, 0x71, 0x12, 0x30, 0x02, 0x91, 0x0a, 0x2e, 0x02, 0x0c, 0x0a, 0xf5, 0x7c, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xd2, 0x53, 0xec, 0x01, 0x70, 0x0a, 0x70, 0x0a, 0x71, 0x02, 0x91, 0x02, 0x71, 0x02, 0x91, 0x02, 0x91, 0x02, 0x71, 0x02, 0x71, 0x0a, 0x31, 0x02, 0x92, 0x0a, 0x70, 0x02, 0x6f, 0x02, 0x71, 0x02, 0x91, 0x02, 0x50, 0x02, 0x90, 0x0a, 0x6f, 0x0a, 0x50, 0x0a, 0x91, 0x12, 0x50, 0x0a, 0x71, 0x12, 0x50, 0x0a, 0x4f, 0x0a, 0x90, 0x12, 0x4f, 0x0a, 0x71, 0x0a, 0x71, 0x02, 0xb2, 0x0a, 0x91, 0x0a, 0x51, 0x02, 0x70, 0x0a, 0x70, 0x0a, 0x70, 0x02, 0x70, 0x02, 0x91, 0x02, 0x70, 0x02, 0x70, 0x0a, 0x0e, 0x0a, 0x8b, 0x09, 0x33, 0x6c, 0xff, 0xff, 0xff, 0xff, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x7c, 0xae, 0x8b, 0x01, 0x4f, 0x12, 0x70, 0x0a, 0x90, 0x0a, 0x71, 0x02, 0x71, 0x02, 0x91, 0x02, 0x92, 0x0a, 0x70, 0x02, 0x70, 0x0a, 0x90, 0x12, 0x6a, 0x01, 0x9c, 0xb6, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xbf, 0xdf, 0xcb, 0x11, 0x0d, 0x12, 0x70, 0x12, 0x70, 0x0a, 0x71, 0x0a, 0x71, 0x0a, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x50, 0x02, 0x91, 0x0a, 0x70, 0x02, 0x91, 0x02, 0x91, 0x0a, 0x2f, 0x02, 0x0e, 0x02, 0xed, 0x09, 0xed, 0x09, 0x0e, 0x0a, 0x4f, 0x12, 0x50, 0x0a, 0x91, 0x12, 0x71, 0x0a, 0x50, 0x02, 0x70, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x71, 0x0a, 0x51, 0x0a, 0x51, 0x0a, 0x50, 0x0a, 0x30, 0x12, 0x0d, 0x1a, 0x58, 0x95, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xd2, 0x53, 0x0d, 0x0a, 0x50, 0x0a, 0x91, 0x0a, 0x70, 0x02, 0x91, 0x0a, 0x50, 0x02, 0x91, 0x0a, 0x91, 0x0a, 0x50, 0x0a, 0x4e, 0x12, 0x48, 0x01, 0x1e, 0xcf, 0xff, 0xf7, 0xdf, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0x3b, 0xae, 0xec, 0x11, 0x2d, 0x12, 0x4f, 0x0a, 0x50, 0x0a, 0x91, 0x0a, 0x50, 0x02, 0x71, 0x0a, 0x50, 0x02, 0x91, 0x0a, 0x51, 0x0a, 0x71, 0x0a, 0x90, 0x1a, 0x8b, 0x01, 0xef, 0x32, 0xbc, 0xbe, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x1f, 0xc7, 0x6a, 0x01, 0x4f, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x70, 0x02, 0x70, 0x02, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x51, 0x0a, 0x2f, 0x0a, 0x8e, 0x22, 0x7c, 0xb6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1e, 0xcf, 0xb2, 0x53, 0xed, 0x09, 0x70, 0x0a, 0x50, 0x0a, 0x70, 0x0a, 0x91, 0x0a, 0xb1, 0x0a, 0x50, 0x02, 0x71, 0x02, 0x71, 0x02, 0x71, 0x0a, 0x6f, 0x12, 0xaa, 0x09, 0xff, 0xf7, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xef, 0xce, 0x3a, 0xab, 0x01, 0x4f, 0x12, 0x70, 0x0a, 0x71, 0x0a, 0x70, 0x02, 0x91, 0x0a, 0x70, 0x02, 0xb1, 0x0a, 0x70, 0x02, 0x50, 0x0a, 0x70, 0x12, 0x4f, 0x12, 0x2e, 0x0a, 0xec, 0x01, 0xec, 0x09, 0xef, 0x32, 0x13, 0x5c, 0x54, 0x64, 0xb2, 0x4b, 0x4d, 0x1a, 0x6a, 0x01, 0x70, 0x12, 0x70, 0x0a, 0x71, 0x0a, 0x91, 0x02, 0x91, 0x02, 0x91, 0x02, 0x70, 0x02, 0x70, 0x0a, 0x50, 0x0a, 0xb2, 0x0a, 0x71, 0x02, 0x90, 0x0a, 0x0d, 0x02, 0x0e, 0x3b, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0x71, 0x43, 0xcc, 0x01, 0x70, 0x0a, 0x91, 0x0a, 0x71, 0x02, 0x71, 0x02, 0x91, 0x02, 0x70, 0x02, 0x91, 0x02, 0x70, 0x0a, 0x71, 0x0a, 0xb2, 0x0a, 0x71, 0x02, 0x91, 0x02, 0x70, 0x02, 0x71, 0x02, 0x50, 0x02, 0x90, 0x12, 0x4f, 0x0a, 0x4e, 0x12, 0x0d, 0x0a, 0xac, 0x01, 0xac, 0x01, 0xac, 0x01, 0xcc, 0x01, 0xec, 0x09, 0x0d, 0x0a, 0x6f, 0x12, 0xb1, 0x12, 0x71, 0x02, 0x92, 0x02, 0x72, 0x02, 0x71, 0x0a, 0x91, 0x0a, 0x70, 0x0a, 0x91, 0x02, 0x91, 0x02, 0x71, 0x02, 0x70, 0x02, 0x71, 0x0a, 0x4f, 0x12, 0x4e, 0x1a, 0x28, 0x01, 0xff, 0xf7, 0xbf, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0x98, 0x8d, 0x8b, 0x01, 0x70, 0x12, 0x70, 0x0a, 0x70, 0x02, 0x70, 0x02, 0x91, 0x02, 0x91, 0x02, 0x91, 0x02, 0x70, 0x02, 0x70, 0x0a, 0x0e, 0x0a, 0x0c, 0x1a, 0xdd, 0xc6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0x4c, 0x22, 0xed, 0x09, 0x50, 0x12, 0x50, 0x02, 0x71, 0x02, 0x92, 0x0a, 0x51, 0x02, 0x71, 0x02, 0x91, 0x0a, 0x71, 0x0a, 0xb1, 0x12, 0x90, 0x0a, 0x6f, 0x0a, 0x0d, 0x02, 0xac, 0x01, 0x0d, 0x12, 0x31, 0x3b, 0xf4, 0x5b, 0x14, 0x5c, 0x52, 0x43, 0x0d, 0x12, 0xac, 0x01, 0x0e, 0x0a, 0x70, 0x12, 0x50, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x71, 0x0a, 0x71, 0x0a, 0x71, 0x0a, 0x50, 0x0a, 0x0e, 0x12, 0x10, 0x43, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xbf, 0xe7, 0x71, 0x4b, 0x0d, 0x02, 0x70, 0x0a, 0x91, 0x0a, 0x71, 0x02, 0x70, 0x02, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x90, 0x12, 0x6e, 0x12, 0x07, 0x01, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xbf, 0xf7, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xef, 0xda, 0x9d, 0xcc, 0x11, 0x0d, 0x0a, 0x2f, 0x0a, 0x70, 0x12, 0x71, 0x12, 0x50, 0x0a, 0x71, 0x0a, 0x91, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0xb1, 0x12, 0x4f, 0x12, 0x6b, 0x01, 0x92, 0x4b, 0xfe, 0xc6, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x1b, 0x9e, 0x8b, 0x01, 0x70, 0x0a, 0x71, 0x0a, 0x70, 0x0a, 0x70, 0x02, 0x70, 0x02, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x70, 0x0a, 0xed, 0x09, 0x92, 0x4b, 0x1e, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xf7, 0xff, 0xf7, 0x38, 0x8d, 0xab, 0x09, 0x2f, 0x0a, 0x50, 0x0a, 0x91, 0x0a, 0x70, 0x0a, 0x90, 0x0a, 0x50, 0x02, 0x91, 0x0a, 0x71, 0x0a, 0x71, 0x0a, 0x70, 0x0a, 0x8b, 0x01, 0x95, 0x74, 0xff, 0xf7, 0xbf, 0xf7, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xf7, 0x54, 0x64, 0xab, 0x01, 0xb0, 0x1a, 0x2f, 0x02, 0x91, 0x0a, 0x91, 0x0a, 0x70, 0x02, 0x91, 0x0a, 0x70, 0x02, 0x30, 0x02, 0x91, 0x0a, 0x70, 0x0a, 0x4e, 0x12, 0x6a, 0x01, 0x8e, 0x2a, 0xfa, 0x9d, 0x7f, 0xcf, 0xbf, 0xdf, 0xff, 0xe7, 0xdf, 0xe7, 0xdf, 0xe7, 0xdf, 0xdf, 0x7c, 0xae, 0x0c, 0x12, 0xec, 0x01, 0x4f, 0x0a, 0x70, 0x0a, 0x90, 0x02, 0x70, 0x02, 0x91, 0x0a, 0x70, 0x0a, 0x50, 0x0a, 0x71, 0x02, 0x92, 0x02, 0x70, 0x02, 0x2e, 0x0a, 0xae, 0x32, 0x1a, 0xae, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3e, 0xc7, 0x30, 0x3b, 0x2d, 0x0a, 0x6f, 0x0a, 0x70, 0x02, 0x71, 0x02, 0x91, 0x02, 0x91, 0x02, 0x91, 0x02, 0x71, 0x02, 0x70, 0x0a, 0x71, 0x0a, 0x51, 0x02, 0x91, 0x02, 0x91, 0x02, 0x91, 0x0a, 0x71, 0x0a, 0x70, 0x12, 0xac, 0x01, 0x4a, 0x01, 0x2c, 0x1a, 0xf3, 0x5b, 0x59, 0x85, 0xdb, 0x95, 0xba, 0x95, 0x17, 0x7d, 0xd2, 0x53, 0x2c, 0x1a, 0x8a, 0x01, 0x2e, 0x0a, 0x50, 0x02, 0x71, 0x02, 0x92, 0x02, 0x72, 0x02, 0x91, 0x0a, 0x50, 0x02, 0x91, 0x0a, 0x91, 0x02, 0x70, 0x02, 0x71, 0x0a, 0x71, 0x0a, 0x70, 0x12, 0x4f, 0x12, 0xab, 0x09, 0x78, 0x95, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xdf, 0x54, 0x64, 0xcd, 0x01, 0x91, 0x12, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x91, 0x02, 0x91, 0x02, 0x91, 0x02, 0x70, 0x0a, 0x90, 0x12, 0x0d, 0x0a, 0x51, 0x43, 0x3e, 0xd7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xf7, 0xff, 0xf7, 0x90, 0x53, 0xab, 0x09, 0x70, 0x1a, 0x50, 0x0a, 0xd2, 0x12, 0x50, 0x02, 0x50, 0x02, 0x71, 0x02, 0x91, 0x0a, 0x50, 0x02, 0x91, 0x12, 0x4f, 0x0a, 0x0d, 0x0a, 0xaa, 0x01, 0xee, 0x32, 0xd9, 0x9d, 0x7f, 0xd7, 0xbf, 0xe7, 0xdf, 0xef, 0xdf, 0xe7, 0xdf, 0xdf, 0x9f, 0xd7, 0x3c, 0x9e, 0x4d, 0x1a, 0xcc, 0x09, 0x4f, 0x12, 0x90, 0x12, 0x70, 0x0a, 0x71, 0x0a, 0x71, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x71, 0x0a, 0x71, 0x0a, 0x50, 0x02, 0x2e, 0x0a, 0xcf, 0x32, 0xfe, 0xce, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbd, 0xbe, 0xf0, 0x32, 0x2e, 0x0a, 0x91, 0x0a, 0x91, 0x0a, 0x71, 0x02, 0x71, 0x0a, 0x50, 0x02, 0x91, 0x02, 0x70, 0x02, 0x70, 0x0a, 0x6f, 0x1a, 0x48, 0x09, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xef, 0x78, 0x8d, 0x8b, 0x01, 0x2f, 0x12, 0x4f, 0x0a, 0x70, 0x0a, 0x50, 0x0a, 0x50, 0x12, 0x30, 0x0a, 0x30, 0x02, 0x70, 0x0a, 0x6f, 0x02, 0x4e, 0x02, 0x4e, 0x0a, 0x49, 0x01, 0x13, 0x64, 0x7f, 0xdf, 0xff, 0xf7, 0xbf, 0xf7, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xef, 0x96, 0x6c, 0x0e, 0x0a, 0x50, 0x0a, 0x70, 0x0a, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x71, 0x02, 0x71, 0x02, 0x71, 0x0a, 0x70, 0x0a, 0xcc, 0x09, 0x95, 0x74, 0xdf, 0xef, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xdf, 0xf7, 0xff, 0xf7, 0xfb, 0xa5, 0x0c, 0x12, 0x2e, 0x12, 0x70, 0x0a, 0x92, 0x0a, 0x50, 0x02, 0x50, 0x02, 0x90, 0x0a, 0x91, 0x0a, 0x50, 0x02, 0x91, 0x0a, 0x50, 0x0a, 0x4f, 0x12, 0xe8, 0x00, 0xdf, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x7c, 0xb6, 0x6a, 0x01, 0x6f, 0x12, 0x4f, 0x02, 0x91, 0x02, 0x71, 0x02, 0x71, 0x02, 0xb2, 0x0a, 0x91, 0x0a, 0xb1, 0x0a, 0x91, 0x0a, 0x70, 0x0a, 0xed, 0x09, 0x2d, 0x1a, 0x1b, 0x9e, 0xff, 0xe7, 0xff, 0xef, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xef, 0xff, 0xe7, 0x34, 0x5c, 0xcb, 0x01, 0x8f, 0x12, 0x90, 0x0a, 0x91, 0x0a, 0x70, 0x02, 0x70, 0x0a, 0x70, 0x0a, 0x71, 0x02, 0x91, 0x02, 0x71, 0x02, 0x70, 0x12, 0x2d, 0x1a, 0x33, 0x6c, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3b, 0xa6, 0xae, 0x22, 0x2e, 0x0a, 0x6f, 0x0a, 0x70, 0x02, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x50, 0x02, 0x91, 0x0a, 0x70, 0x0a, 0x70, 0x02, 0xb1, 0x12, 0x4f, 0x02, 0x6f, 0x0a, 0x0e, 0x0a, 0x8b, 0x01, 0x75, 0x6c, 0xdf, 0xdf, 0xff, 0xe7, 0xff, 0xef, 0xff, 0xef, 0xff, 0xef, 0xff, 0xf7, 0xff, 0xef, 0xff, 0xef, 0xff, 0xe7, 0x5c, 0xa6, 0xaf, 0x22, 0xed, 0x01, 0x91, 0x12, 0xb2, 0x0a, 0x71, 0x02, 0x51, 0x02, 0x71, 0x0a, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x70, 0x02, 0x70, 0x02, 0x50, 0x0a, 0x70, 0x0a, 0x4e, 0x12, 0x2c, 0x22, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1e, 0xcf, 0x50, 0x3b, 0x2e, 0x0a, 0x50, 0x0a, 0x50, 0x02, 0x91, 0x0a, 0x91, 0x0a, 0x91, 0x02, 0x90, 0x02, 0x90, 0x02, 0x70, 0x0a, 0x4f, 0x0a, 0xcc, 0x09, 0x55, 0x6c, 0xbf, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x98, 0x9d, 0x49, 0x01, 0x4e, 0x12, 0x70, 0x12, 0x91, 0x0a, 0x50, 0x02, 0x70, 0x02, 0x91, 0x0a, 0x91, 0x0a, 0x71, 0x0a, 0x91, 0x12, 0x4f, 0x12, 0xcc, 0x09, 0x8e, 0x2a, 0x1a, 0xa6, 0xff, 0xef, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xef, 0xff, 0xef, 0x51, 0x43, 0xec, 0x09, 0x6f, 0x12, 0x2f, 0x02, 0x71, 0x0a, 0x71, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x4f, 0x02, 0x4e, 0x1a, 0x95, 0x74, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x99, 0x95, 0x6e, 0x22, 0x4f, 0x0a, 0x70, 0x02, 0x70, 0x02, 0x91, 0x0a, 0x51, 0x02, 0x71, 0x0a, 0x91, 0x02, 0x91, 0x02, 0x4f, 0x0a, 0xec, 0x09, 0x0f, 0x4b, 0xff, 0xf7, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x91, 0x53, 0x8b, 0x01, 0x4f, 0x12, 0x71, 0x0a, 0x91, 0x0a, 0x0f, 0x02, 0x71, 0x12, 0x71, 0x12, 0x51, 0x0a, 0x71, 0x0a, 0x90, 0x0a, 0xaf, 0x0a, 0x8e, 0x12, 0xa9, 0x01, 0x37, 0x85, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xdf, 0x31, 0x3b, 0x0e, 0x02, 0x50, 0x0a, 0x70, 0x0a, 0x70, 0x02, 0x70, 0x02, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x71, 0x0a, 0x90, 0x12, 0x8a, 0x01, 0x37, 0x8d, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xf7, 0xff, 0xff, 0xff, 0xf7, 0x5b, 0xae, 0x4c, 0x1a, 0x2d, 0x12, 0x6f, 0x12, 0x50, 0x02, 0x30, 0x02, 0x92, 0x0a, 0x91, 0x0a, 0xb2, 0x12, 0x70, 0x0a, 0x91, 0x0a, 0x30, 0x02, 0x4f, 0x12, 0xab, 0x09, 0xf2, 0x63, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xef, 0x69, 0x09, 0x4e, 0x12, 0xb0, 0x12, 0x70, 0x02, 0xb1, 0x0a, 0x71, 0x02, 0x91, 0x0a, 0x71, 0x02, 0x91, 0x02, 0x50, 0x02, 0x70, 0x0a, 0xac, 0x01, 0xd0, 0x32, 0xbd, 0xbe, 0xff, 0xef, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xef, 0x8d, 0x2a, 0x2d, 0x12, 0x4f, 0x0a, 0x71, 0x0a, 0x91, 0x0a, 0x90, 0x02, 0x70, 0x02, 0x91, 0x0a, 0x71, 0x02, 0x71, 0x0a, 0x70, 0x12, 0xac, 0x09, 0x91, 0x53, 0xff, 0xf7, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x17, 0x7d, 0x2d, 0x12, 0x4e, 0x0a, 0x70, 0x0a, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x91, 0x0a, 0x50, 0x02, 0x70, 0x0a, 0x91, 0x0a, 0x2e, 0x02, 0x4e, 0x12, 0xcb, 0x09, 0x6c, 0x22, 0x9f, 0xd7, 0xff, 0xef, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xf7, 0xdf, 0xdf, 0x72, 0x4b, 0x8c, 0x01, 0x4f, 0x0a, 0x91, 0x0a, 0x50, 0x02, 0x91, 0x0a, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x91, 0x0a, 0x70, 0x0a, 0x2e, 0x0a, 0x49, 0x01, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdd, 0xbe, 0x0b, 0x12, 0x4f, 0x12, 0x70, 0x0a, 0x50, 0x02, 0x71, 0x02, 0x91, 0x0a, 0x91, 0x02, 0x70, 0x02, 0x90, 0x02, 0x70, 0x0a, 0x4f, 0x12, 0xab, 0x01, 0x79, 0x95, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0x48, 0x01, 0x8f, 0x1a, 0x70, 0x12, 0x50, 0x02, 0x50, 0x02, 0x70, 0x0a, 0x90, 0x0a, 0x70, 0x02, 0x50, 0x02, 0x71, 0x0a, 0xb1, 0x1a, 0x8b, 0x01, 0x10, 0x43, 0xfe, 0xce, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xef, 0xeb, 0x11, 0x2e, 0x12, 0xb1, 0x12, 0x70, 0x02, 0x71, 0x02, 0x71, 0x02, 0x70, 0x02, 0x70, 0x02, 0x90, 0x02, 0x90, 0x02, 0x70, 0x02, 0xee, 0x01, 0x92, 0x4b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x75, 0x6c, 0xcc, 0x09, 0x70, 0x12, 0x70, 0x02, 0x70, 0x02, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x91, 0x02, 0x70, 0x02, 0x90, 0x12, 0x8b, 0x01, 0xb5, 0x7c, 0xff, 0xf7, 0xbf, 0xef, 0xff, 0xff, 0xff, 0xef, 0xef, 0x42, 0xab, 0x09, 0x2e, 0x0a, 0x91, 0x12, 0x71, 0x02, 0x91, 0x02, 0x71, 0x02, 0x71, 0x02, 0x71, 0x0a, 0x51, 0x02, 0x70, 0x0a, 0x6f, 0x0a, 0x2d, 0x02, 0xca, 0x01, 0xd8, 0x95, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xdf, 0xff, 0xbf, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xdf, 0x0d, 0x12, 0x2f, 0x0a, 0x70, 0x0a, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x70, 0x0a, 0x2e, 0x0a, 0xcb, 0x09, 0xfa, 0xa5, 0xff, 0xf7, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xef, 0xda, 0x95, 0xeb, 0x09, 0x2d, 0x0a, 0x8f, 0x12, 0x4f, 0x0a, 0x70, 0x02, 0xb2, 0x0a, 0x71, 0x0a, 0x71, 0x02, 0x30, 0x02, 0x50, 0x02, 0x71, 0x02, 0xb1, 0x12, 0x2e, 0x0a, 0x08, 0x01, 0xff, 0xef, 0xff, 0xf7, 0xbf, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x17, 0x85, 0x6a, 0x01, 0x6f, 0x12, 0x6f, 0x02, 0x70, 0x02, 0x70, 0x02, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x70, 0x02, 0x91, 0x12, 0xcc, 0x01, 0x8e, 0x2a, 0xbd, 0xbe, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xff, 0xe7, 0x29, 0x01, 0x6f, 0x12, 0x70, 0x0a, 0x71, 0x02, 0x91, 0x02, 0x90, 0x02, 0x70, 0x02, 0x71, 0x0a, 0x51, 0x02, 0x50, 0x0a, 0x0e, 0x0a, 0x10, 0x3b, 0x9f, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x13, 0x5c, 0x0d, 0x0a, 0x70, 0x12, 0x70, 0x0a, 0x50, 0x02, 0x71, 0x02, 0x71, 0x02, 0x92, 0x0a, 0x71, 0x0a, 0x51, 0x02, 0x71, 0x0a, 0x91, 0x0a, 0x6f, 0x02, 0x8f, 0x12, 0xcb, 0x11, 0x0f, 0x43, 0xff, 0xef, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xf7, 0xbf, 0xdf, 0x30, 0x43, 0xec, 0x01, 0x90, 0x12, 0x70, 0x0a, 0x70, 0x02, 0x71, 0x02, 0x92, 0x0a, 0x71, 0x02, 0x91, 0x0a, 0x71, 0x02, 0x50, 0x02, 0x70, 0x02, 0x4f, 0x0a, 0xcc, 0x09, 0x9d, 0xb6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xbd, 0xb6, 0x69, 0x01, 0x6f, 0x12, 0x91, 0x0a, 0x71, 0x0a, 0x50, 0x02, 0x71, 0x02, 0x91, 0x02, 0x90, 0x02, 0x90, 0x02, 0x70, 0x0a, 0x90, 0x1a, 0x6a, 0x01, 0x5c, 0xb6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x95, 0x74, 0x6a, 0x01, 0x50, 0x12, 0x70, 0x02, 0x71, 0x02, 0x91, 0x02, 0xb1, 0x0a, 0x70, 0x02, 0x70, 0x02, 0x91, 0x0a, 0x70, 0x12, 0xcd, 0x01, 0xf0, 0x3a, 0x1f, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0x3f, 0xc7, 0x6a, 0x01, 0x2e, 0x0a, 0x70, 0x02, 0x71, 0x02, 0x71, 0x02, 0x70, 0x02, 0x70, 0x02, 0x90, 0x02, 0x91, 0x02, 0x90, 0x02, 0x2f, 0x02, 0x31, 0x3b, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x13, 0x5c, 0xcc, 0x09, 0x90, 0x12, 0x71, 0x0a, 0x91, 0x0a, 0x71, 0x02, 0x71, 0x0a, 0x71, 0x02, 0x91, 0x02, 0x70, 0x02, 0xb1, 0x1a, 0x6a, 0x01, 0x5b, 0xae, 0xff, 0xef, 0xff, 0xf7, 0xff, 0xef, 0x2c, 0x22, 0xcb, 0x09, 0x2e, 0x12, 0x70, 0x0a, 0x71, 0x0a, 0x71, 0x02, 0x50, 0x02, 0x91, 0x02, 0x71, 0x02, 0x71, 0x0a, 0x50, 0x0a, 0x70, 0x12, 0xcc, 0x01, 0xeb, 0x09, 0x1a, 0x9e, 0xff, 0xef, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0x5f, 0xd7, 0x6b, 0x01, 0x91, 0x12, 0x70, 0x0a, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x2f, 0x02, 0xf1, 0x22, 0xbd, 0xae, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0x3b, 0xae, 0xef, 0x32, 0xab, 0x01, 0x90, 0x12, 0x70, 0x0a, 0x50, 0x0a, 0x91, 0x0a, 0x91, 0x02, 0x70, 0x02, 0x71, 0x02, 0x71, 0x0a, 0x71, 0x0a, 0x71, 0x0a, 0x91, 0x0a, 0x2f, 0x02, 0xab, 0x01, 0x17, 0x7d, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xf7, 0xdf, 0xf7, 0xff, 0xf7, 0x49, 0x01, 0x2d, 0x0a, 0x8f, 0x12, 0x6f, 0x02, 0x50, 0x02, 0x91, 0x0a, 0x71, 0x0a, 0x71, 0x0a, 0x91, 0x02, 0x90, 0x0a, 0x0d, 0x0a, 0x2c, 0x1a, 0xb9, 0xa5, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xdf, 0xf7, 0xff, 0xf7, 0x6d, 0x2a, 0x0d, 0x0a, 0x4f, 0x0a, 0x70, 0x02, 0x90, 0x02, 0x91, 0x02, 0x70, 0x0a, 0x50, 0x0a, 0x71, 0x0a, 0x50, 0x02, 0xee, 0x01, 0x31, 0x33, 0xbc, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xd2, 0x53, 0xcd, 0x09, 0x2f, 0x0a, 0x71, 0x0a, 0x91, 0x0a, 0x71, 0x02, 0x51, 0x02, 0x71, 0x0a, 0x51, 0x0a, 0x51, 0x0a, 0x91, 0x0a, 0x50, 0x02, 0x6f, 0x0a, 0xeb, 0x09, 0x6c, 0x32, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xf7, 0xff, 0xf7, 0xb9, 0x9d, 0x6d, 0x22, 0x2e, 0x0a, 0x70, 0x0a, 0x70, 0x02, 0x71, 0x02, 0x92, 0x0a, 0x71, 0x02, 0x92, 0x02, 0x92, 0x02, 0x71, 0x02, 0x91, 0x0a, 0x90, 0x12, 0xab, 0x09, 0x17, 0x85, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x1a, 0xa6, 0x8a, 0x01, 0x6f, 0x0a, 0x70, 0x02, 0x71, 0x0a, 0x92, 0x0a, 0x71, 0x0a, 0x91, 0x02, 0x90, 0x02, 0x90, 0x02, 0x50, 0x0a, 0x2f, 0x12, 0xec, 0x11, 0x9d, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xc7, 0x00, 0x2f, 0x12, 0x71, 0x0a, 0x92, 0x02, 0x70, 0x02, 0x91, 0x02, 0x91, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x12, 0x0e, 0x0a, 0x4d, 0x22, 0xfa, 0xa5, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xef, 0xeb, 0x11, 0x4f, 0x12, 0x50, 0x0a, 0x71, 0x02, 0x71, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x71, 0x0a, 0x71, 0x02, 0x71, 0x02, 0x30, 0x02, 0xd1, 0x2a, 0x5f, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xe7, 0xf3, 0x5b, 0x0d, 0x12, 0x70, 0x0a, 0x50, 0x02, 0x71, 0x02, 0x91, 0x0a, 0x50, 0x02, 0xb1, 0x0a, 0x70, 0x02, 0x91, 0x0a, 0x4f, 0x12, 0x08, 0x01, 0xff, 0xef, 0xff, 0xef, 0xff, 0xe7, 0xcb, 0x11, 0x0d, 0x12, 0x4f, 0x12, 0x90, 0x12, 0x70, 0x0a, 0x70, 0x02, 0x91, 0x0a, 0x90, 0x02, 0x90, 0x02, 0x90, 0x0a, 0x70, 0x0a, 0x6f, 0x12, 0xcc, 0x09, 0x6d, 0x2a, 0x9c, 0xb6, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbc, 0xbe, 0x6b, 0x01, 0x91, 0x12, 0x71, 0x0a, 0x90, 0x02, 0x90, 0x02, 0x90, 0x02, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x70, 0x02, 0x90, 0x12, 0x51, 0x33, 0x71, 0x4b, 0x51, 0x4b, 0x31, 0x4b, 0x92, 0x53, 0x50, 0x4b, 0x50, 0x4b, 0x50, 0x4b, 0x50, 0x4b, 0x50, 0x4b, 0x50, 0x4b, 0x50, 0x4b, 0x51, 0x4b, 0x31, 0x4b, 0x30, 0x53, 0x31, 0x53, 0x51, 0x4b, 0x51, 0x4b, 0x51, 0x4b, 0x71, 0x4b, 0x0f, 0x43, 0x8e, 0x32, 0xab, 0x19, 0x4a, 0x01, 0x0d, 0x0a, 0x4f, 0x0a, 0x50, 0x02, 0x71, 0x02, 0x51, 0x02, 0x51, 0x02, 0x91, 0x0a, 0x91, 0x02, 0x51, 0x02, 0x71, 0x02, 0x51, 0x0a, 0x92, 0x12, 0x70, 0x0a, 0x2e, 0x0a, 0xeb, 0x11, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x98, 0x9d, 0x8a, 0x01, 0x6f, 0x12, 0xb0, 0x12, 0x70, 0x0a, 0xb1, 0x12, 0x50, 0x0a, 0x50, 0x02, 0x91, 0x0a, 0x70, 0x0a, 0x2e, 0x02, 0xcb, 0x09, 0x74, 0x74, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x38, 0x8d, 0x8b, 0x01, 0xb0, 0x12, 0x90, 0x0a, 0x70, 0x02, 0x91, 0x02, 0x70, 0x0a, 0x50, 0x0a, 0x71, 0x0a, 0x71, 0x0a, 0x2f, 0x02, 0xaf, 0x22, 0x3a, 0xae, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5f, 0xdf, 0x31, 0x43, 0x0e, 0x0a, 0x70, 0x12, 0x71, 0x0a, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x51, 0x02, 0x71, 0x0a, 0x71, 0x0a, 0x71, 0x0a, 0x90, 0x0a, 0x2d, 0x0a, 0xca, 0x11, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xf7, 0x91, 0x4b, 0xec, 0x09, 0x70, 0x0a, 0x91, 0x0a, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x91, 0x02, 0x70, 0x02, 0x4f, 0x0a, 0x0d, 0x12, 0x13, 0x64, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xef, 0x95, 0x6c, 0xcb, 0x01, 0x90, 0x12, 0x90, 0x0a, 0x70, 0x02, 0x71, 0x02, 0x71, 0x02, 0x70, 0x02, 0x90, 0x02, 0xb0, 0x0a, 0x70, 0x0a, 0xed, 0x09, 0x30, 0x3b, 0xfe, 0xce, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xf7, 0xff, 0xff, 0x95, 0x7c, 0x8b, 0x01, 0x50, 0x0a, 0x92, 0x0a, 0x72, 0x02, 0x91, 0x02, 0xb1, 0x0a, 0x70, 0x02, 0x90, 0x02, 0x70, 0x0a, 0x70, 0x12, 0xcc, 0x09, 0x54, 0x6c, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x55, 0x64, 0xed, 0x09, 0x70, 0x0a, 0x71, 0x0a, 0x71, 0x02, 0x71, 0x02, 0x50, 0x02, 0x71, 0x0a, 0x71, 0x0a, 0x71, 0x0a, 0x30, 0x02, 0xf1, 0x2a, 0x7c, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdd, 0xc6, 0x31, 0x43, 0xed, 0x09, 0x70, 0x0a, 0x91, 0x0a, 0x70, 0x02, 0x71, 0x02, 0x91, 0x02, 0x30, 0x02, 0xb1, 0x0a, 0x90, 0x0a, 0x0e, 0x0a, 0x6a, 0x01, 0xff, 0xe7, 0xff, 0xe7, 0x28, 0x01, 0xec, 0x09, 0x4f, 0x0a, 0x70, 0x0a, 0x50, 0x02, 0x70, 0x02, 0x70, 0x02, 0x91, 0x0a, 0xb1, 0x0a, 0x90, 0x0a, 0x6f, 0x0a, 0x2e, 0x0a, 0xcb, 0x09, 0xcf, 0x3a, 0xdd, 0xc6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x16, 0x85, 0xed, 0x09, 0x30, 0x02, 0x91, 0x02, 0x91, 0x02, 0x91, 0x02, 0x91, 0x02, 0x91, 0x02, 0x71, 0x02, 0x71, 0x02, 0x71, 0x0a, 0x91, 0x0a, 0x70, 0x0a, 0x2e, 0x0a, 0x0d, 0x02, 0xed, 0x09, 0xed, 0x09, 0xed, 0x09, 0xed, 0x09, 0xec, 0x09, 0xec, 0x09, 0xec, 0x09, 0xcc, 0x09, 0xcc, 0x09, 0xcd, 0x09, 0xcd, 0x09, 0xcd, 0x09, 0xcd, 0x11, 0xcd, 0x11, 0xcd, 0x09, 0xed, 0x09, 0xed, 0x01, 0xed, 0x01, 0xed, 0x09, 0xed, 0x09, 0x2e, 0x12, 0x70, 0x12, 0x71, 0x12, 0x50, 0x02, 0x50, 0x02, 0x71, 0x0a, 0x71, 0x12, 0x50, 0x0a, 0x50, 0x02, 0x91, 0x02, 0x92, 0x0a, 0x92, 0x0a, 0x70, 0x02, 0x50, 0x0a, 0x2e, 0x12, 0x29, 0x01, 0x9f, 0xd7, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xc9, 0x19, 0x2d, 0x12, 0x90, 0x12, 0x4f, 0x02, 0x91, 0x0a, 0x50, 0x02, 0x50, 0x02, 0xb2, 0x0a, 0x91, 0x0a, 0x70, 0x0a, 0x0d, 0x0a, 0xef, 0x32, 0x7c, 0xb6, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x9d, 0xbe, 0x4a, 0x01, 0x4f, 0x12, 0x91, 0x0a, 0x71, 0x02, 0x91, 0x02, 0x90, 0x0a, 0x4f, 0x02, 0x71, 0x02, 0x50, 0x02, 0x2f, 0x0a, 0x8f, 0x22, 0xd9, 0xa5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5b, 0xbe, 0xcf, 0x3a, 0x2e, 0x12, 0x50, 0x0a, 0x70, 0x0a, 0x71, 0x02, 0x71, 0x02, 0x92, 0x0a, 0x50, 0x02, 0x50, 0x02, 0x91, 0x0a, 0x50, 0x0a, 0x4f, 0x12, 0x69, 0x01, 0xdf, 0xdf, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x94, 0x74, 0x2d, 0x1a, 0x4f, 0x0a, 0x71, 0x02, 0x91, 0x02, 0x91, 0x02, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x91, 0x02, 0x91, 0x0a, 0x4f, 0x0a, 0xec, 0x09, 0x91, 0x53, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xef, 0xff, 0xef, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0xef, 0xff, 0xef, 0xff, 0xef, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0xef, 0xff, 0xef, 0xff, 0xef, 0xff, 0xef, 0xff, 0xef, 0xff, 0xef, 0xff, 0xef, 0xff, 0xef, 0xff, 0xef, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xdf, 0xb2, 0x53, 0xcc, 0x01, 0x90, 0x0a, 0x90, 0x0a, 0x70, 0x02, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x91, 0x02, 0x70, 0x02, 0x6f, 0x0a, 0xec, 0x09, 0xf2, 0x5b, 0x7f, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x28, 0x01, 0x2e, 0x12, 0x50, 0x0a, 0x71, 0x0a, 0x92, 0x02, 0x91, 0x02, 0x70, 0x02, 0x90, 0x02, 0xb0, 0x0a, 0x2e, 0x02, 0x0d, 0x0a, 0x30, 0x43, 0xfe, 0xc6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xf7, 0xff, 0xff, 0x99, 0x95, 0xcc, 0x01, 0x70, 0x0a, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x91, 0x02, 0x71, 0x02, 0x70, 0x02, 0x70, 0x0a, 0x2f, 0x02, 0xcf, 0x2a, 0x5b, 0xb6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xa5, 0x8f, 0x2a, 0x2f, 0x12, 0x2f, 0x0a, 0x70, 0x0a, 0x71, 0x02, 0x92, 0x0a, 0x71, 0x02, 0x71, 0x02, 0x70, 0x02, 0x91, 0x0a, 0x4f, 0x0a, 0x52, 0x33, 0xff, 0xd7, 0xe7, 0x00, 0x0d, 0x12, 0x90, 0x12, 0x50, 0x0a, 0x71, 0x0a, 0x91, 0x0a, 0x70, 0x02, 0x91, 0x02, 0x71, 0x02, 0x4f, 0x02, 0xb0, 0x12, 0x8f, 0x12, 0xab, 0x01, 0x30, 0x43, 0x5f, 0xd7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xef, 0x91, 0x53, 0xed, 0x09, 0x91, 0x0a, 0x91, 0x02, 0x91, 0x02, 0x71, 0x02, 0x91, 0x02, 0x91, 0x02, 0x71, 0x02, 0x71, 0x02, 0x71, 0x0a, 0x71, 0x02, 0x70, 0x02, 0x70, 0x0a, 0x70, 0x02, 0x70, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x90, 0x12, 0x70, 0x0a, 0x70, 0x0a, 0x50, 0x0a, 0x50, 0x0a, 0x50, 0x0a, 0x50, 0x0a, 0x70, 0x0a, 0x50, 0x0a, 0x50, 0x12, 0x50, 0x12, 0x50, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x71, 0x0a, 0x50, 0x02, 0x50, 0x02, 0x71, 0x02, 0x71, 0x0a, 0x71, 0x0a, 0x70, 0x0a, 0x71, 0x0a, 0x71, 0x0a, 0x71, 0x02, 0x91, 0x0a, 0x50, 0x02, 0x4f, 0x02, 0x0d, 0x0a, 0x8a, 0x09, 0x1b, 0xa6, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xe7, 0xc6, 0x00, 0x8f, 0x1a, 0x90, 0x0a, 0x91, 0x0a, 0x91, 0x02, 0x71, 0x02, 0x71, 0x02, 0x51, 0x02, 0x50, 0x02, 0x2f, 0x0a, 0xec, 0x09, 0xf3, 0x5b, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xbe, 0x6a, 0x01, 0x70, 0x12, 0x71, 0x0a, 0x71, 0x02, 0x71, 0x02, 0x70, 0x0a, 0x6f, 0x02, 0x70, 0x02, 0x70, 0x02, 0x2f, 0x0a, 0x6f, 0x22, 0x78, 0x9d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x36, 0x95, 0x6d, 0x2a, 0x2e, 0x12, 0x6f, 0x0a, 0x70, 0x0a, 0x91, 0x0a, 0x71, 0x02, 0x91, 0x0a, 0x71, 0x02, 0x70, 0x02, 0x90, 0x0a, 0x2f, 0x0a, 0xcc, 0x09, 0xf2, 0x5b, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xd9, 0x9d, 0x8d, 0x22, 0x2f, 0x0a, 0x91, 0x02, 0x91, 0x02, 0x70, 0x02, 0x71, 0x02, 0x91, 0x02, 0x91, 0x02, 0x71, 0x02, 0x71, 0x02, 0x50, 0x0a, 0x0d, 0x0a, 0x0f, 0x43, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xdf, 0x9f, 0xcf, 0xbf, 0xc7, 0xdf, 0xc7, 0xbf, 0xbf, 0xdf, 0xc7, 0xdf, 0xc7, 0xdf, 0xc7, 0xdf, 0xc7, 0xdf, 0xc7, 0xdf, 0xc7, 0xdf, 0xc7, 0xdf, 0xc7, 0xdf, 0xc7, 0xdf, 0xc7, 0xdf, 0xc7, 0xdf, 0xc7, 0xdf, 0xc7, 0xdf, 0xc7, 0xbf, 0xc7, 0xbf, 0xc7, 0xbf, 0xc7, 0xdf, 0xcf, 0x9f, 0xc7, 0xbf, 0xc7, 0xbf, 0xcf, 0x7f, 0xcf, 0xff, 0xef, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0x3e, 0xd7, 0x2d, 0x1a, 0x2e, 0x0a, 0x90, 0x12, 0x70, 0x02, 0x70, 0x02, 0x91, 0x02, 0x51, 0x02, 0x92, 0x0a, 0x71, 0x02, 0x70, 0x0a, 0x8f, 0x12, 0xab, 0x01, 0x16, 0x85, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0xc7, 0x28, 0x01, 0xb1, 0x22, 0x30, 0x02, 0x71, 0x02, 0x92, 0x02, 0x51, 0x02, 0xb2, 0x0a, 0x70, 0x02, 0x2e, 0x02, 0x8f, 0x12, 0xcb, 0x01, 0xf3, 0x5b, 0xff, 0xf7, 0xdf, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x5c, 0xa6, 0x8b, 0x01, 0x70, 0x0a, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x91, 0x02, 0x71, 0x02, 0x70, 0x02, 0x70, 0x0a, 0x2e, 0x02, 0xaf, 0x22, 0x3a, 0xae, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x17, 0x85, 0x0d, 0x12, 0x50, 0x12, 0x70, 0x0a, 0x70, 0x0a, 0x71, 0x02, 0x91, 0x02, 0xb1, 0x0a, 0xb1, 0x0a, 0x71, 0x02, 0x71, 0x02, 0x4f, 0x0a, 0x94, 0x3b, 0xac, 0x01, 0x6f, 0x1a, 0x6f, 0x12, 0x70, 0x0a, 0x91, 0x0a, 0x71, 0x02, 0x71, 0x02, 0x91, 0x0a, 0x71, 0x02, 0x71, 0x0a, 0x90, 0x12, 0x4f, 0x12, 0xab, 0x01, 0xb2, 0x53, 0xbf, 0xe7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0x9f, 0xdf, 0x6d, 0x2a, 0xed, 0x09, 0x71, 0x0a, 0x71, 0x02, 0x91, 0x02, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x91, 0x02, 0x71, 0x02, 0x91, 0x02, 0x91, 0x02, 0x91, 0x02, 0x91, 0x02, 0x91, 0x02, 0x71, 0x02, 0x71, 0x02, 0x70, 0x02, 0x70, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x71, 0x0a, 0x71, 0x0a, 0x71, 0x0a, 0x71, 0x0a, 0x71, 0x0a, 0x71, 0x0a, 0x71, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x71, 0x0a, 0x71, 0x0a, 0x91, 0x0a, 0x91, 0x0a, 0x71, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x0a, 0x71, 0x0a, 0x71, 0x02, 0x71, 0x0a, 0x70, 0x0a, 0x6f, 0x12, 0x6e, 0x12, 0xca, 0x09, 0x77, 0x95, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x95, 0x74, 0xec, 0x11, 0x6f, 0x12, 0x50, 0x02, 0x91, 0x0a, 0x71, 0x02, 0x71, 0x02, 0x91, 0x0a, 0x71, 0x02, 0x70, 0x0a, 0x4e, 0x12, 0x4d, 0x1a, 0xf6, 0x84, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xef, 0xff, 0xef, 0xff, 0xef, 0xff, 0xe7, 0xdf, 0xdf, 0xdf, 0xdf, 0xff, 0xd7, 0xdf, 0xae, 0xac, 0x01, 0x70, 0x0a, 0x50, 0x02, 0x71, 0x02, 0x50, 0x02, 0x70, 0x0a, 0x70, 0x0a, 0x70, 0x02, 0x70, 0x0a, 0x4f, 0x0a, 0x6e, 0x22, 0x78, 0x9d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x53, 0x74, 0xec, 0x11, 0x4f, 0x12, 0x70, 0x0a, 0x91, 0x0a, 0x92, 0x0a, 0x71, 0x02, 0x71, 0x02, 0x91, 0x0a, 0xb1, 0x0a, 0x4f, 0x0a, 0x6f, 0x12, 0x29, 0x01, 0xff, 0xef, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xdd, 0xc6, 0xce, 0x2a, 0x2e, 0x02, 0x91, 0x0a, 0x71, 0x02, 0x70, 0x02, 0x91, 0x0a, 0x91, 0x02, 0x91, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x0a, 0x0d, 0x12, 0x0f, 0x3b, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xe7, 0x7c, 0xa6, 0x55, 0x4c, 0xd7, 0x4c, 0xb7, 0x44, 0xf8, 0x4c, 0xb7, 0x44, 0xd7, 0x4c, 0xd7, 0x4c, 0xd7, 0x4c, 0xd7, 0x4c, 0xd6, 0x4c, 0xd6, 0x44, 0xd6, 0x44, 0xd6, 0x44, 0xd6, 0x44, 0xd6, 0x44, 0xf6, 0x44, 0xf7, 0x44, 0xf7, 0x44, 0xf7, 0x44, 0xf6, 0x44, 0xf6, 0x44, 0xf6, 0x44, 0xd6, 0x44, 0xf6, 0x4c, 0xd6, 0x54, 0x73, 0x54, 0x3e, 0xc7, 0xff, 0xef, 0xff, 0xff, 0xff, 0xf7, 0xfd, 0xce, 0x49, 0x01, 0x4f, 0x12, 0x70, 0x0a, 0x70, 0x0a, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x91, 0x0a, 0x51, 0x02, 0x71, 0x0a, 0x6f, 0x12, 0x6a, 0x01, 0xfa, 0xa5, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x91, 0x53, 0xab, 0x09, 0x2f, 0x0a, 0x71, 0x0a, 0x91, 0x0a, 0x71, 0x02, 0x92, 0x0a, 0x50, 0x02, 0x71, 0x0a, 0xb1, 0x12, 0x4f, 0x0a, 0x8f, 0x22, 0xba, 0x95, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xef, 0xff, 0xef, 0xff, 0xef, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0xdf, 0xfb, 0x8d, 0xed, 0x01, 0x70, 0x0a, 0x71, 0x0a, 0x70, 0x0a, 0x71, 0x0a, 0x71, 0x0a, 0x71, 0x02, 0x70, 0x02, 0x70, 0x0a, 0x2f, 0x0a, 0xaf, 0x22, 0x1a, 0xae, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x54, 0x6c, 0xac, 0x01, 0x50, 0x12, 0x70, 0x0a, 0x70, 0x02, 0x71, 0x02, 0x91, 0x02, 0x70, 0x02, 0x91, 0x0a, 0x91, 0x02, 0xb2, 0x0a, 0x30, 0x02, 0x50, 0x0a, 0x4f, 0x0a, 0x2f, 0x0a, 0x70, 0x0a, 0xb1, 0x0a, 0x71, 0x02, 0x70, 0x02, 0x71, 0x0a, 0x71, 0x02, 0x71, 0x02, 0x70, 0x0a, 0x2e, 0x0a, 0xec, 0x11, 0x34, 0x64, 0xff, 0xef, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0x9f, 0xdf, 0x49, 0x01, 0x6f, 0x12, 0x50, 0x02, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x71, 0x0a, 0x71, 0x02, 0x90, 0x02, 0x91, 0x02, 0x91, 0x02, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x71, 0x0a, 0x71, 0x0a, 0x71, 0x0a, 0x71, 0x0a, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x91, 0x0a, 0x91, 0x0a, 0x70, 0x0a, 0x50, 0x02, 0x90, 0x0a, 0x4f, 0x12, 0x0d, 0x12, 0xea, 0x11, 0x7b, 0xae, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xcb, 0x11, 0xed, 0x11, 0x50, 0x0a, 0x51, 0x02, 0x92, 0x0a, 0x71, 0x02, 0x91, 0x02, 0x71, 0x02, 0x91, 0x02, 0x70, 0x0a, 0x2e, 0x0a, 0xef, 0x2a, 0xdd, 0xbe, 0xff, 0xef, 0xdf, 0xe7, 0xbf, 0xe7, 0xdf, 0xe7, 0xbf, 0xe7, 0x9f, 0xdf, 0x9f, 0xdf, 0x3e, 0xcf, 0x9c, 0xb6, 0x1b, 0xa6, 0x99, 0x8d, 0xd6, 0x74, 0x33, 0x5c, 0xef, 0x32, 0x8e, 0x2a, 0xec, 0x11, 0xab, 0x01, 0xcc, 0x01, 0x2f, 0x02, 0x91, 0x0a, 0xb2, 0x0a, 0x71, 0x02, 0x50, 0x02, 0x70, 0x0a, 0x70, 0x0a, 0x90, 0x02, 0x90, 0x0a, 0x4f, 0x0a, 0x8e, 0x22, 0xd9, 0xa5, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xf2, 0x63, 0xab, 0x09, 0x6f, 0x12, 0x70, 0x0a, 0x91, 0x0a, 0x92, 0x02, 0x71, 0x02, 0x71, 0x02, 0x91, 0x0a, 0x70, 0x0a, 0x6f, 0x12, 0xab, 0x01, 0x34, 0x64, 0xff, 0xf7, 0xdf, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xc6, 0xee, 0x32, 0x2e, 0x0a, 0x71, 0x0a, 0x71, 0x02, 0x71, 0x02, 0x91, 0x0a, 0x71, 0x02, 0x91, 0x02, 0x70, 0x02, 0x70, 0x0a, 0x6f, 0x12, 0xec, 0x09, 0x91, 0x4b, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xdf, 0xdf, 0xfb, 0x85, 0xb7, 0x4c, 0x3a, 0x4d, 0x5b, 0x45, 0x3a, 0x45, 0x5a, 0x45, 0x5a, 0x45, 0x5a, 0x45, 0x5a, 0x45, 0x5a, 0x45, 0x5a, 0x45, 0x5a, 0x45, 0x5a, 0x45, 0x5a, 0x45, 0x5a, 0x45, 0x5a, 0x3d, 0x5a, 0x3d, 0x7a, 0x3d, 0x7b, 0x3d, 0x7a, 0x3d, 0x7a, 0x3d, 0x7a, 0x3d, 0x7a, 0x3d, 0x5a, 0x3d, 0x59, 0x45, 0x17, 0x4d, 0x94, 0x54, 0xff, 0xdf, 0xff, 0xef, 0xff, 0xef, 0xff, 0xf7, 0x5b, 0xb6, 0x8a, 0x01, 0x4f, 0x12, 0x50, 0x0a, 0x71, 0x0a, 0x71, 0x02, 0x71, 0x02, 0x91, 0x0a, 0x51, 0x02, 0x51, 0x02, 0x50, 0x0a, 0x4f, 0x12, 0xec, 0x11, 0x7b, 0xb6, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x48, 0x09, 0x8f, 0x22, 0x0f, 0x0a, 0x71, 0x0a, 0x51, 0x02, 0x71, 0x02, 0x91, 0x02, 0x51, 0x02, 0x72, 0x0a, 0x51, 0x0a, 0x2f, 0x0a, 0x32, 0x33, 0x3f, 0xbf, 0xff, 0xe7, 0xdf, 0xe7, 0xff, 0xef, 0xdf, 0xe7, 0xdf, 0xdf, 0xbf, 0xdf, 0x9f, 0xd7, 0x3e, 0xcf, 0x9c, 0xbe, 0xda, 0xa5, 0x58, 0x95, 0xd6, 0x74, 0xd2, 0x53, 0xef, 0x32, 0x4c, 0x22, 0xca, 0x11, 0xcb, 0x09, 0xac, 0x01, 0x6f, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x50, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x2e, 0x0a, 0xd0, 0x2a, 0x5c, 0xb6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xf2, 0x5b, 0xed, 0x09, 0x70, 0x0a, 0x70, 0x0a, 0x70, 0x02, 0x91, 0x02, 0x71, 0x02, 0x90, 0x02, 0x70, 0x02, 0xb1, 0x0a, 0x71, 0x02, 0x51, 0x02, 0x92, 0x0a, 0x71, 0x02, 0xb2, 0x12, 0x71, 0x02, 0x71, 0x02, 0x70, 0x02, 0x91, 0x0a, 0x71, 0x02, 0x51, 0x02, 0xb2, 0x12, 0x50, 0x0a, 0x6e, 0x12, 0xd6, 0x6c, 0xff, 0xef, 0xff, 0xf7, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xdd, 0xbe, 0x49, 0x01, 0x70, 0x0a, 0x91, 0x0a, 0x70, 0x02, 0x71, 0x02, 0x51, 0x0a, 0x71, 0x0a, 0x70, 0x0a, 0x90, 0x02, 0x91, 0x02, 0x91, 0x02, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x71, 0x0a, 0x71, 0x0a, 0x71, 0x0a, 0x71, 0x0a, 0x91, 0x0a, 0x91, 0x0a, 0x91, 0x02, 0x71, 0x02, 0x71, 0x02, 0x91, 0x02, 0x91, 0x02, 0x91, 0x02, 0x91, 0x02, 0x91, 0x02, 0x90, 0x02, 0x70, 0x02, 0x70, 0x0a, 0x71, 0x0a, 0x71, 0x0a, 0x91, 0x0a, 0x71, 0x02, 0x71, 0x02, 0x70, 0x02, 0x90, 0x02, 0x90, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x4f, 0x0a, 0x4f, 0x0a, 0x4e, 0x12, 0xec, 0x09, 0xce, 0x32, 0x1e, 0xc7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xef, 0x29, 0x01, 0x2f, 0x12, 0x71, 0x12, 0x51, 0x02, 0x72, 0x02, 0x71, 0x02, 0x91, 0x0a, 0x91, 0x02, 0x91, 0x02, 0x50, 0x02, 0x70, 0x0a, 0x11, 0x2b, 0xba, 0x8d, 0xda, 0x95, 0xd6, 0x6c, 0x34, 0x5c, 0x92, 0x43, 0xaf, 0x2a, 0x2c, 0x1a, 0xcb, 0x11, 0x8b, 0x09, 0xab, 0x01, 0xac, 0x01, 0xac, 0x01, 0xac, 0x01, 0xcd, 0x01, 0x0e, 0x0a, 0x0e, 0x0a, 0x2f, 0x0a, 0x4f, 0x0a, 0x70, 0x0a, 0x91, 0x0a, 0x50, 0x02, 0x50, 0x02, 0x71, 0x02, 0x51, 0x02, 0x71, 0x02, 0x91, 0x02, 0x91, 0x02, 0x91, 0x0a, 0x4f, 0x0a, 0xaf, 0x2a, 0x3a, 0xae, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xe7, 0x71, 0x53, 0xcc, 0x01, 0x70, 0x0a, 0x70, 0x02, 0x91, 0x0a, 0x71, 0x02, 0x72, 0x02, 0x91, 0x02, 0x70, 0x02, 0x70, 0x0a, 0x4e, 0x12, 0x49, 0x01, 0xdf, 0xdf, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbc, 0xbe, 0xee, 0x32, 0x2e, 0x0a, 0x51, 0x02, 0x71, 0x0a, 0x71, 0x02, 0x72, 0x02, 0x71, 0x02, 0x91, 0x02, 0x90, 0x02, 0x70, 0x0a, 0x6f, 0x12, 0xec, 0x11, 0xf2, 0x63, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xef, 0xdf, 0xd7, 0x58, 0x6d, 0xf9, 0x44, 0x5b, 0x45, 0x7c, 0x3d, 0x5b, 0x35, 0x7b, 0x3d, 0x7b, 0x3d, 0x7b, 0x3d, 0x7c, 0x3d, 0x7c, 0x3d, 0x7c, 0x3d, 0x7c, 0x3d, 0x7b, 0x3d, 0x7b, 0x3d, 0x7b, 0x3d, 0x7b, 0x3d, 0x7c, 0x35, 0x7c, 0x35, 0x7d, 0x35, 0x7c, 0x35, 0x7c, 0x35, 0x7b, 0x3d, 0x5b, 0x35, 0x5b, 0x35, 0x5b, 0x45, 0x18, 0x4d, 0xf6, 0x64, 0xff, 0xdf, 0xff, 0xef, 0xff, 0xf7, 0xff, 0xef, 0xf6, 0x84, 0xab, 0x09, 0x6f, 0x12, 0x50, 0x0a, 0x71, 0x02, 0x71, 0x02, 0x91, 0x0a, 0x91, 0x02, 0x51, 0x02, 0x51, 0x0a, 0x50, 0x0a, 0x0e, 0x12, 0xcf, 0x32, 0xdd, 0xc6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xe7, 0x28, 0x01, 0x6f, 0x1a, 0x70, 0x12, 0x30, 0x02, 0x71, 0x0a, 0x71, 0x02, 0x71, 0x02, 0x92, 0x0a, 0x51, 0x02, 0x92, 0x0a, 0x50, 0x02, 0x53, 0x2b, 0x3d, 0x96, 0xdb, 0x8d, 0xb5, 0x6c, 0x33, 0x5c, 0x50, 0x3b, 0xce, 0x2a, 0x2c, 0x12, 0xaa, 0x09, 0x8a, 0x01, 0x8a, 0x09, 0xab, 0x09, 0xac, 0x09, 0xcd, 0x09, 0xcd, 0x01, 0xee, 0x01, 0x4f, 0x12, 0x2f, 0x0a, 0x4f, 0x0a, 0x71, 0x0a, 0xb2, 0x0a, 0x71, 0x02, 0x71, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x2e, 0x0a, 0xd0, 0x2a, 0xbd, 0xc6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1e, 0xcf, 0x70, 0x43, 0x2e, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x70, 0x02, 0x71, 0x02, 0x71, 0x02, 0x70, 0x02, 0xb1, 0x0a, 0x50, 0x02, 0x31, 0x02, 0x92, 0x0a, 0x72, 0x02, 0x92, 0x02, 0x51, 0x02, 0x71, 0x02, 0x71, 0x02, 0x91, 0x02, 0x50, 0x02, 0x71, 0x0a, 0x92, 0x0a, 0x50, 0x0a, 0x70, 0x12, 0x4e, 0x12, 0xd2, 0x53, 0xff, 0xef, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x58, 0x8d, 0xcc, 0x01, 0x2f, 0x02, 0xb1, 0x0a, 0x70, 0x02, 0x70, 0x0a, 0x51, 0x0a, 0x71, 0x0a, 0x70, 0x0a, 0x90, 0x02, 0x91, 0x02, 0x91, 0x02, 0x91, 0x0a, 0x71, 0x0a, 0x71, 0x0a, 0x70, 0x02, 0x70, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x71, 0x02, 0x91, 0x02, 0x91, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x92, 0x0a, 0x91, 0x0a, 0x91, 0x0a, 0x70, 0x0a, 0x4f, 0x0a, 0x4f, 0x0a, 0x4f, 0x0a, 0x2e, 0x0a, 0x0d, 0x12, 0x4d, 0x1a, 0x95, 0x6c, 0xff, 0xe7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xf7, 0xff, 0xff, 0x7c, 0xb6, 0x49, 0x01, 0x90, 0x1a, 0x71, 0x0a, 0x30, 0x02, 0x92, 0x0a, 0x51, 0x02, 0x71, 0x02, 0xb2, 0x0a, 0x71, 0x02, 0x91, 0x02, 0x90, 0x0a, 0x4f, 0x0a, 0xed, 0x01, 0xab, 0x01, 0xed, 0x01, 0xed, 0x01, 0x0d, 0x02, 0x0e, 0x0a, 0x0d, 0x0a, 0x2e, 0x12, 0x4f, 0x12, 0x2f, 0x0a, 0x4f, 0x0a, 0x70, 0x0a, 0x70, 0x12, 0x70, 0x0a, 0x50, 0x0a, 0x2f, 0x02, 0x91, 0x0a, 0x91, 0x0a, 0x71, 0x0a, 0x91, 0x0a, 0x30, 0x02, 0x71, 0x0a, 0x71, 0x0a, 0x71, 0x02, 0x91, 0x02, 0x91, 0x02, 0x91, 0x02, 0x90, 0x0a, 0x2e, 0x0a, 0xcf, 0x32, 0x9c, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbd, 0xbe, 0xf0, 0x3a, 0x0e, 0x0a, 0x70, 0x0a, 0x70, 0x02, 0x91, 0x02, 0x71, 0x02, 0x92, 0x02, 0x91, 0x02, 0x70, 0x02, 0x90, 0x12, 0x0d, 0x0a, 0xaa, 0x11, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7b, 0xb6, 0xce, 0x2a, 0x2e, 0x0a, 0x51, 0x02, 0x72, 0x0a, 0x72, 0x02, 0x71, 0x02, 0x91, 0x02, 0x90, 0x02, 0x90, 0x02, 0x70, 0x02, 0x4f, 0x12, 0xec, 0x11, 0xb5, 0x7c, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xef, 0x9f, 0xc7, 0xf7, 0x5c, 0x1a, 0x45, 0x7c, 0x3d, 0x7d, 0x35, 0x9c, 0x35, 0x9c, 0x35, 0x9c, 0x35, 0x9c, 0x35, 0x9c, 0x35, 0x9d, 0x35, 0x7d, 0x35, 0x7d, 0x35, 0x9d, 0x35, 0x9c, 0x35, 0x7c, 0x35, 0x7c, 0x35, 0x7d, 0x35, 0x7d, 0x35, 0x7e, 0x35, 0x7d, 0x35, 0x7d, 0x35, 0x7c, 0x35, 0x9d, 0x35, 0x7c, 0x3d, 0x5b, 0x3d, 0xf8, 0x44, 0xd9, 0x85, 0xff, 0xef, 0xff, 0xef, 0xff, 0xf7, 0x9f, 0xdf, 0xb2, 0x53, 0xcc, 0x09, 0x70, 0x12, 0x70, 0x0a, 0x51, 0x02, 0x91, 0x0a, 0x71, 0x02, 0x70, 0x02, 0x91, 0x0a, 0x51, 0x0a, 0x71, 0x12, 0xee, 0x09, 0xd3, 0x53, 0x5f, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xd9, 0xa5, 0x8a, 0x09, 0x4f, 0x12, 0x50, 0x0a, 0x51, 0x02, 0x92, 0x0a, 0x50, 0x02, 0x91, 0x0a, 0x71, 0x02, 0x92, 0x0a, 0x71, 0x02, 0x71, 0x02, 0x50, 0x0a, 0xac, 0x01, 0xab, 0x01, 0x0c, 0x0a, 0xcc, 0x01, 0x0d, 0x02, 0x2e, 0x02, 0x4e, 0x0a, 0x6f, 0x12, 0x6f, 0x12, 0x4f, 0x12, 0x2f, 0x0a, 0x2f, 0x0a, 0x71, 0x0a, 0x51, 0x0a, 0x71, 0x0a, 0x91, 0x0a, 0x91, 0x0a, 0x50, 0x02, 0xb2, 0x0a, 0x50, 0x02, 0x71, 0x02, 0x71, 0x02, 0x70, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x6f, 0x0a, 0x2e, 0x0a, 0xcf, 0x32, 0x1f, 0xd7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x5b, 0xae, 0xce, 0x2a, 0x2e, 0x0a, 0x70, 0x0a, 0x90, 0x0a, 0x90, 0x0a, 0x71, 0x02, 0x91, 0x02, 0x91, 0x0a, 0x70, 0x02, 0x50, 0x02, 0x92, 0x0a, 0x52, 0x02, 0x92, 0x02, 0x72, 0x02, 0x92, 0x02, 0x91, 0x02, 0x71, 0x02, 0x91, 0x0a, 0x71, 0x0a, 0x51, 0x02, 0x71, 0x0a, 0x71, 0x0a, 0x6f, 0x0a, 0x2d, 0x0a, 0x8d, 0x22, 0x1a, 0xae, 0xff, 0xff, 0xdf, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xdf, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xef, 0x34, 0x5c, 0xac, 0x01, 0xb1, 0x12, 0x50, 0x02, 0x70, 0x0a, 0x70, 0x0a, 0x51, 0x0a, 0x71, 0x0a, 0x70, 0x0a, 0x90, 0x02, 0x91, 0x02, 0x91, 0x02, 0x71, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x51, 0x02, 0x51, 0x0a, 0x51, 0x02, 0x51, 0x02, 0x91, 0x0a, 0x90, 0x0a, 0x4f, 0x0a, 0x2e, 0x0a, 0x2e, 0x1a, 0x6e, 0x22, 0xf3, 0x5b, 0x1e, 0xc7, 0xff, 0xef, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x57, 0x95, 0xab, 0x09, 0x4f, 0x0a, 0x91, 0x0a, 0x51, 0x02, 0xb2, 0x0a, 0x71, 0x02, 0x50, 0x02, 0x71, 0x0a, 0x51, 0x02, 0x92, 0x02, 0x71, 0x02, 0x70, 0x0a, 0x6f, 0x0a, 0x6f, 0x12, 0xb0, 0x12, 0x4f, 0x02, 0x90, 0x0a, 0x90, 0x0a, 0x6f, 0x0a, 0x4f, 0x0a, 0x70, 0x0a, 0x90, 0x0a, 0x90, 0x0a, 0x70, 0x02, 0x70, 0x0a, 0x90, 0x0a, 0x70, 0x02, 0x70, 0x02, 0x91, 0x02, 0x70, 0x02, 0x91, 0x0a, 0x50, 0x02, 0x90, 0x0a, 0x4f, 0x0a, 0x91, 0x0a, 0x71, 0x02, 0x91, 0x02, 0x91, 0x02, 0x70, 0x02, 0x6f, 0x0a, 0x0d, 0x0a, 0xf0, 0x3a, 0x3f, 0xd7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x99, 0x95, 0x6e, 0x22, 0x4f, 0x0a, 0x70, 0x02, 0x70, 0x02, 0x91, 0x02, 0x71, 0x02, 0x92, 0x02, 0x91, 0x02, 0x90, 0x0a, 0x4f, 0x0a, 0xcc, 0x09, 0xf2, 0x63, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x97, 0x95, 0x8d, 0x22, 0x2f, 0x0a, 0x51, 0x0a, 0x72, 0x02, 0x71, 0x02, 0x71, 0x02, 0x91, 0x02, 0x90, 0x02, 0x90, 0x02, 0x70, 0x0a, 0x4f, 0x12, 0xab, 0x09, 0x1b, 0xae, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xef, 0x3e, 0xb7, 0x96, 0x44, 0x7b, 0x4d, 0x5c, 0x3d, 0x7d, 0x35, 0x5c, 0x2d, 0x9c, 0x35, 0x9c, 0x35, 0x9c, 0x35, 0x7c, 0x35, 0x7d, 0x35, 0x7d, 0x35, 0x7d, 0x35, 0x7d, 0x35, 0x7d, 0x35, 0x7c, 0x35, 0x7c, 0x35, 0x7d, 0x35, 0x7d, 0x35, 0x7d, 0x2d, 0x7d, 0x35, 0x5c, 0x35, 0x5c, 0x35, 0x5c, 0x35, 0x7d, 0x3d, 0x7c, 0x45, 0xd7, 0x44, 0x7b, 0xa6, 0xff, 0xef, 0xff, 0xf7, 0xff, 0xf7, 0x5f, 0xd7, 0x8d, 0x2a, 0x2d, 0x12, 0x70, 0x0a, 0x51, 0x0a, 0x71, 0x0a, 0x91, 0x0a, 0x70, 0x02, 0x70, 0x02, 0x71, 0x0a, 0x71, 0x0a, 0x71, 0x12, 0xac, 0x09, 0xd7, 0x7c, 0xdf, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xf7, 0xf2, 0x63, 0x0d, 0x12, 0x6f, 0x12, 0x71, 0x0a, 0x71, 0x02, 0x51, 0x02, 0x91, 0x02, 0x71, 0x02, 0x50, 0x02, 0x71, 0x02, 0x91, 0x0a, 0x70, 0x02, 0x91, 0x0a, 0x90, 0x0a, 0x90, 0x0a, 0x4f, 0x0a, 0x90, 0x0a, 0x90, 0x0a, 0x90, 0x0a, 0x70, 0x0a, 0x50, 0x0a, 0x50, 0x0a, 0x50, 0x0a, 0x71, 0x0a, 0x91, 0x0a, 0x91, 0x0a, 0x71, 0x02, 0x91, 0x0a, 0x50, 0x02, 0xb1, 0x0a, 0x90, 0x0a, 0x90, 0x02, 0x91, 0x02, 0x91, 0x02, 0x91, 0x02, 0x71, 0x02, 0x70, 0x0a, 0x71, 0x0a, 0x70, 0x02, 0x70, 0x0a, 0x6f, 0x0a, 0x0d, 0x0a, 0xef, 0x3a, 0xbf, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x98, 0x8d, 0x4c, 0x12, 0x4e, 0x0a, 0x70, 0x02, 0x70, 0x0a, 0x91, 0x0a, 0x71, 0x02, 0x92, 0x0a, 0x71, 0x0a, 0x71, 0x02, 0x71, 0x0a, 0x71, 0x0a, 0x51, 0x02, 0x72, 0x02, 0x92, 0x02, 0x91, 0x02, 0x50, 0x02, 0x91, 0x0a, 0x51, 0x0a, 0x51, 0x02, 0x72, 0x0a, 0x51, 0x0a, 0x50, 0x0a, 0x6f, 0x0a, 0x4f, 0x0a, 0x0d, 0x0a, 0x91, 0x4b, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xe7, 0xcf, 0x2a, 0x0e, 0x0a, 0x90, 0x0a, 0x90, 0x02, 0x70, 0x02, 0x70, 0x0a, 0x71, 0x0a, 0x71, 0x0a, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x71, 0x0a, 0x4f, 0x0a, 0x4f, 0x0a, 0x4f, 0x0a, 0x4f, 0x0a, 0x2e, 0x0a, 0x2e, 0x0a, 0x2e, 0x0a, 0x2e, 0x0a, 0x2e, 0x0a, 0x2e, 0x0a, 0x2e, 0x0a, 0x2e, 0x0a, 0x2e, 0x0a, 0x2e, 0x02, 0x2e, 0x02, 0x2e, 0x02, 0x70, 0x0a, 0x70, 0x0a, 0x71, 0x0a, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x51, 0x02, 0x50, 0x02, 0x71, 0x0a, 0x50, 0x02, 0x71, 0x0a, 0x71, 0x12, 0x4f, 0x12, 0xd0, 0x2a, 0xf7, 0x7c, 0x3f, 0xcf, 0xff, 0xef, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x91, 0x5b, 0xcc, 0x09, 0x6f, 0x12, 0x91, 0x0a, 0x91, 0x02, 0x50, 0x02, 0x91, 0x0a, 0x70, 0x0a, 0x71, 0x0a, 0x91, 0x0a, 0x92, 0x02, 0x91, 0x02, 0x71, 0x02, 0x50, 0x02, 0x70, 0x0a, 0x70, 0x02, 0xb1, 0x0a, 0x70, 0x02, 0x70, 0x02, 0x70, 0x0a, 0x70, 0x0a, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x0a, 0x70, 0x0a, 0x4f, 0x0a, 0x6f, 0x02, 0x90, 0x0a, 0x70, 0x02, 0x91, 0x02, 0x70, 0x02, 0x91, 0x0a, 0x6f, 0x0a, 0x6f, 0x12, 0x70, 0x0a, 0x70, 0x0a, 0x70, 0x02, 0x70, 0x0a, 0x6f, 0x0a, 0x4e, 0x12, 0xcc, 0x11, 0x0f, 0x43, 0xbf, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xd6, 0x74, 0x0d, 0x0a, 0x4f, 0x0a, 0x71, 0x02, 0x91, 0x02, 0x71, 0x02, 0x92, 0x02, 0x71, 0x02, 0x70, 0x02, 0x91, 0x0a, 0x4f, 0x0a, 0x8b, 0x01, 0xb9, 0x9d, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x94, 0x74, 0x0c, 0x12, 0x4f, 0x0a, 0x72, 0x0a, 0x71, 0x02, 0x72, 0x02, 0x92, 0x02, 0x71, 0x02, 0x90, 0x02, 0x70, 0x02, 0x70, 0x0a, 0x4f, 0x12, 0x8a, 0x09, 0x7f, 0xd7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xdf, 0xfe, 0xa6, 0xd7, 0x4c, 0x5b, 0x45, 0x7c, 0x3d, 0x7d, 0x35, 0x9d, 0x35, 0x7c, 0x35, 0x7c, 0x35, 0x7c, 0x35, 0x7d, 0x35, 0x7d, 0x35, 0x7d, 0x35, 0x7d, 0x35, 0x7d, 0x35, 0x7c, 0x35, 0x7c, 0x35, 0x7c, 0x35, 0x7c, 0x35, 0x7d, 0x35, 0x7d, 0x35, 0x7d, 0x35, 0x7c, 0x3d, 0x7c, 0x3d, 0x7c, 0x35, 0x5c, 0x35, 0x5b, 0x45, 0xd8, 0x4c, 0x3e, 0xbf, 0xff, 0xef, 0xff, 0xf7, 0xff, 0xf7, 0x1f, 0xc7, 0x8a, 0x01, 0x4e, 0x12, 0x70, 0x0a, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x91, 0x0a, 0x91, 0x02, 0x50, 0x02, 0x71, 0x0a, 0x50, 0x12, 0x6b, 0x01, 0xba, 0x9d, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xef, 0x42, 0xcc, 0x09, 0x70, 0x0a, 0x50, 0x02, 0x71, 0x02, 0x92, 0x0a, 0x70, 0x02, 0x71, 0x02, 0x71, 0x02, 0x91, 0x0a, 0x50, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x90, 0x0a, 0x70, 0x02, 0x91, 0x02, 0x91, 0x02, 0x71, 0x02, 0x70, 0x02, 0x50, 0x0a, 0x70, 0x0a, 0x71, 0x0a, 0x71, 0x0a, 0x71, 0x02, 0x71, 0x0a, 0x71, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x0a, 0x70, 0x0a, 0x4f, 0x02, 0x90, 0x0a, 0x90, 0x0a, 0x90, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x50, 0x0a, 0x50, 0x0a, 0x4f, 0x12, 0xec, 0x11, 0x0f, 0x43, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xd5, 0x74, 0xeb, 0x01, 0x6f, 0x0a, 0x70, 0x0a, 0x70, 0x02, 0x71, 0x0a, 0x71, 0x0a, 0x51, 0x02, 0x91, 0x0a, 0x50, 0x02, 0x50, 0x0a, 0x71, 0x0a, 0x51, 0x02, 0x91, 0x02, 0x91, 0x02, 0x71, 0x02, 0x70, 0x02, 0x70, 0x0a, 0x92, 0x12, 0x51, 0x0a, 0x72, 0x0a, 0x91, 0x0a, 0x4f, 0x02, 0x70, 0x0a, 0x90, 0x0a, 0x0d, 0x02, 0xae, 0x2a, 0xfa, 0xa5, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xbf, 0xdf, 0xac, 0x09, 0x0f, 0x0a, 0x70, 0x0a, 0x70, 0x02, 0x70, 0x02, 0xb1, 0x0a, 0x51, 0x02, 0x71, 0x02, 0x90, 0x0a, 0x6f, 0x02, 0x70, 0x0a, 0x4f, 0x0a, 0xb0, 0x22, 0xd0, 0x2a, 0x8f, 0x22, 0xcf, 0x2a, 0xaf, 0x22, 0xaf, 0x22, 0xcf, 0x2a, 0xaf, 0x2a, 0xaf, 0x2a, 0xaf, 0x2a, 0xaf, 0x2a, 0xaf, 0x2a, 0xaf, 0x2a, 0x8f, 0x22, 0xaf, 0x2a, 0xf1, 0x2a, 0x0e, 0x0a, 0x70, 0x12, 0x71, 0x0a, 0x71, 0x02, 0x91, 0x02, 0x91, 0x0a, 0x70, 0x0a, 0x91, 0x0a, 0x71, 0x0a, 0x91, 0x0a, 0x51, 0x02, 0x71, 0x0a, 0xcd, 0x01, 0xb7, 0x6c, 0xff, 0xe7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xee, 0x42, 0xec, 0x09, 0x6f, 0x0a, 0x70, 0x02, 0x91, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x0a, 0x90, 0x12, 0x71, 0x0a, 0x51, 0x02, 0x72, 0x02, 0x92, 0x0a, 0x71, 0x0a, 0x71, 0x0a, 0x91, 0x0a, 0x70, 0x02, 0x91, 0x0a, 0x4f, 0x02, 0x70, 0x0a, 0x70, 0x0a, 0x91, 0x0a, 0x71, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x4f, 0x0a, 0x4f, 0x0a, 0x4f, 0x0a, 0x4f, 0x0a, 0x50, 0x02, 0x50, 0x02, 0x90, 0x12, 0x2e, 0x0a, 0x0d, 0x0a, 0x2d, 0x0a, 0xec, 0x09, 0x0d, 0x0a, 0xec, 0x01, 0x2d, 0x0a, 0x4d, 0x1a, 0x2d, 0x1a, 0xeb, 0x21, 0xb1, 0x63, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x55, 0x64, 0xed, 0x01, 0x70, 0x0a, 0x70, 0x02, 0x70, 0x02, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x70, 0x02, 0x90, 0x0a, 0x4f, 0x0a, 0x6a, 0x01, 0x9c, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x91, 0x4b, 0x0c, 0x0a, 0x70, 0x0a, 0x71, 0x0a, 0x92, 0x0a, 0x71, 0x02, 0x91, 0x02, 0x91, 0x02, 0xb1, 0x02, 0x50, 0x02, 0x70, 0x0a, 0x2f, 0x12, 0x69, 0x09, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xd7, 0x7c, 0x8e, 0xf7, 0x44, 0x7b, 0x45, 0x5b, 0x35, 0x7c, 0x35, 0x7c, 0x3d, 0x7c, 0x3d, 0x7c, 0x3d, 0x7c, 0x3d, 0x7c, 0x3d, 0x7c, 0x3d, 0x7c, 0x3d, 0x7c, 0x35, 0x7c, 0x35, 0x7c, 0x35, 0x7c, 0x3d, 0x7c, 0x3d, 0x7c, 0x3d, 0x7c, 0x35, 0x9c, 0x35, 0x9c, 0x35, 0x7b, 0x3d, 0x7b, 0x3d, 0x7c, 0x3d, 0x5b, 0x3d, 0x3a, 0x45, 0xd7, 0x54, 0xff, 0xdf, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xef, 0x9d, 0xb6, 0x8a, 0x01, 0x6f, 0x0a, 0x70, 0x02, 0x91, 0x0a, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x0a, 0x0f, 0x12, 0xcc, 0x11, 0x1b, 0xa6, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xcb, 0x19, 0x2e, 0x12, 0x70, 0x0a, 0x71, 0x0a, 0x71, 0x02, 0x91, 0x02, 0x71, 0x02, 0x71, 0x02, 0x91, 0x0a, 0x70, 0x02, 0x91, 0x0a, 0xb1, 0x0a, 0x90, 0x0a, 0x70, 0x02, 0x90, 0x02, 0x91, 0x02, 0x91, 0x0a, 0x71, 0x02, 0x70, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x70, 0x12, 0x70, 0x0a, 0x71, 0x0a, 0x71, 0x0a, 0x71, 0x0a, 0x71, 0x12, 0x70, 0x12, 0x50, 0x0a, 0x2f, 0x0a, 0x2f, 0x0a, 0x2e, 0x0a, 0x2e, 0x0a, 0x2e, 0x0a, 0x2e, 0x0a, 0xed, 0x01, 0x0e, 0x0a, 0xed, 0x09, 0x0d, 0x0a, 0xed, 0x09, 0x4d, 0x1a, 0x0b, 0x1a, 0xf1, 0x63, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xf7, 0xff, 0xf7, 0x74, 0x64, 0xcb, 0x01, 0x6f, 0x0a, 0x70, 0x0a, 0x71, 0x0a, 0x51, 0x02, 0x51, 0x0a, 0x92, 0x0a, 0x51, 0x02, 0x71, 0x02, 0x91, 0x0a, 0x50, 0x02, 0x70, 0x02, 0x71, 0x02, 0x91, 0x02, 0x90, 0x02, 0x90, 0x0a, 0x50, 0x02, 0x71, 0x0a, 0x92, 0x0a, 0x72, 0x02, 0x92, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x70, 0x02, 0x70, 0x0a, 0xcc, 0x01, 0xf3, 0x53, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x7f, 0xd7, 0x4a, 0x01, 0x50, 0x12, 0x50, 0x02, 0x91, 0x0a, 0x70, 0x02, 0x91, 0x0a, 0x50, 0x02, 0x71, 0x02, 0x90, 0x0a, 0x6f, 0x0a, 0x2f, 0x0a, 0xd1, 0x2a, 0x9a, 0x8d, 0x5c, 0xa6, 0x5c, 0xae, 0x7c, 0xae, 0x5c, 0xae, 0x5c, 0xae, 0x5c, 0xae, 0x5b, 0xae, 0x3b, 0xae, 0x5c, 0xae, 0x5b, 0xae, 0x5c, 0xae, 0x5c, 0xb6, 0x5c, 0xae, 0x5c, 0xb6, 0x9e, 0xb6, 0xaf, 0x2a, 0x2f, 0x12, 0x70, 0x0a, 0x91, 0x0a, 0x91, 0x02, 0x50, 0x02, 0x91, 0x0a, 0x70, 0x02, 0x70, 0x0a, 0x71, 0x0a, 0x51, 0x02, 0x71, 0x0a, 0xee, 0x01, 0x31, 0x3b, 0xfe, 0xc6, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x2b, 0x22, 0x2e, 0x0a, 0x6f, 0x02, 0x90, 0x02, 0x90, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x0a, 0x50, 0x0a, 0x51, 0x0a, 0x51, 0x02, 0x92, 0x0a, 0x71, 0x02, 0x71, 0x0a, 0x70, 0x0a, 0x2f, 0x02, 0x91, 0x12, 0x4f, 0x0a, 0x70, 0x0a, 0x4f, 0x0a, 0x2f, 0x0a, 0x2f, 0x02, 0x0f, 0x02, 0x0e, 0x0a, 0x0e, 0x0a, 0xed, 0x09, 0xcc, 0x09, 0xcc, 0x09, 0x2d, 0x12, 0x0e, 0x12, 0x6f, 0x1a, 0x2e, 0x12, 0xb0, 0x2a, 0xf0, 0x32, 0x10, 0x3b, 0x30, 0x43, 0x71, 0x4b, 0xf3, 0x53, 0xf2, 0x53, 0x33, 0x64, 0xf6, 0x84, 0x57, 0x95, 0x7b, 0xc6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xe7, 0xf4, 0x53, 0xcd, 0x01, 0x70, 0x0a, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x71, 0x02, 0x71, 0x02, 0x70, 0x02, 0x70, 0x0a, 0x50, 0x0a, 0x6a, 0x01, 0x5f, 0xd7, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3e, 0xcf, 0x10, 0x33, 0x0d, 0x0a, 0x70, 0x0a, 0x71, 0x0a, 0x91, 0x02, 0x91, 0x02, 0x91, 0x02, 0x91, 0x02, 0xb1, 0x02, 0x91, 0x02, 0x50, 0x0a, 0x2e, 0x12, 0x6d, 0x32, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xd7, 0x57, 0x6d, 0xd6, 0x44, 0x38, 0x45, 0x39, 0x3d, 0x19, 0x3d, 0x19, 0x3d, 0x19, 0x3d, 0x1a, 0x3d, 0x1a, 0x3d, 0x1a, 0x3d, 0x19, 0x3d, 0x19, 0x3d, 0x39, 0x3d, 0x39, 0x3d, 0x39, 0x3d, 0x39, 0x3d, 0x39, 0x3d, 0x39, 0x3d, 0x39, 0x3d, 0x39, 0x3d, 0x39, 0x3d, 0x38, 0x3d, 0x18, 0x45, 0x39, 0x3d, 0x3a, 0x45, 0x19, 0x4d, 0x96, 0x54, 0xff, 0xe7, 0xff, 0xf7, 0xff, 0xf7, 0xdf, 0xe7, 0x79, 0x8d, 0x8b, 0x01, 0x6f, 0x0a, 0x50, 0x02, 0x71, 0x02, 0x91, 0x0a, 0x91, 0x0a, 0x70, 0x02, 0x71, 0x02, 0x91, 0x0a, 0x50, 0x0a, 0x2e, 0x12, 0x8e, 0x2a, 0x7c, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x69, 0x11, 0x4e, 0x12, 0x70, 0x0a, 0x71, 0x02, 0x71, 0x02, 0x91, 0x02, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x70, 0x02, 0x4f, 0x02, 0x4f, 0x02, 0x4f, 0x0a, 0xb1, 0x12, 0x70, 0x02, 0x91, 0x0a, 0x70, 0x02, 0x70, 0x0a, 0x4f, 0x0a, 0x2e, 0x12, 0x2e, 0x12, 0x2e, 0x12, 0x2e, 0x0a, 0x0e, 0x02, 0x0e, 0x02, 0xed, 0x09, 0xcd, 0x09, 0xcd, 0x09, 0xed, 0x11, 0x2e, 0x1a, 0x4e, 0x1a, 0x6e, 0x22, 0x8e, 0x2a, 0xcf, 0x32, 0x10, 0x3b, 0x71, 0x43, 0x51, 0x43, 0xd2, 0x53, 0x75, 0x6c, 0x95, 0x74, 0xf7, 0x84, 0x78, 0x95, 0x7b, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xdf, 0xb2, 0x4b, 0xec, 0x01, 0x90, 0x0a, 0x50, 0x02, 0x50, 0x02, 0x71, 0x0a, 0x72, 0x0a, 0x51, 0x02, 0x92, 0x02, 0x71, 0x02, 0x71, 0x02, 0x50, 0x02, 0x91, 0x0a, 0x91, 0x0a, 0x50, 0x02, 0x91, 0x0a, 0x70, 0x0a, 0x50, 0x0a, 0x71, 0x02, 0x71, 0x02, 0xb2, 0x0a, 0x71, 0x02, 0x90, 0x0a, 0x90, 0x0a, 0x70, 0x02, 0x90, 0x0a, 0x2e, 0x0a, 0x6e, 0x22, 0x1a, 0xa6, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x3b, 0xa6, 0x6b, 0x01, 0x91, 0x12, 0x71, 0x0a, 0x70, 0x02, 0x70, 0x02, 0x71, 0x02, 0x71, 0x02, 0x91, 0x02, 0x70, 0x02, 0x70, 0x0a, 0xed, 0x01, 0xb3, 0x4b, 0x5f, 0xcf, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x1c, 0xa6, 0x6a, 0x01, 0x4f, 0x0a, 0x70, 0x02, 0x91, 0x02, 0x91, 0x02, 0xb0, 0x0a, 0x6f, 0x02, 0x90, 0x0a, 0x70, 0x02, 0x72, 0x02, 0x71, 0x0a, 0x2f, 0x0a, 0x0d, 0x12, 0x78, 0x95, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa9, 0x11, 0x4e, 0x12, 0x70, 0x02, 0x90, 0x02, 0x90, 0x02, 0x90, 0x02, 0x90, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x71, 0x0a, 0x71, 0x0a, 0x71, 0x0a, 0x51, 0x0a, 0x0f, 0x0a, 0x2e, 0x0a, 0x0e, 0x0a, 0xcc, 0x01, 0xec, 0x09, 0xcc, 0x01, 0x0d, 0x12, 0x4e, 0x12, 0x6f, 0x1a, 0xd0, 0x2a, 0xf0, 0x32, 0x51, 0x43, 0x91, 0x4b, 0x91, 0x53, 0xd2, 0x5b, 0xf3, 0x63, 0x75, 0x74, 0x17, 0x85, 0x58, 0x8d, 0x1b, 0xa6, 0x5b, 0xb6, 0xfe, 0xce, 0x9f, 0xe7, 0xdf, 0xef, 0xff, 0xef, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xce, 0x51, 0x3b, 0xee, 0x01, 0x70, 0x0a, 0x71, 0x0a, 0x71, 0x02, 0x71, 0x02, 0x71, 0x0a, 0x71, 0x0a, 0x71, 0x02, 0x70, 0x0a, 0x50, 0x0a, 0x8b, 0x01, 0x7f, 0xd7, 0xdf, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x57, 0x8d, 0x6e, 0x1a, 0x2e, 0x02, 0x70, 0x0a, 0x51, 0x02, 0x71, 0x02, 0x71, 0x02, 0x91, 0x02, 0x71, 0x02, 0x70, 0x02, 0x90, 0x0a, 0x91, 0x12, 0xac, 0x09, 0xd6, 0x7c, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xbf, 0xd7, 0x57, 0x7d, 0x98, 0x75, 0xb9, 0x6d, 0xd9, 0x6d, 0xb9, 0x65, 0xb9, 0x6d, 0xba, 0x6d, 0x9a, 0x6d, 0x9a, 0x6d, 0x9a, 0x6d, 0xba, 0x6d, 0xb9, 0x6d, 0xb9, 0x6d, 0xb9, 0x6d, 0xba, 0x6d, 0xda, 0x6d, 0xba, 0x6d, 0xba, 0x6d, 0xba, 0x6d, 0xda, 0x6d, 0xda, 0x6d, 0xb9, 0x75, 0xb9, 0x75, 0xba, 0x6d, 0xba, 0x75, 0x58, 0x6d, 0xb9, 0x8d, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xf7, 0xbf, 0xe7, 0x14, 0x5c, 0xcd, 0x01, 0x70, 0x0a, 0x70, 0x02, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x91, 0x0a, 0x50, 0x0a, 0xed, 0x09, 0x71, 0x4b, 0xfe, 0xce, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x49, 0x09, 0x4e, 0x12, 0x70, 0x0a, 0x71, 0x02, 0x71, 0x02, 0x91, 0x02, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x91, 0x0a, 0x70, 0x0a, 0x70, 0x12, 0x2e, 0x0a, 0xed, 0x01, 0xee, 0x01, 0x2f, 0x0a, 0xcd, 0x01, 0xcd, 0x01, 0xec, 0x09, 0x0c, 0x1a, 0x2c, 0x22, 0x6d, 0x22, 0xae, 0x2a, 0x10, 0x33, 0x71, 0x3b, 0x71, 0x4b, 0x91, 0x5b, 0xd2, 0x5b, 0x14, 0x64, 0x96, 0x74, 0xf7, 0x7c, 0x58, 0x95, 0xd9, 0xa5, 0xbc, 0xbe, 0xdc, 0xc6, 0xbf, 0xdf, 0xdf, 0xe7, 0xff, 0xf7, 0xff, 0xef, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xef, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9c, 0xbe, 0x10, 0x33, 0x0d, 0x02, 0x70, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x71, 0x0a, 0x71, 0x0a, 0x51, 0x02, 0x71, 0x02, 0x91, 0x02, 0xb2, 0x0a, 0x91, 0x0a, 0x70, 0x02, 0x91, 0x0a, 0x50, 0x02, 0x4f, 0x02, 0x70, 0x0a, 0xb1, 0x12, 0x71, 0x02, 0x71, 0x02, 0x92, 0x02, 0x91, 0x02, 0x70, 0x02, 0x91, 0x0a, 0x91, 0x0a, 0x70, 0x0a, 0x6f, 0x0a, 0xec, 0x09, 0x13, 0x64, 0xdf, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0x95, 0x74, 0xac, 0x01, 0x50, 0x0a, 0x91, 0x0a, 0x70, 0x02, 0x91, 0x02, 0x70, 0x02, 0x71, 0x02, 0x91, 0x02, 0x70, 0x02, 0x90, 0x12, 0xcc, 0x01, 0x55, 0x64, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xef, 0xaa, 0x11, 0x2e, 0x0a, 0x70, 0x0a, 0x91, 0x02, 0xb1, 0x02, 0x70, 0x02, 0x90, 0x0a, 0x90, 0x0a, 0x91, 0x02, 0x92, 0x02, 0x71, 0x02, 0x70, 0x0a, 0xec, 0x09, 0xf2, 0x5b, 0xbf, 0xdf, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x88, 0x11, 0x4e, 0x12, 0x90, 0x02, 0x90, 0x02, 0x90, 0x02, 0x90, 0x02, 0x70, 0x02, 0x70, 0x0a, 0x70, 0x0a, 0x71, 0x0a, 0x71, 0x0a, 0x70, 0x0a, 0xf2, 0x22, 0xf1, 0x32, 0x51, 0x3b, 0x92, 0x4b, 0xd3, 0x53, 0x33, 0x64, 0x54, 0x6c, 0xb6, 0x74, 0x17, 0x85, 0x99, 0x95, 0x1b, 0xa6, 0xbd, 0xbe, 0x3f, 0xd7, 0xbf, 0xe7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xf9, 0xad, 0x8f, 0x22, 0x4f, 0x0a, 0x70, 0x0a, 0x71, 0x0a, 0x71, 0x0a, 0x71, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x71, 0x0a, 0x70, 0x0a, 0x70, 0x12, 0x4a, 0x01, 0xfe, 0xbe, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xe7, 0x91, 0x4b, 0x0d, 0x02, 0x50, 0x02, 0x70, 0x0a, 0x71, 0x0a, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x70, 0x02, 0x91, 0x0a, 0x70, 0x0a, 0x4f, 0x12, 0x09, 0x01, 0x9f, 0xdf, 0xdf, 0xf7, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xef, 0x5f, 0xcf, 0x9f, 0xc7, 0xbf, 0xc7, 0xbf, 0xc7, 0xbf, 0xc7, 0xbf, 0xc7, 0xbf, 0xcf, 0xbf, 0xc7, 0xbf, 0xc7, 0xbf, 0xcf, 0xbf, 0xcf, 0xbf, 0xcf, 0xbf, 0xcf, 0xbf, 0xc7, 0xbf, 0xc7, 0xbf, 0xc7, 0xbf, 0xc7, 0xbf, 0xc7, 0xbf, 0xcf, 0xbf, 0xcf, 0xbf, 0xc7, 0xbf, 0xcf, 0xbf, 0xcf, 0xbf, 0xcf, 0xbf, 0xcf, 0x5f, 0xc7, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xbf, 0xdf, 0xd0, 0x32, 0x0e, 0x0a, 0x90, 0x0a, 0x91, 0x0a, 0x91, 0x0a, 0x71, 0x02, 0x71, 0x02, 0x91, 0x0a, 0x91, 0x02, 0x91, 0x0a, 0x70, 0x12, 0xac, 0x09, 0x74, 0x6c, 0x9f, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x69, 0x09, 0x4e, 0x12, 0x70, 0x0a, 0x71, 0x02, 0x71, 0x02, 0x91, 0x02, 0x91, 0x02, 0x71, 0x02, 0x71, 0x02, 0x70, 0x02, 0x70, 0x0a, 0x6f, 0x12, 0xaf, 0x22, 0x11, 0x33, 0x72, 0x3b, 0x93, 0x43, 0xf4, 0x53, 0x34, 0x5c, 0x54, 0x6c, 0xb5, 0x7c, 0x36, 0x8d, 0x98, 0x9d, 0x1a, 0xa6, 0xbd, 0xb6, 0x3f, 0xcf, 0xbf, 0xe7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xb9, 0x9d, 0x6e, 0x1a, 0x2e, 0x0a, 0x50, 0x0a, 0x91, 0x0a, 0x91, 0x0a, 0x71, 0x0a, 0x51, 0x02, 0x71, 0x0a, 0x50, 0x02, 0x91, 0x0a, 0x50, 0x02, 0x70, 0x02, 0x70, 0x0a, 0x4f, 0x0a, 0x2e, 0x0a, 0x90, 0x1a, 0x4f, 0x0a, 0x2e, 0x02, 0xb1, 0x0a, 0x70, 0x02, 0x92, 0x02, 0xb2, 0x02, 0x50, 0x02, 0x71, 0x02, 0x91, 0x0a, 0x70, 0x0a, 0x6f, 0x0a, 0x2d, 0x0a, 0x4c, 0x22, 0xd9, 0xa5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0x0f, 0x3b, 0xed, 0x09, 0x50, 0x0a, 0x70, 0x02, 0x91, 0x02, 0x91, 0x0a, 0x71, 0x02, 0x71, 0x02, 0x70, 0x02, 0x70, 0x02, 0x6f, 0x12, 0xcc, 0x09, 0xd6, 0x7c, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xb5, 0x7c, 0x8a, 0x01, 0x90, 0x12, 0x70, 0x02, 0x91, 0x02, 0x70, 0x02, 0x90, 0x02, 0x70, 0x02, 0x91, 0x02, 0x71, 0x02, 0x71, 0x02, 0x91, 0x0a, 0x2e, 0x0a, 0x4c, 0x1a, 0x1a, 0xa6, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xc9, 0x19, 0x4e, 0x12, 0x90, 0x0a, 0x91, 0x02, 0x91, 0x02, 0x91, 0x02, 0x71, 0x02, 0x70, 0x02, 0x70, 0x0a, 0x50, 0x0a, 0x2f, 0x0a, 0x12, 0x2b, 0xfc, 0x95, 0x7d, 0xb6, 0x1e, 0xcf, 0x7f, 0xdf, 0xff, 0xef, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xdf, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0x37, 0x8d, 0xec, 0x11, 0x4f, 0x0a, 0x70, 0x0a, 0x71, 0x0a, 0x71, 0x0a, 0x71, 0x02, 0x70, 0x0a, 0x70, 0x0a, 0x71, 0x0a, 0x71, 0x0a, 0x70, 0x12, 0xac, 0x01, 0xba, 0x95, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xf7, 0xb9, 0x95, 0x6e, 0x22, 0x2e, 0x02, 0x91, 0x0a, 0x70, 0x0a, 0x71, 0x0a, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x70, 0x0a, 0x6f, 0x0a, 0x0e, 0x12, 0x0c, 0x22, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xef, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xef, 0xff, 0xef, 0xff, 0xef, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xef, 0xff, 0xef, 0xff, 0xef, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x7f, 0xd7, 0xab, 0x09, 0x4f, 0x12, 0x91, 0x0a, 0x70, 0x02, 0x70, 0x02, 0x71, 0x0a, 0x91, 0x0a, 0x71, 0x02, 0x92, 0x02, 0x71, 0x0a, 0x70, 0x12, 0x8a, 0x01, 0x36, 0x8d, 0xff, 0xf7, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x69, 0x09, 0x4e, 0x12, 0x90, 0x0a, 0x71, 0x02, 0x71, 0x02, 0x91, 0x02, 0x91, 0x02, 0x71, 0x02, 0x71, 0x02, 0x71, 0x0a, 0x2f, 0x0a, 0x11, 0x33, 0x7d, 0xae, 0x9d, 0xb6, 0x3f, 0xcf, 0x7f, 0xd7, 0xff, 0xe7, 0xff, 0xef, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xbf, 0xef, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xf7, 0x17, 0x85, 0xed, 0x09, 0x70, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x71, 0x0a, 0x71, 0x0a, 0x91, 0x0a, 0x71, 0x02, 0x71, 0x02, 0x91, 0x0a, 0x4f, 0x02, 0xb0, 0x12, 0x6f, 0x12, 0xab, 0x01, 0xf0, 0x32, 0x1c, 0x96, 0x6b, 0x01, 0x8f, 0x12, 0x70, 0x0a, 0x70, 0x02, 0x91, 0x02, 0x91, 0x02, 0x71, 0x02, 0x71, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x6f, 0x12, 0xcb, 0x09, 0xd2, 0x5b, 0xdf, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xaa, 0x11, 0x2e, 0x0a, 0x91, 0x0a, 0x70, 0x02, 0x70, 0x02, 0x71, 0x02, 0x71, 0x02, 0x91, 0x02, 0x70, 0x02, 0x70, 0x0a, 0x4f, 0x0a, 0x0c, 0x12, 0x58, 0x8d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xdf, 0x49, 0x01, 0x6f, 0x1a, 0x70, 0x0a, 0x71, 0x02, 0x71, 0x02, 0x70, 0x02, 0x70, 0x02, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x70, 0x02, 0x6f, 0x0a, 0xcb, 0x01, 0x94, 0x6c, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0a, 0x22, 0x2d, 0x12, 0x70, 0x0a, 0x71, 0x0a, 0x91, 0x02, 0x91, 0x02, 0x71, 0x02, 0x71, 0x02, 0x91, 0x0a, 0x70, 0x02, 0x2e, 0x02, 0x31, 0x33, 0x5f, 0xc7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xf7, 0xb5, 0x7c, 0xcb, 0x09, 0x4f, 0x0a, 0x70, 0x0a, 0x71, 0x0a, 0x72, 0x0a, 0x71, 0x02, 0x70, 0x0a, 0x70, 0x0a, 0x71, 0x0a, 0x51, 0x0a, 0x50, 0x0a, 0x2e, 0x12, 0x0f, 0x3b, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5f, 0xd7, 0x51, 0x43, 0xcc, 0x01, 0x70, 0x0a, 0xb1, 0x0a, 0x70, 0x02, 0x70, 0x0a, 0x71, 0x02, 0x71, 0x02, 0x71, 0x0a, 0x71, 0x0a, 0x70, 0x0a, 0x4e, 0x0a, 0xab, 0x01, 0xd6, 0x7c, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xfd, 0xc6, 0x4a, 0x01, 0x50, 0x12, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x71, 0x0a, 0x70, 0x0a, 0x71, 0x0a, 0x92, 0x02, 0x51, 0x02, 0x50, 0x12, 0xab, 0x09, 0xb8, 0x9d, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x89, 0x11, 0x4e, 0x12, 0x90, 0x0a, 0x91, 0x0a, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x91, 0x0a, 0x2f, 0x02, 0x11, 0x33, 0xff, 0xe7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5e, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xf7, 0x95, 0x74, 0xcd, 0x01, 0x71, 0x12, 0x70, 0x0a, 0x70, 0x0a, 0x50, 0x02, 0x71, 0x0a, 0x91, 0x0a, 0x71, 0x02, 0x91, 0x0a, 0x50, 0x0a, 0x70, 0x0a, 0x6f, 0x0a, 0xab, 0x01, 0x30, 0x3b, 0xbd, 0xbe, 0xff, 0xef, 0x51, 0x4b, 0x0d, 0x12, 0x4f, 0x0a, 0x90, 0x02, 0x91, 0x02, 0x91, 0x02, 0x71, 0x02, 0x71, 0x0a, 0x71, 0x0a, 0x70, 0x0a, 0x91, 0x0a, 0x70, 0x0a, 0x0e, 0x0a, 0x2d, 0x1a, 0xfa, 0xa5, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xbf, 0xdf, 0x48, 0x01, 0x6f, 0x12, 0x50, 0x02, 0x90, 0x02, 0x91, 0x02, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x70, 0x0a, 0x2e, 0x0a, 0xcf, 0x2a, 0x1b, 0xa6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0x91, 0x53, 0x0d, 0x12, 0x50, 0x0a, 0x51, 0x0a, 0x51, 0x0a, 0x71, 0x0a, 0x71, 0x0a, 0x71, 0x0a, 0x51, 0x02, 0x71, 0x02, 0x71, 0x02, 0x90, 0x0a, 0x2d, 0x0a, 0x30, 0x33, 0xdc, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee, 0x42, 0x0d, 0x12, 0x50, 0x0a, 0x50, 0x0a, 0x71, 0x0a, 0x92, 0x02, 0x72, 0x02, 0x71, 0x02, 0x91, 0x02, 0x91, 0x02, 0x6f, 0x0a, 0x2d, 0x12, 0xf6, 0x7c, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5a, 0xbe, 0xd1, 0x63, 0x5b, 0xbe, 0xff, 0xff, 0xdf, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xdf, 0xef, 0x32, 0x64, 0xcb, 0x09, 0x6f, 0x0a, 0x71, 0x0a, 0x72, 0x0a, 0x72, 0x0a, 0x72, 0x02, 0x70, 0x02, 0x70, 0x0a, 0x71, 0x0a, 0x51, 0x0a, 0x70, 0x0a, 0x2e, 0x0a, 0x49, 0x01, 0xff, 0xef, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x95, 0x74, 0x2e, 0x1a, 0x6f, 0x12, 0x90, 0x0a, 0x91, 0x02, 0x70, 0x02, 0x70, 0x0a, 0x71, 0x0a, 0x71, 0x02, 0x71, 0x0a, 0x50, 0x0a, 0x90, 0x12, 0x4e, 0x0a, 0x49, 0x01, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xf7, 0x1b, 0xa6, 0x6b, 0x01, 0x50, 0x12, 0x50, 0x02, 0x91, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x50, 0x0a, 0x71, 0x0a, 0x72, 0x02, 0x51, 0x0a, 0x2f, 0x12, 0x4d, 0x22, 0x39, 0xae, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x2c, 0x22, 0x2d, 0x0a, 0x70, 0x0a, 0x91, 0x0a, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x91, 0x02, 0x6f, 0x02, 0x6d, 0x1a, 0x16, 0x85, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x19, 0xb6, 0x6f, 0x53, 0xfd, 0xc6, 0xff, 0xf7, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x9f, 0xdf, 0xf3, 0x5b, 0xed, 0x01, 0x71, 0x0a, 0x50, 0x0a, 0x91, 0x0a, 0x71, 0x0a, 0x70, 0x02, 0x91, 0x0a, 0x91, 0x0a, 0x51, 0x02, 0x51, 0x0a, 0x70, 0x0a, 0xcb, 0x01, 0xd1, 0x53, 0x5e, 0xcf, 0xff, 0xff, 0xff, 0xff, 0x5f, 0xd7, 0x09, 0x01, 0x6f, 0x12, 0x70, 0x0a, 0x91, 0x0a, 0xb1, 0x0a, 0x71, 0x0a, 0x71, 0x02, 0x50, 0x02, 0x50, 0x02, 0x91, 0x0a, 0x91, 0x0a, 0x70, 0x0a, 0xcc, 0x01, 0x14, 0x64, 0xdf, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xbd, 0xbe, 0x49, 0x01, 0x6f, 0x12, 0x70, 0x02, 0x91, 0x0a, 0x70, 0x02, 0x71, 0x0a, 0x71, 0x0a, 0x70, 0x02, 0x90, 0x0a, 0x70, 0x0a, 0x0e, 0x0a, 0x51, 0x43, 0xfd, 0xc6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbd, 0xbe, 0x29, 0x01, 0x70, 0x12, 0x51, 0x0a, 0x91, 0x0a, 0x50, 0x02, 0x71, 0x0a, 0x71, 0x0a, 0x71, 0x02, 0x71, 0x0a, 0x91, 0x0a, 0x70, 0x02, 0x6f, 0x12, 0xcc, 0x09, 0x58, 0x8d, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd1, 0x63, 0xcc, 0x09, 0x70, 0x12, 0x50, 0x0a, 0x71, 0x0a, 0x72, 0x02, 0x92, 0x02, 0x71, 0x02, 0x70, 0x02, 0x90, 0x02, 0xb0, 0x0a, 0x0d, 0x0a, 0x30, 0x3b, 0x3f, 0xcf, 0xff, 0xff, 0xdf, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xef, 0xd5, 0x84, 0xee, 0x42, 0x28, 0x01, 0x0f, 0x43, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x5e, 0xd7, 0xb1, 0x53, 0xec, 0x01, 0x90, 0x12, 0x71, 0x0a, 0x72, 0x0a, 0x72, 0x0a, 0x71, 0x02, 0x70, 0x0a, 0x70, 0x0a, 0x71, 0x0a, 0x51, 0x02, 0x91, 0x12, 0x4f, 0x12, 0x8b, 0x01, 0x75, 0x6c, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x58, 0x95, 0x4d, 0x22, 0x2e, 0x12, 0x50, 0x0a, 0x70, 0x02, 0x70, 0x02, 0x70, 0x0a, 0x90, 0x0a, 0x91, 0x0a, 0x71, 0x02, 0x71, 0x0a, 0x50, 0x0a, 0x6f, 0x12, 0xec, 0x09, 0x91, 0x4b, 0xff, 0xf7, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0x95, 0x7c, 0x8c, 0x01, 0x51, 0x12, 0x71, 0x02, 0x71, 0x02, 0x50, 0x02, 0x91, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x71, 0x02, 0x71, 0x0a, 0x0e, 0x0a, 0x30, 0x3b, 0xdb, 0xc6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x2f, 0x43, 0x0d, 0x0a, 0x4f, 0x0a, 0x70, 0x0a, 0x71, 0x02, 0x71, 0x02, 0x71, 0x0a, 0x71, 0x0a, 0x92, 0x02, 0x91, 0x02, 0x90, 0x0a, 0xec, 0x09, 0x2f, 0x43, 0x7f, 0xdf, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xe7, 0xd5, 0x84, 0xad, 0x3a, 0x48, 0x01, 0x4f, 0x43, 0xff, 0xef, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xbd, 0xbe, 0x71, 0x43, 0xee, 0x01, 0x71, 0x0a, 0x71, 0x0a, 0x91, 0x0a, 0x71, 0x02, 0x70, 0x02, 0x91, 0x0a, 0x71, 0x02, 0x51, 0x0a, 0x71, 0x12, 0xed, 0x01, 0x55, 0x5c, 0xdf, 0xdf, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x10, 0x4b, 0xed, 0x11, 0x6f, 0x0a, 0x70, 0x02, 0x90, 0x02, 0x91, 0x0a, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x91, 0x0a, 0x70, 0x0a, 0x0e, 0x02, 0x4d, 0x1a, 0xda, 0xa5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xf7, 0x7c, 0xac, 0x01, 0x70, 0x0a, 0x91, 0x0a, 0x50, 0x02, 0x71, 0x0a, 0x71, 0x0a, 0x70, 0x02, 0x90, 0x0a, 0x90, 0x0a, 0x70, 0x0a, 0xcc, 0x09, 0xf3, 0x5b, 0xbf, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0x4d, 0x2a, 0xed, 0x09, 0x91, 0x12, 0x70, 0x02, 0x70, 0x02, 0x70, 0x0a, 0x71, 0x0a, 0x71, 0x0a, 0x71, 0x02, 0x91, 0x02, 0x90, 0x0a, 0x4f, 0x0a, 0xed, 0x09, 0xd3, 0x53, 0x7f, 0xdf, 0xff, 0xff, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xf7, 0xff, 0xff, 0x78, 0x9d, 0x8b, 0x01, 0x70, 0x12, 0x71, 0x12, 0x31, 0x02, 0x51, 0x02, 0x92, 0x0a, 0x70, 0x02, 0x90, 0x02, 0x6f, 0x02, 0x8f, 0x02, 0x6f, 0x0a, 0x2d, 0x0a, 0x14, 0x5c, 0x7f, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xe7, 0x78, 0x8d, 0xd3, 0x53, 0xab, 0x09, 0x0d, 0x12, 0x2d, 0x12, 0x0c, 0x12, 0x57, 0x95, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7c, 0xb6, 0x10, 0x3b, 0x0d, 0x02, 0x91, 0x0a, 0x72, 0x0a, 0x72, 0x02, 0x71, 0x0a, 0x71, 0x0a, 0x91, 0x0a, 0x50, 0x02, 0x71, 0x0a, 0x71, 0x02, 0x91, 0x0a, 0x50, 0x0a, 0x4e, 0x12, 0x8a, 0x01, 0x9c, 0xb6, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xef, 0x58, 0x8d, 0x6d, 0x22, 0xed, 0x09, 0x90, 0x0a, 0x91, 0x0a, 0x71, 0x02, 0x91, 0x0a, 0x91, 0x0a, 0x70, 0x02, 0x91, 0x02, 0x91, 0x02, 0x50, 0x02, 0x90, 0x12, 0x6f, 0x1a, 0x48, 0x01, 0x7f, 0xdf, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xf7, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xe7, 0x0f, 0x43, 0xed, 0x09, 0x70, 0x0a, 0x71, 0x0a, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x70, 0x0a, 0x70, 0x0a, 0x91, 0x02, 0x70, 0x02, 0xed, 0x01, 0x34, 0x54, 0x9f, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x74, 0x6c, 0xec, 0x09, 0x50, 0x0a, 0x71, 0x0a, 0x71, 0x02, 0x50, 0x02, 0x91, 0x0a, 0x30, 0x02, 0x71, 0x0a, 0x91, 0x02, 0x4f, 0x02, 0x6f, 0x12, 0x0c, 0x12, 0x54, 0x6c, 0xdf, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xf7, 0xbf, 0xd7, 0x37, 0x85, 0xb2, 0x53, 0x8b, 0x09, 0x0d, 0x12, 0x4d, 0x1a, 0xc9, 0x09, 0x3a, 0xae, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xfa, 0x9d, 0x8f, 0x22, 0x2e, 0x0a, 0x70, 0x0a, 0x71, 0x0a, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x91, 0x0a, 0x70, 0x0a, 0x50, 0x0a, 0x2f, 0x0a, 0x10, 0x3b, 0xff, 0xe7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdd, 0xce, 0x28, 0x01, 0x6f, 0x12, 0x90, 0x0a, 0x70, 0x02, 0xb1, 0x0a, 0x70, 0x02, 0x70, 0x0a, 0x70, 0x02, 0x71, 0x0a, 0x71, 0x02, 0x71, 0x02, 0x4f, 0x0a, 0xab, 0x01, 0x13, 0x64, 0x9f, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xf7, 0x51, 0x43, 0xee, 0x01, 0x71, 0x0a, 0x71, 0x02, 0x92, 0x0a, 0x71, 0x02, 0x70, 0x02, 0x70, 0x02, 0xb0, 0x0a, 0x90, 0x0a, 0x4f, 0x0a, 0xcc, 0x09, 0x53, 0x6c, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xf7, 0xda, 0xa5, 0x6a, 0x01, 0x2f, 0x0a, 0xb1, 0x0a, 0x70, 0x02, 0x70, 0x0a, 0x71, 0x0a, 0x71, 0x0a, 0x71, 0x02, 0x90, 0x02, 0x90, 0x02, 0x70, 0x0a, 0x2f, 0x0a, 0x0d, 0x1a, 0xfa, 0xa5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xdf, 0x6a, 0x01, 0x70, 0x12, 0x50, 0x0a, 0x92, 0x12, 0x71, 0x0a, 0x51, 0x02, 0x70, 0x02, 0x90, 0x02, 0xd0, 0x0a, 0x6f, 0x02, 0x90, 0x02, 0x2f, 0x02, 0x4e, 0x1a, 0xd3, 0x5b, 0xfe, 0xce, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x7f, 0xdf, 0xd6, 0x7c, 0xd2, 0x53, 0x2d, 0x1a, 0xcc, 0x01, 0x70, 0x12, 0x4f, 0x0a, 0x6f, 0x0a, 0x2d, 0x12, 0x6d, 0x32, 0x9f, 0xe7, 0xff, 0xff, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb9, 0x9d, 0x4e, 0x1a, 0x2f, 0x0a, 0x91, 0x0a, 0x72, 0x0a, 0x71, 0x02, 0x91, 0x0a, 0x70, 0x02, 0x30, 0x02, 0x71, 0x0a, 0x71, 0x0a, 0x50, 0x02, 0x91, 0x0a, 0x71, 0x0a, 0xb1, 0x12, 0xed, 0x01, 0xae, 0x2a, 0x3a, 0xa6, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xf7, 0x5f, 0xd7, 0x54, 0x6c, 0x2c, 0x1a, 0x0d, 0x0a, 0x6f, 0x0a, 0x91, 0x0a, 0x71, 0x02, 0x50, 0x02, 0x91, 0x0a, 0x50, 0x02, 0xb1, 0x02, 0xb1, 0x02, 0x91, 0x02, 0x71, 0x0a, 0x90, 0x12, 0xab, 0x09, 0x13, 0x64, 0xff, 0xf7, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xbf, 0xe7, 0xca, 0x19, 0x0e, 0x0a, 0x70, 0x0a, 0x71, 0x0a, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x90, 0x0a, 0x70, 0x0a, 0x90, 0x02, 0x70, 0x02, 0xed, 0x01, 0xf7, 0x74, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x5b, 0xae, 0x8a, 0x01, 0x90, 0x1a, 0x70, 0x0a, 0x50, 0x02, 0x50, 0x02, 0x50, 0x02, 0x91, 0x0a, 0x71, 0x02, 0x70, 0x02, 0x90, 0x0a, 0x90, 0x12, 0x2e, 0x12, 0x0d, 0x1a, 0x34, 0x64, 0x3e, 0xcf, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x1e, 0xcf, 0x17, 0x7d, 0xb1, 0x43, 0x2d, 0x12, 0xed, 0x09, 0x6f, 0x12, 0x2f, 0x12, 0x6f, 0x12, 0x0c, 0x0a, 0x6c, 0x22, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x79, 0x8d, 0xec, 0x09, 0x4f, 0x0a, 0x70, 0x0a, 0x70, 0x02, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x71, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0xcc, 0x01, 0x95, 0x74, 0xff, 0xef, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x0f, 0x3b, 0xec, 0x09, 0x70, 0x0a, 0xb1, 0x0a, 0x50, 0x02, 0x71, 0x0a, 0x70, 0x0a, 0x70, 0x02, 0x71, 0x02, 0x91, 0x02, 0x71, 0x02, 0x70, 0x0a, 0x2e, 0x12, 0x2c, 0x22, 0xf9, 0xad, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xef, 0xec, 0x11, 0x0e, 0x0a, 0x91, 0x0a, 0xb2, 0x0a, 0x31, 0x02, 0x92, 0x02, 0x51, 0x02, 0x91, 0x02, 0xb1, 0x02, 0x90, 0x02, 0x4f, 0x0a, 0xec, 0x09, 0xd5, 0x84, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xdf, 0x8a, 0x09, 0x90, 0x1a, 0x50, 0x02, 0x91, 0x02, 0x71, 0x0a, 0x71, 0x0a, 0x71, 0x0a, 0x71, 0x02, 0x70, 0x02, 0x90, 0x02, 0x70, 0x0a, 0x4f, 0x12, 0xab, 0x09, 0x95, 0x74, 0xbf, 0xef, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x69, 0x01, 0x2e, 0x0a, 0x70, 0x0a, 0x50, 0x02, 0x51, 0x02, 0x92, 0x0a, 0x51, 0x0a, 0x50, 0x02, 0x70, 0x02, 0x90, 0x0a, 0x91, 0x0a, 0x90, 0x0a, 0x2f, 0x0a, 0x0e, 0x12, 0x11, 0x3b, 0x96, 0x74, 0x7c, 0xae, 0x9f, 0xd7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0x9f, 0xdf, 0x7b, 0xb6, 0x37, 0x8d, 0x14, 0x5c, 0x31, 0x3b, 0x0e, 0x12, 0xee, 0x09, 0x4f, 0x0a, 0x90, 0x12, 0x90, 0x12, 0x4f, 0x02, 0x90, 0x0a, 0x2e, 0x0a, 0x0c, 0x1a, 0xf2, 0x63, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x84, 0xac, 0x09, 0x70, 0x12, 0x71, 0x0a, 0x50, 0x0a, 0x91, 0x0a, 0x91, 0x0a, 0x70, 0x02, 0xb2, 0x12, 0x50, 0x02, 0x50, 0x02, 0x91, 0x0a, 0x30, 0x02, 0x91, 0x0a, 0x51, 0x02, 0x70, 0x0a, 0x0d, 0x0a, 0x6d, 0x1a, 0x74, 0x64, 0xfd, 0xbe, 0xff, 0xef, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xef, 0xbd, 0xbe, 0xd6, 0x74, 0x0f, 0x33, 0x2d, 0x0a, 0x6f, 0x12, 0x6f, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0xb1, 0x0a, 0x70, 0x02, 0x91, 0x02, 0x71, 0x02, 0x70, 0x12, 0x2e, 0x12, 0xaa, 0x11, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x7f, 0xd7, 0x28, 0x01, 0x4f, 0x12, 0x70, 0x0a, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x70, 0x0a, 0x90, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0xac, 0x01, 0x79, 0x8d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xef, 0x69, 0x01, 0x2e, 0x12, 0x4f, 0x0a, 0xb1, 0x0a, 0x70, 0x0a, 0x50, 0x02, 0x70, 0x02, 0x71, 0x02, 0x50, 0x02, 0xb1, 0x0a, 0x50, 0x02, 0x50, 0x02, 0x4f, 0x0a, 0x0e, 0x0a, 0x31, 0x3b, 0xd6, 0x74, 0x9d, 0xbe, 0x7f, 0xdf, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xef, 0x7f, 0xd7, 0x5b, 0xb6, 0x16, 0x85, 0xf3, 0x5b, 0x31, 0x3b, 0x0d, 0x0a, 0x0e, 0x02, 0xee, 0x01, 0x70, 0x12, 0x4f, 0x0a, 0x90, 0x12, 0x4f, 0x0a, 0x6f, 0x12, 0xec, 0x09, 0x74, 0x6c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xf7, 0x7c, 0x8b, 0x01, 0x6f, 0x12, 0x4f, 0x0a, 0x70, 0x0a, 0x70, 0x02, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x70, 0x0a, 0x70, 0x12, 0x8b, 0x01, 0x3b, 0xa6, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xde, 0xbe, 0x69, 0x01, 0x4f, 0x0a, 0x70, 0x0a, 0xb1, 0x0a, 0x50, 0x02, 0x71, 0x02, 0x91, 0x02, 0x71, 0x02, 0x91, 0x02, 0x91, 0x02, 0x70, 0x02, 0x6f, 0x12, 0x8b, 0x01, 0x13, 0x64, 0x9f, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xf7, 0xff, 0xef, 0x29, 0x01, 0x4f, 0x12, 0x91, 0x0a, 0x91, 0x0a, 0x51, 0x02, 0x72, 0x02, 0x71, 0x02, 0x91, 0x02, 0x90, 0x02, 0x6f, 0x02, 0x4f, 0x0a, 0x6e, 0x1a, 0xb8, 0x9d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xf7, 0xff, 0xef, 0x75, 0x6c, 0x8b, 0x01, 0x70, 0x0a, 0x71, 0x02, 0x71, 0x0a, 0x71, 0x0a, 0x71, 0x0a, 0x71, 0x0a, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x70, 0x0a, 0x0d, 0x0a, 0x8e, 0x2a, 0x9b, 0xc6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb1, 0x53, 0x0c, 0x12, 0x90, 0x12, 0x70, 0x0a, 0x70, 0x02, 0xb1, 0x0a, 0x91, 0x0a, 0x92, 0x0a, 0xb2, 0x12, 0x50, 0x02, 0x91, 0x0a, 0x91, 0x0a, 0x50, 0x02, 0x50, 0x0a, 0x0e, 0x0a, 0x4e, 0x1a, 0xcf, 0x2a, 0x70, 0x43, 0x91, 0x53, 0x91, 0x5b, 0xb1, 0x5b, 0x90, 0x53, 0x90, 0x53, 0x70, 0x4b, 0xef, 0x32, 0x2d, 0x12, 0xed, 0x09, 0x0e, 0x0a, 0x71, 0x12, 0x50, 0x0a, 0x71, 0x0a, 0x50, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x50, 0x02, 0x90, 0x12, 0x0d, 0x12, 0x0b, 0x22, 0x3a, 0xb6, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0x76, 0x74, 0xac, 0x09, 0x70, 0x12, 0x71, 0x0a, 0x71, 0x0a, 0x50, 0x02, 0x71, 0x02, 0x50, 0x02, 0x51, 0x02, 0x71, 0x02, 0x91, 0x0a, 0x70, 0x0a, 0x71, 0x0a, 0x51, 0x02, 0x92, 0x0a, 0x51, 0x02, 0x4f, 0x0a, 0x4e, 0x12, 0x0c, 0x0a, 0x30, 0x3b, 0x91, 0x4b, 0x13, 0x64, 0xd5, 0x84, 0x16, 0x8d, 0x95, 0x7c, 0x13, 0x64, 0xb2, 0x53, 0xef, 0x32, 0x2d, 0x12, 0x0d, 0x02, 0x6f, 0x02, 0x90, 0x0a, 0x70, 0x02, 0x91, 0x0a, 0x70, 0x02, 0x91, 0x0a, 0xb1, 0x0a, 0x70, 0x02, 0x70, 0x02, 0x91, 0x02, 0x91, 0x02, 0x50, 0x0a, 0x70, 0x1a, 0x29, 0x01, 0x5c, 0xb6, 0xff, 0xf7, 0xdf, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x9d, 0xb6, 0x8a, 0x01, 0x6f, 0x12, 0x71, 0x0a, 0x71, 0x02, 0x71, 0x02, 0x91, 0x02, 0x71, 0x02, 0x71, 0x0a, 0x71, 0x0a, 0x70, 0x0a, 0x6f, 0x12, 0x0d, 0x12, 0xda, 0x9d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xf7, 0x0e, 0x43, 0xcb, 0x09, 0x8f, 0x12, 0x4f, 0x02, 0x70, 0x02, 0xb1, 0x0a, 0x50, 0x02, 0xb1, 0x0a, 0x91, 0x0a, 0x50, 0x02, 0x91, 0x0a, 0x71, 0x02, 0x71, 0x02, 0x50, 0x0a, 0x0e, 0x02, 0x0d, 0x0a, 0xf0, 0x32, 0x31, 0x43, 0x92, 0x4b, 0xd2, 0x5b, 0xd2, 0x5b, 0xb1, 0x53, 0x90, 0x4b, 0x50, 0x43, 0xce, 0x32, 0x0d, 0x12, 0xec, 0x09, 0x4e, 0x0a, 0x2f, 0x02, 0x91, 0x12, 0x71, 0x0a, 0x70, 0x0a, 0x90, 0x12, 0x70, 0x0a, 0x70, 0x0a, 0x4f, 0x0a, 0x2e, 0x0a, 0x2d, 0x22, 0xdd, 0xce, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xe7, 0x75, 0x6c, 0xcc, 0x09, 0x6f, 0x12, 0x70, 0x0a, 0x70, 0x0a, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x70, 0x0a, 0x70, 0x12, 0x29, 0x01, 0x5f, 0xd7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x0f, 0x3b, 0x0d, 0x0a, 0xb0, 0x12, 0x50, 0x02, 0x71, 0x02, 0x70, 0x02, 0x91, 0x02, 0x91, 0x02, 0x71, 0x02, 0x92, 0x02, 0x50, 0x02, 0x70, 0x0a, 0x4e, 0x12, 0xcb, 0x11, 0x1a, 0xae, 0xff, 0xf7, 0xdf, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xf7, 0x3e, 0xcf, 0x49, 0x01, 0x8f, 0x12, 0x4f, 0x02, 0x90, 0x0a, 0x91, 0x0a, 0x71, 0x0a, 0x71, 0x0a, 0x91, 0x0a, 0x70, 0x02, 0x4f, 0x02, 0x2e, 0x0a, 0x11, 0x33, 0x9c, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xf7, 0xff, 0xff, 0xff, 0xff, 0x1e, 0xcf, 0x29, 0x01, 0x90, 0x12, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x70, 0x02, 0x71, 0x0a, 0x91, 0x02, 0x92, 0x02, 0x91, 0x02, 0x91, 0x0a, 0x30, 0x02, 0xac, 0x01, 0xb9, 0x95, 0xff, 0xef, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xbf, 0xe7, 0xa6, 0x00, 0x8f, 0x1a, 0x70, 0x0a, 0x70, 0x02, 0x4f, 0x02, 0x91, 0x0a, 0x51, 0x02, 0x51, 0x0a, 0xb3, 0x12, 0x51, 0x02, 0x71, 0x02, 0x71, 0x0a, 0x70, 0x0a, 0x90, 0x12, 0x4e, 0x0a, 0x4e, 0x0a, 0x2d, 0x0a, 0xcc, 0x01, 0xec, 0x09, 0xec, 0x09, 0xec, 0x09, 0xed, 0x09, 0xed, 0x01, 0x0e, 0x02, 0x4f, 0x0a, 0x50, 0x0a, 0x71, 0x0a, 0x71, 0x0a, 0x71, 0x0a, 0x91, 0x0a, 0x50, 0x02, 0x90, 0x0a, 0x70, 0x0a, 0x92, 0x0a, 0x71, 0x02, 0x4f, 0x0a, 0x0d, 0x12, 0x0f, 0x43, 0x7f, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x7f, 0xd7, 0xf4, 0x5b, 0xcd, 0x09, 0x50, 0x0a, 0x71, 0x0a, 0x71, 0x02, 0x71, 0x02, 0xb2, 0x0a, 0x92, 0x02, 0x71, 0x02, 0x92, 0x02, 0x50, 0x02, 0x91, 0x02, 0x91, 0x02, 0x50, 0x02, 0x92, 0x0a, 0x51, 0x02, 0x50, 0x02, 0x70, 0x0a, 0x6f, 0x12, 0x0d, 0x0a, 0x0d, 0x12, 0xec, 0x11, 0x2d, 0x1a, 0x4d, 0x22, 0x0d, 0x1a, 0x0c, 0x12, 0xcc, 0x09, 0x0d, 0x0a, 0x70, 0x0a, 0x91, 0x0a, 0x91, 0x02, 0x92, 0x0a, 0x71, 0x02, 0x50, 0x02, 0x71, 0x0a, 0x50, 0x02, 0x90, 0x0a, 0x90, 0x0a, 0x70, 0x02, 0x70, 0x02, 0x71, 0x0a, 0x4f, 0x12, 0x4a, 0x01, 0xb6, 0x7c, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0x38, 0x85, 0xcc, 0x09, 0x70, 0x12, 0x51, 0x0a, 0x71, 0x02, 0x71, 0x02, 0x72, 0x02, 0x71, 0x02, 0x71, 0x02, 0x71, 0x0a, 0x50, 0x0a, 0x0e, 0x0a, 0xf0, 0x32, 0x7c, 0xb6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x3e, 0xd7, 0x07, 0x01, 0x6e, 0x12, 0x4f, 0x02, 0x71, 0x0a, 0x71, 0x02, 0x50, 0x02, 0x70, 0x02, 0x51, 0x02, 0x92, 0x0a, 0x92, 0x0a, 0x72, 0x02, 0x71, 0x02, 0x91, 0x02, 0x90, 0x0a, 0x6f, 0x0a, 0x6f, 0x0a, 0x2e, 0x0a, 0xed, 0x01, 0xed, 0x09, 0xed, 0x09, 0xcc, 0x01, 0x0c, 0x0a, 0x0d, 0x0a, 0x0e, 0x0a, 0x2f, 0x0a, 0x6f, 0x0a, 0x70, 0x02, 0x50, 0x02, 0x51, 0x02, 0x71, 0x0a, 0x70, 0x0a, 0x50, 0x0a, 0x70, 0x0a, 0x91, 0x12, 0x71, 0x12, 0x70, 0x12, 0xec, 0x11, 0x2f, 0x4b, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x3e, 0xcf, 0xb2, 0x4b, 0xed, 0x09, 0x70, 0x0a, 0x70, 0x02, 0x70, 0x02, 0x91, 0x02, 0x92, 0x02, 0x72, 0x02, 0x71, 0x02, 0x90, 0x0a, 0x4f, 0x12, 0x8a, 0x01, 0xbf, 0xdf, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x9d, 0xb6, 0x08, 0x01, 0x6f, 0x12, 0x70, 0x0a, 0x71, 0x02, 0x71, 0x02, 0x70, 0x02, 0x91, 0x02, 0x91, 0x02, 0x71, 0x02, 0x91, 0x02, 0x91, 0x0a, 0x6f, 0x0a, 0xec, 0x09, 0x13, 0x5c, 0xdf, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xef, 0x77, 0x8d, 0xcb, 0x01, 0x6f, 0x12, 0x4f, 0x0a, 0x90, 0x12, 0x50, 0x0a, 0x71, 0x0a, 0x71, 0x0a, 0x91, 0x0a, 0x70, 0x0a, 0x4f, 0x0a, 0x0e, 0x0a, 0xd3, 0x4b, 0x7f, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xe7, 0x51, 0x4b, 0xcd, 0x01, 0x71, 0x0a, 0x71, 0x0a, 0x71, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x91, 0x0a, 0x92, 0x0a, 0x91, 0x02, 0x91, 0x02, 0x91, 0x0a, 0x2f, 0x02, 0xb2, 0x4b, 0x5f, 0xcf, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x43, 0xec, 0x09, 0x6f, 0x12, 0x70, 0x0a, 0x90, 0x0a, 0x91, 0x0a, 0x71, 0x02, 0x71, 0x02, 0x51, 0x02, 0x72, 0x0a, 0x51, 0x02, 0x91, 0x0a, 0x50, 0x02, 0x6f, 0x0a, 0x4f, 0x0a, 0x90, 0x12, 0x4f, 0x0a, 0x90, 0x12, 0x90, 0x0a, 0x70, 0x0a, 0x50, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x71, 0x0a, 0x91, 0x0a, 0x71, 0x02, 0x50, 0x02, 0x71, 0x02, 0x71, 0x02, 0x91, 0x0a, 0x71, 0x0a, 0x50, 0x0a, 0x91, 0x0a, 0x50, 0x02, 0x91, 0x0a, 0x90, 0x12, 0xab, 0x01, 0x4c, 0x2a, 0xbf, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xbd, 0xbe, 0x32, 0x43, 0x0e, 0x0a, 0x50, 0x02, 0x91, 0x02, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x51, 0x02, 0x92, 0x02, 0x92, 0x02, 0xb1, 0x0a, 0x70, 0x02, 0x90, 0x02, 0x70, 0x02, 0x71, 0x0a, 0x30, 0x02, 0x71, 0x0a, 0x91, 0x0a, 0x50, 0x0a, 0x91, 0x12, 0x70, 0x12, 0x4f, 0x0a, 0x4f, 0x12, 0x4f, 0x0a, 0x2e, 0x0a, 0x6f, 0x12, 0x4f, 0x0a, 0x91, 0x0a, 0x71, 0x02, 0x92, 0x0a, 0x71, 0x02, 0x51, 0x02, 0x71, 0x02, 0x71, 0x0a, 0x71, 0x0a, 0x70, 0x0a, 0x50, 0x02, 0x90, 0x0a, 0x90, 0x0a, 0x4f, 0x02, 0xb0, 0x1a, 0x6b, 0x01, 0x92, 0x53, 0xdf, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xe7, 0xd3, 0x53, 0xcd, 0x01, 0x70, 0x0a, 0x51, 0x0a, 0x71, 0x0a, 0x71, 0x02, 0x72, 0x02, 0x71, 0x02, 0x51, 0x02, 0x71, 0x0a, 0x70, 0x0a, 0xcd, 0x01, 0xd3, 0x53, 0x3e, 0xd7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x6c, 0x32, 0xec, 0x09, 0x90, 0x12, 0x71, 0x12, 0x71, 0x0a, 0xb2, 0x0a, 0x71, 0x02, 0x71, 0x02, 0x72, 0x0a, 0x52, 0x02, 0x92, 0x0a, 0x92, 0x0a, 0x71, 0x02, 0x70, 0x02, 0x90, 0x02, 0x6f, 0x02, 0x90, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x90, 0x0a, 0x4f, 0x0a, 0x50, 0x0a, 0x71, 0x0a, 0x70, 0x02, 0x70, 0x02, 0x91, 0x0a, 0x71, 0x02, 0x91, 0x0a, 0x70, 0x0a, 0x2f, 0x02, 0x91, 0x12, 0x51, 0x0a, 0x0f, 0x0a, 0x6f, 0x12, 0xcb, 0x09, 0x6b, 0x32, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7b, 0xb6, 0xcf, 0x2a, 0x0d, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x91, 0x02, 0x91, 0x02, 0x92, 0x02, 0x72, 0x02, 0x71, 0x02, 0x70, 0x0a, 0x2e, 0x0a, 0xef, 0x32, 0x9f, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xef, 0xef, 0x3a, 0x2d, 0x12, 0x50, 0x12, 0x50, 0x02, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x92, 0x0a, 0x71, 0x02, 0x71, 0x02, 0x91, 0x0a, 0x70, 0x0a, 0x4e, 0x0a, 0xec, 0x11, 0x1a, 0xa6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xe7, 0xf2, 0x53, 0xcc, 0x01, 0x4f, 0x0a, 0x70, 0x12, 0x50, 0x0a, 0x71, 0x0a, 0x50, 0x0a, 0x71, 0x0a, 0x71, 0x0a, 0x70, 0x0a, 0x6f, 0x0a, 0xed, 0x09, 0x34, 0x64, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x9c, 0xbe, 0x2a, 0x01, 0x70, 0x12, 0x71, 0x0a, 0x71, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x71, 0x0a, 0x70, 0x0a, 0x70, 0x02, 0x91, 0x0a, 0x4f, 0x0a, 0xaa, 0x01, 0x5b, 0xae, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0x7f, 0xdf, 0x09, 0x01, 0x2f, 0x12, 0x70, 0x12, 0x50, 0x02, 0x90, 0x02, 0x91, 0x02, 0xb1, 0x02, 0x71, 0x02, 0x91, 0x0a, 0x71, 0x0a, 0x50, 0x02, 0x70, 0x0a, 0x70, 0x0a, 0x90, 0x12, 0x50, 0x0a, 0x91, 0x0a, 0x70, 0x02, 0x90, 0x02, 0x91, 0x0a, 0x71, 0x02, 0x71, 0x02, 0x71, 0x0a, 0x71, 0x0a, 0x51, 0x02, 0x71, 0x02, 0xb1, 0x0a, 0x70, 0x02, 0x50, 0x02, 0x70, 0x0a, 0x70, 0x0a, 0x91, 0x0a, 0x70, 0x0a, 0x90, 0x0a, 0x4e, 0x0a, 0xaa, 0x01, 0xee, 0x3a, 0x5f, 0xd7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xfa, 0xa5, 0x8e, 0x2a, 0x4f, 0x12, 0x50, 0x02, 0x91, 0x02, 0x91, 0x0a, 0x4f, 0x02, 0x90, 0x0a, 0x70, 0x02, 0x71, 0x0a, 0x50, 0x02, 0x70, 0x0a, 0xee, 0x01, 0x4f, 0x0a, 0x70, 0x12, 0x30, 0x0a, 0xd3, 0x1a, 0x50, 0x02, 0x70, 0x02, 0x91, 0x0a, 0x70, 0x02, 0x71, 0x02, 0x71, 0x02, 0x91, 0x0a, 0x50, 0x02, 0x70, 0x02, 0xb1, 0x0a, 0x90, 0x0a, 0x70, 0x02, 0x71, 0x0a, 0x51, 0x02, 0x91, 0x0a, 0x71, 0x02, 0x91, 0x0a, 0x91, 0x0a, 0x50, 0x02, 0x71, 0x0a, 0x91, 0x0a, 0x70, 0x0a, 0x90, 0x12, 0x8f, 0x1a, 0x49, 0x01, 0x30, 0x43, 0x7f, 0xdf, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x6e, 0x22, 0x2f, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x70, 0x02, 0x71, 0x0a, 0x71, 0x0a, 0x51, 0x02, 0x71, 0x0a, 0x90, 0x12, 0xac, 0x01, 0x75, 0x6c, 0xdf, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xdf, 0xc7, 0x00, 0x6f, 0x1a, 0x50, 0x12, 0x30, 0x02, 0x71, 0x0a, 0x91, 0x0a, 0x71, 0x0a, 0x51, 0x0a, 0x71, 0x0a, 0x50, 0x02, 0x70, 0x02, 0x91, 0x0a, 0x70, 0x0a, 0x90, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x51, 0x0a, 0x91, 0x0a, 0x91, 0x0a, 0x70, 0x02, 0x90, 0x02, 0x90, 0x0a, 0x70, 0x0a, 0x71, 0x0a, 0x70, 0x02, 0x90, 0x0a, 0x90, 0x0a, 0x70, 0x02, 0x90, 0x02, 0x70, 0x02, 0x91, 0x0a, 0x71, 0x12, 0x70, 0x12, 0x4f, 0x12, 0x8a, 0x01, 0x2f, 0x43, 0x7e, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xd9, 0x9d, 0x0c, 0x12, 0x4e, 0x12, 0x50, 0x0a, 0x70, 0x0a, 0x71, 0x0a, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x71, 0x0a, 0x4f, 0x0a, 0x0d, 0x0a, 0x34, 0x64, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0x9c, 0xb6, 0x49, 0x01, 0x4f, 0x12, 0x91, 0x12, 0x71, 0x0a, 0x71, 0x0a, 0x51, 0x02, 0x71, 0x0a, 0x71, 0x0a, 0x51, 0x02, 0x71, 0x0a, 0x91, 0x0a, 0x70, 0x0a, 0xec, 0x09, 0x34, 0x64, 0x9f, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xe7, 0x6d, 0x22, 0x2d, 0x12, 0x4f, 0x12, 0x50, 0x0a, 0x70, 0x0a, 0x91, 0x12, 0x71, 0x0a, 0x92, 0x0a, 0x71, 0x0a, 0x70, 0x0a, 0x6f, 0x12, 0xcc, 0x09, 0x74, 0x6c, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5f, 0xd7, 0x6e, 0x2a, 0x0e, 0x0a, 0x50, 0x12, 0x70, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x71, 0x0a, 0x90, 0x0a, 0x70, 0x0a, 0x70, 0x02, 0x6f, 0x0a, 0xab, 0x01, 0xd6, 0x74, 0x9f, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1c, 0xae, 0xc8, 0x00, 0x90, 0x1a, 0x90, 0x12, 0x4f, 0x02, 0x90, 0x02, 0x90, 0x02, 0x91, 0x02, 0x71, 0x02, 0x51, 0x02, 0x71, 0x0a, 0x91, 0x0a, 0x50, 0x02, 0x70, 0x0a, 0x71, 0x0a, 0x71, 0x02, 0x91, 0x02, 0x70, 0x02, 0x91, 0x02, 0x92, 0x0a, 0x71, 0x02, 0x51, 0x02, 0x91, 0x0a, 0x91, 0x0a, 0x50, 0x02, 0x70, 0x02, 0x6f, 0x02, 0x90, 0x0a, 0xb0, 0x12, 0x4f, 0x0a, 0x50, 0x0a, 0x90, 0x12, 0x2d, 0x12, 0x89, 0x01, 0x33, 0x64, 0x9f, 0xdf, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x57, 0x8d, 0xeb, 0x11, 0x4e, 0x0a, 0x70, 0x02, 0x71, 0x02, 0x50, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x90, 0x0a, 0x71, 0x0a, 0x90, 0x12, 0xed, 0x01, 0x9b, 0x7d, 0xcc, 0x09, 0x4e, 0x12, 0x70, 0x12, 0x30, 0x0a, 0x91, 0x0a, 0x50, 0x02, 0x71, 0x02, 0x92, 0x02, 0x92, 0x0a, 0x71, 0x02, 0x91, 0x02, 0xb2, 0x0a, 0xb2, 0x0a, 0x70, 0x02, 0x70, 0x02, 0x50, 0x02, 0x71, 0x02, 0x71, 0x0a, 0x71, 0x02, 0x71, 0x0a, 0x51, 0x02, 0x50, 0x02, 0x71, 0x0a, 0x71, 0x0a, 0x71, 0x0a, 0x50, 0x12, 0x4e, 0x12, 0x49, 0x01, 0x2f, 0x4b, 0x5e, 0xd7, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x6a, 0x01, 0x91, 0x12, 0x70, 0x0a, 0x70, 0x0a, 0x90, 0x0a, 0x70, 0x02, 0x70, 0x02, 0x91, 0x0a, 0x50, 0x02, 0x71, 0x0a, 0x6f, 0x0a, 0xab, 0x01, 0xf6, 0x84, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x58, 0x8d, 0x08, 0x01, 0xb1, 0x2a, 0x50, 0x12, 0x50, 0x0a, 0x91, 0x0a, 0x91, 0x0a, 0x71, 0x0a, 0x91, 0x0a, 0x91, 0x0a, 0x50, 0x02, 0x70, 0x02, 0x90, 0x0a, 0x70, 0x0a, 0x90, 0x0a, 0x71, 0x0a, 0x51, 0x0a, 0x51, 0x0a, 0x71, 0x02, 0x71, 0x02, 0x90, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x0a, 0x50, 0x02, 0x70, 0x0a, 0x70, 0x02, 0x70, 0x02, 0xb1, 0x0a, 0x70, 0x02, 0xb1, 0x12, 0x50, 0x12, 0x0d, 0x0a, 0x49, 0x01, 0xd5, 0x7c, 0xbf, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x57, 0x8d, 0xab, 0x01, 0x6f, 0x1a, 0x50, 0x0a, 0x70, 0x0a, 0x70, 0x02, 0x50, 0x02, 0x51, 0x02, 0x71, 0x0a, 0x50, 0x0a, 0x2e, 0x0a, 0xcb, 0x09, 0x78, 0x8d, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xe7, 0x8d, 0x32, 0x0e, 0x12, 0x2f, 0x0a, 0x71, 0x0a, 0x50, 0x02, 0x91, 0x0a, 0x50, 0x02, 0x70, 0x0a, 0x91, 0x0a, 0x71, 0x0a, 0x70, 0x02, 0x70, 0x0a, 0x2e, 0x0a, 0xaa, 0x09, 0x5b, 0xb6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xef, 0xe6, 0x00, 0x6e, 0x1a, 0x6f, 0x12, 0x0e, 0x0a, 0x71, 0x12, 0x51, 0x02, 0x71, 0x02, 0x92, 0x02, 0x51, 0x02, 0x91, 0x12, 0x2e, 0x0a, 0x2d, 0x1a, 0x58, 0x8d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xef, 0x17, 0x7d, 0xac, 0x01, 0x70, 0x12, 0x71, 0x0a, 0x70, 0x0a, 0x70, 0x02, 0x91, 0x0a, 0x91, 0x0a, 0x50, 0x02, 0x91, 0x0a, 0x70, 0x0a, 0x6f, 0x12, 0x2d, 0x0a, 0x2c, 0x1a, 0xdd, 0xc6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xd7, 0x84, 0x29, 0x01, 0x4e, 0x1a, 0xb0, 0x12, 0x6f, 0x02, 0x70, 0x02, 0x50, 0x02, 0x91, 0x0a, 0x92, 0x0a, 0x71, 0x02, 0x51, 0x02, 0x71, 0x02, 0x91, 0x02, 0x92, 0x02, 0x71, 0x02, 0x91, 0x02, 0x71, 0x02, 0x71, 0x02, 0x50, 0x02, 0x91, 0x02, 0xb1, 0x0a, 0x70, 0x02, 0x70, 0x02, 0xb1, 0x0a, 0x70, 0x02, 0x70, 0x02, 0x6f, 0x0a, 0x4f, 0x0a, 0x6f, 0x12, 0x90, 0x1a, 0x8b, 0x01, 0xca, 0x11, 0x9c, 0xbe, 0xdf, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xf6, 0x7c, 0xcb, 0x01, 0x6f, 0x0a, 0x91, 0x0a, 0x71, 0x02, 0x71, 0x0a, 0x70, 0x0a, 0xb1, 0x0a, 0x71, 0x02, 0x70, 0x02, 0x70, 0x12, 0x6a, 0x01, 0x1f, 0xbf, 0xff, 0xbe, 0x49, 0x01, 0x2e, 0x1a, 0x70, 0x12, 0x91, 0x0a, 0x71, 0x02, 0x71, 0x02, 0x92, 0x02, 0x71, 0x02, 0x71, 0x02, 0x92, 0x0a, 0x51, 0x02, 0x71, 0x0a, 0x71, 0x0a, 0x71, 0x0a, 0x51, 0x0a, 0x71, 0x0a, 0x71, 0x0a, 0x71, 0x0a, 0x71, 0x0a, 0x71, 0x0a, 0x51, 0x02, 0x51, 0x02, 0x71, 0x12, 0x71, 0x12, 0x0e, 0x12, 0x29, 0x01, 0x33, 0x64, 0x7f, 0xdf, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xf7, 0xff, 0xff, 0x1d, 0xc7, 0x6b, 0x01, 0x50, 0x0a, 0x70, 0x02, 0x91, 0x02, 0x91, 0x02, 0x91, 0x02, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x70, 0x0a, 0x4f, 0x12, 0x0c, 0x12, 0x57, 0x95, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xef, 0xf3, 0x63, 0xe9, 0x00, 0x4f, 0x22, 0x70, 0x12, 0x4f, 0x0a, 0x4f, 0x02, 0x50, 0x02, 0x50, 0x02, 0x71, 0x02, 0x91, 0x02, 0x71, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x0a, 0x50, 0x0a, 0x71, 0x12, 0x51, 0x0a, 0x50, 0x0a, 0x91, 0x0a, 0x70, 0x02, 0x70, 0x02, 0x90, 0x02, 0x91, 0x02, 0x71, 0x0a, 0x50, 0x0a, 0x70, 0x0a, 0x90, 0x0a, 0x70, 0x02, 0x70, 0x0a, 0x4f, 0x12, 0xac, 0x09, 0xca, 0x11, 0x1d, 0xc7, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xef, 0xd5, 0x74, 0xab, 0x01, 0x90, 0x12, 0x70, 0x0a, 0x70, 0x0a, 0x70, 0x02, 0x70, 0x02, 0x71, 0x02, 0x70, 0x0a, 0x6f, 0x0a, 0x6f, 0x12, 0x6a, 0x01, 0xfe, 0xc6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5b, 0xae, 0x29, 0x01, 0x70, 0x12, 0x70, 0x0a, 0x91, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x91, 0x0a, 0x90, 0x0a, 0x6f, 0x0a, 0xab, 0x01, 0x54, 0x64, 0x7f, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xdf, 0xdf, 0x07, 0x01, 0x6e, 0x22, 0x4e, 0x12, 0x4f, 0x12, 0x70, 0x0a, 0x71, 0x0a, 0x71, 0x02, 0x92, 0x02, 0x71, 0x0a, 0x50, 0x0a, 0x0e, 0x0a, 0xae, 0x2a, 0x1a, 0xae, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xbd, 0xbe, 0xab, 0x09, 0x0e, 0x0a, 0x50, 0x0a, 0x70, 0x0a, 0x70, 0x02, 0x70, 0x02, 0x71, 0x02, 0x71, 0x02, 0x50, 0x02, 0x50, 0x0a, 0x6f, 0x0a, 0x8f, 0x1a, 0x69, 0x01, 0xb9, 0x9d, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xf6, 0x84, 0x08, 0x01, 0x0d, 0x0a, 0x8f, 0x12, 0x70, 0x0a, 0x71, 0x0a, 0x51, 0x0a, 0x51, 0x0a, 0x71, 0x02, 0xb2, 0x0a, 0xb2, 0x02, 0x91, 0x02, 0x91, 0x02, 0x71, 0x02, 0x71, 0x02, 0x71, 0x02, 0x91, 0x0a, 0x91, 0x02, 0x70, 0x02, 0x70, 0x02, 0x90, 0x02, 0x90, 0x02, 0x70, 0x02, 0x70, 0x0a, 0x70, 0x0a, 0x6f, 0x12, 0xb0, 0x1a, 0xec, 0x09, 0x08, 0x01, 0x95, 0x6c, 0xff, 0xe7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xe7, 0x74, 0x6c, 0xec, 0x01, 0x4f, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x50, 0x0a, 0x70, 0x0a, 0x91, 0x02, 0x91, 0x02, 0x70, 0x0a, 0x6f, 0x12, 0x28, 0x01, 0x7f, 0xd7, 0xff, 0xf7, 0x9d, 0xbe, 0x08, 0x01, 0xed, 0x09, 0x70, 0x12, 0x50, 0x0a, 0x91, 0x12, 0x30, 0x02, 0x71, 0x0a, 0x71, 0x0a, 0x71, 0x0a, 0x50, 0x0a, 0x71, 0x12, 0x51, 0x0a, 0x50, 0x0a, 0x71, 0x0a, 0x91, 0x0a, 0x30, 0x02, 0x50, 0x02, 0x71, 0x0a, 0x71, 0x0a, 0x50, 0x0a, 0x71, 0x12, 0x70, 0x1a, 0xac, 0x09, 0x6a, 0x09, 0xb9, 0x9d, 0xff, 0xef, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x97, 0x9d, 0x8a, 0x01, 0x90, 0x12, 0x70, 0x02, 0x91, 0x02, 0x91, 0x02, 0x71, 0x02, 0x71, 0x02, 0x71, 0x0a, 0x71, 0x0a, 0x70, 0x0a, 0x2e, 0x0a, 0x8e, 0x2a, 0x3a, 0xb6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xf7, 0xdf, 0xef, 0xff, 0xef, 0x75, 0x74, 0x09, 0x01, 0x4e, 0x1a, 0x2e, 0x0a, 0x90, 0x12, 0x70, 0x0a, 0x70, 0x02, 0x91, 0x0a, 0xb2, 0x02, 0x71, 0x02, 0x70, 0x02, 0x70, 0x02, 0x91, 0x0a, 0x50, 0x0a, 0x30, 0x02, 0x71, 0x0a, 0x71, 0x0a, 0x50, 0x0a, 0x70, 0x0a, 0xb1, 0x0a, 0x90, 0x02, 0xb1, 0x0a, 0x71, 0x0a, 0x0f, 0x02, 0x90, 0x12, 0x4e, 0x0a, 0x6f, 0x12, 0x8b, 0x01, 0xe8, 0x00, 0x38, 0x8d, 0xff, 0xe7, 0xff, 0xef, 0xff, 0xf7, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xdf, 0x13, 0x5c, 0xcc, 0x01, 0x6f, 0x0a, 0x70, 0x0a, 0x70, 0x02, 0x70, 0x02, 0x70, 0x02, 0x70, 0x0a, 0x70, 0x0a, 0x6f, 0x0a, 0x4e, 0x12, 0x48, 0x01, 0x3e, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xf7, 0x5f, 0xdf, 0xae, 0x32, 0xcc, 0x01, 0x6f, 0x0a, 0x90, 0x0a, 0x90, 0x0a, 0x70, 0x02, 0x70, 0x0a, 0x6f, 0x0a, 0x6f, 0x0a, 0x90, 0x0a, 0x70, 0x02, 0x70, 0x0a, 0x4e, 0x12, 0x8a, 0x09, 0x9c, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0x7e, 0xb6, 0x8a, 0x09, 0x6f, 0x22, 0x4f, 0x12, 0x70, 0x1a, 0x50, 0x0a, 0x71, 0x0a, 0x71, 0x0a, 0x71, 0x02, 0x70, 0x0a, 0x4f, 0x0a, 0x0d, 0x12, 0x70, 0x43, 0x1e, 0xcf, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xdf, 0xe7, 0xb2, 0x53, 0xed, 0x09, 0xb1, 0x1a, 0x90, 0x12, 0x70, 0x0a, 0x90, 0x0a, 0x70, 0x02, 0x71, 0x0a, 0x91, 0x12, 0x4f, 0x0a, 0x2e, 0x0a, 0x6e, 0x1a, 0x2c, 0x1a, 0x2f, 0x43, 0x3e, 0xd7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xf7, 0xbc, 0xbe, 0x28, 0x01, 0x8a, 0x09, 0x4f, 0x1a, 0x50, 0x1a, 0x50, 0x12, 0x50, 0x12, 0x70, 0x0a, 0x70, 0x02, 0x71, 0x02, 0x91, 0x02, 0x71, 0x02, 0x50, 0x02, 0x91, 0x02, 0x70, 0x02, 0x90, 0x0a, 0x70, 0x02, 0x6f, 0x02, 0xb1, 0x12, 0x90, 0x0a, 0x50, 0x0a, 0x50, 0x0a, 0x70, 0x12, 0x0e, 0x12, 0xcb, 0x09, 0xc6, 0x00, 0x53, 0x64, 0xff, 0xe7, 0xff, 0xef, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1e, 0xcf, 0x71, 0x4b, 0x0d, 0x12, 0x4e, 0x12, 0x4f, 0x12, 0x4f, 0x12, 0x50, 0x12, 0x70, 0x0a, 0x70, 0x02, 0x90, 0x0a, 0x90, 0x12, 0x2d, 0x12, 0xa9, 0x11, 0xbf, 0xe7, 0xff, 0xf7, 0xff, 0xf7, 0xdf, 0xe7, 0x4d, 0x22, 0x6a, 0x01, 0x2e, 0x12, 0x6f, 0x1a, 0x70, 0x12, 0xb1, 0x12, 0x2f, 0x02, 0x70, 0x0a, 0x70, 0x12, 0x70, 0x12, 0x70, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x50, 0x02, 0x91, 0x0a, 0x70, 0x0a, 0x4f, 0x0a, 0x90, 0x12, 0x6f, 0x12, 0xac, 0x01, 0x09, 0x01, 0x92, 0x53, 0x3f, 0xcf, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x52, 0x74, 0xcb, 0x11, 0x4f, 0x12, 0x70, 0x12, 0x70, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x50, 0x0a, 0x50, 0x12, 0x70, 0x12, 0x6f, 0x12, 0xed, 0x11, 0x30, 0x43, 0xfd, 0xce, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xef, 0x1b, 0xae, 0x28, 0x01, 0xcb, 0x09, 0x6e, 0x12, 0x6f, 0x12, 0x4f, 0x0a, 0x70, 0x0a, 0x70, 0x02, 0x91, 0x02, 0x91, 0x02, 0x90, 0x02, 0x50, 0x02, 0xb1, 0x0a, 0x91, 0x0a, 0x91, 0x0a, 0x71, 0x0a, 0x50, 0x0a, 0x70, 0x12, 0x4f, 0x0a, 0x90, 0x0a, 0x2e, 0x02, 0x70, 0x1a, 0x90, 0x22, 0xec, 0x09, 0x49, 0x01, 0x08, 0x01, 0xb6, 0x84, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x9b, 0xbe, 0x0f, 0x3b, 0x2e, 0x12, 0x70, 0x12, 0x71, 0x0a, 0x71, 0x0a, 0x70, 0x0a, 0x70, 0x0a, 0x50, 0x0a, 0x50, 0x12, 0x4f, 0x12, 0x2d, 0x12, 0x2c, 0x22, 0x9f, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0x3b, 0xa6, 0x6a, 0x01, 0x4f, 0x12, 0x90, 0x12, 0x70, 0x12, 0x6f, 0x0a, 0x6f, 0x12, 0x6f, 0x12, 0x6f, 0x12, 0x6f, 0x12, 0x6f, 0x0a, 0x6f, 0x12, 0x6f, 0x12, 0xec, 0x11, 0xf2, 0x63, 0xbf, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0x96, 0x74, 0x08, 0x01, 0x29, 0x01, 0x8b, 0x09, 0xcc, 0x09, 0xac, 0x01, 0x8c, 0x01, 0xed, 0x01, 0xed, 0x01, 0xcc, 0x01, 0xab, 0x09, 0x08, 0x01, 0x6f, 0x4b, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x7b, 0xb6, 0xa7, 0x00, 0x8b, 0x09, 0xac, 0x01, 0x8b, 0x01, 0xcc, 0x01, 0xec, 0x01, 0xac, 0x01, 0x8c, 0x01, 0xcc, 0x09, 0xcb, 0x09, 0xaa, 0x01, 0x89, 0x01, 0xc5, 0x00, 0x3a, 0xb6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xdf, 0xf7, 0xff, 0xff, 0x9f, 0xe7, 0x75, 0x7c, 0x09, 0x01, 0x4a, 0x01, 0xec, 0x11, 0x6e, 0x1a, 0x6f, 0x12, 0x6f, 0x0a, 0x91, 0x0a, 0x91, 0x02, 0x50, 0x02, 0xb1, 0x12, 0x90, 0x0a, 0x90, 0x0a, 0x4f, 0x02, 0x8f, 0x0a, 0x8f, 0x12, 0x4e, 0x0a, 0x4e, 0x12, 0x2e, 0x12, 0x8b, 0x01, 0x09, 0x01, 0x0c, 0x22, 0x38, 0x8d, 0xff, 0xef, 0xff, 0xef, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xad, 0xeb, 0x21, 0x69, 0x01, 0xab, 0x09, 0xab, 0x09, 0x8b, 0x09, 0x8c, 0x01, 0xac, 0x01, 0xcc, 0x01, 0xcc, 0x01, 0xab, 0x01, 0x49, 0x01, 0x2e, 0x4b, 0xbf, 0xe7, 0xff, 0xf7, 0xff, 0xff, 0xdf, 0xef, 0xff, 0xe7, 0x7d, 0xb6, 0xcb, 0x11, 0x08, 0x01, 0xab, 0x09, 0x2e, 0x12, 0x6f, 0x1a, 0x90, 0x1a, 0x4e, 0x12, 0x4f, 0x12, 0x70, 0x12, 0x6f, 0x12, 0x70, 0x12, 0x90, 0x12, 0x6f, 0x12, 0x2e, 0x12, 0xcc, 0x09, 0x49, 0x01, 0x49, 0x01, 0xb2, 0x53, 0x3f, 0xcf, 0xff, 0xf7, 0xdf, 0xef, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xf7, 0x87, 0x21, 0x69, 0x09, 0x8a, 0x01, 0xac, 0x09, 0xac, 0x09, 0xac, 0x01, 0xac, 0x01, 0x8b, 0x01, 0x8b, 0x01, 0x8b, 0x01, 0x8b, 0x09, 0x08, 0x01, 0xb1, 0x5b, 0x7f, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xbf, 0xdf, 0x12, 0x5c, 0x27, 0x01, 0xaa, 0x01, 0x2d, 0x12, 0x6f, 0x12, 0x90, 0x12, 0x70, 0x0a, 0x70, 0x0a, 0x70, 0x02, 0x91, 0x02, 0x91, 0x02, 0x50, 0x02, 0x71, 0x0a, 0x71, 0x12, 0x70, 0x12, 0x70, 0x1a, 0x4e, 0x12, 0x4e, 0x12, 0x0d, 0x12, 0x8b, 0x09, 0xe8, 0x00, 0x6d, 0x2a, 0x99, 0x95, 0xff, 0xef, 0xff, 0xf7, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd8, 0xad, 0x88, 0x11, 0x6a, 0x01, 0xac, 0x01, 0xad, 0x01, 0xac, 0x01, 0xac, 0x01, 0xac, 0x01, 0x8b, 0x01, 0x8b, 0x01, 0x8a, 0x09, 0x48, 0x01, 0x4f, 0x4b, 0x9f, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0x1e, 0xcf, 0x4c, 0x22, 0x6a, 0x01, 0xab, 0x01, 0xab, 0x01, 0x8b, 0x01, 0xab, 0x09, 0xab, 0x09, 0xab, 0x09, 0xab, 0x01, 0xcc, 0x01, 0x6a, 0x01, 0xab, 0x01, 0x69, 0x09, 0xc5, 0x00, 0x7b, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0x78, 0x9d, 0xd5, 0x84, 0x37, 0x8d, 0x37, 0x8d, 0xd6, 0x84, 0x17, 0x8d, 0x17, 0x85, 0x17, 0x7d, 0x17, 0x7d, 0xf6, 0x7c, 0xf6, 0x8c, 0x94, 0x84, 0xd8, 0xad, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xef, 0x98, 0x9d, 0xd6, 0x84, 0xd6, 0x7c, 0x37, 0x8d, 0x16, 0x85, 0xf6, 0x84, 0xf6, 0x84, 0x17, 0x8d, 0xf6, 0x84, 0xd6, 0x84, 0xf6, 0x84, 0x77, 0x95, 0x73, 0x7c, 0xf8, 0xb5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xe7, 0xb9, 0x9d, 0x6b, 0x2a, 0x47, 0x01, 0x49, 0x01, 0xcc, 0x01, 0xce, 0x01, 0xef, 0x01, 0x30, 0x0a, 0x0f, 0x02, 0x2f, 0x0a, 0xed, 0x01, 0xcc, 0x01, 0xab, 0x01, 0x69, 0x01, 0x07, 0x01, 0x48, 0x01, 0xcd, 0x3a, 0x57, 0x95, 0xdf, 0xe7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdc, 0xd6, 0xd5, 0x8c, 0xf6, 0x84, 0x17, 0x85, 0xf6, 0x84, 0xf7, 0x8c, 0x17, 0x8d, 0xf6, 0x84, 0x16, 0x85, 0x16, 0x85, 0xf6, 0x84, 0x94, 0x7c, 0x3a, 0xb6, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xef, 0xff, 0xf7, 0xff, 0xf7, 0x7f, 0xd7, 0x74, 0x74, 0xeb, 0x19, 0x08, 0x01, 0x28, 0x01, 0x6a, 0x01, 0x8a, 0x01, 0x6b, 0x01, 0x8b, 0x01, 0x8b, 0x01, 0x29, 0x01, 0x08, 0x01, 0x8a, 0x11, 0x50, 0x53, 0xfa, 0xad, 0xdf, 0xef, 0xff, 0xf7, 0xff, 0xf7, 0xdf, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x52, 0x7c, 0x16, 0x85, 0xd6, 0x7c, 0x17, 0x8d, 0x17, 0x8d, 0x17, 0x85, 0x17, 0x85, 0x16, 0x85, 0xf6, 0x84, 0xf7, 0x84, 0xf6, 0x84, 0xb4, 0x84, 0x7b, 0xc6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xf7, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xef, 0xff, 0xe7, 0x56, 0x8d, 0x2b, 0x22, 0x07, 0x01, 0x29, 0x01, 0xac, 0x01, 0xed, 0x01, 0xee, 0x01, 0x70, 0x0a, 0x50, 0x02, 0x50, 0x02, 0xee, 0x01, 0xad, 0x01, 0xac, 0x01, 0x69, 0x01, 0x08, 0x01, 0x49, 0x01, 0x0f, 0x43, 0x58, 0x95, 0xff, 0xe7, 0xff, 0xf7, 0xff, 0xef, 0xff, 0xf7, 0xdf, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xdb, 0xd6, 0x93, 0x84, 0xf6, 0x84, 0x17, 0x85, 0x17, 0x85, 0xf7, 0x84, 0x17, 0x85, 0x17, 0x85, 0xf6, 0x84, 0xf7, 0x84, 0xf6, 0x84, 0xb4, 0x7c, 0x7b, 0xb6, 0xff, 0xef, 0xdf, 0xf7, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xf7, 0xff, 0xf7, 0xbc, 0xbe, 0xd5, 0x7c, 0xf6, 0x84, 0xf6, 0x84, 0xf6, 0x84, 0xf7, 0x84, 0x17, 0x85, 0x17, 0x85, 0x17, 0x85, 0x37, 0x85, 0x37, 0x85, 0x16, 0x85, 0x57, 0x8d, 0x72, 0x7c, 0xf8, 0xb5, 0xde, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xf7, 0xff, 0xef, 0xff, 0xef, 0xff, 0xef, 0xff, 0xef, 0xff, 0xf7, 0xff, 0xef, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xf7, 0xff, 0xef, 0xff, 0xef, 0xff, 0xef, 0xff, 0xe7, 0x9f, 0xc7, 0x3d, 0x96, 0x3b, 0x6d, 0xba, 0x5c, 0x95, 0x3b, 0x91, 0x12, 0x74, 0x33, 0xd9, 0x64, 0x19, 0x6d, 0xdb, 0x8d, 0x1f, 0xbf, 0xff, 0xdf, 0xff, 0xef, 0xff, 0xef, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xef, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xbf, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xef, 0xff, 0xef, 0xff, 0xe7, 0xdf, 0xdf, 0x1f, 0xbf, 0xbf, 0xae, 0x9e, 0xa6, 0x9f, 0xa6, 0xff, 0xb6, 0x9f, 0xd7, 0xff, 0xe7, 0xff, 0xef, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xff, 0xef, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xef, 0xff, 0xef, 0xff, 0xef, 0xff, 0xe7, 0x3f, 0xcf, 0xdc, 0x95, 0xfa, 0x74, 0xb9, 0x5c, 0x74, 0x2b, 0xb2, 0x12, 0xb6, 0x33, 0xd9, 0x54, 0x5a, 0x75, 0xfc, 0x8d, 0xbe, 0xae, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0xef, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xef, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xef, 0xff, 0xef, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xef, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xef, 0xff, 0xef, 0xff, 0xef, 0xff, 0xef, 0xff, 0xef, 0xff, 0xef, 0xff, 0xef, 0xff, 0xf7, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+const uint32_t img_logo_marine_120x120_rle_size = sizeof(img_logo_marine_120x120_rle);
+
+/* 310x62, 38440 -> 15622 bytes */
+const uint8_t img_logo_rebtek_310_62_rle[] = {
+    0x54, 0x53, 0x52, 0x4c, 0x36, 0x01, 0x3e, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0xff, 0x71, 0x02, 0xff, 0xf7, 0x70, 0x0a, 0x71, 0x0a, 
+    0x70, 0x02, 0x91, 0x0a, 0x91, 0x02, 0xff, 0xef, 0x50, 0x02, 0x50, 0x0a, 0x90, 0x0a, 0x4f, 0x0a, 0xdf, 0xff, 0x90, 0x02, 0x51, 0x02, 
+    0x6f, 0x12, 0x6f, 0x0a, 0x70, 0x12, 0x2e, 0x0a, 0x4f, 0x12, 0x0d, 0x0a, 0x90, 0x12, 0x92, 0x0a, 0x51, 0x0a, 0x92, 0x02, 0xff, 0xe7, 
+    0xb1, 0x0a, 0xec, 0x09, 0x6a, 0x01, 0xdf, 0xf7, 0x0e, 0x0a, 0x2f, 0x0a, 0xed, 0x09, 0x50, 0x12, 0x4e, 0x12, 0xac, 0x01, 0xcc, 0x09, 
+    0x8b, 0x01, 0xab, 0x01, 0xed, 0x01, 0xcc, 0x01, 0x0d, 0x12, 0x4a, 0x01, 0x2e, 0x12, 0xab, 0x09, 0x4f, 0x02, 0x71, 0x12, 0x2d, 0x12, 
+    0x91, 0x12, 0x49, 0x01, 0x30, 0x02, 0x72, 0x02, 0x1f, 0xcf, 0x1e, 0xcf, 0xdf, 0xe7, 0xf6, 0x84, 0xb2, 0x0a, 0x2f, 0x02, 0xbf, 0xe7, 
+    0x4e, 0x0a, 0x7d, 0x35, 0x8a, 0x01, 0x6f, 0x02, 0x2d, 0x0a, 0x0d, 0x02, 0xec, 0x11, 0xcb, 0x09, 0x9f, 0xdf, 0x7c, 0x35, 0x7f, 0xdf, 
+    0xd3, 0x53, 0xdf, 0xef, 0x7c, 0x3d, 0x72, 0x0a, 0x0c, 0x12, 0x3e, 0xcf, 0x29, 0x01, 0x4d, 0x1a, 0x2e, 0x02, 0xb1, 0x12, 0x5f, 0xd7, 
+    0xbf, 0xdf, 0x8f, 0x12, 0x95, 0x74, 0x17, 0x85, 0xbf, 0xc7, 0xfe, 0xff, 0x6b, 0x01, 0x28, 0x01, 0x0e, 0x02, 0x2d, 0x1a, 0x8e, 0x2a, 
+    0xbd, 0xbe, 0x0c, 0x0a, 0xf3, 0x5b, 0xcd, 0x01, 0x08, 0x01, 0xdf, 0xc7, 0x3f, 0xcf, 0xf3, 0x53, 0xee, 0x01, 0x2f, 0x12, 0x6f, 0x1a, 
+    0x9f, 0xe7, 0xec, 0x01, 0xb2, 0x53, 0x7f, 0xd7, 0xdf, 0xdf, 0x1f, 0xc7, 0xd2, 0x53, 0x4b, 0x01, 0xcb, 0x11, 0x0f, 0x43, 0x71, 0x4b, 
+    0xef, 0x32, 0xfa, 0xa5, 0x6e, 0x22, 0x8a, 0x09, 0xbf, 0xf7, 0xac, 0x09, 0xbf, 0xcf, 0x1b, 0xa6, 0x4e, 0x1a, 0x50, 0x4b, 0xb9, 0x9d, 
+    0x9c, 0xbe, 0x34, 0x64, 0x33, 0x5c, 0xb1, 0x02, 0x1a, 0xa6, 0x54, 0x6c, 0xaf, 0x2a, 0xbf, 0xff, 0x16, 0x85, 0x7b, 0x3d, 0x9c, 0x35, 
+    0x39, 0x3d, 0xde, 0xff, 0x1e, 0xc7, 0x6d, 0x2a, 0x91, 0x4b, 0x30, 0x3b, 0xcf, 0x2a, 0x6e, 0x1a, 0x69, 0x01, 0x58, 0x8d, 0x13, 0x64, 
+    0x8f, 0x22, 0x2c, 0x1a, 0xcd, 0x09, 0x5a, 0x45, 0xdd, 0xc6, 0x09, 0x01, 0x9f, 0xd7, 0xbf, 0xef, 0x33, 0x64, 0x91, 0x53, 0x51, 0x43, 
+    0xd9, 0xa5, 0x3e, 0xd7, 0x51, 0x4b, 0xcb, 0x01, 0xaf, 0x22, 0x7c, 0xb6, 0x90, 0x1a, 0x0e, 0x12, 0xb0, 0x12, 0x8d, 0x2a, 0x3f, 0xc7, 
+    0xae, 0x2a, 0x4d, 0x22, 0xd2, 0x5b, 0xd6, 0x7c, 0x10, 0x3b, 0x5b, 0xb6, 0xbc, 0xbe, 0x34, 0x5c, 0xf0, 0x32, 0x0f, 0x3b, 0xf2, 0x63, 
+    0x07, 0x01, 0x5c, 0xb6, 0x9c, 0xb6, 0x75, 0x6c, 0xcf, 0x32, 0x5c, 0xae, 0x8b, 0x09, 0x48, 0x01, 0x5b, 0xae, 0x3f, 0xd7, 0x57, 0x95, 
+    0x3b, 0xae, 0x8f, 0x0a, 0x2c, 0x22, 0x37, 0x8d, 0xd5, 0x84, 0x9d, 0xb6, 0x78, 0x95, 0x30, 0x0a, 0x70, 0x1a, 0x99, 0x95, 0x69, 0x09, 
+    0xb8, 0x9d, 0x74, 0x6c, 0x1a, 0xae, 0x6e, 0x12, 0x17, 0x8d, 0x7b, 0xb6, 0x30, 0x43, 0x31, 0x3b, 0x17, 0x7d, 0xd6, 0x44, 0xba, 0x6d, 
+    0x0d, 0x1a, 0x8c, 0x01, 0x2a, 0x01, 0x50, 0x1a, 0x0c, 0x1a, 0xb5, 0x7c, 0x7f, 0xe7, 0x8e, 0x22, 0xef, 0x3a, 0x9d, 0xbe, 0xb2, 0x4b, 
+    0x6d, 0x22, 0x8f, 0x1a, 0x74, 0x74, 0x79, 0x8d, 0x3b, 0xa6, 0x4e, 0x02, 0x54, 0x64, 0xf7, 0x7c, 0xfd, 0xce, 0xed, 0x11, 0xce, 0x2a, 
+    0x98, 0x9d, 0x37, 0x85, 0x92, 0x4b, 0x13, 0x5c, 0xfe, 0xce, 0xb2, 0x12, 0xd7, 0x4c, 0xff, 0xdf, 0xd6, 0x74, 0xf7, 0x84, 0xce, 0x32, 
+    0xfe, 0xc6, 0x38, 0x8d, 0xaa, 0x09, 0xb5, 0x74, 0x92, 0x12, 0x5e, 0xd7, 0xdd, 0xbe, 0x6c, 0x22, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x00, 
+    0x00, 0x00, 0x12, 0x01, 0x00, 0x00, 0xba, 0x01, 0x00, 0x00, 0x57, 0x02, 0x00, 0x00, 0xde, 0x02, 0x00, 0x00, 0x6e, 0x03, 0x00, 0x00, 
+    0x00, 0x04, 0x00, 0x00, 0x85, 0x04, 0x00, 0x00, 0x1d, 0x05, 0x00, 0x00, 0xae, 0x05, 0x00, 0x00, 0x55, 0x06, 0x00, 0x00, 0xf8, 0x06, 
+    0x00, 0x00, 0x86, 0x07, 0x00, 0x00, 0xfd, 0x07, 0x00, 0x00, 0x6c, 0x08, 0x00, 0x00, 0xe8, 0x08, 0x00, 0x00, 0xbd, 0x09, 0x00, 0x00, 
+    0xc3, 0x0a, 0x00, 0x00, 0xb2, 0x0b, 0x00, 0x00, 0xb1, 0x0c, 0x00, 0x00, 0xab, 0x0d, 0x00, 0x00, 0xae, 0x0e, 0x00, 0x00, 0xa9, 0x0f, 
+    0x00, 0x00, 0xa5, 0x10, 0x00, 0x00, 0xb1, 0x11, 0x00, 0x00, 0xb8, 0x12, 0x00, 0x00, 0xd5, 0x13, 0x00, 0x00, 0xf0, 0x14, 0x00, 0x00, 
+    0xfa, 0x15, 0x00, 0x00, 0xf2, 0x16, 0x00, 0x00, 0xfc, 0x17, 0x00, 0x00, 0x05, 0x19, 0x00, 0x00, 0x0e, 0x1a, 0x00, 0x00, 0x37, 0x1b, 
+    0x00, 0x00, 0x66, 0x1c, 0x00, 0x00, 0xa0, 0x1d, 0x00, 0x00, 0xe4, 0x1e, 0x00, 0x00, 0x22, 0x20, 0x00, 0x00, 0x59, 0x21, 0x00, 0x00, 
+    0x7d, 0x22, 0x00, 0x00, 0xb2, 0x23, 0x00, 0x00, 0x07, 0x25, 0x00, 0x00, 0x59, 0x26, 0x00, 0x00, 0x75, 0x27, 0x00, 0x00, 0x7e, 0x28, 
+    0x00, 0x00, 0x66, 0x29, 0x00, 0x00, 0x5b, 0x2a, 0x00, 0x00, 0x50, 0x2b, 0x00, 0x00, 0x52, 0x2c, 0x00, 0x00, 0x5a, 0x2d, 0x00, 0x00, 
+    0x66, 0x2e, 0x00, 0x00, 0x88, 0x2f, 0x00, 0x00, 0x95, 0x30, 0x00, 0x00, 0xa8, 0x31, 0x00, 0x00, 0xa9, 0x32, 0x00, 0x00, 0xb3, 0x33, 
+    0x00, 0x00, 0xb7, 0x34, 0x00, 0x00, 0xb7, 0x35, 0x00, 0x00, 0xbe, 0x36, 0x00, 0x00, 0xdb, 0x37, 0x00, 0x00, 0x1f, 0x39, 0x00, 0x00, 
+    0x00, 0x57, 0x86, 0x00, 0x00, 0x02, 0x86, 0x00, 0x87, 0x02, 0x82, 0x08, 0x84, 0x02, 0x81, 0x08, 0x8c, 0x02, 0x82, 0x00, 0x00, 0x02, 
+    0x83, 0x00, 0x81, 0x57, 0x01, 0x00, 0x02, 0xb9, 0x00, 0x04, 0x98, 0x5b, 0x66, 0x0a, 0x06, 0x81, 0x01, 0x07, 0x07, 0x1b, 0x0a, 0x14, 
+    0x30, 0xa8, 0x02, 0x1e, 0xb0, 0x00, 0x00, 0x02, 0x81, 0x08, 0x01, 0x02, 0x00, 0x87, 0x02, 0x82, 0x08, 0x81, 0x02, 0x82, 0x00, 0x81, 
+    0x02, 0x83, 0x08, 0x81, 0x02, 0x84, 0x08, 0x84, 0x02, 0x82, 0x08, 0x83, 0x02, 0x00, 0x00, 0x82, 0x02, 0xa3, 0x00, 0x00, 0x8a, 0x81, 
+    0x00, 0x0d, 0x02, 0x7a, 0x23, 0x0c, 0x04, 0x01, 0x39, 0x09, 0x01, 0x17, 0x01, 0x31, 0x25, 0xff, 0x8d, 0x32, 0x99, 0x00, 0x88, 0x00, 
+    0x81, 0x1e, 0x04, 0xff, 0x5e, 0xe7, 0xff, 0xdc, 0xd6, 0xff, 0xfd, 0xd6, 0xbe, 0x35, 0x81, 0x6d, 0x85, 0x35, 0x05, 0x6d, 0x8b, 0xff, 
+    0x3e, 0xc7, 0x8b, 0x4c, 0x36, 0x81, 0x35, 0x81, 0x6d, 0x00, 0x35, 0x82, 0x36, 0x82, 0x35, 0x05, 0x63, 0x6d, 0x8b, 0x51, 0x37, 0x08, 
+    0x85, 0x02, 0x00, 0x1e, 0x83, 0x00, 0x00, 0x02, 0x82, 0x00, 0x00, 0x0d, 0xb5, 0x00, 0x06, 0xbf, 0xd6, 0x14, 0x03, 0x05, 0x01, 0x19, 
+    0x81, 0x07, 0x04, 0x3a, 0x10, 0x7b, 0x6e, 0x02, 0xad, 0x00, 0x06, 0x0d, 0x00, 0x1e, 0xff, 0x1d, 0xd7, 0x36, 0x6d, 0x51, 0x82, 0x36, 
+    0x83, 0x35, 0x81, 0x36, 0x06, 0x35, 0x6d, 0xa9, 0x6d, 0x63, 0x35, 0x36, 0x81, 0xff, 0x1f, 0xd7, 0x81, 0x4c, 0x82, 0xa9, 0x81, 0x35, 
+    0x01, 0x36, 0x63, 0x82, 0xa9, 0x83, 0x35, 0x82, 0x4c, 0x00, 0x63, 0x81, 0x35, 0x81, 0x63, 0x81, 0x4c, 0x04, 0xbe, 0x63, 0xff, 0x1f, 
+    0xd7, 0xff, 0xbd, 0xce, 0xff, 0x5e, 0xe7, 0xa4, 0x00, 0x05, 0x02, 0xff, 0xb6, 0x74, 0x15, 0x0c, 0x04, 0x0f, 0x81, 0x01, 0x06, 0x07, 
+    0x01, 0x04, 0x0a, 0x2a, 0xff, 0x34, 0x6c, 0x02, 0x98, 0x00, 0x89, 0x00, 0x05, 0xff, 0xbc, 0xc6, 0xff, 0x0b, 0x2a, 0xff, 0xc7, 0x00, 
+    0x32, 0xd7, 0x26, 0x83, 0x1d, 0x00, 0x2b, 0x81, 0x1d, 0x00, 0x2b, 0x85, 0x1d, 0x81, 0x58, 0x82, 0x6f, 0x84, 0x1d, 0x82, 0x2b, 0x01, 
+    0x58, 0xd8, 0x81, 0x99, 0x05, 0xff, 0x4a, 0x09, 0x5c, 0x64, 0xff, 0x1b, 0x9e, 0x9a, 0x02, 0x81, 0x00, 0x00, 0x0d, 0x82, 0x00, 0x00, 
+    0xff, 0xbe, 0xf7, 0xb6, 0x00, 0x81, 0x02, 0x05, 0xff, 0xd1, 0x63, 0x5b, 0x20, 0x0a, 0x06, 0x19, 0x81, 0x01, 0x04, 0x06, 0x0a, 0x14, 
+    0x30, 0xff, 0x58, 0x85, 0xaf, 0x00, 0x04, 0x02, 0xff, 0x32, 0x74, 0xff, 0x27, 0x01, 0x4d, 0x26, 0x83, 0x2b, 0x82, 0x6f, 0x01, 0x2b, 
+    0x32, 0x81, 0x2b, 0x81, 0x1d, 0x81, 0x58, 0x81, 0x1d, 0x00, 0x6f, 0x82, 0x2b, 0x82, 0x6f, 0x81, 0xd8, 0x81, 0x2b, 0x82, 0x1d, 0x01, 
+    0x2b, 0xd8, 0x85, 0x2b, 0x81, 0x6f, 0x82, 0x2b, 0x05, 0x32, 0x1d, 0x2b, 0x59, 0xff, 0xc6, 0x00, 0xff, 0x73, 0x84, 0x81, 0x00, 0x00, 
+    0x0d, 0xa1, 0x00, 0x04, 0x02, 0x7c, 0x15, 0x03, 0x04, 0x81, 0x0f, 0x07, 0x06, 0x01, 0x05, 0x06, 0x20, 0x42, 0xff, 0xba, 0x9d, 0x02, 
+    0x98, 0x00, 0x89, 0x00, 0x06, 0xff, 0x1b, 0xae, 0x70, 0x67, 0x16, 0x04, 0x05, 0x0b, 0x83, 0x10, 0x81, 0x14, 0x00, 0x22, 0x87, 0x12, 
+    0x81, 0x22, 0x83, 0x14, 0x81, 0x0c, 0x03, 0x12, 0x16, 0x12, 0x22, 0x82, 0xd9, 0x07, 0xff, 0x2f, 0x1a, 0x1f, 0x15, 0x3e, 0x59, 0xa8, 
+    0xc0, 0x3b, 0xbc, 0x00, 0x04, 0x02, 0xff, 0xad, 0x32, 0x2a, 0x22, 0x03, 0x81, 0x01, 0x06, 0x19, 0x07, 0x01, 0x0a, 0x14, 0x4b, 0x5d, 
+    0xaf, 0x00, 0x05, 0x02, 0xff, 0x4f, 0x4b, 0x4e, 0x23, 0x10, 0xff, 0xb1, 0x1a, 0x81, 0x10, 0x01, 0x22, 0x12, 0x81, 0x22, 0x05, 0x14, 
+    0x23, 0xff, 0x4f, 0x1a, 0x14, 0x10, 0x11, 0x81, 0x03, 0x81, 0x10, 0x81, 0x22, 0x81, 0x14, 0x00, 0x22, 0x81, 0xd9, 0x00, 0xff, 0x2f, 
+    0x1a, 0x81, 0xff, 0x4f, 0x1a, 0x00, 0x10, 0x82, 0x12, 0x82, 0x22, 0x81, 0x14, 0x01, 0x10, 0x12, 0x82, 0x22, 0x01, 0x12, 0x16, 0x81, 
+    0x12, 0x81, 0x10, 0x02, 0x5b, 0x8c, 0xff, 0xf9, 0xad, 0xa4, 0x00, 0x04, 0x02, 0xf6, 0x15, 0x03, 0x04, 0x84, 0x01, 0x04, 0x04, 0x14, 
+    0x43, 0x8b, 0x02, 0x98, 0x00, 0x88, 0x00, 0x06, 0x02, 0x7a, 0x1d, 0x10, 0x1b, 0x01, 0x17, 0x82, 0x03, 0x02, 0x0a, 0x03, 0x0a, 0x82, 
+    0x22, 0x82, 0x0a, 0x82, 0x03, 0x82, 0x05, 0x82, 0x03, 0x81, 0x11, 0x82, 0x03, 0x81, 0x09, 0x81, 0x0a, 0x01, 0x22, 0x0a, 0x81, 0x0c, 
+    0x81, 0x10, 0x06, 0x2a, 0x26, 0xda, 0x5d, 0x02, 0x1e, 0x0d, 0x82, 0x00, 0x00, 0x0d, 0xb4, 0x00, 0x0d, 0x08, 0x8c, 0x2a, 0x12, 0x03, 
+    0x05, 0x0f, 0x01, 0x07, 0x05, 0x03, 0x13, 0xda, 0x1a, 0xaf, 0x00, 0x04, 0x02, 0xa8, 0x5e, 0x3c, 0x0b, 0x82, 0x05, 0x83, 0x03, 0x83, 
+    0x11, 0x81, 0xc1, 0x81, 0x0e, 0x81, 0x03, 0x01, 0x0a, 0x03, 0x83, 0x11, 0x03, 0x03, 0x11, 0x10, 0x11, 0x8d, 0x03, 0x81, 0x01, 0x06, 
+    0x09, 0x04, 0x09, 0x0c, 0x2a, 0x71, 0xff, 0x9b, 0xc6, 0xa4, 0x00, 0x06, 0x44, 0xaa, 0x13, 0x03, 0x04, 0x01, 0x07, 0x81, 0x01, 0x05, 
+    0x06, 0x0a, 0x66, 0x70, 0x08, 0x02, 0x98, 0x00, 0x88, 0x00, 0x08, 0x02, 0xff, 0x38, 0x85, 0x24, 0x16, 0x01, 0x17, 0x0f, 0x04, 0x03, 
+    0x84, 0x04, 0x00, 0x18, 0x85, 0x04, 0x83, 0x07, 0x81, 0x0e, 0x01, 0x05, 0x03, 0x81, 0x05, 0x02, 0x03, 0x05, 0x04, 0x81, 0x06, 0x81, 
+    0x04, 0x00, 0x06, 0x81, 0x1b, 0x07, 0x0c, 0x03, 0x3a, 0x20, 0x14, 0x4d, 0xdb, 0xdc, 0x82, 0x00, 0x00, 0x0d, 0xb5, 0x00, 0x0d, 0xf7, 
+    0x5c, 0x2c, 0x0a, 0x03, 0x06, 0x01, 0x0f, 0x05, 0x03, 0x0b, 0x41, 0xab, 0x02, 0xad, 0x00, 0x06, 0x0d, 0x00, 0x52, 0xa8, 0x23, 0x0b, 
+    0x05, 0x85, 0x07, 0x00, 0x05, 0x81, 0x0b, 0x01, 0x03, 0x0b, 0x85, 0x0e, 0x00, 0x03, 0x81, 0x0b, 0x83, 0x0e, 0x00, 0x0b, 0x81, 0x03, 
+    0x83, 0x05, 0x01, 0x0e, 0x05, 0x81, 0x03, 0x81, 0x05, 0x0c, 0x07, 0x01, 0x05, 0x01, 0x06, 0x07, 0x01, 0x39, 0x06, 0x16, 0x1c, 0xac, 
+    0x68, 0xa4, 0x00, 0x04, 0xc0, 0x5c, 0x13, 0x03, 0x04, 0x82, 0x01, 0x05, 0x07, 0x06, 0x0a, 0x2c, 0xc2, 0x02, 0x99, 0x00, 0x88, 0x00, 
+    0x07, 0x68, 0xff, 0x14, 0x64, 0x24, 0x0c, 0x03, 0x0c, 0x03, 0x04, 0x85, 0x01, 0x00, 0x04, 0x82, 0x18, 0x82, 0x04, 0x81, 0x01, 0x89, 
+    0x04, 0x02, 0x01, 0x09, 0x05, 0x81, 0x07, 0x82, 0x05, 0x01, 0x0b, 0x05, 0x81, 0x06, 0x05, 0x03, 0x12, 0xd8, 0xff, 0xd3, 0x63, 0x9b, 
+    0x02, 0xb7, 0x00, 0x0e, 0x7d, 0x4e, 0x13, 0x03, 0x06, 0x05, 0x0f, 0x04, 0x06, 0x09, 0x03, 0x13, 0x72, 0x02, 0x0d, 0xac, 0x00, 0x08, 
+    0x0d, 0x00, 0xff, 0x7c, 0xbe, 0xdd, 0x1f, 0x0a, 0x06, 0x09, 0x06, 0x81, 0x19, 0x81, 0x01, 0x82, 0x03, 0x81, 0x0a, 0x81, 0x05, 0x84, 
+    0x01, 0x83, 0x07, 0x82, 0x01, 0x82, 0x03, 0x82, 0x04, 0x81, 0x03, 0x82, 0x04, 0x00, 0x01, 0x83, 0x04, 0x81, 0x03, 0x00, 0x04, 0x81, 
+    0x06, 0x02, 0x10, 0x43, 0xff, 0x54, 0x74, 0x86, 0x00, 0x00, 0x0d, 0x9d, 0x00, 0x03, 0xad, 0x4e, 0x13, 0x03, 0x82, 0x01, 0x06, 0x07, 
+    0x01, 0x06, 0x0c, 0x2c, 0x8d, 0x08, 0x81, 0x00, 0x00, 0x0d, 0x96, 0x00, 0x88, 0x00, 0x02, 0xff, 0x1d, 0xd7, 0xae, 0x13, 0x81, 0x03, 
+    0x81, 0x12, 0x02, 0x04, 0x01, 0x07, 0x81, 0x19, 0x02, 0x07, 0x01, 0x04, 0x83, 0x18, 0x88, 0x04, 0x83, 0x18, 0x81, 0x04, 0x81, 0x07, 
+    0x01, 0x05, 0x0e, 0x82, 0x07, 0x08, 0x05, 0x0b, 0x05, 0x01, 0x17, 0x33, 0x14, 0x4d, 0xff, 0x75, 0x74, 0x81, 0x02, 0xb6, 0x00, 0x0d, 
+    0xff, 0x95, 0x6c, 0x2a, 0x0c, 0x03, 0x05, 0x07, 0x04, 0x18, 0x03, 0x0a, 0x0b, 0x15, 0x38, 0x02, 0xaf, 0x00, 0x09, 0xc3, 0x5b, 0x14, 
+    0x03, 0x04, 0x03, 0x06, 0x07, 0x19, 0x01, 0x81, 0x04, 0x02, 0x03, 0x04, 0x18, 0x81, 0x04, 0x8a, 0x07, 0x83, 0x01, 0x84, 0x04, 0x00, 
+    0x05, 0x85, 0x01, 0x00, 0x04, 0x81, 0x03, 0x06, 0x0a, 0x06, 0x09, 0x03, 0x0c, 0x2d, 0xc4, 0xa4, 0x00, 0x0e, 0x02, 0x5f, 0x4b, 0x0c, 
+    0x03, 0x09, 0x17, 0x01, 0x1b, 0x05, 0x0b, 0x13, 0x2a, 0xf8, 0x02, 0x99, 0x00, 0x88, 0x00, 0x04, 0xff, 0xbc, 0xc6, 0x5b, 0x20, 0x05, 
+    0x07, 0x81, 0x03, 0x01, 0x04, 0x09, 0x81, 0x01, 0x81, 0x07, 0x01, 0x05, 0x06, 0x81, 0x03, 0x00, 0x18, 0x81, 0x04, 0x02, 0x01, 0x05, 
+    0x03, 0x85, 0x04, 0x83, 0x01, 0x02, 0x06, 0x05, 0x06, 0x82, 0x05, 0x81, 0x01, 0x01, 0x06, 0x05, 0x81, 0x0b, 0x06, 0x1b, 0x09, 0x06, 
+    0x14, 0x59, 0xc5, 0x02, 0xb5, 0x00, 0x02, 0x02, 0x8e, 0x2c, 0x81, 0x03, 0x01, 0x07, 0x01, 0x81, 0x04, 0x04, 0x33, 0x16, 0x03, 0x5e, 
+    0x7e, 0xb0, 0x00, 0x03, 0x5f, 0x30, 0x0c, 0x03, 0x81, 0x0b, 0x01, 0x05, 0x01, 0x81, 0x07, 0x82, 0x01, 0x02, 0x04, 0x4a, 0x34, 0x81, 
+    0x01, 0x00, 0x06, 0x81, 0x01, 0x82, 0x07, 0x83, 0x05, 0x82, 0x01, 0x04, 0x07, 0x0f, 0x39, 0x05, 0x06, 0x81, 0x04, 0x86, 0x01, 0x02, 
+    0x05, 0x0a, 0x31, 0x82, 0x03, 0x02, 0x13, 0x4e, 0xc6, 0xa0, 0x00, 0x00, 0x0d, 0x82, 0x00, 0x04, 0x02, 0xde, 0x30, 0x11, 0x03, 0x82, 
+    0x01, 0x06, 0x07, 0x05, 0x0c, 0x23, 0xd6, 0xdf, 0x02, 0x99, 0x00, 0x88, 0x00, 0x07, 0xaf, 0x24, 0x0a, 0x07, 0x01, 0x09, 0x04, 0x0a, 
+    0x81, 0x04, 0x03, 0x01, 0x1b, 0x05, 0x11, 0x82, 0x0c, 0x00, 0x0a, 0x82, 0x03, 0x81, 0x0c, 0x89, 0x03, 0x00, 0x2e, 0x81, 0x0a, 0x02, 
+    0x03, 0x09, 0x06, 0x81, 0x17, 0x01, 0x06, 0x05, 0x81, 0x0b, 0x00, 0x3f, 0x81, 0x0e, 0x03, 0x05, 0x40, 0xff, 0x0b, 0x1a, 0x08, 0xb5, 
+    0x00, 0x06, 0x02, 0xff, 0x10, 0x33, 0x5a, 0x0c, 0x06, 0x07, 0x01, 0x81, 0x04, 0x06, 0x0a, 0x03, 0x11, 0x43, 0x08, 0x00, 0x0d, 0xad, 
+    0x00, 0x06, 0x02, 0xf6, 0x1c, 0x3c, 0x53, 0x11, 0x0c, 0x86, 0x03, 0x83, 0x04, 0x82, 0x03, 0x01, 0x06, 0x01, 0x81, 0x04, 0x82, 0x03, 
+    0x00, 0x05, 0x82, 0x01, 0x05, 0x07, 0x01, 0x06, 0x03, 0x0c, 0x3a, 0x88, 0x03, 0x01, 0x12, 0x0c, 0x81, 0x03, 0x03, 0x0c, 0x15, 0xde, 
+    0xaf, 0xa3, 0x00, 0x03, 0x02, 0x08, 0xae, 0x28, 0x81, 0x03, 0x82, 0x01, 0x06, 0x07, 0x05, 0x0c, 0x67, 0xff, 0x6a, 0x09, 0x37, 0x02, 
+    0x99, 0x00, 0x87, 0x00, 0x06, 0x02, 0x7d, 0x58, 0x04, 0x19, 0x01, 0x09, 0x81, 0x04, 0x00, 0x2f, 0x81, 0x04, 0x03, 0x06, 0x4f, 0x13, 
+    0x1c, 0x81, 0x5e, 0x00, 0x15, 0x82, 0x41, 0x82, 0x15, 0x82, 0x41, 0x81, 0x15, 0x02, 0xff, 0x0c, 0x02, 0x5e, 0x69, 0x81, 0x15, 0x81, 
+    0x1f, 0x04, 0x20, 0x2f, 0x0a, 0x04, 0x0f, 0x81, 0x01, 0x02, 0x03, 0x0b, 0x3f, 0x82, 0xff, 0xb0, 0x02, 0x02, 0x11, 0x32, 0xdf, 0xb5, 
+    0x00, 0x02, 0x51, 0x8f, 0x4f, 0x81, 0x03, 0x81, 0x07, 0x08, 0x0f, 0x04, 0x03, 0x0c, 0x3c, 0xda, 0x02, 0x00, 0x0d, 0xad, 0x00, 0x04, 
+    0x08, 0xff, 0x6c, 0x2a, 0x43, 0x1c, 0x15, 0x81, 0x1c, 0x00, 0x21, 0x85, 0x28, 0x00, 0x65, 0x81, 0x5a, 0x03, 0x1f, 0x15, 0x28, 0x1f, 
+    0x81, 0xc7, 0x84, 0x03, 0x00, 0x05, 0x82, 0x01, 0x02, 0x07, 0x3a, 0x5a, 0x81, 0x15, 0x04, 0x28, 0x15, 0x1f, 0x5a, 0x28, 0x82, 0x15, 
+    0x82, 0x21, 0x06, 0x1c, 0x21, 0x15, 0x30, 0xf9, 0xff, 0x2f, 0x4b, 0xff, 0x1e, 0xd7, 0xa3, 0x00, 0x03, 0x02, 0xb0, 0x8f, 0x13, 0x81, 
+    0x03, 0x82, 0x01, 0x04, 0x07, 0x05, 0x0c, 0x30, 0xff, 0xeb, 0x19, 0x81, 0x02, 0x99, 0x00, 0x87, 0x00, 0x05, 0x3b, 0xfa, 0xff, 0xad, 
+    0x01, 0xfb, 0x07, 0x05, 0x81, 0x04, 0x07, 0xc7, 0x0a, 0x33, 0x04, 0x5a, 0xff, 0x73, 0x33, 0xff, 0x55, 0x5c, 0x7f, 0x81, 0x9c, 0x83, 
+    0xb1, 0x81, 0x9c, 0x88, 0x80, 0x81, 0x7f, 0x01, 0xe0, 0xb2, 0x81, 0x2c, 0x01, 0x14, 0x04, 0x81, 0x0f, 0x01, 0x06, 0x09, 0x81, 0x0b, 
+    0x06, 0x0e, 0x81, 0x0e, 0x0c, 0x30, 0x7c, 0x02, 0xb4, 0x00, 0x04, 0x82, 0x90, 0x3c, 0x03, 0x09, 0x81, 0x07, 0x06, 0x0f, 0x04, 0x03, 
+    0x0c, 0x40, 0xb3, 0x02, 0xaf, 0x00, 0x01, 0xff, 0x5e, 0xdf, 0xb4, 0x81, 0x6a, 0x03, 0x5f, 0x64, 0x6e, 0x47, 0x84, 0x64, 0x81, 0xff, 
+    0xd4, 0x53, 0x81, 0x47, 0x82, 0x64, 0x04, 0xff, 0xb3, 0x43, 0xc8, 0x12, 0x0a, 0x03, 0x81, 0x04, 0x00, 0x03, 0x82, 0x01, 0x05, 0x06, 
+    0x5a, 0xff, 0x11, 0x2b, 0xff, 0xf4, 0x4b, 0x64, 0x6e, 0x8a, 0x47, 0x06, 0x5f, 0x64, 0x6a, 0x6e, 0xff, 0x70, 0x4b, 0xff, 0xf6, 0x8c, 
+    0x02, 0xa3, 0x00, 0x04, 0x02, 0xc6, 0x7b, 0x0c, 0x03, 0x81, 0x04, 0x81, 0x01, 0x05, 0x07, 0x05, 0x11, 0x42, 0xff, 0x30, 0x4b, 0x02, 
+    0x9a, 0x00, 0x87, 0x00, 0x04, 0xfc, 0x72, 0xff, 0xee, 0x09, 0xfb, 0x05, 0x81, 0x03, 0x08, 0x0a, 0x03, 0x06, 0x03, 0x11, 0x29, 0xff, 
+    0x1c, 0x9e, 0x08, 0x02, 0x82, 0x00, 0x81, 0x02, 0x8b, 0x00, 0x81, 0x02, 0x12, 0x08, 0xfd, 0xff, 0xd5, 0x74, 0xe1, 0xff, 0x2c, 0x12, 
+    0x03, 0x06, 0x05, 0x1b, 0x01, 0x0f, 0x06, 0x17, 0x04, 0x09, 0x53, 0x5b, 0xb5, 0x02, 0xb2, 0x00, 0x06, 0x1e, 0x02, 0xad, 0xff, 0x4d, 
+    0x12, 0x11, 0x03, 0x05, 0x81, 0x19, 0x05, 0x18, 0x04, 0x09, 0x12, 0x1c, 0x54, 0xb1, 0x00, 0x02, 0x02, 0x00, 0x02, 0x81, 0x08, 0x83, 
+    0x02, 0x82, 0x08, 0x82, 0x02, 0x83, 0x08, 0x03, 0xff, 0xbd, 0xb6, 0xe2, 0x5a, 0x03, 0x83, 0x04, 0x07, 0x01, 0x34, 0x04, 0x0c, 0x27, 
+    0xff, 0xda, 0x95, 0x1a, 0x08, 0x81, 0x02, 0x82, 0x08, 0x86, 0x02, 0x82, 0x08, 0x81, 0x02, 0xa5, 0x00, 0x06, 0x02, 0xe3, 0x15, 0x0c, 
+    0x03, 0x05, 0x04, 0x82, 0x01, 0x03, 0x05, 0x10, 0x42, 0x54, 0x9b, 0x00, 0x87, 0x00, 0x04, 0xff, 0x1d, 0xcf, 0xab, 0x20, 0x04, 0x05, 
+    0x81, 0x03, 0x01, 0x0a, 0x05, 0x81, 0x0b, 0x03, 0x0c, 0x3e, 0xc5, 0x02, 0x92, 0x00, 0x82, 0x02, 0x04, 0x1a, 0xff, 0x19, 0xa6, 0xfe, 
+    0x28, 0x1b, 0x81, 0x03, 0x01, 0x06, 0x01, 0x81, 0x4a, 0x05, 0x04, 0x0a, 0x53, 0xff, 0x8e, 0x1a, 0xb5, 0x37, 0xb2, 0x00, 0x81, 0x02, 
+    0x04, 0xff, 0xd1, 0x53, 0xff, 0x2c, 0x0a, 0x11, 0x03, 0x04, 0x81, 0x19, 0x05, 0x04, 0x18, 0x09, 0x12, 0x43, 0xb6, 0xc3, 0x00, 0x04, 
+    0x08, 0xff, 0x1a, 0x9e, 0x24, 0x22, 0x03, 0x85, 0x01, 0x05, 0x04, 0x14, 0x32, 0xfd, 0x08, 0x02, 0x8a, 0x00, 0x81, 0x02, 0x84, 0x00, 
+    0x00, 0x0d, 0xa3, 0x00, 0x06, 0x02, 0x9d, 0x15, 0x0b, 0x03, 0x01, 0x04, 0x82, 0x01, 0x03, 0x05, 0x10, 0x2d, 0xb6, 0x9b, 0x00, 0x87, 
+    0x00, 0x05, 0xb7, 0x2d, 0x0a, 0x04, 0x05, 0x0e, 0x81, 0x04, 0x05, 0x1b, 0x0e, 0x05, 0x13, 0xff, 0x4e, 0x22, 0xff, 0xbe, 0xbe, 0x82, 
+    0x00, 0x00, 0x57, 0x8d, 0x00, 0x00, 0x0d, 0x83, 0x00, 0x81, 0x02, 0x09, 0x38, 0x2c, 0x0c, 0x03, 0x0a, 0x04, 0x17, 0x4a, 0x0f, 0x01, 
+    0x81, 0x03, 0x02, 0x23, 0x1d, 0xb6, 0xb3, 0x00, 0x05, 0x08, 0xb3, 0x5e, 0x11, 0x16, 0x04, 0x81, 0x19, 0x06, 0x18, 0x0a, 0x06, 0x0c, 
+    0x2d, 0x44, 0x02, 0xc2, 0x00, 0x04, 0x02, 0xe4, 0x24, 0x22, 0x04, 0x82, 0x01, 0x81, 0x0e, 0x05, 0x01, 0x03, 0x23, 0x2d, 0x8b, 0x02, 
+    0xb6, 0x00, 0x06, 0x02, 0x08, 0x71, 0x1f, 0x03, 0x05, 0x01, 0x81, 0x04, 0x81, 0x01, 0x04, 0x03, 0x10, 0x91, 0x1a, 0x02, 0x9a, 0x00, 
+    0x87, 0x00, 0x04, 0xe5, 0x3e, 0x2f, 0x04, 0x01, 0x82, 0x07, 0x81, 0x05, 0x03, 0x03, 0x1f, 0x9e, 0x35, 0x98, 0x00, 0x0e, 0x36, 0xff, 
+    0x52, 0x3b, 0x1f, 0x0a, 0x31, 0x18, 0x01, 0x17, 0x01, 0x07, 0x06, 0x03, 0x0c, 0x27, 0xc9, 0x96, 0x00, 0x84, 0x02, 0x97, 0x00, 0x0d, 
+    0x52, 0xff, 0xee, 0x32, 0xff, 0x4d, 0x0a, 0xe6, 0x03, 0x04, 0x34, 0x19, 0x18, 0x09, 0x50, 0x13, 0xff, 0x8a, 0x11, 0x02, 0xc3, 0x00, 
+    0x04, 0x3b, 0xff, 0x96, 0x74, 0x60, 0x2f, 0x04, 0x82, 0x01, 0x00, 0x05, 0x81, 0x0e, 0x04, 0x03, 0x15, 0x73, 0x6b, 0x02, 0x83, 0x00, 
+    0x00, 0x0d, 0x93, 0x00, 0x81, 0x02, 0x00, 0x00, 0x84, 0x02, 0x92, 0x00, 0x00, 0x0d, 0x82, 0x00, 0x03, 0x36, 0xde, 0x13, 0x03, 0x81, 
+    0x01, 0x81, 0x04, 0x81, 0x01, 0x05, 0x03, 0x10, 0xca, 0x02, 0x00, 0x0d, 0x99, 0x00, 0x86, 0x00, 0x04, 0x08, 0xff, 0x37, 0x7d, 0x27, 
+    0x0a, 0x06, 0x81, 0x01, 0x07, 0x06, 0x01, 0x05, 0x0b, 0x03, 0x24, 0xb8, 0x44, 0x97, 0x00, 0x06, 0x0d, 0x02, 0xff, 0x55, 0x64, 0x29, 
+    0x03, 0x05, 0x03, 0x81, 0x01, 0x06, 0x17, 0x04, 0x06, 0x03, 0x3c, 0x26, 0xe4, 0x90, 0x00, 0x0f, 0x02, 0x51, 0xaf, 0xc6, 0x38, 0x54, 
+    0x83, 0xff, 0x34, 0x6c, 0x7f, 0xff, 0x34, 0x6c, 0xff, 0x75, 0x74, 0x54, 0xbf, 0x9f, 0xa0, 0x02, 0x92, 0x00, 0x04, 0xff, 0x7c, 0xae, 
+    0xff, 0xae, 0x22, 0xe6, 0x0b, 0x0e, 0x82, 0x01, 0x04, 0x06, 0x09, 0x0b, 0x40, 0xff, 0x6d, 0x32, 0x83, 0x00, 0x07, 0x02, 0x00, 0x02, 
+    0x00, 0x02, 0xff, 0x1d, 0xd7, 0xff, 0x5b, 0xbe, 0xff, 0xd8, 0xa5, 0x81, 0xcb, 0x04, 0xff, 0x98, 0x95, 0x7d, 0xff, 0x1b, 0xae, 0x98, 
+    0x3b, 0x83, 0x00, 0x00, 0x0d, 0xac, 0x00, 0x05, 0x51, 0xe0, 0x41, 0x0b, 0x04, 0x0f, 0x81, 0x04, 0x06, 0x06, 0x01, 0x05, 0x10, 0x1c, 
+    0x5f, 0x3b, 0x82, 0x00, 0x00, 0x0d, 0x82, 0x00, 0x00, 0x57, 0x83, 0x00, 0x00, 0x0d, 0x86, 0x00, 0x10, 0x02, 0x00, 0x02, 0xbe, 0xc0, 
+    0xff, 0x57, 0x8d, 0x38, 0xfa, 0xcc, 0x83, 0x7f, 0xe7, 0x54, 0xfa, 0x38, 0xcd, 0xfc, 0x81, 0x02, 0x01, 0x00, 0x1e, 0x8f, 0x00, 0x02, 
+    0x74, 0xdd, 0x0c, 0x81, 0x01, 0x08, 0x0f, 0x06, 0x03, 0x05, 0x03, 0x0a, 0x66, 0x8c, 0x02, 0x8a, 0x00, 0x04, 0x1e, 0x00, 0x02, 0x00, 
+    0x02, 0x86, 0x00, 0x00, 0x02, 0x83, 0x00, 0x86, 0x00, 0x04, 0x44, 0xff, 0x34, 0x54, 0x28, 0x03, 0x04, 0x82, 0x01, 0x06, 0x0e, 0x03, 
+    0x11, 0x12, 0x26, 0x92, 0x08, 0x98, 0x00, 0x03, 0x02, 0xe8, 0x15, 0x0c, 0x82, 0x05, 0x02, 0x01, 0x07, 0x06, 0x81, 0x03, 0x03, 0x10, 
+    0x3e, 0xc9, 0x02, 0x83, 0x00, 0x00, 0x0d, 0x87, 0x00, 0x0b, 0x02, 0xe9, 0xc6, 0xff, 0x33, 0x6c, 0x72, 0x73, 0x4e, 0x4b, 0x2d, 0x27, 
+    0x25, 0x29, 0x81, 0x25, 0x06, 0x27, 0x4b, 0x8c, 0x7c, 0xe3, 0x9f, 0x02, 0x81, 0x00, 0x02, 0x1e, 0x00, 0x0d, 0x8a, 0x00, 0x04, 0x02, 
+    0xff, 0x78, 0x8d, 0xce, 0x3c, 0x0e, 0x81, 0x05, 0x1c, 0x04, 0x01, 0x05, 0x1b, 0x11, 0x1c, 0xff, 0x54, 0x74, 0x00, 0x02, 0x00, 0x02, 
+    0x08, 0x1a, 0x82, 0x54, 0x93, 0x7c, 0xde, 0xa8, 0xe1, 0xff, 0x6d, 0x1a, 0x4e, 0xdd, 0x84, 0xff, 0x50, 0x43, 0xac, 0xff, 0x54, 0x74, 
+    0xff, 0xb9, 0xa5, 0x44, 0x81, 0x02, 0x00, 0x1e, 0xab, 0x00, 0x0e, 0xff, 0xde, 0xbe, 0xaa, 0xe6, 0x0b, 0x04, 0x18, 0x04, 0x03, 0x17, 
+    0x01, 0x05, 0x10, 0x27, 0x92, 0x08, 0x85, 0x00, 0x01, 0x8a, 0x57, 0x81, 0x00, 0x00, 0x0d, 0x86, 0x00, 0x08, 0x02, 0x08, 0x36, 0xcf, 
+    0x83, 0xa1, 0xb9, 0x4e, 0x25, 0x81, 0x27, 0x81, 0x25, 0x00, 0x29, 0x81, 0x26, 0x07, 0x4b, 0xb9, 0xff, 0x70, 0x4b, 0xff, 0x53, 0x6c, 
+    0x74, 0x02, 0x00, 0x1e, 0x81, 0x00, 0x00, 0x0d, 0x8b, 0x00, 0x02, 0xff, 0xf6, 0x7c, 0x30, 0x03, 0x81, 0x01, 0x08, 0x06, 0x0f, 0x04, 
+    0x03, 0x11, 0x22, 0xea, 0xac, 0x02, 0x88, 0x00, 0x00, 0x0d, 0x81, 0x00, 0x07, 0xff, 0x9e, 0xdf, 0xff, 0x39, 0xae, 0xff, 0x97, 0x95, 
+    0x82, 0xff, 0xba, 0xa5, 0xff, 0x99, 0x9d, 0xff, 0xba, 0xa5, 0x9f, 0x82, 0xcb, 0x04, 0x9f, 0xff, 0xb8, 0xa5, 0xff, 0x97, 0xa5, 0xff, 
+    0x14, 0x95, 0xff, 0x3d, 0xdf, 0x86, 0x00, 0x0e, 0xa0, 0xeb, 0x13, 0x12, 0x18, 0x04, 0x01, 0x09, 0x05, 0x03, 0x0c, 0x10, 0x3e, 0x82, 
+    0x02, 0x99, 0x00, 0x03, 0xe4, 0x90, 0x3a, 0x06, 0x83, 0x01, 0x06, 0x06, 0x09, 0x0b, 0x10, 0x1d, 0x7a, 0x02, 0x88, 0x00, 0x0b, 0x02, 
+    0x00, 0x02, 0xd0, 0x9c, 0x8e, 0x7b, 0x24, 0x15, 0x40, 0x3c, 0xff, 0x6e, 0x0a, 0x82, 0xc1, 0x81, 0x11, 0x08, 0x0b, 0x11, 0x0c, 0x3c, 
+    0x28, 0xa2, 0xff, 0xae, 0x22, 0xff, 0xf2, 0x5b, 0xcd, 0x81, 0x02, 0x81, 0x00, 0x00, 0x85, 0x89, 0x00, 0x04, 0x02, 0xe7, 0x15, 0x11, 
+    0x0e, 0x81, 0x05, 0x81, 0x04, 0x0f, 0x07, 0x0e, 0x11, 0x1c, 0xec, 0x02, 0x00, 0x02, 0x52, 0xed, 0xff, 0x91, 0x43, 0xa3, 0x2a, 0x60, 
+    0x1f, 0x20, 0x81, 0x2e, 0x81, 0xe6, 0x09, 0x3c, 0x13, 0x28, 0x15, 0x25, 0x4e, 0xee, 0xff, 0xb6, 0x7c, 0x1a, 0x02, 0x81, 0x00, 0x00, 
+    0x8a, 0xa8, 0x00, 0x07, 0xba, 0x43, 0x11, 0x0e, 0x01, 0x18, 0x04, 0x09, 0x81, 0x01, 0x04, 0x03, 0x10, 0x1d, 0xb7, 0x02, 0x87, 0x00, 
+    0x00, 0x0d, 0x84, 0x00, 0x01, 0x85, 0x00, 0x81, 0x02, 0x0a, 0xe5, 0xef, 0x8e, 0x30, 0x15, 0x28, 0x3a, 0x03, 0x0a, 0x03, 0x16, 0x81, 
+    0x10, 0x0a, 0x16, 0x10, 0x0c, 0x13, 0x1f, 0x15, 0x25, 0x5c, 0x93, 0xa4, 0x02, 0x8e, 0x00, 0x02, 0x5f, 0x21, 0x0b, 0x81, 0x05, 0x07, 
+    0x06, 0x0f, 0x01, 0x05, 0x11, 0x12, 0x2d, 0xff, 0x99, 0x9d, 0x8a, 0x00, 0x07, 0x02, 0x46, 0xff, 0xb4, 0x74, 0xfe, 0xff, 0xad, 0x22, 
+    0xff, 0x8e, 0x1a, 0x75, 0xff, 0xb0, 0x2a, 0x81, 0x94, 0x07, 0xa3, 0xdd, 0x75, 0xa8, 0xff, 0x8d, 0x32, 0xff, 0x68, 0x11, 0xff, 0xb0, 
+    0x63, 0xdc, 0x00, 0x57, 0x85, 0x00, 0x05, 0xe9, 0xf9, 0x11, 0x12, 0x0a, 0x04, 0x82, 0x01, 0x81, 0x03, 0x03, 0x14, 0x42, 0xa4, 0x02, 
+    0x99, 0x00, 0x03, 0xff, 0x78, 0x8d, 0x90, 0x0c, 0x06, 0x83, 0x01, 0x08, 0x07, 0x05, 0x0b, 0x10, 0x32, 0x8b, 0x02, 0x00, 0x02, 0x81, 
+    0x00, 0x00, 0x85, 0x81, 0x00, 0x09, 0x1e, 0x00, 0x02, 0x7e, 0xff, 0x12, 0x64, 0xf6, 0x30, 0x15, 0x0c, 0x0a, 0x81, 0x03, 0x00, 0x11, 
+    0x82, 0x3f, 0x07, 0x0e, 0xff, 0xb0, 0x02, 0x1b, 0x0e, 0x07, 0x05, 0x0b, 0x03, 0x81, 0x11, 0x03, 0x1c, 0xaa, 0xfa, 0x08, 0x82, 0x00, 
+    0x00, 0x0d, 0x88, 0x00, 0x02, 0x02, 0x72, 0x21, 0x81, 0x0b, 0x08, 0x05, 0x06, 0x01, 0x07, 0x01, 0x06, 0x03, 0x3e, 0x51, 0x81, 0x02, 
+    0x05, 0x86, 0xff, 0x70, 0x4b, 0xff, 0x2c, 0x12, 0x69, 0x20, 0x03, 0x81, 0x04, 0x01, 0x17, 0xff, 0xb2, 0x02, 0x82, 0x07, 0x0a, 0x0b, 
+    0x03, 0x05, 0x0b, 0x03, 0x13, 0x15, 0x4b, 0xd1, 0x74, 0x08, 0xaa, 0x00, 0x04, 0xff, 0xda, 0x9d, 0x26, 0x53, 0x05, 0x01, 0x81, 0x04, 
+    0x82, 0x01, 0x04, 0x03, 0x3c, 0xff, 0xca, 0x09, 0xff, 0xfd, 0xbe, 0x02, 0x87, 0x00, 0x01, 0x0d, 0x00, 0x81, 0x0d, 0x0b, 0x00, 0x0d, 
+    0x00, 0x02, 0xa4, 0x6a, 0xaa, 0x5e, 0x40, 0x13, 0x11, 0x06, 0x81, 0x07, 0x08, 0x01, 0x0a, 0x09, 0x0b, 0x0c, 0x09, 0x0b, 0x06, 0x05, 
+    0x81, 0x03, 0x05, 0x0c, 0x14, 0x27, 0x5c, 0xff, 0xd5, 0x7c, 0x02, 0x8c, 0x00, 0x03, 0x02, 0x72, 0x21, 0x0b, 0x81, 0x05, 0x09, 0x07, 
+    0x17, 0x01, 0x05, 0x0b, 0x10, 0x2b, 0xbe, 0x00, 0x0d, 0x85, 0x00, 0x07, 0x0d, 0x00, 0x02, 0xbe, 0x5f, 0x95, 0x5e, 0x3c, 0x81, 0x13, 
+    0x00, 0x1f, 0x81, 0x20, 0x07, 0x65, 0x13, 0x30, 0x42, 0xff, 0xe7, 0x00, 0xe3, 0xa0, 0x08, 0x86, 0x00, 0x04, 0x7e, 0x3e, 0x10, 0x03, 
+    0x04, 0x83, 0x01, 0x05, 0x06, 0x03, 0x13, 0xb2, 0x98, 0x02, 0x98, 0x00, 0x05, 0x02, 0xed, 0x40, 0x11, 0x01, 0x17, 0x81, 0x01, 0x00, 
+    0x05, 0x81, 0x0e, 0x03, 0x0b, 0xff, 0xaf, 0x1a, 0xb5, 0x08, 0x87, 0x00, 0x06, 0x02, 0x37, 0xff, 0xb6, 0x7c, 0xff, 0xae, 0x32, 0xff, 
+    0xeb, 0x09, 0x15, 0x03, 0x81, 0x06, 0x01, 0x01, 0x09, 0x82, 0x05, 0x04, 0x06, 0x0e, 0x05, 0x0e, 0x06, 0x82, 0x05, 0x0b, 0x0b, 0x09, 
+    0x06, 0x09, 0x16, 0x15, 0xff, 0xeb, 0x09, 0xcc, 0x08, 0x0d, 0x00, 0x0d, 0x88, 0x00, 0x04, 0x48, 0xae, 0x1f, 0x03, 0x04, 0x81, 0x03, 
+    0x0e, 0x06, 0x01, 0x07, 0x01, 0x3a, 0x27, 0x1a, 0x08, 0xa1, 0x75, 0x29, 0x0c, 0x0b, 0x05, 0x1b, 0x81, 0x06, 0x81, 0x19, 0x82, 0x07, 
+    0x0b, 0x04, 0x03, 0x01, 0x07, 0x05, 0x0b, 0x0c, 0x10, 0x15, 0x4e, 0xff, 0xf6, 0x7c, 0x02, 0xa8, 0x00, 0x04, 0x48, 0xe8, 0x24, 0xc1, 
+    0x0b, 0x81, 0x01, 0x00, 0x04, 0x81, 0x01, 0x05, 0x05, 0x03, 0x40, 0xff, 0x8d, 0x22, 0x4c, 0x02, 0x82, 0x00, 0x00, 0x0d, 0x81, 0x00, 
+    0x00, 0x0d, 0x83, 0x00, 0x0e, 0x02, 0x1e, 0x00, 0x48, 0x83, 0x5c, 0x1c, 0x1f, 0x3c, 0x0c, 0x16, 0x03, 0x05, 0x01, 0x07, 0x81, 0x03, 
+    0x02, 0x0b, 0x03, 0x0b, 0x83, 0x07, 0x81, 0x01, 0x06, 0x33, 0x03, 0x16, 0x15, 0xff, 0x0b, 0x1a, 0xff, 0x73, 0x74, 0x02, 0x8b, 0x00, 
+    0x0d, 0xff, 0x5f, 0xdf, 0x8e, 0x15, 0x03, 0x01, 0x0e, 0x07, 0x19, 0x01, 0x05, 0x03, 0x10, 0x59, 0x08, 0x88, 0x00, 0x07, 0x02, 0x36, 
+    0xff, 0x50, 0x43, 0x2a, 0x15, 0x12, 0x0c, 0x20, 0x81, 0x16, 0x07, 0x03, 0x0a, 0x31, 0x16, 0x30, 0x76, 0xff, 0x38, 0x85, 0x1a, 0x81, 
+    0x02, 0x85, 0x00, 0x0f, 0x02, 0x7d, 0x27, 0x03, 0x0a, 0x04, 0x05, 0x01, 0x07, 0x01, 0x04, 0x0a, 0x21, 0xff, 0x14, 0x5c, 0x44, 0x02, 
+    0x99, 0x00, 0x0d, 0xff, 0xb5, 0x6c, 0x5e, 0x03, 0x09, 0x17, 0x34, 0x01, 0x05, 0x81, 0x0e, 0x3f, 0x53, 0xff, 0x27, 0x01, 0x02, 0x86, 
+    0x00, 0x0b, 0x02, 0x9a, 0x6a, 0x4b, 0x2c, 0x23, 0x11, 0x06, 0x09, 0x01, 0x09, 0x06, 0x81, 0x05, 0x00, 0x04, 0x83, 0x01, 0x02, 0x05, 
+    0x06, 0x04, 0x81, 0x06, 0x09, 0x09, 0x06, 0x01, 0x04, 0x03, 0x13, 0x4b, 0xe3, 0x02, 0x0d, 0x89, 0x00, 0x03, 0xe9, 0xff, 0xd0, 0x32, 
+    0x20, 0x03, 0x81, 0x04, 0x00, 0x05, 0x81, 0x01, 0x81, 0x07, 0x08, 0x03, 0xff, 0xd0, 0x22, 0x1a, 0xff, 0xce, 0x3a, 0x2d, 0x14, 0x0c, 
+    0x0b, 0x06, 0x81, 0x01, 0x81, 0x05, 0x04, 0x09, 0x01, 0x07, 0x19, 0x07, 0x81, 0x04, 0x01, 0x01, 0x05, 0x81, 0x07, 0x05, 0x05, 0x2e, 
+    0x11, 0x15, 0x70, 0x38, 0x83, 0x00, 0x00, 0x0d, 0xa3, 0x00, 0x04, 0x46, 0x47, 0x21, 0x11, 0x0e, 0x84, 0x01, 0x04, 0x05, 0x03, 0x69, 
+    0xff, 0xb1, 0x4b, 0x9a, 0x82, 0x00, 0x00, 0x0d, 0x82, 0x00, 0x00, 0x0d, 0x84, 0x00, 0x0e, 0x02, 0x51, 0xff, 0x2f, 0x4b, 0x4b, 0x15, 
+    0x16, 0x03, 0x0a, 0x12, 0x03, 0x0a, 0x09, 0x01, 0x06, 0x05, 0x81, 0x11, 0x01, 0x03, 0x0b, 0x83, 0x07, 0x09, 0x19, 0x07, 0xff, 0xd2, 
+    0x0a, 0x01, 0x09, 0x11, 0x23, 0xff, 0xca, 0x11, 0xff, 0xd5, 0x7c, 0x02, 0x8a, 0x00, 0x0c, 0xff, 0x3b, 0xb6, 0x8f, 0x13, 0x09, 0x05, 
+    0x0e, 0x06, 0x09, 0x01, 0x06, 0x0c, 0x2c, 0x70, 0x81, 0x02, 0x86, 0x00, 0x08, 0x02, 0xff, 0x1d, 0xc7, 0x73, 0x40, 0x10, 0x12, 0x04, 
+    0x2f, 0x04, 0x81, 0x0a, 0x06, 0x03, 0x0c, 0x16, 0x15, 0x76, 0xff, 0xda, 0x95, 0x08, 0x81, 0x02, 0x00, 0x00, 0x85, 0x00, 0x02, 0x3b, 
+    0x83, 0x1c, 0x81, 0x03, 0x00, 0x04, 0x81, 0x05, 0x00, 0x07, 0x81, 0x01, 0x03, 0x0a, 0x24, 0xff, 0x18, 0x7d, 0x08, 0x99, 0x00, 0x0e, 
+    0x08, 0xff, 0xf2, 0x53, 0x41, 0x03, 0x05, 0x34, 0x01, 0x06, 0x01, 0x81, 0x07, 0x2e, 0x40, 0xff, 0xad, 0x3a, 0x02, 0x83, 0x00, 0x00, 
+    0x57, 0x81, 0x00, 0x0d, 0x4c, 0xeb, 0x1c, 0x10, 0x0c, 0x03, 0x0a, 0x09, 0x03, 0x06, 0x03, 0x06, 0x09, 0x01, 0x84, 0x04, 0x00, 0x33, 
+    0x85, 0x04, 0x07, 0x0f, 0x17, 0x09, 0x03, 0x41, 0x95, 0xff, 0xf9, 0x9d, 0x02, 0x88, 0x00, 0x04, 0x02, 0xec, 0x94, 0x0c, 0x03, 0x81, 
+    0x04, 0x0c, 0x01, 0x07, 0x81, 0x07, 0x0f, 0x09, 0xff, 0xb4, 0x3b, 0xff, 0x92, 0x43, 0x43, 0x13, 0x11, 0x0b, 0x0e, 0x81, 0x05, 0x04, 
+    0x03, 0x04, 0x31, 0x04, 0x05, 0x81, 0x01, 0x0d, 0x18, 0x0a, 0x04, 0x03, 0x05, 0x09, 0x1b, 0x05, 0x0b, 0x05, 0x16, 0x2c, 0x76, 0xff, 
+    0x3b, 0xb6, 0xa7, 0x00, 0x04, 0x36, 0xb9, 0x13, 0x11, 0x05, 0x84, 0x01, 0x04, 0x05, 0x03, 0x29, 0xff, 0xf6, 0x74, 0x37, 0x81, 0x00, 
+    0x00, 0x0d, 0x87, 0x00, 0x0d, 0x02, 0x08, 0x8b, 0x8c, 0x1c, 0x14, 0x03, 0x09, 0x01, 0x04, 0x0a, 0x03, 0x04, 0x06, 0x81, 0x01, 0x02, 
+    0x05, 0x03, 0x11, 0x81, 0x03, 0x01, 0x01, 0x06, 0x81, 0x07, 0x82, 0x05, 0x06, 0x07, 0x01, 0x03, 0x12, 0x15, 0xab, 0xc0, 0x8a, 0x00, 
+    0x0c, 0xcf, 0x90, 0x12, 0x09, 0x01, 0x05, 0x06, 0x09, 0x01, 0x03, 0x0c, 0x1c, 0x8d, 0x81, 0x02, 0x85, 0x00, 0x0a, 0x02, 0xff, 0xfd, 
+    0xbe, 0xff, 0xae, 0x22, 0x40, 0x2e, 0x09, 0x17, 0xff, 0x31, 0x02, 0x18, 0xff, 0x31, 0x0a, 0x04, 0x81, 0x03, 0x03, 0x11, 0x40, 0x43, 
+    0x74, 0x81, 0x02, 0x82, 0x00, 0x85, 0x00, 0x02, 0x6b, 0xff, 0x2f, 0x3b, 0x15, 0x82, 0x03, 0x81, 0x05, 0x81, 0x01, 0x04, 0x0f, 0x12, 
+    0x26, 0xff, 0xba, 0x95, 0x02, 0x99, 0x00, 0x06, 0xff, 0x9b, 0xbe, 0xff, 0x71, 0x3b, 0x41, 0x03, 0x06, 0x01, 0x0f, 0x81, 0x06, 0x04, 
+    0x01, 0x07, 0x0b, 0x25, 0xff, 0xb4, 0x7c, 0x86, 0x00, 0x07, 0xa0, 0xff, 0x4d, 0x2a, 0x1c, 0x0c, 0x03, 0x06, 0x09, 0x04, 0x81, 0x03, 
+    0x00, 0x0a, 0x81, 0x03, 0x08, 0x09, 0x03, 0x31, 0x0a, 0x22, 0x2f, 0x0a, 0x2f, 0x33, 0x81, 0x17, 0x82, 0x01, 0x00, 0x04, 0x81, 0x18, 
+    0x05, 0x06, 0x0b, 0x69, 0xff, 0x2f, 0x3b, 0x1a, 0x02, 0x87, 0x00, 0x05, 0x02, 0xfa, 0xff, 0x4d, 0x12, 0x0c, 0x03, 0x04, 0x81, 0x01, 
+    0x09, 0x07, 0x05, 0x01, 0x06, 0x04, 0x50, 0x41, 0xce, 0x11, 0x1b, 0x81, 0x05, 0x01, 0x1b, 0x09, 0x81, 0x03, 0x81, 0x0a, 0x83, 0x03, 
+    0x81, 0x18, 0x03, 0x0a, 0x06, 0x0b, 0x03, 0x82, 0x05, 0x04, 0x03, 0x10, 0x25, 0xff, 0xcb, 0x19, 0x02, 0xa5, 0x00, 0x05, 0x02, 0xb7, 
+    0x42, 0x13, 0x0b, 0x05, 0x83, 0x01, 0x05, 0x07, 0x03, 0x0c, 0x27, 0x82, 0x08, 0x89, 0x00, 0x08, 0x1e, 0x02, 0x8b, 0x95, 0x1c, 0x14, 
+    0x0b, 0x04, 0x01, 0x81, 0x06, 0x82, 0x04, 0x03, 0x01, 0x07, 0x06, 0x03, 0x81, 0x11, 0x01, 0x0c, 0x0a, 0x81, 0x09, 0x0c, 0x01, 0x06, 
+    0x0b, 0x03, 0x05, 0x03, 0x01, 0x04, 0x0a, 0x0c, 0x96, 0x9e, 0x02, 0x88, 0x00, 0x0e, 0x02, 0xff, 0x33, 0x6c, 0x1c, 0x16, 0x03, 0x06, 
+    0x03, 0x05, 0x01, 0x05, 0x09, 0x16, 0x2d, 0x92, 0x02, 0x83, 0x00, 0x0b, 0x0d, 0x00, 0x02, 0x5d, 0x4e, 0x15, 0x11, 0x05, 0x39, 0x0f, 
+    0x4a, 0x18, 0x81, 0x04, 0x05, 0x0a, 0x10, 0x29, 0xfe, 0xff, 0x7b, 0xae, 0x02, 0x84, 0x00, 0x85, 0x00, 0x02, 0x4c, 0xff, 0xeb, 0x11, 
+    0x14, 0x81, 0x03, 0x81, 0x05, 0x82, 0x01, 0x04, 0x04, 0x12, 0x25, 0x7a, 0x02, 0x93, 0x00, 0x02, 0x1e, 0x00, 0x0d, 0x82, 0x00, 0x01, 
+    0xc4, 0x1c, 0x81, 0x03, 0x01, 0x05, 0x01, 0x81, 0x04, 0x00, 0x06, 0x81, 0x01, 0x02, 0x0c, 0x32, 0xfc, 0x83, 0x00, 0x16, 0x02, 0x00, 
+    0x52, 0xff, 0x4d, 0x2a, 0xea, 0x0c, 0x03, 0x05, 0x06, 0x05, 0x09, 0x03, 0x0b, 0x20, 0x03, 0x0b, 0x2e, 0x0c, 0x41, 0x15, 0x21, 0x29, 
+    0x14, 0x81, 0x0a, 0x00, 0x33, 0x81, 0x01, 0x81, 0x07, 0x07, 0x05, 0x0a, 0x2f, 0x33, 0x06, 0x4f, 0x5e, 0xff, 0xf5, 0x7c, 0x81, 0x02, 
+    0x86, 0x00, 0x02, 0x08, 0x6e, 0x69, 0x81, 0x03, 0x02, 0x01, 0x07, 0x01, 0x81, 0x07, 0x17, 0x01, 0x04, 0xff, 0x31, 0x02, 0x17, 0x05, 
+    0x3f, 0x01, 0x07, 0x09, 0x0b, 0x11, 0x0a, 0x31, 0x0a, 0x2f, 0x0a, 0x0c, 0x16, 0x0c, 0x04, 0x01, 0x39, 0x06, 0x0f, 0x81, 0x03, 0x81, 
+    0x05, 0x05, 0x07, 0x05, 0x03, 0x1f, 0xbb, 0xff, 0x33, 0x6c, 0x81, 0x00, 0x00, 0x8a, 0xa2, 0x00, 0x05, 0x02, 0xff, 0x7c, 0xae, 0x26, 
+    0x14, 0x03, 0x0b, 0x81, 0x01, 0x07, 0x07, 0x17, 0x05, 0x03, 0x16, 0x1d, 0xb7, 0x02, 0x89, 0x00, 0x05, 0x02, 0x52, 0x70, 0x2a, 0x12, 
+    0x03, 0x81, 0x04, 0x82, 0x01, 0x06, 0x09, 0x06, 0x05, 0x07, 0x06, 0x3a, 0x5a, 0x81, 0x21, 0x05, 0x1f, 0x14, 0x0a, 0x31, 0x04, 0x09, 
+    0x83, 0x03, 0x00, 0x04, 0x81, 0x18, 0x03, 0x0a, 0xff, 0x30, 0x12, 0xd6, 0xff, 0x58, 0x95, 0x81, 0x00, 0x00, 0x0d, 0x85, 0x00, 0x07, 
+    0x02, 0x6e, 0x15, 0x0a, 0x06, 0x05, 0x06, 0x09, 0x81, 0x06, 0x05, 0x0a, 0x23, 0xbc, 0x36, 0x02, 0x1e, 0x81, 0x00, 0x82, 0x02, 0x10, 
+    0xc0, 0x42, 0x30, 0x0c, 0x0a, 0x06, 0x09, 0x04, 0x09, 0x06, 0x18, 0x04, 0xa5, 0x26, 0x73, 0xb0, 0x02, 0x85, 0x00, 0x84, 0x00, 0x03, 
+    0x02, 0x6d, 0x1d, 0x0c, 0x81, 0x03, 0x81, 0x05, 0x82, 0x01, 0x03, 0x18, 0x20, 0xdd, 0xa4, 0x92, 0x00, 0x00, 0x1e, 0x81, 0x00, 0x00, 
+    0x0d, 0x82, 0x00, 0x08, 0x36, 0x6a, 0x21, 0x03, 0x0a, 0x03, 0x06, 0x1b, 0x09, 0x81, 0x01, 0x04, 0x04, 0x10, 0xf9, 0x02, 0x0d, 0x82, 
+    0x00, 0x1a, 0x02, 0x08, 0xff, 0xce, 0x3a, 0x27, 0x14, 0x03, 0x04, 0x05, 0x06, 0x05, 0x1b, 0x05, 0x0a, 0x12, 0x14, 0x13, 0x69, 0x1c, 
+    0x73, 0xef, 0xe7, 0xe0, 0x4e, 0x1d, 0x12, 0x03, 0x04, 0x82, 0x07, 0x08, 0x05, 0x03, 0x0a, 0x39, 0x01, 0x0b, 0x41, 0xff, 0x0e, 0x3b, 
+    0x02, 0x87, 0x00, 0x04, 0x08, 0xff, 0x71, 0x43, 0x29, 0x03, 0x06, 0x81, 0x01, 0x0e, 0x07, 0x05, 0x07, 0x03, 0x04, 0x39, 0x01, 0x07, 
+    0x05, 0x01, 0x09, 0x16, 0x0c, 0x23, 0x15, 0x82, 0x24, 0x0a, 0x29, 0x1c, 0x15, 0x10, 0x50, 0x01, 0x19, 0x34, 0x04, 0x06, 0x03, 0x81, 
+    0x07, 0x07, 0x01, 0x05, 0x04, 0x14, 0x7b, 0x59, 0x02, 0x77, 0xa3, 0x00, 0x04, 0x08, 0xff, 0x98, 0x8d, 0x26, 0x12, 0x03, 0x81, 0x05, 
+    0x82, 0x07, 0x04, 0x05, 0x03, 0x1f, 0xda, 0x98, 0x8a, 0x00, 0x19, 0x08, 0xff, 0x4c, 0x22, 0x21, 0x22, 0x09, 0x01, 0x17, 0x0f, 0x01, 
+    0x06, 0x04, 0x50, 0x0b, 0x11, 0x41, 0x24, 0x2a, 0xd2, 0xff, 0xf4, 0x5b, 0xff, 0x14, 0x5c, 0xff, 0x52, 0x43, 0x2a, 0x24, 0x1f, 0x12, 
+    0x0a, 0x84, 0x03, 0x82, 0x04, 0x03, 0x0a, 0xa6, 0xff, 0x10, 0x43, 0x02, 0x85, 0x00, 0x08, 0x0d, 0x00, 0x3b, 0x72, 0x41, 0x03, 0x06, 
+    0x01, 0x05, 0x82, 0x01, 0x02, 0x16, 0xce, 0xb5, 0x81, 0x02, 0x0d, 0x00, 0x77, 0x00, 0x02, 0x08, 0xff, 0xda, 0x9d, 0xff, 0xcc, 0x11, 
+    0x15, 0x20, 0x12, 0x2f, 0x0a, 0x04, 0x06, 0x81, 0x03, 0x05, 0x50, 0x14, 0x58, 0xee, 0xf7, 0x02, 0x86, 0x00, 0x84, 0x00, 0x05, 0x02, 
+    0xff, 0x1b, 0x9e, 0x26, 0x03, 0x04, 0x03, 0x81, 0x05, 0x82, 0x01, 0x03, 0x03, 0x21, 0xee, 0x36, 0x92, 0x00, 0x81, 0x0d, 0x81, 0x00, 
+    0x0b, 0x0d, 0x1e, 0x02, 0xf8, 0x2d, 0x20, 0x0a, 0x06, 0x03, 0x0b, 0x09, 0x06, 0x81, 0x04, 0x0c, 0x03, 0x26, 0x54, 0x02, 0x77, 0x00, 
+    0x02, 0x00, 0x02, 0xe7, 0x27, 0xff, 0xb0, 0x1a, 0x3a, 0x81, 0x06, 0x0c, 0x05, 0x06, 0x05, 0x33, 0x06, 0x03, 0x23, 0x1d, 0x5c, 0xff, 
+    0xfa, 0x9d, 0xff, 0x7f, 0xcf, 0x52, 0x1a, 0x81, 0x37, 0x10, 0x6c, 0xff, 0x7c, 0xae, 0x4b, 0x69, 0x0c, 0x03, 0x0e, 0x05, 0x06, 0x03, 
+    0x0a, 0x01, 0x19, 0x05, 0x13, 0xff, 0xae, 0x32, 0xcd, 0x87, 0x00, 0x05, 0xff, 0x3e, 0xc7, 0x8e, 0x40, 0x11, 0x05, 0x01, 0x82, 0x07, 
+    0x03, 0x01, 0x03, 0x04, 0x0f, 0x81, 0x07, 0x17, 0x06, 0x04, 0x12, 0x24, 0x2b, 0x95, 0x5f, 0xff, 0x59, 0x85, 0xff, 0xdb, 0x95, 0xff, 
+    0xba, 0x95, 0xd3, 0x6e, 0x95, 0x3e, 0x13, 0x09, 0x01, 0x19, 0x34, 0x06, 0x09, 0x06, 0x07, 0x05, 0x81, 0x04, 0x03, 0x12, 0x14, 0x2d, 
+    0xc6, 0xa4, 0x00, 0x03, 0x52, 0xe7, 0x60, 0x31, 0x82, 0x05, 0x82, 0x07, 0x04, 0x03, 0x16, 0x15, 0x9e, 0xa0, 0x88, 0x00, 0x06, 0x1e, 
+    0x02, 0xff, 0x90, 0x53, 0x2d, 0xc8, 0x0a, 0xff, 0xd2, 0x12, 0x81, 0x09, 0x14, 0x01, 0x06, 0x09, 0x31, 0x0c, 0x15, 0xff, 0xaa, 0x01, 
+    0xff, 0xee, 0x32, 0xff, 0xd9, 0x9d, 0x6b, 0x3b, 0x48, 0x37, 0x6c, 0x9a, 0xff, 0x3c, 0x9e, 0x4e, 0x25, 0x14, 0x16, 0x03, 0x81, 0x04, 
+    0x81, 0x03, 0x81, 0x04, 0x03, 0x09, 0x13, 0xb9, 0xf0, 0x84, 0x00, 0x00, 0x0d, 0x81, 0x00, 0x02, 0x5d, 0xb2, 0x13, 0x81, 0x06, 0x08, 
+    0x01, 0x04, 0x09, 0x07, 0x05, 0x03, 0x67, 0xff, 0x48, 0x09, 0x02, 0x82, 0x00, 0x14, 0x02, 0x08, 0xff, 0x78, 0x8d, 0x26, 0x66, 0x0c, 
+    0x03, 0x0a, 0x22, 0xc7, 0x33, 0x03, 0x3f, 0xe6, 0x3c, 0x32, 0x93, 0x46, 0x02, 0x77, 0x0d, 0x85, 0x00, 0x82, 0x00, 0x06, 0x0d, 0x00, 
+    0x08, 0xff, 0x96, 0x6c, 0x1f, 0x0a, 0x03, 0x82, 0x05, 0x81, 0x01, 0x06, 0x04, 0x03, 0x25, 0x54, 0x48, 0x00, 0x0d, 0x92, 0x00, 0x08, 
+    0x0d, 0x00, 0x1e, 0x02, 0xff, 0xfb, 0xa5, 0x4b, 0x2c, 0x03, 0x17, 0x81, 0x09, 0x07, 0x0b, 0x06, 0x09, 0x06, 0x0a, 0x14, 0xff, 0xe8, 
+    0x00, 0x37, 0x83, 0x00, 0x05, 0x02, 0xa4, 0x1d, 0x10, 0x2e, 0x07, 0x81, 0x01, 0x09, 0x39, 0x06, 0x1b, 0x06, 0x03, 0x21, 0x5b, 0xff, 
+    0x1b, 0x9e, 0x1a, 0x08, 0x82, 0x02, 0x00, 0x00, 0x81, 0x02, 0x07, 0x08, 0x1a, 0xb1, 0xa2, 0x53, 0x0b, 0x06, 0x05, 0x81, 0x03, 0x05, 
+    0x01, 0x07, 0x01, 0x12, 0x5b, 0xff, 0x33, 0x6c, 0x81, 0x00, 0x00, 0x0d, 0x84, 0x00, 0x04, 0xe5, 0xff, 0xae, 0x22, 0x13, 0x11, 0x05, 
+    0x83, 0x01, 0x0b, 0x09, 0x06, 0x03, 0x05, 0x50, 0x2e, 0x11, 0x1f, 0x26, 0xb8, 0x6c, 0x1a, 0x82, 0x08, 0x00, 0x02, 0x81, 0x08, 0x08, 
+    0x1a, 0xff, 0x5c, 0xa6, 0xa3, 0x28, 0x31, 0x39, 0x01, 0x0f, 0x04, 0x82, 0x01, 0x81, 0x05, 0x04, 0x0a, 0x03, 0x23, 0xc2, 0x02, 0xa3, 
+    0x00, 0x04, 0x36, 0xff, 0x50, 0x3b, 0x13, 0x0a, 0x09, 0x81, 0x06, 0x00, 0x07, 0x81, 0x0e, 0x04, 0x03, 0x0c, 0x25, 0xff, 0x55, 0x6c, 
+    0x9b, 0x89, 0x00, 0x06, 0xec, 0x32, 0x23, 0x12, 0x06, 0x09, 0x05, 0x81, 0x06, 0x08, 0x04, 0x31, 0x14, 0x25, 0x5c, 0x82, 0x08, 0x00, 
+    0x02, 0x82, 0x00, 0x81, 0x02, 0x81, 0x08, 0x05, 0x9e, 0x1c, 0x10, 0x3a, 0x04, 0x01, 0x84, 0x05, 0x02, 0x2e, 0x7b, 0x54, 0x87, 0x00, 
+    0x02, 0xc9, 0x75, 0x0c, 0x81, 0x05, 0x02, 0x06, 0x0f, 0x04, 0x81, 0x07, 0x0d, 0x0c, 0x1c, 0xff, 0x0f, 0x4b, 0x02, 0x00, 0x0d, 0x00, 
+    0x02, 0x9d, 0x26, 0x14, 0x04, 0x06, 0xff, 0x0f, 0x02, 0x81, 0x2f, 0x07, 0x18, 0x04, 0x0b, 0xff, 0xaf, 0x0a, 0xff, 0x8e, 0x12, 0xff, 
+    0xa9, 0x01, 0xed, 0x08, 0x82, 0x00, 0x00, 0x0d, 0x81, 0x00, 0x00, 0x0d, 0x82, 0x00, 0x84, 0x00, 0x04, 0x44, 0xd2, 0x5a, 0x0a, 0x03, 
+    0x81, 0x05, 0x82, 0x01, 0x04, 0x04, 0x16, 0x3e, 0xc3, 0x02, 0x94, 0x00, 0x12, 0x1e, 0x00, 0x02, 0xbd, 0xff, 0x4c, 0x1a, 0x30, 0x10, 
+    0x09, 0x33, 0x17, 0x06, 0xf1, 0x03, 0x06, 0x33, 0x14, 0x2d, 0xb4, 0x02, 0x82, 0x00, 0x10, 0x02, 0x08, 0xca, 0x23, 0xa7, 0x05, 0x1b, 
+    0x01, 0x06, 0x01, 0x07, 0x09, 0x03, 0x24, 0xff, 0xd0, 0x32, 0x5d, 0x08, 0x81, 0x02, 0x85, 0x00, 0x81, 0x02, 0x10, 0x08, 0xa8, 0x30, 
+    0x0c, 0x04, 0x06, 0x0e, 0x05, 0x06, 0x01, 0x04, 0x12, 0x78, 0x9d, 0x02, 0x00, 0x0d, 0x83, 0x00, 0x04, 0x02, 0xd3, 0x30, 0x3c, 0x03, 
+    0x84, 0x01, 0x0c, 0x06, 0x09, 0x03, 0x06, 0x4f, 0x23, 0x43, 0xfe, 0x9a, 0x08, 0x02, 0x00, 0x02, 0x84, 0x00, 0x81, 0x02, 0x06, 0x6c, 
+    0xff, 0x72, 0x4b, 0xd7, 0x0c, 0x06, 0x09, 0x06, 0x84, 0x01, 0x04, 0x06, 0x03, 0x13, 0x32, 0x08, 0xa3, 0x00, 0x0e, 0xfd, 0xff, 0x0b, 
+    0x12, 0x14, 0x03, 0x09, 0x01, 0x06, 0x07, 0x05, 0x0e, 0x03, 0x14, 0x27, 0xff, 0x79, 0x95, 0x02, 0x88, 0x00, 0x03, 0x08, 0xbc, 0xe2, 
+    0x12, 0x81, 0x09, 0x08, 0x03, 0x0b, 0x05, 0x09, 0x04, 0xff, 0xb1, 0x1a, 0x26, 0xff, 0x10, 0x43, 0xf0, 0x84, 0x00, 0x01, 0x1e, 0x02, 
+    0x82, 0x00, 0x05, 0x02, 0x08, 0xff, 0xeb, 0x11, 0x2c, 0x50, 0x05, 0x81, 0x01, 0x81, 0x05, 0x81, 0x0e, 0x02, 0x05, 0x65, 0xee, 0x82, 
+    0x00, 0x00, 0x0d, 0x82, 0x00, 0x03, 0x02, 0xb8, 0x25, 0x12, 0x81, 0x05, 0x82, 0x01, 0x0e, 0x07, 0x05, 0x16, 0x26, 0xdb, 0x02, 0x9b, 
+    0x00, 0x08, 0xff, 0xef, 0x42, 0x2d, 0x13, 0x31, 0x01, 0x07, 0x81, 0x01, 0x06, 0x04, 0x0f, 0x03, 0x11, 0xff, 0x2d, 0x02, 0xff, 0xca, 
+    0x01, 0xff, 0xd8, 0x95, 0x81, 0x02, 0x02, 0x00, 0x0d, 0x77, 0x82, 0x00, 0x00, 0x0d, 0x82, 0x00, 0x00, 0x0d, 0x83, 0x00, 0x03, 0x44, 
+    0x2a, 0x20, 0x03, 0x82, 0x05, 0x82, 0x01, 0x05, 0x03, 0x13, 0x43, 0x74, 0x02, 0x0d, 0x93, 0x00, 0x13, 0x02, 0x08, 0xff, 0xda, 0x95, 
+    0xff, 0xeb, 0x09, 0x40, 0x53, 0x0c, 0x05, 0x39, 0x04, 0x01, 0x33, 0x09, 0x01, 0x50, 0x13, 0x61, 0x08, 0x02, 0x77, 0x81, 0x00, 0x04, 
+    0x02, 0x55, 0x1d, 0x10, 0x3f, 0x81, 0x05, 0x82, 0x01, 0x04, 0x05, 0x31, 0x29, 0x5c, 0x5d, 0x81, 0x02, 0x86, 0x00, 0x00, 0x0d, 0x81, 
+    0x00, 0x0e, 0x08, 0x1a, 0x4d, 0x10, 0x03, 0x01, 0x07, 0x0e, 0x05, 0x04, 0x0f, 0x0a, 0x1f, 0xae, 0x68, 0x86, 0x00, 0x04, 0xef, 0x15, 
+    0x12, 0x03, 0x09, 0x81, 0x01, 0x0c, 0x17, 0x04, 0x0f, 0x04, 0x06, 0x3f, 0x53, 0x70, 0x71, 0x08, 0x02, 0x00, 0x02, 0x87, 0x00, 0x81, 
+    0x02, 0x0f, 0x52, 0xd1, 0x69, 0x16, 0x03, 0x05, 0x01, 0x17, 0x01, 0x06, 0x01, 0x09, 0x05, 0x0c, 0x25, 0xc5, 0xa2, 0x00, 0x08, 0x02, 
+    0xff, 0xbd, 0xb6, 0x91, 0x10, 0x06, 0x04, 0x09, 0x01, 0x07, 0x81, 0x0e, 0x03, 0x03, 0xa5, 0x1d, 0xb6, 0x88, 0x00, 0x07, 0x02, 0x54, 
+    0x1d, 0x22, 0x05, 0x01, 0x07, 0x1b, 0x81, 0x05, 0x04, 0x06, 0x12, 0x60, 0xff, 0xf0, 0x3a, 0x35, 0x81, 0x00, 0x00, 0x8a, 0x84, 0x00, 
+    0x81, 0x57, 0x81, 0x00, 0x04, 0x08, 0xa9, 0x1d, 0x13, 0x05, 0x81, 0x01, 0x81, 0x05, 0x05, 0x0e, 0x07, 0x0e, 0x3a, 0xd2, 0x08, 0x85, 
+    0x00, 0x21, 0x02, 0xef, 0x25, 0x16, 0x04, 0x06, 0x01, 0x04, 0x01, 0x07, 0x05, 0xff, 0xb1, 0x1a, 0x1d, 0xbd, 0x08, 0x02, 0x08, 0xc2, 
+    0x43, 0x2c, 0x03, 0x04, 0x01, 0x09, 0x07, 0x01, 0x04, 0x0a, 0x12, 0x29, 0xff, 0xeb, 0x09, 0xff, 0x1a, 0x9e, 0x08, 0x02, 0x8a, 0x00, 
+    0x82, 0x00, 0x05, 0x0d, 0x00, 0x51, 0x58, 0x31, 0x03, 0x82, 0x05, 0x83, 0x01, 0x02, 0x3a, 0xff, 0xf1, 0x22, 0xff, 0xbd, 0xae, 0x81, 
+    0x02, 0x00, 0x00, 0x88, 0x02, 0x82, 0x00, 0x86, 0x02, 0x09, 0xc0, 0x73, 0x27, 0x16, 0x03, 0x0a, 0x06, 0x07, 0x05, 0x01, 0x82, 0x04, 
+    0x04, 0x06, 0x3a, 0x27, 0xd3, 0x08, 0x81, 0x00, 0x81, 0x1e, 0x06, 0x02, 0x32, 0x40, 0x53, 0x3f, 0x09, 0x06, 0x81, 0x04, 0x04, 0x07, 
+    0x0b, 0x15, 0x95, 0xff, 0xb9, 0xa5, 0x81, 0x02, 0x88, 0x00, 0x10, 0x0d, 0x00, 0x1e, 0x02, 0x8c, 0x15, 0x0c, 0x05, 0x0e, 0x07, 0x03, 
+    0x0a, 0x04, 0x09, 0x65, 0xff, 0x31, 0x33, 0xb0, 0x85, 0x00, 0x08, 0x02, 0x6e, 0x96, 0x20, 0x04, 0x06, 0x01, 0x0f, 0x04, 0x81, 0x18, 
+    0x04, 0x06, 0x09, 0x11, 0xff, 0xeb, 0x09, 0xff, 0x6c, 0x32, 0x81, 0x00, 0x00, 0x1e, 0x8a, 0x00, 0x09, 0x1e, 0x02, 0x7d, 0xe1, 0x13, 
+    0x03, 0x05, 0x01, 0x17, 0x01, 0x81, 0x19, 0x04, 0x01, 0x06, 0x16, 0x2d, 0x55, 0xa2, 0x00, 0x08, 0x02, 0x82, 0x3e, 0x11, 0x05, 0x04, 
+    0x17, 0x04, 0x07, 0x81, 0x0e, 0x03, 0x0a, 0x66, 0x42, 0xdf, 0x88, 0x00, 0x05, 0x02, 0xff, 0xc7, 0x00, 0x66, 0x04, 0x19, 0x05, 0x81, 
+    0x07, 0x81, 0x05, 0x03, 0x12, 0x1f, 0xab, 0x74, 0x81, 0x02, 0x87, 0x00, 0x00, 0x0d, 0x81, 0x00, 0x06, 0x02, 0x08, 0xff, 0xeb, 0x11, 
+    0x14, 0x0a, 0x01, 0x04, 0x81, 0x03, 0x00, 0x04, 0x81, 0x01, 0x06, 0x33, 0xff, 0xd1, 0x2a, 0xff, 0x5f, 0xdf, 0x00, 0x0d, 0x00, 0x0d, 
+    0x81, 0x00, 0x0c, 0x3b, 0x5f, 0x2a, 0x03, 0x09, 0x01, 0x06, 0x09, 0x1b, 0x05, 0x06, 0x14, 0x61, 0x81, 0x08, 0x07, 0x1a, 0x70, 0x2a, 
+    0x14, 0x16, 0x03, 0x05, 0x06, 0x81, 0x0e, 0x05, 0x0b, 0x03, 0x10, 0x25, 0x8c, 0xb7, 0x81, 0x02, 0x02, 0x00, 0x0d, 0x00, 0x81, 0x0d, 
+    0x86, 0x00, 0x84, 0x00, 0x03, 0xb0, 0x58, 0x31, 0x04, 0x82, 0x0e, 0x83, 0x01, 0x06, 0x05, 0x16, 0xff, 0x51, 0x33, 0x72, 0xa1, 0xff, 
+    0x31, 0x4b, 0xff, 0x92, 0x53, 0x86, 0x7c, 0x03, 0xa1, 0xff, 0x31, 0x4b, 0xff, 0x30, 0x53, 0xff, 0x31, 0x53, 0x82, 0xa1, 0x08, 0x72, 
+    0x71, 0xff, 0x8e, 0x32, 0xff, 0xab, 0x19, 0x2b, 0x15, 0x0c, 0x09, 0x01, 0x81, 0x0f, 0x09, 0x06, 0x07, 0x0f, 0x01, 0x18, 0xfb, 0x03, 
+    0x13, 0xff, 0xeb, 0x11, 0x1a, 0x84, 0x00, 0x0d, 0xec, 0x3e, 0x10, 0xa7, 0x03, 0x50, 0x0a, 0x09, 0x06, 0x03, 0x4f, 0x43, 0xe3, 0x02, 
+    0x88, 0x00, 0x00, 0x0d, 0x83, 0x00, 0x08, 0x02, 0xf8, 0x26, 0xa7, 0x0b, 0x05, 0x07, 0x03, 0x0a, 0x81, 0x04, 0x04, 0x3a, 0xa3, 0xff, 
+    0x3a, 0xae, 0x00, 0x0d, 0x83, 0x00, 0x04, 0xff, 0x5f, 0xdf, 0xff, 0x31, 0x43, 0x1f, 0x12, 0x04, 0x82, 0x01, 0x00, 0x0f, 0x82, 0x04, 
+    0x03, 0x0b, 0x40, 0xff, 0xca, 0x11, 0x02, 0x8e, 0x00, 0x81, 0x02, 0x03, 0x8d, 0x1c, 0x03, 0x06, 0x84, 0x01, 0x04, 0x07, 0x05, 0x0c, 
+    0x2a, 0x93, 0xa2, 0x00, 0x05, 0x9b, 0xff, 0x95, 0x6c, 0xa2, 0x16, 0x0b, 0x05, 0x81, 0x01, 0x08, 0x05, 0x0e, 0xff, 0xb0, 0x0a, 0x03, 
+    0x21, 0x8e, 0xf0, 0x00, 0x0d, 0x84, 0x00, 0x0f, 0x77, 0x00, 0xff, 0x95, 0x7c, 0x26, 0x0a, 0x17, 0x34, 0x07, 0x1b, 0x05, 0x0e, 0x03, 
+    0x12, 0x25, 0x83, 0x02, 0x8d, 0x00, 0x04, 0x02, 0xff, 0x55, 0x64, 0x21, 0x03, 0x04, 0x81, 0x01, 0x00, 0x09, 0x82, 0x04, 0x02, 0x33, 
+    0xff, 0xf1, 0x2a, 0xff, 0x7c, 0xbe, 0x85, 0x00, 0x0c, 0x98, 0xff, 0x31, 0x43, 0x21, 0x03, 0x06, 0x05, 0x01, 0x07, 0x33, 0x1b, 0x0b, 
+    0x1f, 0x1d, 0x81, 0x1a, 0x04, 0x59, 0x1c, 0x0c, 0x03, 0x09, 0x81, 0x05, 0x07, 0x06, 0x1b, 0x0b, 0x11, 0x13, 0x43, 0xff, 0xcf, 0x3a, 
+    0x98, 0x8e, 0x00, 0x83, 0x00, 0x03, 0x02, 0x86, 0x21, 0x33, 0x84, 0x07, 0x81, 0x01, 0x04, 0x04, 0x06, 0x03, 0x13, 0x41, 0x83, 0x21, 
+    0x82, 0x1c, 0x81, 0x25, 0x82, 0x96, 0x81, 0xff, 0xcd, 0x11, 0x01, 0x96, 0x21, 0x81, 0x28, 0x81, 0x21, 0x02, 0x2c, 0x12, 0x2f, 0x81, 
+    0x09, 0x04, 0x04, 0x2f, 0x0a, 0x09, 0x07, 0x81, 0x17, 0x05, 0x05, 0x0a, 0x2c, 0x4d, 0x9a, 0x08, 0x83, 0x00, 0x05, 0x02, 0xff, 0xc9, 
+    0x19, 0x30, 0x16, 0x2e, 0x06, 0x81, 0x09, 0x06, 0x39, 0x06, 0x03, 0x15, 0x73, 0xa4, 0x02, 0x89, 0x00, 0x00, 0x0d, 0x82, 0x00, 0x0d, 
+    0x02, 0xdf, 0x2b, 0x14, 0x06, 0x01, 0x07, 0x0b, 0x2e, 0x01, 0x09, 0x20, 0x94, 0x9f, 0x85, 0x00, 0x04, 0xff, 0x5b, 0xbe, 0xff, 0xcf, 
+    0x3a, 0x2c, 0x0a, 0x03, 0x81, 0x01, 0x00, 0x17, 0x81, 0x09, 0x05, 0x06, 0x0a, 0x14, 0x91, 0x6c, 0x02, 0x8f, 0x00, 0x04, 0x02, 0xff, 
+    0x94, 0x74, 0x5b, 0x0c, 0x01, 0x81, 0x07, 0x82, 0x01, 0x04, 0x07, 0x06, 0x0c, 0x1c, 0x9d, 0x83, 0x00, 0x00, 0x02, 0x81, 0x08, 0x85, 
+    0x1a, 0x82, 0x08, 0x84, 0x1a, 0x88, 0x08, 0x81, 0x02, 0x82, 0x00, 0x02, 0x46, 0x6a, 0x29, 0x81, 0x0b, 0x00, 0x05, 0x82, 0x01, 0x05, 
+    0x07, 0x05, 0x11, 0x1c, 0xff, 0xf2, 0x5b, 0x46, 0x84, 0x00, 0x00, 0x57, 0x81, 0x00, 0x0d, 0x02, 0x59, 0x2c, 0x0a, 0x04, 0x19, 0x07, 
+    0x05, 0x0e, 0xff, 0xb0, 0x0a, 0x4f, 0x15, 0xd1, 0xf7, 0x8d, 0x00, 0x04, 0x1e, 0x00, 0xc9, 0x29, 0x03, 0x82, 0x01, 0x06, 0x07, 0x01, 
+    0x05, 0x03, 0x3a, 0x8f, 0xaf, 0x85, 0x00, 0x06, 0x74, 0xff, 0x8f, 0x2a, 0x66, 0x20, 0x03, 0x01, 0x17, 0x81, 0x01, 0x13, 0x05, 0x06, 
+    0x0c, 0xff, 0x52, 0x33, 0xff, 0xff, 0xd7, 0xff, 0xe7, 0x00, 0x2a, 0x16, 0x0a, 0x04, 0x06, 0x05, 0x07, 0x01, 0x2e, 0xa7, 0x53, 0x27, 
+    0xd1, 0x51, 0x8f, 0x00, 0x83, 0x00, 0x03, 0x48, 0x9d, 0x21, 0x06, 0x81, 0x07, 0x00, 0x01, 0x81, 0x07, 0x81, 0x01, 0x04, 0x04, 0x01, 
+    0x05, 0x03, 0x05, 0x82, 0x03, 0x00, 0x16, 0x81, 0x03, 0x83, 0x0a, 0x01, 0x03, 0x0a, 0x81, 0x22, 0x00, 0x0a, 0x84, 0x03, 0x00, 0x04, 
+    0x81, 0x09, 0x00, 0x01, 0x81, 0x04, 0x00, 0x03, 0x81, 0x04, 0x07, 0x01, 0x06, 0x09, 0x2e, 0x15, 0x76, 0x7a, 0x02, 0x81, 0x00, 0x00, 
+    0x85, 0x81, 0x00, 0x05, 0x37, 0xff, 0xc6, 0x00, 0xe2, 0x0b, 0x06, 0x07, 0x81, 0x01, 0x04, 0x0f, 0x09, 0x20, 0x1c, 0x5f, 0x81, 0x02, 
+    0x8b, 0x00, 0x82, 0x02, 0x03, 0xff, 0xff, 0xbe, 0x1d, 0x12, 0x04, 0x81, 0x01, 0x01, 0x03, 0x3f, 0x81, 0x05, 0x02, 0x20, 0xff, 0x6f, 
+    0x22, 0xff, 0x78, 0x9d, 0x84, 0x00, 0x0e, 0x02, 0xff, 0x36, 0x95, 0x8c, 0x2c, 0x11, 0x03, 0x06, 0x01, 0x06, 0x01, 0x05, 0x0b, 0x20, 
+    0x25, 0xff, 0xf2, 0x5b, 0x81, 0x02, 0x81, 0x00, 0x00, 0x57, 0x8c, 0x00, 0x03, 0x02, 0xff, 0xd9, 0x9d, 0xff, 0x8d, 0x22, 0x20, 0x81, 
+    0x07, 0x01, 0x05, 0x01, 0x81, 0x07, 0x81, 0x01, 0x03, 0x0a, 0x15, 0x71, 0x02, 0x82, 0x00, 0x04, 0x52, 0xff, 0x9f, 0xcf, 0x56, 0x62, 
+    0xff, 0xbf, 0xbf, 0x8d, 0x62, 0x82, 0x56, 0x06, 0xff, 0xdf, 0xcf, 0xff, 0x9f, 0xc7, 0x56, 0x79, 0xff, 0x7f, 0xcf, 0x08, 0x02, 0x81, 
+    0x00, 0x03, 0xa0, 0x5b, 0x13, 0x16, 0x81, 0x05, 0x08, 0x07, 0x0f, 0x17, 0x01, 0x03, 0x53, 0x27, 0x86, 0x08, 0x87, 0x00, 0x0e, 0x6d, 
+    0x59, 0xff, 0xb1, 0x22, 0x33, 0x01, 0x19, 0x0f, 0x39, 0x05, 0x4f, 0x53, 0xa2, 0x5f, 0x02, 0x1e, 0x89, 0x00, 0x81, 0x02, 0x81, 0x00, 
+    0x03, 0x02, 0xff, 0x5c, 0xa6, 0x26, 0x03, 0x82, 0x01, 0x06, 0x07, 0x01, 0x05, 0x03, 0x4f, 0xa3, 0xff, 0x3a, 0xae, 0x84, 0x00, 0x03, 
+    0x02, 0x55, 0x2a, 0x22, 0x81, 0x03, 0x01, 0x01, 0x07, 0x81, 0x1b, 0x81, 0x01, 0x06, 0x0c, 0xff, 0x94, 0x3b, 0x24, 0x67, 0x10, 0x03, 
+    0x06, 0x81, 0x01, 0x08, 0x06, 0x01, 0x04, 0x16, 0x14, 0x27, 0x6a, 0x3b, 0x02, 0x8f, 0x00, 0x81, 0x00, 0x07, 0x0d, 0x00, 0x44, 0x8c, 
+    0x21, 0x04, 0x01, 0x07, 0x82, 0x01, 0x01, 0x07, 0x01, 0x84, 0x07, 0x81, 0x01, 0x00, 0x05, 0x82, 0x03, 0x86, 0x04, 0x85, 0x03, 0x81, 
+    0x04, 0x81, 0x06, 0x00, 0x01, 0x81, 0x05, 0x08, 0x03, 0x04, 0x01, 0x04, 0x03, 0x10, 0xce, 0xff, 0xca, 0x09, 0xff, 0x77, 0x95, 0x81, 
+    0x02, 0x01, 0x00, 0x0d, 0x82, 0x00, 0x04, 0x54, 0x42, 0x10, 0x09, 0x06, 0x81, 0x01, 0x05, 0x06, 0x01, 0x03, 0x23, 0x4e, 0x38, 0x81, 
+    0x02, 0x83, 0x00, 0x83, 0x02, 0x82, 0x08, 0x00, 0x1a, 0x81, 0x6c, 0x06, 0xff, 0xff, 0xd7, 0xff, 0xdf, 0xae, 0x24, 0x03, 0x09, 0x01, 
+    0x09, 0x81, 0x03, 0x04, 0x05, 0x03, 0x0c, 0x75, 0xff, 0x78, 0x9d, 0x85, 0x00, 0x05, 0xff, 0x53, 0x74, 0x42, 0x14, 0x03, 0x06, 0x17, 
+    0x81, 0x01, 0x06, 0x06, 0x1b, 0x0c, 0x10, 0x4d, 0x08, 0x02, 0x90, 0x00, 0x07, 0x02, 0x98, 0xeb, 0x4f, 0x06, 0x01, 0x05, 0x06, 0x81, 
+    0x07, 0x81, 0x05, 0x03, 0x03, 0x2a, 0xb3, 0x02, 0x81, 0x00, 0x06, 0x37, 0xff, 0x7c, 0xa6, 0xff, 0x55, 0x4c, 0xf2, 0xff, 0xb7, 0x44, 
+    0xff, 0xf8, 0x4c, 0xff, 0xb7, 0x44, 0x83, 0xf2, 0x00, 0xff, 0xd6, 0x4c, 0x84, 0xd4, 0x00, 0xff, 0xf6, 0x44, 0x82, 0xff, 0xf7, 0x44, 
+    0x82, 0xff, 0xf6, 0x44, 0x0a, 0xd4, 0xff, 0xf6, 0x4c, 0xff, 0xd6, 0x54, 0xff, 0x73, 0x54, 0xff, 0x3e, 0xc7, 0x08, 0x00, 0x02, 0xe9, 
+    0x32, 0x14, 0x81, 0x03, 0x82, 0x01, 0x06, 0x06, 0x0f, 0x04, 0x10, 0x1d, 0x74, 0x02, 0x87, 0x00, 0x0d, 0x9d, 0x2d, 0x20, 0x04, 0x06, 
+    0x01, 0x17, 0x09, 0x04, 0x50, 0x0c, 0x94, 0xff, 0xba, 0x95, 0x08, 0x83, 0x00, 0x00, 0x02, 0x82, 0x00, 0x81, 0x02, 0x82, 0x08, 0x81, 
+    0x1a, 0x05, 0xf3, 0xff, 0xfb, 0x8d, 0x28, 0x03, 0x04, 0x03, 0x81, 0x04, 0x05, 0x01, 0x05, 0x03, 0x20, 0xa3, 0xcd, 0x84, 0x00, 0x14, 
+    0x02, 0x83, 0x24, 0x22, 0x03, 0x05, 0x01, 0x07, 0x05, 0x06, 0x07, 0x39, 0x33, 0x0a, 0x0c, 0x20, 0x03, 0x1b, 0x01, 0x05, 0x04, 0x81, 
+    0x01, 0x05, 0x03, 0x13, 0x42, 0x7f, 0x08, 0x02, 0x90, 0x00, 0x81, 0x00, 0x05, 0x0d, 0x00, 0x44, 0x32, 0x10, 0x09, 0x82, 0x01, 0x02, 
+    0x04, 0x01, 0x0e, 0x81, 0x07, 0x90, 0x01, 0x84, 0x05, 0x83, 0x04, 0x82, 0x05, 0x81, 0x06, 0x07, 0x03, 0x09, 0x0b, 0x14, 0x2a, 0xff, 
+    0xea, 0x11, 0xff, 0x7b, 0xae, 0x02, 0x81, 0x00, 0x82, 0x0d, 0x13, 0x00, 0x02, 0x70, 0xea, 0x0a, 0x0f, 0x17, 0x01, 0x07, 0x01, 0x07, 
+    0x03, 0x13, 0xff, 0xef, 0x2a, 0xfd, 0x08, 0x37, 0x3b, 0x37, 0x3b, 0x81, 0x44, 0x0f, 0x4c, 0xb7, 0x7a, 0xff, 0x99, 0x8d, 0xf4, 0x80, 
+    0x73, 0x5c, 0x42, 0x27, 0x29, 0x3a, 0x06, 0x39, 0x01, 0x09, 0x81, 0x03, 0x06, 0x0e, 0x0b, 0x0c, 0xdd, 0x9f, 0x00, 0x02, 0x82, 0x00, 
+    0x06, 0x02, 0xb4, 0x2d, 0x10, 0x03, 0x06, 0x19, 0x81, 0x01, 0x06, 0x06, 0x03, 0x10, 0x27, 0x7f, 0x02, 0x1e, 0x91, 0x00, 0x03, 0xff, 
+    0xfd, 0xc6, 0xff, 0xee, 0x32, 0x13, 0x04, 0x81, 0x01, 0x07, 0x06, 0x01, 0x07, 0x05, 0x03, 0x10, 0x1c, 0x8d, 0x82, 0x02, 0x05, 0x6c, 
+    0xff, 0xfb, 0x85, 0xff, 0xb7, 0x4c, 0xff, 0x3a, 0x4d, 0xff, 0x5b, 0x45, 0xff, 0x3a, 0x45, 0x89, 0x97, 0x81, 0xff, 0x5a, 0x3d, 0x01, 
+    0xff, 0x7a, 0x3d, 0x87, 0x83, 0xff, 0x7a, 0x3d, 0x04, 0xff, 0x5a, 0x3d, 0xff, 0x59, 0x45, 0xff, 0x17, 0x4d, 0xff, 0x94, 0x54, 0xf3, 
+    0x81, 0x08, 0x05, 0x02, 0xaf, 0x3e, 0x14, 0x0a, 0x04, 0x81, 0x01, 0x00, 0x06, 0x81, 0x0f, 0x04, 0x0a, 0x14, 0x42, 0xd0, 0x02, 0x86, 
+    0x00, 0x20, 0x02, 0xff, 0x48, 0x09, 0x94, 0xff, 0x0f, 0x0a, 0x04, 0x0f, 0x01, 0x07, 0x0f, 0x4a, 0x18, 0x20, 0xff, 0x32, 0x33, 0xff, 
+    0x3f, 0xbf, 0x1a, 0x37, 0x08, 0x37, 0x6c, 0x52, 0x9a, 0x4c, 0x7e, 0xff, 0xda, 0xa5, 0xff, 0x58, 0x95, 0xf4, 0x6e, 0x73, 0xff, 0x4c, 
+    0x22, 0xff, 0xca, 0x11, 0x43, 0x24, 0x11, 0x81, 0x03, 0x00, 0x0a, 0x84, 0x03, 0x02, 0x13, 0xff, 0xd0, 0x2a, 0xb6, 0x84, 0x00, 0x02, 
+    0x08, 0xff, 0xf2, 0x5b, 0x21, 0x81, 0x03, 0x0a, 0x05, 0x07, 0x01, 0x0e, 0x05, 0x1b, 0x01, 0x0f, 0x17, 0x01, 0xf1, 0x81, 0x01, 0x0b, 
+    0x05, 0x06, 0x01, 0x0f, 0xf1, 0x0a, 0xce, 0xff, 0xd6, 0x6c, 0x08, 0x02, 0x00, 0x0d, 0x8f, 0x00, 0x82, 0x00, 0x0a, 0x02, 0xfd, 0x32, 
+    0x03, 0x06, 0x05, 0x01, 0x18, 0x04, 0x03, 0x0e, 0x81, 0x07, 0x83, 0x01, 0x83, 0x04, 0x81, 0x06, 0x00, 0x07, 0x81, 0x01, 0x84, 0x07, 
+    0x02, 0x0e, 0x05, 0x03, 0x81, 0x04, 0x00, 0x06, 0x81, 0x01, 0x02, 0x05, 0x0e, 0x0b, 0x81, 0x03, 0x81, 0x0c, 0x04, 0x23, 0x1c, 0xf6, 
+    0x8b, 0x02, 0x83, 0x00, 0x0a, 0x0d, 0x00, 0x02, 0x08, 0x4d, 0x66, 0x2f, 0x0f, 0x34, 0x01, 0x06, 0x81, 0x07, 0x0c, 0x09, 0x03, 0xff, 
+    0x11, 0x2b, 0xff, 0xba, 0x8d, 0xff, 0xda, 0x95, 0xff, 0xd6, 0x6c, 0xb1, 0xff, 0x92, 0x43, 0x84, 0x95, 0x70, 0xbb, 0x27, 0x82, 0x24, 
+    0x00, 0x60, 0x81, 0x1f, 0x03, 0x20, 0x0c, 0x03, 0x06, 0x81, 0x09, 0x02, 0x01, 0x0f, 0x01, 0x81, 0x07, 0x03, 0x06, 0x0c, 0x84, 0xff, 
+    0x3a, 0xae, 0x84, 0x00, 0x0e, 0xdc, 0xff, 0x71, 0x53, 0x29, 0x03, 0x05, 0x06, 0x01, 0x34, 0x07, 0x05, 0x03, 0x23, 0x32, 0x6c, 0x02, 
+    0x92, 0x00, 0x16, 0xb0, 0xff, 0xee, 0x32, 0x13, 0x0f, 0x04, 0x01, 0x34, 0x01, 0x07, 0x0e, 0x03, 0x10, 0x42, 0xb4, 0x00, 0x02, 0x08, 
+    0xff, 0xdf, 0xd7, 0xff, 0x58, 0x6d, 0xff, 0xf9, 0x44, 0xff, 0x5b, 0x45, 0x49, 0xff, 0x5b, 0x35, 0x82, 0x87, 0x83, 0x49, 0x83, 0x87, 
+    0x81, 0x45, 0x00, 0x3d, 0x81, 0x45, 0x00, 0x87, 0x81, 0xff, 0x5b, 0x35, 0x0a, 0xff, 0x5b, 0x45, 0xff, 0x18, 0x4d, 0xff, 0xf6, 0x64, 
+    0xf3, 0x08, 0x02, 0x08, 0x38, 0x2d, 0x10, 0x0a, 0x81, 0x01, 0x07, 0x06, 0x07, 0x0f, 0x18, 0x0a, 0xa6, 0xb9, 0x98, 0x87, 0x00, 0x05, 
+    0x68, 0x59, 0x67, 0x12, 0x33, 0x04, 0x81, 0x01, 0x1a, 0x17, 0x0f, 0x17, 0x09, 0xff, 0x53, 0x2b, 0xff, 0x3d, 0x96, 0xff, 0xdb, 0x8d, 
+    0xff, 0xb5, 0x6c, 0x80, 0xff, 0x50, 0x3b, 0xeb, 0xff, 0x2c, 0x12, 0xf9, 0x3e, 0x76, 0x2d, 0x78, 0x96, 0x60, 0x65, 0x14, 0x20, 0x0c, 
+    0x04, 0x39, 0x01, 0x04, 0x85, 0x03, 0x02, 0x13, 0xff, 0xd0, 0x2a, 0xff, 0xbd, 0xc6, 0x84, 0x00, 0x02, 0x36, 0xff, 0x70, 0x43, 0x13, 
+    0x81, 0x03, 0x00, 0x05, 0x81, 0x01, 0x07, 0x05, 0x1b, 0x09, 0xff, 0x31, 0x02, 0x17, 0x34, 0x19, 0x0f, 0x81, 0x01, 0x09, 0x07, 0x09, 
+    0x04, 0x17, 0x0a, 0x12, 0x23, 0x6e, 0x08, 0x02, 0x91, 0x00, 0x82, 0x00, 0x0a, 0x02, 0x92, 0x29, 0x3a, 0x1b, 0x05, 0x03, 0x18, 0x04, 
+    0x03, 0x0e, 0x81, 0x07, 0x00, 0x06, 0x81, 0x04, 0x00, 0x05, 0x84, 0x03, 0x85, 0x05, 0x00, 0x01, 0x81, 0x07, 0x82, 0x05, 0x82, 0x01, 
+    0x00, 0x17, 0x81, 0x06, 0x00, 0x03, 0x82, 0x0c, 0x04, 0x13, 0x2a, 0x4e, 0xff, 0x95, 0x6c, 0x1a, 0x81, 0x02, 0x81, 0x00, 0x00, 0xff, 
+    0xbe, 0xff, 0x81, 0x00, 0x10, 0x1e, 0x00, 0xa4, 0x32, 0xa5, 0x04, 0x33, 0x17, 0x0f, 0x01, 0x39, 0x01, 0x07, 0x0b, 0x0c, 0x28, 0x27, 
+    0x81, 0x28, 0x0b, 0x41, 0x1f, 0x15, 0x2c, 0x14, 0x20, 0x0c, 0x03, 0x12, 0x03, 0x0a, 0x3a, 0x81, 0x06, 0x02, 0x04, 0x06, 0x33, 0x81, 
+    0x04, 0x00, 0x01, 0x82, 0x07, 0x03, 0x0b, 0x13, 0xb9, 0x7e, 0x84, 0x00, 0x0d, 0x5d, 0xff, 0xf0, 0x3a, 0x1f, 0x03, 0x05, 0x07, 0x01, 
+    0x19, 0x07, 0x05, 0x16, 0x15, 0xff, 0xaa, 0x11, 0x02, 0x93, 0x00, 0x07, 0xd0, 0xeb, 0x13, 0x0f, 0x4a, 0x34, 0x01, 0x07, 0x81, 0x0e, 
+    0x0b, 0x05, 0x14, 0x42, 0xdb, 0x00, 0x02, 0x08, 0xff, 0x9f, 0xc7, 0xff, 0xf7, 0x5c, 0xff, 0x1a, 0x45, 0x49, 0x3d, 0x84, 0x88, 0x00, 
+    0xff, 0x9d, 0x35, 0x81, 0x3d, 0x01, 0xff, 0x9d, 0x35, 0x88, 0x81, 0x45, 0x81, 0x3d, 0x00, 0xff, 0x7e, 0x35, 0x81, 0x3d, 0x05, 0x45, 
+    0xff, 0x9d, 0x35, 0x49, 0xff, 0x5b, 0x3d, 0xff, 0xf8, 0x44, 0xff, 0xd9, 0x85, 0x81, 0x08, 0x0f, 0x02, 0x44, 0x6a, 0x25, 0x12, 0x03, 
+    0x0f, 0x06, 0x01, 0x05, 0x06, 0x18, 0x2f, 0xff, 0xee, 0x09, 0x47, 0xff, 0x5f, 0xdf, 0x85, 0x00, 0x0b, 0x02, 0x00, 0x9f, 0x76, 0x14, 
+    0x0a, 0x0f, 0x17, 0x09, 0x06, 0x01, 0x17, 0x81, 0x01, 0x07, 0x0a, 0x24, 0x27, 0x5e, 0x29, 0x41, 0x4f, 0x3c, 0x81, 0x10, 0x00, 0x14, 
+    0x81, 0x20, 0x02, 0x04, 0x18, 0x04, 0x81, 0x06, 0x02, 0x09, 0x39, 0x09, 0x81, 0x01, 0x84, 0x03, 0x03, 0x11, 0x13, 0xb9, 0xff, 0x1f, 
+    0xd7, 0x83, 0x00, 0x04, 0x02, 0xbd, 0xeb, 0x13, 0x03, 0x81, 0x0b, 0x0e, 0x01, 0x07, 0x06, 0x05, 0x09, 0x17, 0xff, 0x52, 0x02, 0x19, 
+    0x34, 0x19, 0x07, 0x01, 0x06, 0x04, 0x0f, 0x81, 0x04, 0x05, 0x11, 0x40, 0xff, 0x8d, 0x22, 0xcd, 0x00, 0x1e, 0x90, 0x00, 0x07, 0x0d, 
+    0x00, 0x02, 0x08, 0xb1, 0x24, 0x50, 0x09, 0x81, 0x03, 0x03, 0x18, 0x04, 0x03, 0x0e, 0x81, 0x07, 0x00, 0x01, 0x81, 0x05, 0x88, 0x03, 
+    0x83, 0x05, 0x85, 0x01, 0x01, 0x0f, 0x18, 0x81, 0x0f, 0x08, 0x06, 0x0b, 0x0c, 0x13, 0xff, 0x2e, 0x1a, 0x75, 0x5f, 0x8b, 0x08, 0x81, 
+    0x02, 0x00, 0x00, 0x81, 0x0d, 0x83, 0x00, 0x11, 0x02, 0xbf, 0x2d, 0x0c, 0x06, 0x0f, 0x39, 0x01, 0x09, 0x04, 0x0f, 0x19, 0x01, 0x03, 
+    0x11, 0x10, 0xa7, 0x2e, 0x81, 0x0b, 0x02, 0x11, 0x0c, 0x03, 0x81, 0x0b, 0x02, 0x05, 0x03, 0x0b, 0x81, 0x05, 0x07, 0x07, 0x05, 0x06, 
+    0x09, 0x0b, 0x0c, 0x06, 0x01, 0x81, 0x07, 0x04, 0x05, 0x11, 0x15, 0xff, 0xf0, 0x3a, 0xbe, 0x84, 0x00, 0x02, 0xc9, 0x75, 0x0c, 0x81, 
+    0x05, 0x08, 0x07, 0x01, 0x19, 0x07, 0x0b, 0x0c, 0x25, 0xb4, 0x02, 0x93, 0x00, 0x04, 0xff, 0x97, 0x95, 0xff, 0x8d, 0x22, 0x20, 0x18, 
+    0x34, 0x81, 0x01, 0x00, 0x07, 0x81, 0x0e, 0x0c, 0x03, 0x14, 0x2d, 0xff, 0x1b, 0xae, 0x00, 0x02, 0x08, 0xff, 0x3e, 0xb7, 0xff, 0x96, 
+    0x44, 0xff, 0x7b, 0x4d, 0xff, 0x5c, 0x3d, 0x3d, 0xff, 0x5c, 0x2d, 0x82, 0x88, 0x00, 0x45, 0x84, 0x3d, 0x81, 0x45, 0x81, 0x3d, 0x01, 
+    0xff, 0x7d, 0x2d, 0x3d, 0x82, 0xff, 0x5c, 0x35, 0x04, 0xff, 0x7d, 0x3d, 0xff, 0x7c, 0x45, 0xff, 0xd7, 0x44, 0xff, 0x7b, 0xa6, 0x08, 
+    0x81, 0x02, 0x06, 0x51, 0xa8, 0x30, 0x03, 0x18, 0x04, 0x06, 0x81, 0x05, 0x81, 0x04, 0x03, 0x2f, 0x78, 0xff, 0xd7, 0x7c, 0x48, 0x85, 
+    0x00, 0x81, 0x02, 0x0c, 0xb4, 0x2a, 0x10, 0x04, 0x01, 0x0f, 0x07, 0x01, 0x09, 0x01, 0x06, 0x05, 0x06, 0x81, 0x0b, 0x00, 0x0c, 0x82, 
+    0x0b, 0x00, 0x03, 0x82, 0x0a, 0x00, 0x04, 0x81, 0x06, 0x05, 0x01, 0x06, 0x09, 0x1b, 0x0b, 0x0e, 0x82, 0x07, 0x08, 0x01, 0x03, 0x04, 
+    0x05, 0x03, 0x11, 0x15, 0xde, 0x3b, 0x83, 0x00, 0x0a, 0x02, 0xff, 0x98, 0x8d, 0xff, 0x4c, 0x12, 0x3c, 0x05, 0x03, 0x06, 0x01, 0x17, 
+    0x04, 0x01, 0x81, 0x04, 0x0f, 0x0f, 0x34, 0x19, 0x07, 0x09, 0x06, 0x18, 0x0f, 0x4a, 0x18, 0x0a, 0x11, 0x0c, 0x15, 0x8d, 0x08, 0x91, 
+    0x00, 0x82, 0x00, 0x06, 0x37, 0x8f, 0x1f, 0x0b, 0x0e, 0x05, 0x03, 0x81, 0x04, 0x82, 0x05, 0x00, 0x04, 0x83, 0x0c, 0x88, 0x13, 0x82, 
+    0x4f, 0x81, 0x03, 0x00, 0x04, 0x82, 0x01, 0x0a, 0x0f, 0x09, 0x04, 0x09, 0x04, 0x2f, 0x14, 0xff, 0xd0, 0x2a, 0xe8, 0x63, 0x08, 0x81, 
+    0x02, 0x83, 0x00, 0x00, 0x0d, 0x84, 0x00, 0x10, 0xff, 0x91, 0x5b, 0x25, 0x10, 0x06, 0x07, 0x09, 0x06, 0x03, 0x04, 0x06, 0x19, 0x07, 
+    0x01, 0x09, 0x03, 0x05, 0x1b, 0x81, 0x05, 0x81, 0x03, 0x82, 0x05, 0x81, 0x03, 0x08, 0x0c, 0x3f, 0x0b, 0x05, 0x07, 0x05, 0x06, 0x11, 
+    0x10, 0x81, 0x03, 0x06, 0x05, 0x03, 0x11, 0x23, 0xff, 0xcc, 0x11, 0x71, 0x9b, 0x83, 0x00, 0x0e, 0x02, 0xf4, 0x15, 0x0c, 0x01, 0x07, 
+    0x01, 0x19, 0x01, 0x05, 0x06, 0x0c, 0x26, 0x7d, 0x02, 0x93, 0x00, 0x0d, 0xff, 0x94, 0x74, 0x4b, 0x0c, 0x4a, 0x01, 0x34, 0x19, 0x01, 
+    0x0e, 0x05, 0x03, 0x14, 0x76, 0x6b, 0x81, 0x02, 0x06, 0xf3, 0xff, 0xfe, 0xa6, 0xf2, 0xff, 0x5b, 0x45, 0x49, 0x3d, 0xff, 0x9d, 0x35, 
+    0x82, 0x45, 0x84, 0x3d, 0x83, 0x45, 0x82, 0x3d, 0x81, 0x49, 0x05, 0x45, 0xff, 0x5c, 0x35, 0xff, 0x5b, 0x45, 0xff, 0xd8, 0x4c, 0xff, 
+    0x3e, 0xbf, 0x08, 0x81, 0x02, 0x03, 0x6d, 0x3e, 0x23, 0x03, 0x82, 0x01, 0x07, 0x06, 0x07, 0x09, 0x04, 0x22, 0x58, 0xff, 0xba, 0x9d, 
+    0x02, 0x86, 0x00, 0x07, 0x02, 0xff, 0xef, 0x42, 0x25, 0x03, 0x09, 0x01, 0x17, 0x05, 0x81, 0x01, 0x01, 0x06, 0x09, 0x82, 0x05, 0x01, 
+    0x0b, 0x05, 0x81, 0x07, 0x03, 0x01, 0x05, 0x0a, 0x03, 0x81, 0x04, 0x02, 0x01, 0x04, 0x01, 0x81, 0x05, 0x81, 0x03, 0x00, 0x2e, 0x82, 
+    0x0b, 0x82, 0x03, 0x81, 0x0a, 0x03, 0x14, 0x42, 0x71, 0x02, 0x83, 0x00, 0x05, 0x02, 0xff, 0xd5, 0x74, 0xff, 0xeb, 0x01, 0x11, 0x03, 
+    0x05, 0x81, 0x04, 0x05, 0x0f, 0x06, 0x09, 0x0a, 0x04, 0x0f, 0x81, 0x07, 0x0d, 0x01, 0x05, 0x03, 0xfb, 0x18, 0x4a, 0x06, 0x2e, 0x03, 
+    0x0b, 0x41, 0xaa, 0x74, 0x02, 0x90, 0x00, 0x06, 0x00, 0x0d, 0x00, 0x52, 0x78, 0xff, 0x0f, 0x0a, 0x03, 0x81, 0x05, 0x0a, 0x1b, 0x0f, 
+    0x01, 0x0b, 0x3f, 0x03, 0x0c, 0xff, 0xb0, 0x22, 0xff, 0xd0, 0x2a, 0x94, 0x8f, 0x81, 0xa3, 0x00, 0x8f, 0x85, 0x84, 0x11, 0x94, 0x84, 
+    0xff, 0xf1, 0x2a, 0x1f, 0x12, 0x04, 0x01, 0x07, 0x06, 0x03, 0x06, 0x04, 0x06, 0x0f, 0x04, 0x60, 0xff, 0xb7, 0x6c, 0x1a, 0x81, 0x02, 
+    0x8a, 0x00, 0x05, 0x02, 0xff, 0xee, 0x42, 0x1c, 0x11, 0x05, 0x07, 0x81, 0x05, 0x05, 0x03, 0x16, 0x04, 0x0f, 0x34, 0x17, 0x81, 0x04, 
+    0x03, 0x06, 0x05, 0x06, 0x2e, 0x81, 0x03, 0x01, 0x06, 0x04, 0x81, 0x03, 0x83, 0x0c, 0x81, 0x09, 0x0b, 0x16, 0x13, 0x15, 0x40, 0x1c, 
+    0x15, 0x69, 0x40, 0x4e, 0x5b, 0xff, 0xeb, 0x21, 0xff, 0xb1, 0x63, 0x84, 0x00, 0x03, 0x02, 0xff, 0x55, 0x64, 0x28, 0x03, 0x81, 0x05, 
+    0x82, 0x01, 0x04, 0x05, 0x0b, 0x0c, 0x1d, 0x7e, 0x93, 0x00, 0x06, 0x02, 0x8d, 0x5e, 0x03, 0x04, 0x17, 0x01, 0x81, 0x07, 0x0d, 0x81, 
+    0x09, 0x03, 0x66, 0xca, 0x02, 0x00, 0x02, 0xff, 0xff, 0xd7, 0xff, 0x7c, 0x8e, 0xff, 0xf7, 0x44, 0xff, 0x7b, 0x45, 0xff, 0x5b, 0x35, 
+    0x45, 0x86, 0x49, 0x82, 0x45, 0x82, 0x49, 0x00, 0x45, 0x81, 0x88, 0x81, 0x87, 0x04, 0x49, 0xff, 0x5b, 0x3d, 0xff, 0x3a, 0x45, 0xff, 
+    0xd7, 0x54, 0xf3, 0x81, 0x02, 0x05, 0x08, 0xc5, 0x3e, 0x11, 0x05, 0x06, 0x82, 0x01, 0x81, 0x05, 0x04, 0x03, 0xff, 0x0f, 0x12, 0xff, 
+    0xcc, 0x11, 0x7a, 0x02, 0x86, 0x00, 0x06, 0x02, 0xff, 0xcb, 0x19, 0x2c, 0x03, 0x04, 0x01, 0x07, 0x81, 0x01, 0x09, 0x06, 0x05, 0x06, 
+    0x1b, 0x0b, 0x05, 0x0e, 0x07, 0x06, 0x01, 0x82, 0x03, 0x01, 0x12, 0x03, 0x82, 0x04, 0x02, 0x2f, 0x12, 0x0a, 0x81, 0x20, 0x83, 0x13, 
+    0x07, 0x28, 0x1f, 0x21, 0x15, 0x21, 0x4e, 0xff, 0x0b, 0x1a, 0xff, 0xf1, 0x63, 0x83, 0x00, 0x17, 0x1e, 0x02, 0xff, 0x74, 0x64, 0xa2, 
+    0x11, 0x03, 0x04, 0x0f, 0x18, 0x17, 0x0f, 0x01, 0x06, 0x09, 0x05, 0x01, 0x07, 0x0e, 0x0b, 0x09, 0x04, 0x17, 0x34, 0x17, 0x81, 0x03, 
+    0x04, 0x05, 0x03, 0x29, 0x64, 0x08, 0x90, 0x00, 0x81, 0x00, 0x11, 0x02, 0x6b, 0x2b, 0x22, 0x09, 0x06, 0x05, 0x06, 0x09, 0x01, 0x0b, 
+    0x11, 0x20, 0xff, 0xd1, 0x2a, 0xff, 0x9a, 0x8d, 0xff, 0x5c, 0xa6, 0xba, 0xff, 0x7c, 0xae, 0x82, 0xba, 0x18, 0xbd, 0xc0, 0xba, 0xbd, 
+    0xba, 0xb6, 0xba, 0xb6, 0xff, 0x9e, 0xb6, 0x84, 0x66, 0x03, 0x06, 0x07, 0x09, 0x06, 0x05, 0x03, 0x04, 0x0f, 0x04, 0x65, 0xd2, 0xf7, 
+    0x02, 0x81, 0x00, 0x00, 0x0d, 0x84, 0x00, 0x00, 0x57, 0x82, 0x00, 0x03, 0x02, 0xff, 0x2b, 0x22, 0x13, 0x3f, 0x81, 0x0e, 0x81, 0x05, 
+    0x0f, 0x03, 0x0a, 0x18, 0x0f, 0x17, 0x01, 0x04, 0x03, 0x3a, 0x31, 0x0c, 0x03, 0x0c, 0x20, 0x3a, 0xff, 0x0f, 0x02, 0x81, 0x1f, 0x00, 
+    0x21, 0x81, 0x25, 0x0e, 0x30, 0xa6, 0x67, 0x2c, 0xff, 0xb0, 0x2a, 0xb2, 0xae, 0xd1, 0x72, 0x64, 0xff, 0xf2, 0x53, 0x9c, 0x38, 0xbf, 
+    0xff, 0x7b, 0xc6, 0x84, 0x00, 0x03, 0x3b, 0xff, 0xf4, 0x53, 0x60, 0x03, 0x82, 0x05, 0x81, 0x01, 0x04, 0x05, 0x03, 0x0a, 0x1d, 0x51, 
+    0x81, 0x00, 0x00, 0x0d, 0x8a, 0x00, 0x00, 0x0d, 0x84, 0x00, 0x04, 0x4c, 0xff, 0x10, 0x33, 0x15, 0x03, 0x04, 0x83, 0x07, 0x04, 0x81, 
+    0x07, 0x0a, 0x2c, 0xff, 0x6d, 0x32, 0x82, 0x02, 0x04, 0xff, 0xff, 0xd7, 0xff, 0x57, 0x6d, 0xd4, 0xff, 0x38, 0x45, 0x89, 0x82, 0xff, 
+    0x19, 0x3d, 0x82, 0xff, 0x1a, 0x3d, 0x81, 0xff, 0x19, 0x3d, 0x88, 0x89, 0x06, 0xff, 0x38, 0x3d, 0xff, 0x18, 0x45, 0x89, 0xff, 0x3a, 
+    0x45, 0xff, 0x19, 0x4d, 0xff, 0x96, 0x54, 0x1a, 0x81, 0x02, 0x05, 0x37, 0xe4, 0x26, 0x11, 0x09, 0x01, 0x81, 0x06, 0x06, 0x05, 0x01, 
+    0x06, 0x0a, 0x2c, 0x5c, 0xff, 0x7c, 0xbe, 0x87, 0x00, 0x03, 0x02, 0xff, 0x69, 0x11, 0x23, 0x03, 0x81, 0x01, 0x00, 0x07, 0x82, 0x01, 
+    0x00, 0x05, 0x81, 0x2e, 0x06, 0x0c, 0x50, 0x05, 0x06, 0x05, 0x03, 0x0c, 0x82, 0x2c, 0x00, 0x13, 0x81, 0x5a, 0x00, 0x21, 0x81, 0x96, 
+    0x0e, 0xea, 0xff, 0x2e, 0x1a, 0x7b, 0x75, 0x5c, 0xb9, 0xae, 0xff, 0x71, 0x43, 0x9e, 0x6e, 0xb8, 0x54, 0xf5, 0xc6, 0xff, 0x7b, 0xbe, 
+    0x84, 0x00, 0x03, 0x46, 0xe0, 0x69, 0x0b, 0x81, 0x09, 0x03, 0x04, 0x4a, 0x0f, 0x19, 0x81, 0x01, 0x00, 0x09, 0x81, 0x06, 0x03, 0x09, 
+    0x06, 0x03, 0x0a, 0x81, 0x01, 0x01, 0x39, 0x01, 0x81, 0x0b, 0x05, 0x05, 0x0b, 0x13, 0x75, 0x82, 0x02, 0x8f, 0x00, 0x81, 0x00, 0x04, 
+    0x02, 0xe5, 0x58, 0x31, 0x04, 0x81, 0x05, 0x81, 0x01, 0x05, 0x07, 0x05, 0x03, 0x28, 0xff, 0xb3, 0x4b, 0xff, 0x5f, 0xcf, 0x85, 0x02, 
+    0x87, 0x00, 0x04, 0x02, 0xff, 0x1c, 0xa6, 0x1d, 0x0c, 0x05, 0x81, 0x07, 0x09, 0xff, 0xb0, 0x0a, 0x3f, 0x0b, 0x05, 0x34, 0x04, 0x20, 
+    0x2a, 0xc6, 0x02, 0x81, 0x00, 0x81, 0x0d, 0x88, 0x00, 0x02, 0xff, 0xa9, 0x11, 0x23, 0x05, 0x82, 0x0e, 0x00, 0x0b, 0x81, 0x03, 0x82, 
+    0x04, 0x19, 0x18, 0xff, 0x0f, 0x0a, 0x13, 0x1f, 0x29, 0x1c, 0x29, 0x2a, 0x23, 0x67, 0xff, 0xd0, 0x2a, 0xb2, 0x9e, 0x8d, 0x9d, 0xac, 
+    0xff, 0xf3, 0x63, 0xff, 0x75, 0x74, 0x55, 0x92, 0x7a, 0xaf, 0xf0, 0x68, 0x48, 0x08, 0x83, 0x02, 0x81, 0x00, 0x00, 0x0d, 0x82, 0x00, 
+    0x04, 0xe9, 0xff, 0x51, 0x3b, 0x65, 0x03, 0x04, 0x81, 0x01, 0x81, 0x04, 0x05, 0x01, 0x03, 0x0a, 0x26, 0x6b, 0x48, 0x91, 0x00, 0x05, 
+    0x02, 0xff, 0x57, 0x8d, 0x90, 0x4f, 0x03, 0x0f, 0x81, 0x01, 0x06, 0x07, 0x01, 0x05, 0x0b, 0x31, 0x78, 0xad, 0x82, 0x02, 0x07, 0xff, 
+    0xbf, 0xd7, 0xff, 0x57, 0x7d, 0xff, 0x98, 0x75, 0xff, 0xb9, 0x6d, 0xff, 0xd9, 0x6d, 0xff, 0xb9, 0x65, 0xff, 0xb9, 0x6d, 0xd5, 0x82, 
+    0xff, 0x9a, 0x6d, 0x00, 0xd5, 0x82, 0xff, 0xb9, 0x6d, 0x01, 0xd5, 0xff, 0xda, 0x6d, 0x82, 0xd5, 0x81, 0xff, 0xda, 0x6d, 0x81, 0xff, 
+    0xb9, 0x75, 0x0b, 0xd5, 0xff, 0xba, 0x75, 0xff, 0x58, 0x6d, 0xff, 0xb9, 0x8d, 0x02, 0x00, 0x02, 0x3b, 0xff, 0x14, 0x5c, 0x60, 0x03, 
+    0x05, 0x84, 0x01, 0x04, 0x06, 0x0a, 0x21, 0x72, 0xf0, 0x87, 0x00, 0x03, 0x02, 0xff, 0x49, 0x09, 0x23, 0x03, 0x81, 0x01, 0x00, 0x07, 
+    0x82, 0x01, 0x06, 0x06, 0x03, 0x12, 0x13, 0x28, 0x65, 0x20, 0x81, 0x60, 0x14, 0x1c, 0xda, 0xc2, 0xe1, 0xaa, 0xff, 0x10, 0x33, 0xff, 
+    0x71, 0x3b, 0x72, 0xff, 0x91, 0x5b, 0xac, 0xff, 0x14, 0x64, 0xff, 0x96, 0x74, 0xe8, 0xff, 0x58, 0x95, 0x9f, 0xb0, 0xff, 0xdc, 0xc6, 
+    0x52, 0x37, 0x02, 0x08, 0x81, 0x02, 0x01, 0x08, 0x02, 0x84, 0x00, 0x02, 0x7e, 0xff, 0x10, 0x33, 0x41, 0x82, 0x03, 0x81, 0x04, 0x0a, 
+    0x0f, 0x01, 0x07, 0x39, 0x06, 0x05, 0x06, 0x09, 0x2e, 0x03, 0x50, 0x81, 0x01, 0x02, 0x19, 0x07, 0x05, 0x81, 0x06, 0x04, 0x03, 0x11, 
+    0x1c, 0x93, 0x48, 0x8f, 0x00, 0x81, 0x00, 0x0e, 0x08, 0x54, 0x24, 0x0a, 0x06, 0x05, 0x07, 0x05, 0x01, 0x07, 0x05, 0x16, 0x29, 0xff, 
+    0x55, 0x64, 0x08, 0x8d, 0x00, 0x07, 0x02, 0x08, 0xff, 0xaa, 0x11, 0x13, 0x03, 0x07, 0x81, 0x05, 0x81, 0x0b, 0x07, 0x07, 0x19, 0x01, 
+    0x03, 0x1c, 0xff, 0xf2, 0x5b, 0x52, 0x02, 0x81, 0x00, 0x00, 0x0d, 0x87, 0x00, 0x02, 0x02, 0xff, 0x88, 0x11, 0x23, 0x83, 0x0e, 0x00, 
+    0x05, 0x81, 0x03, 0x81, 0x04, 0x0e, 0x03, 0xff, 0xf2, 0x22, 0xff, 0xf1, 0x32, 0xff, 0x51, 0x3b, 0xee, 0x47, 0x9c, 0x83, 0xff, 0xb6, 
+    0x74, 0x55, 0xc9, 0x7a, 0x5d, 0xbe, 0x3b, 0x87, 0x02, 0x01, 0x00, 0x02, 0x89, 0x00, 0x05, 0x02, 0x00, 0xff, 0xf9, 0xad, 0x94, 0x0c, 
+    0x03, 0x82, 0x04, 0x81, 0x03, 0x05, 0x04, 0x03, 0x12, 0x2b, 0xff, 0xfe, 0xbe, 0x02, 0x8e, 0x00, 0x08, 0x0d, 0x00, 0x02, 0x1a, 0x8d, 
+    0x41, 0x09, 0x03, 0x04, 0x82, 0x01, 0x0b, 0x05, 0x06, 0x03, 0x14, 0x99, 0x44, 0x1e, 0x00, 0x02, 0x08, 0xff, 0x5f, 0xcf, 0xff, 0x9f, 
+    0xc7, 0x83, 0x56, 0x00, 0x79, 0x81, 0x56, 0x83, 0x79, 0x84, 0x56, 0x81, 0x79, 0x00, 0x56, 0x83, 0x79, 0x01, 0xff, 0x5f, 0xc7, 0x1a, 
+    0x81, 0x00, 0x04, 0x02, 0x52, 0xff, 0xd0, 0x32, 0x1f, 0x0b, 0x81, 0x06, 0x81, 0x01, 0x06, 0x06, 0x07, 0x06, 0x12, 0x78, 0xcc, 0x44, 
+    0x87, 0x00, 0x03, 0x02, 0xca, 0x23, 0x03, 0x81, 0x01, 0x81, 0x07, 0x81, 0x01, 0x10, 0x05, 0x03, 0x10, 0xa3, 0xff, 0x11, 0x33, 0xff, 
+    0x72, 0x3b, 0xff, 0x93, 0x43, 0xff, 0xf4, 0x53, 0xb1, 0x83, 0xdb, 0xff, 0x36, 0x8d, 0xec, 0x82, 0xff, 0xbd, 0xb6, 0x63, 0x3b, 0x86, 
+    0x02, 0x82, 0x00, 0x00, 0x02, 0x89, 0x00, 0x04, 0x02, 0x7d, 0x90, 0x13, 0x0a, 0x81, 0x06, 0x18, 0x04, 0x0f, 0x04, 0x09, 0x06, 0x09, 
+    0x05, 0x03, 0x0c, 0x13, 0xa5, 0x0c, 0x4f, 0x1b, 0x05, 0x19, 0xff, 0xb2, 0x02, 0x09, 0x01, 0x06, 0x03, 0x11, 0x40, 0xff, 0x4c, 0x22, 
+    0x9f, 0x8f, 0x00, 0x81, 0x00, 0x06, 0x08, 0xb3, 0x21, 0x0a, 0x05, 0x07, 0x06, 0x81, 0x01, 0x81, 0x05, 0x03, 0x10, 0x25, 0xad, 0x02, 
+    0x8e, 0x00, 0x09, 0x02, 0xdb, 0x3e, 0x16, 0x05, 0x07, 0x05, 0x0e, 0x05, 0x07, 0x81, 0x01, 0x04, 0x06, 0x13, 0xff, 0x4c, 0x1a, 0x82, 
+    0x02, 0x8a, 0x00, 0x03, 0x02, 0xff, 0xc9, 0x19, 0x23, 0x0b, 0x82, 0x07, 0x0b, 0x01, 0x05, 0x03, 0x0a, 0x20, 0xff, 0x12, 0x2b, 0xff, 
+    0xfc, 0x95, 0xff, 0x7d, 0xb6, 0x36, 0x46, 0x08, 0x02, 0x8c, 0x00, 0x02, 0x02, 0x00, 0x1e, 0x81, 0x00, 0x00, 0x77, 0x88, 0x00, 0x05, 
+    0x02, 0x00, 0xc3, 0x42, 0x0c, 0x03, 0x81, 0x04, 0x00, 0x01, 0x81, 0x03, 0x81, 0x04, 0x03, 0x12, 0x24, 0xff, 0xba, 0x95, 0x08, 0x8c, 
+    0x00, 0x00, 0x0d, 0x81, 0x00, 0x81, 0x02, 0x05, 0xff, 0xb9, 0x95, 0x75, 0x4f, 0x06, 0x03, 0x04, 0x83, 0x01, 0x04, 0x03, 0x11, 0xa6, 
+    0xff, 0x0c, 0x22, 0x02, 0x82, 0x00, 0x00, 0x77, 0x82, 0x02, 0x00, 0x08, 0x81, 0x02, 0x82, 0x08, 0x84, 0x02, 0x82, 0x08, 0x89, 0x02, 
+    0x81, 0x00, 0x04, 0x02, 0x6b, 0x2d, 0x14, 0x06, 0x81, 0x05, 0x0a, 0x04, 0x06, 0x01, 0x19, 0x04, 0x12, 0x3e, 0xff, 0x36, 0x8d, 0x02, 
+    0x00, 0x0d, 0x85, 0x00, 0x03, 0x02, 0xca, 0x23, 0x0b, 0x81, 0x01, 0x81, 0x07, 0x81, 0x01, 0x08, 0x04, 0x20, 0xff, 0x11, 0x33, 0xff, 
+    0x7d, 0xae, 0xc5, 0x63, 0x6b, 0x1a, 0x08, 0x81, 0x02, 0x81, 0x00, 0x82, 0x02, 0x82, 0x00, 0x01, 0x1e, 0x02, 0x84, 0x00, 0x01, 0x02, 
+    0x9b, 0x81, 0x00, 0x00, 0x0d, 0x85, 0x00, 0x81, 0x02, 0x01, 0x55, 0x21, 0x82, 0x03, 0x81, 0x04, 0x00, 0x06, 0x81, 0x01, 0x0a, 0x06, 
+    0x2e, 0xa7, 0x10, 0x27, 0xb2, 0xff, 0x1c, 0x96, 0x58, 0x53, 0x03, 0x05, 0x81, 0x07, 0x01, 0x01, 0x04, 0x82, 0x03, 0x03, 0x10, 0x43, 
+    0xac, 0x48, 0x8e, 0x00, 0x81, 0x00, 0x03, 0x08, 0xff, 0xaa, 0x11, 0x13, 0x06, 0x81, 0x05, 0x81, 0x01, 0x05, 0x07, 0x05, 0x03, 0x0c, 
+    0x4b, 0x92, 0x90, 0x00, 0x03, 0x44, 0x32, 0x67, 0x03, 0x81, 0x01, 0x81, 0x05, 0x82, 0x01, 0x04, 0x05, 0x11, 0xa2, 0xff, 0x94, 0x6c, 
+    0x08, 0x84, 0x00, 0x00, 0x0d, 0x85, 0x00, 0x03, 0xff, 0x0a, 0x22, 0x30, 0x03, 0x04, 0x81, 0x07, 0x81, 0x01, 0x05, 0x06, 0x05, 0x4f, 
+    0xff, 0x31, 0x33, 0xff, 0x5f, 0xc7, 0x02, 0x94, 0x00, 0x00, 0xdc, 0x81, 0x00, 0x00, 0x8a, 0x86, 0x00, 0x81, 0x02, 0x06, 0xdb, 0x43, 
+    0x0c, 0x03, 0x04, 0x4a, 0x01, 0x81, 0x03, 0x05, 0x04, 0x18, 0x0a, 0x2c, 0xb3, 0x02, 0x90, 0x00, 0x06, 0x51, 0x9e, 0x29, 0x03, 0x1b, 
+    0x05, 0x03, 0x81, 0x01, 0x81, 0x04, 0x03, 0x03, 0x3c, 0x27, 0xad, 0x81, 0x00, 0x00, 0x0d, 0x9b, 0x00, 0x00, 0xff, 0xde, 0xf7, 0x81, 
+    0x00, 0x03, 0x02, 0xff, 0xfd, 0xc6, 0x2b, 0x22, 0x82, 0x05, 0x08, 0x04, 0x03, 0x04, 0x19, 0x0f, 0x22, 0x2d, 0xcb, 0x02, 0x84, 0x00, 
+    0x00, 0x0d, 0x81, 0x00, 0x04, 0x02, 0xff, 0x89, 0x11, 0x23, 0x0b, 0x06, 0x84, 0x01, 0x03, 0x06, 0x3a, 0xff, 0x11, 0x33, 0x1a, 0x82, 
+    0x02, 0x8f, 0x00, 0x00, 0x0d, 0x81, 0x00, 0x00, 0xff, 0x5e, 0xdf, 0x81, 0x00, 0x00, 0xff, 0xbe, 0xf7, 0x86, 0x00, 0x81, 0x02, 0x02, 
+    0x54, 0x60, 0x2f, 0x81, 0x03, 0x0f, 0x09, 0x04, 0x06, 0x01, 0x06, 0x0a, 0x03, 0x11, 0x27, 0x8e, 0x5d, 0x08, 0xa1, 0x2a, 0x0c, 0x0e, 
+    0x81, 0x07, 0x00, 0x01, 0x81, 0x04, 0x06, 0x03, 0x06, 0x03, 0x1f, 0x5b, 0x74, 0x02, 0x8d, 0x00, 0x81, 0x00, 0x05, 0x52, 0xbc, 0x10, 
+    0x09, 0x0e, 0x07, 0x83, 0x01, 0x03, 0x03, 0x13, 0x8f, 0x7a, 0x90, 0x00, 0x03, 0x08, 0x9d, 0x2a, 0x0a, 0x81, 0x18, 0x82, 0x04, 0x00, 
+    0x0f, 0x81, 0x01, 0x03, 0x0b, 0x40, 0xff, 0x30, 0x33, 0xff, 0xdc, 0xbe, 0x8b, 0x00, 0x01, 0xff, 0xee, 0x42, 0x2a, 0x81, 0x0a, 0x03, 
+    0x04, 0x19, 0x34, 0x01, 0x81, 0x07, 0x02, 0x11, 0x30, 0xff, 0xf6, 0x7c, 0x81, 0x02, 0x8d, 0x00, 0x00, 0x0d, 0x83, 0x00, 0x04, 0xff, 
+    0x5a, 0xbe, 0xff, 0xd1, 0x63, 0xff, 0x5b, 0xbe, 0x00, 0x1e, 0x86, 0x00, 0x05, 0x02, 0x48, 0xff, 0x32, 0x64, 0x43, 0x11, 0x04, 0x81, 
+    0x4a, 0x0a, 0x34, 0x05, 0x03, 0x04, 0x18, 0x03, 0x13, 0x32, 0x08, 0x00, 0x0d, 0x8a, 0x00, 0x81, 0x0d, 0x10, 0x00, 0x02, 0x54, 0xff, 
+    0x2e, 0x1a, 0x10, 0x0b, 0x07, 0x05, 0x03, 0x04, 0x01, 0x04, 0x0a, 0x16, 0x3c, 0x32, 0x1a, 0x81, 0x00, 0x00, 0x85, 0x9d, 0x00, 0x81, 
+    0x02, 0x04, 0x7a, 0x58, 0x22, 0x09, 0x06, 0x81, 0x03, 0x07, 0x0a, 0x04, 0x34, 0x18, 0x66, 0xab, 0xff, 0x39, 0xae, 0x02, 0x87, 0x00, 
+    0x04, 0x02, 0xc2, 0x40, 0x03, 0x06, 0x84, 0x01, 0x03, 0x07, 0x3f, 0xff, 0x6d, 0x1a, 0x86, 0x83, 0x02, 0x88, 0x00, 0x00, 0x0d, 0x86, 
+    0x00, 0x05, 0xff, 0x19, 0xb6, 0xff, 0x6f, 0x53, 0xff, 0xfd, 0xc6, 0x02, 0x00, 0x0d, 0x85, 0x00, 0x08, 0x02, 0x44, 0x5f, 0x28, 0x04, 
+    0x0a, 0x06, 0x04, 0x05, 0x81, 0x06, 0x05, 0x0f, 0x18, 0x03, 0xa2, 0xff, 0xd1, 0x53, 0xff, 0x5e, 0xcf, 0x81, 0x00, 0x07, 0x51, 0x99, 
+    0x10, 0x03, 0x06, 0x1b, 0x04, 0x01, 0x81, 0x09, 0x81, 0x06, 0x03, 0x03, 0x29, 0xff, 0x14, 0x64, 0x48, 0x8d, 0x00, 0x81, 0x00, 0x05, 
+    0x5d, 0x32, 0x10, 0x05, 0x06, 0x05, 0x81, 0x04, 0x05, 0x05, 0x0b, 0x03, 0x1f, 0x9e, 0xff, 0xfd, 0xc6, 0x91, 0x00, 0x05, 0x5d, 0x4d, 
+    0x12, 0x18, 0x06, 0x09, 0x81, 0x04, 0x07, 0x01, 0x04, 0x06, 0x05, 0x10, 0x25, 0x92, 0x02, 0x8a, 0x00, 0x0f, 0xff, 0xd1, 0x63, 0x25, 
+    0x12, 0x0a, 0x04, 0x34, 0x19, 0x01, 0x05, 0x0e, 0xff, 0xb0, 0x0a, 0x15, 0x8e, 0x63, 0x00, 0x1e, 0x8f, 0x00, 0x05, 0x48, 0xc4, 0xff, 
+    0xee, 0x42, 0x59, 0x71, 0x02, 0x87, 0x00, 0x05, 0x02, 0xfc, 0xff, 0xb1, 0x53, 0x69, 0x16, 0x04, 0x81, 0x4a, 0x00, 0x01, 0x81, 0x03, 
+    0x06, 0x04, 0x0f, 0x31, 0x14, 0x26, 0xb8, 0x02, 0x8b, 0x00, 0x00, 0x0d, 0x81, 0x00, 0x03, 0xff, 0x58, 0x95, 0xab, 0x2c, 0x0a, 0x81, 
+    0x05, 0x0b, 0x03, 0x0b, 0x06, 0x01, 0x04, 0x0a, 0x10, 0x1c, 0x8d, 0x02, 0x00, 0x0d, 0x9f, 0x00, 0x03, 0x08, 0xff, 0x95, 0x7c, 0xd7, 
+    0xff, 0x51, 0x12, 0x81, 0x01, 0x01, 0x09, 0x06, 0x81, 0x03, 0x04, 0x01, 0x04, 0x1f, 0x8e, 0xff, 0xdb, 0xc6, 0x88, 0x00, 0x04, 0x02, 
+    0xff, 0x2f, 0x43, 0x15, 0x0c, 0x03, 0x81, 0x01, 0x81, 0x04, 0x07, 0x19, 0x07, 0x0b, 0x1c, 0xff, 0x2f, 0x43, 0x46, 0x00, 0x02, 0x8c, 
+    0x00, 0x00, 0x02, 0x81, 0x00, 0x06, 0x68, 0xc4, 0xff, 0xad, 0x3a, 0xbc, 0xff, 0x4f, 0x43, 0x08, 0x02, 0x86, 0x00, 0x03, 0x02, 0x5d, 
+    0xff, 0x71, 0x43, 0x65, 0x81, 0x04, 0x0a, 0x06, 0x01, 0x05, 0x06, 0x01, 0x18, 0x2f, 0x28, 0xff, 0x55, 0x5c, 0x6c, 0x02, 0x81, 0x00, 
+    0x06, 0x02, 0xff, 0x10, 0x4b, 0xea, 0x11, 0x05, 0x0e, 0x06, 0x83, 0x01, 0x04, 0x06, 0x03, 0x5a, 0x4e, 0xff, 0xda, 0xa5, 0x8d, 0x00, 
+    0x81, 0x00, 0x04, 0xe8, 0x24, 0x03, 0x06, 0x09, 0x81, 0x04, 0x00, 0x05, 0x81, 0x0b, 0x03, 0x03, 0x25, 0x5f, 0x3b, 0x91, 0x00, 0x03, 
+    0x08, 0xff, 0x4d, 0x2a, 0x21, 0x31, 0x81, 0x05, 0x00, 0x03, 0x81, 0x04, 0x08, 0x01, 0x07, 0x0b, 0x0c, 0x21, 0x47, 0x46, 0x00, 0x8a, 
+    0x86, 0x00, 0x10, 0x1e, 0x00, 0xff, 0x78, 0x9d, 0x26, 0x12, 0x2f, 0xff, 0x31, 0x02, 0x0f, 0x17, 0x05, 0x0e, 0x3f, 0xff, 0x8f, 0x02, 
+    0x11, 0x40, 0xff, 0x14, 0x5c, 0x46, 0x83, 0x00, 0x00, 0x02, 0x84, 0x00, 0x00, 0x0d, 0x81, 0x00, 0x81, 0x02, 0x07, 0x1a, 0xff, 0x78, 
+    0x8d, 0x47, 0x2d, 0x2a, 0x30, 0x4b, 0xbf, 0x88, 0x00, 0x05, 0xa4, 0xae, 0x41, 0x06, 0x4a, 0x34, 0x81, 0x04, 0x08, 0x06, 0x09, 0x04, 
+    0x01, 0x06, 0x0a, 0x23, 0x3e, 0xb7, 0x81, 0x02, 0x8a, 0x00, 0x06, 0x48, 0x92, 0xe1, 0x21, 0x0b, 0x06, 0x01, 0x81, 0x06, 0x00, 0x05, 
+    0x81, 0x07, 0x05, 0x09, 0x16, 0x67, 0xbc, 0x46, 0x02, 0x9e, 0x00, 0x00, 0x1e, 0x81, 0x00, 0x04, 0x68, 0x71, 0x21, 0x03, 0x04, 0x82, 
+    0x01, 0x81, 0x03, 0x04, 0x07, 0x05, 0x28, 0xff, 0x34, 0x54, 0x44, 0x88, 0x00, 0x0f, 0x02, 0xcc, 0x1c, 0x0a, 0x04, 0x01, 0x09, 0x06, 
+    0x33, 0x04, 0x07, 0x2e, 0x10, 0x4b, 0x83, 0x37, 0x83, 0x00, 0x00, 0x0d, 0x87, 0x00, 0x81, 0x02, 0x08, 0xff, 0xbf, 0xd7, 0xed, 0x6a, 
+    0xbb, 0x2a, 0x4e, 0xff, 0xc9, 0x09, 0xff, 0x3a, 0xae, 0x02, 0x86, 0x00, 0x05, 0x02, 0xff, 0xfa, 0x9d, 0x94, 0x13, 0x03, 0x04, 0x82, 
+    0x01, 0x05, 0x06, 0x03, 0x0a, 0x20, 0xae, 0x1a, 0x81, 0x02, 0x82, 0x00, 0x09, 0xff, 0xdd, 0xce, 0x59, 0x10, 0x0b, 0x05, 0x1b, 0x05, 
+    0x03, 0x05, 0x04, 0x81, 0x01, 0x03, 0x0c, 0x27, 0x93, 0x68, 0x82, 0x00, 0x00, 0x02, 0x88, 0x00, 0x07, 0x00, 0x02, 0x9e, 0x65, 0x04, 
+    0x01, 0x17, 0x01, 0x81, 0x05, 0x05, 0xff, 0xb0, 0x0a, 0x0b, 0x0c, 0x25, 0xff, 0x53, 0x6c, 0x02, 0x90, 0x00, 0x81, 0x02, 0x05, 0xff, 
+    0xda, 0xa5, 0x1d, 0x20, 0x1b, 0x05, 0x03, 0x81, 0x04, 0x00, 0x01, 0x81, 0x0e, 0x03, 0x03, 0x20, 0xd6, 0x74, 0x83, 0x00, 0x00, 0x0d, 
+    0x85, 0x00, 0x11, 0x46, 0x1d, 0x12, 0x0a, 0xfb, 0x04, 0x0f, 0x05, 0x0e, 0xff, 0xd0, 0x0a, 0x3f, 0x0e, 0x3a, 0x7b, 0xff, 0xd3, 0x5b, 
+    0xf0, 0x02, 0x00, 0x83, 0x02, 0x84, 0x00, 0x0d, 0x02, 0x46, 0xad, 0x6e, 0x5b, 0x29, 0x12, 0x0c, 0x11, 0x30, 0xff, 0x6d, 0x32, 0x68, 
+    0x00, 0x8a, 0x85, 0x00, 0x08, 0x7d, 0x7b, 0x20, 0x06, 0x4a, 0x01, 0x06, 0x05, 0x33, 0x81, 0x04, 0x06, 0x09, 0x06, 0x04, 0x50, 0x28, 
+    0xaa, 0xff, 0x3a, 0xa6, 0x81, 0x02, 0x86, 0x00, 0x81, 0x02, 0x09, 0x51, 0x83, 0x95, 0x15, 0x11, 0x06, 0x01, 0x09, 0x06, 0x09, 0x81, 
+    0x81, 0x07, 0x07, 0x04, 0x16, 0x2d, 0x93, 0x02, 0x00, 0x0d, 0x9f, 0x00, 0x05, 0x02, 0x3b, 0xff, 0xca, 0x19, 0x1f, 0x03, 0x04, 0x82, 
+    0x01, 0x06, 0x0b, 0x03, 0x0e, 0x05, 0x28, 0xff, 0xf7, 0x74, 0x08, 0x84, 0x00, 0x00, 0x0d, 0x82, 0x00, 0x04, 0x02, 0xbd, 0x3e, 0xa5, 
+    0x03, 0x82, 0x09, 0x09, 0x06, 0x01, 0x05, 0x0b, 0x16, 0x2c, 0xd6, 0x7f, 0x4c, 0x02, 0x83, 0x00, 0x81, 0x02, 0x83, 0x00, 0x0b, 0x02, 
+    0x36, 0xd3, 0xff, 0xb1, 0x43, 0x30, 0x21, 0x10, 0x66, 0x10, 0x5e, 0xfe, 0x08, 0x86, 0x00, 0x05, 0x02, 0xe4, 0x1c, 0x0c, 0x03, 0x05, 
+    0x82, 0x01, 0x00, 0x04, 0x81, 0x03, 0x03, 0x29, 0x54, 0x08, 0x02, 0x83, 0x00, 0x11, 0x02, 0xb3, 0x1c, 0x03, 0x1b, 0x09, 0x04, 0x03, 
+    0x05, 0x01, 0x07, 0x01, 0x03, 0x2c, 0xc2, 0xff, 0xf9, 0xad, 0x02, 0x00, 0x81, 0x02, 0x88, 0x00, 0x0e, 0x00, 0x08, 0x42, 0x1f, 0x06, 
+    0x39, 0xff, 0x31, 0x02, 0x19, 0x0f, 0x07, 0x81, 0x0e, 0x0c, 0x1c, 0xc4, 0x93, 0x00, 0x04, 0x46, 0x76, 0xa5, 0x09, 0x07, 0x82, 0x04, 
+    0x09, 0x01, 0x05, 0x0e, 0x03, 0x14, 0x2d, 0x54, 0x9b, 0x00, 0x0d, 0x87, 0x00, 0x12, 0x02, 0x91, 0x13, 0x03, 0x09, 0x0f, 0x17, 0x18, 
+    0x09, 0x05, 0x0b, 0x06, 0x0b, 0x20, 0xa6, 0xff, 0x11, 0x3b, 0xff, 0x96, 0x74, 0xff, 0x7c, 0xae, 0x9a, 0x81, 0x02, 0x81, 0x00, 0x08, 
+    0x08, 0x44, 0xd0, 0xc3, 0xff, 0x14, 0x5c, 0xd2, 0xa6, 0xff, 0xee, 0x09, 0x0c, 0x81, 0x16, 0x04, 0x2e, 0x0b, 0x13, 0xda, 0xb4, 0x87, 
+    0x00, 0x04, 0xf5, 0x78, 0x12, 0x04, 0x0a, 0x81, 0x06, 0x01, 0x05, 0xf1, 0x81, 0x09, 0x09, 0x06, 0x33, 0x06, 0x0f, 0x03, 0x15, 0xff, 
+    0x6d, 0x1a, 0xff, 0x74, 0x64, 0xff, 0xfd, 0xbe, 0x08, 0x82, 0x02, 0x08, 0x00, 0x02, 0x08, 0x5d, 0xf4, 0xff, 0x0f, 0x33, 0x40, 0x10, 
+    0x11, 0x81, 0x03, 0x82, 0x05, 0x07, 0x1b, 0x05, 0x07, 0x01, 0x12, 0x2c, 0xff, 0xaa, 0x11, 0x08, 0x82, 0x00, 0x00, 0x0d, 0x9e, 0x00, 
+    0x04, 0x02, 0x6b, 0x59, 0x14, 0x03, 0x83, 0x01, 0x01, 0x03, 0x0b, 0x81, 0x03, 0x01, 0x24, 0xe4, 0x89, 0x00, 0x0b, 0x02, 0x08, 0x91, 
+    0x2c, 0x0c, 0x1b, 0x03, 0x09, 0x05, 0x01, 0x09, 0x1b, 0x81, 0x09, 0x05, 0x0c, 0x1f, 0xd2, 0xf4, 0xdf, 0x46, 0x83, 0x02, 0x0f, 0x08, 
+    0x6b, 0xaf, 0x86, 0x5f, 0xd2, 0x15, 0x5a, 0x65, 0x12, 0x0c, 0x16, 0x0c, 0x10, 0x1c, 0xcc, 0x86, 0x00, 0x06, 0x08, 0xe8, 0x26, 0x10, 
+    0x0c, 0x03, 0x05, 0x82, 0x01, 0x06, 0x03, 0x12, 0x26, 0xe5, 0x02, 0x00, 0x02, 0x82, 0x00, 0x09, 0x02, 0xff, 0xde, 0xbe, 0x91, 0x0c, 
+    0x03, 0x1b, 0x09, 0x01, 0x07, 0x01, 0x81, 0x07, 0x04, 0x05, 0x10, 0x26, 0x93, 0x68, 0x82, 0x00, 0x81, 0x0d, 0x86, 0x00, 0x03, 0x02, 
+    0x08, 0x4d, 0x14, 0x81, 0x06, 0x08, 0x0f, 0x34, 0x01, 0x07, 0x0e, 0x3f, 0x0c, 0x90, 0xcb, 0x92, 0x00, 0x05, 0x1e, 0x08, 0xb8, 0x26, 
+    0x03, 0x01, 0x83, 0x04, 0x82, 0x01, 0x03, 0x03, 0x15, 0x5c, 0xff, 0x9b, 0xc6, 0x8a, 0x00, 0x09, 0xff, 0xb1, 0x53, 0x4b, 0x16, 0x03, 
+    0x05, 0x1b, 0x06, 0x17, 0xf1, 0x09, 0x81, 0x06, 0x08, 0x09, 0x0a, 0x1f, 0x7b, 0x8f, 0xff, 0x70, 0x43, 0x9d, 0xff, 0x91, 0x5b, 0xff, 
+    0xb1, 0x5b, 0x81, 0xff, 0x90, 0x53, 0x08, 0xff, 0x70, 0x4b, 0x73, 0x30, 0x21, 0x1f, 0x2f, 0x0a, 0x04, 0x0a, 0x81, 0x03, 0x04, 0x09, 
+    0x16, 0x2a, 0xff, 0x0b, 0x22, 0xff, 0x3a, 0xb6, 0x81, 0x00, 0x00, 0x85, 0x82, 0x00, 0x03, 0x08, 0xff, 0x76, 0x74, 0x78, 0x12, 0x81, 
+    0x04, 0x1f, 0x09, 0x01, 0x09, 0x0f, 0x01, 0x06, 0x03, 0x04, 0x0f, 0x17, 0x0f, 0x0c, 0x23, 0x5e, 0x8e, 0x8d, 0x93, 0xc4, 0xff, 0x16, 
+    0x8d, 0xff, 0x95, 0x7c, 0x93, 0x6a, 0x73, 0x30, 0x41, 0x3f, 0x0b, 0x05, 0x06, 0x05, 0x06, 0x1b, 0x81, 0x05, 0x81, 0x07, 0x05, 0x0a, 
+    0xc8, 0x4d, 0xb6, 0x02, 0x1e, 0xa1, 0x00, 0x04, 0x02, 0xc5, 0x3e, 0x10, 0x04, 0x81, 0x01, 0x01, 0x07, 0x01, 0x81, 0x04, 0x03, 0x03, 
+    0x10, 0x2a, 0xff, 0xda, 0x9d, 0x87, 0x00, 0x01, 0x57, 0x00, 0x81, 0x02, 0x0a, 0xff, 0x0e, 0x43, 0x43, 0x53, 0x2e, 0x05, 0x1b, 0x09, 
+    0x1b, 0x06, 0x09, 0x06, 0x81, 0x01, 0x05, 0x0a, 0x5a, 0x15, 0xb2, 0xff, 0x31, 0x43, 0xee, 0x81, 0xac, 0x0b, 0xff, 0xb1, 0x53, 0xff, 
+    0x90, 0x4b, 0xff, 0x50, 0x43, 0xf6, 0x2a, 0x1c, 0x3c, 0x3a, 0x31, 0x04, 0x03, 0x16, 0x81, 0x03, 0x03, 0x0c, 0x13, 0xff, 0x2d, 0x22, 
+    0xff, 0xdd, 0xce, 0x85, 0x00, 0x03, 0x37, 0xb8, 0x25, 0x10, 0x81, 0x03, 0x83, 0x01, 0x04, 0x03, 0x12, 0x4d, 0x51, 0x02, 0x85, 0x00, 
+    0x06, 0x1a, 0xb3, 0x15, 0xa7, 0x09, 0x01, 0x05, 0x81, 0x07, 0x0a, 0x01, 0x19, 0x09, 0x03, 0x23, 0x70, 0xcd, 0x02, 0x0d, 0x00, 0x0d, 
+    0x87, 0x00, 0x06, 0x02, 0x4c, 0x32, 0x53, 0x2e, 0x0b, 0x06, 0x81, 0x04, 0x05, 0x06, 0x05, 0x2e, 0x13, 0xff, 0x11, 0x33, 0x7e, 0x91, 
+    0x00, 0x00, 0x1e, 0x81, 0x00, 0x02, 0x36, 0x4d, 0x16, 0x82, 0x01, 0x0a, 0x05, 0x04, 0x07, 0x19, 0x07, 0x06, 0x33, 0x24, 0xff, 0xb9, 
+    0x95, 0x08, 0x02, 0x86, 0x00, 0x10, 0x0d, 0x00, 0x3b, 0xff, 0xa6, 0x00, 0xe2, 0x03, 0x05, 0x2e, 0x06, 0x0f, 0x18, 0xff, 0xb3, 0x12, 
+    0x0f, 0x01, 0x04, 0x03, 0x16, 0x81, 0x3c, 0x01, 0x40, 0x29, 0x82, 0x1c, 0x04, 0x21, 0x28, 0x5a, 0x0c, 0x0a, 0x82, 0x04, 0x09, 0x06, 
+    0x09, 0x0b, 0x03, 0x17, 0x01, 0x0c, 0x2a, 0x71, 0xdc, 0x83, 0x00, 0x05, 0x02, 0x6b, 0xff, 0xf4, 0x5b, 0x96, 0x0a, 0x04, 0x81, 0x01, 
+    0x04, 0x39, 0x19, 0x01, 0x19, 0x09, 0x81, 0x07, 0x16, 0x09, 0x17, 0x0f, 0x09, 0x03, 0x10, 0x15, 0x2a, 0x42, 0x5b, 0xab, 0xd6, 0x4b, 
+    0x25, 0x15, 0x03, 0x06, 0x07, 0x17, 0x01, 0x09, 0x04, 0x09, 0x81, 0x0b, 0x81, 0x05, 0x04, 0x04, 0x14, 0x2b, 0xff, 0xb6, 0x7c, 0x02, 
+    0xa3, 0x00, 0x04, 0x08, 0xff, 0x38, 0x85, 0x25, 0x12, 0x18, 0x81, 0x01, 0x00, 0x34, 0x81, 0x01, 0x04, 0x04, 0x0a, 0x1f, 0xb2, 0xa4, 
+    0x8a, 0x00, 0x09, 0x02, 0xa0, 0xb5, 0xce, 0x2e, 0x04, 0x01, 0x09, 0x05, 0x0f, 0x81, 0x17, 0x03, 0x34, 0x01, 0x07, 0x0b, 0x81, 0x11, 
+    0x01, 0x13, 0x28, 0x81, 0x21, 0x12, 0x29, 0x5e, 0x15, 0x1f, 0x20, 0x11, 0x05, 0x09, 0x0f, 0x04, 0x03, 0x0a, 0x03, 0x31, 0x2f, 0x12, 
+    0x42, 0xff, 0x2f, 0x4b, 0x02, 0x83, 0x00, 0x04, 0x02, 0x4c, 0xe0, 0x21, 0x03, 0x81, 0x05, 0x08, 0x07, 0x19, 0x34, 0x01, 0x0b, 0x14, 
+    0x3e, 0x52, 0x02, 0x83, 0x00, 0x06, 0x0d, 0x00, 0x02, 0xc5, 0x61, 0x10, 0x03, 0x81, 0x01, 0x00, 0x05, 0x81, 0x07, 0x06, 0x01, 0x07, 
+    0x06, 0x11, 0x1c, 0xef, 0x37, 0x8a, 0x00, 0x06, 0x08, 0xff, 0x77, 0x8d, 0xa2, 0x10, 0x0c, 0x16, 0x0a, 0x81, 0x04, 0x05, 0x06, 0x03, 
+    0x0c, 0x1f, 0xff, 0xd3, 0x4b, 0x46, 0x90, 0x00, 0x00, 0x1e, 0x82, 0x00, 0x02, 0x3b, 0xa1, 0x60, 0x82, 0x04, 0x81, 0x03, 0x01, 0x06, 
+    0x17, 0x81, 0x07, 0x04, 0x06, 0x3a, 0xe0, 0xff, 0x5f, 0xcf, 0x02, 0x86, 0x00, 0x00, 0x0d, 0x81, 0x00, 0x05, 0x71, 0x1c, 0x10, 0x03, 
+    0x0b, 0x06, 0x81, 0x01, 0x0c, 0x0f, 0x4a, 0x0f, 0x06, 0x09, 0x11, 0x0c, 0x16, 0x0c, 0x16, 0x0b, 0x03, 0x0a, 0x81, 0x03, 0x03, 0x04, 
+    0x06, 0x01, 0x09, 0x81, 0x01, 0x09, 0x06, 0x04, 0x0a, 0x06, 0x09, 0x06, 0x16, 0x27, 0xff, 0x4c, 0x2a, 0x3b, 0x83, 0x00, 0x05, 0x02, 
+    0x5d, 0xff, 0x32, 0x43, 0x1f, 0x09, 0x07, 0x82, 0x01, 0x00, 0x0f, 0x81, 0x19, 0x16, 0x1b, 0x05, 0x0e, 0x05, 0x04, 0x33, 0x04, 0x06, 
+    0x0a, 0x31, 0x12, 0x0c, 0x14, 0x0c, 0x13, 0x10, 0x0c, 0x06, 0x01, 0x17, 0x01, 0x0f, 0x01, 0x81, 0x04, 0x01, 0x03, 0x09, 0x81, 0x0b, 
+    0x04, 0x2e, 0xff, 0xb0, 0x1a, 0x58, 0xff, 0x92, 0x53, 0x37, 0xa1, 0x00, 0x00, 0x0d, 0x81, 0x00, 0x0e, 0x37, 0x47, 0x60, 0x03, 0x18, 
+    0x04, 0x01, 0x34, 0x01, 0x0f, 0x04, 0x03, 0x60, 0x47, 0xa0, 0x89, 0x00, 0x08, 0x0d, 0x00, 0x02, 0xff, 0x6c, 0x32, 0x1c, 0x16, 0x2f, 
+    0x04, 0x39, 0x81, 0x01, 0x01, 0x4a, 0xff, 0x52, 0x02, 0x81, 0x17, 0x04, 0x01, 0x05, 0x0e, 0x3f, 0x0b, 0x83, 0x03, 0x03, 0x0b, 0x0c, 
+    0x0a, 0x04, 0x81, 0x05, 0x0b, 0x06, 0x01, 0x06, 0x03, 0x3a, 0x31, 0x18, 0xff, 0x0f, 0x0a, 0x10, 0x43, 0xff, 0x6b, 0x32, 0x02, 0x84, 
+    0x00, 0x02, 0xd0, 0x8f, 0x15, 0x81, 0x03, 0x81, 0x07, 0x06, 0x19, 0x34, 0x01, 0x03, 0x13, 0x73, 0x44, 0x86, 0x00, 0x05, 0x02, 0x08, 
+    0xde, 0x30, 0x22, 0x09, 0x82, 0x01, 0x00, 0x17, 0x81, 0x01, 0x04, 0x06, 0x03, 0x3c, 0x42, 0x82, 0x8a, 0x00, 0x07, 0x1a, 0xff, 0xf2, 
+    0x53, 0x29, 0x0c, 0x12, 0x0a, 0x04, 0x0a, 0x81, 0x04, 0x04, 0x03, 0x11, 0x21, 0x7f, 0x08, 0x94, 0x00, 0x03, 0x02, 0x7e, 0xd8, 0x12, 
+    0x81, 0x04, 0x82, 0x03, 0x06, 0x04, 0x03, 0x05, 0x06, 0x0c, 0xff, 0xaa, 0x01, 0xbd, 0x88, 0x00, 0x0d, 0x0d, 0x00, 0x46, 0x99, 0x66, 
+    0x12, 0x09, 0x0e, 0x07, 0x81, 0x01, 0x06, 0x04, 0x09, 0x81, 0x03, 0x05, 0x16, 0x0a, 0x06, 0x05, 0x0e, 0x06, 0x81, 0x01, 0x81, 0x04, 
+    0x04, 0x0f, 0x01, 0x1b, 0x05, 0x09, 0x81, 0x03, 0x07, 0x06, 0x03, 0x0b, 0x3c, 0xff, 0xaa, 0x01, 0xff, 0xee, 0x3a, 0x51, 0x02, 0x83, 
+    0x00, 0x15, 0x02, 0x74, 0x5c, 0x14, 0x09, 0x07, 0x06, 0x2e, 0x0b, 0x05, 0x04, 0x09, 0x03, 0x65, 0x0c, 0x12, 0xc7, 0xff, 0xd3, 0x1a, 
+    0x09, 0x05, 0x06, 0x05, 0x81, 0x01, 0x09, 0x06, 0x09, 0x05, 0x1b, 0x0b, 0x05, 0x04, 0x0f, 0x06, 0x01, 0x81, 0x06, 0x09, 0x09, 0x04, 
+    0x06, 0x03, 0x16, 0xe2, 0x32, 0xd1, 0x46, 0x02, 0xa4, 0x00, 0x02, 0x1a, 0x75, 0x20, 0x82, 0x03, 0x00, 0x05, 0x81, 0x04, 0x05, 0x0f, 
+    0x04, 0x16, 0x24, 0xb8, 0x48, 0x8c, 0x00, 0x0e, 0x46, 0xff, 0xc7, 0x00, 0x67, 0x22, 0x33, 0x04, 0x06, 0x04, 0x18, 0x04, 0x09, 0x05, 
+    0x06, 0x03, 0x0b, 0x81, 0x03, 0x00, 0x18, 0x81, 0x06, 0x05, 0x05, 0x0e, 0x0b, 0x03, 0x04, 0x05, 0x81, 0x0b, 0x09, 0x05, 0x0e, 0x05, 
+    0x06, 0x2f, 0x12, 0x14, 0x3e, 0xff, 0x2f, 0x43, 0xff, 0x7e, 0xdf, 0x84, 0x00, 0x06, 0x02, 0xff, 0xd9, 0x9d, 0x4b, 0x23, 0x0a, 0x03, 
+    0x04, 0x82, 0x01, 0x04, 0x04, 0x0c, 0x15, 0x7f, 0x08, 0x87, 0x00, 0x04, 0x08, 0xb7, 0x32, 0x14, 0x31, 0x81, 0x04, 0x00, 0x0f, 0x81, 
+    0x04, 0x06, 0x0f, 0x04, 0x06, 0x03, 0x1c, 0x7f, 0x44, 0x89, 0x00, 0x0e, 0x1a, 0xe1, 0x30, 0x14, 0x0a, 0x03, 0x31, 0x04, 0x17, 0x04, 
+    0x03, 0x10, 0x25, 0xcc, 0x02, 0x95, 0x00, 0x03, 0x51, 0xff, 0x6e, 0x2a, 0x1f, 0x22, 0x83, 0x03, 0x07, 0x04, 0x0b, 0x03, 0x05, 0x11, 
+    0x27, 0xf4, 0x68, 0x8a, 0x00, 0x04, 0xff, 0x1c, 0xae, 0xff, 0xc8, 0x00, 0xa5, 0x16, 0x2e, 0x81, 0x0e, 0x0e, 0x07, 0x01, 0x0f, 0x04, 
+    0x06, 0x09, 0x03, 0x04, 0x01, 0x07, 0x05, 0x07, 0x17, 0x01, 0x0f, 0x81, 0x06, 0x0c, 0x09, 0x05, 0x3f, 0x0b, 0xa7, 0x0c, 0x0a, 0x16, 
+    0x30, 0xff, 0x89, 0x01, 0x9c, 0x44, 0x02, 0x84, 0x00, 0x06, 0x02, 0xff, 0x57, 0x8d, 0xff, 0xeb, 0x11, 0x3c, 0x05, 0x01, 0x0a, 0x81, 
+    0x03, 0x0f, 0x0b, 0x04, 0x16, 0x28, 0xff, 0x9b, 0x7d, 0x25, 0x23, 0x12, 0xc7, 0x06, 0x09, 0x01, 0x19, 0x17, 0x01, 0x07, 0x81, 0x39, 
+    0x81, 0x05, 0x06, 0x09, 0x01, 0x04, 0x01, 0x04, 0x0f, 0x09, 0x82, 0x04, 0x04, 0x22, 0x23, 0x32, 0xff, 0x2f, 0x4b, 0xfc, 0x81, 0x00, 
+    0x00, 0x57, 0xa3, 0x00, 0x02, 0x1a, 0x1d, 0x31, 0x81, 0x03, 0x00, 0x0b, 0x81, 0x05, 0x05, 0x06, 0x09, 0x04, 0x11, 0x27, 0x38, 0x8d, 
+    0x00, 0x05, 0x02, 0x92, 0x61, 0xff, 0xb1, 0x2a, 0x22, 0x0a, 0x81, 0x06, 0x00, 0x04, 0x81, 0x06, 0x05, 0x09, 0x05, 0x0b, 0x03, 0x0b, 
+    0x04, 0x81, 0x18, 0x81, 0x01, 0x00, 0x0e, 0x81, 0x05, 0x02, 0x03, 0x09, 0x03, 0x81, 0x05, 0x07, 0x1b, 0x05, 0x50, 0x22, 0x15, 0x32, 
+    0xff, 0xd5, 0x7c, 0x3b, 0x82, 0x00, 0x00, 0x0d, 0x81, 0x00, 0x0e, 0x02, 0xff, 0x57, 0x8d, 0x27, 0x67, 0x0a, 0x03, 0x05, 0x09, 0x0f, 
+    0x04, 0x0a, 0x13, 0x43, 0xff, 0x78, 0x8d, 0x02, 0x81, 0x00, 0x00, 0x0d, 0x85, 0x00, 0x0f, 0x3b, 0xff, 0x8d, 0x32, 0xa6, 0x20, 0x04, 
+    0x09, 0x06, 0x09, 0x03, 0x06, 0x04, 0x05, 0x03, 0x13, 0xf9, 0xaf, 0x89, 0x00, 0x0d, 0x08, 0xff, 0xe6, 0x00, 0x90, 0x10, 0x1f, 0x2f, 
+    0x0f, 0x01, 0x19, 0x0f, 0x31, 0x13, 0x5b, 0x92, 0x94, 0x00, 0x08, 0x0d, 0x00, 0x08, 0xd3, 0x24, 0x12, 0x04, 0x03, 0x05, 0x81, 0x06, 
+    0x06, 0x09, 0x06, 0x03, 0x10, 0x40, 0x95, 0x98, 0x8a, 0x00, 0x10, 0x02, 0xff, 0xd7, 0x84, 0x4d, 0x7b, 0xa7, 0x3f, 0x05, 0x09, 0x06, 
+    0x17, 0x01, 0x0f, 0x01, 0x07, 0x19, 0x01, 0x07, 0x81, 0x01, 0x02, 0x09, 0x07, 0x1b, 0x81, 0x05, 0x00, 0x1b, 0x81, 0x05, 0x07, 0x11, 
+    0x0c, 0x10, 0xa5, 0x26, 0xff, 0xca, 0x11, 0x7e, 0x48, 0x86, 0x00, 0x12, 0x08, 0xff, 0xf6, 0x7c, 0xa2, 0x11, 0x06, 0x01, 0x04, 0x03, 
+    0x1b, 0x01, 0x05, 0x12, 0x1d, 0xff, 0x1f, 0xbf, 0xff, 0xff, 0xbe, 0x32, 0xff, 0x2e, 0x1a, 0x12, 0x06, 0x81, 0x01, 0x00, 0x19, 0x81, 
+    0x01, 0x01, 0x17, 0x0f, 0x82, 0x04, 0x00, 0x18, 0x84, 0x04, 0x81, 0x0f, 0x81, 0x2f, 0x04, 0xa6, 0x4d, 0x9c, 0x46, 0x02, 0xa4, 0x00, 
+    0x05, 0xff, 0xde, 0xf7, 0x00, 0xff, 0x1d, 0xc7, 0x58, 0x0a, 0x05, 0x82, 0x07, 0x82, 0x01, 0x03, 0x03, 0x14, 0x4b, 0xbf, 0x8d, 0x00, 
+    0x07, 0x02, 0x08, 0xff, 0xf3, 0x63, 0xff, 0xe9, 0x00, 0xff, 0x4f, 0x22, 0x12, 0x0c, 0x2e, 0x81, 0x09, 0x02, 0x01, 0x07, 0x01, 0x81, 
+    0x05, 0x05, 0x03, 0x0a, 0x2f, 0x18, 0x0a, 0x06, 0x81, 0x05, 0x0c, 0x0e, 0x07, 0x04, 0x0a, 0x03, 0x0b, 0x05, 0x03, 0x14, 0x78, 0xff, 
+    0xca, 0x11, 0xff, 0x1d, 0xc7, 0x08, 0x81, 0x00, 0x00, 0x85, 0x81, 0x00, 0x05, 0x0d, 0x00, 0x08, 0xff, 0xd5, 0x74, 0x27, 0x16, 0x81, 
+    0x03, 0x81, 0x05, 0x05, 0x01, 0x03, 0x11, 0x10, 0x1d, 0xf7, 0x8a, 0x00, 0x04, 0xbd, 0x4d, 0x12, 0x03, 0x07, 0x81, 0x05, 0x82, 0x03, 
+    0x05, 0x06, 0x0b, 0x11, 0x27, 0xe7, 0x46, 0x88, 0x00, 0x0d, 0x6c, 0xb5, 0x75, 0x23, 0x14, 0x03, 0x04, 0x01, 0x19, 0x04, 0x0a, 0x1f, 
+    0xaa, 0xcd, 0x96, 0x00, 0x05, 0x02, 0x5d, 0x2d, 0x1f, 0x0a, 0x03, 0x81, 0x05, 0x81, 0x01, 0x06, 0x09, 0x0a, 0x11, 0xe2, 0x91, 0x7d, 
+    0x02, 0x8a, 0x00, 0x06, 0x08, 0x38, 0x61, 0x15, 0x53, 0x03, 0x04, 0x81, 0x18, 0x02, 0x01, 0x39, 0xff, 0xb2, 0x02, 0x81, 0x07, 0x82, 
+    0x01, 0x01, 0x06, 0x07, 0x81, 0x05, 0x81, 0x0e, 0x00, 0x05, 0x81, 0x03, 0x06, 0x10, 0xff, 0xb0, 0x1a, 0x1c, 0x61, 0xff, 0x95, 0x6c, 
+    0x1a, 0x02, 0x81, 0x00, 0x00, 0x8a, 0x84, 0x00, 0x03, 0x37, 0xcc, 0x69, 0x0c, 0x81, 0x03, 0x01, 0x0a, 0x03, 0x81, 0x07, 0x0b, 0x03, 
+    0x10, 0x59, 0x6b, 0x02, 0xdf, 0x61, 0x21, 0x12, 0x0a, 0x31, 0x33, 0x82, 0x04, 0x07, 0x0a, 0x2f, 0x18, 0x0a, 0x04, 0x06, 0x33, 0x09, 
+    0x81, 0x04, 0x07, 0x0a, 0x2f, 0xc8, 0x78, 0xff, 0x6a, 0x09, 0x7d, 0x08, 0x02, 0xa7, 0x00, 0x03, 0xff, 0x97, 0x9d, 0x3e, 0x16, 0x05, 
+    0x81, 0x07, 0x81, 0x01, 0x81, 0x04, 0x03, 0x03, 0x13, 0x5c, 0xff, 0x3a, 0xb6, 0x8d, 0x00, 0x0c, 0x1e, 0x48, 0x08, 0xff, 0x75, 0x74, 
+    0x99, 0x7b, 0x13, 0x16, 0x03, 0x05, 0x06, 0xff, 0xb2, 0x02, 0x01, 0x81, 0x05, 0x02, 0x06, 0x0a, 0x33, 0x81, 0x04, 0x10, 0x0a, 0x03, 
+    0x1b, 0x0e, 0x1b, 0x04, 0xff, 0x0f, 0x02, 0x16, 0x3c, 0x10, 0x26, 0xff, 0xe8, 0x00, 0xf8, 0x1a, 0x08, 0x02, 0x8a, 0x85, 0x00, 0x04, 
+    0x46, 0xef, 0x29, 0x11, 0x03, 0x82, 0x05, 0x81, 0x03, 0x03, 0x11, 0x23, 0xbc, 0x4c, 0x86, 0x00, 0x07, 0x0d, 0x00, 0x0d, 0x1e, 0xff, 
+    0x5f, 0xdf, 0xff, 0xae, 0x32, 0x29, 0x11, 0x81, 0x0b, 0x01, 0x05, 0x03, 0x81, 0x11, 0x05, 0x0b, 0x05, 0x03, 0x23, 0x76, 0x7e, 0x88, 
+    0x00, 0x05, 0xff, 0x7e, 0xb6, 0x76, 0xff, 0x6f, 0x22, 0x14, 0xc8, 0x0a, 0x81, 0x04, 0x06, 0x01, 0x03, 0x0c, 0x2a, 0xff, 0x70, 0x43, 
+    0x36, 0x02, 0x92, 0x00, 0x00, 0x0d, 0x81, 0x00, 0x10, 0x02, 0x37, 0x6a, 0x21, 0xff, 0xb1, 0x1a, 0x16, 0x03, 0x0b, 0x05, 0x04, 0x31, 
+    0x0c, 0x13, 0x90, 0x95, 0xff, 0x2f, 0x43, 0xa0, 0x8a, 0x00, 0x81, 0x02, 0x04, 0xb0, 0x59, 0x76, 0xff, 0x4f, 0x1a, 0xd9, 0x81, 0x22, 
+    0x0c, 0x03, 0x05, 0x01, 0x07, 0x01, 0x09, 0x07, 0x05, 0x0b, 0x05, 0x3f, 0x50, 0x0b, 0x81, 0x0a, 0x05, 0x12, 0xa6, 0x43, 0xff, 0xc6, 
+    0x00, 0xff, 0x53, 0x64, 0x1a, 0x81, 0x08, 0x81, 0x00, 0x00, 0x85, 0x85, 0x00, 0x03, 0x36, 0x72, 0x2a, 0x23, 0x81, 0x14, 0x07, 0x22, 
+    0x03, 0x05, 0x0b, 0x16, 0x30, 0xff, 0xa9, 0x11, 0x3b, 0x81, 0x02, 0x08, 0x37, 0xab, 0x1d, 0x2c, 0x67, 0x12, 0x50, 0x3a, 0x03, 0x81, 
+    0x12, 0x82, 0x03, 0x0c, 0x09, 0x06, 0x03, 0x0c, 0x16, 0x10, 0x24, 0x99, 0xff, 0x92, 0x53, 0x63, 0x02, 0x00, 0x02, 0xa4, 0x00, 0x00, 
+    0x0d, 0x81, 0x00, 0x03, 0xff, 0x52, 0x74, 0x70, 0x14, 0x12, 0x82, 0x03, 0x06, 0x0a, 0x22, 0x12, 0x10, 0xea, 0xd1, 0xe9, 0x8f, 0x00, 
+    0x09, 0x02, 0x08, 0xff, 0x1b, 0xae, 0x59, 0x43, 0xce, 0x10, 0x0c, 0x03, 0x05, 0x81, 0x07, 0x02, 0x0e, 0x09, 0x1b, 0x81, 0x06, 0x0b, 
+    0x04, 0x0a, 0x12, 0x0c, 0x0b, 0x4f, 0xc8, 0xff, 0x90, 0x22, 0x1c, 0x32, 0x61, 0xff, 0xb6, 0x84, 0x82, 0x02, 0x82, 0x00, 0x01, 0x85, 
+    0x0d, 0x82, 0x00, 0x04, 0x02, 0xff, 0x9b, 0xbe, 0xb3, 0x2c, 0x12, 0x81, 0x04, 0x81, 0x03, 0x05, 0x0a, 0x22, 0x14, 0x30, 0xc2, 0x44, 
+    0x8a, 0x00, 0x06, 0x08, 0xe5, 0x1d, 0x14, 0x16, 0x12, 0x11, 0x83, 0x10, 0x00, 0x11, 0x81, 0x10, 0x02, 0x42, 0xb4, 0x9b, 0x87, 0x00, 
+    0x06, 0xff, 0x96, 0x74, 0x61, 0x4d, 0xbb, 0x25, 0x24, 0xd7, 0x81, 0x28, 0x04, 0x29, 0x2d, 0x61, 0xff, 0x6f, 0x4b, 0x08, 0x93, 0x00, 
+    0x00, 0x0d, 0x82, 0x00, 0x0f, 0x02, 0xd0, 0xff, 0xa7, 0x00, 0xbb, 0x24, 0x26, 0x29, 0x69, 0x24, 0xd7, 0x25, 0x43, 0xff, 0xaa, 0x01, 
+    0xff, 0x89, 0x01, 0xff, 0xc5, 0x00, 0xff, 0x3a, 0xb6, 0x89, 0x00, 0x0f, 0x0d, 0x00, 0x1e, 0x00, 0x68, 0xff, 0x75, 0x7c, 0x99, 0x2b, 
+    0x42, 0x90, 0x10, 0x11, 0x06, 0x07, 0x09, 0x50, 0x81, 0x0b, 0x09, 0x2e, 0xc1, 0x53, 0x3c, 0x23, 0x2c, 0x26, 0x99, 0xff, 0x0c, 0x22, 
+    0xf8, 0x81, 0x08, 0x81, 0x02, 0x84, 0x00, 0x00, 0x0d, 0x83, 0x00, 0x02, 0xff, 0xfa, 0xad, 0xff, 0xeb, 0x21, 0x91, 0x81, 0x2d, 0x02, 
+    0xbb, 0xd7, 0x24, 0x81, 0x29, 0x17, 0x27, 0x32, 0xff, 0x2e, 0x4b, 0x3b, 0x02, 0x00, 0x48, 0x1a, 0xff, 0x7d, 0xb6, 0x70, 0x61, 0x2d, 
+    0x2c, 0x67, 0xa5, 0x23, 0x14, 0x12, 0x10, 0x12, 0x16, 0x10, 0x2c, 0x25, 0x81, 0x32, 0x05, 0x6a, 0x63, 0x02, 0x48, 0x00, 0x02, 0xa7, 
+    0x00, 0x03, 0x1e, 0xff, 0x87, 0x21, 0xca, 0x3e, 0x81, 0x78, 0x81, 0x24, 0x82, 0x26, 0x03, 0xbb, 0x61, 0xff, 0xb1, 0x5b, 0xdc, 0x8d, 
+    0x00, 0x00, 0x0d, 0x82, 0x00, 0x07, 0x02, 0x52, 0xff, 0x12, 0x5c, 0xff, 0x27, 0x01, 0xff, 0xaa, 0x01, 0x30, 0x10, 0x16, 0x81, 0x03, 
+    0x00, 0x05, 0x81, 0x07, 0x04, 0x09, 0x04, 0x2f, 0x12, 0xc8, 0x81, 0x23, 0x08, 0x2a, 0xbb, 0xff, 0xe8, 0x00, 0x8c, 0xc9, 0x08, 0x02, 
+    0x00, 0x0d, 0x82, 0x00, 0x81, 0x0d, 0x84, 0x00, 0x04, 0xff, 0xd8, 0xad, 0xff, 0x88, 0x11, 0x1d, 0x24, 0xff, 0xad, 0x01, 0x82, 0x24, 
+    0x81, 0x26, 0x03, 0x76, 0xbc, 0xff, 0x4f, 0x4b, 0x68, 0x86, 0x00, 0x00, 0x0d, 0x81, 0x00, 0x04, 0x0d, 0x00, 0x36, 0xff, 0x4c, 0x22, 
+    0x1d, 0x81, 0x27, 0x00, 0x26, 0x82, 0x2d, 0x06, 0x27, 0x29, 0x1d, 0x27, 0xca, 0xff, 0xc5, 0x00, 0xff, 0x7b, 0xbe, 0x87, 0x00, 0x01, 
+    0xff, 0x78, 0x9d, 0xc4, 0x81, 0xc3, 0x02, 0xff, 0xd6, 0x84, 0xcf, 0x55, 0x81, 0xd3, 0x03, 0xff, 0xf6, 0x7c, 0xff, 0xf6, 0x8c, 0xff, 
+    0x94, 0x84, 0xff, 0xd8, 0xad, 0x81, 0x00, 0x00, 0x0d, 0x93, 0x00, 0x00, 0x0d, 0x81, 0x00, 0x05, 0x9b, 0xec, 0xff, 0xd6, 0x84, 0xad, 
+    0xc3, 0x86, 0x81, 0x38, 0x06, 0xcf, 0x38, 0xff, 0xd6, 0x84, 0x38, 0xff, 0x77, 0x95, 0xff, 0x73, 0x7c, 0xff, 0xf8, 0xb5, 0x8e, 0x00, 
+    0x14, 0x02, 0x1a, 0x7d, 0xff, 0x6b, 0x2a, 0xff, 0x47, 0x01, 0x32, 0x29, 0xff, 0xce, 0x01, 0xff, 0xef, 0x01, 0xc7, 0xff, 0x0f, 0x02, 
+    0x20, 0x28, 0x29, 0x27, 0x91, 0xb5, 0xbc, 0xff, 0xcd, 0x3a, 0xbf, 0x37, 0x82, 0x02, 0x84, 0x00, 0x81, 0x0d, 0x82, 0x00, 0x00, 0x85, 
+    0x81, 0x00, 0x07, 0xff, 0xdc, 0xd6, 0xff, 0xd5, 0x8c, 0x38, 0x55, 0x38, 0xff, 0xf7, 0x8c, 0xcf, 0x38, 0x81, 0x86, 0x03, 0x38, 0xff, 
+    0x94, 0x7c, 0xff, 0x3a, 0xb6, 0x02, 0x82, 0x00, 0x00, 0xff, 0x9f, 0xef, 0x81, 0x02, 0x07, 0x6b, 0xe3, 0xff, 0xeb, 0x19, 0x61, 0x59, 
+    0x1d, 0x3e, 0x58, 0x81, 0x26, 0x05, 0x4d, 0x61, 0xff, 0x8a, 0x11, 0xff, 0x50, 0x53, 0xff, 0xfa, 0xad, 0x48, 0x81, 0x02, 0x00, 0x1e, 
+    0xa8, 0x00, 0x00, 0x0d, 0x81, 0x00, 0x02, 0xff, 0x52, 0x7c, 0x86, 0xad, 0x81, 0xcf, 0x81, 0x55, 0x05, 0x86, 0x38, 0xf5, 0x38, 0xff, 
+    0xb4, 0x84, 0xff, 0x7b, 0xc6, 0x84, 0x00, 0x00, 0x0d, 0x88, 0x00, 0x00, 0x0d, 0x81, 0x00, 0x0c, 0x77, 0x00, 0x02, 0x08, 0x1a, 0xff, 
+    0x56, 0x8d, 0xff, 0x2b, 0x22, 0xb5, 0x4d, 0x24, 0x28, 0x65, 0x03, 0x81, 0x09, 0x0c, 0x65, 0xff, 0xad, 0x01, 0x24, 0x91, 0x61, 0x32, 
+    0x71, 0xff, 0x58, 0x95, 0x1a, 0x02, 0x08, 0x02, 0x1e, 0x82, 0x00, 0x00, 0x0d, 0x82, 0x00, 0x00, 0xff, 0xbe, 0xff, 0x81, 0x00, 0x04, 
+    0x0d, 0x00, 0xff, 0xdb, 0xd6, 0xff, 0x93, 0x84, 0x38, 0x81, 0x55, 0x00, 0xf5, 0x81, 0x55, 0x07, 0x38, 0xf5, 0x38, 0xff, 0xb4, 0x7c, 
+    0xd0, 0x08, 0x1e, 0x0d, 0x88, 0x00, 0x03, 0x1e, 0x02, 0xb0, 0xff, 0xd5, 0x7c, 0x82, 0x38, 0x00, 0xf5, 0x82, 0x55, 0x81, 0xed, 0x04, 
+    0x86, 0xff, 0x57, 0x8d, 0xff, 0x72, 0x7c, 0xff, 0xf8, 0xb5, 0xff, 0xde, 0xf7, 0x86, 0x00, 0x00, 0x02, 0x83, 0x08, 0x01, 0x02, 0x08, 
+    0x83, 0x02, 0x82, 0x00, 0x00, 0x0d, 0x93, 0x00, 0x00, 0x85, 0x84, 0x00, 0x00, 0x08, 0x8a, 0x02, 0x8c, 0x00, 0x03, 0x0d, 0x00, 0x0d, 
+    0x1e, 0x82, 0x08, 0x0c, 0x1a, 0xff, 0x9f, 0xc7, 0xff, 0x3d, 0x96, 0xff, 0x3b, 0x6d, 0xff, 0xba, 0x5c, 0xff, 0x95, 0x3b, 0x31, 0xff, 
+    0x74, 0x33, 0xff, 0xd9, 0x64, 0xff, 0x19, 0x6d, 0xff, 0xdb, 0x8d, 0xff, 0x1f, 0xbf, 0xf3, 0x82, 0x08, 0x81, 0x00, 0x00, 0x1e, 0x81, 
+    0x00, 0x00, 0x0d, 0x86, 0x00, 0x02, 0x0d, 0x00, 0x0d, 0x82, 0x00, 0x81, 0x02, 0x00, 0x08, 0x86, 0x02, 0x81, 0x00, 0x01, 0x02, 0x77, 
+    0x81, 0x00, 0x82, 0x02, 0x81, 0x08, 0x0a, 0x1a, 0x6c, 0xff, 0x1f, 0xbf, 0xff, 0xbf, 0xae, 0xff, 0x9e, 0xa6, 0xff, 0x9f, 0xa6, 0xff, 
+    0xff, 0xb6, 0x9a, 0x1a, 0x08, 0x02, 0x85, 0x00, 0x00, 0xff, 0xde, 0xf7, 0x81, 0x00, 0x02, 0x0d, 0x00, 0x0d, 0xa5, 0x00, 0x81, 0x08, 
+    0x88, 0x02, 0x81, 0x00, 0x00, 0x0d, 0x8b, 0x00, 0x02, 0x0d, 0x00, 0x0d, 0x82, 0x00, 0x81, 0x02, 0x82, 0x08, 0x0b, 0x1a, 0x63, 0xff, 
+    0xdc, 0x95, 0xff, 0xfa, 0x74, 0xff, 0xb9, 0x5c, 0xff, 0x74, 0x2b, 0xf1, 0xff, 0xb6, 0x33, 0xff, 0xd9, 0x54, 0xff, 0x5a, 0x75, 0xff, 
+    0xfc, 0x8d, 0xff, 0xbe, 0xae, 0x81, 0x1a, 0x00, 0x08, 0x82, 0x02, 0x82, 0x00, 0x81, 0x0d, 0x8b, 0x00, 0x01, 0x02, 0x08, 0x86, 0x02, 
+    0x81, 0x08, 0x00, 0x02, 0x87, 0x00, 0x00, 0x77, 0x82, 0x00, 0x81, 0x02, 0x00, 0x08, 0x83, 0x02, 0x86, 0x08, 0x02, 0x02, 0x00, 0x57, 
+    0x86, 0x00, 
 };
+
+const uint32_t img_logo_rebtek_310_62_rle_size = sizeof(img_logo_rebtek_310_62_rle);
+
+#endif /* RESOURCE_BUILTIN_LOGOS */
@@ -0,0 +1,237 @@
+/*
+ *  res_pack.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+
+#include <stdio.h>
+#include "app_config.h"
+#include "log.h"
+#include "res_pack.h"
+
+#ifndef RES_PACK_FILE
+#include "W25Qx.h"
+#endif
+
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+
+typedef struct {
+    uint32_t address;               /* Block address in the pack, UINT32_MAX if empty */
+    uint32_t last_use;
+    uint8_t data[RES_CACHE_BLOCK_SIZE];
+} res_cache_block_t;
+
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+
+static res_pack_header_t pack_header;
+static res_pack_entry_t pack_entries[RES_PACK_MAX_ENTRIES];
+static bool pack_valid = false;
+
+static res_cache_block_t cache_blocks[RES_CACHE_BLOCKS];
+static uint32_t cache_clock;
+static res_pack_stats_t pack_stats;
+
+#ifdef RES_PACK_FILE
+static FILE *pack_file;
+#endif
+
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+/*                                FUNCTIONS                                   */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+
+/**
+ * @brief  Read raw pack bytes (offset from the start of the pack)
+ */
+static int res_flash_read(uint32_t offset, uint8_t *data, uint32_t size) {
+    pack_stats.flash_bytes += size;
+
+#ifdef RES_PACK_FILE
+    if ((pack_file == NULL) || (fseek(pack_file, offset, SEEK_SET) != 0)) {
+        return -1;
+    }
+    /* Cache blocks may run past the end of the file, read as erased flash */
+    size_t length = fread(data, 1, size, pack_file);
+    memset(&data[length], 0xFF, size - length);
+    return 0;
+#else
+    return (w25qx_read(data, RESOURCE_PACK_ADDRESS + offset, size) == W25Qx_OK) ? 0 : -1;
+#endif
+}
+
+/**
+ * @brief  Get a cached block, load it into the least recently used slot on a miss
+ */
+static const uint8_t *res_cache_get(uint32_t address) {
+    uint32_t i, lru = 0;
+
+    cache_clock++;
+    for (i = 0; i < RES_CACHE_BLOCKS; i++) {
+        if (cache_blocks[i].address == address) {
+            cache_blocks[i].last_use = cache_clock;
+            pack_stats.hits++;
+            return cache_blocks[i].data;
+        }
+        if (cache_blocks[i].last_use < cache_blocks[lru].last_use) {
+            lru = i;
+        }
+    }
+
+    pack_stats.misses++;
+    if (res_flash_read(address, cache_blocks[lru].data, RES_CACHE_BLOCK_SIZE) != 0) {
+        cache_blocks[lru].address = UINT32_MAX;
+        cache_blocks[lru].last_use = 0;
+        return NULL;
+    }
+
+    cache_blocks[lru].address = address;
+    cache_blocks[lru].last_use = cache_clock;
+    return cache_blocks[lru].data;
+}
+
+/******************************************************************************/
+
+/*!
+ * @brief  Load and check the pack index
+ */
+int res_pack_init(void) {
+    uint32_t i, checksum = 0;
+    uint8_t *index = (uint8_t*) pack_entries;
+
+    pack_valid = false;
+    for (i = 0; i < RES_CACHE_BLOCKS; i++) {
+        cache_blocks[i].address = UINT32_MAX;
+        cache_blocks[i].last_use = 0;
+    }
+
+#ifdef RES_PACK_FILE
+    pack_file = fopen(RES_PACK_FILE, "rb");
+#else
+    w25qx_init();
+#endif
+
+    if (res_flash_read(0, (uint8_t*) &pack_header, sizeof(pack_header)) != 0) {
+        LOG_WARN("Resource pack read failed");
+        return -1;
+    }
+
+    if ((pack_header.magic != RES_PACK_MAGIC) || (pack_header.version != RES_PACK_VERSION)
+        || (pack_header.count > RES_PACK_MAX_ENTRIES) || (pack_header.size > RESOURCE_PACK_MAX_SIZE)) {
+        LOG_INFO("No resource pack");
+        return -1;
+    }
+
+    if (res_flash_read(sizeof(pack_header), index, pack_header.count * sizeof(res_pack_entry_t)) != 0) {
+        return -1;
+    }
+
+    for (i = 0; i < pack_header.count * sizeof(res_pack_entry_t); i++) {
+        checksum += index[i];
+    }
+
+    if (checksum != pack_header.index_checksum) {
+        LOG_WARN("Resource pack index corrupted");
+        return -1;
+    }
+
+    for (i = 0; i < pack_header.count; i++) {
+        pack_entries[i].name[RES_PACK_NAME_LEN - 1] = '\0';
+        if ((pack_entries[i].offset > pack_header.size) || (pack_entries[i].size > pack_header.size - pack_entries[i].offset)) {
+            LOG_WARN("Resource %s out of the pack", pack_entries[i].name);
+            return -1;
+        }
+    }
+
+    LOG_INFO("Resource pack: %d entries, %lu bytes", pack_header.count, pack_header.size);
+    pack_valid = true;
+    return 0;
+}
+
+/*!
+ * @brief  Find a resource by name
+ */
+const res_pack_entry_t *res_pack_find(const char *name) {
+    uint32_t i;
+
+    if (!pack_valid) {
+        return NULL;
+    }
+
+    for (i = 0; i < pack_header.count; i++) {
+        if (strcmp(pack_entries[i].name, name) == 0) {
+            return &pack_entries[i];
+        }
+    }
+
+    return NULL;
+}
+
+/*!
+ * @brief  Read from a resource
+ */
+int32_t res_pack_read(const res_pack_entry_t *entry, uint32_t offset, void *data, uint32_t size) {
+    uint8_t *out = data;
+    uint32_t done = 0;
+
+    if (offset >= entry->size) {
+        return 0;
+    }
+    if (size > entry->size - offset) {
+        size = entry->size - offset;
+    }
+
+    while (done < size) {
+        uint32_t address = entry->offset + offset + done;
+        uint32_t block_offset = address % RES_CACHE_BLOCK_SIZE;
+        uint32_t remain = size - done;
+
+        /* Whole blocks (font loading) go straight to the buffer and keep the cache for small reads */
+        if ((block_offset == 0) && (remain >= RES_CACHE_BLOCK_SIZE)) {
+            uint32_t length = remain - (remain % RES_CACHE_BLOCK_SIZE);
+            if (res_flash_read(address, &out[done], length) != 0) {
+                return -1;
+            }
+            pack_stats.direct_reads++;
+            done += length;
+            continue;
+        }
+
+        const uint8_t *block = res_cache_get(address - block_offset);
+        if (block == NULL) {
+            return -1;
+        }
+
+        uint32_t length = RES_CACHE_BLOCK_SIZE - block_offset;
+        if (length > remain) {
+            length = remain;
+        }
+        memcpy(&out[done], &block[block_offset], length);
+        done += length;
+    }
+
+    return (int32_t) done;
+}
+
+/*!
+ * @brief  Get the read statistics
+ */
+const res_pack_stats_t *res_pack_get_stats(void) {
+    return &pack_stats;
+}
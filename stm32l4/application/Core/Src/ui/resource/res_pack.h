@@ -0,0 +1,117 @@
+/*
+ *  res_pack.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef _RES_PACK_H_
+#define _RES_PACK_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************************************************************/
+
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+
+#include <stdint.h>
+
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+
+/*
+ * Pack layout at RESOURCE_PACK_ADDRESS in the W25Q (little endian):
+ *   res_pack_header_t, res_pack_entry_t[count], data
+ * Entry offsets are from the start of the pack.
+ */
+#define RES_PACK_MAGIC             (0x50525354)    /* "TSRP" */
+#define RES_PACK_VERSION           (1)
+#define RES_PACK_NAME_LEN          (24)
+#define RES_PACK_MAX_ENTRIES       (16)
+
+/* Read cache, blocks of the pack kept in RAM (LRU) */
+#define RES_CACHE_BLOCK_SIZE       (512)
+#define RES_CACHE_BLOCKS           (8)
+
+/* Define to a file path to read the pack from a file instead of the W25Q (host build) */
+/* #define RES_PACK_FILE           "resources.bin" */
+
+typedef struct {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t count;
+    uint32_t size;                  /* Whole pack in bytes */
+    uint32_t index_checksum;        /* Additive checksum of the entry table */
+} __attribute__((packed)) res_pack_header_t;
+
+typedef struct {
+    char name[RES_PACK_NAME_LEN];   /* Zero terminated */
+    uint32_t offset;
+    uint32_t size;
+} __attribute__((packed)) res_pack_entry_t;
+
+typedef struct {
+    uint32_t hits;                  /* Cache block hits */
+    uint32_t misses;                /* Cache block loads */
+    uint32_t direct_reads;          /* Large reads bypassing the cache */
+    uint32_t flash_bytes;           /* Bytes read from the flash */
+} res_pack_stats_t;
+
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+/*                                FUNCTIONS                                   */
+/******************************************************************************/
+
+/*!
+ * @brief  Load and check the pack index
+ * @param  None
+ * @retval 0 if a valid pack is present, -1 otherwise
+ */
+int res_pack_init(void);
+
+/*!
+ * @brief  Find a resource by name
+ * @param  name: Resource name
+ * @retval Entry or NULL if not found
+ */
+const res_pack_entry_t *res_pack_find(const char *name);
+
+/*!
+ * @brief  Read from a resource
+ * @param  entry: Resource entry
+ * @param  offset: Offset in the resource
+ * @param  data: Output buffer
+ * @param  size: Number of bytes to read
+ * @retval Number of bytes read (less than size at the end of the resource), -1 on error
+ */
+int32_t res_pack_read(const res_pack_entry_t *entry, uint32_t offset, void *data, uint32_t size);
+
+/*!
+ * @brief  Get the read statistics
+ * @param  None
+ * @retval Pointer to the statistics
+ */
+const res_pack_stats_t *res_pack_get_stats(void);
+
+/******************************************************************************/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _RES_PACK_H_ */
@@ -0,0 +1,143 @@
+/*
+ *  resource.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+
+#include "lvgl.h"
+#include "app_config.h"
+#include "log.h"
+#include "lv_port_img.h"
+#include "res_pack.h"
+#include "resource.h"
+
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+
+#define RES_PATH_PREFIX            "R:"
+
+typedef struct {
+    const char *name;               /* Name in the resource pack */
+    const lv_font_t *builtin;
+} res_font_t;
+
+typedef struct {
+    const char *name;
+    const uint8_t *builtin;         /* RLE encoded */
+    const uint32_t *builtin_size;
+} res_image_t;
+
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+
+static const res_font_t res_fonts[RES_FONT_COUNT] = {
+#if LV_FONT_ABADI_36
+    /* RES_FONT_ABADI_36 */ {"abadi_36.bin", &lv_font_abadi_36},
+#else
+    /* RES_FONT_ABADI_36 */ {"abadi_36.bin", NULL},
+#endif
+#if LV_FONT_ABADI_40
+    /* RES_FONT_ABADI_40 */ {"abadi_40.bin", &lv_font_abadi_40},
+#else
+    /* RES_FONT_ABADI_40 */ {"abadi_40.bin", NULL},
+#endif
+#if LV_FONT_ABADI_44
+    /* RES_FONT_ABADI_44 */ {"abadi_44.bin", &lv_font_abadi_44},
+#else
+    /* RES_FONT_ABADI_44 */ {"abadi_44.bin", NULL},
+#endif
+};
+
+static const res_image_t res_images[RES_IMG_COUNT] = {
+#if RESOURCE_BUILTIN_LOGOS
+    /* RES_IMG_LOGO_MARINE */ {"logo_marine.rle", img_logo_marine_120x120_rle, &img_logo_marine_120x120_rle_size},
+    /* RES_IMG_LOGO_REBTEK */ {"logo_rebtek.rle", img_logo_rebtek_310_62_rle, &img_logo_rebtek_310_62_rle_size},
+#else
+    /* RES_IMG_LOGO_MARINE */ {"logo_marine.rle", NULL, NULL},
+    /* RES_IMG_LOGO_REBTEK */ {"logo_rebtek.rle", NULL, NULL},
+#endif
+};
+
+static const lv_font_t *fonts[RES_FONT_COUNT];
+static char image_paths[RES_IMG_COUNT][sizeof(RES_PATH_PREFIX) + RES_PACK_NAME_LEN];
+static lv_img_dsc_t image_builtin[RES_IMG_COUNT];
+
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+/*                                FUNCTIONS                                   */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+
+/*!
+ * @brief  Open the resource pack and load the fonts
+ */
+void resource_init(void) {
+    uint8_t i;
+    bool pack = (res_pack_init() == 0);
+
+    for (i = 0; i < RES_FONT_COUNT; i++) {
+        fonts[i] = NULL;
+
+        if (pack && (res_pack_find(res_fonts[i].name) != NULL)) {
+            char path[sizeof(RES_PATH_PREFIX) + RES_PACK_NAME_LEN];
+            snprintf(path, sizeof(path), RES_PATH_PREFIX "%s", res_fonts[i].name);
+            fonts[i] = lv_font_load(path);
+            if (fonts[i] == NULL) {
+                LOG_WARN("Font %s in the resource pack is invalid", res_fonts[i].name);
+            }
+        }
+
+        if (fonts[i] == NULL) {
+            fonts[i] = (res_fonts[i].builtin != NULL) ? res_fonts[i].builtin : LV_THEME_DEFAULT_FONT_NORMAL;
+        }
+    }
+
+    for (i = 0; i < RES_IMG_COUNT; i++) {
+        image_paths[i][0] = '\0';
+        if (pack && (res_pack_find(res_images[i].name) != NULL)) {
+            snprintf(image_paths[i], sizeof(image_paths[i]), RES_PATH_PREFIX "%s", res_images[i].name);
+        }
+        else if (res_images[i].builtin != NULL) {
+            lv_port_img_rle_dsc_init(&image_builtin[i], res_images[i].builtin, *res_images[i].builtin_size);
+        }
+    }
+}
+
+/*!
+ * @brief  Get a font, loaded from the resource pack or the built-in copy
+ */
+const lv_font_t *resource_font(uint8_t id) {
+    if ((id >= RES_FONT_COUNT) || (fonts[id] == NULL)) {
+        return LV_THEME_DEFAULT_FONT_NORMAL;
+    }
+    return fonts[id];
+}
+
+/*!
+ * @brief  Get an image source for lv_img_set_src()
+ */
+const void *resource_image(uint8_t id) {
+    if (id >= RES_IMG_COUNT) {
+        return NULL;
+    }
+
+    if (image_paths[id][0] != '\0') {
+        return image_paths[id];
+    }
+
+    return (image_builtin[id].data != NULL) ? &image_builtin[id] : NULL;
+}
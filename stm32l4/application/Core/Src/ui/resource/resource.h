@@ -23,6 +23,38 @@ extern "C" {
 /*                     EXPORTED TYPES and DEFINITIONS                         */
 /******************************************************************************/
 
+/* Built-in copies used when the W25Q resource pack is missing,
+ * build with 0 to leave them out of the internal flash.
+ * Fonts loaded from the pack are copied into the LVGL heap (mem_heap.c) by
+ * lv_font_load(): 36920 bytes in 24 blocks for the three compressed fonts,
+ * measured by ui_sim (host/ui_sim/pack_fonts.py). The other fonts of
+ * fonts/ (abadi_18, 24, 78) are not used by the UI, the linker drops them
+ * and they are not part of the pack. */
+#ifndef LV_FONT_ABADI_36
+#define LV_FONT_ABADI_36           1
+#endif
+#ifndef LV_FONT_ABADI_40
+#define LV_FONT_ABADI_40           1
+#endif
+#ifndef LV_FONT_ABADI_44
+#define LV_FONT_ABADI_44           1
+#endif
+#ifndef RESOURCE_BUILTIN_LOGOS
+#define RESOURCE_BUILTIN_LOGOS     1
+#endif
+
+enum {
+    RES_FONT_ABADI_36 = 0,
+    RES_FONT_ABADI_40,
+    RES_FONT_ABADI_44,
+    RES_FONT_COUNT,
+};
+
+enum {
+    RES_IMG_LOGO_MARINE = 0,
+    RES_IMG_LOGO_REBTEK,
+    RES_IMG_COUNT,
+};
 
 
 /******************************************************************************/
@@ -36,23 +68,44 @@ extern "C" {
 /******************************************************************************/
 
 /* Font resources */
-extern const lv_font_t lv_font_abadi_18;
-extern const lv_font_t lv_font_abadi_24;
 extern const lv_font_t lv_font_abadi_36;
 extern const lv_font_t lv_font_abadi_40;
 extern const lv_font_t lv_font_abadi_44;
-extern const lv_font_t lv_font_abadi_78;
 
 /* Image resources */
 extern const uint8_t img_arrow_up_11x21[];
 extern const uint8_t img_arrow_down_11x21[];
-extern const uint8_t img_logo_marine_120x120[];
-extern const uint8_t img_logo_rebtek_310_62[];
+#if RESOURCE_BUILTIN_LOGOS
+extern const uint8_t img_logo_marine_120x120_rle[];       /* RLE encoded, see tools/img_rle.py */
+extern const uint32_t img_logo_marine_120x120_rle_size;
+extern const uint8_t img_logo_rebtek_310_62_rle[];
+extern const uint32_t img_logo_rebtek_310_62_rle_size;
+#endif
 
 /******************************************************************************/
 /*                                FUNCTIONS                                   */
 /******************************************************************************/
 
+/*!
+ * @brief  Open the resource pack and load the fonts, call after the LVGL ports are initialized
+ * @param  None
+ * @retval None
+ */
+void resource_init(void);
+
+/*!
+ * @brief  Get a font, loaded from the resource pack or the built-in copy
+ * @param  id: RES_FONT_xxx
+ * @retval Font, the theme font if neither is available
+ */
+const lv_font_t *resource_font(uint8_t id);
+
+/*!
+ * @brief  Get an image source for lv_img_set_src()
+ * @param  id: RES_IMG_xxx
+ * @retval "R:<name>" path in the resource pack, built-in descriptor or NULL
+ */
+const void *resource_image(uint8_t id);
 
 
 /******************************************************************************/
@@ -59,6 +59,15 @@ enum {
     BIG_NUMBER_COUNT,
 };
 
+#define LABEL_TEXT_MAX      32
+
+/* Inputs of the text pass, the pass is skipped while they do not change */
+typedef struct {
+    system_status_t status;
+    uint8_t depth_units;
+    bool valid;
+} big_number_snapshot_t;
+
 /******************************************************************************/
 /*                              PRIVATE DATA                                  */
 /******************************************************************************/
@@ -78,6 +87,11 @@ static uint8_t sensor_warn_mask = 0;
 static uint8_t valid_sensor_count = 0;
 static uint32_t sum_valid_sensor = 0;
 
+static int8_t idle_layout = -1;
+static uint32_t label_changed_mask = 0;
+static big_number_snapshot_t last_snapshot;
+static ui_big_number_stats_t big_number_stats;
+
 /******************************************************************************/
 /*                              EXPORTED DATA                                 */
 /******************************************************************************/
@@ -92,6 +106,41 @@ static uint32_t sum_valid_sensor = 0;
 
 /******************************************************************************/
 
+/**
+ * @brief  Set label text, skip (and count) it when the text is unchanged
+ */
+static void ui_big_number_set_text(uint8_t id, const char *text) {
+    if (strcmp(lv_label_get_text(dashboard_labels[id]), text) == 0) {
+        big_number_stats.skipped_sets++;
+        return;
+    }
+
+    lv_label_set_text(dashboard_labels[id], text);
+    label_changed_mask |= 1UL << id;
+    big_number_stats.label_sets++;
+}
+
+/**
+ * @brief  Set value text centered under its label, re-centered only when the value or the label changed
+ */
+static void ui_big_number_set_value(uint8_t id, char *text, lv_obj_t *parent, bool parent_changed) {
+    if (!parent_changed && (strcmp(lv_label_get_text(dashboard_labels[id]), text) == 0)) {
+        big_number_stats.skipped_sets++;
+        return;
+    }
+
+    ui_utils_set_text_center(dashboard_labels[id], text, parent);
+    label_changed_mask |= 1UL << id;
+    big_number_stats.label_sets++;
+}
+
+/**
+ * @brief  Value text centered under one of the dashboard labels
+ */
+static void ui_big_number_set_label_value(uint8_t id, char *text, uint8_t label_id) {
+    ui_big_number_set_value(id, text, dashboard_labels[label_id], (label_changed_mask & (1UL << label_id)) != 0);
+}
+
 /**
  * @brief  Initialize static components
  */
@@ -261,6 +310,12 @@ static int ui_check_sensor_state(uint32_t s1, uint16_t setpoint)
 static void ui_big_number_set_idle(bool idle) {
     is_idle = idle;
 
+    /* Hidden/visible toggles invalidate even when nothing changes */
+    if (idle_layout == is_idle) {
+        return;
+    }
+    idle_layout = is_idle;
+
     if (is_idle) {
         lv_obj_set_y(dashboard_labels[BIG_NUMBER_DEPTH_LABEL], LINE2_LABEL_Y_IDLE);
         lv_obj_set_y(dashboard_labels[BIG_NUMBER_SETPOINT_LABEL], LINE2_LABEL_Y_IDLE);
@@ -346,125 +401,77 @@ static void ui_big_number_blink(void) {
     }
 }
 
-/******************************************************************************/
-
-/*!
- * @brief  Initialize the big number mode screen
- */
-void ui_big_number_init(void) {
-    screen_dashboard = lv_obj_create(NULL, NULL);
-    lv_obj_add_style(screen_dashboard, LV_STATE_DEFAULT, &style_dashboard);
-
-    ui_dashboard_static_init();
-    ui_dashboard_param_init();
-}
-
-/*!
- * @brief  Set the big number mode screen
- */
-void ui_big_number_loadscreen(void) {
-    lv_scr_load(screen_dashboard);
-    ui_big_number_set_idle(true);
-}
-
-/**
- * @brief  Set menu text
- */
-void ui_big_number_set_menu_text(char *text) {
-    int16_t width, x;
-    lv_label_set_text(dashboard_labels[BIG_NUMBER_MENU], text);
-
-    if (strlen(text) > 2) {
-        width = lv_obj_get_width(dashboard_labels[BIG_NUMBER_MENU]);
-        x = (316 - width) / 2;
-        
-        lv_obj_align(dashboard_labels[BIG_NUMBER_MENU], NULL, LV_ALIGN_IN_TOP_LEFT, x, lv_obj_get_y(dashboard_labels[BIG_NUMBER_MENU]));
-        lv_obj_set_state(dashboard_labels[BIG_NUMBER_MENU], LV_STATE_DEFAULT);
-        is_idle = false;
-    }
-    else {
-        is_idle = true;
-    }
-    ui_big_number_set_idle(is_idle);
-}
-
 /**
- * @brief  Update big number screen
+ * @brief  Format all values, only labels whose text changed are set
  */
-void ui_big_number_update(void) {
+static void ui_big_number_update_text(void) {
     int i;
-    static char char_value[32];
+    static char char_value[LABEL_TEXT_MAX];
+    static char char_label[LABEL_TEXT_MAX];
     static uint16_t last_depth_deco = 0;
 
+    label_changed_mask = 0;
+    uint32_t sets = big_number_stats.label_sets;
+    uint32_t skips = big_number_stats.skipped_sets;
+
     /* Sensors 1, 2, 3 */
     for (i = 0; i < O2_SENSOR_NUM; i++) {
         ui_utils_convert_sensor(char_value, system_status.sensor[i].data);
-        ui_utils_set_text_center(dashboard_labels[i], char_value, panel_sensor[i]);
+        ui_big_number_set_value(i, char_value, panel_sensor[i], false);
     }
 
     /* Current Depth from pressure */
-    if ((system_status.dive_state != DIVE_CONTROL_STATE) || (system_status.current_distance < DIVETHRESH_DECIMETERS)) {
-        /* Check DIVETHRESH_DECIMETERS to avoid displaying small depth */
-        system_status.current_distance = 0;
-    }
-
     if (system_config.user_setting.flags.depth_units == 1) {
         sprintf(char_value, "%d.%d", system_status.current_distance / 10, system_status.current_distance % 10);
-        lv_label_set_text(dashboard_labels[BIG_NUMBER_DEPTH_LABEL], "DEPTH (m)");
+        ui_big_number_set_text(BIG_NUMBER_DEPTH_LABEL, "DEPTH (m)");
     }
     else {
         sprintf(char_value, "%d", system_status.current_distance);
-        lv_label_set_text(dashboard_labels[BIG_NUMBER_DEPTH_LABEL], "DEPTH (ft)");
+        ui_big_number_set_text(BIG_NUMBER_DEPTH_LABEL, "DEPTH (ft)");
     }
-    ui_utils_set_text_center(dashboard_labels[BIG_NUMBER_DEPTH], char_value, dashboard_labels[BIG_NUMBER_DEPTH_LABEL]);
+    ui_big_number_set_label_value(BIG_NUMBER_DEPTH, char_value, BIG_NUMBER_DEPTH_LABEL);
 
     /* Display in minutes or in seconds */
     int time_s = (system_status.dive_state == DIVE_CONTROL_STATE) ? system_status.dive_time_sec : system_status.surface_time_sec;
     uint8_t unit = ui_utils_convert_dive_time_with_unit(char_value, time_s);
-    if (unit == 2) {
-        lv_label_set_text_fmt(dashboard_labels[BIG_NUMBER_D_TIME_LABEL], "%cTIME (h)", system_status.dive_state == DIVE_CONTROL_STATE ? 'D' : 'S');
-    }
-    else if (unit == 1) {
-        lv_label_set_text_fmt(dashboard_labels[BIG_NUMBER_D_TIME_LABEL], "%cTIME (m)", system_status.dive_state == DIVE_CONTROL_STATE ? 'D' : 'S');
-    }
-    else {
-        lv_label_set_text_fmt(dashboard_labels[BIG_NUMBER_D_TIME_LABEL], "%cTIME (s)", system_status.dive_state == DIVE_CONTROL_STATE ? 'D' : 'S');
-    }
-    ui_utils_set_text_center(dashboard_labels[BIG_NUMBER_D_TIME], char_value, dashboard_labels[BIG_NUMBER_D_TIME_LABEL]);
+    sprintf(char_label, "%cTIME (%c)", system_status.dive_state == DIVE_CONTROL_STATE ? 'D' : 'S', (unit == 2) ? 'h' : ((unit == 1) ? 'm' : 's'));
+    ui_big_number_set_text(BIG_NUMBER_D_TIME_LABEL, char_label);
+    ui_big_number_set_label_value(BIG_NUMBER_D_TIME, char_value, BIG_NUMBER_D_TIME_LABEL);
 
     if (system_status.dive_state == SURFACE_CONTROL_STATE) {
         uint8_t unit = ui_utils_convert_dive_time_with_unit(char_value, system_status.last_dive_info.total_time_last_dive);
-        lv_label_set_text_fmt(dashboard_labels[BIG_NUMBER_STIME_LABEL], "TIME (%c)", unit ? 'm' : 's');
-        ui_utils_set_text_center(dashboard_labels[BIG_NUMBER_STIME], char_value, dashboard_labels[BIG_NUMBER_STIME_LABEL]);
+        sprintf(char_label, "TIME (%c)", unit ? 'm' : 's');
+        ui_big_number_set_text(BIG_NUMBER_STIME_LABEL, char_label);
+        ui_big_number_set_label_value(BIG_NUMBER_STIME, char_value, BIG_NUMBER_STIME_LABEL);
     }
     else {
         if (system_status.deco_mode) {
             sprintf(char_value, "%d@%d", system_status.deco_time, system_status.deco_depth);
-            lv_label_set_text(dashboard_labels[BIG_NUMBER_STIME_LABEL], "DECO");
-            ui_utils_set_text_center(dashboard_labels[BIG_NUMBER_STIME], char_value, dashboard_labels[BIG_NUMBER_STIME_LABEL]);
+            ui_big_number_set_text(BIG_NUMBER_STIME_LABEL, "DECO");
+            ui_big_number_set_label_value(BIG_NUMBER_STIME, char_value, BIG_NUMBER_STIME_LABEL);
         }
         else {
-            lv_label_set_text(dashboard_labels[BIG_NUMBER_STIME_LABEL], "NSTOP");
-            ui_utils_set_text_center(dashboard_labels[BIG_NUMBER_STIME], "NS", dashboard_labels[BIG_NUMBER_STIME_LABEL]);
+            ui_big_number_set_text(BIG_NUMBER_STIME_LABEL, "NSTOP");
+            ui_big_number_set_label_value(BIG_NUMBER_STIME, "NS", BIG_NUMBER_STIME_LABEL);
         }
     }
 
     /* Current Set Point selected */
     ui_utils_convert_setpoint(char_value, system_status.set_point.data, system_status.cc_mode);
-    ui_utils_set_text_center(dashboard_labels[BIG_NUMBER_SETPOINT], char_value, dashboard_labels[BIG_NUMBER_SETPOINT_LABEL]);
+    ui_big_number_set_label_value(BIG_NUMBER_SETPOINT, char_value, BIG_NUMBER_SETPOINT_LABEL);
 
     /* Total Time to Surface from calculation in deco program */
     if (system_status.time_to_surface.blink) {
-        ui_utils_set_text_center(dashboard_labels[BIG_NUMBER_TTS], "!!!", dashboard_labels[BIG_NUMBER_TTS_LABEL]);
+        ui_big_number_set_label_value(BIG_NUMBER_TTS, "!!!", BIG_NUMBER_TTS_LABEL);
     }
     else {
         sprintf(char_value, "%d", system_status.time_to_surface.data);
-        ui_utils_set_text_center(dashboard_labels[BIG_NUMBER_TTS], char_value, dashboard_labels[BIG_NUMBER_TTS_LABEL]);
+        ui_big_number_set_label_value(BIG_NUMBER_TTS, char_value, BIG_NUMBER_TTS_LABEL);
     }
 
     /* Oxygen/Helium fraction of Gas Mix selected */
     sprintf(char_value, "%d/%d", system_status.gas_mix.O2, system_status.gas_mix.he);
-    ui_utils_set_text_center(dashboard_labels[BIG_NUMBER_02_HE], char_value, dashboard_labels[BIG_NUMBER_02_HE_LABEL]);
+    ui_big_number_set_label_value(BIG_NUMBER_02_HE, char_value, BIG_NUMBER_02_HE_LABEL);
 
     /* Deco depth */
     if (system_status.deco_mode) {
@@ -476,19 +483,99 @@ void ui_big_number_update(void) {
         }
 
         sprintf(char_value, "%d", system_status.deco_depth);
-        ui_utils_set_text_center(dashboard_labels[BIG_NUMBER_STOP], char_value, dashboard_labels[BIG_NUMBER_STOP_LABEL]);
-
-        lv_obj_set_width(panel_stop, lv_obj_get_width(dashboard_labels[BIG_NUMBER_STOP]) + 12);
-        lv_obj_set_height(panel_stop, lv_obj_get_height(dashboard_labels[BIG_NUMBER_STOP]));
-        lv_obj_align(panel_stop, NULL, LV_ALIGN_IN_TOP_LEFT, lv_obj_get_x(dashboard_labels[BIG_NUMBER_STOP]) - 6, lv_obj_get_y(dashboard_labels[BIG_NUMBER_STOP]) - 2);
+        ui_big_number_set_label_value(BIG_NUMBER_STOP, char_value, BIG_NUMBER_STOP_LABEL);
 
         sprintf(char_value, "%d", system_status.deco_time);
-        ui_utils_set_text_center(dashboard_labels[BIG_NUMBER_NDL], char_value, dashboard_labels[BIG_NUMBER_NDL_LABEL]);
+        ui_big_number_set_label_value(BIG_NUMBER_NDL, char_value, BIG_NUMBER_NDL_LABEL);
     }
     else {
         stop_time_blink = 0;
-        ui_utils_set_text_center(dashboard_labels[BIG_NUMBER_NDL], "0", dashboard_labels[BIG_NUMBER_NDL_LABEL]);
-        ui_utils_set_text_center(dashboard_labels[BIG_NUMBER_STOP], "ND", dashboard_labels[BIG_NUMBER_STOP_LABEL]);
+        ui_big_number_set_label_value(BIG_NUMBER_NDL, "0", BIG_NUMBER_NDL_LABEL);
+        ui_big_number_set_label_value(BIG_NUMBER_STOP, "ND", BIG_NUMBER_STOP_LABEL);
+    }
+
+    big_number_stats.last_label_sets = big_number_stats.label_sets - sets;
+    big_number_stats.last_skipped_sets = big_number_stats.skipped_sets - skips;
+}
+
+/******************************************************************************/
+
+/*!
+ * @brief  Initialize the big number mode screen
+ */
+void ui_big_number_init(void) {
+    screen_dashboard = lv_obj_create(NULL, NULL);
+    lv_obj_add_style(screen_dashboard, LV_STATE_DEFAULT, &style_dashboard);
+
+    ui_dashboard_static_init();
+    ui_dashboard_param_init();
+}
+
+/*!
+ * @brief  Set the big number mode screen
+ */
+void ui_big_number_loadscreen(void) {
+    lv_scr_load(screen_dashboard);
+    ui_big_number_set_idle(true);
+}
+
+/**
+ * @brief  Set menu text
+ */
+void ui_big_number_set_menu_text(char *text) {
+    int16_t width, x;
+    bool changed = strcmp(lv_label_get_text(dashboard_labels[BIG_NUMBER_MENU]), text) != 0;
+
+    if (changed) {
+        lv_label_set_text(dashboard_labels[BIG_NUMBER_MENU], text);
+        big_number_stats.label_sets++;
+    }
+    else {
+        big_number_stats.skipped_sets++;
+    }
+
+    if (strlen(text) > 2) {
+        if (changed) {
+            width = lv_obj_get_width(dashboard_labels[BIG_NUMBER_MENU]);
+            x = (316 - width) / 2;
+            lv_obj_align(dashboard_labels[BIG_NUMBER_MENU], NULL, LV_ALIGN_IN_TOP_LEFT, x, lv_obj_get_y(dashboard_labels[BIG_NUMBER_MENU]));
+        }
+        lv_obj_set_state(dashboard_labels[BIG_NUMBER_MENU], LV_STATE_DEFAULT);
+        is_idle = false;
+    }
+    else {
+        is_idle = true;
+    }
+    ui_big_number_set_idle(is_idle);
+}
+
+/**
+ * @brief  Update big number screen
+ */
+void ui_big_number_update(void) {
+    int i;
+
+    /* Current Depth from pressure */
+    if ((system_status.dive_state != DIVE_CONTROL_STATE) || (system_status.current_distance < DIVETHRESH_DECIMETERS)) {
+        /* Check DIVETHRESH_DECIMETERS to avoid displaying small depth */
+        system_status.current_distance = 0;
+    }
+
+    big_number_stats.updates++;
+    if (last_snapshot.valid
+        && (last_snapshot.depth_units == system_config.user_setting.flags.depth_units)
+        && (memcmp(&last_snapshot.status, &system_status, sizeof(system_status_t)) == 0)) {
+        big_number_stats.skipped_updates++;
+    }
+    else {
+        ui_big_number_update_text();
+    }
+
+    /* Follows the STOP label across layout changes, no-op (no invalidation) when already in place */
+    if (system_status.deco_mode) {
+        lv_obj_set_width(panel_stop, lv_obj_get_width(dashboard_labels[BIG_NUMBER_STOP]) + 12);
+        lv_obj_set_height(panel_stop, lv_obj_get_height(dashboard_labels[BIG_NUMBER_STOP]));
+        lv_obj_align(panel_stop, NULL, LV_ALIGN_IN_TOP_LEFT, lv_obj_get_x(dashboard_labels[BIG_NUMBER_STOP]) - 6, lv_obj_get_y(dashboard_labels[BIG_NUMBER_STOP]) - 2);
     }
 
     /* Check menu state */
@@ -510,6 +597,10 @@ void ui_big_number_update(void) {
         sensor_warn_mask |= 1 << state;
     }
 
+    /* Taken after the blink flags above, they would differ from the next status otherwise */
+    last_snapshot.status = system_status;
+    last_snapshot.depth_units = system_config.user_setting.flags.depth_units;
+    last_snapshot.valid = true;
 
     /* Update menu label if in the menu state */
     if (is_idle) {
@@ -546,3 +637,10 @@ void ui_big_number_update(void) {
     /* Update blink components */
     ui_big_number_blink();
 }
+
+/*!
+ * @brief  Get the label update statistics
+ */
+const ui_big_number_stats_t *ui_big_number_get_stats(void) {
+    return &big_number_stats;
+}
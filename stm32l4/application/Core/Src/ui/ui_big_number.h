@@ -17,12 +17,21 @@ extern "C" {
 /*                              INCLUDE FILES                                 */
 /******************************************************************************/
 
+#include <stdint.h>
 
 
 /******************************************************************************/
 /*                     EXPORTED TYPES and DEFINITIONS                         */
 /******************************************************************************/
 
+typedef struct {
+    uint32_t updates;               /* ui_big_number_update() calls */
+    uint32_t skipped_updates;       /* Updates where the status did not change, no label touched */
+    uint32_t label_sets;            /* Label texts set (each invalidates the label) */
+    uint32_t skipped_sets;          /* Label texts skipped because they were unchanged */
+    uint32_t last_label_sets;       /* Label sets of the last update that ran the text pass */
+    uint32_t last_skipped_sets;     /* Skipped sets of the last update that ran the text pass */
+} ui_big_number_stats_t;
 
 
 /******************************************************************************/
@@ -69,6 +78,13 @@ void ui_big_number_set_menu_text(char *text);
  */
 void ui_big_number_update(void);
 
+/*!
+ * @brief  Get the label update statistics
+ * @param  None
+ * @retval Pointer to the statistics
+ */
+const ui_big_number_stats_t *ui_big_number_get_stats(void);
+
 /******************************************************************************/
 
 #ifdef __cplusplus
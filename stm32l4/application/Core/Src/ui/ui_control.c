@@ -13,12 +13,17 @@
 #include "app_config.h"
 #include "log.h"
 #include "lv_port_disp.h"
+#include "lv_port_img.h"
+#include "lv_port_fs.h"
+#include "resource.h"
 #include "power_manager.h"
 #include "user_intf.h"
+#include "ota.h"
 
 #include "ui_utils.h"
 #include "ui_splash.h"
 #include "ui_big_number.h"
+#include "ui_event.h"
 
 #include "ui_control.h"
 
@@ -39,17 +44,14 @@ static const osThreadAttr_t lvgl_task_attributes = {
     .stack_size = 8192
 };
 
-static osThreadId_t ui_control_task_handle;
-static const osThreadAttr_t ui_control_task_attributes = {
-    .name = "ui_control_task",
-    .priority = (osPriority_t) osPriorityAboveNormal,
-    .stack_size = 4096
-};
-
-static osMutexId_t lvgl_mutex;
-
 static int ui_current_screen = SCREEN_INIT_ID;
 static uint8_t current_mode = SCREEN_MODE_COUNT;
+static uint32_t next_update_ms;
+
+static ui_control_stats_t lvgl_stats;
+static uint32_t stats_period_start;
+static uint32_t stats_wakeups;
+static uint32_t stats_sleep_ms;
 
 static const screen_mode_t screen_modes[SCREEN_MODE_COUNT] = {
     /* BIG_NUMBER_MODE */ {ui_big_number_init, ui_big_number_loadscreen, ui_big_number_update},
@@ -73,6 +75,134 @@ static const screen_mode_t screen_modes[SCREEN_MODE_COUNT] = {
 
 /******************************************************************************/
 
+/*!
+ * @brief  Load and update the screens, runs in the LVGL task
+ * @retval Time until the next update in ms
+ */
+static uint32_t ui_control_update(void) {
+    uint32_t now = current_ms();
+    uint32_t delay_time_ms;
+
+    if ((int32_t) (now - next_update_ms) < 0) {
+        return next_update_ms - now;
+    }
+
+    switch (ui_current_screen) {
+        case SCREEN_SPLASH_ID:
+            LOG_INFO("Loading splash screen...");
+            ui_splash_loadscreen();
+            ui_current_screen = SCREEN_HOME_ID;
+            delay_time_ms = 2000;    /* Wait for splash bar */
+            break;
+
+        case SCREEN_HOME_ID:
+            /* When we change screen mode, we need to load it */
+            if ((current_mode != system_config.screen_mode) && (system_config.screen_mode < SCREEN_MODE_COUNT)) {
+                current_mode = system_config.screen_mode;
+                LOG_INFO("Loading home screen mode %d...", current_mode);
+                if (screen_modes[current_mode].load) {
+                    screen_modes[current_mode].load();
+                }
+
+                /* The image came up to its home screen, keep it after an OTA */
+                ota_confirm();
+            }
+
+            /* Update screens */
+            if ((current_mode < SCREEN_MODE_COUNT) && screen_modes[current_mode].update) {
+                screen_modes[current_mode].update();
+            }
+            delay_time_ms = 500;
+            break;
+
+        default:
+            delay_time_ms = 100;
+            break;
+    }
+
+    next_update_ms = now + delay_time_ms;
+    return delay_time_ms;
+}
+
+/*!
+ * @brief  Refresh fast while something animates, slower for static screens
+ */
+static void ui_control_adapt_refresh(void) {
+    static uint32_t refr_period = LVGL_REFR_ANIM_PERIOD;
+    uint32_t period = (lv_anim_count_running() > 0) ? LVGL_REFR_ANIM_PERIOD : LVGL_REFR_IDLE_PERIOD;
+
+    if (period != refr_period) {
+        refr_period = period;
+        lv_task_set_period(_lv_disp_get_refr_task(NULL), period);
+    }
+}
+
+/*!
+ * @brief  Sleep until the deadline or a posted event, update the wakeup statistics
+ */
+static void ui_control_sleep(uint32_t sleep_ms) {
+    uint32_t start = current_ms();
+
+    if (sleep_ms > 0) {
+        uint32_t flags = osThreadFlagsWait(UI_EVENT_THREAD_FLAG, osFlagsWaitAny, sleep_ms);
+        if ((flags & osFlagsError) == 0) {
+            lvgl_stats.event_wakeups++;
+        }
+        else {
+            lvgl_stats.timer_wakeups++;
+        }
+    }
+
+    uint32_t now = current_ms();
+    stats_sleep_ms += now - start;
+    stats_wakeups++;
+
+    uint32_t elapsed = now - stats_period_start;
+    if (elapsed >= 1000) {
+        lvgl_stats.wakeups_per_sec = (stats_wakeups * 1000) / elapsed;
+        lvgl_stats.idle_percent = (stats_sleep_ms * 100) / elapsed;
+        stats_period_start = now;
+        stats_wakeups = 0;
+        stats_sleep_ms = 0;
+    }
+}
+
+/*!
+ * @brief  Handle the events posted by other tasks, runs in the LVGL task
+ */
+static void ui_control_process_events(void) {
+    ui_event_t event;
+
+    while (ui_event_get(&event)) {
+        switch (event.type) {
+            case UI_EVENT_BUTTON:
+                if (event.param == BUTTON_MAIN) {
+                    ui_big_number_set_menu_text("SETPOINT 123");
+                }
+                else if (event.param == BUTTON_TAP) {
+                    ui_big_number_set_menu_text("LCD 50%");
+                }
+                break;
+
+            case UI_EVENT_SENSOR:
+                if (event.param < O2_SENSOR_NUM) {
+                    system_status.sensor[event.param].data = event.value;
+                }
+                /* fall through */
+            case UI_EVENT_ALARM:
+            case UI_EVENT_REFRESH:
+                /* Update the home screen on the next pass instead of waiting for the period */
+                if (ui_current_screen == SCREEN_HOME_ID) {
+                    next_update_ms = current_ms();
+                }
+                break;
+
+            default:
+                break;
+        }
+    }
+}
+
 /*!
  * @brief  Task for LVGL handle
  */
@@ -82,12 +212,15 @@ static void lvgl_task(void *argument) {
     /* Initialize LVGL */
     lv_init();
     lv_port_disp_init();
+    lv_port_img_init();
+    lv_port_fs_init();
+    resource_init();
 
     if (system_config.screen_rotate == 1) {
-        lv_disp_set_rotation(NULL, LV_DISP_ROT_90);
+        lv_port_disp_set_rotation(LV_DISP_ROT_90);
     }
     else {
-        lv_disp_set_rotation(NULL, LV_DISP_ROT_270);
+        lv_port_disp_set_rotation(LV_DISP_ROT_270);
     }
 
     /* Initialize screens */
@@ -100,56 +233,20 @@ static void lvgl_task(void *argument) {
     }
 
     ui_current_screen = SCREEN_SPLASH_ID;
+    next_update_ms = current_ms();
+    stats_period_start = current_ms();
+    ui_event_set_consumer(osThreadGetId());
     while (1) {
-        osMutexAcquire(lvgl_mutex, osWaitForever);
-        lv_task_handler();    /* Let the GUI do its work */
-        osMutexRelease(lvgl_mutex);
-        delay(LVGL_TICK_HANDLER);
-    }
-}
-
-/*!
- * @brief  Task for ui control
- */
-static void ui_control_task(void *argument) {
-    int delay_time_ms = 100;
-    (void) argument;
-    LOG_INFO("UI control task started");
-
-    while (1) {
-        osMutexAcquire(lvgl_mutex, osWaitForever);
-        switch (ui_current_screen) {
-            case SCREEN_SPLASH_ID:
-                LOG_INFO("Loading splash screen...");
-                ui_splash_loadscreen();
-                ui_current_screen = SCREEN_HOME_ID;
-                delay_time_ms = 2000;    /* Wait for splash bar */
-                break;
+        ui_control_process_events();
+        uint32_t sleep_ms = ui_control_update();
 
-            case SCREEN_HOME_ID:
-                /* When we change screen mode, we need to load it */
-                if ((current_mode != system_config.screen_mode) && (system_config.screen_mode < SCREEN_MODE_COUNT)) {
-                    current_mode = system_config.screen_mode;
-                    LOG_INFO("Loading home screen mode %d...", current_mode);
-                    if (screen_modes[current_mode].load) {
-                        screen_modes[current_mode].load();
-                    }
-                }
+        ui_control_adapt_refresh();
+        uint32_t lvgl_ms = lv_task_handler();    /* Let the GUI do its work */
 
-                /* Update screens */
-                if (screen_modes[current_mode].update) {
-                    screen_modes[current_mode].update();
-                }
-                delay_time_ms = 500;
-                break;
-
-            default:
-                delay_time_ms = 100;
-                break;
-        }
-        osMutexRelease(lvgl_mutex);
-        
-        delay(delay_time_ms);
+        /* LV_NO_TASK_READY when no LVGL task is active */
+        sleep_ms = LV_MATH_MIN(sleep_ms, lvgl_ms);
+        sleep_ms = LV_MATH_MIN(sleep_ms, LVGL_MAX_SLEEP);
+        ui_control_sleep(sleep_ms);
     }
 }
 
@@ -157,24 +254,29 @@ static void ui_control_task(void *argument) {
  * @brief  Handle button main pressed event
  */
 void ui_control_button_main_pressed(void) {
-    ui_big_number_set_menu_text("SETPOINT 123");
+    ui_event_post(UI_EVENT_BUTTON, BUTTON_MAIN, 0);
 }
 
 /*!
  * @brief  Handle button tap pressed event
  */
 void ui_control_button_tap_pressed(void) {
-    ui_big_number_set_menu_text("LCD 50%");
+    ui_event_post(UI_EVENT_BUTTON, BUTTON_TAP, 0);
+}
+
+/*!
+ * @brief  Get the LVGL task statistics
+ */
+const ui_control_stats_t *ui_control_get_stats(void) {
+    return &lvgl_stats;
 }
 
 /*!
  * @brief  Initialize UI control
  */
 void ui_control_init(void) {
-    /* Create task for lvgl handle */
-    ui_control_task_handle = osThreadNew(ui_control_task, NULL, &ui_control_task_attributes);
+    /* Create task for lvgl handle, other tasks talk to it with ui_event_post() */
     lvgl_task_handle = osThreadNew(lvgl_task, NULL, &lvgl_task_attributes);
-    lvgl_mutex = osMutexNew(NULL);
 
     user_intf_register_button_callback(BUTTON_MAIN, ui_control_button_main_pressed);
     user_intf_register_button_callback(BUTTON_TAP, ui_control_button_tap_pressed);
@@ -23,7 +23,10 @@ extern "C" {
 /*                     EXPORTED TYPES and DEFINITIONS                         */
 /******************************************************************************/
 
-#define LVGL_TICK_HANDLER    (10)   /* in ms */
+/* The LVGL task sleeps until the next LVGL task or screen update is due, or an event is posted */
+#define LVGL_REFR_ANIM_PERIOD  (LV_DISP_DEF_REFR_PERIOD)   /* Refresh period while animations run, in ms */
+#define LVGL_REFR_IDLE_PERIOD  (80)                        /* Refresh period for static screens, in ms */
+#define LVGL_MAX_SLEEP         (1000)                      /* Longest sleep, in ms */
 
 enum {
     SCREEN_INIT_ID = 0,
@@ -37,6 +40,13 @@ typedef void (*screen_init_func_t)(void);
 typedef void (*screen_load_func_t)(void);
 typedef void (*screen_update_func_t)(void);
 
+typedef struct {
+    uint16_t wakeups_per_sec;       /* LVGL task wakeups during the last second */
+    uint8_t idle_percent;           /* Time the LVGL task slept during the last second */
+    uint32_t event_wakeups;         /* Wakeups caused by ui_event_post() */
+    uint32_t timer_wakeups;         /* Wakeups on a deadline */
+} ui_control_stats_t;
+
 typedef struct {
     screen_init_func_t init;
     screen_load_func_t load;
@@ -60,19 +70,26 @@ typedef struct {
 /******************************************************************************/
 
 /*!
- * @brief  Handle button main pressed event
+ * @brief  Handle button main pressed event, queued to the LVGL task (any task or interrupt)
  * @param  None
  * @retval None
  */
 void ui_control_button_main_pressed(void);
 
 /*!
- * @brief  Handle button tap pressed event
+ * @brief  Handle button tap pressed event, queued to the LVGL task (any task or interrupt)
  * @param  None
  * @retval None
  */
 void ui_control_button_tap_pressed(void);
 
+/*!
+ * @brief  Get the LVGL task statistics
+ * @param  None
+ * @retval Pointer to the statistics
+ */
+const ui_control_stats_t *ui_control_get_stats(void);
+
 /*!
  * @brief  Initialize UI control
  * @param  None
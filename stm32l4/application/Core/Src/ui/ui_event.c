@@ -0,0 +1,135 @@
+/*
+ *  ui_event.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+
+#include <stdatomic.h>
+#include "ui_event.h"
+
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+
+#define UI_EVENT_QUEUE_MASK    (UI_EVENT_QUEUE_SIZE - 1)
+
+_Static_assert((UI_EVENT_QUEUE_SIZE & UI_EVENT_QUEUE_MASK) == 0, "UI_EVENT_QUEUE_SIZE must be a power of 2");
+
+typedef struct {
+    atomic_uint ready;          /* Set by the producer once the event is written */
+    ui_event_t event;
+} ui_event_cell_t;
+
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+
+static ui_event_cell_t event_cells[UI_EVENT_QUEUE_SIZE];
+
+/*
+ * Producers reserve room in queue_count first, then claim a cell with
+ * queue_head. Both are single fetch_add, so posting is wait-free. With the
+ * reservation, the claimed cell is always one the consumer already released.
+ */
+static atomic_uint queue_count;
+static atomic_uint queue_head;
+static uint32_t queue_tail;     /* Consumer only */
+static osThreadId_t consumer_thread;
+
+static atomic_uint stats_posted;
+static atomic_uint stats_dropped;
+static uint32_t stats_received;
+static uint32_t stats_max_depth;
+
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+/*                                FUNCTIONS                                   */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+
+/*!
+ * @brief  Post an event to the LVGL task, safe from any task or interrupt
+ */
+bool ui_event_post(uint8_t type, uint8_t param, int32_t value) {
+    if (atomic_fetch_add_explicit(&queue_count, 1, memory_order_acq_rel) >= UI_EVENT_QUEUE_SIZE) {
+        atomic_fetch_sub_explicit(&queue_count, 1, memory_order_acq_rel);
+        atomic_fetch_add_explicit(&stats_dropped, 1, memory_order_relaxed);
+        return false;
+    }
+
+    uint32_t index = atomic_fetch_add_explicit(&queue_head, 1, memory_order_relaxed) & UI_EVENT_QUEUE_MASK;
+    ui_event_cell_t *cell = &event_cells[index];
+
+    cell->event.type = type;
+    cell->event.param = param;
+    cell->event.reserved = 0;
+    cell->event.value = value;
+    atomic_store_explicit(&cell->ready, 1, memory_order_release);
+    atomic_fetch_add_explicit(&stats_posted, 1, memory_order_relaxed);
+
+    if (consumer_thread != NULL) {
+        osThreadFlagsSet(consumer_thread, UI_EVENT_THREAD_FLAG);
+    }
+
+    return true;
+}
+
+/*!
+ * @brief  Set the thread woken up by ui_event_post()
+ */
+void ui_event_set_consumer(osThreadId_t thread) {
+    consumer_thread = thread;
+}
+
+/*!
+ * @brief  Get the oldest event, LVGL task only
+ */
+bool ui_event_get(ui_event_t *event) {
+    ui_event_cell_t *cell = &event_cells[queue_tail & UI_EVENT_QUEUE_MASK];
+
+    /* A producer may have claimed the cell and not written it yet, keep the order and retry later */
+    if (atomic_load_explicit(&cell->ready, memory_order_acquire) == 0) {
+        return false;
+    }
+
+    /* The count also holds producers about to give up on a full queue */
+    uint32_t depth = atomic_load_explicit(&queue_count, memory_order_relaxed);
+    if (depth > UI_EVENT_QUEUE_SIZE) {
+        depth = UI_EVENT_QUEUE_SIZE;
+    }
+    if (depth > stats_max_depth) {
+        stats_max_depth = depth;
+    }
+
+    *event = cell->event;
+    atomic_store_explicit(&cell->ready, 0, memory_order_relaxed);
+    queue_tail++;
+    stats_received++;
+
+    /* Release the cell to the producers */
+    atomic_fetch_sub_explicit(&queue_count, 1, memory_order_release);
+
+    return true;
+}
+
+/*!
+ * @brief  Get the queue statistics
+ */
+void ui_event_get_stats(ui_event_stats_t *stats) {
+    stats->posted = atomic_load_explicit(&stats_posted, memory_order_relaxed);
+    stats->dropped = atomic_load_explicit(&stats_dropped, memory_order_relaxed);
+    stats->received = stats_received;
+    stats->max_depth = stats_max_depth;
+}
@@ -0,0 +1,110 @@
+/*
+ *  ui_event.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef _UI_EVENT_H_
+#define _UI_EVENT_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************************************************************/
+
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "cmsis_os2.h"
+
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+
+/*
+ * Multi producer / single consumer queue of UI events.
+ * Any task or interrupt may post, only the LVGL task reads. Posting never
+ * blocks nor retries: an event is dropped (and counted) when the queue is full.
+ */
+#define UI_EVENT_QUEUE_SIZE    (32)    /* Power of 2 */
+#define UI_EVENT_THREAD_FLAG   (0x0001) /* Set on the consumer thread for each posted event */
+
+enum {
+    UI_EVENT_BUTTON = 0,        /* param: BUTTON_xxx */
+    UI_EVENT_SENSOR,            /* param: sensor index, value: new reading */
+    UI_EVENT_ALARM,             /* param: alarm id, value: 1 raised, 0 cleared */
+    UI_EVENT_REFRESH,           /* Status changed, update the screen now */
+    UI_EVENT_COUNT
+};
+
+typedef struct {
+    uint8_t type;               /* UI_EVENT_xxx */
+    uint8_t param;
+    uint16_t reserved;
+    int32_t value;
+} ui_event_t;
+
+typedef struct {
+    uint32_t posted;            /* Events accepted */
+    uint32_t dropped;           /* Events lost because the queue was full */
+    uint32_t received;          /* Events read by the LVGL task */
+    uint32_t max_depth;         /* Highest number of pending events seen */
+} ui_event_stats_t;
+
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+/*                                FUNCTIONS                                   */
+/******************************************************************************/
+
+/*!
+ * @brief  Post an event to the LVGL task, safe from any task or interrupt
+ * @param  type: UI_EVENT_xxx
+ * @param  param: Event parameter
+ * @param  value: Event value
+ * @retval true if queued, false if the queue is full
+ */
+bool ui_event_post(uint8_t type, uint8_t param, int32_t value);
+
+/*!
+ * @brief  Set the thread woken up by ui_event_post() with UI_EVENT_THREAD_FLAG
+ * @param  thread: Consumer thread, NULL for none
+ * @retval None
+ */
+void ui_event_set_consumer(osThreadId_t thread);
+
+/*!
+ * @brief  Get the oldest event, LVGL task only
+ * @param  event: Output event
+ * @retval true if an event was read
+ */
+bool ui_event_get(ui_event_t *event);
+
+/*!
+ * @brief  Get the queue statistics
+ * @param  stats: Output statistics
+ * @retval None
+ */
+void ui_event_get_stats(ui_event_stats_t *stats);
+
+/******************************************************************************/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _UI_EVENT_H_ */
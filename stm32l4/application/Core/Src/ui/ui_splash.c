@@ -48,7 +48,7 @@ void ui_splash_text(void) {
     static lv_style_t style_splash_context;
     lv_style_init(&style_splash_header);
     lv_style_init(&style_splash_context);
-    lv_style_set_text_font(&style_splash_header, LV_STATE_DEFAULT, &lv_font_abadi_36);
+    lv_style_set_text_font(&style_splash_header, LV_STATE_DEFAULT, resource_font(RES_FONT_ABADI_36));
     lv_style_set_text_color(&style_splash_header, LV_STATE_DEFAULT, LV_COLOR_MAKE(0x00, 0x00, 0xff));
     lv_style_set_text_font(&style_splash_context, LV_STATE_DEFAULT, &lv_font_montserrat_18);
     lv_style_set_text_color(&style_splash_context, LV_STATE_DEFAULT, LV_COLOR_MAKE(0x00, 0x00, 0x80));
@@ -76,24 +76,12 @@ void ui_splash_text(void) {
  * @brief  Initialize splash image
  */
 void ui_splash_image(void) {
-    static lv_img_dsc_t img_logo = {
-        .header.always_zero = 0,
-        .header.w = 120,
-        .header.h = 120,
-        .data_size = 120 * 120 * LV_COLOR_DEPTH / 8,
-        .header.cf = LV_IMG_CF_TRUE_COLOR, /*Set the color format*/
-        .data = img_logo_marine_120x120,
-    };
+    const void *img_logo = resource_image(system_config.manufacturer_id == REB_TEK_ID ? RES_IMG_LOGO_REBTEK : RES_IMG_LOGO_MARINE);
 
     lv_obj_t *img_splash_logo = lv_img_create(screen_splash, NULL);
-    if (system_config.manufacturer_id == REB_TEK_ID) {
-        img_logo.header.w = 310;
-        img_logo.header.h = 62;
-        img_logo.data_size = 310 * 62 * LV_COLOR_DEPTH / 8;
-        img_logo.data = img_logo_rebtek_310_62;
+    if (img_logo != NULL) {
+        lv_img_set_src(img_splash_logo, img_logo);
     }
-
-    lv_img_set_src(img_splash_logo, &img_logo);
     lv_obj_align(img_splash_logo, NULL, LV_ALIGN_CENTER, 0, 8);
 }
 
@@ -67,11 +67,11 @@ void ui_utils_init(void) {
     lv_style_set_border_color(&style_border, LV_STATE_PRESSED, SENSOR_HIGH_COLOR);
 
     lv_style_init(&style_label_font_36);
-    lv_style_set_text_font(&style_label_font_36, LV_STATE_DEFAULT, &lv_font_abadi_36);
+    lv_style_set_text_font(&style_label_font_36, LV_STATE_DEFAULT, resource_font(RES_FONT_ABADI_36));
     lv_style_init(&style_label_font_40);
-    lv_style_set_text_font(&style_label_font_40, LV_STATE_DEFAULT, &lv_font_abadi_40);
+    lv_style_set_text_font(&style_label_font_40, LV_STATE_DEFAULT, resource_font(RES_FONT_ABADI_40));
     lv_style_init(&style_label_font_44);
-    lv_style_set_text_font(&style_label_font_44, LV_STATE_DEFAULT, &lv_font_abadi_44);
+    lv_style_set_text_font(&style_label_font_44, LV_STATE_DEFAULT, resource_font(RES_FONT_ABADI_44));
 
     if (system_config.user_setting.flags.dark_mode) {
         lv_style_set_bg_color(&style_dashboard, LV_STATE_DEFAULT, DARK_BACKGROUND);
@@ -12,6 +12,11 @@
 #include "app_config.h"
 #include "log.h"
 #include "W25Qx.h"
+#include "lzss.h"
+#include "delta.h"
+#include "flash_prog.h"
+#include "slots.h"
+#include "boot_mailbox.h"
 #include "app_main.h"
 
 /******************************************************************************/
@@ -35,12 +40,33 @@
 #define OTA_PART_LENGTH       (1024)
 #define MAGIC_NUMBER          (0xAA555AA5)
 
+#define ETX_APP_FLASH_END     (0x08100000)     /* End of bank 2 */
+#define ETX_APP_MAX_SIZE      (ETX_APP_FLASH_END - ETX_APP_FLASH_ADDR)
+
+#define ETX_RAM_START         (0x20000000)
+#define ETX_RAM_END           (0x20050000)     /* SRAM1, then SRAM2 */
+
+#define DELTA_SCRATCH_ADDRESS (0x110000)       /* W25Q area the delta images are rebuilt in */
+#define W25Q_SECTOR_SIZE      (0x1000)
+
+#define OTA_JOURNAL_ADDRESS   (0xF000)         /* W25Q sector before the OTA file */
+#define OTA_JOURNAL_MAGIC     (0x4C4A5354)     /* "TSJL" */
+#define OTA_JOURNAL_STEP      (0x2000)         /* Progress recorded every 4 pages */
+
+#define SLOT_TABLE_ADDRESS    (0xD000)         /* Two W25Q sectors before the journal */
+#define PREV_SLOT_ADDRESS     (0x210000)       /* Raw copy of the previous image, after the delta scratch */
+#define W25Q_BLOCK_SIZE       (0x10000)
+
 typedef void (*application_func_t)(void);
 
 typedef struct {
     int32_t fw_size;
     uint32_t fw_crc;
     uint32_t reserved1;
+    uint32_t fw_crc32;          /* CRC-32/MPEG-2 of the file, valid if reserved2 is MAGIC_NUMBER */
+    uint32_t reserved2;
+    uint32_t version;           /* Image version given with the OTA, 0xFFFFFFFF if none */
+    uint32_t reserved3;         /* Pads the configuration to double words */
 } __attribute__((packed)) ext_slot_t;
 
 typedef struct {
@@ -48,12 +74,36 @@ typedef struct {
     ext_slot_t slot_table;
 } __attribute__((packed)) ext_general_cfg_t;
 
+/* Install journal: a header naming the OTA file being installed, then
+ * progress entries appended as the copy goes, the last complete one counts */
+typedef struct {
+    uint32_t magic;             /* Cleared once the install ended */
+    int32_t fw_size;
+    uint32_t fw_crc;
+    uint32_t fw_crc32;
+} __attribute__((packed)) ota_journal_header_t;
+
+typedef struct {
+    uint32_t offset;            /* Image bytes programmed */
+    uint32_t check;             /* ~offset, the entry was completely written */
+} __attribute__((packed)) ota_journal_entry_t;
+
 /******************************************************************************/
 /*                              PRIVATE DATA                                  */
 /******************************************************************************/
 
-static uint8_t ota_buf[OTA_PART_LENGTH];
-static uint32_t checksum_file = 0;
+/* Ping-pong buffers: one part is read by DMA while the other is programmed */
+static uint8_t ota_buf[2][OTA_PART_LENGTH] __attribute__((aligned(8)));
+
+/* W25Q address of the next journal entry, 0 without journal */
+static uint32_t journal_next;
+
+/* Check of a compressed file, continued over the bytes the decoder reads */
+static uint32_t lzss_file_sum;
+static uint32_t lzss_file_crc;
+static uint32_t lzss_file_read;
+
+extern CRC_HandleTypeDef hcrc;
 
 /******************************************************************************/
 /*                              EXPORTED DATA                                 */
@@ -119,165 +169,691 @@ static void jump_to_application(void) {
 }
 
 /*!
- * @brief Write the configuration to flash
+ * @brief  Log the work done by the flash programming engine
  */
-static HAL_StatusTypeDef write_cfg_to_flash(ext_general_cfg_t *cfg)
+static void log_flash_stats(const flash_prog_stats_t *stats)
 {
-    HAL_StatusTypeDef ret;
-    HAL_FLASH_Unlock();
+    LOG_INFO("Flash: %lu pages erased, %lu skipped, %lu bank erase, %lu fast rows, %lu double words in %lu ms",
+             stats->pages_erased, stats->pages_skipped, stats->mass_erases,
+             stats->rows_fast, stats->double_words, stats->elapsed_ms);
+}
 
-    do {
-        FLASH_WaitForLastOperation(HAL_MAX_DELAY);
+/*!
+ * @brief  Open the install journal of an OTA file
+ * @retval Bytes a previous install of the same file programmed, 0 to start over
+ */
+static int journal_open(const ext_slot_t *slot)
+{
+    ota_journal_header_t header;
+    uint32_t address = OTA_JOURNAL_ADDRESS + sizeof(header);
+    int offset = 0;
 
-        /* Erase the Flash */
-        FLASH_EraseInitTypeDef EraseInitStruct;
-        uint32_t SectorError;
+    journal_next = 0;
+    if (w25qx_read((uint8_t *) &header, OTA_JOURNAL_ADDRESS, sizeof(header)) != W25Qx_OK) {
+        return 0;
+    }
 
-        EraseInitStruct.TypeErase = FLASH_TYPEERASE_PAGES;
-        EraseInitStruct.Banks = FLASH_BANK_1;
-        EraseInitStruct.Page = ETX_APP_NPAGE - 1;
-        EraseInitStruct.NbPages = 1;
+    if ((header.magic != OTA_JOURNAL_MAGIC) || (header.fw_size != slot->fw_size)
+        || (header.fw_crc != slot->fw_crc) || (header.fw_crc32 != slot->fw_crc32)) {
+        /* Another file, start a new journal */
+        header.magic = OTA_JOURNAL_MAGIC;
+        header.fw_size = slot->fw_size;
+        header.fw_crc = slot->fw_crc;
+        header.fw_crc32 = slot->fw_crc32;
+        if ((w25qx_erase_block(OTA_JOURNAL_ADDRESS) == W25Qx_OK)
+            && (w25qx_write((uint8_t *) &header, OTA_JOURNAL_ADDRESS, sizeof(header)) == W25Qx_OK)) {
+            journal_next = address;
+        }
+        return 0;
+    }
 
-        /* Clear all flags before you write it to flash */
-        __HAL_FLASH_CLEAR_FLAG(FLASH_FLAG_EOP | FLASH_FLAG_OPERR |
-                            FLASH_FLAG_WRPERR | FLASH_FLAG_PGAERR);
+    /* Entries up to the first erased one, an entry torn by a reset is skipped */
+    while (address < OTA_JOURNAL_ADDRESS + W25Q_SECTOR_SIZE) {
+        uint32_t size = OTA_JOURNAL_ADDRESS + W25Q_SECTOR_SIZE - address;
+        ota_journal_entry_t *entry = (ota_journal_entry_t *) ota_buf[0];
 
-        ret = HAL_FLASHEx_Erase(&EraseInitStruct, &SectorError);
-        if (ret != HAL_OK) {
-            LOG_INFO("Config Flash Write Error");
-            break;
+        if (size > OTA_PART_LENGTH) {
+            size = OTA_PART_LENGTH;
+        }
+        if (w25qx_read(ota_buf[0], address, size) != W25Qx_OK) {
+            return 0;
         }
+        for (uint32_t i = 0; i < size / sizeof(*entry); i++, address += sizeof(*entry)) {
+            if ((entry[i].offset == 0xFFFFFFFF) && (entry[i].check == 0xFFFFFFFF)) {
+                journal_next = address;
+                return offset;
+            }
+            if ((entry[i].check == ~entry[i].offset) && (entry[i].offset <= ETX_APP_MAX_SIZE)
+                && (entry[i].offset % OTA_JOURNAL_STEP == 0)) {
+                offset = entry[i].offset;
+            }
+        }
+    }
+
+    /* Full, keep the progress without recording more */
+    return offset;
+}
+
+/*!
+ * @brief  Record that the first offset bytes of the image are programmed
+ */
+static void journal_commit(uint32_t offset)
+{
+    ota_journal_entry_t entry = { .offset = offset, .check = ~offset };
 
-        /* Write the configuration */
-        uint8_t *data = (uint8_t *)cfg;
-        uint8_t mem_offest = 0;
+    if ((journal_next == 0) || (journal_next + sizeof(entry) > OTA_JOURNAL_ADDRESS + W25Q_SECTOR_SIZE)) {
+        return;
+    }
+    if (w25qx_write((uint8_t *) &entry, journal_next, sizeof(entry)) == W25Qx_OK) {
+        journal_next += sizeof(entry);
+    }
+}
 
-        for (int i = 0; i < sizeof(ext_general_cfg_t); i += 8) {
-            uint64_t u64_data;
-            memcpy(&u64_data, &data[i], sizeof(uint64_t));
+/*!
+ * @brief  End the journal, the next install of the same file starts over
+ */
+static void journal_close(void)
+{
+    uint32_t magic = 0;
 
-            ret = HAL_FLASH_Program(FLASH_TYPEPROGRAM_DOUBLEWORD, (ETX_CONFIG_FLASH_ADDR + mem_offest), u64_data);
-            if (ret == HAL_OK) {
-                mem_offest += 8;
-            }
-            else {
-                LOG_INFO("Config Flash Write Error");
+    if (journal_next != 0) {
+        w25qx_write((uint8_t *) &magic, OTA_JOURNAL_ADDRESS, sizeof(magic));
+        journal_next = 0;
+    }
+}
+
+/*!
+ * @brief  Copy an image from the W25Q to the application area
+ * @param  start: Bytes already programmed, a multiple of OTA_JOURNAL_STEP
+ * @param  sum: Additive checksum, continued over the copied bytes, can be NULL
+ * @param  crc: CRC-32/MPEG-2, continued over the copied bytes from the CRC
+ *         unit state when start is not 0, can be NULL
+ * @retval length if the whole image was programmed, less on error
+ *
+ * Reads part n + 1 with DMA while part n is checked and programmed. The
+ * progress goes to the journal every OTA_JOURNAL_STEP bytes.
+ */
+static int copy_to_application(uint32_t address, int start, int length, uint32_t *sum, uint32_t *crc)
+{
+    flash_prog_stats_t stats;
+    int offset = start;
+    int reading = 0;
+
+    if (flash_prog_begin(ETX_APP_FLASH_ADDR + start, length - start, ETX_APP_MAX_SIZE - start) != 0) {
+        return 0;
+    }
+    if (w25qx_read_start(ota_buf[0], address + offset, OTA_PART_LENGTH) == W25Qx_OK) {
+        reading = 1;
+    }
+
+    for (int part = 0; reading && (offset < length); part++) {
+        uint8_t *data = ota_buf[part & 1];
+        int size = (length - offset < OTA_PART_LENGTH) ? (length - offset) : OTA_PART_LENGTH;
+
+        reading = 0;
+        if (w25qx_read_wait() != W25Qx_OK) {
+            LOG_INFO("Read flash failed");
+            break;
+        }
+        /* The pages before offset are programmed, no read is running */
+        if ((offset > start) && (offset % OTA_JOURNAL_STEP == 0)) {
+            journal_commit(offset);
+        }
+        if (offset + OTA_PART_LENGTH < length) {
+            if (w25qx_read_start(ota_buf[(part + 1) & 1], address + offset + OTA_PART_LENGTH, OTA_PART_LENGTH) != W25Qx_OK) {
+                LOG_INFO("Read flash failed");
                 break;
             }
+            reading = 1;
         }
 
-        /* Check if the FLASH_FLAG_BSY */
-        FLASH_WaitForLastOperation(HAL_MAX_DELAY);
-
-        if (ret != HAL_OK) {
+        if (sum != NULL) {
+            *sum = cal_checksum_file(*sum, data, size);
+        }
+        if (crc != NULL) {
+            *crc = (offset == 0) ? HAL_CRC_Calculate(&hcrc, (uint32_t *) data, size)
+                                 : HAL_CRC_Accumulate(&hcrc, (uint32_t *) data, size);
+        }
+        if (flash_prog_write(data, size) != 0) {
+            LOG_INFO("Write flash failed");
             break;
         }
+        offset += size;
+    }
+
+    /* Stopped on an error, let the last read end */
+    if (reading) {
+        w25qx_read_wait();
+    }
+
+    if (flash_prog_end(&stats) != 0) {
+        LOG_INFO("Write flash failed");
+        return 0;
+    }
+    log_flash_stats(&stats);
+    return offset;
+}
+
+/*!
+ * @brief  CRC of an image in the W25Q, same as the CRC unit over the bytes
+ */
+static int crc_w25q(uint32_t address, uint32_t length, uint32_t *crc)
+{
+    for (uint32_t offset = 0; offset < length; offset += OTA_PART_LENGTH) {
+        uint32_t size = (length - offset < OTA_PART_LENGTH) ? (length - offset) : OTA_PART_LENGTH;
+
+        if (w25qx_read(ota_buf[0], address + offset, size) != W25Qx_OK) {
+            return -1;
+        }
+        *crc = (offset == 0) ? HAL_CRC_Calculate(&hcrc, (uint32_t *) ota_buf[0], size)
+                             : HAL_CRC_Accumulate(&hcrc, (uint32_t *) ota_buf[0], size);
+    }
+    return 0;
+}
+
+/*!
+ * @brief  Read delta operations from the W25Q, after the header
+ */
+static int delta_read_w25q(uint32_t offset, uint8_t *data, uint32_t size)
+{
+    return (w25qx_read(data, OTA_FIRMWARE_ADDRESS + sizeof(delta_header_t) + offset, size) == W25Qx_OK) ? 0 : -1;
+}
 
-    } while (0);
+/*!
+ * @brief  Write the rebuilt image to the scratch area, erasing it on the way
+ */
+static int delta_write_scratch(uint32_t offset, const uint8_t *data, uint32_t size)
+{
+    /* Writes are DELTA_BUF_SIZE chunks, every sector starts with one */
+    if (((offset % W25Q_SECTOR_SIZE) == 0) && (w25qx_erase_block(DELTA_SCRATCH_ADDRESS + offset) != W25Qx_OK)) {
+        return -1;
+    }
+    return (w25qx_write((uint8_t *) data, DELTA_SCRATCH_ADDRESS + offset, size) == W25Qx_OK) ? 0 : -1;
+}
 
-    HAL_FLASH_Lock();
-    return ret;
+/*!
+ * @brief  Rebuild a delta image in the W25Q scratch area then install it
+ * @retval 0 if the programmed image matches the header CRC
+ *
+ * The application area is only erased once the scratch area holds the
+ * checked new image. If power fails while programming, the next boot finds
+ * the scratch area valid and resumes the copy where the journal stopped.
+ */
+static int install_delta(const ext_slot_t *slot, const delta_header_t *header, int file_length)
+{
+    delta_io_t io = {
+        .read = delta_read_w25q,
+        .write = delta_write_scratch,
+        .old = (const uint8_t *) ETX_APP_FLASH_ADDR,
+        .patch_size = file_length - sizeof(delta_header_t),
+    };
+    uint32_t tickstart = HAL_GetTick();
+    uint32_t crc = 0;
+    int start;
+
+    if ((crc_w25q(DELTA_SCRATCH_ADDRESS, header->new_size, &crc) == 0) && (crc == header->new_crc)) {
+        LOG_INFO("Delta already applied, resume the copy");
+    }
+    else {
+        crc = HAL_CRC_Calculate(&hcrc, (uint32_t *) ETX_APP_FLASH_ADDR, header->old_size);
+        if (crc != header->old_crc) {
+            LOG_INFO("Delta built for another firmware");
+            return -1;
+        }
+
+        LOG_INFO("Start apply delta %d bytes -> %lu bytes", file_length, header->new_size);
+        if ((delta_apply(&io, header) != 0)
+            || (crc_w25q(DELTA_SCRATCH_ADDRESS, header->new_size, &crc) != 0) || (crc != header->new_crc)) {
+            LOG_INFO("Apply delta failed");
+            return -1;
+        }
+        LOG_INFO("Delta applied in %lu ms", HAL_GetTick() - tickstart);
+    }
+
+    /* The scratch area holds the new image, what the journal recorded is valid */
+    start = journal_open(slot);
+    if (start > (int) header->new_size) {
+        start = 0;
+    }
+    if (start > 0) {
+        LOG_INFO("Resume install at %d of %lu bytes", start, header->new_size);
+    }
+
+    if ((copy_to_application(DELTA_SCRATCH_ADDRESS, start, header->new_size, NULL, NULL) < (int) header->new_size)
+        || (HAL_CRC_Calculate(&hcrc, (uint32_t *) ETX_APP_FLASH_ADDR, header->new_size) != header->new_crc)) {
+        LOG_INFO("Delta image is invalid");
+        return -1;
+    }
+
+    LOG_INFO("Installed %lu bytes in %lu ms", header->new_size, HAL_GetTick() - tickstart);
+    return 0;
+}
+
+/*!
+ * @brief  Read compressed bytes from the W25Q, after the header, and check them
+ *
+ * The decoder reads the stream once, in order: the file sum and CRC go on
+ * over each read, the file is not read a second time to check it.
+ */
+static int lzss_read_w25q(uint32_t offset, uint8_t *data, uint32_t size)
+{
+    if ((offset != lzss_file_read)
+        || (w25qx_read(data, OTA_FIRMWARE_ADDRESS + sizeof(lzss_header_t) + offset, size) != W25Qx_OK)) {
+        return -1;
+    }
+    lzss_file_sum = cal_checksum_file(lzss_file_sum, data, size);
+    lzss_file_crc = HAL_CRC_Accumulate(&hcrc, (uint32_t *) data, size);
+    lzss_file_read += size;
+    return 0;
+}
+
+/*!
+ * @brief  Program decompressed bytes in the application area
+ */
+static int lzss_write_flash(uint32_t offset, const uint8_t *data, uint32_t size)
+{
+    /* Written in order, whole pages are programmed at once for the window */
+    (void) offset;
+    if (flash_prog_write(data, size) != 0) {
+        LOG_INFO("Write flash failed");
+        return -1;
+    }
+    return 0;
+}
+
+/*!
+ * @brief  Decompress a TSLZ image from the W25Q into the application area
+ * @retval 0 if the file matches the slot sum and CRC, and the programmed
+ *         image the header checksum
+ */
+static int install_compressed(const ext_slot_t *slot, const lzss_header_t *header, int file_length)
+{
+    lzss_io_t io = {
+        .read = lzss_read_w25q,
+        .write = lzss_write_flash,
+        .output = (const uint8_t *) ETX_APP_FLASH_ADDR,
+        .stream_size = file_length - sizeof(lzss_header_t),
+    };
+    flash_prog_stats_t stats;
+    uint32_t tickstart = HAL_GetTick();
+    uint8_t *bytes = (uint8_t *) header;
+    int ret;
+
+    /* The file check starts with the header, the decoder reads the rest */
+    lzss_file_sum = cal_checksum_file(0, bytes, sizeof(*header));
+    lzss_file_crc = HAL_CRC_Calculate(&hcrc, (uint32_t *) bytes, sizeof(*header));
+    lzss_file_read = 0;
+
+    LOG_INFO("Start decompress file %d -> %lu bytes", file_length, header->size);
+    if (flash_prog_begin(ETX_APP_FLASH_ADDR, header->size, ETX_APP_MAX_SIZE) != 0) {
+        return -1;
+    }
+    ret = lzss_decode(&io, header);
+    if ((flash_prog_end(&stats) != 0) || (ret != 0)) {
+        LOG_INFO("Decompress failed");
+        return -1;
+    }
+    log_flash_stats(&stats);
+
+    /* Bytes after the end of the stream the decoder needed, normally none */
+    while ((ret == 0) && (lzss_file_read < io.stream_size)) {
+        uint32_t size = io.stream_size - lzss_file_read;
+
+        ret = lzss_read_w25q(lzss_file_read, ota_buf[0], (size < OTA_PART_LENGTH) ? size : OTA_PART_LENGTH);
+    }
+    if ((ret != 0) || (lzss_file_sum != slot->fw_crc)
+        || ((slot->reserved2 == MAGIC_NUMBER) && (lzss_file_crc != slot->fw_crc32))) {
+        LOG_INFO("Firmware is invalid");
+        return -1;
+    }
+
+    /* Check what was really programmed */
+    if (cal_checksum_file(0, (uint8_t *) ETX_APP_FLASH_ADDR, header->size) != header->checksum) {
+        LOG_INFO("Decompressed image is invalid");
+        return -1;
+    }
+
+    LOG_INFO("Installed %lu bytes in %lu ms", header->size, HAL_GetTick() - tickstart);
+    return 0;
+}
+
+/*!
+ * @brief  Check the vector table at the start of a raw image in the W25Q
+ * @retval 0 if the stack pointer is in the RAM and the reset handler in the image
+ */
+static int check_vector_table(int file_length)
+{
+    uint32_t vectors[2];
+
+    if ((file_length < (int) sizeof(vectors))
+        || (w25qx_read((uint8_t *) vectors, OTA_FIRMWARE_ADDRESS, sizeof(vectors)) != W25Qx_OK)) {
+        return -1;
+    }
+    if ((vectors[0] <= ETX_RAM_START) || (vectors[0] > ETX_RAM_END) || ((vectors[0] & 3) != 0)) {
+        return -1;
+    }
+    /* Thumb address */
+    if (((vectors[1] & 1) == 0) || (vectors[1] < ETX_APP_FLASH_ADDR)
+        || (vectors[1] >= ETX_APP_FLASH_ADDR + (uint32_t) file_length)) {
+        return -1;
+    }
+    return 0;
+}
+
+/*!
+ * @brief  Install the image downloaded to the W25Q by the application
+ * @param  image_size: Set to the size of the programmed image
+ * @retval 0 if the application area holds the new image
+ */
+static int install_image(const ext_slot_t *slot, int *image_size)
+{
+    int file_length = slot->fw_size;
+    uint32_t sum = 0;
+    uint32_t crc = 0;
+    union {
+        lzss_header_t lzss;
+        delta_header_t delta;
+    } header;
+
+    /* The record and the image header are checked before the first erase,
+     * an older application leaves reserved2 erased: sum only */
+    if ((slot->reserved1 != MAGIC_NUMBER) || (file_length <= 0) || (file_length > (int) ETX_APP_MAX_SIZE)
+        || ((slot->reserved2 != MAGIC_NUMBER) && (slot->reserved2 != 0xFFFFFFFF))
+        || (w25qx_read((uint8_t *) &header, OTA_FIRMWARE_ADDRESS, sizeof(header)) != W25Qx_OK)) {
+        LOG_INFO("Firmware is invalid");
+        return -1;
+    }
+
+    if ((file_length > (int) sizeof(header)) && (lzss_check_header(&header.lzss, ETX_APP_MAX_SIZE) == 0)) {
+        /* Compressed image, the file is checked while it is decoded */
+        *image_size = header.lzss.size;
+        return install_compressed(slot, &header.lzss, file_length);
+    }
+
+    if ((file_length > (int) sizeof(header)) && (delta_check_header(&header.delta, ETX_APP_MAX_SIZE) == 0)) {
+        /* Patch against the installed firmware, checked by its own CRCs */
+        *image_size = header.delta.new_size;
+        return install_delta(slot, &header.delta, file_length);
+    }
+
+    /* Raw image: its vector table must point in the RAM and in the image.
+     * The sum and CRC are computed while the copy programs it, a file the
+     * application changed since its request fails there and the previous
+     * image is restored */
+    if (check_vector_table(file_length) != 0) {
+        LOG_INFO("Firmware is invalid");
+        return -1;
+    }
+
+    uint32_t tickstart = HAL_GetTick();
+    int start = journal_open(slot);
+    if (start > file_length) {
+        start = 0;
+    }
+    if (start > 0) {
+        /* Programmed before the reset: checked from the internal flash, the
+         * CRC unit then continues over the rest */
+        LOG_INFO("Resume install at %d of %d bytes", start, file_length);
+        sum = cal_checksum_file(sum, (uint8_t *) ETX_APP_FLASH_ADDR, start);
+        crc = HAL_CRC_Calculate(&hcrc, (uint32_t *) ETX_APP_FLASH_ADDR, start);
+    }
+
+    LOG_INFO("Start download file %d bytes", file_length);
+    *image_size = file_length;
+    if (copy_to_application(OTA_FIRMWARE_ADDRESS, start, file_length, &sum, &crc) < file_length) {
+        return -1;
+    }
+    if ((sum != slot->fw_crc) || ((slot->reserved2 == MAGIC_NUMBER) && (crc != slot->fw_crc32))) {
+        LOG_INFO("Firmware is invalid");
+        return -1;
+    }
+
+    LOG_INFO("Received %d bytes, Checksum %lu, CRC %08lX in %lu ms", file_length, sum, crc, HAL_GetTick() - tickstart);
+    return 0;
+}
+
+/*!
+ * @brief  Slot table storage in the W25Q
+ */
+static int slots_read_w25q(uint32_t address, uint8_t *data, uint32_t size)
+{
+    return (w25qx_read(data, address, size) == W25Qx_OK) ? 0 : -1;
+}
+
+static int slots_write_w25q(uint32_t address, const uint8_t *data, uint32_t size)
+{
+    return (w25qx_write((uint8_t *) data, address, size) == W25Qx_OK) ? 0 : -1;
+}
+
+static int slots_erase_w25q(uint32_t address)
+{
+    return (w25qx_erase_block(address) == W25Qx_OK) ? 0 : -1;
+}
+
+static const slots_io_t slots_io = {
+    .read = slots_read_w25q,
+    .write = slots_write_w25q,
+    .erase = slots_erase_w25q,
+    .address = SLOT_TABLE_ADDRESS,
+    .sector_size = W25Q_SECTOR_SIZE,
+};
+
+/*!
+ * @brief  Save the slot table if it differs from the saved one
+ */
+static void save_slots(slot_table_t *table, slot_table_t *saved)
+{
+    if (memcmp(table, saved, sizeof(*table)) == 0) {
+        return;
+    }
+    if (slots_save(&slots_io, table) != 0) {
+        LOG_ERR("Slot table write failed");
+    }
+    *saved = *table;
+}
+
+/*!
+ * @brief  Size of the image in the application area, trailing erased words excluded
+ *
+ * The flash engine erases what a larger image left after a smaller one.
+ */
+static int application_size(void)
+{
+    const uint32_t *word = (const uint32_t *) ETX_APP_FLASH_ADDR;
+    int count = ETX_APP_MAX_SIZE / 4;
+
+    while ((count > 0) && (word[count - 1] == 0xFFFFFFFF)) {
+        count--;
+    }
+    return count * 4;
+}
+
+/*!
+ * @brief  Copy the application area to the previous slot
+ * @param  current: Running image, its size is measured when unknown
+ * @param  copied: Filled with the copied image
+ * @retval 0 if the previous slot holds the image
+ */
+static int backup_application(const slot_info_t *current, slot_info_t *copied)
+{
+    uint32_t tickstart = HAL_GetTick();
+    uint32_t crc = 0;
+    int size = current->size;
+
+    if ((size <= 0) || (size > (int) ETX_APP_MAX_SIZE)) {
+        size = application_size();
+    }
+    if (size == 0) {
+        LOG_INFO("No application to back up");
+        return -1;
+    }
+
+    copied->state = SLOT_STATE_VALID;
+    copied->size = size;
+    copied->crc32 = HAL_CRC_Calculate(&hcrc, (uint32_t *) ETX_APP_FLASH_ADDR, size);
+    copied->version = current->version;
+
+    for (int offset = 0; offset < size; offset += W25Q_BLOCK_SIZE) {
+        if (w25qx_erase_block_64k(PREV_SLOT_ADDRESS + offset) != W25Qx_OK) {
+            LOG_INFO("Backup erase failed");
+            return -1;
+        }
+    }
+    /* In parts, the W25Q write timeout covers a whole call */
+    for (int offset = 0; offset < size; offset += OTA_PART_LENGTH) {
+        int part = (size - offset < OTA_PART_LENGTH) ? (size - offset) : OTA_PART_LENGTH;
+
+        if (w25qx_write((uint8_t *) ETX_APP_FLASH_ADDR + offset, PREV_SLOT_ADDRESS + offset, part) != W25Qx_OK) {
+            LOG_INFO("Backup write failed");
+            return -1;
+        }
+    }
+    if ((crc_w25q(PREV_SLOT_ADDRESS, size, &crc) != 0) || (crc != copied->crc32)) {
+        LOG_INFO("Backup is invalid");
+        return -1;
+    }
+
+    LOG_INFO("Backup %d bytes, CRC %08lX in %lu ms", size, crc, HAL_GetTick() - tickstart);
+    return 0;
+}
+
+/*!
+ * @brief  Program the previous slot back in the application area
+ * @retval 0 if the application area holds the previous image
+ *
+ * Only the pages differing from the previous image are erased and
+ * programmed, a rollback to the image just replaced is a short copy.
+ */
+static int restore_application(const slot_info_t *previous)
+{
+    uint32_t tickstart = HAL_GetTick();
+    uint32_t crc = 0;
+
+    /* The journal names the OTA file, not this copy */
+    journal_close();
+
+    LOG_INFO("Restore previous image %ld bytes, version %lu", previous->size, previous->version);
+    if ((copy_to_application(PREV_SLOT_ADDRESS, 0, previous->size, NULL, &crc) < previous->size)
+        || (crc != previous->crc32)) {
+        LOG_ERR("Restore failed");
+        return -1;
+    }
+
+    LOG_INFO("Restored %ld bytes in %lu ms", previous->size, HAL_GetTick() - tickstart);
+    return 0;
+}
+
+/*!
+ * @brief  Slot event of the reboot cause left in the mailbox
+ */
+static uint32_t reboot_event(uint32_t reboot_cause)
+{
+    switch (reboot_cause) {
+        case ETX_OTA_REQUEST:
+            return SLOT_EVENT_OTA_REQUEST;
+        case ETX_LOAD_PREV_APP:
+            return SLOT_EVENT_ROLLBACK_REQUEST;
+        case ETX_OTA_DONE_BOOT:
+            return SLOT_EVENT_TRIAL_BOOT;
+        case ETX_NORMAL_BOOT:
+            return SLOT_EVENT_CONFIRMED;
+        default:
+            return SLOT_EVENT_BOOT;
+    }
 }
 
 /*!
  * @brief  Check if a reboot ota is required
+ *
+ * The reboot cause comes from the boot mailbox, the configuration page only
+ * names the OTA file and is never erased here. The slot table is saved
+ * before each action, a reset in the middle of one finds the same table and
+ * does it again: a pending candidate is installed again even when the
+ * mailbox was lost with the power. Unconfirmed boots are only counted on a
+ * reset, after a power loss the image gets another trial boot.
  */
 static void app_main_check_reboot(void) {
     /* Check firmware configuration */
     ext_general_cfg_t *cfg = (ext_general_cfg_t *)(ETX_CONFIG_FLASH_ADDR);
-    if (cfg->reboot_cause != ETX_OTA_REQUEST) {
-        LOG_INFO("Normal reset");
+    boot_mailbox_t mailbox;
+    slot_table_t table, saved;
+    slot_info_t request = { 0 };
+    slot_info_t image;
+    uint32_t actions, event;
+    int image_size = 0;
+
+    if (slots_load(&slots_io, &table) != 0) {
+        LOG_INFO("New slot table");
     }
-    else {
-        int file_length = cfg->slot_table.fw_size;
-        int offset = 0;
-        int file_valid = 1;
-        HAL_StatusTypeDef ret;
-
-        /* Check crc */
-        while (offset < file_length) {
-            if (w25qx_read(ota_buf, OTA_FIRMWARE_ADDRESS + offset, OTA_PART_LENGTH) == W25Qx_OK) {
-                checksum_file = cal_checksum_file(checksum_file, ota_buf,
-                                    offset + OTA_PART_LENGTH < file_length ? OTA_PART_LENGTH : (file_length - offset));
-                offset += OTA_PART_LENGTH;
-            }
-            else {
-                file_valid = 0;
-                break;
-            }
-        }
+    saved = table;
 
-        if ((file_valid) && (checksum_file == cfg->slot_table.fw_crc)) {
-            offset = 0;
-            checksum_file = 0;
-            if ((cfg->reboot_cause == ETX_OTA_REQUEST) && (file_length > 0) && (cfg->slot_table.reserved1 == MAGIC_NUMBER)) {
-                LOG_INFO("Start download file %d bytes", file_length);
-                HAL_FLASH_Unlock();
-
-                while (offset < file_length) {
-                    if (w25qx_read(ota_buf, OTA_FIRMWARE_ADDRESS + offset, OTA_PART_LENGTH) == W25Qx_OK) {
-                        if (offset == 0) {
-                            /* No need to erase every time. Erase only the first time */
-                            FLASH_EraseInitTypeDef EraseInitStruct;
-                            uint32_t SectorError;
-                            EraseInitStruct.TypeErase = FLASH_TYPEERASE_PAGES;
-                            EraseInitStruct.Banks = FLASH_BANK_1;
-                            EraseInitStruct.Page = ETX_APP_NPAGE;
-                            EraseInitStruct.NbPages = 256 - ETX_APP_NPAGE;
-
-                            if (HAL_FLASHEx_Erase(&EraseInitStruct, &SectorError) != HAL_OK) {
-                                break;
-                            }
-
-                            EraseInitStruct.TypeErase = FLASH_TYPEERASE_MASSERASE;
-                            EraseInitStruct.Banks = FLASH_BANK_2;
-                            EraseInitStruct.Page = 0;
-                            EraseInitStruct.NbPages = 256;
-
-                            ret = HAL_FLASHEx_Erase(&EraseInitStruct, &SectorError);
-                            if (ret != HAL_OK) {
-                                break;
-                            }
-                        }
-
-                        uint32_t temp = cal_checksum_file(checksum_file, ota_buf,
-                                                offset + OTA_PART_LENGTH < file_length ? OTA_PART_LENGTH : (file_length - offset));
-                        checksum_file = temp;
-                        for (int i = 0; i < OTA_PART_LENGTH; i += 8) {
-                            uint64_t u64_data;
-                            memcpy(&u64_data, &ota_buf[i], sizeof(uint64_t));
-                            ret = HAL_FLASH_Program(FLASH_TYPEPROGRAM_DOUBLEWORD, ETX_APP_FLASH_ADDR + offset, u64_data);
-                            offset += 8;
-                            if (ret != HAL_OK) {
-                                LOG_INFO("Write flash failed");
-                                break;
-                            }
-                        }
-                    }
-                    else {
-                        LOG_INFO("Read flash failed");
-                        break;
-                    }
-                }
-                HAL_FLASH_Lock();
-            }
+    event = (boot_mailbox_read(&mailbox) == 0) ? reboot_event(mailbox.reboot_cause) : SLOT_EVENT_BOOT;
+    if (cfg->reboot_cause == ETX_OTA_REQUEST) {
+        request.size = cfg->slot_table.fw_size;
+        request.crc32 = cfg->slot_table.fw_crc32;
+        request.version = (cfg->slot_table.version != 0xFFFFFFFF) ? cfg->slot_table.version : 0;
+
+        /* Not handled yet, or requested again through the mailbox */
+        if (!slots_request_done(&table, &request)) {
+            event = SLOT_EVENT_OTA_REQUEST;
         }
-        else {
-            LOG_INFO("Firmware is invalid");
+    }
+    else if (event == SLOT_EVENT_OTA_REQUEST) {
+        event = SLOT_EVENT_BOOT;
+    }
+
+    actions = slots_boot(&table, event, &request);
+    if (table.slot[SLOT_CURRENT].state == SLOT_STATE_TRIAL) {
+        LOG_INFO("Image on trial, boot %lu of %d", table.trial_boots, SLOT_TRIAL_BOOTS);
+    }
+    save_slots(&table, &saved);
+
+    if (event == SLOT_EVENT_ROLLBACK_REQUEST) {
+        if (actions == 0) {
+            LOG_INFO("No previous image to load");
         }
+    }
+    else if (actions == 0) {
+        LOG_INFO("Normal reset");
+    }
 
-        if ((offset >= file_length) && (checksum_file == cfg->slot_table.fw_crc)) {
-            LOG_INFO("Received %d bytes, Checksum %u", offset, checksum_file);
-            ext_general_cfg_t _cfg;
-            _cfg.reboot_cause = ETX_OTA_DONE_BOOT;
-            _cfg.slot_table.fw_size = 0;
-            write_cfg_to_flash(&_cfg);
+    if (actions & SLOT_ACTION_BACKUP) {
+        int ret = backup_application(&table.slot[SLOT_CURRENT], &image);
+
+        slots_backup_done(&table, (ret == 0) ? &image : NULL);
+        save_slots(&table, &saved);
+    }
+
+    if (actions & SLOT_ACTION_INSTALL) {
+        if (install_image(&cfg->slot_table, &image_size) == 0) {
+            journal_close();
+            image = request;
+            image.size = image_size;
+            image.crc32 = HAL_CRC_Calculate(&hcrc, (uint32_t *) ETX_APP_FLASH_ADDR, image_size);
+            actions |= slots_install_done(&table, &image);
         }
         else {
+            journal_close();
             LOG_ERR("Bootloader OTA failed");
+            actions |= slots_install_done(&table, NULL);
         }
+        save_slots(&table, &saved);
     }
 
+    if (actions & SLOT_ACTION_RESTORE) {
+        int ret = restore_application(&table.slot[SLOT_PREVIOUS]);
+
+        slots_restore_done(&table, ret == 0);
+        save_slots(&table, &saved);
+    }
+
+    /* Tell the application if the image is on trial */
+    mailbox.reboot_cause = (table.slot[SLOT_CURRENT].state == SLOT_STATE_TRIAL) ? ETX_OTA_DONE_BOOT : ETX_NORMAL_BOOT;
+    mailbox.boot_ms = HAL_GetTick();
+    boot_mailbox_write(&mailbox);
+    LOG_INFO("Boot took %lu ms", mailbox.boot_ms);
+
+    w25qx_deinit();
     jump_to_application();
 }
 
@@ -0,0 +1,73 @@
+/*
+ *  boot_mailbox.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+
+#include <stddef.h>
+#include "stm32l4xx_hal.h"
+#include "boot_mailbox.h"
+
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+
+extern RTC_HandleTypeDef hrtc;
+extern CRC_HandleTypeDef hcrc;
+
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+/*                                FUNCTIONS                                   */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+
+/*!
+ * @brief  Read the boot mailbox
+ */
+int boot_mailbox_read(boot_mailbox_t *mailbox)
+{
+    uint32_t *word = (uint32_t *) mailbox;
+
+    for (uint32_t i = 0; i < BOOT_MAILBOX_WORDS; i++) {
+        word[i] = HAL_RTCEx_BKUPRead(&hrtc, BOOT_MAILBOX_FIRST_REG + i);
+    }
+
+    if ((mailbox->magic != BOOT_MAILBOX_MAGIC)
+        || (mailbox->check != HAL_CRC_Calculate(&hcrc, word, offsetof(boot_mailbox_t, check)))) {
+        return -1;
+    }
+    return 0;
+}
+
+/*!
+ * @brief  Write the boot mailbox
+ */
+void boot_mailbox_write(boot_mailbox_t *mailbox)
+{
+    uint32_t *word = (uint32_t *) mailbox;
+
+    mailbox->magic = BOOT_MAILBOX_MAGIC;
+    mailbox->check = HAL_CRC_Calculate(&hcrc, word, offsetof(boot_mailbox_t, check));
+
+    for (uint32_t i = 0; i < BOOT_MAILBOX_WORDS; i++) {
+        HAL_RTCEx_BKUPWrite(&hrtc, BOOT_MAILBOX_FIRST_REG + i, word[i]);
+    }
+}
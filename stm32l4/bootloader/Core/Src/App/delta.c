@@ -0,0 +1,182 @@
+/*
+ *  delta.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+
+#include <string.h>
+#include "delta.h"
+
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+
+static const delta_io_t *delta_io;
+
+static uint8_t in_buf[DELTA_BUF_SIZE];
+static uint32_t in_pos;             /* Patch bytes read into in_buf */
+static uint32_t in_len;
+static uint32_t in_idx;
+
+static uint8_t out_buf[DELTA_BUF_SIZE];
+static uint32_t out_flushed;        /* Bytes written */
+static uint32_t out_len;            /* Bytes waiting in out_buf */
+
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+/*                                FUNCTIONS                                   */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+
+/*!
+ * @brief  Get the next patch bytes
+ */
+static int delta_get(uint8_t *data, uint32_t size) {
+    while (size > 0) {
+        if (in_idx == in_len) {
+            uint32_t length = delta_io->patch_size - in_pos;
+
+            if (length == 0) {
+                return -1;
+            }
+            if (length > DELTA_BUF_SIZE) {
+                length = DELTA_BUF_SIZE;
+            }
+            if (delta_io->read(in_pos, in_buf, length) != 0) {
+                return -1;
+            }
+            in_pos += length;
+            in_len = length;
+            in_idx = 0;
+        }
+
+        uint32_t chunk = in_len - in_idx;
+        if (chunk > size) {
+            chunk = size;
+        }
+        memcpy(data, &in_buf[in_idx], chunk);
+        in_idx += chunk;
+        data += chunk;
+        size -= chunk;
+    }
+
+    return 0;
+}
+
+static int delta_get_u32(uint32_t *value) {
+    uint8_t data[4];
+
+    if (delta_get(data, sizeof(data)) != 0) {
+        return -1;
+    }
+    *value = data[0] | (data[1] << 8) | (data[2] << 16) | ((uint32_t) data[3] << 24);
+    return 0;
+}
+
+/*!
+ * @brief  Make room in the output buffer, write it when full
+ */
+static int delta_flush(void) {
+    if (out_len == DELTA_BUF_SIZE) {
+        if (delta_io->write(out_flushed, out_buf, DELTA_BUF_SIZE) != 0) {
+            return -1;
+        }
+        out_flushed += DELTA_BUF_SIZE;
+        out_len = 0;
+    }
+    return 0;
+}
+
+/*!
+ * @brief  Check a delta image header
+ */
+int delta_check_header(const delta_header_t *header, uint32_t max_size) {
+    if ((header->magic != DELTA_MAGIC) || (header->version != DELTA_VERSION)
+        || (header->old_size == 0) || (header->old_size > max_size)
+        || (header->new_size == 0) || (header->new_size > max_size)) {
+        return -1;
+    }
+
+    return 0;
+}
+
+/*!
+ * @brief  Rebuild the new image from the old one and the operations
+ */
+int delta_apply(const delta_io_t *io, const delta_header_t *header) {
+    uint32_t total = 0;
+
+    delta_io = io;
+    in_pos = in_len = in_idx = 0;
+    out_flushed = out_len = 0;
+
+    while (total < header->new_size) {
+        uint8_t op;
+        uint32_t offset = 0;
+        uint32_t length;
+
+        if ((delta_get(&op, 1) != 0)
+            || ((op == DELTA_OP_COPY) && (delta_get_u32(&offset) != 0))
+            || (delta_get_u32(&length) != 0)) {
+            return -1;
+        }
+        if ((length == 0) || (length > header->new_size - total)) {
+            return -1;
+        }
+
+        if (op == DELTA_OP_COPY) {
+            if ((offset > header->old_size) || (length > header->old_size - offset)) {
+                return -1;
+            }
+        }
+        else if (op != DELTA_OP_INSERT) {
+            return -1;
+        }
+
+        total += length;
+        while (length > 0) {
+            uint32_t chunk = DELTA_BUF_SIZE - out_len;
+            if (chunk > length) {
+                chunk = length;
+            }
+
+            if (op == DELTA_OP_COPY) {
+                memcpy(&out_buf[out_len], &io->old[offset], chunk);
+                offset += chunk;
+            }
+            else if (delta_get(&out_buf[out_len], chunk) != 0) {
+                return -1;
+            }
+            out_len += chunk;
+            length -= chunk;
+
+            if (delta_flush() != 0) {
+                return -1;
+            }
+        }
+    }
+
+    if ((out_len > 0) && (io->write(out_flushed, out_buf, out_len) != 0)) {
+        return -1;
+    }
+
+    return 0;
+}
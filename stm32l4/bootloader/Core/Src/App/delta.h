@@ -0,0 +1,105 @@
+/*
+ *  delta.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef _DELTA_H_
+#define _DELTA_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************************************************************/
+
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+
+#include <stdint.h>
+
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+
+/*
+ * Delta image, built by tools/ota_delta.py against the installed firmware
+ * (little endian): header (delta_header_t), then a list of operations:
+ *   DELTA_OP_COPY:   offset (4 bytes), length (4 bytes), bytes copied from the old image
+ *   DELTA_OP_INSERT: length (4 bytes), then the new bytes
+ * The new image is rebuilt in a scratch area, the old image is left untouched
+ * until the result was checked against new_crc.
+ * CRCs are CRC-32/MPEG-2, as computed by the CRC unit with its default settings.
+ */
+#define DELTA_MAGIC            (0x50445354)    /* "TSDP" */
+#define DELTA_VERSION          (1)
+#define DELTA_BUF_SIZE         (1024)          /* Input and output buffers */
+
+enum {
+    DELTA_OP_COPY = 0,
+    DELTA_OP_INSERT,
+};
+
+typedef struct {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t reserved;
+    uint32_t old_size;
+    uint32_t old_crc;
+    uint32_t new_size;
+    uint32_t new_crc;
+} __attribute__((packed)) delta_header_t;
+
+/* Read patch bytes, offset from the first operation */
+typedef int (*delta_read_t)(uint32_t offset, uint8_t *data, uint32_t size);
+
+/* Write the new image, in order, in chunks of DELTA_BUF_SIZE except the last one */
+typedef int (*delta_write_t)(uint32_t offset, const uint8_t *data, uint32_t size);
+
+typedef struct {
+    delta_read_t read;
+    delta_write_t write;
+    const uint8_t *old;             /* Installed image, memory mapped */
+    uint32_t patch_size;            /* Operation bytes after the header */
+} delta_io_t;
+
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+/*                                FUNCTIONS                                   */
+/******************************************************************************/
+
+/*!
+ * @brief  Check a delta image header
+ * @param  header: Image header
+ * @param  max_size: Largest old and new image size
+ * @retval 0 if this decoder handles it, -1 otherwise
+ */
+int delta_check_header(const delta_header_t *header, uint32_t max_size);
+
+/*!
+ * @brief  Rebuild the new image from the old one and the operations
+ * @param  io: Patch input, image output, old image
+ * @param  header: Image header, already checked with delta_check_header()
+ * @retval 0 if success, -1 on a read/write error or a malformed patch
+ */
+int delta_apply(const delta_io_t *io, const delta_header_t *header);
+
+/******************************************************************************/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _DELTA_H_ */
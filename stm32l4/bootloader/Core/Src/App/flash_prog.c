@@ -0,0 +1,320 @@
+/*
+ *  flash_prog.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+
+#include <string.h>
+#include "stm32l4xx_hal.h"
+#include "flash_prog.h"
+
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+
+#define FLASH_PROG_BANK2_ADDR  (FLASH_BASE + FLASH_BANK_SIZE)
+#define FLASH_PROG_END_ADDR    (FLASH_BASE + 2 * FLASH_BANK_SIZE)
+
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+
+/* Page being filled, in RAM as the fast programming source */
+static uint8_t page_buf[FLASH_PAGE_SIZE] __attribute__((aligned(8)));
+static uint32_t page_len;
+
+static uint32_t prog_address;       /* Start of the page being filled */
+static uint32_t prog_end;           /* End of the image */
+static uint32_t prog_area_end;      /* Left erased after the image */
+static uint32_t prog_mass_erased;   /* Banks mass erased, fast rows allowed */
+static uint32_t prog_tickstart;
+static int prog_error;
+static flash_prog_stats_t prog_stats;
+
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+/*                                FUNCTIONS                                   */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+
+/*!
+ * @brief  Fast program a row, run from RAM: the 32 double words must follow
+ *         each other, the CPU can not wait for a fetch from a busy bank
+ */
+static __RAM_FUNC void flash_prog_fast_row(uint32_t address, const uint32_t *data)
+{
+    __IO uint32_t *dest = (__IO uint32_t *) address;
+    uint32_t primask_bit = __get_PRIMASK();
+
+    __disable_irq();
+    SET_BIT(FLASH->CR, FLASH_CR_FSTPG);
+
+    for (uint32_t i = 0; i < FLASH_PROG_ROW_SIZE / 4; i++) {
+        dest[i] = data[i];
+    }
+    while (READ_BIT(FLASH->SR, FLASH_SR_BSY) != 0) {
+    }
+
+    CLEAR_BIT(FLASH->CR, FLASH_CR_FSTPG);
+    __set_PRIMASK(primask_bit);
+}
+
+/*!
+ * @brief  Check that bytes are erased
+ */
+static int flash_prog_blank(const uint8_t *data, uint32_t size)
+{
+    const uint32_t *word = (const uint32_t *) data;
+
+    for (uint32_t i = 0; i < size / 4; i++) {
+        if (word[i] != 0xFFFFFFFF) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/*!
+ * @brief  Bank of an address
+ */
+static uint32_t flash_prog_bank(uint32_t address)
+{
+    return (address < FLASH_PROG_BANK2_ADDR) ? FLASH_BANK_1 : FLASH_BANK_2;
+}
+
+/*!
+ * @brief  Erase the page at address, or the whole bank 2 from its first page
+ */
+static HAL_StatusTypeDef flash_prog_erase(uint32_t address, int mass_erase)
+{
+    FLASH_EraseInitTypeDef EraseInitStruct;
+    uint32_t SectorError;
+    HAL_StatusTypeDef status;
+
+    EraseInitStruct.Banks = flash_prog_bank(address);
+    EraseInitStruct.Page = ((address - FLASH_BASE) % FLASH_BANK_SIZE) / FLASH_PAGE_SIZE;
+    EraseInitStruct.NbPages = 1;
+
+    if (mass_erase && (address == FLASH_PROG_BANK2_ADDR)) {
+        EraseInitStruct.TypeErase = FLASH_TYPEERASE_MASSERASE;
+        status = HAL_FLASHEx_Erase(&EraseInitStruct, &SectorError);
+        if (status == HAL_OK) {
+            prog_mass_erased |= FLASH_BANK_2;
+            prog_stats.mass_erases++;
+        }
+        return status;
+    }
+
+    EraseInitStruct.TypeErase = FLASH_TYPEERASE_PAGES;
+    prog_stats.pages_erased++;
+    return HAL_FLASHEx_Erase(&EraseInitStruct, &SectorError);
+}
+
+/*!
+ * @brief  Drop what the data cache kept of pages read before programming
+ */
+static void flash_prog_cache_reset(void)
+{
+    if (READ_BIT(FLASH->ACR, FLASH_ACR_DCEN) != 0) {
+        __HAL_FLASH_DATA_CACHE_DISABLE();
+        __HAL_FLASH_DATA_CACHE_RESET();
+        __HAL_FLASH_DATA_CACHE_ENABLE();
+    }
+}
+
+/*!
+ * @brief  Program double words of the page buffer, 0xFF ones are skipped
+ */
+static int flash_prog_double_words(uint32_t start, uint32_t end)
+{
+    for (uint32_t i = start; i < end; i += 8) {
+        uint64_t u64_data;
+
+        memcpy(&u64_data, &page_buf[i], sizeof(uint64_t));
+        if (u64_data == UINT64_MAX) {
+            continue;
+        }
+        if (HAL_FLASH_Program(FLASH_TYPEPROGRAM_DOUBLEWORD, prog_address + i, u64_data) != HAL_OK) {
+            return -1;
+        }
+        prog_stats.double_words++;
+    }
+    return 0;
+}
+
+/*!
+ * @brief  Program the page buffer, a whole page
+ *
+ * Fast programming needs its bank mass erased first (PGSERR otherwise):
+ * rows are only used in bank 2 after its mass erase, double words elsewhere.
+ * Bank 2 is mass erased when the image covers more than
+ * FLASH_PROG_MASS_ERASE_PAGES of it and its first page differs, blank or not.
+ */
+static int flash_prog_page(void)
+{
+    const uint8_t *flash = (const uint8_t *) prog_address;
+    uint32_t bank = flash_prog_bank(prog_address);
+    int mass_erase = (prog_address == FLASH_PROG_BANK2_ADDR)
+                     && ((prog_end - prog_address) > FLASH_PROG_MASS_ERASE_PAGES * FLASH_PAGE_SIZE);
+
+    if (memcmp(flash, page_buf, FLASH_PAGE_SIZE) == 0) {
+        prog_stats.pages_skipped++;
+        return 0;
+    }
+    if ((mass_erase || !flash_prog_blank(flash, FLASH_PAGE_SIZE))
+        && (flash_prog_erase(prog_address, mass_erase) != HAL_OK)) {
+        return -1;
+    }
+
+    for (uint32_t row = 0; row < FLASH_PAGE_SIZE; row += FLASH_PROG_ROW_SIZE) {
+        if (flash_prog_blank(&page_buf[row], FLASH_PROG_ROW_SIZE)) {
+            continue;
+        }
+        if ((prog_mass_erased & bank) == 0) {
+            if (flash_prog_double_words(row, row + FLASH_PROG_ROW_SIZE) != 0) {
+                return -1;
+            }
+            continue;
+        }
+
+        if (FLASH_WaitForLastOperation(FLASH_TIMEOUT_VALUE) != HAL_OK) {
+            return -1;
+        }
+        flash_prog_fast_row(prog_address + row, (const uint32_t *) &page_buf[row]);
+        if (FLASH_WaitForLastOperation(FLASH_TIMEOUT_VALUE) != HAL_OK) {
+            return -1;
+        }
+        prog_stats.rows_fast++;
+    }
+
+    /* Check what was really programmed */
+    flash_prog_cache_reset();
+    return (memcmp(flash, page_buf, FLASH_PAGE_SIZE) == 0) ? 0 : -1;
+}
+
+/*!
+ * @brief  Erase the pages after the image that a larger one left programmed
+ *
+ * A whole bank 2 after the image is mass erased.
+ */
+static int flash_prog_erase_tail(void)
+{
+    int mass_erase = (prog_area_end == FLASH_PROG_END_ADDR);
+    int erased = 0;
+
+    for (uint32_t address = prog_address; address < prog_area_end; address += FLASH_PAGE_SIZE) {
+        if (flash_prog_blank((const uint8_t *) address, FLASH_PAGE_SIZE)) {
+            continue;
+        }
+        if (flash_prog_erase(address, mass_erase) != HAL_OK) {
+            return -1;
+        }
+        erased = 1;
+        if (mass_erase && (address == FLASH_PROG_BANK2_ADDR)) {
+            break;
+        }
+    }
+    if (erased) {
+        flash_prog_cache_reset();
+    }
+    return 0;
+}
+
+/*!
+ * @brief  Start programming an image, unlock the flash
+ */
+int flash_prog_begin(uint32_t address, uint32_t size, uint32_t area_size)
+{
+    if ((address < FLASH_BASE) || ((address - FLASH_BASE) % FLASH_PAGE_SIZE != 0)
+        || (area_size > FLASH_PROG_END_ADDR - address) || (area_size % FLASH_PAGE_SIZE != 0) || (size > area_size)) {
+        return -1;
+    }
+
+    memset(&prog_stats, 0, sizeof(prog_stats));
+    prog_address = address;
+    prog_end = address + ((size + 7) & ~7UL);   /* Last double word padded */
+    prog_area_end = address + area_size;
+    prog_mass_erased = 0;
+    prog_tickstart = HAL_GetTick();
+    prog_error = 0;
+    page_len = 0;
+
+    HAL_FLASH_Unlock();
+    __HAL_FLASH_CLEAR_FLAG(FLASH_FLAG_ALL_ERRORS);
+    return 0;
+}
+
+/*!
+ * @brief  Program the next image bytes
+ */
+int flash_prog_write(const uint8_t *data, uint32_t size)
+{
+    if (prog_error || (size > prog_end - prog_address - page_len)) {
+        prog_error = 1;
+        return -1;
+    }
+
+    while (size > 0) {
+        uint32_t chunk = FLASH_PAGE_SIZE - page_len;
+        if (chunk > size) {
+            chunk = size;
+        }
+        memcpy(&page_buf[page_len], data, chunk);
+        page_len += chunk;
+        data += chunk;
+        size -= chunk;
+
+        if (page_len == FLASH_PAGE_SIZE) {
+            if (flash_prog_page() != 0) {
+                prog_error = 1;
+                return -1;
+            }
+            prog_address += FLASH_PAGE_SIZE;
+            page_len = 0;
+        }
+    }
+
+    return 0;
+}
+
+/*!
+ * @brief  Program the last partial page, erase the rest of the area, lock the flash
+ */
+int flash_prog_end(flash_prog_stats_t *stats)
+{
+    int complete = (prog_address + page_len >= prog_end);
+
+    /* Padded with 0xFF to the end of the page, a stale end gets it erased */
+    if (!prog_error && (page_len > 0)) {
+        memset(&page_buf[page_len], 0xFF, FLASH_PAGE_SIZE - page_len);
+        page_len = FLASH_PAGE_SIZE;
+        if (flash_prog_page() != 0) {
+            prog_error = 1;
+        }
+        prog_address += FLASH_PAGE_SIZE;
+        page_len = 0;
+    }
+    if (!prog_error && complete && (flash_prog_erase_tail() != 0)) {
+        prog_error = 1;
+    }
+
+    HAL_FLASH_Lock();
+
+    prog_stats.elapsed_ms = HAL_GetTick() - prog_tickstart;
+    if (stats != NULL) {
+        *stats = prog_stats;
+    }
+    return prog_error ? -1 : 0;
+}
@@ -0,0 +1,98 @@
+/*
+ *  flash_prog.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef _FLASH_PROG_H_
+#define _FLASH_PROG_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************************************************************/
+
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+
+#include <stdint.h>
+
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+
+/*
+ * Programs an image in the internal flash as a stream, one page at a time:
+ * only the pages the image covers are erased, pages already holding the
+ * same bytes are left untouched, blank pages are not erased again.
+ * When the image covers more than FLASH_PROG_MASS_ERASE_PAGES of bank 2 and
+ * its first bank 2 page differs, bank 2 is mass erased instead (one page
+ * erase time for the whole bank). Fast programming needs a mass erased
+ * bank: whole rows use it there, the rest is written with double words,
+ * 0xFF rows and double words are skipped.
+ * Once the whole image is programmed, the pages of its area after it are
+ * erased if a larger image left them programmed: the area holds nothing
+ * but the image.
+ */
+#define FLASH_PROG_ROW_SIZE          (256)     /* Fast programming: 32 double words */
+#define FLASH_PROG_MASS_ERASE_PAGES  (8)
+
+typedef struct {
+    uint32_t pages_erased;
+    uint32_t pages_skipped;         /* Already holding the image bytes */
+    uint32_t mass_erases;
+    uint32_t rows_fast;
+    uint32_t double_words;
+    uint32_t elapsed_ms;
+} flash_prog_stats_t;
+
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+/*                                FUNCTIONS                                   */
+/******************************************************************************/
+
+/*!
+ * @brief  Start programming an image, unlock the flash
+ * @param  address: Image address, start of a page
+ * @param  size: Image size in bytes
+ * @param  area_size: Bytes from address left erased after the image, whole pages
+ * @retval 0 if success, -1 if the image does not fit in the area or the area in the flash
+ */
+int flash_prog_begin(uint32_t address, uint32_t size, uint32_t area_size);
+
+/*!
+ * @brief  Program the next image bytes
+ * @param  data: Bytes following the previous ones
+ * @param  size: Any size, a page is programmed as soon as it is complete
+ * @retval 0 if success, -1 on a flash error or past the image size
+ */
+int flash_prog_write(const uint8_t *data, uint32_t size);
+
+/*!
+ * @brief  Program the last partial page, padded with 0xFF, erase the rest of
+ *         the area if the whole image was written, lock the flash
+ * @param  stats: Filled with the work done, can be NULL
+ * @retval 0 if every page was programmed and erased, -1 otherwise
+ */
+int flash_prog_end(flash_prog_stats_t *stats);
+
+/******************************************************************************/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _FLASH_PROG_H_ */
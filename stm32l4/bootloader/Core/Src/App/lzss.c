@@ -0,0 +1,169 @@
+/*
+ *  lzss.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+
+#include <string.h>
+#include "lzss.h"
+
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+
+#define LZSS_OFFSET_MASK       ((1 << LZSS_WINDOW_BITS) - 1)
+
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+
+static const lzss_io_t *lzss_io;
+
+static uint8_t in_buf[LZSS_BUF_SIZE];
+static uint32_t in_pos;             /* Stream bytes read into in_buf */
+static uint32_t in_len;
+static uint32_t in_idx;
+
+static uint8_t out_buf[LZSS_BUF_SIZE];
+static uint32_t out_flushed;        /* Bytes programmed */
+static uint32_t out_len;            /* Bytes waiting in out_buf */
+
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+/*                                FUNCTIONS                                   */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+
+/*!
+ * @brief  Get the next stream byte
+ */
+static int lzss_get(uint8_t *byte) {
+    if (in_idx == in_len) {
+        uint32_t size = lzss_io->stream_size - in_pos;
+
+        if (size == 0) {
+            return -1;
+        }
+        if (size > LZSS_BUF_SIZE) {
+            size = LZSS_BUF_SIZE;
+        }
+        if (lzss_io->read(in_pos, in_buf, size) != 0) {
+            return -1;
+        }
+        in_pos += size;
+        in_len = size;
+        in_idx = 0;
+    }
+
+    *byte = in_buf[in_idx++];
+    return 0;
+}
+
+/*!
+ * @brief  Append an output byte, program the buffer when full
+ */
+static int lzss_put(uint8_t byte) {
+    out_buf[out_len++] = byte;
+    if (out_len == LZSS_BUF_SIZE) {
+        if (lzss_io->write(out_flushed, out_buf, LZSS_BUF_SIZE) != 0) {
+            return -1;
+        }
+        out_flushed += LZSS_BUF_SIZE;
+        out_len = 0;
+    }
+
+    return 0;
+}
+
+/*!
+ * @brief  Output byte at position, from the buffer or from flash
+ */
+static uint8_t lzss_window(uint32_t position) {
+    return (position >= out_flushed) ? out_buf[position - out_flushed] : lzss_io->output[position];
+}
+
+/*!
+ * @brief  Check an image header
+ */
+int lzss_check_header(const lzss_header_t *header, uint32_t max_size) {
+    if ((header->magic != LZSS_MAGIC) || (header->version != LZSS_VERSION)
+        || (header->window_bits != LZSS_WINDOW_BITS) || (header->length_bits != LZSS_LENGTH_BITS)
+        || (header->size == 0) || (header->size > max_size)) {
+        return -1;
+    }
+
+    return 0;
+}
+
+/*!
+ * @brief  Decompress a stream
+ */
+int lzss_decode(const lzss_io_t *io, const lzss_header_t *header) {
+    uint32_t total = 0;
+    uint8_t flags = 0;
+    uint8_t bits = 0;
+    uint8_t byte, high;
+
+    lzss_io = io;
+    in_pos = in_len = in_idx = 0;
+    out_flushed = out_len = 0;
+
+    while (total < header->size) {
+        if (bits == 0) {
+            if (lzss_get(&flags) != 0) {
+                return -1;
+            }
+            bits = 8;
+        }
+
+        if (flags & 1) {
+            if ((lzss_get(&byte) != 0) || (lzss_put(byte) != 0)) {
+                return -1;
+            }
+            total++;
+        }
+        else {
+            if ((lzss_get(&byte) != 0) || (lzss_get(&high) != 0)) {
+                return -1;
+            }
+            uint32_t match = byte | (high << 8);
+            uint32_t offset = (match & LZSS_OFFSET_MASK) + 1;
+            uint32_t length = (match >> LZSS_WINDOW_BITS) + LZSS_MIN_MATCH;
+
+            if ((offset > total) || (length > header->size - total)) {
+                return -1;
+            }
+            for (uint32_t i = 0; i < length; i++, total++) {
+                if (lzss_put(lzss_window(total - offset)) != 0) {
+                    return -1;
+                }
+            }
+        }
+
+        flags >>= 1;
+        bits--;
+    }
+
+    /* Last partial buffer, padded to a double word */
+    if (out_len > 0) {
+        uint32_t size = (out_len + 7) & ~7UL;
+        memset(&out_buf[out_len], 0xFF, size - out_len);
+        if (io->write(out_flushed, out_buf, size) != 0) {
+            return -1;
+        }
+    }
+
+    return 0;
+}
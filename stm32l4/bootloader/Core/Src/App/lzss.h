@@ -0,0 +1,103 @@
+/*
+ *  lzss.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef _LZSS_H_
+#define _LZSS_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************************************************************/
+
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+
+#include <stdint.h>
+
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+
+/*
+ * Compressed firmware image, built by tools/ota_pack.py (little endian):
+ *   header (lzss_header_t), then the LZSS stream:
+ *   a flag byte for each 8 items, LSB first, 1 = literal byte,
+ *   0 = match: 16 bits, offset - 1 in the low LZSS_WINDOW_BITS, length - LZSS_MIN_MATCH above.
+ * Matches are copied back from the output, read from the flash already
+ * programmed, so only two LZSS_BUF_SIZE buffers are needed whatever the window.
+ * The output buffer is one internal flash page: each write completes a page,
+ * programmed before the window reads it back.
+ */
+#define LZSS_MAGIC             (0x5A4C5354)    /* "TSLZ" */
+#define LZSS_VERSION           (1)
+#define LZSS_WINDOW_BITS       (12)            /* 4 KB window */
+#define LZSS_LENGTH_BITS       (4)
+#define LZSS_MIN_MATCH         (3)
+#define LZSS_BUF_SIZE          (2048)          /* Input and output buffers, multiple of 8 */
+
+typedef struct {
+    uint32_t magic;
+    uint16_t version;
+    uint8_t window_bits;
+    uint8_t length_bits;
+    uint32_t size;                  /* Decompressed size */
+    uint32_t checksum;              /* Sum of the decompressed bytes */
+} __attribute__((packed)) lzss_header_t;
+
+/* Read compressed bytes, offset from the start of the stream (after the header) */
+typedef int (*lzss_read_t)(uint32_t offset, uint8_t *data, uint32_t size);
+
+/* Program decompressed bytes, size is a multiple of 8 (the end is padded with 0xFF) */
+typedef int (*lzss_write_t)(uint32_t offset, const uint8_t *data, uint32_t size);
+
+typedef struct {
+    lzss_read_t read;
+    lzss_write_t write;
+    const uint8_t *output;          /* Where the written bytes can be read back */
+    uint32_t stream_size;           /* Compressed bytes after the header */
+} lzss_io_t;
+
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+/*                                FUNCTIONS                                   */
+/******************************************************************************/
+
+/*!
+ * @brief  Decompress a stream
+ * @param  io: Input, output and stream size
+ * @param  header: Image header, already checked with lzss_check_header()
+ * @retval 0 if success, -1 on a read/write error or a corrupted stream
+ */
+int lzss_decode(const lzss_io_t *io, const lzss_header_t *header);
+
+/*!
+ * @brief  Check an image header
+ * @param  header: Image header
+ * @param  max_size: Largest decompressed size
+ * @retval 0 if this decoder handles it, -1 otherwise
+ */
+int lzss_check_header(const lzss_header_t *header, uint32_t max_size);
+
+/******************************************************************************/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _LZSS_H_ */
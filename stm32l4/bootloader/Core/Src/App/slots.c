@@ -0,0 +1,306 @@
+/*
+ *  slots.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+
+#include <stddef.h>
+#include <string.h>
+#include "slots.h"
+
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+
+#define SLOTS_CRC_POLY         (0x04C11DB7)
+
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+
+static uint32_t slots_next;         /* Address of the next record */
+static int slots_erase_first;       /* The sector of slots_next must be erased before */
+
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+/*                                FUNCTIONS                                   */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+
+/*!
+ * @brief  CRC-32/MPEG-2 of a record, bitwise: records are small
+ */
+static uint32_t slots_crc(const uint8_t *data, uint32_t size) {
+    uint32_t crc = 0xFFFFFFFF;
+
+    for (uint32_t i = 0; i < size; i++) {
+        crc ^= (uint32_t) data[i] << 24;
+        for (int bit = 0; bit < 8; bit++) {
+            crc = (crc & 0x80000000) ? ((crc << 1) ^ SLOTS_CRC_POLY) : (crc << 1);
+        }
+    }
+    return crc;
+}
+
+static int slots_record_valid(const slot_table_t *record) {
+    return (record->magic == SLOT_TABLE_MAGIC)
+           && (record->check == slots_crc((const uint8_t *) record, offsetof(slot_table_t, check)));
+}
+
+static int slots_record_erased(const slot_table_t *record) {
+    const uint8_t *data = (const uint8_t *) record;
+
+    for (uint32_t i = 0; i < sizeof(*record); i++) {
+        if (data[i] != 0xFF) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/*!
+ * @brief  Same image in both slots
+ */
+static int slots_same(const slot_info_t *a, const slot_info_t *b) {
+    return (a->size != 0) && (a->size == b->size) && (a->crc32 == b->crc32);
+}
+
+/*!
+ * @brief  The previous slot holds a confirmed image other than the current one
+ */
+static int slots_can_restore(const slot_table_t *table) {
+    return (table->slot[SLOT_PREVIOUS].state == SLOT_STATE_VALID)
+           && !slots_same(&table->slot[SLOT_PREVIOUS], &table->slot[SLOT_CURRENT]);
+}
+
+/*!
+ * @brief  Start a restore: until it ends the internal flash holds parts of two images
+ */
+static uint32_t slots_restore(slot_table_t *table) {
+    memset(&table->slot[SLOT_CURRENT], 0, sizeof(slot_info_t));
+    return SLOT_ACTION_RESTORE;
+}
+
+/*!
+ * @brief  Read the slot table
+ */
+int slots_load(const slots_io_t *io, slot_table_t *table) {
+    slot_table_t record;
+    uint32_t used[2];
+    int found = -1;
+
+    memset(table, 0, sizeof(*table));
+    table->magic = SLOT_TABLE_MAGIC;
+
+    for (int sector = 0; sector < 2; sector++) {
+        uint32_t start = io->address + sector * io->sector_size;
+
+        /* Records are appended, the first erased one ends the sector */
+        used[sector] = start;
+        for (uint32_t address = start; address < start + io->sector_size; address += sizeof(record)) {
+            if ((io->read(address, (uint8_t *) &record, sizeof(record)) != 0) || slots_record_erased(&record)) {
+                break;
+            }
+            used[sector] = address + sizeof(record);
+
+            /* A record torn by a reset fails its check */
+            if (slots_record_valid(&record)
+                && ((found < 0) || ((int32_t) (record.sequence - table->sequence) > 0))) {
+                *table = record;
+                found = sector;
+            }
+        }
+    }
+
+    if (found < 0) {
+        slots_next = io->address;
+        slots_erase_first = 1;
+        return -1;
+    }
+
+    slots_next = used[found];
+    slots_erase_first = 0;
+    if (slots_next == io->address + (found + 1) * io->sector_size) {
+        /* Full, go on in the other sector */
+        slots_next = io->address + (1 - found) * io->sector_size;
+        slots_erase_first = 1;
+    }
+    return 0;
+}
+
+/*!
+ * @brief  Append the table as a new record
+ */
+int slots_save(const slots_io_t *io, slot_table_t *table) {
+    uint32_t sector = (slots_next - io->address) / io->sector_size;
+
+    table->magic = SLOT_TABLE_MAGIC;
+    table->sequence++;
+    table->check = slots_crc((const uint8_t *) table, offsetof(slot_table_t, check));
+
+    if (slots_erase_first) {
+        if (io->erase(slots_next) != 0) {
+            return -1;
+        }
+        slots_erase_first = 0;
+    }
+    if (io->write(slots_next, (const uint8_t *) table, sizeof(*table)) != 0) {
+        return -1;
+    }
+
+    slots_next += sizeof(*table);
+    if (slots_next == io->address + (sector + 1) * io->sector_size) {
+        /* The older records stay valid until the first write in the other sector */
+        slots_next = io->address + (1 - sector) * io->sector_size;
+        slots_erase_first = 1;
+    }
+    return 0;
+}
+
+/*!
+ * @brief  Check if an OTA request was already installed or rejected
+ */
+int slots_request_done(const slot_table_t *table, const slot_info_t *request) {
+    const slot_info_t *candidate = &table->slot[SLOT_CANDIDATE];
+
+    return (candidate->state != SLOT_STATE_PENDING) && (candidate->state != SLOT_STATE_EMPTY)
+           && (candidate->size == request->size) && (candidate->crc32 == request->crc32)
+           && (candidate->version == request->version);
+}
+
+/*!
+ * @brief  Apply the reset event to the table
+ */
+uint32_t slots_boot(slot_table_t *table, uint32_t event, const slot_info_t *request) {
+    slot_info_t *current = &table->slot[SLOT_CURRENT];
+    slot_info_t *previous = &table->slot[SLOT_PREVIOUS];
+    uint32_t actions = 0;
+
+    /* A restore did not end, whatever the event: the reset may have lost it */
+    if ((current->state == SLOT_STATE_EMPTY) && slots_can_restore(table)) {
+        return slots_restore(table);
+    }
+
+    switch (event) {
+        case SLOT_EVENT_CONFIRMED:
+            if (current->state == SLOT_STATE_TRIAL) {
+                current->state = SLOT_STATE_VALID;
+                table->trial_boots = 0;
+            }
+            break;
+
+        case SLOT_EVENT_TRIAL_BOOT:
+            if (current->state != SLOT_STATE_TRIAL) {
+                break;
+            }
+            if (table->trial_boots < SLOT_TRIAL_BOOTS) {
+                table->trial_boots++;
+            }
+            else if (slots_can_restore(table)) {
+                actions = slots_restore(table);
+            }
+            else {
+                /* Nothing to go back to */
+                current->state = SLOT_STATE_VALID;
+                table->trial_boots = 0;
+            }
+            break;
+
+        case SLOT_EVENT_OTA_REQUEST:
+            table->slot[SLOT_CANDIDATE] = *request;
+            table->slot[SLOT_CANDIDATE].state = SLOT_STATE_PENDING;
+
+            /* Keep the last confirmed image, not the one on trial */
+            if ((current->state != SLOT_STATE_TRIAL)
+                && !((previous->state == SLOT_STATE_VALID) && slots_same(current, previous))) {
+                previous->state = SLOT_STATE_EMPTY;     /* Overwritten from now on */
+                actions = SLOT_ACTION_BACKUP;
+            }
+            actions |= SLOT_ACTION_INSTALL;
+            break;
+
+        case SLOT_EVENT_ROLLBACK_REQUEST:
+            if (slots_can_restore(table)) {
+                actions = slots_restore(table);
+            }
+            break;
+
+        default:
+            break;
+    }
+
+    return actions;
+}
+
+/*!
+ * @brief  Record the end of SLOT_ACTION_BACKUP
+ */
+void slots_backup_done(slot_table_t *table, const slot_info_t *copied) {
+    slot_info_t *current = &table->slot[SLOT_CURRENT];
+
+    if (copied == NULL) {
+        return;
+    }
+
+    table->slot[SLOT_PREVIOUS] = *copied;
+    table->slot[SLOT_PREVIOUS].state = SLOT_STATE_VALID;
+
+    /* Image installed before the table existed: it runs, it is valid */
+    if (current->state == SLOT_STATE_EMPTY) {
+        *current = *copied;
+        current->state = SLOT_STATE_VALID;
+    }
+}
+
+/*!
+ * @brief  Record the end of SLOT_ACTION_INSTALL
+ */
+uint32_t slots_install_done(slot_table_t *table, const slot_info_t *installed) {
+    slot_info_t *current = &table->slot[SLOT_CURRENT];
+
+    if (installed != NULL) {
+        *current = *installed;
+        current->state = SLOT_STATE_TRIAL;
+        table->trial_boots = 1;         /* The jump after the install */
+        table->slot[SLOT_CANDIDATE].state = SLOT_STATE_VALID;
+        return 0;
+    }
+
+    /* The internal flash may hold anything now */
+    table->slot[SLOT_CANDIDATE].state = SLOT_STATE_REJECTED;
+    memset(current, 0, sizeof(*current));
+
+    return slots_can_restore(table) ? slots_restore(table) : 0;
+}
+
+/*!
+ * @brief  Record the end of SLOT_ACTION_RESTORE
+ */
+void slots_restore_done(slot_table_t *table, int ok) {
+    slot_info_t *current = &table->slot[SLOT_CURRENT];
+
+    if (!ok) {
+        memset(current, 0, sizeof(*current));
+        return;
+    }
+
+    /* The last OTA file installed the image replaced */
+    if (table->slot[SLOT_CANDIDATE].state == SLOT_STATE_VALID) {
+        table->slot[SLOT_CANDIDATE].state = SLOT_STATE_REJECTED;
+    }
+
+    *current = table->slot[SLOT_PREVIOUS];
+    table->trial_boots = 0;
+}
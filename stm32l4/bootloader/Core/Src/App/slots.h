@@ -0,0 +1,177 @@
+/*
+ *  slots.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef _SLOTS_H_
+#define _SLOTS_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************************************************************/
+
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+
+#include <stdint.h>
+
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+
+/*
+ * Firmware slots, kept in two W25Q sectors as a log of slot_table_t
+ * records, the valid record with the highest sequence is the table:
+ *   SLOT_CURRENT:   image in the internal flash
+ *   SLOT_PREVIOUS:  last confirmed image, raw copy in the W25Q for rollbacks
+ *   SLOT_CANDIDATE: last OTA file, pending until installed, valid once installed,
+ *                   rejected if it failed to install or was rolled back
+ * An installed image is on trial until the application confirms it. After
+ * SLOT_TRIAL_BOOTS boots without confirmation the previous image is restored.
+ * No hardware access here: the bootloader gives the storage functions and
+ * performs the actions, so the state machine also runs on a host.
+ */
+#define SLOT_TABLE_MAGIC       (0x42535354)    /* "TSSB" */
+#define SLOT_TRIAL_BOOTS       (3)
+
+enum {
+    SLOT_CURRENT = 0,
+    SLOT_PREVIOUS,
+    SLOT_CANDIDATE,
+    SLOT_COUNT,
+};
+
+enum {
+    SLOT_STATE_EMPTY = 0,           /* Nothing known */
+    SLOT_STATE_VALID,               /* Confirmed by the application */
+    SLOT_STATE_TRIAL,               /* Installed, waiting for the confirmation */
+    SLOT_STATE_PENDING,             /* Downloaded, to install */
+    SLOT_STATE_REJECTED,            /* Failed to install or never confirmed */
+};
+
+/* What the bootloader found at reset */
+enum {
+    SLOT_EVENT_BOOT = 0,            /* Nothing requested */
+    SLOT_EVENT_CONFIRMED,           /* The application confirmed the running image */
+    SLOT_EVENT_TRIAL_BOOT,          /* The image on trial restarted without confirming */
+    SLOT_EVENT_OTA_REQUEST,         /* A new image waits in the W25Q */
+    SLOT_EVENT_ROLLBACK_REQUEST,    /* The application wants the previous image back */
+};
+
+/* What the bootloader has to do, in this order */
+#define SLOT_ACTION_BACKUP     (0x01)          /* Copy the current image to the previous slot */
+#define SLOT_ACTION_INSTALL    (0x02)          /* Install the candidate */
+#define SLOT_ACTION_RESTORE    (0x04)          /* Copy the previous image back */
+
+typedef struct {
+    uint32_t state;                 /* SLOT_STATE_xxx */
+    int32_t size;                   /* Image bytes, 0 if unknown */
+    uint32_t crc32;                 /* CRC-32/MPEG-2 of the image */
+    uint32_t version;               /* Given with the OTA, 0 if unknown */
+} __attribute__((packed)) slot_info_t;
+
+typedef struct {
+    uint32_t magic;
+    uint32_t sequence;              /* Incremented by each record */
+    slot_info_t slot[SLOT_COUNT];
+    uint32_t trial_boots;           /* Boots of the current image on trial */
+    uint32_t check;                 /* CRC-32/MPEG-2 of the fields above */
+} __attribute__((packed)) slot_table_t;
+
+/* Storage of the records, erase works on sector_size units */
+typedef int (*slots_read_t)(uint32_t address, uint8_t *data, uint32_t size);
+typedef int (*slots_write_t)(uint32_t address, const uint8_t *data, uint32_t size);
+typedef int (*slots_erase_t)(uint32_t address);
+
+typedef struct {
+    slots_read_t read;
+    slots_write_t write;
+    slots_erase_t erase;
+    uint32_t address;               /* Two sectors from here */
+    uint32_t sector_size;           /* Multiple of sizeof(slot_table_t) */
+} slots_io_t;
+
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+/*                                FUNCTIONS                                   */
+/******************************************************************************/
+
+/*!
+ * @brief  Read the slot table
+ * @param  io: Storage
+ * @param  table: Latest valid record, or an empty table
+ * @retval 0 if a record was found, -1 if the table is new
+ */
+int slots_load(const slots_io_t *io, slot_table_t *table);
+
+/*!
+ * @brief  Append the table as a new record, after slots_load()
+ * @param  io: Storage
+ * @param  table: Table to save, sequence and check are updated
+ * @retval 0 if success, -1 on a storage error
+ */
+int slots_save(const slots_io_t *io, slot_table_t *table);
+
+/*!
+ * @brief  Check if an OTA request was already installed or rejected
+ * @param  table: Slot table
+ * @param  request: OTA file named by the configuration page
+ * @retval 1 if handled, 0 if new or interrupted by a reset
+ */
+int slots_request_done(const slot_table_t *table, const slot_info_t *request);
+
+/*!
+ * @brief  Apply the reset event to the table
+ * @param  table: Slot table, to save if it changed
+ * @param  event: SLOT_EVENT_xxx
+ * @param  request: Candidate for SLOT_EVENT_OTA_REQUEST, NULL otherwise
+ * @retval SLOT_ACTION_xxx flags
+ */
+uint32_t slots_boot(slot_table_t *table, uint32_t event, const slot_info_t *request);
+
+/*!
+ * @brief  Record the end of SLOT_ACTION_BACKUP
+ * @param  table: Slot table
+ * @param  copied: Image copied to the previous slot, NULL if the copy failed
+ * @retval None
+ */
+void slots_backup_done(slot_table_t *table, const slot_info_t *copied);
+
+/*!
+ * @brief  Record the end of SLOT_ACTION_INSTALL
+ * @param  table: Slot table
+ * @param  installed: Image now in the internal flash, NULL if the install failed
+ * @retval SLOT_ACTION_RESTORE if the previous image has to be restored, 0 otherwise
+ */
+uint32_t slots_install_done(slot_table_t *table, const slot_info_t *installed);
+
+/*!
+ * @brief  Record the end of SLOT_ACTION_RESTORE
+ * @param  table: Slot table
+ * @param  ok: 1 if the internal flash holds the previous image
+ * @retval None
+ */
+void slots_restore_done(slot_table_t *table, int ok);
+
+/******************************************************************************/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _SLOTS_H_ */
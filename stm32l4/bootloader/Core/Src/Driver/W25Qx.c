@@ -24,10 +24,18 @@
 #define w25qx_enable()     HAL_GPIO_WritePin(CS_GPIO_Port, CS_Pin, GPIO_PIN_RESET)
 #define w25qx_disable()    HAL_GPIO_WritePin(CS_GPIO_Port, CS_Pin, GPIO_PIN_SET)
 
+/* SPI2 DMA requests */
+#define W25Q_DMA_RX        DMA1_Channel4
+#define W25Q_DMA_RX_IRQ    DMA1_Channel4_IRQn
+#define W25Q_DMA_TX        DMA1_Channel5
+#define W25Q_DMA_TX_IRQ    DMA1_Channel5_IRQn
+
 /******************************************************************************/
 /*                              PRIVATE DATA                                  */
 /******************************************************************************/
 
+static DMA_HandleTypeDef hdma_w25q_rx;
+static DMA_HandleTypeDef hdma_w25q_tx;
 
 
 /******************************************************************************/
@@ -57,10 +65,46 @@ static void w25qx_reset(void)
     w25qx_disable();
 }
 
+/*!
+ * @brief  Initialize one SPI DMA channel
+ */
+static void w25qx_dma_channel_init(DMA_HandleTypeDef *hdma, DMA_Channel_TypeDef *instance, uint32_t direction, IRQn_Type irq) {
+    hdma->Instance = instance;
+    hdma->Init.Request = DMA_REQUEST_1;
+    hdma->Init.Direction = direction;
+    hdma->Init.PeriphInc = DMA_PINC_DISABLE;
+    hdma->Init.MemInc = DMA_MINC_ENABLE;
+    hdma->Init.PeriphDataAlignment = DMA_PDATAALIGN_BYTE;
+    hdma->Init.MemDataAlignment = DMA_MDATAALIGN_BYTE;
+    hdma->Init.Mode = DMA_NORMAL;
+    hdma->Init.Priority = DMA_PRIORITY_HIGH;
+    if (HAL_DMA_Init(hdma) != HAL_OK) {
+        Error_Handler();
+    }
+
+    HAL_NVIC_SetPriority(irq, 0, 0);
+    HAL_NVIC_EnableIRQ(irq);
+}
+
+/*!
+ * @brief  Initialize the SPI DMA channels used by w25qx_read_start()
+ */
+static void w25qx_dma_init(void) {
+    __HAL_RCC_DMA1_CLK_ENABLE();
+
+    /* A master receive clocks dummy bytes out, so it needs the TX channel too */
+    w25qx_dma_channel_init(&hdma_w25q_rx, W25Q_DMA_RX, DMA_PERIPH_TO_MEMORY, W25Q_DMA_RX_IRQ);
+    w25qx_dma_channel_init(&hdma_w25q_tx, W25Q_DMA_TX, DMA_MEMORY_TO_PERIPH, W25Q_DMA_TX_IRQ);
+    __HAL_LINKDMA(&W25Q_SPI, hdmarx, hdma_w25q_rx);
+    __HAL_LINKDMA(&W25Q_SPI, hdmatx, hdma_w25q_tx);
+}
+
 /*!
  * @brief  Initialize the W25Qx flash memory device
  */
 uint8_t w25qx_init(void) {
+    w25qx_dma_init();
+
     /* Reset W25Qxxx */
     w25qx_reset();
 
@@ -154,6 +198,71 @@ uint8_t w25qx_read(uint8_t *data, uint32_t read_addr, uint32_t size) {
     return W25Qx_OK;
 }
 
+/*!
+ * @brief  Start reading data from W25Qx flash memory with DMA
+ */
+uint8_t w25qx_read_start(uint8_t *data, uint32_t read_addr, uint32_t size) {
+    uint8_t cmd[4];
+
+    /* Configure the command */
+    cmd[0] = READ_CMD;
+    cmd[1] = (uint8_t)(read_addr >> 16);
+    cmd[2] = (uint8_t)(read_addr >> 8);
+    cmd[3] = (uint8_t)(read_addr);
+
+    w25qx_enable();
+    /* Send the read command, the data follows in the background */
+    if ((HAL_SPI_Transmit(&W25Q_SPI, cmd, 4, W25Qx_TIMEOUT_VALUE) != HAL_OK)
+        || (HAL_SPI_Receive_DMA(&W25Q_SPI, data, size) != HAL_OK)) {
+        w25qx_disable();
+        return W25Qx_ERROR;
+    }
+
+    return W25Qx_OK;
+}
+
+/*!
+ * @brief  Wait for the end of w25qx_read_start()
+ */
+uint8_t w25qx_read_wait(void) {
+    uint32_t tickstart = HAL_GetTick();
+
+    while (HAL_SPI_GetState(&W25Q_SPI) != HAL_SPI_STATE_READY) {
+        if ((HAL_GetTick() - tickstart) > W25Qx_TIMEOUT_VALUE) {
+            HAL_SPI_Abort(&W25Q_SPI);
+            w25qx_disable();
+            return W25Qx_TIMEOUT;
+        }
+    }
+    w25qx_disable();
+
+    return (W25Q_SPI.ErrorCode == HAL_SPI_ERROR_NONE) ? W25Qx_OK : W25Qx_ERROR;
+}
+
+/*!
+ * @brief  Release the DMA channels before jumping to the application
+ */
+void w25qx_deinit(void) {
+    HAL_NVIC_DisableIRQ(W25Q_DMA_RX_IRQ);
+    HAL_NVIC_DisableIRQ(W25Q_DMA_TX_IRQ);
+    HAL_DMA_DeInit(&hdma_w25q_rx);
+    HAL_DMA_DeInit(&hdma_w25q_tx);
+}
+
+/*!
+ * @brief  Handle the SPI RX DMA interrupt
+ */
+void w25qx_dma_rx_irq_handler(void) {
+    HAL_DMA_IRQHandler(&hdma_w25q_rx);
+}
+
+/*!
+ * @brief  Handle the SPI TX DMA interrupt
+ */
+void w25qx_dma_tx_irq_handler(void) {
+    HAL_DMA_IRQHandler(&hdma_w25q_tx);
+}
+
 /*!
  * @brief  Write data to W25Qx flash memory
  */
@@ -253,6 +362,34 @@ uint8_t w25qx_erase_block(uint32_t address) {
     return W25Qx_OK;
 }
 
+/*!
+ * @brief  Erase one 64 KB block of W25Qx flash
+ */
+uint8_t w25qx_erase_block_64k(uint32_t address) {
+    uint8_t cmd[4];
+    uint32_t tickstart = HAL_GetTick();
+    cmd[0] = BLOCK_ERASE_64K_CMD;
+    cmd[1] = (uint8_t)(address >> 16);
+    cmd[2] = (uint8_t)(address >> 8);
+    cmd[3] = (uint8_t)(address);
+
+    /* Enable write operations */
+    w25qx_write_enable();
+
+    w25qx_enable();
+    HAL_SPI_Transmit(&W25Q_SPI, cmd, 4, W25Qx_TIMEOUT_VALUE);
+    w25qx_disable();
+
+    /* Wait the end of Flash writing */
+    while(w25qx_get_status() == W25Qx_BUSY) {
+        /* Check for the Timeout */
+        if((HAL_GetTick() - tickstart) > W25Q128FV_SECTOR_ERASE_MAX_TIME) {
+            return W25Qx_TIMEOUT;
+        }
+    }
+    return W25Qx_OK;
+}
+
 /*!
  * @brief  Erase entire W25Qx flash memory chip
  */
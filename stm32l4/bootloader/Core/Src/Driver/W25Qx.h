@@ -78,6 +78,7 @@ extern "C" {
 
 /* Erase Operations */
 #define SECTOR_ERASE_CMD                     0x20
+#define BLOCK_ERASE_64K_CMD                  0xD8
 #define CHIP_ERASE_CMD                       0xC7
 
 #define PROG_ERASE_RESUME_CMD                0x7A
@@ -149,6 +150,22 @@ void w25qx_read_id(uint8_t *id);
  */
 uint8_t w25qx_read(uint8_t *data, uint32_t read_addr, uint32_t size);
 
+/*!
+ * @brief  Start reading data from W25Qx flash memory with DMA
+ * @param  data: Pointer to buffer to store data, untouched until w25qx_read_wait()
+ * @param  read_addr: Start address to read from
+ * @param  size: Number of bytes to read, up to 65535
+ * @retval uint8_t: Status (0 = OK, other = Error)
+ */
+uint8_t w25qx_read_start(uint8_t *data, uint32_t read_addr, uint32_t size);
+
+/*!
+ * @brief  Wait for the end of w25qx_read_start()
+ * @param  None
+ * @retval uint8_t: Status (0 = OK, other = Error)
+ */
+uint8_t w25qx_read_wait(void);
+
 /*!
  * @brief  Write data to W25Qx flash memory
  * @param  data: Pointer to data buffer
@@ -165,6 +182,13 @@ uint8_t w25qx_write(uint8_t *data, uint32_t write_addr, uint32_t size);
  */
 uint8_t w25qx_erase_block(uint32_t address);
 
+/*!
+ * @brief  Erase one 64 KB block of W25Qx flash, faster than its 16 sectors
+ * @param  address: Any address inside the block to erase
+ * @retval uint8_t: Status (0 = OK, other = Error)
+ */
+uint8_t w25qx_erase_block_64k(uint32_t address);
+
 /*!
  * @brief  Erase entire W25Qx flash memory chip
  * @param  None
@@ -179,6 +203,27 @@ uint8_t w25qx_erase_chip(void);
  */
 void w25qx_read_status_register1(uint8_t *sr1);
 
+/*!
+ * @brief  Release the DMA channels before jumping to the application
+ * @param  None
+ * @retval None
+ */
+void w25qx_deinit(void);
+
+/*!
+ * @brief  Handle the SPI RX DMA interrupt
+ * @param  None
+ * @retval None
+ */
+void w25qx_dma_rx_irq_handler(void);
+
+/*!
+ * @brief  Handle the SPI TX DMA interrupt
+ * @param  None
+ * @retval None
+ */
+void w25qx_dma_tx_irq_handler(void);
+
 /******************************************************************************/
 
 #ifdef __cplusplus
@@ -22,6 +22,7 @@
 #include "stm32l4xx_it.h"
 /* Private includes ----------------------------------------------------------*/
 /* USER CODE BEGIN Includes */
+#include "W25Qx.h"
 /* USER CODE END Includes */
 
 /* Private typedef -----------------------------------------------------------*/
@@ -214,4 +215,20 @@ void USART2_IRQHandler(void)
 
 /* USER CODE BEGIN 1 */
 
+/**
+  * @brief This function handles DMA1 channel4 global interrupt (W25Q SPI RX).
+  */
+void DMA1_Channel4_IRQHandler(void)
+{
+  w25qx_dma_rx_irq_handler();
+}
+
+/**
+  * @brief This function handles DMA1 channel5 global interrupt (W25Q SPI TX).
+  */
+void DMA1_Channel5_IRQHandler(void)
+{
+  w25qx_dma_tx_irq_handler();
+}
+
 /* USER CODE END 1 */
@@ -0,0 +1,84 @@
+/*
+ *  boot_mailbox.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef _BOOT_MAILBOX_H_
+#define _BOOT_MAILBOX_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************************************************************/
+
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+
+#include <stdint.h>
+
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+
+/*
+ * Boot mailbox between the bootloader and the application, in the RTC backup
+ * registers 28 to 31: kept by a reset, lost with the power. This header is
+ * shared by both builds, each has its boot_mailbox.c: the bootloader checks
+ * with its CRC unit (App/boot_mailbox.c), the application with the CRC table
+ * (system/boot_mailbox.c).
+ * The bootloader leaves the reboot cause of the running image (ETX_NORMAL_BOOT,
+ * or ETX_OTA_DONE_BOOT while on trial) and its own boot time. The application
+ * changes the cause to confirm an image, request an OTA or a rollback.
+ */
+#define BOOT_MAILBOX_MAGIC     (0x4D425354)    /* "TSBM" */
+#define BOOT_MAILBOX_FIRST_REG (28U)           /* RTC_BKP_DR28 */
+
+typedef struct {
+    uint32_t magic;
+    uint32_t reboot_cause;          /* ETX_xxx */
+    uint32_t boot_ms;               /* Bootloader time from its start to the jump */
+    uint32_t check;                 /* CRC-32/MPEG-2 of the fields above */
+} boot_mailbox_t;
+
+#define BOOT_MAILBOX_WORDS     (sizeof(boot_mailbox_t) / sizeof(uint32_t))
+
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+/*                                FUNCTIONS                                   */
+/******************************************************************************/
+
+/*!
+ * @brief  Read the boot mailbox
+ * @param  mailbox: Output mailbox
+ * @retval 0 if valid, -1 after a power loss
+ */
+int boot_mailbox_read(boot_mailbox_t *mailbox);
+
+/*!
+ * @brief  Write the boot mailbox
+ * @param  mailbox: Mailbox to write, magic and check are set
+ * @retval None
+ */
+void boot_mailbox_write(boot_mailbox_t *mailbox);
+
+/******************************************************************************/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _BOOT_MAILBOX_H_ */
@@ -0,0 +1,49 @@
+/*
+ *  FreeRTOS.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef _HOST_FREERTOS_H_
+#define _HOST_FREERTOS_H_
+
+/******************************************************************************/
+
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+
+#include <assert.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+
+/* Same heap size as Core/Inc/FreeRTOSConfig.h */
+#define configTOTAL_HEAP_SIZE          ((size_t) (160 * 1024))
+#define configUSE_MALLOC_FAILED_HOOK   0
+#define configASSERT(x)                assert(x)
+
+#define traceMALLOC(pvAddress, uiSize)
+#define traceFREE(pvAddress, uiSize)
+
+typedef long BaseType_t;
+typedef unsigned long UBaseType_t;
+typedef uint32_t TickType_t;
+
+#define pdFALSE                        ((BaseType_t) 0)
+#define pdTRUE                         ((BaseType_t) 1)
+
+/******************************************************************************/
+/*                                FUNCTIONS                                   */
+/******************************************************************************/
+
+/* portable.h, implemented by system/mem_heap.c */
+void *pvPortMalloc(size_t xWantedSize);
+void vPortFree(void *pv);
+
+/******************************************************************************/
+
+#endif /* _HOST_FREERTOS_H_ */
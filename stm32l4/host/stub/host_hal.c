@@ -0,0 +1,113 @@
+/*
+ *  host_hal.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "main.h"
+
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+
+uint8_t host_sram2[HOST_SRAM2_SIZE] __attribute__((aligned(8)));
+uint16_t host_fmc_bank1[2];
+DMA_Channel_TypeDef host_dma2_channel1;
+USART_TypeDef host_usart1;
+USART_TypeDef host_usart2;
+CoreDebug_Type host_core_debug;
+uint32_t SystemCoreClock = 80000000;
+
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+
+static int tick_frozen;
+static uint32_t tick_frozen_ms;
+static __thread DWT_Type dwt;    /* Per thread, the interrupt and the tasks read it concurrently */
+
+/******************************************************************************/
+/*                                FUNCTIONS                                   */
+/******************************************************************************/
+
+/*!
+ * @brief  Milliseconds since the first call (CLOCK_MONOTONIC)
+ */
+uint32_t HAL_GetTick(void) {
+    static uint64_t start_ms;
+    struct timespec now;
+
+    if (tick_frozen) {
+        return tick_frozen_ms;
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    uint64_t ms = (uint64_t) now.tv_sec * 1000 + now.tv_nsec / 1000000;
+    if (start_ms == 0) {
+        start_ms = ms;
+    }
+    return (uint32_t) (ms - start_ms);
+}
+
+/*!
+ * @brief  Stop the tick at its current value, it then only moves with host_tick_advance()
+ */
+void host_tick_freeze(void) {
+    tick_frozen_ms = HAL_GetTick();
+    tick_frozen = 1;
+}
+
+/*!
+ * @brief  Move the frozen tick forward
+ */
+void host_tick_advance(uint32_t ms) {
+    tick_frozen_ms += ms;
+}
+
+/*!
+ * @brief  Cycle counter of the calling thread, CYCCNT updated to the current time
+ */
+DWT_Type *host_dwt(void) {
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    dwt.CYCCNT = (uint32_t) (((uint64_t) now.tv_sec * 1000000000u + now.tv_nsec) * (SystemCoreClock / 1000000) / 1000);
+    return &dwt;
+}
+
+/*!
+ * @brief  Sleep on the host
+ */
+void HAL_Delay(uint32_t Delay) {
+    struct timespec ts = { .tv_sec = Delay / 1000, .tv_nsec = (long) (Delay % 1000) * 1000000 };
+    nanosleep(&ts, NULL);
+}
+
+void HAL_NVIC_SetPriority(IRQn_Type IRQn, uint32_t PreemptPriority, uint32_t SubPriority) {
+    (void) IRQn;
+    (void) PreemptPriority;
+    (void) SubPriority;
+}
+
+void HAL_NVIC_EnableIRQ(IRQn_Type IRQn) {
+    (void) IRQn;
+}
+
+void HAL_NVIC_DisableIRQ(IRQn_Type IRQn) {
+    (void) IRQn;
+}
+
+/*!
+ * @brief  Abort the host program
+ */
+void Error_Handler(void) {
+    fprintf(stderr, "Error_Handler\n");
+    abort();
+}
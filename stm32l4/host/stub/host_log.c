@@ -0,0 +1,56 @@
+/*
+ *  host_log.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+
+#include "main.h"
+#include "log.h"
+
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+
+static int log_muted;
+
+/******************************************************************************/
+/*                                FUNCTIONS                                   */
+/******************************************************************************/
+
+/*!
+ * @brief  Log output of the host programs goes to stderr
+ */
+void log_printf(const char *format, ...) {
+    va_list args;
+
+    if (log_muted) {
+        return;
+    }
+    va_start(args, format);
+    vfprintf(stderr, format, args);
+    va_end(args);
+}
+
+/*!
+ * @brief  Dump bytes in hexadecimal
+ */
+void log_printf_hex(uint8_t *buffs, int length) {
+    if (log_muted) {
+        return;
+    }
+    for (int i = 0; i < length; i++) {
+        fprintf(stderr, "%02X ", buffs[i]);
+    }
+    fprintf(stderr, "\r\n");
+}
+
+/*!
+ * @brief  Drop the log output, for runs expected to log every error
+ */
+void host_log_mute(int mute) {
+    log_muted = mute;
+}
@@ -0,0 +1,307 @@
+/*
+ *  host_rtos.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "FreeRTOS.h"
+#include "task.h"
+#include "cmsis_os2.h"
+#include "stm32l4xx_hal.h"
+
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+
+static pthread_mutex_t scheduler_lock = PTHREAD_RECURSIVE_MUTEX_INITIALIZER_NP;
+
+/******************************************************************************/
+/*                                FUNCTIONS                                   */
+/******************************************************************************/
+
+/*!
+ * @brief  Scheduler lock, a recursive mutex on the host
+ */
+void vTaskSuspendAll(void) {
+    pthread_mutex_lock(&scheduler_lock);
+}
+
+/*!
+ * @brief  Scheduler unlock
+ */
+BaseType_t xTaskResumeAll(void) {
+    pthread_mutex_unlock(&scheduler_lock);
+    return pdFALSE;
+}
+
+osStatus_t osDelay(uint32_t ticks) {
+    HAL_Delay(ticks);
+    return osOK;
+}
+
+uint32_t osKernelGetTickCount(void) {
+    return HAL_GetTick();
+}
+
+/*!
+ * @brief  Threads are pthreads, each with its flags under a mutex
+ */
+typedef struct {
+    pthread_t thread;
+    pthread_mutex_t lock;
+    pthread_cond_t changed;
+    uint32_t flags;
+    osThreadFunc_t func;
+    void *argument;
+} host_thread_t;
+
+static __thread host_thread_t *current_thread;
+static atomic_uint thread_flags_sets;
+
+/* Deadline of a wait of timeout ms, CLOCK_REALTIME for pthread_cond_timedwait() */
+static struct timespec host_deadline(uint32_t timeout) {
+    struct timespec deadline;
+
+    clock_gettime(CLOCK_REALTIME, &deadline);
+    deadline.tv_sec += timeout / 1000;
+    deadline.tv_nsec += (long) (timeout % 1000) * 1000000;
+    if (deadline.tv_nsec >= 1000000000) {
+        deadline.tv_sec++;
+        deadline.tv_nsec -= 1000000000;
+    }
+    return deadline;
+}
+
+static void *host_thread_start(void *arg) {
+    host_thread_t *thread = arg;
+
+    current_thread = thread;
+    thread->func(thread->argument);
+    return NULL;
+}
+
+static host_thread_t *host_thread_alloc(void) {
+    host_thread_t *thread = calloc(1, sizeof(*thread));
+
+    if (thread != NULL) {
+        pthread_mutex_init(&thread->lock, NULL);
+        pthread_cond_init(&thread->changed, NULL);
+    }
+    return thread;
+}
+
+osThreadId_t osThreadNew(osThreadFunc_t func, void *argument, const osThreadAttr_t *attr) {
+    host_thread_t *thread = host_thread_alloc();
+    (void) attr;
+
+    if (thread == NULL) {
+        return NULL;
+    }
+    thread->func = func;
+    thread->argument = argument;
+    if (pthread_create(&thread->thread, NULL, host_thread_start, thread) != 0) {
+        free(thread);
+        return NULL;
+    }
+    pthread_detach(thread->thread);
+    return thread;
+}
+
+/*!
+ * @brief  Threads not created by osThreadNew() (main) get their flags on the first call
+ */
+osThreadId_t osThreadGetId(void) {
+    if (current_thread == NULL) {
+        current_thread = host_thread_alloc();
+    }
+    return current_thread;
+}
+
+/*!
+ * @brief  Counted per call, threads not created by osThreadNew() (NULL) only count
+ */
+uint32_t osThreadFlagsSet(osThreadId_t thread_id, uint32_t flags) {
+    host_thread_t *thread = thread_id;
+    uint32_t result = flags;
+
+    atomic_fetch_add_explicit(&thread_flags_sets, 1, memory_order_relaxed);
+    if (thread != NULL) {
+        pthread_mutex_lock(&thread->lock);
+        thread->flags |= flags;
+        result = thread->flags;
+        pthread_cond_broadcast(&thread->changed);
+        pthread_mutex_unlock(&thread->lock);
+    }
+    return result;
+}
+
+uint32_t osThreadFlagsWait(uint32_t flags, uint32_t options, uint32_t timeout) {
+    host_thread_t *thread = current_thread;
+    struct timespec deadline = host_deadline(timeout);
+    uint32_t result;
+
+    if (thread == NULL) {
+        return osFlagsErrorUnknown;
+    }
+
+    pthread_mutex_lock(&thread->lock);
+    for (;;) {
+        uint32_t match = thread->flags & flags;
+        if ((options & osFlagsWaitAll) ? (match == flags) : (match != 0)) {
+            break;
+        }
+        if (timeout == 0) {
+            pthread_mutex_unlock(&thread->lock);
+            return osFlagsErrorResource;
+        }
+        int ret = (timeout == osWaitForever) ? pthread_cond_wait(&thread->changed, &thread->lock)
+                                             : pthread_cond_timedwait(&thread->changed, &thread->lock, &deadline);
+        if (ret != 0) {
+            pthread_mutex_unlock(&thread->lock);
+            return osFlagsErrorTimeout;
+        }
+    }
+    result = thread->flags;
+    if ((options & osFlagsNoClear) == 0) {
+        thread->flags &= ~flags;
+    }
+    pthread_mutex_unlock(&thread->lock);
+    return result;
+}
+
+/*!
+ * @brief  Message queue: fixed size messages in a ring under a mutex
+ */
+typedef struct {
+    pthread_mutex_t lock;
+    pthread_cond_t changed;
+    uint32_t msg_count;
+    uint32_t msg_size;
+    uint32_t head;
+    uint32_t count;
+    uint8_t data[];
+} host_queue_t;
+
+osMessageQueueId_t osMessageQueueNew(uint32_t msg_count, uint32_t msg_size, const osMessageQueueAttr_t *attr) {
+    host_queue_t *queue = calloc(1, sizeof(*queue) + (size_t) msg_count * msg_size);
+    (void) attr;
+
+    if (queue == NULL) {
+        return NULL;
+    }
+    pthread_mutex_init(&queue->lock, NULL);
+    pthread_cond_init(&queue->changed, NULL);
+    queue->msg_count = msg_count;
+    queue->msg_size = msg_size;
+    return queue;
+}
+
+/* Wait for a change of the queue, osOK or the error of the timeout */
+static osStatus_t host_queue_wait(host_queue_t *queue, uint32_t timeout, const struct timespec *deadline) {
+    if (timeout == 0) {
+        return osErrorResource;
+    }
+    if (timeout == osWaitForever) {
+        pthread_cond_wait(&queue->changed, &queue->lock);
+        return osOK;
+    }
+    return (pthread_cond_timedwait(&queue->changed, &queue->lock, deadline) == 0) ? osOK : osErrorTimeout;
+}
+
+osStatus_t osMessageQueuePut(osMessageQueueId_t mq_id, const void *msg_ptr, uint8_t msg_prio, uint32_t timeout) {
+    host_queue_t *queue = mq_id;
+    struct timespec deadline = host_deadline(timeout);
+    osStatus_t status = osOK;
+    (void) msg_prio;
+
+    pthread_mutex_lock(&queue->lock);
+    while ((queue->count == queue->msg_count) && (status == osOK)) {
+        status = host_queue_wait(queue, timeout, &deadline);
+    }
+    if (queue->count < queue->msg_count) {
+        uint32_t slot = (queue->head + queue->count) % queue->msg_count;
+        memcpy(&queue->data[slot * queue->msg_size], msg_ptr, queue->msg_size);
+        queue->count++;
+        pthread_cond_broadcast(&queue->changed);
+        status = osOK;
+    }
+    pthread_mutex_unlock(&queue->lock);
+    return status;
+}
+
+osStatus_t osMessageQueueGet(osMessageQueueId_t mq_id, void *msg_ptr, uint8_t *msg_prio, uint32_t timeout) {
+    host_queue_t *queue = mq_id;
+    struct timespec deadline = host_deadline(timeout);
+    osStatus_t status = osOK;
+
+    pthread_mutex_lock(&queue->lock);
+    while ((queue->count == 0) && (status == osOK)) {
+        status = host_queue_wait(queue, timeout, &deadline);
+    }
+    if (queue->count > 0) {
+        memcpy(msg_ptr, &queue->data[queue->head * queue->msg_size], queue->msg_size);
+        queue->head = (queue->head + 1) % queue->msg_count;
+        queue->count--;
+        pthread_cond_broadcast(&queue->changed);
+        status = osOK;
+        if (msg_prio != NULL) {
+            *msg_prio = 0;
+        }
+    }
+    pthread_mutex_unlock(&queue->lock);
+    return status;
+}
+
+/*!
+ * @brief  Mutex: a pthread mutex, recursive with osMutexRecursive
+ */
+osMutexId_t osMutexNew(const osMutexAttr_t *attr) {
+    pthread_mutex_t *mutex = calloc(1, sizeof(*mutex));
+    pthread_mutexattr_t mutex_attr;
+
+    if (mutex == NULL) {
+        return NULL;
+    }
+    pthread_mutexattr_init(&mutex_attr);
+    if ((attr != NULL) && (attr->attr_bits & osMutexRecursive)) {
+        pthread_mutexattr_settype(&mutex_attr, PTHREAD_MUTEX_RECURSIVE);
+    }
+    pthread_mutex_init(mutex, &mutex_attr);
+    pthread_mutexattr_destroy(&mutex_attr);
+    return mutex;
+}
+
+osStatus_t osMutexAcquire(osMutexId_t mutex_id, uint32_t timeout) {
+    struct timespec deadline = host_deadline(timeout);
+
+    if (mutex_id == NULL) {
+        return osErrorParameter;
+    }
+    if (timeout == osWaitForever) {
+        return (pthread_mutex_lock(mutex_id) == 0) ? osOK : osErrorResource;
+    }
+    if (timeout == 0) {
+        return (pthread_mutex_trylock(mutex_id) == 0) ? osOK : osErrorResource;
+    }
+    return (pthread_mutex_timedlock(mutex_id, &deadline) == 0) ? osOK : osErrorTimeout;
+}
+
+osStatus_t osMutexRelease(osMutexId_t mutex_id) {
+    if (mutex_id == NULL) {
+        return osErrorParameter;
+    }
+    return (pthread_mutex_unlock(mutex_id) == 0) ? osOK : osErrorResource;
+}
+
+uint32_t host_thread_flags_sets(void) {
+    return atomic_load_explicit(&thread_flags_sets, memory_order_relaxed);
+}
@@ -0,0 +1,46 @@
+/*
+ *  main.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef __MAIN_H
+#define __MAIN_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************************************************************/
+
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+
+#include "stm32l4xx_hal.h"
+
+/******************************************************************************/
+/*                                FUNCTIONS                                   */
+/******************************************************************************/
+
+/*!
+ * @brief  Abort the host program
+ * @param  None
+ * @retval None
+ */
+void Error_Handler(void);
+
+/*!
+ * @brief  Drop the log output, for runs expected to log every error
+ * @param  mute: 1 to drop, 0 to print again
+ * @retval None
+ */
+void host_log_mute(int mute);
+
+/******************************************************************************/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __MAIN_H */
@@ -0,0 +1,339 @@
+/*
+ *  stm32l4xx_hal.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef _HOST_STM32L4XX_HAL_H_
+#define _HOST_STM32L4XX_HAL_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************************************************************/
+
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+
+#include <stddef.h>
+#include <stdint.h>
+
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+
+/*
+ * Host build of the application modules: only the HAL types, constants and
+ * functions they use. Peripherals are modelled by the tests (see test/lcd_model.c).
+ * Addresses are passed as uint32_t like on the target, the host programs are
+ * linked without PIE so static buffers stay below 4 GB.
+ */
+
+#define __IO                          volatile
+
+typedef enum {
+    HAL_OK = 0x00,
+    HAL_ERROR = 0x01,
+    HAL_BUSY = 0x02,
+    HAL_TIMEOUT = 0x03,
+} HAL_StatusTypeDef;
+
+typedef int IRQn_Type;
+
+/* SRAM2 holds the LCD draw buffers, backed by a host array */
+#define HOST_SRAM2_SIZE               (0x10000)
+extern uint8_t host_sram2[HOST_SRAM2_SIZE];
+#define SRAM2_BASE                    ((uintptr_t) host_sram2)
+
+/* FMC bank 1 (LCD register and RAM) for builds without the panel model */
+extern uint16_t host_fmc_bank1[2];
+
+/* DMA */
+typedef struct {
+    uint32_t id;
+} DMA_Channel_TypeDef;
+
+extern DMA_Channel_TypeDef host_dma2_channel1;
+#define DMA2_Channel1                 (&host_dma2_channel1)
+#define DMA2_Channel1_IRQn            ((IRQn_Type) 56)
+
+typedef struct {
+    uint32_t Request;
+    uint32_t Direction;
+    uint32_t PeriphInc;
+    uint32_t MemInc;
+    uint32_t PeriphDataAlignment;
+    uint32_t MemDataAlignment;
+    uint32_t Mode;
+    uint32_t Priority;
+} DMA_InitTypeDef;
+
+typedef enum {
+    HAL_DMA_STATE_RESET = 0x00,
+    HAL_DMA_STATE_READY = 0x01,
+    HAL_DMA_STATE_BUSY = 0x02,
+} HAL_DMA_StateTypeDef;
+
+typedef enum {
+    HAL_DMA_XFER_CPLT_CB_ID = 0x00,
+    HAL_DMA_XFER_HALFCPLT_CB_ID = 0x01,
+    HAL_DMA_XFER_ERROR_CB_ID = 0x02,
+    HAL_DMA_XFER_ABORT_CB_ID = 0x03,
+    HAL_DMA_XFER_ALL_CB_ID = 0x04,
+} HAL_DMA_CallbackIDTypeDef;
+
+typedef struct __DMA_HandleTypeDef {
+    DMA_Channel_TypeDef *Instance;
+    DMA_InitTypeDef Init;
+    volatile HAL_DMA_StateTypeDef State;
+    void (*XferCpltCallback)(struct __DMA_HandleTypeDef *hdma);
+    void (*XferHalfCpltCallback)(struct __DMA_HandleTypeDef *hdma);
+    void (*XferErrorCallback)(struct __DMA_HandleTypeDef *hdma);
+    void (*XferAbortCallback)(struct __DMA_HandleTypeDef *hdma);
+} DMA_HandleTypeDef;
+
+#define DMA_REQUEST_0                 (0x00000000U)
+#define DMA_PERIPH_TO_MEMORY          (0x00000000U)
+#define DMA_MEMORY_TO_PERIPH          (0x00000010U)
+#define DMA_MEMORY_TO_MEMORY          (0x00004000U)
+#define DMA_PINC_ENABLE               (0x00000040U)
+#define DMA_PINC_DISABLE              (0x00000000U)
+#define DMA_MINC_ENABLE               (0x00000080U)
+#define DMA_MINC_DISABLE              (0x00000000U)
+#define DMA_PDATAALIGN_BYTE           (0x00000000U)
+#define DMA_PDATAALIGN_HALFWORD       (0x00000100U)
+#define DMA_MDATAALIGN_BYTE           (0x00000000U)
+#define DMA_MDATAALIGN_HALFWORD       (0x00000400U)
+#define DMA_NORMAL                    (0x00000000U)
+#define DMA_CIRCULAR                  (0x00000020U)
+#define DMA_PRIORITY_LOW              (0x00000000U)
+#define DMA_PRIORITY_HIGH             (0x00002000U)
+
+#define __HAL_RCC_DMA1_CLK_ENABLE()   do { } while (0)
+#define __HAL_RCC_DMA2_CLK_ENABLE()   do { } while (0)
+
+/* UART */
+typedef struct {
+    uint32_t id;
+} USART_TypeDef;
+
+extern USART_TypeDef host_usart1;
+extern USART_TypeDef host_usart2;
+#define USART1                        (&host_usart1)
+#define USART2                        (&host_usart2)
+
+typedef struct __UART_HandleTypeDef {
+    USART_TypeDef *Instance;
+} UART_HandleTypeDef;
+
+/* Cycle counter: CYCCNT follows CLOCK_MONOTONIC at SystemCoreClock, read through host_dwt() */
+typedef struct {
+    volatile uint32_t CTRL;
+    volatile uint32_t CYCCNT;
+} DWT_Type;
+
+typedef struct {
+    volatile uint32_t DEMCR;
+} CoreDebug_Type;
+
+extern CoreDebug_Type host_core_debug;
+#define DWT                           (host_dwt())
+#define CoreDebug                     (&host_core_debug)
+#define DWT_CTRL_CYCCNTENA_Msk        (1UL << 0)
+#define CoreDebug_DEMCR_TRCENA_Msk    (1UL << 24)
+
+/* SysTick, only cleared before a jump */
+typedef struct {
+    volatile uint32_t CTRL;
+    volatile uint32_t LOAD;
+    volatile uint32_t VAL;
+} SysTick_Type;
+
+extern SysTick_Type host_systick;
+#define SysTick                       (&host_systick)
+
+#define SET_BIT(REG, BIT)             ((REG) |= (BIT))
+#define CLEAR_BIT(REG, BIT)           ((REG) &= ~(BIT))
+#define READ_BIT(REG, BIT)            ((REG) & (BIT))
+
+/* Internal flash (bootloader builds): mapped at its target address by the
+ * test that models it (test/boot_model.c), 2 banks of 256 pages */
+#define __RAM_FUNC
+
+#define FLASH_BASE                    (0x08000000UL)
+#define FLASH_BANK_SIZE               (0x80000UL)
+#define FLASH_PAGE_SIZE               (0x800UL)
+#define FLASH_BANK_1                  (0x01U)
+#define FLASH_BANK_2                  (0x02U)
+#define FLASH_TYPEERASE_PAGES         (0x00U)
+#define FLASH_TYPEERASE_MASSERASE     (0x01U)
+#define FLASH_TYPEPROGRAM_DOUBLEWORD  (0x00U)
+#define FLASH_TIMEOUT_VALUE           (50000U)
+
+typedef struct {
+    volatile uint32_t ACR;
+    volatile uint32_t CR;
+    volatile uint32_t SR;
+} FLASH_TypeDef;
+
+extern FLASH_TypeDef host_flash_regs;
+#define FLASH                         (&host_flash_regs)
+#define FLASH_ACR_DCEN                (1UL << 10)
+#define FLASH_CR_FSTPG                (1UL << 18)
+#define FLASH_SR_BSY                  (1UL << 16)
+
+#define FLASH_FLAG_EOP                (1UL << 0)
+#define FLASH_FLAG_OPERR              (1UL << 1)
+#define FLASH_FLAG_PROGERR            (1UL << 3)
+#define FLASH_FLAG_WRPERR             (1UL << 4)
+#define FLASH_FLAG_PGAERR             (1UL << 5)
+#define FLASH_FLAG_PGSERR             (1UL << 7)
+#define FLASH_FLAG_ALL_ERRORS         (FLASH_FLAG_OPERR | FLASH_FLAG_PROGERR | FLASH_FLAG_WRPERR | FLASH_FLAG_PGAERR \
+                                       | FLASH_FLAG_PGSERR)
+
+#define __HAL_FLASH_CLEAR_FLAG(FLAG)       do { (void) (FLAG); } while (0)
+#define __HAL_FLASH_DATA_CACHE_DISABLE()   do { } while (0)
+#define __HAL_FLASH_DATA_CACHE_RESET()     do { } while (0)
+#define __HAL_FLASH_DATA_CACHE_ENABLE()    do { } while (0)
+
+typedef struct {
+    uint32_t TypeErase;
+    uint32_t Banks;
+    uint32_t Page;
+    uint32_t NbPages;
+} FLASH_EraseInitTypeDef;
+
+/* CRC unit: CRC-32/MPEG-2 over bytes, the bootloader configuration */
+typedef struct {
+    uint32_t id;
+} CRC_HandleTypeDef;
+
+/* RTC backup registers, kept by a reset */
+typedef struct {
+    uint32_t id;
+} RTC_HandleTypeDef;
+
+/* Timers of the LED PWM, only declared by power_manager.h */
+typedef struct {
+    uint32_t id;
+} TIM_HandleTypeDef;
+
+#define RTC_BKP_DR28                  (28U)
+#define RTC_BKP_DR29                  (29U)
+#define RTC_BKP_DR30                  (30U)
+#define RTC_BKP_DR31                  (31U)
+
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+
+
+
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+
+extern uint32_t SystemCoreClock;
+
+/******************************************************************************/
+/*                                FUNCTIONS                                   */
+/******************************************************************************/
+
+/*!
+ * @brief  Cycle counter of the calling thread, CYCCNT updated to the current time
+ * @param  None
+ * @retval DWT registers
+ */
+DWT_Type *host_dwt(void);
+
+/*!
+ * @brief  Milliseconds since the first call (CLOCK_MONOTONIC), see host_tick_freeze()
+ * @param  None
+ * @retval Tick in ms
+ */
+uint32_t HAL_GetTick(void);
+
+/*!
+ * @brief  Stop the tick at its current value, it then only moves with host_tick_advance()
+ *         (deterministic LVGL timers and animations)
+ * @param  None
+ * @retval None
+ */
+void host_tick_freeze(void);
+
+/*!
+ * @brief  Move the frozen tick forward
+ * @param  ms: Milliseconds
+ * @retval None
+ */
+void host_tick_advance(uint32_t ms);
+
+/*!
+ * @brief  Sleep on the host
+ * @param  Delay: Time in ms
+ * @retval None
+ */
+void HAL_Delay(uint32_t Delay);
+
+void HAL_NVIC_SetPriority(IRQn_Type IRQn, uint32_t PreemptPriority, uint32_t SubPriority);
+void HAL_NVIC_EnableIRQ(IRQn_Type IRQn);
+void HAL_NVIC_DisableIRQ(IRQn_Type IRQn);
+
+/* Implemented by the test that models the DMA user */
+HAL_StatusTypeDef HAL_DMA_Init(DMA_HandleTypeDef *hdma);
+HAL_StatusTypeDef HAL_DMA_RegisterCallback(DMA_HandleTypeDef *hdma, HAL_DMA_CallbackIDTypeDef CallbackID,
+                                           void (*pCallback)(DMA_HandleTypeDef *_hdma));
+HAL_StatusTypeDef HAL_DMA_Start_IT(DMA_HandleTypeDef *hdma, uint32_t SrcAddress, uint32_t DstAddress, uint32_t DataLength);
+void HAL_DMA_IRQHandler(DMA_HandleTypeDef *hdma);
+
+/* Implemented by the test that models the UART */
+HAL_StatusTypeDef HAL_UART_Transmit(UART_HandleTypeDef *huart, uint8_t *pData, uint16_t Size, uint32_t Timeout);
+HAL_StatusTypeDef HAL_UART_Receive_IT(UART_HandleTypeDef *huart, uint8_t *pData, uint16_t Size);
+HAL_StatusTypeDef HAL_UARTEx_ReceiveToIdle_DMA(UART_HandleTypeDef *huart, uint8_t *pData, uint16_t Size);
+void HAL_UARTEx_RxEventCallback(UART_HandleTypeDef *huart, uint16_t Size);
+
+/* Core registers, nothing to model on the host */
+static inline void __disable_irq(void) {
+}
+
+static inline uint32_t __get_PRIMASK(void) {
+    return 0;
+}
+
+static inline void __set_PRIMASK(uint32_t priMask) {
+    (void) priMask;
+}
+
+static inline void __set_CONTROL(uint32_t control) {
+    (void) control;
+}
+
+/* Implemented by the test that models the bootloader hardware, where the
+ * tick also comes from (HAL_GetTick above): the application is entered
+ * through __set_MSP() */
+void __set_MSP(uint32_t topOfMainStack);
+void NVIC_SystemReset(void);
+HAL_StatusTypeDef HAL_RCC_DeInit(void);
+HAL_StatusTypeDef HAL_DeInit(void);
+
+HAL_StatusTypeDef HAL_FLASH_Unlock(void);
+HAL_StatusTypeDef HAL_FLASH_Lock(void);
+HAL_StatusTypeDef HAL_FLASH_Program(uint32_t TypeProgram, uint32_t Address, uint64_t Data);
+HAL_StatusTypeDef HAL_FLASHEx_Erase(FLASH_EraseInitTypeDef *pEraseInit, uint32_t *PageError);
+HAL_StatusTypeDef FLASH_WaitForLastOperation(uint32_t Timeout);
+
+uint32_t HAL_CRC_Calculate(CRC_HandleTypeDef *hcrc, uint32_t pBuffer[], uint32_t BufferLength);
+uint32_t HAL_CRC_Accumulate(CRC_HandleTypeDef *hcrc, uint32_t pBuffer[], uint32_t BufferLength);
+
+uint32_t HAL_RTCEx_BKUPRead(RTC_HandleTypeDef *hrtc, uint32_t BackupRegister);
+void HAL_RTCEx_BKUPWrite(RTC_HandleTypeDef *hrtc, uint32_t BackupRegister, uint32_t Data);
+
+/******************************************************************************/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _HOST_STM32L4XX_HAL_H_ */
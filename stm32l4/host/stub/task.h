@@ -0,0 +1,45 @@
+/*
+ *  task.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef _HOST_TASK_H_
+#define _HOST_TASK_H_
+
+/******************************************************************************/
+
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+
+#include "FreeRTOS.h"
+
+/******************************************************************************/
+/*                                FUNCTIONS                                   */
+/******************************************************************************/
+
+/*!
+ * @brief  Scheduler lock, a recursive mutex on the host
+ * @param  None
+ * @retval None
+ */
+void vTaskSuspendAll(void);
+
+/*!
+ * @brief  Scheduler unlock
+ * @param  None
+ * @retval pdFALSE
+ */
+BaseType_t xTaskResumeAll(void);
+
+/*!
+ * @brief  Number of osThreadFlagsSet() calls, including the ones on threads not created by osThreadNew()
+ * @param  None
+ * @retval Calls since the start
+ */
+uint32_t host_thread_flags_sets(void);
+
+/******************************************************************************/
+
+#endif /* _HOST_TASK_H_ */
@@ -0,0 +1,118 @@
+/*
+ *  bench_ili9341.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+
+#include "main.h"
+#include "ili9341.h"
+#include "test.h"
+
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+
+/*
+ * CPU cost of the pixel writes, ili9341.c is built with its FMC bank on a host
+ * variable: every pixel is still one volatile halfword store.
+ */
+#define AREA_PIXELS        (240 * 32)      /* One part of the draw buffer */
+#define ROUNDS             (2000)
+
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+
+static uint16_t area[AREA_PIXELS + 2] __attribute__((aligned(8)));
+
+/******************************************************************************/
+/*                                FUNCTIONS                                   */
+/******************************************************************************/
+
+/* Not used by the benchmark, ili9341_init() needs them */
+HAL_StatusTypeDef HAL_DMA_Init(DMA_HandleTypeDef *hdma) {
+    (void) hdma;
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_DMA_RegisterCallback(DMA_HandleTypeDef *hdma, HAL_DMA_CallbackIDTypeDef CallbackID,
+                                           void (*pCallback)(DMA_HandleTypeDef *_hdma)) {
+    (void) hdma;
+    (void) CallbackID;
+    (void) pCallback;
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_DMA_Start_IT(DMA_HandleTypeDef *hdma, uint32_t SrcAddress, uint32_t DstAddress, uint32_t DataLength) {
+    (void) hdma;
+    (void) SrcAddress;
+    (void) DstAddress;
+    (void) DataLength;
+    return HAL_OK;
+}
+
+void HAL_DMA_IRQHandler(DMA_HandleTypeDef *hdma) {
+    (void) hdma;
+}
+
+/**
+ * @brief  The flush loop before the bulk API: one call per pixel
+ */
+static void write_per_pixel(const uint16_t *data, uint32_t count) {
+    for (uint32_t i = 0; i < count; i++) {
+        ili9341_write_data(data[i]);
+    }
+}
+
+static double mpixels_per_s(double seconds) {
+    return (double) AREA_PIXELS * ROUNDS / seconds / 1e6;
+}
+
+/******************************************************************************/
+
+int main(void) {
+    double start;
+
+    for (uint32_t i = 0; i < AREA_PIXELS + 2; i++) {
+        area[i] = (uint16_t) i;
+    }
+
+    start = test_now();
+    for (int round = 0; round < ROUNDS; round++) {
+        ili9341_set_window(0, 239, 0, 31);
+        write_per_pixel(area, AREA_PIXELS);
+    }
+    double per_pixel = mpixels_per_s(test_now() - start);
+
+    start = test_now();
+    for (int round = 0; round < ROUNDS; round++) {
+        ili9341_write_area(0, 239, 0, 31, area);
+    }
+    double aligned = mpixels_per_s(test_now() - start);
+
+    start = test_now();
+    for (int round = 0; round < ROUNDS; round++) {
+        ili9341_write_area(0, 239, 0, 31, &area[1]);
+    }
+    double misaligned = mpixels_per_s(test_now() - start);
+
+    start = test_now();
+    for (int round = 0; round < ROUNDS; round++) {
+        ili9341_set_window(0, 239, 0, 31);
+        ili9341_fill_color(0xFFFF, AREA_PIXELS);
+    }
+    double fill = mpixels_per_s(test_now() - start);
+
+    printf("%u px areas, Mpixel/s:\n", AREA_PIXELS);
+    printf("  ili9341_write_data per pixel  %8.1f\n", per_pixel);
+    printf("  ili9341_write_pixels aligned  %8.1f\n", aligned);
+    printf("  ili9341_write_pixels +1 px    %8.1f\n", misaligned);
+    printf("  ili9341_fill_color            %8.1f\n", fill);
+
+    TEST_CHECK(host_fmc_bank1[1] == 0xFFFF);
+    return TEST_RESULT();
+}
@@ -0,0 +1,163 @@
+/*
+ *  bench_ring_buffer.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+
+#include <string.h>
+#include "ring_buffer.h"
+#include "test.h"
+
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+
+/*
+ * UART FIFO of communication.c before ring_buffer.c against the ring: the
+ * DMA callback pushes 256 byte spans (HT/TC of the 512 byte DMA buffer), the
+ * task drains them. Same per byte work on the consumer side, only the FIFO
+ * and the way the task gets at the bytes differ:
+ *   old    uint16_t head/tail/count, % 2304, one pop and one call per byte
+ *   ring   peek_contiguous/commit, one call per contiguous span
+ */
+#define OLD_FIFO_SIZE      (2048 + 256)
+#define SPAN_SIZE          (256)
+#define SPANS_PER_DRAIN    (4)
+#define TOTAL_BYTES        (256u * 1024 * 1024)
+
+typedef struct {
+    uint16_t head;
+    uint16_t tail;
+    uint16_t count;
+    uint8_t data[OLD_FIFO_SIZE];
+} old_fifo_t;
+
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+
+static old_fifo_t old_fifo;
+
+static uint8_t ring_storage[4096];    /* FIFO_SIZE */
+static ring_buffer_t ring;
+
+static uint8_t span[SPAN_SIZE];
+static uint32_t checksum;
+
+/******************************************************************************/
+/*                                FUNCTIONS                                   */
+/******************************************************************************/
+
+/**
+ * @brief  communication_rx_span() before the ring
+ */
+static void old_fifo_write(const uint8_t *data, uint16_t length) {
+    if (length > OLD_FIFO_SIZE - old_fifo.count) {
+        length = OLD_FIFO_SIZE - old_fifo.count;
+    }
+
+    uint16_t first = OLD_FIFO_SIZE - old_fifo.head;
+    if (first > length) {
+        first = length;
+    }
+    memcpy(&old_fifo.data[old_fifo.head], data, first);
+    memcpy(&old_fifo.data[0], &data[first], length - first);
+    old_fifo.head = (old_fifo.head + length) % OLD_FIFO_SIZE;
+    old_fifo.count += length;
+}
+
+/* communication_process(byte) of the old task loop */
+__attribute__((noinline)) static int process_byte(uint8_t byte) {
+    checksum = (checksum << 1 | checksum >> 31) ^ byte;
+    return 0;
+}
+
+/* communication_scan() of the current task loop */
+__attribute__((noinline)) static uint32_t process_span(const uint8_t *data, uint32_t length) {
+    uint32_t sum = checksum;
+    for (uint32_t i = 0; i < length; i++) {
+        sum = (sum << 1 | sum >> 31) ^ data[i];
+    }
+    checksum = sum;
+    return length;
+}
+
+/**
+ * @brief  The old communication_task() loop
+ */
+static void old_fifo_drain(void) {
+    int available = old_fifo.count;
+    for (int i = 0; i < available; i++) {
+        uint8_t byte = old_fifo.data[old_fifo.tail];
+        old_fifo.tail = (old_fifo.tail + 1) % OLD_FIFO_SIZE;
+        old_fifo.count--;
+        process_byte(byte);
+    }
+}
+
+/**
+ * @brief  The current communication_task() loop
+ */
+static void ring_drain(void) {
+    const uint8_t *data;
+    uint32_t available;
+
+    while ((available = ring_buffer_peek_contiguous(&ring, &data)) > 0) {
+        process_span(data, available);
+        ring_buffer_commit(&ring, available);
+    }
+}
+
+static double mbytes_per_s(double seconds) {
+    return (double) TOTAL_BYTES / seconds / 1e6;
+}
+
+/******************************************************************************/
+
+int main(void) {
+    double start, old_s, ring_s;
+    uint32_t old_sum, ring_sum;
+
+    for (uint32_t i = 0; i < SPAN_SIZE; i++) {
+        span[i] = (uint8_t) (i * 7 + 3);
+    }
+
+    memset(&old_fifo, 0, sizeof(old_fifo));
+    checksum = 0;
+    start = test_now();
+    for (uint32_t sent = 0; sent < TOTAL_BYTES; sent += SPAN_SIZE) {
+        old_fifo_write(span, SPAN_SIZE);
+        if ((sent / SPAN_SIZE) % SPANS_PER_DRAIN == SPANS_PER_DRAIN - 1) {
+            old_fifo_drain();
+        }
+    }
+    old_fifo_drain();
+    old_s = test_now() - start;
+    old_sum = checksum;
+
+    ring_buffer_init(&ring, ring_storage, sizeof(ring_storage));
+    checksum = 0;
+    start = test_now();
+    for (uint32_t sent = 0; sent < TOTAL_BYTES; sent += SPAN_SIZE) {
+        ring_buffer_write(&ring, span, SPAN_SIZE);
+        if ((sent / SPAN_SIZE) % SPANS_PER_DRAIN == SPANS_PER_DRAIN - 1) {
+            ring_drain();
+        }
+    }
+    ring_drain();
+    ring_s = test_now() - start;
+    ring_sum = checksum;
+
+    printf("old fifo: %8.1f MB/s\n", mbytes_per_s(old_s));
+    printf("ring:     %8.1f MB/s (x%.1f)\n", mbytes_per_s(ring_s), old_s / ring_s);
+
+    /* Both delivered the same bytes in the same order */
+    TEST_CHECK(old_sum == ring_sum);
+    TEST_CHECK((old_fifo.count == 0) && (ring_buffer_count(&ring) == 0));
+
+    return TEST_RESULT();
+}
@@ -0,0 +1,456 @@
+/*
+ *  boot_model.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+
+#include <setjmp.h>
+#include <string.h>
+#include <sys/mman.h>
+#include "stm32l4xx_hal.h"
+#include "W25Qx.h"
+#include "app_main.h"
+#include "crc.h"
+#include "flash_prog.h"
+#include "boot_model.h"
+
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+
+/* Typical durations in ns: STM32L4 flash at 80 MHz, W25Q128FV on a 40 MHz SPI */
+#define FLASH_PAGE_ERASE_NS     (22020000ULL)
+#define FLASH_MASS_ERASE_NS     (22130000ULL)
+#define FLASH_ROW_NS            (1910000ULL)     /* Fast programming, 32 double words */
+#define FLASH_DOUBLE_WORD_NS    (82000ULL)
+#define W25Q_PAGE_PROGRAM_NS    (700000ULL)
+#define W25Q_SECTOR_ERASE_NS    (45000000ULL)
+#define W25Q_BLOCK_ERASE_NS     (150000000ULL)
+#define W25Q_READ_BYTE_NS       (200ULL)
+#define CRC_WORD_NS             (50ULL)
+
+#define BACKUP_REGISTERS        (32)
+
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+
+static uint8_t *flash;                  /* Mapped at FLASH_BASE */
+static int flash_unlocked;
+static int flash_row_wait;              /* Waits around the fast row being programmed */
+static uint32_t flash_mass_erased;      /* Banks mass erased since the unlock */
+
+/* The flash as the model last left it: the fast row the CPU stored is
+ * found by comparing, from the row after the previous one */
+static uint8_t flash_shadow[BOOT_MODEL_FLASH_SIZE];
+static uint32_t flash_row_next;
+static uint8_t w25q[BOOT_MODEL_W25Q_SIZE];
+static uint32_t backup[BACKUP_REGISTERS];
+static uint32_t crc_state;
+
+/* Read started by w25qx_read_start(), copied when waited for */
+static uint8_t *read_data;
+static uint32_t read_address;
+static uint32_t read_size;
+static uint64_t read_done_ns;
+
+static uint64_t now_ns;
+static uint64_t cut_ns;                 /* 0 for no cut */
+static uint32_t garbage_seed = 1;
+static jmp_buf boot_exit;
+static boot_model_stats_t stats;
+
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+
+SysTick_Type host_systick;
+FLASH_TypeDef host_flash_regs;
+CRC_HandleTypeDef hcrc;
+RTC_HandleTypeDef hrtc;
+
+/******************************************************************************/
+/*                                FUNCTIONS                                   */
+/******************************************************************************/
+
+/**
+ * @brief  Spend time in an operation, 1 if the power is cut before its end
+ */
+static int model_busy(uint64_t ns) {
+    if ((cut_ns != 0) && (now_ns + ns >= cut_ns)) {
+        now_ns = cut_ns;
+        return 1;
+    }
+    now_ns += ns;
+    return 0;
+}
+
+static void model_power_cut(void) {
+    longjmp(boot_exit, BOOT_MODEL_POWER_CUT);
+}
+
+/**
+ * @brief  What an interrupted erase leaves
+ */
+static void model_garbage(uint8_t *data, uint32_t size) {
+    for (uint32_t i = 0; i < size; i++) {
+        garbage_seed = garbage_seed * 1103515245 + 12345;
+        data[i] = (uint8_t) (garbage_seed >> 16);
+    }
+}
+
+/**
+ * @brief  The model changed flash bytes
+ */
+static void model_flash_sync(uint32_t offset, uint32_t size) {
+    memcpy(&flash_shadow[offset], &flash[offset], size);
+}
+
+/**
+ * @brief  Programming only clears bits
+ */
+static void model_program(uint8_t *dest, const uint8_t *data, uint32_t size) {
+    for (uint32_t i = 0; i < size; i++) {
+        dest[i] &= data[i];
+    }
+}
+
+/******************************************************************************/
+
+int boot_model_init(void) {
+    void *map = mmap((void *) FLASH_BASE, BOOT_MODEL_FLASH_SIZE, PROT_READ | PROT_WRITE,
+                     MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE, -1, 0);
+
+    if (map != (void *) FLASH_BASE) {
+        return -1;
+    }
+    flash = map;
+    memset(flash, 0xFF, BOOT_MODEL_FLASH_SIZE);
+    memset(w25q, 0xFF, sizeof(w25q));
+    memset(backup, 0, sizeof(backup));
+    return 0;
+}
+
+uint8_t *boot_model_w25q(void) {
+    return w25q;
+}
+
+void boot_model_power_loss(void) {
+    memset(backup, 0, sizeof(backup));
+}
+
+void boot_model_cut_at(uint64_t time_us) {
+    cut_ns = time_us * 1000;
+}
+
+boot_model_result_t boot_model_boot(boot_model_stats_t *boot_stats) {
+    volatile boot_model_result_t result;
+
+    now_ns = 0;
+    flash_unlocked = 0;
+    flash_row_wait = 0;
+    flash_mass_erased = 0;
+    flash_row_next = 0;
+    model_flash_sync(0, BOOT_MODEL_FLASH_SIZE);     /* The tests write the flash directly */
+    read_data = NULL;
+    memset(&stats, 0, sizeof(stats));
+
+    result = (boot_model_result_t) setjmp(boot_exit);
+    if (result == 0) {
+        app_main_init();
+        /* Not reached, the bootloader ends in a jump or a reset */
+        result = BOOT_MODEL_RESET;
+    }
+
+    cut_ns = 0;
+    stats.time_us = now_ns / 1000;
+    if (boot_stats != NULL) {
+        *boot_stats = stats;
+    }
+    return result;
+}
+
+/******************************************************************************/
+/*                        HAL of the bootloader                               */
+/******************************************************************************/
+
+uint32_t HAL_GetTick(void) {
+    return (uint32_t) (now_ns / 1000000);
+}
+
+void __set_MSP(uint32_t topOfMainStack) {
+    (void) topOfMainStack;
+    longjmp(boot_exit, BOOT_MODEL_JUMP);
+}
+
+void NVIC_SystemReset(void) {
+    longjmp(boot_exit, BOOT_MODEL_RESET);
+}
+
+HAL_StatusTypeDef HAL_RCC_DeInit(void) {
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_DeInit(void) {
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_FLASH_Unlock(void) {
+    flash_unlocked = 1;
+    flash_mass_erased = 0;
+    host_flash_regs.SR = 0;
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_FLASH_Lock(void) {
+    flash_unlocked = 0;
+    return HAL_OK;
+}
+
+/**
+ * @brief  Double word programming, refused on a double word not erased (PROGERR)
+ */
+HAL_StatusTypeDef HAL_FLASH_Program(uint32_t TypeProgram, uint32_t Address, uint64_t Data) {
+    uint8_t *dest = &flash[Address - FLASH_BASE];
+    uint8_t garbage[8];
+
+    if (!flash_unlocked || (TypeProgram != FLASH_TYPEPROGRAM_DOUBLEWORD) || (Address < FLASH_BASE)
+        || (Address - FLASH_BASE > BOOT_MODEL_FLASH_SIZE - 8) || (Address % 8 != 0)) {
+        return HAL_ERROR;
+    }
+    for (int i = 0; i < 8; i++) {
+        if (dest[i] != 0xFF) {
+            return HAL_ERROR;
+        }
+    }
+
+    if (model_busy(FLASH_DOUBLE_WORD_NS)) {
+        model_garbage(garbage, sizeof(garbage));
+        model_program(dest, garbage, sizeof(garbage));
+        model_power_cut();
+    }
+    model_program(dest, (const uint8_t *) &Data, 8);
+    model_flash_sync(Address - FLASH_BASE, 8);
+    stats.flash_double_words++;
+    return HAL_OK;
+}
+
+/**
+ * @brief  Page or bank erase
+ */
+HAL_StatusTypeDef HAL_FLASHEx_Erase(FLASH_EraseInitTypeDef *pEraseInit, uint32_t *PageError) {
+    *PageError = 0xFFFFFFFF;
+    if (!flash_unlocked || ((pEraseInit->Banks != FLASH_BANK_1) && (pEraseInit->Banks != FLASH_BANK_2))) {
+        return HAL_ERROR;
+    }
+    uint8_t *bank = &flash[(pEraseInit->Banks == FLASH_BANK_2) ? FLASH_BANK_SIZE : 0];
+
+    if (pEraseInit->TypeErase == FLASH_TYPEERASE_MASSERASE) {
+        if (model_busy(FLASH_MASS_ERASE_NS)) {
+            model_garbage(bank, FLASH_BANK_SIZE);
+            model_power_cut();
+        }
+        memset(bank, 0xFF, FLASH_BANK_SIZE);
+        model_flash_sync(bank - flash, FLASH_BANK_SIZE);
+        flash_mass_erased |= pEraseInit->Banks;
+        stats.flash_erases++;
+        return HAL_OK;
+    }
+
+    if (pEraseInit->Page + pEraseInit->NbPages > FLASH_BANK_SIZE / FLASH_PAGE_SIZE) {
+        *PageError = pEraseInit->Page;
+        return HAL_ERROR;
+    }
+    for (uint32_t page = pEraseInit->Page; page < pEraseInit->Page + pEraseInit->NbPages; page++) {
+        if (model_busy(FLASH_PAGE_ERASE_NS)) {
+            model_garbage(&bank[page * FLASH_PAGE_SIZE], FLASH_PAGE_SIZE);
+            model_power_cut();
+        }
+        memset(&bank[page * FLASH_PAGE_SIZE], 0xFF, FLASH_PAGE_SIZE);
+        model_flash_sync(&bank[page * FLASH_PAGE_SIZE] - flash, FLASH_PAGE_SIZE);
+        stats.flash_erases++;
+    }
+    return HAL_OK;
+}
+
+/**
+ * @brief  Check the fast row the CPU just stored (RM0351 fast programming)
+ *
+ * Its bank must have been mass erased since the unlock, and the row must
+ * be erased. Otherwise PGSERR or PROGERR is set and nothing is programmed.
+ */
+static HAL_StatusTypeDef model_fast_row(void) {
+    uint32_t row = flash_row_next;
+
+    for (uint32_t n = 0; n < BOOT_MODEL_FLASH_SIZE / FLASH_PROG_ROW_SIZE; n++) {
+        if (memcmp(&flash[row], &flash_shadow[row], FLASH_PROG_ROW_SIZE) != 0) {
+            uint32_t bank = (row < FLASH_BANK_SIZE) ? FLASH_BANK_1 : FLASH_BANK_2;
+            uint32_t error = 0;
+
+            if ((flash_mass_erased & bank) == 0) {
+                error = FLASH_FLAG_PGSERR;
+            }
+            for (uint32_t i = 0; (error == 0) && (i < FLASH_PROG_ROW_SIZE); i++) {
+                if (flash_shadow[row + i] != 0xFF) {
+                    error = FLASH_FLAG_PROGERR;
+                }
+            }
+            if (error != 0) {
+                memcpy(&flash[row], &flash_shadow[row], FLASH_PROG_ROW_SIZE);
+                host_flash_regs.SR |= error;
+                return HAL_ERROR;
+            }
+
+            model_flash_sync(row, FLASH_PROG_ROW_SIZE);
+            flash_row_next = (row + FLASH_PROG_ROW_SIZE) % BOOT_MODEL_FLASH_SIZE;
+            stats.flash_rows++;
+            return HAL_OK;
+        }
+        row = (row + FLASH_PROG_ROW_SIZE) % BOOT_MODEL_FLASH_SIZE;
+    }
+    return HAL_OK;
+}
+
+/**
+ * @brief  Called before and after each fast row (flash_prog.c), half the row time each
+ */
+HAL_StatusTypeDef FLASH_WaitForLastOperation(uint32_t Timeout) {
+    (void) Timeout;
+    if (model_busy(FLASH_ROW_NS / 2)) {
+        model_power_cut();
+    }
+    flash_row_wait ^= 1;
+    if (flash_row_wait == 0) {
+        return model_fast_row();
+    }
+    return HAL_OK;
+}
+
+uint32_t HAL_CRC_Calculate(CRC_HandleTypeDef *hcrc, uint32_t pBuffer[], uint32_t BufferLength) {
+    crc_state = CRC32_MPEG2_INIT;
+    return HAL_CRC_Accumulate(hcrc, pBuffer, BufferLength);
+}
+
+uint32_t HAL_CRC_Accumulate(CRC_HandleTypeDef *hcrc, uint32_t pBuffer[], uint32_t BufferLength) {
+    (void) hcrc;
+    if (model_busy((BufferLength + 3) / 4 * CRC_WORD_NS)) {
+        model_power_cut();
+    }
+    crc_state = crc32_mpeg2(crc_state, (const uint8_t *) pBuffer, BufferLength);
+    return crc_state;
+}
+
+uint32_t HAL_RTCEx_BKUPRead(RTC_HandleTypeDef *hrtc, uint32_t BackupRegister) {
+    (void) hrtc;
+    return (BackupRegister < BACKUP_REGISTERS) ? backup[BackupRegister] : 0;
+}
+
+void HAL_RTCEx_BKUPWrite(RTC_HandleTypeDef *hrtc, uint32_t BackupRegister, uint32_t Data) {
+    (void) hrtc;
+    if (BackupRegister < BACKUP_REGISTERS) {
+        backup[BackupRegister] = Data;
+    }
+}
+
+/******************************************************************************/
+/*                        W25Qx.c of the bootloader                           */
+/******************************************************************************/
+
+uint8_t w25qx_init(void) {
+    return W25Qx_OK;
+}
+
+void w25qx_deinit(void) {
+}
+
+uint8_t w25qx_read(uint8_t *data, uint32_t read_addr, uint32_t size) {
+    if ((read_data != NULL) || (read_addr > BOOT_MODEL_W25Q_SIZE) || (size > BOOT_MODEL_W25Q_SIZE - read_addr)) {
+        return W25Qx_ERROR;
+    }
+    if (model_busy(size * W25Q_READ_BYTE_NS)) {
+        model_power_cut();
+    }
+    memcpy(data, &w25q[read_addr], size);
+    stats.w25q_read += size;
+    return W25Qx_OK;
+}
+
+/**
+ * @brief  The DMA transfer runs beside the CPU, it ends read_done_ns
+ */
+uint8_t w25qx_read_start(uint8_t *data, uint32_t read_addr, uint32_t size) {
+    if ((read_data != NULL) || (size > 0xFFFF) || (read_addr > BOOT_MODEL_W25Q_SIZE)
+        || (size > BOOT_MODEL_W25Q_SIZE - read_addr)) {
+        return W25Qx_ERROR;
+    }
+    read_data = data;
+    read_address = read_addr;
+    read_size = size;
+    read_done_ns = now_ns + size * W25Q_READ_BYTE_NS;
+    return W25Qx_OK;
+}
+
+uint8_t w25qx_read_wait(void) {
+    if (read_data == NULL) {
+        return W25Qx_ERROR;
+    }
+    if ((read_done_ns > now_ns) && model_busy(read_done_ns - now_ns)) {
+        model_power_cut();
+    }
+    memcpy(read_data, &w25q[read_address], read_size);
+    stats.w25q_read += read_size;
+    read_data = NULL;
+    return W25Qx_OK;
+}
+
+/**
+ * @brief  Page programs, an interrupted one programs its first half
+ */
+uint8_t w25qx_write(uint8_t *data, uint32_t write_addr, uint32_t size) {
+    if ((write_addr > BOOT_MODEL_W25Q_SIZE) || (size > BOOT_MODEL_W25Q_SIZE - write_addr)) {
+        return W25Qx_ERROR;
+    }
+    while (size > 0) {
+        uint32_t chunk = W25Q128FV_PAGE_SIZE - (write_addr % W25Q128FV_PAGE_SIZE);
+
+        if (chunk > size) {
+            chunk = size;
+        }
+        if (model_busy(W25Q_PAGE_PROGRAM_NS)) {
+            model_program(&w25q[write_addr], data, chunk / 2);
+            model_power_cut();
+        }
+        model_program(&w25q[write_addr], data, chunk);
+        stats.w25q_programmed += chunk;
+        data += chunk;
+        write_addr += chunk;
+        size -= chunk;
+    }
+    return W25Qx_OK;
+}
+
+static uint8_t model_w25q_erase(uint32_t address, uint32_t size, uint64_t ns) {
+    if (address >= BOOT_MODEL_W25Q_SIZE) {
+        return W25Qx_ERROR;
+    }
+    address &= ~(size - 1);
+    if (model_busy(ns)) {
+        model_garbage(&w25q[address], size);
+        model_power_cut();
+    }
+    memset(&w25q[address], 0xFF, size);
+    stats.w25q_erases++;
+    return W25Qx_OK;
+}
+
+uint8_t w25qx_erase_block(uint32_t address) {
+    return model_w25q_erase(address, W25Q128FV_SECTOR_SIZE, W25Q_SECTOR_ERASE_NS);
+}
+
+uint8_t w25qx_erase_block_64k(uint32_t address) {
+    return model_w25q_erase(address, W25Q128FV_BLOCK_SIZE, W25Q_BLOCK_ERASE_NS);
+}
@@ -0,0 +1,105 @@
+/*
+ *  boot_model.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef _BOOT_MODEL_H_
+#define _BOOT_MODEL_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************************************************************/
+
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+
+#include <stdint.h>
+
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+
+/*
+ * The bootloader hardware for the real App/app_main.c: the internal flash
+ * mapped at FLASH_BASE, the W25Q, the CRC unit and the RTC backup registers.
+ * Flashes only clear bits when programmed. Time is model time: every flash
+ * operation takes its typical datasheet duration (STM32L4 flash, W25Q128FV),
+ * the tick follows it. A power cut set at a model time stops the bootloader
+ * in the operation it falls in, that operation is left half done: a page or
+ * sector erase leaves garbage, a W25Q program its first half, a double word
+ * garbage. A fast row is either programmed or not, its page is partially
+ * programmed either way.
+ * Programming follows RM0351: a double word needs an erased target
+ * (PROGERR), a fast row an erased target in a bank mass erased since the
+ * unlock (PGSERR), nothing is programmed otherwise.
+ */
+#define BOOT_MODEL_FLASH_SIZE   (0x100000)
+#define BOOT_MODEL_W25Q_SIZE    (0x1000000)
+
+/* How a boot ended */
+typedef enum {
+    BOOT_MODEL_JUMP = 1,            /* Jumped to the application */
+    BOOT_MODEL_RESET,               /* NVIC_SystemReset() */
+    BOOT_MODEL_POWER_CUT,           /* Stopped at the cut time */
+} boot_model_result_t;
+
+typedef struct {
+    uint64_t time_us;               /* Model time from reset to the end of the boot */
+    uint32_t flash_erases;          /* Pages, a bank erase counts once */
+    uint32_t flash_rows;            /* Fast rows */
+    uint32_t flash_double_words;
+    uint32_t w25q_erases;           /* 4 KB sectors and 64 KB blocks */
+    uint32_t w25q_programmed;       /* Bytes */
+    uint32_t w25q_read;             /* Bytes */
+} boot_model_stats_t;
+
+/******************************************************************************/
+/*                                FUNCTIONS                                   */
+/******************************************************************************/
+
+/*!
+ * @brief  Map the internal flash at FLASH_BASE, erase both flashes, clear the backup registers
+ * @param  None
+ * @retval 0 if success, -1 if the address range is taken
+ */
+int boot_model_init(void);
+
+/*!
+ * @brief  W25Q contents, BOOT_MODEL_W25Q_SIZE bytes, written directly by the tests
+ * @param  None
+ * @retval Pointer to the W25Q bytes
+ */
+uint8_t *boot_model_w25q(void);
+
+/*!
+ * @brief  Power loss: the RTC backup registers are cleared, the flashes are kept
+ * @param  None
+ * @retval None
+ */
+void boot_model_power_loss(void);
+
+/*!
+ * @brief  Cut the power of the next boot
+ * @param  time_us: Model time from reset, 0 for no cut
+ * @retval None
+ */
+void boot_model_cut_at(uint64_t time_us);
+
+/*!
+ * @brief  Run the bootloader from reset: app_main_init() until the jump, a reset or the cut
+ * @param  stats: Filled with the work done by the boot, can be NULL
+ * @retval How the boot ended
+ */
+boot_model_result_t boot_model_boot(boot_model_stats_t *stats);
+
+/******************************************************************************/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _BOOT_MODEL_H_ */
@@ -0,0 +1,329 @@
+/*
+ *  lcd_model.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+
+#include <pthread.h>
+#include <string.h>
+#include <time.h>
+#include "stm32l4xx_hal.h"
+#include "lcd_model.h"
+
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+
+#define CMD_CASET               (0x2A)
+#define CMD_PASET               (0x2B)
+#define CMD_RAMWR               (0x2C)
+#define CMD_MADCTL              (0x36)
+#define CMD_DISPLAY_ON          (0x29)
+#define CMD_READ_ID4            (0xD3)
+
+#define MADCTL_MY               (0x80)
+#define MADCTL_MX               (0x40)
+#define MADCTL_MV               (0x20)
+
+#define DMA_CHUNK               (256)   /* Pixels written per bus lock by the DMA */
+
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+
+static uint16_t gram[LCD_MODEL_WIDTH * LCD_MODEL_HEIGHT];
+static lcd_model_stats_t stats;
+
+/* Controller registers */
+static uint8_t command;
+static uint8_t params[4];
+static uint32_t param_count;
+static uint16_t column_start, column_end, page_start, page_end;
+static uint16_t column, page;
+static uint32_t read_index;
+
+/* The bus: CPU accesses and the DMA interrupt are serialized by it */
+static pthread_mutex_t bus_lock = PTHREAD_RECURSIVE_MUTEX_INITIALIZER_NP;
+static volatile int dma_busy;
+
+/* DMA channel */
+static pthread_mutex_t dma_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t dma_cond = PTHREAD_COND_INITIALIZER;
+static pthread_t dma_thread;
+static int dma_started;
+static int dma_pending;
+static int dma_running;
+static DMA_HandleTypeDef *dma_handle;
+static const uint16_t *dma_src;
+static uint32_t dma_length;
+static uint32_t dma_delay_us;
+
+/******************************************************************************/
+/*                                FUNCTIONS                                   */
+/******************************************************************************/
+
+/**
+ * @brief  Store one pixel at the address counters, mapped through MADCTL
+ */
+static void model_write_pixel(uint16_t value) {
+    uint32_t x = column;
+    uint32_t y = page;
+
+    /* Row/column exchange first, then the mirrors act on the panel axes */
+    if (stats.madctl & MADCTL_MV) {
+        x = page;
+        y = column;
+    }
+    if (stats.madctl & MADCTL_MX) {
+        x = LCD_MODEL_WIDTH - 1 - x;
+    }
+    if (stats.madctl & MADCTL_MY) {
+        y = LCD_MODEL_HEIGHT - 1 - y;
+    }
+    if ((x < LCD_MODEL_WIDTH) && (y < LCD_MODEL_HEIGHT)) {
+        gram[y * LCD_MODEL_WIDTH + x] = value;
+    }
+
+    if (column < column_end) {
+        column++;
+    }
+    else {
+        column = column_start;
+        page = (page < page_end) ? page + 1 : page_start;
+    }
+}
+
+/**
+ * @brief  Parameter byte of the current command
+ */
+static void model_write_param(uint8_t value) {
+    if (param_count < sizeof(params)) {
+        params[param_count] = value;
+    }
+    param_count++;
+
+    if ((command == CMD_CASET) && (param_count == 4)) {
+        column_start = (uint16_t) ((params[0] << 8) | params[1]);
+        column_end = (uint16_t) ((params[2] << 8) | params[3]);
+    }
+    else if ((command == CMD_PASET) && (param_count == 4)) {
+        page_start = (uint16_t) ((params[0] << 8) | params[1]);
+        page_end = (uint16_t) ((params[2] << 8) | params[3]);
+    }
+    else if ((command == CMD_MADCTL) && (param_count == 1)) {
+        stats.madctl = value;
+        stats.madctl_writes++;
+    }
+}
+
+static void model_cpu_enter(void) {
+    pthread_mutex_lock(&bus_lock);
+    if (dma_busy) {
+        stats.conflicts++;
+    }
+}
+
+static void model_cpu_exit(void) {
+    pthread_mutex_unlock(&bus_lock);
+}
+
+void lcd_model_write_reg(uint16_t value) {
+    model_cpu_enter();
+    command = (uint8_t) value;
+    param_count = 0;
+    read_index = 0;
+    stats.commands++;
+    if (command == CMD_RAMWR) {
+        column = column_start;
+        page = page_start;
+    }
+    else if (command == CMD_DISPLAY_ON) {
+        stats.display_on = 1;
+    }
+    model_cpu_exit();
+}
+
+void lcd_model_write_ram(uint16_t value) {
+    model_cpu_enter();
+    if (command == CMD_RAMWR) {
+        model_write_pixel(value);
+        stats.cpu_pixels++;
+    }
+    else {
+        model_write_param((uint8_t) value);
+    }
+    model_cpu_exit();
+}
+
+uint16_t lcd_model_read_ram(void) {
+    static const uint16_t id4[] = { 0x00, 0x00, 0x93, 0x41 };
+    uint16_t value = 0;
+
+    model_cpu_enter();
+    if ((command == CMD_READ_ID4) && (read_index < sizeof(id4) / sizeof(id4[0]))) {
+        value = id4[read_index++];
+    }
+    model_cpu_exit();
+    return value;
+}
+
+/**
+ * @brief  The DMA channel: run the queued transfer, then the interrupt
+ */
+static void *model_dma_thread(void *arg) {
+    (void) arg;
+
+    for (;;) {
+        pthread_mutex_lock(&dma_lock);
+        while (!dma_pending) {
+            pthread_cond_wait(&dma_cond, &dma_lock);
+        }
+        DMA_HandleTypeDef *hdma = dma_handle;
+        const uint16_t *src = dma_src;
+        uint32_t length = dma_length;
+        uint32_t delay_us = dma_delay_us;
+        dma_pending = 0;
+        dma_running = 1;
+        pthread_mutex_unlock(&dma_lock);
+
+        if (delay_us > 0) {
+            struct timespec ts = { .tv_sec = delay_us / 1000000, .tv_nsec = (long) (delay_us % 1000000) * 1000 };
+            nanosleep(&ts, NULL);
+        }
+
+        for (uint32_t done = 0; done < length; done += DMA_CHUNK) {
+            uint32_t count = (length - done < DMA_CHUNK) ? length - done : DMA_CHUNK;
+            pthread_mutex_lock(&bus_lock);
+            for (uint32_t i = 0; i < count; i++) {
+                model_write_pixel(src[done + i]);
+            }
+            stats.dma_pixels += count;
+            pthread_mutex_unlock(&bus_lock);
+        }
+
+        /* Transfer complete interrupt, the callback may chain the next transfer */
+        pthread_mutex_lock(&bus_lock);
+        dma_busy = 0;
+        hdma->State = HAL_DMA_STATE_READY;
+        if (hdma->XferCpltCallback != NULL) {
+            hdma->XferCpltCallback(hdma);
+        }
+        pthread_mutex_unlock(&bus_lock);
+
+        pthread_mutex_lock(&dma_lock);
+        dma_running = 0;
+        pthread_cond_broadcast(&dma_cond);
+        pthread_mutex_unlock(&dma_lock);
+    }
+    return NULL;
+}
+
+/*!
+ * @brief  Clear the panel memory, registers and statistics, start the DMA thread
+ */
+void lcd_model_reset(void) {
+    lcd_model_wait_dma();
+
+    pthread_mutex_lock(&bus_lock);
+    memset(gram, 0, sizeof(gram));
+    memset(&stats, 0, sizeof(stats));
+    command = 0;
+    param_count = 0;
+    column_start = page_start = 0;
+    column_end = LCD_MODEL_WIDTH - 1;
+    page_end = LCD_MODEL_HEIGHT - 1;
+    column = page = 0;
+    pthread_mutex_unlock(&bus_lock);
+
+    if (!dma_started) {
+        pthread_create(&dma_thread, NULL, model_dma_thread, NULL);
+        pthread_detach(dma_thread);
+        dma_started = 1;
+    }
+}
+
+/*!
+ * @brief  Time the DMA takes per transfer, to keep flushes in flight
+ */
+void lcd_model_set_dma_delay(uint32_t delay_us) {
+    pthread_mutex_lock(&dma_lock);
+    dma_delay_us = delay_us;
+    pthread_mutex_unlock(&dma_lock);
+}
+
+/*!
+ * @brief  Wait until no DMA transfer is queued or running
+ */
+void lcd_model_wait_dma(void) {
+    pthread_mutex_lock(&dma_lock);
+    while (dma_pending || dma_running) {
+        pthread_cond_wait(&dma_cond, &dma_lock);
+    }
+    pthread_mutex_unlock(&dma_lock);
+}
+
+/*!
+ * @brief  Get the panel memory
+ */
+const uint16_t *lcd_model_gram(void) {
+    return gram;
+}
+
+/*!
+ * @brief  Get the statistics
+ */
+const lcd_model_stats_t *lcd_model_get_stats(void) {
+    return &stats;
+}
+
+/******************************************************************************/
+/*                          HAL DMA of the channel                            */
+/******************************************************************************/
+
+HAL_StatusTypeDef HAL_DMA_Init(DMA_HandleTypeDef *hdma) {
+    hdma->State = HAL_DMA_STATE_READY;
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_DMA_RegisterCallback(DMA_HandleTypeDef *hdma, HAL_DMA_CallbackIDTypeDef CallbackID,
+                                           void (*pCallback)(DMA_HandleTypeDef *_hdma)) {
+    if (CallbackID == HAL_DMA_XFER_CPLT_CB_ID) {
+        hdma->XferCpltCallback = pCallback;
+    }
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_DMA_Start_IT(DMA_HandleTypeDef *hdma, uint32_t SrcAddress, uint32_t DstAddress, uint32_t DataLength) {
+    (void) DstAddress;
+
+    pthread_mutex_lock(&bus_lock);
+    if (hdma->State == HAL_DMA_STATE_BUSY) {
+        pthread_mutex_unlock(&bus_lock);
+        return HAL_BUSY;
+    }
+    hdma->State = HAL_DMA_STATE_BUSY;
+    dma_busy = 1;
+    stats.dma_transfers++;
+    if (DataLength > stats.dma_max_transfer) {
+        stats.dma_max_transfer = DataLength;
+    }
+
+    pthread_mutex_lock(&dma_lock);
+    dma_handle = hdma;
+    dma_src = (const uint16_t *) (uintptr_t) SrcAddress;
+    dma_length = DataLength;
+    dma_pending = 1;
+    pthread_cond_broadcast(&dma_cond);
+    pthread_mutex_unlock(&dma_lock);
+    pthread_mutex_unlock(&bus_lock);
+    return HAL_OK;
+}
+
+void HAL_DMA_IRQHandler(DMA_HandleTypeDef *hdma) {
+    /* The model thread raises the interrupt itself */
+    (void) hdma;
+}
@@ -0,0 +1,97 @@
+/*
+ *  lcd_model.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef _LCD_MODEL_H_
+#define _LCD_MODEL_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************************************************************/
+
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+
+#include <stdint.h>
+
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+
+/*
+ * ILI9341 seen from the FMC bus (ili9341.c built with LCD_BUS_MODEL) and the
+ * memory to FMC DMA channel. The DMA runs in its own thread like the real
+ * channel runs beside the CPU, its completion callback is the interrupt: the
+ * CPU side of the bus waits while it runs.
+ */
+#define LCD_MODEL_WIDTH         (240)
+#define LCD_MODEL_HEIGHT        (320)
+
+typedef struct {
+    uint32_t commands;              /* Register writes */
+    uint32_t cpu_pixels;            /* Pixels written by the CPU after RAMWR */
+    uint32_t dma_pixels;            /* Pixels written by the DMA */
+    uint32_t dma_transfers;         /* HAL_DMA_Start_IT calls */
+    uint32_t dma_max_transfer;      /* Largest transfer */
+    uint32_t conflicts;             /* CPU bus accesses while a DMA transfer was running */
+    uint32_t madctl_writes;
+    uint8_t madctl;
+    uint8_t display_on;
+} lcd_model_stats_t;
+
+/******************************************************************************/
+/*                                FUNCTIONS                                   */
+/******************************************************************************/
+
+/*!
+ * @brief  Clear the panel memory, registers and statistics, start the DMA thread
+ * @param  None
+ * @retval None
+ */
+void lcd_model_reset(void);
+
+/*!
+ * @brief  Time the DMA takes per transfer, to keep flushes in flight
+ * @param  delay_us: Microseconds
+ * @retval None
+ */
+void lcd_model_set_dma_delay(uint32_t delay_us);
+
+/*!
+ * @brief  Wait until no DMA transfer is queued or running
+ * @param  None
+ * @retval None
+ */
+void lcd_model_wait_dma(void);
+
+/*!
+ * @brief  Get the panel memory, LCD_MODEL_WIDTH x LCD_MODEL_HEIGHT in panel order
+ * @param  None
+ * @retval Pointer to the RGB565 pixels
+ */
+const uint16_t *lcd_model_gram(void);
+
+/*!
+ * @brief  Get the statistics
+ * @param  None
+ * @retval Pointer to the statistics
+ */
+const lcd_model_stats_t *lcd_model_get_stats(void);
+
+/* Bus accesses of ili9341.c */
+void lcd_model_write_reg(uint16_t value);
+void lcd_model_write_ram(uint16_t value);
+uint16_t lcd_model_read_ram(void);
+
+/******************************************************************************/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _LCD_MODEL_H_ */
@@ -0,0 +1,53 @@
+/*
+ *  test.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef _TEST_H_
+#define _TEST_H_
+
+/******************************************************************************/
+
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+
+#include <stdio.h>
+#include <time.h>
+
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+
+/* Each test is one program: checks count failures, main() returns TEST_RESULT() */
+static int test_failures;
+
+#define TEST_CHECK(cond)                                                                 \
+    do {                                                                                 \
+        if (!(cond)) {                                                                   \
+            fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond);     \
+            test_failures++;                                                             \
+        }                                                                                \
+    } while (0)
+
+#define TEST_RESULT()    (printf("%s\n", test_failures ? "FAILED" : "OK"), test_failures ? 1 : 0)
+
+/******************************************************************************/
+/*                                FUNCTIONS                                   */
+/******************************************************************************/
+
+/*!
+ * @brief  Monotonic time for the benchmarks
+ * @param  None
+ * @retval Seconds
+ */
+static inline double test_now(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec + now.tv_nsec * 1e-9;
+}
+
+/******************************************************************************/
+
+#endif /* _TEST_H_ */
@@ -0,0 +1,163 @@
+/*
+ *  test_boot_mailbox.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+
+#include <string.h>
+#include "main.h"
+#include "boot_mailbox.h"
+#include "boot_model.h"
+#include "test.h"
+
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+
+/*
+ * The boot mailbox of the application (system/boot_mailbox.c, table CRC,
+ * renamed app_boot_mailbox_xxx by the build) against the one of the
+ * bootloader (App/boot_mailbox.c, CRC unit of boot_model.c): what one
+ * writes, the other reads, a damaged register or a power loss is refused
+ * by both. Then the real bootloader boots with the causes the application
+ * leaves: the boot time and the internal flash erases of each path.
+ */
+
+/* Same values as the bootloader app_main.c */
+#define APP_ADDRESS          (0x0800A000)
+#define ETX_NORMAL_BOOT      (0xBEEFFEED)
+#define ETX_OTA_DONE_BOOT    (0xBEEFFDDE)
+#define ETX_OTA_REQUEST      (0xDEADBEEF)
+#define ETX_LOAD_PREV_APP    (0xFACEFADE)
+
+#define BOOTS                (10)
+
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+
+static const uint32_t causes[] = { ETX_NORMAL_BOOT, ETX_OTA_DONE_BOOT, ETX_OTA_REQUEST, ETX_LOAD_PREV_APP };
+
+/* Initial stack pointer and reset handler of the installed image */
+static const uint32_t vector_table[2] = { 0x20050000, APP_ADDRESS + 0x1C1 };
+
+extern RTC_HandleTypeDef hrtc;
+
+/******************************************************************************/
+/*                                FUNCTIONS                                   */
+/******************************************************************************/
+
+int app_boot_mailbox_read(boot_mailbox_t *mailbox);
+void app_boot_mailbox_write(boot_mailbox_t *mailbox);
+
+/**
+ * @brief  Written by one side, read by the other
+ */
+static void check_round_trip(void) {
+    boot_mailbox_t mailbox, read;
+
+    for (uint32_t i = 0; i < sizeof(causes) / sizeof(causes[0]); i++) {
+        mailbox = (boot_mailbox_t) { .reboot_cause = causes[i], .boot_ms = 17 * i };
+        app_boot_mailbox_write(&mailbox);
+        TEST_CHECK(HAL_RTCEx_BKUPRead(&hrtc, BOOT_MAILBOX_FIRST_REG) == BOOT_MAILBOX_MAGIC);
+        TEST_CHECK(boot_mailbox_read(&read) == 0);
+        TEST_CHECK(memcmp(&read, &mailbox, sizeof(read)) == 0);
+
+        mailbox = (boot_mailbox_t) { .reboot_cause = causes[i], .boot_ms = 1000 + i };
+        boot_mailbox_write(&mailbox);
+        TEST_CHECK(app_boot_mailbox_read(&read) == 0);
+        TEST_CHECK(memcmp(&read, &mailbox, sizeof(read)) == 0);
+    }
+}
+
+/**
+ * @brief  A bit flipped in any register, or the power lost: refused by both sides
+ */
+static void check_damaged(void) {
+    boot_mailbox_t mailbox = { .reboot_cause = ETX_LOAD_PREV_APP, .boot_ms = 5 };
+    boot_mailbox_t read;
+
+    for (uint32_t reg = 0; reg < BOOT_MAILBOX_WORDS; reg++) {
+        for (uint32_t bit = 0; bit < 32; bit += 7) {
+            app_boot_mailbox_write(&mailbox);
+            uint32_t word = HAL_RTCEx_BKUPRead(&hrtc, BOOT_MAILBOX_FIRST_REG + reg);
+            HAL_RTCEx_BKUPWrite(&hrtc, BOOT_MAILBOX_FIRST_REG + reg, word ^ (1UL << bit));
+            TEST_CHECK(boot_mailbox_read(&read) != 0);
+            TEST_CHECK(app_boot_mailbox_read(&read) != 0);
+        }
+    }
+
+    app_boot_mailbox_write(&mailbox);
+    boot_model_power_loss();
+    TEST_CHECK(boot_mailbox_read(&read) != 0);
+    TEST_CHECK(app_boot_mailbox_read(&read) != 0);
+}
+
+/**
+ * @brief  Boot with the cause the application left, nothing to install or restore
+ * @retval Model time of the boot in us
+ */
+static uint64_t boot_with(uint32_t cause) {
+    boot_mailbox_t mailbox = { .reboot_cause = cause };
+    boot_model_stats_t stats;
+
+    app_boot_mailbox_write(&mailbox);
+    TEST_CHECK(boot_model_boot(&stats) == BOOT_MODEL_JUMP);
+    TEST_CHECK(stats.flash_erases == 0);
+
+    /* The bootloader answers through the mailbox */
+    TEST_CHECK(app_boot_mailbox_read(&mailbox) == 0);
+    TEST_CHECK(mailbox.reboot_cause == ETX_NORMAL_BOOT);
+    TEST_CHECK(mailbox.boot_ms == stats.time_us / 1000);
+    return stats.time_us;
+}
+
+/**
+ * @brief  Boot paths of the mailbox on an installed image
+ */
+static void check_boot_paths(void) {
+    boot_model_stats_t stats;
+    boot_mailbox_t mailbox;
+    uint64_t power_on_us, normal_us = 0, confirm_us = 0, rollback_us = 0;
+
+    memcpy((void *) APP_ADDRESS, vector_table, sizeof(vector_table));
+    boot_model_power_loss();
+
+    /* Power on: no mailbox */
+    TEST_CHECK(boot_model_boot(&stats) == BOOT_MODEL_JUMP);
+    TEST_CHECK(stats.flash_erases == 0);
+    power_on_us = stats.time_us;
+    TEST_CHECK(app_boot_mailbox_read(&mailbox) == 0);
+    TEST_CHECK(mailbox.reboot_cause == ETX_NORMAL_BOOT);
+
+    for (int i = 0; i < BOOTS; i++) {
+        normal_us += boot_with(ETX_NORMAL_BOOT);
+        confirm_us += boot_with(ETX_OTA_DONE_BOOT);
+        rollback_us += boot_with(ETX_LOAD_PREV_APP);
+    }
+    TEST_CHECK(memcmp((const void *) APP_ADDRESS, vector_table, sizeof(vector_table)) == 0);
+
+    printf("boot (model time, no internal flash erase): power on %.2f ms, normal reset %.2f ms,\n"
+           "  trial reset %.2f ms, rollback request without previous image %.2f ms\n",
+           power_on_us / 1e3, normal_us / 1e3 / BOOTS, confirm_us / 1e3 / BOOTS, rollback_us / 1e3 / BOOTS);
+}
+
+/******************************************************************************/
+
+int main(void) {
+    if (boot_model_init() != 0) {
+        fprintf(stderr, "internal flash address range not available\n");
+        return 1;
+    }
+    host_log_mute(1);
+
+    check_round_trip();
+    check_damaged();
+    check_boot_paths();
+
+    return TEST_RESULT();
+}
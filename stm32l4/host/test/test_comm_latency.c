@@ -0,0 +1,168 @@
+/*
+ *  test_comm_latency.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <string.h>
+#include "main.h"
+#include "app_config.h"
+#include "crc.h"
+#include "command.h"
+#include "communication.h"
+#include "uart_model.h"
+#include "test.h"
+
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+
+/*
+ * communication.c on its own thread, this one plays the USART2 interrupt
+ * through uart_model.c. The histogram of communication_get_latency() is
+ * taken twice:
+ *   before   the task polls the FIFO every 10 ms, osThreadFlagsWait() is
+ *            wrapped (--wrap) into the delay(10) of the old loop
+ *   after    the task sleeps on COMM_RX_FLAG set by the interrupt
+ */
+#define POLL_MS            (10)       /* delay() of the polling loop */
+#define FRAMES             (150)      /* Per phase */
+#define GAP_MIN_MS         (1)        /* Silence between two frames */
+#define GAP_MAX_MS         (12)
+#define SENSOR_PAYLOAD     (3)        /* Sensor index, reading */
+
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+
+static atomic_bool polling;
+static atomic_uint sensor_packets;
+
+/******************************************************************************/
+/*                                FUNCTIONS                                   */
+/******************************************************************************/
+
+uint32_t __real_osThreadFlagsWait(uint32_t flags, uint32_t options, uint32_t timeout);
+
+/**
+ * @brief  The RX wait of communication_task(): delay(10) before the change
+ */
+uint32_t __wrap_osThreadFlagsWait(uint32_t flags, uint32_t options, uint32_t timeout) {
+    if (atomic_load(&polling) && (flags & COMM_RX_FLAG)) {
+        delay(POLL_MS);
+        return osFlagsErrorTimeout;
+    }
+    return __real_osThreadFlagsWait(flags, options, timeout);
+}
+
+static int sensor_data(const uint8_t *data, uint16_t length) {
+    (void) data;
+    atomic_fetch_add(&sensor_packets, 1);
+    return (length == SENSOR_PAYLOAD) ? 0 : -1;
+}
+
+/**
+ * @brief  A v2 sensor frame
+ */
+static uint32_t sensor_frame(uint8_t *frame, uint32_t index) {
+    uint16_t length = 1 + SENSOR_PAYLOAD;
+
+    frame[0] = 0xAA;
+    frame[1] = 0x56;
+    frame[2] = (uint8_t) length;
+    frame[3] = (uint8_t) (length >> 8);
+    frame[4] = COMMAND_SENSOR_DATA;
+    frame[5] = (uint8_t) (index % 3);
+    frame[6] = (uint8_t) index;
+    frame[7] = (uint8_t) (index >> 8);
+    uint16_t crc = crc16_ccitt(CRC16_INIT, &frame[2], 2 + length);
+    frame[8] = (uint8_t) crc;
+    frame[9] = (uint8_t) (crc >> 8);
+
+    return 10;
+}
+
+/**
+ * @brief  FRAMES frames at random intervals, histogram of this phase only
+ */
+static void run_phase(bool poll, comm_latency_stats_t *phase) {
+    comm_latency_stats_t before, after;
+    uint8_t frame[16];
+    uint32_t expected = atomic_load(&sensor_packets) + FRAMES;
+
+    atomic_store(&polling, poll);
+    delay(2 * POLL_MS);
+    communication_get_latency(&before);
+
+    for (uint32_t i = 0; i < FRAMES; i++) {
+        uart_model_receive(frame, sensor_frame(frame, i));
+        delay(GAP_MIN_MS + rand() % (GAP_MAX_MS - GAP_MIN_MS + 1));
+    }
+    for (int i = 0; (i < 100) && (atomic_load(&sensor_packets) < expected); i++) {
+        delay(POLL_MS);
+    }
+
+    communication_get_latency(&after);
+    TEST_CHECK(atomic_load(&sensor_packets) == expected);
+
+    phase->packets = after.packets - before.packets;
+    phase->max_us = 0;    /* Not per phase */
+    for (int i = 0; i < COMM_LATENCY_BUCKETS; i++) {
+        phase->buckets[i] = after.buckets[i] - before.buckets[i];
+    }
+}
+
+static int median_bucket(const comm_latency_stats_t *stats) {
+    uint32_t count = 0;
+
+    for (int i = 0; i < COMM_LATENCY_BUCKETS; i++) {
+        count += stats->buckets[i];
+        if (2 * count >= stats->packets) {
+            return i;
+        }
+    }
+    return COMM_LATENCY_BUCKETS - 1;
+}
+
+/******************************************************************************/
+
+int main(void) {
+    comm_latency_stats_t polled, notified;
+    comm_frame_stats_t frames;
+
+    srand(1);
+    communication_init();
+    command_register(COMMAND_SENSOR_DATA, "sensor_data", sensor_data, COMMAND_INLINE);
+    TEST_CHECK(uart_model_rx_started());
+
+    run_phase(true, &polled);
+    run_phase(false, &notified);
+
+    printf("arrival to dispatch   before (%d ms poll)   after (thread flags)\n", POLL_MS);
+    for (int i = 0; i < COMM_LATENCY_BUCKETS; i++) {
+        if (i < COMM_LATENCY_BUCKETS - 1) {
+            printf("  < %6u us %18lu %22lu\n", 16u << i, (unsigned long) polled.buckets[i], (unsigned long) notified.buckets[i]);
+        }
+        else {
+            printf("  >=%6u us %18lu %22lu\n", 16u << (i - 1), (unsigned long) polled.buckets[i], (unsigned long) notified.buckets[i]);
+        }
+    }
+    printf("  median     %15s%u us %19s%u us\n", "< ", 16u << median_bucket(&polled), "< ", 16u << median_bucket(&notified));
+
+    communication_get_frame_stats(&frames);
+    TEST_CHECK(frames.frames[1] == 2 * FRAMES);
+    TEST_CHECK((frames.check_errors == 0) && (frames.length_errors == 0));
+    TEST_CHECK((polled.packets == FRAMES) && (notified.packets == FRAMES));
+    TEST_CHECK(median_bucket(&notified) < median_bucket(&polled));
+
+    /* Woken by the interrupt, the task never waits for its timeout */
+    TEST_CHECK(notified.buckets[COMM_LATENCY_BUCKETS - 1] == 0);
+
+    return TEST_RESULT();
+}
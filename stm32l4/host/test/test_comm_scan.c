@@ -0,0 +1,441 @@
+/*
+ *  test_comm_scan.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+
+#include <stdlib.h>
+#include <string.h>
+#include "main.h"
+#include "crc.h"
+#include "command.h"
+#include "communication.h"
+#include "test.h"
+
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+
+/*
+ * Frame parser of communication.c (communication_sim_parse(), built with
+ * COMMUNICATION_SIMULATION) against the per byte communication_process()
+ * it replaced, kept below as it was except that accepted frames go to
+ * command_dispatch() too. Streams are handed over in random spans:
+ *   clean       v1 or v2 frames with short noise between them: frames/s
+ *   corrupted   every frame damaged once after its length field, the
+ *               frames still accepted are false accepts
+ *   noise       random bytes with SOF pairs sprinkled in
+ *   repeated    a SOF doubled before a frame (AA AA 55): the old parser
+ *               went idle on the second SOF and dropped the frame, the
+ *               scan stays on SOF and takes it
+ */
+#define STREAM_MAX         (4 * 1024 * 1024)
+#define CLEAN_FRAMES       (30000)
+#define CORRUPT_FRAMES     (20000)    /* Per kind of damage */
+#define NOISE_SIZE         (4 * 1024 * 1024)
+#define SPAN_MAX           (600)      /* FIFO spans of the task */
+#define PAYLOAD_MAX        (200)
+#define BENCH_ROUNDS       (5)
+
+#define SOF                (0xAA)
+#define SOF2               (0x55)
+#define SOF2_V2            (0x56)
+
+enum {
+    DAMAGE_BIT = 0,                   /* One bit flipped */
+    DAMAGE_BYTE,                      /* One byte replaced */
+    DAMAGE_SWAP,                      /* Two adjacent different bytes swapped */
+    DAMAGE_ZERO,                      /* Two adjacent bytes zeroed */
+    DAMAGE_SCATTER,                   /* Three bytes replaced anywhere */
+    DAMAGE_KINDS,
+};
+
+static const char *const damage_names[DAMAGE_KINDS] = {
+    "bit flip", "byte replaced", "adjacent swap", "2 bytes zeroed", "3 bytes scattered",
+};
+
+typedef struct {
+    int state;
+    int index;
+    int length;
+    uint8_t data[COMM_MAX_LENGTH];
+} old_rx_t;
+
+typedef uint32_t (*parser_t)(const uint8_t *data, uint32_t length);
+
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+
+static uint8_t stream[STREAM_MAX];
+static uint32_t stream_length;
+static uint32_t stream_frames;
+
+static old_rx_t old_rx;
+static uint32_t old_accepted;
+
+static uint32_t packets_good;
+static uint32_t packets_bad;
+
+/******************************************************************************/
+/*                                FUNCTIONS                                   */
+/******************************************************************************/
+
+/**
+ * @brief  Payload byte i of the frame tagged tag
+ */
+static uint8_t payload_byte(uint8_t tag, uint32_t i) {
+    return (uint8_t) (tag * 31 + i * 7 + 1);
+}
+
+/**
+ * @brief  COMMAND_SENSOR_DATA handler, checks the payload it gets
+ */
+static int packet_handler(const uint8_t *data, uint16_t length) {
+    int good = (length >= 1);
+    for (uint32_t i = 1; good && (i < length); i++) {
+        good = (data[i] == payload_byte(data[0], i));
+    }
+    if (good) {
+        packets_good++;
+    }
+    else {
+        packets_bad++;
+    }
+    return 0;
+}
+
+/**
+ * @brief  The parser before communication_scan(), fed byte per byte
+ */
+static uint8_t old_checksum(uint8_t *data, int size) {
+    uint8_t checksum = 0;
+    for (int i = 0; i < size; i++) {
+        checksum += data[i];
+    }
+
+    return checksum;
+}
+
+static bool old_process(uint8_t c) {
+    switch (old_rx.state) {
+        case COMM_IDLE_STATE:
+            if (c == SOF) {
+                old_rx.state = COMM_SOF_STATE;
+            }
+            break;
+
+        case COMM_SOF_STATE:
+            if (c == SOF2) {
+                old_rx.state = COMM_LENGTH_STATE;
+            }
+            else {
+                old_rx.state = COMM_IDLE_STATE;
+            }
+            break;
+
+        case COMM_LENGTH_STATE:
+            if (c == 0) {
+                old_rx.length = OTA_PACKET_LENGTH;
+            }
+            else {
+                old_rx.length = c;
+            }
+            old_rx.index = 0;
+            old_rx.state = COMM_DATA_STATE;
+            break;
+
+        case COMM_DATA_STATE:
+            old_rx.data[old_rx.index++] = c;
+            if (old_rx.index >= old_rx.length) {
+                old_rx.state = COMM_CHECKSUM_STATE;
+            }
+            break;
+
+        case COMM_CHECKSUM_STATE:
+            old_rx.state = COMM_IDLE_STATE;
+            if (old_checksum(old_rx.data, old_rx.length) == c) {
+                old_accepted++;
+                command_dispatch(old_rx.data, old_rx.length, NULL);
+            }
+            return true;
+
+        default:
+            old_rx.state = COMM_IDLE_STATE;
+            break;
+    }
+
+    return false;
+}
+
+static uint32_t old_parse(const uint8_t *data, uint32_t length) {
+    uint32_t frames = 0;
+    for (uint32_t i = 0; i < length; i++) {
+        frames += old_process(data[i]);
+    }
+    return frames;
+}
+
+/**
+ * @brief  Frames accepted so far by communication.c
+ */
+static uint32_t new_accepted(void) {
+    comm_frame_stats_t stats;
+    communication_get_frame_stats(&stats);
+    return stats.frames[0] + stats.frames[1];
+}
+
+/**
+ * @brief  Append a sensor frame, returns the offset of its first damageable byte
+ */
+static uint32_t append_frame(uint8_t version, uint32_t tag) {
+    uint32_t length = 2 + rand() % (PAYLOAD_MAX - 1);
+    uint8_t *frame = &stream[stream_length];
+    uint32_t header = (version == COMM_FRAME_V1) ? 3 : 4;
+
+    frame[0] = SOF;
+    frame[1] = (version == COMM_FRAME_V1) ? SOF2 : SOF2_V2;
+    frame[2] = (uint8_t) length;
+    frame[3] = (uint8_t) (length >> 8);
+    uint8_t *packet = &frame[header];
+    packet[0] = COMMAND_SENSOR_DATA;
+    packet[1] = (uint8_t) tag;
+    for (uint32_t i = 2; i < length; i++) {
+        packet[i] = payload_byte(packet[1], i - 1);
+    }
+
+    if (version == COMM_FRAME_V1) {
+        packet[length] = old_checksum(packet, length);
+        stream_length += header + length + 1;
+    }
+    else {
+        uint16_t crc = crc16_ccitt(CRC16_INIT, &frame[2], 2);
+        crc = crc16_ccitt(crc, packet, length);
+        packet[length] = (uint8_t) crc;
+        packet[length + 1] = (uint8_t) (crc >> 8);
+        stream_length += header + length + 2;
+    }
+    stream_frames++;
+
+    /* Noise between frames, without SOF */
+    for (int i = rand() % 8; i > 0; i--) {
+        uint8_t byte = (uint8_t) rand();
+        stream[stream_length++] = (byte == SOF) ? 0 : byte;
+    }
+
+    return header;
+}
+
+static void stream_clean(uint8_t version) {
+    stream_length = 0;
+    stream_frames = 0;
+    while ((stream_frames < CLEAN_FRAMES) && (stream_length + PAYLOAD_MAX + 16 < STREAM_MAX)) {
+        append_frame(version, stream_frames);
+    }
+}
+
+/**
+ * @brief  Frames each damaged once after the length field, so the parsers stay in step
+ */
+static void stream_damaged(uint8_t version, int kind) {
+    stream_length = 0;
+    stream_frames = 0;
+    while ((stream_frames < CORRUPT_FRAMES) && (stream_length + PAYLOAD_MAX + 16 < STREAM_MAX)) {
+        uint32_t start = stream_length;
+        uint32_t first = start + append_frame(version, stream_frames);
+        uint32_t end = first + (stream[start + 2] | ((version == COMM_FRAME_V2) ? (stream[start + 3] << 8) : 0))
+                       + ((version == COMM_FRAME_V1) ? 1 : 2);
+        uint32_t span = end - first;
+        uint32_t at = first + rand() % span;
+        uint32_t pair = first + rand() % (span - 1);
+
+        switch (kind) {
+            case DAMAGE_BIT:
+                stream[at] ^= (uint8_t) (1 << (rand() % 8));
+                break;
+            case DAMAGE_BYTE:
+                stream[at] ^= (uint8_t) (1 + rand() % 255);
+                break;
+            case DAMAGE_SWAP:
+                while (stream[pair] == stream[pair + 1]) {
+                    pair = first + rand() % (span - 1);
+                }
+                uint8_t byte = stream[pair];
+                stream[pair] = stream[pair + 1];
+                stream[pair + 1] = byte;
+                break;
+            case DAMAGE_ZERO:
+                while ((stream[pair] | stream[pair + 1]) == 0) {
+                    pair = first + rand() % (span - 1);
+                }
+                stream[pair] = 0;
+                stream[pair + 1] = 0;
+                break;
+            default:
+                for (int i = 0; i < 3; i++) {
+                    stream[first + rand() % span] ^= (uint8_t) (1 + rand() % 255);
+                }
+                break;
+        }
+    }
+}
+
+/**
+ * @brief  Hand the stream to a parser in random spans
+ */
+static void replay(parser_t parse) {
+    for (uint32_t offset = 0; offset < stream_length; ) {
+        uint32_t span = 1 + rand() % SPAN_MAX;
+        if (span > stream_length - offset) {
+            span = stream_length - offset;
+        }
+        parse(&stream[offset], span);
+        offset += span;
+    }
+}
+
+/**
+ * @brief  Frames per second of a parser on the current stream
+ */
+static double frames_per_s(parser_t parse) {
+    double start = test_now();
+    for (int round = 0; round < BENCH_ROUNDS; round++) {
+        replay(parse);
+    }
+    return (double) stream_frames * BENCH_ROUNDS / (test_now() - start);
+}
+
+/**
+ * @brief  A frame after an extra SOF, in one span and byte per byte
+ */
+static void check_repeated_sof(uint8_t version, int extra) {
+    uint32_t old_before, new_before;
+
+    /* Any frame in progress ends in the zeros */
+    memset(stream, 0, COMM_MAX_LENGTH + 16);
+    old_parse(stream, COMM_MAX_LENGTH + 16);
+    communication_sim_parse(stream, COMM_MAX_LENGTH + 16);
+
+    for (int per_byte = 0; per_byte < 2; per_byte++) {
+        stream_length = 0;
+        stream_frames = 0;
+        for (int i = 0; i < extra; i++) {
+            stream[stream_length++] = SOF;
+        }
+        append_frame(version, 0x42);
+
+        old_before = old_accepted;
+        new_before = new_accepted();
+        for (uint32_t i = 0; i < stream_length; i += per_byte ? 1 : stream_length) {
+            communication_sim_parse(&stream[i], per_byte ? 1 : stream_length);
+            if (version == COMM_FRAME_V1) {
+                old_parse(&stream[i], per_byte ? 1 : stream_length);
+            }
+        }
+
+        TEST_CHECK(new_accepted() - new_before == 1);
+        TEST_CHECK(old_accepted == old_before);
+    }
+}
+
+/******************************************************************************/
+
+int main(void) {
+    uint32_t accepted;
+
+    srand(1);
+    command_register(COMMAND_SENSOR_DATA, "sensor_data", packet_handler, COMMAND_INLINE);
+
+    /* Clean streams: every frame decoded, payloads intact */
+    stream_clean(COMM_FRAME_V1);
+    double old_v1 = frames_per_s(old_parse);
+    TEST_CHECK(old_accepted == stream_frames * BENCH_ROUNDS);
+    double new_v1 = frames_per_s(communication_sim_parse);
+    TEST_CHECK(new_accepted() == stream_frames * BENCH_ROUNDS);
+    uint32_t v1_frames = stream_frames;
+
+    stream_clean(COMM_FRAME_V2);
+    accepted = new_accepted();
+    double new_v2 = frames_per_s(communication_sim_parse);
+    TEST_CHECK(new_accepted() - accepted == stream_frames * BENCH_ROUNDS);
+    TEST_CHECK(packets_bad == 0);
+    TEST_CHECK(packets_good == (2 * v1_frames + stream_frames) * BENCH_ROUNDS);
+
+    printf("clean frames (%lu v1 and %lu v2 frames, %d MiB each):\n", (unsigned long) v1_frames,
+           (unsigned long) stream_frames, STREAM_MAX >> 20);
+    printf("  old parser v1  %10.0f frames/s\n", old_v1);
+    printf("  scan v1        %10.0f frames/s (x%.1f)\n", new_v1, new_v1 / old_v1);
+    printf("  scan v2        %10.0f frames/s\n", new_v2);
+
+    /* Damaged frames: the ones still accepted are false accepts */
+    host_log_mute(1);
+    printf("false accepts of %d damaged frames:   old v1   scan v1   scan v2\n", CORRUPT_FRAMES);
+    for (int kind = 0; kind < DAMAGE_KINDS; kind++) {
+        uint32_t old_v1_accepts, new_v1_accepts, new_v2_accepts;
+
+        stream_damaged(COMM_FRAME_V1, kind);
+        accepted = old_accepted;
+        replay(old_parse);
+        old_v1_accepts = old_accepted - accepted;
+        accepted = new_accepted();
+        replay(communication_sim_parse);
+        new_v1_accepts = new_accepted() - accepted;
+
+        stream_damaged(COMM_FRAME_V2, kind);
+        accepted = new_accepted();
+        replay(communication_sim_parse);
+        new_v2_accepts = new_accepted() - accepted;
+
+        printf("  %-18s %20.3f %% %7.3f %% %7.4f %%\n", damage_names[kind],
+               100.0 * old_v1_accepts / CORRUPT_FRAMES, 100.0 * new_v1_accepts / CORRUPT_FRAMES,
+               100.0 * new_v2_accepts / CORRUPT_FRAMES);
+
+        /* Same sum as before on v1, CRC-16 catches every burst up to 16 bits */
+        TEST_CHECK(new_v1_accepts == old_v1_accepts);
+        if (kind != DAMAGE_SCATTER) {
+            TEST_CHECK(new_v2_accepts == 0);
+        }
+        else {
+            TEST_CHECK(new_v2_accepts <= CORRUPT_FRAMES / 1000);
+        }
+    }
+
+    /* Noise: SOF pairs of both versions in random bytes */
+    stream_length = NOISE_SIZE;
+    for (uint32_t i = 0; i < NOISE_SIZE; i++) {
+        stream[i] = (uint8_t) rand();
+        if ((rand() % 64 == 0) && (i + 1 < NOISE_SIZE)) {
+            stream[i++] = SOF;
+            stream[i] = (rand() & 1) ? SOF2 : SOF2_V2;
+        }
+    }
+    accepted = old_accepted;
+    replay(old_parse);
+    uint32_t old_noise = old_accepted - accepted;
+    accepted = new_accepted();
+    replay(communication_sim_parse);
+    uint32_t new_noise = new_accepted() - accepted;
+    host_log_mute(0);
+
+    comm_frame_stats_t stats;
+    communication_get_frame_stats(&stats);
+    printf("noise (%d MiB): old parser accepted %lu frames, scan %lu (%lu length errors)\n", NOISE_SIZE >> 20,
+           (unsigned long) old_noise, (unsigned long) new_noise, (unsigned long) stats.length_errors);
+    TEST_CHECK(stats.length_errors > 0);
+
+    /* The one v1 stream the parsers treat differently */
+    host_log_mute(1);
+    accepted = packets_good;
+    check_repeated_sof(COMM_FRAME_V1, 1);
+    check_repeated_sof(COMM_FRAME_V1, 3);
+    check_repeated_sof(COMM_FRAME_V2, 1);
+    host_log_mute(0);
+    TEST_CHECK(packets_good - accepted == 6);
+    printf("repeated SOF: AA AA 55 frames taken by the scan, dropped by the old parser\n");
+
+    return TEST_RESULT();
+}
@@ -0,0 +1,122 @@
+/*
+ *  test_crc.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+
+#include <stdlib.h>
+#include "crc.h"
+#include "test.h"
+
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+
+/*
+ * The tables of crc.c against the catalogue check values ("123456789") and
+ * against bitwise implementations of the same parameters.
+ */
+#define RANDOM_SIZE        (4096)
+
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+
+static const uint8_t check_string[] = "123456789";
+static uint8_t random_data[RANDOM_SIZE];
+
+/******************************************************************************/
+/*                                FUNCTIONS                                   */
+/******************************************************************************/
+
+/* CRC-16/CCITT-FALSE: poly 0x1021, init 0xFFFF, not reflected, no final XOR */
+static uint16_t bitwise_crc16(const uint8_t *data, uint32_t length) {
+    uint16_t crc = 0xFFFF;
+    for (uint32_t i = 0; i < length; i++) {
+        crc ^= (uint16_t) (data[i] << 8);
+        for (int bit = 0; bit < 8; bit++) {
+            crc = (crc & 0x8000) ? (uint16_t) ((crc << 1) ^ 0x1021) : (uint16_t) (crc << 1);
+        }
+    }
+    return crc;
+}
+
+/* CRC-32: poly 0x04C11DB7 reflected, init and final XOR 0xFFFFFFFF */
+static uint32_t bitwise_crc32(const uint8_t *data, uint32_t length) {
+    uint32_t crc = 0xFFFFFFFF;
+    for (uint32_t i = 0; i < length; i++) {
+        crc ^= data[i];
+        for (int bit = 0; bit < 8; bit++) {
+            crc = (crc & 1) ? ((crc >> 1) ^ 0xEDB88320) : (crc >> 1);
+        }
+    }
+    return ~crc;
+}
+
+/* CRC-32/MPEG-2: poly 0x04C11DB7, init 0xFFFFFFFF, not reflected, no final XOR */
+static uint32_t bitwise_crc32_mpeg2(const uint8_t *data, uint32_t length) {
+    uint32_t crc = 0xFFFFFFFF;
+    for (uint32_t i = 0; i < length; i++) {
+        crc ^= (uint32_t) data[i] << 24;
+        for (int bit = 0; bit < 8; bit++) {
+            crc = (crc & 0x80000000) ? ((crc << 1) ^ 0x04C11DB7) : (crc << 1);
+        }
+    }
+    return crc;
+}
+
+/******************************************************************************/
+
+int main(void) {
+    /* Catalogue check values */
+    TEST_CHECK(crc16_ccitt(CRC16_INIT, check_string, 9) == 0x29B1);
+    TEST_CHECK(crc32_ieee(CRC32_INIT, check_string, 9) == 0xCBF43926);
+    TEST_CHECK(crc32_mpeg2(CRC32_MPEG2_INIT, check_string, 9) == 0x0376E6E7);
+
+    /* No data leaves the initial value */
+    TEST_CHECK(crc16_ccitt(CRC16_INIT, check_string, 0) == CRC16_INIT);
+    TEST_CHECK(crc32_ieee(CRC32_INIT, check_string, 0) == CRC32_INIT);
+    TEST_CHECK(crc32_mpeg2(CRC32_MPEG2_INIT, check_string, 0) == CRC32_MPEG2_INIT);
+
+    /* Every table entry: each single byte value */
+    for (uint32_t value = 0; value < 256; value++) {
+        uint8_t byte = (uint8_t) value;
+        TEST_CHECK(crc16_ccitt(CRC16_INIT, &byte, 1) == bitwise_crc16(&byte, 1));
+        TEST_CHECK(crc32_ieee(CRC32_INIT, &byte, 1) == bitwise_crc32(&byte, 1));
+        TEST_CHECK(crc32_mpeg2(CRC32_MPEG2_INIT, &byte, 1) == bitwise_crc32_mpeg2(&byte, 1));
+    }
+
+    /* Random data, whole and in two pieces split anywhere */
+    srand(1);
+    for (uint32_t i = 0; i < RANDOM_SIZE; i++) {
+        random_data[i] = (uint8_t) rand();
+    }
+    uint16_t crc16 = bitwise_crc16(random_data, RANDOM_SIZE);
+    uint32_t crc32 = bitwise_crc32(random_data, RANDOM_SIZE);
+    uint32_t mpeg2 = bitwise_crc32_mpeg2(random_data, RANDOM_SIZE);
+    TEST_CHECK(crc16_ccitt(CRC16_INIT, random_data, RANDOM_SIZE) == crc16);
+    TEST_CHECK(crc32_ieee(CRC32_INIT, random_data, RANDOM_SIZE) == crc32);
+    TEST_CHECK(crc32_mpeg2(CRC32_MPEG2_INIT, random_data, RANDOM_SIZE) == mpeg2);
+
+    for (uint32_t split = 0; split <= RANDOM_SIZE; split += 37) {
+        uint32_t rest = RANDOM_SIZE - split;
+        TEST_CHECK(crc16_ccitt(crc16_ccitt(CRC16_INIT, random_data, split), &random_data[split], rest) == crc16);
+        TEST_CHECK(crc32_ieee(crc32_ieee(CRC32_INIT, random_data, split), &random_data[split], rest) == crc32);
+        TEST_CHECK(crc32_mpeg2(crc32_mpeg2(CRC32_MPEG2_INIT, random_data, split), &random_data[split], rest) == mpeg2);
+    }
+
+    /* Appending the CRC-16 (big endian) gives a zero residue */
+    uint8_t framed[11];
+    for (int i = 0; i < 9; i++) {
+        framed[i] = check_string[i];
+    }
+    framed[9] = 0x29;
+    framed[10] = 0xB1;
+    TEST_CHECK(crc16_ccitt(CRC16_INIT, framed, sizeof(framed)) == 0);
+
+    return TEST_RESULT();
+}
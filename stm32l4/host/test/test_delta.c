@@ -0,0 +1,236 @@
+/*
+ *  test_delta.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "crc.h"
+#include "delta.h"
+#include "test.h"
+
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+
+/*
+ * Run by test_delta.py: <name>.tsdp is the output of tools/ota_delta.py from
+ * <name>.old to <name>.new. The scratch model takes the writes of
+ * delta_apply() as documented in delta.h: in order, whole buffers except the
+ * last one. Reads and writes can be made to fail at a given offset.
+ */
+#define IMAGE_MAX_SIZE     (0x100000 - 0xA000)    /* Application area, MAX_SIZE of ota_delta.py */
+
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+
+static uint8_t scratch[IMAGE_MAX_SIZE];
+static uint32_t scratch_next;        /* Where the next write must start */
+static uint32_t scratch_bad_writes;
+static int scratch_last;             /* A short write was seen, it must be the last one */
+
+static const uint8_t *patch;
+static uint32_t read_fail_at;        /* Fail the read covering this offset, UINT32_MAX for none */
+static uint32_t write_fail_at;
+
+/******************************************************************************/
+/*                                FUNCTIONS                                   */
+/******************************************************************************/
+
+static uint8_t *read_file(const char *path, uint32_t *size) {
+    FILE *file = fopen(path, "rb");
+    if (file == NULL) {
+        return NULL;
+    }
+    fseek(file, 0, SEEK_END);
+    *size = (uint32_t) ftell(file);
+    fseek(file, 0, SEEK_SET);
+
+    uint8_t *data = malloc(*size + 1);
+    if (fread(data, 1, *size, file) != *size) {
+        free(data);
+        data = NULL;
+    }
+    fclose(file);
+    return data;
+}
+
+static int patch_read(uint32_t offset, uint8_t *data, uint32_t size) {
+    if ((read_fail_at >= offset) && (read_fail_at < offset + size)) {
+        return -1;
+    }
+    memcpy(data, &patch[offset], size);
+    return 0;
+}
+
+static int scratch_write(uint32_t offset, const uint8_t *data, uint32_t size) {
+    if ((write_fail_at >= offset) && (write_fail_at < offset + size)) {
+        return -1;
+    }
+    if ((offset != scratch_next) || scratch_last || (size == 0) || (size > DELTA_BUF_SIZE)
+        || (offset + size > IMAGE_MAX_SIZE)) {
+        scratch_bad_writes++;
+        return -1;
+    }
+    scratch_last = (size != DELTA_BUF_SIZE);
+    memcpy(&scratch[offset], data, size);
+    scratch_next = offset + size;
+    return 0;
+}
+
+static int apply(const uint8_t *image, uint32_t patch_size, const uint8_t *old) {
+    delta_io_t io = { .read = patch_read, .write = scratch_write, .old = old, .patch_size = patch_size };
+    delta_header_t header;
+
+    memcpy(&header, image, sizeof(header));
+    patch = &image[sizeof(header)];
+    memset(scratch, 0xFF, sizeof(scratch));
+    scratch_next = 0;
+    scratch_last = 0;
+
+    return delta_apply(&io, &header);
+}
+
+/**
+ * @brief  Apply a patch of ota_delta.py and compare with the new image
+ */
+static void check_patch(const char *name) {
+    char path[256];
+    uint32_t old_size, new_size, image_size;
+    delta_header_t header;
+
+    snprintf(path, sizeof(path), "%s.old", name);
+    uint8_t *old = read_file(path, &old_size);
+    snprintf(path, sizeof(path), "%s.new", name);
+    uint8_t *new = read_file(path, &new_size);
+    snprintf(path, sizeof(path), "%s.tsdp", name);
+    uint8_t *image = read_file(path, &image_size);
+    if ((old == NULL) || (new == NULL) || (image == NULL) || (image_size < sizeof(header))) {
+        TEST_CHECK(!"missing input");
+        return;
+    }
+    memcpy(&header, image, sizeof(header));
+    uint32_t patch_size = image_size - sizeof(header);
+
+    /* The header identifies the installed image like the bootloader checks it */
+    TEST_CHECK(delta_check_header(&header, IMAGE_MAX_SIZE) == 0);
+    TEST_CHECK(header.old_size == old_size);
+    TEST_CHECK(header.old_crc == crc32_mpeg2(CRC32_MPEG2_INIT, old, old_size));
+    TEST_CHECK(header.new_size == new_size);
+
+    read_fail_at = write_fail_at = UINT32_MAX;
+    scratch_bad_writes = 0;
+    TEST_CHECK(apply(image, patch_size, old) == 0);
+    TEST_CHECK(scratch_bad_writes == 0);
+    TEST_CHECK(scratch_next == new_size);
+    TEST_CHECK(memcmp(scratch, new, new_size) == 0);
+    TEST_CHECK(crc32_mpeg2(CRC32_MPEG2_INIT, scratch, new_size) == header.new_crc);
+
+    /* A patch cut short, a failing read, a failing write */
+    TEST_CHECK(apply(image, patch_size - 1, old) != 0);
+    read_fail_at = patch_size - 1;
+    TEST_CHECK(apply(image, patch_size, old) != 0);
+    read_fail_at = UINT32_MAX;
+    write_fail_at = new_size - 1;
+    TEST_CHECK(apply(image, patch_size, old) != 0);
+    write_fail_at = UINT32_MAX;
+
+    /* Applied to another installed image: rebuilt, but caught by the CRC */
+    if (old_size > 1) {
+        old[old_size / 2] ^= 0x01;
+        if (apply(image, patch_size, old) == 0) {
+            TEST_CHECK((memcmp(scratch, new, new_size) == 0)
+                       || (crc32_mpeg2(CRC32_MPEG2_INIT, scratch, new_size) != header.new_crc));
+        }
+        TEST_CHECK(crc32_mpeg2(CRC32_MPEG2_INIT, old, old_size) != header.old_crc);
+    }
+
+    printf("%-12s %7lu -> %7lu bytes, patch %7lu bytes\n", name, (unsigned long) old_size,
+           (unsigned long) new_size, (unsigned long) image_size);
+    free(old);
+    free(new);
+    free(image);
+}
+
+/**
+ * @brief  Headers and operations ota_delta.py does not produce
+ */
+static void check_rejects(void) {
+    static const uint8_t old[16] = "0123456789abcdef";
+    delta_header_t good = {
+        .magic = DELTA_MAGIC, .version = DELTA_VERSION, .old_size = sizeof(old), .new_size = 8,
+    };
+    delta_header_t header;
+
+    TEST_CHECK(delta_check_header(&good, IMAGE_MAX_SIZE) == 0);
+    header = good;
+    header.magic ^= 1;
+    TEST_CHECK(delta_check_header(&header, IMAGE_MAX_SIZE) != 0);
+    header = good;
+    header.version++;
+    TEST_CHECK(delta_check_header(&header, IMAGE_MAX_SIZE) != 0);
+    header = good;
+    header.old_size = 0;
+    TEST_CHECK(delta_check_header(&header, IMAGE_MAX_SIZE) != 0);
+    header.old_size = IMAGE_MAX_SIZE + 1;
+    TEST_CHECK(delta_check_header(&header, IMAGE_MAX_SIZE) != 0);
+    header = good;
+    header.new_size = 0;
+    TEST_CHECK(delta_check_header(&header, IMAGE_MAX_SIZE) != 0);
+    header.new_size = IMAGE_MAX_SIZE + 1;
+    TEST_CHECK(delta_check_header(&header, IMAGE_MAX_SIZE) != 0);
+
+    /* Operations: header, then op, offset, length (little endian) */
+    uint8_t image[sizeof(delta_header_t) + 16];
+    uint8_t *op = &image[sizeof(delta_header_t)];
+    memcpy(image, &good, sizeof(good));
+    read_fail_at = write_fail_at = UINT32_MAX;
+
+    const uint8_t copy_end[] = { DELTA_OP_COPY, 8, 0, 0, 0, 8, 0, 0, 0 };     /* The last 8 bytes, fits */
+    memcpy(op, copy_end, sizeof(copy_end));
+    TEST_CHECK(apply(image, sizeof(copy_end), old) == 0);
+    TEST_CHECK(memcmp(scratch, "89abcdef", 8) == 0);
+
+    op[1] = 9;                                                                /* One byte past the old image */
+    TEST_CHECK(apply(image, sizeof(copy_end), old) != 0);
+    op[1] = 0xFF;                                                             /* Offset + length wrapping */
+    op[2] = op[3] = op[4] = 0xFF;
+    TEST_CHECK(apply(image, sizeof(copy_end), old) != 0);
+
+    memcpy(op, copy_end, sizeof(copy_end));
+    op[1] = 0;
+    op[5] = 9;                                                                /* One byte past the new size */
+    TEST_CHECK(apply(image, sizeof(copy_end), old) != 0);
+    op[5] = 0;                                                                /* Empty, would never end */
+    TEST_CHECK(apply(image, sizeof(copy_end), old) != 0);
+
+    const uint8_t insert[] = { DELTA_OP_INSERT, 8, 0, 0, 0, 'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H' };
+    memcpy(op, insert, sizeof(insert));
+    TEST_CHECK(apply(image, sizeof(insert), old) == 0);
+    TEST_CHECK(memcmp(scratch, "ABCDEFGH", 8) == 0);
+    op[0] = DELTA_OP_INSERT + 1;                                              /* Unknown operation */
+    TEST_CHECK(apply(image, sizeof(insert), old) != 0);
+}
+
+/******************************************************************************/
+
+int main(int argc, char **argv) {
+    if (argc < 2) {
+        fprintf(stderr, "usage: %s name...\n", argv[0]);
+        return 2;
+    }
+
+    for (int i = 1; i < argc; i++) {
+        check_patch(argv[i]);
+    }
+    check_rejects();
+
+    return TEST_RESULT();
+}
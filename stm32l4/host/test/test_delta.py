@@ -0,0 +1,76 @@
+#!/usr/bin/env python3
+"""
+Round trip of tools/ota_delta.py through the bootloader App/delta.c: build
+patches between pairs of images with ota_delta.py, then let test_delta
+rebuild each new image from the old one and compare.
+
+Pairs: a real executable (no target build here, the host test binary is
+used) against itself with patched, inserted, removed and appended bytes,
+identical and unrelated images, shrinking and reordered images, and sizes
+around the 1 KB output buffer.
+
+Usage:
+    test_delta.py <test_delta binary> <tools dir> <work dir>
+"""
+
+import os
+import random
+import subprocess
+import sys
+
+
+def random_bytes(size, seed):
+    rng = random.Random(seed)
+    return bytes(rng.randrange(256) for _ in range(size))
+
+
+def edited(data, seed):
+    rng = random.Random(seed)
+    data = bytearray(data)
+    for _ in range(20):                            # Patched constants and branches
+        pos = rng.randrange(len(data) - 4)
+        data[pos:pos + 4] = random_bytes(4, pos)
+    pos = len(data) // 3                           # Code inserted, the rest shifted
+    data[pos:pos] = random_bytes(700, 1)
+    pos = len(data) // 2                           # Code removed
+    del data[pos:pos + 1500]
+    return bytes(data) + random_bytes(300, 2)      # Code appended
+
+
+def pairs(binary):
+    executable = open(binary, "rb").read()[:64 * 1024]
+    blocks = [executable[i:i + 4096] for i in range(0, 16 * 1024, 4096)]
+    small = random_bytes(3000, 3)
+    return [
+        ("edited", executable, edited(executable, 4)),
+        ("same", executable, executable),
+        ("unrelated", random_bytes(5000, 5), random_bytes(6000, 6)),
+        ("shrink", executable, executable[:10000]),
+        ("reorder", b"".join(blocks), b"".join(reversed(blocks))),
+        ("one", small, b"\x42"),
+        ("buf_less", small, small[:1023]),
+        ("buf_exact", small, small[:1024]),
+        ("buf_more", small, small[:1025]),
+        ("buf_split", small, small[:1000] + random_bytes(48, 7) + small[1000:2100]),
+    ]
+
+
+def main():
+    binary, tools, work = sys.argv[1:4]
+    os.makedirs(work, exist_ok=True)
+
+    names = []
+    for name, old, new in pairs(binary):
+        for suffix, data in ((".old", old), (".new", new)):
+            with open(os.path.join(work, name + suffix), "wb") as f:
+                f.write(data)
+        subprocess.run([sys.executable, os.path.join(tools, "ota_delta.py"), "-o", os.path.join(work, name + ".tsdp"),
+                        os.path.join(work, name + ".old"), os.path.join(work, name + ".new")], check=True)
+        names.append(name)
+
+    result = subprocess.run([os.path.abspath(binary)] + names, cwd=work)
+    sys.exit(result.returncode)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,154 @@
+/*
+ *  test_dma_ring.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+
+#include <stdlib.h>
+#include <string.h>
+#include "dma_ring.h"
+#include "test.h"
+
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+
+/*
+ * Bursts replayed through dma_ring_sim_receive() on the buffer size of
+ * communication.c: the spans must rebuild the received stream, stay inside
+ * the buffer, and come with one event per half transfer, transfer complete
+ * and idle line.
+ */
+#define RING_SIZE          (512)      /* COMM_DMA_RX_SIZE */
+#define STREAM_MAX         (64 * 1024)
+
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+
+static uint8_t dma_buffer[RING_SIZE];
+static dma_ring_t ring;
+
+static uint8_t sent[STREAM_MAX];
+static uint8_t received[STREAM_MAX];
+static uint32_t sent_length;
+static uint32_t received_length;
+static uint32_t bad_spans;
+
+/******************************************************************************/
+/*                                FUNCTIONS                                   */
+/******************************************************************************/
+
+static void on_span(const uint8_t *data, uint16_t length, void *arg) {
+    uint32_t *spans = arg;
+
+    (*spans)++;
+    if ((length == 0) || (data < dma_buffer) || (data + length > dma_buffer + RING_SIZE) ||
+        (received_length + length > STREAM_MAX)) {
+        bad_spans++;
+        return;
+    }
+    memcpy(&received[received_length], data, length);
+    received_length += length;
+}
+
+/**
+ * @brief  Events the DMA raises for a burst starting at position pos: HT at
+ *         size/2, TC at size, idle line unless the burst ended on one of them
+ */
+static uint32_t expected_events(uint32_t pos, uint32_t length) {
+    uint32_t events = 0;
+    for (uint32_t i = 1; i <= length; i++) {
+        events += (((pos + i) % (RING_SIZE / 2)) == 0);
+    }
+    if ((length > 0) && (((pos + length) % (RING_SIZE / 2)) != 0)) {
+        events++;
+    }
+    return events;
+}
+
+/**
+ * @brief  One burst through the simulated DMA, checked against the expected events
+ */
+static void replay_burst(uint32_t length) {
+    uint32_t pos = ring.sim_write_pos;
+    uint32_t events = ring.events;
+    uint32_t spans = 0;
+
+    if (sent_length + length > STREAM_MAX) {
+        return;
+    }
+    for (uint32_t i = 0; i < length; i++) {
+        sent[sent_length + i] = (uint8_t) rand();
+    }
+
+    uint32_t expected = expected_events(pos, length);
+    dma_ring_sim_receive(&ring, &sent[sent_length], length, on_span, &spans);
+    sent_length += length;
+
+    TEST_CHECK(ring.events - events == expected);
+    TEST_CHECK(ring.sim_write_pos == (pos + length) % RING_SIZE);
+    TEST_CHECK(ring.read_pos == ring.sim_write_pos);
+    TEST_CHECK(spans <= 2 * expected);
+}
+
+/******************************************************************************/
+
+int main(void) {
+    static const uint32_t bursts[] = {
+        1, 254, 1, 1,               /* Up to the half transfer, one byte at a time */
+        255, 1,                     /* Transfer complete on the last byte */
+        256, 256,                   /* Exactly on HT then TC */
+        300, 300, 300,              /* Crossing HT and TC, wrapping */
+        511, 2, 512, 513, 1023,     /* Around the buffer size */
+        0, 3000,
+    };
+
+    srand(1);
+    dma_ring_init(&ring, dma_buffer, RING_SIZE);
+
+    for (uint32_t i = 0; i < sizeof(bursts) / sizeof(bursts[0]); i++) {
+        replay_burst(bursts[i]);
+    }
+    /* Random bursts until the stream is full */
+    for (int i = 0; i < 2000; i++) {
+        replay_burst((rand() % 4 == 0) ? (uint32_t) (rand() % 1100) : (uint32_t) (rand() % 40 + 1));
+    }
+
+    printf("%lu bytes in %lu events, %lu spans\n", (unsigned long) sent_length,
+           (unsigned long) ring.events, (unsigned long) ring.spans);
+    TEST_CHECK(received_length == sent_length);
+    TEST_CHECK(memcmp(sent, received, sent_length) == 0);
+    TEST_CHECK(ring.bytes == sent_length);
+    TEST_CHECK(bad_spans == 0);
+
+    /* A wrap gives the tail of the buffer then the head */
+    uint32_t spans = 0;
+    received_length = 0;
+    dma_ring_reset(&ring);
+    dma_ring_update(&ring, 500, on_span, &spans);
+    dma_ring_update(&ring, 20, on_span, &spans);
+    TEST_CHECK((spans == 3) && (received_length == 500 + 12 + 20));
+    TEST_CHECK(ring.read_pos == 20);
+
+    /* No new byte, then a position past the buffer: nothing handed over */
+    spans = 0;
+    dma_ring_update(&ring, 20, on_span, &spans);
+    dma_ring_update(&ring, RING_SIZE + 1, on_span, &spans);
+    TEST_CHECK((spans == 0) && (ring.read_pos == 20));
+
+    /* Transfer complete reports the buffer size, reading restarts at 0 */
+    dma_ring_update(&ring, RING_SIZE, on_span, &spans);
+    TEST_CHECK((spans == 1) && (ring.read_pos == 0));
+
+    /* DMA restarted */
+    dma_ring_update(&ring, 100, on_span, &spans);
+    dma_ring_reset(&ring);
+    TEST_CHECK((ring.read_pos == 0) && (ring.sim_write_pos == 0));
+
+    return TEST_RESULT();
+}
@@ -0,0 +1,97 @@
+/*
+ *  test_ili9341.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+
+#include <string.h>
+#include "ili9341.h"
+#include "lcd_model.h"
+#include "test.h"
+
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+
+static uint16_t pixels[2048] __attribute__((aligned(8)));
+
+/******************************************************************************/
+/*                                FUNCTIONS                                   */
+/******************************************************************************/
+
+/**
+ * @brief  Write count pixels from pixels + offset at the start of the panel RAM
+ */
+static void check_write_pixels(uint32_t offset, uint32_t count) {
+    const lcd_model_stats_t *stats = lcd_model_get_stats();
+    const uint16_t *gram = lcd_model_gram();
+
+    lcd_model_reset();
+    ili9341_set_window(0, LCD_MODEL_WIDTH - 1, 0, LCD_MODEL_HEIGHT - 1);
+    ili9341_write_pixels(&pixels[offset], count);
+
+    TEST_CHECK(stats->cpu_pixels == count);
+    TEST_CHECK(memcmp(gram, &pixels[offset], count * 2) == 0);
+    TEST_CHECK(gram[count] == 0);
+}
+
+static void check_fill_color(uint32_t count) {
+    const lcd_model_stats_t *stats = lcd_model_get_stats();
+    const uint16_t *gram = lcd_model_gram();
+    uint32_t wrong = 0;
+
+    lcd_model_reset();
+    ili9341_set_window(0, LCD_MODEL_WIDTH - 1, 0, LCD_MODEL_HEIGHT - 1);
+    ili9341_fill_color(0xF81F, count);
+
+    for (uint32_t i = 0; i < count; i++) {
+        wrong += (gram[i] != 0xF81F);
+    }
+    TEST_CHECK(stats->cpu_pixels == count);
+    TEST_CHECK(wrong == 0);
+    TEST_CHECK(gram[count] == 0);
+}
+
+/******************************************************************************/
+
+int main(void) {
+    for (uint32_t i = 0; i < sizeof(pixels) / sizeof(pixels[0]); i++) {
+        pixels[i] = (uint16_t) (0x1234 + i * 0x0101);
+    }
+
+    /* Source misaligned by 0..3 pixels, tails of 0..7 pixels after the 8 pixel bursts */
+    for (uint32_t offset = 0; offset < 4; offset++) {
+        for (uint32_t count = 0; count <= 40; count++) {
+            check_write_pixels(offset, count);
+        }
+        check_write_pixels(offset, 1999);
+    }
+
+    for (uint32_t count = 0; count <= 20; count++) {
+        check_fill_color(count);
+    }
+    check_fill_color(LCD_MODEL_WIDTH * LCD_MODEL_HEIGHT - 1);
+
+    /* A window inside the panel, nothing written around it */
+    lcd_model_reset();
+    ili9341_write_area(5, 17, 9, 15, &pixels[1]);
+    const uint16_t *gram = lcd_model_gram();
+    uint32_t wrong = 0;
+    for (uint32_t y = 0; y < 24; y++) {
+        for (uint32_t x = 0; x < 24; x++) {
+            uint16_t expected = 0;
+            if ((x >= 5) && (x <= 17) && (y >= 9) && (y <= 15)) {
+                expected = pixels[1 + (y - 9) * 13 + (x - 5)];
+            }
+            wrong += (gram[y * LCD_MODEL_WIDTH + x] != expected);
+        }
+    }
+    TEST_CHECK(wrong == 0);
+    TEST_CHECK(lcd_model_get_stats()->cpu_pixels == 13 * 7);
+
+    return TEST_RESULT();
+}
@@ -0,0 +1,214 @@
+/*
+ *  test_img_rle.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "lvgl.h"
+#include "res_pack.h"
+#include "lv_port_img.h"
+#include "lv_port_fs.h"
+#include "resource.h"
+#include "test.h"
+
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+
+/*
+ * Run by test_img_rle.py: <name>.rle is the output of tools/img_rle.py for the
+ * pixels of <name>.raw, resources.bin (RES_PACK_FILE) holds the same images.
+ * Then the built-in logos are timed: every line decoded by lv_port_img.c
+ * against the same pixels as an LV_IMG_CF_TRUE_COLOR image, where a line read
+ * is a copy from img_data.
+ */
+#define LINE_MAX_PIXELS    (512)
+#define CHUNK_STEP         (7)        /* Partial reads, as LVGL clips an image */
+#define CHUNK_LENGTH       (13)
+#define GUARD              (0xA5A5)
+#define BENCH_ROUNDS       (500)
+
+/******************************************************************************/
+/*                                FUNCTIONS                                   */
+/******************************************************************************/
+
+static uint8_t *read_file(const char *path, uint32_t *size) {
+    FILE *file = fopen(path, "rb");
+    if (file == NULL) {
+        return NULL;
+    }
+    fseek(file, 0, SEEK_END);
+    *size = (uint32_t) ftell(file);
+    fseek(file, 0, SEEK_SET);
+
+    uint8_t *data = malloc(*size);
+    if (fread(data, 1, *size, file) != *size) {
+        free(data);
+        data = NULL;
+    }
+    fclose(file);
+    return data;
+}
+
+/**
+ * @brief  Decode every line in full and in chunks, the pixels after len stay untouched
+ */
+static void check_decoder(const void *src, const uint16_t *raw, lv_coord_t width, lv_coord_t height) {
+    lv_img_header_t header;
+    lv_img_decoder_dsc_t dsc;
+    lv_color_t line[LINE_MAX_PIXELS + 1];
+    uint32_t errors = 0;
+
+    TEST_CHECK(lv_img_decoder_get_info(src, &header) == LV_RES_OK);
+    TEST_CHECK((header.w == width) && (header.h == height) && (header.cf == LV_PORT_IMG_CF_RLE));
+
+    if (lv_img_decoder_open(&dsc, src, LV_COLOR_BLACK) != LV_RES_OK) {
+        TEST_CHECK(!"lv_img_decoder_open");
+        return;
+    }
+    TEST_CHECK(dsc.img_data == NULL);
+
+    for (lv_coord_t y = 0; y < height; y++) {
+        TEST_CHECK(lv_img_decoder_read_line(&dsc, 0, y, width, (uint8_t*) line) == LV_RES_OK);
+        for (lv_coord_t x = 0; x < width; x++) {
+            errors += (line[x].full != raw[y * width + x]);
+        }
+
+        for (lv_coord_t x = 0; x < width; x += CHUNK_STEP) {
+            lv_coord_t len = LV_MATH_MIN(CHUNK_LENGTH, width - x);
+            for (int i = 0; i <= len; i++) {
+                line[i].full = GUARD;
+            }
+            TEST_CHECK(lv_img_decoder_read_line(&dsc, x, y, len, (uint8_t*) line) == LV_RES_OK);
+            for (lv_coord_t i = 0; i < len; i++) {
+                errors += (line[i].full != raw[y * width + x + i]);
+            }
+            errors += (line[len].full != GUARD);
+        }
+    }
+    lv_img_decoder_close(&dsc);
+
+    TEST_CHECK(errors == 0);
+}
+
+/**
+ * @brief  One image from memory (built-in images) and from the resource pack
+ */
+static void check_image(const char *name) {
+    char path[64];
+    uint32_t size, raw_size;
+    lv_img_dsc_t img;
+
+    snprintf(path, sizeof(path), "%s.rle", name);
+    uint8_t *data = read_file(path, &size);
+    snprintf(path, sizeof(path), "%s.raw", name);
+    uint16_t *raw = (uint16_t*) read_file(path, &raw_size);
+    if ((data == NULL) || (raw == NULL)) {
+        TEST_CHECK(!"missing test files");
+        return;
+    }
+
+    TEST_CHECK(lv_port_img_rle_dsc_init(&img, data, size) == 0);
+    TEST_CHECK((uint32_t) img.header.w * img.header.h * 2 == raw_size);
+    TEST_CHECK(img.header.w <= LINE_MAX_PIXELS);
+    printf("%-10s %3ux%-3u %6u -> %6u bytes\n", name, img.header.w, img.header.h, raw_size, size);
+
+    check_decoder(&img, raw, img.header.w, img.header.h);
+
+    snprintf(path, sizeof(path), "R:%s.rle", name);
+    check_decoder(path, raw, img.header.w, img.header.h);
+
+    /* Broken headers are rejected */
+    lv_img_dsc_t bad;
+    TEST_CHECK(lv_port_img_rle_dsc_init(&bad, data, 11) != 0);
+    data[0] ^= 0xFF;
+    TEST_CHECK(lv_port_img_rle_dsc_init(&bad, data, size) != 0);
+
+    free(data);
+    free(raw);
+}
+
+/**
+ * @brief  Read every line of an image like the LVGL image drawing, BENCH_ROUNDS times
+ * @retval Seconds
+ */
+static double time_lines(const lv_img_dsc_t *img, lv_color_t *out) {
+    lv_img_decoder_dsc_t dsc;
+    lv_coord_t width = img->header.w;
+    double start = test_now();
+
+    for (int round = 0; round < BENCH_ROUNDS; round++) {
+        if (lv_img_decoder_open(&dsc, img, LV_COLOR_BLACK) != LV_RES_OK) {
+            TEST_CHECK(!"lv_img_decoder_open");
+            return 0;
+        }
+        for (lv_coord_t y = 0; y < img->header.h; y++) {
+            if (dsc.img_data != NULL) {
+                memcpy(&out[y * width], &dsc.img_data[y * width * sizeof(lv_color_t)], width * sizeof(lv_color_t));
+            }
+            else {
+                lv_img_decoder_read_line(&dsc, 0, y, width, (uint8_t*) &out[y * width]);
+            }
+        }
+        lv_img_decoder_close(&dsc);
+    }
+    return test_now() - start;
+}
+
+/**
+ * @brief  RLE decode of a logo against the raw copy of its pixels
+ */
+static void bench_logo(const char *name, const uint8_t *data, uint32_t size) {
+    lv_img_dsc_t rle, raw;
+
+    TEST_CHECK(lv_port_img_rle_dsc_init(&rle, data, size) == 0);
+    uint32_t pixels = (uint32_t) rle.header.w * rle.header.h;
+    lv_color_t *decoded = malloc(pixels * sizeof(lv_color_t));
+    lv_color_t *copied = malloc(pixels * sizeof(lv_color_t));
+
+    double rle_time = time_lines(&rle, decoded);
+
+    raw = rle;
+    raw.header.cf = LV_IMG_CF_TRUE_COLOR;
+    raw.data = (const uint8_t*) decoded;
+    raw.data_size = pixels * sizeof(lv_color_t);
+    double raw_time = time_lines(&raw, copied);
+    TEST_CHECK(memcmp(decoded, copied, pixels * sizeof(lv_color_t)) == 0);
+
+    printf("  %-12s %3ux%-3u %6u -> %5u bytes  RLE %8.1f  raw %8.1f\n", name, rle.header.w, rle.header.h,
+           raw.data_size, size, (double) pixels * BENCH_ROUNDS / rle_time / 1e6,
+           (double) pixels * BENCH_ROUNDS / raw_time / 1e6);
+
+    free(decoded);
+    free(copied);
+}
+
+/******************************************************************************/
+
+int main(int argc, char **argv) {
+    lv_init();
+    lv_port_img_init();
+    lv_port_fs_init();
+    TEST_CHECK(res_pack_init() == 0);
+
+    for (int i = 1; i < argc; i++) {
+        check_image(argv[i]);
+    }
+
+    const lv_port_img_stats_t *stats = lv_port_img_get_stats();
+    printf("%u images opened, %u lines, %u pixels decoded\n", stats->opened, stats->lines, stats->pixels);
+    TEST_CHECK(argc > 1);
+
+    printf("logo line reads, Mpixel/s:\n");
+    bench_logo("logo_marine", img_logo_marine_120x120_rle, img_logo_marine_120x120_rle_size);
+    bench_logo("logo_rebtek", img_logo_rebtek_310_62_rle, img_logo_rebtek_310_62_rle_size);
+
+    return TEST_RESULT();
+}
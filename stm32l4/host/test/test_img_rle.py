@@ -0,0 +1,82 @@
+#!/usr/bin/env python3
+"""
+Round trip of tools/img_rle.py through ui/port/lv_port_img.c: encode test
+images with img_rle.py --bin, pack them with res_pack.py, then let
+test_img_rle decode them from memory and from the "R:" drive and compare
+with the source pixels.
+
+Usage:
+    test_img_rle.py <test_img_rle binary> <tools dir> <work dir>
+"""
+
+import os
+import random
+import struct
+import subprocess
+import sys
+
+
+def gradient(width, height):
+    # More than 255 colors: escaped values and literal packets longer than 128
+    return [(x * 211 + y * 7919) & 0xFFFF for y in range(height) for x in range(width)]
+
+
+def runs(width, height):
+    # Runs longer than 128, two pixel runs and single pixels
+    pixels = []
+    for y in range(height):
+        line = [0x0000] * 200 + [0xF800, 0xF800] + [0x07E0] + [0x001F] * (width - 203)
+        pixels.extend(line[y:] + line[:y])
+    return pixels
+
+
+def mixed(width, height, seed):
+    rng = random.Random(seed)
+    colors = [rng.randrange(0x10000) for _ in range(300)]
+    pixels = []
+    while len(pixels) < width * height:
+        pixels.extend([rng.choice(colors if rng.random() < 0.2 else colors[:6])] * rng.choice([1, 1, 2, 3, 40, 130]))
+    return pixels[:width * height]
+
+
+IMAGES = [
+    ("gradient", 300, 4, gradient(300, 4)),
+    ("runs", 320, 3, runs(320, 3)),
+    ("mixed", 37, 29, mixed(37, 29, 1)),
+    ("wide", 310, 62, mixed(310, 62, 2)),
+    ("one", 1, 1, [0x1234]),
+]
+
+
+def main():
+    binary, tools, work = sys.argv[1:4]
+    os.makedirs(work, exist_ok=True)
+
+    pack = []
+    for name, width, height, pixels in IMAGES:
+        raw = struct.pack("<%dH" % len(pixels), *pixels)
+        with open(os.path.join(work, name + ".raw"), "wb") as f:
+            f.write(raw)
+
+        # img_rle.py input: RGB565 C array as exported by the LVGL image converter
+        source = os.path.join(work, name + ".c")
+        with open(source, "w") as f:
+            f.write("const uint8_t %s_map[] = {\n" % name)
+            for i in range(0, len(raw), 16):
+                f.write("    " + "".join("0x%02x, " % b for b in raw[i:i + 16]) + "\n")
+            f.write("};\n")
+
+        encoded = os.path.join(work, name + ".rle")
+        subprocess.run([sys.executable, os.path.join(tools, "img_rle.py"), source, name + "_map",
+                        str(width), str(height), "--bin", encoded], check=True, stdout=subprocess.DEVNULL)
+        pack.append(encoded)
+
+    subprocess.run([sys.executable, os.path.join(tools, "res_pack.py"), "-o", os.path.join(work, "resources.bin")] + pack,
+                   check=True, stdout=subprocess.DEVNULL)
+
+    result = subprocess.run([os.path.abspath(binary)] + [name for name, _, _, _ in IMAGES], cwd=work)
+    sys.exit(result.returncode)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,431 @@
+/*
+ *  test_journal.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+
+#include <stdlib.h>
+#include <string.h>
+#include "main.h"
+#include "boot_mailbox.h"
+#include "delta.h"
+#include "lzss.h"
+#include "crc.h"
+#include "flash_prog.h"
+#include "boot_model.h"
+#include "test.h"
+
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+
+/*
+ * The bootloader app_main.c on the model of its flashes (boot_model.c): an
+ * OTA request is installed over a factory image while the power is cut at
+ * random times, the boot after some cuts is cut again, some cuts are resets
+ * that keep the mailbox. Whatever the cuts, the bootloader must end up
+ * jumping into the new image, the journal closed.
+ * The boot after a cut is timed twice from the same state: resuming from
+ * the journal, and starting over with the journal sector erased.
+ */
+
+/* Same values as app_main.c */
+#define APP_ADDRESS          (0x0800A000)
+#define APP_END              (0x08100000)
+#define CONFIG_ADDRESS       (0x08009800)
+#define OTA_FILE_ADDRESS     (0x10000)
+#define JOURNAL_ADDRESS      (0xF000)
+#define ETX_OTA_REQUEST      (0xDEADBEEF)
+#define MAGIC_NUMBER         (0xAA555AA5)
+#define W25Q_SECTOR_SIZE     (0x1000)
+
+#define FACTORY_SIZE         (300 * 1024 + 8)
+#define IMAGE_SIZE           (600 * 1024 + 40)     /* Into bank 2, bank erase */
+#define COMPRESSED_SIZE      (120 * 1024 + 3)
+#define CUTS                 (40)
+#define TIMED_CUTS           (8)
+#define BOOTS_MAX            (8)
+
+/* Configuration page written by the application (App/ota.h) */
+typedef struct {
+    uint32_t reboot_cause;
+    int32_t fw_size;
+    uint32_t fw_crc;            /* Sum of the file bytes */
+    uint32_t reserved1;
+    uint32_t fw_crc32;
+    uint32_t reserved2;
+    uint32_t version;
+    uint32_t reserved3;
+} __attribute__((packed)) config_page_t;
+
+typedef enum {
+    CASE_RAW = 0,               /* File CRC given by the application */
+    CASE_RAW_SUM,               /* Older application: sum only */
+    CASE_DELTA,
+    CASE_COMPRESSED,
+    CASE_COUNT,
+} install_case_t;
+
+static const char *const case_names[CASE_COUNT] = { "raw", "raw sum", "delta", "compressed" };
+
+/* Initial stack pointer at the end of the RAM, reset handler in the image */
+static const uint32_t vector_table[2] = { 0x20050000, APP_ADDRESS + 0x1C1 };
+
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+
+static uint8_t factory[FACTORY_SIZE];
+static uint8_t image[IMAGE_SIZE];           /* What the case installs */
+static uint32_t image_size;
+static uint8_t file[IMAGE_SIZE + IMAGE_SIZE / 8 + 64];
+static uint32_t file_size;
+
+/******************************************************************************/
+/*                                FUNCTIONS                                   */
+/******************************************************************************/
+
+static void random_bytes(uint8_t *data, uint32_t size) {
+    for (uint32_t i = 0; i < size; i++) {
+        data[i] = (uint8_t) rand();
+    }
+}
+
+static uint32_t sum(const uint8_t *data, uint32_t size) {
+    uint32_t value = 0;
+    for (uint32_t i = 0; i < size; i++) {
+        value += data[i];
+    }
+    return value;
+}
+
+static void put_u32(uint32_t value) {
+    memcpy(&file[file_size], &value, sizeof(value));
+    file_size += sizeof(value);
+}
+
+static void put_bytes(const uint8_t *data, uint32_t size) {
+    memcpy(&file[file_size], data, size);
+    file_size += size;
+}
+
+/**
+ * @brief  The new image and the OTA file of a case
+ */
+static void make_case(install_case_t install) {
+    file_size = 0;
+
+    if (install == CASE_DELTA) {
+        /* Factory code kept, moved and extended */
+        delta_header_t header = { .magic = DELTA_MAGIC, .version = DELTA_VERSION,
+                                  .old_size = FACTORY_SIZE, .old_crc = crc32_mpeg2(CRC32_MPEG2_INIT, factory, FACTORY_SIZE) };
+        uint32_t kept = 200 * 1024, inserted = 40 * 1024, moved = FACTORY_SIZE - kept, added = 100 * 1024 + 12;
+
+        image_size = kept + inserted + moved + added;
+        memcpy(image, factory, kept);
+        random_bytes(&image[kept], inserted);
+        memcpy(&image[kept + inserted], &factory[kept], moved);
+        random_bytes(&image[kept + inserted + moved], added);
+        header.new_size = image_size;
+        header.new_crc = crc32_mpeg2(CRC32_MPEG2_INIT, image, image_size);
+
+        put_bytes((const uint8_t *) &header, sizeof(header));
+        file[file_size++] = DELTA_OP_COPY;
+        put_u32(0);
+        put_u32(kept);
+        file[file_size++] = DELTA_OP_INSERT;
+        put_u32(inserted);
+        put_bytes(&image[kept], inserted);
+        file[file_size++] = DELTA_OP_COPY;
+        put_u32(kept);
+        put_u32(moved);
+        file[file_size++] = DELTA_OP_INSERT;
+        put_u32(added);
+        put_bytes(&image[kept + inserted + moved], added);
+        return;
+    }
+
+    if (install == CASE_COMPRESSED) {
+        /* Literals only: a flag byte 0xFF before each 8 bytes */
+        lzss_header_t header = { .magic = LZSS_MAGIC, .version = LZSS_VERSION, .window_bits = LZSS_WINDOW_BITS,
+                                 .length_bits = LZSS_LENGTH_BITS, .size = COMPRESSED_SIZE };
+
+        image_size = COMPRESSED_SIZE;
+        random_bytes(image, image_size);
+        header.checksum = sum(image, image_size);
+        put_bytes((const uint8_t *) &header, sizeof(header));
+        for (uint32_t i = 0; i < image_size; i += 8) {
+            file[file_size++] = 0xFF;
+            put_bytes(&image[i], (image_size - i < 8) ? (image_size - i) : 8);
+        }
+        return;
+    }
+
+    /* Raw: the bootloader checks the vector table before erasing */
+    image_size = IMAGE_SIZE;
+    random_bytes(image, image_size);
+    memcpy(image, vector_table, sizeof(vector_table));
+    put_bytes(image, image_size);
+}
+
+/**
+ * @brief  The device when the application rebooted for the update
+ */
+static void setup(install_case_t install) {
+    config_page_t config = {
+        .reboot_cause = ETX_OTA_REQUEST,
+        .fw_size = (int32_t) file_size,
+        .fw_crc = sum(file, file_size),
+        .reserved1 = MAGIC_NUMBER,
+        .fw_crc32 = crc32_mpeg2(CRC32_MPEG2_INIT, file, file_size),
+        .reserved2 = (install == CASE_RAW_SUM) ? 0xFFFFFFFF : MAGIC_NUMBER,
+        .version = 2,
+        .reserved3 = 0xFFFFFFFF,
+    };
+    boot_mailbox_t mailbox = { .reboot_cause = ETX_OTA_REQUEST };
+    uint8_t *w25q = boot_model_w25q();
+
+    memset((void *) FLASH_BASE, 0xFF, BOOT_MODEL_FLASH_SIZE);
+    memcpy((void *) APP_ADDRESS, factory, FACTORY_SIZE);
+    memcpy((void *) CONFIG_ADDRESS, &config, sizeof(config));
+
+    memset(w25q, 0xFF, BOOT_MODEL_W25Q_SIZE);
+    memcpy(&w25q[OTA_FILE_ADDRESS], file, file_size);
+
+    boot_model_power_loss();
+    boot_mailbox_write(&mailbox);
+}
+
+/**
+ * @brief  Boot until the application is entered
+ * @retval Model time of the boots in us
+ */
+static uint64_t boot_to_application(void) {
+    boot_model_stats_t stats;
+    uint64_t time_us = 0;
+
+    for (int boot = 0; boot < BOOTS_MAX; boot++) {
+        boot_model_result_t result = boot_model_boot(&stats);
+
+        time_us += stats.time_us;
+        if (result == BOOT_MODEL_JUMP) {
+            return time_us;
+        }
+        TEST_CHECK(result == BOOT_MODEL_RESET);
+    }
+    TEST_CHECK(!"application never entered");
+    return time_us;
+}
+
+/**
+ * @brief  Nothing left after the image in the application area
+ */
+static int erased_after(uint32_t size) {
+    const uint8_t *flash = (const uint8_t *) APP_ADDRESS;
+
+    for (uint32_t i = size; i < APP_END - APP_ADDRESS; i++) {
+        if (flash[i] != 0xFF) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/**
+ * @brief  The new image runs, the next boot leaves it untouched
+ */
+static void check_installed(void) {
+    boot_model_stats_t stats;
+
+    TEST_CHECK(memcmp((const void *) APP_ADDRESS, image, image_size) == 0);
+    TEST_CHECK(erased_after(image_size));
+    TEST_CHECK(*(const uint32_t *) &boot_model_w25q()[JOURNAL_ADDRESS] != 0x4C4A5354);
+
+    TEST_CHECK(boot_model_boot(&stats) == BOOT_MODEL_JUMP);
+    TEST_CHECK(stats.flash_erases == 0);
+    TEST_CHECK(stats.flash_rows + stats.flash_double_words == 0);
+    TEST_CHECK(memcmp((const void *) APP_ADDRESS, image, image_size) == 0);
+}
+
+/**
+ * @brief  Power cut at time_us, a reset keeps the mailbox
+ * @retval How the boot ended, BOOT_MODEL_JUMP if it was done before the cut
+ */
+static boot_model_result_t cut(uint64_t time_us, int reset) {
+    boot_model_cut_at(time_us);
+    boot_model_result_t result = boot_model_boot(NULL);
+    if (!reset) {
+        boot_model_power_loss();
+    }
+    return result;
+}
+
+/**
+ * @brief  One install case: uncut, random cuts, then resume against restart
+ */
+static void check_case(install_case_t install) {
+    boot_model_stats_t stats;
+    uint64_t resume_us = 0, restart_us = 0;
+
+    make_case(install);
+
+    setup(install);
+    TEST_CHECK(boot_model_boot(&stats) == BOOT_MODEL_JUMP);
+    uint64_t full_us = stats.time_us;
+    uint32_t full_read = stats.w25q_read;
+    check_installed();
+
+    for (int i = 0; i < CUTS; i++) {
+        setup(install);
+        TEST_CHECK(cut(1 + (uint64_t) rand() % (full_us - 1), rand() & 1) == BOOT_MODEL_POWER_CUT);
+        if ((rand() & 3) == 0) {
+            /* The boot after the cut may be shorter */
+            cut(1 + (uint64_t) rand() % (full_us - 1), rand() & 1);
+        }
+        boot_to_application();
+        check_installed();
+    }
+
+    /* Same state after the cut, with and without the journal */
+    for (int i = 0; i < TIMED_CUTS; i++) {
+        uint64_t time_us = full_us * (2 * i + 1) / (2 * TIMED_CUTS);
+
+        setup(install);
+        TEST_CHECK(cut(time_us, 0) == BOOT_MODEL_POWER_CUT);
+        resume_us += boot_to_application();
+        check_installed();
+
+        setup(install);
+        TEST_CHECK(cut(time_us, 0) == BOOT_MODEL_POWER_CUT);
+        memset(&boot_model_w25q()[JOURNAL_ADDRESS], 0xFF, W25Q_SECTOR_SIZE);
+        restart_us += boot_to_application();
+        check_installed();
+    }
+    TEST_CHECK(resume_us <= restart_us);
+
+    printf("%-10s %7lu -> %7lu bytes, boot %6.0f ms, W25Q read %4lu KB, after a cut: resume %6.0f ms, restart %6.0f ms\n",
+           case_names[install], (unsigned long) file_size, (unsigned long) image_size, full_us / 1e3,
+           (unsigned long) (full_read >> 10), resume_us / 1e3 / TIMED_CUTS, restart_us / 1e3 / TIMED_CUTS);
+}
+
+/**
+ * @brief  A file changed since the request
+ *
+ * The file is checked while it is copied or decoded: the install fails,
+ * the backup of the factory image is restored.
+ */
+static void check_corrupt_file(install_case_t install) {
+    uint8_t *w25q = boot_model_w25q() + OTA_FILE_ADDRESS;
+    uint32_t last, other;
+
+    make_case(install);
+    setup(install);
+    last = file_size - 1;
+    /* Past the vector table, in the literals of the last group */
+    other = (install == CASE_COMPRESSED) ? last - 2 : sizeof(vector_table);
+
+    /* Two bytes swapped: same sum, another CRC */
+    while ((other < last) && (w25q[other] == w25q[last])) {
+        other++;
+    }
+    TEST_CHECK(other < last);
+    uint8_t byte = w25q[other];
+    w25q[other] = w25q[last];
+    w25q[last] = byte;
+
+    boot_to_application();
+    TEST_CHECK(memcmp((const void *) APP_ADDRESS, factory, FACTORY_SIZE) == 0);
+    TEST_CHECK(erased_after(FACTORY_SIZE));
+}
+
+/**
+ * @brief  A raw file without a valid vector table: nothing is erased, no journal opened
+ */
+static void check_bad_header(uint32_t sp, uint32_t reset) {
+    boot_model_stats_t stats;
+    uint32_t vectors[2] = { sp, reset };
+    const uint8_t *journal = &boot_model_w25q()[JOURNAL_ADDRESS];
+    uint32_t erased = 0;
+
+    make_case(CASE_RAW);
+    memcpy(file, vectors, sizeof(vectors));
+    setup(CASE_RAW);
+
+    TEST_CHECK(boot_model_boot(&stats) == BOOT_MODEL_JUMP);
+    TEST_CHECK(stats.flash_erases == 0);
+    TEST_CHECK(memcmp((const void *) APP_ADDRESS, factory, FACTORY_SIZE) == 0);
+    TEST_CHECK(erased_after(FACTORY_SIZE));
+    while ((erased < W25Q_SECTOR_SIZE) && (journal[erased] == 0xFF)) {
+        erased++;
+    }
+    TEST_CHECK(erased == W25Q_SECTOR_SIZE);
+}
+
+/**
+ * @brief  The model refuses fast rows the way RM0351 does, flash_prog.c must not hit it
+ */
+static void check_fast_row_rules(void) {
+    FLASH_EraseInitTypeDef erase = { .TypeErase = FLASH_TYPEERASE_PAGES, .Banks = FLASH_BANK_2, .Page = 4, .NbPages = 1 };
+    uint32_t row = FLASH_BASE + FLASH_BANK_SIZE + 4 * FLASH_PAGE_SIZE;
+    uint32_t page_error;
+    uint8_t data[FLASH_PROG_ROW_SIZE];
+
+    memset((void *) FLASH_BASE, 0xFF, BOOT_MODEL_FLASH_SIZE);
+    boot_model_cut_at(1);
+    boot_model_boot(NULL);      /* Model state from the flash as set */
+    random_bytes(data, sizeof(data));
+
+    /* Page erased only: PGSERR, nothing programmed */
+    HAL_FLASH_Unlock();
+    TEST_CHECK(HAL_FLASHEx_Erase(&erase, &page_error) == HAL_OK);
+    TEST_CHECK(FLASH_WaitForLastOperation(FLASH_TIMEOUT_VALUE) == HAL_OK);
+    memcpy((void *) row, data, sizeof(data));
+    TEST_CHECK(FLASH_WaitForLastOperation(FLASH_TIMEOUT_VALUE) == HAL_ERROR);
+    TEST_CHECK((FLASH->SR & FLASH_FLAG_PGSERR) != 0);
+    TEST_CHECK(*(const uint32_t *) row == 0xFFFFFFFF);
+
+    /* After a mass erase of the bank */
+    erase.TypeErase = FLASH_TYPEERASE_MASSERASE;
+    TEST_CHECK(HAL_FLASHEx_Erase(&erase, &page_error) == HAL_OK);
+    TEST_CHECK(FLASH_WaitForLastOperation(FLASH_TIMEOUT_VALUE) == HAL_OK);
+    memcpy((void *) row, data, sizeof(data));
+    TEST_CHECK(FLASH_WaitForLastOperation(FLASH_TIMEOUT_VALUE) == HAL_OK);
+    TEST_CHECK(memcmp((const void *) row, data, sizeof(data)) == 0);
+
+    /* Not erased any more: PROGERR */
+    TEST_CHECK(FLASH_WaitForLastOperation(FLASH_TIMEOUT_VALUE) == HAL_OK);
+    memset((void *) row, 0, sizeof(data));
+    TEST_CHECK(FLASH_WaitForLastOperation(FLASH_TIMEOUT_VALUE) == HAL_ERROR);
+    TEST_CHECK((FLASH->SR & FLASH_FLAG_PROGERR) != 0);
+    TEST_CHECK(memcmp((const void *) row, data, sizeof(data)) == 0);
+    HAL_FLASH_Lock();
+}
+
+/******************************************************************************/
+
+int main(void) {
+    if (boot_model_init() != 0) {
+        fprintf(stderr, "internal flash address range not available\n");
+        return 1;
+    }
+    host_log_mute(1);
+
+    srand(1);
+    check_fast_row_rules();
+    random_bytes(factory, FACTORY_SIZE);
+    for (int install = 0; install < CASE_COUNT; install++) {
+        check_case((install_case_t) install);
+    }
+    check_corrupt_file(CASE_RAW);
+    check_corrupt_file(CASE_COMPRESSED);
+    check_bad_header(0xFFFFFFFF, 0xFFFFFFFF);
+    check_bad_header(0x20050000, APP_ADDRESS + 0x1C0);                 /* Not thumb */
+    check_bad_header(0x20050000, APP_ADDRESS + IMAGE_SIZE + 1);        /* Past the image */
+    check_bad_header(0x08000000, APP_ADDRESS + 0x1C1);                 /* Stack in the flash */
+
+    return TEST_RESULT();
+}
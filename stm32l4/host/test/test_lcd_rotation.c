@@ -0,0 +1,159 @@
+/*
+ *  test_lcd_rotation.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+
+#include <string.h>
+#include "lvgl.h"
+#include "ili9341.h"
+#include "lv_port_disp.h"
+#include "lcd_model.h"
+#include "test.h"
+
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+
+/*
+ * The LCD port rotates in the controller (MADCTL, sw_rotate = 0), the
+ * reference display lets LVGL rotate in software (sw_rotate = 1). Both must
+ * put the same pixels in the panel memory.
+ */
+#define PANEL_WIDTH        (LCD_MODEL_WIDTH)
+#define PANEL_HEIGHT       (LCD_MODEL_HEIGHT)
+#define REF_BUF_PIXELS     (PANEL_WIDTH * 40)
+
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+
+static lv_color_t ref_fb[PANEL_WIDTH * PANEL_HEIGHT];
+static lv_color_t ref_buf[REF_BUF_PIXELS];
+static lv_disp_buf_t ref_buf_dsc;
+static lv_disp_drv_t ref_drv;
+static lv_disp_t *ref_disp;
+static lv_disp_t *lcd_disp;
+
+static uint16_t pattern[PANEL_WIDTH * PANEL_HEIGHT];
+
+/******************************************************************************/
+/*                                FUNCTIONS                                   */
+/******************************************************************************/
+
+/**
+ * @brief  Areas arrive in panel coordinates, LVGL rotated them
+ */
+static void ref_flush(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *color_p) {
+    for (int32_t y = area->y1; y <= area->y2; y++) {
+        for (int32_t x = area->x1; x <= area->x2; x++) {
+            ref_fb[y * PANEL_WIDTH + x] = *color_p++;
+        }
+    }
+    lv_disp_flush_ready(drv);
+}
+
+static void scene_rect(lv_obj_t *parent, lv_coord_t x, lv_coord_t y, lv_coord_t w, lv_coord_t h, lv_color_t color) {
+    lv_obj_t *obj = lv_obj_create(parent, NULL);
+    lv_obj_set_pos(obj, x, y);
+    lv_obj_set_size(obj, w, h);
+    lv_obj_set_style_local_radius(obj, LV_OBJ_PART_MAIN, LV_STATE_DEFAULT, 0);
+    lv_obj_set_style_local_border_width(obj, LV_OBJ_PART_MAIN, LV_STATE_DEFAULT, 0);
+    lv_obj_set_style_local_bg_color(obj, LV_OBJ_PART_MAIN, LV_STATE_DEFAULT, color);
+}
+
+/**
+ * @brief  Asymmetric widgets inside 240x240, visible in every orientation
+ */
+static void scene_create(lv_disp_t *disp) {
+    lv_obj_t *scr = lv_disp_get_scr_act(disp);
+    lv_obj_set_style_local_bg_color(scr, LV_OBJ_PART_MAIN, LV_STATE_DEFAULT, LV_COLOR_NAVY);
+
+    scene_rect(scr, 0, 0, 60, 40, LV_COLOR_RED);
+    scene_rect(scr, 200, 10, 30, 100, LV_COLOR_GREEN);
+    scene_rect(scr, 150, 200, 80, 30, LV_COLOR_YELLOW);
+
+    lv_obj_t *label = lv_label_create(scr, NULL);
+    lv_label_set_text(label, "N 12.5 m\nO2 1.30");
+    lv_obj_set_pos(label, 10, 150);
+}
+
+static uint32_t compare_with_reference(void) {
+    const uint16_t *gram = lcd_model_gram();
+    uint32_t diff = 0;
+
+    for (uint32_t i = 0; i < PANEL_WIDTH * PANEL_HEIGHT; i++) {
+        diff += (gram[i] != ref_fb[i].full);
+    }
+    return diff;
+}
+
+static void set_rotation(lv_disp_rot_t rotation) {
+    lv_port_disp_set_rotation(rotation);
+    lv_disp_set_rotation(ref_disp, rotation);
+    lv_disp_set_default(lcd_disp);
+}
+
+/******************************************************************************/
+
+int main(void) {
+    static const char *names[] = { "0", "90", "180", "270" };
+    const lcd_model_stats_t *stats = lcd_model_get_stats();
+
+    lcd_model_reset();
+    lv_init();
+    lv_port_disp_init();
+    lcd_disp = lv_disp_get_default();
+
+    lv_disp_buf_init(&ref_buf_dsc, ref_buf, NULL, REF_BUF_PIXELS);
+    lv_disp_drv_init(&ref_drv);
+    ref_drv.hor_res = PANEL_WIDTH;
+    ref_drv.ver_res = PANEL_HEIGHT;
+    ref_drv.sw_rotate = 1;
+    ref_drv.flush_cb = ref_flush;
+    ref_drv.buffer = &ref_buf_dsc;
+    ref_disp = lv_disp_drv_register(&ref_drv);
+    lv_disp_set_default(lcd_disp);
+
+    scene_create(lcd_disp);
+    scene_create(ref_disp);
+
+    /* Each orientation against the software rotated reference */
+    for (lv_disp_rot_t rotation = LV_DISP_ROT_NONE; rotation <= LV_DISP_ROT_270; rotation++) {
+        set_rotation(rotation);
+        lv_refr_now(NULL);
+        lcd_model_wait_dma();
+
+        uint32_t diff = compare_with_reference();
+        printf("rotation %3s: MADCTL 0x%02X, %u px differ from the reference\n", names[rotation], stats->madctl, diff);
+        TEST_CHECK(diff == 0);
+    }
+
+    /* Rotate right after a refresh, its last flush is still in the DMA */
+    lcd_model_set_dma_delay(5000);
+    for (lv_disp_rot_t rotation = LV_DISP_ROT_NONE; rotation <= LV_DISP_ROT_270; rotation++) {
+        lv_obj_invalidate(lv_disp_get_scr_act(lcd_disp));
+        lv_refr_now(lcd_disp);
+        set_rotation((rotation + 1) % 4);
+        lv_refr_now(NULL);
+        lcd_model_wait_dma();
+        TEST_CHECK(compare_with_reference() == 0);
+    }
+    printf("rotations during DMA flushes: %u bus conflicts\n", stats->conflicts);
+    TEST_CHECK(stats->conflicts == 0);
+
+    /* The driver alone waits for its transfer too */
+    uint32_t transfers = stats->dma_transfers;
+    ili9341_set_window(0, PANEL_WIDTH - 1, 0, PANEL_HEIGHT - 1);
+    ili9341_write_pixels_dma(pattern, PANEL_WIDTH * PANEL_HEIGHT, NULL);
+    ili9341_set_rotation(ILI9341_ROTATION_0);
+    lcd_model_wait_dma();
+    TEST_CHECK(stats->dma_transfers - transfers == 2);
+    TEST_CHECK(stats->conflicts == 0);
+
+    return TEST_RESULT();
+}
@@ -0,0 +1,234 @@
+/*
+ *  test_lv_port_disp.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+
+#include <string.h>
+#include "lvgl.h"
+#include "ili9341.h"
+#include "lv_port_disp.h"
+#include "lcd_model.h"
+#include "test.h"
+
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+
+#define REF_WIDTH          (LV_HOR_RES_MAX)
+#define REF_HEIGHT         (LV_VER_RES_MAX)
+#define REF_BUF_PIXELS     (REF_WIDTH * 32)
+#define DMA_MIN_PIXELS     (128)     /* DISP_DMA_MIN_PIXELS of lv_port_disp.c */
+#define BENCH_FRAMES       (100)     /* Full screen refreshes per flush path */
+
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+
+/* Reference display: the same widgets rendered by LVGL into memory */
+static lv_color_t ref_fb[REF_WIDTH * REF_HEIGHT];
+static lv_color_t ref_buf[REF_BUF_PIXELS];
+static lv_disp_buf_t ref_buf_dsc;
+static lv_disp_drv_t ref_drv;
+static lv_disp_t *ref_disp;
+static lv_disp_t *lcd_disp;
+
+static lv_obj_t *lcd_dot;
+static lv_obj_t *ref_dot;
+
+static uint16_t big_area[LCD_MODEL_WIDTH * LCD_MODEL_HEIGHT];
+static volatile int big_area_done;
+
+/* Flush callback under measurement and the time spent in it */
+static void (*bench_flush_cb)(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *color_p);
+static double bench_flush_time;
+
+/******************************************************************************/
+/*                                FUNCTIONS                                   */
+/******************************************************************************/
+
+static void ref_flush(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *color_p) {
+    for (int32_t y = area->y1; y <= area->y2; y++) {
+        for (int32_t x = area->x1; x <= area->x2; x++) {
+            ref_fb[y * REF_WIDTH + x] = *color_p++;
+        }
+    }
+    lv_disp_flush_ready(drv);
+}
+
+static lv_obj_t *scene_rect(lv_obj_t *parent, lv_coord_t x, lv_coord_t y, lv_coord_t w, lv_coord_t h, lv_color_t color) {
+    lv_obj_t *obj = lv_obj_create(parent, NULL);
+    lv_obj_set_pos(obj, x, y);
+    lv_obj_set_size(obj, w, h);
+    lv_obj_set_style_local_radius(obj, LV_OBJ_PART_MAIN, LV_STATE_DEFAULT, 0);
+    lv_obj_set_style_local_border_width(obj, LV_OBJ_PART_MAIN, LV_STATE_DEFAULT, 0);
+    lv_obj_set_style_local_bg_color(obj, LV_OBJ_PART_MAIN, LV_STATE_DEFAULT, color);
+    return obj;
+}
+
+/**
+ * @brief  Widgets covering the whole screen, a label and a small dot to change later
+ */
+static lv_obj_t *scene_create(lv_disp_t *disp) {
+    lv_obj_t *scr = lv_disp_get_scr_act(disp);
+    lv_obj_set_style_local_bg_color(scr, LV_OBJ_PART_MAIN, LV_STATE_DEFAULT, LV_COLOR_NAVY);
+
+    scene_rect(scr, 0, 0, 120, 80, LV_COLOR_RED);
+    scene_rect(scr, 100, 60, 140, 200, LV_COLOR_GREEN);
+    scene_rect(scr, 10, 290, 230, 30, LV_COLOR_YELLOW);
+
+    lv_obj_t *label = lv_label_create(scr, NULL);
+    lv_label_set_text(label, "TigerShark 2.01\n0123456789");
+    lv_obj_set_pos(label, 20, 120);
+
+    return scene_rect(scr, 200, 10, 8, 8, LV_COLOR_WHITE);
+}
+
+/**
+ * @brief  Pixels of the panel that differ from the reference
+ */
+static uint32_t compare_with_reference(void) {
+    const uint16_t *gram = lcd_model_gram();
+    uint32_t diff = 0;
+
+    for (uint32_t i = 0; i < REF_WIDTH * REF_HEIGHT; i++) {
+        if (gram[i] != ref_fb[i].full) {
+            diff++;
+        }
+    }
+    return diff;
+}
+
+static void refresh(void) {
+    lv_refr_now(NULL);
+    lcd_model_wait_dma();
+}
+
+static void big_area_flushed(void) {
+    big_area_done++;
+}
+
+/**
+ * @brief  The flush of the port without the DMA: every area written by the CPU
+ */
+static void cpu_flush(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *color_p) {
+    ili9341_write_area(area->x1, area->x2, area->y1, area->y2, (const uint16_t *) color_p);
+    lv_disp_flush_ready(drv);
+}
+
+static void timed_flush(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *color_p) {
+    double start = test_now();
+    bench_flush_cb(drv, area, color_p);
+    bench_flush_time += test_now() - start;
+}
+
+/**
+ * @brief  Full screen refreshes through a flush callback, time per frame and time in the callback
+ */
+static void bench_refresh(void (*flush_cb)(lv_disp_drv_t*, const lv_area_t*, lv_color_t*),
+                          double *frame_us, double *flush_us) {
+    void (*port_flush_cb)(lv_disp_drv_t*, const lv_area_t*, lv_color_t*) = lcd_disp->driver.flush_cb;
+
+    bench_flush_cb = flush_cb;
+    bench_flush_time = 0;
+    lcd_disp->driver.flush_cb = timed_flush;
+
+    double start = test_now();
+    for (int frame = 0; frame < BENCH_FRAMES; frame++) {
+        lv_obj_invalidate(lv_disp_get_scr_act(lcd_disp));
+        refresh();
+    }
+    *frame_us = (test_now() - start) * 1e6 / BENCH_FRAMES;
+    *flush_us = bench_flush_time * 1e6 / BENCH_FRAMES;
+
+    lcd_disp->driver.flush_cb = port_flush_cb;
+}
+
+/******************************************************************************/
+
+int main(void) {
+    lcd_model_reset();
+    lv_init();
+    lv_port_disp_init();
+    lcd_disp = lv_disp_get_default();
+
+    const lcd_model_stats_t *stats = lcd_model_get_stats();
+    TEST_CHECK(stats->display_on);
+    TEST_CHECK(stats->madctl == 0x08);
+
+    lv_disp_buf_init(&ref_buf_dsc, ref_buf, NULL, REF_BUF_PIXELS);
+    lv_disp_drv_init(&ref_drv);
+    ref_drv.hor_res = REF_WIDTH;
+    ref_drv.ver_res = REF_HEIGHT;
+    ref_drv.flush_cb = ref_flush;
+    ref_drv.buffer = &ref_buf_dsc;
+    ref_disp = lv_disp_drv_register(&ref_drv);
+    lv_disp_set_default(lcd_disp);
+
+    lcd_dot = scene_create(lcd_disp);
+    ref_dot = scene_create(ref_disp);
+
+    /* Full screen: every part of the draw buffer goes through the DMA */
+    refresh();
+    printf("full screen: %u DMA transfers (max %u px), %u DMA px, %u CPU px\n",
+           stats->dma_transfers, stats->dma_max_transfer, stats->dma_pixels, stats->cpu_pixels);
+    TEST_CHECK(compare_with_reference() == 0);
+    TEST_CHECK(stats->dma_transfers > 0);
+    TEST_CHECK(stats->dma_pixels == REF_WIDTH * REF_HEIGHT);
+    TEST_CHECK(stats->conflicts == 0);
+
+    /* A small area is written by the CPU */
+    uint32_t transfers = stats->dma_transfers;
+    uint32_t cpu_pixels = stats->cpu_pixels;
+    lv_obj_set_style_local_bg_color(lcd_dot, LV_OBJ_PART_MAIN, LV_STATE_DEFAULT, LV_COLOR_MAGENTA);
+    lv_obj_set_style_local_bg_color(ref_dot, LV_OBJ_PART_MAIN, LV_STATE_DEFAULT, LV_COLOR_MAGENTA);
+    refresh();
+    printf("8x8 dot: %u DMA transfers, %u CPU px\n", stats->dma_transfers - transfers, stats->cpu_pixels - cpu_pixels);
+    TEST_CHECK(compare_with_reference() == 0);
+    TEST_CHECK(stats->dma_transfers == transfers);
+    TEST_CHECK(stats->cpu_pixels - cpu_pixels < DMA_MIN_PIXELS);
+
+    /* Slow DMA: LVGL renders the next part while the previous one is sent */
+    lcd_model_set_dma_delay(2000);
+    lv_obj_invalidate(lv_disp_get_scr_act(lcd_disp));
+    lv_obj_invalidate(lv_disp_get_scr_act(ref_disp));
+    memset((void *) lcd_model_gram(), 0, LCD_MODEL_WIDTH * LCD_MODEL_HEIGHT * 2);
+    refresh();
+    lcd_model_set_dma_delay(0);
+    TEST_CHECK(compare_with_reference() == 0);
+    TEST_CHECK(stats->conflicts == 0);
+
+    /* DMA against CPU flush on the model: the CPU only sets the window and starts the DMA */
+    double dma_frame_us, dma_flush_us, cpu_frame_us, cpu_flush_us;
+    bench_refresh(lcd_disp->driver.flush_cb, &dma_frame_us, &dma_flush_us);
+    TEST_CHECK(compare_with_reference() == 0);
+    memset((void *) lcd_model_gram(), 0, LCD_MODEL_WIDTH * LCD_MODEL_HEIGHT * 2);
+    bench_refresh(cpu_flush, &cpu_frame_us, &cpu_flush_us);
+    TEST_CHECK(compare_with_reference() == 0);
+    TEST_CHECK(dma_flush_us < cpu_flush_us);
+    TEST_CHECK(stats->conflicts == 0);
+
+    printf("%u px full screen refresh, us/frame:\n", REF_WIDTH * REF_HEIGHT);
+    printf("  DMA flush       frame %8.0f  in flush_cb %8.0f\n", dma_frame_us, dma_flush_us);
+    printf("  CPU flush       frame %8.0f  in flush_cb %8.0f\n", cpu_frame_us, cpu_flush_us);
+
+    /* Transfers above the 16 bit DMA counter are chained */
+    for (uint32_t i = 0; i < LCD_MODEL_WIDTH * LCD_MODEL_HEIGHT; i++) {
+        big_area[i] = (uint16_t) (i * 31);
+    }
+    transfers = stats->dma_transfers;
+    ili9341_set_window(0, LCD_MODEL_WIDTH - 1, 0, LCD_MODEL_HEIGHT - 1);
+    ili9341_write_pixels_dma(big_area, LCD_MODEL_WIDTH * LCD_MODEL_HEIGHT, big_area_flushed);
+    lcd_model_wait_dma();
+    TEST_CHECK(big_area_done == 1);
+    TEST_CHECK(stats->dma_transfers - transfers == 2);
+    TEST_CHECK(stats->dma_max_transfer == 0xFFFF);
+    TEST_CHECK(memcmp(lcd_model_gram(), big_area, sizeof(big_area)) == 0);
+    TEST_CHECK(stats->conflicts == 0);
+
+    return TEST_RESULT();
+}
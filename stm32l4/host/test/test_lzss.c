@@ -0,0 +1,222 @@
+/*
+ *  test_lzss.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "lzss.h"
+#include "test.h"
+
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+
+/*
+ * Run by test_lzss.py: <name>.tslz is the output of tools/ota_pack.py for
+ * <name>.bin. The flash model takes the writes of lzss_decode() like the
+ * bootloader programs them: in order, whole buffers, double words, erased
+ * bytes only. Reads can be made to fail at a given offset.
+ */
+#define FLASH_SIZE         (0x100000 - 0xA000)    /* Application area, MAX_SIZE of ota_pack.py */
+
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+
+static uint8_t flash[FLASH_SIZE];
+static uint32_t flash_next;          /* Where the next write must start */
+static uint32_t flash_bad_writes;
+
+static const uint8_t *stream;
+static uint32_t read_fail_at;        /* Fail the read covering this offset, UINT32_MAX for none */
+static uint32_t write_fail_at;
+
+/******************************************************************************/
+/*                                FUNCTIONS                                   */
+/******************************************************************************/
+
+static uint8_t *read_file(const char *path, uint32_t *size) {
+    FILE *file = fopen(path, "rb");
+    if (file == NULL) {
+        return NULL;
+    }
+    fseek(file, 0, SEEK_END);
+    *size = (uint32_t) ftell(file);
+    fseek(file, 0, SEEK_SET);
+
+    uint8_t *data = malloc(*size + 1);
+    if (fread(data, 1, *size, file) != *size) {
+        free(data);
+        data = NULL;
+    }
+    fclose(file);
+    return data;
+}
+
+static int stream_read(uint32_t offset, uint8_t *data, uint32_t size) {
+    if ((read_fail_at >= offset) && (read_fail_at < offset + size)) {
+        return -1;
+    }
+    memcpy(data, &stream[offset], size);
+    return 0;
+}
+
+static int flash_write(uint32_t offset, const uint8_t *data, uint32_t size) {
+    if ((write_fail_at >= offset) && (write_fail_at < offset + size)) {
+        return -1;
+    }
+    if ((offset != flash_next) || (size % 8 != 0) || (offset + size > FLASH_SIZE)) {
+        flash_bad_writes++;
+        return -1;
+    }
+    for (uint32_t i = 0; i < size; i++) {
+        if (flash[offset + i] != 0xFF) {
+            flash_bad_writes++;
+        }
+        flash[offset + i] = data[i];
+    }
+    flash_next = offset + size;
+    return 0;
+}
+
+static int decode(const uint8_t *image, uint32_t stream_size) {
+    lzss_io_t io = { .read = stream_read, .write = flash_write, .output = flash, .stream_size = stream_size };
+    lzss_header_t header;
+
+    memcpy(&header, image, sizeof(header));
+    stream = &image[sizeof(header)];
+    memset(flash, 0xFF, sizeof(flash));
+    flash_next = 0;
+
+    return lzss_decode(&io, &header);
+}
+
+/**
+ * @brief  Decode an image of ota_pack.py and compare it with its source
+ */
+static void check_image(const char *name) {
+    char path[256];
+    uint32_t size, image_size;
+    lzss_header_t header;
+
+    snprintf(path, sizeof(path), "%s.bin", name);
+    uint8_t *data = read_file(path, &size);
+    snprintf(path, sizeof(path), "%s.tslz", name);
+    uint8_t *image = read_file(path, &image_size);
+    if ((data == NULL) || (image == NULL) || (image_size < sizeof(header))) {
+        TEST_CHECK(!"missing input");
+        return;
+    }
+    memcpy(&header, image, sizeof(header));
+    uint32_t stream_size = image_size - sizeof(header);
+
+    TEST_CHECK(lzss_check_header(&header, FLASH_SIZE) == 0);
+    TEST_CHECK(header.size == size);
+
+    read_fail_at = write_fail_at = UINT32_MAX;
+    flash_bad_writes = 0;
+    TEST_CHECK(decode(image, stream_size) == 0);
+    TEST_CHECK(flash_bad_writes == 0);
+    TEST_CHECK(memcmp(flash, data, size) == 0);
+    TEST_CHECK(flash_next == ((size + 7) & ~7u));
+    for (uint32_t i = size; i < flash_next; i++) {
+        TEST_CHECK(flash[i] == 0xFF);
+    }
+
+    uint32_t checksum = 0;
+    for (uint32_t i = 0; i < size; i++) {
+        checksum += flash[i];
+    }
+    TEST_CHECK(checksum == header.checksum);
+
+    /* A stream cut short, a failing read, a failing write */
+    if (stream_size > 1) {
+        TEST_CHECK(decode(image, stream_size - 1) != 0);
+    }
+    read_fail_at = stream_size / 2;
+    TEST_CHECK(decode(image, stream_size) != 0);
+    read_fail_at = UINT32_MAX;
+    if (size > LZSS_BUF_SIZE) {
+        write_fail_at = LZSS_BUF_SIZE;
+        TEST_CHECK(decode(image, stream_size) != 0);
+        write_fail_at = UINT32_MAX;
+    }
+
+    printf("%-12s %7lu -> %7lu bytes\n", name, (unsigned long) size, (unsigned long) image_size);
+    free(data);
+    free(image);
+}
+
+/**
+ * @brief  Headers and streams ota_pack.py does not produce
+ */
+static void check_rejects(void) {
+    lzss_header_t good = {
+        .magic = LZSS_MAGIC, .version = LZSS_VERSION, .window_bits = LZSS_WINDOW_BITS,
+        .length_bits = LZSS_LENGTH_BITS, .size = 16, .checksum = 0,
+    };
+    lzss_header_t header;
+
+    TEST_CHECK(lzss_check_header(&good, FLASH_SIZE) == 0);
+    header = good;
+    header.magic ^= 1;
+    TEST_CHECK(lzss_check_header(&header, FLASH_SIZE) != 0);
+    header = good;
+    header.version++;
+    TEST_CHECK(lzss_check_header(&header, FLASH_SIZE) != 0);
+    header = good;
+    header.window_bits++;
+    TEST_CHECK(lzss_check_header(&header, FLASH_SIZE) != 0);
+    header = good;
+    header.length_bits--;
+    TEST_CHECK(lzss_check_header(&header, FLASH_SIZE) != 0);
+    header = good;
+    header.size = 0;
+    TEST_CHECK(lzss_check_header(&header, FLASH_SIZE) != 0);
+    header.size = FLASH_SIZE + 1;
+    TEST_CHECK(lzss_check_header(&header, FLASH_SIZE) != 0);
+
+    /* A match before the first byte, then one running past the size */
+    uint8_t image[sizeof(lzss_header_t) + 8];
+    read_fail_at = write_fail_at = UINT32_MAX;
+    memcpy(image, &good, sizeof(good));
+    image[sizeof(good) + 0] = 0x00;             /* Match */
+    image[sizeof(good) + 1] = 0x00;             /* Offset 1, length 3 */
+    image[sizeof(good) + 2] = 0x00;
+    TEST_CHECK(decode(image, 3) != 0);
+
+    header = good;
+    header.size = 4;
+    memcpy(image, &header, sizeof(header));
+    image[sizeof(good) + 0] = 0x01;             /* Literal, then a match */
+    image[sizeof(good) + 1] = 0x41;
+    image[sizeof(good) + 2] = 0x00;             /* Offset 1, length 3: 4 bytes in all, fits */
+    image[sizeof(good) + 3] = 0x00;
+    TEST_CHECK(decode(image, 4) == 0);
+    TEST_CHECK(memcmp(flash, "AAAA", 4) == 0);
+    image[sizeof(good) + 3] = 0x10;             /* Length 4: one byte past the size */
+    TEST_CHECK(decode(image, 4) != 0);
+}
+
+/******************************************************************************/
+
+int main(int argc, char **argv) {
+    if (argc < 2) {
+        fprintf(stderr, "usage: %s name...\n", argv[0]);
+        return 2;
+    }
+
+    for (int i = 1; i < argc; i++) {
+        check_image(argv[i]);
+    }
+    check_rejects();
+
+    return TEST_RESULT();
+}
@@ -0,0 +1,63 @@
+#!/usr/bin/env python3
+"""
+Round trip of tools/ota_pack.py through the bootloader App/lzss.c: compress
+test images with ota_pack.py, then let test_lzss decompress them into its
+flash model and compare with the source bytes.
+
+Inputs: a real executable (no target build here, the host test binary is
+used), runs of erased flash, random bytes, periodic data with matches at the
+far end of the window, and sizes around the 2 KB output buffer.
+
+Usage:
+    test_lzss.py <test_lzss binary> <tools dir> <work dir>
+"""
+
+import os
+import random
+import subprocess
+import sys
+
+
+def periodic(size, period):
+    rng = random.Random(period)
+    block = bytes(rng.randrange(256) for _ in range(period))
+    return (block * (size // period + 1))[:size]
+
+
+def images(binary):
+    rng = random.Random(1)
+    executable = open(binary, "rb").read()[:96 * 1024]
+    return [
+        ("executable", executable),
+        ("erased", b"\xff" * 20000),
+        ("random", bytes(rng.randrange(256) for _ in range(9000))),
+        ("window", periodic(30000, 4096)),         # Every match at offset 4096
+        ("beyond", periodic(30000, 4097)),         # Out of the window, literals
+        ("short", periodic(70, 5)),
+        ("one", b"\x42"),
+        ("buf_less", periodic(2047, 300)),
+        ("buf_exact", periodic(2048, 300)),
+        ("buf_more", periodic(2049, 300)),
+        ("buf_two", executable[:4096 + 3]),
+    ]
+
+
+def main():
+    binary, tools, work = sys.argv[1:4]
+    os.makedirs(work, exist_ok=True)
+
+    names = []
+    for name, data in images(binary):
+        source = os.path.join(work, name + ".bin")
+        with open(source, "wb") as f:
+            f.write(data)
+        subprocess.run([sys.executable, os.path.join(tools, "ota_pack.py"), "-o", os.path.join(work, name + ".tslz"),
+                        source], check=True)
+        names.append(name)
+
+    result = subprocess.run([os.path.abspath(binary)] + names, cwd=work)
+    sys.exit(result.returncode)
+
+
+if __name__ == "__main__":
+    main()
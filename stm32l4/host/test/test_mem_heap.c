@@ -0,0 +1,244 @@
+/*
+ *  test_mem_heap.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "FreeRTOS.h"
+#include "main.h"
+#include "lvgl.h"
+#include "app_config.h"
+#include "mem_heap.h"
+#include "lv_port_disp.h"
+#include "lv_port_img.h"
+#include "lv_port_fs.h"
+#include "resource.h"
+#include "ui_utils.h"
+#include "ui_splash.h"
+#include "ui_big_number.h"
+#include "replay.h"
+#include "test.h"
+
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+
+/*
+ * The boot of the application replayed on the shared heap, mem_heap_check()
+ * after every allocation and release:
+ *   app_main_init()   task stacks, TCBs and the command queue (pvPortMalloc)
+ *   lvgl_task()       LVGL, the fonts of the resource pack and the screens
+ *   run               a UI sequence, then random application allocations
+ * LVGL goes through mem_heap_lvgl_alloc/free, wrapped at link time (--wrap).
+ * RTOS object sizes are the ones of the Cortex-M4 build.
+ */
+#define RTOS_TCB_SIZE          (96)
+#define RTOS_QUEUE_SIZE        (80)
+#define COMMAND_JOB_SIZE       (12)
+#define COMMAND_QUEUE_LENGTH   (4)
+
+#define CHURN_SLOTS            (64)
+#define CHURN_STEPS            (20000)
+
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+
+static uint32_t checks;
+static uint32_t check_failures;
+
+static struct {
+    void *ptr;
+    size_t size;
+    uint8_t fill;
+} churn[CHURN_SLOTS];
+
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+
+system_config_t system_config;
+system_status_t system_status;
+
+/******************************************************************************/
+/*                                FUNCTIONS                                   */
+/******************************************************************************/
+
+void *__real_mem_heap_lvgl_alloc(size_t size);
+void __real_mem_heap_lvgl_free(void *ptr);
+
+static void heap_check(const char *step) {
+    checks++;
+    if (mem_heap_check() != 0) {
+        if (check_failures++ < 10) {
+            printf("heap inconsistent after %s\n", step);
+        }
+    }
+}
+
+void *__wrap_mem_heap_lvgl_alloc(size_t size) {
+    void *ptr = __real_mem_heap_lvgl_alloc(size);
+    heap_check("an LVGL allocation");
+    return ptr;
+}
+
+void __wrap_mem_heap_lvgl_free(void *ptr) {
+    __real_mem_heap_lvgl_free(ptr);
+    heap_check("an LVGL release");
+}
+
+static void print_heap(const char *phase) {
+    mem_heap_stats_t stats;
+    mem_heap_get_stats(&stats);
+    printf("%-8s used %6lu (RTOS %6lu, LVGL %6lu, app %5lu), peak %6lu, largest free %6lu, %lu free blocks, %u%% fragmentation\n",
+           phase, (unsigned long) stats.used, (unsigned long) stats.tags[MEM_TAG_RTOS].used,
+           (unsigned long) stats.tags[MEM_TAG_LVGL].used, (unsigned long) stats.tags[MEM_TAG_APP].used,
+           (unsigned long) stats.peak, (unsigned long) stats.largest_free,
+           (unsigned long) stats.free_blocks, stats.fragmentation);
+}
+
+/**
+ * @brief  osThreadNew() with a dynamic stack: stack first, then the TCB (stack grows down)
+ */
+static void rtos_task(const char *name, size_t stack_size) {
+    TEST_CHECK(pvPortMalloc(stack_size) != NULL);
+    heap_check(name);
+    TEST_CHECK(pvPortMalloc(RTOS_TCB_SIZE) != NULL);
+    heap_check(name);
+}
+
+/**
+ * @brief  app_main_init() then the default task of main()
+ */
+static void boot_rtos(void) {
+    rtos_task("user_intf task", 2048);
+    TEST_CHECK(pvPortMalloc(RTOS_QUEUE_SIZE + COMMAND_QUEUE_LENGTH * COMMAND_JOB_SIZE) != NULL);
+    heap_check("command queue");
+    rtos_task("command task", 2048);
+    rtos_task("communication task", 2048);
+    rtos_task("lvgl task", 8192);
+    rtos_task("default task", 128 * 4);
+}
+
+/**
+ * @brief  lvgl_task() of ui_control.c up to its loop
+ */
+static void boot_lvgl(void) {
+    memset(&system_config, 0, sizeof(system_config));
+    system_config.manufacturer_id = JUER_MARINE_ID;
+    system_config.screen_mode = BIG_NUMBER_MODE;
+    system_config.set_point = 100;
+    memset(&system_status, 0, sizeof(system_status));
+    system_status.dive_state = SURFACE_CONTROL_STATE;
+
+    host_tick_freeze();
+    lv_init();
+    lv_port_disp_init();
+    lv_port_img_init();
+    lv_port_fs_init();
+
+    /* W25Q mutex, created by res_pack_init() */
+    TEST_CHECK(pvPortMalloc(RTOS_QUEUE_SIZE) != NULL);
+    heap_check("w25qx mutex");
+    resource_init();
+
+    lv_port_disp_set_rotation(LV_DISP_ROT_270);
+    ui_utils_init();
+    ui_splash_init();
+    ui_big_number_init();
+}
+
+/**
+ * @brief  Application buffers of random sizes allocated and released, contents checked
+ */
+static void run_churn(void) {
+    srand(1);
+    for (uint32_t step = 0; step < CHURN_STEPS; step++) {
+        int i = rand() % CHURN_SLOTS;
+
+        if (churn[i].ptr != NULL) {
+            const uint8_t *data = churn[i].ptr;
+            for (size_t k = 0; k < churn[i].size; k++) {
+                if (data[k] != churn[i].fill) {
+                    TEST_CHECK(!"block content overwritten");
+                    break;
+                }
+            }
+            mem_heap_free(churn[i].ptr);
+            churn[i].ptr = NULL;
+            heap_check("an application release");
+            continue;
+        }
+
+        /* Mostly small, sometimes OTA and transport sized */
+        size_t size = (rand() % 8 == 0) ? (size_t) (rand() % 4096 + 1) : (size_t) (rand() % 256 + 1);
+        churn[i].ptr = mem_heap_alloc(MEM_TAG_APP, size);
+        heap_check("an application allocation");
+        if (churn[i].ptr != NULL) {
+            TEST_CHECK(((uintptr_t) churn[i].ptr & 7) == 0);
+            TEST_CHECK(mem_heap_block_size(churn[i].ptr) >= size);
+            churn[i].size = size;
+            churn[i].fill = (uint8_t) rand();
+            memset(churn[i].ptr, churn[i].fill, size);
+        }
+    }
+
+    for (int i = 0; i < CHURN_SLOTS; i++) {
+        mem_heap_free(churn[i].ptr);
+        churn[i].ptr = NULL;
+        heap_check("an application release");
+    }
+}
+
+/******************************************************************************/
+
+int main(int argc, char **argv) {
+    mem_heap_stats_t stats;
+    replay_stats_t replay;
+
+    if (argc < 3) {
+        fprintf(stderr, "usage: %s out_dir sequence\n", argv[0]);
+        return 2;
+    }
+
+    boot_rtos();
+    print_heap("rtos");
+    boot_lvgl();
+    print_heap("boot");
+
+    mem_heap_get_stats(&stats);
+    TEST_CHECK(stats.tags[MEM_TAG_LVGL].failed == 0);
+    TEST_CHECK(stats.tags[MEM_TAG_LVGL].used > 0);
+    uint32_t boot_used = stats.used;
+
+    memset(&replay, 0, sizeof(replay));
+    TEST_CHECK(replay_file(argv[2], argv[1], &replay) == 0);
+    TEST_CHECK(replay.frames > 0);
+    print_heap("replay");
+
+    mem_heap_get_stats(&stats);
+    uint32_t replay_used = stats.used;
+    run_churn();
+    print_heap("churn");
+
+    /* Every application block came back, the LVGL state is the one after the replay */
+    mem_heap_get_stats(&stats);
+    TEST_CHECK(stats.used == replay_used);
+    TEST_CHECK(stats.tags[MEM_TAG_APP].used == 0);
+    TEST_CHECK(stats.tags[MEM_TAG_LVGL].failed == 0);
+    TEST_CHECK(stats.peak < stats.total);
+
+    printf("%lu heap checks, %lu failed, boot %lu bytes, peak %lu of %lu bytes\n",
+           (unsigned long) checks, (unsigned long) check_failures, (unsigned long) boot_used,
+           (unsigned long) stats.peak, (unsigned long) stats.total);
+    TEST_CHECK(check_failures == 0);
+
+    return TEST_RESULT();
+}
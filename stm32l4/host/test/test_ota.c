@@ -0,0 +1,464 @@
+/*
+ *  test_ota.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+
+#include <stdlib.h>
+#include <string.h>
+#include "app_config.h"
+#include "command.h"
+#include "communication.h"
+#include "crc.h"
+#include "ota.h"
+#include "test.h"
+
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+
+/*
+ * ota.c built with OTA_FLASH_FILE and OTA_CONFIG_FILE: the OTA commands go
+ * through the handlers it registers, the W25Q is a file where programming
+ * only clears bits. The file starts filled with zeros and each image is
+ * written over the previous one, a sector the erase-ahead missed corrupts
+ * the image. The bootloader view is checked at the end: the image bytes at
+ * OTA_FIRMWARE_ADDRESS and the configuration page.
+ * The status frames the handlers answer with are collected by
+ * communication_send(). A model of the ESP32 follows them: OTA_PARTS_AHEAD
+ * parts in flight, back to the bytes written on a refused part, again after
+ * a timeout when a part or its status is lost on the line.
+ */
+#define IMAGE_SIZE         (200 * 1024 + 123)
+#define BENCH_SIZE         (900 * 1024)
+#define FLASH_FILE_SIZE    (OTA_FIRMWARE_ADDRESS + OTA_FIRMWARE_MAX_SIZE + OTA_SECTOR_SIZE)
+#define STATUS_LENGTH      (8)
+#define STATUS_QUEUE       (4)
+
+typedef struct {
+    uint8_t command;
+    uint8_t result;                  /* 0 accepted, 1 refused */
+    uint8_t state;
+    uint32_t received;
+} status_t;
+
+/* Parts and statuses lost on the line, by their index in the transfer */
+typedef struct {
+    const uint32_t *parts;
+    uint32_t part_count;
+    const uint32_t *statuses;
+    uint32_t status_count;
+} losses_t;
+
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+
+static command_handler_t handlers[COMMAND_COUNT];
+static uint8_t image[OTA_FIRMWARE_MAX_SIZE];
+static uint8_t readback[OTA_FIRMWARE_MAX_SIZE + OTA_SECTOR_SIZE];
+static uint32_t erase_lead_max;      /* Largest erased - received seen during a download */
+
+/* Status frames not read yet, the oldest dropped when full */
+static status_t statuses[STATUS_QUEUE];
+static uint32_t status_head;
+static uint32_t status_count;
+static uint32_t status_errors;       /* Malformed frames */
+
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+
+system_status_t system_status;
+
+/******************************************************************************/
+/*                                FUNCTIONS                                   */
+/******************************************************************************/
+
+/* The registry of command.c, the handlers are called directly */
+int command_register(uint8_t command, const char *name, command_handler_t handler, uint8_t mode) {
+    (void) name;
+    (void) mode;
+    handlers[command] = handler;
+    return 0;
+}
+
+/* The status frames to the ESP32 */
+int communication_send(const uint8_t *packet, uint16_t length) {
+    status_t *status;
+
+    if ((length != STATUS_LENGTH) || (packet[0] != COMMAND_OTA_STATUS)) {
+        status_errors++;
+        return -1;
+    }
+    if (status_count == STATUS_QUEUE) {
+        status_head = (status_head + 1) % STATUS_QUEUE;
+        status_count--;
+    }
+    status = &statuses[(status_head + status_count) % STATUS_QUEUE];
+    status->command = packet[1];
+    status->result = packet[2];
+    status->state = packet[3];
+    status->received = packet[4] | (packet[5] << 8) | (packet[6] << 16) | ((uint32_t) packet[7] << 24);
+    status_count++;
+    return 0;
+}
+
+/* Oldest status not read, false if none */
+static bool read_status(status_t *status) {
+    if (status_count == 0) {
+        return false;
+    }
+    *status = statuses[status_head];
+    status_head = (status_head + 1) % STATUS_QUEUE;
+    status_count--;
+    return true;
+}
+
+/* Status of the last command, the queue is emptied */
+static status_t last_status(void) {
+    status_t status = { 0 };
+
+    TEST_CHECK(status_count > 0);
+    while (read_status(&status)) {
+    }
+    return status;
+}
+
+static void put_u32(uint8_t *data, uint32_t value) {
+    data[0] = (uint8_t) value;
+    data[1] = (uint8_t) (value >> 8);
+    data[2] = (uint8_t) (value >> 16);
+    data[3] = (uint8_t) (value >> 24);
+}
+
+static int send_start(uint32_t size, uint32_t sum, uint32_t version) {
+    uint8_t payload[12];
+
+    put_u32(&payload[0], size);
+    put_u32(&payload[4], sum);
+    put_u32(&payload[8], version);
+    return handlers[COMMAND_OTA_START](payload, sizeof(payload));
+}
+
+static int send_part(uint32_t offset, uint32_t size) {
+    static uint8_t payload[4 + OTA_PART_LENGTH];
+    ota_status_t status;
+
+    put_u32(payload, offset);
+    memcpy(&payload[4], &image[offset], size);
+    int ret = handlers[COMMAND_OTA_DATA](payload, (uint16_t) (4 + size));
+
+    ota_get_status(&status);
+    if ((status.state == OTA_RECEIVE_STATE) && (status.erased - status.received > erase_lead_max)) {
+        erase_lead_max = status.erased - status.received;
+    }
+    return ret;
+}
+
+static int send_image(uint32_t size) {
+    for (uint32_t offset = 0; offset < size; offset += OTA_PART_LENGTH) {
+        uint32_t part = (size - offset > OTA_PART_LENGTH) ? OTA_PART_LENGTH : (size - offset);
+        if (send_part(offset, part) != 0) {
+            return -1;
+        }
+    }
+    return 0;
+}
+
+static int send_end(void) {
+    return handlers[COMMAND_OTA_END](NULL, 0);
+}
+
+static uint32_t sum(const uint8_t *data, uint32_t size) {
+    uint32_t value = 0;
+    for (uint32_t i = 0; i < size; i++) {
+        value += data[i];
+    }
+    return value;
+}
+
+static void make_image(uint32_t size, unsigned seed) {
+    srand(seed);
+    for (uint32_t i = 0; i < size; i++) {
+        image[i] = (uint8_t) rand();
+    }
+}
+
+static int read_file(const char *path, uint32_t offset, uint8_t *data, uint32_t size) {
+    FILE *file = fopen(path, "rb");
+    int ret = -1;
+
+    if (file != NULL) {
+        ret = ((fseek(file, offset, SEEK_SET) == 0) && (fread(data, 1, size, file) == size)) ? 0 : -1;
+        fclose(file);
+    }
+    return ret;
+}
+
+/**
+ * @brief  What the bootloader reads after a download
+ */
+static void check_installed(uint32_t size, uint32_t version) {
+    ext_general_cfg_t cfg;
+    uint32_t sectors = (size + OTA_SECTOR_SIZE - 1) & ~(OTA_SECTOR_SIZE - 1);
+
+    TEST_CHECK(read_file(OTA_FLASH_FILE, OTA_FIRMWARE_ADDRESS, readback, sectors + OTA_SECTOR_SIZE) == 0);
+    TEST_CHECK(memcmp(readback, image, size) == 0);
+    for (uint32_t i = size; i < sectors; i++) {
+        TEST_CHECK(readback[i] == 0xFF);
+    }
+
+    TEST_CHECK(read_file(OTA_CONFIG_FILE, 0, (uint8_t *) &cfg, sizeof(cfg)) == 0);
+    TEST_CHECK(cfg.reboot_cause == ETX_OTA_REQUEST);
+    TEST_CHECK(cfg.slot_table.fw_size == (int32_t) size);
+    TEST_CHECK(cfg.slot_table.fw_crc == sum(image, size));
+    TEST_CHECK(cfg.slot_table.reserved1 == MAGIC_NUMBER);
+    TEST_CHECK(cfg.slot_table.reserved2 == MAGIC_NUMBER);
+    TEST_CHECK(cfg.slot_table.fw_crc32 == crc32_mpeg2(CRC32_MPEG2_INIT, image, size));
+    TEST_CHECK(cfg.slot_table.version == version);
+}
+
+/**
+ * @brief  A download in order, then the bootloader view
+ */
+static void check_download(uint32_t size, unsigned seed, uint32_t version) {
+    ext_general_cfg_t cfg;
+    ota_status_t status;
+
+    make_image(size, seed);
+    erase_lead_max = 0;
+    TEST_CHECK(send_start(size, sum(image, size), version) == 0);
+
+    /* The request of the previous download is withdrawn before its file is erased */
+    TEST_CHECK((read_file(OTA_CONFIG_FILE, 0, (uint8_t *) &cfg, sizeof(cfg)) != 0)
+               || (cfg.reboot_cause != ETX_OTA_REQUEST));
+    TEST_CHECK(send_image(size) == 0);
+    TEST_CHECK(send_end() == 0);
+
+    ota_get_status(&status);
+    TEST_CHECK(status.state == OTA_DONE_STATE);
+    TEST_CHECK(status.received == size);
+    TEST_CHECK(status.erased >= size);
+    TEST_CHECK(status.erased < size + OTA_SECTOR_SIZE);
+    TEST_CHECK(erase_lead_max <= OTA_ERASE_AHEAD + OTA_SECTOR_SIZE);
+    check_installed(size, version);
+}
+
+/**
+ * @brief  Parts sent again, out of order, out of the image
+ */
+static void check_protocol(void) {
+    ext_general_cfg_t cfg;
+    ota_status_t status;
+    uint32_t size = 5 * OTA_PART_LENGTH + 17;
+
+    make_image(size, 7);
+
+    /* No download started */
+    TEST_CHECK(send_part(0, OTA_PART_LENGTH) != 0);
+    TEST_CHECK(send_end() != 0);
+    status_t reply = last_status();
+    TEST_CHECK((reply.command == COMMAND_OTA_END) && (reply.result == 1));
+
+    /* Sizes */
+    TEST_CHECK(handlers[COMMAND_OTA_START](image, 7) != 0);
+    TEST_CHECK(send_start(0, 0, 0) != 0);
+    TEST_CHECK(send_start(OTA_FIRMWARE_MAX_SIZE + 1, 0, 0) != 0);
+    ota_get_status(&status);
+    TEST_CHECK(status.state == OTA_FAILED_STATE);
+    reply = last_status();
+    TEST_CHECK((reply.command == COMMAND_OTA_START) && (reply.result == 1) && (reply.state == OTA_FAILED_STATE));
+
+    /* A part sent again is acknowledged, a gap is refused without failing */
+    TEST_CHECK(send_start(size, sum(image, size), 3) == 0);
+    TEST_CHECK(send_part(0, OTA_PART_LENGTH) == 0);
+    TEST_CHECK(send_part(0, OTA_PART_LENGTH) == 0);
+    TEST_CHECK(send_part(2 * OTA_PART_LENGTH, OTA_PART_LENGTH) != 0);
+    ota_get_status(&status);
+    TEST_CHECK(status.state == OTA_RECEIVE_STATE);
+    TEST_CHECK(status.received == OTA_PART_LENGTH);
+    reply = last_status();
+    TEST_CHECK((reply.command == COMMAND_OTA_DATA) && (reply.result == 1));
+    TEST_CHECK((reply.state == OTA_RECEIVE_STATE) && (reply.received == OTA_PART_LENGTH));
+
+    /* A rollback waits for the download, END before the last part fails it */
+    TEST_CHECK(handlers[COMMAND_OTA_ROLLBACK](NULL, 0) != 0);
+    TEST_CHECK(send_end() != 0);
+    ota_get_status(&status);
+    TEST_CHECK(status.state == OTA_FAILED_STATE);
+
+    /* Past the end of the image */
+    TEST_CHECK(send_start(size, sum(image, size), 3) == 0);
+    TEST_CHECK(send_image(size - 17) == 0);
+    TEST_CHECK(send_part(size - 17, 18) != 0);
+    ota_get_status(&status);
+    TEST_CHECK(status.state == OTA_FAILED_STATE);
+
+    /* Wrong sum: no configuration written */
+    TEST_CHECK(remove(OTA_CONFIG_FILE) == 0);
+    TEST_CHECK(send_start(size, sum(image, size) + 1, 3) == 0);
+    TEST_CHECK(send_image(size) == 0);
+    TEST_CHECK(send_end() != 0);
+    TEST_CHECK(fopen(OTA_CONFIG_FILE, "rb") == NULL);
+
+    /* The same image again */
+    TEST_CHECK(send_start(size, sum(image, size), 3) == 0);
+    TEST_CHECK(send_image(size) == 0);
+    TEST_CHECK(send_end() == 0);
+    check_installed(size, 3);
+    reply = last_status();
+    TEST_CHECK((reply.command == COMMAND_OTA_END) && (reply.result == 0));
+    TEST_CHECK((reply.state == OTA_DONE_STATE) && (reply.received == size));
+    TEST_CHECK(handlers[COMMAND_OTA_ROLLBACK](NULL, 0) != 0);
+
+    /* A refused start keeps the request, an accepted one withdraws it */
+    TEST_CHECK(send_start(0, 0, 0) != 0);
+    TEST_CHECK(read_file(OTA_CONFIG_FILE, 0, (uint8_t *) &cfg, sizeof(cfg)) == 0);
+    TEST_CHECK(cfg.reboot_cause == ETX_OTA_REQUEST);
+    TEST_CHECK(send_start(size, sum(image, size), 4) == 0);
+    TEST_CHECK(read_file(OTA_CONFIG_FILE, 0, (uint8_t *) &cfg, sizeof(cfg)) == 0);
+    TEST_CHECK(cfg.reboot_cause == ETX_NORMAL_BOOT);
+    TEST_CHECK(cfg.slot_table.fw_size == (int32_t) size);
+}
+
+static bool lost(uint32_t index, const uint32_t *list, uint32_t count) {
+    for (uint32_t i = 0; i < count; i++) {
+        if (list[i] == index) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief  The ESP32 sending an image on a lossy line, led by the status frames
+ * @retval Parts sent again
+ */
+static uint32_t send_lossy(uint32_t size, const losses_t *losses) {
+    uint32_t next = 0;               /* Next offset to send */
+    uint32_t acked = 0;              /* Bytes written, from the last status */
+    uint32_t parts = 0, replies = 0, resent = 0;
+    bool rewound = false;            /* Went back, the other refused parts in flight are ignored */
+    status_t status;
+
+    while ((acked < size) && (parts < 4 * size / OTA_PART_LENGTH + 16)) {
+        /* Fill the window */
+        if ((next < size) && (next < acked + OTA_PARTS_AHEAD * OTA_PART_LENGTH)) {
+            uint32_t part = (size - next > OTA_PART_LENGTH) ? OTA_PART_LENGTH : (size - next);
+
+            if (!lost(parts++, losses->parts, losses->part_count)) {
+                uint32_t before = status_count;
+                send_part(next, part);
+                TEST_CHECK(status_count == before + 1);
+                if (lost(replies++, losses->statuses, losses->status_count)) {
+                    status_count--;
+                }
+            }
+            next += part;
+            continue;
+        }
+
+        /* Window full, nothing came back: timeout, again from the bytes written */
+        if (!read_status(&status)) {
+            resent += (next - acked + OTA_PART_LENGTH - 1) / OTA_PART_LENGTH;
+            next = acked;
+            rewound = false;
+            continue;
+        }
+
+        TEST_CHECK((status.command == COMMAND_OTA_DATA) && (status.state == OTA_RECEIVE_STATE));
+        TEST_CHECK(status.received >= acked);
+        acked = status.received;
+        if (status.result == 0) {
+            rewound = false;
+        }
+        else if (!rewound) {
+            /* A part before this one was lost */
+            resent += (next - acked + OTA_PART_LENGTH - 1) / OTA_PART_LENGTH;
+            next = acked;
+            rewound = true;
+        }
+    }
+
+    return resent;
+}
+
+/**
+ * @brief  Parts and statuses lost in the middle of the transfer, during the erase-ahead
+ */
+static void check_resume(void) {
+    static const uint32_t one_part[] = { 100 };
+    static const uint32_t parts[] = { 3, 4, 63, 64, 65, 150 };
+    static const uint32_t two_statuses[] = { 70, (IMAGE_SIZE - 1) / OTA_PART_LENGTH };
+    static const uint32_t status_list[] = { 10, 11, 120, 199 };
+    static const losses_t cases[] = {
+        { one_part, 1, NULL, 0 },
+        { parts, sizeof(parts) / sizeof(parts[0]), NULL, 0 },
+        { NULL, 0, two_statuses, 2 },
+        { parts, sizeof(parts) / sizeof(parts[0]), status_list, sizeof(status_list) / sizeof(status_list[0]) },
+    };
+    ota_status_t status;
+    uint32_t resent[sizeof(cases) / sizeof(cases[0])];
+
+    for (uint32_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        make_image(IMAGE_SIZE, 10 + i);
+        TEST_CHECK(send_start(IMAGE_SIZE, sum(image, IMAGE_SIZE), 7 + i) == 0);
+        TEST_CHECK(last_status().result == 0);
+
+        resent[i] = send_lossy(IMAGE_SIZE, &cases[i]);
+        ota_get_status(&status);
+        TEST_CHECK(status.state == OTA_RECEIVE_STATE);
+        TEST_CHECK(status.received == IMAGE_SIZE);
+        TEST_CHECK(resent[i] >= cases[i].part_count);
+        TEST_CHECK(resent[i] <= 2 * OTA_PARTS_AHEAD * (cases[i].part_count + cases[i].status_count));
+
+        TEST_CHECK(send_end() == 0);
+        status_t reply = last_status();
+        TEST_CHECK((reply.command == COMMAND_OTA_END) && (reply.state == OTA_DONE_STATE));
+        check_installed(IMAGE_SIZE, 7 + i);
+    }
+    TEST_CHECK(status_errors == 0);
+
+    /* A status lost in the middle is covered by the next one, the last one by the timeout */
+    TEST_CHECK(resent[2] == 1);
+
+    printf("%u parts, %u ahead, parts resent: 1 part lost %lu, 6 parts %lu, 2 statuses %lu, 6 parts and 4 statuses %lu\n",
+           (IMAGE_SIZE + OTA_PART_LENGTH - 1) / OTA_PART_LENGTH, OTA_PARTS_AHEAD,
+           (unsigned long) resent[0], (unsigned long) resent[1], (unsigned long) resent[2], (unsigned long) resent[3]);
+}
+
+/******************************************************************************/
+
+int main(void) {
+    /* A W25Q holding something else than erased bytes */
+    FILE *file = fopen(OTA_FLASH_FILE, "wb");
+    for (uint32_t i = 0; i < FLASH_FILE_SIZE; i++) {
+        fputc(0, file);
+    }
+    fclose(file);
+    remove(OTA_CONFIG_FILE);
+
+    ota_init();
+
+    check_download(IMAGE_SIZE, 1, 2);
+    check_download(OTA_PART_LENGTH, 2, 0);
+    check_download(1, 3, 4);
+    check_download(IMAGE_SIZE / 2, 4, 5);
+    check_protocol();
+    check_resume();
+
+    /* End to end on the file-backed model: command handling, erase-ahead, programming, check */
+    double start = test_now();
+    check_download(BENCH_SIZE, 5, 6);
+    double elapsed = test_now() - start;
+    printf("%u bytes in %.1f ms, %.1f MB/s on the host model\n", BENCH_SIZE, elapsed * 1e3, BENCH_SIZE / elapsed / 1e6);
+
+    remove(OTA_FLASH_FILE);
+    remove(OTA_CONFIG_FILE);
+    return TEST_RESULT();
+}
@@ -0,0 +1,243 @@
+/*
+ *  test_ring_buffer.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+
+#include <pthread.h>
+#include <sched.h>
+#include <string.h>
+#include "ring_buffer.h"
+#include "test.h"
+
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+
+#define RING_SIZE          (64)
+#define STREAM_SIZE        (16 * 1024 * 1024)    /* Bytes sent through the threaded ring */
+#define THREAD_RING_SIZE   (4096)                /* FIFO_SIZE */
+
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+
+static uint8_t storage[RING_SIZE];
+static ring_buffer_t ring;
+
+static uint8_t thread_storage[THREAD_RING_SIZE];
+static ring_buffer_t thread_ring;
+
+/******************************************************************************/
+/*                                FUNCTIONS                                   */
+/******************************************************************************/
+
+static uint8_t stream_byte(uint32_t index) {
+    return (uint8_t) ((index * 2654435761u) >> 24);
+}
+
+static void fill(uint8_t *data, uint32_t length, uint32_t first) {
+    for (uint32_t i = 0; i < length; i++) {
+        data[i] = stream_byte(first + i);
+    }
+}
+
+static int matches(const uint8_t *data, uint32_t length, uint32_t first) {
+    for (uint32_t i = 0; i < length; i++) {
+        if (data[i] != stream_byte(first + i)) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/**
+ * @brief  Full, empty and wrapping with write/read
+ */
+static void test_write_read(void) {
+    uint8_t in[RING_SIZE * 2];
+    uint8_t out[RING_SIZE * 2];
+
+    TEST_CHECK(ring_buffer_init(&ring, storage, 48) != 0);
+    TEST_CHECK(ring_buffer_init(&ring, storage, 0) != 0);
+    TEST_CHECK(ring_buffer_init(&ring, storage, RING_SIZE) == 0);
+    TEST_CHECK((ring_buffer_count(&ring) == 0) && (ring_buffer_free(&ring) == RING_SIZE));
+    TEST_CHECK(ring_buffer_read(&ring, out, sizeof(out)) == 0);
+
+    /* Full: the rest is refused, nothing is overwritten */
+    fill(in, sizeof(in), 0);
+    TEST_CHECK(ring_buffer_write(&ring, in, RING_SIZE + 10) == RING_SIZE);
+    TEST_CHECK((ring_buffer_count(&ring) == RING_SIZE) && (ring_buffer_free(&ring) == 0));
+    TEST_CHECK(ring_buffer_write(&ring, in, 1) == 0);
+    TEST_CHECK(ring_buffer_read(&ring, out, sizeof(out)) == RING_SIZE);
+    TEST_CHECK(matches(out, RING_SIZE, 0));
+
+    /* Every offset and length across the end of the storage */
+    uint32_t next_in = 0, next_out = 0;
+    for (uint32_t offset = 0; offset < RING_SIZE; offset++) {
+        for (uint32_t length = 1; length <= RING_SIZE; length += 7) {
+            ring_buffer_init(&ring, storage, RING_SIZE);
+            atomic_store(&ring.head, offset);
+            atomic_store(&ring.tail, offset);
+            fill(in, length, next_in);
+            TEST_CHECK(ring_buffer_write(&ring, in, length) == length);
+            next_in += length;
+            TEST_CHECK(ring_buffer_count(&ring) == length);
+            TEST_CHECK(ring_buffer_read(&ring, out, length) == length);
+            TEST_CHECK(matches(out, length, next_out));
+            next_out += length;
+        }
+    }
+
+    /* The free running indices wrap at 2^32 */
+    ring_buffer_init(&ring, storage, RING_SIZE);
+    atomic_store(&ring.head, UINT32_MAX - 20);
+    atomic_store(&ring.tail, UINT32_MAX - 20);
+    fill(in, 50, 1000);
+    TEST_CHECK(ring_buffer_write(&ring, in, 50) == 50);
+    TEST_CHECK((ring_buffer_count(&ring) == 50) && (ring_buffer_free(&ring) == RING_SIZE - 50));
+    TEST_CHECK(ring_buffer_read(&ring, out, 30) == 30);
+    TEST_CHECK(ring_buffer_read(&ring, &out[30], 30) == 20);
+    TEST_CHECK(matches(out, 50, 1000));
+    TEST_CHECK(atomic_load(&ring.tail) == 29);
+}
+
+/**
+ * @brief  In place access on both sides
+ */
+static void test_peek_reserve(void) {
+    const uint8_t *span;
+    uint8_t *space;
+    uint8_t in[RING_SIZE];
+
+    ring_buffer_init(&ring, storage, RING_SIZE);
+    TEST_CHECK(ring_buffer_peek_contiguous(&ring, &span) == 0);
+    TEST_CHECK((ring_buffer_reserve_contiguous(&ring, &space) == RING_SIZE) && (space == storage));
+
+    /* 40 bytes written at offset 50: reserve stops at the end of the storage */
+    atomic_store(&ring.head, 50);
+    atomic_store(&ring.tail, 50);
+    TEST_CHECK((ring_buffer_reserve_contiguous(&ring, &space) == RING_SIZE - 50) && (space == &storage[50]));
+    fill(space, 14, 0);
+    ring_buffer_produce(&ring, 14);
+    TEST_CHECK((ring_buffer_reserve_contiguous(&ring, &space) == 50) && (space == storage));
+    fill(space, 26, 14);
+    ring_buffer_produce(&ring, 26);
+    TEST_CHECK(ring_buffer_count(&ring) == 40);
+
+    /* Reserve only offers what the consumer released */
+    TEST_CHECK(ring_buffer_reserve_contiguous(&ring, &space) == RING_SIZE - 40);
+
+    /* Peek gives the tail of the storage first, a partial commit keeps the rest */
+    TEST_CHECK((ring_buffer_peek_contiguous(&ring, &span) == 14) && (span == &storage[50]));
+    TEST_CHECK(matches(span, 14, 0));
+    ring_buffer_commit(&ring, 10);
+    TEST_CHECK((ring_buffer_peek_contiguous(&ring, &span) == 4) && matches(span, 4, 10));
+    ring_buffer_commit(&ring, 4);
+    TEST_CHECK((ring_buffer_peek_contiguous(&ring, &span) == 26) && (span == storage) && matches(span, 26, 14));
+    ring_buffer_commit(&ring, 26);
+    TEST_CHECK(ring_buffer_count(&ring) == 0);
+    TEST_CHECK(ring_buffer_peek_contiguous(&ring, &span) == 0);
+
+    /* Mixed: write then peek, reserve then read */
+    fill(in, 20, 500);
+    TEST_CHECK(ring_buffer_write(&ring, in, 20) == 20);
+    TEST_CHECK((ring_buffer_peek_contiguous(&ring, &span) == 20) && (span == &storage[26]) && matches(span, 20, 500));
+    ring_buffer_commit(&ring, 20);
+    TEST_CHECK((ring_buffer_reserve_contiguous(&ring, &space) == RING_SIZE - 46) && (space == &storage[46]));
+    fill(space, 18, 600);
+    ring_buffer_produce(&ring, 18);
+    TEST_CHECK(ring_buffer_read(&ring, in, sizeof(in)) == 18);
+    TEST_CHECK(matches(in, 18, 600) && (ring_buffer_count(&ring) == 0));
+}
+
+/**
+ * @brief  DMA interrupt side: chunks of varying size, reserve/produce and write
+ */
+static void *producer(void *arg) {
+    uint32_t sent = 0;
+    uint32_t round = 0;
+    (void) arg;
+
+    while (sent < STREAM_SIZE) {
+        uint32_t length = ((round++ * 37) % 700) + 1;
+        if (length > STREAM_SIZE - sent) {
+            length = STREAM_SIZE - sent;
+        }
+
+        if (round & 1) {
+            uint8_t *space;
+            uint32_t chunk = ring_buffer_reserve_contiguous(&thread_ring, &space);
+            if (chunk > length) {
+                chunk = length;
+            }
+            fill(space, chunk, sent);
+            ring_buffer_produce(&thread_ring, chunk);
+            sent += chunk;
+        }
+        else {
+            uint8_t data[700];
+            fill(data, length, sent);
+            sent += ring_buffer_write(&thread_ring, data, length);
+        }
+
+        if (ring_buffer_free(&thread_ring) == 0) {
+            sched_yield();
+        }
+    }
+    return NULL;
+}
+
+/**
+ * @brief  One producer thread and the consumer: no byte lost, duplicated or reordered
+ */
+static void test_threads(void) {
+    pthread_t thread;
+    uint32_t received = 0;
+    uint32_t errors = 0;
+    uint32_t round = 0;
+
+    ring_buffer_init(&thread_ring, thread_storage, THREAD_RING_SIZE);
+    double start = test_now();
+    pthread_create(&thread, NULL, producer, NULL);
+
+    while (received < STREAM_SIZE) {
+        if (round++ & 1) {
+            const uint8_t *span;
+            uint32_t length = ring_buffer_peek_contiguous(&thread_ring, &span);
+            errors += !matches(span, length, received);
+            ring_buffer_commit(&thread_ring, length);
+            received += length;
+        }
+        else {
+            uint8_t data[300];
+            uint32_t length = ring_buffer_read(&thread_ring, data, sizeof(data));
+            errors += !matches(data, length, received);
+            received += length;
+        }
+
+        if (ring_buffer_count(&thread_ring) == 0) {
+            sched_yield();
+        }
+    }
+    pthread_join(thread, NULL);
+
+    printf("threads: %u MiB in %.3f s, %lu errors\n", STREAM_SIZE >> 20, test_now() - start, (unsigned long) errors);
+    TEST_CHECK(errors == 0);
+    TEST_CHECK(received == STREAM_SIZE);
+    TEST_CHECK(ring_buffer_count(&thread_ring) == 0);
+}
+
+/******************************************************************************/
+
+int main(void) {
+    test_write_read();
+    test_peek_reserve();
+    test_threads();
+
+    return TEST_RESULT();
+}
@@ -0,0 +1,503 @@
+/*
+ *  test_slots.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+
+#include <setjmp.h>
+#include <stdlib.h>
+#include <string.h>
+#include "crc.h"
+#include "slots.h"
+#include "test.h"
+
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+
+/*
+ * Power cuts through the slot state machine. The device model holds what
+ * survives a reset: the internal flash, the W25Q (slot table sectors,
+ * previous slot, OTA file), the configuration page and the boot mailbox,
+ * which a power cut clears. boot() follows app_main_check_reboot() of the
+ * bootloader with model storage, each page erase or program and each word of
+ * a table record is a step, power is cut before any of them: the page is
+ * left half done, the record torn, the sector holds garbage.
+ * Every scenario is run once without a cut to count the steps, then with a
+ * cut at each step, the mailbox lost (power) or kept (reset), and optionally
+ * a second cut as long into the recovery. At each jump the application area
+ * must hold a whole known image, the one the table names, and every run must
+ * end in the state of the run without a cut.
+ */
+#define PAGE_SIZE          (256)
+#define APP_SIZE           (PAGE_SIZE * 16)
+#define RECORDS_PER_SECTOR (4)           /* Small, the log changes sector during a scenario */
+#define SECTOR_SIZE        (RECORDS_PER_SECTOR * sizeof(slot_table_t))
+#define MAX_BOOTS          (20)
+
+enum {
+    IMAGE_FACTORY = 0,
+    IMAGE_UPDATE,
+    IMAGE_BAD,                       /* Runs, never confirms */
+    IMAGE_COUNT,
+};
+
+typedef struct {
+    uint8_t data[APP_SIZE];
+    slot_info_t info;
+} image_t;
+
+typedef struct {
+    uint8_t app[APP_SIZE];           /* Internal flash */
+    uint8_t table[2 * SECTOR_SIZE];  /* W25Q slot table sectors */
+    uint8_t previous[APP_SIZE];      /* W25Q previous slot */
+    uint8_t file[APP_SIZE];          /* W25Q OTA file */
+    int ota_request;                 /* The configuration page names the file */
+    slot_info_t request;
+    int mailbox_valid;               /* RTC backup registers, lost with the power */
+    uint32_t mailbox_event;          /* Reboot cause, as mapped by reboot_event() */
+} device_t;
+
+typedef struct {
+    const char *name;
+    uint32_t sequence;               /* Sequence of a first record, 0 for an empty table */
+    int setup_update;                /* Start with the update installed and confirmed */
+    int file;                        /* Image sent with the OTA, -1 for none */
+    int corrupt;                     /* The file does not match the request */
+    uint32_t event;                  /* Mailbox at the start */
+    int image;                       /* Running at the end */
+    uint32_t candidate;              /* Candidate state at the end */
+} scenario_t;
+
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+
+static image_t images[IMAGE_COUNT];
+static device_t dev;
+
+static jmp_buf power_off;
+static int32_t power_budget;         /* Steps before the cut, -1 for none */
+static int32_t power_recut;          /* Budget of a second cut, -1 for none */
+static uint32_t power_steps;
+static uint32_t power_cuts;
+
+static int table_read(uint32_t address, uint8_t *data, uint32_t size);
+static int table_write(uint32_t address, const uint8_t *data, uint32_t size);
+static int table_erase(uint32_t address);
+
+static const slots_io_t slots_io = {
+    .read = table_read,
+    .write = table_write,
+    .erase = table_erase,
+    .address = 0,
+    .sector_size = SECTOR_SIZE,
+};
+
+static const scenario_t scenarios[] = {
+    { "update", 0, 0, IMAGE_UPDATE, 0, SLOT_EVENT_OTA_REQUEST, IMAGE_UPDATE, SLOT_STATE_VALID },
+    { "unconfirmed", 0, 0, IMAGE_BAD, 0, SLOT_EVENT_OTA_REQUEST, IMAGE_FACTORY, SLOT_STATE_REJECTED },
+    { "corrupt", 0, 0, IMAGE_UPDATE, 1, SLOT_EVENT_OTA_REQUEST, IMAGE_FACTORY, SLOT_STATE_REJECTED },
+    { "rollback", 0, 1, -1, 0, SLOT_EVENT_ROLLBACK_REQUEST, IMAGE_FACTORY, SLOT_STATE_REJECTED },
+    { "wrap", 0xFFFFFFFE, 0, IMAGE_UPDATE, 0, SLOT_EVENT_OTA_REQUEST, IMAGE_UPDATE, SLOT_STATE_VALID },
+};
+
+/******************************************************************************/
+/*                                FUNCTIONS                                   */
+/******************************************************************************/
+
+/**
+ * @brief  Count a step, 1 if the power goes before it
+ */
+static int power_lost(void) {
+    if (power_budget == 0) {
+        return 1;
+    }
+    if (power_budget > 0) {
+        power_budget--;
+    }
+    power_steps++;
+    return 0;
+}
+
+static void power_fail(void) {
+    longjmp(power_off, 1);
+}
+
+static uint32_t image_crc(const uint8_t *data, int32_t size) {
+    return crc32_mpeg2(CRC32_MPEG2_INIT, data, (uint32_t) size);
+}
+
+/* W25Q slot table sectors */
+static int table_read(uint32_t address, uint8_t *data, uint32_t size) {
+    memcpy(data, &dev.table[address], size);
+    return 0;
+}
+
+static int table_write(uint32_t address, const uint8_t *data, uint32_t size) {
+    for (uint32_t i = 0; i < size; i += 4) {
+        if (power_lost()) {
+            power_fail();
+        }
+        for (uint32_t j = i; (j < i + 4) && (j < size); j++) {
+            dev.table[address + j] &= data[j];
+        }
+    }
+    return 0;
+}
+
+static int table_erase(uint32_t address) {
+    uint32_t start = address - address % SECTOR_SIZE;
+
+    if (power_lost()) {
+        for (uint32_t i = 0; i < SECTOR_SIZE; i++) {
+            dev.table[start + i] = (uint8_t) rand();
+        }
+        power_fail();
+    }
+    memset(&dev.table[start], 0xFF, SECTOR_SIZE);
+    return 0;
+}
+
+/**
+ * @brief  Program the application area page by page, like flash_prog.c
+ */
+static void program_app(const uint8_t *data, int32_t size) {
+    for (int32_t offset = 0; offset < size; offset += PAGE_SIZE) {
+        uint8_t page[PAGE_SIZE];
+        int32_t part = (size - offset < PAGE_SIZE) ? (size - offset) : PAGE_SIZE;
+
+        memset(page, 0xFF, sizeof(page));
+        memcpy(page, &data[offset], part);
+        if (memcmp(&dev.app[offset], page, PAGE_SIZE) == 0) {
+            continue;
+        }
+        if (power_lost()) {
+            memset(&dev.app[offset], 0xFF, PAGE_SIZE / 2);
+            power_fail();
+        }
+        memset(&dev.app[offset], 0xFF, PAGE_SIZE);
+        if (power_lost()) {
+            memcpy(&dev.app[offset], page, PAGE_SIZE / 2);
+            power_fail();
+        }
+        memcpy(&dev.app[offset], page, PAGE_SIZE);
+    }
+}
+
+/**
+ * @brief  Size of the application area, trailing erased words excluded
+ */
+static int32_t application_size(void) {
+    const uint32_t *word = (const uint32_t *) dev.app;
+    int32_t count = APP_SIZE / 4;
+
+    while ((count > 0) && (word[count - 1] == 0xFFFFFFFF)) {
+        count--;
+    }
+    return count * 4;
+}
+
+static int backup_application(const slot_info_t *current, slot_info_t *copied) {
+    int32_t size = current->size;
+
+    if ((size <= 0) || (size > APP_SIZE)) {
+        size = application_size();
+    }
+    if (size == 0) {
+        return -1;
+    }
+
+    copied->state = SLOT_STATE_VALID;
+    copied->size = size;
+    copied->crc32 = image_crc(dev.app, size);
+    copied->version = current->version;
+
+    if (power_lost()) {
+        for (uint32_t i = 0; i < APP_SIZE; i++) {
+            dev.previous[i] = (uint8_t) rand();
+        }
+        power_fail();
+    }
+    memset(dev.previous, 0xFF, sizeof(dev.previous));
+    for (int32_t offset = 0; offset < size; offset += PAGE_SIZE) {
+        int32_t part = (size - offset < PAGE_SIZE) ? (size - offset) : PAGE_SIZE;
+
+        if (power_lost()) {
+            power_fail();
+        }
+        memcpy(&dev.previous[offset], &dev.app[offset], part);
+    }
+    return (image_crc(dev.previous, size) == copied->crc32) ? 0 : -1;
+}
+
+static int install_image(int32_t *image_size) {
+    program_app(dev.file, dev.request.size);
+    *image_size = dev.request.size;
+    return (image_crc(dev.app, dev.request.size) == dev.request.crc32) ? 0 : -1;
+}
+
+static int restore_application(const slot_info_t *previous) {
+    program_app(dev.previous, previous->size);
+    return (image_crc(dev.app, previous->size) == previous->crc32) ? 0 : -1;
+}
+
+static void save_slots(slot_table_t *table, slot_table_t *saved) {
+    if (memcmp(table, saved, sizeof(*table)) == 0) {
+        return;
+    }
+    TEST_CHECK(slots_save(&slots_io, table) == 0);
+    *saved = *table;
+}
+
+/**
+ * @brief  Image entirely held by the application area, -1 if none
+ */
+static int running_image(void) {
+    for (int i = 0; i < IMAGE_COUNT; i++) {
+        if (memcmp(dev.app, images[i].data, images[i].info.size) == 0) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+/**
+ * @brief  The bootloader from the reset to the jump, app_main_check_reboot()
+ */
+static int boot(void) {
+    slot_table_t table, saved;
+    slot_info_t request = { 0 };
+    slot_info_t image;
+    uint32_t actions, event;
+    int32_t image_size = 0;
+
+    slots_load(&slots_io, &table);
+    saved = table;
+
+    event = dev.mailbox_valid ? dev.mailbox_event : SLOT_EVENT_BOOT;
+    if (dev.ota_request) {
+        request = dev.request;
+        if (!slots_request_done(&table, &request)) {
+            event = SLOT_EVENT_OTA_REQUEST;
+        }
+    }
+    else if (event == SLOT_EVENT_OTA_REQUEST) {
+        event = SLOT_EVENT_BOOT;
+    }
+
+    actions = slots_boot(&table, event, &request);
+    save_slots(&table, &saved);
+
+    if (actions & SLOT_ACTION_BACKUP) {
+        int ret = backup_application(&table.slot[SLOT_CURRENT], &image);
+
+        slots_backup_done(&table, (ret == 0) ? &image : NULL);
+        save_slots(&table, &saved);
+    }
+
+    if (actions & SLOT_ACTION_INSTALL) {
+        if (install_image(&image_size) == 0) {
+            image = request;
+            image.size = image_size;
+            image.crc32 = image_crc(dev.app, image_size);
+            actions |= slots_install_done(&table, &image);
+        }
+        else {
+            actions |= slots_install_done(&table, NULL);
+        }
+        save_slots(&table, &saved);
+    }
+
+    if (actions & SLOT_ACTION_RESTORE) {
+        int ret = restore_application(&table.slot[SLOT_PREVIOUS]);
+
+        slots_restore_done(&table, ret == 0);
+        save_slots(&table, &saved);
+    }
+
+    dev.mailbox_valid = 1;
+    dev.mailbox_event = (table.slot[SLOT_CURRENT].state == SLOT_STATE_TRIAL) ? SLOT_EVENT_TRIAL_BOOT
+                                                                             : SLOT_EVENT_CONFIRMED;
+
+    /* Jump: a whole image, the one the saved table names */
+    int running = running_image();
+    slot_table_t stored;
+    slots_load(&slots_io, &stored);
+    TEST_CHECK(running >= 0);
+    TEST_CHECK(memcmp(&stored, &table, sizeof(table)) == 0);
+    if ((running >= 0) && (stored.slot[SLOT_CURRENT].state != SLOT_STATE_EMPTY)) {
+        TEST_CHECK(stored.slot[SLOT_CURRENT].size == images[running].info.size);
+        TEST_CHECK(stored.slot[SLOT_CURRENT].crc32 == images[running].info.crc32);
+    }
+    return running;
+}
+
+/**
+ * @brief  Reset until the application runs without asking for another one
+ * @retval Running image, -1 if it never settles
+ */
+static int settle(int keep_mailbox) {
+    volatile int boots = 0;
+
+    if (setjmp(power_off) != 0) {
+        power_cuts++;
+        if (!keep_mailbox) {
+            dev.mailbox_valid = 0;
+        }
+        power_budget = power_recut;
+        power_recut = -1;
+        boots++;
+    }
+
+    for (; boots < MAX_BOOTS; boots++) {
+        int running = boot();
+
+        /* An image on trial confirms itself, or resets if it is bad */
+        if (dev.mailbox_event != SLOT_EVENT_TRIAL_BOOT) {
+            return running;
+        }
+        if (running != IMAGE_BAD) {
+            dev.mailbox_event = SLOT_EVENT_CONFIRMED;
+        }
+    }
+    return -1;
+}
+
+/**
+ * @brief  Device of a scenario before its event
+ */
+static void start(const scenario_t *scenario) {
+    slot_table_t table;
+
+    memset(&dev, 0xFF, sizeof(dev));
+    memcpy(dev.app, images[IMAGE_FACTORY].data, APP_SIZE);
+    dev.ota_request = 0;
+    dev.mailbox_valid = 0;
+    power_budget = power_recut = -1;
+
+    if (scenario->sequence != 0) {
+        slots_load(&slots_io, &table);
+        table.slot[SLOT_CURRENT] = images[IMAGE_FACTORY].info;
+        table.sequence = scenario->sequence - 1;
+        slots_save(&slots_io, &table);
+    }
+    if (scenario->setup_update) {
+        memcpy(dev.file, images[IMAGE_UPDATE].data, APP_SIZE);
+        dev.request = images[IMAGE_UPDATE].info;
+        dev.ota_request = 1;
+        dev.mailbox_valid = 1;
+        dev.mailbox_event = SLOT_EVENT_OTA_REQUEST;
+        settle(1);
+    }
+    if (scenario->file >= 0) {
+        memcpy(dev.file, images[scenario->file].data, APP_SIZE);
+        dev.request = images[scenario->file].info;
+        dev.ota_request = 1;
+        if (scenario->corrupt) {
+            dev.file[dev.request.size / 2] ^= 0x01;
+        }
+    }
+    dev.mailbox_valid = 1;
+    dev.mailbox_event = scenario->event;
+}
+
+/**
+ * @brief  Check the end of a run
+ */
+static int finished(int running, int image, uint32_t candidate) {
+    slot_table_t table;
+
+    if ((running != image) || (slots_load(&slots_io, &table) != 0)) {
+        return 0;
+    }
+    return (table.slot[SLOT_CURRENT].state == SLOT_STATE_VALID)
+           && (table.slot[SLOT_CURRENT].crc32 == images[image].info.crc32)
+           && (table.slot[SLOT_PREVIOUS].state == SLOT_STATE_VALID)
+           && (table.slot[SLOT_PREVIOUS].crc32 == images[IMAGE_FACTORY].info.crc32)
+           && (image_crc(dev.previous, table.slot[SLOT_PREVIOUS].size) == images[IMAGE_FACTORY].info.crc32)
+           && (table.slot[SLOT_CANDIDATE].state == candidate)
+           && (!dev.ota_request || slots_request_done(&table, &dev.request));
+}
+
+/**
+ * @brief  A scenario without a cut, then with a cut at each of its steps
+ */
+static void check_scenario(const scenario_t *scenario) {
+    uint32_t runs = 0;
+
+    start(scenario);
+    power_steps = 0;
+    int running = settle(1);
+    uint32_t steps = power_steps;
+    TEST_CHECK(finished(running, scenario->image, scenario->candidate));
+
+    for (int32_t cut = 0; cut < (int32_t) steps; cut++) {
+        for (int keep_mailbox = 0; keep_mailbox < 2; keep_mailbox++) {
+            for (int recut = 0; recut < 2; recut++) {
+                start(scenario);
+                power_budget = cut;
+                power_recut = recut ? cut : -1;
+                power_cuts = 0;
+                running = settle(keep_mailbox);
+                runs++;
+
+                int ok = finished(running, scenario->image, scenario->candidate);
+                /* A rollback request only lives in the mailbox, the power may take it */
+                if (!ok && !keep_mailbox && (scenario->event == SLOT_EVENT_ROLLBACK_REQUEST)) {
+                    ok = finished(running, IMAGE_UPDATE, SLOT_STATE_VALID);
+                }
+                if (!ok) {
+                    fprintf(stderr, "%s: cut at step %ld, mailbox %s, %s cut\n", scenario->name, (long) cut,
+                            keep_mailbox ? "kept" : "lost", recut ? "second" : "no second");
+                }
+                TEST_CHECK(ok);
+                TEST_CHECK(power_cuts >= 1);
+            }
+        }
+    }
+
+    printf("%-12s %3lu steps, %4lu runs with cuts\n", scenario->name, (unsigned long) steps, (unsigned long) runs);
+}
+
+/**
+ * @brief  Images differing in their first pages, trailing word not erased
+ */
+static void make_images(void) {
+    static const int32_t sizes[IMAGE_COUNT] = { 9 * PAGE_SIZE + 100, 11 * PAGE_SIZE + 40, 10 * PAGE_SIZE };
+
+    srand(1);
+    for (int i = 0; i < IMAGE_COUNT; i++) {
+        image_t *image = &images[i];
+
+        memset(image->data, 0xFF, APP_SIZE);
+        for (int32_t j = 0; j < sizes[i]; j++) {
+            image->data[j] = (uint8_t) rand();
+        }
+        /* The update keeps most pages of the factory image */
+        if (i == IMAGE_UPDATE) {
+            memcpy(&image->data[3 * PAGE_SIZE], &images[IMAGE_FACTORY].data[3 * PAGE_SIZE], 5 * PAGE_SIZE);
+        }
+        image->data[sizes[i] - 1] = 0x00;
+        image->info.state = SLOT_STATE_VALID;
+        image->info.size = sizes[i];
+        image->info.crc32 = image_crc(image->data, sizes[i]);
+        image->info.version = (uint32_t) i + 1;
+    }
+}
+
+/******************************************************************************/
+
+int main(void) {
+    make_images();
+
+    for (uint32_t i = 0; i < sizeof(scenarios) / sizeof(scenarios[0]); i++) {
+        check_scenario(&scenarios[i]);
+    }
+
+    return TEST_RESULT();
+}
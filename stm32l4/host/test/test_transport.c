@@ -0,0 +1,614 @@
+/*
+ *  test_transport.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+
+#include <string.h>
+#include "command.h"
+#include "transport.h"
+#include "test.h"
+
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+
+/*
+ * Two transports on a loopback link, in model time: each message takes its
+ * v2 frame time on a 921600 baud line, then the one way delay of the peer
+ * (ESP32 bridge), and is lost with a given probability in both directions.
+ * The receiver checks every packet is handed over once and in order, or
+ * holds them for a while like the deferred OTA handler.
+ * Then the edges: sequence numbers wrapping at 65536, the selective ACK
+ * bitmap at the ends of the window. Also built with TRANSPORT_MAX_WINDOW 64,
+ * more than the bitmap covers.
+ * Recovery: a line dead long enough for the sender to drop its transfer,
+ * then a restart of the receiver and one of the sender in the middle of a
+ * transfer. The packets after them must come in order, none twice.
+ */
+#define LINK_BAUD            (921600)
+#define LINK_FRAME_OVERHEAD  (6)            /* SOF, length, CRC-16 of a v2 frame */
+#define LINK_QUEUE           (512)          /* Messages on the line, power of 2 */
+#define SIM_TIME_LIMIT_US    (600000000ULL)
+
+#define PACKET_COMMAND       (0x11)
+#define PACKET_HEADER        (5)            /* Command byte, 4 bytes index */
+#define PACKET_BULK          (PACKET_HEADER + 1024)
+#define PACKET_SMALL         (PACKET_HEADER + 8)
+
+enum {
+    RESTART_NONE = 0,
+    RESTART_RECEIVER,
+    RESTART_SENDER,
+};
+
+typedef struct {
+    uint64_t at_us;                         /* Arrival at the peer */
+    uint16_t length;
+    uint8_t data[TRANSPORT_ACK_HEADER + TRANSPORT_MAX_PACKET];
+} message_t;
+
+typedef struct endpoint {
+    transport_t transport;
+    struct endpoint *peer;
+
+    /* Line towards the peer */
+    message_t queue[LINK_QUEUE];
+    uint32_t head;
+    uint32_t count;
+    uint64_t busy_until_us;
+    uint32_t overflows;
+
+    /* Receiver side */
+    uint32_t expected;                      /* Index of the next packet */
+    uint32_t packet_size;
+    uint32_t bad_packets;                   /* Wrong content, twice or out of order */
+    uint32_t skipped;                       /* Never handed over */
+    bool restarted;                         /* The next packet sets expected */
+    uint32_t expected_at_restart;
+    uint32_t first_after_restart;
+    const uint8_t *held[TRANSPORT_MAX_WINDOW];
+    uint64_t release_at_us[TRANSPORT_MAX_WINDOW];
+    uint32_t held_count;
+} endpoint_t;
+
+typedef struct {
+    uint32_t window;
+    uint32_t loss_ppm;                      /* Per message, both directions */
+    uint32_t delay_us;                      /* One way */
+    uint32_t hold_us;                       /* Time a packet is held by the receiver, 0 for none */
+    uint32_t packets;
+    uint32_t packet_size;
+    uint16_t rto_ms;
+    uint32_t outage_at_us;                  /* Line dead both ways from then... */
+    uint32_t outage_us;                     /* ...for that long, 0 for none */
+    uint32_t restart;                       /* RESTART_xxx endpoint... */
+    uint32_t restart_after;                 /* ...after that many packets handed over */
+} sim_config_t;
+
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+
+static endpoint_t sender, receiver;
+static const sim_config_t *sim;
+static uint64_t now_us;
+static uint32_t random_state = 1;
+
+/* Direct frames of the edge checks: last message output */
+static uint8_t last_output[TRANSPORT_ACK_HEADER + TRANSPORT_MAX_PACKET];
+static uint32_t outputs;
+
+/******************************************************************************/
+/*                                FUNCTIONS                                   */
+/******************************************************************************/
+
+static uint32_t next_random(void) {
+    random_state = random_state * 1103515245 + 12345;
+    return random_state >> 8;
+}
+
+static uint32_t now_ms(void) {
+    return (uint32_t) (now_us / 1000);
+}
+
+static void put_u16(uint8_t *data, uint16_t value) {
+    data[0] = (uint8_t) value;
+    data[1] = (uint8_t) (value >> 8);
+}
+
+static uint16_t get_u16(const uint8_t *data) {
+    return data[0] | (data[1] << 8);
+}
+
+static void make_packet(uint8_t *packet, uint32_t index, uint32_t size) {
+    packet[0] = PACKET_COMMAND;
+    memcpy(&packet[1], &index, sizeof(index));
+    for (uint32_t i = PACKET_HEADER; i < size; i++) {
+        packet[i] = (uint8_t) (index * 31 + i);
+    }
+}
+
+/**
+ * @brief  Put a message on the line, it arrives after its frame time and the delay
+ */
+static void link_output(const uint8_t *header, uint16_t header_length, const uint8_t *payload, uint16_t length, void *arg) {
+    endpoint_t *endpoint = arg;
+    uint32_t bytes = header_length + length + LINK_FRAME_OVERHEAD;
+    uint64_t start = (endpoint->busy_until_us > now_us) ? endpoint->busy_until_us : now_us;
+
+    endpoint->busy_until_us = start + (uint64_t) bytes * 10 * 1000000 / LINK_BAUD;
+    if (next_random() % 1000000 < sim->loss_ppm) {
+        return;
+    }
+    if ((now_us >= sim->outage_at_us) && (now_us < (uint64_t) sim->outage_at_us + sim->outage_us)) {
+        return;
+    }
+    if (endpoint->count == LINK_QUEUE) {
+        endpoint->overflows++;
+        return;
+    }
+
+    message_t *message = &endpoint->queue[(endpoint->head + endpoint->count++) % LINK_QUEUE];
+    message->at_us = endpoint->busy_until_us + sim->delay_us;
+    message->length = header_length + length;
+    memcpy(message->data, header, header_length);
+    if (length > 0) {
+        memcpy(&message->data[header_length], payload, length);
+    }
+}
+
+/**
+ * @brief  Packets must come once and in order, the ones a dropped transfer lost are counted
+ */
+static int receiver_deliver(const uint8_t *packet, uint16_t length, void *arg) {
+    endpoint_t *endpoint = arg;
+    uint8_t expected[TRANSPORT_MAX_PACKET];
+    uint32_t index;
+
+    memcpy(&index, &packet[1], sizeof(index));
+    if (endpoint->restarted) {
+        endpoint->restarted = false;
+        endpoint->first_after_restart = index;
+        endpoint->expected = index;
+    }
+    make_packet(expected, index, endpoint->packet_size);
+    if ((length != endpoint->packet_size) || (memcmp(packet, expected, length) != 0) || (index < endpoint->expected)) {
+        endpoint->bad_packets++;
+    }
+    else {
+        endpoint->skipped += index - endpoint->expected;
+    }
+    endpoint->expected = index + 1;
+
+    if (sim->hold_us == 0) {
+        return TRANSPORT_DELIVER_DONE;
+    }
+    endpoint->held[endpoint->held_count] = packet;
+    endpoint->release_at_us[endpoint->held_count] = now_us + sim->hold_us;
+    endpoint->held_count++;
+    return TRANSPORT_DELIVER_HELD;
+}
+
+/**
+ * @brief  A message reaches its peer, dispatched on its command byte
+ */
+static void link_arrive(endpoint_t *endpoint) {
+    message_t *message = &endpoint->queue[endpoint->head];
+    transport_t *peer = &endpoint->peer->transport;
+
+    endpoint->head = (endpoint->head + 1) % LINK_QUEUE;
+    endpoint->count--;
+    if (message->data[0] == COMMAND_XFER_DATA) {
+        TEST_CHECK(transport_receive_data(peer, &message->data[1], message->length - 1) == 0);
+    }
+    else if (message->data[0] == COMMAND_XFER_ACK) {
+        TEST_CHECK(transport_receive_ack(peer, &message->data[1], message->length - 1, now_ms()) == 0);
+    }
+    else if (message->data[0] == COMMAND_XFER_SYNC) {
+        TEST_CHECK(transport_receive_sync(peer, &message->data[1], message->length - 1) == 0);
+    }
+    else {
+        TEST_CHECK(!"unknown command");
+    }
+}
+
+/**
+ * @brief  Oldest held packet released by its user
+ */
+static void receiver_release(void) {
+    transport_release(&receiver.transport, receiver.held[0]);
+    receiver.held_count--;
+    memmove(&receiver.held[0], &receiver.held[1], receiver.held_count * sizeof(receiver.held[0]));
+    memmove(&receiver.release_at_us[0], &receiver.release_at_us[1], receiver.held_count * sizeof(receiver.release_at_us[0]));
+    transport_poll(&receiver.transport, now_ms());
+}
+
+static void endpoint_init(endpoint_t *endpoint, endpoint_t *peer, const sim_config_t *config) {
+    transport_config_t transport_config = { .window = (uint8_t) config->window, .rto_ms = config->rto_ms };
+
+    memset(endpoint, 0, sizeof(*endpoint));
+    endpoint->peer = peer;
+    endpoint->packet_size = config->packet_size;
+    transport_init(&endpoint->transport, &transport_config, link_output, receiver_deliver, endpoint);
+}
+
+/**
+ * @brief  Reset of an endpoint: its transport starts again, the line keeps the messages on it
+ */
+static void endpoint_restart(endpoint_t *endpoint, const sim_config_t *config) {
+    transport_config_t transport_config = { .window = (uint8_t) config->window, .rto_ms = config->rto_ms };
+
+    transport_init(&endpoint->transport, &transport_config, link_output, receiver_deliver, endpoint);
+    endpoint->held_count = 0;
+    endpoint->restarted = (endpoint == &receiver);
+}
+
+/**
+ * @brief  Retransmit timeout: COMM_XFER_RTO_MS, unless a full window takes longer
+ *         to send and acknowledge (each frame would go again before its first copy arrived)
+ */
+static uint16_t sim_rto_ms(uint32_t window, uint32_t delay_us, uint32_t packet_size) {
+    uint32_t frame_us = (packet_size + TRANSPORT_DATA_HEADER + LINK_FRAME_OVERHEAD) * 10 * 1000000ULL / LINK_BAUD;
+    uint32_t window_ms = (window * frame_us + 2 * delay_us) / 1000;
+
+    return (window_ms * 3 / 2 > 200) ? (uint16_t) (window_ms * 3 / 2) : 200;
+}
+
+/**
+ * @brief  Transfer config->packets packets from sender to receiver
+ * @retval Model time of the transfer in us
+ */
+static uint64_t sim_run(const sim_config_t *config) {
+    uint8_t packet[TRANSPORT_MAX_PACKET];
+    uint32_t sent = 0;
+    bool restarted = false;
+
+    sim = config;
+    now_us = 0;
+    endpoint_init(&sender, &receiver, config);
+    endpoint_init(&receiver, &sender, config);
+
+    while (((receiver.expected < config->packets) || (receiver.held_count > 0)) && (now_us < SIM_TIME_LIMIT_US)) {
+        if ((config->restart != RESTART_NONE) && !restarted && (receiver.expected >= config->restart_after)) {
+            receiver.expected_at_restart = receiver.expected;
+            endpoint_restart((config->restart == RESTART_SENDER) ? &sender : &receiver, config);
+            restarted = true;
+        }
+        while ((sent < config->packets) && (transport_send_space(&sender.transport) > 0)) {
+            make_packet(packet, sent, config->packet_size);
+            TEST_CHECK(transport_send(&sender.transport, packet, (uint16_t) config->packet_size, now_ms()) == 0);
+            sent++;
+        }
+        uint32_t deadline = transport_poll(&sender.transport, now_ms());
+        uint32_t receiver_deadline = transport_poll(&receiver.transport, now_ms());
+        if (receiver_deadline < deadline) {
+            deadline = receiver_deadline;
+        }
+        uint64_t next_poll_us = (deadline == TRANSPORT_NO_DEADLINE) ? UINT64_MAX : (uint64_t) (now_ms() + deadline) * 1000;
+
+        /* Next event: an arrival, a release, a retransmit timer */
+        uint64_t next_us = next_poll_us;
+        if ((sender.count > 0) && (sender.queue[sender.head].at_us < next_us)) {
+            next_us = sender.queue[sender.head].at_us;
+        }
+        if ((receiver.count > 0) && (receiver.queue[receiver.head].at_us < next_us)) {
+            next_us = receiver.queue[receiver.head].at_us;
+        }
+        if ((receiver.held_count > 0) && (receiver.release_at_us[0] < next_us)) {
+            next_us = receiver.release_at_us[0];
+        }
+        if (next_us == UINT64_MAX) {
+            TEST_CHECK(!"transfer stalled");
+            break;
+        }
+        if (next_us > now_us) {
+            now_us = next_us;
+        }
+
+        while ((sender.count > 0) && (sender.queue[sender.head].at_us <= now_us)) {
+            link_arrive(&sender);
+        }
+        while ((receiver.count > 0) && (receiver.queue[receiver.head].at_us <= now_us)) {
+            link_arrive(&receiver);
+        }
+        while ((receiver.held_count > 0) && (receiver.release_at_us[0] <= now_us)) {
+            receiver_release();
+        }
+    }
+
+    TEST_CHECK(receiver.expected == config->packets);
+    TEST_CHECK(receiver.bad_packets == 0);
+    TEST_CHECK(sender.overflows + receiver.overflows == 0);
+    if ((config->outage_us == 0) && (config->restart == RESTART_NONE)) {
+        TEST_CHECK(receiver.transport.stats.delivered == config->packets);
+        TEST_CHECK(sender.transport.stats.sent == config->packets);
+        TEST_CHECK(sender.transport.stats.failures == 0);
+    }
+    return now_us;
+}
+
+/**
+ * @brief  Throughput against the window, lossless then lossy links
+ */
+static void check_throughput(void) {
+    static const uint32_t losses_ppm[] = { 0, 20000, 100000 };
+    static const uint32_t delays_us[] = { 5000, 20000 };
+    double line_kbs = LINK_BAUD / 10.0 / 1024 * PACKET_BULK / (PACKET_BULK + TRANSPORT_DATA_HEADER + LINK_FRAME_OVERHEAD);
+
+    printf("Throughput in KB/s, %u x %u byte packets, line %.1f KB/s, RTO 200 ms or 1.5 window times\n",
+           256, PACKET_BULK, line_kbs);
+    printf("delay  loss ");
+    for (uint32_t window = 1; window <= TRANSPORT_MAX_WINDOW; window *= 2) {
+        printf("  w=%-4lu", (unsigned long) window);
+    }
+    printf("\n");
+
+    for (uint32_t d = 0; d < sizeof(delays_us) / sizeof(delays_us[0]); d++) {
+        for (uint32_t l = 0; l < sizeof(losses_ppm) / sizeof(losses_ppm[0]); l++) {
+            double first = 0, previous = 0, kbs = 0;
+
+            printf("%3lu ms %4.0f%% ", (unsigned long) (delays_us[d] / 1000), losses_ppm[l] / 1e4);
+            for (uint32_t window = 1; window <= TRANSPORT_MAX_WINDOW; window *= 2) {
+                sim_config_t config = { .window = window, .loss_ppm = losses_ppm[l], .delay_us = delays_us[d],
+                                        .packets = 256, .packet_size = PACKET_BULK,
+                                        .rto_ms = sim_rto_ms(window, delays_us[d], PACKET_BULK) };
+                uint64_t time_us = sim_run(&config);
+
+                kbs = config.packets * (double) config.packet_size / 1024 / (time_us / 1e6);
+                printf("  %6.1f", kbs);
+                if (losses_ppm[l] == 0) {
+                    /* More frames in flight never slow a lossless transfer */
+                    TEST_CHECK(kbs >= previous * 0.99);
+                    TEST_CHECK(kbs <= line_kbs * 1.01);
+                }
+                if (window == 1) {
+                    first = kbs;
+                }
+                previous = kbs;
+            }
+            printf("\n");
+            if ((losses_ppm[l] == 0) && (delays_us[d] >= 20000)) {
+                /* The round trip is longer than a frame: stop and wait is far behind */
+                TEST_CHECK(kbs > 2 * first);
+            }
+        }
+    }
+
+    /* Packets held by a slow handler close the window for a while */
+    sim_config_t held = { .window = TRANSPORT_MAX_WINDOW, .loss_ppm = 20000, .delay_us = 5000, .hold_us = 3000,
+                          .packets = 256, .packet_size = PACKET_BULK,
+                          .rto_ms = sim_rto_ms(TRANSPORT_MAX_WINDOW, 5000, PACKET_BULK) };
+    uint64_t time_us = sim_run(&held);
+    printf("held 3 ms, w=%u, 2%% loss: %.1f KB/s\n", TRANSPORT_MAX_WINDOW,
+           held.packets * (double) held.packet_size / 1024 / (time_us / 1e6));
+}
+
+/**
+ * @brief  More than 65536 packets: the sequence numbers wrap during the transfer
+ */
+static void check_wrap(void) {
+    sim_config_t config = { .window = TRANSPORT_MAX_WINDOW, .loss_ppm = 50000, .delay_us = 2000, .hold_us = 0,
+                            .packets = 70000, .packet_size = PACKET_SMALL,
+                            .rto_ms = sim_rto_ms(TRANSPORT_MAX_WINDOW, 2000, PACKET_SMALL) };
+
+    sim_run(&config);
+    TEST_CHECK(sender.transport.tx_next == (uint16_t) config.packets);
+    TEST_CHECK(receiver.transport.rx_next == (uint16_t) config.packets);
+    TEST_CHECK(sender.transport.stats.fast_retransmits > 0);
+    TEST_CHECK(receiver.transport.stats.duplicates > 0);
+}
+
+/**
+ * @brief  Line dead until the sender drops its transfer, then back
+ */
+static void check_outage(void) {
+    sim_config_t config = { .window = TRANSPORT_MAX_WINDOW, .loss_ppm = 20000, .delay_us = 5000,
+                            .packets = 512, .packet_size = PACKET_BULK,
+                            .rto_ms = sim_rto_ms(TRANSPORT_MAX_WINDOW, 5000, PACKET_BULK), .outage_at_us = 500000 };
+
+    /* Longer than the retries of a frame, shorter than the ones of the SYNC after it */
+    config.outage_us = (TRANSPORT_MAX_RETRIES + 3) * config.rto_ms * 1000;
+
+    uint64_t time_us = sim_run(&config);
+
+    /* One drop, its frames skipped by the receiver, the rest in order */
+    TEST_CHECK(sender.transport.stats.failures == 1);
+    TEST_CHECK(receiver.skipped > 0);
+    TEST_CHECK(receiver.skipped <= sender.transport.stats.abandoned);
+    TEST_CHECK(sender.transport.stats.abandoned <= TRANSPORT_MAX_WINDOW);
+    TEST_CHECK(receiver.transport.stats.delivered + receiver.skipped == config.packets);
+    TEST_CHECK(receiver.transport.stats.resyncs >= 2);
+    printf("line dead %.1f s: 1 transfer dropped, %lu frames, %lu packets lost, done in %.1f s\n",
+           config.outage_us / 1e6, (unsigned long) sender.transport.stats.abandoned,
+           (unsigned long) receiver.skipped, time_us / 1e6);
+}
+
+/**
+ * @brief  Receiver, then sender reset in the middle of a transfer
+ */
+static void check_restart(void) {
+    sim_config_t config = { .window = TRANSPORT_MAX_WINDOW, .loss_ppm = 20000, .delay_us = 5000,
+                            .packets = 2000, .packet_size = PACKET_SMALL,
+                            .rto_ms = sim_rto_ms(TRANSPORT_MAX_WINDOW, 5000, PACKET_SMALL),
+                            .restart = RESTART_RECEIVER, .restart_after = 1000 };
+
+    /* The sender keeps its frames in flight and sends them again: nothing lost */
+    sim_run(&config);
+    TEST_CHECK(receiver.first_after_restart <= receiver.expected_at_restart);
+    TEST_CHECK(receiver.skipped == 0);
+    TEST_CHECK(sender.transport.stats.failures == 0);
+    TEST_CHECK(sender.transport.stats.resyncs >= 2);
+    printf("receiver reset after %lu packets: again from %lu, none lost\n",
+           (unsigned long) receiver.expected_at_restart, (unsigned long) receiver.first_after_restart);
+
+    /* Back to sequence number 0: the frames the sender lost are skipped, no more */
+    config.restart = RESTART_SENDER;
+    sim_run(&config);
+    TEST_CHECK(receiver.skipped <= TRANSPORT_MAX_WINDOW);
+    TEST_CHECK(receiver.transport.stats.resyncs >= 2);
+    TEST_CHECK(sender.transport.stats.failures == 0);
+    printf("sender reset after %lu packets: back to sequence 0, %lu packets lost\n",
+           (unsigned long) receiver.expected_at_restart, (unsigned long) receiver.skipped);
+}
+
+/******************************************************************************/
+
+static void capture_output(const uint8_t *header, uint16_t header_length, const uint8_t *payload, uint16_t length, void *arg) {
+    (void) arg;
+    memcpy(last_output, header, header_length);
+    if (length > 0) {
+        memcpy(&last_output[header_length], payload, length);
+    }
+    outputs++;
+}
+
+static int capture_deliver(const uint8_t *packet, uint16_t length, void *arg) {
+    uint32_t *expected = arg;
+    uint32_t index;
+
+    memcpy(&index, &packet[1], sizeof(index));
+    TEST_CHECK((length == PACKET_SMALL) && (index == *expected));
+    (*expected)++;
+    return TRANSPORT_DELIVER_DONE;
+}
+
+static int send_data(transport_t *transport, uint16_t seq, uint32_t index) {
+    uint8_t data[2 + PACKET_SMALL];
+
+    put_u16(data, seq);
+    make_packet(&data[2], index, PACKET_SMALL);
+    return transport_receive_data(transport, data, sizeof(data));
+}
+
+static int send_ack(transport_t *transport, uint16_t next, uint32_t sack, uint32_t time_ms) {
+    uint8_t data[TRANSPORT_ACK_HEADER - 1];
+
+    put_u16(&data[0], next);
+    put_u16(&data[2], (uint16_t) sack);
+    put_u16(&data[4], (uint16_t) (sack >> 16));
+    return transport_receive_ack(transport, data, sizeof(data), time_ms);
+}
+
+static uint32_t last_sack(void) {
+    return get_u16(&last_output[3]) | ((uint32_t) get_u16(&last_output[5]) << 16);
+}
+
+/**
+ * @brief  Receiver: bitmap bits up to the end of the window, first sequence number start
+ */
+static void check_sack_receiver(uint16_t start) {
+    transport_config_t config = { .window = TRANSPORT_MAX_WINDOW, .rto_ms = 200 };
+    uint32_t bits = (TRANSPORT_MAX_WINDOW - 1 < TRANSPORT_SACK_BITS) ? (TRANSPORT_MAX_WINDOW - 1) : TRANSPORT_SACK_BITS;
+    uint32_t expected = 0;
+    transport_t transport;
+
+    transport_init(&transport, &config, capture_output, capture_deliver, &expected);
+    transport.rx_release = transport.rx_deliver = transport.rx_next = start;
+    transport.rx_synced = true;
+
+    /* All but the first frame of the window, last to second */
+    for (uint32_t i = TRANSPORT_MAX_WINDOW - 1; i >= 1; i--) {
+        TEST_CHECK(send_data(&transport, (uint16_t) (start + i), i) == 0);
+        TEST_CHECK(last_output[0] == COMMAND_XFER_ACK);
+        TEST_CHECK(get_u16(&last_output[1]) == start);
+        uint32_t sack = 0;
+        for (uint32_t bit = i - 1; bit < bits; bit++) {
+            sack |= 1UL << bit;
+        }
+        TEST_CHECK(last_sack() == sack);
+    }
+    TEST_CHECK(expected == 0);
+
+    /* One past the window, a duplicate, nothing changes */
+    TEST_CHECK(send_data(&transport, (uint16_t) (start + TRANSPORT_MAX_WINDOW), TRANSPORT_MAX_WINDOW) == 0);
+    TEST_CHECK(transport.stats.out_of_window == 1);
+    TEST_CHECK(send_data(&transport, (uint16_t) (start + 1), 1) == 0);
+    TEST_CHECK(transport.stats.duplicates == 1);
+    TEST_CHECK(get_u16(&last_output[1]) == start);
+
+    /* The missing frame: everything handed over in order */
+    TEST_CHECK(send_data(&transport, start, 0) == 0);
+    TEST_CHECK(expected == TRANSPORT_MAX_WINDOW);
+    TEST_CHECK(get_u16(&last_output[1]) == (uint16_t) (start + TRANSPORT_MAX_WINDOW));
+    TEST_CHECK(last_sack() == 0);
+
+    /* Before the window now */
+    TEST_CHECK(send_data(&transport, (uint16_t) (start + TRANSPORT_MAX_WINDOW - 1), TRANSPORT_MAX_WINDOW - 1) == 0);
+    TEST_CHECK(transport.stats.duplicates == 2);
+    TEST_CHECK(expected == TRANSPORT_MAX_WINDOW);
+
+    /* Malformed */
+    uint8_t data[2 + TRANSPORT_MAX_PACKET + 1] = { 0 };
+    TEST_CHECK(transport_receive_data(&transport, data, 2) != 0);
+    TEST_CHECK(transport_receive_data(&transport, data, sizeof(data)) != 0);
+    TEST_CHECK(transport_receive_ack(&transport, data, TRANSPORT_ACK_HEADER - 2, 0) != 0);
+}
+
+/**
+ * @brief  Sender: bits past what was sent, ACKs out of the window, fast retransmit once
+ */
+static void check_sack_sender(uint16_t start) {
+    transport_config_t config = { .window = TRANSPORT_MAX_WINDOW, .rto_ms = 200 };
+    uint8_t packet[PACKET_SMALL];
+    uint32_t expected = 0;
+    transport_t transport;
+
+    transport_init(&transport, &config, capture_output, capture_deliver, &expected);
+    transport.tx_base = transport.tx_next = start;
+    transport.tx_sync = 0;
+
+    for (uint32_t i = 0; i < TRANSPORT_MAX_WINDOW; i++) {
+        make_packet(packet, i, sizeof(packet));
+        TEST_CHECK(transport_send(&transport, packet, sizeof(packet), 0) == 0);
+    }
+    TEST_CHECK(transport_send(&transport, packet, sizeof(packet), 0) != 0);
+
+    /* Ahead of what was sent, older than the window: ignored */
+    outputs = 0;
+    TEST_CHECK(send_ack(&transport, (uint16_t) (start + TRANSPORT_MAX_WINDOW + 1), 0, 1) == 0);
+    TEST_CHECK(send_ack(&transport, (uint16_t) (start - 1), 0xFFFFFFFF, 1) == 0);
+    TEST_CHECK(transport_send_space(&transport) == 0);
+    TEST_CHECK(outputs == 0);
+
+    /* Every later frame received, and bits past the last frame sent */
+    TEST_CHECK(send_ack(&transport, start, 0xFFFFFFFF, 10) == 0);
+    TEST_CHECK(transport.stats.fast_retransmits == 1);
+    TEST_CHECK((outputs == 1) && (last_output[0] == COMMAND_XFER_DATA) && (get_u16(&last_output[1]) == start));
+    TEST_CHECK(send_ack(&transport, start, 0xFFFFFFFF, 20) == 0);
+    TEST_CHECK(transport.stats.fast_retransmits == 1);
+
+    /* On timeout only the frames the bitmap could not cover go again */
+    uint32_t uncovered = (TRANSPORT_MAX_WINDOW - 1 > TRANSPORT_SACK_BITS) ? (TRANSPORT_MAX_WINDOW - 1 - TRANSPORT_SACK_BITS) : 0;
+    transport_poll(&transport, 205);
+    TEST_CHECK(transport.stats.retransmits == uncovered);
+    transport_poll(&transport, 215);
+    TEST_CHECK(transport.stats.retransmits == uncovered + 1);
+    TEST_CHECK(get_u16(&last_output[1]) == start);
+
+    /* Cumulative ACK of the whole window */
+    TEST_CHECK(send_ack(&transport, (uint16_t) (start + TRANSPORT_MAX_WINDOW), 0, 220) == 0);
+    TEST_CHECK(transport_send_space(&transport) == TRANSPORT_MAX_WINDOW);
+    TEST_CHECK(transport_poll(&transport, 1000) == TRANSPORT_NO_DEADLINE);
+}
+
+/******************************************************************************/
+
+int main(void) {
+    static const uint16_t starts[] = { 0, (uint16_t) (65536 - TRANSPORT_MAX_WINDOW / 2), 65535 };
+
+    for (uint32_t i = 0; i < sizeof(starts) / sizeof(starts[0]); i++) {
+        check_sack_receiver(starts[i]);
+        check_sack_sender(starts[i]);
+    }
+    check_wrap();
+    check_throughput();
+    check_outage();
+    check_restart();
+
+    return TEST_RESULT();
+}
@@ -0,0 +1,116 @@
+/*
+ *  test_ui_control.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+
+#include <string.h>
+#include "main.h"
+#include "lvgl.h"
+#include "app_config.h"
+#include "ota.h"
+#include "user_intf.h"
+#include "ui_control.h"
+#include "lcd_model.h"
+#include "test.h"
+
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+
+/*
+ * lvgl_task() of ui_control.c on its own thread, with the LCD port on the
+ * panel model, in real time. The splash bar animates for 2 s, then the home
+ * screen stays as it is: the task must sleep between its 500 ms updates, and
+ * wake at once for a posted event.
+ */
+#define SPLASH_WAIT_MS        (1500)
+#define IDLE_WAIT_MS          (5500)     /* From the start, the last second without the splash */
+#define IDLE_MAX_WAKEUPS      (5)        /* Screen updates at 2 per second, a refresh after them */
+#define IDLE_MIN_PERCENT      (90)
+#define EVENT_MAX_MS          (50)
+
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+
+system_config_t system_config;
+system_status_t system_status;
+
+/******************************************************************************/
+/*                                FUNCTIONS                                   */
+/******************************************************************************/
+
+void user_intf_register_button_callback(uint8_t button_id, button_callback_t callback) {
+    (void) button_id;
+    (void) callback;
+}
+
+void ota_confirm(void) {
+}
+
+/**
+ * @brief  Configuration and status of a device at the surface, as ui_sim
+ */
+static void defaults(void) {
+    system_config.manufacturer_id = JUER_MARINE_ID;
+    system_config.screen_mode = BIG_NUMBER_MODE;
+    system_config.set_point = 130;
+    system_status.dive_state = SURFACE_CONTROL_STATE;
+    for (int i = 0; i < O2_SENSOR_NUM; i++) {
+        system_status.sensor[i].data = 130;
+    }
+    system_status.set_point.data = 130;
+    system_status.gas_mix.O2 = 21;
+}
+
+static void wait_until(uint32_t start, uint32_t ms) {
+    while (HAL_GetTick() - start < ms) {
+        HAL_Delay(10);
+    }
+}
+
+/******************************************************************************/
+
+int main(void) {
+    const ui_control_stats_t *stats = ui_control_get_stats();
+
+    defaults();
+    lcd_model_reset();
+    host_log_mute(1);
+
+    uint32_t start = HAL_GetTick();
+    ui_control_init();
+
+    /* Splash bar: refreshed every LV_DISP_DEF_REFR_PERIOD */
+    wait_until(start, SPLASH_WAIT_MS);
+    uint16_t splash_wakeups = stats->wakeups_per_sec;
+    uint8_t splash_idle = stats->idle_percent;
+    TEST_CHECK(splash_wakeups > IDLE_MAX_WAKEUPS);
+
+    /* Static home screen */
+    wait_until(start, IDLE_WAIT_MS);
+    uint16_t idle_wakeups = stats->wakeups_per_sec;
+    uint8_t idle_percent = stats->idle_percent;
+    TEST_CHECK(idle_wakeups <= IDLE_MAX_WAKEUPS);
+    TEST_CHECK(idle_percent >= IDLE_MIN_PERCENT);
+
+    /* A button press wakes the task before its next update */
+    uint32_t event_wakeups = stats->event_wakeups;
+    uint32_t pressed = HAL_GetTick();
+    ui_control_button_main_pressed();
+    while ((stats->event_wakeups == event_wakeups) && (HAL_GetTick() - pressed < 1000)) {
+        HAL_Delay(1);
+    }
+    uint32_t event_ms = HAL_GetTick() - pressed;
+    TEST_CHECK(event_ms <= EVENT_MAX_MS);
+
+    printf("LVGL task: splash %u wakeups/s %u%% idle, home screen %u wakeups/s %u%% idle, button handled in %lu ms\n",
+           splash_wakeups, splash_idle, idle_wakeups, idle_percent, (unsigned long) event_ms);
+
+    return TEST_RESULT();
+}
@@ -0,0 +1,127 @@
+/*
+ *  test_ui_event.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdatomic.h>
+#include <string.h>
+#include "FreeRTOS.h"
+#include "task.h"
+#include "ui_event.h"
+#include "test.h"
+
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+
+/*
+ * Producers post numbered events as fast as they can, retrying when the
+ * queue is full, while the consumer reads: every accepted event must come
+ * out once, in the order of its producer.
+ */
+#define PRODUCERS          (4)
+#define EVENTS_PER_THREAD  (100000)
+
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+
+static atomic_int producers_done;
+static uint32_t producer_full[PRODUCERS];
+
+static uint32_t received_next[PRODUCERS];
+static uint32_t out_of_order;
+static uint32_t bad_events;
+
+/******************************************************************************/
+/*                                FUNCTIONS                                   */
+/******************************************************************************/
+
+static void *producer(void *arg) {
+    uint8_t id = (uint8_t) (uintptr_t) arg;
+
+    for (int32_t seq = 0; seq < EVENTS_PER_THREAD; seq++) {
+        while (!ui_event_post(UI_EVENT_SENSOR, id, seq)) {
+            producer_full[id]++;
+            sched_yield();
+        }
+    }
+    atomic_fetch_add(&producers_done, 1);
+    return NULL;
+}
+
+static void consume(const ui_event_t *event) {
+    if ((event->type != UI_EVENT_SENSOR) || (event->param >= PRODUCERS) || (event->reserved != 0)) {
+        bad_events++;
+        return;
+    }
+    if ((uint32_t) event->value != received_next[event->param]) {
+        out_of_order++;
+    }
+    received_next[event->param] = (uint32_t) event->value + 1;
+}
+
+/******************************************************************************/
+
+int main(void) {
+    pthread_t threads[PRODUCERS];
+    ui_event_stats_t stats;
+    ui_event_t event;
+    uint32_t received = 0;
+
+    ui_event_set_consumer(osThreadGetId());
+
+    double start = test_now();
+    for (int i = 0; i < PRODUCERS; i++) {
+        pthread_create(&threads[i], NULL, producer, (void *) (uintptr_t) i);
+    }
+
+    /* The LVGL task: drain until every producer is done and the queue is empty */
+    for (;;) {
+        int done = (atomic_load(&producers_done) == PRODUCERS);
+        if (ui_event_get(&event)) {
+            consume(&event);
+            received++;
+        }
+        else if (done) {
+            break;
+        }
+        else {
+            sched_yield();
+        }
+    }
+    double elapsed = test_now() - start;
+
+    for (int i = 0; i < PRODUCERS; i++) {
+        pthread_join(threads[i], NULL);
+    }
+
+    ui_event_get_stats(&stats);
+    uint32_t full = 0;
+    for (int i = 0; i < PRODUCERS; i++) {
+        full += producer_full[i];
+        TEST_CHECK(received_next[i] == EVENTS_PER_THREAD);
+    }
+    printf("%d producers: %lu events in %.3f s (%.0f/s), %lu full posts retried, max depth %lu\n",
+           PRODUCERS, (unsigned long) received, elapsed, received / elapsed,
+           (unsigned long) full, (unsigned long) stats.max_depth);
+
+    TEST_CHECK(received == PRODUCERS * EVENTS_PER_THREAD);
+    TEST_CHECK(out_of_order == 0);
+    TEST_CHECK(bad_events == 0);
+    TEST_CHECK(stats.posted == received);
+    TEST_CHECK(stats.received == received);
+    TEST_CHECK(stats.dropped == full);
+    TEST_CHECK(stats.max_depth <= UI_EVENT_QUEUE_SIZE);
+    TEST_CHECK(host_thread_flags_sets() == received);
+    TEST_CHECK(!ui_event_get(&event));
+
+    return TEST_RESULT();
+}
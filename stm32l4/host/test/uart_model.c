@@ -0,0 +1,102 @@
+/*
+ *  uart_model.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+
+#include <stdbool.h>
+#include "main.h"
+#include "uart_model.h"
+
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+
+static uint8_t *dma_buffer;
+static uint16_t dma_size;
+static uint16_t dma_pos;
+static uint32_t tx_bytes;
+
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+
+UART_HandleTypeDef huart1 = { .Instance = USART1 };
+UART_HandleTypeDef huart2 = { .Instance = USART2 };
+
+/******************************************************************************/
+/*                                FUNCTIONS                                   */
+/******************************************************************************/
+
+HAL_StatusTypeDef HAL_UART_Transmit(UART_HandleTypeDef *huart, uint8_t *pData, uint16_t Size, uint32_t Timeout) {
+    (void) pData;
+    (void) Timeout;
+    if (huart->Instance == USART2) {
+        tx_bytes += Size;
+    }
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_UART_Receive_IT(UART_HandleTypeDef *huart, uint8_t *pData, uint16_t Size) {
+    (void) huart;
+    (void) pData;
+    (void) Size;
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_UARTEx_ReceiveToIdle_DMA(UART_HandleTypeDef *huart, uint8_t *pData, uint16_t Size) {
+    if (huart->Instance != USART2) {
+        return HAL_ERROR;
+    }
+    dma_buffer = pData;
+    dma_size = Size;
+    dma_pos = 0;
+    return HAL_OK;
+}
+
+/* Simulator buttons of communication.c (SIMULATOR), not used by the tests */
+void ui_control_button_main_pressed(void) {
+}
+
+void ui_control_button_tap_pressed(void) {
+}
+
+/*!
+ * @brief  Bytes received on USART2 by the DMA, followed by an idle line
+ */
+void uart_model_receive(const uint8_t *data, uint32_t length) {
+    bool event = false;
+
+    for (uint32_t i = 0; i < length; i++) {
+        dma_buffer[dma_pos++] = data[i];
+        event = (dma_pos == dma_size / 2) || (dma_pos == dma_size);
+        if (event) {
+            HAL_UARTEx_RxEventCallback(&huart2, dma_pos);
+        }
+        if (dma_pos == dma_size) {
+            dma_pos = 0;
+        }
+    }
+    /* Idle line after the last byte, unless it raised HT or TC */
+    if ((length > 0) && !event) {
+        HAL_UARTEx_RxEventCallback(&huart2, dma_pos);
+    }
+}
+
+/*!
+ * @brief  Check that the reception DMA was started
+ */
+int uart_model_rx_started(void) {
+    return dma_buffer != NULL;
+}
+
+/*!
+ * @brief  Bytes transmitted on USART2
+ */
+uint32_t uart_model_tx_bytes(void) {
+    return tx_bytes;
+}
@@ -0,0 +1,65 @@
+/*
+ *  uart_model.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef _UART_MODEL_H_
+#define _UART_MODEL_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************************************************************/
+
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+
+#include <stdint.h>
+
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+
+/*
+ * USART1/USART2 of communication.c: huart1 and huart2, the HAL UART calls and
+ * the circular reception DMA of USART2. The caller of uart_model_receive()
+ * plays the interrupt: HAL_UARTEx_RxEventCallback() runs on half transfer,
+ * transfer complete and idle line. Transmitted bytes are only counted.
+ */
+
+/******************************************************************************/
+/*                                FUNCTIONS                                   */
+/******************************************************************************/
+
+/*!
+ * @brief  Bytes received on USART2 by the DMA, followed by an idle line
+ * @param  data: Received bytes
+ * @param  length: Number of bytes
+ * @retval None
+ */
+void uart_model_receive(const uint8_t *data, uint32_t length);
+
+/*!
+ * @brief  Check that the reception DMA was started
+ * @param  None
+ * @retval 1 if started
+ */
+int uart_model_rx_started(void);
+
+/*!
+ * @brief  Bytes transmitted on USART2
+ * @param  None
+ * @retval Number of bytes
+ */
+uint32_t uart_model_tx_bytes(void);
+
+/******************************************************************************/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _UART_MODEL_H_ */
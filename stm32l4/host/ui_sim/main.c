@@ -0,0 +1,134 @@
+/*
+ *  main.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+#include "main.h"
+#include "lvgl.h"
+#include "app_config.h"
+#include "lv_port_disp.h"
+#include "lv_port_img.h"
+#include "lv_port_fs.h"
+#include "lv_port_fb.h"
+#include "mem_heap.h"
+#include "resource.h"
+#include "ui_utils.h"
+#include "ui_splash.h"
+#include "ui_big_number.h"
+#include "replay.h"
+
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+
+system_config_t system_config;
+system_status_t system_status;
+
+/******************************************************************************/
+/*                                FUNCTIONS                                   */
+/******************************************************************************/
+
+/**
+ * @brief  Configuration and status of a device at the surface
+ */
+static void sim_defaults(void) {
+    memset(&system_config, 0, sizeof(system_config));
+    strcpy(system_config.user_name, "TigerShark simulator");
+    system_config.manufacturer_id = JUER_MARINE_ID;
+    system_config.screen_mode = BIG_NUMBER_MODE;
+    system_config.set_point = 130;
+    system_config.user_setting.flags.depth_units = 1;
+
+    memset(&system_status, 0, sizeof(system_status));
+    system_status.dive_state = SURFACE_CONTROL_STATE;
+    for (int i = 0; i < O2_SENSOR_NUM; i++) {
+        system_status.sensor[i].data = 130;
+    }
+    system_status.set_point.data = 130;
+    system_status.gas_mix.O2 = 21;
+}
+
+/**
+ * @brief  Same initialization order as lvgl_task() of ui_control.c
+ */
+static void sim_init(void) {
+    host_tick_freeze();
+    sim_defaults();
+
+    lv_init();
+    lv_port_disp_init();
+    lv_port_img_init();
+    lv_port_fs_init();
+
+    /* Fonts loaded from the resource pack are copied into the heap */
+    mem_heap_stats_t before, after;
+    mem_heap_get_stats(&before);
+    resource_init();
+    mem_heap_get_stats(&after);
+    printf("resources: %lu bytes of heap (%lu blocks), %lu of %lu bytes used\n",
+           (unsigned long) (after.tags[MEM_TAG_LVGL].used - before.tags[MEM_TAG_LVGL].used),
+           (unsigned long) (after.tags[MEM_TAG_LVGL].allocs - before.tags[MEM_TAG_LVGL].allocs
+                            - (after.tags[MEM_TAG_LVGL].frees - before.tags[MEM_TAG_LVGL].frees)),
+           (unsigned long) after.used, (unsigned long) after.total);
+
+    if (system_config.screen_rotate == 1) {
+        lv_port_disp_set_rotation(LV_DISP_ROT_90);
+    }
+    else {
+        lv_port_disp_set_rotation(LV_DISP_ROT_270);
+    }
+
+    ui_utils_init();
+    ui_splash_init();
+    ui_big_number_init();
+}
+
+int main(int argc, char **argv) {
+    const char *out_dir = ".";
+    replay_stats_t stats;
+    int first = 1;
+
+    if ((argc > 2) && (strcmp(argv[1], "-o") == 0)) {
+        out_dir = argv[2];
+        first = 3;
+    }
+    if (first >= argc) {
+        fprintf(stderr, "usage: %s [-o out_dir] sequence...\n", argv[0]);
+        return 2;
+    }
+
+    sim_init();
+    memset(&stats, 0, sizeof(stats));
+
+    for (int i = first; i < argc; i++) {
+        if (replay_file(argv[i], out_dir, &stats) != 0) {
+            return 1;
+        }
+    }
+
+    const ui_big_number_stats_t *labels = ui_big_number_get_stats();
+    printf("total: %lu steps, %lu frames, render %llu us (max %lu us/frame), invalidated %llu px, flushed %llu px, %lu PPM\n",
+           (unsigned long) stats.steps, (unsigned long) stats.frames, (unsigned long long) stats.render_us,
+           (unsigned long) stats.max_render_us, (unsigned long long) stats.invalidated_px,
+           (unsigned long long) stats.flushed_px, (unsigned long) stats.ppm_files);
+    printf("labels: %lu updates (%lu skipped), %lu label sets (%lu skipped)\n",
+           (unsigned long) labels->updates, (unsigned long) labels->skipped_updates,
+           (unsigned long) labels->label_sets, (unsigned long) labels->skipped_sets);
+#if LV_USE_FONT_COMPRESSED && LV_FONT_GLYPH_CACHE_SLOTS
+    const lv_font_glyph_cache_stats_t *glyphs = lv_font_glyph_cache_get_stats();
+    printf("glyph cache: %lu hits, %lu misses, %lu evictions, %lu bypass\n",
+           (unsigned long) glyphs->hits, (unsigned long) glyphs->misses,
+           (unsigned long) glyphs->evictions, (unsigned long) glyphs->bypass);
+#else
+    printf("glyph cache: disabled\n");
+#endif
+
+    return (stats.frames > 0) ? 0 : 1;
+}
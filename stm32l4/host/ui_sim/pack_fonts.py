@@ -0,0 +1,61 @@
+#!/usr/bin/env python3
+"""
+Fonts from the resource pack render like the built-in ones: converts the
+fonts of resource.c with tools/font_bin.py, packs them with res_pack.py,
+replays a sequence with ui_sim without and with the pack and compares the
+frames. ui_sim reports the heap taken by the lv_font_load() copies.
+
+Usage:
+    pack_fonts.py <ui_sim binary> <tools dir> <fonts dir> <work dir> <sequence>
+"""
+
+import filecmp
+import os
+import re
+import subprocess
+import sys
+
+FONTS = ["abadi_36", "abadi_40", "abadi_44"]
+
+
+def replay(binary, work, frames, sequence):
+    os.makedirs(frames, exist_ok=True)
+    output = subprocess.run([binary, "-o", frames, sequence], cwd=work, check=True,
+                            stdout=subprocess.PIPE, universal_newlines=True).stdout
+    heap = re.search(r"^resources: (\d+) bytes of heap", output, re.M)
+    return int(heap.group(1)), sorted(f for f in os.listdir(frames) if f.endswith(".ppm"))
+
+
+def main():
+    binary, tools, fonts, work, sequence = sys.argv[1:6]
+    binary = os.path.abspath(binary)
+    os.makedirs(work, exist_ok=True)
+    pack = os.path.join(work, "resources.bin")
+    if os.path.exists(pack):
+        os.remove(pack)
+
+    builtin_heap, frames = replay(binary, work, os.path.join(work, "builtin"), sequence)
+
+    files = []
+    for name in FONTS:
+        path = os.path.join(work, name + ".bin")
+        subprocess.run([sys.executable, os.path.join(tools, "font_bin.py"),
+                        os.path.join(fonts, "lv_font_%s.c" % name), "-o", path], check=True)
+        files.append(path)
+    subprocess.run([sys.executable, os.path.join(tools, "res_pack.py"), "-o", pack] + files, check=True,
+                   stdout=subprocess.DEVNULL)
+
+    pack_heap, pack_frames = replay(binary, work, os.path.join(work, "pack"), sequence)
+    print("heap taken by the fonts: %d bytes built-in, %d bytes from the pack" % (builtin_heap, pack_heap))
+
+    failed = (pack_heap <= builtin_heap) or not frames or (frames != pack_frames)
+    for name in frames:
+        if not filecmp.cmp(os.path.join(work, "builtin", name), os.path.join(work, "pack", name), shallow=False):
+            print("%s differs" % name)
+            failed = True
+    print("FAILED" if failed else "OK")
+    sys.exit(1 if failed else 0)
+
+
+if __name__ == "__main__":
+    main()
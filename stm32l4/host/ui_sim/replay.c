@@ -0,0 +1,288 @@
+/*
+ *  replay.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "main.h"
+#include "lvgl.h"
+#include "app_config.h"
+#include "lv_port_disp.h"
+#include "lv_port_fb.h"
+#include "ui_splash.h"
+#include "ui_big_number.h"
+#include "replay.h"
+
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+
+#define REPLAY_LINE_MAX        (128)
+
+enum {
+    FIELD_SURFACE_TIME = 0,
+    FIELD_DIVE_TIME,
+    FIELD_CC_MODE,
+    FIELD_DIVE_STATE,
+    FIELD_DECO_MODE,
+    FIELD_DECO_DEPTH,
+    FIELD_DECO_TIME,
+    FIELD_DEPTH,
+    FIELD_S1,
+    FIELD_S2,
+    FIELD_S3,
+    FIELD_SETPOINT,
+    FIELD_TTS,
+    FIELD_TTS_BLINK,
+    FIELD_O2,
+    FIELD_HE,
+    FIELD_LAST_DIVE_TIME,
+    FIELD_DEPTH_UNITS,
+    FIELD_COUNT,
+};
+
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+
+/* Names used by "set" */
+static const char *const field_names[FIELD_COUNT] = {
+    "surface_time", "dive_time", "cc_mode", "dive_state", "deco_mode", "deco_depth",
+    "deco_time", "depth", "s1", "s2", "s3", "setpoint", "tts", "tts_blink", "o2", "he",
+    "last_dive_time", "depth_units",
+};
+
+static bool home_loaded = false;
+static uint32_t next_update_ms;
+
+/******************************************************************************/
+/*                                FUNCTIONS                                   */
+/******************************************************************************/
+
+static uint64_t replay_now_us(void) {
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t) now.tv_sec * 1000000 + now.tv_nsec / 1000;
+}
+
+/**
+ * @brief  Change one field, bitfields are assigned one by one
+ */
+static int replay_set(const char *name, long value) {
+    int field;
+
+    for (field = 0; field < FIELD_COUNT; field++) {
+        if (strcmp(name, field_names[field]) == 0) {
+            break;
+        }
+    }
+
+    switch (field) {
+        case FIELD_SURFACE_TIME:   system_status.surface_time_sec = (int) value; break;
+        case FIELD_DIVE_TIME:      system_status.dive_time_sec = (int) value; break;
+        case FIELD_CC_MODE:        system_status.cc_mode = (uint8_t) value; break;
+        case FIELD_DIVE_STATE:     system_status.dive_state = (uint8_t) value; break;
+        case FIELD_DECO_MODE:      system_status.deco_mode = (uint8_t) value; break;
+        case FIELD_DECO_DEPTH:     system_status.deco_depth = (uint16_t) value; break;
+        case FIELD_DECO_TIME:      system_status.deco_time = (uint16_t) value; break;
+        case FIELD_DEPTH:          system_status.current_distance = (uint16_t) value; break;
+        case FIELD_S1:             system_status.sensor[0].data = (uint16_t) value; break;
+        case FIELD_S2:             system_status.sensor[1].data = (uint16_t) value; break;
+        case FIELD_S3:             system_status.sensor[2].data = (uint16_t) value; break;
+        case FIELD_SETPOINT:       system_status.set_point.data = (uint16_t) value; break;
+        case FIELD_TTS:            system_status.time_to_surface.data = (uint16_t) value; break;
+        case FIELD_TTS_BLINK:      system_status.time_to_surface.blink = (value != 0); break;
+        case FIELD_O2:             system_status.gas_mix.O2 = (uint16_t) value; break;
+        case FIELD_HE:             system_status.gas_mix.he = (uint16_t) value; break;
+        case FIELD_LAST_DIVE_TIME: system_status.last_dive_info.total_time_last_dive = (uint32_t) value; break;
+        case FIELD_DEPTH_UNITS:    system_config.user_setting.flags.depth_units = (value != 0); break;
+        default:
+            return -1;
+    }
+    return 0;
+}
+
+/**
+ * @brief  The loop of ui_control.c on the simulated tick
+ */
+static void replay_run(uint32_t duration_ms, replay_stats_t *stats) {
+    const lv_port_fb_stats_t *fb = lv_port_fb_get_stats();
+    uint64_t invalidated_px = fb->total_invalidated_px;
+    uint64_t flushed_px = fb->total_flushed_px;
+    uint32_t frames = 0;
+    uint64_t render_us = 0;
+    uint32_t max_render_us = 0;
+
+    for (uint32_t elapsed = 0; elapsed < duration_ms; elapsed += REPLAY_TICK_MS) {
+        if (home_loaded && ((int32_t) (HAL_GetTick() - next_update_ms) >= 0)) {
+            ui_big_number_update();
+            next_update_ms = HAL_GetTick() + REPLAY_UPDATE_MS;
+        }
+
+        uint32_t fb_frames = fb->frames;
+        uint64_t start = replay_now_us();
+        lv_task_handler();
+        uint32_t us = (uint32_t) (replay_now_us() - start);
+
+        if (fb->frames != fb_frames) {
+            frames++;
+            render_us += us;
+            if (us > max_render_us) {
+                max_render_us = us;
+            }
+        }
+        host_tick_advance(REPLAY_TICK_MS);
+    }
+
+    invalidated_px = fb->total_invalidated_px - invalidated_px;
+    flushed_px = fb->total_flushed_px - flushed_px;
+    printf("  run %5lu ms: %3lu frames, render %7llu us (max %6lu), invalidated %8llu px, flushed %8llu px\n",
+           (unsigned long) duration_ms, (unsigned long) frames, (unsigned long long) render_us,
+           (unsigned long) max_render_us, (unsigned long long) invalidated_px, (unsigned long long) flushed_px);
+
+    stats->steps++;
+    stats->frames += frames;
+    stats->render_us += render_us;
+    if (max_render_us > stats->max_render_us) {
+        stats->max_render_us = max_render_us;
+    }
+    stats->invalidated_px += invalidated_px;
+    stats->flushed_px += flushed_px;
+}
+
+/**
+ * @brief  Full screen refreshes, the best time is the least disturbed by the host
+ */
+static void replay_redraw(uint32_t count, replay_stats_t *stats) {
+    const lv_port_fb_stats_t *fb = lv_port_fb_get_stats();
+    uint64_t render_us = 0;
+    uint32_t min_us = UINT32_MAX;
+
+    for (uint32_t i = 0; i < count; i++) {
+        uint64_t invalidated_px = fb->total_invalidated_px;
+        uint64_t flushed_px = fb->total_flushed_px;
+
+        lv_obj_invalidate(lv_scr_act());
+        uint64_t start = replay_now_us();
+        lv_refr_now(NULL);
+        uint32_t us = (uint32_t) (replay_now_us() - start);
+
+        render_us += us;
+        if (us < min_us) {
+            min_us = us;
+        }
+        if (us > stats->max_render_us) {
+            stats->max_render_us = us;
+        }
+        stats->frames++;
+        stats->render_us += us;
+        stats->invalidated_px += fb->total_invalidated_px - invalidated_px;
+        stats->flushed_px += fb->total_flushed_px - flushed_px;
+    }
+
+    if (count > 0) {
+        printf("  redraw x %lu: %llu us/frame average, %lu us best\n", (unsigned long) count,
+               (unsigned long long) (render_us / count), (unsigned long) min_us);
+    }
+}
+
+/**
+ * @brief  Execute one command line
+ */
+static int replay_command(char *line, const char *out_dir, replay_stats_t *stats) {
+    char *command = strtok(line, " \t\r\n");
+    char *arg = strtok(NULL, "\r\n");
+    char path[256];
+
+    if ((command == NULL) || (command[0] == '#')) {
+        return 0;
+    }
+
+    if (strcmp(command, "splash") == 0) {
+        home_loaded = false;
+        ui_splash_loadscreen();
+    }
+    else if (strcmp(command, "home") == 0) {
+        ui_big_number_loadscreen();
+        home_loaded = true;
+        next_update_ms = HAL_GetTick();
+    }
+    else if ((strcmp(command, "menu") == 0) && (arg != NULL)) {
+        ui_big_number_set_menu_text(arg);
+    }
+    else if (strcmp(command, "idle") == 0) {
+        ui_big_number_set_menu_text(" ");
+    }
+    else if ((strcmp(command, "rotate") == 0) && (arg != NULL)) {
+        switch (atoi(arg)) {
+            case 0:   lv_port_disp_set_rotation(LV_DISP_ROT_NONE); break;
+            case 90:  lv_port_disp_set_rotation(LV_DISP_ROT_90); break;
+            case 180: lv_port_disp_set_rotation(LV_DISP_ROT_180); break;
+            case 270: lv_port_disp_set_rotation(LV_DISP_ROT_270); break;
+            default:
+                return -1;
+        }
+    }
+    else if ((strcmp(command, "set") == 0) && (arg != NULL)) {
+        char name[32];
+        long value;
+        if ((sscanf(arg, "%31s %li", name, &value) != 2) || (replay_set(name, value) != 0)) {
+            return -1;
+        }
+    }
+    else if ((strcmp(command, "run") == 0) && (arg != NULL)) {
+        replay_run((uint32_t) strtoul(arg, NULL, 0), stats);
+    }
+    else if ((strcmp(command, "redraw") == 0) && (arg != NULL)) {
+        replay_redraw((uint32_t) strtoul(arg, NULL, 0), stats);
+    }
+    else if ((strcmp(command, "frame") == 0) && (arg != NULL)) {
+        snprintf(path, sizeof(path), "%s/%s.ppm", out_dir, arg);
+        if (lv_port_fb_write_ppm(path) != 0) {
+            fprintf(stderr, "cannot write %s\n", path);
+            return -1;
+        }
+        printf("  frame %s\n", path);
+        stats->ppm_files++;
+    }
+    else {
+        return -1;
+    }
+    return 0;
+}
+
+/*!
+ * @brief  Replay a sequence file, print one line per "run" step
+ */
+int replay_file(const char *path, const char *out_dir, replay_stats_t *stats) {
+    char line[REPLAY_LINE_MAX];
+    int line_number = 0;
+
+    FILE *file = fopen(path, "r");
+    if (file == NULL) {
+        fprintf(stderr, "cannot open %s\n", path);
+        return -1;
+    }
+
+    printf("%s\n", path);
+    while (fgets(line, sizeof(line), file) != NULL) {
+        line_number++;
+        if (replay_command(line, out_dir, stats) != 0) {
+            fprintf(stderr, "%s:%d: invalid command\n", path, line_number);
+            fclose(file);
+            return -1;
+        }
+    }
+
+    fclose(file);
+    return 0;
+}
@@ -0,0 +1,75 @@
+/*
+ *  replay.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef _REPLAY_H_
+#define _REPLAY_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************************************************************/
+
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+
+#include <stdint.h>
+
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+
+/*
+ * A sequence is a text file, one command per line, '#' starts a comment:
+ *
+ *   splash                 load the splash screen
+ *   home                   load the big number screen, updated every 500 ms like ui_control.c
+ *   menu <text>            ui_big_number_set_menu_text()
+ *   idle                   back to the idle layout (empty menu text)
+ *   rotate <0|90|180|270>  lv_port_disp_set_rotation()
+ *   set <field> <value>    change a system_status/system_config field (see replay.c)
+ *   run <ms>               run the UI loop for <ms> of simulated time
+ *   redraw <n>             invalidate and render the whole screen <n> times (benchmark)
+ *   frame <name>           dump the framebuffer into <out_dir>/<name>.ppm
+ *
+ * Time only moves in "run" (host_tick_freeze()), so animations and
+ * invalidated areas do not depend on the host speed. The render time is
+ * measured on the host clock around lv_task_handler().
+ */
+#define REPLAY_TICK_MS         (10)     /* lv_task_handler() period */
+#define REPLAY_UPDATE_MS       (500)    /* Screen update period of ui_control.c */
+
+typedef struct {
+    uint32_t steps;                 /* "run" commands */
+    uint32_t frames;                /* Refresh cycles that drew something */
+    uint64_t render_us;             /* Host time of those refresh cycles */
+    uint32_t max_render_us;
+    uint64_t invalidated_px;
+    uint64_t flushed_px;
+    uint32_t ppm_files;
+} replay_stats_t;
+
+/******************************************************************************/
+/*                                FUNCTIONS                                   */
+/******************************************************************************/
+
+/*!
+ * @brief  Replay a sequence file, print one line per "run" step
+ * @param  path: Sequence file
+ * @param  out_dir: Directory of the PPM frames
+ * @param  stats: Accumulated statistics
+ * @retval 0 if success, -1 on a file, syntax or output error
+ */
+int replay_file(const char *path, const char *out_dir, replay_stats_t *stats);
+
+/******************************************************************************/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _REPLAY_H_ */
@@ -0,0 +1,157 @@
+#!/usr/bin/env python3
+"""
+Convert an LVGL 7 font source (lv_font_conv --format lvgl, compressed with
+font_compress.py or not) into the binary format read by lv_font_load()
+(lvgl/src/lv_font/lv_font_loader.c), for the resource pack. The glyph
+bitmaps are copied as they are, the font renders the same as the built-in
+copy.
+
+Tables (little endian, each starts with uint32 length and a 4 char label):
+    head    font_header_bin_t of lv_font_loader.c
+    cmap    subtable count, cmap_table_bin_t[], unicode lists
+    loca    glyph count, glyph offsets in glyf (uint16 or uint32)
+    glyf    per glyph: adv_w, ofs_x, ofs_y, box_w, box_h bit fields padded
+            to whole bytes, then the glyph bitmap
+    kern    sorted pairs or class table
+
+Supported: FORMAT0_TINY and SPARSE_TINY cmaps, kerning pairs and classes.
+
+Usage:
+    font_bin.py <lv_font_xx.c> -o <font.bin>
+"""
+
+import argparse
+import re
+import struct
+import sys
+
+CMAP_TYPES = {"LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY": 2, "LV_FONT_FMT_TXT_CMAP_SPARSE_TINY": 3}
+HEADER = struct.Struct("<IHHHhHhHhhHHBBBBBBBBBBhH")
+CMAP = struct.Struct("<IIHHHBB")
+
+
+def field(text, name, default=None):
+    match = re.search(r"\.%s\s*=\s*(-?[\w&]+)" % name, text)
+    if match is None:
+        if default is None:
+            sys.exit("%s not found" % name)
+        return default
+    return int(match.group(1), 0) if re.match(r"-?\d", match.group(1)) else match.group(1)
+
+
+def array(text, name):
+    match = re.search(r"\b%s\[\]\s*=\s*\{(.*?)\};" % name, text, re.S)
+    if match is None:
+        sys.exit("%s[] not found" % name)
+    return [int(v, 0) for v in re.findall(r"-?0x[0-9a-fA-F]+|-?\d+", re.sub(r"/\*.*?\*/", "", match.group(1)))]
+
+
+def bits_for(values, signed=False):
+    bits = 1 if signed else 0
+    for value in values:
+        needed = (value if value >= 0 else ~value).bit_length() + (1 if signed else 0)
+        bits = max(bits, needed)
+    return bits
+
+
+def table(label, data):
+    return struct.pack("<I4s", 8 + len(data), label) + data
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    parser.add_argument("font")
+    parser.add_argument("-o", "--output", required=True)
+    args = parser.parse_args()
+
+    text = open(args.font).read()
+    bitmap = bytes(array(text, "glyph_bitmap"))
+    dsc = re.compile(r"\{\.bitmap_index = (\d+), \.adv_w = (-?\d+), \.box_w = (\d+), \.box_h = (\d+), "
+                     r"\.ofs_x = (-?\d+), \.ofs_y = (-?\d+)\}")
+    glyphs = [tuple(int(v) for v in m.groups()) for m in dsc.finditer(text)]
+    if not glyphs:
+        sys.exit("glyph_dsc[] not found")
+
+    bpp = field(text, "bpp")
+    bitmap_format = field(text, "bitmap_format", 0)
+    line_height = field(text, "line_height")
+    base_line = field(text, "base_line")
+
+    # cmap: the tiny formats map code points to consecutive glyph ids
+    cmap_block = re.search(r"cmaps\[\]\s*=\s*\{(.*?)\n\};", text, re.S).group(1)
+    cmaps = []
+    for entry in re.findall(r"\{(.*?)\}", cmap_block, re.S):
+        kind = field(entry, "type")
+        if kind not in CMAP_TYPES:
+            sys.exit("unsupported cmap %s" % kind)
+        unicode_list = array(text, field(entry, "unicode_list")) if kind.endswith("SPARSE_TINY") else []
+        cmaps.append((field(entry, "range_start"), field(entry, "range_length"), field(entry, "glyph_id_start"),
+                      CMAP_TYPES[kind], unicode_list))
+
+    cmap_data = bytearray()
+    offset = 12 + CMAP.size * len(cmaps)
+    for start, length, glyph_id, kind, unicode_list in cmaps:
+        cmap_data += CMAP.pack(offset if unicode_list else 0, start, length, glyph_id, len(unicode_list), kind, 0)
+        offset += 2 * len(unicode_list)
+    for cmap in cmaps:
+        cmap_data += struct.pack("<%dH" % len(cmap[4]), *cmap[4])
+    cmap_table = table(b"cmap", struct.pack("<I", len(cmaps)) + cmap_data)
+
+    # glyf: bit fields padded to a whole number of bytes, the loader then copies the bitmaps as is
+    xy_bits = bits_for([g[4] for g in glyphs] + [g[5] for g in glyphs], signed=True)
+    wh_bits = bits_for([g[2] for g in glyphs] + [g[3] for g in glyphs])
+    adv_bits = bits_for([g[1] for g in glyphs])
+    adv_bits += (-(adv_bits + 2 * xy_bits + 2 * wh_bits)) % 8
+
+    indexes = sorted(set(g[0] for g in glyphs)) + [len(bitmap)]
+    glyf = bytearray()
+    offsets = []
+    for index, adv_w, box_w, box_h, ofs_x, ofs_y in glyphs:
+        offsets.append(8 + len(glyf))
+        value = 0
+        for number, bits in ((adv_w, adv_bits), (ofs_x, xy_bits), (ofs_y, xy_bits), (box_w, wh_bits), (box_h, wh_bits)):
+            value = (value << bits) | (number & ((1 << bits) - 1))
+        fields = adv_bits + 2 * xy_bits + 2 * wh_bits
+        glyf += value.to_bytes(fields // 8, "big")
+        if box_w * box_h != 0:
+            glyf += bitmap[index:indexes[indexes.index(index) + 1]]
+    glyf_table = table(b"glyf", bytes(glyf))
+
+    loc_format = 0 if len(glyf_table) <= 0xFFFF else 1
+    loca_table = table(b"loca", struct.pack("<I", len(offsets)) + struct.pack("<%d%s" % (len(offsets), "HI"[loc_format]),
+                                                                              *offsets))
+
+    # kern
+    tables = [cmap_table, loca_table, glyf_table]
+    glyph_id_format = 0
+    kern_scale = field(text, "kern_scale", 0)
+    if field(text, "kern_dsc", "NULL") != "NULL":
+        if field(text, "kern_classes") == 0:
+            ids = array(text, "kern_pair_glyph_ids")
+            values = array(text, "kern_pair_values")
+            glyph_id_format = field(text, "glyph_ids_size")
+            ids_data = struct.pack("<%d%s" % (len(ids), "BH"[glyph_id_format]), *ids)
+            kern = struct.pack("<B3xI", 0, len(values)) + ids_data + struct.pack("<%db" % len(values), *values)
+        else:
+            left = array(text, "kern_left_class_mapping")
+            right = array(text, "kern_right_class_mapping")
+            values = array(text, "kern_class_values")
+            rows, cols = field(text, "left_class_cnt"), field(text, "right_class_cnt")
+            kern = struct.pack("<B3xHBB", 3, len(left), rows, cols) + bytes(left) + bytes(right) + \
+                struct.pack("<%db" % len(values), *values)
+        tables.append(table(b"kern", kern))
+
+    size = re.search(r"Size: (\d+) px", text)
+    ascent = line_height - base_line
+    header = HEADER.pack(1, len(tables), int(size.group(1)) if size else line_height, ascent, -base_line,
+                         ascent, -base_line, 0, -base_line, ascent, 0, kern_scale, loc_format, glyph_id_format, 1,
+                         bpp, xy_bits, wh_bits, adv_bits, bitmap_format, 0, 0,
+                         field(text, "underline_position", 0), field(text, "underline_thickness", 0))
+
+    data = table(b"head", header) + b"".join(tables)
+    open(args.output, "wb").write(data)
+    sys.stderr.write("%s: %d glyphs, %d bytes\n" % (args.output, len(glyphs), len(data)))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,228 @@
+#!/usr/bin/env python3
+"""
+Convert an LVGL 7 font source (lv_font_conv --format lvgl --no-compress)
+into the compressed bitmap format (bitmap_format = 1), the same glyph
+bitmaps lv_font_conv writes without --no-compress.
+
+Each glyph is prefiltered (every line XORed with the line above) and RLE
+encoded for rle_next() of lvgl/src/lv_font/lv_font_fmt_txt.c:
+    value                   bpp bits, a value equal to the previous one
+                            starts a repeat
+    repeat                  1 bit per pixel: 1 = same value again,
+                            0 = a new value (bpp bits) follows
+    after 10 repeat bits    6 bit counter, the value repeats counter - 1
+                            more times then a new value follows (0: the
+                            new value follows at once)
+The encoded glyphs are decoded back and compared before writing.
+
+Usage:
+    font_compress.py <lv_font_xx.c> [-o <output.c>]
+"""
+
+import argparse
+import re
+import sys
+
+REPEAT_BITS = 10
+COUNTER_BITS = 6
+COUNTER_MAX = (1 << COUNTER_BITS) - 1
+
+
+class BitWriter:
+    def __init__(self):
+        self.data = bytearray()
+        self.bits = 0
+
+    def write(self, value, length):
+        for i in range(length - 1, -1, -1):
+            if self.bits % 8 == 0:
+                self.data.append(0)
+            if (value >> i) & 1:
+                self.data[-1] |= 0x80 >> (self.bits % 8)
+            self.bits += 1
+
+
+class BitReader:
+    def __init__(self, data):
+        self.data = data
+        self.pos = 0
+
+    def read(self, length):
+        value = 0
+        for _ in range(length):
+            byte = self.data[self.pos // 8] if self.pos // 8 < len(self.data) else 0
+            value = (value << 1) | ((byte >> (7 - self.pos % 8)) & 1)
+            self.pos += 1
+        return value
+
+
+def rle_encode(pixels, bpp):
+    out = BitWriter()
+    single = True
+    prev = 0
+    count = 0
+    i = 0
+    while i < len(pixels):
+        value = pixels[i]
+        if single:
+            out.write(value, bpp)
+            if i > 0 and value == prev:
+                single = False
+                count = 0
+            prev = value
+            i += 1
+            continue
+
+        count += 1
+        if value != prev:
+            out.write(0, 1)
+            out.write(value, bpp)
+            prev = value
+            single = True
+            i += 1
+            continue
+
+        out.write(1, 1)
+        i += 1
+        if count <= REPEAT_BITS:
+            continue
+
+        # Counter: this pixel and counter - 1 more repeat, then a new value
+        run = 0
+        while i + run < len(pixels) and pixels[i + run] == prev and run < COUNTER_MAX - 1:
+            run += 1
+        counter = run + 1
+        if run == 0:
+            counter = 0
+            i -= 1          # The new value read at once is this pixel
+        out.write(counter, COUNTER_BITS)
+        i += max(counter - 1, 0)
+        if i < len(pixels):
+            prev = pixels[i]
+            out.write(prev, bpp)
+            i += 1
+        single = True
+    return bytes(out.data)
+
+
+def rle_decode(data, bpp, count):
+    """rle_next() of lv_font_fmt_txt.c"""
+    inp = BitReader(data)
+    pixels = []
+    single, repeat, counter = 0, 1, 2
+    state = single
+    prev = 0
+    cnt = 0
+    while len(pixels) < count:
+        if state == single:
+            value = inp.read(bpp)
+            if inp.pos != bpp and prev == value:
+                cnt = 0
+                state = repeat
+            prev = value
+        elif state == repeat:
+            bit = inp.read(1)
+            cnt += 1
+            if bit == 1:
+                value = prev
+                if cnt == REPEAT_BITS + 1:
+                    cnt = inp.read(COUNTER_BITS)
+                    if cnt != 0:
+                        state = counter
+                    else:
+                        value = inp.read(bpp)
+                        prev = value
+                        state = single
+            else:
+                value = inp.read(bpp)
+                prev = value
+                state = single
+        else:
+            value = prev
+            cnt -= 1
+            if cnt == 0:
+                value = inp.read(bpp)
+                prev = value
+                state = single
+        pixels.append(value)
+    return pixels
+
+
+def prefilter(pixels, width, height, inverse=False):
+    out = list(pixels)
+    for y in range(height - 1, 0, -1) if not inverse else range(1, height):
+        for x in range(width):
+            above = (pixels if not inverse else out)[(y - 1) * width + x]
+            out[y * width + x] = out[y * width + x] ^ above
+    return out
+
+
+def glyph_pixels(bitmap, index, width, height, bpp):
+    reader = BitReader(bitmap[index:])
+    return [reader.read(bpp) for _ in range(width * height)]
+
+
+def parse(text):
+    match = re.search(r"(glyph_bitmap\[\]\s*=\s*\{)(.*?)(\};)", text, re.S)
+    if match is None:
+        sys.exit("glyph_bitmap[] not found")
+    body = match.group(2)
+    bitmap = bytes(int(v, 16) for v in re.findall(r"0x[0-9a-fA-F]+", re.sub(r"/\*.*?\*/", "", body)))
+    comments = re.findall(r"/\* U\+[0-9A-F]+ .*?\*/", body)
+
+    bpp = int(re.search(r"\.bpp\s*=\s*(\d+)", text).group(1))
+    fmt = int(re.search(r"\.bitmap_format\s*=\s*(\d+)", text).group(1))
+    if fmt != 0:
+        sys.exit("the font is already compressed")
+    if bpp not in (1, 2, 4, 8):
+        sys.exit("unsupported bpp %d" % bpp)
+
+    dsc = re.compile(r"\{\.bitmap_index = (\d+), \.adv_w = (-?\d+), \.box_w = (\d+), \.box_h = (\d+)")
+    glyphs = [(int(m.group(1)), int(m.group(3)), int(m.group(4))) for m in dsc.finditer(text)]
+    return match, bitmap, comments, bpp, glyphs
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    parser.add_argument("font")
+    parser.add_argument("-o", "--output")
+    args = parser.parse_args()
+
+    text = open(args.font).read()
+    match, bitmap, comments, bpp, glyphs = parse(text)
+
+    # Glyph 0 is reserved, every other glyph has a comment (even without pixels)
+    if len(glyphs) - 1 != len(comments):
+        sys.exit("%d glyphs but %d bitmap comments" % (len(glyphs) - 1, len(comments)))
+
+    lines = []
+    offsets = [0]
+    size = 0
+    for (index, width, height), comment in zip(glyphs[1:], comments):
+        pixels = glyph_pixels(bitmap, index, width, height, bpp)
+        encoded = rle_encode(prefilter(pixels, width, height), bpp)
+        if prefilter(rle_decode(encoded, bpp, width * height), width, height, inverse=True) != pixels:
+            sys.exit("round trip failed for %s" % comment)
+
+        offsets.append(size)
+        lines.append("    " + comment)
+        for i in range(0, len(encoded), 8):
+            lines.append("    " + " ".join("0x%x," % b for b in encoded[i:i + 8]))
+        size += len(encoded)
+
+    # get_bits() may read one byte past the last glyph
+    lines.append("    0x0")
+    size += 1
+
+    out = text[:match.start()] + match.group(1) + "\n" + "\n".join(lines) + "\n" + match.group(3) + text[match.end():]
+    glyph_id = iter(range(len(offsets)))
+    out = re.sub(r"\{\.bitmap_index = \d+,", lambda m: "{.bitmap_index = %d," % offsets[next(glyph_id)], out)
+    out = out.replace(".bitmap_format = 0,", ".bitmap_format = 1,", 1)
+    out = out.replace(" --no-compress", "", 1)
+
+    sys.stderr.write("%s: glyph bitmaps %d -> %d bytes\n" % (args.font, len(bitmap), size))
+    open(args.output or args.font, "w").write(out)
+
+
+if __name__ == "__main__":
+    main()
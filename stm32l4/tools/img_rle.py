@@ -0,0 +1,169 @@
+#!/usr/bin/env python3
+"""
+Convert raw RGB565 image arrays (LV_IMG_CF_TRUE_COLOR, 16 bit, little endian)
+into the line indexed RLE format decoded by ui/port/lv_port_img.c.
+
+Format (little endian):
+    char     magic[4]            "TSRL"
+    uint16   width
+    uint16   height
+    uint16   palette_count       <= 255
+    uint16   reserved
+    uint16   palette[palette_count]
+    uint32   line_offset[height] offset of each line from the start of the stream
+    uint8    stream[]
+
+Each line is a sequence of packets, a control byte followed by values:
+    0x80 | (n - 1)   run, one value repeated n times (n <= 128)
+    n - 1            literal, n values follow (n <= 128)
+A value is a palette index (1 byte) or 0xFF followed by the raw RGB565 color.
+
+Usage:
+    img_rle.py <input.c> <array_name> <width> <height> [--name <output_name>] [--bin <file>]
+The C array is printed to stdout, --bin also writes the raw image (e.g. for res_pack.py).
+"""
+
+import argparse
+import re
+import struct
+import sys
+from collections import Counter
+
+MAGIC = b"TSRL"
+ESCAPE = 0xFF
+MAX_PACKET = 128
+
+
+def read_array(path, name, width, height):
+    text = open(path).read()
+    match = re.search(r"\b" + re.escape(name) + r"\[\]\s*=\s*\{(.*?)\};", text, re.S)
+    if match is None:
+        sys.exit("array %s not found in %s" % (name, path))
+
+    raw = bytes(int(v, 16) for v in re.findall(r"0x[0-9a-fA-F]+", match.group(1)))
+    if len(raw) < width * height * 2:
+        sys.exit("array %s is %d bytes, expected %d" % (name, len(raw), width * height * 2))
+
+    raw = raw[:width * height * 2]
+    return list(struct.unpack("<%dH" % (width * height), raw))
+
+
+def encode_value(value, palette):
+    if value in palette:
+        return bytes([palette[value]])
+    return bytes([ESCAPE]) + struct.pack("<H", value)
+
+
+def encode_line(pixels, palette):
+    out = bytearray()
+    literal = []
+
+    def flush():
+        while literal:
+            chunk = literal[:MAX_PACKET]
+            del literal[:MAX_PACKET]
+            out.append(len(chunk) - 1)
+            for value in chunk:
+                out.extend(encode_value(value, palette))
+
+    i = 0
+    while i < len(pixels):
+        j = i
+        while j < len(pixels) and pixels[j] == pixels[i] and j - i < MAX_PACKET:
+            j += 1
+
+        if j - i >= 2:
+            flush()
+            out.append(0x80 | (j - i - 1))
+            out.extend(encode_value(pixels[i], palette))
+            i = j
+        else:
+            literal.append(pixels[i])
+            i += 1
+
+    flush()
+    return out
+
+
+def encode(pixels, width, height):
+    colors = [c for c, _ in Counter(pixels).most_common(ESCAPE)]
+    palette = {c: i for i, c in enumerate(colors)}
+
+    stream = bytearray()
+    offsets = []
+    for y in range(height):
+        offsets.append(len(stream))
+        stream.extend(encode_line(pixels[y * width:(y + 1) * width], palette))
+
+    blob = bytearray(MAGIC)
+    blob.extend(struct.pack("<HHHH", width, height, len(colors), 0))
+    blob.extend(struct.pack("<%dH" % len(colors), *colors))
+    blob.extend(struct.pack("<%dI" % height, *offsets))
+    blob.extend(stream)
+    return bytes(blob)
+
+
+def decode(blob):
+    width, height, count, _ = struct.unpack_from("<HHHH", blob, 4)
+    palette = struct.unpack_from("<%dH" % count, blob, 12)
+    offsets = struct.unpack_from("<%dI" % height, blob, 12 + 2 * count)
+    base = 12 + 2 * count + 4 * height
+
+    def value(pos):
+        if blob[pos] == ESCAPE:
+            return struct.unpack_from("<H", blob, pos + 1)[0], pos + 3
+        return palette[blob[pos]], pos + 1
+
+    pixels = []
+    for y in range(height):
+        pos = base + offsets[y]
+        line = []
+        while len(line) < width:
+            ctrl = blob[pos]
+            pos += 1
+            n = (ctrl & 0x7F) + 1
+            if ctrl & 0x80:
+                v, pos = value(pos)
+                line.extend([v] * n)
+            else:
+                for _ in range(n):
+                    v, pos = value(pos)
+                    line.append(v)
+        pixels.extend(line)
+    return pixels
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Convert a raw RGB565 C array into the TSRL format")
+    parser.add_argument("input")
+    parser.add_argument("array")
+    parser.add_argument("width", type=int)
+    parser.add_argument("height", type=int)
+    parser.add_argument("--name", help="output array name (default: <array>_rle)")
+    parser.add_argument("--bin", help="also write the encoded image to this file")
+    args = parser.parse_args()
+
+    pixels = read_array(args.input, args.array, args.width, args.height)
+    blob = encode(pixels, args.width, args.height)
+    if decode(blob) != pixels:
+        sys.exit("round trip check failed")
+
+    if args.bin:
+        with open(args.bin, "wb") as f:
+            f.write(blob)
+
+    name = args.name or args.array + "_rle"
+    print("/* %dx%d, %d -> %d bytes */" % (args.width, args.height, len(pixels) * 2, len(blob)))
+    print("const uint8_t %s[] = {" % name)
+    for i in range(0, len(blob), 22):
+        print("    " + "".join("0x%02x, " % b for b in blob[i:i + 22]))
+    print("};")
+    print()
+    print("const uint32_t %s_size = sizeof(%s);" % (name, name))
+
+    print("%s: %d -> %d bytes (%.1f%%)" % (args.array, len(pixels) * 2, len(blob),
+                                           100.0 * len(blob) / (len(pixels) * 2)), file=sys.stderr)
+
+
+if __name__ == "__main__":
+    main()
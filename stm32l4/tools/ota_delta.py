@@ -0,0 +1,163 @@
+#!/usr/bin/env python3
+"""
+Build a delta OTA image: the operations rebuilding a new application binary
+from the one installed on the device (bootloader App/delta.h). The result is
+sent as is with the OTA commands, the bootloader rebuilds the new image in
+the W25Q scratch area, checks it, then programs it.
+
+Layout (little endian):
+    uint32   magic               "TSDP"
+    uint16   version             1
+    uint16   reserved
+    uint32   old_size
+    uint32   old_crc             CRC-32/MPEG-2 of the installed image
+    uint32   new_size
+    uint32   new_crc             CRC-32/MPEG-2 of the new image
+    operations, until new_size bytes are produced:
+        uint8 0, uint32 offset, uint32 length    copy from the installed image
+        uint8 1, uint32 length, bytes[length]    insert new bytes
+
+Usage:
+    ota_delta.py -o update.tsdp installed.bin new.bin
+"""
+
+import argparse
+import struct
+import sys
+
+MAGIC = 0x50445354
+VERSION = 1
+OP_COPY = 0
+OP_INSERT = 1
+BLOCK = 8                       # Bytes hashed to find matches
+MIN_COPY = 16                   # Shorter matches cost more than inserting
+MAX_SIZE = 0x100000 - 0xA000
+HEADER = struct.Struct("<IHHIIII")
+
+
+def crc_table():
+    table = []
+    for i in range(256):
+        crc = i << 24
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x04C11DB7) if crc & 0x80000000 else (crc << 1)
+        table.append(crc & 0xFFFFFFFF)
+    return table
+
+
+CRC_TABLE = crc_table()
+
+
+def crc32_mpeg2(data):
+    crc = 0xFFFFFFFF
+    for byte in data:
+        crc = ((crc << 8) & 0xFFFFFFFF) ^ CRC_TABLE[(crc >> 24) ^ byte]
+    return crc
+
+
+def match_length(old, src, new, dst):
+    length = 0
+    limit = min(len(old) - src, len(new) - dst)
+    # Compare large slices first, then byte by byte
+    step = 256
+    while step:
+        while length + step <= limit and old[src + length:src + length + step] == new[dst + length:dst + length + step]:
+            length += step
+        step //= 4
+    return length
+
+
+def diff(old, new):
+    index = {}
+    for i in range(len(old) - BLOCK, -1, -1):
+        index[old[i:i + BLOCK]] = i
+
+    ops = []
+    insert = bytearray()
+    pos = 0
+    expected = None             # Continuation of the previous copy, same offset shift
+    while pos < len(new):
+        best_len, best_src = 0, 0
+        for src in (expected, index.get(new[pos:pos + BLOCK])):
+            if src is None or src >= len(old):
+                continue
+            length = match_length(old, src, new, pos)
+            if length > best_len:
+                best_len, best_src = length, src
+
+        if best_len >= MIN_COPY:
+            if insert:
+                ops.append((OP_INSERT, bytes(insert)))
+                insert = bytearray()
+            ops.append((OP_COPY, best_src, best_len))
+            pos += best_len
+            expected = best_src + best_len
+        else:
+            insert.append(new[pos])
+            pos += 1
+            if expected is not None:
+                expected += 1
+    if insert:
+        ops.append((OP_INSERT, bytes(insert)))
+
+    out = bytearray(HEADER.pack(MAGIC, VERSION, 0, len(old), crc32_mpeg2(old), len(new), crc32_mpeg2(new)))
+    for op in ops:
+        if op[0] == OP_COPY:
+            out += struct.pack("<BII", OP_COPY, op[1], op[2])
+        else:
+            out += struct.pack("<BI", OP_INSERT, len(op[1])) + op[1]
+    return bytes(out), ops
+
+
+def apply(old, patch):
+    magic, version, _, old_size, old_crc, new_size, new_crc = HEADER.unpack_from(patch)
+    if (magic, version) != (MAGIC, VERSION):
+        raise ValueError("not a TSDP image")
+    if (len(old), crc32_mpeg2(old)) != (old_size, old_crc):
+        raise ValueError("patch built for another image")
+
+    new = bytearray()
+    pos = HEADER.size
+    while len(new) < new_size:
+        op = patch[pos]
+        if op == OP_COPY:
+            offset, length = struct.unpack_from("<II", patch, pos + 1)
+            new += old[offset:offset + length]
+            pos += 9
+        else:
+            length, = struct.unpack_from("<I", patch, pos + 1)
+            new += patch[pos + 5:pos + 5 + length]
+            pos += 5 + length
+
+    if crc32_mpeg2(new) != new_crc:
+        raise ValueError("CRC mismatch")
+    return bytes(new)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Build a delta OTA image")
+    parser.add_argument("-o", "--output", required=True)
+    parser.add_argument("old")
+    parser.add_argument("new")
+    args = parser.parse_args()
+
+    old = open(args.old, "rb").read()
+    new = open(args.new, "rb").read()
+    for name, data in ((args.old, old), (args.new, new)):
+        if not data or len(data) > MAX_SIZE:
+            sys.exit("%s is %d bytes, expected 1 to %d" % (name, len(data), MAX_SIZE))
+
+    patch, ops = diff(old, new)
+    if apply(old, patch) != new:
+        sys.exit("round trip check failed")
+
+    with open(args.output, "wb") as f:
+        f.write(patch)
+
+    copied = sum(op[2] for op in ops if op[0] == OP_COPY)
+    print("%s: %d bytes, %d copied, %d inserted, patch %d bytes (%.1f%%)"
+          % (args.new, len(new), copied, len(new) - copied, len(patch), 100.0 * len(patch) / len(new)))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,145 @@
+#!/usr/bin/env python3
+"""
+Compress an application binary into the TSLZ image decompressed by the
+bootloader while it programs the internal flash (bootloader App/lzss.h).
+The result is sent as is with the OTA commands; the OTA checksum covers the
+compressed file, the header checksum the decompressed image.
+
+Layout (little endian):
+    uint32   magic               "TSLZ"
+    uint16   version             1
+    uint8    window_bits         12, 4 KB window
+    uint8    length_bits         4, matches of 3 to 18 bytes
+    uint32   size                decompressed size
+    uint32   checksum            additive checksum of the decompressed bytes
+    stream[]
+
+The stream is a flag byte for each group of 8 items, LSB first:
+    1    literal, one byte follows
+    0    match, uint16: offset - 1 in the low 12 bits, length - 3 in the high 4 bits
+
+Usage:
+    ota_pack.py -o firmware.tslz firmware.bin
+"""
+
+import argparse
+import struct
+import sys
+
+MAGIC = 0x5A4C5354
+VERSION = 1
+WINDOW_BITS = 12
+LENGTH_BITS = 4
+MIN_MATCH = 3
+WINDOW = 1 << WINDOW_BITS
+MAX_MATCH = MIN_MATCH + (1 << LENGTH_BITS) - 1
+MAX_CHAIN = 256
+MAX_SIZE = 0x100000 - 0xA000
+HEADER = struct.Struct("<IHBBII")
+
+
+def find_match(data, pos, chains):
+    best_len, best_off = 0, 0
+    end = min(len(data), pos + MAX_MATCH)
+    for start in reversed(chains.get(data[pos:pos + MIN_MATCH], [])[-MAX_CHAIN:]):
+        if pos - start > WINDOW:
+            break
+        length = 0
+        while pos + length < end and data[start + length] == data[pos + length]:
+            length += 1
+        if length > best_len:
+            best_len, best_off = length, pos - start
+            if length == MAX_MATCH:
+                break
+    return best_len, best_off
+
+
+def encode(data):
+    out = bytearray()
+    chains = {}
+    items = []
+    pos = 0
+
+    def add(start, stop):
+        for i in range(start, min(stop, len(data) - MIN_MATCH + 1)):
+            chains.setdefault(data[i:i + MIN_MATCH], []).append(i)
+
+    def flush():
+        flags = 0
+        for i, item in enumerate(items):
+            if len(item) == 1:
+                flags |= 1 << i
+        out.append(flags)
+        for item in items:
+            out.extend(item)
+        items.clear()
+
+    while pos < len(data):
+        length, offset = find_match(data, pos, chains)
+        if length >= MIN_MATCH:
+            items.append(struct.pack("<H", (offset - 1) | ((length - MIN_MATCH) << WINDOW_BITS)))
+        else:
+            length = 1
+            items.append(data[pos:pos + 1])
+        add(pos, pos + length)
+        pos += length
+        if len(items) == 8:
+            flush()
+    if items:
+        flush()
+
+    return HEADER.pack(MAGIC, VERSION, WINDOW_BITS, LENGTH_BITS, len(data), sum(data) & 0xFFFFFFFF) + bytes(out)
+
+
+def decode(blob):
+    magic, version, window_bits, length_bits, size, checksum = HEADER.unpack_from(blob)
+    if (magic, version, window_bits, length_bits) != (MAGIC, VERSION, WINDOW_BITS, LENGTH_BITS):
+        raise ValueError("not a TSLZ image")
+
+    out = bytearray()
+    pos = HEADER.size
+    bits = 0
+    while len(out) < size:
+        if bits == 0:
+            flags = blob[pos]
+            pos += 1
+            bits = 8
+        if flags & 1:
+            out.append(blob[pos])
+            pos += 1
+        else:
+            match, = struct.unpack_from("<H", blob, pos)
+            pos += 2
+            offset = (match & (WINDOW - 1)) + 1
+            for _ in range((match >> WINDOW_BITS) + MIN_MATCH):
+                out.append(out[-offset])
+        flags >>= 1
+        bits -= 1
+
+    if sum(out) & 0xFFFFFFFF != checksum:
+        raise ValueError("checksum mismatch")
+    return bytes(out)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Build a compressed OTA image")
+    parser.add_argument("-o", "--output", required=True)
+    parser.add_argument("input")
+    args = parser.parse_args()
+
+    data = open(args.input, "rb").read()
+    if not data or len(data) > MAX_SIZE:
+        sys.exit("%s is %d bytes, expected 1 to %d" % (args.input, len(data), MAX_SIZE))
+
+    blob = encode(data)
+    if decode(blob) != data:
+        sys.exit("round trip check failed")
+
+    with open(args.output, "wb") as f:
+        f.write(blob)
+
+    print("%s: %d -> %d bytes (%.1f%%)" % (args.input, len(data), len(blob), 100.0 * len(blob) / len(data)))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,92 @@
+#!/usr/bin/env python3
+"""
+Build the resource pack programmed at RESOURCE_PACK_ADDRESS in the W25Q
+(see ui/resource/res_pack.h).
+
+Layout (little endian):
+    uint32   magic               "TSRP"
+    uint16   version             1
+    uint16   count
+    uint32   size                whole pack in bytes
+    uint32   index_checksum      additive checksum of the entry table
+    entry[count]:
+        char     name[24]        zero terminated
+        uint32   offset          from the start of the pack
+        uint32   size
+    data                         each resource aligned on 4 bytes
+
+Resources used by the firmware (ui/resource/resource.c):
+    abadi_36.bin, abadi_40.bin, abadi_44.bin
+        font_bin.py lv_font_abadi_xx.c (or lv_font_conv --format bin with
+        the options listed at the top of the C file). Loaded into the heap,
+        36920 bytes for the three. abadi_18, 24 and 78 are not used by the
+        UI and stay out of the pack.
+    logo_marine.rle, logo_rebtek.rle
+        img_rle.py --bin
+
+Usage:
+    res_pack.py -o resources.bin [name=]file ...
+"""
+
+import argparse
+import os
+import struct
+import sys
+
+MAGIC = 0x50525354
+VERSION = 1
+NAME_LEN = 24
+MAX_ENTRIES = 16
+MAX_SIZE = 0x400000
+HEADER = struct.Struct("<IHHII")
+ENTRY = struct.Struct("<%dsII" % NAME_LEN)
+
+
+def build(resources):
+    if len(resources) > MAX_ENTRIES:
+        sys.exit("too many resources (max %d)" % MAX_ENTRIES)
+
+    offset = HEADER.size + ENTRY.size * len(resources)
+    index = bytearray()
+    data = bytearray()
+    for name, content in resources:
+        if len(name.encode()) >= NAME_LEN:
+            sys.exit("name too long: %s" % name)
+
+        pad = (-(offset + len(data))) % 4
+        data.extend(b"\xff" * pad)
+        index.extend(ENTRY.pack(name.encode(), offset + len(data), len(content)))
+        data.extend(content)
+
+    size = offset + len(data)
+    if size > MAX_SIZE:
+        sys.exit("pack too large: %d bytes" % size)
+
+    return HEADER.pack(MAGIC, VERSION, len(resources), size, sum(index) & 0xFFFFFFFF) + index + data
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Build the W25Q resource pack")
+    parser.add_argument("-o", "--output", required=True)
+    parser.add_argument("files", nargs="+", help="[name=]file")
+    args = parser.parse_args()
+
+    resources = []
+    for arg in args.files:
+        name, _, path = arg.rpartition("=")
+        if not name:
+            name = os.path.basename(path)
+        with open(path, "rb") as f:
+            resources.append((name, f.read()))
+
+    pack = build(resources)
+    with open(args.output, "wb") as f:
+        f.write(pack)
+
+    for name, content in resources:
+        print("%-24s %8d bytes" % (name, len(content)))
+    print("%s: %d bytes" % (args.output, len(pack)))
+
+
+if __name__ == "__main__":
+    main()